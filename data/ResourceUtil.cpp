@@ -2,7 +2,7 @@
 
 #include "Resources.h"
 
-const size_t res2hNrOfFiles = 45;
+const size_t res2hNrOfFiles = 42;
 const Res2hEntry res2hFiles[res2hNrOfFiles] = {
     {":/scroll_gradient.png", scroll_gradient_png_size, scroll_gradient_png_data},
     {":/star_filled.svg", star_filled_svg_size, star_filled_svg_data},
@@ -12,7 +12,6 @@ const Res2hEntry res2hFiles[res2hNrOfFiles] = {
     {":/checkbox_unchecked.svg", checkbox_unchecked_svg_size, checkbox_unchecked_svg_data},
     {":/opensans_hebrew_condensed_regular.ttf", opensans_hebrew_condensed_regular_ttf_size, opensans_hebrew_condensed_regular_ttf_data},
     {":/on.svg", on_svg_size, on_svg_data},
-    {":/busy_3.svg", busy_3_svg_size, busy_3_svg_data},
     {":/opensans_hebrew_condensed_light.ttf", opensans_hebrew_condensed_light_ttf_size, opensans_hebrew_condensed_light_ttf_data},
     {":/checkbox_checked.svg", checkbox_checked_svg_size, checkbox_checked_svg_data},
     {":/textinput_ninepatch.png", textinput_ninepatch_png_size, textinput_ninepatch_png_data},
@@ -22,12 +21,9 @@ const Res2hEntry res2hFiles[res2hNrOfFiles] = {
     {":/frame.png", frame_png_size, frame_png_data},
     {":/slider_knob.svg", slider_knob_svg_size, slider_knob_svg_data},
     {":/button.png", button_png_size, button_png_data},
-    {":/busy_1.svg", busy_1_svg_size, busy_1_svg_data},
     {":/fav_remove.svg", fav_remove_svg_size, fav_remove_svg_data},
     {":/arrow.svg", arrow_svg_size, arrow_svg_data},
     {":/star_unfilled.svg", star_unfilled_svg_size, star_unfilled_svg_data},
-    {":/busy_2.svg", busy_2_svg_size, busy_2_svg_data},
-    {":/busy_0.svg", busy_0_svg_size, busy_0_svg_data},
     {":/fav_add.svg", fav_add_svg_size, fav_add_svg_data},
     {":/help/dpad_leftright.svg", help_dpad_leftright_svg_size, help_dpad_leftright_svg_data},
     {":/help/dpad_all.svg", help_dpad_all_svg_size, help_dpad_all_svg_data},
@@ -48,7 +44,8 @@ const Res2hEntry res2hFiles[res2hNrOfFiles] = {
     {":/help/button_r.svg", help_button_r_svg_size, help_button_r_svg_data},
     {":/help/analog_thumb.svg", help_analog_thumb_svg_size, help_analog_thumb_svg_data},
     {":/help/analog_left.svg", help_analog_left_svg_size, help_analog_left_svg_data},
-    {":/help/analog_right.svg", help_analog_right_svg_size, help_analog_right_svg_data}
+    {":/help/analog_right.svg", help_analog_right_svg_size, help_analog_right_svg_data},
+    {":/busy.svg", busy_svg_size, busy_svg_data}
 };
 
 res2hMapType::value_type mapTemp[] = {
@@ -60,43 +57,40 @@ res2hMapType::value_type mapTemp[] = {
     std::make_pair(":/checkbox_unchecked.svg", res2hFiles[5]),
     std::make_pair(":/opensans_hebrew_condensed_regular.ttf", res2hFiles[6]),
     std::make_pair(":/on.svg", res2hFiles[7]),
-    std::make_pair(":/busy_3.svg", res2hFiles[8]),
-    std::make_pair(":/opensans_hebrew_condensed_light.ttf", res2hFiles[9]),
-    std::make_pair(":/checkbox_checked.svg", res2hFiles[10]),
-    std::make_pair(":/textinput_ninepatch.png", res2hFiles[11]),
-    std::make_pair(":/option_arrow.svg", res2hFiles[12]),
-    std::make_pair(":/textinput_ninepatch_active.png", res2hFiles[13]),
-    std::make_pair(":/splash.svg", res2hFiles[14]),
-    std::make_pair(":/frame.png", res2hFiles[15]),
-    std::make_pair(":/slider_knob.svg", res2hFiles[16]),
-    std::make_pair(":/button.png", res2hFiles[17]),
-    std::make_pair(":/busy_1.svg", res2hFiles[18]),
-    std::make_pair(":/fav_remove.svg", res2hFiles[19]),
-    std::make_pair(":/arrow.svg", res2hFiles[20]),
-    std::make_pair(":/star_unfilled.svg", res2hFiles[21]),
-    std::make_pair(":/busy_2.svg", res2hFiles[22]),
-    std::make_pair(":/busy_0.svg", res2hFiles[23]),
-    std::make_pair(":/fav_add.svg", res2hFiles[24]),
-    std::make_pair(":/help/dpad_leftright.svg", res2hFiles[25]),
-    std::make_pair(":/help/dpad_all.svg", res2hFiles[26]),
-    std::make_pair(":/help/button_x.svg", res2hFiles[27]),
-    std::make_pair(":/help/button_a.svg", res2hFiles[28]),
-    std::make_pair(":/help/button_l.svg", res2hFiles[29]),
-    std::make_pair(":/help/dpad_down.svg", res2hFiles[30]),
-    std::make_pair(":/help/analog_up.svg", res2hFiles[31]),
-    std::make_pair(":/help/dpad_left.svg", res2hFiles[32]),
-    std::make_pair(":/help/button_start.svg", res2hFiles[33]),
-    std::make_pair(":/help/dpad_up.svg", res2hFiles[34]),
-    std::make_pair(":/help/analog_down.svg", res2hFiles[35]),
-    std::make_pair(":/help/button_y.svg", res2hFiles[36]),
-    std::make_pair(":/help/button_select.svg", res2hFiles[37]),
-    std::make_pair(":/help/button_b.svg", res2hFiles[38]),
-    std::make_pair(":/help/dpad_updown.svg", res2hFiles[39]),
-    std::make_pair(":/help/dpad_right.svg", res2hFiles[40]),
-    std::make_pair(":/help/button_r.svg", res2hFiles[41]),
-    std::make_pair(":/help/analog_thumb.svg", res2hFiles[42]),
-    std::make_pair(":/help/analog_left.svg", res2hFiles[43]),
-    std::make_pair(":/help/analog_right.svg", res2hFiles[44])
+    std::make_pair(":/opensans_hebrew_condensed_light.ttf", res2hFiles[8]),
+    std::make_pair(":/checkbox_checked.svg", res2hFiles[9]),
+    std::make_pair(":/textinput_ninepatch.png", res2hFiles[10]),
+    std::make_pair(":/option_arrow.svg", res2hFiles[11]),
+    std::make_pair(":/textinput_ninepatch_active.png", res2hFiles[12]),
+    std::make_pair(":/splash.svg", res2hFiles[13]),
+    std::make_pair(":/frame.png", res2hFiles[14]),
+    std::make_pair(":/slider_knob.svg", res2hFiles[15]),
+    std::make_pair(":/button.png", res2hFiles[16]),
+    std::make_pair(":/fav_remove.svg", res2hFiles[17]),
+    std::make_pair(":/arrow.svg", res2hFiles[18]),
+    std::make_pair(":/star_unfilled.svg", res2hFiles[19]),
+    std::make_pair(":/fav_add.svg", res2hFiles[20]),
+    std::make_pair(":/help/dpad_leftright.svg", res2hFiles[21]),
+    std::make_pair(":/help/dpad_all.svg", res2hFiles[22]),
+    std::make_pair(":/help/button_x.svg", res2hFiles[23]),
+    std::make_pair(":/help/button_a.svg", res2hFiles[24]),
+    std::make_pair(":/help/button_l.svg", res2hFiles[25]),
+    std::make_pair(":/help/dpad_down.svg", res2hFiles[26]),
+    std::make_pair(":/help/analog_up.svg", res2hFiles[27]),
+    std::make_pair(":/help/dpad_left.svg", res2hFiles[28]),
+    std::make_pair(":/help/button_start.svg", res2hFiles[29]),
+    std::make_pair(":/help/dpad_up.svg", res2hFiles[30]),
+    std::make_pair(":/help/analog_down.svg", res2hFiles[31]),
+    std::make_pair(":/help/button_y.svg", res2hFiles[32]),
+    std::make_pair(":/help/button_select.svg", res2hFiles[33]),
+    std::make_pair(":/help/button_b.svg", res2hFiles[34]),
+    std::make_pair(":/help/dpad_updown.svg", res2hFiles[35]),
+    std::make_pair(":/help/dpad_right.svg", res2hFiles[36]),
+    std::make_pair(":/help/button_r.svg", res2hFiles[37]),
+    std::make_pair(":/help/analog_thumb.svg", res2hFiles[38]),
+    std::make_pair(":/help/analog_left.svg", res2hFiles[39]),
+    std::make_pair(":/help/analog_right.svg", res2hFiles[40]),
+    std::make_pair(":/busy.svg", res2hFiles[41])
 };
 
 res2hMapType res2hMap(mapTemp, mapTemp + sizeof mapTemp / sizeof mapTemp[0]);
@@ -29,9 +29,6 @@ extern const unsigned char opensans_hebrew_condensed_regular_ttf_data[];
 extern const size_t on_svg_size;
 extern const unsigned char on_svg_data[];
 
-extern const size_t busy_3_svg_size;
-extern const unsigned char busy_3_svg_data[];
-
 extern const size_t opensans_hebrew_condensed_light_ttf_size;
 extern const unsigned char opensans_hebrew_condensed_light_ttf_data[];
 
@@ -59,9 +56,6 @@ extern const unsigned char slider_knob_svg_data[];
 extern const size_t button_png_size;
 extern const unsigned char button_png_data[];
 
-extern const size_t busy_1_svg_size;
-extern const unsigned char busy_1_svg_data[];
-
 extern const size_t fav_remove_svg_size;
 extern const unsigned char fav_remove_svg_data[];
 
@@ -71,12 +65,6 @@ extern const unsigned char arrow_svg_data[];
 extern const size_t star_unfilled_svg_size;
 extern const unsigned char star_unfilled_svg_data[];
 
-extern const size_t busy_2_svg_size;
-extern const unsigned char busy_2_svg_data[];
-
-extern const size_t busy_0_svg_size;
-extern const unsigned char busy_0_svg_data[];
-
 extern const size_t fav_add_svg_size;
 extern const unsigned char fav_add_svg_data[];
 
@@ -140,6 +128,9 @@ extern const unsigned char help_analog_left_svg_data[];
 extern const size_t help_analog_right_svg_size;
 extern const unsigned char help_analog_right_svg_data[];
 
+extern const size_t busy_svg_size;
+extern const unsigned char busy_svg_data[];
+
 struct Res2hEntry {
     const std::string relativeFileName;
     const size_t size;
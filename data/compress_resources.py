@@ -0,0 +1,54 @@
+#!/usr/bin/env python
+# Rewrites the res2h output in ./converted so text-like resources (SVGs, fonts) are stored zlib-compressed.
+# Run after res2h (see generate.sh). ResourceManager::getFileData inflates them the first time they're used.
+#
+# Compressed data starts with "ESZ1" and the uncompressed size (32 bit little endian), then the zlib stream.
+# PNGs are already deflated and are left as they are.
+
+import os
+import struct
+import zlib
+
+MAGIC = b"ESZ1"
+COMPRESSED_EXTENSIONS = (".svg", ".ttf")
+BYTES_PER_LINE = 10
+
+def converted_name(relative_path):
+	return relative_path.replace("/", "_").replace("\\", "_").replace(".", "_")
+
+def write_converted(relative_path, data, out_dir):
+	name = converted_name(relative_path)
+	lines = []
+	for i in range(0, len(data), BYTES_PER_LINE):
+		lines.append("    " + ",".join("0x%02x" % b for b in bytearray(data[i:i + BYTES_PER_LINE])))
+
+	with open(os.path.join(out_dir, name + ".cpp"), "w") as out:
+		out.write("//this file was auto-generated from \"%s\" by res2h (compressed by compress_resources.py)\n\n" % os.path.basename(relative_path))
+		out.write("#include \"../Resources.h\"\n\n")
+		out.write("const size_t %s_size = %d;\n" % (name, len(data)))
+		out.write("const unsigned char %s_data[%d] = {\n" % (name, len(data)))
+		out.write(",\n".join(lines))
+		out.write("\n};\n\n")
+
+def main():
+	base = os.path.dirname(os.path.abspath(__file__))
+	res_dir = os.path.join(base, "resources")
+	out_dir = os.path.join(base, "converted")
+
+	for root, dirs, files in os.walk(res_dir):
+		for f in sorted(files):
+			if not f.lower().endswith(COMPRESSED_EXTENSIONS):
+				continue
+
+			path = os.path.join(root, f)
+			relative_path = os.path.relpath(path, res_dir).replace("\\", "/")
+
+			with open(path, "rb") as src:
+				raw = src.read()
+
+			data = MAGIC + struct.pack("<I", len(raw)) + zlib.compress(raw, 9)
+			write_converted(relative_path, data, out_dir)
+			print("%s: %d -> %d bytes" % (relative_path, len(raw), len(data)))
+
+if __name__ == "__main__":
+	main()
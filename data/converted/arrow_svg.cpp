@@ -1,92 +1,60 @@
-//this file was auto-generated from "arrow.svg" by res2h
+//this file was auto-generated from "arrow.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t arrow_svg_size = 838;
-const unsigned char arrow_svg_data[838] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x45,0x62,0x65,0x6e,
-    0x65,0x5f,0x31,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,
-    0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,
-    0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,
-    0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,
-    0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,
-    0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x32,
-    0x2e,0x31,0x36,0x35,0x70,0x78,0x22,0x20,0x68,0x65,
-    0x69,0x67,0x68,0x74,0x3d,0x22,0x32,0x31,0x2e,0x39,
-    0x32,0x31,0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,
-    0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x31,
-    0x32,0x2e,0x31,0x36,0x35,0x20,0x32,0x31,0x2e,0x39,
-    0x32,0x31,0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,
-    0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-    0x64,0x3d,0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,
-    0x20,0x31,0x32,0x2e,0x31,0x36,0x35,0x20,0x32,0x31,
-    0x2e,0x39,0x32,0x31,0x22,0x20,0x78,0x6d,0x6c,0x3a,
-    0x73,0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,
-    0x73,0x65,0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,
-    0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x37,0x37,0x37,0x37,
-    0x37,0x37,0x22,0x20,0x64,0x3d,0x22,0x4d,0x30,0x2e,
-    0x37,0x35,0x2c,0x32,0x31,0x2e,0x39,0x32,0x31,0x63,
-    0x2d,0x30,0x2e,0x31,0x39,0x37,0x2c,0x30,0x2d,0x30,
-    0x2e,0x33,0x39,0x35,0x2d,0x30,0x2e,0x30,0x37,0x37,
-    0x2d,0x30,0x2e,0x35,0x34,0x32,0x2d,0x30,0x2e,0x32,
-    0x33,0x31,0x63,0x2d,0x30,0x2e,0x32,0x38,0x37,0x2d,
-    0x30,0x2e,0x32,0x39,0x39,0x2d,0x30,0x2e,0x32,0x37,
-    0x36,0x2d,0x30,0x2e,0x37,0x37,0x33,0x2c,0x30,0x2e,
-    0x30,0x32,0x33,0x2d,0x31,0x2e,0x30,0x36,0x31,0x6c,
-    0x31,0x30,0x2e,0x30,0x39,0x38,0x2d,0x39,0x2e,0x36,
-    0x36,0x38,0x0a,0x09,0x09,0x4c,0x30,0x2e,0x32,0x33,
-    0x31,0x2c,0x31,0x2e,0x32,0x39,0x32,0x63,0x2d,0x30,
-    0x2e,0x32,0x39,0x39,0x2d,0x30,0x2e,0x32,0x38,0x36,
-    0x2d,0x30,0x2e,0x33,0x31,0x2d,0x30,0x2e,0x37,0x36,
-    0x31,0x2d,0x30,0x2e,0x30,0x32,0x33,0x2d,0x31,0x2e,
-    0x30,0x36,0x63,0x30,0x2e,0x32,0x38,0x36,0x2d,0x30,
-    0x2e,0x33,0x2c,0x30,0x2e,0x37,0x36,0x31,0x2d,0x30,
-    0x2e,0x33,0x31,0x2c,0x31,0x2e,0x30,0x36,0x2d,0x30,
-    0x2e,0x30,0x32,0x33,0x6c,0x31,0x30,0x2e,0x36,0x36,
-    0x35,0x2c,0x31,0x30,0x2e,0x32,0x31,0x31,0x0a,0x09,
-    0x09,0x63,0x30,0x2e,0x31,0x34,0x37,0x2c,0x30,0x2e,
-    0x31,0x34,0x31,0x2c,0x30,0x2e,0x32,0x33,0x31,0x2c,
-    0x30,0x2e,0x33,0x33,0x37,0x2c,0x30,0x2e,0x32,0x33,
-    0x31,0x2c,0x30,0x2e,0x35,0x34,0x32,0x73,0x2d,0x30,
-    0x2e,0x30,0x38,0x34,0x2c,0x30,0x2e,0x34,0x2d,0x30,
-    0x2e,0x32,0x33,0x31,0x2c,0x30,0x2e,0x35,0x34,0x32,
-    0x4c,0x31,0x2e,0x32,0x36,0x39,0x2c,0x32,0x31,0x2e,
-    0x37,0x31,0x33,0x43,0x31,0x2e,0x31,0x32,0x34,0x2c,
-    0x32,0x31,0x2e,0x38,0x35,0x32,0x2c,0x30,0x2e,0x39,
-    0x33,0x37,0x2c,0x32,0x31,0x2e,0x39,0x32,0x31,0x2c,
-    0x30,0x2e,0x37,0x35,0x2c,0x32,0x31,0x2e,0x39,0x32,
-    0x31,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x67,0x3e,
-    0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a
+const size_t arrow_svg_size = 518;
+const unsigned char arrow_svg_data[518] = {
+    0x45,0x53,0x5a,0x31,0x46,0x03,0x00,0x00,0x78,0xda,
+    0x6d,0x52,0xcb,0x8e,0x9b,0x40,0x10,0x3c,0xdb,0x5f,
+    0xd1,0x99,0x9c,0x22,0x31,0x4f,0xcc,0xcb,0x32,0x5e,
+    0xc5,0x0f,0x59,0x96,0x9c,0xc4,0x52,0x36,0x1b,0xe5,
+    0x14,0x61,0x98,0x05,0xb4,0x04,0x10,0x60,0xe3,0xe4,
+    0xeb,0xd3,0x03,0xd9,0x8d,0x0f,0xf6,0xa1,0x86,0xee,
+    0xae,0xaa,0xee,0x1e,0xcf,0xe2,0xe1,0xfa,0xab,0x80,
+    0x8b,0x6e,0xda,0xbc,0x2a,0x43,0x22,0x99,0x20,0xa0,
+    0xcb,0xb8,0x4a,0xf2,0x32,0x0d,0xc9,0xb9,0x7b,0xa6,
+    0x3e,0x79,0x58,0x4e,0x17,0xef,0x28,0x85,0x9d,0x2e,
+    0x75,0x13,0x75,0x55,0x33,0x87,0x8f,0x49,0x75,0xd2,
+    0xb0,0x2f,0x8a,0x73,0xdb,0x0d,0x29,0x90,0x2e,0x13,
+    0xcc,0xb6,0xe0,0xeb,0xd3,0x0e,0xb6,0xd7,0xba,0x6a,
+    0x3a,0x38,0x16,0xe7,0x94,0xee,0x4b,0x60,0x43,0xf2,
+    0x69,0xec,0x31,0x07,0x24,0x0a,0x58,0x9d,0xf3,0x22,
+    0x01,0xf1,0x01,0x80,0x52,0x63,0xbf,0xf9,0xb2,0x7e,
+    0xfc,0x71,0xdc,0x42,0x7b,0x49,0xe1,0xf8,0x6d,0x75,
+    0xd8,0xaf,0x81,0x50,0xce,0xbf,0xdb,0x6b,0xce,0x37,
+    0x8f,0x9b,0xc1,0x41,0x32,0xc9,0xf9,0xf6,0x33,0x01,
+    0x92,0x75,0x5d,0x3d,0xe7,0xbc,0xef,0x7b,0xd6,0xdb,
+    0xac,0x6a,0x52,0xbe,0x6b,0xa2,0x3a,0xcb,0xe3,0x96,
+    0x23,0x91,0x1b,0x22,0x8a,0x38,0x9a,0x49,0xc9,0x92,
+    0x2e,0x21,0xd8,0xc2,0x38,0xdf,0xec,0x29,0x09,0xe4,
+    0x49,0x48,0xb6,0x27,0x5c,0xea,0x27,0x06,0x78,0x0d,
+    0x65,0x1b,0xde,0x71,0x56,0x42,0x08,0xe3,0xf4,0x8f,
+    0x32,0xbf,0x16,0x79,0xf9,0x72,0x8f,0x28,0x83,0x20,
+    0xe0,0x43,0x15,0xa9,0x21,0x11,0xf5,0x95,0xc0,0xef,
+    0xf1,0x9c,0x4e,0xa0,0xcf,0x93,0x2e,0xc3,0xc6,0x8a,
+    0x49,0xd7,0x31,0xa5,0x4c,0xe7,0x69,0xd6,0x85,0x44,
+    0x49,0x16,0x28,0x69,0x32,0x97,0x5c,0xf7,0xab,0xca,
+    0x48,0x41,0xc0,0x48,0x84,0xb1,0x6a,0xfe,0x93,0xe8,
+    0x54,0x68,0x7a,0x8a,0xe2,0x97,0xb4,0xa9,0xce,0x25,
+    0x8e,0x5e,0xea,0x1e,0xee,0x30,0x71,0xca,0x79,0x5b,
+    0x47,0xb1,0x0e,0x49,0xdd,0xe8,0x56,0x37,0x17,0x6d,
+    0xd6,0x4f,0x97,0xd3,0xc9,0xa2,0x8e,0xba,0x0c,0x9e,
+    0xf3,0xa2,0x08,0xc9,0x7b,0x6f,0xf8,0x11,0x40,0xa7,
+    0x4f,0x82,0x79,0x8e,0x35,0x1a,0xc4,0x54,0x30,0x19,
+    0x78,0x96,0xc0,0xd3,0x0e,0x1c,0x44,0xe1,0x79,0x88,
+    0xce,0x4c,0x21,0x2a,0x7b,0x20,0x28,0xdf,0xa4,0x54,
+    0x10,0x18,0xf4,0x5c,0x44,0xcf,0xb3,0x2d,0xa4,0x2a,
+    0x9b,0xe2,0x13,0x72,0x65,0x21,0x31,0x08,0x7c,0x1a,
+    0x30,0xd7,0xf5,0xa7,0x93,0xc9,0x61,0x90,0x5a,0x12,
+    0x35,0x2a,0xfe,0x2f,0xf5,0x8d,0xd4,0x96,0x46,0xef,
+    0x1a,0x7c,0xd5,0xc7,0x6f,0x35,0xeb,0xb5,0x34,0xa8,
+    0x85,0x3b,0x92,0x8c,0xbd,0xeb,0x3a,0x16,0x1e,0x4a,
+    0x4a,0xf4,0x47,0x81,0x9c,0xe1,0xd0,0x88,0xd2,0x1a,
+    0x7b,0xa1,0xc4,0xf6,0xde,0xbe,0x71,0xfc,0xd6,0x68,
+    0xfd,0x19,0x06,0x33,0x7a,0x93,0x3e,0xe0,0x50,0x6e,
+    0x60,0xb6,0xf7,0xa4,0xbd,0xc6,0x87,0xa1,0x66,0x26,
+    0xf0,0x1d,0x85,0xf5,0x00,0x2d,0xc6,0x7b,0xb1,0x6e,
+    0xee,0xe8,0x0f,0xe1,0x78,0xa3,0x3c,0x35,0x80,0x2f,
+    0x63,0x39,0xfd,0x0b,0x22,0xc2,0xd7,0xa0
 };
 
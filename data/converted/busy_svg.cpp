@@ -0,0 +1,73 @@
+//this file was auto-generated from "busy.svg" by res2h (compressed by compress_resources.py)
+
+#include "../Resources.h"
+
+const size_t busy_svg_size = 644;
+const unsigned char busy_svg_data[644] = {
+    0x45,0x53,0x5a,0x31,0xda,0x0f,0x00,0x00,0x78,0xda,
+    0xed,0x57,0x5d,0x6f,0xda,0x30,0x14,0x7d,0x86,0x5f,
+    0x71,0xe7,0x3d,0x6c,0x93,0x88,0xed,0x10,0x4a,0xec,
+    0xaa,0x69,0xa5,0x52,0xd4,0x4d,0xda,0x47,0xa5,0x75,
+    0x4c,0x7b,0xaa,0x42,0x70,0x89,0x55,0x48,0xa2,0xc4,
+    0x25,0xed,0x7e,0xfd,0xae,0x63,0xe8,0x32,0x8d,0xaa,
+    0x5d,0x1f,0xa6,0x55,0x83,0x07,0xfb,0xc6,0xf7,0xf8,
+    0xf8,0x1e,0xdf,0x1c,0x01,0x07,0x47,0x37,0xcb,0x05,
+    0xac,0x54,0x59,0xe9,0x3c,0x8b,0x88,0x4f,0x39,0x01,
+    0x95,0x25,0xf9,0x4c,0x67,0xf3,0x88,0x5c,0x9b,0x4b,
+    0x4f,0x90,0xa3,0xc3,0xee,0xc1,0x0b,0xcf,0x83,0xe9,
+    0x75,0x75,0x7b,0xc1,0x69,0xb5,0x9a,0x83,0xc9,0xdd,
+    0x53,0xd0,0x3c,0x55,0x7a,0xa6,0x60,0x7a,0xdb,0xcc,
+    0x3d,0xb8,0xcc,0x4b,0x38,0xc6,0xe4,0x28,0x5f,0x16,
+    0x79,0xa6,0x32,0xf3,0xaa,0x82,0xaa,0x28,0xb5,0x51,
+    0x50,0xa5,0x4a,0x19,0x88,0x33,0xbd,0x8c,0x0d,0x9e,
+    0x07,0x9e,0x67,0xa9,0x4f,0x3e,0x8d,0xce,0xbf,0x9d,
+    0x8d,0xc1,0x52,0x9d,0x7d,0x39,0x7e,0xff,0x6e,0x04,
+    0xc4,0x63,0xec,0x6b,0x30,0x62,0xec,0xe4,0xfc,0x04,
+    0x3e,0x4f,0x4e,0xc1,0xa7,0x3e,0x63,0xe3,0x8f,0x04,
+    0x48,0x6a,0x4c,0xb1,0xcf,0x58,0x5d,0xd7,0xb4,0x0e,
+    0x68,0x5e,0xce,0xd9,0x69,0x19,0x17,0xa9,0x4e,0x2a,
+    0x86,0x40,0x66,0x81,0xb8,0x89,0x21,0x99,0xef,0xd3,
+    0x99,0x99,0x11,0x3c,0xc2,0x32,0xb7,0x34,0xfa,0x04,
+    0xf4,0x2c,0x22,0xe3,0xa9,0xca,0xd4,0x05,0x3e,0xe0,
+    0x15,0x64,0x55,0xb4,0x85,0xb9,0xcf,0x39,0xb7,0x4c,
+    0x6b,0xc8,0xfe,0xcd,0x42,0x67,0x57,0xdb,0x80,0xbe,
+    0x94,0x92,0x35,0x59,0x84,0x46,0x84,0x17,0x37,0x04,
+    0x6e,0xdd,0xdc,0xed,0x40,0xad,0x67,0x26,0x8d,0x88,
+    0x18,0x50,0xce,0x85,0x4d,0xa5,0x4a,0xcf,0x53,0x13,
+    0x91,0x7e,0x1f,0x57,0xfa,0x76,0x65,0xa5,0x55,0x7d,
+    0x9c,0xdb,0xad,0xc0,0xc1,0x01,0xc1,0x65,0x6d,0x3f,
+    0xe2,0xe9,0x42,0x79,0xd3,0x38,0xb9,0x9a,0x97,0xf9,
+    0x75,0x86,0xa5,0x67,0xaa,0x86,0x2d,0x48,0xac,0x72,
+    0xbf,0x2a,0xe2,0x44,0x45,0xa4,0x28,0x55,0xa5,0xca,
+    0x95,0xb2,0xf2,0xb1,0x5f,0x65,0x9c,0x55,0xd8,0x98,
+    0x65,0x44,0x9a,0x70,0x11,0x1b,0xf5,0x9a,0xf7,0xf8,
+    0x1b,0x97,0xce,0x71,0x8f,0x36,0xb6,0x60,0xba,0x87,
+    0x2b,0x9d,0x83,0x22,0x36,0x29,0x5c,0xea,0xc5,0x22,
+    0x22,0x2f,0xc3,0xe6,0x43,0x00,0x8f,0xfd,0xd0,0xf7,
+    0xed,0x41,0x3d,0x9c,0xfa,0x32,0x48,0x90,0x80,0x06,
+    0xd2,0xc3,0xc1,0x97,0x18,0x86,0xdc,0xc6,0x38,0xba,
+    0x38,0xf5,0x42,0x2a,0x83,0x30,0xb1,0x79,0x5c,0xf2,
+    0x36,0x00,0x04,0x7b,0x2d,0xf0,0xca,0x13,0x34,0x08,
+    0x65,0xb7,0xd3,0x49,0xf8,0x1a,0xfa,0x13,0xd2,0x66,
+    0x4d,0x1d,0x9d,0x83,0xf4,0x36,0xe9,0xbb,0xa3,0xdd,
+    0x38,0x71,0xa5,0x7d,0x27,0x0c,0x85,0xb1,0xf9,0x93,
+    0xd4,0x49,0xca,0x85,0xf8,0x5d,0x9c,0x68,0x95,0x24,
+    0x1e,0x27,0x4e,0x4c,0x9a,0x71,0xab,0x36,0xd1,0xd2,
+    0x26,0x1e,0xa3,0x4d,0x4c,0x9a,0xc2,0x9e,0x26,0x4d,
+    0xd2,0x60,0x6f,0xf0,0x40,0xdf,0xd6,0x15,0xbd,0x6d,
+    0xe2,0x91,0xcb,0xba,0x37,0x0b,0x6b,0xc2,0xad,0x43,
+    0x11,0xb8,0x00,0x39,0x1e,0xee,0x9a,0x68,0x75,0x4d,
+    0xb4,0x95,0x89,0x96,0x32,0x71,0x6f,0xd7,0x1e,0x16,
+    0x63,0x6f,0x23,0xbc,0xaf,0x4d,0x8e,0x58,0xfc,0xa2,
+    0x45,0xd2,0x50,0x0e,0xb1,0x08,0x49,0x07,0x61,0xd8,
+    0xcc,0x48,0x70,0xd7,0xa1,0x11,0xbf,0xab,0xab,0x19,
+    0x37,0xf5,0x3d,0x46,0x80,0x6b,0x4d,0xd8,0xaa,0x7f,
+    0xdd,0x9f,0xad,0xbe,0x5b,0xbf,0x66,0xff,0x85,0xf9,
+    0x76,0x76,0x7b,0x1e,0x76,0xfb,0x53,0x69,0xcf,0xd6,
+    0x7c,0x03,0x7b,0xc3,0x83,0x8d,0xf9,0x76,0xdf,0x75,
+    0x3b,0xf3,0xed,0xcc,0xf7,0xd7,0xcc,0x37,0x0c,0xf0,
+    0x86,0x87,0xbb,0x9f,0x9d,0xcf,0xdc,0x8a,0x3b,0xf3,
+    0xfd,0xd3,0xe6,0xb3,0xff,0x58,0x0f,0xbb,0x3f,0x00,
+    0xb4,0x89,0x9e,0xa2
+};
+
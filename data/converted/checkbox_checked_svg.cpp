@@ -1,140 +1,68 @@
-//this file was auto-generated from "checkbox_checked.svg" by res2h
+//this file was auto-generated from "checkbox_checked.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t checkbox_checked_svg_size = 1314;
-const unsigned char checkbox_checked_svg_data[1314] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x45,0x62,0x65,0x6e,
-    0x65,0x5f,0x31,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,
-    0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,
-    0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,
-    0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,
-    0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,
-    0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x32,0x31,
-    0x2e,0x39,0x36,0x32,0x70,0x78,0x22,0x20,0x68,0x65,
-    0x69,0x67,0x68,0x74,0x3d,0x22,0x32,0x31,0x2e,0x39,
-    0x35,0x39,0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,
-    0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x32,
-    0x31,0x2e,0x39,0x36,0x32,0x20,0x32,0x31,0x2e,0x39,
-    0x35,0x39,0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,
-    0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-    0x64,0x3d,0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,
-    0x20,0x32,0x31,0x2e,0x39,0x36,0x32,0x20,0x32,0x31,
-    0x2e,0x39,0x35,0x39,0x22,0x20,0x78,0x6d,0x6c,0x3a,
-    0x73,0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,
-    0x73,0x65,0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,
-    0x23,0x37,0x37,0x37,0x37,0x37,0x37,0x22,0x20,0x64,
-    0x3d,0x22,0x4d,0x31,0x37,0x2e,0x37,0x31,0x2c,0x31,
-    0x2e,0x35,0x63,0x31,0x2e,0x35,0x31,0x38,0x2c,0x30,
-    0x2c,0x32,0x2e,0x37,0x35,0x32,0x2c,0x31,0x2e,0x32,
-    0x33,0x34,0x2c,0x32,0x2e,0x37,0x35,0x32,0x2c,0x32,
-    0x2e,0x37,0x35,0x32,0x76,0x31,0x33,0x2e,0x34,0x35,
-    0x35,0x63,0x30,0x2c,0x31,0x2e,0x35,0x31,0x38,0x2d,
-    0x31,0x2e,0x32,0x33,0x34,0x2c,0x32,0x2e,0x37,0x35,
-    0x32,0x2d,0x32,0x2e,0x37,0x35,0x32,0x2c,0x32,0x2e,
-    0x37,0x35,0x32,0x48,0x34,0x2e,0x32,0x35,0x32,0x0a,
-    0x09,0x63,0x2d,0x31,0x2e,0x35,0x31,0x38,0x2c,0x30,
-    0x2d,0x32,0x2e,0x37,0x35,0x32,0x2d,0x31,0x2e,0x32,
-    0x33,0x34,0x2d,0x32,0x2e,0x37,0x35,0x32,0x2d,0x32,
-    0x2e,0x37,0x35,0x32,0x56,0x34,0x2e,0x32,0x35,0x32,
-    0x43,0x31,0x2e,0x35,0x2c,0x32,0x2e,0x37,0x33,0x34,
-    0x2c,0x32,0x2e,0x37,0x33,0x34,0x2c,0x31,0x2e,0x35,
-    0x2c,0x34,0x2e,0x32,0x35,0x32,0x2c,0x31,0x2e,0x35,
-    0x48,0x31,0x37,0x2e,0x37,0x31,0x20,0x4d,0x31,0x37,
-    0x2e,0x37,0x31,0x2c,0x30,0x48,0x34,0x2e,0x32,0x35,
-    0x32,0x43,0x31,0x2e,0x39,0x31,0x34,0x2c,0x30,0x2c,
-    0x30,0x2c,0x31,0x2e,0x39,0x31,0x34,0x2c,0x30,0x2c,
-    0x34,0x2e,0x32,0x35,0x32,0x76,0x31,0x33,0x2e,0x34,
-    0x35,0x35,0x0a,0x09,0x63,0x30,0x2c,0x32,0x2e,0x33,
-    0x33,0x39,0x2c,0x31,0x2e,0x39,0x31,0x34,0x2c,0x34,
-    0x2e,0x32,0x35,0x32,0x2c,0x34,0x2e,0x32,0x35,0x32,
-    0x2c,0x34,0x2e,0x32,0x35,0x32,0x48,0x31,0x37,0x2e,
-    0x37,0x31,0x63,0x32,0x2e,0x33,0x33,0x39,0x2c,0x30,
-    0x2c,0x34,0x2e,0x32,0x35,0x32,0x2d,0x31,0x2e,0x39,
-    0x31,0x33,0x2c,0x34,0x2e,0x32,0x35,0x32,0x2d,0x34,
-    0x2e,0x32,0x35,0x32,0x56,0x34,0x2e,0x32,0x35,0x32,
-    0x43,0x32,0x31,0x2e,0x39,0x36,0x32,0x2c,0x31,0x2e,
-    0x39,0x31,0x34,0x2c,0x32,0x30,0x2e,0x30,0x34,0x39,
-    0x2c,0x30,0x2c,0x31,0x37,0x2e,0x37,0x31,0x2c,0x30,
-    0x4c,0x31,0x37,0x2e,0x37,0x31,0x2c,0x30,0x7a,0x22,
-    0x2f,0x3e,0x0a,0x3c,0x67,0x3e,0x0a,0x09,0x3c,0x67,
-    0x3e,0x0a,0x09,0x09,0x0a,0x09,0x09,0x09,0x3c,0x72,
-    0x65,0x63,0x74,0x20,0x78,0x3d,0x22,0x31,0x30,0x2e,
-    0x32,0x33,0x32,0x22,0x20,0x79,0x3d,0x22,0x31,0x2e,
-    0x30,0x37,0x39,0x22,0x20,0x74,0x72,0x61,0x6e,0x73,
-    0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,0x74,0x72,
-    0x69,0x78,0x28,0x30,0x2e,0x37,0x30,0x37,0x31,0x20,
-    0x30,0x2e,0x37,0x30,0x37,0x31,0x20,0x2d,0x30,0x2e,
-    0x37,0x30,0x37,0x31,0x20,0x30,0x2e,0x37,0x30,0x37,
-    0x31,0x20,0x31,0x30,0x2e,0x39,0x38,0x30,0x31,0x20,
-    0x2d,0x34,0x2e,0x35,0x34,0x39,0x34,0x29,0x22,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x37,0x37,0x37,
-    0x37,0x37,0x37,0x22,0x20,0x77,0x69,0x64,0x74,0x68,
-    0x3d,0x22,0x31,0x2e,0x35,0x22,0x20,0x68,0x65,0x69,
-    0x67,0x68,0x74,0x3d,0x22,0x31,0x39,0x2e,0x38,0x22,
-    0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,
-    0x3c,0x67,0x3e,0x0a,0x09,0x09,0x0a,0x09,0x09,0x09,
-    0x3c,0x72,0x65,0x63,0x74,0x20,0x78,0x3d,0x22,0x31,
-    0x30,0x2e,0x32,0x33,0x32,0x22,0x20,0x79,0x3d,0x22,
-    0x31,0x2e,0x30,0x37,0x39,0x22,0x20,0x74,0x72,0x61,
-    0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,0x61,
-    0x74,0x72,0x69,0x78,0x28,0x30,0x2e,0x37,0x30,0x37,
-    0x31,0x20,0x30,0x2e,0x37,0x30,0x37,0x31,0x20,0x2d,
-    0x30,0x2e,0x37,0x30,0x37,0x31,0x20,0x30,0x2e,0x37,
-    0x30,0x37,0x31,0x20,0x31,0x30,0x2e,0x39,0x38,0x30,
-    0x31,0x20,0x2d,0x34,0x2e,0x35,0x34,0x39,0x34,0x29,
-    0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x37,
-    0x37,0x37,0x37,0x37,0x37,0x22,0x20,0x77,0x69,0x64,
-    0x74,0x68,0x3d,0x22,0x31,0x2e,0x35,0x22,0x20,0x68,
-    0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x39,0x2e,
-    0x38,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,
-    0x0a,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x0a,0x09,
-    0x09,0x09,0x3c,0x72,0x65,0x63,0x74,0x20,0x78,0x3d,
-    0x22,0x31,0x2e,0x30,0x38,0x32,0x22,0x20,0x79,0x3d,
-    0x22,0x31,0x30,0x2e,0x32,0x33,0x22,0x20,0x74,0x72,
-    0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3d,0x22,0x6d,
-    0x61,0x74,0x72,0x69,0x78,0x28,0x30,0x2e,0x37,0x30,
-    0x37,0x31,0x20,0x30,0x2e,0x37,0x30,0x37,0x31,0x20,
-    0x2d,0x30,0x2e,0x37,0x30,0x37,0x31,0x20,0x30,0x2e,
-    0x37,0x30,0x37,0x31,0x20,0x31,0x30,0x2e,0x39,0x37,
-    0x39,0x33,0x20,0x2d,0x34,0x2e,0x35,0x34,0x39,0x34,
-    0x29,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x37,0x37,0x37,0x37,0x37,0x37,0x22,0x20,0x77,0x69,
-    0x64,0x74,0x68,0x3d,0x22,0x31,0x39,0x2e,0x38,0x22,
-    0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,
-    0x2e,0x35,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x73,
-    0x76,0x67,0x3e,0x0a
+const size_t checkbox_checked_svg_size = 598;
+const unsigned char checkbox_checked_svg_data[598] = {
+    0x45,0x53,0x5a,0x31,0x22,0x05,0x00,0x00,0x78,0xda,
+    0xd5,0x53,0x6d,0x6f,0xd3,0x30,0x10,0xfe,0xdc,0xfe,
+    0x8a,0xc3,0x7c,0x61,0x52,0xfd,0x96,0x97,0xa5,0xa9,
+    0x9a,0x4d,0xac,0xab,0xba,0x49,0x03,0x2a,0x31,0x86,
+    0xf8,0x84,0xd2,0xc4,0x4b,0xa3,0x65,0x49,0x94,0xa4,
+    0x4d,0xe1,0xd7,0x73,0x76,0x0c,0x2b,0xa8,0x12,0x12,
+    0xdf,0xa8,0xd2,0xb3,0x7d,0xf7,0xdc,0xe3,0xe7,0xce,
+    0xf6,0xfc,0xf2,0xf0,0x5c,0xc0,0x5e,0x35,0x6d,0x5e,
+    0x95,0x11,0x91,0x4c,0x10,0x50,0x65,0x52,0xa5,0x79,
+    0x99,0x45,0x64,0xd7,0x3d,0xd2,0x29,0xb9,0xbc,0x18,
+    0xcf,0x5f,0x51,0x0a,0x2b,0x55,0xaa,0x26,0xee,0xaa,
+    0x66,0x06,0x6f,0xd3,0x6a,0xa3,0xe0,0xb6,0x28,0x76,
+    0x6d,0x67,0x5c,0x20,0xcf,0x99,0x60,0xee,0x04,0x3e,
+    0x3e,0xac,0x60,0x79,0xa8,0xab,0xa6,0x83,0x75,0xb1,
+    0xcb,0xe8,0x6d,0x09,0xcc,0x38,0x1f,0x86,0x3d,0x66,
+    0x80,0x40,0x01,0x57,0xbb,0xbc,0x48,0x41,0x9c,0x01,
+    0x50,0xaa,0xe9,0xaf,0x3f,0x2c,0xee,0xbf,0xac,0x97,
+    0xd0,0xee,0x33,0x58,0x7f,0xba,0xba,0xbb,0x5d,0x00,
+    0xa1,0x9c,0x7f,0x76,0x17,0x9c,0x5f,0xdf,0x5f,0x1b,
+    0x06,0xc9,0x24,0xe7,0xcb,0xf7,0x04,0xc8,0xb6,0xeb,
+    0xea,0x19,0xe7,0x7d,0xdf,0xb3,0xde,0x65,0x55,0x93,
+    0xf1,0x55,0x13,0xd7,0xdb,0x3c,0x69,0x39,0x02,0xb9,
+    0x06,0x62,0x12,0x47,0x32,0x29,0x59,0xda,0xa5,0x04,
+    0xb7,0xd0,0xcc,0x47,0x75,0x4a,0x02,0x79,0x1a,0x91,
+    0xe5,0x06,0x8b,0xfa,0x8a,0x0b,0x6c,0x43,0xd9,0x46,
+    0x27,0x98,0x1d,0x21,0x84,0x66,0xb2,0x90,0xd9,0xa1,
+    0xc8,0xcb,0xa7,0x53,0x40,0x19,0x86,0x21,0x37,0x51,
+    0x84,0x46,0x44,0xd4,0x07,0x02,0xdf,0x86,0x71,0x3c,
+    0x82,0x3e,0x4f,0xbb,0x6d,0x44,0x1c,0xc9,0xc2,0x73,
+    0x47,0x87,0xb6,0x2a,0xcf,0xb6,0xdd,0xe0,0xf1,0x43,
+    0xed,0xd9,0xe7,0xaa,0xbf,0xaa,0x74,0x2a,0x08,0x18,
+    0x80,0x30,0x44,0xf5,0x99,0xc4,0x9b,0x42,0xd1,0x4d,
+    0x9c,0x3c,0x65,0x4d,0xb5,0x2b,0x51,0x7a,0xa9,0x7a,
+    0x38,0x81,0x44,0x95,0xb3,0xb6,0x8e,0x13,0x15,0x91,
+    0xba,0x51,0xad,0x6a,0xf6,0x4a,0x97,0x5f,0xc7,0xdd,
+    0x16,0x1e,0xf3,0xa2,0x88,0xc8,0xeb,0xc0,0xfc,0x08,
+    0x20,0xc9,0x3b,0x19,0xb0,0x40,0x4e,0x24,0xf3,0x13,
+    0xfc,0xcb,0xe9,0x44,0x4c,0x1c,0x16,0xf8,0x0e,0x7a,
+    0x1c,0xd7,0xb3,0x73,0x63,0xf7,0xd2,0x65,0x9e,0xef,
+    0x27,0x62,0x62,0x80,0xf4,0x08,0x40,0x8f,0x60,0x37,
+    0x1e,0x73,0x7c,0x67,0x3c,0x4a,0xa8,0xe5,0x1b,0x82,
+    0x03,0x9c,0x1e,0xc1,0x1f,0x0c,0x70,0x81,0x28,0x9d,
+    0x38,0x50,0xa1,0xd5,0x6b,0x13,0xd1,0xb3,0x1b,0xa3,
+    0x0e,0xac,0x48,0x71,0xf3,0x33,0x25,0x94,0x1e,0x0a,
+    0xd5,0x4a,0x86,0x99,0xf1,0x5b,0x81,0xb8,0xb5,0xae,
+    0xc1,0x75,0x43,0x1b,0x1e,0xd8,0x8e,0xec,0xc0,0x9a,
+    0x0c,0x18,0x9b,0x4c,0x35,0xd6,0xb5,0x73,0x63,0xad,
+    0xbe,0xa1,0xbb,0x96,0xca,0x11,0x4c,0x78,0x3a,0xc7,
+    0x0a,0xba,0xb3,0xe3,0x77,0xc2,0xb1,0xc5,0xd9,0xc5,
+    0x78,0x64,0xcc,0x08,0xbf,0xd1,0xbc,0x51,0x49,0xa7,
+    0x2f,0x82,0x14,0x58,0xba,0x63,0xee,0x02,0x3e,0xaf,
+    0x00,0x8f,0x08,0x9f,0x4c,0xd9,0x3e,0x56,0xcd,0x73,
+    0x44,0x9e,0xe3,0xae,0xc9,0x0f,0x6f,0x04,0x0b,0x04,
+    0x16,0x6a,0x07,0xfa,0xfb,0x12,0x09,0xc2,0xa9,0x40,
+    0xb7,0xc7,0x7c,0x2f,0xf4,0xce,0xc8,0x9f,0xe7,0x68,
+    0xef,0x16,0x36,0xec,0xe5,0x5a,0xc9,0x90,0x4d,0xb5,
+    0xaa,0xd1,0x9c,0xff,0x6f,0xba,0x98,0x98,0x5a,0x59,
+    0x5a,0xe1,0x3f,0xc9,0x0a,0x42,0xf7,0xef,0xb2,0xb4,
+    0x92,0x17,0x5d,0x28,0xf2,0x97,0x2c,0x6b,0xf0,0xd5,
+    0x5f,0x8c,0x7f,0x00,0x9e,0x32,0x47,0xfb
 };
 
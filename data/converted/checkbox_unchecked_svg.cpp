@@ -1,93 +1,57 @@
-//this file was auto-generated from "checkbox_unchecked.svg" by res2h
+//this file was auto-generated from "checkbox_unchecked.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t checkbox_unchecked_svg_size = 850;
-const unsigned char checkbox_unchecked_svg_data[850] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x45,0x62,0x65,0x6e,
-    0x65,0x5f,0x31,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,
-    0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,
-    0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,
-    0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,
-    0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,
-    0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x32,0x31,
-    0x2e,0x39,0x36,0x32,0x70,0x78,0x22,0x20,0x68,0x65,
-    0x69,0x67,0x68,0x74,0x3d,0x22,0x32,0x31,0x2e,0x39,
-    0x35,0x39,0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,
-    0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x32,
-    0x31,0x2e,0x39,0x36,0x32,0x20,0x32,0x31,0x2e,0x39,
-    0x35,0x39,0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,
-    0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-    0x64,0x3d,0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,
-    0x20,0x32,0x31,0x2e,0x39,0x36,0x32,0x20,0x32,0x31,
-    0x2e,0x39,0x35,0x39,0x22,0x20,0x78,0x6d,0x6c,0x3a,
-    0x73,0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,
-    0x73,0x65,0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,
-    0x23,0x37,0x37,0x37,0x37,0x37,0x37,0x22,0x20,0x64,
-    0x3d,0x22,0x4d,0x31,0x37,0x2e,0x37,0x31,0x2c,0x31,
-    0x2e,0x35,0x63,0x31,0x2e,0x35,0x31,0x38,0x2c,0x30,
-    0x2c,0x32,0x2e,0x37,0x35,0x32,0x2c,0x31,0x2e,0x32,
-    0x33,0x34,0x2c,0x32,0x2e,0x37,0x35,0x32,0x2c,0x32,
-    0x2e,0x37,0x35,0x32,0x76,0x31,0x33,0x2e,0x34,0x35,
-    0x35,0x63,0x30,0x2c,0x31,0x2e,0x35,0x31,0x38,0x2d,
-    0x31,0x2e,0x32,0x33,0x34,0x2c,0x32,0x2e,0x37,0x35,
-    0x32,0x2d,0x32,0x2e,0x37,0x35,0x32,0x2c,0x32,0x2e,
-    0x37,0x35,0x32,0x48,0x34,0x2e,0x32,0x35,0x32,0x0a,
-    0x09,0x63,0x2d,0x31,0x2e,0x35,0x31,0x38,0x2c,0x30,
-    0x2d,0x32,0x2e,0x37,0x35,0x32,0x2d,0x31,0x2e,0x32,
-    0x33,0x34,0x2d,0x32,0x2e,0x37,0x35,0x32,0x2d,0x32,
-    0x2e,0x37,0x35,0x32,0x56,0x34,0x2e,0x32,0x35,0x32,
-    0x43,0x31,0x2e,0x35,0x2c,0x32,0x2e,0x37,0x33,0x34,
-    0x2c,0x32,0x2e,0x37,0x33,0x34,0x2c,0x31,0x2e,0x35,
-    0x2c,0x34,0x2e,0x32,0x35,0x32,0x2c,0x31,0x2e,0x35,
-    0x48,0x31,0x37,0x2e,0x37,0x31,0x20,0x4d,0x31,0x37,
-    0x2e,0x37,0x31,0x2c,0x30,0x48,0x34,0x2e,0x32,0x35,
-    0x32,0x43,0x31,0x2e,0x39,0x31,0x34,0x2c,0x30,0x2c,
-    0x30,0x2c,0x31,0x2e,0x39,0x31,0x34,0x2c,0x30,0x2c,
-    0x34,0x2e,0x32,0x35,0x32,0x76,0x31,0x33,0x2e,0x34,
-    0x35,0x35,0x0a,0x09,0x63,0x30,0x2c,0x32,0x2e,0x33,
-    0x33,0x39,0x2c,0x31,0x2e,0x39,0x31,0x34,0x2c,0x34,
-    0x2e,0x32,0x35,0x32,0x2c,0x34,0x2e,0x32,0x35,0x32,
-    0x2c,0x34,0x2e,0x32,0x35,0x32,0x48,0x31,0x37,0x2e,
-    0x37,0x31,0x63,0x32,0x2e,0x33,0x33,0x39,0x2c,0x30,
-    0x2c,0x34,0x2e,0x32,0x35,0x32,0x2d,0x31,0x2e,0x39,
-    0x31,0x33,0x2c,0x34,0x2e,0x32,0x35,0x32,0x2d,0x34,
-    0x2e,0x32,0x35,0x32,0x56,0x34,0x2e,0x32,0x35,0x32,
-    0x43,0x32,0x31,0x2e,0x39,0x36,0x32,0x2c,0x31,0x2e,
-    0x39,0x31,0x34,0x2c,0x32,0x30,0x2e,0x30,0x34,0x39,
-    0x2c,0x30,0x2c,0x31,0x37,0x2e,0x37,0x31,0x2c,0x30,
-    0x4c,0x31,0x37,0x2e,0x37,0x31,0x2c,0x30,0x7a,0x22,
-    0x2f,0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a
+const size_t checkbox_unchecked_svg_size = 489;
+const unsigned char checkbox_unchecked_svg_data[489] = {
+    0x45,0x53,0x5a,0x31,0x52,0x03,0x00,0x00,0x78,0xda,
+    0x6d,0x92,0x5b,0x6f,0x9b,0x30,0x14,0xc7,0x9f,0x9b,
+    0x4f,0x71,0xe6,0x3d,0x4d,0xc2,0x37,0x2e,0x4d,0x89,
+    0x4a,0xab,0xe5,0xa2,0x24,0x52,0xb7,0x46,0x5a,0x97,
+    0x69,0x4f,0x13,0x01,0x17,0x50,0x19,0x20,0x70,0x42,
+    0xba,0x4f,0x3f,0xdf,0x2a,0xe5,0x21,0x48,0xd8,0xc7,
+    0xe7,0xfc,0xce,0xdf,0x7f,0x1b,0xee,0x1f,0xcf,0x7f,
+    0x6b,0x38,0x89,0x7e,0xa8,0xda,0x26,0x41,0x9c,0x30,
+    0x04,0xa2,0xc9,0xda,0xbc,0x6a,0x8a,0x04,0x1d,0xe5,
+    0x2b,0xbe,0x43,0x8f,0x0f,0x93,0xfb,0x4f,0x18,0xc3,
+    0x5a,0x34,0xa2,0x4f,0x65,0xdb,0xcf,0xe0,0x6b,0xde,
+    0x1e,0x04,0x6c,0xeb,0xfa,0x38,0x48,0x93,0x02,0x7e,
+    0x4b,0x18,0x09,0x3c,0xf8,0xb1,0x5f,0xc3,0xea,0xdc,
+    0xb5,0xbd,0x84,0x5d,0x7d,0x2c,0xf0,0xb6,0x01,0x62,
+    0x92,0x7b,0xbb,0xc7,0x0c,0x14,0xc8,0x60,0x7e,0xac,
+    0xea,0x1c,0xd8,0x17,0x00,0x8c,0xb5,0xfc,0xf2,0x79,
+    0xf1,0xf2,0x7b,0xb7,0x82,0xe1,0x54,0xc0,0xee,0xe7,
+    0xfc,0x69,0xbb,0x00,0x84,0x29,0xfd,0x15,0x2c,0x28,
+    0x5d,0xbe,0x2c,0x8d,0x02,0x27,0x9c,0xd2,0xd5,0x77,
+    0x04,0xa8,0x94,0xb2,0x9b,0x51,0x3a,0x8e,0x23,0x19,
+    0x03,0xd2,0xf6,0x05,0x5d,0xf7,0x69,0x57,0x56,0xd9,
+    0x40,0x15,0x48,0x35,0xa8,0x9a,0xa8,0x12,0xe3,0x9c,
+    0xe4,0x32,0x47,0x6a,0x0b,0xad,0x7c,0x71,0x4e,0x8e,
+    0xa0,0xca,0x13,0xb4,0x3a,0xa8,0x43,0xfd,0x51,0x0b,
+    0x75,0x0d,0xcd,0x90,0x5c,0x51,0xf6,0x19,0x63,0x5a,
+    0xc9,0x21,0xb3,0x73,0x5d,0x35,0x6f,0xd7,0x40,0x1e,
+    0xc7,0x31,0x35,0x55,0x85,0x26,0x88,0x75,0x67,0x04,
+    0xef,0x76,0x9e,0xdc,0xc0,0x58,0xe5,0xb2,0x4c,0x90,
+    0xcf,0x49,0x7c,0xeb,0xeb,0x52,0x29,0xaa,0xa2,0x94,
+    0x36,0x13,0xc5,0x3a,0x73,0xaa,0xc4,0x38,0x6f,0x75,
+    0x2b,0x30,0xb0,0x20,0xd8,0xaa,0xfe,0x26,0xe9,0xa1,
+    0x16,0xf8,0x90,0x66,0x6f,0x45,0xdf,0x1e,0x1b,0x65,
+    0xbd,0x11,0x23,0x5c,0x21,0x95,0xcb,0xd9,0xd0,0xa5,
+    0x99,0x48,0x50,0xd7,0x8b,0x41,0xf4,0x27,0xa1,0x8f,
+    0xdf,0xa5,0xb2,0x84,0xd7,0xaa,0xae,0x13,0xf4,0x79,
+    0x6a,0x1e,0x04,0x4a,0xe4,0x1b,0x9f,0x92,0x29,0xf7,
+    0x38,0x89,0x32,0xf5,0xf2,0x3b,0x8f,0x79,0x3e,0x99,
+    0x46,0xbe,0xca,0xf8,0x41,0xe8,0x62,0x33,0x9e,0x78,
+    0x40,0xc2,0x28,0xca,0x98,0x67,0x40,0x7c,0x01,0xe0,
+    0x0b,0x6c,0x13,0x12,0x3f,0xf2,0x27,0x37,0x19,0x76,
+    0x7a,0xb6,0x68,0x71,0x7c,0x81,0xef,0x0d,0xb8,0x50,
+    0x94,0x6e,0xb4,0x52,0x6a,0xd4,0x6b,0x53,0xd1,0xd1,
+    0xc6,0xb8,0x03,0x67,0x92,0x6d,0x3e,0x5a,0x62,0x1e,
+    0x2a,0xa3,0xda,0x89,0x8d,0x4c,0xde,0x19,0x54,0x5b,
+    0xeb,0x33,0x04,0x41,0xec,0xca,0x56,0xed,0x62,0xb4,
+    0xaa,0x99,0x65,0x5c,0x33,0xd6,0x6c,0xe0,0x62,0x33,
+    0x3a,0x7f,0xf6,0x76,0x9d,0x94,0xcf,0x08,0x0b,0x75,
+    0x8f,0x33,0xf4,0xe4,0xe6,0x7f,0x88,0xaa,0x2b,0xd6,
+    0x7f,0xc9,0xc3,0xe4,0x3f,0x57,0xce,0xdb,0x26
 };
 
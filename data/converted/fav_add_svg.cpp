@@ -1,72 +1,47 @@
-//this file was auto-generated from "fav_add.svg" by res2h
+//this file was auto-generated from "fav_add.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t fav_add_svg_size = 638;
-const unsigned char fav_add_svg_data[638] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x45,0x62,0x65,0x6e,
-    0x65,0x5f,0x31,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,
-    0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,
-    0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,
-    0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,
-    0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,
-    0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x32,0x31,
-    0x2e,0x30,0x30,0x32,0x70,0x78,0x22,0x20,0x68,0x65,
-    0x69,0x67,0x68,0x74,0x3d,0x22,0x32,0x32,0x2e,0x30,
-    0x30,0x32,0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,
-    0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x32,
-    0x31,0x2e,0x30,0x30,0x32,0x20,0x32,0x32,0x2e,0x30,
-    0x30,0x32,0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,
-    0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-    0x64,0x3d,0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,
-    0x20,0x32,0x31,0x2e,0x30,0x30,0x32,0x20,0x32,0x32,
-    0x2e,0x30,0x30,0x32,0x22,0x20,0x78,0x6d,0x6c,0x3a,
-    0x73,0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,
-    0x73,0x65,0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,
-    0x3e,0x0a,0x09,0x3c,0x72,0x65,0x63,0x74,0x20,0x79,
-    0x3d,0x22,0x31,0x30,0x2e,0x32,0x35,0x31,0x22,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x37,0x37,0x37,
-    0x37,0x37,0x37,0x22,0x20,0x77,0x69,0x64,0x74,0x68,
-    0x3d,0x22,0x32,0x31,0x2e,0x30,0x30,0x32,0x22,0x20,
-    0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x2e,
-    0x35,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x67,0x3e,0x0a,
-    0x3c,0x67,0x3e,0x0a,0x09,0x3c,0x72,0x65,0x63,0x74,
-    0x20,0x78,0x3d,0x22,0x39,0x2e,0x37,0x35,0x31,0x22,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x37,0x37,
-    0x37,0x37,0x37,0x37,0x22,0x20,0x77,0x69,0x64,0x74,
-    0x68,0x3d,0x22,0x31,0x2e,0x35,0x22,0x20,0x68,0x65,
-    0x69,0x67,0x68,0x74,0x3d,0x22,0x32,0x32,0x2e,0x30,
-    0x30,0x32,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x67,0x3e,
-    0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a
+const size_t fav_add_svg_size = 388;
+const unsigned char fav_add_svg_data[388] = {
+    0x45,0x53,0x5a,0x31,0x7e,0x02,0x00,0x00,0x78,0xda,
+    0x75,0x91,0x49,0x4f,0xc3,0x30,0x10,0x85,0xcf,0xf4,
+    0x57,0x0c,0xc3,0x09,0x89,0x78,0x49,0x55,0xa0,0x51,
+    0x53,0x44,0x17,0x55,0x95,0x10,0x54,0x62,0x13,0x27,
+    0x94,0x26,0x26,0xb1,0x30,0x4e,0xe4,0x38,0x4d,0xf9,
+    0xf7,0xd8,0x29,0x88,0x45,0x25,0x17,0x2b,0x33,0x6f,
+    0x3e,0xbf,0x37,0x1e,0x5d,0x6c,0xdf,0x14,0x6c,0x84,
+    0xa9,0x65,0xa9,0x63,0xe4,0x84,0x21,0x08,0x9d,0x96,
+    0x99,0xd4,0x79,0x8c,0x8d,0x7d,0x09,0xce,0xf1,0x62,
+    0xdc,0x1b,0x1d,0x06,0x01,0x2c,0x84,0x16,0x26,0xb1,
+    0xa5,0x89,0xe0,0x32,0x2b,0xd7,0x02,0x96,0x4a,0x35,
+    0xb5,0xed,0x4a,0xc0,0x4f,0x09,0x23,0xfd,0x13,0xb8,
+    0x7d,0x58,0xc0,0x7c,0x5b,0x95,0xc6,0xc2,0x4a,0x35,
+    0x79,0xb0,0xd4,0x40,0xba,0xe2,0xc3,0xee,0x8e,0x08,
+    0x9c,0x90,0xc1,0xa4,0x91,0x2a,0x03,0x76,0x0c,0x10,
+    0x04,0x1e,0x3f,0xbb,0x99,0xde,0x3d,0xad,0xe6,0x50,
+    0x6f,0x72,0x58,0xdd,0x4f,0xae,0x96,0x53,0xc0,0x80,
+    0xd2,0xc7,0xfe,0x94,0xd2,0xd9,0xdd,0xac,0x23,0x70,
+    0xc2,0x29,0x9d,0x5f,0x23,0x60,0x61,0x6d,0x15,0x51,
+    0xda,0xb6,0x2d,0x69,0xfb,0xa4,0x34,0x39,0x5d,0x98,
+    0xa4,0x2a,0x64,0x5a,0x53,0x27,0xa4,0x5e,0xe8,0x86,
+    0xa8,0x83,0x71,0x4e,0x32,0x9b,0xa1,0xbb,0xc2,0x93,
+    0x7f,0xe4,0xe4,0x08,0x32,0x8b,0x71,0xbe,0x76,0xa1,
+    0x9e,0xdd,0x8f,0x5b,0x83,0xae,0xe3,0x3d,0xe4,0x90,
+    0x31,0xe6,0x49,0x9f,0x92,0x68,0xab,0xa4,0x7e,0xdd,
+    0x27,0xe4,0xc3,0xe1,0x90,0x76,0x5d,0x27,0x8d,0x91,
+    0x55,0x5b,0x84,0xf7,0xdd,0xd9,0x3b,0x80,0x56,0x66,
+    0xb6,0x88,0x31,0x74,0x1b,0x66,0xa1,0x6f,0x15,0x42,
+    0xe6,0x85,0x75,0x95,0xf0,0xab,0xb2,0x91,0xa2,0x9d,
+    0x94,0x7e,0x14,0x18,0xec,0x84,0xb0,0xeb,0xfa,0x37,
+    0x49,0xd6,0x4a,0x04,0xeb,0x24,0x7d,0xcd,0x4d,0xd9,
+    0x68,0x67,0x5d,0x8b,0x16,0xf6,0x28,0x9d,0xcb,0xa8,
+    0xae,0x92,0x54,0xc4,0x58,0x19,0x51,0x0b,0xb3,0x11,
+    0x3e,0x7e,0x3e,0xee,0x1d,0x8c,0x8c,0x48,0xad,0xf7,
+    0xc4,0x19,0x09,0x07,0x2e,0xf4,0x8b,0x54,0x2a,0xc6,
+    0xa3,0xb3,0xee,0xc3,0xdf,0x1e,0xbf,0x1d,0x72,0x32,
+    0x40,0xea,0x10,0x34,0xff,0xc5,0x71,0x46,0x87,0xe4,
+    0xec,0x7f,0x8c,0x1f,0xfb,0x93,0xf2,0x1b,0xe3,0x37,
+    0x3a,0xee,0x7d,0x00,0xb5,0xb8,0xb6,0x01
 };
 
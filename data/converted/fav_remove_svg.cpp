@@ -1,65 +1,46 @@
-//this file was auto-generated from "fav_remove.svg" by res2h
+//this file was auto-generated from "fav_remove.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t fav_remove_svg_size = 567;
-const unsigned char fav_remove_svg_data[567] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x45,0x62,0x65,0x6e,
-    0x65,0x5f,0x31,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,
-    0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,
-    0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,
-    0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,
-    0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,
-    0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x32,0x31,
-    0x2e,0x30,0x30,0x32,0x70,0x78,0x22,0x20,0x68,0x65,
-    0x69,0x67,0x68,0x74,0x3d,0x22,0x32,0x32,0x2e,0x30,
-    0x30,0x32,0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,
-    0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x32,
-    0x31,0x2e,0x30,0x30,0x32,0x20,0x32,0x32,0x2e,0x30,
-    0x30,0x32,0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,
-    0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-    0x64,0x3d,0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,
-    0x20,0x32,0x31,0x2e,0x30,0x30,0x32,0x20,0x32,0x32,
-    0x2e,0x30,0x30,0x32,0x22,0x20,0x78,0x6d,0x6c,0x3a,
-    0x73,0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,
-    0x73,0x65,0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,
-    0x3e,0x0a,0x09,0x3c,0x72,0x65,0x63,0x74,0x20,0x79,
-    0x3d,0x22,0x31,0x30,0x2e,0x32,0x35,0x31,0x22,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x37,0x37,0x37,
-    0x37,0x37,0x37,0x22,0x20,0x77,0x69,0x64,0x74,0x68,
-    0x3d,0x22,0x32,0x31,0x2e,0x30,0x30,0x32,0x22,0x20,
-    0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,0x31,0x2e,
-    0x35,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x67,0x3e,0x0a,
-    0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a
+const size_t fav_remove_svg_size = 374;
+const unsigned char fav_remove_svg_data[374] = {
+    0x45,0x53,0x5a,0x31,0x37,0x02,0x00,0x00,0x78,0xda,
+    0x6d,0x51,0x5d,0x4b,0xc3,0x30,0x14,0x7d,0x76,0xbf,
+    0xe2,0x7a,0x7d,0x12,0x6c,0x3e,0x3a,0xa6,0xae,0xac,
+    0x13,0xf7,0xc1,0x18,0x88,0x0e,0xd4,0x89,0x4f,0xd2,
+    0xb5,0x59,0x1b,0x8c,0x69,0x49,0xd3,0x75,0xfe,0x7b,
+    0x93,0x4e,0x51,0x61,0x79,0x48,0xc8,0xb9,0xe7,0x9e,
+    0x9c,0x73,0x33,0xba,0xd9,0x7f,0x28,0xd8,0x09,0x53,
+    0xcb,0x52,0xc7,0xc8,0x09,0x43,0x10,0x3a,0x2d,0x33,
+    0xa9,0xf3,0x18,0x1b,0xbb,0x0d,0xae,0xf1,0x66,0xdc,
+    0x1b,0x9d,0x06,0x01,0x2c,0x84,0x16,0x26,0xb1,0xa5,
+    0x89,0xe0,0x36,0x2b,0x37,0x02,0x96,0x4a,0x35,0xb5,
+    0xed,0x20,0xe0,0x97,0x84,0x91,0xfe,0x05,0x3c,0xae,
+    0x17,0x30,0xdf,0x57,0xa5,0xb1,0xb0,0x52,0x4d,0x1e,
+    0x2c,0x35,0x90,0x0e,0x5c,0x1f,0xde,0x88,0xc0,0x11,
+    0x19,0x4c,0x1a,0xa9,0x32,0x60,0xe7,0x00,0x41,0xe0,
+    0xe5,0x67,0x0f,0xd3,0xa7,0xd7,0xd5,0x1c,0xea,0x5d,
+    0x0e,0xab,0xe7,0xc9,0xdd,0x72,0x0a,0x18,0x50,0xfa,
+    0xd2,0x9f,0x52,0x3a,0x7b,0x9a,0x75,0x0a,0x9c,0x70,
+    0x4a,0xe7,0xf7,0x08,0x58,0x58,0x5b,0x45,0x94,0xb6,
+    0x6d,0x4b,0xda,0x3e,0x29,0x4d,0x4e,0x17,0x26,0xa9,
+    0x0a,0x99,0xd6,0xd4,0x11,0xa9,0x27,0xba,0x26,0xea,
+    0xc4,0x38,0x27,0x99,0xcd,0xd0,0x3d,0xe1,0x95,0xff,
+    0xe4,0xe4,0x08,0x32,0x8b,0x71,0xbe,0x71,0xa1,0xde,
+    0xdc,0xc5,0x8d,0x41,0xd7,0xf1,0x11,0xe5,0x90,0x31,
+    0xe6,0x95,0xbe,0x29,0xd1,0x5e,0x49,0xfd,0x7e,0x8c,
+    0xc8,0x87,0xc3,0x21,0xed,0xaa,0x8e,0x1a,0x23,0xab,
+    0xf6,0x08,0x9f,0x87,0xb3,0x77,0x02,0xad,0xcc,0x6c,
+    0x11,0x63,0xe8,0x26,0xcc,0x42,0x5f,0x2a,0x84,0xcc,
+    0x0b,0xeb,0x90,0xf0,0x07,0xd9,0x49,0xd1,0x4e,0x4a,
+    0xdf,0x0a,0x0c,0x0e,0x44,0x38,0x54,0xfd,0x9f,0x24,
+    0x1b,0x25,0x82,0x4d,0x92,0xbe,0xe7,0xa6,0x6c,0xb4,
+    0xb3,0xae,0x45,0x0b,0x47,0x98,0xce,0x65,0x54,0x57,
+    0x49,0x2a,0x62,0xac,0x8c,0xa8,0x85,0xd9,0x09,0x1f,
+    0x3f,0x1f,0xf7,0x4e,0x46,0x46,0xa4,0xd6,0x7b,0xe2,
+    0x8c,0x84,0x03,0x17,0x7a,0x2b,0x95,0x8a,0xf1,0xec,
+    0xaa,0x5b,0xf8,0xdf,0xe3,0xaf,0x43,0x4e,0x06,0x48,
+    0x9d,0x04,0xcd,0xfd,0xe6,0x46,0x31,0xee,0x7d,0x01,
+    0xa6,0x1c,0xa4,0x2d
 };
 
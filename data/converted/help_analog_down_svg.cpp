@@ -1,289 +1,123 @@
-//this file was auto-generated from "analog_down.svg" by res2h
+//this file was auto-generated from "analog_down.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_analog_down_svg_size = 2809;
-const unsigned char help_analog_down_svg_data[2809] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x55,0x54,0x46,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x73,
-    0x76,0x67,0x20,0x50,0x55,0x42,0x4c,0x49,0x43,0x20,
-    0x22,0x2d,0x2f,0x2f,0x57,0x33,0x43,0x2f,0x2f,0x44,
-    0x54,0x44,0x20,0x53,0x56,0x47,0x20,0x31,0x2e,0x31,
-    0x2f,0x2f,0x45,0x4e,0x22,0x20,0x22,0x68,0x74,0x74,
-    0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,
-    0x2e,0x6f,0x72,0x67,0x2f,0x47,0x72,0x61,0x70,0x68,
-    0x69,0x63,0x73,0x2f,0x53,0x56,0x47,0x2f,0x31,0x2e,
-    0x31,0x2f,0x44,0x54,0x44,0x2f,0x73,0x76,0x67,0x31,
-    0x31,0x2e,0x64,0x74,0x64,0x22,0x3e,0x0a,0x3c,0x73,
-    0x76,0x67,0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,
-    0x3d,0x22,0x31,0x2e,0x31,0x22,0x20,0x78,0x6d,0x6c,
-    0x6e,0x73,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,
-    0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,
-    0x67,0x2f,0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,
-    0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,
-    0x69,0x6e,0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,
-    0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,
-    0x72,0x67,0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,
-    0x69,0x6e,0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,
-    0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,
-    0x33,0x37,0x2e,0x30,0x36,0x31,0x22,0x20,0x76,0x69,
-    0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x2c,0x20,
-    0x30,0x2c,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,
-    0x20,0x33,0x37,0x2e,0x30,0x36,0x31,0x22,0x3e,0x0a,
-    0x20,0x20,0x3c,0x67,0x20,0x69,0x64,0x3d,0x22,0x45,
-    0x62,0x65,0x6e,0x65,0x5f,0x31,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,
-    0x3d,0x22,0x4d,0x32,0x32,0x2e,0x31,0x34,0x35,0x2c,
-    0x31,0x38,0x2e,0x35,0x31,0x32,0x20,0x43,0x32,0x32,
-    0x2e,0x31,0x34,0x35,0x2c,0x32,0x30,0x2e,0x35,0x32,
-    0x35,0x20,0x32,0x30,0x2e,0x35,0x30,0x36,0x2c,0x32,
-    0x32,0x2e,0x31,0x36,0x31,0x20,0x31,0x38,0x2e,0x34,
-    0x39,0x34,0x2c,0x32,0x32,0x2e,0x31,0x36,0x31,0x20,
-    0x43,0x31,0x36,0x2e,0x34,0x38,0x32,0x2c,0x32,0x32,
-    0x2e,0x31,0x36,0x31,0x20,0x31,0x34,0x2e,0x38,0x34,
-    0x34,0x2c,0x32,0x30,0x2e,0x35,0x32,0x33,0x20,0x31,
-    0x34,0x2e,0x38,0x34,0x34,0x2c,0x31,0x38,0x2e,0x35,
-    0x31,0x32,0x20,0x43,0x31,0x34,0x2e,0x38,0x34,0x34,
-    0x2c,0x31,0x36,0x2e,0x34,0x39,0x39,0x20,0x31,0x36,
-    0x2e,0x34,0x38,0x33,0x2c,0x31,0x34,0x2e,0x38,0x36,
-    0x32,0x20,0x31,0x38,0x2e,0x34,0x39,0x34,0x2c,0x31,
-    0x34,0x2e,0x38,0x36,0x32,0x20,0x43,0x32,0x30,0x2e,
-    0x35,0x30,0x37,0x2c,0x31,0x34,0x2e,0x38,0x36,0x31,
-    0x20,0x32,0x32,0x2e,0x31,0x34,0x35,0x2c,0x31,0x36,
-    0x2e,0x34,0x39,0x39,0x20,0x32,0x32,0x2e,0x31,0x34,
-    0x35,0x2c,0x31,0x38,0x2e,0x35,0x31,0x32,0x20,0x7a,
-    0x20,0x4d,0x31,0x36,0x2e,0x33,0x34,0x33,0x2c,0x31,
-    0x38,0x2e,0x35,0x31,0x32,0x20,0x43,0x31,0x36,0x2e,
-    0x33,0x34,0x33,0x2c,0x31,0x39,0x2e,0x36,0x39,0x38,
-    0x20,0x31,0x37,0x2e,0x33,0x30,0x38,0x2c,0x32,0x30,
-    0x2e,0x36,0x36,0x31,0x20,0x31,0x38,0x2e,0x34,0x39,
-    0x33,0x2c,0x32,0x30,0x2e,0x36,0x36,0x31,0x20,0x43,
-    0x31,0x39,0x2e,0x36,0x37,0x38,0x2c,0x32,0x30,0x2e,
-    0x36,0x36,0x31,0x20,0x32,0x30,0x2e,0x36,0x34,0x34,
-    0x2c,0x31,0x39,0x2e,0x36,0x39,0x36,0x20,0x32,0x30,
-    0x2e,0x36,0x34,0x34,0x2c,0x31,0x38,0x2e,0x35,0x31,
-    0x32,0x20,0x43,0x32,0x30,0x2e,0x36,0x34,0x34,0x2c,
-    0x31,0x37,0x2e,0x33,0x32,0x36,0x20,0x31,0x39,0x2e,
-    0x36,0x37,0x38,0x2c,0x31,0x36,0x2e,0x33,0x36,0x32,
-    0x20,0x31,0x38,0x2e,0x34,0x39,0x33,0x2c,0x31,0x36,
-    0x2e,0x33,0x36,0x32,0x20,0x43,0x31,0x37,0x2e,0x33,
-    0x30,0x38,0x2c,0x31,0x36,0x2e,0x33,0x36,0x31,0x20,
-    0x31,0x36,0x2e,0x33,0x34,0x33,0x2c,0x31,0x37,0x2e,
-    0x33,0x32,0x36,0x20,0x31,0x36,0x2e,0x33,0x34,0x33,
-    0x2c,0x31,0x38,0x2e,0x35,0x31,0x32,0x20,0x7a,0x22,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,
-    0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,
-    0x22,0x4d,0x38,0x2e,0x35,0x38,0x2c,0x31,0x35,0x2e,
-    0x35,0x30,0x37,0x20,0x4c,0x38,0x2e,0x35,0x38,0x2c,
-    0x32,0x31,0x2e,0x35,0x31,0x39,0x20,0x43,0x38,0x2e,
-    0x35,0x38,0x2c,0x32,0x31,0x2e,0x37,0x39,0x32,0x20,
-    0x38,0x2e,0x34,0x33,0x2c,0x32,0x32,0x2e,0x30,0x34,
-    0x34,0x20,0x38,0x2e,0x31,0x39,0x2c,0x32,0x32,0x2e,
-    0x31,0x37,0x36,0x20,0x43,0x37,0x2e,0x39,0x34,0x39,
-    0x2c,0x32,0x32,0x2e,0x33,0x30,0x38,0x20,0x37,0x2e,
-    0x36,0x35,0x36,0x2c,0x32,0x32,0x2e,0x32,0x39,0x37,
-    0x20,0x37,0x2e,0x34,0x32,0x34,0x2c,0x32,0x32,0x2e,
-    0x31,0x35,0x20,0x4c,0x32,0x2e,0x37,0x34,0x2c,0x31,
-    0x39,0x2e,0x31,0x34,0x35,0x20,0x43,0x32,0x2e,0x33,
-    0x30,0x39,0x2c,0x31,0x38,0x2e,0x38,0x36,0x39,0x20,
-    0x32,0x2e,0x33,0x31,0x2c,0x31,0x38,0x2e,0x31,0x35,
-    0x39,0x20,0x32,0x2e,0x37,0x34,0x2c,0x31,0x37,0x2e,
-    0x38,0x38,0x31,0x20,0x4c,0x37,0x2e,0x34,0x32,0x34,
-    0x2c,0x31,0x34,0x2e,0x38,0x37,0x36,0x20,0x43,0x37,
-    0x2e,0x36,0x35,0x35,0x2c,0x31,0x34,0x2e,0x37,0x32,
-    0x39,0x20,0x37,0x2e,0x39,0x34,0x38,0x2c,0x31,0x34,
-    0x2e,0x37,0x31,0x37,0x20,0x38,0x2e,0x31,0x39,0x2c,
-    0x31,0x34,0x2e,0x38,0x35,0x20,0x43,0x38,0x2e,0x34,
-    0x33,0x2c,0x31,0x34,0x2e,0x39,0x38,0x20,0x38,0x2e,
-    0x35,0x38,0x2c,0x31,0x35,0x2e,0x32,0x33,0x32,0x20,
-    0x38,0x2e,0x35,0x38,0x2c,0x31,0x35,0x2e,0x35,0x30,
-    0x37,0x20,0x7a,0x20,0x4d,0x37,0x2e,0x30,0x38,0x2c,
-    0x32,0x30,0x2e,0x31,0x34,0x36,0x20,0x4c,0x37,0x2e,
-    0x30,0x38,0x2c,0x31,0x36,0x2e,0x38,0x37,0x38,0x20,
-    0x4c,0x34,0x2e,0x35,0x33,0x35,0x2c,0x31,0x38,0x2e,
-    0x35,0x31,0x33,0x20,0x4c,0x37,0x2e,0x30,0x38,0x2c,
-    0x32,0x30,0x2e,0x31,0x34,0x36,0x20,0x7a,0x22,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,
-    0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x3c,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,
-    0x4d,0x31,0x38,0x2e,0x34,0x39,0x34,0x2c,0x33,0x33,
-    0x2e,0x39,0x31,0x38,0x20,0x4c,0x32,0x31,0x2e,0x34,
-    0x39,0x38,0x2c,0x32,0x39,0x2e,0x32,0x33,0x34,0x20,
-    0x4c,0x31,0x35,0x2e,0x34,0x38,0x38,0x2c,0x32,0x39,
-    0x2e,0x32,0x33,0x34,0x20,0x4c,0x31,0x38,0x2e,0x34,
-    0x39,0x34,0x2c,0x33,0x33,0x2e,0x39,0x31,0x38,0x20,
-    0x7a,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,
-    0x68,0x20,0x64,0x3d,0x22,0x4d,0x32,0x32,0x2e,0x32,
-    0x34,0x38,0x2c,0x32,0x39,0x2e,0x32,0x33,0x34,0x20,
-    0x43,0x32,0x32,0x2e,0x32,0x34,0x38,0x2c,0x32,0x39,
-    0x2e,0x33,0x37,0x35,0x20,0x32,0x32,0x2e,0x32,0x30,
-    0x38,0x2c,0x32,0x39,0x2e,0x35,0x31,0x36,0x20,0x32,
-    0x32,0x2e,0x31,0x32,0x39,0x2c,0x32,0x39,0x2e,0x36,
-    0x33,0x39,0x20,0x4c,0x31,0x39,0x2e,0x31,0x32,0x36,
-    0x2c,0x33,0x34,0x2e,0x33,0x32,0x33,0x20,0x43,0x31,
-    0x38,0x2e,0x39,0x38,0x38,0x2c,0x33,0x34,0x2e,0x35,
-    0x33,0x38,0x20,0x31,0x38,0x2e,0x37,0x35,0x2c,0x33,
-    0x34,0x2e,0x36,0x36,0x38,0x20,0x31,0x38,0x2e,0x34,
-    0x39,0x35,0x2c,0x33,0x34,0x2e,0x36,0x36,0x38,0x20,
-    0x43,0x31,0x38,0x2e,0x32,0x34,0x2c,0x33,0x34,0x2e,
-    0x36,0x36,0x38,0x20,0x31,0x38,0x2e,0x30,0x30,0x32,
-    0x2c,0x33,0x34,0x2e,0x35,0x33,0x38,0x20,0x31,0x37,
-    0x2e,0x38,0x36,0x34,0x2c,0x33,0x34,0x2e,0x33,0x32,
-    0x33,0x20,0x4c,0x31,0x34,0x2e,0x38,0x35,0x38,0x2c,
-    0x32,0x39,0x2e,0x36,0x33,0x39,0x20,0x43,0x31,0x34,
-    0x2e,0x37,0x31,0x2c,0x32,0x39,0x2e,0x34,0x30,0x39,
-    0x20,0x31,0x34,0x2e,0x37,0x2c,0x32,0x39,0x2e,0x31,
-    0x31,0x35,0x20,0x31,0x34,0x2e,0x38,0x33,0x31,0x2c,
-    0x32,0x38,0x2e,0x38,0x37,0x33,0x20,0x43,0x31,0x34,
-    0x2e,0x39,0x36,0x32,0x2c,0x32,0x38,0x2e,0x36,0x33,
-    0x33,0x20,0x31,0x35,0x2e,0x32,0x31,0x35,0x2c,0x32,
-    0x38,0x2e,0x34,0x38,0x33,0x20,0x31,0x35,0x2e,0x34,
-    0x38,0x39,0x2c,0x32,0x38,0x2e,0x34,0x38,0x33,0x20,
-    0x4c,0x32,0x31,0x2e,0x34,0x39,0x39,0x2c,0x32,0x38,
-    0x2e,0x34,0x38,0x33,0x20,0x43,0x32,0x31,0x2e,0x37,
-    0x37,0x33,0x2c,0x32,0x38,0x2e,0x34,0x38,0x33,0x20,
-    0x32,0x32,0x2e,0x30,0x32,0x35,0x2c,0x32,0x38,0x2e,
-    0x36,0x33,0x31,0x20,0x32,0x32,0x2e,0x31,0x35,0x37,
-    0x2c,0x32,0x38,0x2e,0x38,0x37,0x33,0x20,0x43,0x32,
-    0x32,0x2e,0x32,0x31,0x38,0x2c,0x32,0x38,0x2e,0x39,
-    0x38,0x37,0x20,0x32,0x32,0x2e,0x32,0x34,0x38,0x2c,
-    0x32,0x39,0x2e,0x31,0x31,0x31,0x20,0x32,0x32,0x2e,
-    0x32,0x34,0x38,0x2c,0x32,0x39,0x2e,0x32,0x33,0x34,
-    0x20,0x7a,0x20,0x4d,0x31,0x38,0x2e,0x34,0x39,0x34,
-    0x2c,0x33,0x32,0x2e,0x35,0x32,0x39,0x20,0x4c,0x32,
-    0x30,0x2e,0x31,0x32,0x36,0x2c,0x32,0x39,0x2e,0x39,
-    0x38,0x34,0x20,0x4c,0x31,0x36,0x2e,0x38,0x36,0x31,
-    0x2c,0x32,0x39,0x2e,0x39,0x38,0x34,0x20,0x4c,0x31,
-    0x38,0x2e,0x34,0x39,0x34,0x2c,0x33,0x32,0x2e,0x35,
-    0x32,0x39,0x20,0x7a,0x22,0x20,0x66,0x69,0x6c,0x6c,
-    0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,
-    0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,
-    0x68,0x20,0x64,0x3d,0x22,0x4d,0x32,0x32,0x2e,0x32,
-    0x34,0x38,0x2c,0x37,0x2e,0x38,0x34,0x38,0x20,0x43,
-    0x32,0x32,0x2e,0x32,0x34,0x38,0x2c,0x37,0x2e,0x39,
-    0x37,0x32,0x20,0x32,0x32,0x2e,0x32,0x31,0x38,0x2c,
-    0x38,0x2e,0x30,0x39,0x34,0x20,0x32,0x32,0x2e,0x31,
-    0x35,0x36,0x2c,0x38,0x2e,0x32,0x30,0x36,0x20,0x43,
-    0x32,0x32,0x2e,0x30,0x32,0x34,0x2c,0x38,0x2e,0x34,
-    0x34,0x37,0x20,0x32,0x31,0x2e,0x37,0x37,0x32,0x2c,
-    0x38,0x2e,0x35,0x39,0x38,0x20,0x32,0x31,0x2e,0x34,
-    0x39,0x38,0x2c,0x38,0x2e,0x35,0x39,0x38,0x20,0x4c,
-    0x31,0x35,0x2e,0x34,0x38,0x38,0x2c,0x38,0x2e,0x35,
-    0x39,0x38,0x20,0x43,0x31,0x35,0x2e,0x32,0x31,0x34,
-    0x2c,0x38,0x2e,0x35,0x39,0x38,0x20,0x31,0x34,0x2e,
-    0x39,0x36,0x32,0x2c,0x38,0x2e,0x34,0x34,0x39,0x20,
-    0x31,0x34,0x2e,0x38,0x33,0x2c,0x38,0x2e,0x32,0x30,
-    0x36,0x20,0x43,0x31,0x34,0x2e,0x36,0x39,0x39,0x2c,
-    0x37,0x2e,0x39,0x36,0x37,0x20,0x31,0x34,0x2e,0x37,
-    0x30,0x37,0x2c,0x37,0x2e,0x36,0x37,0x33,0x20,0x31,
-    0x34,0x2e,0x38,0x35,0x37,0x2c,0x37,0x2e,0x34,0x34,
-    0x31,0x20,0x4c,0x31,0x37,0x2e,0x38,0x36,0x32,0x2c,
-    0x32,0x2e,0x37,0x35,0x36,0x20,0x43,0x31,0x38,0x2c,
-    0x32,0x2e,0x35,0x34,0x31,0x20,0x31,0x38,0x2e,0x32,
-    0x33,0x38,0x2c,0x32,0x2e,0x34,0x31,0x31,0x20,0x31,
-    0x38,0x2e,0x34,0x39,0x33,0x2c,0x32,0x2e,0x34,0x31,
-    0x31,0x20,0x43,0x31,0x38,0x2e,0x37,0x34,0x38,0x2c,
-    0x32,0x2e,0x34,0x31,0x31,0x20,0x31,0x38,0x2e,0x39,
-    0x38,0x36,0x2c,0x32,0x2e,0x35,0x34,0x31,0x20,0x31,
-    0x39,0x2e,0x31,0x32,0x34,0x2c,0x32,0x2e,0x37,0x35,
-    0x36,0x20,0x4c,0x32,0x32,0x2e,0x31,0x32,0x38,0x2c,
-    0x37,0x2e,0x34,0x34,0x31,0x20,0x43,0x32,0x32,0x2e,
-    0x32,0x30,0x38,0x2c,0x37,0x2e,0x35,0x36,0x35,0x20,
-    0x32,0x32,0x2e,0x32,0x34,0x38,0x2c,0x37,0x2e,0x37,
-    0x30,0x37,0x20,0x32,0x32,0x2e,0x32,0x34,0x38,0x2c,
-    0x37,0x2e,0x38,0x34,0x38,0x20,0x7a,0x20,0x4d,0x31,
-    0x36,0x2e,0x38,0x36,0x2c,0x37,0x2e,0x30,0x39,0x38,
-    0x20,0x4c,0x32,0x30,0x2e,0x31,0x32,0x36,0x2c,0x37,
-    0x2e,0x30,0x39,0x38,0x20,0x4c,0x31,0x38,0x2e,0x34,
-    0x39,0x33,0x2c,0x34,0x2e,0x35,0x35,0x32,0x20,0x4c,
-    0x31,0x36,0x2e,0x38,0x36,0x2c,0x37,0x2e,0x30,0x39,
-    0x38,0x20,0x7a,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,
-    0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x2f,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,
-    0x68,0x20,0x64,0x3d,0x22,0x4d,0x33,0x34,0x2e,0x35,
-    0x39,0x2c,0x31,0x38,0x2e,0x35,0x31,0x33,0x20,0x4c,
-    0x33,0x34,0x2e,0x35,0x39,0x2c,0x31,0x38,0x2e,0x35,
-    0x31,0x33,0x20,0x43,0x33,0x34,0x2e,0x35,0x39,0x2c,
-    0x31,0x38,0x2e,0x37,0x36,0x38,0x20,0x33,0x34,0x2e,
-    0x34,0x36,0x2c,0x31,0x39,0x2e,0x30,0x30,0x35,0x20,
-    0x33,0x34,0x2e,0x32,0x34,0x35,0x2c,0x31,0x39,0x2e,
-    0x31,0x34,0x34,0x20,0x4c,0x32,0x39,0x2e,0x35,0x36,
-    0x31,0x2c,0x32,0x32,0x2e,0x31,0x34,0x39,0x20,0x43,
-    0x32,0x39,0x2e,0x33,0x33,0x2c,0x32,0x32,0x2e,0x32,
-    0x39,0x36,0x20,0x32,0x39,0x2e,0x30,0x33,0x37,0x2c,
-    0x32,0x32,0x2e,0x33,0x30,0x37,0x20,0x32,0x38,0x2e,
-    0x37,0x39,0x35,0x2c,0x32,0x32,0x2e,0x31,0x37,0x35,
-    0x20,0x43,0x32,0x38,0x2e,0x35,0x35,0x33,0x2c,0x32,
-    0x32,0x2e,0x30,0x34,0x33,0x20,0x32,0x38,0x2e,0x34,
-    0x30,0x34,0x2c,0x32,0x31,0x2e,0x37,0x39,0x31,0x20,
-    0x32,0x38,0x2e,0x34,0x30,0x34,0x2c,0x32,0x31,0x2e,
-    0x35,0x31,0x38,0x20,0x4c,0x32,0x38,0x2e,0x34,0x30,
-    0x34,0x2c,0x31,0x35,0x2e,0x35,0x30,0x36,0x20,0x43,
-    0x32,0x38,0x2e,0x34,0x30,0x34,0x2c,0x31,0x35,0x2e,
-    0x32,0x33,0x33,0x20,0x32,0x38,0x2e,0x35,0x35,0x32,
-    0x2c,0x31,0x34,0x2e,0x39,0x38,0x31,0x20,0x32,0x38,
-    0x2e,0x37,0x39,0x35,0x2c,0x31,0x34,0x2e,0x38,0x34,
-    0x39,0x20,0x43,0x32,0x39,0x2e,0x30,0x33,0x35,0x2c,
-    0x31,0x34,0x2e,0x37,0x31,0x36,0x20,0x32,0x39,0x2e,
-    0x33,0x32,0x38,0x2c,0x31,0x34,0x2e,0x37,0x32,0x38,
-    0x20,0x32,0x39,0x2e,0x35,0x36,0x31,0x2c,0x31,0x34,
-    0x2e,0x38,0x37,0x35,0x20,0x4c,0x33,0x34,0x2e,0x32,
-    0x34,0x35,0x2c,0x31,0x37,0x2e,0x38,0x38,0x20,0x43,
-    0x33,0x34,0x2e,0x34,0x36,0x2c,0x31,0x38,0x2e,0x30,
-    0x32,0x20,0x33,0x34,0x2e,0x35,0x39,0x2c,0x31,0x38,
-    0x2e,0x32,0x35,0x37,0x20,0x33,0x34,0x2e,0x35,0x39,
-    0x2c,0x31,0x38,0x2e,0x35,0x31,0x33,0x20,0x7a,0x20,
-    0x4d,0x32,0x39,0x2e,0x39,0x30,0x36,0x2c,0x32,0x30,
-    0x2e,0x31,0x34,0x36,0x20,0x4c,0x33,0x32,0x2e,0x34,
-    0x35,0x31,0x2c,0x31,0x38,0x2e,0x35,0x31,0x33,0x20,
-    0x4c,0x32,0x39,0x2e,0x39,0x30,0x36,0x2c,0x31,0x36,
-    0x2e,0x38,0x37,0x38,0x20,0x4c,0x32,0x39,0x2e,0x39,
-    0x30,0x36,0x2c,0x32,0x30,0x2e,0x31,0x34,0x36,0x20,
-    0x7a,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x64,0x3d,0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,0x2c,
-    0x30,0x20,0x43,0x32,0x38,0x2e,0x37,0x36,0x35,0x2c,
-    0x30,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,0x38,
-    0x2e,0x32,0x39,0x36,0x20,0x33,0x37,0x2e,0x30,0x36,
-    0x31,0x2c,0x31,0x38,0x2e,0x35,0x33,0x31,0x20,0x43,
-    0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,0x32,0x38,0x2e,
-    0x37,0x36,0x35,0x20,0x32,0x38,0x2e,0x37,0x36,0x35,
-    0x2c,0x33,0x37,0x2e,0x30,0x36,0x31,0x20,0x31,0x38,
-    0x2e,0x35,0x33,0x2c,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x20,0x43,0x38,0x2e,0x32,0x39,0x36,0x2c,0x33,0x37,
-    0x2e,0x30,0x36,0x31,0x20,0x30,0x2c,0x32,0x38,0x2e,
-    0x37,0x36,0x35,0x20,0x30,0x2c,0x31,0x38,0x2e,0x35,
-    0x33,0x31,0x20,0x43,0x30,0x2c,0x38,0x2e,0x32,0x39,
-    0x36,0x20,0x38,0x2e,0x32,0x39,0x36,0x2c,0x30,0x20,
-    0x31,0x38,0x2e,0x35,0x33,0x2c,0x30,0x20,0x7a,0x20,
-    0x4d,0x31,0x38,0x2e,0x35,0x33,0x2c,0x31,0x20,0x43,
-    0x38,0x2e,0x38,0x34,0x39,0x2c,0x31,0x20,0x31,0x2c,
-    0x38,0x2e,0x38,0x34,0x39,0x20,0x31,0x2c,0x31,0x38,
-    0x2e,0x35,0x33,0x31,0x20,0x43,0x31,0x2c,0x32,0x38,
-    0x2e,0x32,0x31,0x32,0x20,0x38,0x2e,0x38,0x34,0x39,
-    0x2c,0x33,0x36,0x2e,0x30,0x36,0x31,0x20,0x31,0x38,
-    0x2e,0x35,0x33,0x2c,0x33,0x36,0x2e,0x30,0x36,0x31,
-    0x20,0x43,0x32,0x38,0x2e,0x32,0x31,0x32,0x2c,0x33,
-    0x36,0x2e,0x30,0x36,0x31,0x20,0x33,0x36,0x2e,0x30,
-    0x36,0x31,0x2c,0x32,0x38,0x2e,0x32,0x31,0x32,0x20,
-    0x33,0x36,0x2e,0x30,0x36,0x31,0x2c,0x31,0x38,0x2e,
-    0x35,0x33,0x31,0x20,0x43,0x33,0x36,0x2e,0x30,0x36,
-    0x31,0x2c,0x38,0x2e,0x38,0x34,0x39,0x20,0x32,0x38,
-    0x2e,0x32,0x31,0x32,0x2c,0x31,0x20,0x31,0x38,0x2e,
-    0x35,0x33,0x2c,0x31,0x20,0x7a,0x22,0x20,0x66,0x69,
-    0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,
-    0x46,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a
+const size_t help_analog_down_svg_size = 1142;
+const unsigned char help_analog_down_svg_data[1142] = {
+    0x45,0x53,0x5a,0x31,0xf9,0x0a,0x00,0x00,0x78,0xda,
+    0x85,0x56,0x5b,0x6f,0x13,0x47,0x14,0x7e,0xe7,0x57,
+    0x9c,0x6e,0x5f,0xcd,0xee,0xdc,0x2f,0x28,0x06,0x89,
+    0x4d,0x40,0x95,0x4c,0x8b,0x44,0xa0,0xea,0x53,0x45,
+    0x89,0x6b,0x5b,0x4d,0x9d,0x28,0xb1,0x62,0xca,0xaf,
+    0xef,0x77,0xce,0xcc,0xac,0x6d,0x94,0x88,0x28,0xca,
+    0xee,0x37,0x73,0xae,0xdf,0xb9,0x6c,0xce,0x5e,0x7d,
+    0xfd,0xf7,0x9a,0x1e,0x96,0x77,0xf7,0x9b,0x9b,0xed,
+    0xbc,0xd3,0xbd,0xea,0x68,0xb9,0xfd,0x72,0x73,0xb5,
+    0xd9,0xae,0xe6,0xdd,0xc7,0xcb,0x37,0xcf,0x53,0xf7,
+    0xea,0xe5,0xb3,0xb3,0x9f,0xce,0x7f,0x1b,0x2f,0xff,
+    0x78,0x7f,0x41,0xf7,0x0f,0x2b,0x7a,0xff,0xf1,0xf5,
+    0xe2,0x97,0x91,0xba,0xe7,0xc3,0xf0,0xbb,0x1d,0x87,
+    0xe1,0xfc,0xf2,0x9c,0x3e,0x7c,0x7a,0x4b,0xba,0xd7,
+    0xc3,0x70,0xf1,0x6b,0x47,0xdd,0x7a,0xb7,0xbb,0x7d,
+    0x31,0x0c,0xfb,0xfd,0xbe,0xdf,0xdb,0xfe,0xe6,0x6e,
+    0x35,0xbc,0xbd,0xfb,0x7c,0xbb,0xde,0x7c,0xb9,0x1f,
+    0x20,0x38,0xb0,0x20,0x94,0x06,0x18,0xd3,0xba,0xbf,
+    0xda,0x5d,0x75,0x70,0xc1,0x96,0x8f,0x02,0xd1,0x1d,
+    0x21,0xb4,0xed,0xfd,0xfc,0x11,0x63,0x46,0x29,0xc5,
+    0xca,0x55,0xe4,0xc5,0xd7,0xeb,0xcd,0xf6,0x9f,0xc7,
+    0x04,0x75,0xce,0x79,0x90,0x5b,0x88,0xce,0x3b,0x24,
+    0xf7,0x9f,0xfc,0xdd,0x6f,0xae,0x76,0xeb,0x79,0x67,
+    0x63,0xaf,0x02,0x1c,0xad,0x97,0x9b,0xd5,0x7a,0x77,
+    0xc0,0x0f,0x9b,0xe5,0xfe,0xf5,0x0d,0x2b,0xcc,0x08,
+    0xbf,0xe5,0xb8,0x3d,0x11,0x2b,0xd1,0xd9,0x8a,0x36,
+    0x57,0xf3,0xee,0xe2,0xaf,0xe5,0x76,0xf9,0x67,0x39,
+    0xc2,0xe1,0xed,0xe7,0xdd,0x9a,0x70,0xfc,0xce,0x98,
+    0x5e,0x3b,0x3f,0xd3,0xa9,0xf7,0xda,0xd0,0x58,0xa1,
+    0x51,0xbd,0x37,0x9e,0xf8,0xa1,0xc2,0x8c,0x0f,0x83,
+    0x26,0xc8,0xb8,0xec,0x1a,0x1a,0x75,0xe8,0x5d,0x32,
+    0xd3,0xa5,0xeb,0x93,0x73,0x45,0xd1,0x36,0xd4,0xac,
+    0x36,0x08,0x8d,0x9c,0x49,0x14,0xed,0x8c,0x0f,0x83,
+    0x69,0x56,0x2b,0x1a,0xc5,0x65,0x2c,0x50,0x53,0x8b,
+    0xae,0x28,0x9e,0xc6,0xfa,0x8d,0xde,0xe1,0xdc,0x3a,
+    0x7b,0x70,0x53,0x61,0xee,0x43,0x4e,0xa4,0x63,0x6f,
+    0x55,0xe2,0x88,0x42,0x0b,0xde,0x36,0x34,0xb2,0x4c,
+    0x9c,0x2e,0xf9,0xc1,0xf1,0xb1,0x62,0x98,0x50,0xa3,
+    0xa4,0x42,0x98,0x33,0x81,0xaa,0x22,0xbb,0x6a,0xc1,
+    0xdb,0x86,0xc6,0xea,0x52,0xa0,0xa6,0x16,0x4e,0x55,
+    0x3c,0x89,0xf5,0x5b,0x47,0x7f,0x6f,0xae,0xaf,0xe7,
+    0xdd,0xcf,0x6f,0xe4,0xa7,0x1b,0xbe,0x2f,0x0c,0xe4,
+    0x60,0xc9,0x33,0x1b,0xb4,0x10,0x60,0x34,0x54,0x33,
+    0x8d,0x0d,0xc4,0x6c,0x08,0xfe,0x2d,0x97,0x40,0x39,
+    0x87,0x77,0x9d,0xa5,0x1c,0x31,0xd0,0x18,0xfb,0xec,
+    0x04,0x21,0x20,0x8a,0x7d,0xf0,0x52,0x46,0x93,0x23,
+    0x80,0x33,0xa5,0x8a,0x9e,0x16,0xa6,0x8f,0x92,0x37,
+    0x78,0x45,0xa6,0x10,0xce,0x1c,0x61,0x0a,0x20,0xbb,
+    0xb7,0x9a,0xdf,0xb5,0xe7,0xf7,0x28,0x04,0xa4,0xa4,
+    0x69,0x51,0xf4,0xb9,0x40,0xc5,0x4f,0xf0,0x9e,0x51,
+    0x34,0x99,0xd8,0x69,0x12,0xa0,0x63,0x09,0x87,0xc5,
+    0x3c,0x87,0xec,0xa4,0xe0,0x28,0x4b,0xcb,0xcb,0x58,
+    0x43,0xc7,0x39,0xa2,0x9c,0x68,0x5a,0x29,0x89,0x76,
+    0x81,0xdd,0x14,0x26,0x53,0x4c,0xb4,0x70,0xbd,0xb7,
+    0xb5,0xf0,0xb6,0x5e,0x55,0xb9,0x27,0x89,0x5c,0x95,
+    0xe7,0x31,0xa5,0xb5,0xd5,0xac,0xed,0xb3,0x86,0x51,
+    0x50,0xe8,0x32,0x0c,0x65,0xc4,0xe2,0x68,0x81,0x38,
+    0x5c,0x3a,0x82,0x27,0xc2,0x4f,0xb9,0xf9,0x6e,0x94,
+    0x8c,0x9b,0x0c,0x8c,0x07,0x68,0xa3,0xe7,0xde,0x35,
+    0x4a,0x90,0xd7,0x41,0x3a,0xd9,0x64,0x46,0xc1,0x66,
+    0xf8,0x42,0x01,0x4c,0x98,0x59,0x87,0x4e,0xb1,0x68,
+    0xa3,0x04,0xa2,0x12,0x43,0x6f,0x13,0xf7,0x58,0xf4,
+    0x0c,0x42,0x48,0xa5,0xe1,0x26,0xc4,0x92,0xa8,0xc5,
+    0xe1,0x4e,0x29,0x33,0xa9,0xa1,0x5c,0xc1,0x35,0x9b,
+    0x0b,0x29,0x44,0x6a,0x1e,0x47,0xa9,0x11,0x23,0xa7,
+    0x32,0x4f,0x6b,0xe4,0x77,0x8d,0x8e,0x60,0x39,0x14,
+    0xde,0xa0,0x09,0xa2,0x15,0xb9,0x1c,0x0c,0xc3,0x60,
+    0x31,0xd6,0x28,0x9b,0xf6,0x8c,0x30,0xc0,0x24,0x84,
+    0xe5,0x86,0x0a,0x9d,0x13,0x1c,0xb9,0x41,0xa3,0x6d,
+    0x90,0x5b,0xd4,0xf8,0x62,0xa7,0x8c,0xb5,0x8f,0x93,
+    0x13,0xe6,0x46,0x27,0x86,0x39,0x45,0x3a,0xf0,0xa6,
+    0xb5,0xa6,0x53,0x52,0x79,0xe6,0x6b,0x5d,0x0c,0x16,
+    0x0d,0xa8,0xe3,0x36,0x00,0x75,0xb8,0xcf,0x89,0xab,
+    0x16,0x78,0x6f,0x1c,0xe0,0x89,0xf0,0x93,0xbd,0x32,
+    0xac,0x1e,0x59,0x8b,0xec,0x16,0x1c,0xba,0x34,0x95,
+    0x12,0xed,0x1d,0x0d,0xd5,0x68,0x41,0x76,0x76,0x25,
+    0x93,0x00,0x60,0x54,0x10,0x39,0x85,0x7a,0xc0,0xa9,
+    0x43,0x1e,0x4c,0x80,0x01,0xf0,0xe8,0xfa,0xda,0x6b,
+    0x05,0xb4,0x56,0x2b,0x68,0x14,0x56,0x5d,0x45,0x95,
+    0x70,0x36,0x91,0x4b,0x31,0x9a,0x71,0x80,0x00,0x7e,
+    0x11,0x44,0x88,0x52,0x32,0xac,0x49,0x4c,0x5f,0x2c,
+    0xdb,0xd6,0x33,0x70,0x0e,0xf3,0x29,0x85,0x47,0xc9,
+    0xd0,0x35,0xac,0x05,0xee,0x7a,0xef,0x64,0x01,0x1a,
+    0xcb,0xc0,0xe9,0xc3,0x36,0x14,0xc0,0x5d,0x14,0xdd,
+    0xd1,0x55,0x4e,0xa1,0x29,0x71,0x63,0xba,0x6a,0x6b,
+    0x21,0x5d,0x9b,0xaa,0x9f,0xb1,0x76,0x74,0xec,0x7d,
+    0xf0,0x34,0x31,0x84,0xa8,0xe8,0x84,0xbc,0xb2,0xa6,
+    0x61,0x11,0x53,0xcb,0xb9,0xd7,0x82,0x55,0x54,0x03,
+    0x41,0xcb,0x7a,0x53,0xab,0x57,0xaf,0x7e,0xbc,0x21,
+    0xb9,0xd1,0xf3,0xb4,0x14,0x4e,0xd0,0x38,0xa1,0x88,
+    0xc1,0x00,0x70,0x81,0xb7,0x9c,0x52,0x9e,0x81,0xe1,
+    0x8f,0x08,0xef,0x3c,0x74,0x08,0x0f,0x24,0x37,0x0c,
+    0x7f,0x5a,0x30,0x17,0x3c,0xad,0xb6,0x6c,0x4a,0x4c,
+    0x29,0x34,0x6c,0x2c,0x4b,0x14,0x59,0xc1,0x18,0x46,
+    0x4f,0x16,0x2c,0x2f,0x4b,0x78,0xf2,0x75,0xf7,0x5a,
+    0xbe,0x74,0xca,0x95,0xad,0xac,0x8f,0x90,0x97,0x45,
+    0x53,0xa0,0x2c,0xba,0x20,0x9a,0x15,0x1a,0x2b,0x9a,
+    0xc8,0xbd,0x2c,0x47,0xdd,0x9c,0xc8,0x07,0xb3,0x84,
+    0xa3,0x6c,0x59,0xaf,0x5a,0xe2,0xb1,0xa6,0xec,0x57,
+    0x93,0xa8,0x46,0x2e,0x8b,0xd8,0x4b,0xfe,0x92,0x17,
+    0x6f,0x69,0xc9,0x9f,0x53,0x46,0x93,0x1a,0x9a,0xb8,
+    0x30,0x3e,0xd2,0x09,0x4d,0xa8,0x0d,0x4f,0x0a,0x7f,
+    0xe2,0xeb,0xd6,0xc5,0xa4,0x38,0xaf,0x27,0x52,0xeb,
+    0x6d,0x5b,0xc3,0xa7,0xc2,0x3f,0xae,0x10,0x9b,0xb1,
+    0x33,0x25,0x29,0xc7,0xe0,0xf1,0x56,0xff,0x41,0x49,
+    0xc2,0x6f,0x05,0x22,0x85,0x86,0xaa,0xb0,0xc8,0x52,
+    0x55,0x29,0x87,0x54,0x2c,0x55,0x30,0x8a,0x7a,0x43,
+    0xaa,0x69,0xa8,0xc9,0x92,0xaa,0x0e,0x8a,0x9c,0xa2,
+    0x16,0x47,0x59,0x1f,0x78,0x15,0x1b,0x60,0x18,0x2f,
+    0x1c,0x0c,0x73,0x7d,0x88,0x43,0x42,0x30,0x9a,0x3f,
+    0x4f,0x2c,0x62,0xc3,0x71,0x04,0x05,0x8c,0x45,0xa2,
+    0xc1,0xf2,0x68,0x6a,0x15,0x4d,0x69,0x85,0x9a,0x32,
+    0x7b,0xa9,0x7a,0xcd,0x9c,0x7e,0x82,0x44,0xd9,0x48,
+    0x67,0xfc,0x8f,0xe3,0xcb,0x67,0xff,0x03,0x88,0x90,
+    0x51,0xfb
 };
 
@@ -1,292 +1,120 @@
-//this file was auto-generated from "analog_left.svg" by res2h
+//this file was auto-generated from "analog_left.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_analog_left_svg_size = 2834;
-const unsigned char help_analog_left_svg_data[2834] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x55,0x54,0x46,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x73,
-    0x76,0x67,0x20,0x50,0x55,0x42,0x4c,0x49,0x43,0x20,
-    0x22,0x2d,0x2f,0x2f,0x57,0x33,0x43,0x2f,0x2f,0x44,
-    0x54,0x44,0x20,0x53,0x56,0x47,0x20,0x31,0x2e,0x31,
-    0x2f,0x2f,0x45,0x4e,0x22,0x20,0x22,0x68,0x74,0x74,
-    0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,
-    0x2e,0x6f,0x72,0x67,0x2f,0x47,0x72,0x61,0x70,0x68,
-    0x69,0x63,0x73,0x2f,0x53,0x56,0x47,0x2f,0x31,0x2e,
-    0x31,0x2f,0x44,0x54,0x44,0x2f,0x73,0x76,0x67,0x31,
-    0x31,0x2e,0x64,0x74,0x64,0x22,0x3e,0x0a,0x3c,0x73,
-    0x76,0x67,0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,
-    0x3d,0x22,0x31,0x2e,0x31,0x22,0x20,0x78,0x6d,0x6c,
-    0x6e,0x73,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,
-    0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,
-    0x67,0x2f,0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,
-    0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,
-    0x69,0x6e,0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,
-    0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,
-    0x72,0x67,0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,
-    0x69,0x6e,0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,
-    0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,
-    0x33,0x37,0x2e,0x30,0x36,0x31,0x22,0x20,0x76,0x69,
-    0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x2c,0x20,
-    0x30,0x2c,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,
-    0x20,0x33,0x37,0x2e,0x30,0x36,0x31,0x22,0x3e,0x0a,
-    0x20,0x20,0x3c,0x67,0x20,0x69,0x64,0x3d,0x22,0x45,
-    0x62,0x65,0x6e,0x65,0x5f,0x31,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x3c,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,
-    0x3d,0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,
-    0x32,0x32,0x2e,0x31,0x38,0x31,0x20,0x43,0x31,0x36,
-    0x2e,0x35,0x31,0x38,0x2c,0x32,0x32,0x2e,0x31,0x38,
-    0x31,0x20,0x31,0x34,0x2e,0x38,0x38,0x32,0x2c,0x32,
-    0x30,0x2e,0x35,0x34,0x32,0x20,0x31,0x34,0x2e,0x38,
-    0x38,0x32,0x2c,0x31,0x38,0x2e,0x35,0x33,0x20,0x43,
-    0x31,0x34,0x2e,0x38,0x38,0x32,0x2c,0x31,0x36,0x2e,
-    0x35,0x31,0x38,0x20,0x31,0x36,0x2e,0x35,0x32,0x2c,
-    0x31,0x34,0x2e,0x38,0x38,0x20,0x31,0x38,0x2e,0x35,
-    0x33,0x31,0x2c,0x31,0x34,0x2e,0x38,0x38,0x20,0x43,
-    0x32,0x30,0x2e,0x35,0x34,0x34,0x2c,0x31,0x34,0x2e,
-    0x38,0x38,0x20,0x32,0x32,0x2e,0x31,0x38,0x31,0x2c,
-    0x31,0x36,0x2e,0x35,0x31,0x39,0x20,0x32,0x32,0x2e,
-    0x31,0x38,0x31,0x2c,0x31,0x38,0x2e,0x35,0x33,0x20,
-    0x43,0x32,0x32,0x2e,0x31,0x38,0x32,0x2c,0x32,0x30,
-    0x2e,0x35,0x34,0x33,0x20,0x32,0x30,0x2e,0x35,0x34,
-    0x34,0x2c,0x32,0x32,0x2e,0x31,0x38,0x31,0x20,0x31,
-    0x38,0x2e,0x35,0x33,0x31,0x2c,0x32,0x32,0x2e,0x31,
-    0x38,0x31,0x20,0x7a,0x20,0x4d,0x31,0x38,0x2e,0x35,
-    0x33,0x31,0x2c,0x31,0x36,0x2e,0x33,0x37,0x39,0x20,
-    0x43,0x31,0x37,0x2e,0x33,0x34,0x35,0x2c,0x31,0x36,
-    0x2e,0x33,0x37,0x39,0x20,0x31,0x36,0x2e,0x33,0x38,
-    0x32,0x2c,0x31,0x37,0x2e,0x33,0x34,0x34,0x20,0x31,
-    0x36,0x2e,0x33,0x38,0x32,0x2c,0x31,0x38,0x2e,0x35,
-    0x32,0x39,0x20,0x43,0x31,0x36,0x2e,0x33,0x38,0x32,
-    0x2c,0x31,0x39,0x2e,0x37,0x31,0x34,0x20,0x31,0x37,
-    0x2e,0x33,0x34,0x37,0x2c,0x32,0x30,0x2e,0x36,0x38,
-    0x20,0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,0x32,0x30,
-    0x2e,0x36,0x38,0x20,0x43,0x31,0x39,0x2e,0x37,0x31,
-    0x37,0x2c,0x32,0x30,0x2e,0x36,0x38,0x20,0x32,0x30,
-    0x2e,0x36,0x38,0x31,0x2c,0x31,0x39,0x2e,0x37,0x31,
-    0x34,0x20,0x32,0x30,0x2e,0x36,0x38,0x31,0x2c,0x31,
-    0x38,0x2e,0x35,0x32,0x39,0x20,0x43,0x32,0x30,0x2e,
-    0x36,0x38,0x32,0x2c,0x31,0x37,0x2e,0x33,0x34,0x34,
-    0x20,0x31,0x39,0x2e,0x37,0x31,0x37,0x2c,0x31,0x36,
-    0x2e,0x33,0x37,0x39,0x20,0x31,0x38,0x2e,0x35,0x33,
-    0x31,0x2c,0x31,0x36,0x2e,0x33,0x37,0x39,0x20,0x7a,
-    0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,
-    0x46,0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x64,0x3d,0x22,0x4d,0x32,0x31,0x2e,0x35,0x33,
-    0x36,0x2c,0x38,0x2e,0x36,0x31,0x36,0x20,0x4c,0x31,
-    0x35,0x2e,0x35,0x32,0x34,0x2c,0x38,0x2e,0x36,0x31,
-    0x36,0x20,0x43,0x31,0x35,0x2e,0x32,0x35,0x31,0x2c,
-    0x38,0x2e,0x36,0x31,0x36,0x20,0x31,0x34,0x2e,0x39,
-    0x39,0x39,0x2c,0x38,0x2e,0x34,0x36,0x36,0x20,0x31,
-    0x34,0x2e,0x38,0x36,0x37,0x2c,0x38,0x2e,0x32,0x32,
-    0x36,0x20,0x43,0x31,0x34,0x2e,0x37,0x33,0x35,0x2c,
-    0x37,0x2e,0x39,0x38,0x35,0x20,0x31,0x34,0x2e,0x37,
-    0x34,0x36,0x2c,0x37,0x2e,0x36,0x39,0x32,0x20,0x31,
-    0x34,0x2e,0x38,0x39,0x33,0x2c,0x37,0x2e,0x34,0x36,
-    0x20,0x4c,0x31,0x37,0x2e,0x38,0x39,0x38,0x2c,0x32,
-    0x2e,0x37,0x37,0x36,0x20,0x43,0x31,0x38,0x2e,0x31,
-    0x37,0x34,0x2c,0x32,0x2e,0x33,0x34,0x35,0x20,0x31,
-    0x38,0x2e,0x38,0x38,0x34,0x2c,0x32,0x2e,0x33,0x34,
-    0x36,0x20,0x31,0x39,0x2e,0x31,0x36,0x32,0x2c,0x32,
-    0x2e,0x37,0x37,0x36,0x20,0x4c,0x32,0x32,0x2e,0x31,
-    0x36,0x37,0x2c,0x37,0x2e,0x34,0x36,0x20,0x43,0x32,
-    0x32,0x2e,0x33,0x31,0x34,0x2c,0x37,0x2e,0x36,0x39,
-    0x31,0x20,0x32,0x32,0x2e,0x33,0x32,0x36,0x2c,0x37,
-    0x2e,0x39,0x38,0x34,0x20,0x32,0x32,0x2e,0x31,0x39,
-    0x33,0x2c,0x38,0x2e,0x32,0x32,0x36,0x20,0x43,0x32,
-    0x32,0x2e,0x30,0x36,0x33,0x2c,0x38,0x2e,0x34,0x36,
-    0x36,0x20,0x32,0x31,0x2e,0x38,0x31,0x31,0x2c,0x38,
-    0x2e,0x36,0x31,0x36,0x20,0x32,0x31,0x2e,0x35,0x33,
-    0x36,0x2c,0x38,0x2e,0x36,0x31,0x36,0x20,0x7a,0x20,
-    0x4d,0x31,0x36,0x2e,0x38,0x39,0x37,0x2c,0x37,0x2e,
-    0x31,0x31,0x36,0x20,0x4c,0x32,0x30,0x2e,0x31,0x36,
-    0x35,0x2c,0x37,0x2e,0x31,0x31,0x36,0x20,0x4c,0x31,
-    0x38,0x2e,0x35,0x33,0x2c,0x34,0x2e,0x35,0x37,0x31,
-    0x20,0x4c,0x31,0x36,0x2e,0x38,0x39,0x37,0x2c,0x37,
-    0x2e,0x31,0x31,0x36,0x20,0x7a,0x22,0x20,0x66,0x69,
-    0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,
-    0x46,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,
-    0x3d,0x22,0x4d,0x33,0x2e,0x31,0x32,0x35,0x2c,0x31,
-    0x38,0x2e,0x35,0x33,0x20,0x4c,0x37,0x2e,0x38,0x30,
-    0x39,0x2c,0x32,0x31,0x2e,0x35,0x33,0x34,0x20,0x4c,
-    0x37,0x2e,0x38,0x30,0x39,0x2c,0x31,0x35,0x2e,0x35,
-    0x32,0x34,0x20,0x4c,0x33,0x2e,0x31,0x32,0x35,0x2c,
-    0x31,0x38,0x2e,0x35,0x33,0x20,0x7a,0x22,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,
-    0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x64,0x3d,0x22,0x4d,0x37,0x2e,0x38,0x30,0x39,0x2c,
-    0x32,0x32,0x2e,0x32,0x38,0x34,0x20,0x43,0x37,0x2e,
-    0x36,0x36,0x38,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,
-    0x20,0x37,0x2e,0x35,0x32,0x37,0x2c,0x32,0x32,0x2e,
-    0x32,0x34,0x34,0x20,0x37,0x2e,0x34,0x30,0x34,0x2c,
-    0x32,0x32,0x2e,0x31,0x36,0x35,0x20,0x4c,0x32,0x2e,
-    0x37,0x32,0x2c,0x31,0x39,0x2e,0x31,0x36,0x32,0x20,
-    0x43,0x32,0x2e,0x35,0x30,0x35,0x2c,0x31,0x39,0x2e,
-    0x30,0x32,0x34,0x20,0x32,0x2e,0x33,0x37,0x35,0x2c,
-    0x31,0x38,0x2e,0x37,0x38,0x36,0x20,0x32,0x2e,0x33,
-    0x37,0x35,0x2c,0x31,0x38,0x2e,0x35,0x33,0x31,0x20,
-    0x43,0x32,0x2e,0x33,0x37,0x35,0x2c,0x31,0x38,0x2e,
-    0x32,0x37,0x36,0x20,0x32,0x2e,0x35,0x30,0x35,0x2c,
-    0x31,0x38,0x2e,0x30,0x33,0x38,0x20,0x32,0x2e,0x37,
-    0x32,0x2c,0x31,0x37,0x2e,0x39,0x20,0x4c,0x37,0x2e,
-    0x34,0x30,0x34,0x2c,0x31,0x34,0x2e,0x38,0x39,0x34,
-    0x20,0x43,0x37,0x2e,0x36,0x33,0x34,0x2c,0x31,0x34,
-    0x2e,0x37,0x34,0x36,0x20,0x37,0x2e,0x39,0x32,0x38,
-    0x2c,0x31,0x34,0x2e,0x37,0x33,0x36,0x20,0x38,0x2e,
-    0x31,0x37,0x2c,0x31,0x34,0x2e,0x38,0x36,0x37,0x20,
-    0x43,0x38,0x2e,0x34,0x31,0x2c,0x31,0x34,0x2e,0x39,
-    0x39,0x38,0x20,0x38,0x2e,0x35,0x36,0x2c,0x31,0x35,
-    0x2e,0x32,0x35,0x31,0x20,0x38,0x2e,0x35,0x36,0x2c,
-    0x31,0x35,0x2e,0x35,0x32,0x35,0x20,0x4c,0x38,0x2e,
-    0x35,0x36,0x2c,0x32,0x31,0x2e,0x35,0x33,0x35,0x20,
-    0x43,0x38,0x2e,0x35,0x36,0x2c,0x32,0x31,0x2e,0x38,
-    0x30,0x39,0x20,0x38,0x2e,0x34,0x31,0x32,0x2c,0x32,
-    0x32,0x2e,0x30,0x36,0x31,0x20,0x38,0x2e,0x31,0x37,
-    0x2c,0x32,0x32,0x2e,0x31,0x39,0x33,0x20,0x43,0x38,
-    0x2e,0x30,0x35,0x36,0x2c,0x32,0x32,0x2e,0x32,0x35,
-    0x34,0x20,0x37,0x2e,0x39,0x33,0x32,0x2c,0x32,0x32,
-    0x2e,0x32,0x38,0x34,0x20,0x37,0x2e,0x38,0x30,0x39,
-    0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,0x20,0x7a,0x20,
-    0x4d,0x34,0x2e,0x35,0x31,0x34,0x2c,0x31,0x38,0x2e,
-    0x35,0x33,0x20,0x4c,0x37,0x2e,0x30,0x35,0x39,0x2c,
-    0x32,0x30,0x2e,0x31,0x36,0x32,0x20,0x4c,0x37,0x2e,
-    0x30,0x35,0x39,0x2c,0x31,0x36,0x2e,0x38,0x39,0x37,
-    0x20,0x4c,0x34,0x2e,0x35,0x31,0x34,0x2c,0x31,0x38,
-    0x2e,0x35,0x33,0x20,0x7a,0x22,0x20,0x66,0x69,0x6c,
-    0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,
-    0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,
-    0x4d,0x32,0x39,0x2e,0x31,0x39,0x35,0x2c,0x32,0x32,
-    0x2e,0x32,0x38,0x34,0x20,0x43,0x32,0x39,0x2e,0x30,
-    0x37,0x31,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,0x20,
-    0x32,0x38,0x2e,0x39,0x34,0x39,0x2c,0x32,0x32,0x2e,
-    0x32,0x35,0x34,0x20,0x32,0x38,0x2e,0x38,0x33,0x37,
-    0x2c,0x32,0x32,0x2e,0x31,0x39,0x32,0x20,0x43,0x32,
-    0x38,0x2e,0x35,0x39,0x36,0x2c,0x32,0x32,0x2e,0x30,
-    0x36,0x20,0x32,0x38,0x2e,0x34,0x34,0x35,0x2c,0x32,
-    0x31,0x2e,0x38,0x30,0x38,0x20,0x32,0x38,0x2e,0x34,
-    0x34,0x35,0x2c,0x32,0x31,0x2e,0x35,0x33,0x34,0x20,
-    0x4c,0x32,0x38,0x2e,0x34,0x34,0x35,0x2c,0x31,0x35,
-    0x2e,0x35,0x32,0x34,0x20,0x43,0x32,0x38,0x2e,0x34,
-    0x34,0x35,0x2c,0x31,0x35,0x2e,0x32,0x35,0x20,0x32,
-    0x38,0x2e,0x35,0x39,0x34,0x2c,0x31,0x34,0x2e,0x39,
-    0x39,0x38,0x20,0x32,0x38,0x2e,0x38,0x33,0x37,0x2c,
-    0x31,0x34,0x2e,0x38,0x36,0x36,0x20,0x43,0x32,0x39,
-    0x2e,0x30,0x37,0x36,0x2c,0x31,0x34,0x2e,0x37,0x33,
-    0x35,0x20,0x32,0x39,0x2e,0x33,0x37,0x2c,0x31,0x34,
-    0x2e,0x37,0x34,0x33,0x20,0x32,0x39,0x2e,0x36,0x30,
-    0x32,0x2c,0x31,0x34,0x2e,0x38,0x39,0x33,0x20,0x4c,
-    0x33,0x34,0x2e,0x32,0x38,0x37,0x2c,0x31,0x37,0x2e,
-    0x38,0x39,0x38,0x20,0x43,0x33,0x34,0x2e,0x35,0x30,
-    0x32,0x2c,0x31,0x38,0x2e,0x30,0x33,0x36,0x20,0x33,
-    0x34,0x2e,0x36,0x33,0x32,0x2c,0x31,0x38,0x2e,0x32,
-    0x37,0x34,0x20,0x33,0x34,0x2e,0x36,0x33,0x32,0x2c,
-    0x31,0x38,0x2e,0x35,0x32,0x39,0x20,0x43,0x33,0x34,
-    0x2e,0x36,0x33,0x32,0x2c,0x31,0x38,0x2e,0x37,0x38,
-    0x34,0x20,0x33,0x34,0x2e,0x35,0x30,0x32,0x2c,0x31,
-    0x39,0x2e,0x30,0x32,0x32,0x20,0x33,0x34,0x2e,0x32,
-    0x38,0x37,0x2c,0x31,0x39,0x2e,0x31,0x36,0x20,0x4c,
-    0x32,0x39,0x2e,0x36,0x30,0x32,0x2c,0x32,0x32,0x2e,
-    0x31,0x36,0x34,0x20,0x43,0x32,0x39,0x2e,0x34,0x37,
-    0x38,0x2c,0x32,0x32,0x2e,0x32,0x34,0x34,0x20,0x32,
-    0x39,0x2e,0x33,0x33,0x36,0x2c,0x32,0x32,0x2e,0x32,
-    0x38,0x34,0x20,0x32,0x39,0x2e,0x31,0x39,0x35,0x2c,
-    0x32,0x32,0x2e,0x32,0x38,0x34,0x20,0x7a,0x20,0x4d,
-    0x32,0x39,0x2e,0x39,0x34,0x35,0x2c,0x31,0x36,0x2e,
-    0x38,0x39,0x36,0x20,0x4c,0x32,0x39,0x2e,0x39,0x34,
-    0x35,0x2c,0x32,0x30,0x2e,0x31,0x36,0x32,0x20,0x4c,
-    0x33,0x32,0x2e,0x34,0x39,0x31,0x2c,0x31,0x38,0x2e,
-    0x35,0x32,0x39,0x20,0x4c,0x32,0x39,0x2e,0x39,0x34,
-    0x35,0x2c,0x31,0x36,0x2e,0x38,0x39,0x36,0x20,0x7a,
-    0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,
-    0x46,0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x64,0x3d,0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,
-    0x2c,0x33,0x34,0x2e,0x36,0x32,0x36,0x20,0x4c,0x31,
-    0x38,0x2e,0x35,0x33,0x2c,0x33,0x34,0x2e,0x36,0x32,
-    0x36,0x20,0x43,0x31,0x38,0x2e,0x32,0x37,0x35,0x2c,
-    0x33,0x34,0x2e,0x36,0x32,0x36,0x20,0x31,0x38,0x2e,
-    0x30,0x33,0x38,0x2c,0x33,0x34,0x2e,0x34,0x39,0x36,
-    0x20,0x31,0x37,0x2e,0x38,0x39,0x39,0x2c,0x33,0x34,
-    0x2e,0x32,0x38,0x31,0x20,0x4c,0x31,0x34,0x2e,0x38,
-    0x39,0x34,0x2c,0x32,0x39,0x2e,0x35,0x39,0x37,0x20,
-    0x43,0x31,0x34,0x2e,0x37,0x34,0x37,0x2c,0x32,0x39,
-    0x2e,0x33,0x36,0x36,0x20,0x31,0x34,0x2e,0x37,0x33,
-    0x36,0x2c,0x32,0x39,0x2e,0x30,0x37,0x33,0x20,0x31,
-    0x34,0x2e,0x38,0x36,0x38,0x2c,0x32,0x38,0x2e,0x38,
-    0x33,0x31,0x20,0x43,0x31,0x35,0x2c,0x32,0x38,0x2e,
-    0x35,0x38,0x39,0x20,0x31,0x35,0x2e,0x32,0x35,0x32,
-    0x2c,0x32,0x38,0x2e,0x34,0x34,0x20,0x31,0x35,0x2e,
-    0x35,0x32,0x35,0x2c,0x32,0x38,0x2e,0x34,0x34,0x20,
-    0x4c,0x32,0x31,0x2e,0x35,0x33,0x37,0x2c,0x32,0x38,
-    0x2e,0x34,0x34,0x20,0x43,0x32,0x31,0x2e,0x38,0x31,
-    0x2c,0x32,0x38,0x2e,0x34,0x34,0x20,0x32,0x32,0x2e,
-    0x30,0x36,0x32,0x2c,0x32,0x38,0x2e,0x35,0x38,0x38,
-    0x20,0x32,0x32,0x2e,0x31,0x39,0x34,0x2c,0x32,0x38,
-    0x2e,0x38,0x33,0x31,0x20,0x43,0x32,0x32,0x2e,0x33,
-    0x32,0x37,0x2c,0x32,0x39,0x2e,0x30,0x37,0x31,0x20,
-    0x32,0x32,0x2e,0x33,0x31,0x35,0x2c,0x32,0x39,0x2e,
-    0x33,0x36,0x34,0x20,0x32,0x32,0x2e,0x31,0x36,0x38,
-    0x2c,0x32,0x39,0x2e,0x35,0x39,0x37,0x20,0x4c,0x31,
-    0x39,0x2e,0x31,0x36,0x33,0x2c,0x33,0x34,0x2e,0x32,
-    0x38,0x31,0x20,0x43,0x31,0x39,0x2e,0x30,0x32,0x33,
-    0x2c,0x33,0x34,0x2e,0x34,0x39,0x36,0x20,0x31,0x38,
-    0x2e,0x37,0x38,0x36,0x2c,0x33,0x34,0x2e,0x36,0x32,
-    0x36,0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x34,
-    0x2e,0x36,0x32,0x36,0x20,0x7a,0x20,0x4d,0x31,0x36,
-    0x2e,0x38,0x39,0x37,0x2c,0x32,0x39,0x2e,0x39,0x34,
-    0x32,0x20,0x4c,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,
-    0x32,0x2e,0x34,0x38,0x37,0x20,0x4c,0x32,0x30,0x2e,
-    0x31,0x36,0x35,0x2c,0x32,0x39,0x2e,0x39,0x34,0x32,
-    0x20,0x4c,0x31,0x36,0x2e,0x38,0x39,0x37,0x2c,0x32,
-    0x39,0x2e,0x39,0x34,0x32,0x20,0x7a,0x22,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,
-    0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x3c,0x2f,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,
-    0x38,0x2e,0x35,0x33,0x2c,0x30,0x20,0x43,0x32,0x38,
-    0x2e,0x37,0x36,0x35,0x2c,0x30,0x20,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x2c,0x38,0x2e,0x32,0x39,0x36,0x20,
-    0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,0x31,0x38,0x2e,
-    0x35,0x33,0x31,0x20,0x43,0x33,0x37,0x2e,0x30,0x36,
-    0x31,0x2c,0x32,0x38,0x2e,0x37,0x36,0x35,0x20,0x32,
-    0x38,0x2e,0x37,0x36,0x35,0x2c,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x20,0x43,0x38,0x2e,0x32,
-    0x39,0x36,0x2c,0x33,0x37,0x2e,0x30,0x36,0x31,0x20,
-    0x30,0x2c,0x32,0x38,0x2e,0x37,0x36,0x35,0x20,0x30,
-    0x2c,0x31,0x38,0x2e,0x35,0x33,0x31,0x20,0x43,0x30,
-    0x2c,0x38,0x2e,0x32,0x39,0x36,0x20,0x38,0x2e,0x32,
-    0x39,0x36,0x2c,0x30,0x20,0x31,0x38,0x2e,0x35,0x33,
-    0x2c,0x30,0x20,0x7a,0x20,0x4d,0x31,0x38,0x2e,0x35,
-    0x33,0x2c,0x31,0x20,0x43,0x38,0x2e,0x38,0x34,0x39,
-    0x2c,0x31,0x20,0x31,0x2c,0x38,0x2e,0x38,0x34,0x39,
-    0x20,0x31,0x2c,0x31,0x38,0x2e,0x35,0x33,0x31,0x20,
-    0x43,0x31,0x2c,0x32,0x38,0x2e,0x32,0x31,0x32,0x20,
-    0x38,0x2e,0x38,0x34,0x39,0x2c,0x33,0x36,0x2e,0x30,
-    0x36,0x31,0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,
-    0x36,0x2e,0x30,0x36,0x31,0x20,0x43,0x32,0x38,0x2e,
-    0x32,0x31,0x32,0x2c,0x33,0x36,0x2e,0x30,0x36,0x31,
-    0x20,0x33,0x36,0x2e,0x30,0x36,0x31,0x2c,0x32,0x38,
-    0x2e,0x32,0x31,0x32,0x20,0x33,0x36,0x2e,0x30,0x36,
-    0x31,0x2c,0x31,0x38,0x2e,0x35,0x33,0x31,0x20,0x43,
-    0x33,0x36,0x2e,0x30,0x36,0x31,0x2c,0x38,0x2e,0x38,
-    0x34,0x39,0x20,0x32,0x38,0x2e,0x32,0x31,0x32,0x2c,
-    0x31,0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,0x31,0x20,
-    0x7a,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,
-    0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x73,
-    0x76,0x67,0x3e,0x0a
+const size_t help_analog_left_svg_size = 1119;
+const unsigned char help_analog_left_svg_data[1119] = {
+    0x45,0x53,0x5a,0x31,0x12,0x0b,0x00,0x00,0x78,0xda,
+    0x8d,0x56,0xdb,0x6e,0xdb,0x46,0x10,0x7d,0xcf,0x57,
+    0x6c,0xd9,0x57,0x66,0xb9,0x17,0xee,0x2d,0xb0,0x12,
+    0x20,0xb4,0x13,0x14,0x50,0xdb,0x00,0x75,0x5a,0xf4,
+    0xa9,0x48,0x63,0xd5,0x12,0xea,0xca,0x86,0x2d,0x44,
+    0x69,0xbe,0xbe,0x67,0x66,0x76,0x29,0xa9,0xb5,0x83,
+    0x1a,0x86,0xc8,0xc3,0x9d,0xcb,0x99,0x33,0xc3,0x91,
+    0xce,0x5e,0x7d,0xfe,0xeb,0x46,0x7d,0x5a,0xdd,0x3f,
+    0x6c,0x6e,0xb7,0x8b,0xce,0x6a,0xd3,0xa9,0xd5,0xf6,
+    0xe3,0xed,0xd5,0x66,0x7b,0xbd,0xe8,0xde,0x5f,0xbe,
+    0x79,0x9e,0xbb,0x57,0x2f,0x9f,0x9d,0x7d,0x73,0xfe,
+    0xe3,0x74,0xf9,0xeb,0xbb,0x0b,0xf5,0xf0,0xe9,0x5a,
+    0xbd,0x7b,0xff,0x7a,0xf9,0xdd,0xa4,0xba,0xe7,0xc3,
+    0xf0,0x8b,0x9f,0x86,0xe1,0xfc,0xf2,0x5c,0xfd,0xf4,
+    0xf3,0x5b,0x65,0xb5,0x1d,0x86,0x8b,0x1f,0x3a,0xd5,
+    0xad,0x77,0xbb,0xbb,0x17,0xc3,0xb0,0xdf,0xef,0xf5,
+    0xde,0xeb,0xdb,0xfb,0xeb,0xe1,0xed,0xfd,0x87,0xbb,
+    0xf5,0xe6,0xe3,0xc3,0x00,0xc3,0x81,0x0c,0xe1,0x34,
+    0x20,0x98,0xb5,0xfa,0x6a,0x77,0xd5,0x21,0x05,0x45,
+    0x3e,0x22,0x62,0x3b,0x05,0x6a,0xdb,0x87,0xc5,0x23,
+    0xc1,0x9c,0x31,0x86,0x9c,0xab,0xc9,0x8b,0xcf,0x37,
+    0x9b,0xed,0x9f,0x8f,0x19,0xda,0x52,0xca,0xc0,0xa7,
+    0x30,0x5d,0x74,0x28,0xee,0x6f,0xfe,0xdc,0x6f,0xae,
+    0x76,0xeb,0x45,0xe7,0x93,0x36,0x11,0x89,0xd6,0xab,
+    0xcd,0xf5,0x7a,0x77,0xc0,0x9f,0x36,0xab,0xfd,0xeb,
+    0x5b,0x72,0xe8,0x15,0xfe,0xe5,0x71,0xbb,0x82,0xab,
+    0x52,0x67,0xd7,0x6a,0x73,0xb5,0xe8,0x2e,0x7e,0x5f,
+    0x6d,0x57,0xbf,0xc9,0x23,0x7a,0x28,0x57,0xdc,0xdd,
+    0x7d,0xd8,0xad,0x15,0x0c,0xbe,0xb7,0x59,0x07,0x6f,
+    0x7b,0xe7,0xb4,0xcd,0x56,0x4d,0x36,0xea,0x60,0x73,
+    0x83,0x76,0xd4,0x39,0xbb,0xde,0x19,0x1d,0x46,0xd7,
+    0x10,0x7b,0xc0,0xb2,0x22,0x76,0x50,0x74,0x01,0xa0,
+    0x67,0xaa,0x86,0x14,0x30,0xb1,0xf3,0x58,0x91,0xc4,
+    0x15,0xa7,0x32,0x23,0x09,0xc8,0xa8,0x26,0xf3,0xaa,
+    0xba,0x35,0x22,0x27,0x2c,0xbf,0xa8,0x46,0x1b,0x81,
+    0x7c,0x2a,0x20,0x93,0xb4,0x1f,0x43,0x83,0x74,0x21,
+    0x6a,0xf4,0x70,0x9c,0x11,0x3c,0x5c,0xe1,0x0a,0x19,
+    0x16,0x9d,0x2c,0x0e,0xc9,0x26,0x51,0xd2,0x38,0x13,
+    0x17,0x30,0xb1,0x45,0x3b,0xe2,0x4f,0xdb,0xbc,0x1a,
+    0xaa,0x21,0x19,0x1e,0xf2,0x89,0x5f,0xe3,0x72,0x42,
+    0xf4,0x4b,0xa7,0xfe,0xd8,0xdc,0xdc,0x2c,0xba,0x6f,
+    0xdf,0xf0,0x5f,0x37,0xfc,0xb7,0x23,0xce,0xc2,0x23,
+    0xf6,0x59,0x47,0x1b,0xd5,0xd2,0x06,0xe4,0x18,0x2b,
+    0x9a,0x80,0x5c,0xb0,0x15,0x41,0x52,0x8c,0x0f,0xc0,
+    0x18,0x19,0xe4,0x98,0x00,0x9c,0x8b,0xdc,0x9c,0xe4,
+    0x43,0x9f,0x74,0xc9,0x81,0x8e,0xd2,0x18,0x01,0x62,
+    0x91,0x26,0x16,0x0f,0x30,0x52,0xf0,0x04,0x80,0x6e,
+    0xeb,0x94,0xc8,0x29,0x6b,0x9b,0x20,0x39,0x49,0x49,
+    0xbc,0x73,0x16,0x10,0xa9,0x24,0x1b,0x5d,0xb5,0x5b,
+    0x52,0x17,0x90,0x8a,0x43,0x50,0xd7,0xbc,0x1d,0x39,
+    0xb8,0xa5,0x86,0x7a,0x17,0x39,0xed,0xc8,0xdd,0x45,
+    0xa6,0xca,0x08,0xc8,0x44,0x5f,0xc9,0xa2,0xc4,0x6c,
+    0x5b,0x19,0x27,0xf5,0x52,0x6b,0x23,0x48,0x51,0x78,
+    0x4b,0xf5,0x43,0x5b,0x1b,0x43,0x43,0xac,0x66,0x3f,
+    0xea,0x90,0x2c,0xc0,0xb1,0xe1,0x57,0x94,0x9d,0xa7,
+    0xfe,0x58,0x65,0xaf,0xad,0x0b,0x75,0xf4,0x96,0x90,
+    0xc1,0x94,0x9e,0x89,0x8c,0x0d,0x89,0xf0,0x6a,0x79,
+    0x6c,0xf8,0x74,0x92,0xe3,0xd0,0x35,0x9a,0xd3,0x0e,
+    0x2a,0x4c,0x50,0x26,0xe6,0x86,0x12,0x62,0x26,0x06,
+    0x23,0x81,0xd1,0xc8,0x84,0xc7,0x80,0x42,0x75,0xe2,
+    0xa9,0x84,0xd0,0x50,0x4b,0x07,0x13,0x08,0x19,0x50,
+    0x80,0xa8,0x89,0x19,0xa4,0x1c,0x0f,0x00,0x53,0x45,
+    0x76,0x15,0xb9,0x44,0x47,0xec,0x94,0xb5,0xf1,0x18,
+    0x58,0x0e,0x87,0x4e,0x50,0x3d,0x94,0x87,0x1b,0x2f,
+    0x7c,0x3c,0x23,0xcc,0x04,0x28,0x14,0x97,0x19,0xf8,
+    0xa8,0xa8,0xfd,0xbd,0xcc,0x91,0x9a,0xd0,0x28,0x7e,
+    0x85,0x4b,0xc9,0x38,0x08,0xb1,0x97,0xd1,0x9b,0xef,
+    0x83,0x03,0x67,0x06,0x2c,0x5b,0x20,0x0f,0x01,0x28,
+    0x5e,0x91,0xb7,0xeb,0xb9,0xe7,0x56,0xe2,0xca,0x34,
+    0x90,0x95,0x21,0x33,0x28,0x10,0x48,0x81,0xe2,0xdd,
+    0x41,0x9b,0x23,0xd9,0x30,0x07,0xe8,0x32,0x06,0x6b,
+    0xee,0x90,0x09,0xa5,0xe7,0x61,0x70,0x0d,0x49,0xff,
+    0xd5,0xf2,0xd8,0xf0,0x2b,0x63,0x30,0x3c,0xb2,0xfd,
+    0x1c,0xf4,0x2e,0x61,0xee,0x15,0xa0,0x49,0xb6,0x41,
+    0x97,0x75,0x19,0x4b,0xe3,0x0a,0x94,0x7d,0xad,0x83,
+    0x3a,0x84,0x74,0x25,0x4a,0x89,0x74,0x36,0x62,0xfd,
+    0x70,0xf1,0xf9,0x08,0xf1,0x38,0x55,0x58,0xe7,0x69,
+    0x3a,0x40,0x28,0xc8,0x51,0xc6,0xa6,0x73,0x4d,0xc1,
+    0x2d,0x88,0x95,0x4d,0x94,0xee,0xc0,0xb4,0x68,0x39,
+    0x4b,0xb4,0x1d,0x8b,0x8e,0x46,0xf6,0x2d,0x44,0x5d,
+    0xfa,0x11,0x84,0x53,0x2f,0xaf,0xb3,0x9a,0x00,0x83,
+    0x71,0x32,0x09,0x51,0x01,0x45,0xef,0x64,0x48,0xc6,
+    0x23,0xc4,0xab,0xeb,0x00,0x53,0xe6,0x43,0x76,0xa4,
+    0xb9,0x73,0xaa,0x45,0xa5,0x99,0x44,0x19,0x92,0x92,
+    0xc7,0x55,0xa4,0x1a,0x53,0x6e,0xa3,0x4c,0xe4,0x7c,
+    0x9c,0x85,0x3b,0x51,0x15,0xad,0xc4,0x83,0x22,0xeb,
+    0x39,0x17,0x09,0x45,0xb0,0x75,0xd3,0x3b,0x3d,0x96,
+    0x79,0x9b,0x2e,0x4f,0x8d,0xff,0xcf,0xc6,0x94,0xad,
+    0x40,0xa5,0xb8,0x79,0x47,0x54,0x34,0x71,0xd9,0xa1,
+    0x41,0x79,0x39,0x08,0x8d,0x88,0xcd,0x7a,0x95,0x9e,
+    0xeb,0xa4,0x7d,0xc2,0x6f,0x48,0x8f,0xfc,0x01,0x63,
+    0xc5,0x3b,0x94,0xbe,0x1a,0x50,0x9a,0xec,0xd7,0x44,
+    0x15,0x52,0x4f,0xbc,0x6c,0x5b,0x54,0x4f,0x0d,0xa3,
+    0x6f,0xcd,0x40,0xb7,0x21,0x63,0xdd,0x53,0x5b,0x5d,
+    0xcf,0x4d,0x56,0xf2,0x9a,0x54,0xb0,0xe4,0x79,0x48,
+    0x15,0x4d,0xbc,0x02,0x2b,0xe0,0x21,0x72,0x12,0x42,
+    0xbe,0x23,0x89,0x46,0x8d,0xcd,0x3b,0x35,0x49,0x62,
+    0xd9,0xb0,0x94,0x8d,0x48,0xc9,0x8a,0x25,0x1a,0xc2,
+    0x78,0xc9,0x9d,0xf2,0xad,0x9e,0x89,0xdb,0xe8,0xe7,
+    0x62,0x79,0x7f,0x1c,0x09,0x71,0x10,0xe9,0xb0,0x74,
+    0x59,0x7b,0x37,0x6b,0x88,0xc6,0xe4,0x34,0xef,0xe0,
+    0xf9,0xf0,0xc4,0xf6,0xa9,0x06,0xcd,0xef,0xdb,0xbf,
+    0xfb,0x64,0xf8,0x1d,0x48,0x08,0x68,0xda,0x2f,0x17,
+    0xf4,0x08,0x0c,0x2b,0x68,0xbb,0xad,0x42,0xb1,0x55,
+    0xd5,0x45,0x1e,0x36,0xfa,0x02,0x26,0x76,0x6f,0xc8,
+    0x34,0x0f,0x33,0x47,0x32,0x35,0x81,0xd8,0x19,0xd5,
+    0x78,0xb4,0xdf,0x11,0x3d,0xc7,0xc8,0x78,0xd7,0x11,
+    0xb9,0xe7,0x3b,0x75,0xe0,0xc1,0x14,0x9c,0x75,0x4a,
+    0x4c,0x7c,0x3c,0x66,0x20,0x60,0x12,0x8b,0x06,0xe5,
+    0xd2,0xdc,0x2a,0x9a,0xcb,0x8a,0xb5,0x64,0xca,0x52,
+    0xfd,0x5a,0x38,0xfb,0x84,0x9a,0xac,0xe5,0x19,0xfd,
+    0xa2,0x7c,0xf9,0xec,0x1f,0xd4,0x98,0x55,0x79
 };
 
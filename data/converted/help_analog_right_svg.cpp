@@ -1,290 +1,122 @@
-//this file was auto-generated from "analog_right.svg" by res2h
+//this file was auto-generated from "analog_right.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_analog_right_svg_size = 2813;
-const unsigned char help_analog_right_svg_data[2813] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x55,0x54,0x46,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x73,
-    0x76,0x67,0x20,0x50,0x55,0x42,0x4c,0x49,0x43,0x20,
-    0x22,0x2d,0x2f,0x2f,0x57,0x33,0x43,0x2f,0x2f,0x44,
-    0x54,0x44,0x20,0x53,0x56,0x47,0x20,0x31,0x2e,0x31,
-    0x2f,0x2f,0x45,0x4e,0x22,0x20,0x22,0x68,0x74,0x74,
-    0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,
-    0x2e,0x6f,0x72,0x67,0x2f,0x47,0x72,0x61,0x70,0x68,
-    0x69,0x63,0x73,0x2f,0x53,0x56,0x47,0x2f,0x31,0x2e,
-    0x31,0x2f,0x44,0x54,0x44,0x2f,0x73,0x76,0x67,0x31,
-    0x31,0x2e,0x64,0x74,0x64,0x22,0x3e,0x0a,0x3c,0x73,
-    0x76,0x67,0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,
-    0x3d,0x22,0x31,0x2e,0x31,0x22,0x20,0x78,0x6d,0x6c,
-    0x6e,0x73,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,
-    0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,
-    0x67,0x2f,0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,
-    0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,
-    0x69,0x6e,0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,
-    0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,
-    0x72,0x67,0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,
-    0x69,0x6e,0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,
-    0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,
-    0x33,0x37,0x2e,0x30,0x36,0x31,0x22,0x20,0x76,0x69,
-    0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x2c,0x20,
-    0x30,0x2c,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,
-    0x20,0x33,0x37,0x2e,0x30,0x36,0x31,0x22,0x3e,0x0a,
-    0x20,0x20,0x3c,0x67,0x20,0x69,0x64,0x3d,0x22,0x45,
-    0x62,0x65,0x6e,0x65,0x5f,0x31,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,
-    0x3d,0x22,0x4d,0x31,0x38,0x2e,0x34,0x37,0x36,0x2c,
-    0x31,0x34,0x2e,0x38,0x39,0x38,0x20,0x43,0x32,0x30,
-    0x2e,0x34,0x38,0x39,0x2c,0x31,0x34,0x2e,0x38,0x39,
-    0x38,0x20,0x32,0x32,0x2e,0x31,0x32,0x35,0x2c,0x31,
-    0x36,0x2e,0x35,0x33,0x37,0x20,0x32,0x32,0x2e,0x31,
-    0x32,0x35,0x2c,0x31,0x38,0x2e,0x35,0x34,0x39,0x20,
-    0x43,0x32,0x32,0x2e,0x31,0x32,0x35,0x2c,0x32,0x30,
-    0x2e,0x35,0x36,0x31,0x20,0x32,0x30,0x2e,0x34,0x38,
-    0x37,0x2c,0x32,0x32,0x2e,0x31,0x39,0x39,0x20,0x31,
-    0x38,0x2e,0x34,0x37,0x36,0x2c,0x32,0x32,0x2e,0x31,
-    0x39,0x39,0x20,0x43,0x31,0x36,0x2e,0x34,0x36,0x33,
-    0x2c,0x32,0x32,0x2e,0x31,0x39,0x39,0x20,0x31,0x34,
-    0x2e,0x38,0x32,0x36,0x2c,0x32,0x30,0x2e,0x35,0x36,
-    0x20,0x31,0x34,0x2e,0x38,0x32,0x36,0x2c,0x31,0x38,
-    0x2e,0x35,0x34,0x39,0x20,0x43,0x31,0x34,0x2e,0x38,
-    0x32,0x35,0x2c,0x31,0x36,0x2e,0x35,0x33,0x36,0x20,
-    0x31,0x36,0x2e,0x34,0x36,0x33,0x2c,0x31,0x34,0x2e,
-    0x38,0x39,0x38,0x20,0x31,0x38,0x2e,0x34,0x37,0x36,
-    0x2c,0x31,0x34,0x2e,0x38,0x39,0x38,0x20,0x7a,0x20,
-    0x4d,0x31,0x38,0x2e,0x34,0x37,0x36,0x2c,0x32,0x30,
-    0x2e,0x37,0x20,0x43,0x31,0x39,0x2e,0x36,0x36,0x32,
-    0x2c,0x32,0x30,0x2e,0x37,0x20,0x32,0x30,0x2e,0x36,
-    0x32,0x35,0x2c,0x31,0x39,0x2e,0x37,0x33,0x35,0x20,
-    0x32,0x30,0x2e,0x36,0x32,0x35,0x2c,0x31,0x38,0x2e,
-    0x35,0x35,0x20,0x43,0x32,0x30,0x2e,0x36,0x32,0x35,
-    0x2c,0x31,0x37,0x2e,0x33,0x36,0x35,0x20,0x31,0x39,
-    0x2e,0x36,0x36,0x2c,0x31,0x36,0x2e,0x33,0x39,0x39,
-    0x20,0x31,0x38,0x2e,0x34,0x37,0x36,0x2c,0x31,0x36,
-    0x2e,0x33,0x39,0x39,0x20,0x43,0x31,0x37,0x2e,0x32,
-    0x39,0x2c,0x31,0x36,0x2e,0x33,0x39,0x39,0x20,0x31,
-    0x36,0x2e,0x33,0x32,0x36,0x2c,0x31,0x37,0x2e,0x33,
-    0x36,0x35,0x20,0x31,0x36,0x2e,0x33,0x32,0x36,0x2c,
-    0x31,0x38,0x2e,0x35,0x35,0x20,0x43,0x31,0x36,0x2e,
-    0x33,0x32,0x35,0x2c,0x31,0x39,0x2e,0x37,0x33,0x35,
-    0x20,0x31,0x37,0x2e,0x32,0x39,0x2c,0x32,0x30,0x2e,
-    0x37,0x20,0x31,0x38,0x2e,0x34,0x37,0x36,0x2c,0x32,
-    0x30,0x2e,0x37,0x20,0x7a,0x22,0x20,0x66,0x69,0x6c,
-    0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,
-    0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,0x35,
-    0x2e,0x34,0x37,0x31,0x2c,0x32,0x38,0x2e,0x34,0x36,
-    0x33,0x20,0x4c,0x32,0x31,0x2e,0x34,0x38,0x33,0x2c,
-    0x32,0x38,0x2e,0x34,0x36,0x33,0x20,0x43,0x32,0x31,
-    0x2e,0x37,0x35,0x36,0x2c,0x32,0x38,0x2e,0x34,0x36,
-    0x33,0x20,0x32,0x32,0x2e,0x30,0x30,0x38,0x2c,0x32,
-    0x38,0x2e,0x36,0x31,0x33,0x20,0x32,0x32,0x2e,0x31,
-    0x34,0x2c,0x32,0x38,0x2e,0x38,0x35,0x33,0x20,0x43,
-    0x32,0x32,0x2e,0x32,0x37,0x32,0x2c,0x32,0x39,0x2e,
-    0x30,0x39,0x34,0x20,0x32,0x32,0x2e,0x32,0x36,0x31,
-    0x2c,0x32,0x39,0x2e,0x33,0x38,0x37,0x20,0x32,0x32,
-    0x2e,0x31,0x31,0x34,0x2c,0x32,0x39,0x2e,0x36,0x31,
-    0x39,0x20,0x4c,0x31,0x39,0x2e,0x31,0x30,0x39,0x2c,
-    0x33,0x34,0x2e,0x33,0x30,0x33,0x20,0x43,0x31,0x38,
-    0x2e,0x38,0x33,0x33,0x2c,0x33,0x34,0x2e,0x37,0x33,
-    0x34,0x20,0x31,0x38,0x2e,0x31,0x32,0x33,0x2c,0x33,
-    0x34,0x2e,0x37,0x33,0x33,0x20,0x31,0x37,0x2e,0x38,
-    0x34,0x35,0x2c,0x33,0x34,0x2e,0x33,0x30,0x33,0x20,
-    0x4c,0x31,0x34,0x2e,0x38,0x34,0x2c,0x32,0x39,0x2e,
-    0x36,0x31,0x39,0x20,0x43,0x31,0x34,0x2e,0x36,0x39,
-    0x33,0x2c,0x32,0x39,0x2e,0x33,0x38,0x38,0x20,0x31,
-    0x34,0x2e,0x36,0x38,0x31,0x2c,0x32,0x39,0x2e,0x30,
-    0x39,0x35,0x20,0x31,0x34,0x2e,0x38,0x31,0x34,0x2c,
-    0x32,0x38,0x2e,0x38,0x35,0x33,0x20,0x43,0x31,0x34,
-    0x2e,0x39,0x34,0x34,0x2c,0x32,0x38,0x2e,0x36,0x31,
-    0x33,0x20,0x31,0x35,0x2e,0x31,0x39,0x36,0x2c,0x32,
-    0x38,0x2e,0x34,0x36,0x33,0x20,0x31,0x35,0x2e,0x34,
-    0x37,0x31,0x2c,0x32,0x38,0x2e,0x34,0x36,0x33,0x20,
-    0x7a,0x20,0x4d,0x32,0x30,0x2e,0x31,0x31,0x2c,0x32,
-    0x39,0x2e,0x39,0x36,0x33,0x20,0x4c,0x31,0x36,0x2e,
-    0x38,0x34,0x32,0x2c,0x32,0x39,0x2e,0x39,0x36,0x33,
-    0x20,0x4c,0x31,0x38,0x2e,0x34,0x37,0x37,0x2c,0x33,
-    0x32,0x2e,0x35,0x30,0x38,0x20,0x4c,0x32,0x30,0x2e,
-    0x31,0x31,0x2c,0x32,0x39,0x2e,0x39,0x36,0x33,0x20,
-    0x7a,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x3c,0x67,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x64,0x3d,0x22,0x4d,0x33,0x33,0x2e,0x38,0x38,0x32,
-    0x2c,0x31,0x38,0x2e,0x35,0x34,0x39,0x20,0x4c,0x32,
-    0x39,0x2e,0x31,0x39,0x38,0x2c,0x31,0x35,0x2e,0x35,
-    0x34,0x35,0x20,0x4c,0x32,0x39,0x2e,0x31,0x39,0x38,
-    0x2c,0x32,0x31,0x2e,0x35,0x35,0x35,0x20,0x4c,0x33,
-    0x33,0x2e,0x38,0x38,0x32,0x2c,0x31,0x38,0x2e,0x35,
-    0x34,0x39,0x20,0x7a,0x22,0x20,0x66,0x69,0x6c,0x6c,
-    0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,
-    0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-    0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x32,
-    0x39,0x2e,0x31,0x39,0x38,0x2c,0x31,0x34,0x2e,0x37,
-    0x39,0x35,0x20,0x43,0x32,0x39,0x2e,0x33,0x33,0x39,
-    0x2c,0x31,0x34,0x2e,0x37,0x39,0x35,0x20,0x32,0x39,
-    0x2e,0x34,0x38,0x2c,0x31,0x34,0x2e,0x38,0x33,0x35,
-    0x20,0x32,0x39,0x2e,0x36,0x30,0x33,0x2c,0x31,0x34,
-    0x2e,0x39,0x31,0x34,0x20,0x4c,0x33,0x34,0x2e,0x32,
-    0x38,0x37,0x2c,0x31,0x37,0x2e,0x39,0x31,0x37,0x20,
-    0x43,0x33,0x34,0x2e,0x35,0x30,0x32,0x2c,0x31,0x38,
-    0x2e,0x30,0x35,0x35,0x20,0x33,0x34,0x2e,0x36,0x33,
-    0x32,0x2c,0x31,0x38,0x2e,0x32,0x39,0x33,0x20,0x33,
-    0x34,0x2e,0x36,0x33,0x32,0x2c,0x31,0x38,0x2e,0x35,
-    0x34,0x38,0x20,0x43,0x33,0x34,0x2e,0x36,0x33,0x32,
-    0x2c,0x31,0x38,0x2e,0x38,0x30,0x33,0x20,0x33,0x34,
-    0x2e,0x35,0x30,0x32,0x2c,0x31,0x39,0x2e,0x30,0x34,
-    0x31,0x20,0x33,0x34,0x2e,0x32,0x38,0x37,0x2c,0x31,
-    0x39,0x2e,0x31,0x37,0x39,0x20,0x4c,0x32,0x39,0x2e,
-    0x36,0x30,0x33,0x2c,0x32,0x32,0x2e,0x31,0x38,0x35,
-    0x20,0x43,0x32,0x39,0x2e,0x33,0x37,0x33,0x2c,0x32,
-    0x32,0x2e,0x33,0x33,0x33,0x20,0x32,0x39,0x2e,0x30,
-    0x37,0x39,0x2c,0x32,0x32,0x2e,0x33,0x34,0x33,0x20,
-    0x32,0x38,0x2e,0x38,0x33,0x37,0x2c,0x32,0x32,0x2e,
-    0x32,0x31,0x32,0x20,0x43,0x32,0x38,0x2e,0x35,0x39,
-    0x37,0x2c,0x32,0x32,0x2e,0x30,0x38,0x31,0x20,0x32,
-    0x38,0x2e,0x34,0x34,0x37,0x2c,0x32,0x31,0x2e,0x38,
-    0x32,0x38,0x20,0x32,0x38,0x2e,0x34,0x34,0x37,0x2c,
-    0x32,0x31,0x2e,0x35,0x35,0x34,0x20,0x4c,0x32,0x38,
-    0x2e,0x34,0x34,0x37,0x2c,0x31,0x35,0x2e,0x35,0x34,
-    0x34,0x20,0x43,0x32,0x38,0x2e,0x34,0x34,0x37,0x2c,
-    0x31,0x35,0x2e,0x32,0x37,0x20,0x32,0x38,0x2e,0x35,
-    0x39,0x35,0x2c,0x31,0x35,0x2e,0x30,0x31,0x38,0x20,
-    0x32,0x38,0x2e,0x38,0x33,0x37,0x2c,0x31,0x34,0x2e,
-    0x38,0x38,0x36,0x20,0x43,0x32,0x38,0x2e,0x39,0x35,
-    0x31,0x2c,0x31,0x34,0x2e,0x38,0x32,0x35,0x20,0x32,
-    0x39,0x2e,0x30,0x37,0x35,0x2c,0x31,0x34,0x2e,0x37,
-    0x39,0x35,0x20,0x32,0x39,0x2e,0x31,0x39,0x38,0x2c,
-    0x31,0x34,0x2e,0x37,0x39,0x35,0x20,0x7a,0x20,0x4d,
-    0x33,0x32,0x2e,0x34,0x39,0x33,0x2c,0x31,0x38,0x2e,
-    0x35,0x34,0x39,0x20,0x4c,0x32,0x39,0x2e,0x39,0x34,
-    0x38,0x2c,0x31,0x36,0x2e,0x39,0x31,0x37,0x20,0x4c,
-    0x32,0x39,0x2e,0x39,0x34,0x38,0x2c,0x32,0x30,0x2e,
-    0x31,0x38,0x32,0x20,0x4c,0x33,0x32,0x2e,0x34,0x39,
-    0x33,0x2c,0x31,0x38,0x2e,0x35,0x34,0x39,0x20,0x7a,
-    0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,
-    0x46,0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,
-    0x22,0x4d,0x37,0x2e,0x38,0x31,0x32,0x2c,0x31,0x34,
-    0x2e,0x37,0x39,0x35,0x20,0x43,0x37,0x2e,0x39,0x33,
-    0x36,0x2c,0x31,0x34,0x2e,0x37,0x39,0x35,0x20,0x38,
-    0x2e,0x30,0x35,0x38,0x2c,0x31,0x34,0x2e,0x38,0x32,
-    0x35,0x20,0x38,0x2e,0x31,0x37,0x2c,0x31,0x34,0x2e,
-    0x38,0x38,0x37,0x20,0x43,0x38,0x2e,0x34,0x31,0x31,
-    0x2c,0x31,0x35,0x2e,0x30,0x31,0x39,0x20,0x38,0x2e,
-    0x35,0x36,0x32,0x2c,0x31,0x35,0x2e,0x32,0x37,0x31,
-    0x20,0x38,0x2e,0x35,0x36,0x32,0x2c,0x31,0x35,0x2e,
-    0x35,0x34,0x35,0x20,0x4c,0x38,0x2e,0x35,0x36,0x32,
-    0x2c,0x32,0x31,0x2e,0x35,0x35,0x35,0x20,0x43,0x38,
-    0x2e,0x35,0x36,0x32,0x2c,0x32,0x31,0x2e,0x38,0x32,
-    0x39,0x20,0x38,0x2e,0x34,0x31,0x33,0x2c,0x32,0x32,
-    0x2e,0x30,0x38,0x31,0x20,0x38,0x2e,0x31,0x37,0x2c,
-    0x32,0x32,0x2e,0x32,0x31,0x33,0x20,0x43,0x37,0x2e,
-    0x39,0x33,0x31,0x2c,0x32,0x32,0x2e,0x33,0x34,0x34,
-    0x20,0x37,0x2e,0x36,0x33,0x37,0x2c,0x32,0x32,0x2e,
-    0x33,0x33,0x36,0x20,0x37,0x2e,0x34,0x30,0x35,0x2c,
-    0x32,0x32,0x2e,0x31,0x38,0x36,0x20,0x4c,0x32,0x2e,
-    0x37,0x32,0x2c,0x31,0x39,0x2e,0x31,0x38,0x31,0x20,
-    0x43,0x32,0x2e,0x35,0x30,0x35,0x2c,0x31,0x39,0x2e,
-    0x30,0x34,0x33,0x20,0x32,0x2e,0x33,0x37,0x35,0x2c,
-    0x31,0x38,0x2e,0x38,0x30,0x35,0x20,0x32,0x2e,0x33,
-    0x37,0x35,0x2c,0x31,0x38,0x2e,0x35,0x35,0x20,0x43,
-    0x32,0x2e,0x33,0x37,0x35,0x2c,0x31,0x38,0x2e,0x32,
-    0x39,0x35,0x20,0x32,0x2e,0x35,0x30,0x35,0x2c,0x31,
-    0x38,0x2e,0x30,0x35,0x37,0x20,0x32,0x2e,0x37,0x32,
-    0x2c,0x31,0x37,0x2e,0x39,0x31,0x39,0x20,0x4c,0x37,
-    0x2e,0x34,0x30,0x35,0x2c,0x31,0x34,0x2e,0x39,0x31,
-    0x35,0x20,0x43,0x37,0x2e,0x35,0x32,0x39,0x2c,0x31,
-    0x34,0x2e,0x38,0x33,0x35,0x20,0x37,0x2e,0x36,0x37,
-    0x31,0x2c,0x31,0x34,0x2e,0x37,0x39,0x35,0x20,0x37,
-    0x2e,0x38,0x31,0x32,0x2c,0x31,0x34,0x2e,0x37,0x39,
-    0x35,0x20,0x7a,0x20,0x4d,0x37,0x2e,0x30,0x36,0x32,
-    0x2c,0x32,0x30,0x2e,0x31,0x38,0x33,0x20,0x4c,0x37,
-    0x2e,0x30,0x36,0x32,0x2c,0x31,0x36,0x2e,0x39,0x31,
-    0x37,0x20,0x4c,0x34,0x2e,0x35,0x31,0x36,0x2c,0x31,
-    0x38,0x2e,0x35,0x35,0x20,0x4c,0x37,0x2e,0x30,0x36,
-    0x32,0x2c,0x32,0x30,0x2e,0x31,0x38,0x33,0x20,0x7a,
-    0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,
-    0x46,0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,
-    0x3d,0x22,0x4d,0x31,0x38,0x2e,0x34,0x37,0x37,0x2c,
-    0x32,0x2e,0x34,0x35,0x33,0x20,0x4c,0x31,0x38,0x2e,
-    0x34,0x37,0x37,0x2c,0x32,0x2e,0x34,0x35,0x33,0x20,
-    0x43,0x31,0x38,0x2e,0x37,0x33,0x32,0x2c,0x32,0x2e,
-    0x34,0x35,0x33,0x20,0x31,0x38,0x2e,0x39,0x36,0x39,
-    0x2c,0x32,0x2e,0x35,0x38,0x33,0x20,0x31,0x39,0x2e,
-    0x31,0x30,0x38,0x2c,0x32,0x2e,0x37,0x39,0x38,0x20,
-    0x4c,0x32,0x32,0x2e,0x31,0x31,0x33,0x2c,0x37,0x2e,
-    0x34,0x38,0x32,0x20,0x43,0x32,0x32,0x2e,0x32,0x36,
-    0x2c,0x37,0x2e,0x37,0x31,0x33,0x20,0x32,0x32,0x2e,
-    0x32,0x37,0x31,0x2c,0x38,0x2e,0x30,0x30,0x36,0x20,
-    0x32,0x32,0x2e,0x31,0x33,0x39,0x2c,0x38,0x2e,0x32,
-    0x34,0x38,0x20,0x43,0x32,0x32,0x2e,0x30,0x30,0x37,
-    0x2c,0x38,0x2e,0x34,0x39,0x20,0x32,0x31,0x2e,0x37,
-    0x35,0x35,0x2c,0x38,0x2e,0x36,0x33,0x39,0x20,0x32,
-    0x31,0x2e,0x34,0x38,0x32,0x2c,0x38,0x2e,0x36,0x33,
-    0x39,0x20,0x4c,0x31,0x35,0x2e,0x34,0x37,0x2c,0x38,
-    0x2e,0x36,0x33,0x39,0x20,0x43,0x31,0x35,0x2e,0x31,
-    0x39,0x37,0x2c,0x38,0x2e,0x36,0x33,0x39,0x20,0x31,
-    0x34,0x2e,0x39,0x34,0x35,0x2c,0x38,0x2e,0x34,0x39,
-    0x31,0x20,0x31,0x34,0x2e,0x38,0x31,0x33,0x2c,0x38,
-    0x2e,0x32,0x34,0x38,0x20,0x43,0x31,0x34,0x2e,0x36,
-    0x38,0x2c,0x38,0x2e,0x30,0x30,0x38,0x20,0x31,0x34,
-    0x2e,0x36,0x39,0x32,0x2c,0x37,0x2e,0x37,0x31,0x35,
-    0x20,0x31,0x34,0x2e,0x38,0x33,0x39,0x2c,0x37,0x2e,
-    0x34,0x38,0x32,0x20,0x4c,0x31,0x37,0x2e,0x38,0x34,
-    0x34,0x2c,0x32,0x2e,0x37,0x39,0x38,0x20,0x43,0x31,
-    0x37,0x2e,0x39,0x38,0x34,0x2c,0x32,0x2e,0x35,0x38,
-    0x33,0x20,0x31,0x38,0x2e,0x32,0x32,0x31,0x2c,0x32,
-    0x2e,0x34,0x35,0x33,0x20,0x31,0x38,0x2e,0x34,0x37,
-    0x37,0x2c,0x32,0x2e,0x34,0x35,0x33,0x20,0x7a,0x20,
-    0x4d,0x32,0x30,0x2e,0x31,0x31,0x2c,0x37,0x2e,0x31,
-    0x33,0x37,0x20,0x4c,0x31,0x38,0x2e,0x34,0x37,0x37,
-    0x2c,0x34,0x2e,0x35,0x39,0x32,0x20,0x4c,0x31,0x36,
-    0x2e,0x38,0x34,0x32,0x2c,0x37,0x2e,0x31,0x33,0x37,
-    0x20,0x4c,0x32,0x30,0x2e,0x31,0x31,0x2c,0x37,0x2e,
-    0x31,0x33,0x37,0x20,0x7a,0x22,0x20,0x66,0x69,0x6c,
-    0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,
-    0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,0x38,
-    0x2e,0x35,0x33,0x2c,0x30,0x20,0x43,0x32,0x38,0x2e,
-    0x37,0x36,0x35,0x2c,0x30,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x2c,0x38,0x2e,0x32,0x39,0x36,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x2c,0x31,0x38,0x2e,0x35,
-    0x33,0x31,0x20,0x43,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x2c,0x32,0x38,0x2e,0x37,0x36,0x35,0x20,0x32,0x38,
-    0x2e,0x37,0x36,0x35,0x2c,0x33,0x37,0x2e,0x30,0x36,
-    0x31,0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x37,
-    0x2e,0x30,0x36,0x31,0x20,0x43,0x38,0x2e,0x32,0x39,
-    0x36,0x2c,0x33,0x37,0x2e,0x30,0x36,0x31,0x20,0x30,
-    0x2c,0x32,0x38,0x2e,0x37,0x36,0x35,0x20,0x30,0x2c,
-    0x31,0x38,0x2e,0x35,0x33,0x31,0x20,0x43,0x30,0x2c,
-    0x38,0x2e,0x32,0x39,0x36,0x20,0x38,0x2e,0x32,0x39,
-    0x36,0x2c,0x30,0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,
-    0x30,0x20,0x7a,0x20,0x4d,0x31,0x38,0x2e,0x35,0x33,
-    0x2c,0x31,0x20,0x43,0x38,0x2e,0x38,0x34,0x39,0x2c,
-    0x31,0x20,0x31,0x2c,0x38,0x2e,0x38,0x34,0x39,0x20,
-    0x31,0x2c,0x31,0x38,0x2e,0x35,0x33,0x31,0x20,0x43,
-    0x31,0x2c,0x32,0x38,0x2e,0x32,0x31,0x32,0x20,0x38,
-    0x2e,0x38,0x34,0x39,0x2c,0x33,0x36,0x2e,0x30,0x36,
-    0x31,0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x36,
-    0x2e,0x30,0x36,0x31,0x20,0x43,0x32,0x38,0x2e,0x32,
-    0x31,0x32,0x2c,0x33,0x36,0x2e,0x30,0x36,0x31,0x20,
-    0x33,0x36,0x2e,0x30,0x36,0x31,0x2c,0x32,0x38,0x2e,
-    0x32,0x31,0x32,0x20,0x33,0x36,0x2e,0x30,0x36,0x31,
-    0x2c,0x31,0x38,0x2e,0x35,0x33,0x31,0x20,0x43,0x33,
-    0x36,0x2e,0x30,0x36,0x31,0x2c,0x38,0x2e,0x38,0x34,
-    0x39,0x20,0x32,0x38,0x2e,0x32,0x31,0x32,0x2c,0x31,
-    0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,0x31,0x20,0x7a,
-    0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,
-    0x46,0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,
-    0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x73,0x76,
-    0x67,0x3e,0x0a
+const size_t help_analog_right_svg_size = 1137;
+const unsigned char help_analog_right_svg_data[1137] = {
+    0x45,0x53,0x5a,0x31,0xfd,0x0a,0x00,0x00,0x78,0xda,
+    0x8d,0x56,0xdb,0x6e,0x1b,0x37,0x10,0x7d,0xcf,0x57,
+    0xb0,0xdb,0xd7,0x0d,0x97,0xf7,0x4b,0x60,0x25,0x40,
+    0xd6,0x4e,0x50,0x40,0x6d,0x03,0xd4,0x69,0xd1,0xa7,
+    0x22,0x8d,0x54,0x49,0xa8,0x2b,0x1b,0xb6,0x60,0x25,
+    0xf9,0xfa,0x9e,0x19,0x92,0xab,0x55,0x1b,0x03,0x31,
+    0x0c,0x49,0x67,0x39,0x97,0x33,0x67,0x86,0x23,0x5d,
+    0xbc,0xfa,0xf4,0xcf,0x8d,0x78,0x5c,0xdf,0x3f,0xec,
+    0x6e,0xf7,0x8b,0x4e,0x4b,0xd5,0x89,0xf5,0xfe,0xe3,
+    0xed,0x6a,0xb7,0xdf,0x2c,0xba,0xf7,0xd7,0x6f,0x9e,
+    0xa7,0xee,0xd5,0xcb,0x67,0x17,0xdf,0x5d,0xfe,0x3c,
+    0x5e,0xff,0xfe,0xee,0x4a,0x3c,0x3c,0x6e,0xc4,0xbb,
+    0xf7,0xaf,0x97,0x3f,0x8c,0xa2,0x7b,0x3e,0x0c,0xbf,
+    0xd9,0x71,0x18,0x2e,0xaf,0x2f,0xc5,0x2f,0xbf,0xbe,
+    0x15,0x5a,0xea,0x61,0xb8,0xfa,0xa9,0x13,0xdd,0xf6,
+    0x70,0xb8,0x7b,0x31,0x0c,0xc7,0xe3,0x51,0x1e,0xad,
+    0xbc,0xbd,0xdf,0x0c,0x6f,0xef,0x3f,0xdc,0x6d,0x77,
+    0x1f,0x1f,0x06,0x18,0x0e,0x64,0x08,0xa7,0x01,0xc1,
+    0xb4,0x96,0xab,0xc3,0xaa,0x43,0x0a,0x8a,0x3c,0x23,
+    0xa2,0x3b,0x01,0x6a,0xfb,0x87,0xc5,0x57,0x82,0x19,
+    0xa5,0x14,0x39,0x57,0x93,0x17,0x9f,0x6e,0x76,0xfb,
+    0xbf,0xbf,0x66,0xa8,0x73,0xce,0x03,0x9f,0xc2,0x74,
+    0xd1,0xa1,0xb8,0xcf,0xfc,0x7a,0xdc,0xad,0x0e,0xdb,
+    0x45,0x67,0xa3,0x54,0x01,0x89,0xb6,0xeb,0xdd,0x66,
+    0x7b,0x38,0xe1,0xc7,0xdd,0xfa,0xf8,0xfa,0x96,0x1c,
+    0x7a,0x81,0xff,0xf2,0xb8,0xbd,0x83,0xab,0x10,0x17,
+    0x1b,0xb1,0x5b,0x2d,0xba,0xab,0x3f,0xd7,0xfb,0xf5,
+    0x1f,0xe5,0x11,0x1e,0xde,0x7d,0x38,0x6c,0x05,0x1e,
+    0xff,0xa8,0x93,0x74,0x31,0xf4,0xda,0xc9,0x94,0x93,
+    0x18,0x8d,0x92,0x2e,0xe5,0x06,0x8d,0x91,0xda,0xf8,
+    0x5e,0x07,0xe9,0x6d,0x9c,0x50,0x92,0xde,0x65,0x98,
+    0x16,0x08,0x0f,0x1f,0xb4,0x60,0xc7,0xd8,0xd3,0xc3,
+    0x9c,0x45,0x8d,0x5a,0xd1,0x88,0x00,0x2e,0xd8,0xe9,
+    0x10,0xc1,0x4d,0x28,0x8e,0x0d,0xb4,0xa0,0x0c,0x6b,
+    0x46,0x1c,0x16,0xbf,0xca,0xe6,0x9c,0xea,0x17,0xd1,
+    0xb8,0x23,0x50,0x84,0x67,0x96,0x21,0x98,0x02,0xf0,
+    0x12,0x28,0x4a,0x96,0xd1,0xfa,0x09,0x21,0x85,0xe7,
+    0x0a,0x19,0x45,0x69,0x83,0x17,0xec,0x45,0xe9,0xec,
+    0x89,0x75,0x45,0x23,0x4c,0x4c,0x9e,0xce,0xf0,0x46,
+    0x3c,0xab,0x5b,0x45,0x25,0x24,0xa3,0x29,0x5d,0x71,
+    0x63,0x1e,0x73,0x82,0x5f,0x3a,0xf1,0xd7,0xee,0xe6,
+    0x66,0xd1,0x7d,0xff,0x86,0xff,0xba,0xe1,0x7f,0xad,
+    0xf0,0xb0,0xd6,0xbd,0x49,0x54,0xb4,0x58,0x1a,0x0d,
+    0x45,0x6d,0x83,0x23,0x60,0xf4,0xa1,0x41,0x48,0xa9,
+    0x54,0x22,0x14,0x34,0x23,0xed,0x08,0x24,0x6f,0xb9,
+    0x31,0x26,0x42,0x89,0x2c,0x55,0x76,0x74,0x66,0x30,
+    0x12,0x40,0x36,0x95,0x1e,0x92,0x29,0xca,0xd6,0x59,
+    0x2c,0x41,0x59,0xab,0xdc,0x5b,0x27,0xad,0x82,0x27,
+    0xf8,0x26,0x6b,0x09,0x46,0xeb,0x88,0xbd,0x36,0x15,
+    0x59,0x2a,0x2b,0x39,0xdf,0x4c,0x97,0xd4,0x85,0x29,
+    0x0e,0xb5,0x2d,0x64,0x5b,0x92,0x24,0xea,0x69,0x48,
+    0xba,0x10,0xf0,0xdc,0xe1,0x19,0x3b,0xc0,0xec,0x5c,
+    0x63,0x8e,0x9a,0x75,0x9e,0xaa,0x3a,0x57,0x00,0x1d,
+    0x86,0x72,0x9a,0x03,0x65,0x52,0x04,0x3a,0x27,0x67,
+    0x4e,0x90,0xd4,0x8d,0xbd,0x35,0xd2,0xab,0x04,0xbd,
+    0xe6,0xb6,0x4f,0xaa,0xbd,0x29,0xef,0x73,0xdd,0xad,
+    0x95,0x29,0x99,0x36,0x82,0x4b,0x44,0xd0,0x39,0xf5,
+    0xe0,0xe2,0x9d,0x9f,0x20,0xe4,0xf7,0xe8,0xf5,0xf2,
+    0xdc,0xf8,0xa9,0x34,0xf3,0xf0,0x2d,0x1e,0x64,0xcc,
+    0x34,0x7f,0xd0,0xc8,0xe6,0x06,0x81,0x1c,0x9f,0x25,
+    0xcb,0x20,0x28,0x1e,0xf7,0xac,0x1d,0x52,0x39,0x69,
+    0x70,0xa5,0x20,0x7c,0xd6,0x18,0x70,0x40,0xaf,0x38,
+    0xb3,0x02,0x11,0xa0,0x60,0x19,0x99,0x6c,0x67,0xc8,
+    0xbb,0xc4,0xa6,0x15,0x26,0xc5,0x87,0xec,0x88,0x76,
+    0x38,0x2d,0x5a,0x54,0xb0,0x8a,0xa5,0x5a,0xca,0x49,
+    0x73,0x91,0x2a,0xbb,0xc8,0xd0,0xa2,0xe7,0xd4,0xc1,
+    0x98,0x19,0x39,0x20,0x9a,0x0e,0xbe,0xe2,0x46,0x1b,
+    0x98,0x22,0x59,0x66,0xa8,0x92,0xa6,0x43,0xe7,0x22,
+    0xc9,0x94,0x4c,0x9a,0x21,0xef,0x51,0x49,0x85,0x2c,
+    0xa9,0x63,0xcf,0x0a,0x4d,0x14,0x1c,0xc6,0x13,0x50,
+    0x3a,0xb5,0x1c,0x24,0x48,0x0a,0x6c,0x99,0xbd,0xee,
+    0xcb,0x56,0x28,0x74,0xfc,0x4c,0xba,0x99,0xae,0x18,
+    0x16,0x0c,0x82,0xc3,0x10,0xce,0xfa,0x98,0x49,0xdb,
+    0xc0,0xf2,0x35,0x48,0x53,0x92,0x0c,0xc4,0x3d,0x33,
+    0x7e,0x72,0x5c,0x86,0xcd,0x7f,0x6f,0x29,0xae,0x81,
+    0x36,0x53,0x37,0xd1,0x1b,0x1b,0x1a,0xa2,0xce,0xa4,
+    0x46,0x16,0x97,0xa7,0xd6,0x81,0xde,0xa1,0x60,0xcc,
+    0x26,0xd7,0x98,0x71,0xe2,0xb1,0xa8,0xb8,0x7a,0x7d,
+    0x02,0x3c,0x6c,0x05,0xd5,0x59,0x1b,0x27,0x94,0x0c,
+    0x79,0x39,0x6d,0x9b,0xda,0x1c,0x9c,0x1b,0x61,0x0b,
+    0x07,0x5d,0x9a,0xe4,0x44,0x44,0xe7,0x63,0xe9,0x5f,
+    0x00,0x70,0xca,0x97,0xde,0x06,0x28,0x20,0x23,0x4f,
+    0x81,0x46,0x80,0x91,0x2e,0x8d,0x2f,0x33,0x81,0xce,
+    0xa2,0xe9,0xbe,0x8c,0x8b,0x3f,0x01,0xde,0x96,0x0d,
+    0x18,0x52,0xbc,0xf8,0x50,0x99,0xe8,0x1b,0x47,0xa3,
+    0xd9,0x84,0xd6,0x25,0x11,0x0f,0x2e,0x8b,0xe2,0x4d,
+    0x6e,0x43,0x0d,0x42,0x51,0x37,0x85,0xce,0xc4,0x43,
+    0xcb,0xe8,0x6b,0xca,0x94,0x9e,0x58,0x8a,0x42,0xa8,
+    0x35,0x0c,0x53,0xab,0xdb,0x8a,0x5d,0x9e,0x19,0x7e,
+    0xc3,0x2a,0x2d,0xab,0x01,0x3d,0xf6,0xa7,0x45,0x51,
+    0x10,0x2d,0xb9,0x88,0xcb,0x51,0x10,0x40,0x0e,0x98,
+    0x70,0xe9,0x11,0x97,0xb7,0x21,0x46,0x04,0xec,0x68,
+    0x9f,0xd0,0xaa,0xb4,0x3d,0x4a,0x4b,0xa6,0x2c,0xd5,
+    0x00,0x10,0xcb,0xba,0x45,0xeb,0x7a,0xe8,0xa0,0x02,
+    0x6f,0x54,0xdc,0x67,0x28,0x44,0x37,0x8f,0xf7,0x72,
+    0x04,0xc2,0x50,0xf1,0xc6,0xf6,0xf8,0x1c,0x2c,0x03,
+    0xc4,0xa9,0x60,0xc9,0x8b,0xae,0x82,0x91,0x77,0x60,
+    0x43,0xbc,0x1e,0x3d,0x07,0xd0,0x65,0x75,0xda,0x16,
+    0x9b,0xd7,0x2a,0x67,0x2d,0x2b,0x36,0x1b,0xe6,0x53,
+    0x36,0x2c,0x28,0x14,0xa6,0x4b,0x5e,0xd4,0xae,0x56,
+    0x41,0x5f,0x62,0x99,0x16,0x75,0x29,0x10,0x91,0x8c,
+    0x3e,0x95,0x7e,0x52,0x65,0xda,0xb5,0x11,0xd5,0xc4,
+    0x49,0x32,0xf4,0x20,0x9b,0x69,0xf1,0xd6,0xb3,0xb9,
+    0xe1,0x37,0xb5,0xc2,0xdb,0x5e,0xf1,0x5d,0x8e,0xc1,
+    0xe3,0x53,0xfd,0x91,0x42,0x33,0x15,0x1a,0x60,0x2b,
+    0x8c,0x65,0x85,0xc5,0x56,0x54,0x97,0xf2,0x50,0x94,
+    0x48,0x15,0x8c,0xec,0xde,0x90,0x6a,0x1e,0x6a,0x8a,
+    0xa4,0x6a,0x82,0x62,0xa7,0x44,0xe3,0x51,0x7e,0x37,
+    0xe0,0x23,0xc7,0x48,0x0e,0x83,0x2a,0x88,0x0c,0x3e,
+    0x89,0x13,0x0f,0xa6,0x40,0x6b,0xae,0x98,0xd8,0x30,
+    0x67,0x50,0xc0,0x58,0x2c,0x1a,0x2c,0x6f,0xcd,0xad,
+    0xa2,0xa9,0xac,0x50,0x4b,0xa6,0x2c,0xd5,0xaf,0x85,
+    0xd3,0x4f,0x88,0xc8,0xbb,0xe7,0x82,0x7e,0x3c,0xbe,
+    0x7c,0xf6,0x2f,0xb5,0x99,0x53,0x0c
 };
 
@@ -1,298 +1,122 @@
-//this file was auto-generated from "analog_thumb.svg" by res2h
+//this file was auto-generated from "analog_thumb.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_analog_thumb_svg_size = 2894;
-const unsigned char help_analog_thumb_svg_data[2894] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x55,0x54,0x46,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x73,
-    0x76,0x67,0x20,0x50,0x55,0x42,0x4c,0x49,0x43,0x20,
-    0x22,0x2d,0x2f,0x2f,0x57,0x33,0x43,0x2f,0x2f,0x44,
-    0x54,0x44,0x20,0x53,0x56,0x47,0x20,0x31,0x2e,0x31,
-    0x2f,0x2f,0x45,0x4e,0x22,0x20,0x22,0x68,0x74,0x74,
-    0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,
-    0x2e,0x6f,0x72,0x67,0x2f,0x47,0x72,0x61,0x70,0x68,
-    0x69,0x63,0x73,0x2f,0x53,0x56,0x47,0x2f,0x31,0x2e,
-    0x31,0x2f,0x44,0x54,0x44,0x2f,0x73,0x76,0x67,0x31,
-    0x31,0x2e,0x64,0x74,0x64,0x22,0x3e,0x0a,0x3c,0x73,
-    0x76,0x67,0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,
-    0x3d,0x22,0x31,0x2e,0x31,0x22,0x20,0x78,0x6d,0x6c,
-    0x6e,0x73,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,
-    0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,
-    0x67,0x2f,0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,
-    0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,
-    0x69,0x6e,0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,
-    0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,
-    0x72,0x67,0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,
-    0x69,0x6e,0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,
-    0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,
-    0x33,0x37,0x2e,0x30,0x36,0x31,0x22,0x20,0x76,0x69,
-    0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x2c,0x20,
-    0x30,0x2c,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,
-    0x20,0x33,0x37,0x2e,0x30,0x36,0x31,0x22,0x3e,0x0a,
-    0x20,0x20,0x3c,0x67,0x20,0x69,0x64,0x3d,0x22,0x45,
-    0x62,0x65,0x6e,0x65,0x5f,0x31,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,
-    0x3d,0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,
-    0x32,0x32,0x2e,0x31,0x38,0x31,0x20,0x43,0x31,0x36,
-    0x2e,0x35,0x31,0x38,0x2c,0x32,0x32,0x2e,0x31,0x38,
-    0x31,0x20,0x31,0x34,0x2e,0x38,0x38,0x32,0x2c,0x32,
-    0x30,0x2e,0x35,0x34,0x32,0x20,0x31,0x34,0x2e,0x38,
-    0x38,0x32,0x2c,0x31,0x38,0x2e,0x35,0x33,0x20,0x43,
-    0x31,0x34,0x2e,0x38,0x38,0x32,0x2c,0x31,0x36,0x2e,
-    0x35,0x31,0x38,0x20,0x31,0x36,0x2e,0x35,0x32,0x2c,
-    0x31,0x34,0x2e,0x38,0x38,0x20,0x31,0x38,0x2e,0x35,
-    0x33,0x31,0x2c,0x31,0x34,0x2e,0x38,0x38,0x20,0x43,
-    0x32,0x30,0x2e,0x35,0x34,0x34,0x2c,0x31,0x34,0x2e,
-    0x38,0x38,0x20,0x32,0x32,0x2e,0x31,0x38,0x31,0x2c,
-    0x31,0x36,0x2e,0x35,0x31,0x39,0x20,0x32,0x32,0x2e,
-    0x31,0x38,0x31,0x2c,0x31,0x38,0x2e,0x35,0x33,0x20,
-    0x43,0x32,0x32,0x2e,0x31,0x38,0x32,0x2c,0x32,0x30,
-    0x2e,0x35,0x34,0x33,0x20,0x32,0x30,0x2e,0x35,0x34,
-    0x34,0x2c,0x32,0x32,0x2e,0x31,0x38,0x31,0x20,0x31,
-    0x38,0x2e,0x35,0x33,0x31,0x2c,0x32,0x32,0x2e,0x31,
-    0x38,0x31,0x20,0x7a,0x20,0x4d,0x31,0x38,0x2e,0x35,
-    0x33,0x31,0x2c,0x31,0x36,0x2e,0x33,0x37,0x39,0x20,
-    0x43,0x31,0x37,0x2e,0x33,0x34,0x35,0x2c,0x31,0x36,
-    0x2e,0x33,0x37,0x39,0x20,0x31,0x36,0x2e,0x33,0x38,
-    0x32,0x2c,0x31,0x37,0x2e,0x33,0x34,0x34,0x20,0x31,
-    0x36,0x2e,0x33,0x38,0x32,0x2c,0x31,0x38,0x2e,0x35,
-    0x32,0x39,0x20,0x43,0x31,0x36,0x2e,0x33,0x38,0x32,
-    0x2c,0x31,0x39,0x2e,0x37,0x31,0x34,0x20,0x31,0x37,
-    0x2e,0x33,0x34,0x37,0x2c,0x32,0x30,0x2e,0x36,0x38,
-    0x20,0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,0x32,0x30,
-    0x2e,0x36,0x38,0x20,0x43,0x31,0x39,0x2e,0x37,0x31,
-    0x37,0x2c,0x32,0x30,0x2e,0x36,0x38,0x20,0x32,0x30,
-    0x2e,0x36,0x38,0x31,0x2c,0x31,0x39,0x2e,0x37,0x31,
-    0x34,0x20,0x32,0x30,0x2e,0x36,0x38,0x31,0x2c,0x31,
-    0x38,0x2e,0x35,0x32,0x39,0x20,0x43,0x32,0x30,0x2e,
-    0x36,0x38,0x32,0x2c,0x31,0x37,0x2e,0x33,0x34,0x34,
-    0x20,0x31,0x39,0x2e,0x37,0x31,0x37,0x2c,0x31,0x36,
-    0x2e,0x33,0x37,0x39,0x20,0x31,0x38,0x2e,0x35,0x33,
-    0x31,0x2c,0x31,0x36,0x2e,0x33,0x37,0x39,0x20,0x7a,
-    0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,
-    0x46,0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,
-    0x3d,0x22,0x4d,0x32,0x31,0x2e,0x35,0x33,0x36,0x2c,
-    0x38,0x2e,0x36,0x31,0x36,0x20,0x4c,0x31,0x35,0x2e,
-    0x35,0x32,0x34,0x2c,0x38,0x2e,0x36,0x31,0x36,0x20,
-    0x43,0x31,0x35,0x2e,0x32,0x35,0x31,0x2c,0x38,0x2e,
-    0x36,0x31,0x36,0x20,0x31,0x34,0x2e,0x39,0x39,0x39,
-    0x2c,0x38,0x2e,0x34,0x36,0x36,0x20,0x31,0x34,0x2e,
-    0x38,0x36,0x37,0x2c,0x38,0x2e,0x32,0x32,0x36,0x20,
-    0x43,0x31,0x34,0x2e,0x37,0x33,0x35,0x2c,0x37,0x2e,
-    0x39,0x38,0x35,0x20,0x31,0x34,0x2e,0x37,0x34,0x36,
-    0x2c,0x37,0x2e,0x36,0x39,0x32,0x20,0x31,0x34,0x2e,
-    0x38,0x39,0x33,0x2c,0x37,0x2e,0x34,0x36,0x20,0x4c,
-    0x31,0x37,0x2e,0x38,0x39,0x38,0x2c,0x32,0x2e,0x37,
-    0x37,0x36,0x20,0x43,0x31,0x38,0x2e,0x31,0x37,0x34,
-    0x2c,0x32,0x2e,0x33,0x34,0x35,0x20,0x31,0x38,0x2e,
-    0x38,0x38,0x34,0x2c,0x32,0x2e,0x33,0x34,0x36,0x20,
-    0x31,0x39,0x2e,0x31,0x36,0x32,0x2c,0x32,0x2e,0x37,
-    0x37,0x36,0x20,0x4c,0x32,0x32,0x2e,0x31,0x36,0x37,
-    0x2c,0x37,0x2e,0x34,0x36,0x20,0x43,0x32,0x32,0x2e,
-    0x33,0x31,0x34,0x2c,0x37,0x2e,0x36,0x39,0x31,0x20,
-    0x32,0x32,0x2e,0x33,0x32,0x36,0x2c,0x37,0x2e,0x39,
-    0x38,0x34,0x20,0x32,0x32,0x2e,0x31,0x39,0x33,0x2c,
-    0x38,0x2e,0x32,0x32,0x36,0x20,0x43,0x32,0x32,0x2e,
-    0x30,0x36,0x33,0x2c,0x38,0x2e,0x34,0x36,0x36,0x20,
-    0x32,0x31,0x2e,0x38,0x31,0x31,0x2c,0x38,0x2e,0x36,
-    0x31,0x36,0x20,0x32,0x31,0x2e,0x35,0x33,0x36,0x2c,
-    0x38,0x2e,0x36,0x31,0x36,0x20,0x7a,0x20,0x4d,0x31,
-    0x36,0x2e,0x38,0x39,0x37,0x2c,0x37,0x2e,0x31,0x31,
-    0x36,0x20,0x4c,0x32,0x30,0x2e,0x31,0x36,0x35,0x2c,
-    0x37,0x2e,0x31,0x31,0x36,0x20,0x4c,0x31,0x38,0x2e,
-    0x35,0x33,0x2c,0x34,0x2e,0x35,0x37,0x31,0x20,0x4c,
-    0x31,0x36,0x2e,0x38,0x39,0x37,0x2c,0x37,0x2e,0x31,
-    0x31,0x36,0x20,0x7a,0x22,0x20,0x66,0x69,0x6c,0x6c,
-    0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,
-    0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x37,0x2e,0x37,
-    0x38,0x32,0x2c,0x31,0x34,0x2e,0x37,0x37,0x36,0x20,
-    0x4c,0x38,0x2e,0x31,0x37,0x2c,0x31,0x34,0x2e,0x38,
-    0x36,0x37,0x20,0x43,0x38,0x2e,0x34,0x31,0x2c,0x31,
-    0x34,0x2e,0x39,0x39,0x38,0x20,0x38,0x2e,0x35,0x36,
-    0x2c,0x31,0x35,0x2e,0x32,0x35,0x31,0x20,0x38,0x2e,
-    0x35,0x36,0x2c,0x31,0x35,0x2e,0x35,0x32,0x35,0x20,
-    0x4c,0x38,0x2e,0x35,0x36,0x2c,0x32,0x31,0x2e,0x35,
-    0x33,0x35,0x20,0x43,0x38,0x2e,0x35,0x36,0x2c,0x32,
-    0x31,0x2e,0x38,0x30,0x39,0x20,0x38,0x2e,0x34,0x31,
-    0x32,0x2c,0x32,0x32,0x2e,0x30,0x36,0x31,0x20,0x38,
-    0x2e,0x31,0x37,0x2c,0x32,0x32,0x2e,0x31,0x39,0x33,
-    0x20,0x43,0x38,0x2e,0x30,0x35,0x36,0x2c,0x32,0x32,
-    0x2e,0x32,0x35,0x34,0x20,0x37,0x2e,0x39,0x33,0x32,
-    0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,0x20,0x37,0x2e,
-    0x38,0x30,0x39,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,
-    0x20,0x43,0x37,0x2e,0x36,0x36,0x38,0x2c,0x32,0x32,
-    0x2e,0x32,0x38,0x34,0x20,0x37,0x2e,0x35,0x32,0x37,
-    0x2c,0x32,0x32,0x2e,0x32,0x34,0x34,0x20,0x37,0x2e,
-    0x34,0x30,0x34,0x2c,0x32,0x32,0x2e,0x31,0x36,0x35,
-    0x20,0x4c,0x32,0x2e,0x37,0x32,0x2c,0x31,0x39,0x2e,
-    0x31,0x36,0x32,0x20,0x43,0x32,0x2e,0x35,0x30,0x35,
-    0x2c,0x31,0x39,0x2e,0x30,0x32,0x34,0x20,0x32,0x2e,
-    0x33,0x37,0x35,0x2c,0x31,0x38,0x2e,0x37,0x38,0x36,
-    0x20,0x32,0x2e,0x33,0x37,0x35,0x2c,0x31,0x38,0x2e,
-    0x35,0x33,0x31,0x20,0x43,0x32,0x2e,0x33,0x37,0x35,
-    0x2c,0x31,0x38,0x2e,0x32,0x37,0x36,0x20,0x32,0x2e,
-    0x35,0x30,0x35,0x2c,0x31,0x38,0x2e,0x30,0x33,0x38,
-    0x20,0x32,0x2e,0x37,0x32,0x2c,0x31,0x37,0x2e,0x39,
-    0x20,0x4c,0x37,0x2e,0x34,0x30,0x34,0x2c,0x31,0x34,
-    0x2e,0x38,0x39,0x34,0x20,0x4c,0x37,0x2e,0x37,0x38,
-    0x32,0x2c,0x31,0x34,0x2e,0x37,0x37,0x36,0x20,0x7a,
-    0x20,0x4d,0x37,0x2e,0x30,0x35,0x39,0x2c,0x31,0x36,
-    0x2e,0x38,0x39,0x37,0x20,0x4c,0x34,0x2e,0x35,0x31,
-    0x34,0x2c,0x31,0x38,0x2e,0x35,0x33,0x20,0x4c,0x37,
-    0x2e,0x30,0x35,0x39,0x2c,0x32,0x30,0x2e,0x31,0x36,
-    0x32,0x20,0x4c,0x37,0x2e,0x30,0x35,0x39,0x2c,0x31,
-    0x36,0x2e,0x38,0x39,0x37,0x20,0x7a,0x22,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,
-    0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,
-    0x32,0x39,0x2e,0x31,0x39,0x35,0x2c,0x32,0x32,0x2e,
-    0x32,0x38,0x34,0x20,0x43,0x32,0x39,0x2e,0x30,0x37,
-    0x31,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,0x20,0x32,
-    0x38,0x2e,0x39,0x34,0x39,0x2c,0x32,0x32,0x2e,0x32,
-    0x35,0x34,0x20,0x32,0x38,0x2e,0x38,0x33,0x37,0x2c,
-    0x32,0x32,0x2e,0x31,0x39,0x32,0x20,0x43,0x32,0x38,
-    0x2e,0x35,0x39,0x36,0x2c,0x32,0x32,0x2e,0x30,0x36,
-    0x20,0x32,0x38,0x2e,0x34,0x34,0x35,0x2c,0x32,0x31,
-    0x2e,0x38,0x30,0x38,0x20,0x32,0x38,0x2e,0x34,0x34,
-    0x35,0x2c,0x32,0x31,0x2e,0x35,0x33,0x34,0x20,0x4c,
-    0x32,0x38,0x2e,0x34,0x34,0x35,0x2c,0x31,0x35,0x2e,
-    0x35,0x32,0x34,0x20,0x43,0x32,0x38,0x2e,0x34,0x34,
-    0x35,0x2c,0x31,0x35,0x2e,0x32,0x35,0x20,0x32,0x38,
-    0x2e,0x35,0x39,0x34,0x2c,0x31,0x34,0x2e,0x39,0x39,
-    0x38,0x20,0x32,0x38,0x2e,0x38,0x33,0x37,0x2c,0x31,
-    0x34,0x2e,0x38,0x36,0x36,0x20,0x43,0x32,0x39,0x2e,
-    0x30,0x37,0x36,0x2c,0x31,0x34,0x2e,0x37,0x33,0x35,
-    0x20,0x32,0x39,0x2e,0x33,0x37,0x2c,0x31,0x34,0x2e,
-    0x37,0x34,0x33,0x20,0x32,0x39,0x2e,0x36,0x30,0x32,
-    0x2c,0x31,0x34,0x2e,0x38,0x39,0x33,0x20,0x4c,0x33,
-    0x34,0x2e,0x32,0x38,0x37,0x2c,0x31,0x37,0x2e,0x38,
-    0x39,0x38,0x20,0x43,0x33,0x34,0x2e,0x35,0x30,0x32,
-    0x2c,0x31,0x38,0x2e,0x30,0x33,0x36,0x20,0x33,0x34,
-    0x2e,0x36,0x33,0x32,0x2c,0x31,0x38,0x2e,0x32,0x37,
-    0x34,0x20,0x33,0x34,0x2e,0x36,0x33,0x32,0x2c,0x31,
-    0x38,0x2e,0x35,0x32,0x39,0x20,0x43,0x33,0x34,0x2e,
-    0x36,0x33,0x32,0x2c,0x31,0x38,0x2e,0x37,0x38,0x34,
-    0x20,0x33,0x34,0x2e,0x35,0x30,0x32,0x2c,0x31,0x39,
-    0x2e,0x30,0x32,0x32,0x20,0x33,0x34,0x2e,0x32,0x38,
-    0x37,0x2c,0x31,0x39,0x2e,0x31,0x36,0x20,0x4c,0x32,
-    0x39,0x2e,0x36,0x30,0x32,0x2c,0x32,0x32,0x2e,0x31,
-    0x36,0x34,0x20,0x43,0x32,0x39,0x2e,0x34,0x37,0x38,
-    0x2c,0x32,0x32,0x2e,0x32,0x34,0x34,0x20,0x32,0x39,
-    0x2e,0x33,0x33,0x36,0x2c,0x32,0x32,0x2e,0x32,0x38,
-    0x34,0x20,0x32,0x39,0x2e,0x31,0x39,0x35,0x2c,0x32,
-    0x32,0x2e,0x32,0x38,0x34,0x20,0x7a,0x20,0x4d,0x32,
-    0x39,0x2e,0x39,0x34,0x35,0x2c,0x31,0x36,0x2e,0x38,
-    0x39,0x36,0x20,0x4c,0x32,0x39,0x2e,0x39,0x34,0x35,
-    0x2c,0x32,0x30,0x2e,0x31,0x36,0x32,0x20,0x4c,0x33,
-    0x32,0x2e,0x34,0x39,0x31,0x2c,0x31,0x38,0x2e,0x35,
-    0x32,0x39,0x20,0x4c,0x32,0x39,0x2e,0x39,0x34,0x35,
-    0x2c,0x31,0x36,0x2e,0x38,0x39,0x36,0x20,0x7a,0x22,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,
-    0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,
-    0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x34,
-    0x2e,0x36,0x32,0x36,0x20,0x4c,0x31,0x38,0x2e,0x35,
-    0x33,0x2c,0x33,0x34,0x2e,0x36,0x32,0x36,0x20,0x43,
-    0x31,0x38,0x2e,0x32,0x37,0x35,0x2c,0x33,0x34,0x2e,
-    0x36,0x32,0x36,0x20,0x31,0x38,0x2e,0x30,0x33,0x38,
-    0x2c,0x33,0x34,0x2e,0x34,0x39,0x36,0x20,0x31,0x37,
-    0x2e,0x38,0x39,0x39,0x2c,0x33,0x34,0x2e,0x32,0x38,
-    0x31,0x20,0x4c,0x31,0x34,0x2e,0x38,0x39,0x34,0x2c,
-    0x32,0x39,0x2e,0x35,0x39,0x37,0x20,0x43,0x31,0x34,
-    0x2e,0x37,0x34,0x37,0x2c,0x32,0x39,0x2e,0x33,0x36,
-    0x36,0x20,0x31,0x34,0x2e,0x37,0x33,0x36,0x2c,0x32,
-    0x39,0x2e,0x30,0x37,0x33,0x20,0x31,0x34,0x2e,0x38,
-    0x36,0x38,0x2c,0x32,0x38,0x2e,0x38,0x33,0x31,0x20,
-    0x43,0x31,0x35,0x2c,0x32,0x38,0x2e,0x35,0x38,0x39,
-    0x20,0x31,0x35,0x2e,0x32,0x35,0x32,0x2c,0x32,0x38,
-    0x2e,0x34,0x34,0x20,0x31,0x35,0x2e,0x35,0x32,0x35,
-    0x2c,0x32,0x38,0x2e,0x34,0x34,0x20,0x4c,0x32,0x31,
-    0x2e,0x35,0x33,0x37,0x2c,0x32,0x38,0x2e,0x34,0x34,
-    0x20,0x43,0x32,0x31,0x2e,0x38,0x31,0x2c,0x32,0x38,
-    0x2e,0x34,0x34,0x20,0x32,0x32,0x2e,0x30,0x36,0x32,
-    0x2c,0x32,0x38,0x2e,0x35,0x38,0x38,0x20,0x32,0x32,
-    0x2e,0x31,0x39,0x34,0x2c,0x32,0x38,0x2e,0x38,0x33,
-    0x31,0x20,0x43,0x32,0x32,0x2e,0x33,0x32,0x37,0x2c,
-    0x32,0x39,0x2e,0x30,0x37,0x31,0x20,0x32,0x32,0x2e,
-    0x33,0x31,0x35,0x2c,0x32,0x39,0x2e,0x33,0x36,0x34,
-    0x20,0x32,0x32,0x2e,0x31,0x36,0x38,0x2c,0x32,0x39,
-    0x2e,0x35,0x39,0x37,0x20,0x4c,0x31,0x39,0x2e,0x31,
-    0x36,0x33,0x2c,0x33,0x34,0x2e,0x32,0x38,0x31,0x20,
-    0x43,0x31,0x39,0x2e,0x30,0x32,0x33,0x2c,0x33,0x34,
-    0x2e,0x34,0x39,0x36,0x20,0x31,0x38,0x2e,0x37,0x38,
-    0x36,0x2c,0x33,0x34,0x2e,0x36,0x32,0x36,0x20,0x31,
-    0x38,0x2e,0x35,0x33,0x2c,0x33,0x34,0x2e,0x36,0x32,
-    0x36,0x20,0x7a,0x20,0x4d,0x31,0x36,0x2e,0x38,0x39,
-    0x37,0x2c,0x32,0x39,0x2e,0x39,0x34,0x32,0x20,0x4c,
-    0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x32,0x2e,0x34,
-    0x38,0x37,0x20,0x4c,0x32,0x30,0x2e,0x31,0x36,0x35,
-    0x2c,0x32,0x39,0x2e,0x39,0x34,0x32,0x20,0x4c,0x31,
-    0x36,0x2e,0x38,0x39,0x37,0x2c,0x32,0x39,0x2e,0x39,
-    0x34,0x32,0x20,0x7a,0x22,0x20,0x66,0x69,0x6c,0x6c,
-    0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,
-    0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,0x38,0x2e,
-    0x35,0x33,0x2c,0x30,0x20,0x43,0x32,0x38,0x2e,0x37,
-    0x36,0x35,0x2c,0x30,0x20,0x33,0x37,0x2e,0x30,0x36,
-    0x31,0x2c,0x38,0x2e,0x32,0x39,0x36,0x20,0x33,0x37,
-    0x2e,0x30,0x36,0x31,0x2c,0x31,0x38,0x2e,0x35,0x33,
-    0x31,0x20,0x43,0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,
-    0x32,0x38,0x2e,0x37,0x36,0x35,0x20,0x32,0x38,0x2e,
-    0x37,0x36,0x35,0x2c,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x20,0x43,0x38,0x2e,0x32,0x39,0x36,
-    0x2c,0x33,0x37,0x2e,0x30,0x36,0x31,0x20,0x30,0x2c,
-    0x32,0x38,0x2e,0x37,0x36,0x35,0x20,0x30,0x2c,0x31,
-    0x38,0x2e,0x35,0x33,0x31,0x20,0x43,0x30,0x2c,0x38,
-    0x2e,0x32,0x39,0x36,0x20,0x38,0x2e,0x32,0x39,0x36,
-    0x2c,0x30,0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,0x30,
-    0x20,0x7a,0x20,0x4d,0x31,0x38,0x2e,0x35,0x33,0x2c,
-    0x31,0x20,0x43,0x38,0x2e,0x38,0x34,0x39,0x2c,0x31,
-    0x20,0x31,0x2c,0x38,0x2e,0x38,0x34,0x39,0x20,0x31,
-    0x2c,0x31,0x38,0x2e,0x35,0x33,0x31,0x20,0x43,0x31,
-    0x2c,0x32,0x38,0x2e,0x32,0x31,0x32,0x20,0x38,0x2e,
-    0x38,0x34,0x39,0x2c,0x33,0x36,0x2e,0x30,0x36,0x31,
-    0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x36,0x2e,
-    0x30,0x36,0x31,0x20,0x43,0x32,0x38,0x2e,0x32,0x31,
-    0x32,0x2c,0x33,0x36,0x2e,0x30,0x36,0x31,0x20,0x33,
-    0x36,0x2e,0x30,0x36,0x31,0x2c,0x32,0x38,0x2e,0x32,
-    0x31,0x32,0x20,0x33,0x36,0x2e,0x30,0x36,0x31,0x2c,
-    0x31,0x38,0x2e,0x35,0x33,0x31,0x20,0x43,0x33,0x36,
-    0x2e,0x30,0x36,0x31,0x2c,0x38,0x2e,0x38,0x34,0x39,
-    0x20,0x32,0x38,0x2e,0x32,0x31,0x32,0x2c,0x31,0x20,
-    0x31,0x38,0x2e,0x35,0x33,0x2c,0x31,0x20,0x7a,0x22,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,
-    0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,0x20,
-    0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,
-    0x22,0x4d,0x31,0x38,0x2e,0x35,0x32,0x39,0x2c,0x32,
-    0x32,0x2e,0x31,0x38,0x31,0x20,0x43,0x31,0x36,0x2e,
-    0x35,0x31,0x33,0x2c,0x32,0x32,0x2e,0x31,0x38,0x31,
-    0x20,0x31,0x34,0x2e,0x38,0x37,0x39,0x2c,0x32,0x30,
-    0x2e,0x35,0x34,0x37,0x20,0x31,0x34,0x2e,0x38,0x37,
-    0x39,0x2c,0x31,0x38,0x2e,0x35,0x33,0x20,0x43,0x31,
-    0x34,0x2e,0x38,0x37,0x39,0x2c,0x31,0x36,0x2e,0x35,
-    0x31,0x34,0x20,0x31,0x36,0x2e,0x35,0x31,0x33,0x2c,
-    0x31,0x34,0x2e,0x38,0x38,0x20,0x31,0x38,0x2e,0x35,
-    0x32,0x39,0x2c,0x31,0x34,0x2e,0x38,0x38,0x20,0x43,
-    0x32,0x30,0x2e,0x35,0x34,0x36,0x2c,0x31,0x34,0x2e,
-    0x38,0x38,0x20,0x32,0x32,0x2e,0x31,0x38,0x2c,0x31,
-    0x36,0x2e,0x35,0x31,0x34,0x20,0x32,0x32,0x2e,0x31,
-    0x38,0x2c,0x31,0x38,0x2e,0x35,0x33,0x20,0x43,0x32,
-    0x32,0x2e,0x31,0x38,0x2c,0x32,0x30,0x2e,0x35,0x34,
-    0x37,0x20,0x32,0x30,0x2e,0x35,0x34,0x36,0x2c,0x32,
-    0x32,0x2e,0x31,0x38,0x31,0x20,0x31,0x38,0x2e,0x35,
-    0x32,0x39,0x2c,0x32,0x32,0x2e,0x31,0x38,0x31,0x20,
-    0x7a,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,
-    0x20,0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x73,
-    0x76,0x67,0x3e,0x0a
+const size_t help_analog_thumb_svg_size = 1131;
+const unsigned char help_analog_thumb_svg_data[1131] = {
+    0x45,0x53,0x5a,0x31,0x4e,0x0b,0x00,0x00,0x78,0xda,
+    0x8d,0x56,0xdb,0x6e,0xdb,0x46,0x10,0x7d,0xcf,0x57,
+    0x6c,0xd9,0x57,0x86,0xe4,0xde,0x77,0x03,0x2b,0x01,
+    0x42,0x3b,0x41,0x01,0xb5,0x0d,0x50,0xa7,0x45,0x9f,
+    0x8a,0x34,0x52,0x25,0xa1,0xae,0x6c,0xd8,0x82,0x95,
+    0xe6,0xeb,0x7b,0x66,0x66,0x97,0xa2,0x0a,0x03,0xb1,
+    0x61,0x88,0x3c,0xbb,0x73,0x39,0x73,0xd9,0xe1,0x5e,
+    0xbc,0xf9,0xf2,0xcf,0x8d,0x7a,0x5c,0xdf,0x3f,0xec,
+    0x6e,0xf7,0x8b,0x46,0x77,0x43,0xa3,0xd6,0xfb,0xcf,
+    0xb7,0xab,0xdd,0x7e,0xb3,0x68,0x3e,0x5e,0xbf,0x7b,
+    0x99,0x9a,0x37,0xaf,0x5f,0x5c,0x7c,0x77,0xf9,0xf3,
+    0x78,0xfd,0xfb,0x87,0x2b,0xf5,0xf0,0xb8,0x51,0x1f,
+    0x3e,0xbe,0x5d,0xfe,0x30,0xaa,0xe6,0x65,0xdf,0xff,
+    0x66,0xc7,0xbe,0xbf,0xbc,0xbe,0x54,0xbf,0xfc,0xfa,
+    0x5e,0xe9,0x4e,0xf7,0xfd,0xd5,0x4f,0x8d,0x6a,0xb6,
+    0x87,0xc3,0xdd,0xab,0xbe,0x3f,0x1e,0x8f,0xdd,0xd1,
+    0x76,0xb7,0xf7,0x9b,0xfe,0xfd,0xfd,0xa7,0xbb,0xed,
+    0xee,0xf3,0x43,0x0f,0xc1,0x9e,0x04,0xa1,0xd4,0xc3,
+    0x98,0xd6,0xdd,0xea,0xb0,0x6a,0xe0,0x82,0x2c,0xcf,
+    0x88,0xe8,0x46,0x81,0xda,0xfe,0x61,0xf1,0x84,0x31,
+    0x33,0x0c,0x03,0x29,0x17,0x91,0x57,0x5f,0x6e,0x76,
+    0xfb,0xbf,0x9f,0x12,0xd4,0x39,0xe7,0x9e,0x77,0x21,
+    0xba,0x68,0x10,0xdc,0xbf,0xfc,0x7b,0xdc,0xad,0x0e,
+    0xdb,0x45,0x63,0x63,0x37,0x04,0x38,0xda,0xae,0x77,
+    0x9b,0xed,0xe1,0x84,0x1f,0x77,0xeb,0xe3,0xdb,0x5b,
+    0x52,0x68,0x15,0xfe,0x65,0xb9,0x3e,0xc1,0x55,0xa9,
+    0x8b,0x8d,0xda,0xad,0x16,0xcd,0xd5,0x9f,0xeb,0xfd,
+    0xfa,0x0f,0x59,0xc2,0xe2,0xdd,0xa7,0xc3,0x56,0x61,
+    0xf9,0x47,0x9d,0x3a,0x6f,0x75,0x6b,0x4c,0xa7,0x93,
+    0x56,0xa3,0x0e,0x9d,0xd7,0xa9,0x42,0xed,0xba,0x94,
+    0x4c,0x6b,0x86,0xce,0x3b,0x53,0x11,0x6b,0x40,0xb2,
+    0x20,0x56,0x50,0xf4,0x00,0xa0,0x35,0x55,0x4c,0x0a,
+    0x18,0x59,0xd9,0x15,0x24,0x76,0x45,0x29,0x4f,0x48,
+    0x0c,0x32,0x2a,0xce,0xac,0x2a,0x6a,0x95,0xc8,0x19,
+    0xcb,0xaf,0xaa,0xd2,0x86,0x21,0x1b,0x33,0xc8,0xc4,
+    0xce,0x3a,0x5f,0x21,0x3d,0x88,0x1a,0x2d,0xba,0x09,
+    0x41,0xc3,0x64,0x8e,0x90,0x61,0xee,0xa2,0xc6,0x26,
+    0xc9,0x44,0x72,0x1a,0x26,0xe2,0x02,0x46,0x96,0xa8,
+    0x5b,0xfc,0xab,0xab,0x56,0x45,0xc5,0x24,0xc3,0x93,
+    0x3f,0xd1,0xab,0x5c,0xce,0x88,0x7e,0x6d,0xd4,0x5f,
+    0xbb,0x9b,0x9b,0x45,0xf3,0xfd,0x3b,0xfe,0x6b,0xfa,
+    0xff,0xd7,0xc3,0x68,0xc8,0x87,0x36,0x75,0x41,0x07,
+    0xb5,0xd4,0x1e,0x1e,0x5c,0x41,0x23,0x90,0xf1,0xba,
+    0x20,0x24,0x14,0x2d,0x03,0xe0,0x02,0x83,0x14,0x22,
+    0x80,0x31,0x81,0x4b,0x13,0xad,0x6f,0x63,0x97,0x93,
+    0xa7,0xad,0xe8,0x02,0x40,0xc8,0x52,0xc2,0x6c,0x01,
+    0x1c,0x19,0x8f,0x00,0xa8,0x75,0x17,0x23,0x29,0xa5,
+    0x4e,0x47,0x24,0x9c,0x12,0x49,0xac,0x53,0x12,0x10,
+    0x28,0x20,0x1d,0x4c,0x91,0x5b,0x52,0x0d,0xe0,0x8a,
+    0x4d,0x50,0xcd,0xac,0x76,0x6c,0x5c,0x53,0x39,0xad,
+    0x09,0xec,0xd6,0x71,0x6d,0xe1,0xa9,0x30,0x02,0x1a,
+    0x82,0x2d,0x64,0x11,0x62,0xd2,0x35,0x8c,0xb3,0x78,
+    0xa9,0xb0,0x01,0xa4,0xc8,0xbc,0xa6,0xf8,0x91,0x59,
+    0x1d,0x7c,0x45,0x9c,0xcb,0xd6,0x75,0x3e,0x6a,0x80,
+    0xb9,0xe0,0xb7,0xf3,0x1a,0xbb,0x98,0xb8,0x41,0x39,
+    0x08,0x8a,0xb5,0x95,0xa4,0xa9,0x11,0xac,0xb8,0x5b,
+    0x73,0x4e,0x0a,0x1e,0x42,0x2b,0x79,0x9e,0xde,0xbd,
+    0xf1,0xa4,0x01,0xc0,0x64,0x3d,0x69,0x08,0x48,0x43,
+    0x56,0xa4,0x6d,0x5a,0x0e,0x90,0x54,0xa8,0x63,0x38,
+    0x74,0x92,0x1a,0x48,0xcc,0xc0,0x98,0x53,0xc8,0x8a,
+    0x65,0x31,0x93,0x08,0x40,0xb3,0x82,0x11,0xd9,0x0b,
+    0xe9,0xb4,0xe5,0x0d,0x9b,0x30,0x8e,0x80,0x1b,0xe4,
+    0x0c,0x04,0x50,0x40,0x01,0xb8,0x6f,0x51,0x0c,0x64,
+    0xb4,0xf3,0x83,0x27,0x34,0x18,0x24,0x1b,0xcd,0xe5,
+    0xa9,0x1d,0x63,0x0a,0x27,0x80,0xbe,0x23,0xb9,0x82,
+    0x4c,0xa4,0x2d,0x56,0x02,0x31,0x8b,0x96,0x66,0x73,
+    0xe0,0xa5,0x96,0xe2,0x87,0x9b,0xc3,0x11,0x9a,0xa5,
+    0x0a,0x25,0xc1,0x2c,0xf1,0xb9,0x95,0x7c,0xab,0x25,
+    0xd2,0x8f,0x8a,0xcb,0x99,0x5d,0xca,0x16,0x57,0xc9,
+    0x54,0x54,0x04,0x9f,0xd1,0xea,0x08,0x25,0xfb,0x29,
+    0x0d,0x80,0x43,0xd4,0x15,0x9a,0xd4,0x65,0x97,0x6b,
+    0xf6,0x80,0x92,0x2d,0x99,0xa5,0xe0,0xe1,0x3d,0x07,
+    0x49,0x3a,0xed,0x39,0x9c,0x7d,0x2e,0x47,0x9a,0x21,
+    0x6f,0x11,0x4b,0x81,0x72,0x8e,0x58,0xb1,0x40,0xd4,
+    0x94,0xad,0xb8,0x5a,0xf9,0xe2,0x82,0x9b,0x22,0x14,
+    0x36,0xa1,0x95,0xa3,0xa4,0x80,0x64,0x2f,0xd2,0x68,
+    0xca,0x5d,0x18,0x64,0xd8,0xa1,0xcc,0x4b,0xeb,0x40,
+    0x38,0xb6,0x72,0x9a,0xd4,0x08,0xe8,0x07,0x23,0x49,
+    0x0e,0x0a,0x28,0x58,0x23,0xf9,0x77,0x33,0xc4,0x73,
+    0xe3,0x04,0x63,0xe2,0x4d,0x56,0xa4,0x92,0x1a,0x55,
+    0xad,0x52,0xb9,0x11,0x86,0xb8,0xe4,0x4e,0x90,0x54,
+    0xb9,0x98,0x6a,0x97,0x10,0x39,0x1b,0xa6,0xc4,0x9d,
+    0x65,0x15,0xe5,0xc3,0x42,0x96,0xd9,0x98,0xb2,0x98,
+    0x22,0x58,0x6b,0x66,0x4d,0xe7,0xf2,0x34,0xca,0x96,
+    0xe7,0xc2,0xdf,0xae,0xa1,0x1c,0x49,0x0a,0xc4,0x4c,
+    0x07,0xb4,0xa0,0x91,0x83,0xf6,0x15,0x4a,0xd7,0x11,
+    0x72,0xb0,0xcc,0xd9,0xca,0x2d,0x47,0x49,0x87,0x99,
+    0x5b,0xaf,0x85,0x77,0x8f,0xd6,0xe1,0x01,0x46,0x53,
+    0x19,0x81,0xc9,0x70,0x8b,0x14,0x1f,0x55,0xc4,0xca,
+    0xa8,0x43,0xec,0x54,0x2e,0xfa,0x60,0x79,0x7a,0xf5,
+    0x09,0x93,0x96,0x8a,0x6a,0x5a,0x2e,0xb1,0x92,0x63,
+    0x5b,0xc0,0x92,0xbb,0x21,0x16,0x34,0xf2,0xfc,0x29,
+    0x80,0x5b,0xc8,0x88,0x09,0xf9,0x3c,0x11,0x8d,0x62,
+    0x9b,0x07,0x5a,0x14,0xc7,0x32,0xde,0xc8,0x1b,0x91,
+    0x92,0xf9,0x46,0x34,0x84,0xf1,0x92,0xeb,0x64,0x6b,
+    0x3c,0x23,0x17,0xd1,0x4e,0xc1,0xf2,0xc1,0x9c,0x25,
+    0xe2,0x94,0xa4,0xd3,0xc4,0xe3,0xcc,0x9b,0x29,0x87,
+    0x28,0x4b,0x8a,0xd3,0x00,0x9c,0x36,0xcf,0x64,0x9f,
+    0x5b,0x9e,0x81,0x1b,0x3f,0xc2,0xce,0x50,0x6f,0x08,
+    0x28,0x0d,0x88,0x15,0x50,0x67,0x45,0x81,0x22,0xab,
+    0x8a,0x8a,0x2c,0x56,0xd6,0x02,0x46,0x56,0xaf,0x68,
+    0xa8,0x1a,0xc3,0x64,0x69,0x28,0x0e,0x44,0x6e,0x50,
+    0x95,0x47,0xfd,0x72,0xb7,0x6c,0x23,0xe1,0x80,0xc3,
+    0x72,0xcb,0x6f,0xea,0xc4,0x83,0x29,0x18,0x6d,0x94,
+    0x88,0xd8,0x30,0x67,0x20,0x60,0x14,0x89,0x0a,0xe5,
+    0x51,0xd5,0x0a,0x9a,0xc2,0x0a,0x25,0x64,0xf2,0x52,
+    0xf4,0xaa,0x39,0xfd,0xcc,0x24,0x9a,0x7c,0x7e,0x45,
+    0xb2,0xf3,0x2b,0x52,0xcc,0x72,0x6b,0x89,0x15,0xcd,
+    0xae,0x48,0x31,0xcb,0x6d,0x87,0xef,0x21,0xa4,0x77,
+    0xba,0x23,0xc1,0xe6,0xfc,0x8e,0x14,0xe6,0x77,0xa4,
+    0xaa,0x54,0xc0,0xec,0x86,0x54,0x5d,0x15,0x9d,0xd9,
+    0x05,0xe9,0xc4,0xf1,0xe9,0x98,0x2e,0xfa,0x0d,0x2e,
+    0xaf,0x74,0x1b,0x7d,0xfd,0xe2,0x3f,0x8b,0xe8,0x63,
+    0x02
 };
 
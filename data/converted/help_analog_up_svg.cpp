@@ -1,294 +1,123 @@
-//this file was auto-generated from "analog_up.svg" by res2h
+//this file was auto-generated from "analog_up.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_analog_up_svg_size = 2853;
-const unsigned char help_analog_up_svg_data[2853] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x55,0x54,0x46,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x73,
-    0x76,0x67,0x20,0x50,0x55,0x42,0x4c,0x49,0x43,0x20,
-    0x22,0x2d,0x2f,0x2f,0x57,0x33,0x43,0x2f,0x2f,0x44,
-    0x54,0x44,0x20,0x53,0x56,0x47,0x20,0x31,0x2e,0x31,
-    0x2f,0x2f,0x45,0x4e,0x22,0x20,0x22,0x68,0x74,0x74,
-    0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,
-    0x2e,0x6f,0x72,0x67,0x2f,0x47,0x72,0x61,0x70,0x68,
-    0x69,0x63,0x73,0x2f,0x53,0x56,0x47,0x2f,0x31,0x2e,
-    0x31,0x2f,0x44,0x54,0x44,0x2f,0x73,0x76,0x67,0x31,
-    0x31,0x2e,0x64,0x74,0x64,0x22,0x3e,0x0a,0x3c,0x73,
-    0x76,0x67,0x20,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,
-    0x3d,0x22,0x31,0x2e,0x31,0x22,0x20,0x78,0x6d,0x6c,
-    0x6e,0x73,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,
-    0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,
-    0x67,0x2f,0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,
-    0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,
-    0x69,0x6e,0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,
-    0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,
-    0x72,0x67,0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,
-    0x69,0x6e,0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,
-    0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,
-    0x33,0x37,0x2e,0x30,0x36,0x31,0x22,0x20,0x76,0x69,
-    0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x2c,0x20,
-    0x30,0x2c,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,
-    0x20,0x33,0x37,0x2e,0x30,0x36,0x31,0x22,0x3e,0x0a,
-    0x20,0x20,0x3c,0x67,0x20,0x69,0x64,0x3d,0x22,0x45,
-    0x62,0x65,0x6e,0x65,0x5f,0x31,0x22,0x3e,0x0a,0x20,
-    0x20,0x20,0x20,0x3c,0x67,0x3e,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,
-    0x3d,0x22,0x4d,0x31,0x34,0x2e,0x38,0x36,0x32,0x2c,
-    0x31,0x38,0x2e,0x35,0x36,0x37,0x20,0x43,0x31,0x34,
-    0x2e,0x38,0x36,0x32,0x2c,0x31,0x36,0x2e,0x35,0x35,
-    0x34,0x20,0x31,0x36,0x2e,0x35,0x30,0x31,0x2c,0x31,
-    0x34,0x2e,0x39,0x31,0x38,0x20,0x31,0x38,0x2e,0x35,
-    0x31,0x33,0x2c,0x31,0x34,0x2e,0x39,0x31,0x38,0x20,
-    0x43,0x32,0x30,0x2e,0x35,0x32,0x35,0x2c,0x31,0x34,
-    0x2e,0x39,0x31,0x38,0x20,0x32,0x32,0x2e,0x31,0x36,
-    0x33,0x2c,0x31,0x36,0x2e,0x35,0x35,0x36,0x20,0x32,
-    0x32,0x2e,0x31,0x36,0x33,0x2c,0x31,0x38,0x2e,0x35,
-    0x36,0x37,0x20,0x43,0x32,0x32,0x2e,0x31,0x36,0x33,
-    0x2c,0x32,0x30,0x2e,0x35,0x38,0x20,0x32,0x30,0x2e,
-    0x35,0x32,0x34,0x2c,0x32,0x32,0x2e,0x32,0x31,0x37,
-    0x20,0x31,0x38,0x2e,0x35,0x31,0x33,0x2c,0x32,0x32,
-    0x2e,0x32,0x31,0x37,0x20,0x43,0x31,0x36,0x2e,0x35,
-    0x2c,0x32,0x32,0x2e,0x32,0x31,0x38,0x20,0x31,0x34,
-    0x2e,0x38,0x36,0x32,0x2c,0x32,0x30,0x2e,0x35,0x38,
-    0x20,0x31,0x34,0x2e,0x38,0x36,0x32,0x2c,0x31,0x38,
-    0x2e,0x35,0x36,0x37,0x20,0x7a,0x20,0x4d,0x32,0x30,
-    0x2e,0x36,0x36,0x34,0x2c,0x31,0x38,0x2e,0x35,0x36,
-    0x37,0x20,0x43,0x32,0x30,0x2e,0x36,0x36,0x34,0x2c,
-    0x31,0x37,0x2e,0x33,0x38,0x31,0x20,0x31,0x39,0x2e,
-    0x36,0x39,0x39,0x2c,0x31,0x36,0x2e,0x34,0x31,0x38,
-    0x20,0x31,0x38,0x2e,0x35,0x31,0x34,0x2c,0x31,0x36,
-    0x2e,0x34,0x31,0x38,0x20,0x43,0x31,0x37,0x2e,0x33,
-    0x32,0x39,0x2c,0x31,0x36,0x2e,0x34,0x31,0x38,0x20,
-    0x31,0x36,0x2e,0x33,0x36,0x33,0x2c,0x31,0x37,0x2e,
-    0x33,0x38,0x33,0x20,0x31,0x36,0x2e,0x33,0x36,0x33,
-    0x2c,0x31,0x38,0x2e,0x35,0x36,0x37,0x20,0x43,0x31,
-    0x36,0x2e,0x33,0x36,0x33,0x2c,0x31,0x39,0x2e,0x37,
-    0x35,0x33,0x20,0x31,0x37,0x2e,0x33,0x32,0x39,0x2c,
-    0x32,0x30,0x2e,0x37,0x31,0x37,0x20,0x31,0x38,0x2e,
-    0x35,0x31,0x34,0x2c,0x32,0x30,0x2e,0x37,0x31,0x37,
-    0x20,0x43,0x31,0x39,0x2e,0x36,0x39,0x39,0x2c,0x32,
-    0x30,0x2e,0x37,0x31,0x38,0x20,0x32,0x30,0x2e,0x36,
-    0x36,0x34,0x2c,0x31,0x39,0x2e,0x37,0x35,0x33,0x20,
-    0x32,0x30,0x2e,0x36,0x36,0x34,0x2c,0x31,0x38,0x2e,
-    0x35,0x36,0x37,0x20,0x7a,0x22,0x20,0x66,0x69,0x6c,
-    0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,
-    0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,
-    0x32,0x38,0x2e,0x34,0x32,0x37,0x2c,0x32,0x31,0x2e,
-    0x35,0x37,0x32,0x20,0x4c,0x32,0x38,0x2e,0x34,0x32,
-    0x37,0x2c,0x31,0x35,0x2e,0x35,0x36,0x20,0x43,0x32,
-    0x38,0x2e,0x34,0x32,0x37,0x2c,0x31,0x35,0x2e,0x32,
-    0x38,0x37,0x20,0x32,0x38,0x2e,0x35,0x37,0x37,0x2c,
-    0x31,0x35,0x2e,0x30,0x33,0x35,0x20,0x32,0x38,0x2e,
-    0x38,0x31,0x37,0x2c,0x31,0x34,0x2e,0x39,0x30,0x33,
-    0x20,0x43,0x32,0x39,0x2e,0x30,0x35,0x38,0x2c,0x31,
-    0x34,0x2e,0x37,0x37,0x31,0x20,0x32,0x39,0x2e,0x33,
-    0x35,0x31,0x2c,0x31,0x34,0x2e,0x37,0x38,0x32,0x20,
-    0x32,0x39,0x2e,0x35,0x38,0x33,0x2c,0x31,0x34,0x2e,
-    0x39,0x32,0x39,0x20,0x4c,0x33,0x34,0x2e,0x32,0x36,
-    0x37,0x2c,0x31,0x37,0x2e,0x39,0x33,0x34,0x20,0x43,
-    0x33,0x34,0x2e,0x36,0x39,0x38,0x2c,0x31,0x38,0x2e,
-    0x32,0x31,0x20,0x33,0x34,0x2e,0x36,0x39,0x37,0x2c,
-    0x31,0x38,0x2e,0x39,0x32,0x20,0x33,0x34,0x2e,0x32,
-    0x36,0x37,0x2c,0x31,0x39,0x2e,0x31,0x39,0x38,0x20,
-    0x4c,0x32,0x39,0x2e,0x35,0x38,0x33,0x2c,0x32,0x32,
-    0x2e,0x32,0x30,0x33,0x20,0x43,0x32,0x39,0x2e,0x33,
-    0x35,0x32,0x2c,0x32,0x32,0x2e,0x33,0x35,0x20,0x32,
-    0x39,0x2e,0x30,0x35,0x39,0x2c,0x32,0x32,0x2e,0x33,
-    0x36,0x32,0x20,0x32,0x38,0x2e,0x38,0x31,0x37,0x2c,
-    0x32,0x32,0x2e,0x32,0x32,0x39,0x20,0x43,0x32,0x38,
-    0x2e,0x35,0x37,0x37,0x2c,0x32,0x32,0x2e,0x30,0x39,
-    0x39,0x20,0x32,0x38,0x2e,0x34,0x32,0x37,0x2c,0x32,
-    0x31,0x2e,0x38,0x34,0x37,0x20,0x32,0x38,0x2e,0x34,
-    0x32,0x37,0x2c,0x32,0x31,0x2e,0x35,0x37,0x32,0x20,
-    0x7a,0x20,0x4d,0x32,0x39,0x2e,0x39,0x32,0x37,0x2c,
-    0x31,0x36,0x2e,0x39,0x33,0x33,0x20,0x4c,0x32,0x39,
-    0x2e,0x39,0x32,0x37,0x2c,0x32,0x30,0x2e,0x32,0x30,
-    0x31,0x20,0x4c,0x33,0x32,0x2e,0x34,0x37,0x32,0x2c,
-    0x31,0x38,0x2e,0x35,0x36,0x36,0x20,0x4c,0x32,0x39,
-    0x2e,0x39,0x32,0x37,0x2c,0x31,0x36,0x2e,0x39,0x33,
-    0x33,0x20,0x7a,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,
-    0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x2f,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x67,
-    0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,
-    0x31,0x38,0x2e,0x35,0x31,0x33,0x2c,0x33,0x2e,0x31,
-    0x36,0x31,0x20,0x4c,0x31,0x35,0x2e,0x35,0x30,0x39,
-    0x2c,0x37,0x2e,0x38,0x34,0x35,0x20,0x4c,0x32,0x31,
-    0x2e,0x35,0x31,0x39,0x2c,0x37,0x2e,0x38,0x34,0x35,
-    0x20,0x4c,0x31,0x38,0x2e,0x35,0x31,0x33,0x2c,0x33,
-    0x2e,0x31,0x36,0x31,0x20,0x7a,0x22,0x20,0x66,0x69,
-    0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,
-    0x46,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,
-    0x3d,0x22,0x4d,0x31,0x34,0x2e,0x37,0x35,0x39,0x2c,
-    0x37,0x2e,0x38,0x34,0x35,0x20,0x43,0x31,0x34,0x2e,
-    0x37,0x35,0x39,0x2c,0x37,0x2e,0x37,0x30,0x34,0x20,
-    0x31,0x34,0x2e,0x37,0x39,0x39,0x2c,0x37,0x2e,0x35,
-    0x36,0x33,0x20,0x31,0x34,0x2e,0x38,0x37,0x38,0x2c,
-    0x37,0x2e,0x34,0x34,0x20,0x4c,0x31,0x37,0x2e,0x38,
-    0x38,0x31,0x2c,0x32,0x2e,0x37,0x35,0x36,0x20,0x43,
-    0x31,0x38,0x2e,0x30,0x31,0x39,0x2c,0x32,0x2e,0x35,
-    0x34,0x31,0x20,0x31,0x38,0x2e,0x32,0x35,0x37,0x2c,
-    0x32,0x2e,0x34,0x31,0x31,0x20,0x31,0x38,0x2e,0x35,
-    0x31,0x32,0x2c,0x32,0x2e,0x34,0x31,0x31,0x20,0x43,
-    0x31,0x38,0x2e,0x37,0x36,0x37,0x2c,0x32,0x2e,0x34,
-    0x31,0x31,0x20,0x31,0x39,0x2e,0x30,0x30,0x35,0x2c,
-    0x32,0x2e,0x35,0x34,0x31,0x20,0x31,0x39,0x2e,0x31,
-    0x34,0x33,0x2c,0x32,0x2e,0x37,0x35,0x36,0x20,0x4c,
-    0x32,0x32,0x2e,0x31,0x34,0x39,0x2c,0x37,0x2e,0x34,
-    0x34,0x20,0x43,0x32,0x32,0x2e,0x32,0x39,0x37,0x2c,
-    0x37,0x2e,0x36,0x37,0x20,0x32,0x32,0x2e,0x33,0x30,
-    0x37,0x2c,0x37,0x2e,0x39,0x36,0x34,0x20,0x32,0x32,
-    0x2e,0x31,0x37,0x36,0x2c,0x38,0x2e,0x32,0x30,0x36,
-    0x20,0x43,0x32,0x32,0x2e,0x30,0x34,0x35,0x2c,0x38,
-    0x2e,0x34,0x34,0x36,0x20,0x32,0x31,0x2e,0x37,0x39,
-    0x32,0x2c,0x38,0x2e,0x35,0x39,0x36,0x20,0x32,0x31,
-    0x2e,0x35,0x31,0x38,0x2c,0x38,0x2e,0x35,0x39,0x36,
-    0x20,0x4c,0x31,0x35,0x2e,0x35,0x30,0x38,0x2c,0x38,
-    0x2e,0x35,0x39,0x36,0x20,0x43,0x31,0x35,0x2e,0x32,
-    0x33,0x34,0x2c,0x38,0x2e,0x35,0x39,0x36,0x20,0x31,
-    0x34,0x2e,0x39,0x38,0x32,0x2c,0x38,0x2e,0x34,0x34,
-    0x38,0x20,0x31,0x34,0x2e,0x38,0x35,0x2c,0x38,0x2e,
-    0x32,0x30,0x36,0x20,0x43,0x31,0x34,0x2e,0x37,0x38,
-    0x39,0x2c,0x38,0x2e,0x30,0x39,0x32,0x20,0x31,0x34,
-    0x2e,0x37,0x35,0x39,0x2c,0x37,0x2e,0x39,0x36,0x38,
-    0x20,0x31,0x34,0x2e,0x37,0x35,0x39,0x2c,0x37,0x2e,
-    0x38,0x34,0x35,0x20,0x7a,0x20,0x4d,0x31,0x38,0x2e,
-    0x35,0x31,0x33,0x2c,0x34,0x2e,0x35,0x35,0x20,0x4c,
-    0x31,0x36,0x2e,0x38,0x38,0x31,0x2c,0x37,0x2e,0x30,
-    0x39,0x35,0x20,0x4c,0x32,0x30,0x2e,0x31,0x34,0x36,
-    0x2c,0x37,0x2e,0x30,0x39,0x35,0x20,0x4c,0x31,0x38,
-    0x2e,0x35,0x31,0x33,0x2c,0x34,0x2e,0x35,0x35,0x20,
-    0x7a,0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x67,0x3e,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,0x34,0x2e,
-    0x37,0x35,0x39,0x2c,0x32,0x39,0x2e,0x32,0x33,0x31,
-    0x20,0x43,0x31,0x34,0x2e,0x37,0x35,0x39,0x2c,0x32,
-    0x39,0x2e,0x31,0x30,0x37,0x20,0x31,0x34,0x2e,0x37,
-    0x38,0x39,0x2c,0x32,0x38,0x2e,0x39,0x38,0x35,0x20,
-    0x31,0x34,0x2e,0x38,0x35,0x31,0x2c,0x32,0x38,0x2e,
-    0x38,0x37,0x33,0x20,0x43,0x31,0x34,0x2e,0x39,0x38,
-    0x33,0x2c,0x32,0x38,0x2e,0x36,0x33,0x32,0x20,0x31,
-    0x35,0x2e,0x32,0x33,0x35,0x2c,0x32,0x38,0x2e,0x34,
-    0x38,0x31,0x20,0x31,0x35,0x2e,0x35,0x30,0x39,0x2c,
-    0x32,0x38,0x2e,0x34,0x38,0x31,0x20,0x4c,0x32,0x31,
-    0x2e,0x35,0x31,0x39,0x2c,0x32,0x38,0x2e,0x34,0x38,
-    0x31,0x20,0x43,0x32,0x31,0x2e,0x37,0x39,0x33,0x2c,
-    0x32,0x38,0x2e,0x34,0x38,0x31,0x20,0x32,0x32,0x2e,
-    0x30,0x34,0x35,0x2c,0x32,0x38,0x2e,0x36,0x33,0x20,
-    0x32,0x32,0x2e,0x31,0x37,0x37,0x2c,0x32,0x38,0x2e,
-    0x38,0x37,0x33,0x20,0x43,0x32,0x32,0x2e,0x33,0x30,
-    0x38,0x2c,0x32,0x39,0x2e,0x31,0x31,0x32,0x20,0x32,
-    0x32,0x2e,0x33,0x2c,0x32,0x39,0x2e,0x34,0x30,0x36,
-    0x20,0x32,0x32,0x2e,0x31,0x35,0x2c,0x32,0x39,0x2e,
-    0x36,0x33,0x38,0x20,0x4c,0x31,0x39,0x2e,0x31,0x34,
-    0x35,0x2c,0x33,0x34,0x2e,0x33,0x32,0x33,0x20,0x43,
-    0x31,0x39,0x2e,0x30,0x30,0x37,0x2c,0x33,0x34,0x2e,
-    0x35,0x33,0x38,0x20,0x31,0x38,0x2e,0x37,0x36,0x39,
-    0x2c,0x33,0x34,0x2e,0x36,0x36,0x38,0x20,0x31,0x38,
-    0x2e,0x35,0x31,0x34,0x2c,0x33,0x34,0x2e,0x36,0x36,
-    0x38,0x20,0x43,0x31,0x38,0x2e,0x32,0x35,0x39,0x2c,
-    0x33,0x34,0x2e,0x36,0x36,0x38,0x20,0x31,0x38,0x2e,
-    0x30,0x32,0x31,0x2c,0x33,0x34,0x2e,0x35,0x33,0x38,
-    0x20,0x31,0x37,0x2e,0x38,0x38,0x33,0x2c,0x33,0x34,
-    0x2e,0x33,0x32,0x33,0x20,0x4c,0x31,0x34,0x2e,0x38,
-    0x37,0x39,0x2c,0x32,0x39,0x2e,0x36,0x33,0x38,0x20,
-    0x43,0x31,0x34,0x2e,0x37,0x39,0x39,0x2c,0x32,0x39,
-    0x2e,0x35,0x31,0x34,0x20,0x31,0x34,0x2e,0x37,0x35,
-    0x39,0x2c,0x32,0x39,0x2e,0x33,0x37,0x32,0x20,0x31,
-    0x34,0x2e,0x37,0x35,0x39,0x2c,0x32,0x39,0x2e,0x32,
-    0x33,0x31,0x20,0x7a,0x20,0x4d,0x32,0x30,0x2e,0x31,
-    0x34,0x37,0x2c,0x32,0x39,0x2e,0x39,0x38,0x31,0x20,
-    0x4c,0x31,0x36,0x2e,0x38,0x38,0x31,0x2c,0x32,0x39,
-    0x2e,0x39,0x38,0x31,0x20,0x4c,0x31,0x38,0x2e,0x35,
-    0x31,0x34,0x2c,0x33,0x32,0x2e,0x35,0x32,0x37,0x20,
-    0x4c,0x32,0x30,0x2e,0x31,0x34,0x37,0x2c,0x32,0x39,
-    0x2e,0x39,0x38,0x31,0x20,0x7a,0x22,0x20,0x66,0x69,
-    0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,
-    0x46,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,
-    0x4d,0x32,0x2e,0x34,0x31,0x37,0x2c,0x31,0x38,0x2e,
-    0x35,0x36,0x36,0x20,0x4c,0x32,0x2e,0x34,0x31,0x37,
-    0x2c,0x31,0x38,0x2e,0x35,0x36,0x36,0x20,0x43,0x32,
-    0x2e,0x34,0x31,0x37,0x2c,0x31,0x38,0x2e,0x33,0x31,
-    0x31,0x20,0x32,0x2e,0x35,0x34,0x37,0x2c,0x31,0x38,
-    0x2e,0x30,0x37,0x34,0x20,0x32,0x2e,0x37,0x36,0x32,
-    0x2c,0x31,0x37,0x2e,0x39,0x33,0x35,0x20,0x4c,0x37,
-    0x2e,0x34,0x34,0x36,0x2c,0x31,0x34,0x2e,0x39,0x33,
-    0x20,0x43,0x37,0x2e,0x36,0x37,0x37,0x2c,0x31,0x34,
-    0x2e,0x37,0x38,0x33,0x20,0x37,0x2e,0x39,0x37,0x2c,
-    0x31,0x34,0x2e,0x37,0x37,0x32,0x20,0x38,0x2e,0x32,
-    0x31,0x32,0x2c,0x31,0x34,0x2e,0x39,0x30,0x34,0x20,
-    0x43,0x38,0x2e,0x34,0x35,0x34,0x2c,0x31,0x35,0x2e,
-    0x30,0x33,0x36,0x20,0x38,0x2e,0x36,0x30,0x33,0x2c,
-    0x31,0x35,0x2e,0x32,0x38,0x38,0x20,0x38,0x2e,0x36,
-    0x30,0x33,0x2c,0x31,0x35,0x2e,0x35,0x36,0x31,0x20,
-    0x4c,0x38,0x2e,0x36,0x30,0x33,0x2c,0x32,0x31,0x2e,
-    0x35,0x37,0x33,0x20,0x43,0x38,0x2e,0x36,0x30,0x33,
-    0x2c,0x32,0x31,0x2e,0x38,0x34,0x36,0x20,0x38,0x2e,
-    0x34,0x35,0x35,0x2c,0x32,0x32,0x2e,0x30,0x39,0x38,
-    0x20,0x38,0x2e,0x32,0x31,0x32,0x2c,0x32,0x32,0x2e,
-    0x32,0x33,0x20,0x43,0x37,0x2e,0x39,0x37,0x32,0x2c,
-    0x32,0x32,0x2e,0x33,0x36,0x33,0x20,0x37,0x2e,0x36,
-    0x37,0x39,0x2c,0x32,0x32,0x2e,0x33,0x35,0x31,0x20,
-    0x37,0x2e,0x34,0x34,0x36,0x2c,0x32,0x32,0x2e,0x32,
-    0x30,0x34,0x20,0x4c,0x32,0x2e,0x37,0x36,0x32,0x2c,
-    0x31,0x39,0x2e,0x31,0x39,0x39,0x20,0x43,0x32,0x2e,
-    0x35,0x34,0x37,0x2c,0x31,0x39,0x2e,0x30,0x35,0x39,
-    0x20,0x32,0x2e,0x34,0x31,0x37,0x2c,0x31,0x38,0x2e,
-    0x38,0x32,0x32,0x20,0x32,0x2e,0x34,0x31,0x37,0x2c,
-    0x31,0x38,0x2e,0x35,0x36,0x36,0x20,0x7a,0x20,0x4d,
-    0x37,0x2e,0x31,0x30,0x31,0x2c,0x31,0x36,0x2e,0x39,
-    0x33,0x33,0x20,0x4c,0x34,0x2e,0x35,0x35,0x36,0x2c,
-    0x31,0x38,0x2e,0x35,0x36,0x36,0x20,0x4c,0x37,0x2e,
-    0x31,0x30,0x31,0x2c,0x32,0x30,0x2e,0x32,0x30,0x31,
-    0x20,0x4c,0x37,0x2e,0x31,0x30,0x31,0x2c,0x31,0x36,
-    0x2e,0x39,0x33,0x33,0x20,0x7a,0x22,0x20,0x66,0x69,
-    0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,
-    0x46,0x22,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,
-    0x2f,0x67,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,0x38,
-    0x2e,0x35,0x33,0x2c,0x30,0x20,0x43,0x32,0x38,0x2e,
-    0x37,0x36,0x35,0x2c,0x30,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x2c,0x38,0x2e,0x32,0x39,0x36,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x2c,0x31,0x38,0x2e,0x35,
-    0x33,0x31,0x20,0x43,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x2c,0x32,0x38,0x2e,0x37,0x36,0x35,0x20,0x32,0x38,
-    0x2e,0x37,0x36,0x35,0x2c,0x33,0x37,0x2e,0x30,0x36,
-    0x31,0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x37,
-    0x2e,0x30,0x36,0x31,0x20,0x43,0x38,0x2e,0x32,0x39,
-    0x36,0x2c,0x33,0x37,0x2e,0x30,0x36,0x31,0x20,0x30,
-    0x2c,0x32,0x38,0x2e,0x37,0x36,0x35,0x20,0x30,0x2c,
-    0x31,0x38,0x2e,0x35,0x33,0x31,0x20,0x43,0x30,0x2c,
-    0x38,0x2e,0x32,0x39,0x36,0x20,0x38,0x2e,0x32,0x39,
-    0x36,0x2c,0x30,0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,
-    0x30,0x20,0x7a,0x20,0x4d,0x31,0x38,0x2e,0x35,0x33,
-    0x2c,0x31,0x20,0x43,0x38,0x2e,0x38,0x34,0x39,0x2c,
-    0x31,0x20,0x31,0x2c,0x38,0x2e,0x38,0x34,0x39,0x20,
-    0x31,0x2c,0x31,0x38,0x2e,0x35,0x33,0x31,0x20,0x43,
-    0x31,0x2c,0x32,0x38,0x2e,0x32,0x31,0x32,0x20,0x38,
-    0x2e,0x38,0x34,0x39,0x2c,0x33,0x36,0x2e,0x30,0x36,
-    0x31,0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x36,
-    0x2e,0x30,0x36,0x31,0x20,0x43,0x32,0x38,0x2e,0x32,
-    0x31,0x32,0x2c,0x33,0x36,0x2e,0x30,0x36,0x31,0x20,
-    0x33,0x36,0x2e,0x30,0x36,0x31,0x2c,0x32,0x38,0x2e,
-    0x32,0x31,0x32,0x20,0x33,0x36,0x2e,0x30,0x36,0x31,
-    0x2c,0x31,0x38,0x2e,0x35,0x33,0x31,0x20,0x43,0x33,
-    0x36,0x2e,0x30,0x36,0x31,0x2c,0x38,0x2e,0x38,0x34,
-    0x39,0x20,0x32,0x38,0x2e,0x32,0x31,0x32,0x2c,0x31,
-    0x20,0x31,0x38,0x2e,0x35,0x33,0x2c,0x31,0x20,0x7a,
-    0x22,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,
-    0x46,0x46,0x46,0x46,0x46,0x22,0x2f,0x3e,0x0a,0x20,
-    0x20,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x73,0x76,
-    0x67,0x3e,0x0a
+const size_t help_analog_up_svg_size = 1149;
+const unsigned char help_analog_up_svg_data[1149] = {
+    0x45,0x53,0x5a,0x31,0x25,0x0b,0x00,0x00,0x78,0xda,
+    0x8d,0x96,0x5b,0x4f,0x1b,0x47,0x14,0xc7,0xdf,0xf3,
+    0x29,0xa6,0xdb,0xd7,0xcd,0xec,0xdc,0x2f,0x11,0x4e,
+    0xa4,0x2c,0x24,0xaa,0x44,0xda,0x48,0x25,0xad,0xfa,
+    0x54,0xa5,0xc1,0xc5,0x56,0xa9,0x41,0x60,0xe1,0x24,
+    0x9f,0xbe,0xff,0x73,0xe6,0x62,0xbb,0x85,0xa8,0x08,
+    0xe1,0xfd,0xed,0x9c,0xdb,0x9c,0x1b,0x3e,0x79,0xf5,
+    0xf9,0xef,0x6b,0xf1,0xb0,0xbc,0xbb,0x5f,0xdf,0x6c,
+    0x16,0x83,0x96,0x6a,0x10,0xcb,0xcd,0xa7,0x9b,0xcb,
+    0xf5,0xe6,0x6a,0x31,0x7c,0xb8,0x78,0xf3,0x3c,0x0d,
+    0xaf,0x5e,0x3e,0x3b,0xf9,0xee,0xf4,0xa7,0xf9,0xe2,
+    0xb7,0xf7,0x67,0xe2,0xfe,0xe1,0x4a,0xbc,0xff,0xf0,
+    0xfa,0xfc,0x87,0x59,0x0c,0xcf,0xa7,0xe9,0x57,0x3b,
+    0x4f,0xd3,0xe9,0xc5,0xa9,0xf8,0xf9,0x97,0xb7,0x42,
+    0x4b,0x3d,0x4d,0x67,0x3f,0x0e,0x62,0x58,0x6d,0xb7,
+    0xb7,0x2f,0xa6,0x69,0xb7,0xdb,0xc9,0x9d,0x95,0x37,
+    0x77,0x57,0xd3,0xdb,0xbb,0x8f,0xb7,0xab,0xf5,0xa7,
+    0xfb,0x09,0x82,0x13,0x09,0x42,0x69,0x82,0x31,0xad,
+    0xe5,0xe5,0xf6,0x72,0x80,0x0b,0xb2,0x7c,0x10,0x88,
+    0x1e,0x04,0x42,0xdb,0xdc,0x2f,0x1e,0x31,0x66,0x94,
+    0x52,0xa4,0x5c,0x45,0x5e,0x7c,0xbe,0x5e,0x6f,0xfe,
+    0x7a,0x4c,0x50,0xe7,0x9c,0x27,0x3e,0x85,0xe8,0x62,
+    0xc0,0xe5,0xbe,0xf0,0xdf,0xdd,0xfa,0x72,0xbb,0x5a,
+    0x0c,0x36,0x4a,0x15,0xe0,0x68,0xb5,0x5c,0x5f,0xad,
+    0xb6,0x7b,0x7e,0x58,0x2f,0x77,0xaf,0x6f,0x48,0x61,
+    0x14,0xf8,0x2d,0xaf,0xdb,0x27,0x62,0x15,0xe2,0xe4,
+    0x4a,0xac,0x2f,0x17,0xc3,0xd9,0x1f,0xcb,0xcd,0xf2,
+    0xf7,0xf2,0x8a,0x5e,0x96,0x4f,0x3c,0xdd,0x7e,0xdc,
+    0xae,0x04,0x04,0xde,0x69,0x27,0x53,0x30,0xa3,0x4e,
+    0xd2,0x87,0x28,0xe6,0x86,0x41,0x7a,0xef,0x04,0x7d,
+    0x28,0x3d,0xe2,0x65,0xd6,0x49,0x90,0x8c,0xb6,0x8d,
+    0x66,0xa3,0xa4,0x37,0xbe,0xa1,0x31,0x52,0x07,0x5b,
+    0x14,0x43,0xa7,0x6a,0xb5,0x22,0x69,0x40,0x92,0xf4,
+    0xdc,0x88,0x77,0x46,0xc7,0x66,0xb4,0xd2,0x4c,0xfa,
+    0x05,0xe0,0xaf,0xc4,0x52,0xb4,0x8e,0xe3,0xfc,0x2a,
+    0xde,0xe1,0x75,0x08,0x6e,0xef,0xa2,0x62,0x94,0x36,
+    0x69,0xa1,0xb3,0x0c,0x39,0x53,0x34,0xae,0x05,0xee,
+    0x1a,0xcd,0x24,0x63,0xf6,0x87,0x41,0x5a,0x0a,0x95,
+    0x14,0x6d,0xa7,0x96,0x8e,0x8a,0x59,0x46,0x8f,0xc3,
+    0xa2,0x08,0x57,0xb1,0x45,0xee,0x1a,0xcd,0xd5,0x25,
+    0x23,0x5f,0x92,0xc3,0x29,0x8a,0xc7,0xb1,0x7e,0x1d,
+    0xc4,0x9f,0xeb,0xeb,0xeb,0xc5,0xf0,0xfd,0x1b,0xfe,
+    0x19,0xa6,0xff,0x96,0xc5,0x24,0xe9,0x4c,0x1c,0x8d,
+    0x96,0x3e,0x1a,0x71,0x5e,0x51,0x7b,0x18,0xc0,0x5d,
+    0x3b,0x99,0x14,0x05,0xc8,0x47,0x26,0x65,0x3d,0x51,
+    0xd2,0x91,0xab,0xa2,0x2c,0x44,0xb3,0x54,0x3e,0x11,
+    0xc6,0xa8,0x05,0xc8,0x7a,0xae,0x67,0x4c,0x86,0xc8,
+    0xa7,0x52,0x4f,0x93,0xc5,0xb9,0x75,0xd2,0x84,0x48,
+    0x89,0xc8,0xd6,0x89,0x19,0x18,0x72,0xa2,0x98,0x8d,
+    0x16,0x0c,0x91,0x20,0x1b,0xd1,0x04,0xb3,0xd4,0x39,
+    0x21,0xb6,0x62,0x86,0x8a,0x56,0x3d,0x5a,0x6f,0x08,
+    0x29,0x1a,0x72,0x9f,0x19,0x82,0x69,0xb1,0x91,0x24,
+    0x1c,0xce,0x35,0x70,0xa0,0xca,0x59,0xec,0x6f,0x9c,
+    0x5c,0x14,0xc7,0xf7,0xa7,0x72,0x67,0xb8,0x8e,0x54,
+    0xb4,0x6c,0x2d,0x3b,0x25,0x44,0x62,0x8d,0xd2,0x88,
+    0xdd,0x48,0x17,0x6b,0x77,0x84,0x7e,0x5a,0x85,0xbf,
+    0x91,0xef,0x3e,0x10,0x47,0x23,0x51,0x5a,0xd2,0xa2,
+    0x67,0x61,0x9a,0x72,0xae,0xf2,0x18,0x11,0x96,0x87,
+    0x65,0x04,0xa4,0x3b,0x1d,0x49,0x3e,0xed,0xe6,0x5f,
+    0xf3,0x16,0x7d,0x33,0x30,0x77,0x8a,0xca,0x51,0x8b,
+    0xc7,0x4c,0xe0,0x83,0xe5,0x7e,0x8f,0x09,0xe0,0x1c,
+    0xfc,0x40,0x3c,0xe9,0xd1,0x40,0x18,0xe5,0x87,0x57,
+    0x85,0x18,0x8c,0xf4,0x4e,0x53,0x17,0x1a,0x8f,0x44,
+    0xa0,0x97,0x75,0x69,0x49,0x53,0x81,0xe4,0x62,0xe8,
+    0x47,0xa8,0x84,0xf2,0x4d,0x09,0xa5,0x73,0xb6,0xda,
+    0x3b,0xa7,0xe9,0x74,0xb9,0xb8,0xa2,0x51,0x35,0xa8,
+    0x74,0x94,0x68,0x54,0x2a,0x9b,0xa2,0xe7,0x1c,0x1c,
+    0x8f,0x74,0x0c,0x23,0xdc,0xa9,0xc0,0x62,0xca,0x79,
+    0x90,0x73,0x98,0x76,0x8d,0xc0,0x0d,0xc0,0x67,0x06,
+    0xaf,0x53,0x85,0x92,0xbd,0x46,0x33,0x75,0xac,0x75,
+    0x95,0xa8,0xef,0x92,0x61,0x13,0x65,0xbc,0x7d,0x33,
+    0xce,0xfd,0x99,0x41,0x0a,0xdd,0xd6,0x53,0x94,0x43,
+    0x12,0x47,0xd9,0x43,0x57,0xd4,0x02,0x38,0x2c,0x1d,
+    0xf8,0x0a,0x9c,0x25,0x2c,0xc1,0x4c,0x95,0x52,0xb8,
+    0x55,0x68,0x74,0x28,0xf8,0x8d,0x7e,0x98,0x1e,0xdf,
+    0x90,0xe4,0x13,0x3d,0x65,0xac,0xee,0x25,0x03,0x6a,
+    0x15,0x45,0x0d,0x15,0xed,0x9a,0x93,0x2f,0xb7,0xd0,
+    0x44,0x29,0x5a,0x16,0xcd,0x34,0x19,0x49,0x06,0x8b,
+    0x8b,0xd0,0xe5,0x3d,0x91,0xa3,0x0d,0x55,0xda,0xaa,
+    0x52,0xeb,0xab,0x8a,0x33,0x67,0xd4,0x36,0xac,0xc9,
+    0x66,0x3b,0xa5,0x0e,0xb1,0xfb,0xe0,0x1a,0x25,0x0e,
+    0x47,0x1b,0xae,0x18,0x3d,0x3b,0x55,0x76,0xb0,0x27,
+    0x08,0x16,0x53,0xca,0x25,0xf7,0x23,0x66,0xd7,0x1a,
+    0xcb,0xdb,0x4a,0xa1,0xb4,0x40,0x6f,0x79,0x41,0xc6,
+    0x90,0x89,0x42,0xe8,0xeb,0xb2,0xd2,0xcc,0x1d,0x76,
+    0x78,0xa8,0x8c,0xee,0x8a,0xd4,0x98,0xb6,0x59,0x3d,
+    0xe7,0xa6,0xcd,0xcd,0xe7,0x5c,0x1b,0x9a,0x16,0x84,
+    0x76,0x62,0x9f,0x38,0x1b,0x8d,0x38,0xce,0x6a,0xd9,
+    0xe7,0xda,0x45,0x7a,0x91,0x29,0x21,0xb5,0x98,0x1d,
+    0x6b,0x4c,0xe8,0x5f,0x13,0x6b,0x71,0xbb,0xf0,0xff,
+    0x5a,0xa8,0x98,0x82,0xb8,0x5f,0x10,0x87,0x34,0x77,
+    0xb2,0x18,0x14,0x9a,0x10,0x06,0x15,0xd1,0xf4,0xc8,
+    0x8b,0x29,0x2b,0x11,0x4d,0x44,0x13,0x12,0x78,0x5f,
+    0x22,0x83,0x34,0x21,0xb1,0xac,0x52,0x2b,0x20,0x50,
+    0x9e,0x71,0x33,0x5a,0x98,0xa6,0x2c,0x60,0xcc,0x13,
+    0x2a,0xe8,0x5d,0x59,0xce,0x01,0x47,0x41,0xd9,0xb2,
+    0xb7,0xd3,0x1e,0x3c,0xad,0x99,0x42,0xbc,0xef,0x2c,
+    0x69,0x55,0x4a,0x8e,0xb4,0x9c,0xf7,0x65,0x4d,0xa6,
+    0x6a,0x9d,0xa6,0x94,0x63,0xc8,0xb1,0xac,0xda,0x40,
+    0x31,0x84,0x58,0x56,0xad,0xd7,0xa2,0x84,0xca,0x3b,
+    0xd9,0xd1,0x75,0xf9,0x1a,0xb4,0xb0,0x69,0xef,0x96,
+    0x1b,0xf2,0x6a,0x16,0xfd,0xee,0xc9,0x18,0x71,0x94,
+    0x16,0xd4,0x24,0xa2,0xc7,0x75,0xdf,0xb9,0x34,0x3c,
+    0xa1,0xa7,0xb0,0x9c,0xb5,0x05,0x7c,0x24,0xf9,0x54,
+    0x3d,0xfa,0x78,0x1d,0xef,0x5a,0x3b,0x2a,0xfe,0x67,
+    0x10,0x83,0xc7,0x53,0xfd,0x32,0x83,0x7b,0x62,0x47,
+    0x54,0x60,0x29,0x8c,0x45,0xc5,0x22,0x2b,0xaa,0x4a,
+    0x79,0x29,0x8a,0xa5,0x0a,0x33,0xab,0x37,0x52,0x4d,
+    0x43,0x75,0x4b,0xaa,0x3a,0x28,0x72,0x4a,0xb4,0x38,
+    0xea,0x4e,0x41,0x5d,0xc8,0x46,0xc2,0x5a,0x84,0xe5,
+    0x91,0x9f,0xc4,0x3e,0x0e,0x0e,0x01,0x75,0x10,0x45,
+    0xc4,0x86,0xc3,0x08,0x0a,0xcc,0x45,0xa2,0x61,0xf9,
+    0x68,0x6a,0x95,0xfa,0xb5,0x42,0xbd,0x32,0x79,0xa9,
+    0x7a,0xcd,0xdc,0x53,0xdd,0xcd,0xb9,0x3c,0xa1,0x2f,
+    0x99,0x2f,0x9f,0xfd,0x03,0x23,0xbf,0x59,0x51
 };
 
@@ -1,105 +1,66 @@
-//this file was auto-generated from "button_a.svg" by res2h
+//this file was auto-generated from "button_a.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_button_a_svg_size = 965;
-const unsigned char help_button_a_svg_data[965] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x33,0x30,
-    0x5f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,
-    0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,
-    0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,
-    0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,
-    0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,0x3d,
-    0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-    0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,
-    0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,0x6b,0x22,
-    0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,0x20,0x79,
-    0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,0x20,0x77,
-    0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x2d,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3d,
-    0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,
-    0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,
-    0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,0x3e,0x0a,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,
-    0x22,0x4d,0x31,0x38,0x2e,0x39,0x31,0x34,0x2c,0x31,
-    0x34,0x2e,0x35,0x37,0x39,0x6c,0x2d,0x31,0x2e,0x36,
-    0x38,0x32,0x2c,0x35,0x2e,0x33,0x30,0x38,0x68,0x33,
-    0x2e,0x34,0x30,0x35,0x6c,0x2d,0x31,0x2e,0x36,0x37,
-    0x2d,0x35,0x2e,0x33,0x30,0x38,0x48,0x31,0x38,0x2e,
-    0x39,0x31,0x34,0x7a,0x20,0x4d,0x31,0x38,0x2e,0x35,
-    0x33,0x31,0x2c,0x33,0x2e,0x30,0x32,0x39,0x63,0x2d,
-    0x38,0x2e,0x35,0x36,0x32,0x2c,0x30,0x2d,0x31,0x35,
-    0x2e,0x35,0x30,0x31,0x2c,0x36,0x2e,0x39,0x34,0x2d,
-    0x31,0x35,0x2e,0x35,0x30,0x31,0x2c,0x31,0x35,0x2e,
-    0x35,0x0a,0x09,0x09,0x09,0x63,0x30,0x2c,0x38,0x2e,
-    0x35,0x36,0x33,0x2c,0x36,0x2e,0x39,0x33,0x39,0x2c,
-    0x31,0x35,0x2e,0x35,0x30,0x32,0x2c,0x31,0x35,0x2e,
-    0x35,0x30,0x31,0x2c,0x31,0x35,0x2e,0x35,0x30,0x32,
-    0x53,0x33,0x34,0x2e,0x30,0x33,0x2c,0x32,0x37,0x2e,
-    0x30,0x39,0x31,0x2c,0x33,0x34,0x2e,0x30,0x33,0x2c,
-    0x31,0x38,0x2e,0x35,0x32,0x39,0x43,0x33,0x34,0x2e,
-    0x30,0x33,0x2c,0x39,0x2e,0x39,0x37,0x2c,0x32,0x37,
-    0x2e,0x30,0x39,0x31,0x2c,0x33,0x2e,0x30,0x32,0x39,
-    0x2c,0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,0x33,0x2e,
-    0x30,0x32,0x39,0x7a,0x20,0x4d,0x32,0x32,0x2e,0x32,
-    0x32,0x37,0x2c,0x32,0x34,0x2e,0x39,0x32,0x35,0x0a,
-    0x09,0x09,0x09,0x6c,0x2d,0x30,0x2e,0x39,0x31,0x39,
-    0x2d,0x32,0x2e,0x39,0x31,0x33,0x68,0x2d,0x34,0x2e,
-    0x37,0x34,0x31,0x6c,0x2d,0x30,0x2e,0x39,0x31,0x38,
-    0x2c,0x32,0x2e,0x39,0x31,0x33,0x68,0x2d,0x32,0x2e,
-    0x37,0x33,0x35,0x6c,0x34,0x2e,0x36,0x34,0x36,0x2d,
-    0x31,0x33,0x2e,0x35,0x30,0x39,0x68,0x32,0x2e,0x37,
-    0x37,0x34,0x6c,0x34,0x2e,0x36,0x32,0x39,0x2c,0x31,
-    0x33,0x2e,0x35,0x30,0x39,0x48,0x32,0x32,0x2e,0x32,
-    0x32,0x37,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,
-    0x67,0x3e,0x0a,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x67,
-    0x20,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3d,0x22,
-    0x30,0x22,0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,
-    0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,
-    0x33,0x36,0x2e,0x39,0x36,0x31,0x2c,0x30,0x2e,0x31,
-    0x76,0x33,0x36,0x2e,0x38,0x36,0x31,0x48,0x30,0x2e,
-    0x31,0x56,0x30,0x2e,0x31,0x48,0x33,0x36,0x2e,0x39,
-    0x36,0x31,0x20,0x4d,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x2c,0x30,0x48,0x30,0x76,0x33,0x37,0x2e,0x30,0x36,
-    0x68,0x33,0x37,0x2e,0x30,0x36,0x31,0x56,0x30,0x4c,
-    0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,0x30,0x7a,0x22,
-    0x2f,0x3e,0x0a,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,
-    0x73,0x76,0x67,0x3e,0x0a
+const size_t help_button_a_svg_size = 577;
+const unsigned char help_button_a_svg_data[577] = {
+    0x45,0x53,0x5a,0x31,0xc5,0x03,0x00,0x00,0x78,0xda,
+    0x75,0x52,0xcb,0x6e,0xdb,0x30,0x10,0x3c,0xdb,0x5f,
+    0xb1,0x65,0x4f,0x05,0xc4,0xb7,0x1e,0xa6,0x11,0x25,
+    0x68,0x9c,0x87,0x03,0x24,0x6d,0x80,0xa4,0x2e,0x7a,
+    0x0a,0x1c,0x4b,0x91,0x84,0xa8,0x92,0x20,0xc9,0x96,
+    0x9b,0xaf,0xef,0x92,0x72,0x0a,0x1f,0x52,0x03,0x26,
+    0x97,0xb3,0xc3,0x99,0xdd,0xa5,0x4e,0xce,0xf6,0xbf,
+    0x4b,0xd8,0xa5,0x6d,0x57,0xd4,0x55,0x4c,0x24,0x13,
+    0x04,0xd2,0x6a,0x53,0x27,0x45,0x95,0xc5,0x64,0xdb,
+    0xbf,0xd0,0x19,0x39,0x3b,0x9d,0x9e,0x7c,0xa2,0x14,
+    0xae,0xd3,0x2a,0x6d,0xd7,0x7d,0xdd,0xce,0xe1,0x6b,
+    0x52,0x3f,0xa7,0x70,0x53,0x96,0xdb,0xae,0x77,0x10,
+    0xc8,0x90,0x09,0xa6,0x3d,0x78,0x58,0x5d,0xc3,0xe5,
+    0xbe,0xa9,0xdb,0x1e,0xee,0xcb,0x6d,0x46,0x6f,0x2a,
+    0x60,0x0e,0x5c,0x8d,0x1e,0x73,0x40,0xa2,0x80,0xf3,
+    0x6d,0x51,0x26,0x20,0xbe,0x00,0x50,0x6a,0xe5,0x2f,
+    0xbe,0x2f,0x1e,0x7f,0xdd,0x5f,0x42,0xb7,0xcb,0xe0,
+    0xfe,0xc7,0xf9,0xed,0xcd,0x02,0x08,0xe5,0xfc,0xa7,
+    0x5e,0x70,0x7e,0xf1,0x78,0xe1,0x14,0x24,0x93,0x9c,
+    0x5f,0x7e,0x23,0x40,0xf2,0xbe,0x6f,0xe6,0x9c,0x0f,
+    0xc3,0xc0,0x06,0xcd,0xea,0x36,0xe3,0xd7,0xed,0xba,
+    0xc9,0x8b,0x4d,0xc7,0x91,0xc8,0x2d,0x11,0x2f,0x71,
+    0x14,0x93,0x92,0x25,0x7d,0x42,0xd0,0xc2,0x2a,0x1f,
+    0xf5,0x29,0x09,0x14,0x49,0x4c,0x9e,0xf6,0x5a,0x3c,
+    0x11,0xc0,0x21,0x54,0x5d,0xfc,0x81,0xae,0x12,0x42,
+    0x58,0x9d,0x03,0x65,0xbe,0x2f,0x8b,0xea,0xf5,0x23,
+    0xa2,0x34,0xc6,0x70,0x97,0x45,0x6a,0x4c,0x44,0xb3,
+    0x27,0xf0,0x67,0xdc,0xa7,0x13,0x18,0x8a,0xa4,0xcf,
+    0x63,0xa2,0x23,0x26,0x42,0x69,0x53,0x79,0x5a,0x64,
+    0x79,0x7f,0x8c,0xec,0x8a,0x74,0x38,0xaf,0xed,0x55,
+    0x10,0x30,0xc2,0x87,0xcd,0xbe,0xc8,0xfa,0xb9,0x4c,
+    0xe9,0xf3,0x7a,0xf3,0x9a,0xb5,0xf5,0xb6,0xc2,0xc2,
+    0xab,0x74,0x80,0x0f,0x98,0x58,0xe5,0xbc,0x6b,0xd6,
+    0x9b,0x34,0x26,0x4d,0x9b,0x76,0x69,0xbb,0x4b,0x6d,
+    0xf3,0xd9,0xe9,0x74,0xe2,0x96,0xc9,0x49,0xb3,0xee,
+    0x73,0x78,0x29,0xca,0x32,0x26,0x9f,0xaf,0xdc,0x8f,
+    0x00,0xea,0xdd,0xc9,0x19,0x33,0xd2,0xf7,0xa4,0xcf,
+    0x82,0xc8,0x94,0x54,0xb2,0x70,0xa6,0xbc,0x80,0x69,
+    0x31,0xcb,0x35,0xf3,0x45,0xe0,0xa0,0x88,0x3a,0x64,
+    0x39,0x92,0xdf,0xc0,0xde,0x0a,0xb4,0xf4,0x34,0x13,
+    0xca,0x6c,0x28,0x1e,0x42,0xe5,0x09,0x2a,0x03,0x16,
+    0x08,0xe9,0x85,0xcc,0xf8,0xef,0xb1,0xdd,0xd0,0x7e,
+    0xb2,0x11,0x9e,0x65,0x69,0x9b,0xd4,0xc6,0xc1,0x42,
+    0x79,0x47,0x24,0xa1,0x1e,0xb4,0xcf,0x84,0xf6,0x14,
+    0xb6,0x64,0x50,0xda,0x1d,0xac,0x8f,0x32,0x8b,0xf1,
+    0x60,0x98,0x89,0xfe,0xa5,0xad,0xb3,0x77,0x5c,0x06,
+    0x56,0xa5,0x14,0x53,0x0a,0x29,0x3e,0x33,0xca,0xb9,
+    0x96,0x54,0x60,0xc1,0x86,0x2a,0x5c,0x75,0x4e,0x7d,
+    0x16,0xf9,0x72,0xc4,0x66,0xde,0x01,0x53,0x2c,0xd2,
+    0x41,0xe9,0xb3,0xd0,0x0f,0xa9,0xd4,0x58,0x87,0xc9,
+    0x11,0x8a,0x7c,0x0b,0x59,0x07,0x07,0x2d,0x47,0xe5,
+    0x37,0xc2,0xed,0x40,0x39,0x4e,0x74,0x5c,0x32,0xa8,
+    0x71,0xe8,0x45,0x6f,0x5f,0x9c,0xd8,0xd4,0xff,0xa6,
+    0xac,0xb1,0xed,0x50,0x7a,0x82,0xc9,0x1d,0x86,0xb3,
+    0x50,0x2e,0x31,0x5c,0xe1,0x7f,0x39,0x66,0xe0,0x6e,
+    0x7c,0x49,0x4f,0x2c,0xc5,0xce,0x85,0xf9,0x08,0xac,
+    0xc4,0xed,0x7b,0xc6,0xb9,0x1f,0xcc,0xf1,0xd3,0x3c,
+    0x9d,0xfe,0x05,0x82,0xe8,0xf7,0xbc
 };
 
@@ -1,157 +1,92 @@
-//this file was auto-generated from "button_b.svg" by res2h
+//this file was auto-generated from "button_b.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_button_b_svg_size = 1483;
-const unsigned char help_button_b_svg_data[1483] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x42,0x22,0x20,0x78,
-    0x6d,0x6c,0x6e,0x73,0x3d,0x22,0x68,0x74,0x74,0x70,
-    0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,
-    0x6f,0x72,0x67,0x2f,0x32,0x30,0x30,0x30,0x2f,0x73,
-    0x76,0x67,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3a,
-    0x78,0x6c,0x69,0x6e,0x6b,0x3d,0x22,0x68,0x74,0x74,
-    0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,0x77,0x33,
-    0x2e,0x6f,0x72,0x67,0x2f,0x31,0x39,0x39,0x39,0x2f,
-    0x78,0x6c,0x69,0x6e,0x6b,0x22,0x20,0x78,0x3d,0x22,
-    0x30,0x70,0x78,0x22,0x20,0x79,0x3d,0x22,0x30,0x70,
-    0x78,0x22,0x0a,0x09,0x20,0x77,0x69,0x64,0x74,0x68,
-    0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,0x70,0x78,
-    0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3d,0x22,
-    0x33,0x37,0x2e,0x30,0x36,0x31,0x70,0x78,0x22,0x20,
-    0x76,0x69,0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,
-    0x20,0x30,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,0x20,
-    0x33,0x37,0x2e,0x30,0x36,0x31,0x22,0x20,0x65,0x6e,
-    0x61,0x62,0x6c,0x65,0x2d,0x62,0x61,0x63,0x6b,0x67,
-    0x72,0x6f,0x75,0x6e,0x64,0x3d,0x22,0x6e,0x65,0x77,
-    0x20,0x30,0x20,0x30,0x20,0x33,0x37,0x2e,0x30,0x36,
-    0x31,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,0x22,0x20,
-    0x78,0x6d,0x6c,0x3a,0x73,0x70,0x61,0x63,0x65,0x3d,
-    0x22,0x70,0x72,0x65,0x73,0x65,0x72,0x76,0x65,0x22,
-    0x3e,0x0a,0x3c,0x67,0x3e,0x0a,0x09,0x3c,0x67,0x3e,
-    0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,
-    0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x31,0x39,
-    0x2e,0x34,0x37,0x2c,0x31,0x38,0x2e,0x39,0x34,0x39,
-    0x68,0x2d,0x32,0x2e,0x36,0x39,0x39,0x76,0x33,0x2e,
-    0x38,0x38,0x37,0x68,0x32,0x2e,0x34,0x39,0x36,0x63,
-    0x30,0x2e,0x37,0x31,0x37,0x2c,0x30,0x2c,0x31,0x2e,
-    0x32,0x36,0x37,0x2d,0x30,0x2e,0x31,0x35,0x34,0x2c,
-    0x31,0x2e,0x36,0x34,0x34,0x2d,0x30,0x2e,0x34,0x36,
-    0x37,0x63,0x30,0x2e,0x33,0x37,0x38,0x2d,0x30,0x2e,
-    0x33,0x31,0x33,0x2c,0x30,0x2e,0x35,0x36,0x33,0x2d,
-    0x30,0x2e,0x37,0x37,0x32,0x2c,0x30,0x2e,0x35,0x36,
-    0x33,0x2d,0x31,0x2e,0x33,0x38,0x35,0x0a,0x09,0x09,
-    0x09,0x63,0x30,0x2d,0x30,0x2e,0x36,0x35,0x39,0x2d,
-    0x30,0x2e,0x31,0x36,0x2d,0x31,0x2e,0x31,0x36,0x35,
-    0x2d,0x30,0x2e,0x34,0x38,0x2d,0x31,0x2e,0x35,0x31,
-    0x33,0x43,0x32,0x30,0x2e,0x36,0x37,0x31,0x2c,0x31,
-    0x39,0x2e,0x31,0x32,0x34,0x2c,0x32,0x30,0x2e,0x31,
-    0x36,0x33,0x2c,0x31,0x38,0x2e,0x39,0x34,0x39,0x2c,
-    0x31,0x39,0x2e,0x34,0x37,0x2c,0x31,0x38,0x2e,0x39,
-    0x34,0x39,0x7a,0x20,0x4d,0x32,0x30,0x2e,0x33,0x38,
-    0x39,0x2c,0x31,0x36,0x2e,0x36,0x33,0x63,0x30,0x2e,
-    0x33,0x39,0x2d,0x30,0x2e,0x32,0x39,0x37,0x2c,0x30,
-    0x2e,0x35,0x38,0x35,0x2d,0x30,0x2e,0x37,0x32,0x39,
-    0x2c,0x30,0x2e,0x35,0x38,0x35,0x2d,0x31,0x2e,0x32,
-    0x39,0x39,0x0a,0x09,0x09,0x09,0x63,0x30,0x2d,0x30,
-    0x2e,0x36,0x32,0x35,0x2d,0x30,0x2e,0x31,0x39,0x37,
-    0x2d,0x31,0x2e,0x30,0x38,0x36,0x2d,0x30,0x2e,0x35,
-    0x39,0x2d,0x31,0x2e,0x33,0x38,0x33,0x73,0x2d,0x30,
-    0x2e,0x39,0x37,0x39,0x2d,0x30,0x2e,0x34,0x34,0x35,
-    0x2d,0x31,0x2e,0x37,0x35,0x38,0x2d,0x30,0x2e,0x34,
-    0x34,0x35,0x68,0x2d,0x31,0x2e,0x38,0x35,0x35,0x76,
-    0x33,0x2e,0x35,0x37,0x32,0x68,0x31,0x2e,0x39,0x34,
-    0x38,0x43,0x31,0x39,0x2e,0x34,0x34,0x32,0x2c,0x31,
-    0x37,0x2e,0x30,0x37,0x35,0x2c,0x31,0x39,0x2e,0x39,
-    0x39,0x39,0x2c,0x31,0x36,0x2e,0x39,0x32,0x37,0x2c,
-    0x32,0x30,0x2e,0x33,0x38,0x39,0x2c,0x31,0x36,0x2e,
-    0x36,0x33,0x7a,0x0a,0x09,0x09,0x09,0x20,0x4d,0x31,
-    0x38,0x2e,0x35,0x33,0x2c,0x33,0x2e,0x30,0x33,0x31,
-    0x63,0x2d,0x38,0x2e,0x35,0x36,0x31,0x2c,0x30,0x2d,
-    0x31,0x35,0x2e,0x35,0x2c,0x36,0x2e,0x39,0x33,0x38,
-    0x2d,0x31,0x35,0x2e,0x35,0x2c,0x31,0x35,0x2e,0x35,
-    0x63,0x30,0x2c,0x38,0x2e,0x35,0x36,0x2c,0x36,0x2e,
-    0x39,0x33,0x39,0x2c,0x31,0x35,0x2e,0x35,0x2c,0x31,
-    0x35,0x2e,0x35,0x2c,0x31,0x35,0x2e,0x35,0x63,0x38,
-    0x2e,0x35,0x36,0x33,0x2c,0x30,0x2c,0x31,0x35,0x2e,
-    0x35,0x2d,0x36,0x2e,0x39,0x33,0x39,0x2c,0x31,0x35,
-    0x2e,0x35,0x2d,0x31,0x35,0x2e,0x35,0x0a,0x09,0x09,
-    0x09,0x43,0x33,0x34,0x2e,0x30,0x33,0x2c,0x39,0x2e,
-    0x39,0x36,0x39,0x2c,0x32,0x37,0x2e,0x30,0x39,0x31,
-    0x2c,0x33,0x2e,0x30,0x33,0x31,0x2c,0x31,0x38,0x2e,
-    0x35,0x33,0x2c,0x33,0x2e,0x30,0x33,0x31,0x7a,0x20,
-    0x4d,0x32,0x32,0x2e,0x38,0x39,0x34,0x2c,0x32,0x33,
-    0x2e,0x39,0x32,0x37,0x63,0x2d,0x30,0x2e,0x38,0x35,
-    0x34,0x2c,0x30,0x2e,0x36,0x36,0x35,0x2d,0x32,0x2e,
-    0x30,0x36,0x33,0x2c,0x30,0x2e,0x39,0x39,0x37,0x2d,
-    0x33,0x2e,0x36,0x32,0x37,0x2c,0x30,0x2e,0x39,0x39,
-    0x37,0x68,0x2d,0x35,0x2e,0x32,0x30,0x35,0x56,0x31,
-    0x31,0x2e,0x34,0x31,0x36,0x68,0x34,0x2e,0x35,0x36,
-    0x34,0x0a,0x09,0x09,0x09,0x63,0x31,0x2e,0x35,0x39,
-    0x2c,0x30,0x2c,0x32,0x2e,0x38,0x33,0x2c,0x30,0x2e,
-    0x33,0x31,0x2c,0x33,0x2e,0x37,0x32,0x31,0x2c,0x30,
-    0x2e,0x39,0x32,0x39,0x63,0x30,0x2e,0x38,0x39,0x31,
-    0x2c,0x30,0x2e,0x36,0x31,0x37,0x2c,0x31,0x2e,0x33,
-    0x33,0x36,0x2c,0x31,0x2e,0x35,0x34,0x33,0x2c,0x31,
-    0x2e,0x33,0x33,0x36,0x2c,0x32,0x2e,0x37,0x37,0x33,
-    0x63,0x30,0x2c,0x30,0x2e,0x36,0x32,0x35,0x2d,0x30,
-    0x2e,0x31,0x36,0x36,0x2c,0x31,0x2e,0x31,0x38,0x34,
-    0x2d,0x30,0x2e,0x34,0x39,0x36,0x2c,0x31,0x2e,0x36,
-    0x37,0x34,0x0a,0x09,0x09,0x09,0x63,0x2d,0x30,0x2e,
-    0x33,0x33,0x32,0x2c,0x30,0x2e,0x34,0x39,0x32,0x2d,
-    0x30,0x2e,0x38,0x31,0x33,0x2c,0x30,0x2e,0x38,0x36,
-    0x2d,0x31,0x2e,0x34,0x34,0x31,0x2c,0x31,0x2e,0x31,
-    0x30,0x38,0x63,0x30,0x2e,0x38,0x31,0x31,0x2c,0x30,
-    0x2e,0x31,0x37,0x34,0x2c,0x31,0x2e,0x34,0x31,0x38,
-    0x2c,0x30,0x2e,0x35,0x34,0x34,0x2c,0x31,0x2e,0x38,
-    0x32,0x31,0x2c,0x31,0x2e,0x31,0x31,0x33,0x63,0x30,
-    0x2e,0x34,0x30,0x35,0x2c,0x30,0x2e,0x35,0x36,0x38,
-    0x2c,0x30,0x2e,0x36,0x30,0x37,0x2c,0x31,0x2e,0x32,
-    0x32,0x39,0x2c,0x30,0x2e,0x36,0x30,0x37,0x2c,0x31,
-    0x2e,0x39,0x37,0x37,0x0a,0x09,0x09,0x09,0x43,0x32,
-    0x34,0x2e,0x31,0x37,0x34,0x2c,0x32,0x32,0x2e,0x32,
-    0x38,0x33,0x2c,0x32,0x33,0x2e,0x37,0x34,0x37,0x2c,
-    0x32,0x33,0x2e,0x32,0x36,0x32,0x2c,0x32,0x32,0x2e,
-    0x38,0x39,0x34,0x2c,0x32,0x33,0x2e,0x39,0x32,0x37,
-    0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,
-    0x0a,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x67,0x20,0x6f,
-    0x70,0x61,0x63,0x69,0x74,0x79,0x3d,0x22,0x30,0x22,
-    0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,
-    0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x33,0x36,
-    0x2e,0x39,0x36,0x31,0x2c,0x30,0x2e,0x31,0x76,0x33,
-    0x36,0x2e,0x38,0x36,0x31,0x48,0x30,0x2e,0x31,0x56,
-    0x30,0x2e,0x31,0x48,0x33,0x36,0x2e,0x39,0x36,0x31,
-    0x20,0x4d,0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,0x30,
-    0x48,0x30,0x76,0x33,0x37,0x2e,0x30,0x36,0x68,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x56,0x30,0x4c,0x33,0x37,
-    0x2e,0x30,0x36,0x31,0x2c,0x30,0x7a,0x22,0x2f,0x3e,
-    0x0a,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x73,0x76,
-    0x67,0x3e,0x0a
+const size_t help_button_b_svg_size = 837;
+const unsigned char help_button_b_svg_data[837] = {
+    0x45,0x53,0x5a,0x31,0xcb,0x05,0x00,0x00,0x78,0xda,
+    0x75,0x54,0xdb,0x6e,0xe3,0x36,0x10,0x7d,0x4e,0xbe,
+    0x82,0x65,0x9f,0x0a,0x50,0x14,0x87,0xa4,0x78,0x31,
+    0xe2,0x2c,0x1a,0x27,0x9b,0x04,0xd8,0xb4,0x01,0xba,
+    0x75,0xd1,0x47,0x47,0xd6,0x5a,0xc2,0xaa,0x92,0x21,
+    0xcb,0x76,0x9a,0xaf,0xef,0x0c,0xe5,0xee,0xba,0x40,
+    0x6a,0xc0,0xd4,0xf1,0xdc,0xce,0xd1,0xcc,0xd0,0x57,
+    0x1f,0x5e,0xff,0x6a,0xd9,0xa1,0x1a,0x76,0x4d,0xdf,
+    0xcd,0x39,0x48,0xc5,0x59,0xd5,0x95,0xfd,0xba,0xe9,
+    0x36,0x73,0xbe,0x1f,0xbf,0x64,0x81,0x7f,0xb8,0xbe,
+    0xbc,0xfa,0x21,0xcb,0xd8,0x7d,0xd5,0x55,0xc3,0x6a,
+    0xec,0x87,0x19,0xfb,0x79,0xdd,0xbf,0x54,0xec,0xb1,
+    0x6d,0xf7,0xbb,0x31,0x99,0x18,0x38,0xa9,0xa4,0x11,
+    0xec,0xb7,0xe5,0x3d,0xbb,0x7b,0xdd,0xf6,0xc3,0xc8,
+    0x9e,0xdb,0xfd,0x26,0x7b,0xec,0x98,0x4c,0xc6,0xe5,
+    0xc4,0x31,0x63,0x18,0xa8,0xd8,0xcd,0xbe,0x69,0xd7,
+    0x4c,0xfd,0xc4,0x58,0x96,0x51,0xf9,0xdb,0x5f,0x17,
+    0x9f,0xff,0x7c,0xbe,0x63,0xbb,0xc3,0x86,0x3d,0xff,
+    0x7e,0xf3,0xe9,0x71,0xc1,0x78,0x96,0xe7,0x7f,0x98,
+    0x45,0x9e,0xdf,0x7e,0xbe,0x4d,0x15,0x40,0x42,0x9e,
+    0xdf,0xfd,0xc2,0x19,0xaf,0xc7,0x71,0x3b,0xcb,0xf3,
+    0xe3,0xf1,0x28,0x8f,0x46,0xf6,0xc3,0x26,0xbf,0x1f,
+    0x56,0xdb,0xba,0x29,0x77,0x39,0x06,0xe6,0x14,0x88,
+    0x49,0x39,0x16,0x03,0x90,0xeb,0x71,0xcd,0x91,0x82,
+    0x2a,0x9f,0xbd,0x27,0x70,0xd6,0xac,0xe7,0xfc,0x86,
+    0x33,0x6c,0x40,0xb7,0x9b,0xbf,0x53,0x53,0x2b,0xa5,
+    0xa8,0xc6,0x29,0x64,0xf6,0xda,0x36,0xdd,0xd7,0xf7,
+    0x02,0x21,0xc6,0x98,0x27,0x2f,0x86,0xce,0xb9,0xda,
+    0xbe,0x72,0xf6,0xf7,0xf4,0xbc,0xbc,0x60,0xc7,0x66,
+    0x3d,0xd6,0x73,0x6e,0xbc,0x54,0x0e,0xc8,0x55,0x57,
+    0xcd,0xa6,0x1e,0xcf,0x2d,0x87,0xa6,0x3a,0xde,0xf4,
+    0x94,0xca,0x14,0x9b,0xcc,0xa7,0x07,0x4d,0x63,0xf5,
+    0xd2,0x56,0xd9,0xcb,0xaa,0xfc,0xba,0x19,0xfa,0x7d,
+    0x87,0xa2,0xbb,0xea,0xc8,0xde,0x89,0x44,0x95,0xb3,
+    0xdd,0x76,0x55,0x56,0x73,0xbe,0x1d,0xaa,0x5d,0x35,
+    0x1c,0x2a,0x7a,0xf1,0xcd,0xf5,0xe5,0x45,0x3a,0x2e,
+    0xae,0xb6,0xab,0xb1,0x66,0x5f,0x9a,0xb6,0x9d,0xf3,
+    0x1f,0x3f,0xa6,0x0f,0x67,0x58,0xef,0x09,0xa2,0xb4,
+    0x5e,0x40,0x90,0xd1,0xc6,0x3a,0xd3,0xd2,0xc5,0x78,
+    0x30,0x32,0x04,0x5f,0x6b,0x69,0xa3,0x2b,0x95,0xf4,
+    0xe0,0x85,0x12,0x20,0xb5,0xf3,0x99,0x92,0x50,0x58,
+    0xc4,0xce,0x5a,0xc4,0xd6,0x79,0xf4,0x1b,0x1f,0x10,
+    0x1b,0x30,0x42,0xc9,0xc2,0x19,0xc4,0xde,0xeb,0x13,
+    0x06,0x69,0x42,0x81,0xf4,0x17,0xa5,0x42,0xbb,0x2b,
+    0x22,0x55,0x70,0x68,0x06,0x57,0x50,0x81,0x80,0xb0,
+    0x00,0xb3,0xd0,0xe8,0xf4,0x20,0x50,0x0c,0x68,0x2b,
+    0x34,0x05,0x99,0x93,0x28,0x71,0xae,0xf0,0x8d,0x3d,
+    0xa1,0xd3,0x04,0xb4,0x3a,0xe9,0x0c,0xb1,0x53,0x49,
+    0x1d,0x3d,0x11,0x06,0xaa,0xe9,0x75,0x3c,0x61,0x94,
+    0x1c,0xe3,0x77,0x72,0x4d,0x5e,0x88,0x1e,0xed,0x2a,
+    0x38,0xc4,0xa8,0x86,0xf4,0x99,0x1d,0xe2,0xe8,0xa9,
+    0x8e,0xb5,0x94,0xe5,0x8b,0x30,0xe1,0x1a,0x7f,0x84,
+    0xa2,0xc0,0x7e,0x14,0x5e,0xd7,0x80,0x02,0xc2,0x82,
+    0xd4,0x58,0x2d,0x00,0x1b,0xef,0x0b,0xd2,0x86,0x0b,
+    0x40,0x62,0xa2,0xf6,0xe2,0x5c,0xda,0x1b,0x11,0xb3,
+    0x27,0x94,0x5d,0x18,0x61,0xa4,0x32,0x50,0x66,0x88,
+    0x1d,0x08,0x95,0x41,0x21,0x0b,0x81,0x29,0x26,0x4c,
+    0x90,0x8e,0x52,0x09,0x72,0x27,0x73,0x14,0xdf,0xcc,
+    0x93,0x8f,0x3c,0x86,0x86,0x80,0x3f,0xb2,0xef,0x11,
+    0x29,0x9b,0x78,0x16,0xc6,0x22,0x83,0x40,0x31,0x2e,
+    0x0a,0x8d,0xd2,0x22,0x4c,0x9c,0xe2,0x8c,0x9f,0x7a,
+    0xa7,0x65,0x88,0xd8,0x5f,0x43,0x72,0x4b,0x7c,0xc9,
+    0x80,0xd3,0xc4,0xd6,0xe0,0x30,0x34,0x2e,0x12,0x4d,
+    0x30,0x62,0x83,0x0c,0x36,0xcb,0x4f,0xb8,0xce,0x0a,
+    0xa9,0x55,0xb1,0xc4,0xcb,0x64,0xc1,0xd5,0x16,0x85,
+    0xd8,0xd4,0x52,0x9c,0x1b,0xf6,0x59,0x60,0x41,0xca,
+    0x32,0xc4,0xe7,0x35,0x50,0x92,0x8e,0x38,0x96,0x10,
+    0x09,0x3b,0x5c,0x1d,0x6c,0xb1,0x71,0x78,0x16,0xd6,
+    0x9c,0xb0,0xc6,0x05,0xc1,0xd1,0x89,0x6f,0x33,0x71,
+    0xe4,0x87,0x90,0x56,0x2a,0x12,0x76,0x7e,0x22,0xa1,
+    0xbd,0x32,0xb4,0x4b,0x36,0x6a,0x52,0x9b,0x76,0x2c,
+    0xd0,0xfe,0x58,0x0b,0x94,0xa3,0x02,0x71,0x01,0x71,
+    0x81,0xa7,0xc5,0xb4,0x10,0x68,0xfa,0x96,0x70,0xd0,
+    0x29,0x06,0x68,0x4d,0xac,0x2a,0xd2,0x4a,0x92,0xd7,
+    0x29,0x52,0xa5,0xd3,0x9e,0x4c,0x38,0x7a,0x9f,0xda,
+    0xa8,0x6d,0x2a,0x83,0x6d,0xd2,0xf8,0x5a,0xd8,0x26,
+    0x8f,0x9b,0x87,0x0f,0xed,0xb4,0xf8,0x4f,0xef,0xde,
+    0x78,0x4e,0x57,0x2b,0xc7,0xbb,0x35,0x1d,0x1b,0xd6,
+    0xe3,0xf5,0x6b,0x46,0xba,0xfb,0x9c,0x5c,0xff,0x77,
+    0xdf,0x0c,0x8e,0xcf,0x25,0xbd,0x07,0x84,0xc1,0xc1,
+    0x03,0xc2,0x25,0x7e,0x1f,0x26,0x0f,0x7b,0x9a,0xee,
+    0xb4,0x50,0x0f,0xea,0x90,0x60,0x3d,0x19,0x96,0xea,
+    0xd3,0xbf,0x9e,0xc4,0x7e,0x22,0xc7,0x3f,0xa9,0xeb,
+    0xcb,0x7f,0x00,0xa0,0x44,0x5b,0xac
 };
 
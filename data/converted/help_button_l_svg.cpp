@@ -1,110 +1,68 @@
-//this file was auto-generated from "button_l.svg" by res2h
+//this file was auto-generated from "button_l.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_button_l_svg_size = 1013;
-const unsigned char help_button_l_svg_data[1013] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x33,0x30,
-    0x5f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,
-    0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,
-    0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,
-    0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,
-    0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,0x3d,
-    0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-    0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,
-    0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,0x6b,0x22,
-    0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,0x20,0x79,
-    0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,0x20,0x77,
-    0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x2d,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3d,
-    0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,
-    0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,
-    0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,0x3e,0x0a,
-    0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,
-    0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,
-    0x22,0x20,0x64,0x3d,0x22,0x4d,0x32,0x39,0x2e,0x32,
-    0x35,0x34,0x2c,0x31,0x31,0x2e,0x35,0x32,0x36,0x63,
-    0x33,0x2e,0x34,0x37,0x38,0x2c,0x30,0x2c,0x36,0x2e,
-    0x33,0x30,0x37,0x2c,0x33,0x2e,0x31,0x34,0x2c,0x36,
-    0x2e,0x33,0x30,0x37,0x2c,0x36,0x2e,0x39,0x39,0x37,
-    0x63,0x30,0x2c,0x33,0x2e,0x38,0x36,0x36,0x2d,0x32,
-    0x2e,0x38,0x32,0x39,0x2c,0x37,0x2e,0x30,0x31,0x31,
-    0x2d,0x36,0x2e,0x33,0x30,0x37,0x2c,0x37,0x2e,0x30,
-    0x31,0x31,0x48,0x37,0x2e,0x37,0x36,0x0a,0x09,0x09,
-    0x63,0x2d,0x33,0x2e,0x34,0x35,0x32,0x2d,0x30,0x2e,
-    0x30,0x33,0x2d,0x36,0x2e,0x32,0x36,0x2d,0x33,0x2e,
-    0x31,0x37,0x37,0x2d,0x36,0x2e,0x32,0x36,0x2d,0x37,
-    0x2e,0x30,0x31,0x31,0x63,0x30,0x2d,0x33,0x2e,0x38,
-    0x32,0x38,0x2c,0x32,0x2e,0x38,0x30,0x38,0x2d,0x36,
-    0x2e,0x39,0x36,0x36,0x2c,0x36,0x2e,0x32,0x34,0x37,
-    0x2d,0x36,0x2e,0x39,0x39,0x37,0x48,0x32,0x39,0x2e,
-    0x32,0x35,0x34,0x20,0x4d,0x32,0x39,0x2e,0x32,0x35,
-    0x34,0x2c,0x31,0x30,0x2e,0x30,0x32,0x36,0x63,0x2d,
-    0x30,0x2e,0x30,0x32,0x31,0x2c,0x30,0x2d,0x32,0x31,
-    0x2e,0x35,0x30,0x37,0x2c,0x30,0x2d,0x32,0x31,0x2e,
-    0x35,0x30,0x37,0x2c,0x30,0x0a,0x09,0x09,0x43,0x33,
-    0x2e,0x34,0x36,0x36,0x2c,0x31,0x30,0x2e,0x30,0x36,
-    0x34,0x2c,0x30,0x2c,0x31,0x33,0x2e,0x38,0x34,0x36,
-    0x2c,0x30,0x2c,0x31,0x38,0x2e,0x35,0x32,0x33,0x63,
-    0x30,0x2c,0x34,0x2e,0x36,0x37,0x38,0x2c,0x33,0x2e,
-    0x34,0x36,0x36,0x2c,0x38,0x2e,0x34,0x37,0x33,0x2c,
-    0x37,0x2e,0x37,0x34,0x37,0x2c,0x38,0x2e,0x35,0x31,
-    0x31,0x63,0x30,0x2c,0x30,0x2c,0x32,0x31,0x2e,0x34,
-    0x38,0x33,0x2c,0x30,0x2c,0x32,0x31,0x2e,0x35,0x30,
-    0x37,0x2c,0x30,0x63,0x34,0x2e,0x33,0x31,0x33,0x2c,
-    0x30,0x2c,0x37,0x2e,0x38,0x30,0x37,0x2d,0x33,0x2e,
-    0x38,0x31,0x32,0x2c,0x37,0x2e,0x38,0x30,0x37,0x2d,
-    0x38,0x2e,0x35,0x31,0x31,0x0a,0x09,0x09,0x53,0x33,
-    0x33,0x2e,0x35,0x36,0x36,0x2c,0x31,0x30,0x2e,0x30,
-    0x32,0x36,0x2c,0x32,0x39,0x2e,0x32,0x35,0x34,0x2c,
-    0x31,0x30,0x2e,0x30,0x32,0x36,0x4c,0x32,0x39,0x2e,
-    0x32,0x35,0x34,0x2c,0x31,0x30,0x2e,0x30,0x32,0x36,
-    0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x67,0x3e,0x0a,
-    0x3c,0x70,0x6f,0x6c,0x79,0x67,0x6f,0x6e,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,
-    0x46,0x46,0x22,0x20,0x70,0x6f,0x69,0x6e,0x74,0x73,
-    0x3d,0x22,0x31,0x35,0x2e,0x39,0x32,0x2c,0x32,0x32,
-    0x2e,0x32,0x31,0x32,0x20,0x32,0x31,0x2e,0x31,0x34,
-    0x31,0x2c,0x32,0x32,0x2e,0x32,0x31,0x32,0x20,0x32,
-    0x31,0x2e,0x31,0x34,0x31,0x2c,0x32,0x30,0x2e,0x38,
-    0x35,0x20,0x31,0x37,0x2e,0x35,0x34,0x33,0x2c,0x32,
-    0x30,0x2e,0x38,0x35,0x20,0x31,0x37,0x2e,0x35,0x34,
-    0x33,0x2c,0x31,0x34,0x2e,0x38,0x33,0x33,0x20,0x31,
-    0x35,0x2e,0x39,0x32,0x2c,0x31,0x34,0x2e,0x38,0x33,
-    0x33,0x20,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x73,0x76,
-    0x67,0x3e,0x0a
+const size_t help_button_l_svg_size = 598;
+const unsigned char help_button_l_svg_data[598] = {
+    0x45,0x53,0x5a,0x31,0xf5,0x03,0x00,0x00,0x78,0xda,
+    0x6d,0x52,0x5d,0x4f,0x9c,0x40,0x14,0x7d,0xde,0xfd,
+    0x15,0xb7,0xd3,0xa7,0x26,0xcc,0x37,0xcc,0xc0,0x66,
+    0xd1,0xd4,0xd5,0xaa,0x89,0x6d,0x4d,0xb4,0x36,0x7d,
+    0x32,0x2b,0x20,0x4b,0xa4,0x40,0x80,0x5d,0xd6,0xfe,
+    0xfa,0xde,0x81,0x4d,0xab,0x46,0x5e,0xe6,0x7e,0x9c,
+    0x39,0xe7,0xdc,0xb9,0x2c,0x8f,0xf7,0xbf,0x4b,0xd8,
+    0x65,0x6d,0x57,0xd4,0x55,0x4c,0x24,0x13,0x04,0xb2,
+    0x2a,0xa9,0xd3,0xa2,0xca,0x63,0xb2,0xed,0x1f,0x69,
+    0x48,0x8e,0x8f,0xe6,0xcb,0x0f,0x94,0xc2,0x79,0x56,
+    0x65,0xed,0xba,0xaf,0xdb,0x05,0x7c,0x4e,0xeb,0x87,
+    0x0c,0x2e,0xcb,0x72,0xdb,0xf5,0x63,0x09,0xa4,0x61,
+    0x82,0x69,0x0f,0x6e,0xee,0xce,0xe1,0x6c,0xdf,0xd4,
+    0x6d,0x0f,0xd7,0xe5,0x36,0xa7,0x97,0x15,0xb0,0xb1,
+    0x78,0x37,0x69,0x2c,0x00,0x81,0x02,0x4e,0xb6,0x45,
+    0x99,0x82,0xf8,0x04,0x40,0xa9,0xa3,0x3f,0xfd,0xbe,
+    0xba,0xfd,0x75,0x7d,0x06,0xdd,0x2e,0x87,0xeb,0x1f,
+    0x27,0x57,0x97,0x2b,0x20,0x94,0xf3,0x9f,0x7a,0xc5,
+    0xf9,0xe9,0xed,0xe9,0xc8,0x20,0x99,0xe4,0xfc,0xec,
+    0x1b,0x01,0xb2,0xe9,0xfb,0x66,0xc1,0xf9,0x30,0x0c,
+    0x6c,0xd0,0xac,0x6e,0x73,0x7e,0xde,0xae,0x9b,0x4d,
+    0x91,0x74,0x1c,0x81,0xdc,0x01,0xf1,0x12,0x47,0x32,
+    0x29,0x59,0xda,0xa7,0x04,0x25,0x1c,0xf3,0x8b,0x39,
+    0x25,0x81,0x22,0x8d,0xc9,0xfd,0x5e,0x8b,0x7b,0x02,
+    0xf8,0x08,0x55,0x17,0xbf,0xc3,0xab,0x84,0x10,0x8e,
+    0xe7,0x00,0x59,0xec,0xcb,0xa2,0x7a,0x7a,0x0f,0x28,
+    0xa3,0x28,0xe2,0x63,0x17,0xa1,0x31,0x11,0xcd,0x9e,
+    0xc0,0xf3,0x74,0xce,0x67,0x30,0x14,0x69,0xbf,0x89,
+    0x89,0xb6,0x4c,0x18,0xe9,0x5a,0x9b,0xac,0xc8,0x37,
+    0xfd,0xcb,0xca,0xae,0xc8,0x86,0x93,0xda,0x5d,0x05,
+    0x01,0x53,0xf9,0x70,0xb8,0x8d,0xac,0x1f,0xca,0x8c,
+    0x3e,0xac,0x93,0xa7,0xbc,0xad,0xb7,0x15,0x1a,0xaf,
+    0xb2,0x01,0xde,0x41,0xa2,0xcb,0x45,0xd7,0xac,0x93,
+    0x2c,0x26,0x4d,0x9b,0x75,0x59,0xbb,0xcb,0xdc,0xf0,
+    0xf9,0xd1,0x7c,0xb6,0x6c,0xd6,0xfd,0x06,0x1e,0x8b,
+    0xb2,0x8c,0xc9,0xc7,0x2f,0xe3,0x47,0x00,0x99,0xbe,
+    0xaa,0x88,0xa9,0xc0,0xf7,0xf0,0xa9,0x02,0x65,0x12,
+    0xcd,0x7c,0x1b,0x7a,0xc2,0x33,0x4c,0x0b,0xeb,0x69,
+    0x26,0xfd,0x43,0x68,0x58,0x14,0xd9,0x44,0x60,0x29,
+    0x34,0x86,0x2a,0x16,0xaa,0xc8,0x43,0x55,0x29,0xe9,
+    0xd4,0x1f,0xe3,0x0b,0xcb,0xac,0x99,0xcf,0x66,0x09,
+    0x45,0x9e,0x40,0x51,0xc1,0x84,0xc6,0xbe,0x32,0x98,
+    0x4b,0x6b,0xa7,0x70,0x44,0x26,0x02,0x4b,0xa1,0x0a,
+    0x3d,0x64,0x12,0x21,0x36,0x22,0x63,0x50,0x43,0xf9,
+    0x0e,0x84,0x4a,0x17,0x93,0x2d,0xf8,0x67,0x0f,0xa9,
+    0xd0,0x9e,0x63,0x54,0xd2,0x13,0x54,0xa1,0x5d,0x54,
+    0xfd,0x1f,0xa0,0xea,0x0a,0x45,0x91,0xc5,0x41,0x8d,
+    0x8f,0x33,0x48,0x54,0xf0,0x8d,0x0b,0x42,0x9c,0x4d,
+    0xa3,0x79,0x9f,0x19,0x9c,0x6e,0x82,0x85,0x38,0xa9,
+    0x46,0xdb,0xd6,0xb7,0x18,0x07,0xce,0x12,0x42,0x91,
+    0xce,0x0f,0xf5,0x14,0x8c,0xbc,0x89,0xcf,0xb4,0x74,
+    0x05,0x8b,0x46,0xad,0x33,0x2d,0xd5,0x21,0x1e,0x6f,
+    0xa1,0xee,0x8d,0xd6,0x2c,0x38,0x08,0x2b,0xe3,0xbd,
+    0x72,0x7c,0xf5,0x2a,0xfb,0x43,0x38,0xae,0x83,0xe3,
+    0x3e,0x96,0x4d,0x5d,0x3e,0xe7,0x75,0xf5,0x76,0x23,
+    0x4d,0x5d,0x54,0x3d,0xfe,0x8b,0x32,0x60,0x91,0xf2,
+    0x94,0x62,0x4a,0x2a,0x40,0x2f,0xd2,0x97,0x6f,0x33,
+    0xc1,0xc2,0x00,0xa4,0x65,0x81,0xaf,0x5f,0x27,0xd2,
+    0x67,0xa1,0xd6,0x30,0x51,0x1c,0x92,0x49,0x18,0x7f,
+    0xe5,0xa3,0xf9,0x5f,0x8e,0x2f,0xfd,0x71
 };
 
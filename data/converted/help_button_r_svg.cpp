@@ -1,140 +1,83 @@
-//this file was auto-generated from "button_r.svg" by res2h
+//this file was auto-generated from "button_r.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_button_r_svg_size = 1315;
-const unsigned char help_button_r_svg_data[1315] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x33,0x30,
-    0x5f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,
-    0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,
-    0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,
-    0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,
-    0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,0x3d,
-    0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-    0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,
-    0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,0x6b,0x22,
-    0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,0x20,0x79,
-    0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,0x20,0x77,
-    0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x2d,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3d,
-    0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,
-    0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,
-    0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x70,0x61,0x74,
-    0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,
-    0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,
-    0x4d,0x31,0x36,0x2e,0x39,0x37,0x33,0x2c,0x31,0x36,
-    0x2e,0x30,0x38,0x36,0x68,0x31,0x2e,0x37,0x37,0x39,
-    0x63,0x30,0x2e,0x37,0x32,0x32,0x2c,0x30,0x2c,0x31,
-    0x2e,0x31,0x31,0x37,0x2c,0x30,0x2e,0x33,0x31,0x32,
-    0x2c,0x31,0x2e,0x31,0x31,0x37,0x2c,0x31,0x2e,0x30,
-    0x32,0x32,0x63,0x30,0x2c,0x30,0x2e,0x37,0x34,0x37,
-    0x2d,0x30,0x2e,0x33,0x39,0x36,0x2c,0x31,0x2e,0x30,
-    0x36,0x2d,0x31,0x2e,0x31,0x31,0x37,0x2c,0x31,0x2e,
-    0x30,0x36,0x68,0x2d,0x31,0x2e,0x37,0x37,0x39,0x56,
-    0x31,0x36,0x2e,0x30,0x38,0x36,0x7a,0x0a,0x09,0x20,
-    0x4d,0x31,0x35,0x2e,0x33,0x35,0x33,0x2c,0x32,0x32,
-    0x2e,0x32,0x31,0x32,0x68,0x31,0x2e,0x36,0x32,0x76,
-    0x2d,0x32,0x2e,0x38,0x38,0x36,0x68,0x31,0x2e,0x36,
-    0x32,0x35,0x63,0x30,0x2e,0x38,0x31,0x36,0x2c,0x30,
-    0x2c,0x31,0x2e,0x31,0x31,0x37,0x2c,0x30,0x2e,0x33,
-    0x34,0x32,0x2c,0x31,0x2e,0x32,0x33,0x2c,0x31,0x2e,
-    0x31,0x31,0x38,0x63,0x30,0x2e,0x30,0x38,0x32,0x2c,
-    0x30,0x2e,0x35,0x38,0x39,0x2c,0x30,0x2e,0x30,0x36,
-    0x31,0x2c,0x31,0x2e,0x33,0x30,0x34,0x2c,0x30,0x2e,
-    0x32,0x35,0x38,0x2c,0x31,0x2e,0x37,0x36,0x39,0x68,
-    0x31,0x2e,0x36,0x32,0x31,0x0a,0x09,0x63,0x2d,0x30,
-    0x2e,0x32,0x38,0x39,0x2d,0x30,0x2e,0x34,0x31,0x34,
-    0x2d,0x30,0x2e,0x32,0x37,0x39,0x2d,0x31,0x2e,0x32,
-    0x38,0x2d,0x30,0x2e,0x33,0x31,0x33,0x2d,0x31,0x2e,
-    0x37,0x34,0x38,0x63,0x2d,0x30,0x2e,0x30,0x35,0x31,
-    0x2d,0x30,0x2e,0x37,0x34,0x34,0x2d,0x30,0x2e,0x32,
-    0x37,0x35,0x2d,0x31,0x2e,0x35,0x32,0x31,0x2d,0x31,
-    0x2e,0x30,0x37,0x2d,0x31,0x2e,0x37,0x32,0x38,0x63,
-    0x30,0x2c,0x30,0x2c,0x31,0x2e,0x31,0x36,0x36,0x2d,
-    0x30,0x2e,0x33,0x30,0x33,0x2c,0x31,0x2e,0x31,0x36,
-    0x36,0x2d,0x31,0x2e,0x38,0x37,0x33,0x0a,0x09,0x63,
-    0x30,0x2d,0x31,0x2e,0x31,0x31,0x38,0x2d,0x30,0x2e,
-    0x38,0x33,0x38,0x2d,0x32,0x2e,0x30,0x33,0x36,0x2d,
-    0x32,0x2e,0x31,0x36,0x2d,0x32,0x2e,0x30,0x33,0x36,
-    0x68,0x2d,0x33,0x2e,0x39,0x37,0x39,0x4c,0x31,0x35,
-    0x2e,0x33,0x35,0x33,0x2c,0x32,0x32,0x2e,0x32,0x31,
-    0x32,0x4c,0x31,0x35,0x2e,0x33,0x35,0x33,0x2c,0x32,
-    0x32,0x2e,0x32,0x31,0x32,0x7a,0x22,0x2f,0x3e,0x0a,
-    0x3c,0x67,0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,
-    0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,
-    0x32,0x39,0x2e,0x32,0x35,0x34,0x2c,0x31,0x31,0x2e,
-    0x35,0x32,0x36,0x63,0x33,0x2e,0x34,0x37,0x38,0x2c,
-    0x30,0x2c,0x36,0x2e,0x33,0x30,0x37,0x2c,0x33,0x2e,
-    0x31,0x34,0x2c,0x36,0x2e,0x33,0x30,0x37,0x2c,0x36,
-    0x2e,0x39,0x39,0x36,0x63,0x30,0x2c,0x33,0x2e,0x38,
-    0x36,0x36,0x2d,0x32,0x2e,0x38,0x32,0x39,0x2c,0x37,
-    0x2e,0x30,0x31,0x32,0x2d,0x36,0x2e,0x33,0x30,0x37,
-    0x2c,0x37,0x2e,0x30,0x31,0x32,0x48,0x37,0x2e,0x37,
-    0x36,0x0a,0x09,0x09,0x63,0x2d,0x33,0x2e,0x34,0x35,
-    0x32,0x2d,0x30,0x2e,0x30,0x33,0x2d,0x36,0x2e,0x32,
-    0x36,0x2d,0x33,0x2e,0x31,0x37,0x37,0x2d,0x36,0x2e,
-    0x32,0x36,0x2d,0x37,0x2e,0x30,0x31,0x32,0x63,0x30,
-    0x2d,0x33,0x2e,0x38,0x32,0x37,0x2c,0x32,0x2e,0x38,
-    0x30,0x38,0x2d,0x36,0x2e,0x39,0x36,0x36,0x2c,0x36,
-    0x2e,0x32,0x34,0x37,0x2d,0x36,0x2e,0x39,0x39,0x36,
-    0x48,0x32,0x39,0x2e,0x32,0x35,0x34,0x20,0x4d,0x32,
-    0x39,0x2e,0x32,0x35,0x34,0x2c,0x31,0x30,0x2e,0x30,
-    0x32,0x36,0x63,0x2d,0x30,0x2e,0x30,0x32,0x31,0x2c,
-    0x30,0x2d,0x32,0x31,0x2e,0x35,0x30,0x37,0x2c,0x30,
-    0x2d,0x32,0x31,0x2e,0x35,0x30,0x37,0x2c,0x30,0x0a,
-    0x09,0x09,0x43,0x33,0x2e,0x34,0x36,0x36,0x2c,0x31,
-    0x30,0x2e,0x30,0x36,0x33,0x2c,0x30,0x2c,0x31,0x33,
-    0x2e,0x38,0x34,0x36,0x2c,0x30,0x2c,0x31,0x38,0x2e,
-    0x35,0x32,0x32,0x63,0x30,0x2c,0x34,0x2e,0x36,0x37,
-    0x39,0x2c,0x33,0x2e,0x34,0x36,0x36,0x2c,0x38,0x2e,
-    0x34,0x37,0x33,0x2c,0x37,0x2e,0x37,0x34,0x37,0x2c,
-    0x38,0x2e,0x35,0x31,0x32,0x63,0x30,0x2c,0x30,0x2c,
-    0x32,0x31,0x2e,0x34,0x38,0x33,0x2c,0x30,0x2c,0x32,
-    0x31,0x2e,0x35,0x30,0x37,0x2c,0x30,0x63,0x34,0x2e,
-    0x33,0x31,0x33,0x2c,0x30,0x2c,0x37,0x2e,0x38,0x30,
-    0x37,0x2d,0x33,0x2e,0x38,0x31,0x32,0x2c,0x37,0x2e,
-    0x38,0x30,0x37,0x2d,0x38,0x2e,0x35,0x31,0x32,0x0a,
-    0x09,0x09,0x43,0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,
-    0x31,0x33,0x2e,0x38,0x32,0x33,0x2c,0x33,0x33,0x2e,
-    0x35,0x36,0x36,0x2c,0x31,0x30,0x2e,0x30,0x32,0x36,
-    0x2c,0x32,0x39,0x2e,0x32,0x35,0x34,0x2c,0x31,0x30,
-    0x2e,0x30,0x32,0x36,0x4c,0x32,0x39,0x2e,0x32,0x35,
-    0x34,0x2c,0x31,0x30,0x2e,0x30,0x32,0x36,0x7a,0x22,
-    0x2f,0x3e,0x0a,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,
-    0x73,0x76,0x67,0x3e,0x0a
+const size_t help_button_r_svg_size = 743;
+const unsigned char help_button_r_svg_data[743] = {
+    0x45,0x53,0x5a,0x31,0x23,0x05,0x00,0x00,0x78,0xda,
+    0x75,0x53,0xdb,0x6e,0xd3,0x40,0x10,0x7d,0x4e,0xbe,
+    0x62,0x59,0x9e,0x90,0xec,0xf5,0x5e,0xec,0xdd,0x75,
+    0xd4,0x14,0xd1,0xb4,0x94,0x4a,0x2d,0x54,0xa2,0x14,
+    0xf1,0x84,0x52,0xc7,0xc4,0x16,0xc6,0x89,0x1c,0xe7,
+    0x02,0x5f,0xcf,0x99,0x75,0x54,0x5a,0xa9,0xe4,0x61,
+    0x3d,0x3b,0x33,0x7b,0xce,0x99,0x4b,0x4e,0xde,0x1e,
+    0x7e,0x35,0x6c,0x57,0x76,0x9b,0x7a,0xd5,0x4e,0xb9,
+    0x12,0x92,0xb3,0xb2,0x2d,0x56,0x8b,0xba,0x5d,0x4e,
+    0xf9,0xb6,0xff,0x11,0x7b,0xfe,0xf6,0x74,0x7c,0xf2,
+    0x2a,0x8e,0xd9,0x65,0xd9,0x96,0xdd,0xbc,0x5f,0x75,
+    0x13,0xf6,0x6e,0xb1,0x7a,0x28,0xd9,0x55,0xd3,0x6c,
+    0x37,0x7d,0x70,0x31,0x65,0x85,0x14,0x26,0x62,0x9f,
+    0xef,0x2f,0xd9,0xc5,0x61,0xbd,0xea,0x7a,0x76,0xdb,
+    0x6c,0x97,0xf1,0x55,0xcb,0x44,0x70,0xde,0x0f,0x1c,
+    0x13,0x86,0x44,0xc9,0xce,0xb6,0x75,0xb3,0x60,0xf2,
+    0x0d,0x63,0x71,0x4c,0xf0,0xe7,0x9f,0x66,0x77,0xdf,
+    0x6e,0x2f,0xd8,0x66,0xb7,0x64,0xb7,0x5f,0xce,0xae,
+    0xaf,0x66,0x8c,0xc7,0x49,0xf2,0xd5,0xcc,0x92,0xe4,
+    0xfc,0xee,0x3c,0x20,0x28,0xa1,0x92,0xe4,0xe2,0x23,
+    0x67,0xbc,0xea,0xfb,0xf5,0x24,0x49,0xf6,0xfb,0xbd,
+    0xd8,0x1b,0xb1,0xea,0x96,0xc9,0x65,0x37,0x5f,0x57,
+    0x75,0xb1,0x49,0x90,0x98,0x50,0x22,0x1e,0x25,0x00,
+    0x53,0x4a,0x2c,0xfa,0x05,0x07,0x05,0x21,0x3f,0xa9,
+    0x53,0x71,0x56,0x2f,0xa6,0xfc,0xfb,0xc1,0xc8,0xef,
+    0x9c,0xa1,0x09,0xed,0x66,0xfa,0x02,0xae,0x96,0x52,
+    0x12,0xce,0x31,0x65,0x72,0x68,0xea,0xf6,0xe7,0x4b,
+    0x89,0x2a,0xcf,0xf3,0x24,0x44,0x91,0x3a,0xe5,0x72,
+    0x7d,0xe0,0xec,0xf7,0xf0,0x1d,0x8f,0xd8,0xbe,0x5e,
+    0xf4,0xd5,0x94,0x1b,0x27,0xa4,0x55,0x14,0xaa,0xca,
+    0x7a,0x59,0xf5,0x4f,0x3d,0xbb,0xba,0xdc,0x9f,0xad,
+    0xe8,0x29,0x93,0x6c,0x70,0x1f,0x3f,0x34,0x91,0xf9,
+    0x43,0x53,0xc6,0x0f,0xf3,0xe2,0xe7,0xb2,0x5b,0x6d,
+    0x5b,0x08,0x6f,0xcb,0x3d,0x7b,0x21,0x13,0x2a,0x27,
+    0x9b,0xf5,0xbc,0x28,0xa7,0x7c,0xdd,0x95,0x9b,0xb2,
+    0xdb,0x95,0x54,0xfc,0x7a,0xde,0x57,0xec,0x47,0xdd,
+    0x34,0x53,0xfe,0xfa,0x7d,0xf8,0x71,0x06,0x90,0x1b,
+    0x4c,0x2d,0x77,0x26,0xa2,0xe1,0x79,0x5b,0x29,0xe1,
+    0x5c,0x5e,0x48,0xe1,0xb4,0x8e,0x64,0x84,0x1e,0x29,
+    0x17,0x61,0xa8,0x4a,0x1f,0x6d,0x6c,0x87,0xd6,0x85,
+    0x84,0xcf,0xa5,0x2e,0x46,0x24,0xb7,0xe4,0xb3,0xf1,
+    0x63,0xd8,0x56,0x71,0x00,0xb9,0x1f,0x10,0xff,0xa0,
+    0xf4,0x1b,0x95,0x09,0x93,0x99,0x48,0x6b,0xa1,0x95,
+    0x06,0x87,0xd5,0xbb,0x58,0x0b,0x1f,0xf8,0xac,0xce,
+    0xc0,0xe7,0x95,0x7d,0xca,0x97,0x12,0x9f,0x36,0xc1,
+    0xe1,0x11,0x96,0x1e,0x72,0x44,0xe6,0x73,0x9c,0x28,
+    0x12,0x7e,0x23,0x53,0xd8,0x3a,0xf3,0xb0,0x9d,0xcd,
+    0x03,0x90,0x1a,0x8f,0x0a,0x68,0xd2,0x3e,0xc7,0x99,
+    0xaa,0x94,0x6c,0x97,0x43,0x8e,0xf6,0x24,0x55,0x19,
+    0x52,0x96,0x7a,0xca,0x91,0x99,0x8a,0xa9,0x86,0x21,
+    0x27,0x43,0x20,0xd3,0x0a,0xa7,0x74,0x94,0xa3,0x3d,
+    0x95,0x48,0xec,0xd6,0xd2,0x4b,0x69,0x8e,0xb6,0x12,
+    0xde,0x19,0xb0,0xc8,0x50,0x2f,0xa1,0x7a,0xe3,0x51,
+    0x8a,0x34,0x16,0xa7,0xb2,0x83,0x59,0xc5,0x06,0x3d,
+    0xcd,0xaf,0x9f,0x95,0xfd,0xfc,0xf6,0x87,0x27,0x98,
+    0xc9,0xf2,0x74,0x3c,0xfa,0xef,0x60,0x74,0x8e,0xf2,
+    0xd2,0x48,0x91,0x34,0x5b,0x18,0x91,0x3a,0x0f,0x4d,
+    0x16,0x6a,0x5c,0x64,0x84,0x4a,0x8f,0x26,0xc6,0x97,
+    0x5b,0xc8,0x35,0xc2,0x5b,0xe2,0xf7,0x3a,0x8f,0xb0,
+    0x09,0x4a,0xc7,0x43,0x3c,0xd8,0x1f,0x1c,0x9a,0x34,
+    0x1e,0xa1,0x3d,0xc0,0xc9,0x34,0x35,0xc0,0x20,0xae,
+    0x2d,0xee,0xca,0xb9,0xc1,0x0c,0x99,0x28,0x0d,0x48,
+    0xda,0x45,0x40,0x92,0x1e,0x81,0xdc,0x5a,0x70,0xe8,
+    0x94,0x92,0xc0,0xf4,0x61,0x90,0xc5,0x1e,0xe5,0x01,
+    0x0a,0xf2,0x08,0x51,0xab,0x48,0xc6,0x1a,0x72,0xc1,
+    0xfa,0xcf,0x00,0xeb,0x0c,0xa4,0x40,0xa1,0x54,0x6b,
+    0xa8,0xaf,0x60,0x48,0xc3,0xbc,0x3d,0x6a,0xa3,0x75,
+    0x4a,0x85,0x75,0x79,0x34,0xa4,0x79,0x54,0x6a,0x20,
+    0x1b,0x0b,0x06,0x3b,0x53,0x61,0xdd,0x22,0xc0,0xa5,
+    0xde,0x0c,0x46,0xc0,0x2d,0x52,0x9a,0x28,0x1c,0x0e,
+    0x42,0x1d,0x89,0xc6,0x92,0x0e,0x76,0x78,0x15,0x78,
+    0xdd,0xb0,0x2d,0x54,0x91,0x89,0x8c,0x11,0xd9,0x51,
+    0x86,0xb6,0xd1,0x33,0xfd,0xd7,0xcf,0x6e,0xc3,0x70,
+    0x92,0x25,0x1d,0xf8,0xe3,0x9f,0x8e,0xff,0x02,0x5e,
+    0x5f,0x39,0x45
 };
 
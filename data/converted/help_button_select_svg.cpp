@@ -1,195 +1,108 @@
-//this file was auto-generated from "button_select.svg" by res2h
+//this file was auto-generated from "button_select.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_button_select_svg_size = 1866;
-const unsigned char help_button_select_svg_data[1866] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x33,0x30,
-    0x5f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,
-    0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,
-    0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,
-    0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,
-    0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,0x3d,
-    0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-    0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,
-    0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,0x6b,0x22,
-    0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,0x20,0x79,
-    0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,0x20,0x77,
-    0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x2d,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3d,
-    0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,
-    0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,
-    0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,0x3e,0x0a,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,
-    0x22,0x4d,0x33,0x33,0x2e,0x32,0x31,0x37,0x2c,0x31,
-    0x39,0x2e,0x31,0x31,0x38,0x48,0x33,0x2e,0x38,0x34,
-    0x35,0x43,0x31,0x2e,0x37,0x32,0x32,0x2c,0x31,0x39,
-    0x2e,0x31,0x31,0x38,0x2c,0x30,0x2c,0x32,0x30,0x2e,
-    0x38,0x39,0x2c,0x30,0x2c,0x32,0x33,0x2e,0x30,0x37,
-    0x35,0x73,0x31,0x2e,0x37,0x32,0x32,0x2c,0x33,0x2e,
-    0x39,0x35,0x37,0x2c,0x33,0x2e,0x38,0x34,0x35,0x2c,
-    0x33,0x2e,0x39,0x35,0x37,0x68,0x32,0x39,0x2e,0x33,
-    0x37,0x32,0x0a,0x09,0x09,0x09,0x63,0x32,0x2e,0x31,
-    0x32,0x33,0x2c,0x30,0x2c,0x33,0x2e,0x38,0x34,0x34,
-    0x2d,0x31,0x2e,0x37,0x37,0x31,0x2c,0x33,0x2e,0x38,
-    0x34,0x34,0x2d,0x33,0x2e,0x39,0x35,0x37,0x43,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x2c,0x32,0x30,0x2e,0x38,
-    0x38,0x39,0x2c,0x33,0x35,0x2e,0x33,0x34,0x2c,0x31,
-    0x39,0x2e,0x31,0x31,0x38,0x2c,0x33,0x33,0x2e,0x32,
-    0x31,0x37,0x2c,0x31,0x39,0x2e,0x31,0x31,0x38,0x7a,
-    0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,
-    0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,
-    0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,
-    0x33,0x33,0x2e,0x37,0x35,0x37,0x2c,0x31,0x35,0x2e,
-    0x35,0x34,0x39,0x68,0x31,0x2e,0x31,0x38,0x36,0x56,
-    0x39,0x2e,0x34,0x37,0x34,0x68,0x32,0x2e,0x31,0x32,
-    0x34,0x56,0x38,0x2e,0x33,0x34,0x35,0x68,0x2d,0x35,
-    0x2e,0x34,0x33,0x33,0x76,0x31,0x2e,0x31,0x32,0x38,
-    0x68,0x32,0x2e,0x31,0x32,0x33,0x56,0x31,0x35,0x2e,
-    0x35,0x34,0x39,0x7a,0x20,0x4d,0x33,0x30,0x2e,0x38,
-    0x35,0x35,0x2c,0x31,0x31,0x2e,0x30,0x30,0x37,0x0a,
-    0x09,0x63,0x2d,0x30,0x2e,0x31,0x32,0x36,0x2d,0x31,
-    0x2e,0x35,0x35,0x34,0x2d,0x31,0x2e,0x31,0x34,0x31,
-    0x2d,0x32,0x2e,0x38,0x36,0x34,0x2d,0x33,0x2e,0x30,
-    0x38,0x37,0x2d,0x32,0x2e,0x38,0x36,0x34,0x63,0x2d,
-    0x32,0x2e,0x32,0x32,0x35,0x2c,0x30,0x2d,0x33,0x2e,
-    0x31,0x36,0x32,0x2c,0x31,0x2e,0x37,0x37,0x33,0x2d,
-    0x33,0x2e,0x31,0x36,0x32,0x2c,0x33,0x2e,0x38,0x30,
-    0x35,0x63,0x30,0x2c,0x32,0x2e,0x30,0x32,0x36,0x2c,
-    0x30,0x2e,0x39,0x37,0x39,0x2c,0x33,0x2e,0x38,0x30,
-    0x34,0x2c,0x33,0x2e,0x30,0x32,0x31,0x2c,0x33,0x2e,
-    0x38,0x30,0x34,0x0a,0x09,0x63,0x32,0x2e,0x33,0x32,
-    0x38,0x2c,0x30,0x2c,0x33,0x2e,0x30,0x36,0x33,0x2d,
-    0x31,0x2e,0x35,0x32,0x31,0x2c,0x33,0x2e,0x32,0x32,
-    0x39,0x2d,0x32,0x2e,0x39,0x35,0x38,0x68,0x2d,0x31,
-    0x2e,0x32,0x38,0x63,0x2d,0x30,0x2e,0x30,0x39,0x39,
-    0x2c,0x30,0x2e,0x37,0x35,0x37,0x2d,0x30,0x2e,0x35,
-    0x31,0x2c,0x31,0x2e,0x38,0x32,0x39,0x2d,0x31,0x2e,
-    0x37,0x34,0x33,0x2c,0x31,0x2e,0x38,0x32,0x39,0x63,
-    0x2d,0x31,0x2e,0x31,0x37,0x35,0x2c,0x30,0x2d,0x31,
-    0x2e,0x39,0x38,0x38,0x2d,0x31,0x2e,0x30,0x34,0x32,
-    0x2d,0x31,0x2e,0x39,0x38,0x38,0x2d,0x32,0x2e,0x35,
-    0x34,0x36,0x0a,0x09,0x63,0x30,0x2d,0x31,0x2e,0x38,
-    0x37,0x37,0x2c,0x30,0x2e,0x38,0x31,0x33,0x2d,0x32,
-    0x2e,0x38,0x30,0x38,0x2c,0x31,0x2e,0x39,0x30,0x38,
-    0x2d,0x32,0x2e,0x38,0x30,0x38,0x63,0x30,0x2e,0x39,
-    0x39,0x39,0x2c,0x30,0x2c,0x31,0x2e,0x37,0x30,0x34,
-    0x2c,0x30,0x2e,0x36,0x34,0x36,0x2c,0x31,0x2e,0x38,
-    0x32,0x33,0x2c,0x31,0x2e,0x37,0x33,0x37,0x4c,0x33,
-    0x30,0x2e,0x38,0x35,0x35,0x2c,0x31,0x31,0x2e,0x30,
-    0x30,0x37,0x4c,0x33,0x30,0x2e,0x38,0x35,0x35,0x2c,
-    0x31,0x31,0x2e,0x30,0x30,0x37,0x7a,0x20,0x4d,0x31,
-    0x38,0x2e,0x36,0x35,0x39,0x2c,0x31,0x35,0x2e,0x35,
-    0x34,0x39,0x68,0x34,0x2e,0x39,0x37,0x33,0x56,0x31,
-    0x34,0x2e,0x34,0x32,0x68,0x2d,0x33,0x2e,0x37,0x38,
-    0x36,0x0a,0x09,0x76,0x2d,0x31,0x2e,0x39,0x39,0x38,
-    0x68,0x33,0x2e,0x35,0x37,0x33,0x76,0x2d,0x31,0x2e,
-    0x31,0x32,0x39,0x68,0x2d,0x33,0x2e,0x35,0x37,0x33,
-    0x56,0x39,0x2e,0x34,0x37,0x34,0x68,0x33,0x2e,0x37,
-    0x32,0x31,0x56,0x38,0x2e,0x33,0x34,0x35,0x48,0x31,
-    0x38,0x2e,0x36,0x36,0x4c,0x31,0x38,0x2e,0x36,0x35,
-    0x39,0x2c,0x31,0x35,0x2e,0x35,0x34,0x39,0x4c,0x31,
-    0x38,0x2e,0x36,0x35,0x39,0x2c,0x31,0x35,0x2e,0x35,
-    0x34,0x39,0x7a,0x20,0x4d,0x31,0x32,0x2e,0x39,0x37,
-    0x39,0x2c,0x31,0x35,0x2e,0x35,0x34,0x39,0x68,0x34,
-    0x2e,0x36,0x32,0x35,0x76,0x2d,0x31,0x2e,0x31,0x38,
-    0x38,0x68,0x2d,0x33,0x2e,0x34,0x33,0x37,0x56,0x38,
-    0x2e,0x33,0x34,0x35,0x0a,0x09,0x68,0x2d,0x31,0x2e,
-    0x31,0x38,0x38,0x56,0x31,0x35,0x2e,0x35,0x34,0x39,
-    0x7a,0x20,0x4d,0x36,0x2e,0x37,0x31,0x34,0x2c,0x31,
-    0x35,0x2e,0x35,0x34,0x39,0x68,0x34,0x2e,0x39,0x37,
-    0x34,0x56,0x31,0x34,0x2e,0x34,0x32,0x48,0x37,0x2e,
-    0x39,0x30,0x32,0x76,0x2d,0x31,0x2e,0x39,0x39,0x38,
-    0x68,0x33,0x2e,0x35,0x37,0x32,0x76,0x2d,0x31,0x2e,
-    0x31,0x32,0x39,0x48,0x37,0x2e,0x39,0x30,0x32,0x56,
-    0x39,0x2e,0x34,0x37,0x34,0x68,0x33,0x2e,0x37,0x32,
-    0x36,0x56,0x38,0x2e,0x33,0x34,0x35,0x48,0x36,0x2e,
-    0x37,0x31,0x34,0x56,0x31,0x35,0x2e,0x35,0x34,0x39,
-    0x7a,0x20,0x4d,0x30,0x2e,0x31,0x34,0x39,0x2c,0x31,
-    0x30,0x2e,0x33,0x37,0x32,0x0a,0x09,0x63,0x30,0x2c,
-    0x32,0x2e,0x39,0x35,0x35,0x2c,0x34,0x2e,0x31,0x36,
-    0x37,0x2c,0x31,0x2e,0x33,0x39,0x38,0x2c,0x34,0x2e,
-    0x31,0x36,0x37,0x2c,0x33,0x2e,0x31,0x38,0x36,0x63,
-    0x30,0x2c,0x30,0x2e,0x37,0x39,0x32,0x2d,0x30,0x2e,
-    0x36,0x37,0x33,0x2c,0x31,0x2e,0x30,0x36,0x34,0x2d,
-    0x31,0x2e,0x33,0x39,0x35,0x2c,0x31,0x2e,0x30,0x36,
-    0x34,0x63,0x2d,0x30,0x2e,0x39,0x37,0x36,0x2c,0x30,
-    0x2d,0x31,0x2e,0x35,0x39,0x31,0x2d,0x30,0x2e,0x34,
-    0x35,0x36,0x2d,0x31,0x2e,0x36,0x32,0x34,0x2d,0x31,
-    0x2e,0x34,0x30,0x37,0x48,0x30,0x2e,0x30,0x31,0x35,
-    0x0a,0x09,0x43,0x30,0x2e,0x30,0x33,0x2c,0x31,0x34,
-    0x2e,0x37,0x33,0x2c,0x30,0x2e,0x38,0x34,0x36,0x2c,
-    0x31,0x35,0x2e,0x37,0x35,0x2c,0x32,0x2e,0x38,0x38,
-    0x32,0x2c,0x31,0x35,0x2e,0x37,0x35,0x63,0x31,0x2e,
-    0x32,0x30,0x35,0x2c,0x30,0x2c,0x32,0x2e,0x37,0x31,
-    0x36,0x2d,0x30,0x2e,0x34,0x38,0x34,0x2c,0x32,0x2e,
-    0x37,0x31,0x36,0x2d,0x32,0x2e,0x33,0x34,0x33,0x63,
-    0x30,0x2d,0x33,0x2e,0x30,0x37,0x37,0x2d,0x34,0x2e,
-    0x32,0x31,0x33,0x2d,0x31,0x2e,0x34,0x35,0x35,0x2d,
-    0x34,0x2e,0x32,0x31,0x33,0x2d,0x33,0x2e,0x31,0x34,
-    0x36,0x0a,0x09,0x63,0x30,0x2d,0x30,0x2e,0x36,0x37,
-    0x37,0x2c,0x30,0x2e,0x35,0x32,0x33,0x2d,0x30,0x2e,
-    0x39,0x39,0x31,0x2c,0x31,0x2e,0x33,0x31,0x33,0x2d,
-    0x30,0x2e,0x39,0x39,0x31,0x63,0x30,0x2e,0x39,0x39,
-    0x2c,0x30,0x2c,0x31,0x2e,0x33,0x38,0x38,0x2c,0x30,
-    0x2e,0x36,0x30,0x35,0x2c,0x31,0x2e,0x34,0x32,0x38,
-    0x2c,0x31,0x2e,0x31,0x36,0x33,0x48,0x35,0x2e,0x34,
-    0x31,0x63,0x2d,0x30,0x2e,0x31,0x35,0x32,0x2d,0x32,
-    0x2e,0x30,0x39,0x31,0x2d,0x31,0x2e,0x38,0x39,0x36,
-    0x2d,0x32,0x2e,0x32,0x39,0x2d,0x32,0x2e,0x37,0x36,
-    0x37,0x2d,0x32,0x2e,0x32,0x39,0x0a,0x09,0x43,0x31,
-    0x2e,0x32,0x36,0x36,0x2c,0x38,0x2e,0x31,0x34,0x33,
-    0x2c,0x30,0x2e,0x31,0x34,0x39,0x2c,0x38,0x2e,0x37,
-    0x36,0x37,0x2c,0x30,0x2e,0x31,0x34,0x39,0x2c,0x31,
-    0x30,0x2e,0x33,0x37,0x32,0x22,0x2f,0x3e,0x0a,0x3c,
-    0x67,0x20,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3d,
-    0x22,0x30,0x22,0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,
-    0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,
-    0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,
-    0x4d,0x33,0x36,0x2e,0x39,0x36,0x31,0x2c,0x30,0x2e,
-    0x31,0x76,0x33,0x36,0x2e,0x38,0x36,0x31,0x48,0x30,
-    0x2e,0x31,0x56,0x30,0x2e,0x31,0x48,0x33,0x36,0x2e,
-    0x39,0x36,0x31,0x20,0x4d,0x33,0x37,0x2e,0x30,0x36,
-    0x31,0x2c,0x30,0x48,0x30,0x76,0x33,0x37,0x2e,0x30,
-    0x36,0x68,0x33,0x37,0x2e,0x30,0x36,0x31,0x56,0x30,
-    0x4c,0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,0x30,0x7a,
-    0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,
-    0x2f,0x73,0x76,0x67,0x3e,0x0a
+const size_t help_button_select_svg_size = 991;
+const unsigned char help_button_select_svg_data[991] = {
+    0x45,0x53,0x5a,0x31,0x4a,0x07,0x00,0x00,0x78,0xda,
+    0x7d,0x55,0xdb,0x6e,0xdb,0x46,0x10,0x7d,0x96,0xbe,
+    0x62,0xcb,0x3e,0x15,0x10,0x97,0x7b,0xbf,0x18,0x96,
+    0x83,0x5a,0x4e,0x2c,0x03,0x4e,0x6b,0xa0,0xa9,0x8a,
+    0x3e,0x05,0x32,0xc5,0x88,0x42,0x54,0x49,0x90,0x68,
+    0xc9,0xcd,0xd7,0xf7,0xcc,0x2e,0xdd,0xc8,0x80,0x5b,
+    0x03,0x26,0x87,0x3b,0xb3,0x67,0xce,0xcc,0x9c,0x5d,
+    0x5d,0xbe,0x7b,0xfe,0x6b,0xcd,0x8e,0xcd,0xfe,0xb0,
+    0xda,0x6e,0xc6,0x85,0xe4,0xa2,0x60,0xcd,0xa6,0xde,
+    0x2e,0x56,0x9b,0xe5,0xb8,0x78,0xea,0xbe,0x94,0xa1,
+    0x78,0x77,0x35,0xbc,0xfc,0xa1,0x2c,0xd9,0x6d,0xb3,
+    0x69,0xf6,0xf3,0x6e,0xbb,0xbf,0x60,0x3f,0x2f,0xb6,
+    0x8f,0x0d,0xbb,0x5b,0xaf,0x9f,0x0e,0x5d,0x5a,0x62,
+    0xd2,0x71,0xc1,0xf5,0x88,0xfd,0x36,0xbb,0x65,0xef,
+    0x9f,0x77,0xdb,0x7d,0xc7,0x1e,0xd6,0x4f,0xcb,0xf2,
+    0x6e,0xc3,0x78,0x5a,0x9c,0xe5,0x1c,0x17,0x0c,0x81,
+    0x82,0x5d,0x3f,0xad,0xd6,0x0b,0x26,0x7e,0x62,0xac,
+    0x2c,0x09,0xfe,0xe6,0xd7,0xc9,0xa7,0x3f,0x1f,0xde,
+    0xb3,0xc3,0x71,0xc9,0x1e,0x7e,0xbf,0xbe,0xbf,0x9b,
+    0xb0,0xa2,0xac,0xaa,0x3f,0xf4,0xa4,0xaa,0x6e,0x3e,
+    0xdd,0x24,0x04,0xc9,0x65,0x55,0xbd,0xff,0xa5,0x60,
+    0x45,0xdb,0x75,0xbb,0x8b,0xaa,0x3a,0x9d,0x4e,0xfc,
+    0xa4,0xf9,0x76,0xbf,0xac,0x6e,0xf7,0xf3,0x5d,0xbb,
+    0xaa,0x0f,0x15,0x02,0x2b,0x0a,0xc4,0xa6,0x0a,0x60,
+    0x52,0xf2,0x45,0xb7,0x28,0x90,0x82,0x90,0xcf,0xea,
+    0x94,0x05,0x5b,0x2d,0xc6,0xc5,0xe7,0x67,0x2d,0x3e,
+    0x17,0x0c,0x4d,0xd8,0x1c,0xc6,0x6f,0xe0,0x2a,0x21,
+    0x04,0xe1,0xf4,0x21,0x17,0xcf,0xeb,0xd5,0xe6,0xeb,
+    0x5b,0x81,0x32,0xc6,0x58,0x25,0x2f,0x42,0xc7,0x85,
+    0xd8,0x3d,0x17,0xec,0xef,0xfc,0x1e,0x0e,0xd8,0x69,
+    0xb5,0xe8,0xda,0x71,0xa1,0x3d,0x17,0x4e,0x92,0xab,
+    0x6d,0x56,0xcb,0xb6,0x3b,0x5f,0x39,0xae,0x9a,0xd3,
+    0xf5,0x96,0xb6,0x32,0xc1,0xf2,0x72,0xff,0xa2,0x89,
+    0xcc,0x1f,0xd7,0x4d,0xf9,0x38,0xaf,0xbf,0x2e,0xf7,
+    0xdb,0xa7,0x0d,0x88,0x6f,0x9a,0x13,0x7b,0x23,0x12,
+    0x2c,0x2f,0x0e,0xbb,0x79,0xdd,0x8c,0x8b,0xdd,0xbe,
+    0x39,0x34,0xfb,0x63,0x43,0xc5,0x2f,0xaf,0x86,0x83,
+    0xf4,0x18,0x5c,0xee,0xe6,0x5d,0xcb,0xbe,0xac,0xd6,
+    0xeb,0x71,0xf1,0xe3,0x87,0xf4,0x57,0x30,0xe0,0x7d,
+    0xd4,0x9a,0x2b,0xe9,0x47,0x32,0x72,0x29,0xc3,0x54,
+    0xf3,0x60,0xec,0x44,0x72,0xaf,0x54,0xbf,0x34,0x12,
+    0x23,0x25,0x78,0x88,0xf4,0xd6,0x5c,0x78,0x7b,0xc8,
+    0x5e,0xcd,0xa3,0xf5,0xa3,0x14,0x9f,0xed,0x56,0x45,
+    0xae,0xbd,0x42,0xae,0x41,0xad,0xb8,0x54,0x1a,0x3b,
+    0xc8,0x6d,0x4a,0x6c,0xf0,0xb2,0xb7,0x53,0xe8,0x24,
+    0xd3,0x4e,0xc0,0x40,0xd6,0x96,0x6b,0xf3,0x92,0xee,
+    0x15,0x9f,0x6f,0x45,0x45,0x15,0x54,0x28,0x21,0x3f,
+    0xfe,0xa7,0x0a,0x0f,0x3a,0xd2,0x72,0x6b,0x62,0x8b,
+    0x31,0x07,0x37,0x8b,0xdc,0x78,0xd3,0x12,0x15,0x33,
+    0x0b,0xc8,0x60,0xdb,0xd2,0x72,0xa3,0xf5,0x11,0x6e,
+    0x15,0x92,0x43,0xcf,0xf2,0x8e,0x6f,0xec,0xa3,0x06,
+    0x17,0x6b,0x47,0x10,0x8e,0x10,0x7e,0x38,0xa8,0x4b,
+    0x01,0xbf,0x03,0x77,0x6b,0xa9,0x02,0x69,0x64,0xa9,
+    0x78,0x70,0x54,0x81,0x08,0x3e,0xdb,0x35,0x5e,0x4a,
+    0xd9,0x91,0xc0,0xa2,0x74,0xe8,0x18,0x0a,0xd5,0xbd,
+    0x8d,0x72,0x85,0xad,0xd1,0x34,0x2e,0x94,0x1b,0x09,
+    0x1e,0x7d,0x4c,0x6b,0x06,0x4f,0xa1,0x64,0xb6,0x87,
+    0xd4,0x2a,0xad,0x42,0x6a,0x95,0x70,0x9a,0xd2,0x25,
+    0x9f,0x52,0x11,0xd8,0xd1,0x86,0x16,0x4b,0x2a,0x10,
+    0x1b,0x11,0x31,0x03,0xaa,0x12,0xb6,0x95,0xc8,0x15,
+    0x10,0x83,0x8c,0x46,0x67,0xbb,0x26,0x96,0x9e,0xc8,
+    0x48,0x1e,0x43,0xc0,0x53,0x18,0xd5,0xdb,0x0a,0x45,
+    0x3a,0x24,0x23,0x5f,0xf0,0x1e,0x38,0x41,0x6a,0xaa,
+    0x41,0x04,0x6c,0x8e,0x22,0x64,0xbb,0x06,0x4d,0xca,
+    0x42,0x85,0x80,0xa8,0xe0,0xce,0xb8,0x04,0x4e,0x29,
+    0xbc,0xf6,0xf7,0xaf,0x9a,0xf4,0xfa,0x0b,0x2d,0x94,
+    0x81,0x3b,0x1b,0x5f,0x86,0x60,0x50,0x32,0xfa,0x6b,
+    0xb8,0x51,0x2d,0x7a,0xe2,0x03,0x08,0x1c,0x89,0x4f,
+    0x0c,0xad,0xe6,0xd6,0x6b,0xfa,0x90,0x2a,0x92,0x13,
+    0x5f,0xfd,0xb8,0x10,0xa8,0x64,0x1e,0xd7,0x94,0xf0,
+    0xdc,0xfd,0x2b,0xd4,0xd7,0x5f,0x94,0x53,0xa5,0xce,
+    0xfe,0x9b,0xd3,0x29,0x9b,0x70,0x43,0x20,0x5c,0xa3,
+    0x7d,0xc6,0x1a,0x0e,0xda,0xbc,0xfa,0x7d,0xe0,0x8e,
+    0x7b,0x69,0xce,0xc9,0x9a,0x4c,0x76,0xea,0xd1,0x10,
+    0x75,0xce,0x54,0xf5,0x4c,0xb3,0xe7,0x8c,0xa8,0xeb,
+    0x89,0x26,0xa8,0xef,0xc8,0x50,0x8e,0x01,0x25,0x91,
+    0x8f,0x43,0xd2,0x40,0x44,0x9f,0x0c,0x74,0x01,0x89,
+    0x72,0x1d,0x43,0x6f,0x6b,0xd2,0x29,0xfc,0x18,0x6b,
+    0x54,0x18,0xab,0xf3,0xd4,0x68,0xe1,0x48,0x70,0x3a,
+    0xda,0x6c,0xd3,0xec,0xa3,0x77,0x69,0xae,0x36,0x4a,
+    0x7c,0x19,0x4b,0xba,0x74,0x8a,0xc2,0x8c,0xf0,0x53,
+    0x68,0x43,0xa2,0xc2,0x09,0xde,0xd8,0x6f,0x30,0x29,
+    0x1a,0x30,0x8d,0xce,0x42,0x2f,0xc8,0x1e,0x82,0xca,
+    0x76,0x0d,0x31,0x09,0x4b,0x47,0x19,0x8c,0x1d,0x41,
+    0x05,0xd3,0xdb,0xd0,0xa1,0xd1,0x35,0x29,0x59,0x78,
+    0x5f,0x1a,0x1c,0x42,0x52,0xa3,0xb1,0xb6,0xb7,0xc1,
+    0xb5,0x97,0x10,0xf1,0x24,0x09,0x59,0xa5,0x89,0x5a,
+    0x24,0x2d,0x6a,0xd9,0xdb,0x49,0x42,0x49,0x41,0x3a,
+    0x04,0x52,0x90,0xa0,0x32,0x8c,0x22,0x9d,0x49,0xa7,
+    0xa7,0x38,0x81,0x32,0x9d,0x2d,0xab,0x90,0x52,0xa0,
+    0x1e,0xe8,0x2b,0x52,0xfa,0xa4,0x78,0xef,0x7c,0x32,
+    0x51,0x0d,0xa8,0x3a,0x37,0x0a,0x48,0x4b,0xe5,0x50,
+    0x47,0x03,0xb9,0x47,0xe7,0xdd,0xa5,0xeb,0xe1,0x72,
+    0xc9,0xb6,0xb8,0xf9,0x56,0x1d,0x5d,0xbb,0x05,0x5d,
+    0x17,0xff,0x79,0x49,0x38,0x1e,0x71,0xeb,0x00,0xe0,
+    0x08,0x33,0x38,0x89,0xce,0xc9,0x19,0xfe,0xa7,0xd9,
+    0x83,0x4b,0x20,0xdf,0x4b,0x62,0x2a,0x8e,0xc9,0x6c,
+    0xf3,0xc2,0x4c,0xdc,0xbf,0x78,0xd2,0x8d,0xd4,0x5f,
+    0x48,0xf8,0x7d,0xb8,0x1a,0xfe,0x03,0xaf,0xb9,0xb1,
+    0x8f
 };
 
@@ -1,185 +1,103 @@
-//this file was auto-generated from "button_start.svg" by res2h
+//this file was auto-generated from "button_start.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_button_start_svg_size = 1769;
-const unsigned char help_button_start_svg_data[1769] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x33,0x30,
-    0x5f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,
-    0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,
-    0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,
-    0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,
-    0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,0x3d,
-    0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-    0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,
-    0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,0x6b,0x22,
-    0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,0x20,0x79,
-    0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,0x20,0x77,
-    0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x2d,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3d,
-    0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,
-    0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,
-    0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x70,0x61,0x74,
-    0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,
-    0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,
-    0x4d,0x33,0x33,0x2e,0x30,0x36,0x35,0x2c,0x31,0x35,
-    0x2e,0x35,0x34,0x38,0x68,0x31,0x2e,0x34,0x33,0x38,
-    0x56,0x39,0x2e,0x34,0x37,0x31,0x68,0x32,0x2e,0x35,
-    0x36,0x33,0x76,0x2d,0x31,0x2e,0x31,0x33,0x68,0x2d,
-    0x36,0x2e,0x35,0x36,0x33,0x76,0x31,0x2e,0x31,0x33,
-    0x68,0x32,0x2e,0x35,0x36,0x33,0x4c,0x33,0x33,0x2e,
-    0x30,0x36,0x35,0x2c,0x31,0x35,0x2e,0x35,0x34,0x38,
-    0x4c,0x33,0x33,0x2e,0x30,0x36,0x35,0x2c,0x31,0x35,
-    0x2e,0x35,0x34,0x38,0x7a,0x20,0x4d,0x32,0x34,0x2e,
-    0x33,0x35,0x31,0x2c,0x31,0x31,0x2e,0x35,0x37,0x33,
-    0x0a,0x09,0x56,0x39,0x2e,0x34,0x37,0x31,0x68,0x32,
-    0x2e,0x34,0x38,0x32,0x63,0x30,0x2e,0x37,0x35,0x35,
-    0x2c,0x30,0x2c,0x31,0x2e,0x32,0x32,0x36,0x2c,0x30,
-    0x2e,0x32,0x39,0x32,0x2c,0x31,0x2e,0x32,0x32,0x36,
-    0x2c,0x31,0x2e,0x30,0x33,0x39,0x63,0x30,0x2c,0x30,
-    0x2e,0x38,0x30,0x38,0x2d,0x30,0x2e,0x34,0x33,0x32,
-    0x2c,0x31,0x2e,0x30,0x36,0x33,0x2d,0x31,0x2e,0x32,
-    0x32,0x36,0x2c,0x31,0x2e,0x30,0x36,0x33,0x48,0x32,
-    0x34,0x2e,0x33,0x35,0x31,0x7a,0x20,0x4d,0x32,0x32,
-    0x2e,0x39,0x31,0x37,0x2c,0x31,0x35,0x2e,0x35,0x34,
-    0x38,0x68,0x31,0x2e,0x34,0x33,0x34,0x76,0x2d,0x32,
-    0x2e,0x38,0x34,0x36,0x68,0x32,0x2e,0x34,0x34,0x33,
-    0x0a,0x09,0x63,0x31,0x2e,0x30,0x35,0x33,0x2c,0x30,
-    0x2c,0x31,0x2e,0x31,0x38,0x38,0x2c,0x30,0x2e,0x37,
-    0x32,0x37,0x2c,0x31,0x2e,0x31,0x38,0x38,0x2c,0x31,
-    0x2e,0x37,0x35,0x35,0x63,0x30,0x2c,0x30,0x2e,0x35,
-    0x32,0x36,0x2c,0x30,0x2e,0x30,0x36,0x38,0x2c,0x30,
-    0x2e,0x38,0x39,0x2c,0x30,0x2e,0x31,0x37,0x34,0x2c,
-    0x31,0x2e,0x30,0x39,0x31,0x68,0x31,0x2e,0x35,0x35,
-    0x32,0x63,0x2d,0x30,0x2e,0x32,0x38,0x31,0x2d,0x30,
-    0x2e,0x33,0x39,0x35,0x2d,0x30,0x2e,0x32,0x39,0x2d,
-    0x31,0x2e,0x31,0x39,0x39,0x2d,0x30,0x2e,0x32,0x39,
-    0x2d,0x31,0x2e,0x35,0x34,0x36,0x0a,0x09,0x63,0x30,
-    0x2d,0x31,0x2e,0x30,0x31,0x39,0x2d,0x30,0x2e,0x31,
-    0x38,0x2d,0x31,0x2e,0x37,0x36,0x36,0x2d,0x30,0x2e,
-    0x39,0x39,0x34,0x2d,0x31,0x2e,0x39,0x34,0x35,0x76,
-    0x2d,0x30,0x2e,0x30,0x32,0x31,0x63,0x30,0x2e,0x36,
-    0x34,0x33,0x2d,0x30,0x2e,0x32,0x31,0x31,0x2c,0x31,
-    0x2e,0x31,0x32,0x38,0x2d,0x30,0x2e,0x37,0x39,0x37,
-    0x2c,0x31,0x2e,0x31,0x32,0x38,0x2d,0x31,0x2e,0x37,
-    0x33,0x37,0x63,0x30,0x2d,0x31,0x2e,0x31,0x31,0x39,
-    0x2d,0x30,0x2e,0x35,0x36,0x33,0x2d,0x31,0x2e,0x39,
-    0x35,0x34,0x2d,0x32,0x2e,0x33,0x30,0x35,0x2d,0x31,
-    0x2e,0x39,0x35,0x34,0x68,0x2d,0x34,0x2e,0x33,0x32,
-    0x37,0x4c,0x32,0x32,0x2e,0x39,0x31,0x37,0x2c,0x31,
-    0x35,0x2e,0x35,0x34,0x38,0x0a,0x09,0x4c,0x32,0x32,
-    0x2e,0x39,0x31,0x37,0x2c,0x31,0x35,0x2e,0x35,0x34,
-    0x38,0x7a,0x20,0x4d,0x31,0x34,0x2e,0x30,0x33,0x32,
-    0x2c,0x31,0x35,0x2e,0x35,0x34,0x38,0x68,0x31,0x2e,
-    0x35,0x35,0x31,0x6c,0x30,0x2e,0x37,0x30,0x38,0x2d,
-    0x31,0x2e,0x37,0x38,0x36,0x68,0x33,0x2e,0x32,0x31,
-    0x37,0x6c,0x30,0x2e,0x37,0x31,0x38,0x2c,0x31,0x2e,
-    0x37,0x38,0x36,0x68,0x31,0x2e,0x36,0x30,0x33,0x6c,
-    0x2d,0x33,0x2e,0x30,0x34,0x35,0x2d,0x37,0x2e,0x32,
-    0x30,0x37,0x68,0x2d,0x31,0x2e,0x37,0x30,0x34,0x4c,
-    0x31,0x34,0x2e,0x30,0x33,0x32,0x2c,0x31,0x35,0x2e,
-    0x35,0x34,0x38,0x7a,0x20,0x4d,0x31,0x36,0x2e,0x37,
-    0x32,0x33,0x2c,0x31,0x32,0x2e,0x36,0x33,0x32,0x0a,
-    0x09,0x4c,0x31,0x37,0x2e,0x39,0x31,0x2c,0x39,0x2e,
-    0x35,0x39,0x6c,0x31,0x2e,0x31,0x36,0x38,0x2c,0x33,
-    0x2e,0x30,0x34,0x32,0x48,0x31,0x36,0x2e,0x37,0x32,
-    0x33,0x7a,0x20,0x4d,0x39,0x2e,0x39,0x39,0x32,0x2c,
-    0x31,0x35,0x2e,0x35,0x34,0x38,0x68,0x31,0x2e,0x34,
-    0x33,0x34,0x56,0x39,0x2e,0x34,0x37,0x31,0x68,0x32,
-    0x2e,0x35,0x36,0x37,0x76,0x2d,0x31,0x2e,0x31,0x33,
-    0x48,0x37,0x2e,0x34,0x32,0x35,0x76,0x31,0x2e,0x31,
-    0x33,0x68,0x32,0x2e,0x35,0x36,0x37,0x56,0x31,0x35,
-    0x2e,0x35,0x34,0x38,0x7a,0x20,0x4d,0x30,0x2e,0x31,
-    0x38,0x37,0x2c,0x31,0x30,0x2e,0x33,0x36,0x38,0x0a,
-    0x09,0x63,0x30,0x2c,0x32,0x2e,0x39,0x35,0x36,0x2c,
-    0x35,0x2e,0x30,0x33,0x36,0x2c,0x31,0x2e,0x34,0x2c,
-    0x35,0x2e,0x30,0x33,0x36,0x2c,0x33,0x2e,0x31,0x38,
-    0x38,0x63,0x30,0x2c,0x30,0x2e,0x37,0x39,0x32,0x2d,
-    0x30,0x2e,0x38,0x31,0x33,0x2c,0x31,0x2e,0x30,0x36,
-    0x34,0x2d,0x31,0x2e,0x36,0x38,0x34,0x2c,0x31,0x2e,
-    0x30,0x36,0x34,0x63,0x2d,0x31,0x2e,0x31,0x37,0x39,
-    0x2c,0x30,0x2d,0x31,0x2e,0x39,0x32,0x33,0x2d,0x30,
-    0x2e,0x34,0x35,0x36,0x2d,0x31,0x2e,0x39,0x36,0x33,
-    0x2d,0x31,0x2e,0x34,0x30,0x37,0x48,0x30,0x2e,0x30,
-    0x32,0x36,0x0a,0x09,0x63,0x30,0x2e,0x30,0x32,0x31,
-    0x2c,0x31,0x2e,0x35,0x31,0x36,0x2c,0x31,0x2e,0x30,
-    0x30,0x35,0x2c,0x32,0x2e,0x35,0x33,0x38,0x2c,0x33,
-    0x2e,0x34,0x36,0x39,0x2c,0x32,0x2e,0x35,0x33,0x38,
-    0x63,0x31,0x2e,0x34,0x35,0x35,0x2c,0x30,0x2c,0x33,
-    0x2e,0x32,0x38,0x2d,0x30,0x2e,0x34,0x38,0x36,0x2c,
-    0x33,0x2e,0x32,0x38,0x2d,0x32,0x2e,0x33,0x34,0x35,
-    0x63,0x30,0x2d,0x33,0x2e,0x30,0x37,0x39,0x2d,0x35,
-    0x2e,0x30,0x39,0x33,0x2d,0x31,0x2e,0x34,0x35,0x34,
-    0x2d,0x35,0x2e,0x30,0x39,0x33,0x2d,0x33,0x2e,0x31,
-    0x34,0x38,0x0a,0x09,0x63,0x30,0x2d,0x30,0x2e,0x36,
-    0x37,0x36,0x2c,0x30,0x2e,0x36,0x33,0x32,0x2d,0x30,
-    0x2e,0x39,0x38,0x38,0x2c,0x31,0x2e,0x35,0x38,0x39,
-    0x2d,0x30,0x2e,0x39,0x38,0x38,0x63,0x31,0x2e,0x31,
-    0x39,0x36,0x2c,0x30,0x2c,0x31,0x2e,0x36,0x37,0x36,
-    0x2c,0x30,0x2e,0x36,0x30,0x34,0x2c,0x31,0x2e,0x37,
-    0x32,0x36,0x2c,0x31,0x2e,0x31,0x36,0x31,0x68,0x31,
-    0x2e,0x35,0x35,0x31,0x63,0x2d,0x30,0x2e,0x31,0x38,
-    0x35,0x2d,0x32,0x2e,0x30,0x39,0x33,0x2d,0x32,0x2e,
-    0x32,0x39,0x2d,0x32,0x2e,0x32,0x39,0x32,0x2d,0x33,
-    0x2e,0x33,0x34,0x35,0x2d,0x32,0x2e,0x32,0x39,0x32,
-    0x0a,0x09,0x43,0x31,0x2e,0x35,0x33,0x36,0x2c,0x38,
-    0x2e,0x31,0x33,0x39,0x2c,0x30,0x2e,0x31,0x38,0x37,
-    0x2c,0x38,0x2e,0x37,0x36,0x32,0x2c,0x30,0x2e,0x31,
-    0x38,0x37,0x2c,0x31,0x30,0x2e,0x33,0x36,0x38,0x22,
-    0x2f,0x3e,0x0a,0x3c,0x67,0x3e,0x0a,0x09,0x3c,0x67,
-    0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,
-    0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x33,
-    0x33,0x2e,0x32,0x31,0x37,0x2c,0x31,0x39,0x2e,0x31,
-    0x31,0x38,0x48,0x33,0x2e,0x38,0x34,0x35,0x43,0x31,
-    0x2e,0x37,0x32,0x32,0x2c,0x31,0x39,0x2e,0x31,0x31,
-    0x38,0x2c,0x30,0x2c,0x32,0x30,0x2e,0x38,0x39,0x2c,
-    0x30,0x2c,0x32,0x33,0x2e,0x30,0x37,0x35,0x73,0x31,
-    0x2e,0x37,0x32,0x32,0x2c,0x33,0x2e,0x39,0x35,0x37,
-    0x2c,0x33,0x2e,0x38,0x34,0x35,0x2c,0x33,0x2e,0x39,
-    0x35,0x37,0x68,0x32,0x39,0x2e,0x33,0x37,0x32,0x0a,
-    0x09,0x09,0x09,0x63,0x32,0x2e,0x31,0x32,0x33,0x2c,
-    0x30,0x2c,0x33,0x2e,0x38,0x34,0x34,0x2d,0x31,0x2e,
-    0x37,0x37,0x31,0x2c,0x33,0x2e,0x38,0x34,0x34,0x2d,
-    0x33,0x2e,0x39,0x35,0x37,0x43,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x2c,0x32,0x30,0x2e,0x38,0x38,0x39,0x2c,
-    0x33,0x35,0x2e,0x33,0x34,0x2c,0x31,0x39,0x2e,0x31,
-    0x31,0x38,0x2c,0x33,0x33,0x2e,0x32,0x31,0x37,0x2c,
-    0x31,0x39,0x2e,0x31,0x31,0x38,0x7a,0x22,0x2f,0x3e,
-    0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a
+const size_t help_button_start_svg_size = 945;
+const unsigned char help_button_start_svg_data[945] = {
+    0x45,0x53,0x5a,0x31,0xe9,0x06,0x00,0x00,0x78,0xda,
+    0x7d,0x54,0xdb,0x6e,0xdb,0x46,0x10,0x7d,0x96,0xbe,
+    0x62,0xcb,0x3e,0x15,0x20,0x97,0x7b,0xbf,0x08,0x96,
+    0x83,0x5a,0x76,0x2c,0x03,0x4e,0x62,0xa0,0xa9,0x8b,
+    0x3e,0x05,0x32,0xc5,0x88,0x42,0x58,0x49,0xd0,0xbd,
+    0xf9,0xfa,0x9e,0x59,0x2a,0x8e,0x04,0x18,0xd5,0xc3,
+    0xea,0x70,0x77,0xf6,0xcc,0xcc,0x99,0x43,0x5e,0xbd,
+    0x3b,0xfe,0xd3,0xb2,0x7d,0xbd,0xde,0xcc,0x97,0x8b,
+    0x61,0x26,0xb9,0xc8,0x58,0xbd,0xa8,0x96,0xd3,0xf9,
+    0x62,0x36,0xcc,0x76,0xdb,0xaf,0x45,0xc8,0xde,0x5d,
+    0xf7,0xaf,0x7e,0x29,0x0a,0x76,0x5f,0x2f,0xea,0xf5,
+    0x64,0xbb,0x5c,0x0f,0xd8,0xef,0xd3,0xe5,0x4b,0xcd,
+    0x1e,0xda,0x76,0xb7,0xd9,0xa6,0x2d,0x26,0x1d,0x17,
+    0x5c,0xe7,0xec,0x8f,0xe7,0x7b,0x76,0x77,0x5c,0x2d,
+    0xd7,0x5b,0xf6,0xd4,0xee,0x66,0xc5,0xc3,0x82,0xf1,
+    0xb4,0xf9,0xdc,0xe5,0x18,0x30,0x04,0x0a,0x76,0xb3,
+    0x9b,0xb7,0x53,0x26,0x7e,0x63,0xac,0x28,0x88,0xfe,
+    0xf6,0xd3,0xe8,0xf3,0xdf,0x4f,0x77,0x6c,0xb3,0x9f,
+    0xb1,0xa7,0x3f,0x6f,0x1e,0x1f,0x46,0x2c,0x2b,0xca,
+    0xf2,0x2f,0x3d,0x2a,0xcb,0xdb,0xcf,0xb7,0x89,0x41,
+    0x72,0x59,0x96,0x77,0x1f,0x33,0x96,0x35,0xdb,0xed,
+    0x6a,0x50,0x96,0x87,0xc3,0x81,0x1f,0x34,0x5f,0xae,
+    0x67,0xe5,0xfd,0x7a,0xb2,0x6a,0xe6,0xd5,0xa6,0x44,
+    0x60,0x49,0x81,0xb8,0x54,0x82,0x4c,0x4a,0x3e,0xdd,
+    0x4e,0x33,0xa4,0x20,0xe6,0xb3,0x3e,0x65,0xc6,0xe6,
+    0xd3,0x61,0xf6,0xe5,0xa8,0xc5,0x97,0x8c,0x41,0x84,
+    0xc5,0x66,0xf8,0x06,0xaf,0x12,0x42,0x10,0xcf,0x29,
+    0x64,0x70,0x6c,0xe7,0x8b,0x6f,0x6f,0x05,0xca,0x18,
+    0x63,0x99,0x4e,0x11,0x3a,0xcc,0xc4,0xea,0x98,0xb1,
+    0x7f,0xbb,0xff,0x7e,0x8f,0x1d,0xe6,0xd3,0x6d,0x33,
+    0xcc,0xb4,0xe7,0xc2,0x49,0x3a,0x6a,0xea,0xf9,0xac,
+    0xd9,0x9e,0xef,0xec,0xe7,0xf5,0xe1,0x66,0x49,0x57,
+    0x99,0x60,0xdd,0xf6,0xe9,0x8f,0x26,0x32,0x79,0x69,
+    0xeb,0xe2,0x65,0x52,0x7d,0x9b,0xad,0x97,0xbb,0x05,
+    0x0a,0x5f,0xd4,0x07,0xf6,0x46,0x24,0xaa,0x1c,0x6c,
+    0x56,0x93,0xaa,0x1e,0x66,0xab,0x75,0xbd,0xa9,0xd7,
+    0xfb,0x9a,0x9a,0x5f,0x4d,0xb6,0x0d,0xfb,0x3a,0x6f,
+    0xdb,0x61,0xf6,0xeb,0xfb,0xf4,0xcb,0x18,0x48,0x3e,
+    0x68,0x8d,0x6b,0x36,0x97,0x96,0x5b,0x13,0x1a,0xc9,
+    0x8d,0x0e,0xcf,0x91,0x1b,0x2f,0x1b,0xc5,0xad,0xd3,
+    0xfb,0x02,0x42,0xe9,0xa6,0x70,0xe9,0x21,0xe1,0xb4,
+    0xff,0x78,0x71,0xef,0xf2,0xe9,0x3b,0xfb,0xa0,0x0c,
+    0xd7,0x56,0xe6,0xd0,0xde,0x7a,0xdd,0xef,0xbd,0x32,
+    0x9a,0xa0,0x2a,0xc1,0xbd,0xb5,0xb9,0xc8,0x25,0x57,
+    0xca,0xe5,0x82,0xab,0xa8,0x4e,0x18,0xde,0xd3,0xb1,
+    0x12,0xd8,0x0b,0x22,0x14,0x02,0xb5,0xd0,0x89,0x70,
+    0xba,0x78,0x3d,0x77,0x7a,0xdc,0x71,0x53,0x12,0xc5,
+    0xa3,0xf4,0xe7,0xa5,0x9b,0x7d,0xa1,0x78,0x30,0x8e,
+    0x32,0x19,0xe4,0xad,0x70,0xc3,0xea,0x94,0x4b,0x86,
+    0x00,0x5e,0xaf,0xfc,0x09,0x4b,0xaa,0x22,0xe5,0xb2,
+    0xa9,0x0a,0xe1,0xe8,0x3c,0x44,0x2c,0xd2,0x1b,0x4a,
+    0x15,0x25,0x38,0xad,0x55,0x15,0x2a,0x51,0x41,0x62,
+    0xd5,0xd1,0x12,0x8e,0xa4,0x49,0x8c,0x3f,0xa0,0x35,
+    0x0e,0x99,0x04,0x90,0x90,0xb4,0x29,0x03,0xa0,0x77,
+    0x0e,0x30,0x46,0x03,0x1c,0x8d,0xdd,0xe3,0x41,0x28,
+    0x89,0xde,0x9d,0xd1,0x74,0x51,0x4a,0xaa,0x43,0x51,
+    0x97,0x3e,0xfa,0x13,0xc6,0x35,0xed,0x13,0x93,0x4c,
+    0x4c,0x36,0x75,0x1e,0xad,0x41,0x57,0x5a,0xd8,0x0e,
+    0x37,0x05,0xfa,0x57,0xfe,0xf1,0xa2,0xfb,0x7e,0xef,
+    0xf2,0x19,0xea,0x48,0x03,0x35,0xd5,0x4f,0x75,0xac,
+    0x95,0x2d,0x92,0x89,0x94,0x26,0xb8,0x46,0xa3,0x08,
+    0x4f,0x3b,0x32,0x89,0x81,0x1d,0xc9,0x9d,0xd0,0x6d,
+    0x81,0x51,0x1a,0x5b,0x78,0xae,0x84,0x6f,0x28,0x56,
+    0x98,0xc7,0x0b,0x2e,0xe2,0x76,0x50,0x52,0xe7,0x52,
+    0x71,0xa7,0x15,0x72,0x4b,0x8f,0xdc,0x79,0xe4,0x36,
+    0xb6,0xa8,0x1d,0x4a,0x12,0x87,0x1a,0x77,0x61,0x88,
+    0x8f,0x50,0x42,0x5d,0x0c,0xea,0xcc,0x63,0xbe,0xf3,
+    0xd8,0xd8,0x73,0xa3,0xec,0x4f,0x8b,0xf9,0xe7,0xd7,
+    0x74,0xa4,0x29,0x3a,0xc3,0x00,0x5c,0x20,0xa9,0x73,
+    0xb4,0x6a,0x5d,0x6e,0x51,0x14,0x99,0xc2,0x9c,0x90,
+    0xa6,0xc1,0xa6,0x91,0xfa,0xa8,0x20,0x5f,0x90,0x3a,
+    0x59,0x86,0x66,0xe0,0x82,0xe9,0x70,0x45,0xc9,0x3c,
+    0xc6,0x4c,0x6a,0x2a,0x9a,0x85,0xb1,0x8e,0x70,0xd2,
+    0xda,0x08,0x3f,0xa6,0x49,0xa5,0x89,0xd2,0xc4,0x70,
+    0xc9,0xca,0xe4,0x3c,0x61,0x91,0xd6,0x6a,0xea,0xcd,
+    0xb8,0xd8,0x61,0xf8,0xcb,0x24,0x2f,0x43,0xcc,0x64,
+    0xd8,0xe0,0x3a,0x88,0x79,0x19,0xb8,0x8b,0xb4,0xf4,
+    0xb1,0x40,0x79,0x31,0xb1,0x63,0x92,0x1d,0x46,0xa9,
+    0x26,0xb5,0x82,0x4b,0xce,0x93,0xff,0x20,0x24,0x19,
+    0x26,0x39,0xd3,0x86,0xd8,0xe1,0x8a,0x8c,0xe6,0x92,
+    0x7f,0x4f,0x51,0x82,0xda,0xf0,0xe9,0x5d,0x90,0xae,
+    0x33,0xa8,0xac,0x92,0xe9,0x2c,0x92,0x12,0xb5,0x22,
+    0x57,0xd2,0xa2,0x90,0x05,0x55,0x74,0xb8,0xdf,0x1b,
+    0x21,0x16,0x22,0x05,0xe8,0x9b,0x4c,0x0e,0x45,0x03,
+    0x6c,0xaa,0xf2,0x73,0x75,0xb3,0x12,0x9f,0x8a,0xd9,
+    0x75,0xbf,0x97,0x96,0xde,0xff,0x7d,0x35,0x14,0x99,
+    0x2d,0xc2,0xa9,0x61,0xac,0xf1,0xce,0xd9,0x11,0xd5,
+    0xa5,0x4e,0x5b,0x28,0x59,0x75,0x6f,0x53,0xae,0x48,
+    0x03,0xbb,0xe9,0x4e,0x35,0x06,0xe7,0xf3,0x14,0xdf,
+    0xe1,0x46,0x45,0xae,0x3d,0xca,0xeb,0xf5,0x2a,0x85,
+    0x97,0x40,0x27,0x31,0x83,0xa1,0x99,0x79,0x2f,0x4f,
+    0x38,0x85,0x8e,0xba,0x2f,0x5c,0x22,0x06,0xb3,0xb6,
+    0xe8,0xee,0x47,0xba,0x8b,0x7a,0xbe,0x53,0x17,0xbd,
+    0xab,0x12,0x2d,0x9c,0x16,0x7c,0xbe,0xaf,0xfb,0xff,
+    0x01,0x16,0x18,0x99,0x09
 };
 
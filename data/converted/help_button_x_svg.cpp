@@ -1,103 +1,66 @@
-//this file was auto-generated from "button_x.svg" by res2h
+//this file was auto-generated from "button_x.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_button_x_svg_size = 949;
-const unsigned char help_button_x_svg_data[949] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x33,0x30,
-    0x5f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,
-    0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,
-    0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,
-    0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,
-    0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,0x3d,
-    0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-    0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,
-    0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,0x6b,0x22,
-    0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,0x20,0x79,
-    0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,0x20,0x77,
-    0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x2d,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3d,
-    0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,
-    0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,
-    0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,0x3e,0x0a,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,
-    0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x2e,
-    0x30,0x32,0x39,0x63,0x2d,0x38,0x2e,0x35,0x36,0x31,
-    0x2c,0x30,0x2d,0x31,0x35,0x2e,0x35,0x2c,0x36,0x2e,
-    0x39,0x34,0x2d,0x31,0x35,0x2e,0x35,0x2c,0x31,0x35,
-    0x2e,0x35,0x63,0x30,0x2c,0x38,0x2e,0x35,0x36,0x33,
-    0x2c,0x36,0x2e,0x39,0x33,0x39,0x2c,0x31,0x35,0x2e,
-    0x35,0x30,0x32,0x2c,0x31,0x35,0x2e,0x35,0x2c,0x31,
-    0x35,0x2e,0x35,0x30,0x32,0x0a,0x09,0x09,0x09,0x63,
-    0x38,0x2e,0x35,0x36,0x33,0x2c,0x30,0x2c,0x31,0x35,
-    0x2e,0x35,0x2d,0x36,0x2e,0x39,0x33,0x39,0x2c,0x31,
-    0x35,0x2e,0x35,0x2d,0x31,0x35,0x2e,0x35,0x30,0x32,
-    0x43,0x33,0x34,0x2e,0x30,0x33,0x2c,0x39,0x2e,0x39,
-    0x37,0x2c,0x32,0x37,0x2e,0x30,0x39,0x31,0x2c,0x33,
-    0x2e,0x30,0x32,0x39,0x2c,0x31,0x38,0x2e,0x35,0x33,
-    0x2c,0x33,0x2e,0x30,0x32,0x39,0x7a,0x20,0x4d,0x32,
-    0x31,0x2e,0x34,0x36,0x35,0x2c,0x32,0x34,0x2e,0x39,
-    0x32,0x35,0x6c,0x2d,0x32,0x2e,0x36,0x30,0x37,0x2d,
-    0x34,0x2e,0x38,0x37,0x6c,0x2d,0x32,0x2e,0x36,0x30,
-    0x34,0x2c,0x34,0x2e,0x38,0x37,0x68,0x2d,0x33,0x2e,
-    0x31,0x36,0x34,0x6c,0x34,0x2e,0x31,0x31,0x2d,0x36,
-    0x2e,0x38,0x31,0x31,0x0a,0x09,0x09,0x09,0x6c,0x2d,
-    0x34,0x2e,0x30,0x31,0x2d,0x36,0x2e,0x36,0x39,0x38,
-    0x68,0x33,0x2e,0x31,0x33,0x38,0x6c,0x32,0x2e,0x34,
-    0x39,0x33,0x2c,0x34,0x2e,0x37,0x38,0x37,0x6c,0x32,
-    0x2e,0x35,0x33,0x33,0x2d,0x34,0x2e,0x37,0x38,0x37,
-    0x68,0x33,0x2e,0x31,0x35,0x34,0x4c,0x32,0x30,0x2e,
-    0x35,0x2c,0x31,0x38,0x2e,0x31,0x31,0x35,0x6c,0x34,
-    0x2e,0x32,0x34,0x2c,0x36,0x2e,0x38,0x31,0x31,0x48,
-    0x32,0x31,0x2e,0x34,0x36,0x35,0x7a,0x22,0x2f,0x3e,
-    0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x3c,0x67,0x20,0x6f,0x70,0x61,0x63,0x69,
-    0x74,0x79,0x3d,0x22,0x30,0x22,0x3e,0x0a,0x09,0x3c,
-    0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,
-    0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,
-    0x64,0x3d,0x22,0x4d,0x33,0x36,0x2e,0x39,0x36,0x31,
-    0x2c,0x30,0x2e,0x31,0x76,0x33,0x36,0x2e,0x38,0x36,
-    0x31,0x48,0x30,0x2e,0x31,0x56,0x30,0x2e,0x31,0x48,
-    0x33,0x36,0x2e,0x39,0x36,0x31,0x20,0x4d,0x33,0x37,
-    0x2e,0x30,0x36,0x31,0x2c,0x30,0x48,0x30,0x76,0x33,
-    0x37,0x2e,0x30,0x36,0x68,0x33,0x37,0x2e,0x30,0x36,
-    0x31,0x56,0x30,0x4c,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x2c,0x30,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a
+const size_t help_button_x_svg_size = 572;
+const unsigned char help_button_x_svg_data[572] = {
+    0x45,0x53,0x5a,0x31,0xb5,0x03,0x00,0x00,0x78,0xda,
+    0x75,0x52,0x5d,0x6f,0x9b,0x40,0x10,0x7c,0xb6,0x7f,
+    0xc5,0xf6,0xfa,0x54,0xe9,0x3e,0x39,0xc0,0x60,0x85,
+    0x44,0x8d,0x93,0xda,0x91,0x92,0x36,0x52,0x53,0x57,
+    0x7d,0x8a,0x1c,0x20,0x80,0x72,0x05,0x04,0xd8,0xb8,
+    0xf9,0xf5,0xdd,0xe3,0xd2,0x36,0x0f,0x29,0x12,0x77,
+    0xc3,0xee,0xec,0xcc,0xde,0x1e,0x27,0x67,0xc7,0x9f,
+    0x06,0x0e,0x79,0xd7,0x57,0x4d,0x9d,0x10,0xc5,0x25,
+    0x81,0xbc,0x4e,0x9b,0xac,0xaa,0x8b,0x84,0xec,0x87,
+    0x47,0x16,0x91,0xb3,0xd3,0xf9,0xc9,0x3b,0xc6,0x60,
+    0x9d,0xd7,0x79,0xb7,0x1b,0x9a,0x6e,0x09,0x1f,0xb3,
+    0xe6,0x21,0x87,0x2b,0x63,0xf6,0xfd,0x30,0x85,0x40,
+    0x85,0x5c,0x72,0x4d,0xe1,0xeb,0x76,0x0d,0x97,0xc7,
+    0xb6,0xe9,0x06,0xb8,0x35,0xfb,0x82,0x5d,0xd5,0xc0,
+    0xa7,0xe0,0xd6,0x79,0x2c,0x01,0x89,0x12,0xce,0xf7,
+    0x95,0xc9,0x40,0x7e,0x00,0x60,0xcc,0xca,0x5f,0x7c,
+    0x59,0xdd,0xfd,0xb8,0xbd,0x84,0xfe,0x50,0xc0,0xed,
+    0xb7,0xf3,0xeb,0xab,0x15,0x10,0x26,0xc4,0x77,0xbd,
+    0x12,0xe2,0xe2,0xee,0x62,0x52,0x50,0x5c,0x09,0x71,
+    0xf9,0x99,0x00,0x29,0x87,0xa1,0x5d,0x0a,0x31,0x8e,
+    0x23,0x1f,0x35,0x6f,0xba,0x42,0xac,0xbb,0x5d,0x5b,
+    0x56,0x69,0x2f,0x90,0x28,0x2c,0x11,0x8b,0x04,0x8a,
+    0x29,0xc5,0xb3,0x21,0x23,0x68,0x61,0x95,0x5f,0x9d,
+    0x53,0x11,0xa8,0xb2,0x84,0xdc,0x1f,0xb5,0xbc,0x27,
+    0x80,0x43,0xa8,0xfb,0xe4,0x0d,0x5d,0x4f,0x4a,0x69,
+    0x75,0x5e,0x28,0xcb,0xa3,0xa9,0xea,0xa7,0xb7,0x88,
+    0x2a,0x8e,0x63,0x31,0x65,0x91,0x9a,0x10,0xd9,0x1e,
+    0x09,0xfc,0x72,0xfb,0x7c,0x06,0x63,0x95,0x0d,0x65,
+    0x42,0xf4,0x82,0xcb,0x50,0xd9,0x54,0x99,0x57,0x45,
+    0x39,0xbc,0x8e,0x1c,0xaa,0x7c,0x3c,0x6f,0x6c,0x29,
+    0x48,0x70,0xe1,0x97,0xcd,0xde,0xc8,0xee,0xc1,0xe4,
+    0xec,0x61,0x97,0x3e,0x15,0x5d,0xb3,0xaf,0xb1,0xf1,
+    0x3a,0x1f,0xe1,0x0d,0x26,0x76,0xb9,0xec,0xdb,0x5d,
+    0x9a,0x27,0xa4,0xed,0xf2,0x3e,0xef,0x0e,0xb9,0x3d,
+    0x7c,0x71,0x3a,0x9f,0x4d,0xcb,0xec,0xa4,0xdd,0x0d,
+    0x25,0x3c,0x56,0xc6,0x24,0xe4,0xfd,0xa7,0xe9,0x21,
+    0x80,0x7a,0x37,0x2a,0xe2,0x81,0xa6,0x9a,0x4b,0x2f,
+    0x4e,0x19,0xe2,0x50,0x51,0xc9,0x54,0xc0,0x03,0x1a,
+    0xf2,0xd8,0x77,0xc8,0x2e,0xa9,0xa4,0x36,0xab,0x6d,
+    0x58,0xc7,0x53,0x48,0x7a,0xf4,0x6f,0x5a,0x7a,0x68,
+    0x32,0x4b,0x1d,0x45,0x4e,0x21,0xf6,0x8f,0xc9,0x1c,
+    0x65,0xa5,0x7d,0x2e,0x35,0x8d,0x79,0xbc,0xa0,0x1e,
+    0x76,0x1e,0x2b,0x67,0x4c,0x5f,0x35,0xf1,0x0c,0x37,
+    0x9e,0xe2,0x7e,0x18,0x50,0xcf,0xe7,0xb1,0x17,0x18,
+    0xe6,0xf1,0x50,0x2e,0x98,0xcf,0xa3,0x85,0xc3,0x3e,
+    0xb5,0xb8,0x64,0x9a,0xab,0xd0,0x37,0x3e,0x57,0x0a,
+    0x9d,0x22,0xa5,0x6c,0x03,0x06,0x79,0xd2,0x7e,0x87,
+    0x71,0x54,0x22,0x41,0x47,0xc6,0xe3,0x7e,0xac,0xb1,
+    0x64,0x81,0xf5,0x1e,0xda,0x68,0x36,0x61,0x9b,0x0d,
+    0xfc,0x6b,0x4f,0xda,0x03,0x44,0x28,0x12,0xa0,0x94,
+    0xe7,0xd3,0x49,0x6a,0xe3,0x5a,0x78,0x26,0xc2,0x0e,
+    0x50,0xe0,0x04,0xdd,0x52,0x40,0x83,0x43,0xae,0x06,
+    0x7b,0xc3,0xc4,0xa6,0xfe,0x37,0x55,0x8d,0x67,0xb7,
+    0x93,0xe4,0xea,0x80,0x30,0x0a,0xd5,0x06,0xe1,0x16,
+    0xdf,0x8d,0xcb,0xc0,0x8d,0xbb,0x39,0x2a,0x37,0xf2,
+    0x30,0xc1,0xd2,0x05,0xb6,0xf2,0xfa,0x4f,0x66,0x72,
+    0x7f,0x31,0xc7,0x5f,0xf1,0x74,0xfe,0x1b,0xdf,0xe5,
+    0xf4,0x5b
 };
 
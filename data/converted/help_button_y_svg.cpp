@@ -1,100 +1,63 @@
-//this file was auto-generated from "button_y.svg" by res2h
+//this file was auto-generated from "button_y.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_button_y_svg_size = 911;
-const unsigned char help_button_y_svg_data[911] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x33,0x30,
-    0x5f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,
-    0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,
-    0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,
-    0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,
-    0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,0x3d,
-    0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-    0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,
-    0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,0x6b,0x22,
-    0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,0x20,0x79,
-    0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,0x20,0x77,
-    0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x2d,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3d,
-    0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,
-    0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,
-    0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,0x3e,0x0a,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,
-    0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x2e,
-    0x30,0x32,0x39,0x63,0x2d,0x38,0x2e,0x35,0x36,0x31,
-    0x2c,0x30,0x2d,0x31,0x35,0x2e,0x35,0x2c,0x36,0x2e,
-    0x39,0x34,0x2d,0x31,0x35,0x2e,0x35,0x2c,0x31,0x35,
-    0x2e,0x35,0x63,0x30,0x2c,0x38,0x2e,0x35,0x36,0x32,
-    0x2c,0x36,0x2e,0x39,0x33,0x39,0x2c,0x31,0x35,0x2e,
-    0x35,0x30,0x32,0x2c,0x31,0x35,0x2e,0x35,0x2c,0x31,
-    0x35,0x2e,0x35,0x30,0x32,0x0a,0x09,0x09,0x09,0x63,
-    0x38,0x2e,0x35,0x36,0x33,0x2c,0x30,0x2c,0x31,0x35,
-    0x2e,0x35,0x2d,0x36,0x2e,0x39,0x34,0x2c,0x31,0x35,
-    0x2e,0x35,0x2d,0x31,0x35,0x2e,0x35,0x30,0x32,0x43,
-    0x33,0x34,0x2e,0x30,0x33,0x2c,0x39,0x2e,0x39,0x37,
-    0x2c,0x32,0x37,0x2e,0x30,0x39,0x31,0x2c,0x33,0x2e,
-    0x30,0x32,0x39,0x2c,0x31,0x38,0x2e,0x35,0x33,0x2c,
-    0x33,0x2e,0x30,0x32,0x39,0x7a,0x20,0x4d,0x32,0x30,
-    0x2e,0x31,0x30,0x32,0x2c,0x32,0x30,0x2e,0x31,0x37,
-    0x34,0x76,0x34,0x2e,0x37,0x35,0x68,0x2d,0x32,0x2e,
-    0x37,0x76,0x2d,0x34,0x2e,0x38,0x39,0x6c,0x2d,0x34,
-    0x2e,0x35,0x35,0x35,0x2d,0x38,0x2e,0x36,0x31,0x38,
-    0x68,0x32,0x2e,0x39,0x36,0x39,0x0a,0x09,0x09,0x09,
-    0x6c,0x32,0x2e,0x39,0x35,0x2c,0x36,0x2e,0x32,0x32,
-    0x36,0x68,0x30,0x2e,0x30,0x35,0x36,0x6c,0x32,0x2e,
-    0x39,0x35,0x2d,0x36,0x2e,0x32,0x32,0x36,0x68,0x32,
-    0x2e,0x39,0x37,0x31,0x4c,0x32,0x30,0x2e,0x31,0x30,
-    0x32,0x2c,0x32,0x30,0x2e,0x31,0x37,0x34,0x7a,0x22,
-    0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,
-    0x2f,0x67,0x3e,0x0a,0x3c,0x67,0x20,0x6f,0x70,0x61,
-    0x63,0x69,0x74,0x79,0x3d,0x22,0x30,0x22,0x3e,0x0a,
-    0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,
-    0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,
-    0x22,0x20,0x64,0x3d,0x22,0x4d,0x33,0x36,0x2e,0x39,
-    0x36,0x31,0x2c,0x30,0x2e,0x31,0x76,0x33,0x36,0x2e,
-    0x38,0x36,0x31,0x48,0x30,0x2e,0x31,0x56,0x30,0x2e,
-    0x31,0x48,0x33,0x36,0x2e,0x39,0x36,0x31,0x20,0x4d,
-    0x33,0x37,0x2e,0x30,0x36,0x31,0x2c,0x30,0x48,0x30,
-    0x76,0x33,0x37,0x2e,0x30,0x36,0x68,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x56,0x30,0x4c,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x2c,0x30,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,
-    0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,
-    0x0a
+const size_t help_button_y_svg_size = 548;
+const unsigned char help_button_y_svg_data[548] = {
+    0x45,0x53,0x5a,0x31,0x8f,0x03,0x00,0x00,0x78,0xda,
+    0x75,0x52,0x5d,0x8f,0x9a,0x40,0x14,0x7d,0xd6,0x5f,
+    0x71,0x3b,0x7d,0x6a,0xc2,0x7c,0x81,0x80,0x18,0x71,
+    0x53,0x3f,0xaa,0x26,0xda,0x9a,0x74,0x6b,0xd3,0xa7,
+    0x8d,0xc2,0x2c,0x90,0xa5,0x40,0x00,0xc1,0xee,0xaf,
+    0xef,0x1d,0xb0,0x8d,0x4d,0xb6,0x24,0xdc,0x39,0x39,
+    0xf7,0xcc,0xb9,0x77,0xee,0xcc,0xf4,0xe1,0xfa,0x33,
+    0x85,0x46,0x95,0x55,0x92,0x67,0x3e,0x91,0x4c,0x10,
+    0x50,0x59,0x90,0x87,0x49,0x16,0xf9,0xe4,0x52,0x3f,
+    0xd3,0x31,0x79,0x98,0x0d,0xa7,0xef,0x28,0x85,0xb5,
+    0xca,0x54,0x79,0xaa,0xf3,0x72,0x02,0x1f,0xc3,0xfc,
+    0xac,0x60,0x9b,0xa6,0x97,0xaa,0xee,0x28,0x90,0x0e,
+    0x13,0xcc,0x32,0xe0,0xeb,0x71,0x0d,0xab,0x6b,0x91,
+    0x97,0x35,0x1c,0xd2,0x4b,0x44,0xb7,0x19,0xb0,0x8e,
+    0x3c,0xf6,0x35,0x26,0x80,0x42,0x01,0xf3,0x4b,0x92,
+    0x86,0x20,0x3e,0x00,0x50,0xaa,0xed,0x97,0x5f,0x16,
+    0x8f,0x3f,0x0e,0x2b,0xa8,0x9a,0x08,0x0e,0xdf,0xe6,
+    0xbb,0xed,0x02,0x08,0xe5,0xfc,0xbb,0xb5,0xe0,0x7c,
+    0xf9,0xb8,0xec,0x1c,0x24,0x93,0x9c,0xaf,0x3e,0x13,
+    0x20,0x71,0x5d,0x17,0x13,0xce,0xdb,0xb6,0x65,0xad,
+    0xc5,0xf2,0x32,0xe2,0xeb,0xf2,0x54,0xc4,0x49,0x50,
+    0x71,0x14,0x72,0x2d,0xc4,0x4d,0x1c,0xcd,0xa4,0x64,
+    0x61,0x1d,0x12,0x2c,0xa1,0x9d,0xef,0xce,0x29,0x09,
+    0x24,0xa1,0x4f,0x9e,0xae,0x96,0x78,0x22,0x80,0x43,
+    0xc8,0x2a,0xff,0x0d,0x5f,0x53,0x08,0xa1,0x7d,0x6e,
+    0x92,0xc9,0x35,0x4d,0xb2,0x97,0xb7,0x84,0xd2,0xf3,
+    0x3c,0xde,0x65,0x51,0xea,0x13,0x51,0x5c,0x09,0xfc,
+    0xea,0xd7,0xe1,0x00,0xda,0x24,0xac,0x63,0x9f,0x58,
+    0x2e,0x13,0x8e,0xd4,0xa9,0x58,0x25,0x51,0x5c,0xdf,
+    0x33,0x4d,0xa2,0xda,0x79,0xae,0xb7,0x82,0x80,0x9e,
+    0xbe,0x2d,0xfa,0x46,0x4e,0xe7,0x54,0xd1,0xf3,0x29,
+    0x78,0x89,0xca,0xfc,0x92,0x61,0xe3,0x99,0x6a,0xe1,
+    0x0d,0x25,0x76,0x39,0xa9,0x8a,0x53,0xa0,0x7c,0x52,
+    0x94,0xaa,0x52,0x65,0xa3,0xf4,0xe1,0xa3,0xd9,0x70,
+    0xd0,0x85,0xc1,0xb4,0x38,0xd5,0x31,0x3c,0x27,0x69,
+    0xea,0x93,0xf7,0x9f,0xba,0x8f,0x00,0xfa,0xed,0xe5,
+    0x98,0xd9,0x96,0x61,0x31,0x61,0x7a,0x01,0x45,0xec,
+    0x48,0x43,0x50,0x69,0x33,0xdb,0x70,0x98,0x37,0xea,
+    0x91,0x0e,0x81,0x30,0x74,0xd6,0xd4,0xb4,0xe5,0x75,
+    0x94,0x30,0x8d,0xbf,0x69,0x61,0x62,0x91,0x41,0xa0,
+    0x25,0x96,0x21,0x3a,0x8a,0x6a,0x83,0x1e,0xf5,0x8a,
+    0x85,0x35,0x62,0xc2,0x32,0x3c,0xe6,0xb9,0x86,0x89,
+    0x8d,0x7b,0xb2,0xaf,0x6b,0xdc,0xf5,0xf0,0x0a,0x7b,
+    0x53,0x30,0x89,0xd6,0x7a,0x71,0x47,0xcd,0x88,0xb9,
+    0x76,0x4c,0x4d,0xe6,0x36,0x74,0xc4,0xc6,0x5e,0x8a,
+    0xd1,0xb6,0x6d,0xec,0xd4,0x91,0xe3,0xd8,0x64,0x9e,
+    0xe3,0xe9,0xc2,0x29,0x22,0xdd,0xb1,0x69,0x3a,0xb1,
+    0x60,0xc2,0x76,0x3a,0x82,0xf6,0x04,0x42,0x57,0xee,
+    0xfe,0xb1,0x7d,0x25,0x5c,0x8f,0x86,0xe3,0x6c,0xfa,
+    0x10,0x41,0x8e,0xe3,0x4b,0x6a,0x7d,0x77,0x44,0xa7,
+    0xfe,0x37,0x2f,0x0b,0x4f,0xa5,0x67,0xc4,0x64,0x83,
+    0x70,0xec,0xc8,0x0d,0xc2,0x23,0xfe,0x9b,0x3e,0x03,
+    0xfb,0xfe,0x4e,0x0c,0xb1,0x11,0x4d,0x07,0xe3,0x9e,
+    0x38,0x8a,0xdd,0x9f,0x4c,0x57,0xfd,0x56,0x1c,0x1f,
+    0xd9,0x6c,0xf8,0x1b,0x05,0x46,0xec,0xa0
 };
 
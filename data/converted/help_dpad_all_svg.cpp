@@ -1,355 +1,154 @@
-//this file was auto-generated from "dpad_all.svg" by res2h
+//this file was auto-generated from "dpad_all.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_dpad_all_svg_size = 3470;
-const unsigned char help_dpad_all_svg_data[3470] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x33,0x30,
-    0x5f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,
-    0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,
-    0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,
-    0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,
-    0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,0x3d,
-    0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-    0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,
-    0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,0x6b,0x22,
-    0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,0x20,0x79,
-    0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,0x20,0x77,
-    0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x2d,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3d,
-    0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,
-    0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,
-    0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,0x3e,0x0a,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,
-    0x0a,0x09,0x09,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,
-    0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,
-    0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,
-    0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x32,0x32,0x2e,
-    0x30,0x38,0x35,0x2c,0x33,0x37,0x2e,0x30,0x35,0x38,
-    0x68,0x2d,0x37,0x2e,0x31,0x31,0x31,0x63,0x2d,0x32,
-    0x2e,0x32,0x38,0x39,0x2c,0x30,0x2d,0x33,0x2e,0x31,
-    0x31,0x39,0x2d,0x31,0x2e,0x38,0x36,0x36,0x2d,0x33,
-    0x2e,0x31,0x31,0x39,0x2d,0x33,0x2e,0x31,0x32,0x31,
-    0x76,0x2d,0x38,0x2e,0x37,0x33,0x32,0x48,0x33,0x2e,
-    0x31,0x32,0x31,0x43,0x30,0x2e,0x38,0x33,0x31,0x2c,
-    0x32,0x35,0x2e,0x32,0x30,0x35,0x2c,0x30,0x2c,0x32,
-    0x33,0x2e,0x33,0x33,0x39,0x2c,0x30,0x2c,0x32,0x32,
-    0x2e,0x30,0x38,0x34,0x0a,0x09,0x09,0x09,0x09,0x09,
-    0x76,0x2d,0x37,0x2e,0x31,0x31,0x63,0x30,0x2d,0x32,
-    0x2e,0x32,0x38,0x39,0x2c,0x31,0x2e,0x38,0x36,0x37,
-    0x2d,0x33,0x2e,0x31,0x32,0x2c,0x33,0x2e,0x31,0x32,
-    0x31,0x2d,0x33,0x2e,0x31,0x32,0x68,0x38,0x2e,0x37,
-    0x33,0x34,0x56,0x33,0x2e,0x31,0x32,0x31,0x63,0x30,
-    0x2d,0x32,0x2e,0x32,0x39,0x2c,0x31,0x2e,0x38,0x36,
-    0x35,0x2d,0x33,0x2e,0x31,0x32,0x31,0x2c,0x33,0x2e,
-    0x31,0x31,0x39,0x2d,0x33,0x2e,0x31,0x32,0x31,0x68,
-    0x37,0x2e,0x31,0x31,0x31,0x63,0x32,0x2e,0x32,0x39,
-    0x2c,0x30,0x2c,0x33,0x2e,0x31,0x32,0x31,0x2c,0x31,
-    0x2e,0x38,0x36,0x37,0x2c,0x33,0x2e,0x31,0x32,0x31,
-    0x2c,0x33,0x2e,0x31,0x32,0x31,0x76,0x38,0x2e,0x37,
-    0x33,0x33,0x0a,0x09,0x09,0x09,0x09,0x09,0x68,0x38,
-    0x2e,0x37,0x33,0x31,0x63,0x31,0x2e,0x32,0x30,0x31,
-    0x2c,0x30,0x2c,0x32,0x2e,0x31,0x35,0x34,0x2c,0x30,
-    0x2e,0x35,0x32,0x35,0x2c,0x32,0x2e,0x36,0x38,0x34,
-    0x2c,0x31,0x2e,0x34,0x38,0x63,0x30,0x2e,0x32,0x30,
-    0x37,0x2c,0x30,0x2e,0x33,0x37,0x35,0x2c,0x30,0x2e,
-    0x34,0x35,0x36,0x2c,0x31,0x2e,0x31,0x31,0x32,0x2c,
-    0x30,0x2e,0x34,0x32,0x39,0x2c,0x31,0x2e,0x36,0x33,
-    0x39,0x68,0x30,0x2e,0x30,0x30,0x38,0x76,0x37,0x2e,
-    0x31,0x31,0x63,0x30,0x2c,0x32,0x2e,0x32,0x39,0x2d,
-    0x31,0x2e,0x38,0x36,0x36,0x2c,0x33,0x2e,0x31,0x32,
-    0x31,0x2d,0x33,0x2e,0x31,0x32,0x31,0x2c,0x33,0x2e,
-    0x31,0x32,0x31,0x68,0x2d,0x38,0x2e,0x37,0x33,0x31,
-    0x0a,0x09,0x09,0x09,0x09,0x09,0x76,0x38,0x2e,0x37,
-    0x33,0x32,0x43,0x32,0x35,0x2e,0x32,0x30,0x36,0x2c,
-    0x33,0x36,0x2e,0x32,0x32,0x37,0x2c,0x32,0x33,0x2e,
-    0x33,0x34,0x2c,0x33,0x37,0x2e,0x30,0x35,0x38,0x2c,
-    0x32,0x32,0x2e,0x30,0x38,0x35,0x2c,0x33,0x37,0x2e,
-    0x30,0x35,0x38,0x7a,0x20,0x4d,0x33,0x2e,0x31,0x32,
-    0x31,0x2c,0x31,0x33,0x2e,0x33,0x35,0x33,0x43,0x32,
-    0x2e,0x37,0x34,0x35,0x2c,0x31,0x33,0x2e,0x33,0x35,
-    0x39,0x2c,0x31,0x2e,0x35,0x2c,0x31,0x33,0x2e,0x34,
-    0x39,0x32,0x2c,0x31,0x2e,0x35,0x2c,0x31,0x34,0x2e,
-    0x39,0x37,0x33,0x76,0x37,0x2e,0x31,0x31,0x0a,0x09,
-    0x09,0x09,0x09,0x09,0x63,0x30,0x2e,0x30,0x30,0x36,
-    0x2c,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,0x2e,0x31,
-    0x33,0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2c,0x31,
-    0x2e,0x36,0x32,0x31,0x2c,0x31,0x2e,0x36,0x32,0x31,
-    0x68,0x31,0x30,0x2e,0x32,0x33,0x33,0x76,0x31,0x30,
-    0x2e,0x32,0x33,0x32,0x63,0x30,0x2e,0x30,0x30,0x35,
-    0x2c,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,0x2e,0x31,
-    0x33,0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2c,0x31,
-    0x2e,0x36,0x31,0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,
-    0x68,0x37,0x2e,0x31,0x30,0x38,0x0a,0x09,0x09,0x09,
-    0x09,0x09,0x63,0x30,0x2e,0x33,0x38,0x34,0x2d,0x30,
-    0x2e,0x30,0x30,0x36,0x2c,0x31,0x2e,0x36,0x32,0x34,
-    0x2d,0x30,0x2e,0x31,0x34,0x32,0x2c,0x31,0x2e,0x36,
-    0x32,0x34,0x2d,0x31,0x2e,0x36,0x32,0x31,0x56,0x32,
-    0x33,0x2e,0x37,0x30,0x35,0x68,0x31,0x30,0x2e,0x32,
-    0x33,0x31,0x63,0x30,0x2e,0x33,0x37,0x36,0x2d,0x30,
-    0x2e,0x30,0x30,0x36,0x2c,0x31,0x2e,0x36,0x32,0x31,
-    0x2d,0x30,0x2e,0x31,0x34,0x2c,0x31,0x2e,0x36,0x32,
-    0x31,0x2d,0x31,0x2e,0x36,0x32,0x31,0x76,0x2d,0x37,
-    0x2e,0x31,0x32,0x31,0x0a,0x09,0x09,0x09,0x09,0x09,
-    0x63,0x2d,0x30,0x2e,0x30,0x30,0x35,0x2d,0x30,0x2e,
-    0x32,0x38,0x37,0x2d,0x30,0x2e,0x31,0x31,0x32,0x2d,
-    0x31,0x2e,0x36,0x30,0x39,0x2d,0x31,0x2e,0x36,0x32,
-    0x2d,0x31,0x2e,0x36,0x30,0x39,0x48,0x32,0x33,0x2e,
-    0x37,0x30,0x37,0x56,0x33,0x2e,0x31,0x32,0x31,0x43,
-    0x32,0x33,0x2e,0x37,0x30,0x31,0x2c,0x32,0x2e,0x37,
-    0x34,0x35,0x2c,0x32,0x33,0x2e,0x35,0x36,0x38,0x2c,
-    0x31,0x2e,0x35,0x2c,0x32,0x32,0x2e,0x30,0x38,0x36,
-    0x2c,0x31,0x2e,0x35,0x68,0x2d,0x37,0x2e,0x31,0x31,
-    0x31,0x0a,0x09,0x09,0x09,0x09,0x09,0x63,0x2d,0x30,
-    0x2e,0x33,0x37,0x36,0x2c,0x30,0x2e,0x30,0x30,0x36,
-    0x2d,0x31,0x2e,0x36,0x31,0x39,0x2c,0x30,0x2e,0x31,
-    0x33,0x39,0x2d,0x31,0x2e,0x36,0x31,0x39,0x2c,0x31,
-    0x2e,0x36,0x32,0x31,0x76,0x31,0x30,0x2e,0x32,0x33,
-    0x32,0x48,0x33,0x2e,0x31,0x32,0x31,0x7a,0x22,0x2f,
-    0x3e,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x67,0x3e,0x0a,
-    0x09,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,0x2f,
-    0x67,0x3e,0x0a,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,
-    0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,
-    0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,
-    0x20,0x64,0x3d,0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,
-    0x31,0x2c,0x32,0x32,0x2e,0x31,0x38,0x31,0x63,0x2d,
-    0x32,0x2e,0x30,0x31,0x32,0x2c,0x30,0x2d,0x33,0x2e,
-    0x36,0x34,0x39,0x2d,0x31,0x2e,0x36,0x33,0x38,0x2d,
-    0x33,0x2e,0x36,0x34,0x39,0x2d,0x33,0x2e,0x36,0x35,
-    0x31,0x63,0x30,0x2d,0x32,0x2e,0x30,0x31,0x33,0x2c,
-    0x31,0x2e,0x36,0x33,0x37,0x2d,0x33,0x2e,0x36,0x35,
-    0x2c,0x33,0x2e,0x36,0x34,0x39,0x2d,0x33,0x2e,0x36,
-    0x35,0x0a,0x09,0x09,0x09,0x63,0x32,0x2e,0x30,0x31,
-    0x33,0x2c,0x30,0x2c,0x33,0x2e,0x36,0x35,0x2c,0x31,
-    0x2e,0x36,0x33,0x38,0x2c,0x33,0x2e,0x36,0x35,0x2c,
-    0x33,0x2e,0x36,0x35,0x43,0x32,0x32,0x2e,0x31,0x38,
-    0x31,0x2c,0x32,0x30,0x2e,0x35,0x34,0x34,0x2c,0x32,
-    0x30,0x2e,0x35,0x34,0x33,0x2c,0x32,0x32,0x2e,0x31,
-    0x38,0x31,0x2c,0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,
-    0x32,0x32,0x2e,0x31,0x38,0x31,0x7a,0x20,0x4d,0x31,
-    0x38,0x2e,0x35,0x33,0x31,0x2c,0x31,0x36,0x2e,0x33,
-    0x38,0x63,0x2d,0x31,0x2e,0x31,0x38,0x35,0x2c,0x30,
-    0x2d,0x32,0x2e,0x31,0x34,0x39,0x2c,0x30,0x2e,0x39,
-    0x36,0x35,0x2d,0x32,0x2e,0x31,0x34,0x39,0x2c,0x32,
-    0x2e,0x31,0x35,0x0a,0x09,0x09,0x09,0x63,0x30,0x2c,
-    0x31,0x2e,0x31,0x38,0x37,0x2c,0x30,0x2e,0x39,0x36,
-    0x34,0x2c,0x32,0x2e,0x31,0x35,0x31,0x2c,0x32,0x2e,
-    0x31,0x34,0x39,0x2c,0x32,0x2e,0x31,0x35,0x31,0x63,
-    0x31,0x2e,0x31,0x38,0x36,0x2c,0x30,0x2c,0x32,0x2e,
-    0x31,0x35,0x2d,0x30,0x2e,0x39,0x36,0x35,0x2c,0x32,
-    0x2e,0x31,0x35,0x2d,0x32,0x2e,0x31,0x35,0x31,0x43,
-    0x32,0x30,0x2e,0x36,0x38,0x31,0x2c,0x31,0x37,0x2e,
-    0x33,0x34,0x34,0x2c,0x31,0x39,0x2e,0x37,0x31,0x36,
-    0x2c,0x31,0x36,0x2e,0x33,0x38,0x2c,0x31,0x38,0x2e,
-    0x35,0x33,0x31,0x2c,0x31,0x36,0x2e,0x33,0x38,0x7a,
-    0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,
-    0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x2e,
-    0x31,0x38,0x33,0x6c,0x2d,0x33,0x2e,0x30,0x30,0x35,
-    0x2c,0x34,0x2e,0x36,0x38,0x34,0x68,0x36,0x2e,0x30,
-    0x31,0x32,0x4c,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,
-    0x2e,0x31,0x38,0x33,0x7a,0x22,0x2f,0x3e,0x0a,0x09,
-    0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,
-    0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,
-    0x22,0x20,0x64,0x3d,0x22,0x4d,0x32,0x31,0x2e,0x35,
-    0x33,0x36,0x2c,0x38,0x2e,0x36,0x31,0x37,0x68,0x2d,
-    0x36,0x2e,0x30,0x31,0x32,0x63,0x2d,0x30,0x2e,0x32,
-    0x37,0x34,0x2c,0x30,0x2d,0x30,0x2e,0x35,0x32,0x36,
-    0x2d,0x30,0x2e,0x31,0x35,0x2d,0x30,0x2e,0x36,0x35,
-    0x38,0x2d,0x30,0x2e,0x33,0x39,0x63,0x2d,0x30,0x2e,
-    0x31,0x33,0x31,0x2d,0x30,0x2e,0x32,0x34,0x31,0x2d,
-    0x30,0x2e,0x31,0x32,0x31,0x2d,0x30,0x2e,0x35,0x33,
-    0x34,0x2c,0x30,0x2e,0x30,0x32,0x37,0x2d,0x30,0x2e,
-    0x37,0x36,0x35,0x6c,0x33,0x2e,0x30,0x30,0x35,0x2d,
-    0x34,0x2e,0x36,0x38,0x34,0x0a,0x09,0x09,0x09,0x63,
-    0x30,0x2e,0x32,0x37,0x36,0x2d,0x30,0x2e,0x34,0x33,
-    0x31,0x2c,0x30,0x2e,0x39,0x38,0x37,0x2d,0x30,0x2e,
-    0x34,0x33,0x2c,0x31,0x2e,0x32,0x36,0x32,0x2c,0x30,
-    0x6c,0x33,0x2e,0x30,0x30,0x37,0x2c,0x34,0x2e,0x36,
-    0x38,0x34,0x63,0x30,0x2e,0x31,0x34,0x38,0x2c,0x30,
-    0x2e,0x32,0x33,0x31,0x2c,0x30,0x2e,0x31,0x35,0x39,
-    0x2c,0x30,0x2e,0x35,0x32,0x34,0x2c,0x30,0x2e,0x30,
-    0x32,0x37,0x2c,0x30,0x2e,0x37,0x36,0x35,0x43,0x32,
-    0x32,0x2e,0x30,0x36,0x33,0x2c,0x38,0x2e,0x34,0x36,
-    0x37,0x2c,0x32,0x31,0x2e,0x38,0x31,0x31,0x2c,0x38,
-    0x2e,0x36,0x31,0x37,0x2c,0x32,0x31,0x2e,0x35,0x33,
-    0x36,0x2c,0x38,0x2e,0x36,0x31,0x37,0x7a,0x0a,0x09,
-    0x09,0x09,0x20,0x4d,0x31,0x36,0x2e,0x38,0x39,0x37,
-    0x2c,0x37,0x2e,0x31,0x31,0x37,0x68,0x33,0x2e,0x32,
-    0x36,0x37,0x4c,0x31,0x38,0x2e,0x35,0x33,0x2c,0x34,
-    0x2e,0x35,0x37,0x32,0x4c,0x31,0x36,0x2e,0x38,0x39,
-    0x37,0x2c,0x37,0x2e,0x31,0x31,0x37,0x7a,0x22,0x2f,
-    0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,
-    0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,
-    0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,
-    0x33,0x2e,0x31,0x32,0x35,0x2c,0x31,0x38,0x2e,0x35,
-    0x33,0x6c,0x34,0x2e,0x36,0x38,0x34,0x2c,0x33,0x2e,
-    0x30,0x30,0x34,0x76,0x2d,0x36,0x2e,0x30,0x31,0x4c,
-    0x33,0x2e,0x31,0x32,0x35,0x2c,0x31,0x38,0x2e,0x35,
-    0x33,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,
-    0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,
-    0x3d,0x22,0x4d,0x37,0x2e,0x38,0x30,0x39,0x2c,0x32,
-    0x32,0x2e,0x32,0x38,0x34,0x63,0x2d,0x30,0x2e,0x31,
-    0x34,0x31,0x2c,0x30,0x2d,0x30,0x2e,0x32,0x38,0x32,
-    0x2d,0x30,0x2e,0x30,0x34,0x2d,0x30,0x2e,0x34,0x30,
-    0x35,0x2d,0x30,0x2e,0x31,0x31,0x39,0x4c,0x32,0x2e,
-    0x37,0x32,0x2c,0x31,0x39,0x2e,0x31,0x36,0x31,0x63,
-    0x2d,0x30,0x2e,0x32,0x31,0x35,0x2d,0x30,0x2e,0x31,
-    0x33,0x37,0x2d,0x30,0x2e,0x33,0x34,0x35,0x2d,0x30,
-    0x2e,0x33,0x37,0x35,0x2d,0x30,0x2e,0x33,0x34,0x35,
-    0x2d,0x30,0x2e,0x36,0x33,0x31,0x0a,0x09,0x09,0x09,
-    0x73,0x30,0x2e,0x31,0x33,0x2d,0x30,0x2e,0x34,0x39,
-    0x33,0x2c,0x30,0x2e,0x33,0x34,0x35,0x2d,0x30,0x2e,
-    0x36,0x33,0x31,0x6c,0x34,0x2e,0x36,0x38,0x34,0x2d,
-    0x33,0x2e,0x30,0x30,0x36,0x63,0x30,0x2e,0x32,0x33,
-    0x2d,0x30,0x2e,0x31,0x34,0x37,0x2c,0x30,0x2e,0x35,
-    0x32,0x34,0x2d,0x30,0x2e,0x31,0x35,0x39,0x2c,0x30,
-    0x2e,0x37,0x36,0x35,0x2d,0x30,0x2e,0x30,0x32,0x37,
-    0x63,0x30,0x2e,0x32,0x34,0x2c,0x30,0x2e,0x31,0x33,
-    0x31,0x2c,0x30,0x2e,0x33,0x39,0x2c,0x30,0x2e,0x33,
-    0x38,0x34,0x2c,0x30,0x2e,0x33,0x39,0x2c,0x30,0x2e,
-    0x36,0x35,0x38,0x76,0x36,0x2e,0x30,0x31,0x0a,0x09,
-    0x09,0x09,0x63,0x30,0x2c,0x30,0x2e,0x32,0x37,0x34,
-    0x2d,0x30,0x2e,0x31,0x34,0x39,0x2c,0x30,0x2e,0x35,
-    0x32,0x36,0x2d,0x30,0x2e,0x33,0x39,0x2c,0x30,0x2e,
-    0x36,0x35,0x38,0x43,0x38,0x2e,0x30,0x35,0x36,0x2c,
-    0x32,0x32,0x2e,0x32,0x35,0x34,0x2c,0x37,0x2e,0x39,
-    0x33,0x32,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,0x2c,
-    0x37,0x2e,0x38,0x30,0x39,0x2c,0x32,0x32,0x2e,0x32,
-    0x38,0x34,0x7a,0x20,0x4d,0x34,0x2e,0x35,0x31,0x34,
-    0x2c,0x31,0x38,0x2e,0x35,0x33,0x6c,0x32,0x2e,0x35,
-    0x34,0x35,0x2c,0x31,0x2e,0x36,0x33,0x32,0x76,0x2d,
-    0x33,0x2e,0x32,0x36,0x35,0x4c,0x34,0x2e,0x35,0x31,
-    0x34,0x2c,0x31,0x38,0x2e,0x35,0x33,0x7a,0x22,0x2f,
-    0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,
-    0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,
-    0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,
-    0x33,0x33,0x2e,0x38,0x37,0x39,0x2c,0x31,0x38,0x2e,
-    0x35,0x32,0x39,0x6c,0x2d,0x34,0x2e,0x36,0x38,0x35,
-    0x2d,0x33,0x2e,0x30,0x30,0x35,0x76,0x36,0x2e,0x30,
-    0x31,0x4c,0x33,0x33,0x2e,0x38,0x37,0x39,0x2c,0x31,
-    0x38,0x2e,0x35,0x32,0x39,0x7a,0x22,0x2f,0x3e,0x0a,
-    0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,
-    0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,
-    0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x32,0x39,0x2e,
-    0x31,0x39,0x35,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,
-    0x63,0x2d,0x30,0x2e,0x31,0x32,0x34,0x2c,0x30,0x2d,
-    0x30,0x2e,0x32,0x34,0x37,0x2d,0x30,0x2e,0x30,0x33,
-    0x2d,0x30,0x2e,0x33,0x35,0x39,0x2d,0x30,0x2e,0x30,
-    0x39,0x32,0x63,0x2d,0x30,0x2e,0x32,0x34,0x31,0x2d,
-    0x30,0x2e,0x31,0x33,0x32,0x2d,0x30,0x2e,0x33,0x39,
-    0x31,0x2d,0x30,0x2e,0x33,0x38,0x34,0x2d,0x30,0x2e,
-    0x33,0x39,0x31,0x2d,0x30,0x2e,0x36,0x35,0x38,0x76,
-    0x2d,0x36,0x2e,0x30,0x31,0x0a,0x09,0x09,0x09,0x63,
-    0x30,0x2d,0x30,0x2e,0x32,0x37,0x34,0x2c,0x30,0x2e,
-    0x31,0x34,0x39,0x2d,0x30,0x2e,0x35,0x32,0x36,0x2c,
-    0x30,0x2e,0x33,0x39,0x31,0x2d,0x30,0x2e,0x36,0x35,
-    0x38,0x63,0x30,0x2e,0x32,0x33,0x39,0x2d,0x30,0x2e,
-    0x31,0x33,0x32,0x2c,0x30,0x2e,0x35,0x33,0x32,0x2d,
-    0x30,0x2e,0x31,0x32,0x33,0x2c,0x30,0x2e,0x37,0x36,
-    0x35,0x2c,0x30,0x2e,0x30,0x32,0x37,0x6c,0x34,0x2e,
-    0x36,0x38,0x35,0x2c,0x33,0x2e,0x30,0x30,0x35,0x63,
-    0x30,0x2e,0x32,0x31,0x35,0x2c,0x30,0x2e,0x31,0x33,
-    0x38,0x2c,0x30,0x2e,0x33,0x34,0x35,0x2c,0x30,0x2e,
-    0x33,0x37,0x36,0x2c,0x30,0x2e,0x33,0x34,0x35,0x2c,
-    0x30,0x2e,0x36,0x33,0x31,0x0a,0x09,0x09,0x09,0x73,
-    0x2d,0x30,0x2e,0x31,0x33,0x2c,0x30,0x2e,0x34,0x39,
-    0x33,0x2d,0x30,0x2e,0x33,0x34,0x35,0x2c,0x30,0x2e,
-    0x36,0x33,0x31,0x4c,0x32,0x39,0x2e,0x36,0x2c,0x32,
-    0x32,0x2e,0x31,0x36,0x35,0x43,0x32,0x39,0x2e,0x34,
-    0x37,0x37,0x2c,0x32,0x32,0x2e,0x32,0x34,0x34,0x2c,
-    0x32,0x39,0x2e,0x33,0x33,0x35,0x2c,0x32,0x32,0x2e,
-    0x32,0x38,0x34,0x2c,0x32,0x39,0x2e,0x31,0x39,0x35,
-    0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,0x7a,0x20,0x4d,
-    0x32,0x39,0x2e,0x39,0x34,0x35,0x2c,0x31,0x36,0x2e,
-    0x38,0x39,0x36,0x76,0x33,0x2e,0x32,0x36,0x36,0x6c,
-    0x32,0x2e,0x35,0x34,0x36,0x2d,0x31,0x2e,0x36,0x33,
-    0x33,0x0a,0x09,0x09,0x09,0x4c,0x32,0x39,0x2e,0x39,
-    0x34,0x35,0x2c,0x31,0x36,0x2e,0x38,0x39,0x36,0x7a,
-    0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,
-    0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x33,
-    0x2e,0x38,0x37,0x36,0x6c,0x33,0x2e,0x30,0x30,0x37,
-    0x2d,0x34,0x2e,0x36,0x38,0x34,0x68,0x2d,0x36,0x2e,
-    0x30,0x31,0x32,0x4c,0x31,0x38,0x2e,0x35,0x33,0x2c,
-    0x33,0x33,0x2e,0x38,0x37,0x36,0x7a,0x22,0x2f,0x3e,
-    0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,
-    0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x31,0x38,
-    0x2e,0x35,0x33,0x2c,0x33,0x34,0x2e,0x36,0x32,0x36,
-    0x4c,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x34,0x2e,
-    0x36,0x32,0x36,0x63,0x2d,0x30,0x2e,0x32,0x35,0x35,
-    0x2c,0x30,0x2d,0x30,0x2e,0x34,0x39,0x33,0x2d,0x30,
-    0x2e,0x31,0x33,0x2d,0x30,0x2e,0x36,0x33,0x31,0x2d,
-    0x30,0x2e,0x33,0x34,0x35,0x6c,0x2d,0x33,0x2e,0x30,
-    0x30,0x35,0x2d,0x34,0x2e,0x36,0x38,0x34,0x0a,0x09,
-    0x09,0x09,0x63,0x2d,0x30,0x2e,0x31,0x34,0x38,0x2d,
-    0x30,0x2e,0x32,0x33,0x31,0x2d,0x30,0x2e,0x31,0x35,
-    0x38,0x2d,0x30,0x2e,0x35,0x32,0x34,0x2d,0x30,0x2e,
-    0x30,0x32,0x37,0x2d,0x30,0x2e,0x37,0x36,0x35,0x63,
-    0x30,0x2e,0x31,0x33,0x32,0x2d,0x30,0x2e,0x32,0x34,
-    0x31,0x2c,0x30,0x2e,0x33,0x38,0x34,0x2d,0x30,0x2e,
-    0x33,0x39,0x31,0x2c,0x30,0x2e,0x36,0x35,0x38,0x2d,
-    0x30,0x2e,0x33,0x39,0x31,0x68,0x36,0x2e,0x30,0x31,
-    0x32,0x63,0x30,0x2e,0x32,0x37,0x34,0x2c,0x30,0x2c,
-    0x30,0x2e,0x35,0x32,0x36,0x2c,0x30,0x2e,0x31,0x34,
-    0x39,0x2c,0x30,0x2e,0x36,0x35,0x38,0x2c,0x30,0x2e,
-    0x33,0x39,0x31,0x0a,0x09,0x09,0x09,0x63,0x30,0x2e,
-    0x31,0x33,0x32,0x2c,0x30,0x2e,0x32,0x34,0x2c,0x30,
-    0x2e,0x31,0x32,0x31,0x2c,0x30,0x2e,0x35,0x33,0x34,
-    0x2d,0x30,0x2e,0x30,0x32,0x37,0x2c,0x30,0x2e,0x37,
-    0x36,0x35,0x6c,0x2d,0x33,0x2e,0x30,0x30,0x37,0x2c,
-    0x34,0x2e,0x36,0x38,0x34,0x43,0x31,0x39,0x2e,0x30,
-    0x32,0x33,0x2c,0x33,0x34,0x2e,0x34,0x39,0x36,0x2c,
-    0x31,0x38,0x2e,0x37,0x38,0x35,0x2c,0x33,0x34,0x2e,
-    0x36,0x32,0x36,0x2c,0x31,0x38,0x2e,0x35,0x33,0x2c,
-    0x33,0x34,0x2e,0x36,0x32,0x36,0x7a,0x20,0x4d,0x31,
-    0x36,0x2e,0x38,0x39,0x37,0x2c,0x32,0x39,0x2e,0x39,
-    0x34,0x32,0x6c,0x31,0x2e,0x36,0x33,0x33,0x2c,0x32,
-    0x2e,0x35,0x34,0x35,0x0a,0x09,0x09,0x09,0x6c,0x31,
-    0x2e,0x36,0x33,0x34,0x2d,0x32,0x2e,0x35,0x34,0x35,
-    0x48,0x31,0x36,0x2e,0x38,0x39,0x37,0x7a,0x22,0x2f,
-    0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,
-    0x67,0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a
+const size_t help_dpad_all_svg_size = 1459;
+const unsigned char help_dpad_all_svg_data[1459] = {
+    0x45,0x53,0x5a,0x31,0x8e,0x0d,0x00,0x00,0x78,0xda,
+    0x95,0x57,0xdb,0x6e,0x1b,0x37,0x10,0x7d,0xb6,0xbf,
+    0x82,0xdd,0x3e,0x15,0xe0,0x72,0x79,0x27,0xd7,0x88,
+    0x12,0x34,0x4a,0x9a,0x04,0x50,0xda,0x00,0x4d,0x5d,
+    0xf4,0x29,0x70,0x56,0x8a,0x56,0xa8,0x2a,0x09,0x92,
+    0x2c,0xb9,0xfe,0xfa,0xce,0x85,0x92,0xd7,0x80,0x83,
+    0x34,0x7e,0xe0,0x0e,0x97,0xc3,0xb9,0x9c,0x39,0x33,
+    0x2b,0x3f,0x7b,0x71,0xf7,0xcf,0x52,0x1c,0x66,0xdb,
+    0xdd,0x62,0xbd,0x1a,0x55,0x46,0xe9,0x4a,0xcc,0x56,
+    0xdd,0x7a,0xba,0x58,0xcd,0x47,0xd5,0xed,0xfe,0x4b,
+    0x9d,0xab,0x17,0xcf,0x2f,0x9f,0xfd,0x50,0xd7,0xe2,
+    0xcd,0x6c,0x35,0xdb,0xde,0xec,0xd7,0xdb,0x2b,0xf1,
+    0xf3,0x74,0xfd,0x79,0x26,0xde,0x2d,0x97,0xb7,0xbb,
+    0x3d,0xbd,0x12,0x26,0x2a,0xad,0x9c,0x14,0xbf,0x5f,
+    0xbf,0x11,0xaf,0xef,0x36,0xeb,0xed,0x5e,0x7c,0x58,
+    0xde,0xce,0xeb,0x77,0x2b,0xa1,0xe8,0xe5,0x35,0xfb,
+    0xb8,0x12,0xa0,0xa8,0xc5,0xcb,0xdb,0xc5,0x72,0x2a,
+    0xf4,0x4f,0x42,0xd4,0x35,0x9a,0x7f,0xf5,0xdb,0xf8,
+    0xe3,0x5f,0x1f,0x5e,0x8b,0xdd,0x61,0x2e,0x3e,0xfc,
+    0xf1,0x72,0xf2,0x6e,0x2c,0xaa,0xba,0x69,0xfe,0x74,
+    0xe3,0xa6,0x79,0xf5,0xf1,0x15,0x59,0x30,0xca,0x34,
+    0xcd,0xeb,0x5f,0x2b,0x51,0xf5,0xfb,0xfd,0xe6,0xaa,
+    0x69,0x8e,0xc7,0xa3,0x3a,0x3a,0xb5,0xde,0xce,0x9b,
+    0x37,0xdb,0x9b,0x4d,0xbf,0xe8,0x76,0x0d,0x28,0x36,
+    0xa8,0x08,0x97,0x1a,0x30,0x66,0x8c,0x9a,0xee,0xa7,
+    0x15,0xb8,0x40,0xcb,0x83,0x3c,0x4d,0x25,0x16,0xd3,
+    0x51,0xf5,0xe9,0xce,0xe9,0x4f,0x95,0x00,0x10,0x56,
+    0xbb,0xd1,0x13,0x76,0xad,0xd6,0x1a,0xed,0x14,0x95,
+    0xab,0xbb,0xe5,0x62,0xf5,0xf7,0x53,0x8a,0xa6,0x6d,
+    0xdb,0x86,0x4e,0x41,0x75,0x54,0xe9,0xcd,0x5d,0x25,
+    0xfe,0xe5,0xe7,0xe5,0x85,0x38,0x2e,0xa6,0xfb,0x7e,
+    0x54,0xb9,0xa4,0x74,0x34,0x78,0xd4,0xcf,0x16,0xf3,
+    0x7e,0x3f,0x7c,0x73,0x58,0xcc,0x8e,0x2f,0xd7,0x78,
+    0x55,0x68,0xc1,0xaf,0xcb,0x03,0x2b,0x72,0xf3,0x79,
+    0x39,0xab,0x3f,0xdf,0x74,0x7f,0xcf,0xb7,0xeb,0xdb,
+    0x15,0x04,0xbe,0x9a,0x1d,0xc5,0x13,0x9a,0x10,0xe5,
+    0xd5,0x6e,0x73,0xd3,0xcd,0x46,0xd5,0x66,0x3b,0xdb,
+    0xcd,0xb6,0x87,0x19,0x26,0x3f,0x7f,0x7e,0x79,0x41,
+    0x4b,0x59,0x4f,0x8f,0x8b,0x67,0x9b,0x9b,0x7d,0x2f,
+    0xbe,0x2c,0x96,0xcb,0x51,0xf5,0xe3,0x2f,0xf4,0x57,
+    0x09,0x30,0xff,0xde,0x5a,0xa5,0x73,0x90,0x68,0x37,
+    0xe4,0xbe,0x4e,0xca,0x18,0xd3,0xd5,0x56,0xd9,0xdc,
+    0x4a,0x5d,0x3b,0xd8,0xb6,0xb5,0x51,0x39,0xc6,0x22,
+    0xc3,0x6a,0xcd,0xa1,0xce,0x2a,0x39,0xfb,0x96,0x36,
+    0x63,0xad,0xb2,0x33,0xd2,0x06,0x65,0x75,0x90,0x5a,
+    0x5a,0xa7,0x9c,0x6b,0x51,0x40,0xd3,0x9e,0xdc,0x5f,
+    0x1c,0xc8,0x72,0xa7,0x8b,0x65,0xb4,0x98,0xc8,0x96,
+    0x24,0x1b,0x24,0xf6,0x68,0xd4,0x5f,0xd3,0x0b,0xd6,
+    0x64,0xc5,0xc0,0x4e,0xe5,0x20,0x80,0x9e,0xe3,0x24,
+    0x15,0xcd,0x26,0xd8,0xa6,0x3c,0xab,0x42,0x94,0x68,
+    0xcf,0xb1,0x7f,0xb2,0x6d,0x3a,0x03,0x31,0x1a,0x0c,
+    0x4d,0x99,0xe0,0xa5,0x56,0xc1,0x06,0x90,0x63,0xf6,
+    0x70,0xdb,0xe7,0x4e,0xc3,0x71,0x82,0xd7,0x2e,0x41,
+    0x22,0xca,0x87,0x08,0xaf,0x0d,0xc4,0x08,0x32,0xc5,
+    0x12,0x5d,0xdb,0x6b,0xa0,0x75,0x3e,0x70,0x36,0x12,
+    0x03,0x60,0x78,0x06,0x79,0x14,0xf7,0x3d,0x81,0x64,
+    0x4a,0xfe,0x04,0xd8,0x98,0x40,0x02,0xdd,0xa8,0xac,
+    0x4d,0x84,0x94,0x2f,0xd0,0xcb,0x47,0x85,0xb8,0x17,
+    0xef,0x4b,0x52,0xa0,0x12,0xdc,0xd8,0xaa,0xe4,0x03,
+    0x6f,0x30,0x0e,0x12,0x7d,0x6b,0x59,0xf4,0xaa,0x4d,
+    0x8e,0x22,0x62,0x5f,0x1d,0x86,0x18,0x29,0x0d,0x5c,
+    0x8d,0xa3,0xd0,0x09,0xa1,0xf3,0xda,0x1b,0xc8,0xd5,
+    0xb9,0x03,0x3d,0x2c,0xdd,0x08,0x4f,0xdf,0x30,0x45,
+    0x46,0xc8,0x75,0x3e,0x7b,0x70,0xd9,0xd7,0xec,0x07,
+    0x4f,0x51,0x36,0xde,0x16,0x99,0xf4,0xaf,0x21,0xbb,
+    0xa4,0x03,0x3b,0x32,0x1d,0xd9,0x1e,0xdc,0x30,0x74,
+    0xa3,0x88,0xb4,0x12,0x45,0xec,0x29,0x07,0x52,0x0d,
+    0xb0,0xda,0x9c,0x50,0xd5,0x58,0xd4,0xd2,0x2d,0xe9,
+    0xb2,0xf8,0x96,0x3c,0x24,0x26,0xcc,0x98,0x36,0x40,
+    0x43,0x42,0x0a,0x36,0x21,0x66,0x82,0x87,0x70,0x45,
+    0x9f,0xa1,0xb0,0xfb,0xc1,0x01,0x67,0x0b,0x11,0xd5,
+    0x9c,0x27,0x65,0x5e,0x0f,0x72,0x2e,0xf0,0x30,0xcf,
+    0xef,0xab,0x86,0x5b,0xaa,0xe1,0x06,0xa3,0x47,0x59,
+    0xf9,0xcd,0xd7,0x7a,0xcc,0x64,0x15,0xb0,0x43,0x80,
+    0x75,0x99,0x9a,0x4b,0x23,0xa7,0x80,0x2b,0xd1,0x93,
+    0x3b,0x97,0x8b,0x0c,0x6b,0x60,0xea,0x6b,0xe3,0x88,
+    0x6f,0x89,0xde,0xc9,0x87,0x63,0x8c,0xa0,0xe3,0x73,
+    0x24,0x3e,0x9c,0x91,0x01,0x79,0x52,0x0b,0x63,0x76,
+    0x23,0x2d,0xb0,0xdb,0x7b,0x7e,0xb8,0xe2,0x5b,0x3e,
+    0x8a,0x04,0x48,0x56,0xf6,0x30,0xd4,0x5d,0xee,0x20,
+    0x14,0x03,0x0c,0x44,0xf7,0xc6,0x23,0x1a,0x2d,0xb4,
+    0x1e,0xcb,0xd8,0x2f,0xe4,0x59,0x63,0x47,0xe4,0x44,
+    0x87,0x9e,0x5e,0x23,0xe4,0x27,0x15,0x6c,0x30,0x03,
+    0x60,0x73,0x83,0xd5,0x64,0x81,0x45,0x3a,0x1d,0x43,
+    0x30,0x11,0xa3,0x48,0xc0,0x7b,0xa8,0x7d,0xab,0x92,
+    0x89,0xec,0x5c,0x0e,0x23,0x61,0xa4,0xff,0x3f,0xb4,
+    0xd8,0x6f,0xd9,0x2d,0x01,0x1f,0x64,0xb1,0xc7,0x7e,
+    0xee,0x23,0x82,0x3c,0x19,0x1c,0x97,0xf2,0x7d,0x7d,
+    0x10,0x02,0x43,0x5c,0x94,0x19,0xaa,0x9f,0xfa,0x9a,
+    0xae,0x23,0x47,0x6c,0x82,0x39,0x51,0xe3,0xa4,0x40,
+    0xf6,0x52,0x52,0x31,0x64,0x24,0x4f,0x8b,0xc7,0xc6,
+    0x21,0x91,0xad,0x27,0x3a,0x13,0xa9,0x83,0xc3,0xc1,
+    0xa2,0x2d,0xb2,0x36,0xc5,0xb0,0xa4,0xa0,0x6a,0x0a,
+    0x8a,0x11,0x04,0x93,0x68,0xca,0x43,0xb6,0x00,0x10,
+    0xb1,0xdb,0x63,0xb1,0x6d,0x04,0x52,0x90,0x7a,0xe2,
+    0x1c,0x3a,0xec,0x90,0x2c,0xa9,0x7f,0x90,0x9b,0xa1,
+    0xa5,0x89,0x55,0xcc,0x4b,0x32,0x8f,0xd5,0xd6,0xd1,
+    0x41,0xd8,0x1e,0x86,0x1f,0xe4,0x90,0x8d,0xe1,0x1c,
+    0xe4,0x30,0xa1,0x7b,0x74,0x0d,0xe5,0x8e,0x2a,0xb7,
+    0x49,0x62,0x1b,0xa4,0xde,0x81,0xc7,0x54,0x10,0xf2,
+    0x2a,0x24,0x40,0x6b,0x70,0xfc,0x1d,0x35,0xc0,0xee,
+    0x08,0x5c,0xc0,0x25,0x05,0x2e,0x31,0x09,0x7f,0x20,
+    0x10,0x27,0x83,0xd3,0x6f,0x95,0x20,0xa9,0xac,0x5b,
+    0x24,0xa7,0x85,0xe4,0x69,0x3e,0x18,0xc2,0xde,0x66,
+    0x8b,0xe3,0x00,0x87,0x8c,0xa7,0x99,0x00,0xdf,0x81,
+    0x09,0x34,0xba,0x45,0x0a,0x99,0x68,0xa8,0x4e,0x54,
+    0x1a,0xe3,0x10,0x4e,0xe7,0x03,0x75,0x77,0x38,0xcb,
+    0x91,0xe7,0xf0,0x0e,0x35,0xd0,0x4a,0xeb,0xe4,0xe0,
+    0x88,0xa3,0x26,0xfa,0x44,0xac,0x8f,0x23,0xdf,0x89,
+    0xd1,0xae,0x4f,0xc8,0x03,0xda,0x35,0x21,0x8f,0x2a,
+    0x9e,0x86,0x05,0x96,0x05,0x3f,0x75,0x38,0x0d,0x4f,
+    0x22,0xb0,0xe3,0x80,0x89,0x97,0x76,0x21,0x06,0x91,
+    0x3d,0xae,0x5e,0xac,0x1f,0xf4,0xc6,0x19,0x66,0x7d,
+    0xa4,0x84,0xe1,0x6b,0x94,0x54,0xeb,0x6c,0xc9,0x5e,
+    0x0e,0xa1,0x80,0x3e,0x85,0xfa,0xe0,0xb0,0x24,0x88,
+    0x2d,0x34,0x34,0x77,0xbd,0x3d,0xd4,0x58,0xc4,0x30,
+    0x19,0x1c,0x7f,0x4f,0xdd,0x9c,0xca,0xa9,0xa5,0x6b,
+    0xb6,0x5d,0x12,0x45,0x03,0xf7,0xd0,0x81,0x2b,0x37,
+    0x3c,0xff,0x66,0xfb,0x40,0x25,0xda,0x30,0x2c,0x9e,
+    0xe5,0xc6,0xb1,0x1e,0x4b,0xa2,0x11,0x53,0xf8,0x78,
+    0xa1,0xd8,0x72,0x63,0x71,0xcf,0x38,0x4b,0x80,0xa0,
+    0xcc,0x9f,0x14,0x96,0x11,0xc5,0xfa,0x01,0xc6,0x53,
+    0x23,0x22,0x8c,0xdc,0x8c,0x72,0xa0,0x49,0x35,0x6b,
+    0xd9,0x1a,0x82,0x4c,0x36,0x8d,0x75,0x5c,0x34,0x6e,
+    0x17,0xaa,0x71,0x20,0x66,0x86,0x8e,0xe8,0x42,0x15,
+    0xcc,0xcc,0x83,0xf3,0xa7,0x8f,0xe5,0x13,0x5d,0xc8,
+    0xa4,0x24,0xbe,0xd4,0x83,0xb3,0x09,0x24,0x4b,0x65,
+    0x33,0xd8,0x80,0xad,0xf2,0x29,0x51,0xe2,0x38,0x6e,
+    0x5b,0xf8,0xf1,0x73,0x82,0x41,0x3e,0x02,0x05,0xca,
+    0x08,0xfb,0x16,0x6b,0x87,0x7d,0x16,0x0f,0x58,0xbb,
+    0x48,0xe5,0xa4,0x0f,0x10,0xff,0x54,0x99,0x3c,0xd2,
+    0xf9,0xfe,0x49,0x88,0x35,0x8b,0x3c,0x45,0x78,0xe8,
+    0x94,0x59,0x36,0x19,0x9e,0x7f,0xab,0x98,0x45,0x17,
+    0xee,0xdb,0x38,0x19,0x6e,0xa8,0x70,0x21,0x50,0x61,
+    0x19,0x14,0xea,0xa7,0x48,0x53,0x10,0xf0,0x29,0x33,
+    0x78,0x30,0xee,0x88,0xfa,0x38,0x2f,0x2d,0xe9,0x18,
+    0x9a,0x9d,0xdc,0x56,0xe7,0x19,0xd9,0x9d,0x78,0x60,
+    0xbd,0x91,0x03,0x1e,0xc8,0x87,0x59,0x6b,0x78,0xa0,
+    0x77,0x85,0x07,0xf2,0xc4,0x01,0x6e,0x2b,0xd0,0x62,
+    0x3e,0x94,0x09,0xcb,0x3c,0xe0,0x26,0xb5,0x86,0x28,
+    0x51,0x1c,0x32,0x25,0x38,0xcc,0x32,0x66,0xc7,0x30,
+    0x44,0xb4,0xa5,0x0c,0x7d,0x1b,0x91,0xee,0x09,0x89,
+    0x42,0xf9,0xca,0x61,0xf2,0xf7,0xe7,0x01,0x4a,0x35,
+    0xb2,0x4b,0x2a,0x9a,0xa4,0x7e,0x44,0xc7,0xb4,0xf7,
+    0x35,0xed,0xdf,0xb2,0xe6,0xa0,0x7e,0x65,0x81,0xff,
+    0x31,0x9e,0x5f,0xfe,0x07,0x0b,0x79,0xee,0x86
 };
 
@@ -1,333 +1,146 @@
-//this file was auto-generated from "dpad_leftright.svg" by res2h
+//this file was auto-generated from "dpad_leftright.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_dpad_leftright_svg_size = 3241;
-const unsigned char help_dpad_leftright_svg_data[3241] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x33,0x30,
-    0x5f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,
-    0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,
-    0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,
-    0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,
-    0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,0x3d,
-    0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-    0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,
-    0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,0x6b,0x22,
-    0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,0x20,0x79,
-    0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,0x20,0x77,
-    0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x2d,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3d,
-    0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,
-    0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,
-    0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,0x3e,0x0a,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,
-    0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,
-    0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x32,
-    0x32,0x2e,0x30,0x38,0x36,0x2c,0x33,0x37,0x2e,0x30,
-    0x36,0x68,0x2d,0x37,0x2e,0x31,0x31,0x31,0x63,0x2d,
-    0x32,0x2e,0x32,0x38,0x39,0x2c,0x30,0x2d,0x33,0x2e,
-    0x31,0x31,0x39,0x2d,0x31,0x2e,0x38,0x36,0x36,0x2d,
-    0x33,0x2e,0x31,0x31,0x39,0x2d,0x33,0x2e,0x31,0x32,
-    0x31,0x76,0x2d,0x38,0x2e,0x37,0x33,0x32,0x48,0x33,
-    0x2e,0x31,0x32,0x31,0x43,0x30,0x2e,0x38,0x33,0x31,
-    0x2c,0x32,0x35,0x2e,0x32,0x30,0x36,0x2c,0x30,0x2c,
-    0x32,0x33,0x2e,0x33,0x34,0x2c,0x30,0x2c,0x32,0x32,
-    0x2e,0x30,0x38,0x35,0x0a,0x09,0x09,0x09,0x09,0x76,
-    0x2d,0x37,0x2e,0x31,0x31,0x63,0x30,0x2d,0x32,0x2e,
-    0x32,0x38,0x39,0x2c,0x31,0x2e,0x38,0x36,0x37,0x2d,
-    0x33,0x2e,0x31,0x32,0x2c,0x33,0x2e,0x31,0x32,0x31,
-    0x2d,0x33,0x2e,0x31,0x32,0x68,0x38,0x2e,0x37,0x33,
-    0x33,0x56,0x33,0x2e,0x31,0x32,0x31,0x43,0x31,0x31,
-    0x2e,0x38,0x35,0x35,0x2c,0x30,0x2e,0x38,0x33,0x31,
-    0x2c,0x31,0x33,0x2e,0x37,0x32,0x2c,0x30,0x2c,0x31,
-    0x34,0x2e,0x39,0x37,0x34,0x2c,0x30,0x68,0x37,0x2e,
-    0x31,0x31,0x31,0x63,0x32,0x2e,0x32,0x39,0x2c,0x30,
-    0x2c,0x33,0x2e,0x31,0x32,0x31,0x2c,0x31,0x2e,0x38,
-    0x36,0x37,0x2c,0x33,0x2e,0x31,0x32,0x31,0x2c,0x33,
-    0x2e,0x31,0x32,0x31,0x76,0x38,0x2e,0x37,0x33,0x32,
-    0x0a,0x09,0x09,0x09,0x09,0x68,0x38,0x2e,0x37,0x33,
-    0x31,0x63,0x32,0x2e,0x32,0x39,0x2c,0x30,0x2c,0x33,
-    0x2e,0x31,0x32,0x31,0x2c,0x31,0x2e,0x38,0x36,0x35,
-    0x2c,0x33,0x2e,0x31,0x32,0x31,0x2c,0x33,0x2e,0x31,
-    0x32,0x76,0x37,0x2e,0x31,0x31,0x63,0x30,0x2c,0x32,
-    0x2e,0x32,0x39,0x2d,0x31,0x2e,0x38,0x36,0x36,0x2c,
-    0x33,0x2e,0x31,0x32,0x31,0x2d,0x33,0x2e,0x31,0x32,
-    0x31,0x2c,0x33,0x2e,0x31,0x32,0x31,0x68,0x2d,0x38,
-    0x2e,0x37,0x33,0x31,0x76,0x38,0x2e,0x37,0x33,0x32,
-    0x0a,0x09,0x09,0x09,0x09,0x43,0x32,0x35,0x2e,0x32,
-    0x30,0x37,0x2c,0x33,0x36,0x2e,0x32,0x32,0x39,0x2c,
-    0x32,0x33,0x2e,0x33,0x34,0x31,0x2c,0x33,0x37,0x2e,
-    0x30,0x36,0x2c,0x32,0x32,0x2e,0x30,0x38,0x36,0x2c,
-    0x33,0x37,0x2e,0x30,0x36,0x7a,0x20,0x4d,0x33,0x2e,
-    0x31,0x32,0x31,0x2c,0x31,0x33,0x2e,0x33,0x35,0x34,
-    0x43,0x32,0x2e,0x37,0x34,0x35,0x2c,0x31,0x33,0x2e,
-    0x33,0x35,0x39,0x2c,0x31,0x2e,0x35,0x2c,0x31,0x33,
-    0x2e,0x34,0x39,0x33,0x2c,0x31,0x2e,0x35,0x2c,0x31,
-    0x34,0x2e,0x39,0x37,0x34,0x76,0x37,0x2e,0x31,0x31,
-    0x0a,0x09,0x09,0x09,0x09,0x63,0x30,0x2e,0x30,0x30,
-    0x36,0x2c,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,0x2e,
-    0x31,0x33,0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2c,
-    0x31,0x2e,0x36,0x32,0x31,0x2c,0x31,0x2e,0x36,0x32,
-    0x31,0x68,0x31,0x30,0x2e,0x32,0x33,0x33,0x76,0x31,
-    0x30,0x2e,0x32,0x33,0x32,0x63,0x30,0x2e,0x30,0x30,
-    0x35,0x2c,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,0x2e,
-    0x31,0x34,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2c,0x31,
-    0x2e,0x36,0x31,0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,
-    0x68,0x37,0x2e,0x31,0x30,0x38,0x0a,0x09,0x09,0x09,
-    0x09,0x63,0x30,0x2e,0x33,0x38,0x34,0x2d,0x30,0x2e,
-    0x30,0x30,0x37,0x2c,0x31,0x2e,0x36,0x32,0x34,0x2d,
-    0x30,0x2e,0x31,0x34,0x33,0x2c,0x31,0x2e,0x36,0x32,
-    0x34,0x2d,0x31,0x2e,0x36,0x32,0x31,0x56,0x32,0x33,
-    0x2e,0x37,0x30,0x36,0x68,0x31,0x30,0x2e,0x32,0x33,
-    0x31,0x63,0x30,0x2e,0x33,0x37,0x36,0x2d,0x30,0x2e,
-    0x30,0x30,0x36,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2d,
-    0x30,0x2e,0x31,0x34,0x2c,0x31,0x2e,0x36,0x32,0x31,
-    0x2d,0x31,0x2e,0x36,0x32,0x31,0x76,0x2d,0x37,0x2e,
-    0x31,0x31,0x0a,0x09,0x09,0x09,0x09,0x63,0x2d,0x30,
-    0x2e,0x30,0x30,0x36,0x2d,0x30,0x2e,0x33,0x37,0x36,
-    0x2d,0x30,0x2e,0x31,0x34,0x2d,0x31,0x2e,0x36,0x32,
-    0x2d,0x31,0x2e,0x36,0x32,0x31,0x2d,0x31,0x2e,0x36,
-    0x32,0x68,0x2d,0x31,0x30,0x2e,0x32,0x33,0x56,0x33,
-    0x2e,0x31,0x32,0x31,0x43,0x32,0x33,0x2e,0x37,0x30,
-    0x31,0x2c,0x32,0x2e,0x37,0x34,0x35,0x2c,0x32,0x33,
-    0x2e,0x35,0x36,0x37,0x2c,0x31,0x2e,0x35,0x2c,0x32,
-    0x32,0x2e,0x30,0x38,0x36,0x2c,0x31,0x2e,0x35,0x68,
-    0x2d,0x37,0x2e,0x31,0x31,0x31,0x0a,0x09,0x09,0x09,
-    0x09,0x63,0x2d,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,
-    0x2e,0x30,0x30,0x36,0x2d,0x31,0x2e,0x36,0x31,0x39,
-    0x2c,0x30,0x2e,0x31,0x34,0x2d,0x31,0x2e,0x36,0x31,
-    0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,0x76,0x31,0x30,
-    0x2e,0x32,0x33,0x32,0x4c,0x33,0x2e,0x31,0x32,0x31,
-    0x2c,0x31,0x33,0x2e,0x33,0x35,0x34,0x4c,0x33,0x2e,
-    0x31,0x32,0x31,0x2c,0x31,0x33,0x2e,0x33,0x35,0x34,
-    0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,
-    0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,
-    0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,
-    0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,0x32,0x32,0x2e,
-    0x31,0x38,0x31,0x63,0x2d,0x32,0x2e,0x30,0x31,0x33,
-    0x2c,0x30,0x2d,0x33,0x2e,0x36,0x34,0x39,0x2d,0x31,
-    0x2e,0x36,0x33,0x39,0x2d,0x33,0x2e,0x36,0x34,0x39,
-    0x2d,0x33,0x2e,0x36,0x35,0x31,0x73,0x31,0x2e,0x36,
-    0x33,0x38,0x2d,0x33,0x2e,0x36,0x35,0x2c,0x33,0x2e,
-    0x36,0x34,0x39,0x2d,0x33,0x2e,0x36,0x35,0x63,0x32,
-    0x2e,0x30,0x31,0x33,0x2c,0x30,0x2c,0x33,0x2e,0x36,
-    0x35,0x2c,0x31,0x2e,0x36,0x33,0x39,0x2c,0x33,0x2e,
-    0x36,0x35,0x2c,0x33,0x2e,0x36,0x35,0x0a,0x09,0x09,
-    0x09,0x43,0x32,0x32,0x2e,0x31,0x38,0x32,0x2c,0x32,
-    0x30,0x2e,0x35,0x34,0x33,0x2c,0x32,0x30,0x2e,0x35,
-    0x34,0x34,0x2c,0x32,0x32,0x2e,0x31,0x38,0x31,0x2c,
-    0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,0x32,0x32,0x2e,
-    0x31,0x38,0x31,0x7a,0x20,0x4d,0x31,0x38,0x2e,0x35,
-    0x33,0x31,0x2c,0x31,0x36,0x2e,0x33,0x37,0x39,0x63,
-    0x2d,0x31,0x2e,0x31,0x38,0x36,0x2c,0x30,0x2d,0x32,
-    0x2e,0x31,0x34,0x39,0x2c,0x30,0x2e,0x39,0x36,0x35,
-    0x2d,0x32,0x2e,0x31,0x34,0x39,0x2c,0x32,0x2e,0x31,
-    0x35,0x73,0x30,0x2e,0x39,0x36,0x35,0x2c,0x32,0x2e,
-    0x31,0x35,0x31,0x2c,0x32,0x2e,0x31,0x34,0x39,0x2c,
-    0x32,0x2e,0x31,0x35,0x31,0x0a,0x09,0x09,0x09,0x63,
-    0x31,0x2e,0x31,0x38,0x36,0x2c,0x30,0x2c,0x32,0x2e,
-    0x31,0x35,0x2d,0x30,0x2e,0x39,0x36,0x36,0x2c,0x32,
-    0x2e,0x31,0x35,0x2d,0x32,0x2e,0x31,0x35,0x31,0x43,
-    0x32,0x30,0x2e,0x36,0x38,0x32,0x2c,0x31,0x37,0x2e,
-    0x33,0x34,0x34,0x2c,0x31,0x39,0x2e,0x37,0x31,0x37,
-    0x2c,0x31,0x36,0x2e,0x33,0x37,0x39,0x2c,0x31,0x38,
-    0x2e,0x35,0x33,0x31,0x2c,0x31,0x36,0x2e,0x33,0x37,
-    0x39,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,
-    0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,
-    0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,
-    0x64,0x3d,0x22,0x4d,0x32,0x31,0x2e,0x35,0x33,0x36,
-    0x2c,0x38,0x2e,0x36,0x31,0x36,0x68,0x2d,0x36,0x2e,
-    0x30,0x31,0x32,0x63,0x2d,0x30,0x2e,0x32,0x37,0x33,
-    0x2c,0x30,0x2d,0x30,0x2e,0x35,0x32,0x35,0x2d,0x30,
-    0x2e,0x31,0x35,0x2d,0x30,0x2e,0x36,0x35,0x37,0x2d,
-    0x30,0x2e,0x33,0x39,0x63,0x2d,0x30,0x2e,0x31,0x33,
-    0x32,0x2d,0x30,0x2e,0x32,0x34,0x31,0x2d,0x30,0x2e,
-    0x31,0x32,0x31,0x2d,0x30,0x2e,0x35,0x33,0x34,0x2c,
-    0x30,0x2e,0x30,0x32,0x36,0x2d,0x30,0x2e,0x37,0x36,
-    0x36,0x6c,0x33,0x2e,0x30,0x30,0x35,0x2d,0x34,0x2e,
-    0x36,0x38,0x34,0x0a,0x09,0x09,0x09,0x63,0x30,0x2e,
-    0x32,0x37,0x36,0x2d,0x30,0x2e,0x34,0x33,0x31,0x2c,
-    0x30,0x2e,0x39,0x38,0x36,0x2d,0x30,0x2e,0x34,0x33,
-    0x2c,0x31,0x2e,0x32,0x36,0x34,0x2c,0x30,0x6c,0x33,
-    0x2e,0x30,0x30,0x35,0x2c,0x34,0x2e,0x36,0x38,0x34,
-    0x63,0x30,0x2e,0x31,0x34,0x37,0x2c,0x30,0x2e,0x32,
-    0x33,0x31,0x2c,0x30,0x2e,0x31,0x35,0x39,0x2c,0x30,
-    0x2e,0x35,0x32,0x34,0x2c,0x30,0x2e,0x30,0x32,0x36,
-    0x2c,0x30,0x2e,0x37,0x36,0x36,0x43,0x32,0x32,0x2e,
-    0x30,0x36,0x33,0x2c,0x38,0x2e,0x34,0x36,0x36,0x2c,
-    0x32,0x31,0x2e,0x38,0x31,0x31,0x2c,0x38,0x2e,0x36,
-    0x31,0x36,0x2c,0x32,0x31,0x2e,0x35,0x33,0x36,0x2c,
-    0x38,0x2e,0x36,0x31,0x36,0x7a,0x0a,0x09,0x09,0x09,
-    0x20,0x4d,0x31,0x36,0x2e,0x38,0x39,0x37,0x2c,0x37,
-    0x2e,0x31,0x31,0x36,0x68,0x33,0x2e,0x32,0x36,0x38,
-    0x4c,0x31,0x38,0x2e,0x35,0x33,0x2c,0x34,0x2e,0x35,
-    0x37,0x31,0x4c,0x31,0x36,0x2e,0x38,0x39,0x37,0x2c,
-    0x37,0x2e,0x31,0x31,0x36,0x7a,0x22,0x2f,0x3e,0x0a,
-    0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,0x67,0x3e,
-    0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,
-    0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x33,0x2e,
-    0x31,0x32,0x35,0x2c,0x31,0x38,0x2e,0x35,0x33,0x6c,
-    0x34,0x2e,0x36,0x38,0x34,0x2c,0x33,0x2e,0x30,0x30,
-    0x34,0x76,0x2d,0x36,0x2e,0x30,0x31,0x4c,0x33,0x2e,
-    0x31,0x32,0x35,0x2c,0x31,0x38,0x2e,0x35,0x33,0x7a,
-    0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,
-    0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,
-    0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,
-    0x4d,0x37,0x2e,0x38,0x30,0x39,0x2c,0x32,0x32,0x2e,
-    0x32,0x38,0x34,0x63,0x2d,0x30,0x2e,0x31,0x34,0x31,
-    0x2c,0x30,0x2d,0x30,0x2e,0x32,0x38,0x32,0x2d,0x30,
-    0x2e,0x30,0x34,0x2d,0x30,0x2e,0x34,0x30,0x35,0x2d,
-    0x30,0x2e,0x31,0x31,0x39,0x4c,0x32,0x2e,0x37,0x32,
-    0x2c,0x31,0x39,0x2e,0x31,0x36,0x32,0x63,0x2d,0x30,
-    0x2e,0x32,0x31,0x35,0x2d,0x30,0x2e,0x31,0x33,0x38,
-    0x2d,0x30,0x2e,0x33,0x34,0x35,0x2d,0x30,0x2e,0x33,
-    0x37,0x36,0x2d,0x30,0x2e,0x33,0x34,0x35,0x2d,0x30,
-    0x2e,0x36,0x33,0x31,0x0a,0x09,0x09,0x09,0x73,0x30,
-    0x2e,0x31,0x33,0x2d,0x30,0x2e,0x34,0x39,0x33,0x2c,
-    0x30,0x2e,0x33,0x34,0x35,0x2d,0x30,0x2e,0x36,0x33,
-    0x31,0x6c,0x34,0x2e,0x36,0x38,0x34,0x2d,0x33,0x2e,
-    0x30,0x30,0x36,0x63,0x30,0x2e,0x32,0x33,0x2d,0x30,
-    0x2e,0x31,0x34,0x38,0x2c,0x30,0x2e,0x35,0x32,0x34,
-    0x2d,0x30,0x2e,0x31,0x35,0x38,0x2c,0x30,0x2e,0x37,
-    0x36,0x36,0x2d,0x30,0x2e,0x30,0x32,0x37,0x63,0x30,
-    0x2e,0x32,0x34,0x2c,0x30,0x2e,0x31,0x33,0x31,0x2c,
-    0x30,0x2e,0x33,0x39,0x2c,0x30,0x2e,0x33,0x38,0x34,
-    0x2c,0x30,0x2e,0x33,0x39,0x2c,0x30,0x2e,0x36,0x35,
-    0x38,0x76,0x36,0x2e,0x30,0x31,0x0a,0x09,0x09,0x09,
-    0x63,0x30,0x2c,0x30,0x2e,0x32,0x37,0x34,0x2d,0x30,
-    0x2e,0x31,0x34,0x38,0x2c,0x30,0x2e,0x35,0x32,0x36,
-    0x2d,0x30,0x2e,0x33,0x39,0x2c,0x30,0x2e,0x36,0x35,
-    0x38,0x43,0x38,0x2e,0x30,0x35,0x36,0x2c,0x32,0x32,
-    0x2e,0x32,0x35,0x34,0x2c,0x37,0x2e,0x39,0x33,0x32,
-    0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,0x2c,0x37,0x2e,
-    0x38,0x30,0x39,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,
-    0x7a,0x20,0x4d,0x34,0x2e,0x35,0x31,0x34,0x2c,0x31,
-    0x38,0x2e,0x35,0x33,0x6c,0x32,0x2e,0x35,0x34,0x35,
-    0x2c,0x31,0x2e,0x36,0x33,0x32,0x76,0x2d,0x33,0x2e,
-    0x32,0x36,0x35,0x4c,0x34,0x2e,0x35,0x31,0x34,0x2c,
-    0x31,0x38,0x2e,0x35,0x33,0x7a,0x22,0x2f,0x3e,0x0a,
-    0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,0x67,0x3e,
-    0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,
-    0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x33,0x33,
-    0x2e,0x38,0x37,0x39,0x2c,0x31,0x38,0x2e,0x35,0x32,
-    0x39,0x6c,0x2d,0x34,0x2e,0x36,0x38,0x35,0x2d,0x33,
-    0x2e,0x30,0x30,0x35,0x76,0x36,0x2e,0x30,0x31,0x4c,
-    0x33,0x33,0x2e,0x38,0x37,0x39,0x2c,0x31,0x38,0x2e,
-    0x35,0x32,0x39,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x09,
-    0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,
-    0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,
-    0x20,0x64,0x3d,0x22,0x4d,0x32,0x39,0x2e,0x31,0x39,
-    0x35,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,0x63,0x2d,
-    0x30,0x2e,0x31,0x32,0x34,0x2c,0x30,0x2d,0x30,0x2e,
-    0x32,0x34,0x36,0x2d,0x30,0x2e,0x30,0x33,0x2d,0x30,
-    0x2e,0x33,0x35,0x38,0x2d,0x30,0x2e,0x30,0x39,0x32,
-    0x63,0x2d,0x30,0x2e,0x32,0x34,0x31,0x2d,0x30,0x2e,
-    0x31,0x33,0x32,0x2d,0x30,0x2e,0x33,0x39,0x32,0x2d,
-    0x30,0x2e,0x33,0x38,0x34,0x2d,0x30,0x2e,0x33,0x39,
-    0x32,0x2d,0x30,0x2e,0x36,0x35,0x38,0x76,0x2d,0x36,
-    0x2e,0x30,0x31,0x0a,0x09,0x09,0x09,0x63,0x30,0x2d,
-    0x30,0x2e,0x32,0x37,0x34,0x2c,0x30,0x2e,0x31,0x34,
-    0x39,0x2d,0x30,0x2e,0x35,0x32,0x36,0x2c,0x30,0x2e,
-    0x33,0x39,0x32,0x2d,0x30,0x2e,0x36,0x35,0x38,0x63,
-    0x30,0x2e,0x32,0x33,0x39,0x2d,0x30,0x2e,0x31,0x33,
-    0x31,0x2c,0x30,0x2e,0x35,0x33,0x33,0x2d,0x30,0x2e,
-    0x31,0x32,0x33,0x2c,0x30,0x2e,0x37,0x36,0x35,0x2c,
-    0x30,0x2e,0x30,0x32,0x37,0x6c,0x34,0x2e,0x36,0x38,
-    0x35,0x2c,0x33,0x2e,0x30,0x30,0x35,0x63,0x30,0x2e,
-    0x32,0x31,0x35,0x2c,0x30,0x2e,0x31,0x33,0x38,0x2c,
-    0x30,0x2e,0x33,0x34,0x35,0x2c,0x30,0x2e,0x33,0x37,
-    0x36,0x2c,0x30,0x2e,0x33,0x34,0x35,0x2c,0x30,0x2e,
-    0x36,0x33,0x31,0x0a,0x09,0x09,0x09,0x73,0x2d,0x30,
-    0x2e,0x31,0x33,0x2c,0x30,0x2e,0x34,0x39,0x33,0x2d,
-    0x30,0x2e,0x33,0x34,0x35,0x2c,0x30,0x2e,0x36,0x33,
-    0x31,0x6c,0x2d,0x34,0x2e,0x36,0x38,0x35,0x2c,0x33,
-    0x2e,0x30,0x30,0x34,0x43,0x32,0x39,0x2e,0x34,0x37,
-    0x38,0x2c,0x32,0x32,0x2e,0x32,0x34,0x34,0x2c,0x32,
-    0x39,0x2e,0x33,0x33,0x36,0x2c,0x32,0x32,0x2e,0x32,
-    0x38,0x34,0x2c,0x32,0x39,0x2e,0x31,0x39,0x35,0x2c,
-    0x32,0x32,0x2e,0x32,0x38,0x34,0x7a,0x20,0x4d,0x32,
-    0x39,0x2e,0x39,0x34,0x35,0x2c,0x31,0x36,0x2e,0x38,
-    0x39,0x36,0x76,0x33,0x2e,0x32,0x36,0x36,0x6c,0x32,
-    0x2e,0x35,0x34,0x36,0x2d,0x31,0x2e,0x36,0x33,0x33,
-    0x0a,0x09,0x09,0x09,0x4c,0x32,0x39,0x2e,0x39,0x34,
-    0x35,0x2c,0x31,0x36,0x2e,0x38,0x39,0x36,0x7a,0x22,
-    0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,
-    0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,
-    0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,
-    0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,
-    0x4d,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x34,0x2e,
-    0x36,0x32,0x36,0x4c,0x31,0x38,0x2e,0x35,0x33,0x2c,
-    0x33,0x34,0x2e,0x36,0x32,0x36,0x63,0x2d,0x30,0x2e,
-    0x32,0x35,0x35,0x2c,0x30,0x2d,0x30,0x2e,0x34,0x39,
-    0x32,0x2d,0x30,0x2e,0x31,0x33,0x2d,0x30,0x2e,0x36,
-    0x33,0x31,0x2d,0x30,0x2e,0x33,0x34,0x35,0x6c,0x2d,
-    0x33,0x2e,0x30,0x30,0x35,0x2d,0x34,0x2e,0x36,0x38,
-    0x34,0x0a,0x09,0x09,0x09,0x63,0x2d,0x30,0x2e,0x31,
-    0x34,0x37,0x2d,0x30,0x2e,0x32,0x33,0x31,0x2d,0x30,
-    0x2e,0x31,0x35,0x38,0x2d,0x30,0x2e,0x35,0x32,0x34,
-    0x2d,0x30,0x2e,0x30,0x32,0x36,0x2d,0x30,0x2e,0x37,
-    0x36,0x36,0x73,0x30,0x2e,0x33,0x38,0x34,0x2d,0x30,
-    0x2e,0x33,0x39,0x31,0x2c,0x30,0x2e,0x36,0x35,0x37,
-    0x2d,0x30,0x2e,0x33,0x39,0x31,0x68,0x36,0x2e,0x30,
-    0x31,0x32,0x63,0x30,0x2e,0x32,0x37,0x33,0x2c,0x30,
-    0x2c,0x30,0x2e,0x35,0x32,0x35,0x2c,0x30,0x2e,0x31,
-    0x34,0x38,0x2c,0x30,0x2e,0x36,0x35,0x37,0x2c,0x30,
-    0x2e,0x33,0x39,0x31,0x0a,0x09,0x09,0x09,0x63,0x30,
-    0x2e,0x31,0x33,0x33,0x2c,0x30,0x2e,0x32,0x34,0x2c,
-    0x30,0x2e,0x31,0x32,0x31,0x2c,0x30,0x2e,0x35,0x33,
-    0x33,0x2d,0x30,0x2e,0x30,0x32,0x36,0x2c,0x30,0x2e,
-    0x37,0x36,0x36,0x6c,0x2d,0x33,0x2e,0x30,0x30,0x35,
-    0x2c,0x34,0x2e,0x36,0x38,0x34,0x43,0x31,0x39,0x2e,
-    0x30,0x32,0x33,0x2c,0x33,0x34,0x2e,0x34,0x39,0x36,
-    0x2c,0x31,0x38,0x2e,0x37,0x38,0x36,0x2c,0x33,0x34,
-    0x2e,0x36,0x32,0x36,0x2c,0x31,0x38,0x2e,0x35,0x33,
-    0x2c,0x33,0x34,0x2e,0x36,0x32,0x36,0x7a,0x20,0x4d,
-    0x31,0x36,0x2e,0x38,0x39,0x37,0x2c,0x32,0x39,0x2e,
-    0x39,0x34,0x32,0x6c,0x31,0x2e,0x36,0x33,0x33,0x2c,
-    0x32,0x2e,0x35,0x34,0x35,0x0a,0x09,0x09,0x09,0x6c,
-    0x31,0x2e,0x36,0x33,0x35,0x2d,0x32,0x2e,0x35,0x34,
-    0x35,0x48,0x31,0x36,0x2e,0x38,0x39,0x37,0x7a,0x22,
-    0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,
-    0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,
-    0x0a
+const size_t help_dpad_leftright_svg_size = 1380;
+const unsigned char help_dpad_leftright_svg_data[1380] = {
+    0x45,0x53,0x5a,0x31,0xa9,0x0c,0x00,0x00,0x78,0xda,
+    0x95,0x56,0xdb,0x8e,0xdb,0x36,0x10,0x7d,0xde,0xfd,
+    0x0a,0x56,0x7d,0x2a,0x40,0x52,0xbc,0x88,0x94,0xb4,
+    0x88,0x13,0x34,0x4e,0x9a,0x04,0x70,0xda,0x00,0x4d,
+    0xb7,0xe8,0x53,0xb0,0xb1,0x1d,0xcb,0xa8,0x6a,0x2f,
+    0x6c,0xaf,0xbd,0xdd,0xaf,0xef,0xcc,0x21,0x6d,0x6b,
+    0x8b,0x0d,0xda,0xf8,0x41,0xe2,0x65,0x78,0x38,0x73,
+    0xce,0xcc,0xc8,0xcf,0x5e,0xdc,0xff,0xd5,0x8b,0xfd,
+    0x7c,0xb3,0x5d,0xae,0x57,0xa3,0xc2,0x6a,0x53,0x88,
+    0xf9,0x6a,0xba,0x9e,0x2d,0x57,0x8b,0x51,0x71,0xb7,
+    0xfb,0xa2,0x9a,0xe2,0xc5,0xf3,0xcb,0x67,0xdf,0x29,
+    0x25,0xde,0xcc,0x57,0xf3,0xcd,0xcd,0x6e,0xbd,0xb9,
+    0x12,0x3f,0xce,0xd6,0x9f,0xe7,0xe2,0x5d,0xdf,0xdf,
+    0x6d,0x77,0x58,0x12,0x36,0x6a,0xa3,0xbd,0x14,0xbf,
+    0x5e,0xbf,0x11,0xaf,0xef,0x6f,0xd7,0x9b,0x9d,0xf8,
+    0xd0,0xdf,0x2d,0xd4,0xbb,0x95,0xd0,0x58,0xbc,0x4e,
+    0x77,0x5c,0x09,0x32,0x34,0xe2,0xe5,0xdd,0xb2,0x9f,
+    0x09,0xf3,0x83,0x10,0x4a,0x31,0xfc,0xab,0x5f,0xc6,
+    0x1f,0xff,0xf8,0xf0,0x5a,0x6c,0xf7,0x0b,0xf1,0xe1,
+    0xb7,0x97,0x93,0x77,0x63,0x51,0xa8,0xb2,0xfc,0xdd,
+    0x8f,0xcb,0xf2,0xd5,0xc7,0x57,0x40,0xb0,0xda,0x96,
+    0xe5,0xeb,0x9f,0x0b,0x51,0x74,0xbb,0xdd,0xed,0x55,
+    0x59,0x1e,0x0e,0x07,0x7d,0xf0,0x7a,0xbd,0x59,0x94,
+    0x6f,0x36,0x37,0xb7,0xdd,0x72,0xba,0x2d,0xc9,0xb0,
+    0x64,0x43,0x3a,0x54,0x12,0x98,0xb5,0x7a,0xb6,0x9b,
+    0x15,0x74,0x05,0x23,0x0f,0xe2,0xb4,0x85,0x58,0xce,
+    0x46,0xc5,0xa7,0x7b,0x6f,0x3e,0x15,0x82,0x48,0x58,
+    0x6d,0x47,0x4f,0xe0,0x3a,0x63,0x0c,0xe3,0x64,0x93,
+    0xab,0xfb,0x7e,0xb9,0xfa,0xf3,0x29,0x43,0xdb,0xb6,
+    0x6d,0x89,0x5d,0x32,0x1d,0x15,0xe6,0xf6,0xbe,0x10,
+    0x7f,0xa7,0xf7,0xe5,0x85,0x38,0x2c,0x67,0xbb,0x6e,
+    0x54,0xf8,0x5a,0x9b,0x68,0x79,0xab,0x9b,0x2f,0x17,
+    0xdd,0x6e,0xb8,0xb2,0x5f,0xce,0x0f,0x2f,0xd7,0x7c,
+    0x54,0x18,0x91,0x96,0xf3,0x8b,0x15,0xb9,0xf9,0xdc,
+    0xcf,0xd5,0xe7,0x9b,0xe9,0x9f,0x8b,0xcd,0xfa,0x6e,
+    0x45,0x8e,0xaf,0xe6,0x07,0xf1,0x84,0x25,0x79,0x79,
+    0xb5,0xbd,0xbd,0x99,0xce,0x47,0xc5,0xed,0x66,0xbe,
+    0x9d,0x6f,0xf6,0x73,0x0e,0x7e,0xf1,0xfc,0xf2,0x02,
+    0x8f,0xfc,0xbc,0x78,0x76,0x7b,0xb3,0xeb,0xc4,0x97,
+    0x65,0xdf,0x8f,0x8a,0xef,0x7f,0xc2,0xaf,0x10,0x04,
+    0xfb,0xde,0x39,0x6d,0x9a,0x28,0x81,0xd7,0xa9,0x5a,
+    0x5b,0x6b,0xa7,0xca,0x69,0xd7,0xb4,0xd2,0x28,0x4f,
+    0xd3,0x56,0x59,0xdd,0xc4,0x98,0xc7,0xf4,0x74,0x76,
+    0xaf,0x1a,0x5d,0x7b,0xf7,0x16,0x93,0xb1,0xd1,0x8d,
+    0xb7,0xd2,0x05,0xed,0x4c,0x94,0x46,0x3a,0xaf,0x7d,
+    0xc5,0x6f,0x06,0x0e,0x7c,0xf7,0xc5,0x1e,0xb8,0x53,
+    0x93,0x71,0x19,0xaf,0x06,0x92,0x04,0x02,0x86,0x1d,
+    0x43,0xfa,0xeb,0x04,0x49,0x2a,0x36,0x21,0xc8,0x84,
+    0x6c,0xbd,0xae,0x1d,0x01,0xda,0x4a,0xb7,0x35,0x21,
+    0x77,0xc9,0x49,0xc2,0x22,0x17,0x13,0x42,0x82,0xcc,
+    0xe3,0xe4,0x22,0x3c,0xc4,0xed,0x40,0x7e,0xc2,0x3e,
+    0x0c,0xec,0xf7,0xc9,0x41,0xc9,0x46,0x29,0xde,0x81,
+    0x6b,0x19,0xb2,0x43,0xd4,0x43,0xe4,0x31,0x82,0xa6,
+    0x7b,0xa3,0x76,0x04,0x8e,0xc8,0x6d,0xa2,0x52,0x0e,
+    0x79,0x7d,0x10,0xef,0xf3,0xb5,0x64,0x11,0xaa,0xb1,
+    0xd3,0x75,0x15,0xd2,0x84,0xd9,0xc0,0xb0,0x6a,0x7d,
+    0x1a,0x22,0x4a,0xf8,0x83,0x3b,0xa6,0x86,0xca,0x87,
+    0x78,0xd5,0xbe,0xe6,0xa7,0xf5,0x7c,0x22,0x22,0x84,
+    0xd3,0xb3,0xb3,0x46,0x3b,0xef,0xf7,0x78,0x39,0x9c,
+    0x08,0xe7,0x13,0xd5,0xd9,0xd4,0xe6,0xc3,0x4c,0xa1,
+    0x69,0x8e,0xf8,0xbe,0xa9,0x14,0x9f,0xa9,0xb1,0xc9,
+    0x63,0x5b,0xf9,0x3c,0x86,0xf9,0x35,0x45,0x56,0x53,
+    0x7a,0x00,0xdf,0x4e,0x81,0xac,0x92,0x5f,0xd8,0x57,
+    0xe7,0x5b,0xd2,0x81,0x24,0x78,0xc2,0x4f,0x86,0xea,
+    0x78,0xc8,0x26,0x4c,0x75,0xb6,0xee,0x14,0x70,0xb3,
+    0xf4,0xb8,0x8a,0xd2,0x09,0x14,0xd1,0x24,0xc4,0x1a,
+    0xbc,0x64,0x3e,0x69,0x98,0xb3,0xf4,0x84,0x9e,0xc2,
+    0xe4,0x3b,0x52,0x84,0xc7,0x3b,0x8e,0xc1,0x66,0x5a,
+    0x26,0x43,0x09,0x1e,0x4d,0x1e,0x8a,0x12,0x95,0x52,
+    0xa2,0x6a,0xca,0x41,0xed,0x7c,0xad,0x68,0x6c,0xa3,
+    0x03,0xe7,0xbc,0xd3,0xb6,0x41,0xb9,0x18,0xeb,0x51,
+    0x2e,0xb1,0xe2,0xf4,0x89,0xbe,0xcd,0x63,0x7a,0x06,
+    0xbb,0xe5,0x95,0x06,0x63,0x79,0x5e,0x9e,0xe6,0x53,
+    0x12,0xeb,0x38,0x24,0x8f,0x26,0x28,0x9b,0x31,0xe0,
+    0x9d,0x74,0x46,0x07,0xd2,0x03,0xaf,0x2a,0xdf,0x29,
+    0x1f,0x79,0x40,0xf9,0x95,0xe7,0xd4,0x95,0x7d,0xdd,
+    0x4e,0xc9,0x07,0x4b,0x64,0x71,0xc1,0xd9,0x8a,0x19,
+    0x69,0x63,0xc8,0x63,0x7a,0x86,0x2d,0x16,0x30,0x64,
+    0xa6,0x8f,0xcb,0xa0,0x74,0x9a,0x8f,0x62,0x45,0xb1,
+    0x61,0x4c,0x43,0x58,0x8c,0xc9,0x8b,0x48,0x3e,0xd9,
+    0x9a,0x52,0x9d,0x24,0x6f,0x75,0x6d,0xeb,0x7c,0xab,
+    0x7c,0xe4,0x43,0x22,0xf5,0x7f,0xb1,0xe9,0x48,0x54,
+    0x1f,0x65,0x43,0x92,0x51,0x0b,0xa2,0xcf,0x85,0x75,
+    0xac,0xab,0xab,0x99,0x53,0x8a,0xda,0xb1,0x1f,0x70,
+    0x26,0x86,0x9a,0x05,0x6f,0x79,0xdb,0x7a,0xc7,0x46,
+    0x15,0xb2,0x0f,0x39,0x18,0xb8,0xef,0x68,0xe3,0x38,
+    0xcd,0xea,0x18,0x7b,0xcf,0x75,0xa0,0x2a,0x72,0xb8,
+    0xba,0x4c,0x99,0xee,0x90,0x82,0x15,0x39,0x49,0x81,
+    0x35,0x69,0x4c,0xd4,0xbb,0x48,0x07,0x93,0xb9,0x84,
+    0xf9,0x94,0x73,0xa8,0x96,0x48,0x77,0xce,0xa7,0xc0,
+    0x1c,0x06,0x97,0xe1,0x25,0xe0,0x59,0x1e,0x13,0x3d,
+    0xb9,0x5d,0x31,0x45,0xd4,0x34,0xac,0x4d,0x31,0xc8,
+    0x61,0x40,0x0f,0x7c,0x35,0xe9,0x13,0x75,0xd3,0xd6,
+    0x92,0x33,0x37,0x76,0x9e,0x6e,0x6c,0x26,0xa0,0x8b,
+    0xee,0x0b,0xb5,0x9d,0x0c,0xb7,0xbf,0x81,0x39,0xce,
+    0xe2,0x90,0x78,0xef,0xe1,0xb8,0xe4,0x20,0xaa,0x3d,
+    0x48,0x9c,0x0c,0x76,0x8f,0x29,0xfe,0x35,0xa0,0x5a,
+    0x37,0xa6,0xe5,0x6c,0x72,0x14,0x3c,0xaa,0xd4,0x82,
+    0x7b,0xd7,0x30,0xc9,0x86,0x7b,0x42,0x65,0x20,0x83,
+    0x6d,0x27,0x8e,0xfb,0x31,0x49,0x6f,0x63,0xd2,0x09,
+    0xd2,0x58,0xca,0x70,0x92,0xa6,0x0a,0xa7,0x4a,0x4f,
+    0xe3,0xe8,0x91,0x56,0x5b,0xb6,0x60,0x14,0x6a,0x73,
+    0x83,0xad,0xe4,0xb5,0x62,0xaf,0x23,0xeb,0xe3,0x71,
+    0x77,0x93,0xd8,0x86,0xea,0x4d,0x62,0x9b,0xbd,0x70,
+    0x35,0x9b,0x54,0xe8,0x82,0x2c,0x8b,0x67,0x55,0xa8,
+    0x79,0x1d,0x87,0x31,0x34,0x7b,0x0e,0x3c,0x89,0xcd,
+    0xea,0xd5,0xd5,0x00,0x0f,0x3e,0x65,0xbb,0x71,0xa3,
+    0x4d,0x40,0x93,0x76,0xa1,0x22,0xda,0x5b,0xef,0x72,
+    0xf4,0x72,0x48,0x05,0x15,0x16,0xe9,0xc3,0xbd,0x0d,
+    0x14,0x3b,0xaa,0xc0,0x54,0xaa,0x6e,0xaf,0x58,0xc4,
+    0x30,0x19,0x6c,0x7f,0x8b,0x6e,0x5e,0x37,0xb9,0x60,
+    0x5c,0xdb,0x23,0x45,0x03,0x48,0x08,0xfb,0xa4,0xdc,
+    0x70,0xff,0xbf,0xb4,0x73,0xa4,0x44,0x1b,0x86,0xe2,
+    0x31,0x47,0xa8,0x0d,0xd0,0xc6,0x9c,0xfa,0xc0,0xea,
+    0x98,0x36,0x09,0x96,0x6a,0x06,0xf5,0xe3,0x5b,0x3c,
+    0xf1,0x05,0x48,0x63,0x66,0x51,0x9d,0x69,0x44,0x21,
+    0x82,0x73,0xea,0x5b,0xa0,0x51,0x0e,0x2c,0xa1,0x59,
+    0xab,0x8e,0x8a,0x04,0x0f,0x01,0x9d,0x87,0x68,0x01,
+    0xe5,0x52,0x43,0xe3,0x80,0xcc,0x0c,0x53,0xa4,0x0b,
+    0x14,0x6c,0x52,0x1e,0x9c,0xbe,0x53,0x69,0x7c,0x4c,
+    0x17,0x40,0x4a,0xe4,0x8b,0x1a,0xec,0x65,0xae,0x52,
+    0x9a,0x8f,0x29,0xf2,0xaa,0x6e,0x10,0x39,0x77,0xc6,
+    0x56,0x7b,0x1f,0x8f,0x32,0x3e,0x62,0x85,0x74,0xa4,
+    0x79,0xcb,0xe2,0x71,0xa1,0xc5,0x3d,0x8b,0x17,0xa1,
+    0x27,0xbe,0x1a,0xde,0xf3,0xa5,0x93,0x47,0x36,0xdf,
+    0x20,0x67,0xaa,0x64,0x4f,0xae,0xb9,0x38,0x19,0x4e,
+    0xc0,0x36,0xff,0x91,0x41,0xe6,0x3b,0x95,0x8b,0x80,
+    0x02,0x49,0x41,0xf5,0xea,0xdf,0x3d,0x0a,0xf9,0xca,
+    0x4d,0xce,0xc1,0xc6,0x42,0xb7,0x54,0x0b,0xa7,0xc6,
+    0xb6,0x3d,0x0b,0x66,0xe5,0xb9,0x29,0xda,0x2e,0xb5,
+    0xce,0xdc,0x39,0x91,0xf3,0xa0,0x1a,0xf9,0x4f,0x56,
+    0x10,0x2e,0xcb,0x4a,0x8e,0x30,0xbd,0xa9,0x9a,0xdc,
+    0x59,0xbb,0x53,0x7b,0xcb,0xae,0xa5,0x7e,0x38,0xa6,
+    0x6a,0x37,0x0e,0x51,0x55,0x6d,0xe4,0xbc,0xac,0xf9,
+    0xbf,0x0d,0x62,0x94,0xc3,0x80,0x1f,0x4e,0x9d,0x0e,
+    0x5c,0xba,0x1e,0xe4,0x4a,0x14,0x0e,0x5f,0x8c,0x39,
+    0x7f,0x4b,0x68,0xfe,0x36,0x59,0x0e,0x78,0xce,0x0f,
+    0xfa,0xfb,0xfd,0xfc,0xf2,0x1f,0x7c,0xb2,0xbe,0xaf
 };
 
@@ -1,325 +1,145 @@
-//this file was auto-generated from "dpad_right.svg" by res2h
+//this file was auto-generated from "dpad_right.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_dpad_right_svg_size = 3168;
-const unsigned char help_dpad_right_svg_data[3168] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x33,0x30,
-    0x5f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,
-    0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,
-    0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,
-    0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,
-    0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,0x3d,
-    0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-    0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,
-    0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,0x6b,0x22,
-    0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,0x20,0x79,
-    0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,0x20,0x77,
-    0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x2d,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3d,
-    0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,
-    0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,
-    0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,0x3e,0x0a,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,
-    0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,
-    0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x32,
-    0x32,0x2e,0x30,0x38,0x36,0x2c,0x33,0x37,0x2e,0x30,
-    0x36,0x68,0x2d,0x37,0x2e,0x31,0x31,0x31,0x63,0x2d,
-    0x32,0x2e,0x32,0x38,0x39,0x2c,0x30,0x2d,0x33,0x2e,
-    0x31,0x31,0x39,0x2d,0x31,0x2e,0x38,0x36,0x36,0x2d,
-    0x33,0x2e,0x31,0x31,0x39,0x2d,0x33,0x2e,0x31,0x32,
-    0x31,0x76,0x2d,0x38,0x2e,0x37,0x33,0x32,0x48,0x33,
-    0x2e,0x31,0x32,0x31,0x43,0x30,0x2e,0x38,0x33,0x31,
-    0x2c,0x32,0x35,0x2e,0x32,0x30,0x36,0x2c,0x30,0x2c,
-    0x32,0x33,0x2e,0x33,0x34,0x2c,0x30,0x2c,0x32,0x32,
-    0x2e,0x30,0x38,0x35,0x0a,0x09,0x09,0x09,0x09,0x76,
-    0x2d,0x37,0x2e,0x31,0x31,0x63,0x30,0x2d,0x32,0x2e,
-    0x32,0x38,0x39,0x2c,0x31,0x2e,0x38,0x36,0x37,0x2d,
-    0x33,0x2e,0x31,0x32,0x2c,0x33,0x2e,0x31,0x32,0x31,
-    0x2d,0x33,0x2e,0x31,0x32,0x68,0x38,0x2e,0x37,0x33,
-    0x33,0x56,0x33,0x2e,0x31,0x32,0x31,0x43,0x31,0x31,
-    0x2e,0x38,0x35,0x35,0x2c,0x30,0x2e,0x38,0x33,0x31,
-    0x2c,0x31,0x33,0x2e,0x37,0x32,0x2c,0x30,0x2c,0x31,
-    0x34,0x2e,0x39,0x37,0x34,0x2c,0x30,0x68,0x37,0x2e,
-    0x31,0x31,0x31,0x63,0x32,0x2e,0x32,0x39,0x2c,0x30,
-    0x2c,0x33,0x2e,0x31,0x32,0x31,0x2c,0x31,0x2e,0x38,
-    0x36,0x37,0x2c,0x33,0x2e,0x31,0x32,0x31,0x2c,0x33,
-    0x2e,0x31,0x32,0x31,0x76,0x38,0x2e,0x37,0x33,0x32,
-    0x0a,0x09,0x09,0x09,0x09,0x68,0x38,0x2e,0x37,0x33,
-    0x31,0x63,0x32,0x2e,0x32,0x39,0x2c,0x30,0x2c,0x33,
-    0x2e,0x31,0x32,0x31,0x2c,0x31,0x2e,0x38,0x36,0x35,
-    0x2c,0x33,0x2e,0x31,0x32,0x31,0x2c,0x33,0x2e,0x31,
-    0x32,0x76,0x37,0x2e,0x31,0x31,0x63,0x30,0x2c,0x32,
-    0x2e,0x32,0x39,0x2d,0x31,0x2e,0x38,0x36,0x36,0x2c,
-    0x33,0x2e,0x31,0x32,0x31,0x2d,0x33,0x2e,0x31,0x32,
-    0x31,0x2c,0x33,0x2e,0x31,0x32,0x31,0x68,0x2d,0x38,
-    0x2e,0x37,0x33,0x31,0x76,0x38,0x2e,0x37,0x33,0x32,
-    0x0a,0x09,0x09,0x09,0x09,0x43,0x32,0x35,0x2e,0x32,
-    0x30,0x37,0x2c,0x33,0x36,0x2e,0x32,0x32,0x39,0x2c,
-    0x32,0x33,0x2e,0x33,0x34,0x31,0x2c,0x33,0x37,0x2e,
-    0x30,0x36,0x2c,0x32,0x32,0x2e,0x30,0x38,0x36,0x2c,
-    0x33,0x37,0x2e,0x30,0x36,0x7a,0x20,0x4d,0x33,0x2e,
-    0x31,0x32,0x31,0x2c,0x31,0x33,0x2e,0x33,0x35,0x34,
-    0x43,0x32,0x2e,0x37,0x34,0x35,0x2c,0x31,0x33,0x2e,
-    0x33,0x35,0x39,0x2c,0x31,0x2e,0x35,0x2c,0x31,0x33,
-    0x2e,0x34,0x39,0x33,0x2c,0x31,0x2e,0x35,0x2c,0x31,
-    0x34,0x2e,0x39,0x37,0x34,0x76,0x37,0x2e,0x31,0x31,
-    0x0a,0x09,0x09,0x09,0x09,0x63,0x30,0x2e,0x30,0x30,
-    0x36,0x2c,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,0x2e,
-    0x31,0x33,0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2c,
-    0x31,0x2e,0x36,0x32,0x31,0x2c,0x31,0x2e,0x36,0x32,
-    0x31,0x68,0x31,0x30,0x2e,0x32,0x33,0x33,0x76,0x31,
-    0x30,0x2e,0x32,0x33,0x32,0x63,0x30,0x2e,0x30,0x30,
-    0x35,0x2c,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,0x2e,
-    0x31,0x34,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2c,0x31,
-    0x2e,0x36,0x31,0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,
-    0x68,0x37,0x2e,0x31,0x30,0x38,0x0a,0x09,0x09,0x09,
-    0x09,0x63,0x30,0x2e,0x33,0x38,0x34,0x2d,0x30,0x2e,
-    0x30,0x30,0x37,0x2c,0x31,0x2e,0x36,0x32,0x34,0x2d,
-    0x30,0x2e,0x31,0x34,0x33,0x2c,0x31,0x2e,0x36,0x32,
-    0x34,0x2d,0x31,0x2e,0x36,0x32,0x31,0x56,0x32,0x33,
-    0x2e,0x37,0x30,0x36,0x68,0x31,0x30,0x2e,0x32,0x33,
-    0x31,0x63,0x30,0x2e,0x33,0x37,0x36,0x2d,0x30,0x2e,
-    0x30,0x30,0x36,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2d,
-    0x30,0x2e,0x31,0x34,0x2c,0x31,0x2e,0x36,0x32,0x31,
-    0x2d,0x31,0x2e,0x36,0x32,0x31,0x76,0x2d,0x37,0x2e,
-    0x31,0x31,0x0a,0x09,0x09,0x09,0x09,0x63,0x2d,0x30,
-    0x2e,0x30,0x30,0x36,0x2d,0x30,0x2e,0x33,0x37,0x36,
-    0x2d,0x30,0x2e,0x31,0x34,0x2d,0x31,0x2e,0x36,0x32,
-    0x2d,0x31,0x2e,0x36,0x32,0x31,0x2d,0x31,0x2e,0x36,
-    0x32,0x68,0x2d,0x31,0x30,0x2e,0x32,0x33,0x56,0x33,
-    0x2e,0x31,0x32,0x31,0x43,0x32,0x33,0x2e,0x37,0x30,
-    0x31,0x2c,0x32,0x2e,0x37,0x34,0x35,0x2c,0x32,0x33,
-    0x2e,0x35,0x36,0x37,0x2c,0x31,0x2e,0x35,0x2c,0x32,
-    0x32,0x2e,0x30,0x38,0x36,0x2c,0x31,0x2e,0x35,0x68,
-    0x2d,0x37,0x2e,0x31,0x31,0x31,0x0a,0x09,0x09,0x09,
-    0x09,0x63,0x2d,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,
-    0x2e,0x30,0x30,0x36,0x2d,0x31,0x2e,0x36,0x31,0x39,
-    0x2c,0x30,0x2e,0x31,0x34,0x2d,0x31,0x2e,0x36,0x31,
-    0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,0x76,0x31,0x30,
-    0x2e,0x32,0x33,0x32,0x4c,0x33,0x2e,0x31,0x32,0x31,
-    0x2c,0x31,0x33,0x2e,0x33,0x35,0x34,0x4c,0x33,0x2e,
-    0x31,0x32,0x31,0x2c,0x31,0x33,0x2e,0x33,0x35,0x34,
-    0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,
-    0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,
-    0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,
-    0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,0x32,0x32,0x2e,
-    0x31,0x38,0x31,0x63,0x2d,0x32,0x2e,0x30,0x31,0x33,
-    0x2c,0x30,0x2d,0x33,0x2e,0x36,0x34,0x39,0x2d,0x31,
-    0x2e,0x36,0x33,0x39,0x2d,0x33,0x2e,0x36,0x34,0x39,
-    0x2d,0x33,0x2e,0x36,0x35,0x31,0x73,0x31,0x2e,0x36,
-    0x33,0x38,0x2d,0x33,0x2e,0x36,0x35,0x2c,0x33,0x2e,
-    0x36,0x34,0x39,0x2d,0x33,0x2e,0x36,0x35,0x63,0x32,
-    0x2e,0x30,0x31,0x33,0x2c,0x30,0x2c,0x33,0x2e,0x36,
-    0x35,0x2c,0x31,0x2e,0x36,0x33,0x39,0x2c,0x33,0x2e,
-    0x36,0x35,0x2c,0x33,0x2e,0x36,0x35,0x0a,0x09,0x09,
-    0x09,0x43,0x32,0x32,0x2e,0x31,0x38,0x32,0x2c,0x32,
-    0x30,0x2e,0x35,0x34,0x33,0x2c,0x32,0x30,0x2e,0x35,
-    0x34,0x34,0x2c,0x32,0x32,0x2e,0x31,0x38,0x31,0x2c,
-    0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,0x32,0x32,0x2e,
-    0x31,0x38,0x31,0x7a,0x20,0x4d,0x31,0x38,0x2e,0x35,
-    0x33,0x31,0x2c,0x31,0x36,0x2e,0x33,0x37,0x39,0x63,
-    0x2d,0x31,0x2e,0x31,0x38,0x36,0x2c,0x30,0x2d,0x32,
-    0x2e,0x31,0x34,0x39,0x2c,0x30,0x2e,0x39,0x36,0x35,
-    0x2d,0x32,0x2e,0x31,0x34,0x39,0x2c,0x32,0x2e,0x31,
-    0x35,0x73,0x30,0x2e,0x39,0x36,0x35,0x2c,0x32,0x2e,
-    0x31,0x35,0x31,0x2c,0x32,0x2e,0x31,0x34,0x39,0x2c,
-    0x32,0x2e,0x31,0x35,0x31,0x0a,0x09,0x09,0x09,0x63,
-    0x31,0x2e,0x31,0x38,0x36,0x2c,0x30,0x2c,0x32,0x2e,
-    0x31,0x35,0x2d,0x30,0x2e,0x39,0x36,0x36,0x2c,0x32,
-    0x2e,0x31,0x35,0x2d,0x32,0x2e,0x31,0x35,0x31,0x43,
-    0x32,0x30,0x2e,0x36,0x38,0x32,0x2c,0x31,0x37,0x2e,
-    0x33,0x34,0x34,0x2c,0x31,0x39,0x2e,0x37,0x31,0x37,
-    0x2c,0x31,0x36,0x2e,0x33,0x37,0x39,0x2c,0x31,0x38,
-    0x2e,0x35,0x33,0x31,0x2c,0x31,0x36,0x2e,0x33,0x37,
-    0x39,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,
-    0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,
-    0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,
-    0x64,0x3d,0x22,0x4d,0x32,0x31,0x2e,0x35,0x33,0x36,
-    0x2c,0x38,0x2e,0x36,0x31,0x36,0x68,0x2d,0x36,0x2e,
-    0x30,0x31,0x32,0x63,0x2d,0x30,0x2e,0x32,0x37,0x33,
-    0x2c,0x30,0x2d,0x30,0x2e,0x35,0x32,0x35,0x2d,0x30,
-    0x2e,0x31,0x35,0x2d,0x30,0x2e,0x36,0x35,0x37,0x2d,
-    0x30,0x2e,0x33,0x39,0x63,0x2d,0x30,0x2e,0x31,0x33,
-    0x32,0x2d,0x30,0x2e,0x32,0x34,0x31,0x2d,0x30,0x2e,
-    0x31,0x32,0x31,0x2d,0x30,0x2e,0x35,0x33,0x34,0x2c,
-    0x30,0x2e,0x30,0x32,0x36,0x2d,0x30,0x2e,0x37,0x36,
-    0x36,0x6c,0x33,0x2e,0x30,0x30,0x35,0x2d,0x34,0x2e,
-    0x36,0x38,0x34,0x0a,0x09,0x09,0x09,0x63,0x30,0x2e,
-    0x32,0x37,0x36,0x2d,0x30,0x2e,0x34,0x33,0x31,0x2c,
-    0x30,0x2e,0x39,0x38,0x36,0x2d,0x30,0x2e,0x34,0x33,
-    0x2c,0x31,0x2e,0x32,0x36,0x34,0x2c,0x30,0x6c,0x33,
-    0x2e,0x30,0x30,0x35,0x2c,0x34,0x2e,0x36,0x38,0x34,
-    0x63,0x30,0x2e,0x31,0x34,0x37,0x2c,0x30,0x2e,0x32,
-    0x33,0x31,0x2c,0x30,0x2e,0x31,0x35,0x39,0x2c,0x30,
-    0x2e,0x35,0x32,0x34,0x2c,0x30,0x2e,0x30,0x32,0x36,
-    0x2c,0x30,0x2e,0x37,0x36,0x36,0x43,0x32,0x32,0x2e,
-    0x30,0x36,0x33,0x2c,0x38,0x2e,0x34,0x36,0x36,0x2c,
-    0x32,0x31,0x2e,0x38,0x31,0x31,0x2c,0x38,0x2e,0x36,
-    0x31,0x36,0x2c,0x32,0x31,0x2e,0x35,0x33,0x36,0x2c,
-    0x38,0x2e,0x36,0x31,0x36,0x7a,0x0a,0x09,0x09,0x09,
-    0x20,0x4d,0x31,0x36,0x2e,0x38,0x39,0x37,0x2c,0x37,
-    0x2e,0x31,0x31,0x36,0x68,0x33,0x2e,0x32,0x36,0x38,
-    0x4c,0x31,0x38,0x2e,0x35,0x33,0x2c,0x34,0x2e,0x35,
-    0x37,0x31,0x4c,0x31,0x36,0x2e,0x38,0x39,0x37,0x2c,
-    0x37,0x2e,0x31,0x31,0x36,0x7a,0x22,0x2f,0x3e,0x0a,
-    0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,0x67,0x3e,
-    0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,
-    0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x37,0x2e,
-    0x38,0x30,0x39,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,
-    0x63,0x2d,0x30,0x2e,0x31,0x34,0x31,0x2c,0x30,0x2d,
-    0x30,0x2e,0x32,0x38,0x32,0x2d,0x30,0x2e,0x30,0x34,
-    0x2d,0x30,0x2e,0x34,0x30,0x35,0x2d,0x30,0x2e,0x31,
-    0x31,0x39,0x4c,0x32,0x2e,0x37,0x32,0x2c,0x31,0x39,
-    0x2e,0x31,0x36,0x32,0x63,0x2d,0x30,0x2e,0x32,0x31,
-    0x35,0x2d,0x30,0x2e,0x31,0x33,0x38,0x2d,0x30,0x2e,
-    0x33,0x34,0x35,0x2d,0x30,0x2e,0x33,0x37,0x36,0x2d,
-    0x30,0x2e,0x33,0x34,0x35,0x2d,0x30,0x2e,0x36,0x33,
-    0x31,0x0a,0x09,0x09,0x09,0x73,0x30,0x2e,0x31,0x33,
-    0x2d,0x30,0x2e,0x34,0x39,0x33,0x2c,0x30,0x2e,0x33,
-    0x34,0x35,0x2d,0x30,0x2e,0x36,0x33,0x31,0x6c,0x34,
-    0x2e,0x36,0x38,0x34,0x2d,0x33,0x2e,0x30,0x30,0x36,
-    0x63,0x30,0x2e,0x32,0x33,0x2d,0x30,0x2e,0x31,0x34,
-    0x38,0x2c,0x30,0x2e,0x35,0x32,0x34,0x2d,0x30,0x2e,
-    0x31,0x35,0x38,0x2c,0x30,0x2e,0x37,0x36,0x36,0x2d,
-    0x30,0x2e,0x30,0x32,0x37,0x63,0x30,0x2e,0x32,0x34,
-    0x2c,0x30,0x2e,0x31,0x33,0x31,0x2c,0x30,0x2e,0x33,
-    0x39,0x2c,0x30,0x2e,0x33,0x38,0x34,0x2c,0x30,0x2e,
-    0x33,0x39,0x2c,0x30,0x2e,0x36,0x35,0x38,0x76,0x36,
-    0x2e,0x30,0x31,0x0a,0x09,0x09,0x09,0x63,0x30,0x2c,
-    0x30,0x2e,0x32,0x37,0x34,0x2d,0x30,0x2e,0x31,0x34,
-    0x38,0x2c,0x30,0x2e,0x35,0x32,0x36,0x2d,0x30,0x2e,
-    0x33,0x39,0x2c,0x30,0x2e,0x36,0x35,0x38,0x43,0x38,
-    0x2e,0x30,0x35,0x36,0x2c,0x32,0x32,0x2e,0x32,0x35,
-    0x34,0x2c,0x37,0x2e,0x39,0x33,0x32,0x2c,0x32,0x32,
-    0x2e,0x32,0x38,0x34,0x2c,0x37,0x2e,0x38,0x30,0x39,
-    0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,0x7a,0x20,0x4d,
-    0x34,0x2e,0x35,0x31,0x34,0x2c,0x31,0x38,0x2e,0x35,
-    0x33,0x6c,0x32,0x2e,0x35,0x34,0x35,0x2c,0x31,0x2e,
-    0x36,0x33,0x32,0x76,0x2d,0x33,0x2e,0x32,0x36,0x35,
-    0x4c,0x34,0x2e,0x35,0x31,0x34,0x2c,0x31,0x38,0x2e,
-    0x35,0x33,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,
-    0x67,0x3e,0x0a,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,
-    0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,
-    0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,
-    0x20,0x64,0x3d,0x22,0x4d,0x33,0x33,0x2e,0x38,0x37,
-    0x39,0x2c,0x31,0x38,0x2e,0x35,0x32,0x39,0x6c,0x2d,
-    0x34,0x2e,0x36,0x38,0x35,0x2d,0x33,0x2e,0x30,0x30,
-    0x35,0x76,0x36,0x2e,0x30,0x31,0x4c,0x33,0x33,0x2e,
-    0x38,0x37,0x39,0x2c,0x31,0x38,0x2e,0x35,0x32,0x39,
-    0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,
-    0x22,0x4d,0x32,0x39,0x2e,0x31,0x39,0x35,0x2c,0x32,
-    0x32,0x2e,0x32,0x38,0x34,0x63,0x2d,0x30,0x2e,0x31,
-    0x32,0x34,0x2c,0x30,0x2d,0x30,0x2e,0x32,0x34,0x36,
-    0x2d,0x30,0x2e,0x30,0x33,0x2d,0x30,0x2e,0x33,0x35,
-    0x38,0x2d,0x30,0x2e,0x30,0x39,0x32,0x63,0x2d,0x30,
-    0x2e,0x32,0x34,0x31,0x2d,0x30,0x2e,0x31,0x33,0x32,
-    0x2d,0x30,0x2e,0x33,0x39,0x32,0x2d,0x30,0x2e,0x33,
-    0x38,0x34,0x2d,0x30,0x2e,0x33,0x39,0x32,0x2d,0x30,
-    0x2e,0x36,0x35,0x38,0x76,0x2d,0x36,0x2e,0x30,0x31,
-    0x0a,0x09,0x09,0x09,0x63,0x30,0x2d,0x30,0x2e,0x32,
-    0x37,0x34,0x2c,0x30,0x2e,0x31,0x34,0x39,0x2d,0x30,
-    0x2e,0x35,0x32,0x36,0x2c,0x30,0x2e,0x33,0x39,0x32,
-    0x2d,0x30,0x2e,0x36,0x35,0x38,0x63,0x30,0x2e,0x32,
-    0x33,0x39,0x2d,0x30,0x2e,0x31,0x33,0x31,0x2c,0x30,
-    0x2e,0x35,0x33,0x33,0x2d,0x30,0x2e,0x31,0x32,0x33,
-    0x2c,0x30,0x2e,0x37,0x36,0x35,0x2c,0x30,0x2e,0x30,
-    0x32,0x37,0x6c,0x34,0x2e,0x36,0x38,0x35,0x2c,0x33,
-    0x2e,0x30,0x30,0x35,0x63,0x30,0x2e,0x32,0x31,0x35,
-    0x2c,0x30,0x2e,0x31,0x33,0x38,0x2c,0x30,0x2e,0x33,
-    0x34,0x35,0x2c,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,
-    0x2e,0x33,0x34,0x35,0x2c,0x30,0x2e,0x36,0x33,0x31,
-    0x0a,0x09,0x09,0x09,0x73,0x2d,0x30,0x2e,0x31,0x33,
-    0x2c,0x30,0x2e,0x34,0x39,0x33,0x2d,0x30,0x2e,0x33,
-    0x34,0x35,0x2c,0x30,0x2e,0x36,0x33,0x31,0x6c,0x2d,
-    0x34,0x2e,0x36,0x38,0x35,0x2c,0x33,0x2e,0x30,0x30,
-    0x34,0x43,0x32,0x39,0x2e,0x34,0x37,0x38,0x2c,0x32,
-    0x32,0x2e,0x32,0x34,0x34,0x2c,0x32,0x39,0x2e,0x33,
-    0x33,0x36,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,0x2c,
-    0x32,0x39,0x2e,0x31,0x39,0x35,0x2c,0x32,0x32,0x2e,
-    0x32,0x38,0x34,0x7a,0x20,0x4d,0x32,0x39,0x2e,0x39,
-    0x34,0x35,0x2c,0x31,0x36,0x2e,0x38,0x39,0x36,0x76,
-    0x33,0x2e,0x32,0x36,0x36,0x6c,0x32,0x2e,0x35,0x34,
-    0x36,0x2d,0x31,0x2e,0x36,0x33,0x33,0x0a,0x09,0x09,
-    0x09,0x4c,0x32,0x39,0x2e,0x39,0x34,0x35,0x2c,0x31,
-    0x36,0x2e,0x38,0x39,0x36,0x7a,0x22,0x2f,0x3e,0x0a,
-    0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,0x67,0x3e,
-    0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,
-    0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x31,0x38,
-    0x2e,0x35,0x33,0x2c,0x33,0x34,0x2e,0x36,0x32,0x36,
-    0x4c,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x34,0x2e,
-    0x36,0x32,0x36,0x63,0x2d,0x30,0x2e,0x32,0x35,0x35,
-    0x2c,0x30,0x2d,0x30,0x2e,0x34,0x39,0x32,0x2d,0x30,
-    0x2e,0x31,0x33,0x2d,0x30,0x2e,0x36,0x33,0x31,0x2d,
-    0x30,0x2e,0x33,0x34,0x35,0x6c,0x2d,0x33,0x2e,0x30,
-    0x30,0x35,0x2d,0x34,0x2e,0x36,0x38,0x34,0x0a,0x09,
-    0x09,0x09,0x63,0x2d,0x30,0x2e,0x31,0x34,0x37,0x2d,
-    0x30,0x2e,0x32,0x33,0x31,0x2d,0x30,0x2e,0x31,0x35,
-    0x38,0x2d,0x30,0x2e,0x35,0x32,0x34,0x2d,0x30,0x2e,
-    0x30,0x32,0x36,0x2d,0x30,0x2e,0x37,0x36,0x36,0x73,
-    0x30,0x2e,0x33,0x38,0x34,0x2d,0x30,0x2e,0x33,0x39,
-    0x31,0x2c,0x30,0x2e,0x36,0x35,0x37,0x2d,0x30,0x2e,
-    0x33,0x39,0x31,0x68,0x36,0x2e,0x30,0x31,0x32,0x63,
-    0x30,0x2e,0x32,0x37,0x33,0x2c,0x30,0x2c,0x30,0x2e,
-    0x35,0x32,0x35,0x2c,0x30,0x2e,0x31,0x34,0x38,0x2c,
-    0x30,0x2e,0x36,0x35,0x37,0x2c,0x30,0x2e,0x33,0x39,
-    0x31,0x0a,0x09,0x09,0x09,0x63,0x30,0x2e,0x31,0x33,
-    0x33,0x2c,0x30,0x2e,0x32,0x34,0x2c,0x30,0x2e,0x31,
-    0x32,0x31,0x2c,0x30,0x2e,0x35,0x33,0x33,0x2d,0x30,
-    0x2e,0x30,0x32,0x36,0x2c,0x30,0x2e,0x37,0x36,0x36,
-    0x6c,0x2d,0x33,0x2e,0x30,0x30,0x35,0x2c,0x34,0x2e,
-    0x36,0x38,0x34,0x43,0x31,0x39,0x2e,0x30,0x32,0x33,
-    0x2c,0x33,0x34,0x2e,0x34,0x39,0x36,0x2c,0x31,0x38,
-    0x2e,0x37,0x38,0x36,0x2c,0x33,0x34,0x2e,0x36,0x32,
-    0x36,0x2c,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x34,
-    0x2e,0x36,0x32,0x36,0x7a,0x20,0x4d,0x31,0x36,0x2e,
-    0x38,0x39,0x37,0x2c,0x32,0x39,0x2e,0x39,0x34,0x32,
-    0x6c,0x31,0x2e,0x36,0x33,0x33,0x2c,0x32,0x2e,0x35,
-    0x34,0x35,0x0a,0x09,0x09,0x09,0x6c,0x31,0x2e,0x36,
-    0x33,0x35,0x2d,0x32,0x2e,0x35,0x34,0x35,0x48,0x31,
-    0x36,0x2e,0x38,0x39,0x37,0x7a,0x22,0x2f,0x3e,0x0a,
-    0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x67,0x3e,
-    0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a
+const size_t help_dpad_right_svg_size = 1364;
+const unsigned char help_dpad_right_svg_data[1364] = {
+    0x45,0x53,0x5a,0x31,0x60,0x0c,0x00,0x00,0x78,0xda,
+    0x95,0x56,0xdb,0x6e,0x1b,0x37,0x10,0x7d,0xb6,0xbf,
+    0x82,0xdd,0x3e,0x15,0x20,0xb9,0xbc,0x2c,0xb9,0xbb,
+    0x46,0x94,0xa0,0x51,0xd2,0x24,0x80,0xd2,0x06,0x68,
+    0xea,0xa2,0x4f,0x81,0x23,0x29,0x5a,0x21,0x5b,0xc9,
+    0x90,0x64,0xc9,0xf5,0xd7,0x77,0xe6,0x90,0x92,0xd6,
+    0x85,0x03,0x34,0x7e,0xe0,0xf2,0x32,0x3c,0x9c,0x39,
+    0x67,0x66,0xe4,0x67,0x2f,0xee,0xff,0xee,0xc5,0x7e,
+    0xbe,0xd9,0x2e,0xd7,0xab,0x51,0x61,0xb5,0x29,0xc4,
+    0x7c,0x35,0x5d,0xcf,0x96,0xab,0xc5,0xa8,0xb8,0xdb,
+    0x7d,0x51,0x4d,0xf1,0xe2,0xf9,0xe5,0xb3,0x1f,0x94,
+    0x12,0x6f,0xe6,0xab,0xf9,0xe6,0x66,0xb7,0xde,0x5c,
+    0x89,0x9f,0x67,0xeb,0xcf,0x73,0xf1,0xae,0xef,0xef,
+    0xb6,0x3b,0x6c,0x09,0x1b,0xb5,0xd1,0x5e,0x8a,0xdf,
+    0xaf,0xdf,0x88,0xd7,0xf7,0xb7,0xeb,0xcd,0x4e,0x7c,
+    0xe8,0xef,0x16,0xea,0xdd,0x4a,0x68,0x6c,0x5e,0xa7,
+    0x37,0xae,0x04,0x19,0x1a,0xf1,0xf2,0x6e,0xd9,0xcf,
+    0x84,0xf9,0x49,0x08,0xa5,0x18,0xfe,0xd5,0x6f,0xe3,
+    0x8f,0x7f,0x7d,0x78,0x2d,0xb6,0xfb,0x85,0xf8,0xf0,
+    0xc7,0xcb,0xc9,0xbb,0xb1,0x28,0x54,0x59,0xfe,0xe9,
+    0xc7,0x65,0xf9,0xea,0xe3,0x2b,0x20,0x58,0x6d,0xcb,
+    0xf2,0xf5,0xaf,0x85,0x28,0xba,0xdd,0xee,0xf6,0xaa,
+    0x2c,0x0f,0x87,0x83,0x3e,0x78,0xbd,0xde,0x2c,0xca,
+    0x37,0x9b,0x9b,0xdb,0x6e,0x39,0xdd,0x96,0x64,0x58,
+    0xb2,0x21,0x5d,0x2a,0x09,0xcc,0x5a,0x3d,0xdb,0xcd,
+    0x0a,0x7a,0x82,0x91,0x07,0x71,0xda,0x42,0x2c,0x67,
+    0xa3,0xe2,0xd3,0xbd,0x37,0x9f,0x0a,0x41,0x24,0xac,
+    0xb6,0xa3,0x27,0x70,0x9d,0x31,0x86,0x71,0xb2,0xc9,
+    0xd5,0x7d,0xbf,0x5c,0x7d,0x7d,0xca,0xd0,0xb6,0x6d,
+    0x5b,0xe2,0x94,0x4c,0x47,0x85,0xb9,0xbd,0x2f,0xc4,
+    0x3f,0xe9,0x7b,0x79,0x21,0x0e,0xcb,0xd9,0xae,0x1b,
+    0x15,0xbe,0xd6,0x26,0x5a,0x3e,0xea,0xe6,0xcb,0x45,
+    0xb7,0x1b,0xee,0xec,0x97,0xf3,0xc3,0xcb,0x35,0x5f,
+    0x15,0x46,0xa4,0xed,0xfc,0x61,0x45,0x6e,0x3e,0xf7,
+    0x73,0xf5,0xf9,0x66,0xfa,0x75,0xb1,0x59,0xdf,0xad,
+    0xc8,0xf1,0xd5,0xfc,0x20,0x9e,0xb0,0x24,0x2f,0xaf,
+    0xb6,0xb7,0x37,0xd3,0xf9,0xa8,0xb8,0xdd,0xcc,0xb7,
+    0xf3,0xcd,0x7e,0xce,0xc1,0x2f,0x9e,0x5f,0x5e,0x60,
+    0xc8,0xe3,0xc5,0xb3,0xdb,0x9b,0x5d,0x27,0xbe,0x2c,
+    0xfb,0x7e,0x54,0xfc,0xf8,0x0b,0xfe,0x0a,0x41,0xb0,
+    0xef,0x9d,0xd3,0xa6,0x89,0x12,0x78,0x9d,0xaa,0xb5,
+    0xb5,0x76,0xaa,0x9c,0x76,0x4d,0x2b,0x8d,0xf2,0xb4,
+    0x6c,0x95,0xd5,0x4d,0x8c,0x79,0x4e,0xa3,0xb3,0x7b,
+    0xd5,0xe8,0xda,0xbb,0xb7,0x58,0x8c,0x8d,0x6e,0xbc,
+    0x95,0x2e,0x68,0x67,0xa2,0x34,0xd2,0x79,0xed,0x2b,
+    0xfe,0x32,0x70,0xe0,0xb7,0x2f,0xf6,0xc0,0x9d,0x9a,
+    0x8c,0xcb,0x78,0x35,0x90,0x24,0x10,0x30,0xed,0x18,
+    0xd2,0x5f,0x27,0x48,0x52,0xb1,0x09,0x41,0x26,0x64,
+    0xeb,0x75,0xed,0x08,0xd0,0x56,0xba,0xad,0x09,0xb9,
+    0x4b,0x4e,0x12,0x16,0xb9,0x98,0x10,0x12,0x64,0x9e,
+    0x27,0x17,0xe1,0x21,0x5e,0x07,0xf2,0x13,0xf6,0x61,
+    0x60,0xbf,0x4f,0x0e,0x4a,0x36,0x4a,0xf1,0x0e,0x5c,
+    0xcb,0x90,0x1d,0xa2,0x1e,0x22,0x8f,0x11,0x34,0xbd,
+    0x1b,0xb5,0x23,0x70,0x44,0x6e,0x13,0x95,0x72,0xc8,
+    0xeb,0x83,0x78,0x9f,0x9f,0x25,0x8b,0x50,0x8d,0x9d,
+    0xae,0xab,0x90,0x16,0xcc,0x06,0xa6,0x55,0xeb,0xd3,
+    0x14,0x51,0xc2,0x1f,0xbc,0x31,0x35,0x54,0x3e,0xc4,
+    0xab,0xf6,0x35,0x8f,0xd6,0xf3,0x8d,0x88,0x10,0x4e,
+    0x63,0x67,0x8d,0x76,0xde,0xef,0xf1,0x71,0xb8,0x11,
+    0xce,0x37,0xaa,0xb3,0xa9,0xcd,0x97,0x99,0x42,0xd3,
+    0x1c,0xf1,0x7d,0x53,0x29,0xbe,0x53,0xe3,0x90,0xe7,
+    0xb6,0xf2,0x79,0x0e,0xf3,0x6b,0x8a,0xac,0xa6,0xf4,
+    0x00,0xbe,0x9d,0x02,0x59,0x25,0xbf,0x70,0xae,0xce,
+    0xaf,0xa4,0x0b,0x49,0xf0,0x84,0x9f,0x0c,0xd5,0xf1,
+    0x92,0x4d,0x98,0xea,0x6c,0xdd,0x29,0xe0,0x66,0xe9,
+    0xf1,0x14,0xa5,0x13,0x28,0xa2,0x45,0x88,0x35,0x78,
+    0xc9,0x7c,0xd2,0x34,0x67,0xe9,0x09,0x3d,0x85,0xc9,
+    0x6f,0xa4,0x08,0x8f,0x6f,0x1c,0x83,0xcd,0xb4,0x4c,
+    0x86,0x12,0x3c,0x5a,0x3c,0x14,0x25,0x2a,0xa5,0x44,
+    0xd5,0x94,0x83,0xda,0xf9,0x56,0xd1,0xd8,0x46,0x07,
+    0xce,0x79,0xa7,0x6d,0x83,0x72,0x31,0xd6,0xa3,0x5c,
+    0x62,0xc5,0xe9,0x13,0x7d,0x9b,0xe7,0x34,0x06,0xbb,
+    0xe5,0x9d,0x06,0x73,0x79,0xde,0x9e,0xe6,0x5b,0x12,
+    0xfb,0xb8,0x24,0x8f,0x26,0x28,0x9b,0x31,0xe0,0x9d,
+    0x74,0x46,0x07,0xd2,0x03,0x9f,0x2a,0xbf,0x29,0x1f,
+    0x79,0x40,0xf9,0x95,0xd7,0xd4,0x95,0x7d,0xdd,0x4e,
+    0xc9,0x07,0x4b,0x64,0x71,0xc1,0xd9,0x8a,0x19,0x69,
+    0x63,0xc8,0x73,0x1a,0xc3,0x16,0x1b,0x98,0x32,0xd3,
+    0xc7,0x6d,0x50,0x3a,0xcd,0x57,0xb1,0xa3,0xd8,0x30,
+    0xa6,0x29,0x2c,0xc6,0xe4,0x45,0x24,0x9f,0x6c,0x4d,
+    0xa9,0x4e,0x92,0xb7,0xba,0xb6,0x75,0x7e,0x55,0x3e,
+    0xf2,0x21,0x91,0xfa,0xbf,0xd8,0x74,0x24,0xaa,0x8f,
+    0xb2,0x21,0xc9,0xa8,0x05,0xd1,0xcf,0x85,0x75,0xac,
+    0xab,0xab,0x99,0x53,0x8a,0xda,0xb1,0x1f,0x70,0x26,
+    0x86,0x9a,0x05,0x6f,0xf9,0xd8,0x7a,0xc7,0x46,0x15,
+    0xb2,0x0f,0x39,0x18,0xb8,0xef,0x68,0xe3,0x38,0xcd,
+    0xea,0x18,0x7b,0xcf,0x75,0xa0,0x2a,0x72,0xb8,0xba,
+    0x4c,0x99,0xee,0x90,0x82,0x15,0x39,0x49,0x81,0x35,
+    0x69,0x4e,0xd4,0xbb,0x48,0x17,0x93,0xb9,0x84,0xf9,
+    0x94,0x73,0xa8,0x96,0x48,0x77,0xce,0xa7,0xc0,0x1c,
+    0x06,0x97,0xe1,0x25,0xe0,0x59,0x1e,0x13,0x3d,0xb9,
+    0x5d,0x31,0x45,0xd4,0x34,0xac,0x4d,0x31,0xc8,0x61,
+    0x40,0x0f,0xfc,0x34,0xe9,0x13,0x75,0xd3,0xd6,0x92,
+    0x33,0x37,0x76,0x9e,0x5e,0x6c,0x26,0xa0,0x8b,0xde,
+    0x0b,0xb5,0x9d,0x0c,0x8f,0xbf,0x83,0xb9,0x5a,0x37,
+    0xa6,0xe5,0x24,0x70,0xe4,0x33,0x8a,0xcb,0x82,0x32,
+    0xd7,0x30,0x37,0x86,0x4b,0xb9,0x32,0x60,0xcf,0xb6,
+    0x13,0xc7,0x6d,0x94,0x14,0xb3,0x31,0xd1,0x0b,0x46,
+    0x2d,0x25,0x26,0x31,0x5a,0x85,0x53,0x81,0xa6,0x79,
+    0xf4,0xc8,0x86,0x2d,0x5b,0x30,0x0a,0x75,0xa7,0xc1,
+    0x51,0x0f,0x96,0x14,0x33,0x16,0x99,0x56,0x8f,0xb7,
+    0x9b,0x44,0x12,0xc4,0x6a,0x12,0x49,0xec,0x85,0xab,
+    0xd9,0xa4,0x42,0xf3,0x62,0x36,0x3d,0x93,0x49,0x3d,
+    0xe7,0x38,0x8d,0xa1,0xd9,0xb3,0xe8,0x49,0x23,0x26,
+    0xbd,0xae,0x06,0x78,0xf0,0x29,0xdb,0x8d,0x1b,0x6d,
+    0x02,0x7a,0xab,0x0b,0x15,0xb1,0xd5,0x7a,0x97,0xa3,
+    0x97,0x43,0x2a,0xa8,0x1e,0x88,0x56,0x6e,0x49,0x4c,
+    0x71,0xef,0xa8,0x70,0x52,0x85,0xb9,0xbd,0x62,0xee,
+    0xc3,0x64,0x70,0xfc,0x1d,0x74,0x7b,0xaf,0x9b,0x9c,
+    0xe7,0xae,0xed,0x91,0x59,0x01,0x24,0x04,0x04,0x30,
+    0x79,0x74,0x7e,0xec,0x2a,0xdf,0xcc,0x7a,0x52,0xa2,
+    0x0d,0x43,0xf1,0x98,0x23,0xa4,0x34,0x68,0x63,0x4e,
+    0x7d,0x60,0x75,0x4c,0x9b,0x04,0x4b,0xa9,0x8e,0xb4,
+    0xf7,0x2d,0x46,0x34,0xee,0x34,0x67,0x16,0xd5,0x99,
+    0x46,0xd4,0x0f,0x38,0xa7,0x76,0x03,0x1a,0xe5,0xc0,
+    0x12,0x9a,0xb5,0xea,0xa8,0x48,0xf0,0x10,0xd0,0x79,
+    0x88,0x16,0x90,0xe5,0x35,0x34,0xe6,0x6e,0x44,0xe1,
+    0x4d,0x91,0x2e,0x50,0xb0,0x49,0x79,0x70,0xfa,0x79,
+    0x49,0xf3,0x63,0xba,0x00,0x52,0x22,0x5f,0xd4,0xe0,
+    0x2c,0x73,0x05,0x30,0xfa,0xf9,0x6b,0x75,0x55,0x37,
+    0x88,0x9c,0x1b,0x5a,0xab,0xbd,0x8f,0x47,0x19,0x1f,
+    0xb1,0x42,0x3a,0xd2,0xba,0x65,0xf1,0xb8,0x3e,0xe2,
+    0x9e,0xc5,0x8b,0xd0,0x13,0xcd,0xde,0x7b,0x7e,0x74,
+    0xf2,0xc8,0xe6,0x3b,0xe4,0x4c,0x05,0xe8,0xc9,0x35,
+    0x17,0x27,0xc3,0x05,0xd8,0xe6,0xff,0x3f,0x90,0xf9,
+    0x4e,0xe5,0x22,0xa0,0x40,0x52,0x50,0xbd,0xfa,0x6f,
+    0x6b,0x41,0xbe,0x72,0x6f,0x72,0xb0,0xb1,0xd0,0x2d,
+    0xd5,0xc2,0xa9,0x1f,0x6d,0xcf,0x82,0x59,0x79,0xee,
+    0x65,0xb6,0x4b,0x1d,0x2f,0x37,0x3c,0xe4,0x3c,0xa8,
+    0x46,0xfe,0x93,0x15,0x84,0xcb,0xb2,0x92,0x23,0x4c,
+    0x6f,0xaa,0x26,0x77,0xd6,0xee,0xd4,0x95,0xb2,0x6b,
+    0xa9,0x8d,0x8d,0xa9,0xda,0x8d,0x43,0x54,0x55,0x1b,
+    0x39,0x2f,0x6b,0xfe,0x97,0x04,0x31,0xca,0x61,0xc0,
+    0x0f,0xa7,0x06,0x05,0x2e,0x5d,0x0f,0x72,0x25,0x0a,
+    0x87,0x1f,0xc6,0x9a,0x7f,0x02,0x68,0xfd,0x36,0x59,
+    0x0e,0x78,0xce,0x03,0xfd,0xd7,0xfc,0xfc,0xf2,0x5f,
+    0x75,0xba,0xad,0xd5
 };
 
@@ -1,325 +1,144 @@
-//this file was auto-generated from "dpad_up.svg" by res2h
+//this file was auto-generated from "dpad_up.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_dpad_up_svg_size = 3165;
-const unsigned char help_dpad_up_svg_data[3165] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x33,0x30,
-    0x5f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,
-    0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,
-    0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,
-    0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,
-    0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,0x3d,
-    0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-    0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,
-    0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,0x6b,0x22,
-    0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,0x20,0x79,
-    0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,0x20,0x77,
-    0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x2d,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3d,
-    0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,
-    0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,
-    0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,0x3e,0x0a,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,
-    0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,
-    0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x32,
-    0x32,0x2e,0x30,0x38,0x36,0x2c,0x33,0x37,0x2e,0x30,
-    0x36,0x68,0x2d,0x37,0x2e,0x31,0x31,0x31,0x63,0x2d,
-    0x32,0x2e,0x32,0x38,0x39,0x2c,0x30,0x2d,0x33,0x2e,
-    0x31,0x31,0x39,0x2d,0x31,0x2e,0x38,0x36,0x36,0x2d,
-    0x33,0x2e,0x31,0x31,0x39,0x2d,0x33,0x2e,0x31,0x32,
-    0x31,0x76,0x2d,0x38,0x2e,0x37,0x33,0x32,0x48,0x33,
-    0x2e,0x31,0x32,0x31,0x43,0x30,0x2e,0x38,0x33,0x31,
-    0x2c,0x32,0x35,0x2e,0x32,0x30,0x36,0x2c,0x30,0x2c,
-    0x32,0x33,0x2e,0x33,0x34,0x2c,0x30,0x2c,0x32,0x32,
-    0x2e,0x30,0x38,0x35,0x0a,0x09,0x09,0x09,0x09,0x76,
-    0x2d,0x37,0x2e,0x31,0x31,0x63,0x30,0x2d,0x32,0x2e,
-    0x32,0x38,0x39,0x2c,0x31,0x2e,0x38,0x36,0x37,0x2d,
-    0x33,0x2e,0x31,0x32,0x2c,0x33,0x2e,0x31,0x32,0x31,
-    0x2d,0x33,0x2e,0x31,0x32,0x68,0x38,0x2e,0x37,0x33,
-    0x33,0x56,0x33,0x2e,0x31,0x32,0x31,0x43,0x31,0x31,
-    0x2e,0x38,0x35,0x35,0x2c,0x30,0x2e,0x38,0x33,0x31,
-    0x2c,0x31,0x33,0x2e,0x37,0x32,0x2c,0x30,0x2c,0x31,
-    0x34,0x2e,0x39,0x37,0x34,0x2c,0x30,0x68,0x37,0x2e,
-    0x31,0x31,0x31,0x63,0x32,0x2e,0x32,0x39,0x2c,0x30,
-    0x2c,0x33,0x2e,0x31,0x32,0x31,0x2c,0x31,0x2e,0x38,
-    0x36,0x37,0x2c,0x33,0x2e,0x31,0x32,0x31,0x2c,0x33,
-    0x2e,0x31,0x32,0x31,0x76,0x38,0x2e,0x37,0x33,0x32,
-    0x0a,0x09,0x09,0x09,0x09,0x68,0x38,0x2e,0x37,0x33,
-    0x31,0x63,0x32,0x2e,0x32,0x39,0x2c,0x30,0x2c,0x33,
-    0x2e,0x31,0x32,0x31,0x2c,0x31,0x2e,0x38,0x36,0x35,
-    0x2c,0x33,0x2e,0x31,0x32,0x31,0x2c,0x33,0x2e,0x31,
-    0x32,0x76,0x37,0x2e,0x31,0x31,0x63,0x30,0x2c,0x32,
-    0x2e,0x32,0x39,0x2d,0x31,0x2e,0x38,0x36,0x36,0x2c,
-    0x33,0x2e,0x31,0x32,0x31,0x2d,0x33,0x2e,0x31,0x32,
-    0x31,0x2c,0x33,0x2e,0x31,0x32,0x31,0x68,0x2d,0x38,
-    0x2e,0x37,0x33,0x31,0x76,0x38,0x2e,0x37,0x33,0x32,
-    0x0a,0x09,0x09,0x09,0x09,0x43,0x32,0x35,0x2e,0x32,
-    0x30,0x37,0x2c,0x33,0x36,0x2e,0x32,0x32,0x39,0x2c,
-    0x32,0x33,0x2e,0x33,0x34,0x31,0x2c,0x33,0x37,0x2e,
-    0x30,0x36,0x2c,0x32,0x32,0x2e,0x30,0x38,0x36,0x2c,
-    0x33,0x37,0x2e,0x30,0x36,0x7a,0x20,0x4d,0x33,0x2e,
-    0x31,0x32,0x31,0x2c,0x31,0x33,0x2e,0x33,0x35,0x34,
-    0x43,0x32,0x2e,0x37,0x34,0x35,0x2c,0x31,0x33,0x2e,
-    0x33,0x35,0x39,0x2c,0x31,0x2e,0x35,0x2c,0x31,0x33,
-    0x2e,0x34,0x39,0x33,0x2c,0x31,0x2e,0x35,0x2c,0x31,
-    0x34,0x2e,0x39,0x37,0x34,0x76,0x37,0x2e,0x31,0x31,
-    0x0a,0x09,0x09,0x09,0x09,0x63,0x30,0x2e,0x30,0x30,
-    0x36,0x2c,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,0x2e,
-    0x31,0x33,0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2c,
-    0x31,0x2e,0x36,0x32,0x31,0x2c,0x31,0x2e,0x36,0x32,
-    0x31,0x68,0x31,0x30,0x2e,0x32,0x33,0x33,0x76,0x31,
-    0x30,0x2e,0x32,0x33,0x32,0x63,0x30,0x2e,0x30,0x30,
-    0x35,0x2c,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,0x2e,
-    0x31,0x34,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2c,0x31,
-    0x2e,0x36,0x31,0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,
-    0x68,0x37,0x2e,0x31,0x30,0x38,0x0a,0x09,0x09,0x09,
-    0x09,0x63,0x30,0x2e,0x33,0x38,0x34,0x2d,0x30,0x2e,
-    0x30,0x30,0x37,0x2c,0x31,0x2e,0x36,0x32,0x34,0x2d,
-    0x30,0x2e,0x31,0x34,0x33,0x2c,0x31,0x2e,0x36,0x32,
-    0x34,0x2d,0x31,0x2e,0x36,0x32,0x31,0x56,0x32,0x33,
-    0x2e,0x37,0x30,0x36,0x68,0x31,0x30,0x2e,0x32,0x33,
-    0x31,0x63,0x30,0x2e,0x33,0x37,0x36,0x2d,0x30,0x2e,
-    0x30,0x30,0x36,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2d,
-    0x30,0x2e,0x31,0x34,0x2c,0x31,0x2e,0x36,0x32,0x31,
-    0x2d,0x31,0x2e,0x36,0x32,0x31,0x76,0x2d,0x37,0x2e,
-    0x31,0x31,0x0a,0x09,0x09,0x09,0x09,0x63,0x2d,0x30,
-    0x2e,0x30,0x30,0x36,0x2d,0x30,0x2e,0x33,0x37,0x36,
-    0x2d,0x30,0x2e,0x31,0x34,0x2d,0x31,0x2e,0x36,0x32,
-    0x2d,0x31,0x2e,0x36,0x32,0x31,0x2d,0x31,0x2e,0x36,
-    0x32,0x68,0x2d,0x31,0x30,0x2e,0x32,0x33,0x56,0x33,
-    0x2e,0x31,0x32,0x31,0x43,0x32,0x33,0x2e,0x37,0x30,
-    0x31,0x2c,0x32,0x2e,0x37,0x34,0x35,0x2c,0x32,0x33,
-    0x2e,0x35,0x36,0x37,0x2c,0x31,0x2e,0x35,0x2c,0x32,
-    0x32,0x2e,0x30,0x38,0x36,0x2c,0x31,0x2e,0x35,0x68,
-    0x2d,0x37,0x2e,0x31,0x31,0x31,0x0a,0x09,0x09,0x09,
-    0x09,0x63,0x2d,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,
-    0x2e,0x30,0x30,0x36,0x2d,0x31,0x2e,0x36,0x31,0x39,
-    0x2c,0x30,0x2e,0x31,0x34,0x2d,0x31,0x2e,0x36,0x31,
-    0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,0x76,0x31,0x30,
-    0x2e,0x32,0x33,0x32,0x4c,0x33,0x2e,0x31,0x32,0x31,
-    0x2c,0x31,0x33,0x2e,0x33,0x35,0x34,0x4c,0x33,0x2e,
-    0x31,0x32,0x31,0x2c,0x31,0x33,0x2e,0x33,0x35,0x34,
-    0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,
-    0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,
-    0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,
-    0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,0x32,0x32,0x2e,
-    0x31,0x38,0x31,0x63,0x2d,0x32,0x2e,0x30,0x31,0x33,
-    0x2c,0x30,0x2d,0x33,0x2e,0x36,0x34,0x39,0x2d,0x31,
-    0x2e,0x36,0x33,0x39,0x2d,0x33,0x2e,0x36,0x34,0x39,
-    0x2d,0x33,0x2e,0x36,0x35,0x31,0x73,0x31,0x2e,0x36,
-    0x33,0x38,0x2d,0x33,0x2e,0x36,0x35,0x2c,0x33,0x2e,
-    0x36,0x34,0x39,0x2d,0x33,0x2e,0x36,0x35,0x63,0x32,
-    0x2e,0x30,0x31,0x33,0x2c,0x30,0x2c,0x33,0x2e,0x36,
-    0x35,0x2c,0x31,0x2e,0x36,0x33,0x39,0x2c,0x33,0x2e,
-    0x36,0x35,0x2c,0x33,0x2e,0x36,0x35,0x0a,0x09,0x09,
-    0x09,0x43,0x32,0x32,0x2e,0x31,0x38,0x32,0x2c,0x32,
-    0x30,0x2e,0x35,0x34,0x33,0x2c,0x32,0x30,0x2e,0x35,
-    0x34,0x34,0x2c,0x32,0x32,0x2e,0x31,0x38,0x31,0x2c,
-    0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,0x32,0x32,0x2e,
-    0x31,0x38,0x31,0x7a,0x20,0x4d,0x31,0x38,0x2e,0x35,
-    0x33,0x31,0x2c,0x31,0x36,0x2e,0x33,0x37,0x39,0x63,
-    0x2d,0x31,0x2e,0x31,0x38,0x36,0x2c,0x30,0x2d,0x32,
-    0x2e,0x31,0x34,0x39,0x2c,0x30,0x2e,0x39,0x36,0x35,
-    0x2d,0x32,0x2e,0x31,0x34,0x39,0x2c,0x32,0x2e,0x31,
-    0x35,0x73,0x30,0x2e,0x39,0x36,0x35,0x2c,0x32,0x2e,
-    0x31,0x35,0x31,0x2c,0x32,0x2e,0x31,0x34,0x39,0x2c,
-    0x32,0x2e,0x31,0x35,0x31,0x0a,0x09,0x09,0x09,0x63,
-    0x31,0x2e,0x31,0x38,0x36,0x2c,0x30,0x2c,0x32,0x2e,
-    0x31,0x35,0x2d,0x30,0x2e,0x39,0x36,0x36,0x2c,0x32,
-    0x2e,0x31,0x35,0x2d,0x32,0x2e,0x31,0x35,0x31,0x43,
-    0x32,0x30,0x2e,0x36,0x38,0x32,0x2c,0x31,0x37,0x2e,
-    0x33,0x34,0x34,0x2c,0x31,0x39,0x2e,0x37,0x31,0x37,
-    0x2c,0x31,0x36,0x2e,0x33,0x37,0x39,0x2c,0x31,0x38,
-    0x2e,0x35,0x33,0x31,0x2c,0x31,0x36,0x2e,0x33,0x37,
-    0x39,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,
-    0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,
-    0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,
-    0x64,0x3d,0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,0x2c,
-    0x33,0x2e,0x31,0x38,0x33,0x6c,0x2d,0x33,0x2e,0x30,
-    0x30,0x35,0x2c,0x34,0x2e,0x36,0x38,0x34,0x68,0x36,
-    0x2e,0x30,0x31,0x32,0x4c,0x31,0x38,0x2e,0x35,0x33,
-    0x2c,0x33,0x2e,0x31,0x38,0x33,0x7a,0x22,0x2f,0x3e,
-    0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,
-    0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x32,0x31,
-    0x2e,0x35,0x33,0x36,0x2c,0x38,0x2e,0x36,0x31,0x36,
-    0x68,0x2d,0x36,0x2e,0x30,0x31,0x32,0x63,0x2d,0x30,
-    0x2e,0x32,0x37,0x33,0x2c,0x30,0x2d,0x30,0x2e,0x35,
-    0x32,0x35,0x2d,0x30,0x2e,0x31,0x35,0x2d,0x30,0x2e,
-    0x36,0x35,0x37,0x2d,0x30,0x2e,0x33,0x39,0x63,0x2d,
-    0x30,0x2e,0x31,0x33,0x32,0x2d,0x30,0x2e,0x32,0x34,
-    0x31,0x2d,0x30,0x2e,0x31,0x32,0x31,0x2d,0x30,0x2e,
-    0x35,0x33,0x34,0x2c,0x30,0x2e,0x30,0x32,0x36,0x2d,
-    0x30,0x2e,0x37,0x36,0x36,0x6c,0x33,0x2e,0x30,0x30,
-    0x35,0x2d,0x34,0x2e,0x36,0x38,0x34,0x0a,0x09,0x09,
-    0x09,0x63,0x30,0x2e,0x32,0x37,0x36,0x2d,0x30,0x2e,
-    0x34,0x33,0x31,0x2c,0x30,0x2e,0x39,0x38,0x36,0x2d,
-    0x30,0x2e,0x34,0x33,0x2c,0x31,0x2e,0x32,0x36,0x34,
-    0x2c,0x30,0x6c,0x33,0x2e,0x30,0x30,0x35,0x2c,0x34,
-    0x2e,0x36,0x38,0x34,0x63,0x30,0x2e,0x31,0x34,0x37,
-    0x2c,0x30,0x2e,0x32,0x33,0x31,0x2c,0x30,0x2e,0x31,
-    0x35,0x39,0x2c,0x30,0x2e,0x35,0x32,0x34,0x2c,0x30,
-    0x2e,0x30,0x32,0x36,0x2c,0x30,0x2e,0x37,0x36,0x36,
-    0x43,0x32,0x32,0x2e,0x30,0x36,0x33,0x2c,0x38,0x2e,
-    0x34,0x36,0x36,0x2c,0x32,0x31,0x2e,0x38,0x31,0x31,
-    0x2c,0x38,0x2e,0x36,0x31,0x36,0x2c,0x32,0x31,0x2e,
-    0x35,0x33,0x36,0x2c,0x38,0x2e,0x36,0x31,0x36,0x7a,
-    0x0a,0x09,0x09,0x09,0x20,0x4d,0x31,0x36,0x2e,0x38,
-    0x39,0x37,0x2c,0x37,0x2e,0x31,0x31,0x36,0x68,0x33,
-    0x2e,0x32,0x36,0x38,0x4c,0x31,0x38,0x2e,0x35,0x33,
-    0x2c,0x34,0x2e,0x35,0x37,0x31,0x4c,0x31,0x36,0x2e,
-    0x38,0x39,0x37,0x2c,0x37,0x2e,0x31,0x31,0x36,0x7a,
-    0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,
-    0x22,0x4d,0x37,0x2e,0x38,0x30,0x39,0x2c,0x32,0x32,
-    0x2e,0x32,0x38,0x34,0x63,0x2d,0x30,0x2e,0x31,0x34,
-    0x31,0x2c,0x30,0x2d,0x30,0x2e,0x32,0x38,0x32,0x2d,
-    0x30,0x2e,0x30,0x34,0x2d,0x30,0x2e,0x34,0x30,0x35,
-    0x2d,0x30,0x2e,0x31,0x31,0x39,0x4c,0x32,0x2e,0x37,
-    0x32,0x2c,0x31,0x39,0x2e,0x31,0x36,0x32,0x63,0x2d,
-    0x30,0x2e,0x32,0x31,0x35,0x2d,0x30,0x2e,0x31,0x33,
-    0x38,0x2d,0x30,0x2e,0x33,0x34,0x35,0x2d,0x30,0x2e,
-    0x33,0x37,0x36,0x2d,0x30,0x2e,0x33,0x34,0x35,0x2d,
-    0x30,0x2e,0x36,0x33,0x31,0x0a,0x09,0x09,0x09,0x73,
-    0x30,0x2e,0x31,0x33,0x2d,0x30,0x2e,0x34,0x39,0x33,
-    0x2c,0x30,0x2e,0x33,0x34,0x35,0x2d,0x30,0x2e,0x36,
-    0x33,0x31,0x6c,0x34,0x2e,0x36,0x38,0x34,0x2d,0x33,
-    0x2e,0x30,0x30,0x36,0x63,0x30,0x2e,0x32,0x33,0x2d,
-    0x30,0x2e,0x31,0x34,0x38,0x2c,0x30,0x2e,0x35,0x32,
-    0x34,0x2d,0x30,0x2e,0x31,0x35,0x38,0x2c,0x30,0x2e,
-    0x37,0x36,0x36,0x2d,0x30,0x2e,0x30,0x32,0x37,0x63,
-    0x30,0x2e,0x32,0x34,0x2c,0x30,0x2e,0x31,0x33,0x31,
-    0x2c,0x30,0x2e,0x33,0x39,0x2c,0x30,0x2e,0x33,0x38,
-    0x34,0x2c,0x30,0x2e,0x33,0x39,0x2c,0x30,0x2e,0x36,
-    0x35,0x38,0x76,0x36,0x2e,0x30,0x31,0x0a,0x09,0x09,
-    0x09,0x63,0x30,0x2c,0x30,0x2e,0x32,0x37,0x34,0x2d,
-    0x30,0x2e,0x31,0x34,0x38,0x2c,0x30,0x2e,0x35,0x32,
-    0x36,0x2d,0x30,0x2e,0x33,0x39,0x2c,0x30,0x2e,0x36,
-    0x35,0x38,0x43,0x38,0x2e,0x30,0x35,0x36,0x2c,0x32,
-    0x32,0x2e,0x32,0x35,0x34,0x2c,0x37,0x2e,0x39,0x33,
-    0x32,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,0x2c,0x37,
-    0x2e,0x38,0x30,0x39,0x2c,0x32,0x32,0x2e,0x32,0x38,
-    0x34,0x7a,0x20,0x4d,0x34,0x2e,0x35,0x31,0x34,0x2c,
-    0x31,0x38,0x2e,0x35,0x33,0x6c,0x32,0x2e,0x35,0x34,
-    0x35,0x2c,0x31,0x2e,0x36,0x33,0x32,0x76,0x2d,0x33,
-    0x2e,0x32,0x36,0x35,0x4c,0x34,0x2e,0x35,0x31,0x34,
-    0x2c,0x31,0x38,0x2e,0x35,0x33,0x7a,0x22,0x2f,0x3e,
-    0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,0x67,
-    0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,
-    0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x32,
-    0x39,0x2e,0x31,0x39,0x35,0x2c,0x32,0x32,0x2e,0x32,
-    0x38,0x34,0x63,0x2d,0x30,0x2e,0x31,0x32,0x34,0x2c,
-    0x30,0x2d,0x30,0x2e,0x32,0x34,0x36,0x2d,0x30,0x2e,
-    0x30,0x33,0x2d,0x30,0x2e,0x33,0x35,0x38,0x2d,0x30,
-    0x2e,0x30,0x39,0x32,0x63,0x2d,0x30,0x2e,0x32,0x34,
-    0x31,0x2d,0x30,0x2e,0x31,0x33,0x32,0x2d,0x30,0x2e,
-    0x33,0x39,0x32,0x2d,0x30,0x2e,0x33,0x38,0x34,0x2d,
-    0x30,0x2e,0x33,0x39,0x32,0x2d,0x30,0x2e,0x36,0x35,
-    0x38,0x76,0x2d,0x36,0x2e,0x30,0x31,0x0a,0x09,0x09,
-    0x09,0x63,0x30,0x2d,0x30,0x2e,0x32,0x37,0x34,0x2c,
-    0x30,0x2e,0x31,0x34,0x39,0x2d,0x30,0x2e,0x35,0x32,
-    0x36,0x2c,0x30,0x2e,0x33,0x39,0x32,0x2d,0x30,0x2e,
-    0x36,0x35,0x38,0x63,0x30,0x2e,0x32,0x33,0x39,0x2d,
-    0x30,0x2e,0x31,0x33,0x31,0x2c,0x30,0x2e,0x35,0x33,
-    0x33,0x2d,0x30,0x2e,0x31,0x32,0x33,0x2c,0x30,0x2e,
-    0x37,0x36,0x35,0x2c,0x30,0x2e,0x30,0x32,0x37,0x6c,
-    0x34,0x2e,0x36,0x38,0x35,0x2c,0x33,0x2e,0x30,0x30,
-    0x35,0x63,0x30,0x2e,0x32,0x31,0x35,0x2c,0x30,0x2e,
-    0x31,0x33,0x38,0x2c,0x30,0x2e,0x33,0x34,0x35,0x2c,
-    0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,0x2e,0x33,0x34,
-    0x35,0x2c,0x30,0x2e,0x36,0x33,0x31,0x0a,0x09,0x09,
-    0x09,0x73,0x2d,0x30,0x2e,0x31,0x33,0x2c,0x30,0x2e,
-    0x34,0x39,0x33,0x2d,0x30,0x2e,0x33,0x34,0x35,0x2c,
-    0x30,0x2e,0x36,0x33,0x31,0x6c,0x2d,0x34,0x2e,0x36,
-    0x38,0x35,0x2c,0x33,0x2e,0x30,0x30,0x34,0x43,0x32,
-    0x39,0x2e,0x34,0x37,0x38,0x2c,0x32,0x32,0x2e,0x32,
-    0x34,0x34,0x2c,0x32,0x39,0x2e,0x33,0x33,0x36,0x2c,
-    0x32,0x32,0x2e,0x32,0x38,0x34,0x2c,0x32,0x39,0x2e,
-    0x31,0x39,0x35,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,
-    0x7a,0x20,0x4d,0x32,0x39,0x2e,0x39,0x34,0x35,0x2c,
-    0x31,0x36,0x2e,0x38,0x39,0x36,0x76,0x33,0x2e,0x32,
-    0x36,0x36,0x6c,0x32,0x2e,0x35,0x34,0x36,0x2d,0x31,
-    0x2e,0x36,0x33,0x33,0x0a,0x09,0x09,0x09,0x4c,0x32,
-    0x39,0x2e,0x39,0x34,0x35,0x2c,0x31,0x36,0x2e,0x38,
-    0x39,0x36,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,
-    0x67,0x3e,0x0a,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,
-    0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,
-    0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,
-    0x20,0x64,0x3d,0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,
-    0x2c,0x33,0x34,0x2e,0x36,0x32,0x36,0x4c,0x31,0x38,
-    0x2e,0x35,0x33,0x2c,0x33,0x34,0x2e,0x36,0x32,0x36,
-    0x63,0x2d,0x30,0x2e,0x32,0x35,0x35,0x2c,0x30,0x2d,
-    0x30,0x2e,0x34,0x39,0x32,0x2d,0x30,0x2e,0x31,0x33,
-    0x2d,0x30,0x2e,0x36,0x33,0x31,0x2d,0x30,0x2e,0x33,
-    0x34,0x35,0x6c,0x2d,0x33,0x2e,0x30,0x30,0x35,0x2d,
-    0x34,0x2e,0x36,0x38,0x34,0x0a,0x09,0x09,0x09,0x63,
-    0x2d,0x30,0x2e,0x31,0x34,0x37,0x2d,0x30,0x2e,0x32,
-    0x33,0x31,0x2d,0x30,0x2e,0x31,0x35,0x38,0x2d,0x30,
-    0x2e,0x35,0x32,0x34,0x2d,0x30,0x2e,0x30,0x32,0x36,
-    0x2d,0x30,0x2e,0x37,0x36,0x36,0x73,0x30,0x2e,0x33,
-    0x38,0x34,0x2d,0x30,0x2e,0x33,0x39,0x31,0x2c,0x30,
-    0x2e,0x36,0x35,0x37,0x2d,0x30,0x2e,0x33,0x39,0x31,
-    0x68,0x36,0x2e,0x30,0x31,0x32,0x63,0x30,0x2e,0x32,
-    0x37,0x33,0x2c,0x30,0x2c,0x30,0x2e,0x35,0x32,0x35,
-    0x2c,0x30,0x2e,0x31,0x34,0x38,0x2c,0x30,0x2e,0x36,
-    0x35,0x37,0x2c,0x30,0x2e,0x33,0x39,0x31,0x0a,0x09,
-    0x09,0x09,0x63,0x30,0x2e,0x31,0x33,0x33,0x2c,0x30,
-    0x2e,0x32,0x34,0x2c,0x30,0x2e,0x31,0x32,0x31,0x2c,
-    0x30,0x2e,0x35,0x33,0x33,0x2d,0x30,0x2e,0x30,0x32,
-    0x36,0x2c,0x30,0x2e,0x37,0x36,0x36,0x6c,0x2d,0x33,
-    0x2e,0x30,0x30,0x35,0x2c,0x34,0x2e,0x36,0x38,0x34,
-    0x43,0x31,0x39,0x2e,0x30,0x32,0x33,0x2c,0x33,0x34,
-    0x2e,0x34,0x39,0x36,0x2c,0x31,0x38,0x2e,0x37,0x38,
-    0x36,0x2c,0x33,0x34,0x2e,0x36,0x32,0x36,0x2c,0x31,
-    0x38,0x2e,0x35,0x33,0x2c,0x33,0x34,0x2e,0x36,0x32,
-    0x36,0x7a,0x20,0x4d,0x31,0x36,0x2e,0x38,0x39,0x37,
-    0x2c,0x32,0x39,0x2e,0x39,0x34,0x32,0x6c,0x31,0x2e,
-    0x36,0x33,0x33,0x2c,0x32,0x2e,0x35,0x34,0x35,0x0a,
-    0x09,0x09,0x09,0x6c,0x31,0x2e,0x36,0x33,0x35,0x2d,
-    0x32,0x2e,0x35,0x34,0x35,0x48,0x31,0x36,0x2e,0x38,
-    0x39,0x37,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,
-    0x67,0x3e,0x0a,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,
-    0x73,0x76,0x67,0x3e,0x0a
+const size_t help_dpad_up_svg_size = 1353;
+const unsigned char help_dpad_up_svg_data[1353] = {
+    0x45,0x53,0x5a,0x31,0x5d,0x0c,0x00,0x00,0x78,0xda,
+    0x95,0x56,0xdb,0x6e,0x1b,0x37,0x10,0x7d,0xb6,0xbf,
+    0x82,0xdd,0x3e,0x15,0xe0,0x72,0x79,0x59,0x72,0x77,
+    0x8d,0x28,0x41,0xa3,0x5c,0x01,0xa5,0x35,0xd0,0xd4,
+    0x45,0x9f,0x02,0x67,0xa5,0x68,0x85,0x6c,0x25,0x41,
+    0x92,0x25,0xd7,0x5f,0xdf,0x99,0x43,0x4a,0x5a,0x03,
+    0x0e,0x50,0xfb,0x81,0x3b,0x24,0x87,0x67,0x66,0xce,
+    0x5c,0xe4,0x17,0xaf,0xee,0xff,0xe9,0xc5,0x7e,0xb6,
+    0xd9,0x2e,0x56,0xcb,0x51,0x66,0x94,0xce,0xc4,0x6c,
+    0xd9,0xae,0xa6,0x8b,0xe5,0x7c,0x94,0xdd,0xed,0xbe,
+    0xe5,0x75,0xf6,0xea,0xe5,0xe5,0x8b,0x9f,0xf2,0x5c,
+    0xbc,0x9f,0x2d,0x67,0x9b,0xdb,0xdd,0x6a,0x73,0x25,
+    0x7e,0x9d,0xae,0xbe,0xce,0xc4,0xc7,0xbe,0xbf,0xdb,
+    0xee,0x70,0x24,0x4c,0x50,0x5a,0x39,0x29,0xfe,0xb8,
+    0x79,0x2f,0xde,0xde,0xaf,0x57,0x9b,0x9d,0xb8,0xee,
+    0xef,0xe6,0xf9,0xc7,0xa5,0x50,0x38,0xbc,0x89,0x36,
+    0xae,0x04,0x29,0x6a,0xf1,0xfa,0x6e,0xd1,0x4f,0x85,
+    0xfe,0x45,0x88,0x3c,0x67,0xf8,0x37,0xbf,0x8f,0x3f,
+    0xff,0x7d,0xfd,0x56,0x6c,0xf7,0x73,0x71,0xfd,0xe7,
+    0xeb,0xc9,0xc7,0xb1,0xc8,0xf2,0xa2,0xf8,0xcb,0x8d,
+    0x8b,0xe2,0xcd,0xe7,0x37,0x40,0x30,0xca,0x14,0xc5,
+    0xdb,0xdf,0x32,0x91,0x75,0xbb,0xdd,0xfa,0xaa,0x28,
+    0x0e,0x87,0x83,0x3a,0x38,0xb5,0xda,0xcc,0x8b,0xf7,
+    0x9b,0xdb,0x75,0xb7,0x68,0xb7,0x05,0x29,0x16,0xac,
+    0x48,0x8f,0x0a,0x02,0x33,0x46,0x4d,0x77,0xd3,0x8c,
+    0x4c,0x30,0xf2,0x20,0x4e,0x93,0x89,0xc5,0x74,0x94,
+    0x7d,0xb9,0x77,0xfa,0x4b,0x26,0x88,0x84,0xe5,0x76,
+    0xf4,0x04,0xae,0xd5,0x5a,0x33,0x4e,0x52,0xb9,0xba,
+    0xef,0x17,0xcb,0xef,0x4f,0x29,0x9a,0xa6,0x69,0x0a,
+    0xdc,0x92,0xea,0x28,0xd3,0xeb,0xfb,0x4c,0xfc,0x1b,
+    0xbf,0x97,0x17,0xe2,0xb0,0x98,0xee,0xba,0x51,0xe6,
+    0x2a,0xa5,0x83,0xe1,0xab,0x6e,0xb6,0x98,0x77,0xbb,
+    0xe1,0xc9,0x7e,0x31,0x3b,0xbc,0x5e,0xf1,0x53,0xa1,
+    0x45,0x3c,0x4e,0x1f,0xce,0xc8,0xed,0xd7,0x7e,0x96,
+    0x7f,0xbd,0x6d,0xbf,0xcf,0x37,0xab,0xbb,0x25,0x39,
+    0xbe,0x9c,0x1d,0xc4,0x13,0x9a,0xe4,0xe5,0xd5,0x76,
+    0x7d,0xdb,0xce,0x46,0xd9,0x7a,0x33,0xdb,0xce,0x36,
+    0xfb,0x19,0x07,0x3f,0x7f,0x79,0x79,0x81,0x25,0xad,
+    0x17,0x2f,0xd6,0xb7,0xbb,0x4e,0x7c,0x5b,0xf4,0xfd,
+    0x28,0xfb,0xf9,0x1d,0xfe,0x32,0x41,0xb0,0x9f,0xac,
+    0x55,0xba,0x0e,0x12,0x78,0x5d,0x5e,0x29,0x63,0x4c,
+    0x9b,0x5b,0x65,0xeb,0x46,0xea,0xdc,0xd1,0xb6,0xc9,
+    0x8d,0xaa,0x43,0x48,0x32,0xad,0xd6,0xec,0xf3,0x5a,
+    0x55,0xce,0x7e,0xc0,0x66,0xac,0x55,0xed,0x8c,0xb4,
+    0x5e,0x59,0x1d,0xa4,0x96,0xd6,0x29,0x57,0xf2,0x97,
+    0x81,0x3d,0xdb,0xbe,0xd8,0x03,0xb7,0xd5,0x09,0x97,
+    0xf1,0x2a,0x20,0x49,0x20,0x40,0xec,0x18,0xd2,0xdd,
+    0x44,0x48,0xca,0x62,0xed,0xbd,0x8c,0xc8,0xc6,0xa9,
+    0xca,0x12,0xa0,0x29,0x55,0x53,0x11,0x72,0x17,0x9d,
+    0x24,0x2c,0x72,0x31,0x22,0x44,0xc8,0x24,0x47,0x17,
+    0xe1,0x21,0xac,0x03,0xf9,0x09,0x7d,0x3f,0xd0,0xdf,
+    0x47,0x07,0x25,0x2b,0xc5,0x78,0x07,0xae,0x25,0xc8,
+    0x0e,0x51,0x0f,0x91,0xc7,0x08,0x9a,0xec,0x06,0x65,
+    0x09,0x1c,0x91,0x9b,0x48,0xa5,0x1c,0xf2,0xfa,0x20,
+    0x3e,0x25,0xb3,0xa4,0xe1,0xcb,0xb1,0x55,0x55,0xe9,
+    0xe3,0x86,0xd9,0x80,0x58,0x36,0x2e,0x8a,0x88,0x12,
+    0xfe,0xc0,0x46,0xab,0xa9,0x7d,0x88,0x57,0xe5,0x2a,
+    0x5e,0x8d,0xe3,0x17,0x01,0x21,0x9c,0xd6,0xce,0x68,
+    0x65,0x9d,0xdb,0xe3,0x63,0xf1,0xc2,0x9f,0x5f,0x94,
+    0x67,0x55,0x93,0x1e,0x33,0x85,0xba,0x3e,0xe2,0xbb,
+    0xba,0xcc,0xf9,0x4d,0x85,0x4b,0x96,0x4d,0xe9,0x92,
+    0x0c,0xf5,0x1b,0x8a,0xac,0xa2,0xf2,0x00,0xbe,0x69,
+    0x81,0x9c,0x47,0xbf,0x70,0x9f,0x9f,0xad,0xc4,0x07,
+    0x31,0xe1,0x11,0x3f,0x2a,0xe6,0xc7,0x47,0x26,0x62,
+    0xe6,0x67,0xed,0x2e,0x07,0x6e,0x4a,0x3d,0x4c,0x51,
+    0x39,0x81,0x22,0xda,0xf8,0x50,0x81,0x97,0xc4,0x27,
+    0x89,0xa9,0x4a,0x4f,0xe8,0x31,0x4c,0xb6,0x11,0x23,
+    0x3c,0xda,0x38,0x06,0x9b,0x68,0x99,0x0c,0x53,0xf0,
+    0x68,0xf3,0x90,0x15,0xe8,0x94,0x02,0x5d,0x53,0x0c,
+    0x7a,0xe7,0x47,0x4d,0x63,0x6a,0xe5,0xb9,0xe6,0xad,
+    0x32,0x35,0xda,0x45,0x1b,0x87,0x76,0x09,0x25,0x97,
+    0x4f,0x70,0x4d,0x92,0x69,0xf5,0x66,0xcb,0x27,0x35,
+    0x64,0x79,0x3e,0x6e,0xd3,0x2b,0x89,0x73,0x3c,0x92,
+    0x47,0x15,0xb4,0xcd,0x18,0xf0,0x56,0x5a,0xad,0x3c,
+    0xe5,0x03,0x9f,0x32,0xd9,0x94,0x8f,0x3c,0xa0,0xfa,
+    0x4a,0x7b,0x9a,0xca,0xae,0x6a,0x5a,0xf2,0xc1,0x10,
+    0x59,0xdc,0x70,0xa6,0x64,0x46,0x9a,0xe0,0x93,0x4c,
+    0xab,0xdf,0xe2,0x00,0x22,0x33,0x7d,0x3c,0x06,0xa5,
+    0x6d,0x7a,0x8a,0x93,0x9c,0x15,0x43,0x14,0xa1,0x31,
+    0x26,0x2f,0x02,0xf9,0x64,0x2a,0x2a,0x75,0x4a,0x79,
+    0xa3,0x2a,0x53,0x25,0xab,0xf2,0x91,0x0f,0x91,0xd4,
+    0xff,0xcf,0x26,0xf7,0x58,0xed,0x7a,0xa2,0x86,0x8b,
+    0xb7,0x24,0x2b,0x65,0x47,0xbf,0x1c,0xc6,0x4e,0x06,
+    0xd7,0xc7,0x4c,0xfd,0x70,0x98,0x51,0x79,0xb8,0x20,
+    0x6b,0x4a,0x3e,0x0d,0x33,0x3c,0xe7,0x0a,0xb1,0x15,
+    0x67,0x87,0xf8,0xb3,0x1c,0x11,0xc2,0x0a,0xbe,0xe2,
+    0xd2,0x69,0xf8,0xda,0x38,0xcb,0x4a,0x25,0xea,0x18,
+    0xd5,0xec,0x79,0x82,0x29,0x6d,0xb9,0x60,0xab,0x10,
+    0x7a,0x38,0x95,0xc3,0xa9,0xcb,0xd8,0x33,0x16,0xc5,
+    0x5c,0x52,0xb8,0x44,0x51,0x1d,0x65,0x4a,0xa2,0x0d,
+    0xf4,0xb0,0x1f,0xc4,0xd0,0x72,0x35,0x56,0x12,0x8d,
+    0xc3,0x95,0xe9,0x39,0x1b,0xde,0x26,0x78,0x09,0x78,
+    0x4e,0xb4,0x0e,0x8e,0xdc,0x2e,0x99,0x6c,0x1a,0x3f,
+    0xc6,0xc4,0x18,0xe4,0x30,0xa0,0x07,0x36,0x4d,0x99,
+    0x0e,0xaa,0x6e,0x2a,0xc9,0x3d,0x10,0x3a,0x47,0x16,
+    0xeb,0xc4,0x50,0xa9,0x7c,0x65,0x26,0xc3,0xeb,0x67,
+    0xe4,0xa0,0x52,0xb5,0x6e,0xb8,0x9c,0x2c,0xf9,0x8c,
+    0x36,0x35,0xa0,0xcc,0xd6,0xcc,0x8d,0xe6,0xa1,0x50,
+    0x6a,0xb0,0x67,0x9a,0x89,0xe5,0x81,0x4c,0xb9,0x37,
+    0x21,0xd2,0x0b,0x46,0x0d,0x95,0x38,0x31,0x5a,0xfa,
+    0x53,0xab,0x47,0x39,0x38,0xd4,0xd5,0x96,0x35,0x18,
+    0x85,0xe6,0xdc,0xe0,0xaa,0x07,0x4b,0xc8,0x7a,0x60,
+    0x5a,0x1d,0x6c,0xd7,0x91,0x24,0x24,0xab,0x8e,0x24,
+    0xb1,0x17,0xb6,0x62,0x95,0x12,0x63,0x90,0xd9,0x74,
+    0x4c,0x26,0x4d,0xaf,0xa3,0x18,0x7c,0xbd,0xe7,0xa4,
+    0xc7,0x1c,0x31,0xe9,0x55,0x39,0xc0,0x83,0x4f,0x49,
+    0x6f,0x5c,0x2b,0xed,0x31,0xa5,0xad,0x2f,0x89,0xad,
+    0xc6,0xd9,0x14,0xbd,0x1c,0x52,0x41,0x9d,0x45,0xb4,
+    0xf2,0x70,0x63,0x8a,0x7b,0x4b,0x2d,0x18,0x7b,0xd5,
+    0xee,0x73,0xe6,0xde,0x4f,0x06,0xd7,0xcf,0xa0,0xdb,
+    0x12,0x79,0x8d,0x1f,0xf2,0xcd,0x61,0xa1,0x0a,0x11,
+    0x29,0xd3,0xe0,0x3c,0x13,0xaa,0x9b,0xc8,0x71,0xac,
+    0x4e,0x54,0xaa,0x6b,0xb0,0x62,0x6a,0x47,0x99,0x03,
+    0xcf,0xcf,0x91,0xa3,0xe4,0x41,0x13,0xcd,0x1a,0x44,
+    0x2e,0x07,0x9a,0xa0,0xb9,0xc9,0x8f,0x24,0x7a,0x07,
+    0xce,0xad,0x03,0xcf,0x1e,0x85,0x59,0x21,0x2d,0x3c,
+    0x8a,0xa8,0x90,0x5b,0x64,0x18,0xa4,0xd7,0x31,0x75,
+    0xa7,0xdf,0x96,0x28,0x1f,0x33,0x0c,0x48,0x89,0x14,
+    0xe7,0x83,0xbb,0x3e,0x3f,0x83,0xd1,0x6f,0x5f,0xa3,
+    0xca,0xaa,0x46,0xe4,0x3c,0xcd,0x1a,0xe5,0x5c,0x38,
+    0x32,0xff,0x88,0x15,0xa2,0x9e,0xf6,0x0d,0xf3,0xcd,
+    0x25,0x1d,0xf6,0xcc,0x77,0x40,0x0a,0x30,0xe9,0x9d,
+    0x63,0xa3,0x93,0x47,0x3a,0xcf,0x1f,0x3a,0xe4,0x9a,
+    0x0d,0x93,0xe1,0x06,0x6c,0xf3,0x3f,0x1f,0x28,0x56,
+    0x9b,0xa7,0xba,0xa5,0x40,0x62,0x50,0x69,0x44,0x0d,
+    0xa6,0x01,0x4a,0x8c,0xc7,0x89,0x85,0x8e,0x41,0xde,
+    0x62,0xf9,0x9e,0x46,0xc8,0xf6,0x9c,0x30,0x23,0xcf,
+    0xe3,0xc7,0xc4,0x19,0xd7,0xa6,0x19,0x85,0x32,0x05,
+    0xd5,0x28,0x59,0xd2,0x42,0xe2,0x52,0x5a,0xc9,0x11,
+    0xa6,0x37,0x36,0x80,0x3d,0xe7,0xee,0x34,0x48,0x1e,
+    0x4d,0xcf,0x31,0x35,0xa8,0xb6,0x88,0xaa,0x6c,0x02,
+    0x57,0x68,0xc5,0xff,0x8f,0x20,0x46,0x39,0x0c,0xf8,
+    0xe1,0x34,0x53,0xc0,0xa5,0xed,0x41,0xae,0x44,0xad,
+    0xb3,0x61,0xec,0x79,0xfe,0xd3,0xfe,0x43,0xd4,0x1c,
+    0xf0,0x9c,0x16,0xfa,0x97,0xf9,0xe5,0xe5,0x7f,0x1f,
+    0x0a,0xad,0x09
 };
 
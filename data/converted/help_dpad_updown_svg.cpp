@@ -1,333 +1,146 @@
-//this file was auto-generated from "dpad_updown.svg" by res2h
+//this file was auto-generated from "dpad_updown.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t help_dpad_updown_svg_size = 3241;
-const unsigned char help_dpad_updown_svg_data[3241] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x5f,0x78,0x33,0x30,
-    0x5f,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,0x3d,0x22,
-    0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,
-    0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x32,0x30,
-    0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,0x78,0x6d,
-    0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,0x6b,0x3d,
-    0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,
-    0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,0x31,
-    0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,0x6b,0x22,
-    0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,0x20,0x79,
-    0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,0x20,0x77,
-    0x69,0x64,0x74,0x68,0x3d,0x22,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3d,0x22,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,0x42,0x6f,
-    0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x33,0x37,0x2e,
-    0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,0x36,0x31,
-    0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x2d,0x62,
-    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3d,
-    0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,0x20,0x33,
-    0x37,0x2e,0x30,0x36,0x31,0x20,0x33,0x37,0x2e,0x30,
-    0x36,0x31,0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,
-    0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,
-    0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,0x3e,0x0a,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x67,0x3e,
-    0x0a,0x09,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,
-    0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x32,
-    0x32,0x2e,0x30,0x38,0x36,0x2c,0x33,0x37,0x2e,0x30,
-    0x36,0x68,0x2d,0x37,0x2e,0x31,0x31,0x31,0x63,0x2d,
-    0x32,0x2e,0x32,0x38,0x39,0x2c,0x30,0x2d,0x33,0x2e,
-    0x31,0x31,0x39,0x2d,0x31,0x2e,0x38,0x36,0x36,0x2d,
-    0x33,0x2e,0x31,0x31,0x39,0x2d,0x33,0x2e,0x31,0x32,
-    0x31,0x76,0x2d,0x38,0x2e,0x37,0x33,0x32,0x48,0x33,
-    0x2e,0x31,0x32,0x31,0x43,0x30,0x2e,0x38,0x33,0x31,
-    0x2c,0x32,0x35,0x2e,0x32,0x30,0x36,0x2c,0x30,0x2c,
-    0x32,0x33,0x2e,0x33,0x34,0x2c,0x30,0x2c,0x32,0x32,
-    0x2e,0x30,0x38,0x35,0x0a,0x09,0x09,0x09,0x09,0x76,
-    0x2d,0x37,0x2e,0x31,0x31,0x63,0x30,0x2d,0x32,0x2e,
-    0x32,0x38,0x39,0x2c,0x31,0x2e,0x38,0x36,0x37,0x2d,
-    0x33,0x2e,0x31,0x32,0x2c,0x33,0x2e,0x31,0x32,0x31,
-    0x2d,0x33,0x2e,0x31,0x32,0x68,0x38,0x2e,0x37,0x33,
-    0x33,0x56,0x33,0x2e,0x31,0x32,0x31,0x43,0x31,0x31,
-    0x2e,0x38,0x35,0x35,0x2c,0x30,0x2e,0x38,0x33,0x31,
-    0x2c,0x31,0x33,0x2e,0x37,0x32,0x2c,0x30,0x2c,0x31,
-    0x34,0x2e,0x39,0x37,0x34,0x2c,0x30,0x68,0x37,0x2e,
-    0x31,0x31,0x31,0x63,0x32,0x2e,0x32,0x39,0x2c,0x30,
-    0x2c,0x33,0x2e,0x31,0x32,0x31,0x2c,0x31,0x2e,0x38,
-    0x36,0x37,0x2c,0x33,0x2e,0x31,0x32,0x31,0x2c,0x33,
-    0x2e,0x31,0x32,0x31,0x76,0x38,0x2e,0x37,0x33,0x32,
-    0x0a,0x09,0x09,0x09,0x09,0x68,0x38,0x2e,0x37,0x33,
-    0x31,0x63,0x32,0x2e,0x32,0x39,0x2c,0x30,0x2c,0x33,
-    0x2e,0x31,0x32,0x31,0x2c,0x31,0x2e,0x38,0x36,0x35,
-    0x2c,0x33,0x2e,0x31,0x32,0x31,0x2c,0x33,0x2e,0x31,
-    0x32,0x76,0x37,0x2e,0x31,0x31,0x63,0x30,0x2c,0x32,
-    0x2e,0x32,0x39,0x2d,0x31,0x2e,0x38,0x36,0x36,0x2c,
-    0x33,0x2e,0x31,0x32,0x31,0x2d,0x33,0x2e,0x31,0x32,
-    0x31,0x2c,0x33,0x2e,0x31,0x32,0x31,0x68,0x2d,0x38,
-    0x2e,0x37,0x33,0x31,0x76,0x38,0x2e,0x37,0x33,0x32,
-    0x0a,0x09,0x09,0x09,0x09,0x43,0x32,0x35,0x2e,0x32,
-    0x30,0x37,0x2c,0x33,0x36,0x2e,0x32,0x32,0x39,0x2c,
-    0x32,0x33,0x2e,0x33,0x34,0x31,0x2c,0x33,0x37,0x2e,
-    0x30,0x36,0x2c,0x32,0x32,0x2e,0x30,0x38,0x36,0x2c,
-    0x33,0x37,0x2e,0x30,0x36,0x7a,0x20,0x4d,0x33,0x2e,
-    0x31,0x32,0x31,0x2c,0x31,0x33,0x2e,0x33,0x35,0x34,
-    0x43,0x32,0x2e,0x37,0x34,0x35,0x2c,0x31,0x33,0x2e,
-    0x33,0x35,0x39,0x2c,0x31,0x2e,0x35,0x2c,0x31,0x33,
-    0x2e,0x34,0x39,0x33,0x2c,0x31,0x2e,0x35,0x2c,0x31,
-    0x34,0x2e,0x39,0x37,0x34,0x76,0x37,0x2e,0x31,0x31,
-    0x0a,0x09,0x09,0x09,0x09,0x63,0x30,0x2e,0x30,0x30,
-    0x36,0x2c,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,0x2e,
-    0x31,0x33,0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2c,
-    0x31,0x2e,0x36,0x32,0x31,0x2c,0x31,0x2e,0x36,0x32,
-    0x31,0x68,0x31,0x30,0x2e,0x32,0x33,0x33,0x76,0x31,
-    0x30,0x2e,0x32,0x33,0x32,0x63,0x30,0x2e,0x30,0x30,
-    0x35,0x2c,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,0x2e,
-    0x31,0x34,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2c,0x31,
-    0x2e,0x36,0x31,0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,
-    0x68,0x37,0x2e,0x31,0x30,0x38,0x0a,0x09,0x09,0x09,
-    0x09,0x63,0x30,0x2e,0x33,0x38,0x34,0x2d,0x30,0x2e,
-    0x30,0x30,0x37,0x2c,0x31,0x2e,0x36,0x32,0x34,0x2d,
-    0x30,0x2e,0x31,0x34,0x33,0x2c,0x31,0x2e,0x36,0x32,
-    0x34,0x2d,0x31,0x2e,0x36,0x32,0x31,0x56,0x32,0x33,
-    0x2e,0x37,0x30,0x36,0x68,0x31,0x30,0x2e,0x32,0x33,
-    0x31,0x63,0x30,0x2e,0x33,0x37,0x36,0x2d,0x30,0x2e,
-    0x30,0x30,0x36,0x2c,0x31,0x2e,0x36,0x32,0x31,0x2d,
-    0x30,0x2e,0x31,0x34,0x2c,0x31,0x2e,0x36,0x32,0x31,
-    0x2d,0x31,0x2e,0x36,0x32,0x31,0x76,0x2d,0x37,0x2e,
-    0x31,0x31,0x0a,0x09,0x09,0x09,0x09,0x63,0x2d,0x30,
-    0x2e,0x30,0x30,0x36,0x2d,0x30,0x2e,0x33,0x37,0x36,
-    0x2d,0x30,0x2e,0x31,0x34,0x2d,0x31,0x2e,0x36,0x32,
-    0x2d,0x31,0x2e,0x36,0x32,0x31,0x2d,0x31,0x2e,0x36,
-    0x32,0x68,0x2d,0x31,0x30,0x2e,0x32,0x33,0x56,0x33,
-    0x2e,0x31,0x32,0x31,0x43,0x32,0x33,0x2e,0x37,0x30,
-    0x31,0x2c,0x32,0x2e,0x37,0x34,0x35,0x2c,0x32,0x33,
-    0x2e,0x35,0x36,0x37,0x2c,0x31,0x2e,0x35,0x2c,0x32,
-    0x32,0x2e,0x30,0x38,0x36,0x2c,0x31,0x2e,0x35,0x68,
-    0x2d,0x37,0x2e,0x31,0x31,0x31,0x0a,0x09,0x09,0x09,
-    0x09,0x63,0x2d,0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,
-    0x2e,0x30,0x30,0x36,0x2d,0x31,0x2e,0x36,0x31,0x39,
-    0x2c,0x30,0x2e,0x31,0x34,0x2d,0x31,0x2e,0x36,0x31,
-    0x39,0x2c,0x31,0x2e,0x36,0x32,0x31,0x76,0x31,0x30,
-    0x2e,0x32,0x33,0x32,0x4c,0x33,0x2e,0x31,0x32,0x31,
-    0x2c,0x31,0x33,0x2e,0x33,0x35,0x34,0x4c,0x33,0x2e,
-    0x31,0x32,0x31,0x2c,0x31,0x33,0x2e,0x33,0x35,0x34,
-    0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,
-    0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,
-    0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,
-    0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,0x32,0x32,0x2e,
-    0x31,0x38,0x31,0x63,0x2d,0x32,0x2e,0x30,0x31,0x33,
-    0x2c,0x30,0x2d,0x33,0x2e,0x36,0x34,0x39,0x2d,0x31,
-    0x2e,0x36,0x33,0x39,0x2d,0x33,0x2e,0x36,0x34,0x39,
-    0x2d,0x33,0x2e,0x36,0x35,0x31,0x73,0x31,0x2e,0x36,
-    0x33,0x38,0x2d,0x33,0x2e,0x36,0x35,0x2c,0x33,0x2e,
-    0x36,0x34,0x39,0x2d,0x33,0x2e,0x36,0x35,0x63,0x32,
-    0x2e,0x30,0x31,0x33,0x2c,0x30,0x2c,0x33,0x2e,0x36,
-    0x35,0x2c,0x31,0x2e,0x36,0x33,0x39,0x2c,0x33,0x2e,
-    0x36,0x35,0x2c,0x33,0x2e,0x36,0x35,0x0a,0x09,0x09,
-    0x09,0x43,0x32,0x32,0x2e,0x31,0x38,0x32,0x2c,0x32,
-    0x30,0x2e,0x35,0x34,0x33,0x2c,0x32,0x30,0x2e,0x35,
-    0x34,0x34,0x2c,0x32,0x32,0x2e,0x31,0x38,0x31,0x2c,
-    0x31,0x38,0x2e,0x35,0x33,0x31,0x2c,0x32,0x32,0x2e,
-    0x31,0x38,0x31,0x7a,0x20,0x4d,0x31,0x38,0x2e,0x35,
-    0x33,0x31,0x2c,0x31,0x36,0x2e,0x33,0x37,0x39,0x63,
-    0x2d,0x31,0x2e,0x31,0x38,0x36,0x2c,0x30,0x2d,0x32,
-    0x2e,0x31,0x34,0x39,0x2c,0x30,0x2e,0x39,0x36,0x35,
-    0x2d,0x32,0x2e,0x31,0x34,0x39,0x2c,0x32,0x2e,0x31,
-    0x35,0x73,0x30,0x2e,0x39,0x36,0x35,0x2c,0x32,0x2e,
-    0x31,0x35,0x31,0x2c,0x32,0x2e,0x31,0x34,0x39,0x2c,
-    0x32,0x2e,0x31,0x35,0x31,0x0a,0x09,0x09,0x09,0x63,
-    0x31,0x2e,0x31,0x38,0x36,0x2c,0x30,0x2c,0x32,0x2e,
-    0x31,0x35,0x2d,0x30,0x2e,0x39,0x36,0x36,0x2c,0x32,
-    0x2e,0x31,0x35,0x2d,0x32,0x2e,0x31,0x35,0x31,0x43,
-    0x32,0x30,0x2e,0x36,0x38,0x32,0x2c,0x31,0x37,0x2e,
-    0x33,0x34,0x34,0x2c,0x31,0x39,0x2e,0x37,0x31,0x37,
-    0x2c,0x31,0x36,0x2e,0x33,0x37,0x39,0x2c,0x31,0x38,
-    0x2e,0x35,0x33,0x31,0x2c,0x31,0x36,0x2e,0x33,0x37,
-    0x39,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,
-    0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,
-    0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,
-    0x64,0x3d,0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,0x2c,
-    0x33,0x2e,0x31,0x38,0x33,0x6c,0x2d,0x33,0x2e,0x30,
-    0x30,0x35,0x2c,0x34,0x2e,0x36,0x38,0x34,0x68,0x36,
-    0x2e,0x30,0x31,0x32,0x4c,0x31,0x38,0x2e,0x35,0x33,
-    0x2c,0x33,0x2e,0x31,0x38,0x33,0x7a,0x22,0x2f,0x3e,
-    0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,
-    0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x32,0x31,
-    0x2e,0x35,0x33,0x36,0x2c,0x38,0x2e,0x36,0x31,0x36,
-    0x68,0x2d,0x36,0x2e,0x30,0x31,0x32,0x63,0x2d,0x30,
-    0x2e,0x32,0x37,0x33,0x2c,0x30,0x2d,0x30,0x2e,0x35,
-    0x32,0x35,0x2d,0x30,0x2e,0x31,0x35,0x2d,0x30,0x2e,
-    0x36,0x35,0x37,0x2d,0x30,0x2e,0x33,0x39,0x63,0x2d,
-    0x30,0x2e,0x31,0x33,0x32,0x2d,0x30,0x2e,0x32,0x34,
-    0x31,0x2d,0x30,0x2e,0x31,0x32,0x31,0x2d,0x30,0x2e,
-    0x35,0x33,0x34,0x2c,0x30,0x2e,0x30,0x32,0x36,0x2d,
-    0x30,0x2e,0x37,0x36,0x36,0x6c,0x33,0x2e,0x30,0x30,
-    0x35,0x2d,0x34,0x2e,0x36,0x38,0x34,0x0a,0x09,0x09,
-    0x09,0x63,0x30,0x2e,0x32,0x37,0x36,0x2d,0x30,0x2e,
-    0x34,0x33,0x31,0x2c,0x30,0x2e,0x39,0x38,0x36,0x2d,
-    0x30,0x2e,0x34,0x33,0x2c,0x31,0x2e,0x32,0x36,0x34,
-    0x2c,0x30,0x6c,0x33,0x2e,0x30,0x30,0x35,0x2c,0x34,
-    0x2e,0x36,0x38,0x34,0x63,0x30,0x2e,0x31,0x34,0x37,
-    0x2c,0x30,0x2e,0x32,0x33,0x31,0x2c,0x30,0x2e,0x31,
-    0x35,0x39,0x2c,0x30,0x2e,0x35,0x32,0x34,0x2c,0x30,
-    0x2e,0x30,0x32,0x36,0x2c,0x30,0x2e,0x37,0x36,0x36,
-    0x43,0x32,0x32,0x2e,0x30,0x36,0x33,0x2c,0x38,0x2e,
-    0x34,0x36,0x36,0x2c,0x32,0x31,0x2e,0x38,0x31,0x31,
-    0x2c,0x38,0x2e,0x36,0x31,0x36,0x2c,0x32,0x31,0x2e,
-    0x35,0x33,0x36,0x2c,0x38,0x2e,0x36,0x31,0x36,0x7a,
-    0x0a,0x09,0x09,0x09,0x20,0x4d,0x31,0x36,0x2e,0x38,
-    0x39,0x37,0x2c,0x37,0x2e,0x31,0x31,0x36,0x68,0x33,
-    0x2e,0x32,0x36,0x38,0x4c,0x31,0x38,0x2e,0x35,0x33,
-    0x2c,0x34,0x2e,0x35,0x37,0x31,0x4c,0x31,0x36,0x2e,
-    0x38,0x39,0x37,0x2c,0x37,0x2e,0x31,0x31,0x36,0x7a,
-    0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,
-    0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,
-    0x22,0x4d,0x37,0x2e,0x38,0x30,0x39,0x2c,0x32,0x32,
-    0x2e,0x32,0x38,0x34,0x63,0x2d,0x30,0x2e,0x31,0x34,
-    0x31,0x2c,0x30,0x2d,0x30,0x2e,0x32,0x38,0x32,0x2d,
-    0x30,0x2e,0x30,0x34,0x2d,0x30,0x2e,0x34,0x30,0x35,
-    0x2d,0x30,0x2e,0x31,0x31,0x39,0x4c,0x32,0x2e,0x37,
-    0x32,0x2c,0x31,0x39,0x2e,0x31,0x36,0x32,0x63,0x2d,
-    0x30,0x2e,0x32,0x31,0x35,0x2d,0x30,0x2e,0x31,0x33,
-    0x38,0x2d,0x30,0x2e,0x33,0x34,0x35,0x2d,0x30,0x2e,
-    0x33,0x37,0x36,0x2d,0x30,0x2e,0x33,0x34,0x35,0x2d,
-    0x30,0x2e,0x36,0x33,0x31,0x0a,0x09,0x09,0x09,0x73,
-    0x30,0x2e,0x31,0x33,0x2d,0x30,0x2e,0x34,0x39,0x33,
-    0x2c,0x30,0x2e,0x33,0x34,0x35,0x2d,0x30,0x2e,0x36,
-    0x33,0x31,0x6c,0x34,0x2e,0x36,0x38,0x34,0x2d,0x33,
-    0x2e,0x30,0x30,0x36,0x63,0x30,0x2e,0x32,0x33,0x2d,
-    0x30,0x2e,0x31,0x34,0x38,0x2c,0x30,0x2e,0x35,0x32,
-    0x34,0x2d,0x30,0x2e,0x31,0x35,0x38,0x2c,0x30,0x2e,
-    0x37,0x36,0x36,0x2d,0x30,0x2e,0x30,0x32,0x37,0x63,
-    0x30,0x2e,0x32,0x34,0x2c,0x30,0x2e,0x31,0x33,0x31,
-    0x2c,0x30,0x2e,0x33,0x39,0x2c,0x30,0x2e,0x33,0x38,
-    0x34,0x2c,0x30,0x2e,0x33,0x39,0x2c,0x30,0x2e,0x36,
-    0x35,0x38,0x76,0x36,0x2e,0x30,0x31,0x0a,0x09,0x09,
-    0x09,0x63,0x30,0x2c,0x30,0x2e,0x32,0x37,0x34,0x2d,
-    0x30,0x2e,0x31,0x34,0x38,0x2c,0x30,0x2e,0x35,0x32,
-    0x36,0x2d,0x30,0x2e,0x33,0x39,0x2c,0x30,0x2e,0x36,
-    0x35,0x38,0x43,0x38,0x2e,0x30,0x35,0x36,0x2c,0x32,
-    0x32,0x2e,0x32,0x35,0x34,0x2c,0x37,0x2e,0x39,0x33,
-    0x32,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,0x2c,0x37,
-    0x2e,0x38,0x30,0x39,0x2c,0x32,0x32,0x2e,0x32,0x38,
-    0x34,0x7a,0x20,0x4d,0x34,0x2e,0x35,0x31,0x34,0x2c,
-    0x31,0x38,0x2e,0x35,0x33,0x6c,0x32,0x2e,0x35,0x34,
-    0x35,0x2c,0x31,0x2e,0x36,0x33,0x32,0x76,0x2d,0x33,
-    0x2e,0x32,0x36,0x35,0x4c,0x34,0x2e,0x35,0x31,0x34,
-    0x2c,0x31,0x38,0x2e,0x35,0x33,0x7a,0x22,0x2f,0x3e,
-    0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x09,0x3c,0x67,
-    0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,
-    0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,0x4d,0x32,
-    0x39,0x2e,0x31,0x39,0x35,0x2c,0x32,0x32,0x2e,0x32,
-    0x38,0x34,0x63,0x2d,0x30,0x2e,0x31,0x32,0x34,0x2c,
-    0x30,0x2d,0x30,0x2e,0x32,0x34,0x36,0x2d,0x30,0x2e,
-    0x30,0x33,0x2d,0x30,0x2e,0x33,0x35,0x38,0x2d,0x30,
-    0x2e,0x30,0x39,0x32,0x63,0x2d,0x30,0x2e,0x32,0x34,
-    0x31,0x2d,0x30,0x2e,0x31,0x33,0x32,0x2d,0x30,0x2e,
-    0x33,0x39,0x32,0x2d,0x30,0x2e,0x33,0x38,0x34,0x2d,
-    0x30,0x2e,0x33,0x39,0x32,0x2d,0x30,0x2e,0x36,0x35,
-    0x38,0x76,0x2d,0x36,0x2e,0x30,0x31,0x0a,0x09,0x09,
-    0x09,0x63,0x30,0x2d,0x30,0x2e,0x32,0x37,0x34,0x2c,
-    0x30,0x2e,0x31,0x34,0x39,0x2d,0x30,0x2e,0x35,0x32,
-    0x36,0x2c,0x30,0x2e,0x33,0x39,0x32,0x2d,0x30,0x2e,
-    0x36,0x35,0x38,0x63,0x30,0x2e,0x32,0x33,0x39,0x2d,
-    0x30,0x2e,0x31,0x33,0x31,0x2c,0x30,0x2e,0x35,0x33,
-    0x33,0x2d,0x30,0x2e,0x31,0x32,0x33,0x2c,0x30,0x2e,
-    0x37,0x36,0x35,0x2c,0x30,0x2e,0x30,0x32,0x37,0x6c,
-    0x34,0x2e,0x36,0x38,0x35,0x2c,0x33,0x2e,0x30,0x30,
-    0x35,0x63,0x30,0x2e,0x32,0x31,0x35,0x2c,0x30,0x2e,
-    0x31,0x33,0x38,0x2c,0x30,0x2e,0x33,0x34,0x35,0x2c,
-    0x30,0x2e,0x33,0x37,0x36,0x2c,0x30,0x2e,0x33,0x34,
-    0x35,0x2c,0x30,0x2e,0x36,0x33,0x31,0x0a,0x09,0x09,
-    0x09,0x73,0x2d,0x30,0x2e,0x31,0x33,0x2c,0x30,0x2e,
-    0x34,0x39,0x33,0x2d,0x30,0x2e,0x33,0x34,0x35,0x2c,
-    0x30,0x2e,0x36,0x33,0x31,0x6c,0x2d,0x34,0x2e,0x36,
-    0x38,0x35,0x2c,0x33,0x2e,0x30,0x30,0x34,0x43,0x32,
-    0x39,0x2e,0x34,0x37,0x38,0x2c,0x32,0x32,0x2e,0x32,
-    0x34,0x34,0x2c,0x32,0x39,0x2e,0x33,0x33,0x36,0x2c,
-    0x32,0x32,0x2e,0x32,0x38,0x34,0x2c,0x32,0x39,0x2e,
-    0x31,0x39,0x35,0x2c,0x32,0x32,0x2e,0x32,0x38,0x34,
-    0x7a,0x20,0x4d,0x32,0x39,0x2e,0x39,0x34,0x35,0x2c,
-    0x31,0x36,0x2e,0x38,0x39,0x36,0x76,0x33,0x2e,0x32,
-    0x36,0x36,0x6c,0x32,0x2e,0x35,0x34,0x36,0x2d,0x31,
-    0x2e,0x36,0x33,0x33,0x0a,0x09,0x09,0x09,0x4c,0x32,
-    0x39,0x2e,0x39,0x34,0x35,0x2c,0x31,0x36,0x2e,0x38,
-    0x39,0x36,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,
-    0x67,0x3e,0x0a,0x09,0x3c,0x67,0x3e,0x0a,0x09,0x09,
-    0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,
-    0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,
-    0x20,0x64,0x3d,0x22,0x4d,0x31,0x38,0x2e,0x35,0x33,
-    0x2c,0x33,0x33,0x2e,0x38,0x37,0x36,0x6c,0x33,0x2e,
-    0x30,0x30,0x37,0x2d,0x34,0x2e,0x36,0x38,0x34,0x68,
-    0x2d,0x36,0x2e,0x30,0x31,0x32,0x4c,0x31,0x38,0x2e,
-    0x35,0x33,0x2c,0x33,0x33,0x2e,0x38,0x37,0x36,0x7a,
-    0x22,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x70,0x61,0x74,
-    0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x46,
-    0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,0x3d,0x22,
-    0x4d,0x31,0x38,0x2e,0x35,0x33,0x2c,0x33,0x34,0x2e,
-    0x36,0x32,0x36,0x4c,0x31,0x38,0x2e,0x35,0x33,0x2c,
-    0x33,0x34,0x2e,0x36,0x32,0x36,0x63,0x2d,0x30,0x2e,
-    0x32,0x35,0x35,0x2c,0x30,0x2d,0x30,0x2e,0x34,0x39,
-    0x32,0x2d,0x30,0x2e,0x31,0x33,0x2d,0x30,0x2e,0x36,
-    0x33,0x31,0x2d,0x30,0x2e,0x33,0x34,0x35,0x6c,0x2d,
-    0x33,0x2e,0x30,0x30,0x35,0x2d,0x34,0x2e,0x36,0x38,
-    0x34,0x0a,0x09,0x09,0x09,0x63,0x2d,0x30,0x2e,0x31,
-    0x34,0x37,0x2d,0x30,0x2e,0x32,0x33,0x31,0x2d,0x30,
-    0x2e,0x31,0x35,0x38,0x2d,0x30,0x2e,0x35,0x32,0x34,
-    0x2d,0x30,0x2e,0x30,0x32,0x36,0x2d,0x30,0x2e,0x37,
-    0x36,0x36,0x73,0x30,0x2e,0x33,0x38,0x34,0x2d,0x30,
-    0x2e,0x33,0x39,0x31,0x2c,0x30,0x2e,0x36,0x35,0x37,
-    0x2d,0x30,0x2e,0x33,0x39,0x31,0x68,0x36,0x2e,0x30,
-    0x31,0x32,0x63,0x30,0x2e,0x32,0x37,0x33,0x2c,0x30,
-    0x2c,0x30,0x2e,0x35,0x32,0x35,0x2c,0x30,0x2e,0x31,
-    0x34,0x38,0x2c,0x30,0x2e,0x36,0x35,0x37,0x2c,0x30,
-    0x2e,0x33,0x39,0x31,0x0a,0x09,0x09,0x09,0x63,0x30,
-    0x2e,0x31,0x33,0x33,0x2c,0x30,0x2e,0x32,0x34,0x2c,
-    0x30,0x2e,0x31,0x32,0x31,0x2c,0x30,0x2e,0x35,0x33,
-    0x33,0x2d,0x30,0x2e,0x30,0x32,0x36,0x2c,0x30,0x2e,
-    0x37,0x36,0x36,0x6c,0x2d,0x33,0x2e,0x30,0x30,0x35,
-    0x2c,0x34,0x2e,0x36,0x38,0x34,0x43,0x31,0x39,0x2e,
-    0x30,0x32,0x33,0x2c,0x33,0x34,0x2e,0x34,0x39,0x36,
-    0x2c,0x31,0x38,0x2e,0x37,0x38,0x36,0x2c,0x33,0x34,
-    0x2e,0x36,0x32,0x36,0x2c,0x31,0x38,0x2e,0x35,0x33,
-    0x2c,0x33,0x34,0x2e,0x36,0x32,0x36,0x7a,0x20,0x4d,
-    0x31,0x36,0x2e,0x38,0x39,0x37,0x2c,0x32,0x39,0x2e,
-    0x39,0x34,0x32,0x6c,0x31,0x2e,0x36,0x33,0x33,0x2c,
-    0x32,0x2e,0x35,0x34,0x35,0x0a,0x09,0x09,0x09,0x6c,
-    0x31,0x2e,0x36,0x33,0x35,0x2d,0x32,0x2e,0x35,0x34,
-    0x35,0x48,0x31,0x36,0x2e,0x38,0x39,0x37,0x7a,0x22,
-    0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,
-    0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,
-    0x0a
+const size_t help_dpad_updown_svg_size = 1373;
+const unsigned char help_dpad_updown_svg_data[1373] = {
+    0x45,0x53,0x5a,0x31,0xa9,0x0c,0x00,0x00,0x78,0xda,
+    0x95,0x56,0xdb,0x6e,0x1b,0x37,0x10,0x7d,0xb6,0xbf,
+    0x82,0xdd,0x3e,0x15,0x20,0xb9,0xbc,0x2c,0x2f,0x6b,
+    0x58,0x09,0x1a,0xd9,0x4d,0x02,0x28,0xad,0x81,0xa6,
+    0x2e,0xfa,0x14,0xd8,0xab,0x8d,0x56,0xc8,0x56,0x12,
+    0x24,0x59,0x72,0xfd,0xf5,0x9d,0x19,0x52,0xd2,0x1a,
+    0x70,0xd0,0xda,0x0f,0xdc,0x21,0x39,0x3c,0x33,0x73,
+    0xe6,0x22,0x5f,0xbe,0x7d,0xfc,0xbb,0x67,0xbb,0x76,
+    0xbd,0x99,0x2f,0x17,0xa3,0x42,0x4b,0x55,0xb0,0x76,
+    0xd1,0x2c,0xa7,0xf3,0xc5,0x6c,0x54,0x3c,0x6c,0xbf,
+    0x8a,0x58,0xbc,0x7d,0x73,0x7e,0xf9,0x83,0x10,0xec,
+    0x7d,0xbb,0x68,0xd7,0x77,0xdb,0xe5,0xfa,0x82,0xfd,
+    0x3c,0x5d,0xde,0xb7,0xec,0x63,0xdf,0x3f,0x6c,0xb6,
+    0x74,0xc4,0xb4,0x97,0x4a,0x5a,0xce,0x7e,0xbf,0x7d,
+    0xcf,0xae,0x1f,0x57,0xcb,0xf5,0x96,0xdd,0xf4,0x0f,
+    0x33,0xf1,0x71,0xc1,0x24,0x1d,0xde,0x26,0x1b,0x17,
+    0x0c,0x14,0x15,0x7b,0xf7,0x30,0xef,0xa7,0x4c,0xfd,
+    0xc4,0x98,0x10,0x08,0x7f,0xf5,0xdb,0xf8,0xf3,0x5f,
+    0x37,0xd7,0x6c,0xb3,0x9b,0xb1,0x9b,0x3f,0xde,0x4d,
+    0x3e,0x8e,0x59,0x21,0xca,0xf2,0x4f,0x3b,0x2e,0xcb,
+    0xab,0xcf,0x57,0x84,0xa0,0xa5,0x2e,0xcb,0xeb,0x5f,
+    0x0b,0x56,0x74,0xdb,0xed,0xea,0xa2,0x2c,0xf7,0xfb,
+    0xbd,0xdc,0x5b,0xb9,0x5c,0xcf,0xca,0xf7,0xeb,0xbb,
+    0x55,0x37,0x6f,0x36,0x25,0x28,0x96,0xa8,0x08,0x8f,
+    0x4a,0x00,0xd3,0x5a,0x4e,0xb7,0xd3,0x02,0x4c,0x20,
+    0xf2,0x20,0x4e,0x5d,0xb0,0xf9,0x74,0x54,0x7c,0x79,
+    0xb4,0xea,0x4b,0xc1,0x80,0x84,0xc5,0x66,0xf4,0x02,
+    0xae,0x51,0x4a,0x21,0x4e,0x56,0xb9,0x78,0xec,0xe7,
+    0x8b,0x6f,0x2f,0x29,0xea,0xba,0xae,0x4b,0xba,0x05,
+    0xd5,0x51,0xa1,0x56,0x8f,0x05,0xfb,0x27,0x7d,0xcf,
+    0xcf,0xd8,0x7e,0x3e,0xdd,0x76,0xa3,0xc2,0x06,0xa9,
+    0xbc,0xc6,0xab,0xae,0x9d,0xcf,0xba,0xed,0xf0,0x64,
+    0x37,0x6f,0xf7,0xef,0x96,0xf8,0x94,0x29,0x96,0x8e,
+    0xf3,0x07,0x33,0x72,0x77,0xdf,0xb7,0xe2,0xfe,0xae,
+    0xf9,0x36,0x5b,0x2f,0x1f,0x16,0xe0,0xf8,0xa2,0xdd,
+    0xb3,0x17,0x34,0xc1,0xcb,0x8b,0xcd,0xea,0xae,0x69,
+    0x47,0xc5,0x6a,0xdd,0x6e,0xda,0xf5,0xae,0xc5,0xe0,
+    0x67,0x6f,0xce,0xcf,0x68,0xc9,0xeb,0xd9,0xe5,0xea,
+    0x6e,0xdb,0xb1,0xaf,0xf3,0xbe,0x1f,0x15,0x3f,0xfe,
+    0x42,0x7f,0x05,0x03,0xd8,0x4f,0xc6,0x48,0x15,0x3d,
+    0x27,0xbc,0x4e,0x04,0xa9,0xb5,0x6e,0x84,0x91,0x26,
+    0xd6,0x5c,0x09,0x0b,0xdb,0x5a,0x68,0x19,0xbd,0xcf,
+    0x32,0xac,0x46,0xef,0x44,0x94,0xc1,0x9a,0x0f,0xb4,
+    0x19,0x2b,0x19,0xad,0xe6,0xc6,0x49,0xa3,0x3c,0x57,
+    0xdc,0x58,0x69,0x2b,0xfc,0x22,0xb0,0x43,0xdb,0x67,
+    0x3b,0xc2,0x6d,0x54,0xc6,0x45,0xbc,0x40,0x48,0x9c,
+    0x10,0x48,0xec,0x10,0xd2,0xde,0x26,0x48,0xc8,0x62,
+    0x74,0x8e,0x27,0x64,0x6d,0x65,0x30,0x00,0xa8,0x2b,
+    0x59,0x07,0x40,0xee,0x92,0x93,0x80,0x05,0x2e,0x26,
+    0x84,0x04,0x99,0xe5,0xe4,0x22,0x79,0x48,0xd6,0x09,
+    0xf9,0x05,0x7d,0x37,0xd0,0xdf,0x25,0x07,0x39,0x2a,
+    0xa5,0x78,0x07,0xae,0x65,0xc8,0x8e,0xa2,0x1e,0x22,
+    0x8f,0x29,0x68,0xb0,0xeb,0xa5,0x01,0x70,0x8a,0x5c,
+    0x27,0x2a,0xf9,0x90,0xd7,0x27,0xf6,0x29,0x9b,0x05,
+    0x0d,0x57,0x8d,0x8d,0x0c,0x95,0x4b,0x1b,0x64,0x83,
+    0xc4,0xaa,0xb6,0x49,0xa4,0x28,0xc9,0x1f,0xb2,0xd1,
+    0x28,0x68,0x1f,0xe0,0x55,0xda,0x80,0xab,0xb6,0xf8,
+    0xc2,0x53,0x08,0xc7,0xb5,0xd3,0x4a,0x1a,0x6b,0x77,
+    0xf4,0x31,0xf4,0xc2,0x9d,0x5e,0x54,0x27,0x55,0x9d,
+    0x1f,0x23,0x85,0x2a,0x1e,0xf0,0x6d,0xac,0x04,0xbe,
+    0x09,0x74,0x89,0xb2,0xae,0x6c,0x96,0x49,0xfd,0x16,
+    0x22,0x0b,0x50,0x1e,0x84,0xaf,0x1b,0x42,0x16,0xc9,
+    0x2f,0xba,0x17,0x27,0x2b,0xe9,0x41,0x4a,0x78,0xc2,
+    0x4f,0x8a,0xe2,0xf0,0x48,0x27,0x4c,0x71,0xd2,0xee,
+    0x04,0xe1,0xe6,0xd4,0x93,0x29,0x28,0x27,0xa2,0x08,
+    0x36,0xce,0x07,0xe2,0x25,0xf3,0x09,0x62,0xae,0xd2,
+    0x23,0x7a,0x0a,0x13,0x6d,0xa4,0x08,0x0f,0x36,0x0e,
+    0xc1,0x66,0x5a,0x26,0xc3,0x14,0x3c,0xdb,0x3c,0x15,
+    0x25,0x75,0x4a,0x49,0x5d,0x53,0x0e,0x7a,0xe7,0x7b,
+    0x4d,0xa3,0xa3,0x74,0x58,0xf3,0x46,0xea,0x48,0xed,
+    0xa2,0xb4,0xa5,0x76,0xf1,0x15,0x96,0x8f,0xb7,0x75,
+    0x96,0x61,0x75,0x7a,0x83,0x27,0x91,0x64,0x7e,0x3a,
+    0x6e,0xf2,0x2b,0x4e,0xe7,0xf4,0x88,0x1f,0x54,0xa8,
+    0x6d,0xc6,0x04,0x6f,0xb8,0x51,0xd2,0x41,0x3e,0xe8,
+    0x53,0x65,0x9b,0xfc,0x99,0x07,0x50,0x5f,0x79,0x0f,
+    0x53,0xd9,0x86,0xba,0x01,0x1f,0x34,0x90,0x85,0x0d,
+    0xa7,0x2b,0x64,0xa4,0xf6,0x2e,0xcb,0xb0,0xba,0x0d,
+    0x1d,0x90,0x88,0x4c,0x1f,0x8e,0x89,0xd2,0x26,0x3f,
+    0xa5,0x13,0x81,0x8a,0x3e,0x89,0xa4,0x31,0x06,0x2f,
+    0x3c,0xf8,0xa4,0x03,0x94,0x3a,0xa4,0xbc,0x96,0x41,
+    0x87,0x6c,0x95,0x3f,0xf3,0x21,0x91,0xfa,0xff,0xd9,
+    0xc4,0x1e,0x8b,0xb6,0x07,0x6a,0xb0,0x78,0x2b,0xb0,
+    0x52,0x75,0xf0,0xcb,0xa1,0xcd,0x64,0x70,0x7d,0xc8,
+    0xd4,0x77,0x87,0x19,0x94,0x87,0xf5,0x3c,0x42,0xf2,
+    0x61,0x98,0xd1,0x73,0xac,0x10,0x13,0x30,0x3b,0xc0,
+    0x9f,0xc1,0x88,0x28,0x2c,0xef,0x02,0x96,0x4e,0x8d,
+    0xd7,0xda,0x1a,0x54,0xaa,0xa8,0x8e,0xa9,0x9a,0x1d,
+    0x4e,0x30,0xa9,0x0c,0x16,0x6c,0xf0,0xbe,0x27,0xa7,
+    0x04,0x39,0x75,0x9e,0x7a,0xc6,0x50,0x31,0x57,0x10,
+    0x2e,0x50,0x14,0x93,0x0c,0x49,0x34,0x1e,0x1e,0xf6,
+    0x83,0x18,0x1a,0xac,0xc6,0xc0,0xa9,0x71,0xb0,0x32,
+    0x1d,0x66,0xc3,0x99,0x0c,0xcf,0x09,0x1e,0x13,0xad,
+    0xbc,0x05,0xb7,0x2b,0x24,0x1b,0xc6,0x8f,0xd6,0x29,
+    0x06,0x3e,0x0c,0xe8,0x09,0x4d,0x43,0xa6,0xbd,0x8c,
+    0x75,0xe0,0xd8,0x03,0xbe,0xb3,0x60,0x31,0x66,0x86,
+    0x2a,0xe9,0x82,0x9e,0x0c,0xaf,0x5f,0x91,0x83,0x20,
+    0xa3,0xaa,0xb1,0x9c,0x0c,0xf8,0x4c,0x6d,0xaa,0x89,
+    0x32,0x13,0x91,0x1b,0x85,0x43,0xa1,0x52,0xc4,0x9e,
+    0xae,0x27,0x06,0x07,0x32,0xe4,0x5e,0xfb,0x44,0x2f,
+    0x31,0xaa,0xa1,0xc4,0x81,0xd1,0xca,0x1d,0x5b,0x3d,
+    0xc9,0xde,0x52,0x5d,0x6d,0x50,0x03,0x51,0x60,0xce,
+    0x0d,0xae,0x7a,0x62,0x89,0xb2,0xee,0x91,0x56,0x4b,
+    0xb6,0x63,0x22,0x89,0x92,0x15,0x13,0x49,0xe8,0x85,
+    0x09,0xa8,0x52,0xd1,0x18,0x44,0x36,0x2d,0x92,0x09,
+    0xd3,0xeb,0x20,0x7a,0x17,0x77,0x98,0xf4,0x94,0x23,
+    0x24,0x3d,0x54,0x03,0x3c,0xf2,0x29,0xeb,0x8d,0xa3,
+    0x54,0x8e,0xa6,0xb4,0x71,0x15,0xb0,0x55,0x5b,0x93,
+    0xa3,0xe7,0x43,0x2a,0xa0,0xb3,0x80,0x56,0x1c,0x6e,
+    0x48,0x71,0x6f,0xa0,0x05,0x53,0xaf,0x9a,0x9d,0x40,
+    0xee,0xdd,0x64,0x70,0xfd,0x0a,0xba,0x0d,0x90,0x57,
+    0xbb,0x21,0xdf,0x18,0x16,0x55,0x21,0x45,0x8a,0x34,
+    0x58,0x87,0x84,0xaa,0x3a,0x71,0x9c,0xaa,0x93,0x2a,
+    0xd5,0xd6,0xb4,0xd2,0xd4,0x4e,0x32,0x06,0x2e,0x4e,
+    0x91,0x53,0xc9,0x13,0x4d,0x30,0x6b,0x28,0x72,0x3e,
+    0xd0,0x24,0x9a,0x6b,0x71,0x20,0xd1,0x59,0xe2,0xdc,
+    0x58,0xe2,0xd9,0x51,0x61,0x06,0x4a,0x0b,0x8e,0x22,
+    0x28,0xe4,0x86,0x32,0x4c,0xa4,0xc7,0x94,0xba,0xe3,
+    0x6f,0x4b,0x92,0x0f,0x19,0x26,0x48,0x4e,0x29,0x16,
+    0x83,0xbb,0x5e,0x9c,0xc0,0xe0,0xb7,0xaf,0x96,0x55,
+    0x88,0x14,0x39,0x4e,0xb3,0x5a,0x5a,0xeb,0x0f,0xcc,
+    0x3f,0x63,0x05,0xa8,0x87,0x7d,0x8d,0x7c,0x63,0x49,
+    0xfb,0x1d,0xf2,0xed,0x29,0x05,0x34,0xe9,0xad,0x45,
+    0xa3,0x93,0x67,0x3a,0xaf,0x1f,0x3a,0x56,0xc6,0x90,
+    0xfa,0x3b,0xa4,0xfe,0xce,0x63,0x63,0x32,0xbc,0xff,
+    0xaf,0xb1,0x93,0x75,0xe1,0xbd,0xf1,0x93,0xe1,0x86,
+    0x32,0x87,0xff,0xc8,0x50,0xe1,0x1b,0x91,0x7b,0x00,
+    0x48,0x49,0x04,0xe5,0x71,0x37,0x98,0x2c,0x54,0xae,
+    0x38,0x9a,0x0c,0xe9,0x68,0xaa,0x81,0xd4,0x0a,0xc7,
+    0x71,0xb4,0x39,0x25,0x5f,0xf3,0xd3,0x28,0xd3,0x69,
+    0x5e,0x36,0x79,0xde,0x51,0xc9,0x53,0xda,0xa8,0xfc,
+    0x41,0x8b,0x8a,0x20,0x97,0x08,0x38,0x82,0xa9,0x4a,
+    0xcd,0x64,0x4e,0x75,0x70,0x1c,0x4a,0xcf,0x26,0xf1,
+    0x18,0x9a,0x5d,0x19,0x8a,0xaa,0xaa,0x3d,0x56,0x7b,
+    0xc0,0xff,0x6d,0x28,0x46,0x3e,0x0c,0xf8,0xe9,0x38,
+    0x9f,0x28,0x2f,0xa6,0xa7,0x44,0x71,0xea,0x1b,0x34,
+    0x4c,0x7b,0xfc,0x2d,0x81,0xfd,0x87,0xa4,0x39,0xc8,
+    0x59,0x5e,0xe0,0xdf,0xef,0x37,0xe7,0xff,0x02,0x26,
+    0xed,0xbe,0x8b
 };
 
@@ -1,141 +1,78 @@
-//this file was auto-generated from "off.svg" by res2h
+//this file was auto-generated from "off.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t off_svg_size = 1325;
-const unsigned char off_svg_data[1325] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x45,0x62,0x65,0x6e,
-    0x65,0x5f,0x31,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,
-    0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,
-    0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,
-    0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,
-    0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,
-    0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x34,0x33,
-    0x2e,0x39,0x31,0x36,0x70,0x78,0x22,0x20,0x68,0x65,
-    0x69,0x67,0x68,0x74,0x3d,0x22,0x32,0x31,0x2e,0x39,
-    0x35,0x39,0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,
-    0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x34,
-    0x33,0x2e,0x39,0x31,0x36,0x20,0x32,0x31,0x2e,0x39,
-    0x35,0x39,0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,
-    0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-    0x64,0x3d,0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,
-    0x20,0x34,0x33,0x2e,0x39,0x31,0x36,0x20,0x32,0x31,
-    0x2e,0x39,0x35,0x39,0x22,0x20,0x78,0x6d,0x6c,0x3a,
-    0x73,0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,
-    0x73,0x65,0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,
-    0x23,0x37,0x37,0x37,0x37,0x37,0x37,0x22,0x20,0x64,
-    0x3d,0x22,0x4d,0x32,0x39,0x2e,0x32,0x39,0x31,0x2c,
-    0x31,0x35,0x2e,0x36,0x39,0x68,0x31,0x2e,0x39,0x33,
-    0x34,0x76,0x2d,0x34,0x2e,0x31,0x31,0x33,0x68,0x35,
-    0x2e,0x34,0x32,0x76,0x2d,0x31,0x2e,0x34,0x37,0x39,
-    0x68,0x2d,0x35,0x2e,0x34,0x32,0x56,0x37,0x2e,0x37,
-    0x30,0x34,0x68,0x35,0x2e,0x37,0x32,0x39,0x56,0x36,
-    0x2e,0x32,0x32,0x35,0x68,0x2d,0x37,0x2e,0x36,0x36,
-    0x32,0x56,0x31,0x35,0x2e,0x36,0x39,0x7a,0x20,0x4d,
-    0x31,0x39,0x2e,0x38,0x31,0x2c,0x31,0x35,0x2e,0x36,
-    0x39,0x68,0x31,0x2e,0x39,0x33,0x36,0x76,0x2d,0x34,
-    0x2e,0x31,0x31,0x33,0x0a,0x09,0x68,0x35,0x2e,0x34,
-    0x31,0x36,0x76,0x2d,0x31,0x2e,0x34,0x37,0x39,0x68,
-    0x2d,0x35,0x2e,0x34,0x31,0x36,0x56,0x37,0x2e,0x37,
-    0x30,0x34,0x68,0x35,0x2e,0x37,0x32,0x35,0x56,0x36,
-    0x2e,0x32,0x32,0x35,0x68,0x2d,0x37,0x2e,0x36,0x36,
-    0x56,0x31,0x35,0x2e,0x36,0x39,0x7a,0x20,0x4d,0x31,
-    0x32,0x2e,0x33,0x37,0x38,0x2c,0x31,0x34,0x2e,0x34,
-    0x37,0x33,0x63,0x2d,0x32,0x2e,0x31,0x36,0x36,0x2c,
-    0x30,0x2d,0x33,0x2e,0x34,0x30,0x34,0x2d,0x31,0x2e,
-    0x34,0x33,0x35,0x2d,0x33,0x2e,0x34,0x30,0x34,0x2d,
-    0x33,0x2e,0x35,0x31,0x37,0x0a,0x09,0x63,0x30,0x2d,
-    0x32,0x2e,0x30,0x38,0x33,0x2c,0x31,0x2e,0x32,0x33,
-    0x38,0x2d,0x33,0x2e,0x35,0x31,0x38,0x2c,0x33,0x2e,
-    0x34,0x30,0x34,0x2d,0x33,0x2e,0x35,0x31,0x38,0x63,
-    0x32,0x2e,0x31,0x36,0x37,0x2c,0x30,0x2c,0x33,0x2e,
-    0x34,0x30,0x36,0x2c,0x31,0x2e,0x34,0x33,0x35,0x2c,
-    0x33,0x2e,0x34,0x30,0x36,0x2c,0x33,0x2e,0x35,0x31,
-    0x38,0x43,0x31,0x35,0x2e,0x37,0x38,0x34,0x2c,0x31,
-    0x33,0x2e,0x30,0x33,0x38,0x2c,0x31,0x34,0x2e,0x35,
-    0x34,0x35,0x2c,0x31,0x34,0x2e,0x34,0x37,0x33,0x2c,
-    0x31,0x32,0x2e,0x33,0x37,0x38,0x2c,0x31,0x34,0x2e,
-    0x34,0x37,0x33,0x20,0x4d,0x31,0x32,0x2e,0x33,0x37,
-    0x38,0x2c,0x31,0x35,0x2e,0x39,0x35,0x36,0x0a,0x09,
-    0x63,0x33,0x2e,0x38,0x39,0x36,0x2c,0x30,0x2c,0x35,
-    0x2e,0x34,0x31,0x39,0x2d,0x32,0x2e,0x33,0x33,0x35,
-    0x2c,0x35,0x2e,0x34,0x31,0x39,0x2d,0x35,0x73,0x2d,
-    0x31,0x2e,0x35,0x32,0x32,0x2d,0x34,0x2e,0x39,0x39,
-    0x37,0x2d,0x35,0x2e,0x34,0x31,0x39,0x2d,0x34,0x2e,
-    0x39,0x39,0x37,0x63,0x2d,0x33,0x2e,0x38,0x39,0x36,
-    0x2c,0x30,0x2d,0x35,0x2e,0x34,0x31,0x36,0x2c,0x32,
-    0x2e,0x33,0x33,0x32,0x2d,0x35,0x2e,0x34,0x31,0x36,
-    0x2c,0x34,0x2e,0x39,0x39,0x37,0x53,0x38,0x2e,0x34,
-    0x38,0x32,0x2c,0x31,0x35,0x2e,0x39,0x35,0x36,0x2c,
-    0x31,0x32,0x2e,0x33,0x37,0x38,0x2c,0x31,0x35,0x2e,
-    0x39,0x35,0x36,0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x37,0x37,0x37,0x37,0x37,0x37,0x22,0x20,0x64,0x3d,
-    0x22,0x4d,0x33,0x39,0x2e,0x36,0x36,0x34,0x2c,0x31,
-    0x2e,0x35,0x63,0x31,0x2e,0x35,0x31,0x38,0x2c,0x30,
-    0x2c,0x32,0x2e,0x37,0x35,0x32,0x2c,0x31,0x2e,0x32,
-    0x33,0x34,0x2c,0x32,0x2e,0x37,0x35,0x32,0x2c,0x32,
-    0x2e,0x37,0x35,0x32,0x76,0x31,0x33,0x2e,0x34,0x35,
-    0x35,0x63,0x30,0x2c,0x31,0x2e,0x35,0x31,0x38,0x2d,
-    0x31,0x2e,0x32,0x33,0x34,0x2c,0x32,0x2e,0x37,0x35,
-    0x32,0x2d,0x32,0x2e,0x37,0x35,0x32,0x2c,0x32,0x2e,
-    0x37,0x35,0x32,0x48,0x34,0x2e,0x32,0x35,0x32,0x0a,
-    0x09,0x63,0x2d,0x31,0x2e,0x35,0x31,0x38,0x2c,0x30,
-    0x2d,0x32,0x2e,0x37,0x35,0x32,0x2d,0x31,0x2e,0x32,
-    0x33,0x34,0x2d,0x32,0x2e,0x37,0x35,0x32,0x2d,0x32,
-    0x2e,0x37,0x35,0x32,0x56,0x34,0x2e,0x32,0x35,0x32,
-    0x43,0x31,0x2e,0x35,0x2c,0x32,0x2e,0x37,0x33,0x34,
-    0x2c,0x32,0x2e,0x37,0x33,0x34,0x2c,0x31,0x2e,0x35,
-    0x2c,0x34,0x2e,0x32,0x35,0x32,0x2c,0x31,0x2e,0x35,
-    0x48,0x33,0x39,0x2e,0x36,0x36,0x34,0x20,0x4d,0x33,
-    0x39,0x2e,0x36,0x36,0x34,0x2c,0x30,0x48,0x34,0x2e,
-    0x32,0x35,0x32,0x43,0x31,0x2e,0x39,0x31,0x34,0x2c,
-    0x30,0x2c,0x30,0x2c,0x31,0x2e,0x39,0x31,0x34,0x2c,
-    0x30,0x2c,0x34,0x2e,0x32,0x35,0x32,0x76,0x31,0x33,
-    0x2e,0x34,0x35,0x35,0x0a,0x09,0x63,0x30,0x2c,0x32,
-    0x2e,0x33,0x33,0x39,0x2c,0x31,0x2e,0x39,0x31,0x34,
-    0x2c,0x34,0x2e,0x32,0x35,0x32,0x2c,0x34,0x2e,0x32,
-    0x35,0x32,0x2c,0x34,0x2e,0x32,0x35,0x32,0x68,0x33,
-    0x35,0x2e,0x34,0x31,0x32,0x63,0x32,0x2e,0x33,0x33,
-    0x39,0x2c,0x30,0x2c,0x34,0x2e,0x32,0x35,0x32,0x2d,
-    0x31,0x2e,0x39,0x31,0x33,0x2c,0x34,0x2e,0x32,0x35,
-    0x32,0x2d,0x34,0x2e,0x32,0x35,0x32,0x56,0x34,0x2e,
-    0x32,0x35,0x32,0x43,0x34,0x33,0x2e,0x39,0x31,0x36,
-    0x2c,0x31,0x2e,0x39,0x31,0x34,0x2c,0x34,0x32,0x2e,
-    0x30,0x30,0x33,0x2c,0x30,0x2c,0x33,0x39,0x2e,0x36,
-    0x36,0x34,0x2c,0x30,0x4c,0x33,0x39,0x2e,0x36,0x36,
-    0x34,0x2c,0x30,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,
-    0x73,0x76,0x67,0x3e,0x0a
+const size_t off_svg_size = 699;
+const unsigned char off_svg_data[699] = {
+    0x45,0x53,0x5a,0x31,0x2d,0x05,0x00,0x00,0x78,0xda,
+    0x7d,0x94,0x5d,0x6f,0x9b,0x30,0x14,0x86,0xaf,0x9b,
+    0x5f,0xe1,0x79,0x57,0x93,0x6c,0xe3,0x0f,0x0c,0x38,
+    0x2a,0xad,0xd6,0xb4,0x6a,0x2b,0xb5,0x5b,0xa5,0x76,
+    0x99,0x76,0x35,0x25,0x84,0x06,0x54,0x06,0x11,0x90,
+    0x8f,0xf5,0xd7,0xef,0xd8,0x38,0x2a,0x95,0xaa,0xe5,
+    0x82,0x1c,0x8e,0xdf,0xf3,0x9c,0xf7,0x1c,0x48,0x4e,
+    0xcf,0x0f,0x7f,0x2a,0xb4,0xcb,0xdb,0xae,0x6c,0xea,
+    0x14,0x0b,0xc6,0x31,0xca,0xeb,0xac,0x59,0x95,0xf5,
+    0x3a,0xc5,0xdb,0xfe,0x99,0x26,0xf8,0xfc,0x6c,0x72,
+    0xfa,0x89,0x52,0x74,0x9d,0xd7,0x79,0xbb,0xe8,0x9b,
+    0x76,0x8a,0xbe,0xae,0x9a,0x65,0x8e,0x6e,0xab,0x6a,
+    0xdb,0xf5,0x2e,0x85,0x44,0xc4,0x38,0x53,0x04,0x3d,
+    0xce,0xaf,0xd1,0xd5,0x61,0xd3,0xb4,0x3d,0x7a,0xa8,
+    0xb6,0x6b,0x7a,0x5b,0x23,0xe6,0x92,0xf3,0xa1,0xc7,
+    0x14,0x81,0x90,0xa3,0x8b,0x6d,0x59,0xad,0x10,0xff,
+    0x82,0x10,0xa5,0x16,0x7f,0xf9,0x7d,0xf6,0xf4,0xeb,
+    0xe1,0x0a,0x75,0xbb,0x35,0x7a,0xf8,0x71,0x71,0x77,
+    0x3b,0x43,0x98,0x06,0xc1,0x4f,0x35,0x0b,0x82,0xcb,
+    0xa7,0x4b,0x47,0x10,0x4c,0x04,0xc1,0xd5,0x37,0x8c,
+    0x70,0xd1,0xf7,0x9b,0x69,0x10,0xec,0xf7,0x7b,0xb6,
+    0x57,0xac,0x69,0xd7,0xc1,0x75,0xbb,0xd8,0x14,0x65,
+    0xd6,0x05,0x20,0x0c,0xac,0x10,0x8a,0x02,0x80,0x09,
+    0xc1,0x56,0xfd,0x0a,0x43,0x0b,0x4b,0x1e,0xcd,0x29,
+    0x30,0x2a,0x57,0x29,0xbe,0x5a,0xc2,0x50,0xbf,0xe1,
+    0x06,0xd6,0x50,0x77,0xe9,0x07,0x64,0xc9,0x39,0xb7,
+    0x24,0x2f,0x99,0x1e,0xaa,0xb2,0x7e,0xf9,0x48,0x28,
+    0x8c,0x31,0x81,0x3b,0x05,0x69,0x8a,0xf9,0xe6,0x80,
+    0xd1,0xdf,0xe1,0x7b,0x72,0x82,0xf6,0xe5,0xaa,0x2f,
+    0x52,0x1c,0x2a,0x66,0x44,0x64,0x8f,0x8a,0xbc,0x5c,
+    0x17,0x7d,0x8a,0xa5,0x60,0x46,0x1b,0x9b,0xd9,0x95,
+    0xf9,0xfe,0xa2,0xb1,0xa5,0x88,0xa3,0x41,0x88,0x86,
+    0x53,0xfb,0x4c,0x16,0xcb,0x2a,0xa7,0xcb,0x45,0xf6,
+    0xb2,0x6e,0x9b,0x6d,0x0d,0xd6,0xeb,0x7c,0x8f,0x3e,
+    0x50,0x82,0xcb,0x69,0xb7,0x59,0x64,0x79,0x8a,0x37,
+    0x6d,0xde,0xe5,0xed,0x2e,0xb7,0xe3,0x6f,0x16,0x7d,
+    0x81,0x9e,0xcb,0xaa,0x4a,0xf1,0xe7,0xd8,0x7d,0x30,
+    0x02,0xc8,0xbd,0x34,0x4c,0x1a,0x41,0x84,0x66,0x91,
+    0x29,0x00,0xa1,0xc2,0x1d,0x0d,0x99,0x10,0xaa,0xd0,
+    0x2c,0x94,0x3b,0x2a,0x58,0x18,0x9b,0x82,0xda,0x9b,
+    0x79,0xcc,0x62,0x1e,0x42,0x3e,0x96,0x66,0x1e,0x31,
+    0x29,0x75,0x41,0x63,0x16,0x45,0x72,0xee,0xaa,0x5f,
+    0xd1,0xbd,0x30,0x2c,0x19,0xb3,0x22,0xcf,0x9a,0x9c,
+    0x58,0x9a,0x88,0xc6,0x38,0x11,0x8d,0x78,0x7a,0xcc,
+    0x7b,0xc3,0x49,0xa6,0xe2,0x84,0x88,0x10,0x8a,0x54,
+    0x46,0x25,0x13,0x51,0x44,0x38,0x55,0x2c,0xe4,0xa1,
+    0x25,0x29,0xed,0x63,0xc5,0xb4,0x88,0x27,0x27,0x19,
+    0x07,0x0d,0x4f,0x14,0x11,0x4c,0xaa,0xc4,0x65,0x13,
+    0xf2,0xa6,0x48,0x32,0x4b,0x88,0x09,0x77,0xb9,0x88,
+    0x38,0x82,0x8f,0xdd,0xf9,0x0c,0x1a,0xc7,0x49,0x48,
+    0x84,0x62,0x5c,0xb9,0xbe,0x3a,0xd4,0xbe,0x3d,0x79,
+    0x67,0xe6,0xcd,0x9b,0x86,0xad,0x47,0xd0,0x5a,0xb1,
+    0xc4,0x80,0x39,0x62,0x27,0x33,0x60,0x43,0x01,0x7a,
+    0x88,0x75,0x07,0x5e,0xb5,0x94,0xb0,0x0a,0x63,0x62,
+    0x3a,0x24,0x5d,0x9c,0x51,0x5f,0x35,0xec,0x83,0xd8,
+    0x2a,0xe9,0x63,0x27,0x78,0x4c,0x58,0x98,0x48,0xdf,
+    0x84,0xbc,0x6b,0x89,0x83,0xff,0x3c,0x54,0x65,0x60,
+    0x8d,0x30,0x07,0xd3,0x99,0x70,0x4b,0xe0,0xc0,0x8e,
+    0xb5,0x74,0x8b,0x09,0x7d,0xec,0xae,0x3b,0x98,0x35,
+    0xd4,0x3a,0xe3,0xc4,0x09,0xe9,0x48,0x40,0x47,0xb2,
+    0x9b,0x90,0x49,0x2d,0x61,0x4c,0xea,0x79,0xc3,0xe1,
+    0x20,0xa7,0x23,0xf9,0xdc,0x09,0x67,0xa0,0xb2,0x85,
+    0x03,0x4a,0x39,0x27,0xc4,0x9d,0xd8,0xe8,0x66,0xb0,
+    0x87,0x8e,0x36,0xf9,0xcd,0xb1,0xc8,0x08,0xb8,0x23,
+    0xd6,0xcb,0x10,0xb9,0xbc,0xb7,0x68,0x1f,0xaf,0xdb,
+    0x90,0xf1,0xc7,0x03,0x6f,0x74,0x2d,0x94,0x5d,0x9d,
+    0xcc,0x06,0x91,0xaf,0xa6,0x56,0xac,0x7c,0xec,0xae,
+    0xde,0xe2,0xf0,0xb3,0x39,0xb2,0xe0,0xbd,0xe1,0xca,
+    0xbe,0x19,0xde,0xd2,0xdd,0x31,0x78,0x75,0x8b,0xb6,
+    0x7f,0x00,0x67,0x93,0x7f,0x53,0x0e,0x3f,0x8e
 };
 
@@ -1,122 +1,74 @@
-//this file was auto-generated from "on.svg" by res2h
+//this file was auto-generated from "on.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t on_svg_size = 1132;
-const unsigned char on_svg_data[1132] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x45,0x62,0x65,0x6e,
-    0x65,0x5f,0x31,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,
-    0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,
-    0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,
-    0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,
-    0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,
-    0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x34,0x33,
-    0x2e,0x39,0x31,0x36,0x70,0x78,0x22,0x20,0x68,0x65,
-    0x69,0x67,0x68,0x74,0x3d,0x22,0x32,0x31,0x2e,0x39,
-    0x35,0x39,0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,
-    0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x34,
-    0x33,0x2e,0x39,0x31,0x36,0x20,0x32,0x31,0x2e,0x39,
-    0x35,0x39,0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,
-    0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-    0x64,0x3d,0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,
-    0x20,0x34,0x33,0x2e,0x39,0x31,0x36,0x20,0x32,0x31,
-    0x2e,0x39,0x35,0x39,0x22,0x20,0x78,0x6d,0x6c,0x3a,
-    0x73,0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,
-    0x73,0x65,0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,
-    0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x37,0x37,0x37,0x37,
-    0x37,0x37,0x22,0x20,0x64,0x3d,0x22,0x4d,0x31,0x35,
-    0x2e,0x37,0x35,0x34,0x2c,0x37,0x2e,0x34,0x36,0x31,
-    0x63,0x2d,0x32,0x2e,0x33,0x31,0x39,0x2c,0x30,0x2d,
-    0x33,0x2e,0x36,0x34,0x33,0x2c,0x31,0x2e,0x34,0x33,
-    0x34,0x2d,0x33,0x2e,0x36,0x34,0x33,0x2c,0x33,0x2e,
-    0x35,0x31,0x38,0x63,0x30,0x2c,0x32,0x2e,0x30,0x38,
-    0x33,0x2c,0x31,0x2e,0x33,0x32,0x35,0x2c,0x33,0x2e,
-    0x35,0x32,0x31,0x2c,0x33,0x2e,0x36,0x34,0x33,0x2c,
-    0x33,0x2e,0x35,0x32,0x31,0x0a,0x09,0x09,0x63,0x32,
-    0x2e,0x33,0x32,0x2c,0x30,0x2c,0x33,0x2e,0x36,0x34,
-    0x34,0x2d,0x31,0x2e,0x34,0x33,0x37,0x2c,0x33,0x2e,
-    0x36,0x34,0x35,0x2d,0x33,0x2e,0x35,0x32,0x31,0x43,
-    0x31,0x39,0x2e,0x33,0x39,0x39,0x2c,0x38,0x2e,0x38,
-    0x39,0x35,0x2c,0x31,0x38,0x2e,0x30,0x37,0x34,0x2c,
-    0x37,0x2e,0x34,0x36,0x31,0x2c,0x31,0x35,0x2e,0x37,
-    0x35,0x34,0x2c,0x37,0x2e,0x34,0x36,0x31,0x7a,0x22,
-    0x2f,0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x37,0x37,0x37,
-    0x37,0x37,0x37,0x22,0x20,0x64,0x3d,0x22,0x4d,0x33,
-    0x39,0x2e,0x36,0x36,0x34,0x2c,0x30,0x48,0x34,0x2e,
-    0x32,0x35,0x32,0x43,0x31,0x2e,0x39,0x31,0x34,0x2c,
-    0x30,0x2c,0x30,0x2c,0x31,0x2e,0x39,0x31,0x34,0x2c,
-    0x30,0x2c,0x34,0x2e,0x32,0x35,0x32,0x76,0x31,0x33,
-    0x2e,0x34,0x35,0x35,0x63,0x30,0x2c,0x32,0x2e,0x33,
-    0x33,0x39,0x2c,0x31,0x2e,0x39,0x31,0x34,0x2c,0x34,
-    0x2e,0x32,0x35,0x32,0x2c,0x34,0x2e,0x32,0x35,0x32,
-    0x2c,0x34,0x2e,0x32,0x35,0x32,0x68,0x33,0x35,0x2e,
-    0x34,0x31,0x32,0x0a,0x09,0x09,0x63,0x32,0x2e,0x33,
-    0x33,0x39,0x2c,0x30,0x2c,0x34,0x2e,0x32,0x35,0x32,
-    0x2d,0x31,0x2e,0x39,0x31,0x33,0x2c,0x34,0x2e,0x32,
-    0x35,0x32,0x2d,0x34,0x2e,0x32,0x35,0x32,0x56,0x34,
-    0x2e,0x32,0x35,0x32,0x43,0x34,0x33,0x2e,0x39,0x31,
-    0x36,0x2c,0x31,0x2e,0x39,0x31,0x34,0x2c,0x34,0x32,
-    0x2e,0x30,0x30,0x33,0x2c,0x30,0x2c,0x33,0x39,0x2e,
-    0x36,0x36,0x34,0x2c,0x30,0x7a,0x20,0x4d,0x31,0x35,
-    0x2e,0x37,0x35,0x34,0x2c,0x31,0x35,0x2e,0x39,0x37,
-    0x39,0x63,0x2d,0x34,0x2e,0x31,0x36,0x38,0x2c,0x30,
-    0x2d,0x35,0x2e,0x37,0x39,0x36,0x2d,0x32,0x2e,0x33,
-    0x33,0x34,0x2d,0x35,0x2e,0x37,0x39,0x36,0x2d,0x35,
-    0x0a,0x09,0x09,0x63,0x30,0x2d,0x32,0x2e,0x36,0x36,
-    0x39,0x2c,0x31,0x2e,0x36,0x32,0x38,0x2d,0x35,0x2e,
-    0x30,0x30,0x31,0x2c,0x35,0x2e,0x37,0x39,0x36,0x2d,
-    0x35,0x2e,0x30,0x30,0x31,0x63,0x34,0x2e,0x31,0x37,
-    0x2c,0x30,0x2c,0x35,0x2e,0x37,0x39,0x38,0x2c,0x32,
-    0x2e,0x33,0x33,0x32,0x2c,0x35,0x2e,0x37,0x39,0x38,
-    0x2c,0x35,0x2e,0x30,0x30,0x31,0x43,0x32,0x31,0x2e,
-    0x35,0x35,0x32,0x2c,0x31,0x33,0x2e,0x36,0x34,0x34,
-    0x2c,0x31,0x39,0x2e,0x39,0x32,0x34,0x2c,0x31,0x35,
-    0x2e,0x39,0x37,0x39,0x2c,0x31,0x35,0x2e,0x37,0x35,
-    0x34,0x2c,0x31,0x35,0x2e,0x39,0x37,0x39,0x7a,0x20,
-    0x4d,0x33,0x33,0x2e,0x39,0x35,0x37,0x2c,0x31,0x35,
-    0x2e,0x37,0x31,0x35,0x0a,0x09,0x09,0x68,0x2d,0x32,
-    0x2e,0x33,0x33,0x32,0x4c,0x32,0x35,0x2e,0x37,0x32,
-    0x2c,0x38,0x2e,0x36,0x30,0x32,0x68,0x2d,0x30,0x2e,
-    0x30,0x32,0x37,0x76,0x37,0x2e,0x31,0x31,0x33,0x68,
-    0x2d,0x31,0x2e,0x39,0x38,0x38,0x56,0x36,0x2e,0x32,
-    0x34,0x34,0x68,0x32,0x2e,0x33,0x37,0x33,0x6c,0x35,
-    0x2e,0x38,0x36,0x35,0x2c,0x37,0x2e,0x31,0x31,0x34,
-    0x68,0x30,0x2e,0x30,0x32,0x37,0x56,0x36,0x2e,0x32,
-    0x34,0x34,0x68,0x31,0x2e,0x39,0x38,0x37,0x56,0x31,
-    0x35,0x2e,0x37,0x31,0x35,0x7a,0x22,0x2f,0x3e,0x0a,
-    0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,
-    0x3e,0x0a
+const size_t on_svg_size = 651;
+const unsigned char on_svg_data[651] = {
+    0x45,0x53,0x5a,0x31,0x6c,0x04,0x00,0x00,0x78,0xda,
+    0x7d,0x53,0xdb,0x6e,0x9b,0x40,0x10,0x7d,0xb6,0xbf,
+    0x62,0xba,0x7d,0xaa,0xb4,0xec,0x95,0x05,0xd6,0x32,
+    0x89,0x1a,0x27,0x4a,0x23,0xa5,0x6d,0xa4,0xa6,0xae,
+    0xfa,0x54,0xd9,0x98,0x00,0x2a,0x05,0x0b,0xe3,0x4b,
+    0xf3,0xf5,0x9d,0x5d,0x70,0x95,0x4a,0x51,0x6d,0x69,
+    0x19,0xe6,0x9c,0x39,0x73,0x66,0x56,0xcc,0x2f,0x4f,
+    0xbf,0x6a,0x38,0xe4,0xdd,0xae,0x6a,0x9b,0x94,0x48,
+    0x26,0x08,0xe4,0x4d,0xd6,0x6e,0xaa,0xa6,0x48,0xc9,
+    0xbe,0x7f,0x0a,0x12,0x72,0x79,0x31,0x9d,0xbf,0x09,
+    0x02,0xb8,0xcd,0x9b,0xbc,0x5b,0xf5,0x6d,0x37,0x83,
+    0xf7,0x9b,0x76,0x9d,0xc3,0x5d,0x5d,0xef,0x77,0xbd,
+    0x4f,0x81,0x8c,0x98,0x60,0x9a,0xc2,0x97,0xe5,0x2d,
+    0xdc,0x9c,0xb6,0x6d,0xd7,0xc3,0x43,0xbd,0x2f,0x82,
+    0xbb,0x06,0x98,0x4f,0x2e,0x87,0x1e,0x33,0x40,0xa2,
+    0x80,0xab,0x7d,0x55,0x6f,0x40,0xbc,0x03,0x08,0x02,
+    0x27,0x7f,0xfd,0x79,0xf1,0xf8,0xfd,0xe1,0x06,0x76,
+    0x87,0x02,0x1e,0xbe,0x5e,0xdd,0xdf,0x2d,0x80,0x04,
+    0x9c,0x7f,0xd3,0x0b,0xce,0xaf,0x1f,0xaf,0xbd,0x82,
+    0x64,0x92,0xf3,0x9b,0x4f,0x04,0x48,0xd9,0xf7,0xdb,
+    0x19,0xe7,0xc7,0xe3,0x91,0x1d,0x35,0x6b,0xbb,0x82,
+    0xdf,0x76,0xab,0x6d,0x59,0x65,0x3b,0x8e,0x44,0xee,
+    0x88,0x58,0xc4,0x51,0x4c,0x4a,0xb6,0xe9,0x37,0x04,
+    0x5b,0x38,0xe5,0x17,0x73,0x4a,0x02,0xd5,0x26,0x25,
+    0x37,0x6b,0x1c,0xea,0x07,0xbe,0xe0,0x1a,0x9a,0x5d,
+    0xfa,0x8a,0xb2,0x12,0x42,0x38,0xa5,0x91,0x32,0x3b,
+    0xd5,0x55,0xf3,0xf3,0x35,0xa2,0xb4,0xd6,0x72,0x8f,
+    0x22,0x35,0x25,0x62,0x7b,0x22,0xf0,0x7b,0x78,0x4e,
+    0x27,0x70,0xac,0x36,0x7d,0x99,0x92,0x50,0x33,0x2b,
+    0x23,0x07,0x95,0x79,0x55,0x94,0x7d,0x4a,0x94,0x64,
+    0xd6,0x58,0x97,0x39,0x54,0xf9,0xf1,0xaa,0x75,0xa5,
+    0x20,0x60,0x20,0xc2,0x80,0xba,0x3b,0x59,0xad,0xeb,
+    0x3c,0x58,0xaf,0xb2,0x9f,0x45,0xd7,0xee,0x1b,0xb4,
+    0xde,0xe4,0x47,0x78,0x85,0x89,0x2e,0x67,0xbb,0xed,
+    0x2a,0xcb,0x53,0xb2,0xed,0xf2,0x5d,0xde,0x1d,0x72,
+    0x37,0x7e,0x71,0x31,0x9d,0xcc,0xb7,0xab,0xbe,0x84,
+    0xa7,0xaa,0xae,0x53,0xf2,0x36,0xf6,0x3f,0x02,0xa8,
+    0xf4,0x51,0x1a,0x16,0x9b,0x90,0xc6,0x2c,0x8c,0x64,
+    0x16,0x28,0xa6,0xa5,0xa5,0x22,0xd0,0x2c,0x0a,0x35,
+    0x95,0x2c,0xd4,0xe1,0x18,0x6b,0x66,0x64,0x92,0x09,
+    0xaa,0x98,0x48,0x1c,0xa2,0x95,0x71,0x39,0x25,0xe9,
+    0x5f,0x5c,0xc9,0xe9,0x64,0x92,0xa1,0x84,0xa2,0xc2,
+    0x67,0xc3,0xc0,0x29,0xc4,0x3e,0x36,0x81,0x67,0x2c,
+    0xa4,0x65,0xda,0x5a,0x9a,0xb0,0xc4,0x1a,0x2a,0x13,
+    0x26,0xe2,0xb1,0x39,0x7d,0xe9,0xe4,0x99,0xf0,0xff,
+    0x99,0xd6,0x96,0x45,0x51,0x48,0xc5,0x87,0x90,0x29,
+    0xa3,0x16,0x38,0xbe,0xc4,0x37,0xfc,0x9f,0x23,0x9f,
+    0x3f,0x48,0xcd,0x42,0x63,0xbc,0x69,0xad,0xed,0x08,
+    0x7a,0xe8,0xe5,0x59,0x6a,0xc3,0x42,0xa9,0x46,0xef,
+    0xc8,0x1b,0xcb,0x03,0xc7,0xd7,0x63,0xec,0xcf,0xe5,
+    0xd0,0x6e,0xd8,0xfa,0x59,0x0e,0x17,0x22,0xb4,0x1b,
+    0x78,0xf4,0xf4,0x0c,0xe7,0x9d,0xe2,0xc3,0xc6,0x36,
+    0xc3,0x5a,0x19,0x25,0xb8,0x54,0xcc,0xda,0xc8,0xad,
+    0x18,0x97,0x3a,0xc4,0xc6,0x35,0x15,0x98,0x8a,0x22,
+    0x67,0x2f,0x52,0x09,0x02,0x42,0x48,0x3a,0xc2,0x2e,
+    0xce,0xb0,0x3c,0x46,0x7d,0x97,0x4a,0xfc,0x24,0x6a,
+    0x8c,0x3d,0xbc,0xc0,0xcb,0x37,0x38,0x8a,0xf4,0x0b,
+    0xa7,0xb8,0x5e,0xab,0xce,0xad,0xe9,0x3f,0x46,0xd0,
+    0x98,0x46,0xe7,0x26,0xf6,0x69,0xe9,0x7a,0x97,0xde,
+    0x8d,0xba,0x57,0x98,0x50,0x78,0x27,0x91,0x50,0x65,
+    0x20,0x98,0x50,0xf1,0x21,0x66,0x52,0xea,0xd2,0xed,
+    0x20,0x49,0x96,0x11,0x53,0x61,0x58,0x22,0x37,0xd6,
+    0xb5,0x61,0x49,0x64,0xa8,0x83,0xc3,0xd2,0x53,0x47,
+    0xd4,0x31,0xe3,0xe5,0x20,0xed,0xaf,0x6f,0xce,0x0b,
+    0x77,0xe0,0xf7,0x73,0x31,0xfd,0x03,0x8b,0x45,0x16,
+    0x8b
 };
 
@@ -1,3295 +1,1807 @@
-//this file was auto-generated from "opensans_hebrew_condensed_light.ttf" by res2h
+//this file was auto-generated from "opensans_hebrew_condensed_light.ttf" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t opensans_hebrew_condensed_light_ttf_size = 32868;
-const unsigned char opensans_hebrew_condensed_light_ttf_data[32868] = {
-    0x00,0x01,0x00,0x00,0x00,0x10,0x01,0x00,0x00,0x04,
-    0x00,0x00,0x46,0x46,0x54,0x4d,0x67,0x7f,0x0d,0x13,
-    0x00,0x00,0x7c,0xb4,0x00,0x00,0x00,0x1c,0x47,0x44,
-    0x45,0x46,0x03,0xd1,0x04,0xb1,0x00,0x00,0x7c,0xd0,
-    0x00,0x00,0x00,0x36,0x47,0x50,0x4f,0x53,0xc8,0x42,
-    0xaa,0x57,0x00,0x00,0x7d,0x08,0x00,0x00,0x03,0x3a,
-    0x47,0x53,0x55,0x42,0x68,0x93,0x62,0x93,0x00,0x00,
-    0x80,0x44,0x00,0x00,0x00,0x1e,0x4f,0x53,0x2f,0x32,
-    0x7f,0x1c,0xcd,0x34,0x00,0x00,0x01,0x88,0x00,0x00,
-    0x00,0x60,0x63,0x6d,0x61,0x70,0x0a,0x98,0xec,0xca,
-    0x00,0x00,0x06,0xc4,0x00,0x00,0x03,0x56,0x67,0x61,
-    0x73,0x70,0x00,0x00,0x00,0x10,0x00,0x00,0x7c,0xac,
-    0x00,0x00,0x00,0x08,0x67,0x6c,0x79,0x66,0xef,0xde,
-    0xcd,0x13,0x00,0x00,0x0c,0x94,0x00,0x00,0x61,0x64,
-    0x68,0x65,0x61,0x64,0x02,0xea,0x24,0x85,0x00,0x00,
-    0x01,0x0c,0x00,0x00,0x00,0x36,0x68,0x68,0x65,0x61,
-    0x0e,0xf1,0x05,0x93,0x00,0x00,0x01,0x44,0x00,0x00,
-    0x00,0x24,0x68,0x6d,0x74,0x78,0x88,0x5f,0x5a,0xe2,
-    0x00,0x00,0x01,0xe8,0x00,0x00,0x04,0xdc,0x6c,0x6f,
-    0x63,0x61,0x42,0xdc,0x5b,0x10,0x00,0x00,0x0a,0x24,
-    0x00,0x00,0x02,0x70,0x6d,0x61,0x78,0x70,0x01,0x80,
-    0x00,0x49,0x00,0x00,0x01,0x68,0x00,0x00,0x00,0x20,
-    0x6e,0x61,0x6d,0x65,0x61,0x6e,0xb0,0xc4,0x00,0x00,
-    0x6d,0xf8,0x00,0x00,0x08,0xe8,0x70,0x6f,0x73,0x74,
-    0x38,0xa2,0xa4,0x31,0x00,0x00,0x76,0xe0,0x00,0x00,
-    0x05,0xca,0x70,0x72,0x65,0x70,0x68,0x06,0x8c,0x85,
-    0x00,0x00,0x0a,0x1c,0x00,0x00,0x00,0x07,0x00,0x01,
-    0x00,0x00,0x00,0x02,0x00,0x41,0xc4,0xb8,0xc0,0x2c,
-    0x5f,0x0f,0x3c,0xf5,0x02,0x09,0x08,0x00,0x00,0x00,
-    0x00,0x00,0xcd,0xac,0x5d,0x6c,0x00,0x00,0x00,0x00,
-    0xcd,0xc0,0x7c,0x56,0xfe,0xb3,0xfe,0x12,0x07,0xae,
-    0x07,0x73,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x08,0x8d,
-    0xfd,0xa8,0x00,0x00,0x08,0x00,0xfe,0xb3,0xfe,0xb3,
-    0x07,0xae,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x37,
-    0x00,0x01,0x00,0x00,0x01,0x37,0x00,0x46,0x00,0x07,
-    0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,
-    0x00,0x01,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x03,0x03,0x1b,0x01,0x2c,0x00,0x03,
-    0x00,0x00,0x05,0x33,0x04,0xcc,0x00,0x00,0x00,0x99,
-    0x05,0x33,0x04,0xcc,0x00,0x00,0x02,0xcc,0x00,0x32,
-    0x02,0x9e,0x00,0x00,0x00,0x00,0x04,0x06,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x03,0x40,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x55,0x4b,0x57,0x4e,0x00,0x00,0x00,0x0d,0xfb,0x4b,
-    0x06,0x1f,0xfe,0x14,0x00,0x84,0x08,0x8d,0x02,0x58,
-    0x20,0x00,0x00,0x21,0x00,0x00,0x00,0x00,0x04,0x3d,
-    0x05,0xb6,0x00,0x00,0x00,0x20,0x00,0x04,0x02,0x14,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xaa,0x00,0x00,
-    0x02,0x14,0x00,0x00,0x01,0x81,0x00,0x00,0x01,0xc3,
-    0x00,0x93,0x02,0xae,0x00,0x85,0x03,0x64,0x00,0x25,
-    0x03,0x33,0x00,0x5e,0x04,0xb8,0x00,0x5e,0x03,0x42,
-    0x00,0x42,0x01,0x85,0x00,0x85,0x02,0x35,0x00,0x68,
-    0x02,0x35,0x00,0x54,0x02,0xe9,0x00,0x5e,0x03,0x33,
-    0x00,0x3b,0x01,0xa6,0x00,0x4e,0x02,0x04,0x00,0x35,
-    0x01,0xa6,0x00,0x85,0x02,0xc9,0x00,0x33,0x03,0x33,
-    0x00,0x58,0x03,0x33,0x00,0x96,0x03,0x33,0x00,0x4a,
-    0x03,0x33,0x00,0x4c,0x03,0x33,0x00,0x25,0x03,0x33,
-    0x00,0x62,0x03,0x33,0x00,0x64,0x03,0x33,0x00,0x39,
-    0x03,0x33,0x00,0x48,0x03,0x33,0x00,0x52,0x01,0xa6,
-    0x00,0x85,0x01,0xa6,0x00,0x4e,0x03,0x33,0x00,0x3b,
-    0x03,0x33,0x00,0x3b,0x03,0x33,0x00,0x39,0x02,0x42,
-    0x00,0x23,0x04,0xd1,0x00,0x6e,0x03,0x2d,0x00,0x00,
-    0x03,0x8b,0x00,0xa0,0x03,0x5c,0x00,0x6e,0x03,0xe2,
-    0x00,0xa0,0x03,0x14,0x00,0xa0,0x02,0xd9,0x00,0xa0,
-    0x04,0x33,0x00,0x6f,0x04,0x02,0x00,0xa0,0x01,0xa2,
-    0x00,0xa0,0x01,0x91,0xff,0xa6,0x03,0x39,0x00,0xa0,
-    0x02,0xc7,0x00,0xa0,0x05,0x73,0x00,0xa0,0x04,0x42,
-    0x00,0xa0,0x04,0x29,0x00,0x6f,0x03,0x48,0x00,0xa0,
-    0x04,0x29,0x00,0x6f,0x03,0x66,0x00,0xa0,0x03,0x29,
-    0x00,0x56,0x02,0xc7,0x00,0x0e,0x03,0xf4,0x00,0x93,
-    0x03,0x1f,0x00,0x00,0x05,0x73,0x00,0x0a,0x02,0xcb,
-    0x00,0x14,0x02,0xae,0x00,0x00,0x02,0x83,0x00,0x39,
-    0x02,0x85,0x00,0xae,0x02,0xc9,0x00,0x33,0x02,0x85,
-    0x00,0x4a,0x03,0x33,0x00,0x25,0x03,0x4a,0xff,0xfc,
-    0x04,0x66,0x01,0xb2,0x03,0x10,0x00,0x4e,0x03,0x7d,
-    0x00,0x91,0x02,0x7b,0x00,0x60,0x03,0x7d,0x00,0x5e,
-    0x03,0x23,0x00,0x60,0x01,0xc5,0x00,0x14,0x02,0xe5,
-    0x00,0x23,0x03,0x66,0x00,0x91,0x01,0x81,0x00,0x83,
-    0x01,0x81,0xff,0xfc,0x02,0xc7,0x00,0x91,0x01,0x81,
-    0x00,0x91,0x05,0x17,0x00,0x91,0x03,0x66,0x00,0x91,
-    0x03,0x52,0x00,0x5e,0x03,0x7d,0x00,0x91,0x03,0x7d,
-    0x00,0x5e,0x02,0x2f,0x00,0x91,0x02,0x85,0x00,0x4a,
-    0x01,0xc1,0x00,0x2b,0x03,0x66,0x00,0x8d,0x02,0x8d,
-    0x00,0x0a,0x04,0x64,0x00,0x14,0x02,0xa4,0x00,0x23,
-    0x02,0x8d,0xff,0xfe,0x02,0x1d,0x00,0x3b,0x02,0xe1,
-    0x00,0x6d,0x03,0x33,0x01,0x6a,0x02,0xe1,0x00,0x68,
-    0x03,0x33,0x00,0x3b,0x02,0x14,0x00,0x00,0x01,0xc3,
-    0x00,0x93,0x03,0x33,0x00,0xa8,0x03,0x33,0x00,0x50,
-    0x04,0x6f,0x00,0x7d,0x03,0x33,0x00,0x6a,0x03,0x33,
-    0x01,0x6a,0x02,0xba,0x00,0x52,0x04,0x66,0x01,0x5c,
-    0x06,0xa8,0x00,0x64,0x02,0x42,0x00,0x39,0x03,0x58,
-    0x00,0x52,0x03,0x33,0x00,0x3b,0x02,0x04,0x00,0x35,
-    0x06,0xa8,0x00,0x64,0x03,0x4a,0xff,0xf8,0x03,0x6d,
-    0x00,0x8b,0x03,0x33,0x00,0x3b,0x02,0x66,0x00,0x31,
-    0x02,0x66,0x00,0x2f,0x04,0x66,0x01,0xb2,0x03,0x6a,
-    0x00,0x91,0x03,0xc7,0x00,0x96,0x01,0xa6,0x00,0x85,
-    0x01,0xd1,0x00,0x3b,0x02,0x66,0x00,0x52,0x02,0x6a,
-    0x00,0x46,0x03,0x58,0x00,0x52,0x05,0x96,0x00,0x34,
-    0x05,0x96,0x00,0x34,0x05,0x96,0x00,0x2f,0x02,0x42,
-    0x00,0x2f,0x03,0x2d,0x00,0x00,0x03,0x2d,0x00,0x00,
-    0x03,0x2d,0x00,0x00,0x03,0x2d,0x00,0x00,0x03,0x2d,
-    0x00,0x00,0x03,0x2d,0x00,0x00,0x04,0x81,0x00,0x00,
-    0x03,0x5c,0x00,0x6e,0x03,0x14,0x00,0xa0,0x03,0x14,
-    0x00,0xa0,0x03,0x14,0x00,0xa0,0x03,0x14,0x00,0xa0,
-    0x01,0xa2,0xff,0xde,0x01,0xa2,0x00,0x9a,0x01,0xa2,
-    0xff,0xe6,0x01,0xa2,0xff,0xfb,0x03,0xe2,0x00,0x3d,
-    0x04,0x42,0x00,0xa0,0x04,0x29,0x00,0x6f,0x04,0x29,
-    0x00,0x6f,0x04,0x29,0x00,0x6f,0x04,0x29,0x00,0x6f,
-    0x04,0x29,0x00,0x6f,0x03,0x33,0x00,0x3b,0x04,0x29,
-    0x00,0x60,0x03,0xf4,0x00,0x93,0x03,0xf4,0x00,0x93,
-    0x03,0xf4,0x00,0x93,0x03,0xf4,0x00,0x93,0x02,0xae,
-    0x00,0x00,0x03,0x48,0x00,0xa0,0x03,0x37,0x00,0x91,
-    0x03,0x10,0x00,0x4e,0x03,0x10,0x00,0x4e,0x03,0x10,
-    0x00,0x4e,0x03,0x10,0x00,0x4e,0x03,0x10,0x00,0x4e,
-    0x03,0x10,0x00,0x4e,0x04,0xec,0x00,0x4e,0x02,0x7b,
-    0x00,0x60,0x03,0x23,0x00,0x60,0x03,0x23,0x00,0x60,
-    0x03,0x23,0x00,0x60,0x03,0x23,0x00,0x60,0x01,0x81,
-    0xff,0xe0,0x01,0x81,0x00,0x71,0x01,0x81,0xff,0xd6,
-    0x01,0x81,0xff,0xec,0x03,0x58,0x00,0x5e,0x03,0x66,
-    0x00,0x91,0x03,0x52,0x00,0x5e,0x03,0x52,0x00,0x5e,
-    0x03,0x52,0x00,0x5e,0x03,0x52,0x00,0x5e,0x03,0x52,
-    0x00,0x5e,0x03,0x33,0x00,0x3b,0x03,0x52,0x00,0x44,
-    0x03,0x66,0x00,0x8d,0x03,0x66,0x00,0x8d,0x03,0x66,
-    0x00,0x8d,0x03,0x66,0x00,0x8d,0x02,0x8d,0xff,0xfe,
-    0x03,0x7d,0x00,0x91,0x02,0x8d,0xff,0xfe,0x01,0x81,
-    0x00,0x91,0x04,0xd1,0x00,0x6f,0x05,0x52,0x00,0x5e,
-    0x03,0x29,0x00,0x56,0x02,0x85,0x00,0x4a,0x02,0xae,
-    0x00,0x00,0x02,0x83,0x00,0x39,0x02,0x1d,0x00,0x32,
-    0x03,0x33,0x00,0x50,0x04,0x85,0x01,0x56,0x04,0x85,
-    0x01,0x56,0x04,0x85,0x01,0x68,0x01,0x81,0x00,0x83,
-    0x04,0x9e,0x01,0x89,0x01,0x7f,0x00,0x44,0x04,0x85,
-    0x01,0x29,0x04,0x89,0x01,0x21,0x00,0x00,0xff,0xc4,
-    0x00,0x00,0xfe,0xb3,0x00,0x00,0xfe,0xe1,0x00,0x00,
-    0xfe,0xe1,0x00,0x00,0xff,0xc3,0x00,0x00,0xff,0x33,
-    0x00,0x00,0xff,0x35,0x00,0x00,0xff,0x4e,0x00,0x00,
-    0xff,0x4e,0x00,0x00,0xff,0xc3,0x00,0x00,0xff,0xc4,
-    0x00,0x00,0xff,0x35,0x00,0x00,0xff,0xc3,0x00,0x00,
-    0xff,0xd3,0x02,0x04,0x00,0x35,0x00,0x00,0xff,0xc3,
-    0x00,0x00,0xff,0xc2,0x00,0x00,0xff,0x6e,0x03,0x09,
-    0x00,0x48,0x02,0xec,0x00,0x5e,0x02,0x90,0x00,0x73,
-    0x02,0xa6,0x00,0x11,0x03,0x94,0x00,0x91,0x01,0x81,
-    0x00,0x91,0x01,0xab,0x00,0x87,0x03,0x94,0x00,0x91,
-    0x03,0x74,0x00,0x5f,0x01,0x77,0x00,0x8c,0x02,0xa8,
-    0x00,0x29,0x02,0x7b,0x00,0x29,0x02,0x5e,0x00,0x2d,
-    0x03,0x93,0x00,0x91,0x03,0x5b,0x00,0x3b,0x01,0x90,
-    0x00,0x73,0x02,0x39,0x00,0x27,0x03,0x74,0x00,0x5e,
-    0x03,0x4e,0x00,0x48,0x03,0x90,0x00,0x5e,0x03,0x62,
-    0x00,0x5e,0x02,0x6f,0x00,0x00,0x02,0xf3,0x00,0x3b,
-    0x03,0x55,0x00,0x91,0x02,0x9c,0x00,0x17,0x04,0x18,
-    0x00,0x4a,0x03,0x7a,0x00,0x10,0x01,0x3c,0x00,0x2b,
-    0x02,0x56,0x00,0x2b,0x04,0x00,0x00,0x52,0x08,0x00,
-    0x00,0x52,0x01,0x3b,0x00,0x2b,0x01,0x3b,0x00,0x2b,
-    0x01,0xa6,0x00,0x4e,0x02,0x56,0x00,0x2b,0x02,0x56,
-    0x00,0x2b,0x02,0x93,0x00,0x21,0x03,0x73,0x00,0x7b,
-    0x03,0x73,0x00,0x7b,0x03,0x02,0x00,0xa8,0x04,0xf2,
-    0x00,0x85,0x06,0xb6,0x00,0x5e,0x02,0x00,0x00,0x52,
-    0x02,0x00,0x00,0x52,0x01,0x0a,0xfe,0xd7,0x04,0x6b,
-    0x00,0x91,0x03,0x33,0x00,0x23,0x05,0xac,0x00,0x0e,
-    0x03,0x46,0x00,0x14,0x03,0x46,0x00,0x14,0x04,0x18,
-    0x00,0x4a,0x04,0x18,0x00,0x2e,0x04,0x18,0x00,0x4a,
-    0x04,0x18,0x00,0x2e,0x03,0x09,0x00,0x48,0x03,0x09,
-    0x00,0x48,0x03,0x09,0x00,0x48,0x02,0xec,0x00,0x5e,
-    0x02,0x90,0x00,0x73,0x02,0xa6,0x00,0x11,0x03,0x94,
-    0x00,0x91,0x01,0x81,0xff,0xcc,0x01,0xab,0xff,0xec,
-    0x03,0x74,0x00,0x5f,0x01,0x77,0xff,0xca,0x02,0xa8,
-    0x00,0x29,0x02,0x7b,0x00,0x29,0x02,0x5e,0x00,0x2d,
-    0x03,0x5b,0x00,0x3b,0x02,0x39,0x00,0x27,0x03,0x74,
-    0x00,0x5e,0x03,0x90,0x00,0x5e,0x03,0x62,0x00,0x5e,
-    0x02,0xf3,0x00,0x3b,0x03,0x55,0x00,0x91,0x02,0x9c,
-    0x00,0x17,0x04,0x18,0x00,0x4a,0x03,0x7a,0x00,0x10,
-    0x01,0x81,0x00,0x67,0x00,0x00,0xff,0x15,0x01,0x81,
-    0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x03,
-    0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x01,0x4c,0x00,0x03,0x00,0x01,0x00,0x00,0x00,0x1c,
-    0x00,0x04,0x01,0x30,0x00,0x00,0x00,0x48,0x00,0x40,
-    0x00,0x05,0x00,0x08,0x00,0x0d,0x00,0x7e,0x00,0xa0,
-    0x00,0xff,0x01,0x31,0x01,0x53,0x01,0x61,0x01,0x78,
-    0x01,0x7e,0x01,0x92,0x02,0xc7,0x02,0xdd,0x05,0xbe,
-    0x05,0xc2,0x05,0xc7,0x05,0xea,0x05,0xf4,0x20,0x14,
-    0x20,0x1a,0x20,0x1e,0x20,0x22,0x20,0x26,0x20,0x30,
-    0x20,0x3a,0x20,0x44,0x20,0xaa,0x20,0xac,0x21,0x22,
-    0xfb,0x02,0xfb,0x36,0xfb,0x3c,0xfb,0x3e,0xfb,0x41,
-    0xfb,0x44,0xfb,0x4b,0xff,0xff,0x00,0x00,0x00,0x0d,
-    0x00,0x20,0x00,0xa0,0x00,0xa1,0x01,0x31,0x01,0x52,
-    0x01,0x60,0x01,0x78,0x01,0x7d,0x01,0x92,0x02,0xc6,
-    0x02,0xd8,0x05,0xb0,0x05,0xc1,0x05,0xc7,0x05,0xd0,
-    0x05,0xf3,0x20,0x13,0x20,0x18,0x20,0x1c,0x20,0x20,
-    0x20,0x26,0x20,0x30,0x20,0x39,0x20,0x44,0x20,0xaa,
-    0x20,0xac,0x21,0x22,0xfb,0x01,0xfb,0x2a,0xfb,0x38,
-    0xfb,0x3e,0xfb,0x40,0xfb,0x43,0xfb,0x46,0xff,0xff,
-    0xff,0xf6,0xff,0xe4,0x00,0x96,0xff,0xc3,0xff,0x92,
-    0xff,0x72,0xff,0x66,0xff,0x50,0xff,0x4c,0xff,0x39,
-    0xfe,0x06,0xfd,0xf6,0xfb,0x24,0xfb,0x22,0xfb,0x1e,
-    0xfb,0x16,0xfb,0x0e,0xe0,0xf0,0xe0,0xed,0xe0,0xec,
-    0xe0,0xeb,0xe0,0xe8,0xe0,0xdf,0xe0,0xd7,0xe0,0xce,
-    0xe0,0x69,0xe0,0x68,0xdf,0xf3,0x06,0x15,0x05,0xee,
-    0x05,0xed,0x05,0xec,0x05,0xeb,0x05,0xea,0x05,0xe9,
-    0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x06,0x02,0x0a,0x00,0x00,
-    0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x04,
-    0x00,0x05,0x00,0x06,0x00,0x07,0x00,0x08,0x00,0x09,
-    0x00,0x0a,0x00,0x0b,0x00,0x0c,0x00,0x0d,0x00,0x0e,
-    0x00,0x0f,0x00,0x10,0x00,0x11,0x00,0x12,0x00,0x13,
-    0x00,0x14,0x00,0x15,0x00,0x16,0x00,0x17,0x00,0x18,
-    0x00,0x19,0x00,0x1a,0x00,0x1b,0x00,0x1c,0x00,0x1d,
-    0x00,0x1e,0x00,0x1f,0x00,0x20,0x00,0x21,0x00,0x22,
-    0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,
-    0x00,0x28,0x00,0x29,0x00,0x2a,0x00,0x2b,0x00,0x2c,
-    0x00,0x2d,0x00,0x2e,0x00,0x2f,0x00,0x30,0x00,0x31,
-    0x00,0x32,0x00,0x33,0x00,0x34,0x00,0x35,0x00,0x36,
-    0x00,0x37,0x00,0x38,0x00,0x39,0x00,0x3a,0x00,0x3b,
-    0x00,0x3c,0x00,0x3d,0x00,0x3e,0x00,0x3f,0x00,0x40,
-    0x00,0x41,0x00,0x42,0x00,0x43,0x00,0x44,0x00,0x45,
-    0x00,0x46,0x00,0x47,0x00,0x48,0x00,0x49,0x00,0x4a,
-    0x00,0x4b,0x00,0x4c,0x00,0x4d,0x00,0x4e,0x00,0x4f,
-    0x00,0x50,0x00,0x51,0x00,0x52,0x00,0x53,0x00,0x54,
-    0x00,0x55,0x00,0x56,0x00,0x57,0x00,0x58,0x00,0x59,
-    0x00,0x5a,0x00,0x5b,0x00,0x5c,0x00,0x5d,0x00,0x5e,
-    0x00,0x5f,0x00,0x60,0x00,0x61,0x00,0x62,0x00,0x00,
-    0x00,0x87,0x00,0x88,0x00,0x8a,0x00,0x8c,0x00,0x94,
-    0x00,0x99,0x00,0x9f,0x00,0xa4,0x00,0xa3,0x00,0xa5,
-    0x00,0xa7,0x00,0xa6,0x00,0xa8,0x00,0xaa,0x00,0xac,
-    0x00,0xab,0x00,0xad,0x00,0xae,0x00,0xb0,0x00,0xaf,
-    0x00,0xb1,0x00,0xb2,0x00,0xb4,0x00,0xb6,0x00,0xb5,
-    0x00,0xb7,0x00,0xb9,0x00,0xb8,0x00,0xbd,0x00,0xbc,
-    0x00,0xbe,0x00,0xbf,0x01,0x0b,0x00,0x73,0x00,0x65,
-    0x00,0x66,0x00,0x6a,0x01,0x0d,0x00,0x79,0x00,0xa2,
-    0x00,0x71,0x00,0x6c,0x01,0x15,0x00,0x77,0x00,0x6b,
-    0x00,0x00,0x00,0x89,0x00,0x9b,0x00,0x00,0x00,0x74,
-    0x00,0x00,0x00,0x00,0x00,0x68,0x00,0x78,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6d,
-    0x00,0x7d,0x00,0x00,0x00,0xa9,0x00,0xbb,0x00,0x82,
-    0x00,0x64,0x00,0x6f,0x00,0x00,0x00,0xcb,0x00,0x00,
-    0x00,0x00,0x00,0x6e,0x00,0x7e,0x01,0x0e,0x01,0x36,
-    0x00,0x83,0x00,0x86,0x00,0x98,0x00,0xc4,0x00,0xc5,
-    0x01,0x03,0x01,0x04,0x01,0x08,0x01,0x09,0x01,0x05,
-    0x01,0x06,0x00,0xba,0x00,0x00,0x00,0xc2,0x00,0xc8,
-    0x01,0x12,0x01,0x14,0x01,0x10,0x01,0x11,0x01,0x16,
-    0x01,0x17,0x01,0x0c,0x00,0x7a,0x01,0x07,0x01,0x0a,
-    0x01,0x0f,0x00,0x85,0x00,0x8d,0x00,0x84,0x00,0x8e,
-    0x00,0x8b,0x00,0x90,0x00,0x91,0x00,0x92,0x00,0x8f,
-    0x00,0x96,0x00,0x97,0x00,0x00,0x00,0x95,0x00,0x9d,
-    0x00,0x9e,0x00,0x9c,0x00,0xc3,0x00,0xcc,0x00,0xd2,
-    0x00,0x72,0x00,0xce,0x00,0xcf,0x00,0xd0,0x00,0x7b,
-    0x00,0xd3,0x00,0xd1,0x00,0xcd,0x00,0x00,0xb8,0x01,
-    0xff,0x85,0xb0,0x04,0x8d,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,
-    0x00,0x2e,0x00,0x66,0x00,0xac,0x00,0xf2,0x01,0x3e,
-    0x01,0x4c,0x01,0x68,0x01,0x84,0x01,0xa2,0x01,0xba,
-    0x01,0xcc,0x01,0xda,0x01,0xea,0x01,0xf8,0x02,0x1e,
-    0x02,0x36,0x02,0x64,0x02,0x9c,0x02,0xc0,0x02,0xec,
-    0x03,0x22,0x03,0x36,0x03,0x7a,0x03,0xb4,0x03,0xce,
-    0x03,0xea,0x04,0x00,0x04,0x14,0x04,0x28,0x04,0x5c,
-    0x04,0xc2,0x04,0xe4,0x05,0x18,0x05,0x48,0x05,0x6a,
-    0x05,0x84,0x05,0x9a,0x05,0xc4,0x05,0xdc,0x05,0xe8,
-    0x06,0x00,0x06,0x1e,0x06,0x2e,0x06,0x58,0x06,0x76,
-    0x06,0x9e,0x06,0xbe,0x06,0xee,0x07,0x16,0x07,0x4e,
-    0x07,0x62,0x07,0x80,0x07,0x9a,0x07,0xc8,0x07,0xe6,
-    0x07,0xfc,0x08,0x14,0x08,0x28,0x08,0x36,0x08,0x4a,
-    0x08,0x5e,0x08,0x6c,0x08,0x82,0x08,0xb8,0x08,0xe8,
-    0x09,0x0a,0x09,0x38,0x09,0x62,0x09,0x86,0x09,0xde,
-    0x0a,0x04,0x0a,0x1e,0x0a,0x44,0x0a,0x62,0x0a,0x6e,
-    0x0a,0xa0,0x0a,0xc2,0x0a,0xe4,0x0b,0x16,0x0b,0x44,
-    0x0b,0x66,0x0b,0x98,0x0b,0xba,0x0b,0xde,0x0b,0xf8,
-    0x0c,0x28,0x0c,0x44,0x0c,0x6e,0x0c,0x86,0x0c,0xbc,
-    0x0c,0xca,0x0d,0x00,0x0d,0x22,0x0d,0x22,0x0d,0x3a,
-    0x0d,0x62,0x0d,0x92,0x0d,0xd6,0x0d,0xfc,0x0e,0x10,
-    0x0e,0x60,0x0e,0x80,0x0e,0xd2,0x0f,0x04,0x0f,0x28,
-    0x0f,0x38,0x0f,0x46,0x0f,0x9a,0x0f,0xa8,0x0f,0xca,
-    0x0f,0xea,0x10,0x10,0x10,0x40,0x10,0x54,0x10,0x7a,
-    0x10,0x96,0x10,0xa6,0x10,0xc6,0x10,0xde,0x10,0xfe,
-    0x11,0x20,0x11,0x5a,0x11,0x98,0x11,0xea,0x12,0x1e,
-    0x12,0x50,0x12,0x80,0x12,0xbc,0x12,0xfc,0x13,0x36,
-    0x13,0x70,0x13,0x98,0x13,0xdc,0x14,0x04,0x14,0x2c,
-    0x14,0x60,0x14,0x92,0x14,0xae,0x14,0xca,0x14,0xf2,
-    0x15,0x18,0x15,0x42,0x15,0x80,0x15,0xb8,0x15,0xee,
-    0x16,0x30,0x16,0x76,0x16,0xb6,0x16,0xd8,0x17,0x16,
-    0x17,0x44,0x17,0x70,0x17,0xa8,0x17,0xde,0x18,0x04,
-    0x18,0x2a,0x18,0x66,0x18,0xaa,0x18,0xee,0x19,0x3e,
-    0x19,0x92,0x19,0xe0,0x1a,0x2e,0x1a,0x7e,0x1a,0xb6,
-    0x1a,0xf0,0x1b,0x28,0x1b,0x6e,0x1b,0xb0,0x1b,0xcc,
-    0x1b,0xe8,0x1c,0x10,0x1c,0x36,0x1c,0x72,0x1c,0xb2,
-    0x1c,0xe4,0x1d,0x14,0x1d,0x50,0x1d,0x90,0x1d,0xca,
-    0x1d,0xec,0x1e,0x28,0x1e,0x5c,0x1e,0x8e,0x1e,0xcc,
-    0x1f,0x08,0x1f,0x40,0x1f,0x76,0x1f,0xb8,0x1f,0xc4,
-    0x1f,0xf4,0x20,0x36,0x20,0x86,0x20,0xd0,0x21,0x00,
-    0x21,0x30,0x21,0x60,0x21,0x90,0x21,0xb2,0x21,0xd0,
-    0x21,0xe8,0x21,0xfa,0x22,0x1a,0x22,0x36,0x22,0x5c,
-    0x22,0x82,0x22,0x98,0x22,0xc6,0x22,0xe2,0x23,0x02,
-    0x23,0x10,0x23,0x26,0x23,0x44,0x23,0x52,0x23,0x62,
-    0x23,0x70,0x23,0x7e,0x23,0x9c,0x23,0xaa,0x23,0xb8,
-    0x23,0xc6,0x23,0xd4,0x23,0xe2,0x23,0xf2,0x24,0x24,
-    0x24,0x4c,0x24,0x78,0x24,0x9a,0x24,0xbe,0x24,0xca,
-    0x24,0xe4,0x25,0x02,0x25,0x2e,0x25,0x3e,0x25,0x56,
-    0x25,0x82,0x25,0x9c,0x25,0xc0,0x25,0xfe,0x26,0x14,
-    0x26,0x3a,0x26,0x6a,0x26,0x94,0x26,0xbc,0x26,0xf8,
-    0x27,0x1a,0x27,0x40,0x27,0x70,0x27,0x92,0x27,0xc6,
-    0x27,0xf6,0x28,0x0e,0x28,0x34,0x28,0x42,0x28,0x50,
-    0x28,0x62,0x28,0x74,0x28,0x86,0x28,0xa2,0x28,0xc0,
-    0x28,0xde,0x28,0xfa,0x29,0x28,0x29,0x3a,0x29,0x5c,
-    0x29,0xbc,0x29,0xd2,0x29,0xe6,0x29,0xf4,0x2a,0x32,
-    0x2a,0x6e,0x2a,0x9a,0x2a,0xd0,0x2a,0xfa,0x2b,0x38,
-    0x2b,0x76,0x2b,0xbc,0x2c,0x02,0x2c,0x3c,0x2c,0x78,
-    0x2c,0xb2,0x2c,0xe2,0x2d,0x16,0x2d,0x40,0x2d,0x6c,
-    0x2d,0x80,0x2d,0xa2,0x2d,0xd6,0x2d,0xee,0x2e,0x0e,
-    0x2e,0x42,0x2e,0x64,0x2e,0xaa,0x2e,0xd8,0x2f,0x10,
-    0x2f,0x40,0x2f,0x84,0x2f,0xb4,0x2f,0xee,0x30,0x18,
-    0x30,0x54,0x30,0x8e,0x30,0xa4,0x30,0xb2,0x30,0xb2,
-    0x00,0x02,0x00,0x93,0xff,0xf0,0x01,0x2f,0x05,0xb6,
-    0x00,0x03,0x00,0x0a,0x00,0x00,0x13,0x23,0x03,0x33,
-    0x02,0x32,0x15,0x14,0x06,0x23,0x22,0xfc,0x37,0x23,
-    0x7d,0x8c,0x9c,0x2b,0x23,0x4e,0x01,0x6f,0x04,0x47,
-    0xfb,0x0f,0x6b,0x36,0x34,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x85,0x03,0xa6,0x02,0x29,0x05,0xb6,0x00,0x03,
-    0x00,0x07,0x00,0x00,0x13,0x23,0x03,0x33,0x01,0x23,
-    0x03,0x33,0xe3,0x3d,0x21,0x7b,0x01,0x0c,0x3d,0x21,
-    0x7b,0x03,0xa6,0x02,0x10,0xfd,0xf0,0x02,0x10,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x25,0x00,0x00,0x03,0x3d,
-    0x05,0xb6,0x00,0x1b,0x00,0x1f,0x00,0x00,0x01,0x15,
-    0x23,0x03,0x33,0x15,0x23,0x03,0x23,0x13,0x23,0x03,
-    0x23,0x13,0x23,0x35,0x33,0x13,0x23,0x35,0x33,0x13,
-    0x33,0x03,0x33,0x13,0x33,0x03,0x05,0x03,0x33,0x13,
-    0x03,0x3d,0xb0,0x2d,0xae,0xb8,0x35,0x52,0x37,0xe9,
-    0x36,0x4d,0x33,0xa8,0xb2,0x2d,0xb2,0xbc,0x2f,0x52,
-    0x31,0xec,0x31,0x4c,0x2f,0xfe,0xbc,0x2d,0xe9,0x2f,
-    0x04,0x12,0x56,0xfe,0x71,0x5a,0xfe,0x2d,0x01,0xd3,
-    0xfe,0x2d,0x01,0xd3,0x5a,0x01,0x8f,0x56,0x01,0xa4,
-    0xfe,0x5c,0x01,0xa4,0xfe,0x5c,0x56,0xfe,0x71,0x01,
-    0x8f,0x00,0x00,0x00,0x00,0x03,0x00,0x5e,0xff,0x89,
-    0x02,0xd7,0x06,0x14,0x00,0x1c,0x00,0x23,0x00,0x2a,
-    0x00,0x00,0x01,0x15,0x16,0x17,0x07,0x26,0x27,0x11,
-    0x16,0x16,0x14,0x06,0x07,0x15,0x23,0x35,0x22,0x27,
-    0x35,0x16,0x16,0x33,0x11,0x26,0x26,0x34,0x36,0x37,
-    0x35,0x11,0x06,0x06,0x14,0x17,0x16,0x17,0x13,0x36,
-    0x34,0x26,0x27,0x11,0x36,0x01,0xc1,0x8d,0x75,0x25,
-    0x75,0x68,0x96,0x80,0x97,0x7f,0x52,0xaf,0x62,0x33,
-    0x95,0x49,0x92,0x75,0x92,0x75,0x49,0x5d,0x27,0x29,
-    0x56,0xd5,0x31,0x54,0x60,0x51,0x06,0x14,0xb6,0x05,
-    0x38,0x56,0x36,0x03,0xfe,0x04,0x3d,0x9a,0xf1,0xaa,
-    0x15,0xf8,0xf2,0x35,0x67,0x1e,0x22,0x01,0xee,0x3c,
-    0x9b,0xfa,0xb0,0x14,0xba,0xfe,0xea,0x10,0x7c,0xb2,
-    0x37,0x36,0x2a,0xfe,0x04,0x3b,0xa3,0x70,0x29,0xfe,
-    0x3b,0x13,0x00,0x00,0x00,0x05,0x00,0x5e,0xff,0xec,
-    0x04,0x5a,0x05,0xcb,0x00,0x07,0x00,0x0b,0x00,0x15,
-    0x00,0x1d,0x00,0x27,0x00,0x00,0x12,0x36,0x32,0x16,
-    0x10,0x06,0x22,0x26,0x01,0x23,0x01,0x33,0x05,0x22,
-    0x06,0x10,0x16,0x33,0x32,0x36,0x35,0x10,0x00,0x36,
-    0x32,0x16,0x10,0x06,0x22,0x26,0x13,0x22,0x06,0x10,
-    0x16,0x33,0x32,0x36,0x35,0x10,0x5e,0x66,0xc7,0x69,
-    0x6c,0xc3,0x67,0x01,0x3c,0x58,0x01,0xdb,0x58,0xfd,
-    0xb0,0x3a,0x33,0x34,0x3d,0x3b,0x36,0x01,0x2b,0x66,
-    0xc6,0x69,0x6c,0xc2,0x67,0xc6,0x3a,0x32,0x33,0x3d,
-    0x3b,0x36,0x04,0xe1,0xea,0xe9,0xfe,0x45,0xf2,0xee,
-    0xfc,0xdd,0x05,0xb6,0x39,0xb7,0xfe,0x7b,0xb8,0xb9,
-    0xc2,0x01,0x79,0xfd,0x1e,0xe6,0xe9,0xfe,0x43,0xef,
-    0xf0,0x02,0x57,0xb7,0xfe,0x7b,0xb8,0xb9,0xc2,0x01,
-    0x79,0x00,0x00,0x00,0x00,0x03,0x00,0x42,0xff,0xec,
-    0x03,0x44,0x05,0xcb,0x00,0x1b,0x00,0x25,0x00,0x2d,
-    0x00,0x00,0x05,0x22,0x26,0x10,0x37,0x36,0x37,0x26,
-    0x26,0x34,0x36,0x32,0x16,0x10,0x06,0x07,0x13,0x36,
-    0x35,0x33,0x14,0x06,0x07,0x13,0x23,0x27,0x06,0x06,
-    0x03,0x22,0x06,0x14,0x16,0x17,0x36,0x36,0x35,0x34,
-    0x02,0x06,0x14,0x16,0x32,0x36,0x37,0x03,0x01,0x48,
-    0x7a,0x8c,0x57,0x2b,0x59,0x4b,0x2c,0x68,0xb5,0x68,
-    0x4b,0x59,0xec,0x39,0x5e,0x3a,0x28,0x9c,0x6d,0x62,
-    0x4b,0x89,0x3d,0x2e,0x32,0x32,0x26,0x3e,0x33,0xe7,
-    0x44,0x5e,0x98,0x76,0x36,0xfe,0x14,0xc5,0x01,0x5f,
-    0x7a,0x3e,0x4c,0x8c,0xa7,0xf0,0x94,0x98,0xfe,0xef,
-    0xc3,0x59,0xfe,0x5a,0x76,0xaf,0x5d,0xde,0x46,0xfe,
-    0xfc,0xb2,0x70,0x56,0x05,0x85,0x67,0xb7,0xc2,0x3f,
-    0x3f,0xa8,0x71,0xc7,0xfd,0x02,0x9c,0xfa,0x93,0x5c,
-    0x60,0x01,0xc7,0x00,0x00,0x00,0x00,0x01,0x00,0x85,
-    0x03,0xa6,0x01,0x00,0x05,0xb6,0x00,0x03,0x00,0x00,
-    0x13,0x23,0x03,0x33,0xe3,0x3d,0x21,0x7b,0x03,0xa6,
-    0x02,0x10,0x00,0x00,0x00,0x01,0x00,0x68,0xfe,0xbc,
-    0x01,0xe1,0x05,0xb6,0x00,0x0b,0x00,0x00,0x01,0x06,
-    0x02,0x10,0x12,0x17,0x23,0x26,0x02,0x10,0x12,0x37,
-    0x01,0xe1,0x87,0x89,0x91,0x7d,0x4e,0x90,0x99,0x9c,
-    0x8d,0x05,0xb6,0xc8,0xfe,0x33,0xfe,0x1f,0xfe,0x28,
-    0xac,0xa8,0x01,0xcc,0x02,0x03,0x01,0xd8,0xab,0x00,
-    0x00,0x01,0x00,0x54,0xfe,0xbc,0x01,0xcd,0x05,0xb6,
-    0x00,0x0b,0x00,0x00,0x13,0x16,0x12,0x10,0x02,0x07,
-    0x23,0x36,0x12,0x10,0x02,0x27,0xa4,0x90,0x99,0x9a,
-    0x8f,0x4e,0x80,0x8e,0x8b,0x85,0x05,0xb6,0xab,0xfe,
-    0x25,0xfe,0x01,0xfe,0x31,0xa6,0xb5,0x01,0xd6,0x01,
-    0xdd,0x01,0xcc,0xc6,0x00,0x00,0x00,0x01,0x00,0x5e,
-    0x03,0xcf,0x02,0x8b,0x06,0x14,0x00,0x0e,0x00,0x00,
-    0x01,0x37,0x17,0x07,0x17,0x07,0x27,0x07,0x27,0x37,
-    0x27,0x37,0x17,0x27,0x33,0x01,0x96,0xe7,0x0e,0xe3,
-    0x9c,0x61,0x6c,0x75,0x5c,0x95,0xdd,0x11,0xe5,0x1b,
-    0x79,0x05,0x1b,0x39,0x6b,0x08,0xe3,0x2d,0xed,0xef,
-    0x2f,0xe3,0x06,0x6b,0x37,0xf9,0x00,0x01,0x00,0x3b,
-    0x00,0xfa,0x02,0xf8,0x04,0xae,0x00,0x0b,0x00,0x00,
-    0x01,0x21,0x15,0x21,0x11,0x23,0x11,0x21,0x35,0x21,
-    0x11,0x33,0x01,0xc3,0x01,0x35,0xfe,0xcb,0x52,0xfe,
-    0xca,0x01,0x36,0x52,0x02,0xfc,0x52,0xfe,0x50,0x01,
-    0xb0,0x52,0x01,0xb2,0x00,0x01,0x00,0x4e,0xfe,0xf8,
-    0x01,0x33,0x00,0xcd,0x00,0x06,0x00,0x00,0x25,0x17,
-    0x06,0x07,0x23,0x36,0x37,0x01,0x25,0x0e,0x43,0x63,
-    0x3f,0x4a,0x1a,0xcd,0x17,0xe5,0xd9,0xfc,0xd9,0x00,
-    0x00,0x01,0x00,0x35,0x01,0xf6,0x01,0xcf,0x02,0x5c,
-    0x00,0x03,0x00,0x00,0x01,0x21,0x35,0x21,0x01,0xcf,
-    0xfe,0x66,0x01,0x9a,0x01,0xf6,0x66,0x00,0x00,0x01,
-    0x00,0x85,0xff,0xf0,0x01,0x21,0x00,0xc5,0x00,0x06,
-    0x00,0x00,0x36,0x32,0x15,0x14,0x06,0x23,0x22,0x85,
-    0x9c,0x2b,0x23,0x4e,0xc5,0x6b,0x36,0x34,0x00,0x00,
-    0x00,0x01,0x00,0x33,0x00,0x00,0x02,0xa2,0x05,0xb6,
-    0x00,0x03,0x00,0x00,0x33,0x23,0x01,0x33,0x98,0x65,
-    0x02,0x0f,0x60,0x05,0xb6,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x58,0xff,0xec,0x02,0xd9,0x05,0xcb,0x00,0x09,
-    0x00,0x11,0x00,0x00,0x01,0x32,0x12,0x10,0x02,0x20,
-    0x27,0x26,0x11,0x10,0x05,0x22,0x02,0x10,0x12,0x33,
-    0x32,0x10,0x01,0x98,0xa5,0x9c,0xa2,0xfe,0xb9,0x4d,
-    0x4b,0x01,0x40,0x71,0x69,0x6a,0x70,0xdb,0x05,0xcb,
-    0xfe,0x8e,0xfd,0x10,0xfe,0x83,0xb0,0xb1,0x01,0x90,
-    0x02,0xee,0x5e,0xfe,0xbe,0xfd,0x65,0xfe,0xba,0x05,
-    0x23,0x00,0x00,0x00,0x00,0x01,0x00,0x96,0x00,0x00,
-    0x02,0x00,0x05,0xb6,0x00,0x0a,0x00,0x00,0x21,0x23,
-    0x11,0x34,0x37,0x06,0x07,0x07,0x27,0x01,0x33,0x02,
-    0x00,0x60,0x08,0x14,0x4e,0x7d,0x33,0x01,0x1a,0x50,
-    0x04,0x33,0x79,0xa2,0x1b,0x4e,0x72,0x3f,0x01,0x04,
-    0x00,0x00,0x00,0x01,0x00,0x4a,0x00,0x00,0x02,0xd9,
-    0x05,0xcb,0x00,0x1a,0x00,0x00,0x01,0x32,0x16,0x15,
-    0x14,0x07,0x06,0x07,0x01,0x15,0x21,0x15,0x21,0x35,
-    0x01,0x36,0x36,0x35,0x34,0x26,0x23,0x22,0x06,0x07,
-    0x27,0x36,0x36,0x01,0x79,0x97,0xa8,0x5e,0x2c,0x67,
-    0xfe,0xf3,0x02,0x1f,0xfd,0x71,0x01,0x27,0x86,0x5f,
-    0x7a,0x69,0x43,0x67,0x36,0x35,0x47,0x7e,0x05,0xcb,
-    0xbd,0x9f,0xcb,0xc2,0x5f,0x93,0xfe,0x72,0x08,0x5a,
-    0x4e,0x01,0xbe,0xcb,0xff,0x99,0x76,0x8c,0x27,0x2b,
-    0x4b,0x35,0x2c,0x00,0x00,0x01,0x00,0x4c,0xff,0xec,
-    0x02,0xcf,0x05,0xcb,0x00,0x24,0x00,0x00,0x01,0x32,
-    0x16,0x15,0x10,0x07,0x15,0x16,0x16,0x15,0x14,0x06,
-    0x20,0x27,0x35,0x16,0x33,0x32,0x36,0x10,0x26,0x23,
-    0x23,0x35,0x33,0x32,0x37,0x36,0x10,0x26,0x23,0x22,
-    0x06,0x07,0x27,0x36,0x36,0x01,0x7d,0x8f,0xac,0xed,
-    0x7b,0x89,0xc1,0xfe,0xb3,0x6d,0x7d,0x97,0x7b,0x87,
-    0xa0,0x99,0x4a,0x50,0x7f,0x50,0x50,0x71,0x66,0x43,
-    0x6f,0x44,0x3d,0x49,0x91,0x05,0xcb,0xbe,0x93,0xfe,
-    0xd8,0x54,0x08,0x1b,0xbf,0x91,0xbf,0xe0,0x35,0x6c,
-    0x49,0xb1,0x01,0x2e,0xa4,0x5c,0x59,0x5b,0x01,0x0f,
-    0x8d,0x2d,0x40,0x40,0x47,0x3e,0x00,0x02,0x00,0x25,
-    0x00,0x00,0x03,0x19,0x05,0xc7,0x00,0x0a,0x00,0x11,
-    0x00,0x00,0x01,0x33,0x15,0x23,0x11,0x23,0x11,0x21,
-    0x35,0x01,0x33,0x03,0x11,0x34,0x37,0x23,0x07,0x01,
-    0x02,0x7d,0x9c,0x9c,0x60,0xfe,0x08,0x01,0xdf,0x79,
-    0x60,0x08,0x06,0x4a,0xfe,0xb4,0x01,0xa6,0x5a,0xfe,
-    0xb4,0x01,0x4c,0x54,0x04,0x27,0xfb,0xdf,0x02,0xc2,
-    0x73,0x7b,0xbc,0xfd,0x0c,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x62,0xff,0xec,0x02,0xd7,0x05,0xb6,0x00,0x18,
-    0x00,0x00,0x01,0x21,0x03,0x36,0x33,0x32,0x16,0x15,
-    0x14,0x02,0x23,0x22,0x27,0x35,0x16,0x20,0x36,0x10,
-    0x26,0x23,0x22,0x07,0x27,0x13,0x21,0x02,0x87,0xfe,
-    0x62,0x24,0x5c,0x52,0xa4,0xc0,0xd2,0xaf,0x9c,0x58,
-    0x6e,0x01,0x07,0x9c,0x89,0x7d,0x66,0x69,0x31,0x2b,
-    0x01,0xef,0x05,0x58,0xfd,0xfe,0x14,0xda,0xbf,0xdd,
-    0xfe,0xf8,0x37,0x6e,0x4d,0xda,0x01,0x50,0xa6,0x1e,
-    0x3f,0x02,0x81,0x00,0x00,0x00,0x00,0x02,0x00,0x64,
-    0xff,0xec,0x02,0xd9,0x05,0xcb,0x00,0x15,0x00,0x1f,
-    0x00,0x00,0x01,0x32,0x16,0x10,0x06,0x23,0x22,0x02,
-    0x11,0x10,0x21,0x32,0x17,0x15,0x26,0x23,0x22,0x02,
-    0x03,0x33,0x36,0x36,0x00,0x26,0x22,0x06,0x14,0x17,
-    0x16,0x33,0x32,0x36,0x01,0xb4,0x88,0x9d,0xa6,0x8d,
-    0x9d,0xa5,0x01,0xa8,0x4c,0x33,0x39,0x4e,0x90,0xa3,
-    0x0a,0x08,0x22,0x77,0x01,0x0d,0x69,0xca,0x79,0x1c,
-    0x3a,0x89,0x64,0x69,0x03,0x87,0xf2,0xfe,0x51,0xfa,
-    0x01,0x4a,0x01,0x39,0x03,0x5c,0x17,0x60,0x19,0xfe,
-    0xb4,0xfe,0xc4,0x4d,0x55,0xfe,0xe8,0xbc,0xa2,0xfc,
-    0x6a,0xd9,0xba,0x00,0x00,0x01,0x00,0x39,0x00,0x00,
-    0x02,0xec,0x05,0xb6,0x00,0x06,0x00,0x00,0x13,0x35,
-    0x21,0x15,0x01,0x23,0x01,0x39,0x02,0xb3,0xfe,0x3d,
-    0x66,0x01,0xc6,0x05,0x58,0x5e,0x52,0xfa,0x9c,0x05,
-    0x58,0x00,0x00,0x00,0x00,0x03,0x00,0x48,0xff,0xec,
-    0x02,0xee,0x05,0xcb,0x00,0x14,0x00,0x1d,0x00,0x28,
-    0x00,0x00,0x13,0x34,0x36,0x20,0x17,0x16,0x15,0x14,
-    0x07,0x16,0x17,0x16,0x10,0x06,0x20,0x26,0x35,0x34,
-    0x36,0x37,0x26,0x00,0x26,0x22,0x06,0x14,0x16,0x17,
-    0x36,0x35,0x01,0x06,0x14,0x16,0x32,0x36,0x35,0x34,
-    0x27,0x27,0x06,0x6a,0xab,0x01,0x11,0x54,0x55,0xf0,
-    0x6c,0x35,0x6e,0xb9,0xfe,0xd7,0xc4,0x6f,0x86,0xd3,
-    0x02,0x00,0x6d,0xc1,0x6d,0x5a,0x71,0xd0,0xfe,0x74,
-    0x30,0x84,0xd6,0x7f,0xcf,0x31,0x79,0x04,0x77,0x97,
-    0xbd,0x5a,0x58,0x9e,0xf3,0x8e,0x49,0x38,0x74,0xfe,
-    0xbe,0xd7,0xce,0xa4,0x7f,0xc6,0x57,0xa2,0x01,0x4f,
-    0x86,0x87,0xde,0x9a,0x4b,0x7d,0xcf,0xfd,0xbc,0x52,
-    0xff,0x98,0x9e,0x8b,0xb3,0x8e,0x21,0x4d,0x00,0x00,
-    0x00,0x02,0x00,0x52,0xff,0xec,0x02,0xc7,0x05,0xcb,
-    0x00,0x16,0x00,0x20,0x00,0x00,0x01,0x22,0x26,0x10,
-    0x36,0x20,0x12,0x11,0x10,0x02,0x23,0x22,0x26,0x27,
-    0x35,0x16,0x33,0x32,0x12,0x13,0x23,0x06,0x06,0x03,
-    0x22,0x06,0x10,0x16,0x32,0x36,0x10,0x26,0x26,0x01,
-    0x77,0x89,0x9c,0xa9,0x01,0x2e,0x9e,0xda,0xd4,0x28,
-    0x4f,0x11,0x37,0x59,0x91,0xa7,0x0b,0x08,0x22,0x77,
-    0x38,0x64,0x71,0x69,0xca,0x79,0x35,0x60,0x02,0x2f,
-    0xf6,0x01,0xab,0xfb,0xfe,0xbf,0xfe,0xd0,0xfe,0x4c,
-    0xfe,0x46,0x0e,0x08,0x60,0x18,0x01,0x4f,0x01,0x38,
-    0x4d,0x55,0x03,0x3e,0xbd,0xfe,0x97,0xbc,0xa9,0x01,
-    0x0b,0xc7,0x67,0x00,0x00,0x00,0x00,0x02,0x00,0x85,
-    0xff,0xf0,0x01,0x21,0x04,0x3f,0x00,0x06,0x00,0x0d,
-    0x00,0x00,0x12,0x32,0x15,0x14,0x06,0x23,0x22,0x10,
-    0x32,0x15,0x14,0x06,0x23,0x22,0x85,0x9c,0x2b,0x23,
-    0x4e,0x9c,0x2b,0x23,0x4e,0x04,0x3f,0x6a,0x36,0x35,
-    0xfd,0x5b,0x6b,0x36,0x34,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x4e,0xfe,0xf8,0x01,0x33,0x04,0x3f,0x00,0x06,
-    0x00,0x0d,0x00,0x00,0x12,0x32,0x15,0x14,0x06,0x23,
-    0x22,0x13,0x17,0x06,0x07,0x23,0x36,0x37,0x85,0x9c,
-    0x2b,0x23,0x4e,0xa0,0x0e,0x43,0x63,0x3f,0x4a,0x1a,
-    0x04,0x3f,0x6a,0x36,0x35,0xfd,0x63,0x17,0xe5,0xd9,
-    0xfc,0xd9,0x00,0x00,0x00,0x01,0x00,0x3b,0x01,0x1f,
-    0x02,0xfa,0x04,0x85,0x00,0x06,0x00,0x00,0x09,0x02,
-    0x15,0x01,0x35,0x01,0x02,0xfa,0xfd,0xa8,0x02,0x58,
-    0xfd,0x41,0x02,0xbf,0x04,0x21,0xfe,0xb2,0xfe,0xb2,
-    0x66,0x01,0x93,0x44,0x01,0x8f,0x00,0x00,0x00,0x02,
-    0x00,0x3b,0x01,0xd1,0x02,0xf8,0x03,0xd1,0x00,0x03,
-    0x00,0x07,0x00,0x00,0x01,0x21,0x35,0x21,0x11,0x21,
-    0x35,0x21,0x02,0xf8,0xfd,0x43,0x02,0xbd,0xfd,0x43,
-    0x02,0xbd,0x03,0x7f,0x52,0xfe,0x00,0x52,0x00,0x01,
-    0x00,0x39,0x01,0x1f,0x02,0xf8,0x04,0x85,0x00,0x06,
-    0x00,0x00,0x01,0x15,0x01,0x35,0x01,0x01,0x35,0x02,
-    0xf8,0xfd,0x41,0x02,0x58,0xfd,0xa8,0x02,0xf6,0x44,
-    0xfe,0x6d,0x66,0x01,0x4e,0x01,0x4e,0x64,0x00,0x02,
-    0x00,0x23,0xff,0xf0,0x02,0x12,0x05,0xcb,0x00,0x19,
-    0x00,0x20,0x00,0x00,0x13,0x36,0x32,0x16,0x15,0x14,
-    0x06,0x07,0x06,0x06,0x15,0x15,0x23,0x35,0x34,0x36,
-    0x37,0x36,0x37,0x36,0x34,0x26,0x23,0x22,0x06,0x07,
-    0x13,0x22,0x34,0x32,0x15,0x14,0x06,0x23,0x64,0xff,
-    0x8c,0x40,0x5f,0x3c,0x2f,0x4a,0x2a,0x39,0x59,0x19,
-    0x1b,0x5a,0x50,0x35,0x4f,0x2e,0x97,0x4d,0x9b,0x2b,
-    0x05,0x81,0x4a,0xa6,0x9e,0x7a,0xa5,0x8f,0x5b,0x87,
-    0x64,0x24,0x33,0x70,0x97,0x55,0x86,0x4f,0x4f,0xd2,
-    0x7d,0x1d,0x1f,0xfa,0xbb,0xd5,0x6b,0x36,0x34,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x6f,0xff,0x4c,0x04,0x6a,
-    0x05,0xc1,0x00,0x3a,0x00,0x45,0x00,0x00,0x05,0x22,
-    0x02,0x11,0x34,0x35,0x10,0x12,0x36,0x33,0x32,0x33,
-    0x32,0x16,0x12,0x15,0x10,0x23,0x22,0x26,0x27,0x23,
-    0x06,0x06,0x23,0x22,0x26,0x35,0x10,0x21,0x32,0x17,
-    0x03,0x15,0x14,0x33,0x32,0x36,0x35,0x34,0x35,0x34,
-    0x02,0x26,0x23,0x22,0x23,0x22,0x06,0x02,0x15,0x10,
-    0x12,0x33,0x32,0x36,0x37,0x15,0x06,0x03,0x22,0x06,
-    0x15,0x10,0x33,0x32,0x36,0x37,0x13,0x26,0x02,0x48,
-    0xe6,0xf3,0x85,0xf6,0x9f,0x03,0x03,0x89,0xdd,0x75,
-    0xe1,0x51,0x4a,0x02,0x09,0x11,0x4a,0x42,0x58,0x61,
-    0x01,0x06,0x56,0x4e,0x14,0x66,0x43,0x3c,0x5f,0xac,
-    0x6b,0x02,0x03,0x85,0xce,0x6f,0xce,0xb5,0x43,0x78,
-    0x26,0x64,0x42,0x4b,0x4e,0x68,0x2d,0x33,0x09,0x10,
-    0x1d,0xb4,0x01,0x85,0x01,0x73,0x08,0x07,0x01,0x05,
-    0x01,0x92,0xd7,0xbb,0xfe,0xaf,0xd6,0xfe,0x08,0x68,
-    0x67,0x6d,0x62,0xbb,0xaa,0x01,0xd9,0x1d,0xfe,0x23,
-    0x3d,0xa8,0xc9,0xd6,0x04,0x04,0xb6,0x01,0x25,0xa0,
-    0xc6,0xfe,0x9b,0xe9,0xfe,0xb9,0xfe,0x95,0x26,0x1f,
-    0x5e,0x3d,0x04,0x87,0xc9,0xc2,0xfe,0xfe,0xa6,0xae,
-    0x01,0x31,0x08,0x00,0x00,0x00,0x00,0x02,0x00,0x00,
-    0x00,0x00,0x03,0x2d,0x05,0xb6,0x00,0x07,0x00,0x0e,
-    0x00,0x00,0x21,0x23,0x03,0x21,0x03,0x23,0x01,0x33,
-    0x13,0x03,0x26,0x27,0x06,0x07,0x03,0x03,0x2d,0x64,
-    0x81,0xfe,0x9d,0x7f,0x66,0x01,0x60,0x65,0x6c,0x81,
-    0x16,0x09,0x09,0x13,0x7d,0x02,0x12,0xfd,0xee,0x05,
-    0xb6,0xfc,0xbf,0x02,0x21,0x67,0x47,0x5b,0x53,0xfd,
-    0xdf,0x00,0x00,0x00,0x00,0x03,0x00,0xa0,0x00,0x00,
-    0x03,0x3b,0x05,0xb6,0x00,0x0e,0x00,0x17,0x00,0x1f,
-    0x00,0x00,0x13,0x21,0x32,0x16,0x15,0x10,0x07,0x15,
-    0x16,0x16,0x15,0x14,0x06,0x23,0x21,0x13,0x11,0x33,
-    0x32,0x36,0x35,0x34,0x26,0x23,0x03,0x11,0x33,0x32,
-    0x11,0x34,0x26,0x23,0xa0,0x01,0x18,0xad,0xb8,0xd9,
-    0x7e,0x79,0xae,0x9d,0xfe,0xb0,0x62,0xb8,0x87,0x77,
-    0x82,0x7e,0xb6,0xe1,0xf2,0x8d,0x81,0x05,0xb6,0xb1,
-    0xab,0xfe,0xd7,0x2b,0x08,0x1a,0xab,0x99,0xc4,0xdc,
-    0x05,0x5c,0xfd,0xcf,0x94,0x9d,0x7c,0x84,0xfd,0x75,
-    0xfd,0x89,0x01,0x48,0x92,0x9d,0x00,0x00,0x00,0x01,
-    0x00,0x6f,0xff,0xec,0x03,0x29,0x05,0xcd,0x00,0x1d,
-    0x00,0x00,0x05,0x22,0x02,0x11,0x34,0x35,0x10,0x12,
-    0x33,0x32,0x17,0x07,0x26,0x23,0x22,0x02,0x11,0x14,
-    0x15,0x10,0x12,0x33,0x32,0x33,0x32,0x37,0x15,0x06,
-    0x23,0x22,0x02,0x37,0xce,0xfa,0xf9,0xd7,0x85,0x65,
-    0x2d,0x54,0x6b,0xa6,0xc2,0xc8,0xa4,0x02,0x03,0x70,
-    0x54,0x4e,0x7f,0x03,0x14,0x01,0x94,0x01,0x54,0x06,
-    0x05,0x01,0x5f,0x01,0x8f,0x3e,0x56,0x36,0xfe,0xa4,
-    0xfe,0xca,0x06,0x05,0xfe,0xdc,0xfe,0x9c,0x29,0x5a,
-    0x2d,0x00,0x00,0x00,0x00,0x02,0x00,0xa0,0x00,0x00,
-    0x03,0x75,0x05,0xb6,0x00,0x07,0x00,0x0f,0x00,0x00,
-    0x13,0x21,0x32,0x12,0x11,0x10,0x21,0x21,0x13,0x11,
-    0x33,0x20,0x11,0x10,0x02,0x23,0xa0,0x01,0x0a,0xe2,
-    0xe9,0xfe,0x2f,0xfe,0xfc,0x62,0x9c,0x01,0x70,0xb7,
-    0xb1,0x05,0xb6,0xfe,0x93,0xfe,0xa0,0xfd,0x17,0x05,
-    0x5c,0xfa,0xfe,0x02,0x89,0x01,0x36,0x01,0x43,0x00,
-    0x00,0x00,0x00,0x01,0x00,0xa0,0x00,0x00,0x02,0xb2,
-    0x05,0xb6,0x00,0x0b,0x00,0x00,0x01,0x21,0x11,0x21,
-    0x15,0x21,0x11,0x21,0x15,0x21,0x11,0x21,0x02,0xb2,
-    0xfe,0x50,0x01,0x98,0xfe,0x68,0x01,0xb0,0xfd,0xee,
-    0x02,0x12,0x05,0x58,0xfd,0xd5,0x5e,0xfd,0x8f,0x5e,
-    0x05,0xb6,0x00,0x00,0x00,0x01,0x00,0xa0,0x00,0x00,
-    0x02,0xb4,0x05,0xb6,0x00,0x09,0x00,0x00,0x01,0x21,
-    0x11,0x21,0x15,0x21,0x11,0x23,0x11,0x21,0x02,0xb4,
-    0xfe,0x4e,0x01,0x9a,0xfe,0x66,0x62,0x02,0x14,0x05,
-    0x58,0xfd,0x94,0x5f,0xfd,0x73,0x05,0xb6,0x00,0x01,
-    0x00,0x6f,0xff,0xec,0x03,0xc1,0x05,0xcb,0x00,0x17,
-    0x00,0x00,0x01,0x11,0x06,0x23,0x22,0x00,0x10,0x00,
-    0x33,0x32,0x17,0x07,0x26,0x23,0x22,0x02,0x10,0x12,
-    0x33,0x32,0x37,0x11,0x23,0x35,0x03,0xc1,0xa8,0xb3,
-    0xef,0xfe,0xf8,0x01,0x10,0xf8,0xa7,0x92,0x2f,0x89,
-    0x81,0xcc,0xd4,0xd4,0xc4,0x8d,0x62,0xdd,0x02,0xe1,
-    0xfd,0x4c,0x41,0x01,0x90,0x02,0xc7,0x01,0x88,0x5e,
-    0x56,0x58,0xfe,0xb0,0xfd,0x83,0xfe,0xa8,0x25,0x02,
-    0x14,0x5e,0x00,0x01,0x00,0xa0,0x00,0x00,0x03,0x62,
-    0x05,0xb6,0x00,0x0b,0x00,0x00,0x21,0x23,0x11,0x21,
-    0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x33,0x03,0x62,
-    0x62,0xfe,0x02,0x62,0x62,0x01,0xfe,0x62,0x02,0xcf,
-    0xfd,0x31,0x05,0xb6,0xfd,0x77,0x02,0x89,0x00,0x00,
-    0x00,0x01,0x00,0xa0,0x00,0x00,0x01,0x02,0x05,0xb6,
-    0x00,0x03,0x00,0x00,0x21,0x23,0x11,0x33,0x01,0x02,
-    0x62,0x62,0x05,0xb6,0x00,0x01,0xff,0xa6,0xfe,0x8f,
-    0x00,0xf8,0x05,0xb6,0x00,0x0c,0x00,0x00,0x13,0x11,
-    0x14,0x06,0x23,0x22,0x27,0x35,0x16,0x32,0x36,0x35,
-    0x11,0xf8,0x70,0x6d,0x44,0x31,0x33,0x80,0x3d,0x05,
-    0xb6,0xfa,0x33,0xab,0xaf,0x19,0x5c,0x14,0x75,0x82,
-    0x05,0xcf,0x00,0x01,0x00,0xa0,0x00,0x00,0x03,0x39,
-    0x05,0xb6,0x00,0x0c,0x00,0x00,0x21,0x23,0x11,0x33,
-    0x11,0x36,0x01,0x33,0x01,0x01,0x23,0x01,0x07,0x01,
-    0x02,0x62,0x62,0x33,0x01,0x7d,0x6b,0xfe,0x91,0x01,
-    0x8b,0x6e,0xfe,0xa8,0x71,0x05,0xb6,0xfc,0xfa,0x60,
-    0x02,0xa6,0xfd,0x7d,0xfc,0xcd,0x02,0xd9,0x95,0x00,
-    0x00,0x00,0x00,0x01,0x00,0xa0,0x00,0x00,0x02,0x9e,
-    0x05,0xb6,0x00,0x05,0x00,0x00,0x25,0x21,0x15,0x21,
-    0x11,0x33,0x01,0x02,0x01,0x9c,0xfe,0x02,0x62,0x5e,
-    0x5e,0x05,0xb6,0x00,0x00,0x01,0x00,0xa0,0x00,0x00,
-    0x04,0xd3,0x05,0xb6,0x00,0x17,0x00,0x00,0x21,0x23,
-    0x11,0x34,0x37,0x23,0x01,0x23,0x01,0x23,0x16,0x15,
-    0x11,0x23,0x11,0x33,0x01,0x16,0x17,0x33,0x36,0x37,
-    0x01,0x33,0x04,0xd3,0x62,0x0a,0x08,0xfe,0x7d,0x6f,
-    0xfe,0x7b,0x08,0x0a,0x5e,0x91,0x01,0x48,0x2b,0x0e,
-    0x08,0x0c,0x32,0x01,0x45,0x96,0x04,0x21,0x48,0xc8,
-    0xfa,0xcf,0x05,0x33,0xc8,0x42,0xfb,0xd7,0x05,0xb6,
-    0xfb,0xa2,0x94,0x68,0x52,0xa8,0x04,0x60,0x00,0x01,
-    0x00,0xa0,0x00,0x00,0x03,0xa2,0x05,0xb6,0x00,0x0f,
-    0x00,0x00,0x21,0x23,0x01,0x23,0x16,0x15,0x11,0x23,
-    0x11,0x33,0x01,0x33,0x26,0x35,0x11,0x33,0x03,0xa2,
-    0x7d,0xfd,0xd7,0x08,0x0c,0x60,0x7f,0x02,0x25,0x06,
-    0x08,0x60,0x05,0x1f,0x89,0x7d,0xfb,0xe7,0x05,0xb6,
-    0xfa,0xf0,0xae,0x64,0x03,0xfe,0x00,0x00,0x00,0x02,
-    0x00,0x6f,0xff,0xec,0x03,0xba,0x05,0xcb,0x00,0x09,
-    0x00,0x11,0x00,0x00,0x01,0x32,0x17,0x16,0x10,0x02,
-    0x20,0x02,0x11,0x10,0x00,0x02,0x20,0x02,0x10,0x12,
-    0x20,0x12,0x02,0x17,0xcd,0x6a,0x6c,0xd9,0xfe,0x63,
-    0xd5,0x02,0xe5,0xa0,0xfe,0xc3,0xa2,0xa3,0x01,0x3a,
-    0xa2,0x05,0xcb,0xc3,0xc2,0xfd,0x2b,0xfe,0x7b,0x01,
-    0x89,0x01,0x6a,0x02,0xec,0xfe,0x57,0x01,0x4b,0xfe,
-    0xb3,0xfd,0x78,0xfe,0xb2,0x01,0x4b,0x00,0x00,0x02,
-    0x00,0xa0,0x00,0x00,0x03,0x04,0x05,0xb6,0x00,0x09,
-    0x00,0x11,0x00,0x00,0x13,0x33,0x32,0x16,0x10,0x06,
-    0x23,0x23,0x11,0x23,0x13,0x11,0x33,0x32,0x36,0x10,
-    0x26,0x23,0xa0,0xc8,0xd6,0xc6,0xcd,0xcd,0x68,0x62,
-    0x62,0x62,0xac,0x90,0x93,0x9e,0x05,0xb6,0xca,0xfe,
-    0x46,0xd6,0xfd,0xa4,0x05,0x5c,0xfd,0x5a,0xa2,0x01,
-    0x69,0x9b,0x00,0x02,0x00,0x6f,0xfe,0xa4,0x03,0xba,
-    0x05,0xcb,0x00,0x0f,0x00,0x17,0x00,0x00,0x13,0x10,
-    0x21,0x32,0x17,0x16,0x11,0x10,0x02,0x07,0x13,0x23,
-    0x03,0x07,0x22,0x02,0x00,0x02,0x20,0x02,0x10,0x12,
-    0x20,0x12,0x6f,0x01,0xa8,0xcd,0x6a,0x6c,0x8d,0x85,
-    0xd5,0x7d,0xba,0x32,0xd0,0xd5,0x02,0xe5,0xa0,0xfe,
-    0xc3,0xa2,0xa3,0x01,0x3a,0xa2,0x02,0xdf,0x02,0xec,
-    0xc3,0xc2,0xfe,0x97,0xfe,0xde,0xfe,0x8d,0x3e,0xfe,
-    0x9a,0x01,0x4c,0x04,0x01,0x89,0x02,0xad,0x01,0x4b,
-    0xfe,0xb3,0xfd,0x78,0xfe,0xb2,0x01,0x4b,0x00,0x02,
-    0x00,0xa0,0x00,0x00,0x03,0x3b,0x05,0xb6,0x00,0x0d,
-    0x00,0x15,0x00,0x00,0x13,0x33,0x32,0x16,0x15,0x14,
-    0x06,0x07,0x01,0x23,0x01,0x23,0x11,0x23,0x13,0x11,
-    0x33,0x32,0x36,0x10,0x26,0x23,0xa0,0xc8,0xd4,0xc8,
-    0x6f,0x7c,0x01,0x22,0x6e,0xfe,0xef,0xba,0x62,0x62,
-    0x89,0x86,0x8f,0x92,0x9f,0x05,0xb6,0xc8,0xcb,0x9c,
-    0xc1,0x30,0xfd,0x6a,0x02,0x7f,0xfd,0x81,0x05,0x56,
-    0xfd,0x83,0xa5,0x01,0x45,0x93,0x00,0x00,0x00,0x01,
-    0x00,0x56,0xff,0xec,0x02,0xd1,0x05,0xcb,0x00,0x25,
-    0x00,0x00,0x25,0x32,0x36,0x34,0x26,0x27,0x2e,0x02,
-    0x35,0x34,0x35,0x34,0x36,0x33,0x32,0x33,0x32,0x17,
-    0x07,0x26,0x22,0x06,0x14,0x16,0x17,0x16,0x16,0x15,
-    0x14,0x07,0x06,0x23,0x22,0x27,0x35,0x16,0x16,0x01,
-    0x6f,0x70,0x90,0x67,0x8f,0x72,0x6f,0x36,0xc3,0x8c,
-    0x02,0x03,0x9a,0x6e,0x26,0x6f,0xdf,0x87,0x63,0x8e,
-    0x94,0x89,0x64,0x65,0x99,0xaf,0x6a,0x38,0x98,0x4a,
-    0xaa,0xfc,0x8f,0x46,0x3a,0x6a,0x8d,0x64,0x06,0x06,
-    0x97,0xce,0x3c,0x5e,0x39,0x93,0xf5,0x86,0x4a,0x48,
-    0xc1,0x8a,0xb4,0x70,0x6f,0x33,0x6a,0x1e,0x21,0x00,
-    0x00,0x01,0x00,0x0e,0x00,0x00,0x02,0xb6,0x05,0xb6,
-    0x00,0x07,0x00,0x00,0x01,0x21,0x11,0x23,0x11,0x21,
-    0x35,0x21,0x02,0xb6,0xfe,0xdd,0x62,0xfe,0xdd,0x02,
-    0xa8,0x05,0x58,0xfa,0xa8,0x05,0x58,0x5e,0x00,0x00,
-    0x00,0x01,0x00,0x93,0xff,0xec,0x03,0x60,0x05,0xb6,
-    0x00,0x0f,0x00,0x00,0x01,0x11,0x10,0x21,0x22,0x26,
-    0x35,0x11,0x33,0x11,0x14,0x16,0x32,0x36,0x35,0x11,
-    0x03,0x60,0xfe,0x9e,0xb1,0xba,0x63,0x89,0xfd,0x82,
-    0x05,0xb6,0xfc,0x25,0xfe,0x11,0xff,0xf0,0x03,0xdb,
-    0xfc,0x19,0xbd,0xc8,0xc7,0xc2,0x03,0xe3,0x00,0x00,
-    0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x1f,0x05,0xb6,
-    0x00,0x0b,0x00,0x00,0x21,0x23,0x01,0x33,0x13,0x16,
-    0x16,0x17,0x36,0x37,0x01,0x33,0x01,0xc5,0x6d,0xfe,
-    0xa8,0x66,0xee,0x1b,0x13,0x09,0x15,0x0d,0x01,0x0d,
-    0x65,0x05,0xb6,0xfb,0xfc,0x70,0x76,0x53,0x95,0x3b,
-    0x04,0x6d,0x00,0x01,0x00,0x0a,0x00,0x00,0x05,0x68,
-    0x05,0xb6,0x00,0x18,0x00,0x00,0x21,0x23,0x03,0x26,
-    0x27,0x07,0x03,0x23,0x01,0x33,0x13,0x16,0x17,0x36,
-    0x37,0x13,0x33,0x13,0x16,0x17,0x17,0x36,0x37,0x13,
-    0x33,0x04,0x31,0x77,0xdf,0x07,0x1c,0x25,0xdb,0x74,
-    0xfe,0xc6,0x67,0xce,0x31,0x0d,0x16,0x23,0xcd,0x6f,
-    0xcc,0x22,0x0c,0x0a,0x1c,0x1d,0xd5,0x64,0x04,0x46,
-    0x20,0xcf,0xed,0xfb,0xb8,0x05,0xb6,0xfc,0x11,0xfe,
-    0x5a,0x9f,0xb5,0x03,0xf3,0xfc,0x11,0xb3,0x5b,0x4a,
-    0xd1,0x87,0x03,0xef,0x00,0x01,0x00,0x14,0x00,0x00,
-    0x02,0xb6,0x05,0xb6,0x00,0x0b,0x00,0x00,0x01,0x01,
-    0x23,0x03,0x03,0x23,0x01,0x01,0x33,0x13,0x13,0x33,
-    0x01,0xb4,0x01,0x02,0x66,0xdb,0xfe,0x63,0x01,0x32,
-    0xfe,0xf9,0x67,0xd9,0xd3,0x64,0x02,0xf2,0xfd,0x0e,
-    0x02,0xa0,0xfd,0x60,0x03,0x08,0x02,0xae,0xfd,0xa0,
-    0x02,0x60,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x02,0xae,0x05,0xb6,0x00,0x08,0x00,0x00,0x21,0x23,
-    0x11,0x01,0x33,0x13,0x13,0x33,0x01,0x01,0x87,0x62,
-    0xfe,0xdb,0x68,0xf0,0xee,0x68,0xfe,0xd9,0x02,0x3b,
-    0x03,0x7b,0xfd,0x0d,0x02,0xf3,0xfc,0x85,0x00,0x01,
-    0x00,0x39,0x00,0x00,0x02,0x5a,0x05,0xb6,0x00,0x09,
-    0x00,0x00,0x25,0x15,0x21,0x35,0x01,0x21,0x35,0x21,
-    0x15,0x01,0x02,0x5a,0xfd,0xdf,0x01,0xa8,0xfe,0x5e,
-    0x02,0x0f,0xfe,0x52,0x5e,0x5e,0x58,0x04,0xfe,0x60,
-    0x5a,0xfb,0x02,0x00,0x00,0x00,0x00,0x01,0x00,0xae,
-    0xfe,0xbc,0x02,0x3b,0x05,0xb6,0x00,0x07,0x00,0x00,
-    0x01,0x21,0x11,0x21,0x15,0x21,0x11,0x21,0x02,0x3b,
-    0xfe,0xd1,0x01,0x2f,0xfe,0x73,0x01,0x8d,0x05,0x5c,
-    0xf9,0xbb,0x5b,0x06,0xfa,0x00,0x00,0x01,0x00,0x33,
-    0x00,0x00,0x02,0xa2,0x05,0xb6,0x00,0x03,0x00,0x00,
-    0x21,0x23,0x01,0x33,0x02,0xa2,0x65,0xfd,0xf6,0x60,
-    0x05,0xb6,0x00,0x00,0x00,0x01,0x00,0x4a,0xfe,0xbc,
-    0x01,0xd7,0x05,0xb6,0x00,0x07,0x00,0x00,0x01,0x21,
-    0x35,0x21,0x11,0x21,0x35,0x21,0x01,0xd7,0xfe,0x73,
-    0x01,0x2f,0xfe,0xd1,0x01,0x8d,0xfe,0xbc,0x5b,0x06,
-    0x45,0x5a,0x00,0x00,0x00,0x01,0x00,0x25,0x02,0xf6,
-    0x03,0x0e,0x05,0xb4,0x00,0x06,0x00,0x00,0x01,0x23,
-    0x01,0x01,0x23,0x01,0x33,0x03,0x0e,0x66,0xfe,0xf2,
-    0xfe,0xef,0x64,0x01,0x52,0x43,0x02,0xf6,0x02,0x4e,
-    0xfd,0xb2,0x02,0xbe,0x00,0x01,0xff,0xfc,0xfe,0xf6,
-    0x03,0x4e,0xff,0x48,0x00,0x03,0x00,0x00,0x01,0x21,
-    0x35,0x21,0x03,0x4e,0xfc,0xae,0x03,0x52,0xfe,0xf6,
-    0x52,0x00,0x00,0x01,0x01,0xb2,0x04,0xd9,0x02,0xee,
-    0x06,0x21,0x00,0x09,0x00,0x00,0x01,0x33,0x16,0x16,
-    0x17,0x15,0x23,0x26,0x26,0x27,0x01,0xb2,0x7d,0x1d,
-    0x6a,0x38,0x30,0x3f,0xa8,0x25,0x06,0x21,0x43,0xaa,
-    0x46,0x15,0x33,0xbf,0x45,0x00,0x00,0x02,0x00,0x4e,
-    0xff,0xec,0x02,0x83,0x04,0x52,0x00,0x16,0x00,0x20,
-    0x00,0x00,0x13,0x36,0x20,0x16,0x15,0x11,0x23,0x27,
-    0x23,0x06,0x23,0x22,0x27,0x26,0x10,0x36,0x37,0x37,
-    0x35,0x34,0x26,0x22,0x07,0x03,0x14,0x16,0x33,0x32,
-    0x36,0x35,0x35,0x07,0x04,0x9a,0x70,0x01,0x04,0x75,
-    0x4e,0x0c,0x04,0x4e,0x9e,0x6b,0x40,0x40,0xba,0xa8,
-    0x75,0x4d,0xb4,0x61,0x11,0x52,0x4a,0x66,0x71,0x71,
-    0xfe,0xfe,0x04,0x0c,0x46,0xaa,0xc5,0xfd,0x1d,0x98,
-    0xac,0x54,0x55,0x01,0x29,0xb5,0x08,0x06,0x5a,0x99,
-    0x8a,0x3d,0xfd,0x60,0x73,0x71,0xca,0xb7,0x71,0x06,
-    0x0d,0x00,0x00,0x00,0x00,0x02,0x00,0x91,0xff,0xec,
-    0x03,0x1f,0x06,0x14,0x00,0x11,0x00,0x1b,0x00,0x00,
-    0x01,0x20,0x11,0x10,0x02,0x23,0x22,0x26,0x27,0x23,
-    0x07,0x23,0x11,0x33,0x11,0x07,0x33,0x36,0x03,0x15,
-    0x10,0x33,0x32,0x36,0x10,0x26,0x22,0x06,0x01,0xe1,
-    0x01,0x3e,0x9e,0x95,0x4f,0x7f,0x2a,0x08,0x0d,0x4e,
-    0x5f,0x04,0x08,0x56,0x5a,0xf1,0x6f,0x6c,0x6b,0xf1,
-    0x70,0x04,0x50,0xfd,0xd1,0xfe,0xec,0xfe,0xdf,0x57,
-    0x53,0x96,0x06,0x14,0xfe,0x1d,0x83,0xa2,0xfd,0xd1,
-    0x19,0xfe,0x3a,0xeb,0x01,0xe2,0xe9,0xdc,0x00,0x00,
-    0x00,0x01,0x00,0x60,0xff,0xec,0x02,0x52,0x04,0x52,
-    0x00,0x12,0x00,0x00,0x05,0x22,0x02,0x10,0x12,0x33,
-    0x32,0x17,0x07,0x26,0x23,0x22,0x10,0x33,0x32,0x37,
-    0x15,0x06,0x06,0x01,0xa8,0xa2,0xa6,0xa8,0xa2,0x65,
-    0x43,0x25,0x42,0x39,0xef,0xef,0x46,0x54,0x1f,0x60,
-    0x14,0x01,0x1b,0x02,0x29,0x01,0x22,0x25,0x54,0x1f,
-    0xfc,0x4a,0x20,0x50,0x11,0x15,0x00,0x00,0x00,0x02,
-    0x00,0x5e,0xff,0xec,0x02,0xec,0x06,0x14,0x00,0x11,
-    0x00,0x1b,0x00,0x00,0x21,0x23,0x27,0x23,0x06,0x23,
-    0x20,0x11,0x10,0x12,0x33,0x32,0x16,0x17,0x33,0x27,
-    0x11,0x33,0x03,0x35,0x34,0x26,0x22,0x06,0x10,0x16,
-    0x32,0x36,0x02,0xec,0x4e,0x08,0x09,0x51,0xa2,0xfe,
-    0xc4,0x9f,0x99,0x49,0x83,0x27,0x08,0x04,0x5f,0x5f,
-    0x76,0xed,0x69,0x6c,0xe6,0x7a,0x98,0xac,0x02,0x31,
-    0x01,0x15,0x01,0x20,0x54,0x4a,0x79,0x01,0xe7,0xfb,
-    0xcb,0x3e,0xf5,0xe6,0xef,0xfe,0x24,0xee,0xd4,0x00,
-    0x00,0x02,0x00,0x60,0xff,0xec,0x02,0xc3,0x04,0x52,
-    0x00,0x11,0x00,0x17,0x00,0x00,0x05,0x22,0x27,0x26,
-    0x10,0x12,0x33,0x32,0x12,0x15,0x15,0x21,0x12,0x21,
-    0x32,0x37,0x15,0x06,0x13,0x34,0x26,0x23,0x22,0x03,
-    0x01,0xc5,0xac,0x5d,0x5c,0xa5,0x9b,0x87,0x9c,0xfd,
-    0xfe,0x04,0x01,0x04,0x67,0x70,0x68,0x2c,0x6d,0x5d,
-    0xc4,0x13,0x14,0x92,0x94,0x02,0x1b,0x01,0x25,0xff,
-    0x00,0xdb,0x58,0xfe,0x27,0x43,0x5c,0x41,0x02,0x89,
-    0xb3,0xd4,0xfe,0x79,0x00,0x01,0x00,0x14,0x00,0x00,
-    0x01,0xf8,0x06,0x1f,0x00,0x15,0x00,0x00,0x13,0x34,
-    0x36,0x33,0x32,0x17,0x07,0x26,0x23,0x06,0x06,0x07,
-    0x15,0x33,0x15,0x23,0x11,0x23,0x11,0x23,0x35,0x37,
-    0x9e,0x62,0x79,0x47,0x38,0x21,0x33,0x2d,0x48,0x31,
-    0x02,0xaa,0xaa,0x5e,0x8a,0x8a,0x04,0x9a,0xcf,0xb6,
-    0x19,0x58,0x19,0x03,0x7d,0xaf,0x5b,0x54,0xfc,0x17,
-    0x03,0xe9,0x36,0x29,0x00,0x00,0x00,0x03,0x00,0x23,
-    0xfe,0x14,0x02,0xdb,0x04,0x52,0x00,0x28,0x00,0x31,
-    0x00,0x3d,0x00,0x00,0x25,0x33,0x32,0x16,0x15,0x14,
-    0x06,0x23,0x22,0x26,0x35,0x34,0x37,0x26,0x35,0x34,
-    0x36,0x37,0x26,0x26,0x35,0x34,0x36,0x33,0x32,0x17,
-    0x33,0x15,0x07,0x16,0x16,0x15,0x14,0x06,0x23,0x23,
-    0x27,0x06,0x06,0x14,0x16,0x12,0x26,0x22,0x06,0x10,
-    0x16,0x33,0x32,0x11,0x03,0x23,0x22,0x06,0x14,0x16,
-    0x33,0x32,0x36,0x35,0x34,0x26,0x01,0x66,0x44,0x92,
-    0x9f,0xd7,0xb0,0x93,0x9e,0xd7,0x6f,0x3c,0x41,0x52,
-    0x56,0x92,0x7f,0x43,0x2f,0xe6,0x94,0x1d,0x27,0x8f,
-    0x75,0x18,0x15,0x34,0x33,0x48,0xf4,0x5a,0xab,0x5c,
-    0x60,0x53,0xae,0x73,0x46,0x62,0x81,0x6d,0x6a,0x87,
-    0x9c,0x6b,0x91,0x97,0x8d,0x9f,0xba,0x95,0x8c,0xd0,
-    0x51,0x30,0x6a,0x2e,0x4c,0x30,0x26,0xa8,0x75,0xad,
-    0xc8,0x15,0x43,0x11,0x26,0x90,0x4e,0x9f,0xc3,0x02,
-    0x25,0x43,0x58,0x34,0x02,0xdc,0x97,0x9b,0xfe,0xf0,
-    0x8c,0x01,0x18,0xfd,0x50,0x88,0xd9,0x72,0x8c,0x7a,
-    0x63,0x6a,0x00,0x01,0x00,0x91,0x00,0x00,0x02,0xd9,
-    0x06,0x14,0x00,0x17,0x00,0x00,0x13,0x11,0x14,0x07,
-    0x33,0x36,0x37,0x36,0x33,0x32,0x16,0x15,0x11,0x23,
-    0x11,0x34,0x26,0x23,0x22,0x06,0x15,0x11,0x23,0x11,
-    0xf0,0x04,0x08,0x20,0x40,0x40,0x47,0x87,0x77,0x5e,
-    0x4c,0x58,0x74,0x73,0x5f,0x06,0x14,0xfe,0x07,0x4a,
-    0x29,0x52,0x2b,0x2d,0xb0,0xb6,0xfd,0x14,0x02,0xec,
-    0x92,0x7c,0xcf,0xd9,0xfd,0xae,0x06,0x14,0x00,0x02,
-    0x00,0x83,0x00,0x00,0x01,0x00,0x05,0xc9,0x00,0x07,
-    0x00,0x0b,0x00,0x00,0x12,0x36,0x32,0x16,0x14,0x06,
-    0x22,0x26,0x13,0x23,0x11,0x33,0x83,0x24,0x39,0x20,
-    0x20,0x38,0x25,0x6d,0x5f,0x5f,0x05,0x96,0x33,0x32,
-    0x58,0x33,0x34,0xfa,0xc0,0x04,0x3d,0x00,0x00,0x00,
-    0x00,0x02,0xff,0xfc,0xfe,0x14,0x01,0x00,0x05,0xc9,
-    0x00,0x07,0x00,0x15,0x00,0x00,0x12,0x36,0x32,0x16,
-    0x14,0x06,0x22,0x26,0x13,0x11,0x14,0x06,0x23,0x22,
-    0x27,0x35,0x16,0x33,0x32,0x36,0x35,0x11,0x83,0x24,
-    0x39,0x20,0x20,0x38,0x25,0x6d,0x56,0x5b,0x29,0x1a,
-    0x1f,0x20,0x2e,0x28,0x05,0x96,0x33,0x32,0x58,0x33,
-    0x34,0xfe,0xfd,0xfa,0xfa,0x95,0x8e,0x11,0x5a,0x10,
-    0x59,0x61,0x05,0x14,0x00,0x00,0x00,0x01,0x00,0x91,
-    0x00,0x00,0x02,0xb8,0x06,0x14,0x00,0x0e,0x00,0x00,
-    0x33,0x23,0x11,0x33,0x11,0x07,0x33,0x37,0x01,0x33,
-    0x03,0x01,0x23,0x03,0x07,0xf0,0x5f,0x5f,0x07,0x09,
-    0x3d,0x01,0x0c,0x67,0xfa,0x01,0x10,0x64,0xec,0x78,
-    0x06,0x14,0xfc,0xbb,0xb6,0x6e,0x01,0xb6,0xfe,0x71,
-    0xfd,0x52,0x02,0x56,0x9e,0x00,0x00,0x01,0x00,0x91,
-    0x00,0x00,0x00,0xf0,0x06,0x14,0x00,0x03,0x00,0x00,
-    0x33,0x23,0x11,0x33,0xf0,0x5f,0x5f,0x06,0x14,0x00,
-    0x00,0x01,0x00,0x91,0x00,0x00,0x04,0x89,0x04,0x52,
-    0x00,0x20,0x00,0x00,0x01,0x32,0x17,0x36,0x36,0x33,
-    0x32,0x16,0x15,0x11,0x23,0x11,0x10,0x23,0x22,0x06,
-    0x15,0x11,0x23,0x11,0x34,0x26,0x23,0x22,0x06,0x15,
-    0x11,0x23,0x11,0x33,0x17,0x33,0x36,0x01,0xcf,0xaa,
-    0x2f,0x27,0x72,0x5b,0x7b,0x72,0x5e,0xa0,0x6c,0x63,
-    0x5e,0x4e,0x52,0x6b,0x63,0x5f,0x50,0x08,0x09,0x40,
-    0x04,0x52,0xbc,0x64,0x58,0xbe,0xcf,0xfd,0x3b,0x02,
-    0xe3,0x01,0x11,0xbb,0xbe,0xfd,0x85,0x02,0xe3,0x8a,
-    0x87,0xc3,0xdd,0xfd,0xac,0x04,0x3d,0x97,0xac,0x00,
-    0x00,0x01,0x00,0x91,0x00,0x00,0x02,0xd9,0x04,0x52,
-    0x00,0x13,0x00,0x00,0x01,0x32,0x16,0x15,0x11,0x23,
-    0x11,0x10,0x23,0x22,0x06,0x15,0x11,0x23,0x11,0x33,
-    0x17,0x33,0x36,0x36,0x01,0xdd,0x80,0x7c,0x5e,0xa0,
-    0x7a,0x71,0x5f,0x50,0x08,0x09,0x21,0x80,0x04,0x52,
-    0xab,0xb9,0xfd,0x12,0x02,0xec,0x01,0x0e,0xca,0xdc,
-    0xfd,0xac,0x04,0x3d,0x97,0x50,0x5c,0x00,0x00,0x02,
-    0x00,0x5e,0xff,0xec,0x02,0xf4,0x04,0x52,0x00,0x08,
-    0x00,0x10,0x00,0x00,0x01,0x32,0x12,0x10,0x02,0x20,
-    0x02,0x11,0x10,0x05,0x22,0x06,0x15,0x10,0x33,0x32,
-    0x10,0x01,0xaa,0x9c,0xae,0xad,0xfe,0xc0,0xa9,0x01,
-    0x4a,0x78,0x6f,0xe7,0xe9,0x04,0x52,0xfe,0xda,0xfd,
-    0xe3,0xfe,0xdd,0x01,0x23,0x01,0x12,0x02,0x31,0x5a,
-    0xe9,0xee,0xfe,0x25,0x03,0xb2,0x00,0x02,0x00,0x91,
-    0xfe,0x14,0x03,0x1f,0x04,0x52,0x00,0x12,0x00,0x1c,
-    0x00,0x00,0x01,0x20,0x11,0x10,0x02,0x23,0x22,0x26,
-    0x27,0x23,0x17,0x11,0x23,0x11,0x33,0x17,0x33,0x36,
-    0x36,0x03,0x15,0x14,0x16,0x32,0x36,0x10,0x26,0x22,
-    0x06,0x01,0xe1,0x01,0x3e,0x9d,0x94,0x52,0x87,0x23,
-    0x09,0x07,0x5f,0x4e,0x0a,0x09,0x28,0x7d,0xa7,0x76,
-    0xe9,0x6d,0x69,0xf0,0x73,0x04,0x52,0xfd,0xcf,0xfe,
-    0xf0,0xfe,0xdb,0x5b,0x4f,0x77,0xfd,0xf5,0x06,0x29,
-    0x95,0x52,0x58,0xfd,0xf4,0x1f,0xf9,0xec,0xea,0x01,
-    0xe6,0xe6,0xd3,0x00,0x00,0x00,0x00,0x02,0x00,0x5e,
-    0xfe,0x14,0x02,0xec,0x04,0x52,0x00,0x10,0x00,0x1a,
-    0x00,0x00,0x25,0x06,0x23,0x20,0x11,0x10,0x12,0x20,
-    0x17,0x33,0x37,0x33,0x11,0x23,0x11,0x34,0x37,0x03,
-    0x35,0x34,0x26,0x22,0x06,0x10,0x16,0x32,0x36,0x02,
-    0x8d,0x55,0x9e,0xfe,0xc4,0xa5,0x01,0x34,0x52,0x08,
-    0x0f,0x4c,0x5f,0x09,0x09,0x76,0xed,0x69,0x6d,0xe6,
-    0x79,0x9e,0xb2,0x02,0x31,0x01,0x1a,0x01,0x1b,0xa6,
-    0x91,0xf9,0xd7,0x01,0xd5,0x43,0x72,0x01,0x4e,0x31,
-    0xf5,0xe6,0xef,0xfe,0x1a,0xe1,0xda,0x00,0x00,0x01,
-    0x00,0x91,0x00,0x00,0x02,0x1d,0x04,0x52,0x00,0x14,
-    0x00,0x00,0x01,0x32,0x17,0x07,0x26,0x23,0x22,0x23,
-    0x22,0x06,0x06,0x15,0x14,0x15,0x11,0x23,0x11,0x33,
-    0x17,0x33,0x36,0x01,0xbe,0x32,0x2d,0x17,0x24,0x26,
-    0x03,0x02,0x33,0x5d,0x37,0x5f,0x4e,0x0a,0x07,0x4c,
-    0x04,0x52,0x0e,0x5f,0x0f,0x71,0xc9,0x73,0x04,0x04,
-    0xfd,0xc1,0x04,0x3d,0xbe,0xd3,0x00,0x01,0x00,0x4a,
-    0xff,0xec,0x02,0x3d,0x04,0x52,0x00,0x1f,0x00,0x00,
-    0x25,0x32,0x36,0x35,0x34,0x2e,0x03,0x35,0x34,0x36,
-    0x32,0x17,0x07,0x26,0x22,0x06,0x14,0x17,0x16,0x17,
-    0x16,0x17,0x16,0x10,0x06,0x20,0x27,0x35,0x16,0x16,
-    0x01,0x29,0x54,0x60,0x47,0xd1,0x4f,0x2c,0x9f,0xfb,
-    0x59,0x31,0x52,0xb0,0x64,0x22,0x22,0x6e,0x6b,0x28,
-    0x50,0x91,0xfe,0xf1,0x51,0x25,0x7a,0x46,0x6d,0x5d,
-    0x47,0x66,0x85,0x52,0x67,0x49,0x75,0x99,0x3e,0x53,
-    0x37,0x63,0x99,0x31,0x30,0x45,0x46,0x2a,0x56,0xfe,
-    0xf6,0x9a,0x3d,0x6f,0x25,0x2d,0x00,0x01,0x00,0x2b,
-    0xff,0xec,0x01,0xa6,0x05,0x3f,0x00,0x14,0x00,0x00,
-    0x13,0x33,0x15,0x23,0x11,0x14,0x16,0x33,0x32,0x37,
-    0x15,0x06,0x23,0x22,0x35,0x11,0x23,0x35,0x37,0x13,
-    0x33,0xec,0xac,0xac,0x30,0x3c,0x2c,0x22,0x2d,0x44,
-    0xa8,0x62,0x60,0x1f,0x42,0x04,0x3d,0x54,0xfd,0x19,
-    0x6e,0x50,0x0c,0x50,0x14,0xfb,0x03,0x02,0x38,0x1c,
-    0x01,0x02,0x00,0x00,0x00,0x01,0x00,0x8d,0xff,0xec,
-    0x02,0xd5,0x04,0x3d,0x00,0x15,0x00,0x00,0x21,0x23,
-    0x27,0x23,0x06,0x06,0x23,0x22,0x27,0x26,0x35,0x11,
-    0x33,0x11,0x14,0x16,0x33,0x32,0x36,0x35,0x11,0x33,
-    0x02,0xd5,0x50,0x0c,0x08,0x23,0x7b,0x4a,0x83,0x3d,
-    0x3c,0x5f,0x4c,0x51,0x7c,0x72,0x5e,0x98,0x52,0x5a,
-    0x5d,0x5d,0xd3,0x02,0xc4,0xfd,0x3c,0xa0,0x95,0xc8,
-    0xdd,0x02,0x54,0x00,0x00,0x00,0x00,0x01,0x00,0x0a,
-    0x00,0x00,0x02,0x83,0x04,0x3d,0x00,0x0b,0x00,0x00,
-    0x21,0x23,0x01,0x33,0x13,0x16,0x17,0x33,0x36,0x36,
-    0x13,0x33,0x01,0x7b,0x71,0xff,0x00,0x60,0xa2,0x1c,
-    0x1a,0x08,0x09,0x20,0xb0,0x60,0x04,0x3d,0xfd,0x46,
-    0x79,0x8f,0x40,0x9a,0x02,0xe8,0x00,0x00,0x00,0x01,
-    0x00,0x14,0x00,0x00,0x04,0x50,0x04,0x3d,0x00,0x1a,
-    0x00,0x00,0x21,0x23,0x03,0x27,0x27,0x23,0x07,0x07,
-    0x03,0x23,0x03,0x33,0x13,0x13,0x33,0x36,0x37,0x13,
-    0x33,0x13,0x16,0x13,0x33,0x36,0x36,0x13,0x33,0x03,
-    0x5c,0x70,0x96,0x04,0x1f,0x02,0x0e,0x17,0x9b,0x71,
-    0xec,0x5f,0x87,0x3f,0x06,0x13,0x27,0x87,0x64,0x88,
-    0x10,0x29,0x06,0x02,0x2c,0x99,0x5e,0x02,0xdf,0x11,
-    0xc0,0x55,0x7c,0xfd,0x21,0x04,0x3d,0xfd,0x88,0xfe,
-    0xb6,0x95,0xb7,0x02,0x76,0xfd,0x88,0x47,0xfe,0xfd,
-    0x1b,0xe1,0x02,0xc6,0x00,0x01,0x00,0x23,0x00,0x00,
-    0x02,0x81,0x04,0x3d,0x00,0x0b,0x00,0x00,0x01,0x13,
-    0x23,0x03,0x03,0x23,0x01,0x03,0x33,0x13,0x13,0x33,
-    0x01,0x83,0xfe,0x64,0xcb,0xcd,0x62,0x01,0x02,0xee,
-    0x67,0xb6,0xbe,0x63,0x02,0x27,0xfd,0xd9,0x01,0xd5,
-    0xfe,0x2b,0x02,0x33,0x02,0x0a,0xfe,0x48,0x01,0xb8,
-    0x00,0x01,0xff,0xfe,0xfe,0x14,0x02,0x83,0x04,0x3d,
-    0x00,0x16,0x00,0x00,0x13,0x22,0x27,0x35,0x16,0x33,
-    0x32,0x36,0x37,0x37,0x01,0x33,0x13,0x16,0x17,0x33,
-    0x36,0x37,0x13,0x33,0x01,0x06,0x06,0x54,0x25,0x31,
-    0x2a,0x24,0x3b,0x46,0x1c,0x30,0xfe,0xf1,0x60,0xa4,
-    0x1e,0x1a,0x08,0x15,0x20,0xa0,0x60,0xfe,0xc3,0x24,
-    0x72,0xfe,0x14,0x11,0x56,0x0e,0x65,0x74,0xbc,0x04,
-    0x3b,0xfd,0x5b,0x81,0x92,0x8f,0x86,0x02,0xa3,0xfa,
-    0xf6,0x93,0x8c,0x00,0x00,0x01,0x00,0x3b,0x00,0x00,
-    0x01,0xee,0x04,0x3d,0x00,0x09,0x00,0x00,0x25,0x15,
-    0x21,0x35,0x01,0x21,0x35,0x21,0x15,0x01,0x01,0xee,
-    0xfe,0x4d,0x01,0x40,0xfe,0xd5,0x01,0x8f,0xfe,0xc1,
-    0x54,0x54,0x4c,0x03,0x9d,0x54,0x4d,0xfc,0x64,0x00,
-    0x00,0x00,0x00,0x01,0x00,0x6d,0xfe,0xbc,0x02,0x79,
-    0x05,0xb6,0x00,0x21,0x00,0x00,0x01,0x11,0x14,0x06,
-    0x07,0x15,0x16,0x16,0x15,0x11,0x14,0x16,0x17,0x15,
-    0x26,0x26,0x35,0x11,0x34,0x26,0x26,0x23,0x35,0x32,
-    0x37,0x36,0x35,0x11,0x34,0x36,0x37,0x15,0x06,0x06,
-    0x01,0x9e,0x5b,0x68,0x6a,0x59,0x6b,0x70,0x97,0xa7,
-    0x26,0x59,0x4f,0x92,0x28,0x14,0xa8,0x96,0x70,0x6b,
-    0x04,0x7b,0xfe,0xc4,0x7a,0x74,0x14,0x08,0x13,0x77,
-    0x78,0xfe,0xc5,0x77,0x73,0x02,0x50,0x04,0xa9,0x93,
-    0x01,0x43,0x58,0x56,0x2a,0x45,0x52,0x2d,0x58,0x01,
-    0x44,0x93,0xa8,0x04,0x50,0x02,0x72,0x00,0x00,0x00,
-    0x00,0x01,0x01,0x6a,0xfe,0x14,0x01,0xc9,0x06,0x14,
-    0x00,0x03,0x00,0x00,0x01,0x23,0x11,0x33,0x01,0xc9,
-    0x5f,0x5f,0xfe,0x14,0x08,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x68,0xfe,0xbc,0x02,0x75,0x05,0xb6,0x00,0x22,
-    0x00,0x00,0x01,0x11,0x14,0x16,0x17,0x16,0x33,0x15,
-    0x22,0x07,0x06,0x15,0x11,0x14,0x06,0x07,0x35,0x36,
-    0x36,0x35,0x11,0x34,0x36,0x37,0x35,0x26,0x26,0x35,
-    0x11,0x34,0x26,0x27,0x35,0x16,0x16,0x01,0xa6,0x27,
-    0x2d,0x2e,0x4d,0x93,0x28,0x14,0xa7,0x97,0x70,0x6c,
-    0x5a,0x68,0x66,0x5c,0x6c,0x70,0x96,0xa8,0x04,0x77,
-    0xfe,0xbc,0x58,0x55,0x16,0x14,0x45,0x53,0x2b,0x5a,
-    0xfe,0xbd,0x93,0xa9,0x04,0x50,0x02,0x73,0x77,0x01,
-    0x3b,0x78,0x77,0x13,0x08,0x13,0x76,0x79,0x01,0x3c,
-    0x77,0x72,0x02,0x50,0x04,0xa8,0x00,0x01,0x00,0x3b,
-    0x02,0x6a,0x02,0xf8,0x03,0x3b,0x00,0x12,0x00,0x00,
-    0x01,0x22,0x2e,0x02,0x22,0x06,0x07,0x35,0x36,0x33,
-    0x32,0x16,0x16,0x32,0x36,0x37,0x15,0x06,0x02,0x44,
-    0x33,0x3e,0x86,0x3c,0x49,0x63,0x2a,0x4b,0x6e,0x29,
-    0x47,0xa5,0x6a,0x5f,0x26,0x4a,0x02,0x71,0x13,0x4a,
-    0x15,0x41,0x38,0x63,0x6a,0x13,0x5d,0x3f,0x35,0x62,
-    0x68,0x00,0x00,0x00,0x00,0x02,0x00,0x93,0xfe,0x79,
-    0x01,0x2f,0x04,0x3f,0x00,0x06,0x00,0x0a,0x00,0x00,
-    0x13,0x32,0x16,0x15,0x14,0x22,0x34,0x13,0x23,0x13,
-    0x33,0xe1,0x23,0x2b,0x9c,0x8c,0x7d,0x23,0x37,0x04,
-    0x3f,0x34,0x36,0x6b,0xd5,0xfa,0x3a,0x04,0x48,0x00,
-    0x00,0x00,0x00,0x01,0x00,0xa8,0xff,0xec,0x02,0x9a,
-    0x05,0xcb,0x00,0x17,0x00,0x00,0x01,0x15,0x16,0x17,
-    0x07,0x26,0x23,0x22,0x06,0x15,0x10,0x33,0x32,0x37,
-    0x15,0x06,0x07,0x15,0x23,0x35,0x24,0x10,0x25,0x35,
-    0x02,0x08,0x58,0x3a,0x25,0x48,0x33,0x7b,0x73,0xee,
-    0x45,0x54,0x33,0x58,0x52,0xfe,0xf2,0x01,0x0e,0x05,
-    0xcb,0xa8,0x06,0x1f,0x56,0x1d,0xef,0xea,0xfe,0x2b,
-    0x20,0x54,0x1e,0x09,0xd0,0xd5,0x2f,0x03,0xf6,0x37,
-    0xae,0x00,0x00,0x01,0x00,0x50,0x00,0x00,0x02,0xe5,
-    0x05,0xcb,0x00,0x1e,0x00,0x00,0x13,0x11,0x34,0x36,
-    0x20,0x17,0x07,0x26,0x27,0x26,0x23,0x22,0x06,0x15,
-    0x11,0x33,0x15,0x23,0x11,0x14,0x07,0x21,0x15,0x21,
-    0x35,0x36,0x36,0x35,0x11,0x23,0x35,0xee,0x82,0x01,
-    0x11,0x64,0x37,0x33,0x2a,0x27,0x32,0x59,0x4f,0xfa,
-    0xfa,0x79,0x02,0x0a,0xfd,0x7b,0x45,0x4d,0x9e,0x03,
-    0x00,0x01,0x62,0xb8,0xb1,0x58,0x4c,0x2b,0x0f,0x10,
-    0x82,0x8f,0xfe,0xa0,0x56,0xfe,0xe1,0xd6,0x57,0x5e,
-    0x52,0x1d,0xa4,0x76,0x01,0x21,0x56,0x00,0x00,0x02,
-    0x00,0x7d,0x01,0x19,0x03,0xf0,0x04,0x8b,0x00,0x17,
-    0x00,0x29,0x00,0x00,0x00,0x10,0x07,0x17,0x07,0x27,
-    0x06,0x20,0x27,0x07,0x27,0x37,0x26,0x10,0x37,0x27,
-    0x37,0x17,0x36,0x20,0x17,0x37,0x17,0x07,0x25,0x22,
-    0x06,0x15,0x14,0x15,0x14,0x16,0x20,0x36,0x35,0x34,
-    0x35,0x34,0x26,0x23,0x22,0x22,0x03,0xc1,0x59,0x88,
-    0x3a,0x89,0x6b,0xfe,0xe5,0x6a,0x85,0x39,0x85,0x56,
-    0x56,0x87,0x39,0x87,0x6d,0x01,0x19,0x6a,0x87,0x3c,
-    0x88,0xfe,0xc7,0x7b,0xb8,0xb6,0x01,0x0a,0xb9,0xbb,
-    0x7b,0x04,0x08,0x03,0x5e,0xfe,0xea,0x6d,0x89,0x39,
-    0x87,0x56,0x58,0x87,0x3b,0x85,0x6e,0x01,0x12,0x6e,
-    0x89,0x39,0x89,0x5a,0x58,0x87,0x39,0x87,0x45,0xb9,
-    0x7a,0x05,0x05,0x85,0xb6,0xb7,0x84,0x05,0x05,0x79,
-    0xba,0x00,0x00,0x00,0x00,0x01,0x00,0x6a,0x00,0x00,
-    0x02,0xc7,0x05,0xb6,0x00,0x17,0x00,0x00,0x01,0x15,
-    0x23,0x15,0x33,0x15,0x23,0x11,0x23,0x11,0x23,0x35,
-    0x33,0x35,0x27,0x23,0x35,0x33,0x03,0x33,0x13,0x13,
-    0x33,0x03,0x02,0xa8,0xdd,0xdd,0xdd,0x67,0xd7,0xd7,
-    0x02,0xd5,0xbf,0xe2,0x61,0xcf,0xca,0x63,0xe4,0x02,
-    0x8f,0x52,0xc8,0x52,0xfe,0xdd,0x01,0x23,0x52,0xc6,
-    0x02,0x52,0x03,0x27,0xfd,0x02,0x02,0xfe,0xfc,0xd9,
-    0x00,0x02,0x01,0x6a,0xfe,0x14,0x01,0xc9,0x06,0x14,
-    0x00,0x03,0x00,0x07,0x00,0x00,0x01,0x23,0x11,0x33,
-    0x11,0x23,0x11,0x33,0x01,0xc9,0x5f,0x5f,0x5f,0x5f,
-    0x02,0xf6,0x03,0x1e,0xf8,0x00,0x03,0x1f,0x00,0x00,
-    0x00,0x02,0x00,0x52,0x00,0x62,0x02,0x58,0x06,0x14,
-    0x00,0x2a,0x00,0x35,0x00,0x00,0x13,0x34,0x36,0x37,
-    0x26,0x35,0x34,0x36,0x33,0x32,0x16,0x17,0x07,0x26,
-    0x26,0x23,0x22,0x06,0x14,0x1e,0x03,0x14,0x06,0x07,
-    0x16,0x16,0x15,0x14,0x06,0x20,0x27,0x35,0x16,0x33,
-    0x32,0x36,0x34,0x26,0x27,0x27,0x26,0x12,0x06,0x14,
-    0x16,0x17,0x36,0x35,0x34,0x27,0x26,0x27,0x52,0x4e,
-    0x45,0x7f,0x9b,0x78,0x3d,0x51,0x3f,0x27,0x31,0x4a,
-    0x2f,0x51,0x61,0x43,0xdd,0x4e,0x27,0x42,0x35,0x40,
-    0x37,0xa0,0xfe,0xf2,0x58,0x53,0x8c,0x5a,0x6f,0x43,
-    0x63,0x5e,0xa4,0x9b,0x3f,0x69,0x87,0x5c,0x48,0x27,
-    0x60,0x03,0x5a,0x50,0x75,0x1e,0x58,0x82,0x71,0x8c,
-    0x14,0x23,0x4a,0x1d,0x15,0x5a,0x89,0x55,0x80,0x4c,
-    0x58,0x83,0x7e,0x20,0x31,0x66,0x40,0x7b,0x94,0x38,
-    0x64,0x4a,0x69,0x8d,0x58,0x3b,0x37,0x60,0x01,0x28,
-    0x59,0x7e,0x69,0x41,0x35,0x77,0x5e,0x38,0x20,0x33,
-    0x00,0x02,0x01,0x5c,0x05,0x19,0x03,0x0a,0x05,0xbe,
-    0x00,0x07,0x00,0x0f,0x00,0x00,0x00,0x36,0x32,0x16,
-    0x14,0x06,0x22,0x26,0x24,0x36,0x32,0x16,0x14,0x06,
-    0x22,0x26,0x01,0x5c,0x25,0x35,0x23,0x23,0x35,0x25,
-    0x01,0x31,0x24,0x35,0x24,0x24,0x35,0x24,0x05,0x95,
-    0x29,0x29,0x52,0x2a,0x2a,0x52,0x29,0x29,0x52,0x2a,
-    0x2b,0x00,0x00,0x00,0x00,0x03,0x00,0x64,0xff,0xec,
-    0x06,0x44,0x05,0xcb,0x00,0x0b,0x00,0x17,0x00,0x2b,
-    0x00,0x00,0x04,0x24,0x02,0x10,0x12,0x24,0x20,0x04,
-    0x12,0x10,0x02,0x04,0x00,0x02,0x24,0x20,0x04,0x02,
-    0x10,0x12,0x04,0x20,0x24,0x12,0x01,0x22,0x26,0x10,
-    0x36,0x33,0x32,0x17,0x07,0x26,0x23,0x22,0x06,0x15,
-    0x10,0x21,0x32,0x37,0x15,0x06,0x02,0x85,0xfe,0xa2,
-    0xc3,0xc9,0x01,0x5e,0x01,0x91,0x01,0x5f,0xc9,0xc4,
-    0xfe,0xa3,0x01,0xc4,0xac,0xfe,0xcd,0xfe,0x9d,0xfe,
-    0xcc,0xb0,0xb0,0x01,0x31,0x01,0x64,0x01,0x2f,0xb2,
-    0xfd,0x88,0xbb,0xcb,0xde,0xba,0x78,0x6b,0x25,0x62,
-    0x5c,0x8e,0xa1,0x01,0x27,0x55,0x71,0x66,0x14,0xce,
-    0x01,0x5a,0x01,0x8f,0x01,0x5f,0xc9,0xc9,0xfe,0xa2,
-    0xfe,0x71,0xfe,0xa5,0xce,0x03,0x9c,0x01,0x30,0xb7,
-    0xb3,0xfe,0xcd,0xfe,0x9f,0xfe,0xd2,0xb2,0xb1,0x01,
-    0x30,0xfe,0xee,0xe7,0x01,0xa6,0xfa,0x34,0x53,0x2d,
-    0xbe,0xa9,0xfe,0x94,0x2b,0x58,0x2d,0x00,0x00,0x02,
-    0x00,0x39,0x03,0x25,0x01,0xcf,0x05,0xc7,0x00,0x15,
-    0x00,0x1f,0x00,0x00,0x13,0x36,0x32,0x16,0x15,0x11,
-    0x23,0x27,0x23,0x06,0x23,0x22,0x26,0x34,0x36,0x37,
-    0x37,0x35,0x34,0x26,0x22,0x07,0x11,0x14,0x33,0x32,
-    0x36,0x35,0x35,0x07,0x06,0x06,0x73,0x51,0xb8,0x53,
-    0x39,0x0f,0x08,0x45,0x67,0x44,0x56,0x6f,0x79,0x5c,
-    0x30,0x77,0x47,0x5f,0x44,0x4b,0x3e,0x60,0x50,0x05,
-    0x9a,0x2d,0x63,0x6c,0xfe,0x39,0x54,0x60,0x64,0xb0,
-    0x62,0x0b,0x08,0x48,0x4b,0x40,0x27,0xfe,0x81,0x71,
-    0x67,0x5c,0x42,0x07,0x09,0x3f,0x00,0x00,0x00,0x02,
-    0x00,0x52,0x00,0x93,0x03,0x06,0x03,0x8b,0x00,0x06,
-    0x00,0x0d,0x00,0x00,0x01,0x03,0x13,0x07,0x01,0x35,
-    0x01,0x05,0x03,0x13,0x07,0x01,0x35,0x01,0x01,0xae,
-    0xdb,0xdb,0x3d,0xfe,0xe1,0x01,0x1f,0x01,0x95,0xd9,
-    0xd9,0x3b,0xfe,0xdf,0x01,0x21,0x03,0x68,0xfe,0xa8,
-    0xfe,0xa8,0x25,0x01,0x6f,0x1b,0x01,0x6e,0x23,0xfe,
-    0xa8,0xfe,0xa8,0x25,0x01,0x6f,0x1b,0x01,0x6e,0x00,
-    0x00,0x01,0x00,0x3b,0x00,0xfa,0x02,0xe3,0x02,0xfc,
-    0x00,0x05,0x00,0x00,0x25,0x23,0x11,0x21,0x35,0x21,
-    0x02,0xe3,0x52,0xfd,0xaa,0x02,0xa8,0xfa,0x01,0xb0,
-    0x52,0x00,0x00,0x01,0x00,0x35,0x01,0xf6,0x01,0xcf,
-    0x02,0x5c,0x00,0x03,0x00,0x00,0x01,0x21,0x35,0x21,
-    0x01,0xcf,0xfe,0x66,0x01,0x9a,0x01,0xf6,0x66,0x00,
-    0x00,0x04,0x00,0x64,0xff,0xec,0x06,0x44,0x05,0xcb,
-    0x00,0x0b,0x00,0x17,0x00,0x24,0x00,0x2c,0x00,0x00,
-    0x04,0x24,0x02,0x10,0x12,0x24,0x20,0x04,0x12,0x10,
-    0x02,0x04,0x00,0x02,0x24,0x20,0x04,0x02,0x10,0x12,
-    0x04,0x20,0x24,0x12,0x01,0x33,0x32,0x16,0x15,0x14,
-    0x07,0x13,0x23,0x03,0x23,0x11,0x23,0x13,0x11,0x33,
-    0x32,0x36,0x35,0x34,0x23,0x02,0x85,0xfe,0xa2,0xc3,
-    0xc9,0x01,0x5e,0x01,0x91,0x01,0x5f,0xc9,0xc4,0xfe,
-    0xa3,0x01,0xc4,0xac,0xfe,0xcd,0xfe,0x9d,0xfe,0xcc,
-    0xb0,0xb0,0x01,0x31,0x01,0x64,0x01,0x2f,0xb2,0xfc,
-    0x79,0xd3,0x92,0x9b,0x93,0xc6,0x72,0xae,0xae,0x65,
-    0x65,0x70,0x5c,0x67,0xc5,0x14,0xce,0x01,0x5a,0x01,
-    0x8f,0x01,0x5f,0xc9,0xc9,0xfe,0xa2,0xfe,0x71,0xfe,
-    0xa5,0xce,0x03,0x9c,0x01,0x30,0xb7,0xb3,0xfe,0xcd,
-    0xfe,0x9f,0xfe,0xd2,0xb2,0xb1,0x01,0x30,0x02,0x6a,
-    0x7e,0x7f,0xb0,0x40,0xfe,0x7d,0x01,0x68,0xfe,0x98,
-    0x03,0x1a,0xfe,0x9e,0x5e,0x58,0xac,0x00,0x00,0x01,
-    0xff,0xf8,0x06,0x14,0x03,0x52,0x06,0x66,0x00,0x03,
-    0x00,0x00,0x01,0x21,0x35,0x21,0x03,0x52,0xfc,0xa6,
-    0x03,0x5a,0x06,0x14,0x52,0x00,0x00,0x02,0x00,0x8b,
-    0x03,0x75,0x02,0xe1,0x05,0xcb,0x00,0x07,0x00,0x10,
-    0x00,0x00,0x00,0x32,0x16,0x10,0x06,0x22,0x26,0x10,
-    0x00,0x36,0x34,0x26,0x22,0x07,0x06,0x14,0x16,0x01,
-    0x38,0xfc,0xad,0xad,0xff,0xaa,0x01,0x80,0x7c,0x78,
-    0xb3,0x3c,0x3b,0x7a,0x05,0xcb,0xa7,0xfe,0xf8,0xa7,
-    0xa5,0x01,0x0a,0xfe,0xa3,0x7c,0xb9,0x7d,0x40,0x41,
-    0xb4,0x7d,0x00,0x00,0x00,0x02,0x00,0x3b,0x00,0x00,
-    0x02,0xf8,0x04,0xae,0x00,0x0b,0x00,0x0f,0x00,0x00,
-    0x01,0x21,0x15,0x21,0x11,0x23,0x11,0x21,0x35,0x21,
-    0x11,0x33,0x01,0x21,0x35,0x21,0x01,0xc3,0x01,0x35,
-    0xfe,0xcb,0x52,0xfe,0xca,0x01,0x36,0x52,0x01,0x35,
-    0xfd,0x43,0x02,0xbd,0x02,0xfc,0x52,0xfe,0x50,0x01,
-    0xb0,0x52,0x01,0xb2,0xfb,0x52,0x52,0x00,0x00,0x01,
-    0x00,0x31,0x02,0x4a,0x02,0x08,0x05,0xcb,0x00,0x16,
-    0x00,0x00,0x01,0x32,0x16,0x15,0x14,0x06,0x07,0x07,
-    0x21,0x15,0x21,0x35,0x37,0x3e,0x02,0x34,0x26,0x23,
-    0x22,0x07,0x27,0x36,0x01,0x10,0x6e,0x7c,0x4b,0x88,
-    0x91,0x01,0x72,0xfe,0x29,0xb2,0x46,0x54,0x1f,0x4c,
-    0x42,0x58,0x4c,0x37,0x5f,0x05,0xcb,0x7c,0x6c,0x56,
-    0x9b,0xa6,0xb0,0x52,0x4e,0xdf,0x56,0x7e,0x57,0x84,
-    0x4f,0x52,0x3d,0x6b,0x00,0x01,0x00,0x2f,0x02,0x39,
-    0x02,0x0e,0x05,0xcd,0x00,0x1f,0x00,0x00,0x13,0x36,
-    0x32,0x16,0x15,0x14,0x06,0x07,0x15,0x16,0x15,0x14,
-    0x06,0x23,0x22,0x27,0x35,0x16,0x32,0x36,0x34,0x26,
-    0x23,0x23,0x35,0x33,0x32,0x36,0x34,0x26,0x22,0x07,
-    0x2f,0x63,0xe6,0x7a,0x49,0x41,0xa6,0x96,0x7e,0x65,
-    0x60,0x5e,0xc4,0x59,0x68,0x65,0x3d,0x41,0x54,0x5d,
-    0x4f,0x9b,0x4a,0x05,0x73,0x5a,0x7a,0x6c,0x48,0x6a,
-    0x18,0x09,0x2e,0xb3,0x6e,0x8c,0x2b,0x5f,0x34,0x57,
-    0xa8,0x5e,0x51,0x5f,0x92,0x49,0x48,0x00,0x00,0x00,
-    0x00,0x01,0x01,0xb2,0x04,0xd9,0x02,0xee,0x06,0x21,
-    0x00,0x08,0x00,0x00,0x01,0x15,0x06,0x06,0x07,0x23,
-    0x35,0x36,0x37,0x02,0xee,0x25,0xa1,0x47,0x2f,0x7e,
-    0x41,0x06,0x21,0x11,0x42,0xba,0x3b,0x15,0xa4,0x8f,
-    0x00,0x01,0x00,0x91,0xfe,0x14,0x02,0xd9,0x04,0x3d,
-    0x00,0x17,0x00,0x00,0x21,0x23,0x27,0x23,0x06,0x06,
-    0x23,0x22,0x27,0x23,0x16,0x15,0x11,0x23,0x11,0x33,
-    0x11,0x10,0x33,0x32,0x36,0x35,0x11,0x33,0x02,0xd9,
-    0x50,0x0c,0x08,0x21,0x7a,0x44,0x76,0x30,0x09,0x09,
-    0x5f,0x5f,0x9d,0x7c,0x72,0x5e,0x98,0x50,0x5c,0x6a,
-    0x78,0x3f,0xfe,0x75,0x06,0x29,0xfd,0x23,0xfe,0xe4,
-    0xc8,0xdd,0x02,0x54,0x00,0x00,0x00,0x01,0x00,0x96,
-    0xfe,0xfc,0x03,0x00,0x06,0x14,0x00,0x0e,0x00,0x00,
-    0x01,0x23,0x11,0x23,0x11,0x23,0x11,0x06,0x23,0x22,
-    0x26,0x10,0x12,0x33,0x21,0x03,0x00,0x5e,0x92,0x5e,
-    0x1e,0x27,0x6f,0x68,0x80,0x88,0x01,0x62,0xfe,0xfc,
-    0x06,0xb8,0xf9,0x48,0x03,0x33,0x12,0xf5,0x02,0x02,
-    0x01,0x00,0x00,0x01,0x00,0x85,0x02,0x66,0x01,0x21,
-    0x03,0x3b,0x00,0x06,0x00,0x00,0x12,0x32,0x15,0x14,
-    0x06,0x23,0x22,0x85,0x9c,0x2b,0x23,0x4e,0x03,0x3b,
-    0x6a,0x36,0x35,0x00,0x00,0x01,0x00,0x3b,0xfe,0x14,
-    0x01,0x7b,0x00,0x00,0x00,0x11,0x00,0x00,0x01,0x14,
-    0x06,0x23,0x22,0x27,0x35,0x16,0x33,0x32,0x36,0x34,
-    0x26,0x27,0x37,0x33,0x07,0x16,0x01,0x7b,0x7b,0x6f,
-    0x3d,0x19,0x21,0x2d,0x4c,0x4c,0x54,0x52,0x48,0x4b,
-    0x33,0xa0,0xfe,0xdd,0x62,0x67,0x0b,0x4e,0x0b,0x41,
-    0x72,0x3e,0x0d,0xa0,0x73,0x27,0x00,0x00,0x00,0x01,
-    0x00,0x52,0x02,0x4a,0x01,0x8d,0x05,0xb6,0x00,0x0a,
-    0x00,0x00,0x01,0x23,0x11,0x34,0x37,0x06,0x06,0x07,
-    0x27,0x37,0x33,0x01,0x8d,0x56,0x06,0x20,0x36,0x64,
-    0x31,0xed,0x4e,0x02,0x4a,0x02,0x66,0x56,0x54,0x1f,
-    0x2b,0x47,0x41,0xac,0x00,0x00,0x00,0x02,0x00,0x46,
-    0x03,0x25,0x02,0x25,0x05,0xc7,0x00,0x07,0x00,0x10,
-    0x00,0x00,0x12,0x36,0x32,0x16,0x10,0x06,0x22,0x26,
-    0x13,0x22,0x11,0x14,0x16,0x32,0x36,0x10,0x26,0x46,
-    0x7f,0xe5,0x7b,0x7a,0xeb,0x7a,0xef,0x95,0x47,0x9f,
-    0x45,0x47,0x05,0x17,0xb0,0xa8,0xfe,0xb3,0xad,0xac,
-    0x01,0xac,0xfe,0xfa,0x8a,0x7e,0x7c,0x01,0x16,0x7c,
-    0x00,0x02,0x00,0x52,0x00,0x93,0x03,0x06,0x03,0x8b,
-    0x00,0x06,0x00,0x0d,0x00,0x00,0x01,0x15,0x01,0x27,
-    0x13,0x03,0x37,0x01,0x15,0x01,0x27,0x13,0x03,0x37,
-    0x01,0xae,0xfe,0xdf,0x3b,0xd9,0xd9,0x3b,0x02,0x79,
-    0xfe,0xe1,0x3d,0xdb,0xdb,0x3d,0x02,0x1d,0x1b,0xfe,
-    0x91,0x25,0x01,0x58,0x01,0x58,0x23,0xfe,0x92,0x1b,
-    0xfe,0x91,0x25,0x01,0x58,0x01,0x58,0x23,0x00,0x04,
-    0x00,0x34,0x00,0x00,0x05,0x18,0x05,0xb6,0x00,0x0a,
-    0x00,0x0e,0x00,0x19,0x00,0x20,0x00,0x00,0x01,0x23,
-    0x11,0x34,0x37,0x06,0x06,0x07,0x27,0x37,0x33,0x13,
-    0x23,0x01,0x33,0x13,0x33,0x15,0x23,0x15,0x23,0x35,
-    0x21,0x35,0x01,0x33,0x03,0x11,0x34,0x37,0x06,0x06,
-    0x03,0x01,0x6f,0x56,0x06,0x20,0x36,0x64,0x31,0xed,
-    0x4e,0x01,0x5c,0x03,0x00,0x5c,0x44,0x64,0x64,0x56,
-    0xfe,0xb2,0x01,0x54,0x50,0x56,0x04,0x04,0x4c,0x9d,
-    0x02,0x4a,0x02,0x66,0x56,0x54,0x1f,0x2b,0x47,0x41,
-    0xac,0xfa,0x4a,0x05,0xb6,0xfb,0x6e,0x52,0xd1,0xd1,
-    0x41,0x02,0x60,0xfd,0xb1,0x01,0x1a,0x7f,0x2b,0x0c,
-    0x9a,0xfe,0xe2,0x00,0x00,0x03,0x00,0x34,0x00,0x00,
-    0x05,0x37,0x05,0xb6,0x00,0x0a,0x00,0x0e,0x00,0x25,
-    0x00,0x00,0x01,0x23,0x11,0x34,0x37,0x06,0x06,0x07,
-    0x27,0x37,0x33,0x03,0x23,0x01,0x33,0x03,0x32,0x16,
-    0x15,0x14,0x06,0x07,0x07,0x21,0x15,0x21,0x35,0x37,
-    0x3e,0x02,0x34,0x26,0x23,0x22,0x07,0x27,0x36,0x01,
-    0x6f,0x56,0x06,0x20,0x36,0x64,0x31,0xed,0x4e,0x17,
-    0x5c,0x03,0x00,0x5c,0x19,0x6e,0x7c,0x4b,0x88,0x91,
-    0x01,0x72,0xfe,0x29,0xb2,0x46,0x54,0x1f,0x4c,0x42,
-    0x58,0x4c,0x37,0x5f,0x02,0x4a,0x02,0x66,0x56,0x54,
-    0x1f,0x2b,0x47,0x41,0xac,0xfa,0x4a,0x05,0xb6,0xfd,
-    0xcc,0x7c,0x6c,0x56,0x9b,0xa6,0xb0,0x52,0x4e,0xdf,
-    0x56,0x7e,0x57,0x84,0x4f,0x52,0x3d,0x6b,0x00,0x04,
-    0x00,0x2f,0x00,0x00,0x05,0x3f,0x05,0xcd,0x00,0x1f,
-    0x00,0x23,0x00,0x2e,0x00,0x35,0x00,0x00,0x13,0x36,
-    0x32,0x16,0x15,0x14,0x06,0x07,0x15,0x16,0x15,0x14,
-    0x06,0x23,0x22,0x27,0x35,0x16,0x32,0x36,0x34,0x26,
-    0x23,0x23,0x35,0x33,0x32,0x36,0x34,0x26,0x22,0x07,
-    0x01,0x23,0x01,0x33,0x13,0x33,0x15,0x23,0x15,0x23,
-    0x35,0x21,0x35,0x01,0x33,0x03,0x11,0x34,0x37,0x06,
-    0x06,0x03,0x2f,0x63,0xe6,0x7a,0x49,0x41,0xa6,0x96,
-    0x7e,0x65,0x60,0x5e,0xc4,0x59,0x68,0x65,0x3d,0x41,
-    0x54,0x5d,0x4f,0x9b,0x4a,0x01,0x35,0x5c,0x03,0x00,
-    0x5c,0x42,0x64,0x64,0x56,0xfe,0xb2,0x01,0x54,0x50,
-    0x56,0x04,0x05,0x4b,0x9d,0x05,0x73,0x5a,0x7a,0x6c,
-    0x48,0x6a,0x18,0x09,0x2e,0xb3,0x6e,0x8c,0x2b,0x5f,
-    0x34,0x57,0xa8,0x5e,0x51,0x5f,0x92,0x49,0x48,0xfa,
-    0xd1,0x05,0xb6,0xfb,0x6e,0x52,0xd1,0xd1,0x41,0x02,
-    0x60,0xfd,0xb1,0x01,0x1a,0x7f,0x2b,0x0c,0x9a,0xfe,
-    0xe2,0x00,0x00,0x02,0x00,0x2f,0xfe,0x64,0x02,0x1f,
-    0x04,0x3f,0x00,0x06,0x00,0x1f,0x00,0x00,0x01,0x32,
-    0x14,0x22,0x35,0x34,0x36,0x13,0x15,0x14,0x06,0x06,
-    0x07,0x06,0x14,0x16,0x33,0x32,0x36,0x37,0x17,0x06,
-    0x22,0x26,0x10,0x37,0x36,0x37,0x36,0x36,0x35,0x35,
-    0x01,0x58,0x4e,0x9c,0x2b,0x4e,0x2a,0x7f,0x16,0x31,
-    0x5b,0x4f,0x35,0x4f,0x2f,0x2f,0x67,0xfe,0x8b,0x31,
-    0x1a,0x55,0x3a,0x2e,0x04,0x3f,0xd5,0x6b,0x36,0x34,
-    0xfe,0x82,0x34,0x73,0x92,0xc3,0x31,0x6c,0xed,0x7d,
-    0x1d,0x1f,0x4c,0x4a,0xa9,0x01,0x26,0x69,0x39,0x81,
-    0x5b,0x86,0x63,0x27,0x00,0x00,0x00,0x03,0x00,0x00,
-    0x00,0x00,0x03,0x2d,0x07,0x73,0x00,0x09,0x00,0x11,
-    0x00,0x18,0x00,0x00,0x13,0x33,0x16,0x16,0x17,0x15,
-    0x23,0x26,0x26,0x27,0x01,0x23,0x03,0x21,0x03,0x23,
-    0x01,0x33,0x13,0x03,0x26,0x27,0x06,0x07,0x03,0x92,
-    0x7d,0x1d,0x6a,0x38,0x30,0x3f,0xa8,0x25,0x02,0x9b,
-    0x64,0x81,0xfe,0x9d,0x7f,0x66,0x01,0x60,0x65,0x6c,
-    0x81,0x16,0x09,0x09,0x13,0x7d,0x07,0x73,0x43,0xaa,
-    0x46,0x15,0x33,0xbf,0x45,0xf8,0x9e,0x02,0x12,0xfd,
-    0xee,0x05,0xb6,0xfc,0xbf,0x02,0x21,0x67,0x47,0x5b,
-    0x53,0xfd,0xdf,0x00,0x00,0x00,0x00,0x03,0x00,0x00,
-    0x00,0x00,0x03,0x2d,0x07,0x73,0x00,0x08,0x00,0x10,
-    0x00,0x17,0x00,0x00,0x01,0x15,0x06,0x06,0x07,0x23,
-    0x35,0x36,0x37,0x01,0x23,0x03,0x21,0x03,0x23,0x01,
-    0x33,0x13,0x03,0x26,0x27,0x06,0x07,0x03,0x02,0x8f,
-    0x25,0xa2,0x46,0x2f,0x7e,0x41,0x01,0x1b,0x64,0x81,
-    0xfe,0x9d,0x7f,0x66,0x01,0x60,0x65,0x6c,0x81,0x16,
-    0x09,0x09,0x13,0x7d,0x07,0x73,0x11,0x42,0xba,0x3b,
-    0x15,0xa4,0x8f,0xf8,0x8d,0x02,0x12,0xfd,0xee,0x05,
-    0xb6,0xfc,0xbf,0x02,0x21,0x67,0x47,0x5b,0x53,0xfd,
-    0xdf,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x03,0x2d,
-    0x07,0x73,0x00,0x11,0x00,0x19,0x00,0x20,0x00,0x00,
-    0x01,0x23,0x26,0x27,0x27,0x06,0x07,0x06,0x07,0x23,
-    0x35,0x36,0x37,0x33,0x16,0x17,0x16,0x17,0x13,0x23,
-    0x03,0x21,0x03,0x23,0x01,0x33,0x13,0x03,0x26,0x27,
-    0x06,0x07,0x03,0x02,0x7e,0x2f,0x2a,0x31,0x61,0x13,
-    0x2c,0x51,0x31,0x2b,0x79,0x41,0x5f,0x17,0x37,0x3c,
-    0x34,0xaf,0x64,0x81,0xfe,0x9d,0x7f,0x66,0x01,0x60,
-    0x65,0x6c,0x81,0x16,0x09,0x09,0x13,0x7d,0x06,0x2b,
-    0x2a,0x3b,0x70,0x15,0x33,0x5e,0x2f,0x13,0xa8,0x8d,
-    0x36,0x5b,0x5f,0x45,0xf9,0xc2,0x02,0x12,0xfd,0xee,
-    0x05,0xb6,0xfc,0xbf,0x02,0x21,0x67,0x47,0x5b,0x53,
-    0xfd,0xdf,0x00,0x03,0x00,0x00,0x00,0x00,0x03,0x2d,
-    0x07,0x00,0x00,0x15,0x00,0x1d,0x00,0x24,0x00,0x00,
-    0x01,0x22,0x26,0x27,0x26,0x22,0x06,0x07,0x23,0x36,
-    0x36,0x33,0x32,0x16,0x17,0x16,0x33,0x32,0x37,0x33,
-    0x06,0x06,0x13,0x23,0x03,0x21,0x03,0x23,0x01,0x33,
-    0x13,0x03,0x26,0x27,0x06,0x07,0x03,0x02,0x0f,0x20,
-    0x4a,0x1c,0x4c,0x40,0x2c,0x09,0x4a,0x0c,0x54,0x46,
-    0x20,0x49,0x1b,0x49,0x25,0x3b,0x14,0x4a,0x09,0x54,
-    0xdb,0x64,0x81,0xfe,0x9d,0x7f,0x66,0x01,0x60,0x65,
-    0x6c,0x81,0x16,0x09,0x09,0x13,0x7d,0x06,0x2d,0x28,
-    0x17,0x40,0x46,0x3b,0x64,0x6f,0x28,0x18,0x3f,0x81,
-    0x65,0x6e,0xf9,0xd3,0x02,0x12,0xfd,0xee,0x05,0xb6,
-    0xfc,0xbf,0x02,0x21,0x67,0x47,0x5b,0x53,0xfd,0xdf,
-    0x00,0x04,0x00,0x00,0x00,0x00,0x03,0x2d,0x07,0x10,
-    0x00,0x07,0x00,0x0f,0x00,0x17,0x00,0x1e,0x00,0x00,
-    0x12,0x36,0x32,0x16,0x14,0x06,0x22,0x26,0x24,0x36,
-    0x32,0x16,0x14,0x06,0x22,0x26,0x01,0x23,0x03,0x21,
-    0x03,0x23,0x01,0x33,0x13,0x03,0x26,0x27,0x06,0x07,
-    0x03,0xbf,0x25,0x35,0x23,0x23,0x35,0x25,0x01,0x31,
-    0x24,0x35,0x24,0x24,0x35,0x24,0x01,0x3d,0x64,0x81,
-    0xfe,0x9d,0x7f,0x66,0x01,0x60,0x65,0x6c,0x81,0x16,
-    0x09,0x09,0x13,0x7d,0x06,0xe7,0x29,0x29,0x52,0x2a,
-    0x2a,0x52,0x29,0x29,0x52,0x2a,0x2b,0xf9,0x6a,0x02,
-    0x12,0xfd,0xee,0x05,0xb6,0xfc,0xbf,0x02,0x21,0x67,
-    0x47,0x5b,0x53,0xfd,0xdf,0x00,0x00,0x03,0x00,0x00,
-    0x00,0x00,0x03,0x2d,0x06,0xeb,0x00,0x0f,0x00,0x17,
-    0x00,0x1e,0x00,0x00,0x00,0x26,0x34,0x36,0x32,0x16,
-    0x14,0x06,0x07,0x01,0x23,0x03,0x21,0x03,0x23,0x01,
-    0x12,0x06,0x14,0x16,0x32,0x36,0x34,0x26,0x13,0x03,
-    0x26,0x27,0x06,0x07,0x03,0x01,0x14,0x46,0x6b,0xb3,
-    0x70,0x49,0x40,0x01,0x5a,0x64,0x81,0xfe,0x9d,0x7f,
-    0x66,0x01,0x53,0x0c,0x43,0x3e,0x71,0x43,0x3f,0x62,
-    0x81,0x16,0x09,0x09,0x13,0x7d,0x05,0x8f,0x5d,0x9a,
-    0x65,0x64,0x9a,0x60,0x10,0xfa,0x83,0x02,0x12,0xfd,
-    0xee,0x05,0x7e,0x01,0x27,0x41,0x69,0x3f,0x40,0x69,
-    0x40,0xfb,0xd0,0x02,0x21,0x67,0x47,0x5b,0x53,0xfd,
-    0xdf,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x04,0x1f,
-    0x05,0xb6,0x00,0x0f,0x00,0x13,0x00,0x00,0x01,0x21,
-    0x11,0x21,0x15,0x21,0x11,0x21,0x15,0x21,0x11,0x21,
-    0x03,0x23,0x01,0x21,0x01,0x11,0x23,0x03,0x04,0x1f,
-    0xfe,0x50,0x01,0x97,0xfe,0x69,0x01,0xb0,0xfd,0xed,
-    0xfe,0xf4,0x98,0x68,0x01,0xb2,0x02,0x6d,0xfd,0xed,
-    0x1c,0xd5,0x05,0x56,0xfd,0xd7,0x5e,0xfd,0x8f,0x5e,
-    0x02,0x12,0xfd,0xee,0x05,0xb6,0xfc,0xbf,0x02,0xdf,
-    0xfd,0x21,0x00,0x01,0x00,0x6f,0xfe,0x14,0x03,0x29,
-    0x05,0xcd,0x00,0x2c,0x00,0x00,0x01,0x22,0x02,0x11,
-    0x14,0x15,0x10,0x12,0x33,0x32,0x33,0x32,0x37,0x15,
-    0x06,0x23,0x07,0x16,0x15,0x14,0x06,0x23,0x22,0x27,
-    0x35,0x16,0x33,0x32,0x36,0x34,0x26,0x27,0x37,0x26,
-    0x02,0x11,0x34,0x35,0x10,0x12,0x33,0x32,0x17,0x07,
-    0x26,0x02,0x3d,0xa6,0xc2,0xc8,0xa4,0x02,0x03,0x70,
-    0x54,0x4e,0x7e,0x2a,0xa0,0x7b,0x6f,0x3d,0x19,0x21,
-    0x2d,0x4c,0x4c,0x54,0x52,0x42,0xb5,0xd2,0xf9,0xd7,
-    0x85,0x65,0x2d,0x54,0x05,0x6f,0xfe,0xa4,0xfe,0xca,
-    0x06,0x05,0xfe,0xdc,0xfe,0x9c,0x29,0x5a,0x2d,0x5f,
-    0x27,0x89,0x62,0x67,0x0b,0x4e,0x0b,0x41,0x72,0x3e,
-    0x0d,0x92,0x21,0x01,0x8b,0x01,0x35,0x06,0x06,0x01,
-    0x5f,0x01,0x8f,0x3e,0x56,0x36,0x00,0x00,0x00,0x02,
-    0x00,0xa0,0x00,0x00,0x02,0xb2,0x07,0x73,0x00,0x09,
-    0x00,0x15,0x00,0x00,0x13,0x33,0x16,0x16,0x17,0x15,
-    0x23,0x26,0x26,0x27,0x01,0x21,0x11,0x21,0x15,0x21,
-    0x11,0x21,0x15,0x21,0x11,0x21,0xc7,0x7d,0x1d,0x6a,
-    0x38,0x30,0x3f,0xa8,0x25,0x01,0xeb,0xfe,0x50,0x01,
-    0x98,0xfe,0x68,0x01,0xb0,0xfd,0xee,0x02,0x12,0x07,
-    0x73,0x43,0xaa,0x46,0x15,0x33,0xbf,0x45,0xfd,0xf6,
-    0xfd,0xd5,0x5e,0xfd,0x8f,0x5e,0x05,0xb6,0x00,0x02,
-    0x00,0xa0,0x00,0x00,0x02,0xb2,0x07,0x73,0x00,0x08,
-    0x00,0x14,0x00,0x00,0x01,0x15,0x06,0x06,0x07,0x23,
-    0x35,0x36,0x37,0x13,0x21,0x11,0x21,0x15,0x21,0x11,
-    0x21,0x15,0x21,0x11,0x21,0x02,0x80,0x25,0xa1,0x47,
-    0x2f,0x7e,0x41,0xaf,0xfe,0x50,0x01,0x98,0xfe,0x68,
-    0x01,0xb0,0xfd,0xee,0x02,0x12,0x07,0x73,0x11,0x42,
-    0xba,0x3b,0x15,0xa4,0x8f,0xfd,0xe5,0xfd,0xd5,0x5e,
-    0xfd,0x8f,0x5e,0x05,0xb6,0x00,0x00,0x00,0x00,0x02,
-    0x00,0xa0,0x00,0x00,0x02,0xb2,0x07,0x73,0x00,0x11,
-    0x00,0x1d,0x00,0x00,0x01,0x23,0x26,0x27,0x27,0x06,
-    0x07,0x06,0x07,0x23,0x35,0x36,0x37,0x33,0x16,0x17,
-    0x16,0x17,0x17,0x21,0x11,0x21,0x15,0x21,0x11,0x21,
-    0x15,0x21,0x11,0x21,0x02,0x8c,0x2f,0x2a,0x31,0x61,
-    0x13,0x2c,0x51,0x31,0x2b,0x79,0x41,0x5f,0x17,0x37,
-    0x3c,0x34,0x26,0xfe,0x50,0x01,0x98,0xfe,0x68,0x01,
-    0xb0,0xfd,0xee,0x02,0x12,0x06,0x2b,0x2a,0x3b,0x70,
-    0x15,0x33,0x5e,0x2f,0x13,0xa8,0x8d,0x36,0x5b,0x5f,
-    0x45,0xe6,0xfd,0xd5,0x5e,0xfd,0x8f,0x5e,0x05,0xb6,
-    0x00,0x00,0x00,0x03,0x00,0xa0,0x00,0x00,0x02,0xb2,
-    0x07,0x10,0x00,0x07,0x00,0x0f,0x00,0x1b,0x00,0x00,
-    0x12,0x36,0x32,0x16,0x14,0x06,0x22,0x26,0x24,0x36,
-    0x32,0x16,0x14,0x06,0x22,0x26,0x13,0x21,0x11,0x21,
-    0x15,0x21,0x11,0x21,0x15,0x21,0x11,0x21,0xca,0x25,
-    0x35,0x23,0x23,0x35,0x25,0x01,0x31,0x24,0x35,0x24,
-    0x24,0x35,0x24,0xb7,0xfe,0x50,0x01,0x98,0xfe,0x68,
-    0x01,0xb0,0xfd,0xee,0x02,0x12,0x06,0xe7,0x29,0x29,
-    0x52,0x2a,0x2a,0x52,0x29,0x29,0x52,0x2a,0x2b,0xfe,
-    0xc2,0xfd,0xd5,0x5e,0xfd,0x8f,0x5e,0x05,0xb6,0x00,
-    0x00,0x00,0x00,0x02,0xff,0xde,0x00,0x00,0x01,0x1a,
-    0x07,0x73,0x00,0x09,0x00,0x0d,0x00,0x00,0x03,0x33,
-    0x16,0x16,0x17,0x15,0x23,0x26,0x26,0x27,0x01,0x23,
-    0x11,0x33,0x22,0x7d,0x1d,0x6a,0x38,0x30,0x3f,0xa8,
-    0x25,0x01,0x24,0x62,0x62,0x07,0x73,0x43,0xaa,0x46,
-    0x15,0x33,0xbf,0x45,0xf8,0x9e,0x05,0xb6,0x00,0x02,
-    0x00,0x9a,0x00,0x00,0x01,0xd6,0x07,0x73,0x00,0x08,
-    0x00,0x0c,0x00,0x00,0x01,0x15,0x06,0x06,0x07,0x23,
-    0x35,0x36,0x37,0x03,0x23,0x11,0x33,0x01,0xd6,0x25,
-    0xa1,0x47,0x2f,0x7e,0x41,0x57,0x62,0x62,0x07,0x73,
-    0x11,0x42,0xba,0x3b,0x15,0xa4,0x8f,0xf8,0x8d,0x05,
-    0xb6,0x00,0x00,0x00,0x00,0x02,0xff,0xe6,0x00,0x00,
-    0x01,0xbd,0x07,0x73,0x00,0x11,0x00,0x15,0x00,0x00,
-    0x01,0x23,0x26,0x27,0x27,0x06,0x07,0x06,0x07,0x23,
-    0x35,0x36,0x37,0x33,0x16,0x17,0x16,0x17,0x03,0x23,
-    0x11,0x33,0x01,0xbd,0x2f,0x2a,0x31,0x61,0x13,0x2c,
-    0x51,0x31,0x2b,0x7a,0x40,0x5f,0x17,0x37,0x3c,0x34,
-    0xbb,0x62,0x62,0x06,0x2b,0x2a,0x3b,0x70,0x15,0x33,
-    0x5e,0x2f,0x13,0xa8,0x8d,0x36,0x5b,0x5f,0x45,0xf9,
-    0xc2,0x05,0xb6,0x00,0x00,0x03,0xff,0xfb,0x00,0x00,
-    0x01,0xa9,0x07,0x10,0x00,0x07,0x00,0x0f,0x00,0x13,
-    0x00,0x00,0x02,0x36,0x32,0x16,0x14,0x06,0x22,0x26,
-    0x24,0x36,0x32,0x16,0x14,0x06,0x22,0x26,0x03,0x23,
-    0x11,0x33,0x05,0x25,0x35,0x23,0x23,0x35,0x25,0x01,
-    0x31,0x24,0x35,0x24,0x24,0x35,0x24,0x2a,0x62,0x62,
-    0x06,0xe7,0x29,0x29,0x52,0x2a,0x2a,0x52,0x29,0x29,
-    0x52,0x2a,0x2b,0xf9,0x6a,0x05,0xb6,0x00,0x00,0x00,
-    0x00,0x02,0x00,0x3d,0x00,0x00,0x03,0x75,0x05,0xb6,
-    0x00,0x0b,0x00,0x17,0x00,0x00,0x13,0x21,0x32,0x12,
-    0x11,0x10,0x21,0x21,0x11,0x23,0x35,0x33,0x13,0x11,
-    0x33,0x15,0x23,0x11,0x33,0x20,0x11,0x10,0x02,0x23,
-    0xa0,0x01,0x0a,0xe2,0xe9,0xfe,0x2f,0xfe,0xfc,0x63,
-    0x63,0x62,0xe1,0xe1,0x9c,0x01,0x70,0xb7,0xb1,0x05,
-    0xb6,0xfe,0x93,0xfe,0xa0,0xfd,0x17,0x02,0xbc,0x5b,
-    0x02,0x45,0xfd,0xbb,0x5b,0xfd,0x9e,0x02,0x89,0x01,
-    0x36,0x01,0x43,0x00,0x00,0x02,0x00,0xa0,0x00,0x00,
-    0x03,0xa2,0x07,0x00,0x00,0x15,0x00,0x25,0x00,0x00,
-    0x01,0x22,0x26,0x27,0x26,0x22,0x06,0x07,0x23,0x36,
-    0x36,0x33,0x32,0x16,0x17,0x16,0x33,0x32,0x37,0x33,
-    0x06,0x06,0x13,0x23,0x01,0x23,0x16,0x15,0x11,0x23,
-    0x11,0x33,0x01,0x33,0x26,0x35,0x11,0x33,0x02,0xad,
-    0x20,0x4a,0x1c,0x4c,0x40,0x2c,0x09,0x4a,0x0c,0x54,
-    0x46,0x20,0x49,0x1b,0x49,0x25,0x3b,0x14,0x4a,0x09,
-    0x54,0xb2,0x7d,0xfd,0xd7,0x08,0x0c,0x60,0x7f,0x02,
-    0x25,0x06,0x08,0x60,0x06,0x2d,0x28,0x17,0x40,0x46,
-    0x3b,0x64,0x6f,0x28,0x18,0x3f,0x81,0x65,0x6e,0xf9,
-    0xd3,0x05,0x1f,0x89,0x7d,0xfb,0xe7,0x05,0xb6,0xfa,
-    0xf0,0xae,0x64,0x03,0xfe,0x00,0x00,0x00,0x00,0x03,
-    0x00,0x6f,0xff,0xec,0x03,0xba,0x07,0x73,0x00,0x09,
-    0x00,0x13,0x00,0x1b,0x00,0x00,0x01,0x33,0x16,0x16,
-    0x17,0x15,0x23,0x26,0x26,0x27,0x13,0x32,0x17,0x16,
-    0x10,0x02,0x20,0x02,0x11,0x10,0x00,0x02,0x20,0x02,
-    0x10,0x12,0x20,0x12,0x01,0x1b,0x7d,0x1d,0x6a,0x38,
-    0x30,0x3f,0xa8,0x25,0xfc,0xcd,0x6a,0x6c,0xd9,0xfe,
-    0x63,0xd5,0x02,0xe5,0xa0,0xfe,0xc3,0xa2,0xa3,0x01,
-    0x3a,0xa2,0x07,0x73,0x43,0xaa,0x46,0x15,0x33,0xbf,
-    0x45,0xfe,0x69,0xc3,0xc2,0xfd,0x2b,0xfe,0x7b,0x01,
-    0x89,0x01,0x6a,0x02,0xec,0xfe,0x57,0x01,0x4b,0xfe,
-    0xb3,0xfd,0x78,0xfe,0xb2,0x01,0x4b,0x00,0x00,0x00,
-    0x00,0x03,0x00,0x6f,0xff,0xec,0x03,0xba,0x07,0x73,
-    0x00,0x08,0x00,0x12,0x00,0x1a,0x00,0x00,0x01,0x15,
-    0x06,0x06,0x07,0x23,0x35,0x36,0x37,0x03,0x32,0x17,
-    0x16,0x10,0x02,0x20,0x02,0x11,0x10,0x00,0x02,0x20,
-    0x02,0x10,0x12,0x20,0x12,0x03,0x07,0x25,0xa2,0x46,
-    0x2f,0x7e,0x41,0x73,0xcd,0x6a,0x6c,0xd9,0xfe,0x63,
-    0xd5,0x02,0xe5,0xa0,0xfe,0xc3,0xa2,0xa3,0x01,0x3a,
-    0xa2,0x07,0x73,0x11,0x42,0xba,0x3b,0x15,0xa4,0x8f,
-    0xfe,0x58,0xc3,0xc2,0xfd,0x2b,0xfe,0x7b,0x01,0x89,
-    0x01,0x6a,0x02,0xec,0xfe,0x57,0x01,0x4b,0xfe,0xb3,
-    0xfd,0x78,0xfe,0xb2,0x01,0x4b,0x00,0x00,0x00,0x03,
-    0x00,0x6f,0xff,0xec,0x03,0xba,0x07,0x73,0x00,0x11,
-    0x00,0x1b,0x00,0x23,0x00,0x00,0x01,0x23,0x26,0x27,
-    0x27,0x06,0x07,0x06,0x07,0x23,0x35,0x36,0x37,0x33,
-    0x16,0x17,0x16,0x17,0x07,0x32,0x17,0x16,0x10,0x02,
-    0x20,0x02,0x11,0x10,0x00,0x02,0x20,0x02,0x10,0x12,
-    0x20,0x12,0x02,0xff,0x2f,0x2a,0x31,0x61,0x13,0x2c,
-    0x51,0x31,0x2b,0x7a,0x40,0x5f,0x17,0x37,0x3c,0x34,
-    0xe8,0xcd,0x6a,0x6c,0xd9,0xfe,0x63,0xd5,0x02,0xe5,
-    0xa0,0xfe,0xc3,0xa2,0xa3,0x01,0x3a,0xa2,0x06,0x2b,
-    0x2a,0x3b,0x70,0x15,0x33,0x5e,0x2f,0x13,0xa8,0x8d,
-    0x36,0x5b,0x5f,0x45,0x73,0xc3,0xc2,0xfd,0x2b,0xfe,
-    0x7b,0x01,0x89,0x01,0x6a,0x02,0xec,0xfe,0x57,0x01,
-    0x4b,0xfe,0xb3,0xfd,0x78,0xfe,0xb2,0x01,0x4b,0x00,
-    0x00,0x03,0x00,0x6f,0xff,0xec,0x03,0xba,0x07,0x00,
-    0x00,0x15,0x00,0x1f,0x00,0x27,0x00,0x00,0x01,0x22,
-    0x26,0x27,0x26,0x22,0x06,0x07,0x23,0x36,0x36,0x33,
-    0x32,0x16,0x17,0x16,0x33,0x32,0x37,0x33,0x06,0x06,
-    0x07,0x32,0x17,0x16,0x10,0x02,0x20,0x02,0x11,0x10,
-    0x00,0x02,0x20,0x02,0x10,0x12,0x20,0x12,0x02,0x96,
-    0x20,0x4a,0x1c,0x4c,0x40,0x2c,0x09,0x4a,0x0c,0x54,
-    0x46,0x20,0x49,0x1b,0x49,0x25,0x3b,0x14,0x4a,0x09,
-    0x54,0xc2,0xcd,0x6a,0x6c,0xd9,0xfe,0x63,0xd5,0x02,
-    0xe5,0xa0,0xfe,0xc3,0xa2,0xa3,0x01,0x3a,0xa2,0x06,
-    0x2d,0x28,0x17,0x40,0x46,0x3b,0x64,0x6f,0x28,0x18,
-    0x3f,0x81,0x65,0x6e,0x62,0xc3,0xc2,0xfd,0x2b,0xfe,
-    0x7b,0x01,0x89,0x01,0x6a,0x02,0xec,0xfe,0x57,0x01,
-    0x4b,0xfe,0xb3,0xfd,0x78,0xfe,0xb2,0x01,0x4b,0x00,
-    0x00,0x04,0x00,0x6f,0xff,0xec,0x03,0xba,0x07,0x10,
-    0x00,0x07,0x00,0x0f,0x00,0x19,0x00,0x21,0x00,0x00,
-    0x00,0x36,0x32,0x16,0x14,0x06,0x22,0x26,0x24,0x36,
-    0x32,0x16,0x14,0x06,0x22,0x26,0x07,0x32,0x17,0x16,
-    0x10,0x02,0x20,0x02,0x11,0x10,0x00,0x02,0x20,0x02,
-    0x10,0x12,0x20,0x12,0x01,0x46,0x25,0x35,0x23,0x23,
-    0x35,0x25,0x01,0x31,0x24,0x35,0x24,0x24,0x35,0x24,
-    0x60,0xcd,0x6a,0x6c,0xd9,0xfe,0x63,0xd5,0x02,0xe5,
-    0xa0,0xfe,0xc3,0xa2,0xa3,0x01,0x3a,0xa2,0x06,0xe7,
-    0x29,0x29,0x52,0x2a,0x2a,0x52,0x29,0x29,0x52,0x2a,
-    0x2b,0xcb,0xc3,0xc2,0xfd,0x2b,0xfe,0x7b,0x01,0x89,
-    0x01,0x6a,0x02,0xec,0xfe,0x57,0x01,0x4b,0xfe,0xb3,
-    0xfd,0x78,0xfe,0xb2,0x01,0x4b,0x00,0x00,0x00,0x01,
-    0x00,0x3b,0x01,0x75,0x02,0xf8,0x04,0x31,0x00,0x0b,
-    0x00,0x00,0x09,0x02,0x07,0x01,0x01,0x27,0x01,0x01,
-    0x37,0x01,0x01,0x02,0xf8,0xfe,0xdb,0x01,0x1f,0x3a,
-    0xfe,0xe0,0xfe,0xdd,0x3a,0x01,0x23,0xfe,0xdf,0x3a,
-    0x01,0x21,0x01,0x24,0x03,0xf8,0xfe,0xdb,0xfe,0xdf,
-    0x39,0x01,0x21,0xfe,0xdb,0x3b,0x01,0x23,0x01,0x21,
-    0x39,0xfe,0xdf,0x01,0x25,0x00,0x00,0x03,0x00,0x60,
-    0xff,0xa2,0x03,0xd7,0x06,0x06,0x00,0x11,0x00,0x18,
-    0x00,0x20,0x00,0x00,0x01,0x16,0x10,0x02,0x23,0x22,
-    0x27,0x07,0x27,0x37,0x26,0x11,0x10,0x21,0x32,0x17,
-    0x37,0x17,0x05,0x22,0x02,0x10,0x17,0x01,0x26,0x03,
-    0x32,0x12,0x11,0x34,0x27,0x01,0x16,0x03,0x5c,0x5e,
-    0xd9,0xcd,0x9e,0x66,0x5e,0x52,0x77,0x68,0x01,0xa8,
-    0xa3,0x6b,0x60,0x52,0xfe,0x40,0xa0,0xa2,0x3b,0x01,
-    0xe4,0x50,0x90,0x9e,0xa2,0x31,0xfe,0x1f,0x4d,0x04,
-    0xee,0xbd,0xfd,0x40,0xfe,0x7b,0x72,0xbc,0x25,0xed,
-    0xc2,0x01,0x69,0x02,0xec,0x83,0xbe,0x29,0x70,0xfe,
-    0xb3,0xfd,0xa4,0x9f,0x03,0xbe,0x8a,0xfa,0xdd,0x01,
-    0x4b,0x01,0x48,0xfd,0x9f,0xfc,0x45,0x74,0x00,0x00,
-    0x00,0x02,0x00,0x93,0xff,0xec,0x03,0x60,0x07,0x73,
-    0x00,0x09,0x00,0x19,0x00,0x00,0x01,0x33,0x16,0x16,
-    0x17,0x15,0x23,0x26,0x26,0x27,0x01,0x11,0x10,0x21,
-    0x22,0x26,0x35,0x11,0x33,0x11,0x14,0x16,0x32,0x36,
-    0x35,0x11,0x01,0x15,0x7d,0x1d,0x6a,0x38,0x30,0x3f,
-    0xa8,0x25,0x02,0x4b,0xfe,0x9e,0xb1,0xba,0x63,0x89,
-    0xfd,0x82,0x07,0x73,0x43,0xaa,0x46,0x15,0x33,0xbf,
-    0x45,0xfe,0x54,0xfc,0x25,0xfe,0x11,0xff,0xf0,0x03,
-    0xdb,0xfc,0x19,0xbd,0xc8,0xc7,0xc2,0x03,0xe3,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x93,0xff,0xec,0x03,0x60,
-    0x07,0x73,0x00,0x08,0x00,0x18,0x00,0x00,0x01,0x15,
-    0x06,0x06,0x07,0x23,0x35,0x36,0x37,0x13,0x11,0x10,
-    0x21,0x22,0x26,0x35,0x11,0x33,0x11,0x14,0x16,0x32,
-    0x36,0x35,0x11,0x02,0xe3,0x25,0xa2,0x46,0x2f,0x7e,
-    0x41,0xfa,0xfe,0x9e,0xb1,0xba,0x63,0x89,0xfd,0x82,
-    0x07,0x73,0x11,0x42,0xba,0x3b,0x15,0xa4,0x8f,0xfe,
-    0x43,0xfc,0x25,0xfe,0x11,0xff,0xf0,0x03,0xdb,0xfc,
-    0x19,0xbd,0xc8,0xc7,0xc2,0x03,0xe3,0x00,0x00,0x00,
-    0x00,0x02,0x00,0x93,0xff,0xec,0x03,0x60,0x07,0x73,
-    0x00,0x11,0x00,0x21,0x00,0x00,0x01,0x23,0x26,0x27,
-    0x27,0x06,0x07,0x06,0x07,0x23,0x35,0x36,0x37,0x33,
-    0x16,0x17,0x16,0x17,0x17,0x11,0x10,0x21,0x22,0x26,
-    0x35,0x11,0x33,0x11,0x14,0x16,0x32,0x36,0x35,0x11,
-    0x02,0xe6,0x2f,0x2a,0x31,0x61,0x13,0x2c,0x51,0x31,
-    0x2b,0x79,0x41,0x5f,0x17,0x37,0x3c,0x34,0x7a,0xfe,
-    0x9e,0xb1,0xba,0x63,0x89,0xfd,0x82,0x06,0x2b,0x2a,
-    0x3b,0x70,0x15,0x33,0x5e,0x2f,0x13,0xa8,0x8d,0x36,
-    0x5b,0x5f,0x45,0x88,0xfc,0x25,0xfe,0x11,0xff,0xf0,
-    0x03,0xdb,0xfc,0x19,0xbd,0xc8,0xc7,0xc2,0x03,0xe3,
-    0x00,0x00,0x00,0x03,0x00,0x93,0xff,0xec,0x03,0x60,
-    0x07,0x10,0x00,0x07,0x00,0x0f,0x00,0x1f,0x00,0x00,
-    0x00,0x36,0x32,0x16,0x14,0x06,0x22,0x26,0x24,0x36,
-    0x32,0x16,0x14,0x06,0x22,0x26,0x05,0x11,0x10,0x21,
-    0x22,0x26,0x35,0x11,0x33,0x11,0x14,0x16,0x32,0x36,
-    0x35,0x11,0x01,0x24,0x25,0x35,0x23,0x23,0x35,0x25,
-    0x01,0x31,0x24,0x35,0x24,0x24,0x35,0x24,0x01,0x0b,
-    0xfe,0x9e,0xb1,0xba,0x63,0x89,0xfd,0x82,0x06,0xe7,
-    0x29,0x29,0x52,0x2a,0x2a,0x52,0x29,0x29,0x52,0x2a,
-    0x2b,0xe0,0xfc,0x25,0xfe,0x11,0xff,0xf0,0x03,0xdb,
-    0xfc,0x19,0xbd,0xc8,0xc7,0xc2,0x03,0xe3,0x00,0x00,
-    0x00,0x02,0x00,0x00,0x00,0x00,0x02,0xae,0x07,0x73,
-    0x00,0x08,0x00,0x11,0x00,0x00,0x01,0x15,0x06,0x06,
-    0x07,0x23,0x35,0x36,0x37,0x03,0x23,0x11,0x01,0x33,
-    0x13,0x13,0x33,0x01,0x02,0x4b,0x25,0xa2,0x46,0x2f,
-    0x7e,0x41,0x47,0x62,0xfe,0xdb,0x68,0xf0,0xee,0x68,
-    0xfe,0xd9,0x07,0x73,0x11,0x42,0xba,0x3b,0x15,0xa4,
-    0x8f,0xf8,0x8d,0x02,0x3b,0x03,0x7b,0xfd,0x0d,0x02,
-    0xf3,0xfc,0x85,0x00,0x00,0x00,0x00,0x02,0x00,0xa0,
-    0x00,0x00,0x03,0x04,0x05,0xb6,0x00,0x0b,0x00,0x15,
-    0x00,0x00,0x01,0x33,0x32,0x16,0x15,0x10,0x21,0x23,
-    0x11,0x23,0x11,0x33,0x11,0x11,0x33,0x32,0x37,0x36,
-    0x10,0x27,0x26,0x23,0x01,0x02,0x66,0xd5,0xc7,0xfe,
-    0x69,0x6b,0x62,0x62,0x62,0xa9,0x4a,0x49,0x48,0x46,
-    0xa3,0x04,0xa8,0xc6,0xd2,0xfe,0x3e,0xfe,0xb2,0x05,
-    0xb6,0xfe,0x92,0xfd,0x64,0x4d,0x4d,0x01,0x6b,0x4b,
-    0x4c,0x00,0x00,0x01,0x00,0x91,0xff,0xec,0x02,0xf0,
-    0x06,0x1f,0x00,0x29,0x00,0x00,0x33,0x11,0x34,0x36,
-    0x33,0x32,0x11,0x14,0x06,0x15,0x14,0x16,0x17,0x17,
-    0x16,0x10,0x07,0x06,0x22,0x27,0x35,0x16,0x16,0x33,
-    0x32,0x36,0x35,0x34,0x2e,0x02,0x34,0x36,0x37,0x36,
-    0x35,0x34,0x23,0x22,0x06,0x15,0x11,0x91,0x92,0x7c,
-    0xf4,0xb6,0x2f,0x40,0x3b,0x69,0x47,0x47,0xe7,0x3e,
-    0x2c,0x4f,0x34,0x4e,0x55,0x2d,0xa0,0x41,0x28,0x31,
-    0x59,0x93,0x55,0x5b,0x04,0xb4,0xac,0xbf,0xfe,0xeb,
-    0x78,0xeb,0x49,0x39,0x5c,0x50,0x46,0x78,0xfe,0xd9,
-    0x55,0x53,0x35,0x64,0x1e,0x21,0x74,0x69,0x3c,0x6f,
-    0xc1,0x8c,0x76,0x5a,0x3d,0x70,0x76,0xb7,0x87,0x80,
-    0xfb,0x42,0x00,0x03,0x00,0x4e,0xff,0xec,0x02,0x83,
-    0x06,0x21,0x00,0x09,0x00,0x20,0x00,0x2a,0x00,0x00,
-    0x13,0x33,0x16,0x16,0x17,0x15,0x23,0x26,0x26,0x27,
-    0x03,0x36,0x20,0x16,0x15,0x11,0x23,0x27,0x23,0x06,
-    0x23,0x22,0x27,0x26,0x10,0x36,0x37,0x37,0x35,0x34,
-    0x26,0x22,0x07,0x03,0x14,0x16,0x33,0x32,0x36,0x35,
-    0x35,0x07,0x04,0xa3,0x7d,0x1d,0x6a,0x38,0x30,0x3f,
-    0xa8,0x25,0x09,0x70,0x01,0x04,0x75,0x4e,0x0c,0x04,
-    0x4e,0x9e,0x6b,0x40,0x40,0xba,0xa8,0x75,0x4d,0xb4,
-    0x61,0x11,0x52,0x4a,0x66,0x71,0x71,0xfe,0xfe,0x06,
-    0x21,0x43,0xaa,0x46,0x15,0x33,0xbf,0x45,0xfd,0xfc,
-    0x46,0xaa,0xc5,0xfd,0x1d,0x98,0xac,0x54,0x55,0x01,
-    0x29,0xb5,0x08,0x06,0x5a,0x99,0x8a,0x3d,0xfd,0x60,
-    0x73,0x71,0xca,0xb7,0x71,0x06,0x0d,0x00,0x00,0x03,
-    0x00,0x4e,0xff,0xec,0x02,0x83,0x06,0x21,0x00,0x08,
-    0x00,0x1f,0x00,0x29,0x00,0x00,0x01,0x15,0x06,0x06,
-    0x07,0x23,0x35,0x36,0x37,0x01,0x36,0x20,0x16,0x15,
-    0x11,0x23,0x27,0x23,0x06,0x23,0x22,0x27,0x26,0x10,
-    0x36,0x37,0x37,0x35,0x34,0x26,0x22,0x07,0x03,0x14,
-    0x16,0x33,0x32,0x36,0x35,0x35,0x07,0x04,0x02,0x5e,
-    0x25,0xa1,0x47,0x2f,0x7e,0x41,0xfe,0xb9,0x70,0x01,
-    0x04,0x75,0x4e,0x0c,0x04,0x4e,0x9e,0x6b,0x40,0x40,
-    0xba,0xa8,0x75,0x4d,0xb4,0x61,0x11,0x52,0x4a,0x66,
-    0x71,0x71,0xfe,0xfe,0x06,0x21,0x11,0x42,0xba,0x3b,
-    0x15,0xa4,0x8f,0xfd,0xeb,0x46,0xaa,0xc5,0xfd,0x1d,
-    0x98,0xac,0x54,0x55,0x01,0x29,0xb5,0x08,0x06,0x5a,
-    0x99,0x8a,0x3d,0xfd,0x60,0x73,0x71,0xca,0xb7,0x71,
-    0x06,0x0d,0x00,0x00,0x00,0x03,0x00,0x4e,0xff,0xec,
-    0x02,0x83,0x06,0x23,0x00,0x11,0x00,0x28,0x00,0x32,
-    0x00,0x00,0x01,0x23,0x26,0x27,0x27,0x06,0x07,0x06,
-    0x07,0x23,0x35,0x36,0x37,0x33,0x16,0x17,0x16,0x17,
-    0x05,0x36,0x20,0x16,0x15,0x11,0x23,0x27,0x23,0x06,
-    0x23,0x22,0x27,0x26,0x10,0x36,0x37,0x37,0x35,0x34,
-    0x26,0x22,0x07,0x03,0x14,0x16,0x33,0x32,0x36,0x35,
-    0x35,0x07,0x04,0x02,0x6d,0x2f,0x2a,0x31,0x61,0x13,
-    0x2c,0x51,0x31,0x2b,0x7a,0x40,0x5f,0x17,0x37,0x3c,
-    0x34,0xfe,0x2d,0x70,0x01,0x04,0x75,0x4e,0x0c,0x04,
-    0x4e,0x9e,0x6b,0x40,0x40,0xba,0xa8,0x75,0x4d,0xb4,
-    0x61,0x11,0x52,0x4a,0x66,0x71,0x71,0xfe,0xfe,0x04,
-    0xdb,0x2a,0x3b,0x70,0x15,0x33,0x5e,0x2f,0x13,0xa8,
-    0x8d,0x36,0x5b,0x5f,0x45,0xe2,0x46,0xaa,0xc5,0xfd,
-    0x1d,0x98,0xac,0x54,0x55,0x01,0x29,0xb5,0x08,0x06,
-    0x5a,0x99,0x8a,0x3d,0xfd,0x60,0x73,0x71,0xca,0xb7,
-    0x71,0x06,0x0d,0x00,0x00,0x03,0x00,0x4e,0xff,0xec,
-    0x02,0xa5,0x05,0xae,0x00,0x15,0x00,0x2c,0x00,0x36,
-    0x00,0x00,0x01,0x22,0x26,0x27,0x26,0x22,0x06,0x07,
-    0x23,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x33,0x32,
-    0x37,0x33,0x06,0x06,0x05,0x36,0x20,0x16,0x15,0x11,
-    0x23,0x27,0x23,0x06,0x23,0x22,0x27,0x26,0x10,0x36,
-    0x37,0x37,0x35,0x34,0x26,0x22,0x07,0x03,0x14,0x16,
-    0x33,0x32,0x36,0x35,0x35,0x07,0x04,0x02,0x05,0x20,
-    0x4a,0x1c,0x4c,0x40,0x2c,0x09,0x4a,0x0c,0x54,0x46,
-    0x20,0x49,0x1b,0x49,0x25,0x3b,0x14,0x4a,0x09,0x54,
-    0xfe,0x52,0x70,0x01,0x04,0x75,0x4e,0x0c,0x04,0x4e,
-    0x9e,0x6b,0x40,0x40,0xba,0xa8,0x75,0x4d,0xb4,0x61,
-    0x11,0x52,0x4a,0x66,0x71,0x71,0xfe,0xfe,0x04,0xdb,
-    0x28,0x17,0x40,0x46,0x3b,0x64,0x6f,0x28,0x18,0x3f,
-    0x81,0x65,0x6e,0xcf,0x46,0xaa,0xc5,0xfd,0x1d,0x98,
-    0xac,0x54,0x55,0x01,0x29,0xb5,0x08,0x06,0x5a,0x99,
-    0x8a,0x3d,0xfd,0x60,0x73,0x71,0xca,0xb7,0x71,0x06,
-    0x0d,0x00,0x00,0x04,0x00,0x4e,0xff,0xec,0x02,0x83,
-    0x05,0xbe,0x00,0x07,0x00,0x0f,0x00,0x26,0x00,0x30,
-    0x00,0x00,0x12,0x36,0x32,0x16,0x14,0x06,0x22,0x26,
-    0x24,0x36,0x32,0x16,0x14,0x06,0x22,0x26,0x01,0x36,
-    0x20,0x16,0x15,0x11,0x23,0x27,0x23,0x06,0x23,0x22,
-    0x27,0x26,0x10,0x36,0x37,0x37,0x35,0x34,0x26,0x22,
-    0x07,0x03,0x14,0x16,0x33,0x32,0x36,0x35,0x35,0x07,
-    0x04,0xa5,0x25,0x35,0x23,0x23,0x35,0x25,0x01,0x31,
-    0x24,0x35,0x24,0x24,0x35,0x24,0xfe,0xc4,0x70,0x01,
-    0x04,0x75,0x4e,0x0c,0x04,0x4e,0x9e,0x6b,0x40,0x40,
-    0xba,0xa8,0x75,0x4d,0xb4,0x61,0x11,0x52,0x4a,0x66,
-    0x71,0x71,0xfe,0xfe,0x05,0x95,0x29,0x29,0x52,0x2a,
-    0x2a,0x52,0x29,0x29,0x52,0x2a,0x2b,0xfe,0xc8,0x46,
-    0xaa,0xc5,0xfd,0x1d,0x98,0xac,0x54,0x55,0x01,0x29,
-    0xb5,0x08,0x06,0x5a,0x99,0x8a,0x3d,0xfd,0x60,0x73,
-    0x71,0xca,0xb7,0x71,0x06,0x0d,0x00,0x00,0x00,0x04,
-    0x00,0x4e,0xff,0xec,0x02,0x83,0x06,0x58,0x00,0x07,
-    0x00,0x0f,0x00,0x26,0x00,0x30,0x00,0x00,0x12,0x36,
-    0x32,0x16,0x14,0x06,0x22,0x26,0x24,0x26,0x22,0x06,
-    0x14,0x16,0x32,0x36,0x01,0x36,0x20,0x16,0x15,0x11,
-    0x23,0x27,0x23,0x06,0x23,0x22,0x27,0x26,0x10,0x36,
-    0x37,0x37,0x35,0x34,0x26,0x22,0x07,0x03,0x14,0x16,
-    0x33,0x32,0x36,0x35,0x35,0x07,0x04,0xb9,0x6b,0xb3,
-    0x70,0x6c,0xb8,0x6a,0x01,0x40,0x3f,0x70,0x43,0x3e,
-    0x71,0x43,0xfe,0xa1,0x70,0x01,0x04,0x75,0x4e,0x0c,
-    0x04,0x4e,0x9e,0x6b,0x40,0x40,0xba,0xa8,0x75,0x4d,
-    0xb4,0x61,0x11,0x52,0x4a,0x66,0x71,0x71,0xfe,0xfe,
-    0x05,0xf3,0x65,0x64,0xab,0x66,0x64,0x8b,0x40,0x41,
-    0x69,0x3f,0x40,0xfe,0xa3,0x46,0xaa,0xc5,0xfd,0x1d,
-    0x98,0xac,0x54,0x55,0x01,0x29,0xb5,0x08,0x06,0x5a,
-    0x99,0x8a,0x3d,0xfd,0x60,0x73,0x71,0xca,0xb7,0x71,
-    0x06,0x0d,0x00,0x00,0x00,0x03,0x00,0x4e,0xff,0xec,
-    0x04,0x8b,0x04,0x52,0x00,0x22,0x00,0x29,0x00,0x33,
-    0x00,0x00,0x01,0x32,0x17,0x36,0x33,0x32,0x16,0x15,
-    0x15,0x21,0x12,0x33,0x32,0x37,0x15,0x06,0x22,0x26,
-    0x27,0x06,0x06,0x22,0x27,0x26,0x10,0x36,0x37,0x37,
-    0x35,0x34,0x26,0x22,0x07,0x27,0x36,0x01,0x35,0x34,
-    0x26,0x23,0x22,0x03,0x04,0x06,0x14,0x16,0x33,0x32,
-    0x36,0x35,0x35,0x07,0x01,0x85,0xb2,0x33,0x54,0xa6,
-    0x88,0x9f,0xfd,0xfe,0x09,0xf9,0x71,0x6c,0x65,0xe3,
-    0xa1,0x27,0x2d,0x8d,0xd0,0x40,0x40,0xba,0xa8,0x75,
-    0x50,0xb1,0x61,0x29,0x71,0x03,0x22,0x6e,0x5d,0xc2,
-    0x15,0xfe,0xa4,0x7d,0x52,0x4a,0x66,0x71,0x71,0x04,
-    0x52,0xac,0xac,0xff,0xdc,0x58,0xfe,0x23,0x43,0x58,
-    0x41,0x7f,0x72,0x7e,0x73,0x54,0x55,0x01,0x29,0xb5,
-    0x08,0x06,0x5a,0x93,0x90,0x3d,0x4b,0x46,0xfe,0x23,
-    0x0c,0xad,0xcc,0xfe,0x7b,0x53,0x7e,0xf6,0x71,0xca,
-    0xb7,0x71,0x06,0x00,0x00,0x01,0x00,0x60,0xfe,0x14,
-    0x02,0x52,0x04,0x52,0x00,0x24,0x00,0x00,0x01,0x22,
-    0x10,0x33,0x32,0x37,0x15,0x06,0x06,0x23,0x23,0x07,
-    0x16,0x15,0x14,0x06,0x23,0x22,0x27,0x35,0x16,0x33,
-    0x32,0x36,0x34,0x26,0x27,0x37,0x26,0x11,0x10,0x12,
-    0x33,0x32,0x17,0x07,0x26,0x01,0xb2,0xef,0xef,0x46,
-    0x54,0x1f,0x60,0x25,0x03,0x2a,0xa0,0x7b,0x6f,0x3d,
-    0x19,0x21,0x2d,0x4c,0x4c,0x54,0x52,0x43,0xfe,0xa8,
-    0xa2,0x65,0x43,0x25,0x42,0x03,0xf8,0xfc,0x4a,0x20,
-    0x50,0x11,0x15,0x5f,0x27,0x89,0x62,0x67,0x0b,0x4e,
-    0x0b,0x41,0x72,0x3e,0x0d,0x94,0x3e,0x01,0xe7,0x01,
-    0x17,0x01,0x22,0x25,0x54,0x1f,0x00,0x03,0x00,0x60,
-    0xff,0xec,0x02,0xc3,0x06,0x21,0x00,0x09,0x00,0x1b,
-    0x00,0x21,0x00,0x00,0x13,0x33,0x16,0x16,0x17,0x15,
-    0x23,0x26,0x26,0x27,0x01,0x22,0x27,0x26,0x10,0x12,
-    0x33,0x32,0x12,0x15,0x15,0x21,0x12,0x21,0x32,0x37,
-    0x15,0x06,0x13,0x34,0x26,0x23,0x22,0x03,0xc5,0x7d,
-    0x1d,0x6a,0x38,0x30,0x3f,0xa8,0x25,0x01,0x00,0xac,
-    0x5d,0x5c,0xa5,0x9b,0x87,0x9c,0xfd,0xfe,0x04,0x01,
-    0x04,0x67,0x70,0x68,0x2c,0x6d,0x5d,0xc4,0x13,0x06,
-    0x21,0x43,0xaa,0x46,0x15,0x33,0xbf,0x45,0xf9,0xdc,
-    0x92,0x94,0x02,0x1b,0x01,0x25,0xff,0x00,0xdb,0x58,
-    0xfe,0x27,0x43,0x5c,0x41,0x02,0x89,0xb3,0xd4,0xfe,
-    0x79,0x00,0x00,0x03,0x00,0x60,0xff,0xec,0x02,0xc3,
-    0x06,0x21,0x00,0x08,0x00,0x1a,0x00,0x20,0x00,0x00,
-    0x01,0x15,0x06,0x06,0x07,0x23,0x35,0x36,0x37,0x03,
-    0x22,0x27,0x26,0x10,0x12,0x33,0x32,0x12,0x15,0x15,
-    0x21,0x12,0x21,0x32,0x37,0x15,0x06,0x13,0x34,0x26,
-    0x23,0x22,0x03,0x02,0x93,0x25,0xa2,0x46,0x2f,0x7e,
-    0x41,0x51,0xac,0x5d,0x5c,0xa5,0x9b,0x87,0x9c,0xfd,
-    0xfe,0x04,0x01,0x04,0x67,0x70,0x68,0x2c,0x6d,0x5d,
-    0xc4,0x13,0x06,0x21,0x11,0x42,0xba,0x3b,0x15,0xa4,
-    0x8f,0xf9,0xcb,0x92,0x94,0x02,0x1b,0x01,0x25,0xff,
-    0x00,0xdb,0x58,0xfe,0x27,0x43,0x5c,0x41,0x02,0x89,
-    0xb3,0xd4,0xfe,0x79,0x00,0x03,0x00,0x60,0xff,0xec,
-    0x02,0xc3,0x06,0x21,0x00,0x11,0x00,0x23,0x00,0x29,
-    0x00,0x00,0x01,0x23,0x26,0x27,0x27,0x06,0x07,0x06,
-    0x07,0x23,0x35,0x36,0x37,0x33,0x16,0x17,0x16,0x17,
-    0x03,0x22,0x27,0x26,0x10,0x12,0x33,0x32,0x12,0x15,
-    0x15,0x21,0x12,0x21,0x32,0x37,0x15,0x06,0x13,0x34,
-    0x26,0x23,0x22,0x03,0x02,0x88,0x2f,0x2a,0x31,0x61,
-    0x13,0x2c,0x51,0x31,0x2b,0x79,0x41,0x5f,0x17,0x37,
-    0x3c,0x34,0xc3,0xac,0x5d,0x5c,0xa5,0x9b,0x87,0x9c,
-    0xfd,0xfe,0x04,0x01,0x04,0x67,0x70,0x68,0x2c,0x6d,
-    0x5d,0xc4,0x13,0x04,0xd9,0x2a,0x3b,0x70,0x15,0x33,
-    0x5e,0x2f,0x13,0xa8,0x8d,0x36,0x5b,0x5f,0x45,0xfb,
-    0x00,0x92,0x94,0x02,0x1b,0x01,0x25,0xff,0x00,0xdb,
-    0x58,0xfe,0x27,0x43,0x5c,0x41,0x02,0x89,0xb3,0xd4,
-    0xfe,0x79,0x00,0x00,0x00,0x04,0x00,0x60,0xff,0xec,
-    0x02,0xc3,0x05,0xbe,0x00,0x07,0x00,0x0f,0x00,0x21,
-    0x00,0x27,0x00,0x00,0x12,0x36,0x32,0x16,0x14,0x06,
-    0x22,0x26,0x24,0x36,0x32,0x16,0x14,0x06,0x22,0x26,
-    0x03,0x22,0x27,0x26,0x10,0x12,0x33,0x32,0x12,0x15,
-    0x15,0x21,0x12,0x21,0x32,0x37,0x15,0x06,0x13,0x34,
-    0x26,0x23,0x22,0x03,0xc3,0x25,0x35,0x23,0x23,0x35,
-    0x25,0x01,0x31,0x24,0x35,0x24,0x24,0x35,0x24,0x2f,
-    0xac,0x5d,0x5c,0xa5,0x9b,0x87,0x9c,0xfd,0xfe,0x04,
-    0x01,0x04,0x67,0x70,0x68,0x2c,0x6d,0x5d,0xc4,0x13,
-    0x05,0x95,0x29,0x29,0x52,0x2a,0x2a,0x52,0x29,0x29,
-    0x52,0x2a,0x2b,0xfa,0xa8,0x92,0x94,0x02,0x1b,0x01,
-    0x25,0xff,0x00,0xdb,0x58,0xfe,0x27,0x43,0x5c,0x41,
-    0x02,0x89,0xb3,0xd4,0xfe,0x79,0x00,0x02,0xff,0xe0,
-    0x00,0x00,0x01,0x1c,0x06,0x21,0x00,0x09,0x00,0x0d,
-    0x00,0x00,0x03,0x33,0x16,0x16,0x17,0x15,0x23,0x26,
-    0x26,0x27,0x01,0x23,0x11,0x33,0x20,0x7d,0x1d,0x6a,
-    0x38,0x30,0x3f,0xa8,0x25,0x01,0x10,0x5f,0x5f,0x06,
-    0x21,0x43,0xaa,0x46,0x15,0x33,0xbf,0x45,0xf9,0xf0,
-    0x04,0x3d,0x00,0x02,0x00,0x71,0x00,0x00,0x01,0xad,
-    0x06,0x21,0x00,0x08,0x00,0x0c,0x00,0x00,0x01,0x15,
-    0x06,0x06,0x07,0x23,0x35,0x36,0x37,0x03,0x23,0x11,
-    0x33,0x01,0xad,0x25,0xa2,0x46,0x2f,0x7e,0x41,0x40,
-    0x5f,0x5f,0x06,0x21,0x11,0x42,0xba,0x3b,0x15,0xa4,
-    0x8f,0xf9,0xdf,0x04,0x3d,0x00,0x00,0x00,0x00,0x02,
-    0xff,0xd6,0x00,0x00,0x01,0xad,0x06,0x21,0x00,0x11,
-    0x00,0x15,0x00,0x00,0x01,0x23,0x26,0x27,0x27,0x06,
-    0x07,0x06,0x07,0x23,0x35,0x36,0x37,0x33,0x16,0x17,
-    0x16,0x17,0x03,0x23,0x11,0x33,0x01,0xad,0x2f,0x2a,
-    0x31,0x61,0x13,0x2c,0x51,0x31,0x2b,0x7a,0x40,0x5f,
-    0x17,0x37,0x3c,0x34,0xbd,0x5f,0x5f,0x04,0xd9,0x2a,
-    0x3b,0x70,0x15,0x33,0x5e,0x2f,0x13,0xa8,0x8d,0x36,
-    0x5b,0x5f,0x45,0xfb,0x14,0x04,0x3d,0x00,0x00,0x03,
-    0xff,0xec,0x00,0x00,0x01,0x9a,0x05,0xbe,0x00,0x07,
-    0x00,0x0f,0x00,0x13,0x00,0x00,0x02,0x36,0x32,0x16,
-    0x14,0x06,0x22,0x26,0x24,0x36,0x32,0x16,0x14,0x06,
-    0x22,0x26,0x03,0x23,0x11,0x33,0x14,0x25,0x35,0x23,
-    0x23,0x35,0x25,0x01,0x31,0x24,0x35,0x24,0x24,0x35,
-    0x24,0x2d,0x5f,0x5f,0x05,0x95,0x29,0x29,0x52,0x2a,
-    0x2a,0x52,0x29,0x29,0x52,0x2a,0x2b,0xfa,0xbc,0x04,
-    0x3d,0x00,0x00,0x00,0x00,0x02,0x00,0x5e,0xff,0xec,
-    0x02,0xfa,0x06,0x14,0x00,0x17,0x00,0x21,0x00,0x00,
-    0x01,0x10,0x21,0x22,0x02,0x10,0x36,0x20,0x17,0x33,
-    0x02,0x27,0x07,0x27,0x37,0x26,0x27,0x37,0x16,0x17,
-    0x37,0x17,0x07,0x00,0x05,0x22,0x06,0x10,0x16,0x32,
-    0x36,0x35,0x34,0x26,0x02,0xfa,0xfe,0xae,0x94,0xb6,
-    0xa1,0x01,0x31,0x49,0x08,0x34,0xba,0xae,0x27,0xa0,
-    0x36,0x3a,0x2f,0x4b,0x42,0xbc,0x27,0xae,0x01,0x1b,
-    0xfe,0xb6,0x76,0x7c,0x81,0xe9,0x72,0x82,0x02,0x02,
-    0xfd,0xea,0x01,0x0f,0x01,0xc4,0xfb,0x7b,0x01,0x26,
-    0xd8,0x66,0x42,0x5e,0x33,0x2d,0x3d,0x2f,0x41,0x6e,
-    0x41,0x67,0xfe,0xbb,0xc5,0xcd,0xfe,0x84,0xd5,0xcd,
-    0xd4,0xa6,0xd7,0x00,0x00,0x02,0x00,0x91,0x00,0x00,
-    0x02,0xd9,0x05,0xae,0x00,0x15,0x00,0x29,0x00,0x00,
-    0x01,0x22,0x26,0x27,0x26,0x22,0x06,0x07,0x23,0x36,
-    0x36,0x33,0x32,0x16,0x17,0x16,0x33,0x32,0x37,0x33,
-    0x06,0x06,0x07,0x32,0x16,0x15,0x11,0x23,0x11,0x10,
-    0x23,0x22,0x06,0x15,0x11,0x23,0x11,0x33,0x17,0x33,
-    0x36,0x36,0x02,0x36,0x20,0x4a,0x1c,0x4c,0x40,0x2c,
-    0x09,0x4a,0x0c,0x54,0x46,0x20,0x49,0x1b,0x49,0x25,
-    0x3b,0x14,0x4a,0x09,0x54,0x9c,0x80,0x7c,0x5e,0xa0,
-    0x7a,0x71,0x5f,0x50,0x08,0x09,0x21,0x80,0x04,0xdb,
-    0x28,0x17,0x40,0x46,0x3b,0x64,0x6f,0x28,0x18,0x3f,
-    0x81,0x65,0x6e,0x89,0xab,0xb9,0xfd,0x12,0x02,0xec,
-    0x01,0x0e,0xca,0xdc,0xfd,0xac,0x04,0x3d,0x97,0x50,
-    0x5c,0x00,0x00,0x03,0x00,0x5e,0xff,0xec,0x02,0xf4,
-    0x06,0x21,0x00,0x09,0x00,0x12,0x00,0x1a,0x00,0x00,
-    0x13,0x33,0x16,0x16,0x17,0x15,0x23,0x26,0x26,0x27,
-    0x13,0x32,0x12,0x10,0x02,0x20,0x02,0x11,0x10,0x05,
-    0x22,0x06,0x15,0x10,0x33,0x32,0x10,0xce,0x7d,0x1d,
-    0x6a,0x38,0x30,0x3f,0xa8,0x25,0xdc,0x9c,0xae,0xad,
-    0xfe,0xc0,0xa9,0x01,0x4a,0x78,0x6f,0xe7,0xe9,0x06,
-    0x21,0x43,0xaa,0x46,0x15,0x33,0xbf,0x45,0xfe,0x42,
-    0xfe,0xda,0xfd,0xe3,0xfe,0xdd,0x01,0x23,0x01,0x12,
-    0x02,0x31,0x5a,0xe9,0xee,0xfe,0x25,0x03,0xb2,0x00,
-    0x00,0x00,0x00,0x03,0x00,0x5e,0xff,0xec,0x02,0xf4,
-    0x06,0x21,0x00,0x08,0x00,0x11,0x00,0x19,0x00,0x00,
-    0x01,0x15,0x06,0x06,0x07,0x23,0x35,0x36,0x37,0x03,
-    0x32,0x12,0x10,0x02,0x20,0x02,0x11,0x10,0x05,0x22,
-    0x06,0x15,0x10,0x33,0x32,0x10,0x02,0x91,0x25,0xa2,
-    0x46,0x2f,0x7e,0x41,0x6a,0x9c,0xae,0xad,0xfe,0xc0,
-    0xa9,0x01,0x4a,0x78,0x6f,0xe7,0xe9,0x06,0x21,0x11,
-    0x42,0xba,0x3b,0x15,0xa4,0x8f,0xfe,0x31,0xfe,0xda,
-    0xfd,0xe3,0xfe,0xdd,0x01,0x23,0x01,0x12,0x02,0x31,
-    0x5a,0xe9,0xee,0xfe,0x25,0x03,0xb2,0x00,0x00,0x03,
-    0x00,0x5e,0xff,0xec,0x02,0xf4,0x06,0x21,0x00,0x11,
-    0x00,0x1a,0x00,0x22,0x00,0x00,0x01,0x23,0x26,0x27,
-    0x27,0x06,0x07,0x06,0x07,0x23,0x35,0x36,0x37,0x33,
-    0x16,0x17,0x16,0x17,0x07,0x32,0x12,0x10,0x02,0x20,
-    0x02,0x11,0x10,0x05,0x22,0x06,0x15,0x10,0x33,0x32,
-    0x10,0x02,0x96,0x2f,0x2a,0x31,0x61,0x13,0x2c,0x51,
-    0x31,0x2b,0x79,0x41,0x5f,0x17,0x37,0x3c,0x34,0xec,
-    0x9c,0xae,0xad,0xfe,0xc0,0xa9,0x01,0x4a,0x78,0x6f,
-    0xe7,0xe9,0x04,0xd9,0x2a,0x3b,0x70,0x15,0x33,0x5e,
-    0x2f,0x13,0xa8,0x8d,0x36,0x5b,0x5f,0x45,0x9a,0xfe,
-    0xda,0xfd,0xe3,0xfe,0xdd,0x01,0x23,0x01,0x12,0x02,
-    0x31,0x5a,0xe9,0xee,0xfe,0x25,0x03,0xb2,0x00,0x03,
-    0x00,0x5e,0xff,0xec,0x02,0xf4,0x05,0xae,0x00,0x15,
-    0x00,0x1e,0x00,0x26,0x00,0x00,0x01,0x22,0x26,0x27,
-    0x26,0x22,0x06,0x07,0x23,0x36,0x36,0x33,0x32,0x16,
-    0x17,0x16,0x33,0x32,0x37,0x33,0x06,0x06,0x07,0x32,
-    0x12,0x10,0x02,0x20,0x02,0x11,0x10,0x05,0x22,0x06,
-    0x15,0x10,0x33,0x32,0x10,0x02,0x21,0x20,0x4a,0x1c,
-    0x4c,0x40,0x2c,0x09,0x4a,0x0c,0x54,0x46,0x20,0x49,
-    0x1b,0x49,0x25,0x3b,0x14,0x4a,0x09,0x54,0xba,0x9c,
-    0xae,0xad,0xfe,0xc0,0xa9,0x01,0x4a,0x78,0x6f,0xe7,
-    0xe9,0x04,0xdb,0x28,0x17,0x40,0x46,0x3b,0x64,0x6f,
-    0x28,0x18,0x3f,0x81,0x65,0x6e,0x89,0xfe,0xda,0xfd,
-    0xe3,0xfe,0xdd,0x01,0x23,0x01,0x12,0x02,0x31,0x5a,
-    0xe9,0xee,0xfe,0x25,0x03,0xb2,0x00,0x04,0x00,0x5e,
-    0xff,0xec,0x02,0xf4,0x05,0xbe,0x00,0x07,0x00,0x0f,
-    0x00,0x18,0x00,0x20,0x00,0x00,0x12,0x36,0x32,0x16,
-    0x14,0x06,0x22,0x26,0x24,0x36,0x32,0x16,0x14,0x06,
-    0x22,0x26,0x07,0x32,0x12,0x10,0x02,0x20,0x02,0x11,
-    0x10,0x05,0x22,0x06,0x15,0x10,0x33,0x32,0x10,0xd2,
-    0x25,0x35,0x23,0x23,0x35,0x25,0x01,0x31,0x24,0x35,
-    0x24,0x24,0x35,0x24,0x59,0x9c,0xae,0xad,0xfe,0xc0,
-    0xa9,0x01,0x4a,0x78,0x6f,0xe7,0xe9,0x05,0x95,0x29,
-    0x29,0x52,0x2a,0x2a,0x52,0x29,0x29,0x52,0x2a,0x2b,
-    0xf2,0xfe,0xda,0xfd,0xe3,0xfe,0xdd,0x01,0x23,0x01,
-    0x12,0x02,0x31,0x5a,0xe9,0xee,0xfe,0x25,0x03,0xb2,
-    0x00,0x00,0x00,0x03,0x00,0x3b,0x01,0x0a,0x02,0xf8,
-    0x04,0x9a,0x00,0x06,0x00,0x0a,0x00,0x11,0x00,0x00,
-    0x01,0x22,0x34,0x32,0x15,0x14,0x06,0x01,0x21,0x35,
-    0x21,0x01,0x22,0x34,0x32,0x15,0x14,0x06,0x01,0x9a,
-    0x4e,0x9b,0x2a,0x01,0x3b,0xfd,0x43,0x02,0xbd,0xfe,
-    0xa2,0x4e,0x9b,0x2a,0x03,0xc5,0xd5,0x6b,0x36,0x34,
-    0xfe,0xe5,0x52,0xfe,0x0e,0xd5,0x6a,0x36,0x35,0x00,
-    0x00,0x03,0x00,0x44,0xff,0x71,0x03,0x0e,0x04,0xa6,
-    0x00,0x11,0x00,0x18,0x00,0x1f,0x00,0x00,0x01,0x16,
-    0x10,0x02,0x23,0x22,0x27,0x07,0x27,0x37,0x26,0x11,
-    0x10,0x21,0x32,0x17,0x37,0x17,0x05,0x22,0x06,0x10,
-    0x17,0x01,0x26,0x03,0x32,0x11,0x34,0x27,0x01,0x16,
-    0x02,0xa8,0x4c,0xad,0xa1,0x72,0x46,0x5f,0x4b,0x70,
-    0x56,0x01,0x4c,0x75,0x50,0x54,0x4b,0xfe,0x9a,0x78,
-    0x6f,0x26,0x01,0x5b,0x38,0x62,0xe9,0x20,0xfe,0xaa,
-    0x33,0x03,0xac,0x94,0xfd,0xf7,0xfe,0xdd,0x45,0xc0,
-    0x29,0xe3,0x92,0x01,0x12,0x02,0x31,0x56,0xaa,0x29,
-    0x85,0xe9,0xfe,0x4a,0x72,0x02,0xbb,0x56,0xfc,0x4e,
-    0x01,0xdb,0xb3,0x69,0xfd,0x4c,0x43,0x00,0x00,0x00,
-    0x00,0x02,0x00,0x8d,0xff,0xec,0x02,0xd5,0x06,0x21,
-    0x00,0x09,0x00,0x1f,0x00,0x00,0x13,0x33,0x16,0x16,
-    0x17,0x15,0x23,0x26,0x26,0x27,0x01,0x23,0x27,0x23,
-    0x06,0x06,0x23,0x22,0x27,0x26,0x35,0x11,0x33,0x11,
-    0x14,0x16,0x33,0x32,0x36,0x35,0x11,0x33,0xc3,0x7d,
-    0x1d,0x6a,0x38,0x30,0x3f,0xa8,0x25,0x02,0x12,0x50,
-    0x0c,0x08,0x23,0x7b,0x4a,0x83,0x3d,0x3c,0x5f,0x4c,
-    0x51,0x7c,0x72,0x5e,0x06,0x21,0x43,0xaa,0x46,0x15,
-    0x33,0xbf,0x45,0xf9,0xf0,0x98,0x52,0x5a,0x5d,0x5d,
-    0xd3,0x02,0xc4,0xfd,0x3c,0xa0,0x95,0xc8,0xdd,0x02,
-    0x54,0x00,0x00,0x00,0x00,0x02,0x00,0x8d,0xff,0xec,
-    0x02,0xd5,0x06,0x21,0x00,0x08,0x00,0x1e,0x00,0x00,
-    0x01,0x15,0x06,0x06,0x07,0x23,0x35,0x36,0x37,0x13,
-    0x23,0x27,0x23,0x06,0x06,0x23,0x22,0x27,0x26,0x35,
-    0x11,0x33,0x11,0x14,0x16,0x33,0x32,0x36,0x35,0x11,
-    0x33,0x02,0x9b,0x25,0xa2,0x46,0x2f,0x7e,0x41,0xb7,
-    0x50,0x0c,0x08,0x23,0x7b,0x4a,0x83,0x3d,0x3c,0x5f,
-    0x4c,0x51,0x7c,0x72,0x5e,0x06,0x21,0x11,0x42,0xba,
-    0x3b,0x15,0xa4,0x8f,0xf9,0xdf,0x98,0x52,0x5a,0x5d,
-    0x5d,0xd3,0x02,0xc4,0xfd,0x3c,0xa0,0x95,0xc8,0xdd,
-    0x02,0x54,0x00,0x00,0x00,0x02,0x00,0x8d,0xff,0xec,
-    0x02,0xd5,0x06,0x21,0x00,0x11,0x00,0x27,0x00,0x00,
-    0x01,0x23,0x26,0x27,0x27,0x06,0x07,0x06,0x07,0x23,
-    0x35,0x36,0x37,0x33,0x16,0x17,0x16,0x17,0x13,0x23,
-    0x27,0x23,0x06,0x06,0x23,0x22,0x27,0x26,0x35,0x11,
-    0x33,0x11,0x14,0x16,0x33,0x32,0x36,0x35,0x11,0x33,
-    0x02,0x96,0x2f,0x2a,0x31,0x61,0x13,0x2c,0x51,0x31,
-    0x2b,0x79,0x41,0x5f,0x17,0x37,0x3c,0x34,0x3f,0x50,
-    0x0c,0x08,0x23,0x7b,0x4a,0x83,0x3d,0x3c,0x5f,0x4c,
-    0x51,0x7c,0x72,0x5e,0x04,0xd9,0x2a,0x3b,0x70,0x15,
-    0x33,0x5e,0x2f,0x13,0xa8,0x8d,0x36,0x5b,0x5f,0x45,
-    0xfb,0x14,0x98,0x52,0x5a,0x5d,0x5d,0xd3,0x02,0xc4,
-    0xfd,0x3c,0xa0,0x95,0xc8,0xdd,0x02,0x54,0x00,0x03,
-    0x00,0x8d,0xff,0xec,0x02,0xd5,0x05,0xbe,0x00,0x07,
-    0x00,0x0f,0x00,0x25,0x00,0x00,0x12,0x36,0x32,0x16,
-    0x14,0x06,0x22,0x26,0x24,0x36,0x32,0x16,0x14,0x06,
-    0x22,0x26,0x13,0x23,0x27,0x23,0x06,0x06,0x23,0x22,
-    0x27,0x26,0x35,0x11,0x33,0x11,0x14,0x16,0x33,0x32,
-    0x36,0x35,0x11,0x33,0xda,0x25,0x35,0x23,0x23,0x35,
-    0x25,0x01,0x31,0x24,0x35,0x24,0x24,0x35,0x24,0xca,
-    0x50,0x0c,0x08,0x23,0x7b,0x4a,0x83,0x3d,0x3c,0x5f,
-    0x4c,0x51,0x7c,0x72,0x5e,0x05,0x95,0x29,0x29,0x52,
-    0x2a,0x2a,0x52,0x29,0x29,0x52,0x2a,0x2b,0xfa,0xbc,
-    0x98,0x52,0x5a,0x5d,0x5d,0xd3,0x02,0xc4,0xfd,0x3c,
-    0xa0,0x95,0xc8,0xdd,0x02,0x54,0x00,0x00,0x00,0x02,
-    0xff,0xfe,0xfe,0x14,0x02,0x83,0x06,0x21,0x00,0x08,
-    0x00,0x1f,0x00,0x00,0x01,0x15,0x06,0x06,0x07,0x23,
-    0x35,0x36,0x37,0x01,0x22,0x27,0x35,0x16,0x33,0x32,
-    0x36,0x37,0x37,0x01,0x33,0x13,0x16,0x17,0x33,0x36,
-    0x37,0x13,0x33,0x01,0x06,0x06,0x02,0x39,0x25,0xa2,
-    0x46,0x2f,0x7e,0x41,0xfe,0x98,0x25,0x31,0x2a,0x24,
-    0x3b,0x46,0x1c,0x30,0xfe,0xf1,0x60,0xa4,0x1e,0x1a,
-    0x08,0x15,0x20,0xa0,0x60,0xfe,0xc3,0x24,0x72,0x06,
-    0x21,0x11,0x42,0xba,0x3b,0x15,0xa4,0x8f,0xf7,0xf3,
-    0x11,0x56,0x0e,0x65,0x74,0xbc,0x04,0x3b,0xfd,0x5b,
-    0x81,0x92,0x8f,0x86,0x02,0xa3,0xfa,0xf6,0x93,0x8c,
-    0x00,0x02,0x00,0x91,0xfe,0x14,0x03,0x1f,0x06,0x14,
-    0x00,0x13,0x00,0x1f,0x00,0x00,0x01,0x20,0x11,0x10,
-    0x02,0x23,0x22,0x26,0x27,0x23,0x17,0x11,0x23,0x11,
-    0x33,0x11,0x07,0x33,0x36,0x36,0x03,0x15,0x14,0x16,
-    0x33,0x32,0x37,0x36,0x10,0x26,0x22,0x06,0x01,0xe1,
-    0x01,0x3e,0x9d,0x94,0x53,0x89,0x22,0x07,0x0b,0x63,
-    0x5f,0x04,0x04,0x27,0x7f,0xa6,0x76,0x79,0x6e,0x36,
-    0x37,0x69,0xee,0x73,0x04,0x52,0xfd,0xcf,0xfe,0xf0,
-    0xfe,0xdb,0x5c,0x4e,0x77,0xfd,0xf5,0x08,0x00,0xfe,
-    0x1c,0x88,0x51,0x59,0xfd,0xf4,0x1f,0xf9,0xec,0x71,
-    0x6f,0x01,0xf6,0xe0,0xd3,0x00,0x00,0x00,0x00,0x03,
-    0xff,0xfe,0xfe,0x14,0x02,0x83,0x05,0xbe,0x00,0x07,
-    0x00,0x0f,0x00,0x26,0x00,0x00,0x12,0x36,0x32,0x16,
-    0x14,0x06,0x22,0x26,0x24,0x36,0x32,0x16,0x14,0x06,
-    0x22,0x26,0x01,0x22,0x27,0x35,0x16,0x33,0x32,0x36,
-    0x37,0x37,0x01,0x33,0x13,0x16,0x17,0x33,0x36,0x37,
-    0x13,0x33,0x01,0x06,0x06,0x74,0x25,0x35,0x23,0x23,
-    0x35,0x25,0x01,0x31,0x24,0x35,0x24,0x24,0x35,0x24,
-    0xfe,0xaf,0x25,0x31,0x2a,0x24,0x3b,0x46,0x1c,0x30,
-    0xfe,0xf1,0x60,0xa4,0x1e,0x1a,0x08,0x15,0x20,0xa0,
-    0x60,0xfe,0xc3,0x24,0x72,0x05,0x95,0x29,0x29,0x52,
-    0x2a,0x2a,0x52,0x29,0x29,0x52,0x2a,0x2b,0xf8,0xd0,
-    0x11,0x56,0x0e,0x65,0x74,0xbc,0x04,0x3b,0xfd,0x5b,
-    0x81,0x92,0x8f,0x86,0x02,0xa3,0xfa,0xf6,0x93,0x8c,
-    0x00,0x01,0x00,0x91,0x00,0x00,0x00,0xf0,0x04,0x3d,
-    0x00,0x03,0x00,0x00,0x33,0x23,0x11,0x33,0xf0,0x5f,
-    0x5f,0x04,0x3d,0x00,0x00,0x02,0x00,0x6f,0xff,0xfa,
-    0x04,0x6f,0x05,0xbc,0x00,0x11,0x00,0x19,0x00,0x00,
-    0x01,0x15,0x21,0x11,0x21,0x15,0x21,0x11,0x21,0x15,
-    0x21,0x07,0x20,0x11,0x10,0x12,0x33,0x17,0x03,0x11,
-    0x22,0x07,0x06,0x10,0x17,0x16,0x04,0x6f,0xfe,0x4f,
-    0x01,0x98,0xfe,0x68,0x01,0xb1,0xfe,0x58,0x7d,0xfe,
-    0x25,0xf6,0xed,0x73,0x69,0xc9,0x5f,0x5d,0x5c,0x5d,
-    0x05,0xb6,0x5e,0xfd,0xd5,0x5e,0xfd,0x8f,0x5e,0x06,
-    0x02,0xe5,0x01,0x6a,0x01,0x73,0x06,0xfa,0xa2,0x05,
-    0x06,0x96,0x96,0xfd,0x58,0x9a,0x98,0x00,0x00,0x00,
-    0x00,0x03,0x00,0x5e,0xff,0xec,0x04,0xf2,0x04,0x52,
-    0x00,0x18,0x00,0x1f,0x00,0x28,0x00,0x00,0x05,0x22,
-    0x27,0x06,0x23,0x22,0x02,0x11,0x10,0x21,0x32,0x17,
-    0x36,0x33,0x32,0x12,0x15,0x15,0x21,0x12,0x21,0x32,
-    0x37,0x15,0x06,0x13,0x35,0x34,0x26,0x23,0x22,0x03,
-    0x07,0x35,0x10,0x23,0x22,0x06,0x15,0x10,0x20,0x03,
-    0xf4,0xda,0x59,0x4f,0xcc,0x9f,0xa9,0x01,0x4c,0xc1,
-    0x53,0x50,0xc1,0x87,0x9c,0xfd,0xfe,0x04,0x01,0x04,
-    0x67,0x70,0x68,0x2c,0x6d,0x5d,0xc3,0x14,0x63,0xe7,
-    0x78,0x6f,0x01,0xce,0x14,0xe7,0xe7,0x01,0x23,0x01,
-    0x12,0x02,0x31,0xe3,0xe3,0xff,0x00,0xdb,0x58,0xfe,
-    0x23,0x43,0x58,0x41,0x02,0x89,0x0c,0xab,0xce,0xfe,
-    0x7b,0x6d,0x19,0x01,0xd7,0xe9,0xee,0xfe,0x21,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x56,0xff,0xec,0x02,0xd1,
-    0x07,0x73,0x00,0x0f,0x00,0x35,0x00,0x00,0x01,0x15,
-    0x06,0x06,0x07,0x23,0x26,0x27,0x35,0x33,0x16,0x16,
-    0x17,0x37,0x36,0x37,0x01,0x32,0x36,0x34,0x26,0x27,
-    0x2e,0x02,0x35,0x34,0x35,0x34,0x36,0x33,0x32,0x33,
-    0x32,0x17,0x07,0x26,0x22,0x06,0x14,0x16,0x17,0x16,
-    0x16,0x15,0x14,0x07,0x06,0x23,0x22,0x27,0x35,0x16,
-    0x16,0x02,0xa3,0x38,0x6e,0x18,0x5f,0x46,0x74,0x2b,
-    0x31,0x7d,0x13,0x31,0x6f,0x1c,0xfe,0xfb,0x70,0x90,
-    0x67,0x8f,0x72,0x6f,0x36,0xc3,0x8c,0x02,0x03,0x9a,
-    0x6e,0x26,0x6f,0xdf,0x87,0x63,0x8e,0x94,0x89,0x64,
-    0x65,0x99,0xaf,0x6a,0x38,0x98,0x07,0x73,0x13,0x48,
-    0xb7,0x36,0x95,0xa0,0x13,0x2f,0x91,0x15,0x37,0x85,
-    0x19,0xf8,0xd7,0xaa,0xfc,0x8f,0x46,0x3a,0x6a,0x8d,
-    0x64,0x06,0x06,0x97,0xce,0x3c,0x5e,0x39,0x93,0xf5,
-    0x86,0x4a,0x48,0xc1,0x8a,0xb4,0x70,0x6f,0x33,0x6a,
-    0x1e,0x21,0x00,0x02,0x00,0x4a,0xff,0xec,0x02,0x3d,
-    0x06,0x21,0x00,0x0f,0x00,0x2f,0x00,0x00,0x01,0x15,
-    0x06,0x06,0x07,0x23,0x26,0x27,0x35,0x33,0x16,0x16,
-    0x17,0x37,0x36,0x37,0x03,0x32,0x36,0x35,0x34,0x2e,
-    0x03,0x35,0x34,0x36,0x32,0x17,0x07,0x26,0x22,0x06,
-    0x14,0x17,0x16,0x17,0x16,0x17,0x16,0x10,0x06,0x20,
-    0x27,0x35,0x16,0x16,0x02,0x3c,0x38,0x6e,0x18,0x5f,
-    0x47,0x73,0x2b,0x31,0x7d,0x13,0x31,0x6f,0x1c,0xe4,
-    0x54,0x60,0x47,0xd1,0x4f,0x2c,0x9f,0xfb,0x59,0x31,
-    0x52,0xb0,0x64,0x22,0x22,0x6e,0x6b,0x28,0x50,0x91,
-    0xfe,0xf1,0x51,0x25,0x7a,0x06,0x21,0x13,0x48,0xb7,
-    0x36,0x95,0xa0,0x13,0x2f,0x91,0x15,0x37,0x85,0x19,
-    0xfa,0x25,0x6d,0x5d,0x47,0x66,0x85,0x52,0x67,0x49,
-    0x75,0x99,0x3e,0x53,0x37,0x63,0x99,0x31,0x30,0x45,
-    0x46,0x2a,0x56,0xfe,0xf6,0x9a,0x3d,0x6f,0x25,0x2d,
-    0x00,0x03,0x00,0x00,0x00,0x00,0x02,0xae,0x07,0x10,
-    0x00,0x07,0x00,0x0f,0x00,0x18,0x00,0x00,0x12,0x36,
-    0x32,0x16,0x14,0x06,0x22,0x26,0x24,0x36,0x32,0x16,
-    0x14,0x06,0x22,0x26,0x03,0x23,0x11,0x01,0x33,0x13,
-    0x13,0x33,0x01,0x82,0x25,0x35,0x23,0x23,0x35,0x25,
-    0x01,0x31,0x24,0x35,0x24,0x24,0x35,0x24,0x2c,0x62,
-    0xfe,0xdb,0x68,0xf0,0xee,0x68,0xfe,0xd9,0x06,0xe7,
-    0x29,0x29,0x52,0x2a,0x2a,0x52,0x29,0x29,0x52,0x2a,
-    0x2b,0xf9,0x6a,0x02,0x3b,0x03,0x7b,0xfd,0x0d,0x02,
-    0xf3,0xfc,0x85,0x00,0x00,0x00,0x00,0x02,0x00,0x39,
-    0x00,0x00,0x02,0x5a,0x07,0x73,0x00,0x0f,0x00,0x19,
-    0x00,0x00,0x01,0x15,0x06,0x06,0x07,0x23,0x26,0x27,
-    0x35,0x33,0x16,0x16,0x17,0x37,0x36,0x37,0x13,0x15,
-    0x21,0x35,0x01,0x21,0x35,0x21,0x15,0x01,0x02,0x32,
-    0x38,0x6e,0x18,0x5f,0x47,0x73,0x2b,0x31,0x7d,0x13,
-    0x31,0x6f,0x1c,0x57,0xfd,0xdf,0x01,0xa8,0xfe,0x5e,
-    0x02,0x0f,0xfe,0x52,0x07,0x73,0x13,0x48,0xb7,0x36,
-    0x95,0xa0,0x13,0x2f,0x91,0x15,0x37,0x85,0x19,0xf8,
-    0xeb,0x5e,0x58,0x04,0xfe,0x60,0x5a,0xfb,0x02,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x32,0x00,0x00,0x02,0x09,
-    0x06,0x21,0x00,0x0f,0x00,0x19,0x00,0x00,0x01,0x15,
-    0x06,0x06,0x07,0x23,0x26,0x27,0x35,0x33,0x16,0x16,
-    0x17,0x37,0x36,0x37,0x13,0x15,0x21,0x35,0x01,0x21,
-    0x35,0x21,0x15,0x01,0x02,0x09,0x38,0x6e,0x18,0x5f,
-    0x46,0x74,0x2b,0x31,0x7d,0x13,0x31,0x6f,0x1c,0x14,
-    0xfe,0x4d,0x01,0x40,0xfe,0xd5,0x01,0x8f,0xfe,0xc1,
-    0x06,0x21,0x13,0x48,0xb7,0x36,0x95,0xa0,0x13,0x2f,
-    0x91,0x15,0x37,0x85,0x19,0xfa,0x33,0x54,0x4c,0x03,
-    0x9d,0x54,0x4d,0xfc,0x64,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x50,0xfe,0x14,0x02,0xdb,0x05,0xcb,0x00,0x1f,
-    0x00,0x00,0x01,0x34,0x36,0x33,0x32,0x17,0x07,0x26,
-    0x23,0x06,0x06,0x07,0x15,0x33,0x15,0x23,0x11,0x14,
-    0x06,0x23,0x22,0x27,0x35,0x16,0x33,0x32,0x36,0x35,
-    0x11,0x23,0x35,0x37,0x01,0x62,0x67,0x74,0x4b,0x53,
-    0x29,0x3f,0x31,0x49,0x35,0x03,0xbe,0xbe,0x6f,0x83,
-    0x45,0x3a,0x48,0x31,0x52,0x47,0xa1,0xa1,0x04,0x66,
-    0xb7,0xae,0x27,0x56,0x21,0x01,0x7a,0x9e,0xb4,0x54,
-    0xfc,0x43,0xc6,0xb7,0x0d,0x5e,0x12,0x7c,0x84,0x03,
-    0xe1,0x35,0x27,0x00,0x00,0x01,0x01,0x56,0x04,0xd9,
-    0x03,0x2d,0x06,0x21,0x00,0x11,0x00,0x00,0x01,0x23,
-    0x26,0x27,0x27,0x06,0x07,0x06,0x07,0x23,0x35,0x36,
-    0x37,0x33,0x16,0x17,0x16,0x17,0x03,0x2d,0x2f,0x2a,
-    0x31,0x61,0x13,0x2c,0x51,0x31,0x2b,0x7a,0x40,0x5f,
-    0x17,0x37,0x3c,0x34,0x04,0xd9,0x2a,0x3b,0x70,0x15,
-    0x33,0x5e,0x2f,0x13,0xa8,0x8d,0x36,0x5b,0x5f,0x45,
-    0x00,0x00,0x00,0x01,0x01,0x56,0x04,0xd9,0x03,0x2d,
-    0x06,0x21,0x00,0x0f,0x00,0x00,0x01,0x15,0x06,0x06,
-    0x07,0x23,0x26,0x27,0x35,0x33,0x16,0x16,0x17,0x37,
-    0x36,0x37,0x03,0x2d,0x38,0x6e,0x18,0x5f,0x46,0x74,
-    0x2b,0x31,0x7d,0x13,0x31,0x6f,0x1c,0x06,0x21,0x13,
-    0x48,0xb7,0x36,0x95,0xa0,0x13,0x2f,0x91,0x15,0x37,
-    0x85,0x19,0x00,0x01,0x01,0x68,0x04,0xdd,0x03,0x1b,
-    0x05,0xc7,0x00,0x0b,0x00,0x00,0x01,0x22,0x27,0x33,
-    0x16,0x16,0x33,0x32,0x37,0x33,0x06,0x06,0x02,0x3b,
-    0xc5,0x0e,0x44,0x07,0x4c,0x40,0x81,0x13,0x48,0x03,
-    0x76,0x04,0xdd,0xea,0x49,0x4d,0x96,0x6e,0x7c,0x00,
-    0x00,0x01,0x00,0x83,0x05,0x0c,0x01,0x00,0x05,0xc9,
-    0x00,0x07,0x00,0x00,0x12,0x36,0x32,0x16,0x14,0x06,
-    0x22,0x26,0x83,0x24,0x39,0x20,0x20,0x38,0x25,0x05,
-    0x96,0x33,0x32,0x58,0x33,0x34,0x00,0x02,0x01,0x89,
-    0x04,0xe3,0x03,0x17,0x06,0x58,0x00,0x07,0x00,0x0f,
-    0x00,0x00,0x00,0x36,0x32,0x16,0x14,0x06,0x22,0x26,
-    0x24,0x26,0x22,0x06,0x14,0x16,0x32,0x36,0x01,0x89,
-    0x6b,0xb3,0x70,0x6c,0xb8,0x6a,0x01,0x40,0x3f,0x70,
-    0x43,0x3e,0x71,0x43,0x05,0xf3,0x65,0x64,0xab,0x66,
-    0x64,0x8b,0x40,0x41,0x69,0x3f,0x40,0x00,0x00,0x00,
-    0x00,0x01,0x00,0x44,0xfe,0x42,0x01,0x37,0x00,0x00,
-    0x00,0x0f,0x00,0x00,0x13,0x14,0x33,0x32,0x37,0x15,
-    0x06,0x23,0x22,0x35,0x34,0x36,0x37,0x33,0x06,0x06,
-    0x9e,0x60,0x27,0x12,0x1e,0x2d,0xa8,0x57,0x3c,0x4a,
-    0x46,0x3d,0xfe,0xfc,0x6d,0x09,0x4a,0x0c,0xb0,0x4b,
-    0x95,0x2e,0x46,0x7b,0x00,0x00,0x00,0x01,0x01,0x29,
-    0x04,0xd9,0x03,0x5a,0x05,0xae,0x00,0x15,0x00,0x00,
-    0x01,0x22,0x26,0x27,0x26,0x22,0x06,0x07,0x23,0x36,
-    0x36,0x33,0x32,0x16,0x17,0x16,0x33,0x32,0x37,0x33,
-    0x06,0x06,0x02,0xba,0x20,0x4a,0x1c,0x4c,0x40,0x2c,
-    0x09,0x4a,0x0c,0x54,0x46,0x20,0x49,0x1b,0x49,0x25,
-    0x3b,0x14,0x4a,0x09,0x54,0x04,0xdb,0x28,0x17,0x40,
-    0x46,0x3b,0x64,0x6f,0x28,0x18,0x3f,0x81,0x65,0x6e,
-    0x00,0x00,0x00,0x02,0x01,0x21,0x04,0xd9,0x03,0x4c,
-    0x06,0x21,0x00,0x0a,0x00,0x14,0x00,0x00,0x01,0x15,
-    0x06,0x07,0x06,0x07,0x23,0x35,0x36,0x36,0x37,0x21,
-    0x15,0x06,0x06,0x07,0x23,0x35,0x36,0x36,0x37,0x02,
-    0x42,0x29,0x45,0x45,0x3f,0x2f,0x2c,0x66,0x18,0x01,
-    0x81,0x25,0x8d,0x40,0x2f,0x2c,0x66,0x18,0x06,0x21,
-    0x11,0x48,0x5d,0x5a,0x38,0x15,0x39,0xc1,0x39,0x11,
-    0x48,0xb5,0x3a,0x15,0x39,0xc1,0x39,0x00,0x00,0x02,
-    0xff,0xc4,0xfe,0x12,0x00,0x41,0xff,0xb0,0x00,0x05,
-    0x00,0x0b,0x00,0x00,0x17,0x32,0x14,0x23,0x22,0x34,
-    0x13,0x32,0x14,0x23,0x22,0x34,0x01,0x40,0x40,0x3d,
-    0x3d,0x40,0x40,0x3d,0x50,0x96,0x96,0xfe,0xf9,0x97,
-    0x97,0x00,0x00,0x05,0xfe,0xb3,0xfe,0x12,0x01,0x4d,
-    0xff,0xb0,0x00,0x05,0x00,0x0b,0x00,0x11,0x00,0x17,
-    0x00,0x1d,0x00,0x00,0x05,0x32,0x14,0x23,0x22,0x34,
-    0x21,0x32,0x14,0x23,0x22,0x34,0x21,0x32,0x14,0x23,
-    0x22,0x34,0x01,0x32,0x14,0x23,0x22,0x34,0x21,0x32,
-    0x14,0x23,0x22,0x34,0xfe,0xf0,0x3f,0x3f,0x3d,0x01,
-    0x5c,0x3f,0x3f,0x3d,0x01,0x3b,0x40,0x40,0x3c,0xfe,
-    0xad,0x40,0x40,0x3d,0x01,0xcc,0x40,0x40,0x3c,0x50,
-    0x96,0x96,0x96,0x96,0x96,0x96,0xfe,0xf9,0x97,0x97,
-    0x97,0x97,0x00,0x00,0x00,0x03,0xfe,0xe1,0xfe,0x12,
-    0x01,0x1e,0xff,0xb0,0x00,0x05,0x00,0x09,0x00,0x0f,
-    0x00,0x00,0x17,0x32,0x14,0x23,0x22,0x34,0x07,0x21,
-    0x35,0x21,0x17,0x32,0x14,0x23,0x22,0x34,0xde,0x40,
-    0x40,0x3d,0x5c,0xfe,0x9c,0x01,0x64,0x99,0x40,0x40,
-    0x3d,0x50,0x96,0x96,0x6e,0x47,0xe0,0x97,0x97,0x00,
-    0x00,0x03,0xfe,0xe1,0xfe,0x12,0x01,0x1e,0xff,0xb0,
-    0x00,0x05,0x00,0x0d,0x00,0x13,0x00,0x00,0x17,0x32,
-    0x14,0x23,0x22,0x34,0x07,0x23,0x15,0x23,0x35,0x23,
-    0x35,0x21,0x17,0x32,0x14,0x23,0x22,0x34,0xde,0x40,
-    0x40,0x3d,0x5c,0x8e,0x48,0x8e,0x01,0x64,0x99,0x40,
-    0x40,0x3d,0x50,0x96,0x96,0x6e,0xca,0xca,0x47,0xe0,
-    0x97,0x97,0x00,0x00,0x00,0x01,0xff,0xc3,0xff,0x1a,
-    0x00,0x40,0xff,0xb0,0x00,0x05,0x00,0x00,0x15,0x32,
-    0x14,0x23,0x22,0x34,0x40,0x40,0x3d,0x50,0x96,0x96,
-    0x00,0x00,0x00,0x02,0xff,0x33,0xff,0x1a,0x00,0xce,
-    0xff,0xb0,0x00,0x05,0x00,0x0b,0x00,0x00,0x07,0x32,
-    0x14,0x23,0x22,0x34,0x21,0x32,0x14,0x23,0x22,0x34,
-    0x90,0x3f,0x3f,0x3d,0x01,0x5c,0x3f,0x3f,0x3d,0x50,
-    0x96,0x96,0x96,0x96,0x00,0x00,0x00,0x03,0xff,0x35,
-    0xfe,0x12,0x00,0xd0,0xff,0xb0,0x00,0x05,0x00,0x0b,
-    0x00,0x11,0x00,0x00,0x07,0x32,0x14,0x23,0x22,0x34,
-    0x21,0x32,0x14,0x23,0x22,0x34,0x03,0x32,0x14,0x23,
-    0x22,0x34,0x8e,0x3f,0x3f,0x3d,0x01,0x5c,0x3f,0x3f,
-    0x3d,0x54,0x40,0x40,0x3d,0x50,0x96,0x96,0x96,0x96,
-    0xfe,0xf9,0x97,0x97,0x00,0x00,0x00,0x01,0xff,0x4e,
-    0xff,0x49,0x00,0xb3,0xff,0x91,0x00,0x03,0x00,0x00,
-    0x17,0x21,0x35,0x21,0xb3,0xfe,0x9b,0x01,0x65,0xb7,
-    0x48,0x00,0x00,0x00,0x00,0x01,0xff,0x4e,0xfe,0x80,
-    0x00,0xb3,0xff,0x91,0x00,0x07,0x00,0x00,0x17,0x23,
-    0x15,0x23,0x35,0x23,0x35,0x21,0xb3,0x8f,0x47,0x8f,
-    0x01,0x65,0xb7,0xc9,0xc9,0x48,0x00,0x01,0xff,0xc3,
-    0x05,0x82,0x00,0x40,0x06,0x18,0x00,0x05,0x00,0x00,
-    0x11,0x32,0x14,0x23,0x22,0x34,0x40,0x40,0x3d,0x06,
-    0x18,0x96,0x96,0x00,0x00,0x01,0xff,0xc4,0x05,0x82,
-    0x00,0x40,0x06,0x18,0x00,0x05,0x00,0x00,0x11,0x32,
-    0x14,0x23,0x22,0x34,0x40,0x40,0x3c,0x06,0x18,0x96,
-    0x96,0x00,0x00,0x03,0xff,0x35,0xfe,0x12,0x00,0xd0,
-    0xff,0xb0,0x00,0x05,0x00,0x0b,0x00,0x11,0x00,0x00,
-    0x07,0x32,0x14,0x23,0x22,0x34,0x17,0x32,0x14,0x23,
-    0x22,0x34,0x17,0x32,0x14,0x23,0x22,0x34,0x8e,0x3f,
-    0x3f,0x3d,0xcb,0x40,0x40,0x3d,0xce,0x3f,0x3f,0x3d,
-    0x50,0x96,0x96,0x83,0x97,0x97,0x84,0x97,0x97,0x00,
-    0x00,0x00,0x00,0x01,0xff,0xc3,0x02,0x53,0x00,0x40,
-    0x02,0xe9,0x00,0x05,0x00,0x00,0x11,0x32,0x14,0x23,
-    0x22,0x34,0x40,0x40,0x3d,0x02,0xe9,0x96,0x96,0x00,
-    0x00,0x01,0xff,0xd3,0xfe,0x45,0x00,0x2c,0xff,0x77,
-    0x00,0x03,0x00,0x00,0x13,0x23,0x11,0x33,0x2c,0x59,
-    0x59,0xfe,0x45,0x01,0x32,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x35,0x04,0xa3,0x01,0xcf,0x05,0x09,0x00,0x03,
-    0x00,0x00,0x01,0x21,0x35,0x21,0x01,0xcf,0xfe,0x66,
-    0x01,0x9a,0x04,0xa3,0x66,0x00,0x00,0x01,0xff,0xc3,
-    0x05,0x82,0x00,0x40,0x06,0x18,0x00,0x05,0x00,0x00,
-    0x11,0x32,0x14,0x23,0x22,0x34,0x40,0x40,0x3d,0x06,
-    0x18,0x96,0x96,0x00,0x00,0x01,0xff,0xc2,0x05,0x82,
-    0x00,0x3f,0x06,0x18,0x00,0x05,0x00,0x00,0x03,0x32,
-    0x14,0x23,0x22,0x34,0x01,0x40,0x40,0x3d,0x06,0x18,
-    0x96,0x96,0x00,0x01,0xff,0x6e,0xff,0x0a,0x00,0x8d,
-    0xff,0xc7,0x00,0x07,0x00,0x00,0x17,0x23,0x15,0x23,
-    0x35,0x23,0x35,0x21,0x8d,0x6c,0x47,0x6c,0x01,0x1f,
-    0x81,0x75,0x75,0x48,0x00,0x01,0x00,0x48,0x00,0x00,
-    0x02,0xbf,0x05,0x0a,0x00,0x1b,0x00,0x00,0x01,0x11,
-    0x14,0x06,0x07,0x06,0x07,0x13,0x23,0x01,0x06,0x06,
-    0x15,0x11,0x23,0x11,0x34,0x37,0x36,0x36,0x37,0x03,
-    0x33,0x01,0x36,0x36,0x35,0x11,0x02,0xb4,0x0a,0x10,
-    0x21,0x6f,0xb5,0x67,0xfe,0xc4,0x41,0x38,0x5b,0x1c,
-    0x11,0x4c,0x39,0xb2,0x66,0x01,0x38,0x3f,0x34,0x05,
-    0x0a,0xfe,0x2c,0x3d,0x5d,0x39,0x74,0x37,0xfe,0x48,
-    0x03,0x03,0x2a,0x99,0x7c,0xfe,0x3c,0x01,0xc5,0x75,
-    0x66,0x3c,0x5f,0x1c,0x01,0xb3,0xfd,0x06,0x27,0x89,
-    0x77,0x01,0xd3,0x00,0x00,0x01,0x00,0x5e,0x00,0x00,
-    0x02,0xcd,0x05,0x1e,0x00,0x17,0x00,0x00,0x13,0x36,
-    0x32,0x16,0x16,0x17,0x16,0x15,0x11,0x33,0x15,0x21,
-    0x35,0x21,0x11,0x34,0x27,0x26,0x27,0x26,0x23,0x22,
-    0x07,0x07,0x5e,0x66,0xa9,0x5e,0x56,0x1b,0x3b,0x56,
-    0xfd,0x92,0x01,0xb9,0x25,0x1f,0x51,0x22,0x2f,0x50,
-    0x66,0x1e,0x05,0x14,0x0a,0x11,0x2f,0x28,0x56,0xaa,
-    0xfc,0x9e,0x54,0x54,0x03,0x62,0x87,0x41,0x37,0x0d,
-    0x06,0x08,0x03,0x00,0x00,0x01,0x00,0x73,0xff,0xfc,
-    0x02,0x03,0x05,0x1e,0x00,0x1b,0x00,0x00,0x01,0x32,
-    0x11,0x11,0x23,0x27,0x23,0x06,0x07,0x06,0x23,0x22,
-    0x27,0x37,0x16,0x33,0x32,0x36,0x35,0x11,0x34,0x27,
-    0x26,0x23,0x22,0x07,0x35,0x36,0x01,0x16,0xed,0x50,
-    0x0a,0x07,0x1d,0x19,0x3e,0x7c,0x1e,0x21,0x12,0x17,
-    0x1f,0x75,0x74,0x1a,0x1e,0x5e,0x23,0x3e,0x37,0x05,
-    0x1e,0xfe,0xdd,0xfc,0x05,0xd5,0x59,0x25,0x5b,0x0b,
-    0x5e,0x0d,0xdd,0xca,0x01,0xfc,0x5b,0x34,0x3e,0x11,
-    0x58,0x0f,0x00,0x01,0x00,0x11,0x00,0x00,0x02,0x87,
-    0x05,0x0a,0x00,0x11,0x00,0x00,0x01,0x15,0x06,0x06,
-    0x07,0x06,0x15,0x11,0x23,0x11,0x34,0x36,0x37,0x36,
-    0x37,0x37,0x21,0x35,0x02,0x87,0x43,0x52,0x14,0x2d,
-    0x5f,0x1c,0x14,0x29,0x1f,0x0e,0xfe,0x39,0x05,0x0a,
-    0x49,0x17,0x3f,0x1d,0x45,0x69,0xfc,0x60,0x03,0xa0,
-    0x3b,0x65,0x1e,0x3e,0x12,0x08,0x54,0x00,0x00,0x00,
-    0x00,0x02,0x00,0x91,0x00,0x00,0x03,0x07,0x05,0x1e,
-    0x00,0x0f,0x00,0x13,0x00,0x00,0x13,0x36,0x32,0x1e,
-    0x02,0x15,0x11,0x23,0x11,0x34,0x2e,0x02,0x22,0x07,
-    0x13,0x23,0x11,0x33,0x91,0xcc,0x9a,0x7f,0x64,0x2d,
-    0x60,0x1c,0x48,0x5d,0x6e,0xe7,0x5f,0x5f,0x5f,0x05,
-    0x0a,0x14,0x1c,0x4d,0x90,0x6f,0xfc,0x4a,0x03,0xb6,
-    0x5a,0x6c,0x3a,0x12,0x15,0xfb,0x4d,0x03,0x2d,0x00,
-    0x00,0x00,0x00,0x01,0x00,0x91,0x00,0x00,0x00,0xf0,
-    0x05,0x0a,0x00,0x03,0x00,0x00,0x33,0x23,0x11,0x33,
-    0xf0,0x5f,0x5f,0x05,0x0a,0x00,0x00,0x01,0x00,0x87,
-    0x00,0x00,0x01,0x8c,0x05,0x0a,0x00,0x0c,0x00,0x00,
-    0x01,0x15,0x06,0x06,0x15,0x11,0x23,0x11,0x34,0x36,
-    0x37,0x23,0x35,0x01,0x8c,0x38,0x45,0x5f,0x4a,0x25,
-    0x98,0x05,0x0a,0x49,0x2c,0xda,0x8c,0xfc,0xd1,0x03,
-    0x2f,0x96,0xd1,0x20,0x54,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x91,0x00,0x00,0x03,0x07,0x05,0x1e,0x00,0x11,
-    0x00,0x00,0x33,0x11,0x36,0x32,0x1e,0x02,0x15,0x11,
-    0x23,0x11,0x34,0x2e,0x02,0x22,0x07,0x11,0x91,0xcc,
-    0x9a,0x7f,0x64,0x2d,0x60,0x1c,0x48,0x5d,0x82,0x74,
-    0x05,0x0a,0x14,0x1c,0x4d,0x90,0x6f,0xfc,0x4a,0x03,
-    0xb6,0x5a,0x6c,0x3a,0x12,0x0c,0xfb,0x44,0x00,0x01,
-    0x00,0x5e,0xff,0xec,0x03,0x16,0x05,0x1e,0x00,0x18,
-    0x00,0x00,0x01,0x20,0x10,0x20,0x13,0x11,0x33,0x11,
-    0x10,0x17,0x16,0x16,0x32,0x36,0x37,0x36,0x11,0x10,
-    0x27,0x2e,0x02,0x07,0x35,0x36,0x01,0xba,0x01,0x5c,
-    0xfd,0x48,0x01,0x60,0x4b,0x24,0x55,0x6e,0x54,0x24,
-    0x4a,0x4a,0x24,0x55,0x64,0x2f,0x2e,0x05,0x1e,0xfa,
-    0xce,0x02,0x99,0x02,0x85,0xfd,0x7b,0xfe,0xb5,0x81,
-    0x3e,0x35,0x35,0x3e,0x7f,0x01,0x4d,0x01,0x4c,0x81,
-    0x3e,0x36,0x02,0x0a,0x58,0x08,0x00,0x01,0x00,0x8c,
-    0x01,0xe2,0x00,0xeb,0x05,0x0a,0x00,0x04,0x00,0x00,
-    0x13,0x11,0x33,0x11,0x07,0x8c,0x5f,0x56,0x01,0xe2,
-    0x03,0x28,0xfd,0x46,0x6e,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x29,0xfe,0x14,0x02,0x1b,0x05,0x1e,0x00,0x0b,
-    0x00,0x00,0x13,0x20,0x11,0x11,0x23,0x11,0x10,0x23,
-    0x22,0x07,0x35,0x36,0xc9,0x01,0x52,0x61,0xf2,0x51,
-    0x4e,0x47,0x05,0x1e,0xfd,0xb3,0xfb,0x43,0x04,0xbd,
-    0x01,0xf3,0x32,0x67,0x25,0x00,0x00,0x01,0x00,0x29,
-    0xff,0xec,0x02,0x1b,0x05,0x1e,0x00,0x1a,0x00,0x00,
-    0x13,0x20,0x11,0x15,0x10,0x21,0x22,0x27,0x27,0x35,
-    0x16,0x33,0x32,0x37,0x3e,0x02,0x37,0x36,0x35,0x35,
-    0x10,0x23,0x22,0x07,0x35,0x36,0xc9,0x01,0x52,0xfe,
-    0xae,0x45,0x40,0x15,0x39,0x60,0x6e,0x3c,0x23,0x18,
-    0x08,0x02,0x03,0xf2,0x51,0x4e,0x47,0x05,0x1e,0xfd,
-    0xb3,0xbd,0xfd,0xd8,0x14,0x07,0x5c,0x21,0x66,0x3c,
-    0x73,0x3b,0x25,0x37,0x26,0xbd,0x01,0xf3,0x32,0x67,
-    0x25,0x00,0x00,0x00,0x00,0x01,0x00,0x2d,0x00,0x00,
-    0x02,0x3e,0x06,0x21,0x00,0x0a,0x00,0x00,0x13,0x21,
-    0x15,0x03,0x03,0x23,0x13,0x13,0x21,0x11,0x33,0x8c,
-    0x01,0xb2,0x9e,0x5b,0x61,0x59,0xa9,0xfe,0x47,0x5f,
-    0x05,0x10,0x6e,0xfd,0x59,0xfe,0x05,0x01,0xf0,0x02,
-    0xc4,0x01,0x6d,0x00,0x00,0x00,0x00,0x02,0x00,0x91,
-    0x00,0x00,0x03,0x07,0x05,0x1e,0x00,0x09,0x00,0x14,
-    0x00,0x00,0x33,0x11,0x36,0x32,0x16,0x16,0x17,0x16,
-    0x15,0x11,0x27,0x11,0x34,0x27,0x2e,0x03,0x22,0x07,
-    0x11,0x91,0xcc,0x94,0x72,0x5d,0x18,0x2f,0x5f,0x15,
-    0x0d,0x22,0x45,0x4a,0x71,0x74,0x05,0x0a,0x14,0x0f,
-    0x29,0x28,0x51,0xab,0xfc,0x3e,0x54,0x03,0x6e,0x7d,
-    0x31,0x1f,0x20,0x14,0x05,0x0c,0xfb,0x98,0x00,0x01,
-    0x00,0x3b,0x00,0x00,0x02,0xce,0x05,0x1e,0x00,0x25,
-    0x00,0x00,0x00,0x36,0x32,0x16,0x16,0x17,0x16,0x15,
-    0x11,0x21,0x35,0x33,0x11,0x34,0x27,0x26,0x27,0x26,
-    0x22,0x06,0x07,0x06,0x07,0x07,0x03,0x23,0x13,0x36,
-    0x35,0x34,0x27,0x27,0x33,0x16,0x17,0x33,0x36,0x37,
-    0x01,0x5d,0x57,0x6c,0x54,0x33,0x0f,0x18,0xfe,0xc3,
-    0xde,0x13,0x18,0x26,0x18,0x53,0x55,0x1a,0x35,0x10,
-    0x07,0x5d,0x60,0x5d,0x02,0x2c,0x11,0x65,0x1c,0x0f,
-    0x06,0x1f,0x32,0x04,0xfc,0x22,0x29,0x46,0x39,0x5f,
-    0xa4,0xfc,0x8d,0x54,0x03,0x1f,0xc0,0x35,0x44,0x12,
-    0x0a,0x2d,0x21,0x44,0x32,0x17,0xfc,0x13,0x03,0xed,
-    0x17,0x1f,0x43,0x77,0x2d,0x41,0x46,0x3e,0x27,0x00,
-    0x00,0x00,0x00,0x01,0x00,0x73,0xfe,0x14,0x01,0x03,
-    0x05,0x0a,0x00,0x09,0x00,0x00,0x01,0x11,0x23,0x11,
-    0x34,0x26,0x27,0x27,0x33,0x16,0x01,0x03,0x5f,0x18,
-    0x0c,0x0d,0x60,0x30,0x03,0x89,0xfa,0x8b,0x05,0x75,
-    0x51,0xc1,0x37,0x38,0xc3,0x00,0x00,0x01,0x00,0x27,
-    0x00,0x00,0x01,0xad,0x05,0x1e,0x00,0x15,0x00,0x00,
-    0x13,0x32,0x11,0x11,0x14,0x06,0x07,0x07,0x21,0x35,
-    0x21,0x36,0x35,0x11,0x34,0x27,0x26,0x23,0x22,0x07,
-    0x35,0x36,0xc0,0xed,0x13,0x0a,0x0a,0xfe,0xa1,0x01,
-    0x0c,0x1b,0x1a,0x1e,0x5e,0x23,0x3e,0x37,0x05,0x1e,
-    0xfe,0xdd,0xfd,0x4e,0x44,0xa4,0x31,0x30,0x54,0x7f,
-    0x76,0x02,0xb2,0x5b,0x34,0x3e,0x11,0x58,0x0f,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x5e,0xff,0xec,0x03,0x16,
-    0x05,0x1e,0x00,0x0a,0x00,0x1a,0x00,0x00,0x01,0x20,
-    0x10,0x20,0x11,0x34,0x12,0x37,0x07,0x35,0x36,0x06,
-    0x02,0x10,0x1e,0x02,0x32,0x3e,0x02,0x10,0x2e,0x02,
-    0x23,0x07,0x01,0xba,0x01,0x5c,0xfd,0x48,0x3f,0x54,
-    0x7e,0xe0,0x4f,0x43,0x26,0x48,0x54,0x6e,0x54,0x48,
-    0x26,0x26,0x48,0x54,0x37,0x5e,0x05,0x1e,0xfa,0xce,
-    0x02,0x99,0xcb,0x01,0x06,0x69,0x07,0x58,0x0e,0xb4,
-    0xfe,0xf1,0xfe,0x85,0xe9,0x7c,0x35,0x35,0x7c,0xe9,
-    0x01,0x4a,0xe9,0x7c,0x35,0x02,0x00,0x00,0x00,0x01,
-    0x00,0x48,0xff,0xcf,0x03,0x2f,0x05,0x0a,0x00,0x14,
-    0x00,0x00,0x01,0x03,0x06,0x07,0x06,0x07,0x06,0x07,
-    0x05,0x35,0x37,0x37,0x01,0x33,0x13,0x13,0x36,0x37,
-    0x36,0x37,0x13,0x03,0x2f,0x3a,0x19,0x14,0x30,0x7c,
-    0x54,0x7f,0xfe,0xff,0xfa,0x1f,0xfe,0xef,0x60,0x86,
-    0x7d,0x83,0x30,0x1c,0x15,0x38,0x05,0x0a,0xfd,0xcb,
-    0xf6,0x5b,0xdb,0x5d,0x3f,0x13,0x2b,0x55,0x2a,0x06,
-    0x04,0xb6,0xfd,0xb8,0xfd,0xb1,0x46,0xd5,0x7e,0xca,
-    0x02,0x34,0x00,0x01,0x00,0x5e,0xfe,0x14,0x03,0x04,
-    0x05,0x1e,0x00,0x17,0x00,0x00,0x01,0x22,0x26,0x10,
-    0x36,0x33,0x20,0x11,0x11,0x23,0x11,0x10,0x23,0x22,
-    0x06,0x07,0x06,0x15,0x14,0x17,0x16,0x33,0x33,0x07,
-    0x01,0x88,0x98,0x92,0xb4,0x96,0x01,0x5c,0x5f,0xfd,
-    0x3d,0x60,0x1c,0x39,0x43,0x34,0x62,0x0e,0x10,0x01,
-    0xb9,0xde,0x01,0x8c,0xfb,0xfd,0x67,0xfb,0x8f,0x04,
-    0x71,0x02,0x3f,0x46,0x38,0x70,0x7b,0xc5,0x52,0x40,
-    0x4b,0x00,0x00,0x01,0x00,0x5e,0xff,0xec,0x03,0x04,
-    0x05,0x1e,0x00,0x25,0x00,0x00,0x01,0x22,0x26,0x10,
-    0x36,0x33,0x20,0x11,0x10,0x02,0x23,0x22,0x27,0x27,
-    0x35,0x16,0x33,0x32,0x36,0x36,0x37,0x36,0x11,0x10,
-    0x27,0x26,0x26,0x22,0x06,0x07,0x06,0x15,0x14,0x17,
-    0x16,0x33,0x33,0x07,0x01,0x88,0x98,0x92,0xb4,0x96,
-    0x01,0x5c,0xc0,0xad,0x69,0x57,0x1d,0x67,0x76,0x2b,
-    0x4a,0x46,0x18,0x37,0x4a,0x24,0x54,0x74,0x60,0x1c,
-    0x39,0x43,0x34,0x62,0x0e,0x10,0x01,0xb9,0xde,0x01,
-    0x8c,0xfb,0xfd,0x67,0xfe,0xb2,0xfe,0xb5,0x0f,0x05,
-    0x59,0x13,0x1f,0x50,0x3f,0x8e,0x01,0x03,0x01,0x4d,
-    0x7f,0x3e,0x35,0x46,0x38,0x70,0x7b,0xc5,0x52,0x40,
-    0x4b,0x00,0x00,0x01,0x00,0x00,0xfe,0x14,0x02,0x31,
-    0x05,0x0a,0x00,0x10,0x00,0x00,0x01,0x11,0x14,0x07,
-    0x06,0x06,0x07,0x11,0x23,0x11,0x03,0x33,0x13,0x36,
-    0x36,0x35,0x11,0x02,0x31,0x32,0x1b,0x6b,0x4a,0x66,
-    0xc9,0x66,0xc9,0x4f,0x54,0x05,0x0a,0xfe,0x46,0x7d,
-    0x6d,0x3a,0x5a,0x15,0xfc,0x57,0x04,0x12,0x02,0xe4,
-    0xfd,0x15,0x2b,0x8f,0x78,0x01,0xb9,0x00,0x00,0x00,
-    0x00,0x01,0x00,0x3b,0x00,0x00,0x02,0xa9,0x05,0x0a,
-    0x00,0x12,0x00,0x00,0x21,0x21,0x35,0x21,0x03,0x01,
-    0x33,0x01,0x17,0x36,0x36,0x37,0x13,0x33,0x03,0x06,
-    0x06,0x07,0x13,0x02,0xa1,0xfd,0x9a,0x01,0xed,0xd5,
-    0xfe,0xe8,0x65,0x01,0x19,0x07,0x30,0x2c,0x0f,0x20,
-    0x5e,0x1f,0x14,0x43,0x49,0xb7,0x54,0x01,0xfd,0x02,
-    0xb9,0xfd,0x47,0x13,0x4d,0xc5,0x85,0x01,0x35,0xfe,
-    0xcb,0xc6,0xe3,0x50,0xfe,0x4f,0x00,0x02,0x00,0x91,
-    0xfe,0x14,0x03,0x0d,0x05,0x0a,0x00,0x19,0x00,0x1d,
-    0x00,0x00,0x25,0x15,0x23,0x35,0x34,0x37,0x37,0x3e,
-    0x03,0x37,0x13,0x21,0x35,0x21,0x15,0x03,0x0e,0x05,
-    0x07,0x06,0x03,0x23,0x11,0x33,0x01,0xd8,0x5d,0x09,
-    0x0e,0x0b,0x3a,0x0b,0x1d,0x03,0xac,0xfd,0xe3,0x02,
-    0x7c,0xac,0x0c,0x21,0x1a,0x0f,0x15,0x0c,0x06,0x0c,
-    0xe7,0x5f,0x5f,0x11,0x11,0x11,0x27,0x2d,0x49,0x35,
-    0xd4,0x2a,0x64,0x0c,0x02,0x65,0x54,0x54,0xfd,0x9b,
-    0x29,0x78,0x5c,0x3c,0x52,0x39,0x1f,0x3e,0xfd,0xe4,
-    0x04,0xe3,0x00,0x01,0x00,0x17,0x00,0x00,0x02,0x10,
-    0x05,0x1e,0x00,0x13,0x00,0x00,0x13,0x36,0x32,0x1e,
-    0x02,0x17,0x16,0x15,0x11,0x23,0x11,0x34,0x2e,0x02,
-    0x23,0x22,0x07,0x07,0x17,0x4d,0x9c,0x5c,0x4f,0x32,
-    0x12,0x21,0x5f,0x14,0x3b,0x55,0x39,0x56,0x50,0x17,
-    0x05,0x14,0x0a,0x0b,0x1f,0x33,0x28,0x49,0x9a,0xfc,
-    0x4a,0x03,0xb6,0x5c,0x69,0x3c,0x11,0x08,0x03,0x00,
-    0x00,0x01,0x00,0x4a,0x00,0x00,0x03,0xce,0x05,0x0a,
-    0x00,0x1e,0x00,0x00,0x21,0x23,0x03,0x33,0x13,0x36,
-    0x36,0x37,0x37,0x33,0x07,0x0e,0x03,0x07,0x13,0x33,
-    0x32,0x36,0x37,0x36,0x13,0x13,0x33,0x03,0x06,0x07,
-    0x0e,0x02,0x01,0x20,0x69,0x6d,0x58,0x3d,0x75,0x70,
-    0x16,0x19,0x54,0x19,0x0d,0x27,0x49,0x74,0x56,0x20,
-    0x19,0x73,0xc3,0x44,0x8c,0x1d,0x36,0x55,0x37,0x17,
-    0x5a,0x33,0x89,0xcd,0x05,0x0a,0xfd,0x23,0x35,0xd4,
-    0xd6,0xfe,0xfe,0x7e,0xac,0x92,0x60,0x20,0xfe,0x87,
-    0x62,0x57,0xb3,0x01,0x1c,0x02,0x2b,0xfd,0xd5,0xec,
-    0xaf,0x61,0x8d,0x56,0x00,0x01,0x00,0x10,0x00,0x00,
-    0x02,0xe9,0x05,0x1e,0x00,0x1e,0x00,0x00,0x13,0x36,
-    0x32,0x16,0x16,0x17,0x16,0x15,0x11,0x23,0x11,0x34,
-    0x27,0x26,0x27,0x26,0x22,0x07,0x11,0x14,0x06,0x23,
-    0x22,0x27,0x35,0x16,0x33,0x32,0x35,0x11,0x07,0x40,
-    0xc2,0xd2,0x64,0x59,0x1c,0x3c,0x5f,0x28,0x22,0x56,
-    0x24,0x51,0x85,0x49,0x49,0x26,0x28,0x2c,0x11,0x44,
-    0x51,0x05,0x08,0x16,0x11,0x2e,0x28,0x56,0xab,0xfc,
-    0x4a,0x03,0xb6,0x88,0x40,0x37,0x0d,0x06,0x07,0xfc,
-    0x0b,0x6f,0x5d,0x08,0x5b,0x08,0x71,0x03,0xec,0x07,
-    0x00,0x01,0x00,0x2b,0x03,0x34,0x01,0x11,0x05,0x0a,
-    0x00,0x09,0x00,0x00,0x01,0x17,0x06,0x07,0x07,0x23,
-    0x36,0x36,0x37,0x37,0x01,0x04,0x0d,0x35,0x1d,0x55,
-    0x3f,0x2f,0x28,0x07,0x07,0x05,0x0a,0x14,0xa9,0x4a,
-    0xcf,0x9a,0xe5,0x2b,0x2c,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x2b,0x03,0x34,0x02,0x2b,0x05,0x0a,0x00,0x09,
-    0x00,0x13,0x00,0x00,0x01,0x17,0x06,0x07,0x07,0x23,
-    0x36,0x36,0x37,0x37,0x21,0x17,0x06,0x07,0x07,0x23,
-    0x36,0x36,0x37,0x37,0x01,0x04,0x0d,0x35,0x1d,0x55,
-    0x3f,0x2f,0x28,0x07,0x07,0x01,0x8e,0x0d,0x35,0x1d,
-    0x55,0x3f,0x2f,0x28,0x07,0x07,0x05,0x0a,0x14,0xa9,
-    0x4a,0xcf,0x9a,0xe5,0x2b,0x2c,0x14,0xa9,0x4a,0xcf,
-    0x9a,0xe5,0x2b,0x2c,0x00,0x01,0x00,0x52,0x02,0x00,
-    0x03,0xae,0x02,0x52,0x00,0x03,0x00,0x00,0x01,0x21,
-    0x35,0x21,0x03,0xae,0xfc,0xa4,0x03,0x5c,0x02,0x00,
-    0x52,0x00,0x00,0x01,0x00,0x52,0x02,0x00,0x07,0xae,
-    0x02,0x52,0x00,0x03,0x00,0x00,0x01,0x21,0x35,0x21,
-    0x07,0xae,0xf8,0xa4,0x07,0x5c,0x02,0x00,0x52,0x00,
-    0x00,0x01,0x00,0x2b,0x03,0xe1,0x01,0x10,0x05,0xb6,
-    0x00,0x06,0x00,0x00,0x13,0x33,0x06,0x07,0x23,0x27,
-    0x36,0xd1,0x3f,0x4a,0x1a,0x73,0x0e,0x43,0x05,0xb6,
-    0xfc,0xd9,0x17,0xe5,0x00,0x00,0x00,0x01,0x00,0x2b,
-    0x03,0xe1,0x01,0x10,0x05,0xb6,0x00,0x06,0x00,0x00,
-    0x01,0x17,0x06,0x07,0x23,0x36,0x37,0x01,0x02,0x0e,
-    0x42,0x64,0x3f,0x4a,0x1a,0x05,0xb6,0x16,0xdd,0xe2,
-    0xfc,0xd9,0x00,0x01,0x00,0x4e,0xfe,0xf8,0x01,0x33,
-    0x00,0xcd,0x00,0x06,0x00,0x00,0x25,0x17,0x06,0x07,
-    0x23,0x36,0x37,0x01,0x25,0x0e,0x43,0x63,0x3f,0x4a,
-    0x1a,0xcd,0x17,0xe5,0xd9,0xfc,0xd9,0x00,0x00,0x02,
-    0x00,0x2b,0x03,0xe1,0x02,0x2b,0x05,0xb6,0x00,0x06,
-    0x00,0x0d,0x00,0x00,0x13,0x33,0x06,0x07,0x23,0x27,
-    0x36,0x25,0x33,0x06,0x07,0x23,0x27,0x36,0xd1,0x3f,
-    0x4a,0x1a,0x73,0x0e,0x43,0x01,0x7e,0x3f,0x4a,0x1a,
-    0x73,0x0e,0x43,0x05,0xb6,0xfc,0xd9,0x17,0xe5,0xd9,
-    0xfc,0xd9,0x17,0xe5,0x00,0x02,0x00,0x2b,0x03,0xe1,
-    0x02,0x2b,0x05,0xb6,0x00,0x06,0x00,0x0d,0x00,0x00,
-    0x01,0x17,0x06,0x07,0x23,0x36,0x37,0x21,0x17,0x06,
-    0x07,0x23,0x36,0x37,0x01,0x02,0x0e,0x42,0x64,0x3f,
-    0x4a,0x1a,0x01,0x8e,0x0e,0x42,0x64,0x3f,0x4a,0x1a,
-    0x05,0xb6,0x16,0xdd,0xe2,0xfc,0xd9,0x16,0xdd,0xe2,
-    0xfc,0xd9,0x00,0x00,0x00,0x02,0x00,0x21,0xfe,0xf8,
-    0x02,0x21,0x00,0xcd,0x00,0x06,0x00,0x0d,0x00,0x00,
-    0x37,0x17,0x06,0x07,0x23,0x36,0x37,0x13,0x12,0x37,
-    0x33,0x17,0x06,0x07,0xf8,0x0e,0x43,0x63,0x3f,0x4a,
-    0x1a,0xb6,0x4e,0x17,0x72,0x0f,0x3b,0x6b,0xcd,0x17,
-    0xe5,0xd9,0xfc,0xd9,0xfe,0x2b,0x01,0x10,0xc5,0x17,
-    0xca,0xf4,0x00,0x00,0x00,0x01,0x00,0x7b,0x00,0x00,
-    0x02,0xf8,0x06,0x14,0x00,0x0b,0x00,0x00,0x01,0x25,
-    0x15,0x25,0x13,0x23,0x13,0x05,0x35,0x05,0x03,0x33,
-    0x01,0xd1,0x01,0x27,0xfe,0xd9,0x18,0x74,0x18,0xfe,
-    0xee,0x01,0x12,0x18,0x74,0x04,0x68,0x13,0x5c,0x0a,
-    0xfb,0xd7,0x04,0x29,0x0a,0x5c,0x13,0x01,0xac,0x00,
-    0x00,0x01,0x00,0x7b,0x00,0x00,0x02,0xf8,0x06,0x14,
-    0x00,0x15,0x00,0x00,0x01,0x25,0x15,0x25,0x13,0x03,
-    0x25,0x15,0x25,0x13,0x23,0x13,0x05,0x35,0x05,0x03,
-    0x13,0x05,0x35,0x05,0x03,0x33,0x01,0xd1,0x01,0x27,
-    0xfe,0xd9,0x0a,0x0a,0x01,0x27,0xfe,0xd9,0x18,0x74,
-    0x18,0xfe,0xee,0x01,0x12,0x0c,0x0c,0xfe,0xee,0x01,
-    0x12,0x18,0x74,0x04,0x96,0x12,0x5c,0x0a,0xfe,0xbc,
-    0xfe,0xac,0x0b,0x5c,0x10,0xfe,0x83,0x01,0x7d,0x10,
-    0x5c,0x0b,0x01,0x54,0x01,0x44,0x0a,0x5c,0x12,0x01,
-    0x7e,0x00,0x00,0x01,0x00,0xa8,0x01,0xfa,0x02,0x5a,
-    0x03,0xdd,0x00,0x07,0x00,0x00,0x00,0x32,0x16,0x14,
-    0x06,0x22,0x26,0x34,0x01,0x18,0xd2,0x70,0x70,0xd0,
-    0x72,0x03,0xdd,0x7a,0xec,0x7d,0x7d,0xec,0x00,0x03,
-    0x00,0x85,0xff,0xf0,0x04,0x6d,0x00,0xc5,0x00,0x06,
-    0x00,0x0d,0x00,0x14,0x00,0x00,0x36,0x32,0x15,0x14,
-    0x06,0x23,0x22,0x24,0x32,0x15,0x14,0x06,0x23,0x22,
-    0x24,0x32,0x15,0x14,0x06,0x23,0x22,0x85,0x9c,0x2b,
-    0x23,0x4e,0x01,0xa6,0x9c,0x2b,0x23,0x4e,0x01,0xa6,
-    0x9c,0x2b,0x23,0x4e,0xc5,0x6b,0x36,0x34,0xd5,0x6b,
-    0x36,0x34,0xd5,0x6b,0x36,0x34,0x00,0x07,0x00,0x5e,
-    0xff,0xec,0x06,0x3f,0x05,0xcb,0x00,0x07,0x00,0x0b,
-    0x00,0x15,0x00,0x1d,0x00,0x25,0x00,0x2f,0x00,0x39,
-    0x00,0x00,0x12,0x36,0x32,0x16,0x10,0x06,0x22,0x26,
-    0x01,0x23,0x01,0x33,0x05,0x22,0x06,0x10,0x16,0x33,
-    0x32,0x36,0x35,0x10,0x00,0x36,0x32,0x16,0x10,0x06,
-    0x22,0x26,0x00,0x32,0x16,0x10,0x06,0x22,0x26,0x10,
-    0x25,0x22,0x06,0x10,0x16,0x33,0x32,0x36,0x35,0x10,
-    0x21,0x22,0x06,0x10,0x16,0x33,0x32,0x36,0x35,0x10,
-    0x5e,0x66,0xc7,0x69,0x6c,0xc3,0x67,0x01,0x3e,0x5d,
-    0x01,0xde,0x58,0xfd,0xb0,0x3a,0x33,0x34,0x3d,0x3b,
-    0x36,0x01,0x2b,0x66,0xc6,0x69,0x6c,0xc2,0x67,0x02,
-    0x4b,0xc6,0x69,0x6c,0xc2,0x67,0xfe,0xe1,0x3a,0x32,
-    0x33,0x3d,0x3b,0x36,0x01,0x71,0x3a,0x33,0x34,0x3d,
-    0x3b,0x35,0x04,0xe1,0xea,0xe9,0xfe,0x45,0xf2,0xee,
-    0xfc,0xdd,0x05,0xb6,0x39,0xb7,0xfe,0x7b,0xb8,0xb9,
-    0xc2,0x01,0x79,0xfd,0x1e,0xe6,0xe9,0xfe,0x43,0xef,
-    0xf0,0x02,0xa5,0xe9,0xfe,0x46,0xf2,0xef,0x01,0xbc,
-    0x9c,0xb7,0xfe,0x7b,0xb8,0xb9,0xc2,0x01,0x79,0xb7,
-    0xfe,0x7b,0xb8,0xb8,0xc3,0x01,0x79,0x00,0x00,0x01,
-    0x00,0x52,0x00,0x93,0x01,0xae,0x03,0x8b,0x00,0x06,
-    0x00,0x00,0x01,0x03,0x13,0x07,0x01,0x35,0x01,0x01,
-    0xae,0xdb,0xdb,0x3d,0xfe,0xe1,0x01,0x1f,0x03,0x68,
-    0xfe,0xa8,0xfe,0xa8,0x25,0x01,0x6f,0x1b,0x01,0x6e,
-    0x00,0x00,0x00,0x01,0x00,0x52,0x00,0x93,0x01,0xae,
-    0x03,0x8b,0x00,0x06,0x00,0x00,0x01,0x15,0x01,0x27,
-    0x13,0x03,0x37,0x01,0xae,0xfe,0xe1,0x3d,0xdb,0xdb,
-    0x3d,0x02,0x1d,0x1b,0xfe,0x91,0x25,0x01,0x58,0x01,
-    0x58,0x23,0x00,0x01,0xfe,0xd7,0x00,0x00,0x02,0x33,
-    0x05,0xb6,0x00,0x03,0x00,0x00,0x23,0x23,0x01,0x33,
-    0xcd,0x5c,0x03,0x00,0x5c,0x05,0xb6,0x00,0x00,0x00,
-    0x00,0x02,0x00,0x91,0x00,0x00,0x03,0xdf,0x05,0x0a,
-    0x00,0x13,0x00,0x26,0x00,0x00,0x13,0x33,0x32,0x16,
-    0x16,0x17,0x16,0x15,0x11,0x23,0x11,0x34,0x27,0x26,
-    0x27,0x26,0x23,0x23,0x11,0x23,0x01,0x11,0x14,0x06,
-    0x07,0x06,0x21,0x23,0x11,0x33,0x11,0x33,0x32,0x37,
-    0x36,0x37,0x36,0x35,0x11,0x91,0x8d,0x5d,0x85,0x77,
-    0x23,0x4d,0x5f,0x3d,0x34,0x7b,0x33,0x4b,0x2e,0x5f,
-    0x03,0x4e,0x2f,0x38,0x6d,0xfe,0xe4,0x76,0x5f,0x17,
-    0xc0,0x5d,0x55,0x15,0x0a,0x05,0x0a,0x10,0x2e,0x28,
-    0x55,0xaa,0xfd,0x63,0x02,0x9d,0x87,0x40,0x37,0x0d,
-    0x06,0xfb,0x4a,0x05,0x0a,0xfd,0x7d,0xa3,0xe6,0x56,
-    0xa8,0x04,0x02,0xfc,0x52,0x5a,0x52,0xbc,0x54,0x77,
-    0x02,0x83,0x00,0x00,0x00,0x01,0x00,0x23,0xff,0xec,
-    0x03,0x04,0x05,0xcd,0x00,0x26,0x00,0x00,0x13,0x33,
-    0x12,0x12,0x33,0x32,0x17,0x07,0x26,0x23,0x22,0x03,
-    0x21,0x15,0x21,0x07,0x15,0x17,0x21,0x15,0x21,0x16,
-    0x16,0x33,0x32,0x37,0x15,0x06,0x23,0x22,0x02,0x03,
-    0x23,0x35,0x33,0x27,0x35,0x37,0x23,0x23,0x8d,0x10,
-    0xcb,0x9a,0x7a,0x65,0x33,0x56,0x52,0xed,0x25,0x01,
-    0x45,0xfe,0xb6,0x02,0x02,0x01,0x29,0xfe,0xdc,0x0f,
-    0x8f,0x84,0x65,0x56,0x56,0x65,0xb0,0xc3,0x16,0x8d,
-    0x89,0x02,0x02,0x89,0x03,0x83,0x01,0x0d,0x01,0x3d,
-    0x4a,0x56,0x3d,0xfe,0x19,0x52,0x4c,0x49,0x34,0x51,
-    0xe9,0xe0,0x2f,0x64,0x2d,0x01,0x13,0x01,0x18,0x51,
-    0x65,0x27,0x3d,0x00,0x00,0x02,0x00,0x0e,0x02,0xe5,
-    0x05,0x1b,0x05,0xb6,0x00,0x07,0x00,0x18,0x00,0x00,
-    0x01,0x23,0x11,0x23,0x11,0x23,0x35,0x21,0x01,0x23,
-    0x11,0x37,0x23,0x03,0x23,0x03,0x23,0x17,0x11,0x23,
-    0x11,0x33,0x13,0x13,0x33,0x02,0x19,0xdc,0x56,0xd9,
-    0x02,0x0b,0x03,0x02,0x56,0x06,0x08,0xe4,0x49,0xde,
-    0x08,0x06,0x52,0x7d,0xdd,0xe0,0x7d,0x05,0x68,0xfd,
-    0x7d,0x02,0x83,0x4e,0xfd,0x2f,0x01,0x8e,0xcf,0xfd,
-    0xa3,0x02,0x61,0xc9,0xfe,0x68,0x02,0xd1,0xfd,0xa2,
-    0x02,0x5e,0x00,0x03,0x00,0x14,0x00,0x00,0x02,0xc5,
-    0x06,0x1f,0x00,0x15,0x00,0x1d,0x00,0x21,0x00,0x00,
-    0x13,0x34,0x36,0x33,0x32,0x17,0x07,0x26,0x23,0x06,
-    0x06,0x07,0x15,0x33,0x15,0x23,0x11,0x23,0x11,0x23,
-    0x35,0x37,0x00,0x36,0x32,0x16,0x14,0x06,0x22,0x26,
-    0x13,0x23,0x11,0x33,0x9e,0x62,0x79,0x47,0x38,0x21,
-    0x33,0x2d,0x48,0x31,0x02,0xaa,0xaa,0x5e,0x8a,0x8a,
-    0x01,0xaa,0x24,0x39,0x20,0x20,0x38,0x25,0x6d,0x5f,
-    0x5f,0x04,0x9a,0xcf,0xb6,0x19,0x58,0x19,0x03,0x7d,
-    0xaf,0x5b,0x54,0xfc,0x17,0x03,0xe9,0x36,0x29,0x01,
-    0x4e,0x33,0x32,0x58,0x33,0x34,0xfa,0xc0,0x04,0x3d,
-    0x00,0x02,0x00,0x14,0x00,0x00,0x02,0xb5,0x06,0x1f,
-    0x00,0x15,0x00,0x19,0x00,0x00,0x13,0x34,0x36,0x33,
-    0x32,0x17,0x07,0x26,0x23,0x06,0x06,0x07,0x15,0x33,
-    0x15,0x23,0x11,0x23,0x11,0x23,0x35,0x37,0x01,0x23,
-    0x11,0x33,0x9e,0x62,0x79,0x47,0x38,0x21,0x33,0x2d,
-    0x48,0x31,0x02,0xaa,0xaa,0x5e,0x8a,0x8a,0x02,0x17,
-    0x5f,0x5f,0x04,0x9a,0xcf,0xb6,0x19,0x58,0x19,0x03,
-    0x7d,0xaf,0x5b,0x54,0xfc,0x17,0x03,0xe9,0x36,0x29,
-    0xfb,0xb8,0x06,0x14,0x00,0x02,0x00,0x4a,0x00,0x00,
-    0x03,0xe0,0x06,0x18,0x00,0x05,0x00,0x24,0x00,0x00,
-    0x01,0x32,0x14,0x23,0x22,0x34,0x01,0x23,0x03,0x33,
-    0x13,0x36,0x36,0x37,0x37,0x33,0x07,0x0e,0x03,0x07,
-    0x13,0x33,0x32,0x36,0x37,0x36,0x13,0x13,0x33,0x03,
-    0x06,0x07,0x0e,0x02,0x03,0xa0,0x40,0x40,0x3d,0xfd,
-    0xbd,0x69,0x6d,0x58,0x3d,0x75,0x70,0x16,0x19,0x54,
-    0x19,0x0d,0x27,0x49,0x74,0x56,0x20,0x19,0x73,0xc3,
-    0x44,0x8c,0x1d,0x36,0x55,0x37,0x17,0x5a,0x33,0x89,
-    0xcd,0x06,0x18,0x96,0x96,0xf9,0xe8,0x05,0x0a,0xfd,
-    0x23,0x35,0xd4,0xd6,0xfe,0xfe,0x7e,0xac,0x92,0x60,
-    0x20,0xfe,0x87,0x62,0x57,0xb3,0x01,0x1c,0x02,0x2b,
-    0xfd,0xd5,0xec,0xaf,0x61,0x8d,0x56,0x00,0x00,0x02,
-    0x00,0x2e,0x00,0x00,0x03,0xce,0x06,0x18,0x00,0x05,
-    0x00,0x24,0x00,0x00,0x13,0x32,0x14,0x23,0x22,0x34,
-    0x13,0x23,0x03,0x33,0x13,0x36,0x36,0x37,0x37,0x33,
-    0x07,0x0e,0x03,0x07,0x13,0x33,0x32,0x36,0x37,0x36,
-    0x13,0x13,0x33,0x03,0x06,0x07,0x0e,0x02,0x6b,0x40,
-    0x40,0x3d,0xf2,0x69,0x6d,0x58,0x3d,0x75,0x70,0x16,
-    0x19,0x54,0x19,0x0d,0x27,0x49,0x74,0x56,0x20,0x19,
-    0x73,0xc3,0x44,0x8c,0x1d,0x36,0x55,0x37,0x17,0x5a,
-    0x33,0x89,0xcd,0x06,0x18,0x96,0x96,0xf9,0xe8,0x05,
-    0x0a,0xfd,0x23,0x35,0xd4,0xd6,0xfe,0xfe,0x7e,0xac,
-    0x92,0x60,0x20,0xfe,0x87,0x62,0x57,0xb3,0x01,0x1c,
-    0x02,0x2b,0xfd,0xd5,0xec,0xaf,0x61,0x8d,0x56,0x00,
-    0x00,0x00,0x00,0x03,0x00,0x4a,0x00,0x00,0x03,0xe0,
-    0x06,0x18,0x00,0x05,0x00,0x24,0x00,0x2a,0x00,0x00,
-    0x01,0x32,0x14,0x23,0x22,0x34,0x01,0x23,0x03,0x33,
-    0x13,0x36,0x36,0x37,0x37,0x33,0x07,0x0e,0x03,0x07,
-    0x13,0x33,0x32,0x36,0x37,0x36,0x13,0x13,0x33,0x03,
-    0x06,0x07,0x0e,0x02,0x13,0x32,0x14,0x23,0x22,0x34,
-    0x03,0xa0,0x40,0x40,0x3d,0xfd,0xbd,0x69,0x6d,0x58,
-    0x3d,0x75,0x70,0x16,0x19,0x54,0x19,0x0d,0x27,0x49,
-    0x74,0x56,0x20,0x19,0x73,0xc3,0x44,0x8c,0x1d,0x36,
-    0x55,0x37,0x17,0x5a,0x33,0x89,0xcd,0x6f,0x40,0x40,
-    0x3d,0x06,0x18,0x96,0x96,0xf9,0xe8,0x05,0x0a,0xfd,
-    0x23,0x35,0xd4,0xd6,0xfe,0xfe,0x7e,0xac,0x92,0x60,
-    0x20,0xfe,0x87,0x62,0x57,0xb3,0x01,0x1c,0x02,0x2b,
-    0xfd,0xd5,0xec,0xaf,0x61,0x8d,0x56,0x02,0x03,0x96,
-    0x96,0x00,0x00,0x03,0x00,0x2e,0x00,0x00,0x03,0xce,
-    0x06,0x18,0x00,0x05,0x00,0x24,0x00,0x2a,0x00,0x00,
-    0x13,0x32,0x14,0x23,0x22,0x34,0x13,0x23,0x03,0x33,
-    0x13,0x36,0x36,0x37,0x37,0x33,0x07,0x0e,0x03,0x07,
-    0x13,0x33,0x32,0x36,0x37,0x36,0x13,0x13,0x33,0x03,
-    0x06,0x07,0x0e,0x02,0x13,0x32,0x14,0x23,0x22,0x34,
-    0x6b,0x40,0x40,0x3d,0xf2,0x69,0x6d,0x58,0x3d,0x75,
-    0x70,0x16,0x19,0x54,0x19,0x0d,0x27,0x49,0x74,0x56,
-    0x20,0x19,0x73,0xc3,0x44,0x8c,0x1d,0x36,0x55,0x37,
-    0x17,0x5a,0x33,0x89,0xcd,0x6f,0x40,0x40,0x3d,0x06,
-    0x18,0x96,0x96,0xf9,0xe8,0x05,0x0a,0xfd,0x23,0x35,
-    0xd4,0xd6,0xfe,0xfe,0x7e,0xac,0x92,0x60,0x20,0xfe,
-    0x87,0x62,0x57,0xb3,0x01,0x1c,0x02,0x2b,0xfd,0xd5,
-    0xec,0xaf,0x61,0x8d,0x56,0x02,0x03,0x96,0x96,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x48,0xfe,0xdb,0x02,0xbf,
-    0x05,0x0a,0x00,0x1b,0x00,0x1f,0x00,0x00,0x01,0x11,
-    0x14,0x06,0x07,0x06,0x07,0x13,0x23,0x01,0x06,0x06,
-    0x15,0x11,0x23,0x11,0x34,0x37,0x36,0x36,0x37,0x03,
-    0x33,0x01,0x36,0x36,0x35,0x11,0x03,0x21,0x35,0x21,
-    0x02,0xb4,0x0a,0x10,0x21,0x6f,0xb5,0x67,0xfe,0xc4,
-    0x41,0x38,0x5b,0x1c,0x11,0x4c,0x39,0xb2,0x66,0x01,
-    0x38,0x3f,0x34,0x31,0xfe,0x9b,0x01,0x65,0x05,0x0a,
-    0xfe,0x2c,0x3d,0x5d,0x39,0x74,0x37,0xfe,0x48,0x03,
-    0x03,0x2a,0x99,0x7c,0xfe,0x3c,0x01,0xc5,0x75,0x66,
-    0x3c,0x5f,0x1c,0x01,0xb3,0xfd,0x06,0x27,0x89,0x77,
-    0x01,0xd3,0xf9,0xd1,0x48,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x48,0xfe,0x12,0x02,0xbf,0x05,0x0a,0x00,0x1b,
-    0x00,0x23,0x00,0x00,0x01,0x11,0x14,0x06,0x07,0x06,
-    0x07,0x13,0x23,0x01,0x06,0x06,0x15,0x11,0x23,0x11,
-    0x34,0x37,0x36,0x36,0x37,0x03,0x33,0x01,0x36,0x36,
-    0x35,0x11,0x03,0x23,0x15,0x23,0x35,0x23,0x35,0x21,
-    0x02,0xb4,0x0a,0x10,0x21,0x6f,0xb5,0x67,0xfe,0xc4,
-    0x41,0x38,0x5b,0x1c,0x11,0x4c,0x39,0xb2,0x66,0x01,
-    0x38,0x3f,0x34,0x31,0x8f,0x47,0x8f,0x01,0x65,0x05,
-    0x0a,0xfe,0x2c,0x3d,0x5d,0x39,0x74,0x37,0xfe,0x48,
-    0x03,0x03,0x2a,0x99,0x7c,0xfe,0x3c,0x01,0xc5,0x75,
-    0x66,0x3c,0x5f,0x1c,0x01,0xb3,0xfd,0x06,0x27,0x89,
-    0x77,0x01,0xd3,0xf9,0xd1,0xc9,0xc9,0x48,0x00,0x02,
-    0x00,0x48,0x00,0x00,0x02,0xbf,0x05,0x0a,0x00,0x1b,
-    0x00,0x21,0x00,0x00,0x01,0x11,0x14,0x06,0x07,0x06,
-    0x07,0x13,0x23,0x01,0x06,0x06,0x15,0x11,0x23,0x11,
-    0x34,0x37,0x36,0x36,0x37,0x03,0x33,0x01,0x36,0x36,
-    0x35,0x11,0x01,0x32,0x14,0x23,0x22,0x34,0x02,0xb4,
-    0x0a,0x10,0x21,0x6f,0xb5,0x67,0xfe,0xc4,0x41,0x38,
-    0x5b,0x1c,0x11,0x4c,0x39,0xb2,0x66,0x01,0x38,0x3f,
-    0x34,0xfe,0xe0,0x40,0x40,0x3d,0x05,0x0a,0xfe,0x2c,
-    0x3d,0x5d,0x39,0x74,0x37,0xfe,0x48,0x03,0x03,0x2a,
-    0x99,0x7c,0xfe,0x3c,0x01,0xc5,0x75,0x66,0x3c,0x5f,
-    0x1c,0x01,0xb3,0xfd,0x06,0x27,0x89,0x77,0x01,0xd3,
-    0xfc,0x74,0x96,0x96,0x00,0x02,0x00,0x5e,0x00,0x00,
-    0x02,0xcd,0x05,0x1e,0x00,0x17,0x00,0x1d,0x00,0x00,
-    0x13,0x36,0x32,0x16,0x16,0x17,0x16,0x15,0x11,0x33,
-    0x15,0x21,0x35,0x21,0x11,0x34,0x27,0x26,0x27,0x26,
-    0x23,0x22,0x07,0x07,0x13,0x32,0x14,0x23,0x22,0x34,
-    0x5e,0x66,0xa9,0x5e,0x56,0x1b,0x3b,0x56,0xfd,0x92,
-    0x01,0xb9,0x25,0x1f,0x51,0x22,0x2f,0x50,0x66,0x1e,
-    0xbd,0x40,0x40,0x3d,0x05,0x14,0x0a,0x11,0x2f,0x28,
-    0x56,0xaa,0xfc,0x9e,0x54,0x54,0x03,0x62,0x87,0x41,
-    0x37,0x0d,0x06,0x08,0x03,0xfe,0x2c,0x96,0x96,0x00,
-    0x00,0x02,0x00,0x73,0xff,0xfc,0x02,0x03,0x05,0x1e,
-    0x00,0x1b,0x00,0x21,0x00,0x00,0x01,0x32,0x11,0x11,
-    0x23,0x27,0x23,0x06,0x07,0x06,0x23,0x22,0x27,0x37,
-    0x16,0x33,0x32,0x36,0x35,0x11,0x34,0x27,0x26,0x23,
-    0x22,0x07,0x35,0x36,0x13,0x32,0x14,0x23,0x22,0x34,
-    0x01,0x16,0xed,0x50,0x0a,0x07,0x1d,0x19,0x3e,0x7c,
-    0x1e,0x21,0x12,0x17,0x1f,0x75,0x74,0x1a,0x1e,0x5e,
-    0x23,0x3e,0x37,0x19,0x40,0x40,0x3d,0x05,0x1e,0xfe,
-    0xdd,0xfc,0x05,0xd5,0x59,0x25,0x5b,0x0b,0x5e,0x0d,
-    0xdd,0xca,0x01,0xfc,0x5b,0x34,0x3e,0x11,0x58,0x0f,
-    0xfd,0xcb,0x96,0x96,0x00,0x02,0x00,0x11,0x00,0x00,
-    0x02,0x87,0x05,0x0a,0x00,0x11,0x00,0x17,0x00,0x00,
-    0x01,0x15,0x06,0x06,0x07,0x06,0x15,0x11,0x23,0x11,
-    0x34,0x36,0x37,0x36,0x37,0x37,0x21,0x35,0x13,0x32,
-    0x14,0x23,0x22,0x34,0x02,0x87,0x43,0x52,0x14,0x2d,
-    0x5f,0x1c,0x14,0x29,0x1f,0x0e,0xfe,0x39,0xcb,0x40,
-    0x40,0x3d,0x05,0x0a,0x49,0x17,0x3f,0x1d,0x45,0x69,
-    0xfc,0x60,0x03,0xa0,0x3b,0x65,0x1e,0x3e,0x12,0x08,
-    0x54,0xfd,0xdf,0x96,0x96,0x00,0x00,0x00,0x00,0x03,
-    0x00,0x91,0x00,0x00,0x03,0x07,0x05,0x1e,0x00,0x0f,
-    0x00,0x13,0x00,0x19,0x00,0x00,0x13,0x36,0x32,0x1e,
-    0x02,0x15,0x11,0x23,0x11,0x34,0x2e,0x02,0x22,0x07,
-    0x11,0x11,0x33,0x11,0x13,0x32,0x14,0x23,0x22,0x34,
-    0x91,0xcc,0x9a,0x7f,0x64,0x2d,0x60,0x1c,0x48,0x5d,
-    0x6e,0xe7,0x5f,0xda,0x40,0x40,0x3d,0x05,0x0a,0x14,
-    0x1c,0x4d,0x90,0x6f,0xfc,0x4a,0x03,0xb6,0x5a,0x6c,
-    0x3a,0x12,0x15,0xfb,0x4d,0x03,0x2d,0xfc,0xd3,0x02,
-    0xe9,0x96,0x96,0x00,0x00,0x00,0x00,0x02,0xff,0xcc,
-    0x00,0x00,0x00,0xf0,0x05,0x0a,0x00,0x03,0x00,0x09,
-    0x00,0x00,0x33,0x11,0x33,0x11,0x03,0x32,0x14,0x23,
-    0x22,0x34,0x91,0x5f,0xe7,0x40,0x40,0x3d,0x05,0x0a,
-    0xfa,0xf6,0x02,0xe9,0x96,0x96,0x00,0x02,0xff,0xec,
-    0x00,0x00,0x01,0x8c,0x05,0x0a,0x00,0x0c,0x00,0x12,
-    0x00,0x00,0x01,0x15,0x06,0x06,0x15,0x11,0x23,0x11,
-    0x34,0x36,0x37,0x23,0x35,0x03,0x32,0x14,0x23,0x22,
-    0x34,0x01,0x8c,0x38,0x45,0x5f,0x4a,0x25,0x98,0x5e,
-    0x40,0x40,0x3d,0x05,0x0a,0x49,0x2c,0xda,0x8c,0xfc,
-    0xd1,0x03,0x2f,0x96,0xd1,0x20,0x54,0xfd,0xdf,0x96,
-    0x96,0x00,0x00,0x00,0x00,0x02,0x00,0x5e,0xff,0xec,
-    0x03,0x16,0x05,0x1e,0x00,0x18,0x00,0x1e,0x00,0x00,
-    0x01,0x20,0x10,0x20,0x13,0x11,0x33,0x11,0x10,0x17,
-    0x16,0x16,0x32,0x36,0x37,0x36,0x11,0x10,0x27,0x2e,
-    0x02,0x07,0x35,0x36,0x13,0x32,0x14,0x23,0x22,0x34,
-    0x01,0xba,0x01,0x5c,0xfd,0x48,0x01,0x60,0x4b,0x24,
-    0x55,0x6e,0x54,0x24,0x4a,0x4a,0x24,0x55,0x64,0x2f,
-    0x2e,0x2f,0x40,0x40,0x3d,0x05,0x1e,0xfa,0xce,0x02,
-    0x99,0x02,0x85,0xfd,0x7b,0xfe,0xb5,0x81,0x3e,0x35,
-    0x35,0x3e,0x7f,0x01,0x4d,0x01,0x4c,0x81,0x3e,0x36,
-    0x02,0x0a,0x58,0x08,0xfd,0xcb,0x96,0x96,0x00,0x02,
-    0xff,0xca,0x01,0xe2,0x00,0xeb,0x05,0x0a,0x00,0x04,
-    0x00,0x0a,0x00,0x00,0x13,0x11,0x33,0x11,0x07,0x03,
-    0x32,0x14,0x23,0x22,0x34,0x8c,0x5f,0x56,0x8e,0x40,
-    0x40,0x3d,0x01,0xe2,0x03,0x28,0xfd,0x46,0x6e,0x01,
-    0x7c,0x96,0x96,0x00,0x00,0x00,0x00,0x02,0x00,0x29,
-    0xfe,0x14,0x02,0x1b,0x05,0x1e,0x00,0x0b,0x00,0x11,
-    0x00,0x00,0x13,0x20,0x11,0x11,0x23,0x11,0x10,0x23,
-    0x22,0x07,0x35,0x36,0x13,0x32,0x14,0x23,0x22,0x34,
-    0xc9,0x01,0x52,0x61,0xf2,0x51,0x4e,0x47,0x51,0x40,
-    0x40,0x3d,0x05,0x1e,0xfd,0xb3,0xfb,0x43,0x04,0xbd,
-    0x01,0xf3,0x32,0x67,0x25,0xfd,0xcb,0x96,0x96,0x00,
-    0x00,0x02,0x00,0x29,0xff,0xec,0x02,0x1b,0x05,0x1e,
-    0x00,0x1a,0x00,0x20,0x00,0x00,0x13,0x20,0x11,0x15,
-    0x10,0x21,0x22,0x27,0x27,0x35,0x16,0x33,0x32,0x37,
-    0x3e,0x02,0x37,0x36,0x35,0x35,0x10,0x23,0x22,0x07,
-    0x35,0x36,0x13,0x32,0x14,0x23,0x22,0x34,0xc9,0x01,
-    0x52,0xfe,0xae,0x45,0x40,0x15,0x39,0x60,0x6e,0x3c,
-    0x23,0x18,0x08,0x02,0x03,0xf2,0x51,0x4e,0x47,0x51,
-    0x40,0x40,0x3d,0x05,0x1e,0xfd,0xb3,0xbd,0xfd,0xd8,
-    0x14,0x07,0x5c,0x21,0x66,0x3c,0x73,0x3b,0x25,0x37,
-    0x26,0xbd,0x01,0xf3,0x32,0x67,0x25,0xfd,0xcb,0x96,
-    0x96,0x00,0x00,0x00,0x00,0x02,0x00,0x2d,0x00,0x00,
-    0x02,0x3e,0x06,0x21,0x00,0x0a,0x00,0x10,0x00,0x00,
-    0x01,0x15,0x03,0x03,0x23,0x13,0x13,0x21,0x11,0x33,
-    0x11,0x13,0x32,0x14,0x23,0x22,0x34,0x02,0x3e,0x9e,
-    0x5b,0x61,0x59,0xa9,0xfe,0x47,0x5f,0x07,0x40,0x40,
-    0x3d,0x05,0x10,0x6e,0xfd,0x59,0xfe,0x05,0x01,0xf0,
-    0x02,0xc4,0x01,0x6d,0xfe,0xef,0xfd,0xd9,0x96,0x96,
-    0x00,0x00,0x00,0x02,0x00,0x3b,0x00,0x00,0x02,0xce,
-    0x05,0x1e,0x00,0x25,0x00,0x2b,0x00,0x00,0x00,0x36,
-    0x32,0x16,0x16,0x17,0x16,0x15,0x11,0x21,0x35,0x33,
-    0x11,0x34,0x27,0x26,0x27,0x26,0x22,0x06,0x07,0x06,
-    0x07,0x07,0x03,0x23,0x13,0x36,0x35,0x34,0x27,0x27,
-    0x33,0x16,0x17,0x33,0x36,0x37,0x13,0x32,0x14,0x23,
-    0x22,0x34,0x01,0x5d,0x57,0x6c,0x54,0x33,0x0f,0x18,
-    0xfe,0xc3,0xde,0x13,0x18,0x26,0x18,0x53,0x55,0x1a,
-    0x35,0x10,0x07,0x5d,0x60,0x5d,0x02,0x2c,0x11,0x65,
-    0x1c,0x0f,0x06,0x1f,0x32,0x6a,0x40,0x40,0x3d,0x04,
-    0xfc,0x22,0x29,0x46,0x39,0x5f,0xa4,0xfc,0x8d,0x54,
-    0x03,0x1f,0xc0,0x35,0x44,0x12,0x0a,0x2d,0x21,0x44,
-    0x32,0x17,0xfc,0x13,0x03,0xed,0x17,0x1f,0x43,0x77,
-    0x2d,0x41,0x46,0x3e,0x27,0xfe,0x01,0x96,0x96,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x27,0x00,0x00,0x01,0xad,
-    0x05,0x1e,0x00,0x15,0x00,0x1b,0x00,0x00,0x13,0x32,
-    0x11,0x11,0x14,0x06,0x07,0x07,0x21,0x35,0x21,0x36,
-    0x35,0x11,0x34,0x27,0x26,0x23,0x22,0x07,0x35,0x36,
-    0x13,0x32,0x14,0x23,0x22,0x34,0xc0,0xed,0x13,0x0a,
-    0x0a,0xfe,0xa1,0x01,0x0c,0x1b,0x1a,0x1e,0x5e,0x23,
-    0x3e,0x37,0x19,0x40,0x40,0x3d,0x05,0x1e,0xfe,0xdd,
-    0xfd,0x4e,0x44,0xa4,0x31,0x30,0x54,0x7f,0x76,0x02,
-    0xb2,0x5b,0x34,0x3e,0x11,0x58,0x0f,0xfd,0xcb,0x96,
-    0x96,0x00,0x00,0x00,0x00,0x03,0x00,0x5e,0xff,0xec,
-    0x03,0x16,0x05,0x1e,0x00,0x0a,0x00,0x1a,0x00,0x20,
-    0x00,0x00,0x01,0x20,0x10,0x20,0x11,0x34,0x12,0x37,
-    0x07,0x35,0x36,0x06,0x02,0x10,0x1e,0x02,0x32,0x3e,
-    0x02,0x10,0x2e,0x02,0x23,0x07,0x13,0x32,0x14,0x23,
-    0x22,0x34,0x01,0xba,0x01,0x5c,0xfd,0x48,0x3f,0x54,
-    0x7e,0xe0,0x4f,0x43,0x26,0x48,0x54,0x6e,0x54,0x48,
-    0x26,0x26,0x48,0x54,0x37,0x5e,0x5e,0x40,0x40,0x3d,
-    0x05,0x1e,0xfa,0xce,0x02,0x99,0xcb,0x01,0x06,0x69,
-    0x07,0x58,0x0e,0xb4,0xfe,0xf1,0xfe,0x85,0xe9,0x7c,
-    0x35,0x35,0x7c,0xe9,0x01,0x4a,0xe9,0x7c,0x35,0x02,
-    0xfe,0x27,0x96,0x96,0x00,0x00,0x00,0x02,0x00,0x5e,
-    0xfe,0x14,0x03,0x04,0x05,0x1e,0x00,0x17,0x00,0x1d,
-    0x00,0x00,0x01,0x22,0x26,0x10,0x36,0x33,0x20,0x11,
-    0x11,0x23,0x11,0x10,0x23,0x22,0x06,0x07,0x06,0x15,
-    0x14,0x17,0x16,0x33,0x33,0x07,0x13,0x32,0x14,0x23,
-    0x22,0x34,0x01,0x88,0x98,0x92,0xb4,0x96,0x01,0x5c,
-    0x5f,0xfd,0x3d,0x60,0x1c,0x39,0x43,0x34,0x62,0x0e,
-    0x10,0x0a,0x40,0x40,0x3d,0x01,0xb9,0xde,0x01,0x8c,
-    0xfb,0xfd,0x67,0xfb,0x8f,0x04,0x71,0x02,0x3f,0x46,
-    0x38,0x70,0x7b,0xc5,0x52,0x40,0x4b,0x01,0xe1,0x96,
-    0x96,0x00,0x00,0x02,0x00,0x5e,0xff,0xec,0x03,0x04,
-    0x05,0x1e,0x00,0x25,0x00,0x2b,0x00,0x00,0x01,0x22,
-    0x26,0x10,0x36,0x33,0x20,0x11,0x10,0x02,0x23,0x22,
-    0x27,0x27,0x35,0x16,0x33,0x32,0x36,0x36,0x37,0x36,
-    0x11,0x10,0x27,0x26,0x26,0x22,0x06,0x07,0x06,0x15,
-    0x14,0x17,0x16,0x33,0x33,0x07,0x13,0x32,0x14,0x23,
-    0x22,0x34,0x01,0x88,0x98,0x92,0xb4,0x96,0x01,0x5c,
-    0xc0,0xad,0x69,0x57,0x1d,0x67,0x76,0x2b,0x4a,0x46,
-    0x18,0x37,0x4a,0x24,0x54,0x74,0x60,0x1c,0x39,0x43,
-    0x34,0x62,0x0e,0x10,0x24,0x40,0x40,0x3d,0x01,0xb9,
-    0xde,0x01,0x8c,0xfb,0xfd,0x67,0xfe,0xb2,0xfe,0xb5,
-    0x0f,0x05,0x59,0x13,0x1f,0x50,0x3f,0x8e,0x01,0x03,
-    0x01,0x4d,0x7f,0x3e,0x35,0x46,0x38,0x70,0x7b,0xc5,
-    0x52,0x40,0x4b,0x01,0xe1,0x96,0x96,0x00,0x00,0x02,
-    0x00,0x3b,0x00,0x00,0x02,0xa9,0x05,0x0a,0x00,0x12,
-    0x00,0x18,0x00,0x00,0x21,0x21,0x35,0x21,0x03,0x01,
-    0x33,0x01,0x17,0x36,0x36,0x37,0x13,0x33,0x03,0x06,
-    0x06,0x07,0x13,0x01,0x32,0x14,0x23,0x22,0x34,0x02,
-    0xa1,0xfd,0x9a,0x01,0xed,0xd5,0xfe,0xe8,0x65,0x01,
-    0x19,0x07,0x30,0x2c,0x0f,0x20,0x5e,0x1f,0x14,0x43,
-    0x49,0xb7,0xfe,0x20,0x40,0x40,0x3d,0x54,0x01,0xfd,
-    0x02,0xb9,0xfd,0x47,0x13,0x4d,0xc5,0x85,0x01,0x35,
-    0xfe,0xcb,0xc6,0xe3,0x50,0xfe,0x4f,0x01,0x81,0x96,
-    0x96,0x00,0x00,0x00,0x00,0x03,0x00,0x91,0xfe,0x14,
-    0x03,0x0d,0x05,0x0a,0x00,0x19,0x00,0x1d,0x00,0x23,
-    0x00,0x00,0x25,0x15,0x23,0x35,0x34,0x37,0x37,0x3e,
-    0x03,0x37,0x13,0x21,0x35,0x21,0x15,0x03,0x0e,0x05,
-    0x07,0x06,0x01,0x11,0x33,0x11,0x13,0x32,0x14,0x23,
-    0x22,0x34,0x01,0xd8,0x5d,0x09,0x0e,0x0b,0x3a,0x0b,
-    0x1d,0x03,0xac,0xfd,0xe3,0x02,0x7c,0xac,0x0c,0x21,
-    0x1a,0x0f,0x15,0x0c,0x06,0x0c,0xfe,0xba,0x5f,0x92,
-    0x40,0x40,0x3d,0x11,0x11,0x11,0x27,0x2d,0x49,0x35,
-    0xd4,0x2a,0x64,0x0c,0x02,0x65,0x54,0x54,0xfd,0x9b,
-    0x29,0x78,0x5c,0x3c,0x52,0x39,0x1f,0x3e,0xfd,0xe4,
-    0x04,0xe3,0xfb,0x1d,0x04,0xd5,0x96,0x96,0x00,0x00,
-    0x00,0x02,0x00,0x17,0x00,0x00,0x02,0x10,0x05,0x1e,
-    0x00,0x13,0x00,0x19,0x00,0x00,0x13,0x36,0x32,0x1e,
-    0x02,0x17,0x16,0x15,0x11,0x23,0x11,0x34,0x2e,0x02,
-    0x23,0x22,0x07,0x07,0x13,0x32,0x14,0x23,0x22,0x34,
-    0x17,0x4d,0x9c,0x5c,0x4f,0x32,0x12,0x21,0x5f,0x14,
-    0x3b,0x55,0x39,0x56,0x50,0x17,0xc5,0x40,0x40,0x3d,
-    0x05,0x14,0x0a,0x0b,0x1f,0x33,0x28,0x49,0x9a,0xfc,
-    0x4a,0x03,0xb6,0x5c,0x69,0x3c,0x11,0x08,0x03,0xfe,
-    0x2c,0x96,0x96,0x00,0x00,0x02,0x00,0x4a,0x00,0x00,
-    0x03,0xce,0x05,0x0a,0x00,0x1e,0x00,0x24,0x00,0x00,
-    0x21,0x23,0x03,0x33,0x13,0x36,0x36,0x37,0x37,0x33,
-    0x07,0x0e,0x03,0x07,0x13,0x33,0x32,0x36,0x37,0x36,
-    0x13,0x13,0x33,0x03,0x06,0x07,0x0e,0x02,0x13,0x32,
-    0x14,0x23,0x22,0x34,0x01,0x20,0x69,0x6d,0x58,0x3d,
-    0x75,0x70,0x16,0x19,0x54,0x19,0x0d,0x27,0x49,0x74,
-    0x56,0x20,0x19,0x73,0xc3,0x44,0x8c,0x1d,0x36,0x55,
-    0x37,0x17,0x5a,0x33,0x89,0xcd,0x6f,0x40,0x40,0x3d,
-    0x05,0x0a,0xfd,0x23,0x35,0xd4,0xd6,0xfe,0xfe,0x7e,
-    0xac,0x92,0x60,0x20,0xfe,0x87,0x62,0x57,0xb3,0x01,
-    0x1c,0x02,0x2b,0xfd,0xd5,0xec,0xaf,0x61,0x8d,0x56,
-    0x02,0x03,0x96,0x96,0x00,0x02,0x00,0x10,0x00,0x00,
-    0x02,0xe9,0x05,0x1e,0x00,0x1e,0x00,0x24,0x00,0x00,
-    0x13,0x36,0x32,0x16,0x16,0x17,0x16,0x15,0x11,0x23,
-    0x11,0x34,0x27,0x26,0x27,0x26,0x22,0x07,0x11,0x14,
-    0x06,0x23,0x22,0x27,0x35,0x16,0x33,0x32,0x35,0x11,
-    0x07,0x01,0x32,0x14,0x23,0x22,0x34,0x40,0xc2,0xd2,
-    0x64,0x59,0x1c,0x3c,0x5f,0x28,0x22,0x56,0x24,0x51,
-    0x85,0x49,0x49,0x26,0x28,0x2c,0x11,0x44,0x51,0x01,
-    0x7d,0x40,0x40,0x3d,0x05,0x08,0x16,0x11,0x2e,0x28,
-    0x56,0xab,0xfc,0x4a,0x03,0xb6,0x88,0x40,0x37,0x0d,
-    0x06,0x07,0xfc,0x0b,0x6f,0x5d,0x08,0x5b,0x08,0x71,
-    0x03,0xec,0x07,0xfe,0x38,0x96,0x96,0x00,0x00,0x00,
-    0x00,0x02,0x00,0x67,0x00,0x00,0x00,0xf0,0x06,0x18,
-    0x00,0x05,0x00,0x09,0x00,0x00,0x13,0x32,0x14,0x23,
-    0x22,0x34,0x13,0x11,0x33,0x11,0xa4,0x40,0x40,0x3d,
-    0x2a,0x5f,0x06,0x18,0x96,0x96,0xf9,0xe8,0x05,0x0a,
-    0xfa,0xf6,0x00,0x00,0x00,0x01,0xff,0x15,0x05,0xa9,
-    0x00,0xeb,0x05,0xfc,0x00,0x03,0x00,0x00,0x13,0x21,
-    0x35,0x21,0xeb,0xfe,0x2a,0x01,0xd6,0x05,0xa9,0x53,
-    0x00,0x00,0x00,0x00,0x00,0x20,0x01,0x86,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0x00,0x00,
-    0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x20,
-    0x00,0x75,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x07,0x00,0x95,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x03,0x00,0x28,0x00,0x9c,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x04,0x00,0x20,0x00,0x75,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x3c,0x00,0xc4,
-    0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x1d,
-    0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x07,
-    0x00,0x52,0x01,0x1d,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x08,0x00,0x22,0x01,0x6f,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x0b,0x00,0x32,0x01,0x91,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x3c,0x01,0xc3,
-    0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0d,0x00,0x2e,
-    0x01,0xff,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x0e,
-    0x00,0x2a,0x02,0x2d,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x10,0x00,0x1a,0x02,0x57,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x00,0x05,0x02,0x71,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x20,0x00,0x75,
-    0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x00,0x00,0xea,
-    0x02,0x76,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x01,
-    0x00,0x40,0x03,0x60,0x00,0x03,0x00,0x01,0x04,0x09,
-    0x00,0x02,0x00,0x0e,0x03,0xa0,0x00,0x03,0x00,0x01,
-    0x04,0x09,0x00,0x03,0x00,0x50,0x03,0xae,0x00,0x03,
-    0x00,0x01,0x04,0x09,0x00,0x04,0x00,0x40,0x03,0x60,
-    0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x05,0x00,0x78,
-    0x03,0xfe,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x06,
-    0x00,0x3a,0x04,0x76,0x00,0x03,0x00,0x01,0x04,0x09,
-    0x00,0x07,0x00,0xa4,0x04,0xb0,0x00,0x03,0x00,0x01,
-    0x04,0x09,0x00,0x08,0x00,0x44,0x05,0x54,0x00,0x03,
-    0x00,0x01,0x04,0x09,0x00,0x0b,0x00,0x64,0x05,0x98,
-    0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x0c,0x00,0x78,
-    0x05,0xfc,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x0d,
-    0x00,0x5c,0x06,0x74,0x00,0x03,0x00,0x01,0x04,0x09,
-    0x00,0x0e,0x00,0x54,0x06,0xd0,0x00,0x03,0x00,0x01,
-    0x04,0x09,0x00,0x10,0x00,0x34,0x07,0x24,0x00,0x03,
-    0x00,0x01,0x04,0x09,0x00,0x11,0x00,0x0a,0x07,0x58,
-    0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x12,0x00,0x40,
-    0x03,0x60,0x44,0x69,0x67,0x69,0x74,0x69,0x7a,0x65,
-    0x64,0x20,0x64,0x61,0x74,0x61,0x20,0x63,0x6f,0x70,
-    0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,
-    0x20,0x32,0x30,0x31,0x31,0x2c,0x20,0x47,0x6f,0x6f,
-    0x67,0x6c,0x65,0x20,0x43,0x6f,0x72,0x70,0x6f,0x72,
-    0x61,0x74,0x69,0x6f,0x6e,0x2e,0x20,0x43,0x6f,0x70,
-    0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x28,0x63,0x29,
-    0x20,0x32,0x30,0x31,0x32,0x2c,0x20,0x32,0x30,0x31,
-    0x33,0x20,0x59,0x61,0x6e,0x65,0x6b,0x20,0x49,0x6f,
-    0x6e,0x74,0x65,0x66,0x20,0x28,0x79,0x61,0x6e,0x65,
-    0x6b,0x40,0x6e,0x65,0x74,0x76,0x69,0x73,0x69,0x6f,
-    0x6e,0x2e,0x6e,0x65,0x74,0x2e,0x69,0x6c,0x29,0x4f,
-    0x70,0x65,0x6e,0x20,0x53,0x61,0x6e,0x73,0x20,0x48,
-    0x65,0x62,0x72,0x65,0x77,0x20,0x43,0x6f,0x6e,0x64,
-    0x65,0x6e,0x73,0x65,0x64,0x20,0x4c,0x69,0x67,0x68,
-    0x74,0x52,0x65,0x67,0x75,0x6c,0x61,0x72,0x32,0x2e,
-    0x30,0x30,0x31,0x3b,0x55,0x4b,0x57,0x4e,0x3b,0x4f,
-    0x70,0x65,0x6e,0x53,0x61,0x6e,0x73,0x48,0x65,0x62,
-    0x72,0x65,0x77,0x43,0x6f,0x6e,0x64,0x65,0x6e,0x73,
-    0x65,0x64,0x2d,0x4c,0x69,0x67,0x68,0x74,0x56,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x20,0x32,0x2e,0x30,0x30,
-    0x31,0x3b,0x50,0x53,0x20,0x30,0x30,0x32,0x2e,0x30,
-    0x30,0x31,0x3b,0x68,0x6f,0x74,0x63,0x6f,0x6e,0x76,
-    0x20,0x31,0x2e,0x30,0x2e,0x37,0x30,0x3b,0x6d,0x61,
-    0x6b,0x65,0x6f,0x74,0x66,0x2e,0x6c,0x69,0x62,0x32,
-    0x2e,0x35,0x2e,0x35,0x38,0x33,0x32,0x39,0x4f,0x70,
-    0x65,0x6e,0x53,0x61,0x6e,0x73,0x48,0x65,0x62,0x72,
-    0x65,0x77,0x43,0x6f,0x6e,0x64,0x65,0x6e,0x73,0x65,
-    0x64,0x2d,0x4c,0x69,0x67,0x68,0x74,0x4f,0x70,0x65,
-    0x6e,0x20,0x53,0x61,0x6e,0x73,0x20,0x69,0x73,0x20,
-    0x61,0x20,0x74,0x72,0x61,0x64,0x65,0x6d,0x61,0x72,
-    0x6b,0x20,0x6f,0x66,0x20,0x47,0x6f,0x6f,0x67,0x6c,
-    0x65,0x20,0x61,0x6e,0x64,0x20,0x6d,0x61,0x79,0x20,
-    0x62,0x65,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,
-    0x72,0x65,0x64,0x20,0x69,0x6e,0x20,0x63,0x65,0x72,
-    0x74,0x61,0x69,0x6e,0x20,0x6a,0x75,0x72,0x69,0x73,
-    0x64,0x69,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x41,
-    0x73,0x63,0x65,0x6e,0x64,0x65,0x72,0x20,0x43,0x6f,
-    0x72,0x70,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x2c,
-    0x20,0x59,0x61,0x6e,0x65,0x6b,0x20,0x49,0x6f,0x6e,
-    0x74,0x65,0x66,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x61,0x73,0x63,0x65,0x6e,0x64,
-    0x65,0x72,0x63,0x6f,0x72,0x70,0x2e,0x63,0x6f,0x6d,
-    0x2f,0x20,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x66,0x6f,0x6e,0x74,0x65,0x66,0x2e,
-    0x63,0x6f,0x6d,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x61,0x73,0x63,0x65,0x6e,0x64,
-    0x65,0x72,0x63,0x6f,0x72,0x70,0x2e,0x63,0x6f,0x6d,
-    0x2f,0x74,0x79,0x70,0x65,0x64,0x65,0x73,0x69,0x67,
-    0x6e,0x65,0x72,0x73,0x2e,0x68,0x74,0x6d,0x6c,0x2c,
-    0x20,0x59,0x61,0x6e,0x65,0x6b,0x20,0x49,0x6f,0x6e,
-    0x74,0x65,0x66,0x4c,0x69,0x63,0x65,0x6e,0x73,0x65,
-    0x64,0x20,0x75,0x6e,0x64,0x65,0x72,0x20,0x74,0x68,
-    0x65,0x20,0x41,0x70,0x61,0x63,0x68,0x65,0x20,0x4c,
-    0x69,0x63,0x65,0x6e,0x73,0x65,0x2c,0x20,0x56,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x20,0x32,0x2e,0x30,0x68,
-    0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,0x77,0x77,0x2e,
-    0x61,0x70,0x61,0x63,0x68,0x65,0x2e,0x6f,0x72,0x67,
-    0x2f,0x6c,0x69,0x63,0x65,0x6e,0x73,0x65,0x73,0x2f,
-    0x4c,0x49,0x43,0x45,0x4e,0x53,0x45,0x2d,0x32,0x2e,
-    0x30,0x4f,0x70,0x65,0x6e,0x20,0x53,0x61,0x6e,0x73,
-    0x20,0x48,0x65,0x62,0x72,0x65,0x77,0x20,0x43,0x6f,
-    0x6e,0x64,0x65,0x6e,0x73,0x65,0x64,0x4c,0x69,0x67,
-    0x68,0x74,0x00,0x44,0x00,0x69,0x00,0x67,0x00,0x69,
-    0x00,0x74,0x00,0x69,0x00,0x7a,0x00,0x65,0x00,0x64,
-    0x00,0x20,0x00,0x64,0x00,0x61,0x00,0x74,0x00,0x61,
-    0x00,0x20,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x79,
-    0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,
-    0x00,0x20,0x00,0x28,0x00,0x63,0x00,0x29,0x00,0x20,
-    0x00,0x32,0x00,0x30,0x00,0x31,0x00,0x31,0x00,0x2c,
-    0x00,0x20,0x00,0x47,0x00,0x6f,0x00,0x6f,0x00,0x67,
-    0x00,0x6c,0x00,0x65,0x00,0x20,0x00,0x43,0x00,0x6f,
-    0x00,0x72,0x00,0x70,0x00,0x6f,0x00,0x72,0x00,0x61,
-    0x00,0x74,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x2e,
-    0x00,0x20,0x00,0x43,0x00,0x6f,0x00,0x70,0x00,0x79,
-    0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,
-    0x00,0x20,0x00,0x28,0x00,0x63,0x00,0x29,0x00,0x20,
-    0x00,0x32,0x00,0x30,0x00,0x31,0x00,0x32,0x00,0x2c,
-    0x00,0x20,0x00,0x32,0x00,0x30,0x00,0x31,0x00,0x33,
-    0x00,0x20,0x00,0x59,0x00,0x61,0x00,0x6e,0x00,0x65,
-    0x00,0x6b,0x00,0x20,0x00,0x49,0x00,0x6f,0x00,0x6e,
-    0x00,0x74,0x00,0x65,0x00,0x66,0x00,0x20,0x00,0x28,
-    0x00,0x79,0x00,0x61,0x00,0x6e,0x00,0x65,0x00,0x6b,
-    0x00,0x40,0x00,0x6e,0x00,0x65,0x00,0x74,0x00,0x76,
-    0x00,0x69,0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,
-    0x00,0x2e,0x00,0x6e,0x00,0x65,0x00,0x74,0x00,0x2e,
-    0x00,0x69,0x00,0x6c,0x00,0x29,0x00,0x4f,0x00,0x70,
-    0x00,0x65,0x00,0x6e,0x00,0x20,0x00,0x53,0x00,0x61,
-    0x00,0x6e,0x00,0x73,0x00,0x20,0x00,0x48,0x00,0x65,
-    0x00,0x62,0x00,0x72,0x00,0x65,0x00,0x77,0x00,0x20,
-    0x00,0x43,0x00,0x6f,0x00,0x6e,0x00,0x64,0x00,0x65,
-    0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x20,
-    0x00,0x4c,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,
-    0x00,0x52,0x00,0x65,0x00,0x67,0x00,0x75,0x00,0x6c,
-    0x00,0x61,0x00,0x72,0x00,0x32,0x00,0x2e,0x00,0x30,
-    0x00,0x30,0x00,0x31,0x00,0x3b,0x00,0x55,0x00,0x4b,
-    0x00,0x57,0x00,0x4e,0x00,0x3b,0x00,0x4f,0x00,0x70,
-    0x00,0x65,0x00,0x6e,0x00,0x53,0x00,0x61,0x00,0x6e,
-    0x00,0x73,0x00,0x48,0x00,0x65,0x00,0x62,0x00,0x72,
-    0x00,0x65,0x00,0x77,0x00,0x43,0x00,0x6f,0x00,0x6e,
-    0x00,0x64,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,
-    0x00,0x64,0x00,0x2d,0x00,0x4c,0x00,0x69,0x00,0x67,
-    0x00,0x68,0x00,0x74,0x00,0x56,0x00,0x65,0x00,0x72,
-    0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,
-    0x00,0x32,0x00,0x2e,0x00,0x30,0x00,0x30,0x00,0x31,
-    0x00,0x3b,0x00,0x50,0x00,0x53,0x00,0x20,0x00,0x30,
-    0x00,0x30,0x00,0x32,0x00,0x2e,0x00,0x30,0x00,0x30,
-    0x00,0x31,0x00,0x3b,0x00,0x68,0x00,0x6f,0x00,0x74,
-    0x00,0x63,0x00,0x6f,0x00,0x6e,0x00,0x76,0x00,0x20,
-    0x00,0x31,0x00,0x2e,0x00,0x30,0x00,0x2e,0x00,0x37,
-    0x00,0x30,0x00,0x3b,0x00,0x6d,0x00,0x61,0x00,0x6b,
-    0x00,0x65,0x00,0x6f,0x00,0x74,0x00,0x66,0x00,0x2e,
-    0x00,0x6c,0x00,0x69,0x00,0x62,0x00,0x32,0x00,0x2e,
-    0x00,0x35,0x00,0x2e,0x00,0x35,0x00,0x38,0x00,0x33,
-    0x00,0x32,0x00,0x39,0x00,0x4f,0x00,0x70,0x00,0x65,
-    0x00,0x6e,0x00,0x53,0x00,0x61,0x00,0x6e,0x00,0x73,
-    0x00,0x48,0x00,0x65,0x00,0x62,0x00,0x72,0x00,0x65,
-    0x00,0x77,0x00,0x43,0x00,0x6f,0x00,0x6e,0x00,0x64,
-    0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x64,
-    0x00,0x2d,0x00,0x4c,0x00,0x69,0x00,0x67,0x00,0x68,
-    0x00,0x74,0x00,0x4f,0x00,0x70,0x00,0x65,0x00,0x6e,
-    0x00,0x20,0x00,0x53,0x00,0x61,0x00,0x6e,0x00,0x73,
-    0x00,0x20,0x00,0x69,0x00,0x73,0x00,0x20,0x00,0x61,
-    0x00,0x20,0x00,0x74,0x00,0x72,0x00,0x61,0x00,0x64,
-    0x00,0x65,0x00,0x6d,0x00,0x61,0x00,0x72,0x00,0x6b,
-    0x00,0x20,0x00,0x6f,0x00,0x66,0x00,0x20,0x00,0x47,
-    0x00,0x6f,0x00,0x6f,0x00,0x67,0x00,0x6c,0x00,0x65,
-    0x00,0x20,0x00,0x61,0x00,0x6e,0x00,0x64,0x00,0x20,
-    0x00,0x6d,0x00,0x61,0x00,0x79,0x00,0x20,0x00,0x62,
-    0x00,0x65,0x00,0x20,0x00,0x72,0x00,0x65,0x00,0x67,
-    0x00,0x69,0x00,0x73,0x00,0x74,0x00,0x65,0x00,0x72,
-    0x00,0x65,0x00,0x64,0x00,0x20,0x00,0x69,0x00,0x6e,
-    0x00,0x20,0x00,0x63,0x00,0x65,0x00,0x72,0x00,0x74,
-    0x00,0x61,0x00,0x69,0x00,0x6e,0x00,0x20,0x00,0x6a,
-    0x00,0x75,0x00,0x72,0x00,0x69,0x00,0x73,0x00,0x64,
-    0x00,0x69,0x00,0x63,0x00,0x74,0x00,0x69,0x00,0x6f,
-    0x00,0x6e,0x00,0x73,0x00,0x2e,0x00,0x41,0x00,0x73,
-    0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x64,0x00,0x65,
-    0x00,0x72,0x00,0x20,0x00,0x43,0x00,0x6f,0x00,0x72,
-    0x00,0x70,0x00,0x6f,0x00,0x72,0x00,0x61,0x00,0x74,
-    0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x2c,0x00,0x20,
-    0x00,0x59,0x00,0x61,0x00,0x6e,0x00,0x65,0x00,0x6b,
-    0x00,0x20,0x00,0x49,0x00,0x6f,0x00,0x6e,0x00,0x74,
-    0x00,0x65,0x00,0x66,0x00,0x68,0x00,0x74,0x00,0x74,
-    0x00,0x70,0x00,0x3a,0x00,0x2f,0x00,0x2f,0x00,0x77,
-    0x00,0x77,0x00,0x77,0x00,0x2e,0x00,0x61,0x00,0x73,
-    0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x64,0x00,0x65,
-    0x00,0x72,0x00,0x63,0x00,0x6f,0x00,0x72,0x00,0x70,
-    0x00,0x2e,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x2f,
-    0x00,0x20,0x00,0x68,0x00,0x74,0x00,0x74,0x00,0x70,
-    0x00,0x3a,0x00,0x2f,0x00,0x2f,0x00,0x77,0x00,0x77,
-    0x00,0x77,0x00,0x2e,0x00,0x66,0x00,0x6f,0x00,0x6e,
-    0x00,0x74,0x00,0x65,0x00,0x66,0x00,0x2e,0x00,0x63,
-    0x00,0x6f,0x00,0x6d,0x00,0x68,0x00,0x74,0x00,0x74,
-    0x00,0x70,0x00,0x3a,0x00,0x2f,0x00,0x2f,0x00,0x77,
-    0x00,0x77,0x00,0x77,0x00,0x2e,0x00,0x61,0x00,0x73,
-    0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x64,0x00,0x65,
-    0x00,0x72,0x00,0x63,0x00,0x6f,0x00,0x72,0x00,0x70,
-    0x00,0x2e,0x00,0x63,0x00,0x6f,0x00,0x6d,0x00,0x2f,
-    0x00,0x74,0x00,0x79,0x00,0x70,0x00,0x65,0x00,0x64,
-    0x00,0x65,0x00,0x73,0x00,0x69,0x00,0x67,0x00,0x6e,
-    0x00,0x65,0x00,0x72,0x00,0x73,0x00,0x2e,0x00,0x68,
-    0x00,0x74,0x00,0x6d,0x00,0x6c,0x00,0x2c,0x00,0x20,
-    0x00,0x59,0x00,0x61,0x00,0x6e,0x00,0x65,0x00,0x6b,
-    0x00,0x20,0x00,0x49,0x00,0x6f,0x00,0x6e,0x00,0x74,
-    0x00,0x65,0x00,0x66,0x00,0x4c,0x00,0x69,0x00,0x63,
-    0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x64,
-    0x00,0x20,0x00,0x75,0x00,0x6e,0x00,0x64,0x00,0x65,
-    0x00,0x72,0x00,0x20,0x00,0x74,0x00,0x68,0x00,0x65,
-    0x00,0x20,0x00,0x41,0x00,0x70,0x00,0x61,0x00,0x63,
-    0x00,0x68,0x00,0x65,0x00,0x20,0x00,0x4c,0x00,0x69,
-    0x00,0x63,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,
-    0x00,0x2c,0x00,0x20,0x00,0x56,0x00,0x65,0x00,0x72,
-    0x00,0x73,0x00,0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,
-    0x00,0x32,0x00,0x2e,0x00,0x30,0x00,0x68,0x00,0x74,
-    0x00,0x74,0x00,0x70,0x00,0x3a,0x00,0x2f,0x00,0x2f,
-    0x00,0x77,0x00,0x77,0x00,0x77,0x00,0x2e,0x00,0x61,
-    0x00,0x70,0x00,0x61,0x00,0x63,0x00,0x68,0x00,0x65,
-    0x00,0x2e,0x00,0x6f,0x00,0x72,0x00,0x67,0x00,0x2f,
-    0x00,0x6c,0x00,0x69,0x00,0x63,0x00,0x65,0x00,0x6e,
-    0x00,0x73,0x00,0x65,0x00,0x73,0x00,0x2f,0x00,0x4c,
-    0x00,0x49,0x00,0x43,0x00,0x45,0x00,0x4e,0x00,0x53,
-    0x00,0x45,0x00,0x2d,0x00,0x32,0x00,0x2e,0x00,0x30,
-    0x00,0x4f,0x00,0x70,0x00,0x65,0x00,0x6e,0x00,0x20,
-    0x00,0x53,0x00,0x61,0x00,0x6e,0x00,0x73,0x00,0x20,
-    0x00,0x48,0x00,0x65,0x00,0x62,0x00,0x72,0x00,0x65,
-    0x00,0x77,0x00,0x20,0x00,0x43,0x00,0x6f,0x00,0x6e,
-    0x00,0x64,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,
-    0x00,0x64,0x00,0x4c,0x00,0x69,0x00,0x67,0x00,0x68,
-    0x00,0x74,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xff,0xb5,0x00,0x32,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x37,0x00,0x00,0x00,0x01,
-    0x00,0x02,0x01,0x02,0x00,0x03,0x00,0x04,0x00,0x05,
-    0x00,0x06,0x00,0x07,0x00,0x08,0x00,0x09,0x00,0x0a,
-    0x00,0x0b,0x00,0x0c,0x00,0x0d,0x00,0x0e,0x00,0x0f,
-    0x00,0x10,0x00,0x11,0x00,0x12,0x00,0x13,0x00,0x14,
-    0x00,0x15,0x00,0x16,0x00,0x17,0x00,0x18,0x00,0x19,
-    0x00,0x1a,0x00,0x1b,0x00,0x1c,0x00,0x1d,0x00,0x1e,
-    0x00,0x1f,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x23,
-    0x00,0x24,0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,
-    0x00,0x29,0x00,0x2a,0x00,0x2b,0x00,0x2c,0x00,0x2d,
-    0x00,0x2e,0x00,0x2f,0x00,0x30,0x00,0x31,0x00,0x32,
-    0x00,0x33,0x00,0x34,0x00,0x35,0x00,0x36,0x00,0x37,
-    0x00,0x38,0x00,0x39,0x00,0x3a,0x00,0x3b,0x00,0x3c,
-    0x00,0x3d,0x00,0x3e,0x00,0x3f,0x00,0x40,0x00,0x41,
-    0x00,0x42,0x00,0x43,0x00,0x44,0x00,0x45,0x00,0x46,
-    0x00,0x47,0x00,0x48,0x00,0x49,0x00,0x4a,0x00,0x4b,
-    0x00,0x4c,0x00,0x4d,0x00,0x4e,0x00,0x4f,0x00,0x50,
-    0x00,0x51,0x00,0x52,0x00,0x53,0x00,0x54,0x00,0x55,
-    0x00,0x56,0x00,0x57,0x00,0x58,0x00,0x59,0x00,0x5a,
-    0x00,0x5b,0x00,0x5c,0x00,0x5d,0x00,0x5e,0x00,0x5f,
-    0x00,0x60,0x00,0x61,0x01,0x03,0x00,0xa3,0x00,0x84,
-    0x00,0x85,0x00,0xbd,0x00,0x96,0x00,0xe8,0x00,0x86,
-    0x00,0x8e,0x00,0x8b,0x00,0x9d,0x00,0xa9,0x00,0xa4,
-    0x01,0x04,0x00,0x8a,0x01,0x05,0x00,0x83,0x00,0x93,
-    0x00,0xf2,0x00,0xf3,0x00,0x8d,0x01,0x06,0x00,0x88,
-    0x00,0xc3,0x00,0xde,0x00,0xf1,0x00,0x9e,0x00,0xaa,
-    0x00,0xf5,0x00,0xf4,0x00,0xf6,0x00,0xa2,0x00,0xad,
-    0x00,0xc9,0x00,0xc7,0x00,0xae,0x00,0x62,0x00,0x63,
-    0x00,0x90,0x00,0x64,0x00,0xcb,0x00,0x65,0x00,0xc8,
-    0x00,0xca,0x00,0xcf,0x00,0xcc,0x00,0xcd,0x00,0xce,
-    0x00,0xe9,0x00,0x66,0x00,0xd3,0x00,0xd0,0x00,0xd1,
-    0x00,0xaf,0x00,0x67,0x00,0xf0,0x00,0x91,0x00,0xd6,
-    0x00,0xd4,0x00,0xd5,0x00,0x68,0x00,0xeb,0x00,0xed,
-    0x00,0x89,0x00,0x6a,0x00,0x69,0x00,0x6b,0x00,0x6d,
-    0x00,0x6c,0x00,0x6e,0x00,0xa0,0x00,0x6f,0x00,0x71,
-    0x00,0x70,0x00,0x72,0x00,0x73,0x00,0x75,0x00,0x74,
-    0x00,0x76,0x00,0x77,0x00,0xea,0x00,0x78,0x00,0x7a,
-    0x00,0x79,0x00,0x7b,0x00,0x7d,0x00,0x7c,0x00,0xb8,
-    0x00,0xa1,0x00,0x7f,0x00,0x7e,0x00,0x80,0x00,0x81,
-    0x00,0xec,0x00,0xee,0x00,0xba,0x00,0xd7,0x00,0xb0,
-    0x00,0xb1,0x00,0xe4,0x00,0xe5,0x00,0xbb,0x00,0xe6,
-    0x00,0xe7,0x00,0xa6,0x00,0xd8,0x00,0xe1,0x00,0xdb,
-    0x00,0xdc,0x00,0xdd,0x00,0xe0,0x00,0xd9,0x00,0xdf,
-    0x01,0x07,0x01,0x08,0x01,0x09,0x01,0x0a,0x01,0x0b,
-    0x01,0x0c,0x01,0x0d,0x01,0x0e,0x01,0x0f,0x01,0x10,
-    0x01,0x11,0x01,0x12,0x01,0x13,0x01,0x14,0x01,0x15,
-    0x01,0x16,0x01,0x17,0x01,0x18,0x01,0x19,0x01,0x1a,
-    0x01,0x1b,0x01,0x1c,0x01,0x1d,0x01,0x1e,0x01,0x1f,
-    0x01,0x20,0x01,0x21,0x01,0x22,0x01,0x23,0x01,0x24,
-    0x01,0x25,0x01,0x26,0x01,0x27,0x01,0x28,0x01,0x29,
-    0x01,0x2a,0x01,0x2b,0x01,0x2c,0x01,0x2d,0x01,0x2e,
-    0x01,0x2f,0x01,0x30,0x01,0x31,0x01,0x32,0x01,0x33,
-    0x01,0x34,0x01,0x35,0x00,0xb2,0x00,0xb3,0x00,0xb6,
-    0x00,0xb7,0x00,0xc4,0x00,0xb4,0x00,0xb5,0x00,0xc5,
-    0x00,0x82,0x00,0xc2,0x00,0x87,0x00,0xab,0x00,0xc6,
-    0x00,0xbe,0x00,0xbf,0x00,0xbc,0x01,0x36,0x01,0x37,
-    0x00,0x8c,0x01,0x38,0x01,0x39,0x01,0x3a,0x01,0x3b,
-    0x01,0x3c,0x01,0x3d,0x01,0x3e,0x01,0x3f,0x01,0x40,
-    0x01,0x41,0x01,0x42,0x01,0x43,0x01,0x44,0x01,0x45,
-    0x01,0x46,0x01,0x47,0x01,0x48,0x01,0x49,0x01,0x4a,
-    0x01,0x4b,0x01,0x4c,0x01,0x4d,0x01,0x4e,0x01,0x4f,
-    0x01,0x50,0x01,0x51,0x01,0x52,0x01,0x53,0x01,0x54,
-    0x01,0x55,0x01,0x56,0x01,0x57,0x00,0xac,0x02,0x43,
-    0x52,0x07,0x75,0x6e,0x69,0x30,0x30,0x41,0x30,0x07,
-    0x75,0x6e,0x69,0x30,0x30,0x41,0x44,0x09,0x6f,0x76,
-    0x65,0x72,0x73,0x63,0x6f,0x72,0x65,0x07,0x75,0x6e,
-    0x69,0x30,0x30,0x42,0x35,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x42,0x30,0x07,0x75,0x6e,0x69,0x30,0x35,0x42,
-    0x31,0x07,0x75,0x6e,0x69,0x30,0x35,0x42,0x32,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x42,0x33,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x42,0x34,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x42,0x35,0x07,0x75,0x6e,0x69,0x30,0x35,0x42,
-    0x36,0x07,0x75,0x6e,0x69,0x30,0x35,0x42,0x37,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x42,0x38,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x42,0x39,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x42,0x41,0x07,0x75,0x6e,0x69,0x30,0x35,0x42,
-    0x42,0x07,0x75,0x6e,0x69,0x30,0x35,0x42,0x43,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x42,0x44,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x42,0x45,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x43,0x31,0x07,0x75,0x6e,0x69,0x30,0x35,0x43,
-    0x32,0x07,0x75,0x6e,0x69,0x30,0x35,0x43,0x37,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x44,0x30,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x44,0x31,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x44,0x32,0x07,0x75,0x6e,0x69,0x30,0x35,0x44,
-    0x33,0x07,0x75,0x6e,0x69,0x30,0x35,0x44,0x34,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x44,0x35,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x44,0x36,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x44,0x37,0x07,0x75,0x6e,0x69,0x30,0x35,0x44,
-    0x38,0x07,0x75,0x6e,0x69,0x30,0x35,0x44,0x39,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x44,0x41,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x44,0x42,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x44,0x43,0x07,0x75,0x6e,0x69,0x30,0x35,0x44,
-    0x44,0x07,0x75,0x6e,0x69,0x30,0x35,0x44,0x45,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x44,0x46,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x45,0x30,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x45,0x31,0x07,0x75,0x6e,0x69,0x30,0x35,0x45,
-    0x32,0x07,0x75,0x6e,0x69,0x30,0x35,0x45,0x33,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x45,0x34,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x45,0x35,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x45,0x36,0x07,0x75,0x6e,0x69,0x30,0x35,0x45,
-    0x37,0x07,0x75,0x6e,0x69,0x30,0x35,0x45,0x38,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x45,0x39,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x45,0x41,0x08,0x67,0x65,0x72,0x65,
-    0x73,0x68,0x68,0x62,0x0b,0x67,0x65,0x72,0x73,0x68,
-    0x61,0x79,0x69,0x6d,0x68,0x62,0x07,0x75,0x6e,0x69,
-    0x32,0x30,0x41,0x41,0x04,0x45,0x75,0x72,0x6f,0x07,
-    0x75,0x6e,0x69,0x46,0x42,0x30,0x31,0x07,0x75,0x6e,
-    0x69,0x46,0x42,0x30,0x32,0x07,0x75,0x6e,0x69,0x46,
-    0x42,0x32,0x41,0x07,0x75,0x6e,0x69,0x46,0x42,0x32,
-    0x42,0x13,0x73,0x68,0x69,0x6e,0x64,0x61,0x67,0x65,
-    0x73,0x68,0x73,0x68,0x69,0x6e,0x64,0x6f,0x74,0x68,
-    0x62,0x12,0x73,0x68,0x69,0x6e,0x64,0x61,0x67,0x65,
-    0x73,0x68,0x73,0x69,0x6e,0x64,0x6f,0x74,0x68,0x62,
-    0x0b,0x61,0x6c,0x65,0x66,0x70,0x61,0x74,0x61,0x68,
-    0x68,0x62,0x0c,0x61,0x6c,0x65,0x66,0x71,0x61,0x6d,
-    0x61,0x74,0x73,0x68,0x62,0x0c,0x61,0x6c,0x65,0x66,
-    0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,0x0b,0x62,
-    0x65,0x74,0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,
-    0x0d,0x67,0x69,0x6d,0x65,0x6c,0x64,0x61,0x67,0x65,
-    0x73,0x68,0x68,0x62,0x0d,0x64,0x61,0x6c,0x65,0x74,
-    0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,0x0a,0x68,
-    0x65,0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,0x07,
-    0x75,0x6e,0x69,0x46,0x42,0x33,0x35,0x0d,0x7a,0x61,
-    0x79,0x69,0x6e,0x64,0x61,0x67,0x65,0x73,0x68,0x68,
-    0x62,0x0b,0x74,0x65,0x74,0x64,0x61,0x67,0x65,0x73,
-    0x68,0x68,0x62,0x0b,0x79,0x6f,0x64,0x64,0x61,0x67,
-    0x65,0x73,0x68,0x68,0x62,0x10,0x66,0x69,0x6e,0x61,
-    0x6c,0x6b,0x61,0x66,0x64,0x61,0x67,0x65,0x73,0x68,
-    0x68,0x62,0x0b,0x6b,0x61,0x66,0x64,0x61,0x67,0x65,
-    0x73,0x68,0x68,0x62,0x0d,0x6c,0x61,0x6d,0x65,0x64,
-    0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,0x0b,0x6d,
-    0x65,0x6d,0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,
-    0x0b,0x6e,0x75,0x6e,0x64,0x61,0x67,0x65,0x73,0x68,
-    0x68,0x62,0x0e,0x73,0x61,0x6d,0x65,0x6b,0x68,0x64,
-    0x61,0x67,0x65,0x73,0x68,0x68,0x62,0x0f,0x66,0x69,
-    0x6e,0x61,0x6c,0x70,0x65,0x64,0x61,0x67,0x65,0x73,
-    0x68,0x68,0x62,0x0a,0x70,0x65,0x64,0x61,0x67,0x65,
-    0x73,0x68,0x68,0x62,0x0d,0x74,0x73,0x61,0x64,0x69,
-    0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,0x0b,0x71,
-    0x6f,0x66,0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,
-    0x0c,0x72,0x65,0x73,0x68,0x64,0x61,0x67,0x65,0x73,
-    0x68,0x68,0x62,0x0c,0x73,0x68,0x69,0x6e,0x64,0x61,
-    0x67,0x65,0x73,0x68,0x68,0x62,0x0b,0x74,0x61,0x76,
-    0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,0x07,0x75,
-    0x6e,0x69,0x46,0x42,0x34,0x42,0x07,0x72,0x61,0x66,
-    0x65,0x68,0x68,0x62,0x00,0x00,0x00,0x01,0x00,0x01,
-    0xff,0xff,0x00,0x0f,0x00,0x00,0x00,0x01,0x00,0x00,
-    0x00,0x00,0xcc,0x6d,0xb1,0x55,0x00,0x00,0x00,0x00,
-    0xcd,0x64,0xfe,0x51,0x00,0x00,0x00,0x00,0xcd,0xac,
-    0x5d,0x6c,0x00,0x01,0x00,0x00,0x00,0x0c,0x00,0x00,
-    0x00,0x2e,0x00,0x00,0x00,0x02,0x00,0x05,0x00,0x03,
-    0x00,0xd3,0x00,0x01,0x00,0xd4,0x00,0xe1,0x00,0x03,
-    0x00,0xe2,0x00,0xe2,0x00,0x01,0x00,0xe3,0x00,0xe5,
-    0x00,0x03,0x00,0xe6,0x01,0x35,0x00,0x01,0x00,0x04,
-    0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x0a,0x00,0x1e,0x00,0x2c,0x00,0x01,
-    0x68,0x65,0x62,0x72,0x00,0x08,0x00,0x04,0x00,0x00,
-    0x00,0x00,0xff,0xff,0x00,0x01,0x00,0x00,0x00,0x01,
-    0x6d,0x61,0x72,0x6b,0x00,0x08,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x01,0x00,0x04,0x00,0x04,0x00,0x00,
-    0x00,0x01,0x00,0x08,0x00,0x01,0x00,0x0c,0x00,0x1c,
-    0x00,0x04,0x00,0x26,0x00,0x84,0x00,0x02,0x00,0x02,
-    0x00,0xd4,0x00,0xe1,0x00,0x00,0x00,0xe3,0x00,0xe5,
-    0x00,0x0e,0x00,0x02,0x00,0x01,0x00,0xe6,0x01,0x00,
-    0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x58,0x00,0x00,
-    0x00,0x58,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x58,
-    0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x58,0x00,0x00,
-    0x00,0x58,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x58,
-    0x00,0x01,0x00,0x52,0x00,0x01,0x00,0x52,0x00,0x00,
-    0x00,0x58,0x00,0x02,0x00,0x46,0x00,0x00,0x00,0x58,
-    0x00,0x03,0x00,0x4c,0x00,0x01,0x00,0x52,0x00,0x00,
-    0x00,0x58,0x00,0x01,0x00,0x00,0x02,0x9e,0x00,0x01,
-    0x00,0x00,0x04,0x5e,0x00,0x01,0xff,0xff,0x04,0x5e,
-    0x00,0x01,0x00,0x00,0x00,0x6e,0x00,0x1b,0x00,0xda,
-    0x02,0x6c,0x00,0xe0,0x02,0x78,0x00,0xe6,0x00,0xec,
-    0x00,0xf2,0x02,0x78,0x00,0xf8,0x00,0xfe,0x01,0x04,
-    0x02,0x78,0x01,0x0a,0x01,0x10,0x02,0x48,0x02,0x78,
-    0x01,0x7c,0x01,0x16,0x01,0x88,0x02,0x78,0x01,0x1c,
-    0x01,0x22,0x01,0x28,0x02,0x78,0x01,0x2e,0x01,0xca,
-    0x01,0x34,0x02,0x78,0x01,0x7c,0x02,0x30,0x01,0x88,
-    0x02,0x78,0x01,0xc4,0x01,0x3a,0x01,0xd0,0x02,0x78,
-    0x01,0x40,0x01,0x46,0x01,0x4c,0x02,0x78,0x01,0x52,
-    0x02,0x1e,0x01,0x64,0x02,0x78,0x01,0x58,0x01,0x5e,
-    0x01,0x64,0x02,0x78,0x01,0x6a,0x01,0x70,0x01,0x76,
-    0x02,0x78,0x01,0x7c,0x01,0x82,0x01,0x88,0x02,0x78,
-    0x01,0x8e,0x01,0x94,0x01,0x9a,0x02,0x78,0x01,0xa0,
-    0x01,0xa6,0x01,0xac,0x02,0x78,0x01,0xb2,0x01,0xb8,
-    0x01,0xbe,0x02,0x78,0x01,0xc4,0x01,0xca,0x01,0xd0,
-    0x02,0x78,0x01,0xd6,0x02,0x54,0x01,0xdc,0x02,0x78,
-    0x01,0xe2,0x01,0xe8,0x01,0xee,0x02,0x78,0x01,0xf4,
-    0x01,0xfa,0x02,0x00,0x02,0x78,0x02,0x06,0x02,0x0c,
-    0x02,0x12,0x02,0x78,0x02,0x18,0x02,0x1e,0x02,0x24,
-    0x02,0x78,0x02,0x2a,0x02,0x30,0x02,0x36,0x02,0x78,
-    0x02,0x3c,0x02,0x42,0x02,0x48,0x02,0x78,0x02,0x4e,
-    0x02,0x54,0x02,0x5a,0x02,0x60,0x02,0x66,0x02,0x6c,
-    0x02,0x72,0x02,0x78,0x00,0x01,0x01,0x75,0x00,0x00,
-    0x00,0x01,0x01,0x39,0x01,0x33,0x00,0x01,0x01,0x99,
-    0x00,0x00,0x00,0x01,0x00,0x81,0x04,0x5e,0x00,0x01,
-    0x01,0x1b,0x02,0x9e,0x00,0x01,0x01,0x48,0x00,0x00,
-    0x00,0x01,0x00,0xc8,0x04,0x5e,0x00,0x01,0x00,0xfd,
-    0x02,0x9e,0x00,0x01,0x01,0x53,0x00,0x00,0x00,0x01,
-    0x00,0x49,0x04,0x5e,0x00,0x01,0x00,0xb4,0x04,0x5e,
-    0x00,0x01,0x00,0xc1,0x00,0x00,0x00,0x01,0x00,0xa3,
-    0x04,0x5e,0x00,0x01,0x00,0x09,0x02,0x9e,0x00,0x01,
-    0x00,0xdd,0x00,0x00,0x00,0x01,0x00,0x29,0x02,0x9e,
-    0x00,0x01,0x00,0x8c,0x04,0x5e,0x00,0x01,0x00,0xbc,
-    0x00,0x00,0x00,0x01,0x00,0xa7,0x04,0x5e,0x00,0x01,
-    0x00,0x07,0x03,0x13,0x00,0x01,0x00,0x43,0x01,0x54,
-    0x00,0x01,0x01,0x3e,0x00,0x00,0x00,0x01,0x00,0x5d,
-    0x04,0x5e,0x00,0x01,0x00,0xc1,0x02,0x9e,0x00,0x01,
-    0x01,0x2f,0x00,0x00,0x00,0x01,0xff,0xbd,0x04,0x5e,
-    0x00,0x01,0x00,0x93,0x02,0x9e,0x00,0x01,0x01,0xca,
-    0x00,0x00,0x00,0x01,0x00,0xbb,0x04,0x5e,0x00,0x01,
-    0x01,0xca,0x02,0x9e,0x00,0x01,0x01,0xae,0x00,0x00,
-    0x00,0x01,0x00,0x7a,0x04,0x5e,0x00,0x01,0x01,0xae,
-    0x02,0x9e,0x00,0x01,0xff,0x53,0x01,0x5b,0x00,0x01,
-    0x00,0x85,0x04,0x5e,0x00,0x01,0x00,0x21,0x02,0x9e,
-    0x00,0x01,0x01,0x1d,0x00,0x00,0x00,0x01,0x00,0x7f,
-    0x04,0x5e,0x00,0x01,0x00,0xa7,0x02,0x9e,0x00,0x01,
-    0x01,0xba,0x00,0x00,0x00,0x01,0x00,0x93,0x04,0x5e,
-    0x00,0x01,0x01,0xba,0x02,0x9e,0x00,0x01,0x01,0xa7,
-    0x00,0x00,0x00,0x01,0x01,0xe7,0x02,0x9e,0x00,0x01,
-    0x01,0x39,0x01,0x54,0x00,0x01,0x00,0x99,0x04,0x5e,
-    0x00,0x01,0x01,0x97,0x03,0x4f,0x00,0x01,0x01,0xb1,
-    0x00,0x00,0x00,0x01,0x00,0x8b,0x04,0x5e,0x00,0x01,
-    0x01,0xb1,0x03,0x4f,0x00,0x01,0xff,0x7b,0x01,0x54,
-    0x00,0x01,0x00,0x14,0x04,0x5e,0x00,0x01,0x01,0x38,
-    0x02,0x2f,0x00,0x01,0x01,0x7a,0x00,0x00,0x00,0x01,
-    0x00,0x50,0x04,0x5e,0x00,0x01,0x00,0xc1,0x01,0x61,
-    0x00,0x01,0x02,0x57,0x00,0x00,0x00,0x01,0x00,0xad,
-    0x04,0x5e,0x00,0x01,0x01,0x83,0x02,0x9e,0x00,0x01,
-    0x01,0xe7,0x00,0x00,0x00,0x01,0x00,0x43,0x04,0x5e,
-    0x00,0x01,0x00,0xdc,0x02,0x9e,0x00,0x01,0x02,0x0c,
-    0x00,0x00,0x00,0x01,0x00,0x6b,0x04,0x5e,0x00,0x01,
-    0x02,0x0c,0x01,0xb8,0x00,0x01,0x03,0xa0,0x04,0x5e,
-    0x00,0x01,0x01,0xbd,0x00,0x00,0x00,0x01,0x00,0x64,
-    0x04,0x5e,0x00,0x01,0x01,0xbd,0x02,0x9e,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,
-    0x00,0x0a,0x00,0x1c,0x00,0x1c,0x00,0x01,0x68,0x65,
-    0x62,0x72,0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,
-    0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00
+const size_t opensans_hebrew_condensed_light_ttf_size = 17990;
+const unsigned char opensans_hebrew_condensed_light_ttf_data[17990] = {
+    0x45,0x53,0x5a,0x31,0x64,0x80,0x00,0x00,0x78,0xda,
+    0xd5,0x7d,0x7b,0x40,0x54,0xc5,0xf7,0xf8,0xcc,0xdc,
+    0x7d,0x00,0x22,0xee,0xb2,0x0b,0xf8,0x84,0x5d,0x96,
+    0xa7,0xc8,0x73,0x59,0x56,0x44,0x14,0xe5,0x21,0x22,
+    0x22,0xae,0x88,0x88,0xc8,0x4b,0x9e,0xca,0x4b,0xc0,
+    0xb7,0x68,0x66,0xa6,0x7e,0xd2,0x4c,0x2d,0x35,0x33,
+    0x33,0x33,0x23,0x33,0x33,0x35,0x33,0x33,0x2b,0x1f,
+    0x3d,0x34,0x33,0x2b,0xf3,0x63,0x65,0x69,0x6f,0xcb,
+    0xcc,0x4f,0xf5,0xf1,0x67,0xc0,0x0e,0xbf,0x33,0x73,
+    0xef,0x2e,0xcb,0x43,0xeb,0xf7,0xfd,0xfd,0xfe,0xf9,
+    0xa1,0x73,0x67,0x76,0xee,0xcc,0x39,0x67,0xce,0x9c,
+    0x39,0x73,0xe6,0xcc,0xdc,0x7b,0x11,0x46,0x08,0xa9,
+    0xe0,0x22,0x43,0x28,0x25,0x25,0x6b,0x7c,0xf9,0xd2,
+    0xde,0x1a,0x84,0x16,0x1f,0x82,0xdc,0x81,0x63,0x92,
+    0x92,0x53,0x84,0x0b,0xb2,0x97,0xe1,0xf7,0x47,0xf0,
+    0x3b,0x66,0x4c,0xe6,0x84,0x49,0xef,0x8d,0xde,0x33,
+    0x05,0xa1,0x26,0x27,0x84,0x84,0x61,0x63,0x26,0x4d,
+    0x1e,0x5d,0xb1,0xb1,0x78,0x23,0x42,0xf7,0x25,0xc1,
+    0x7d,0xef,0x09,0x93,0xc2,0xa3,0x96,0x0e,0x3c,0x17,
+    0x8d,0x10,0x5e,0x05,0xbf,0x0b,0x67,0x54,0x17,0xd5,
+    0xb9,0x6c,0xb9,0x71,0x06,0x21,0xc5,0x29,0x28,0x9f,
+    0x5d,0x5e,0xd4,0x50,0xc7,0xb0,0x01,0xbc,0xbd,0x10,
+    0x3b,0x95,0x57,0x2d,0x28,0xfb,0xed,0xab,0x73,0x80,
+    0xcf,0xf5,0x51,0x84,0x8a,0x4a,0x2a,0x4a,0x8b,0x4a,
+    0xc8,0xcf,0x7e,0x2b,0xa0,0xbe,0x2b,0xc3,0x57,0x01,
+    0x19,0x6e,0xff,0x91,0x03,0x7c,0xcc,0xe0,0xfb,0x55,
+    0x54,0x37,0xce,0x5f,0x55,0x90,0xfb,0x0d,0xfc,0xfe,
+    0x09,0x08,0xfe,0xb2,0xaa,0x76,0x46,0xd1,0xe8,0x2f,
+    0xa7,0x01,0x3c,0x17,0x3f,0x84,0x48,0x5d,0x75,0xd1,
+    0xfc,0x3a,0x7c,0x1f,0x1a,0x0b,0xf7,0x2b,0xa0,0xbc,
+    0xae,0xa6,0xa8,0xba,0xb4,0xa8,0x66,0x3f,0xe0,0xae,
+    0xbe,0x03,0xe8,0x7e,0xaa,0xab,0x6d,0x68,0x1c,0xba,
+    0x73,0x57,0x24,0x42,0x73,0xaf,0x22,0x24,0x3f,0x53,
+    0x57,0x5f,0x5a,0x57,0xa1,0x58,0x03,0xf8,0x5c,0x06,
+    0x42,0x79,0x25,0x62,0xbc,0x20,0x68,0xd4,0xa9,0x23,
+    0x6f,0x0d,0x29,0xe8,0x33,0xfc,0xbf,0xc4,0x19,0x9a,
+    0x09,0x7f,0xe7,0xf6,0x4e,0xaf,0xe2,0xf1,0x5b,0x8b,
+    0xb3,0xe9,0x41,0xea,0xae,0xdc,0xa7,0x6c,0x60,0xf4,
+    0x23,0xdb,0x1f,0xd4,0x73,0x5a,0x6b,0x6d,0x66,0x59,
+    0x70,0xff,0xa0,0x72,0x1f,0x87,0xe4,0xf0,0x87,0xcd,
+    0x2c,0x07,0xae,0x29,0x80,0x05,0x71,0x2c,0xac,0x16,
+    0x2b,0x95,0x20,0x15,0x11,0x84,0x01,0x78,0x08,0x12,
+    0x80,0x2e,0xa3,0xec,0x03,0xf8,0xfd,0xb8,0x18,0x93,
+    0x0f,0x50,0x14,0xd9,0xce,0x0a,0xc8,0x14,0x36,0x68,
+    0x4e,0x42,0x82,0x03,0xec,0xc9,0xe3,0xa6,0x64,0x40,
+    0xd4,0xbb,0x75,0x9c,0xc2,0x87,0x6a,0xd1,0x03,0x4e,
+    0x6b,0x49,0x8e,0x0e,0x21,0x3d,0xaf,0x13,0x2f,0x3f,
+    0xcc,0x38,0x81,0x64,0x44,0x2b,0x96,0x26,0x7b,0x20,
+    0x40,0x1a,0x2f,0x83,0x70,0x12,0x6d,0x24,0xfb,0xd0,
+    0x0a,0xa1,0x04,0xf9,0x0b,0x46,0x94,0x2f,0x3b,0x82,
+    0xf2,0x85,0xd1,0x68,0x34,0x5e,0x81,0x56,0x10,0x13,
+    0xaa,0x80,0x90,0x45,0xae,0x43,0x9e,0x11,0xc5,0xe1,
+    0xdd,0x28,0x83,0xc8,0x90,0x09,0xe2,0x15,0xe4,0x7d,
+    0x64,0x84,0xbc,0x1c,0x08,0x9b,0x20,0xa4,0x41,0x48,
+    0x87,0xc0,0x60,0x14,0x43,0x28,0x81,0x10,0x0b,0x21,
+    0x15,0x82,0x85,0x95,0x67,0x75,0x19,0x0c,0x29,0xc4,
+    0x92,0xd1,0xc8,0x20,0xbb,0x80,0x6a,0x84,0x50,0x68,
+    0xf6,0x43,0x68,0x87,0x90,0x07,0xe9,0x6f,0x20,0xd6,
+    0xa2,0x1d,0xe4,0x32,0xda,0x21,0x33,0xa2,0x5a,0x19,
+    0x41,0x3b,0xf0,0x4e,0x08,0xeb,0xdb,0x77,0x0b,0xb1,
+    0x90,0xff,0x2e,0xda,0x21,0x6f,0x80,0x7b,0xa3,0x21,
+    0x04,0xa3,0x5a,0x21,0x55,0x8a,0xcb,0xa0,0x5e,0x30,
+    0xca,0x86,0xfb,0x6e,0xc2,0x9f,0x68,0xa3,0xe0,0x03,
+    0x1c,0x6c,0x40,0x2e,0xe4,0x2c,0xd2,0x42,0xdb,0x10,
+    0x59,0x0e,0xf8,0x56,0xa0,0x7d,0x8c,0x66,0x88,0xd3,
+    0x38,0x9d,0x69,0xed,0x6d,0xb2,0x32,0x7c,0x40,0x50,
+    0x01,0x5d,0x4d,0x68,0x3d,0x59,0x84,0x0a,0x21,0xce,
+    0x17,0x0c,0xa8,0x10,0x9f,0x86,0x7a,0xdf,0x23,0x03,
+    0xc0,0x5d,0x0f,0x3c,0x5a,0x8e,0x97,0xb5,0xb7,0x01,
+    0x6c,0x96,0x5e,0x2f,0xf7,0x42,0xeb,0x59,0xbe,0x60,
+    0x81,0xb2,0x50,0x8f,0xd5,0x21,0xe1,0x50,0x1f,0xe0,
+    0xe2,0xb7,0x51,0x08,0xdc,0x5b,0x4b,0xd6,0x22,0x17,
+    0x59,0x09,0xc0,0xd8,0x85,0x0c,0x64,0x6d,0x3b,0x25,
+    0x83,0x50,0x1c,0xb9,0x86,0xaa,0x05,0x23,0x9e,0x09,
+    0x71,0x05,0xe3,0x01,0xe7,0x3f,0xf0,0x1e,0xd2,0xcd,
+    0x10,0x32,0x65,0xb5,0xa8,0x09,0xe2,0x99,0xbc,0xcc,
+    0x51,0x64,0x01,0xda,0xf2,0x14,0xcd,0xa8,0x04,0xf8,
+    0x14,0x2b,0xe4,0x20,0x0b,0xaf,0x03,0xbc,0x67,0x79,
+    0x40,0xfb,0x1d,0xa1,0x1a,0x3d,0xc4,0xf3,0xca,0x50,
+    0x24,0x84,0x70,0xde,0x96,0x99,0x40,0xcf,0xbb,0x68,
+    0x13,0xe7,0xf7,0x05,0x7e,0xcf,0x42,0x66,0xa2,0x14,
+    0x56,0x5f,0xbe,0x09,0x45,0x4b,0x21,0x1c,0x60,0x86,
+    0x73,0xbe,0xf7,0x10,0x64,0x20,0x13,0xbc,0x2f,0xb4,
+    0x62,0x5f,0xd8,0x02,0xde,0xd9,0xfe,0x15,0xf4,0xc5,
+    0x56,0x88,0x7f,0x80,0xd0,0x0a,0x7d,0x15,0x6f,0xeb,
+    0x87,0xae,0x81,0xd1,0x05,0x71,0x21,0xef,0x0b,0x87,
+    0xc0,0xfa,0x82,0xf5,0x99,0x60,0x06,0x3a,0x19,0xdf,
+    0x7b,0x08,0xb2,0x1b,0x20,0x63,0xac,0x2f,0x0c,0x9d,
+    0x03,0xf4,0xc1,0x55,0xe0,0xff,0x6c,0x88,0x3f,0x83,
+    0x70,0x03,0xda,0x94,0x6f,0xef,0x87,0xae,0x81,0xc9,
+    0x98,0x05,0x25,0xb1,0xbe,0x70,0x0c,0xac,0x2f,0x78,
+    0x5f,0x43,0xcc,0xfa,0x12,0xe4,0xaf,0x56,0xce,0xca,
+    0x33,0xd9,0x81,0xfe,0xb3,0xcb,0xca,0x20,0x14,0xc5,
+    0xfb,0x64,0x05,0xce,0x96,0x42,0x05,0x93,0x03,0xd9,
+    0x76,0xbc,0x1a,0x2f,0x45,0x49,0xf0,0x3b,0x58,0xb6,
+    0x1a,0xc3,0xe8,0x6a,0x07,0xbd,0x42,0x0f,0x42,0xb8,
+    0x26,0x86,0xf6,0x93,0x10,0x8c,0x10,0x4c,0x10,0x32,
+    0xa4,0x70,0x52,0x2c,0xc7,0xf3,0x58,0xfa,0x13,0xd6,
+    0x8f,0x52,0xfa,0x04,0x84,0x1a,0xc1,0x19,0xa5,0x92,
+    0x1b,0x20,0x47,0x8f,0xa0,0x06,0xb2,0x1b,0xa9,0x85,
+    0x47,0x45,0x59,0xc3,0x2f,0xa0,0x95,0x2c,0x2d,0x34,
+    0xa2,0x02,0x3c,0x0f,0xad,0x21,0xcd,0x28,0x18,0x78,
+    0x13,0x4c,0xf2,0x51,0xa8,0xb0,0x11,0xf2,0xa7,0xc1,
+    0x98,0x64,0x75,0x62,0x51,0x20,0x94,0xc9,0x17,0x32,
+    0x60,0xbc,0x3d,0x02,0x71,0x31,0xc0,0xaa,0x85,0xb6,
+    0xfc,0x01,0x7c,0x98,0x0c,0xed,0xdd,0x86,0xbc,0x64,
+    0x7d,0x41,0xee,0x17,0x82,0x96,0x1f,0x8e,0x42,0x48,
+    0x36,0x0a,0x01,0x55,0x6f,0x01,0xe5,0x65,0xc1,0x71,
+    0x28,0x84,0x07,0x36,0xb6,0xb3,0xc5,0x7b,0x64,0x23,
+    0xd2,0x0b,0x0d,0x68,0x11,0x0f,0x04,0x35,0xcb,0x7e,
+    0x47,0x2b,0x14,0x87,0x01,0x26,0x94,0x67,0x01,0xbb,
+    0xd0,0x4b,0xb2,0x59,0x80,0xdf,0x88,0x0c,0xf2,0xbd,
+    0x30,0xe6,0x52,0x90,0x96,0x05,0x86,0x03,0x42,0x98,
+    0x2d,0x66,0xed,0xb2,0x85,0xee,0xed,0x6b,0xff,0x00,
+    0xbf,0x00,0xfd,0xc8,0xdb,0xd6,0x7e,0xa6,0x53,0xdb,
+    0xa0,0x5d,0xf6,0x36,0xd9,0xda,0xd3,0x53,0x5b,0x96,
+    0xa1,0x72,0xe0,0x9f,0x07,0xd3,0x63,0x4c,0x7b,0x4a,
+    0x61,0xa0,0xa8,0x79,0x71,0x3a,0xfc,0xc2,0xfc,0xb7,
+    0x0c,0x47,0x40,0x9c,0x0a,0x7a,0x56,0x0e,0xea,0xb9,
+    0x37,0x5a,0x82,0x76,0xa0,0x76,0x1c,0x89,0x27,0xe1,
+    0x22,0x3c,0x1f,0x2f,0xc1,0x1b,0xc8,0xbb,0xe4,0x8a,
+    0xfc,0xb8,0xfc,0x84,0xfc,0x5d,0xf9,0xcf,0xf2,0x3f,
+    0x75,0x5a,0x5d,0x7f,0x9d,0xb7,0xce,0x57,0x17,0xa0,
+    0x8b,0xd0,0x0d,0xd3,0x25,0xe9,0xf6,0xe8,0xf6,0xea,
+    0x7d,0x5b,0x49,0x6b,0x4c,0xeb,0xf0,0xd6,0x11,0xad,
+    0xa3,0x5a,0x93,0x5a,0xc7,0xb5,0xb7,0x33,0x7d,0x0b,
+    0x5a,0x75,0x07,0x7a,0x1a,0x20,0x59,0x70,0x21,0x40,
+    0x6a,0x02,0x48,0xef,0x90,0x7f,0xcb,0xf7,0xcb,0xdf,
+    0x06,0x48,0x1f,0xc9,0xff,0xd0,0x69,0x74,0x7d,0x75,
+    0x03,0x75,0x3a,0x0e,0x29,0xd6,0x0e,0x09,0xb7,0x0e,
+    0x6e,0x1d,0x0a,0x90,0x12,0x5a,0x13,0x5b,0x53,0xda,
+    0xdb,0xdb,0x6f,0xb7,0x7f,0x87,0x36,0xb5,0x9f,0x6c,
+    0xdf,0xd0,0x5e,0xdf,0x5e,0xd6,0x9e,0xd9,0x9e,0xde,
+    0x1e,0x4b,0x15,0xd6,0xdb,0xad,0x7e,0xad,0xbe,0xad,
+    0xde,0xad,0x9e,0xad,0x6e,0x57,0x6f,0x5d,0xfd,0xf5,
+    0xea,0x8d,0xab,0xbf,0x5c,0xfd,0xe9,0xea,0xd7,0x57,
+    0x2f,0x5d,0xfd,0xf0,0x6a,0xe5,0xd5,0x8a,0xaf,0xff,
+    0x50,0x78,0xc8,0x6f,0xca,0x7f,0x95,0xdf,0x90,0xff,
+    0x02,0x54,0x5f,0xef,0x3a,0xdf,0xfc,0x5f,0xfc,0x29,
+    0x88,0x8b,0x34,0xa5,0x75,0x85,0x89,0xf9,0xac,0x65,
+    0xe3,0xf6,0xbd,0xfe,0xc4,0x9a,0x32,0xe0,0xb8,0x02,
+    0xe6,0x3b,0x27,0xe4,0x8c,0x5c,0x50,0x2f,0xe4,0x0a,
+    0x3c,0x73,0x43,0x7d,0x60,0xfe,0x57,0x23,0x77,0xa4,
+    0x41,0x5a,0xe4,0x81,0x3c,0x91,0x17,0xea,0x8b,0xfa,
+    0xa1,0xfe,0x68,0x00,0xf4,0xd5,0x20,0xe4,0x8d,0x7c,
+    0x80,0xaf,0x7a,0xe4,0x8b,0x0c,0xc8,0x0f,0xf9,0xa3,
+    0x00,0x14,0x88,0x82,0x50,0x30,0x1a,0x8c,0x42,0xd0,
+    0x10,0x14,0x8a,0xc2,0x50,0x38,0x8a,0x40,0x91,0x28,
+    0x0a,0x19,0x51,0x34,0x8c,0xa4,0x18,0x64,0x46,0x43,
+    0x51,0x2c,0x1a,0x86,0xe2,0xd0,0x70,0x14,0x8f,0x46,
+    0xa0,0x91,0xd0,0xd3,0xa3,0xd0,0x68,0x94,0x88,0x92,
+    0x50,0x32,0xcc,0xb7,0x63,0xa0,0xef,0xc7,0xa2,0x34,
+    0x34,0x0e,0xa5,0xa3,0xf1,0x28,0x03,0x4d,0x40,0x99,
+    0x68,0x22,0xb2,0xa0,0x49,0x28,0x0b,0x4d,0x46,0xd9,
+    0x68,0x0a,0xca,0x41,0x53,0x51,0x2e,0x9a,0x86,0xf2,
+    0xd0,0x74,0x94,0x8f,0x0a,0x50,0x21,0x2a,0x42,0xc5,
+    0x40,0xff,0x4a,0xb4,0x0a,0xfd,0x0b,0xad,0x41,0x8f,
+    0xa2,0xc7,0xd1,0x53,0x68,0x17,0x7a,0x06,0x3d,0x8b,
+    0x9e,0x43,0xbb,0x51,0x33,0xda,0x83,0xf6,0xa2,0x17,
+    0xd0,0x8b,0x68,0x1f,0xda,0x8f,0x5e,0x42,0x2f,0xa3,
+    0x03,0xe8,0x10,0x3a,0x8c,0x5e,0x41,0xaf,0xa2,0xd7,
+    0xd0,0x11,0xf4,0x06,0x3a,0x86,0x8e,0xa3,0x37,0x71,
+    0x2f,0xd4,0x80,0x4a,0x51,0x19,0x9a,0x89,0x7b,0xa3,
+    0x05,0x68,0x27,0x9a,0x8d,0xaa,0xb0,0x07,0x9a,0x87,
+    0x66,0x01,0xec,0xd5,0xe8,0x09,0xb8,0x36,0x72,0x3e,
+    0x55,0xa0,0xf9,0x0e,0xbc,0xab,0x46,0x4d,0x70,0x7d,
+    0x1e,0xbd,0x8e,0xee,0x47,0x25,0x08,0x46,0x32,0x3a,
+    0xcb,0xf3,0x6b,0xd0,0x12,0xec,0x86,0x63,0xd0,0x72,
+    0xf4,0x20,0xda,0x82,0x4e,0xa1,0xd3,0x58,0xc0,0x32,
+    0xec,0x84,0x9d,0xb1,0x1c,0x2b,0xd0,0x51,0x28,0x71,
+    0x02,0xbd,0x87,0xdd,0xb1,0x16,0xab,0xb0,0x1a,0x7b,
+    0x62,0x2f,0xb0,0xa1,0x16,0x62,0x25,0x76,0xc1,0x7d,
+    0xd0,0x0a,0xb4,0x16,0x3d,0x80,0x1e,0x46,0x0f,0xa1,
+    0x47,0xd0,0x7a,0xb4,0x01,0xad,0x43,0x9b,0xd0,0x66,
+    0xa8,0xf1,0x18,0x7a,0x12,0x6d,0x47,0xdb,0xd0,0x49,
+    0xf4,0x01,0xfa,0x18,0xd5,0xa3,0x0f,0xd1,0x79,0xf4,
+    0x11,0x5a,0x84,0x3e,0x41,0x17,0xd0,0x39,0x84,0x8e,
+    0xe0,0xf6,0x15,0xfb,0x65,0x6b,0x3b,0xf7,0x2d,0x8c,
+    0x6d,0x68,0xd3,0x5e,0xf4,0x3b,0x1e,0x81,0xd3,0x41,
+    0x37,0x3e,0x80,0x77,0xe2,0xa3,0xf8,0x03,0xfc,0x39,
+    0xfe,0x19,0xdf,0x21,0xde,0x24,0x86,0x94,0x90,0x6d,
+    0xe4,0x2d,0x72,0x43,0xf0,0x15,0x62,0x84,0x85,0xc2,
+    0x21,0xe1,0x43,0xe1,0x67,0x19,0x92,0x69,0x65,0x41,
+    0xb2,0x3c,0xd9,0x09,0xd9,0x77,0xf2,0xbe,0xf2,0x54,
+    0xf9,0x4c,0xf9,0x03,0xf2,0xad,0xf2,0x53,0xf2,0x2f,
+    0xe5,0x3f,0x29,0x90,0xc2,0x5b,0x11,0xa6,0xc8,0x51,
+    0xcc,0x55,0x6c,0x57,0x1c,0x57,0xdc,0x54,0x7a,0x2a,
+    0x33,0x94,0xc5,0xca,0xfb,0x94,0x5b,0x95,0xef,0x29,
+    0x7f,0x50,0xb6,0x39,0x69,0x9d,0x82,0x9c,0x62,0x9c,
+    0xd2,0x9c,0xf2,0x9d,0xaa,0x9c,0xee,0x77,0x3a,0xe2,
+    0xf4,0x93,0xb3,0x8b,0xf3,0x50,0xe7,0x62,0xe7,0x07,
+    0x9d,0xbf,0x72,0x91,0xb9,0x78,0xbb,0x24,0xb9,0x14,
+    0xbb,0xd4,0xb8,0xec,0x70,0x39,0xe1,0xf2,0x5d,0x2f,
+    0xcf,0x5e,0x49,0xbd,0xca,0x7a,0x6d,0xe9,0x75,0xb4,
+    0xd7,0x57,0xbd,0xee,0xb8,0x06,0xb9,0x26,0xb9,0xd6,
+    0xb8,0x3e,0xe8,0x7a,0xcc,0xf5,0x4c,0x6f,0xd4,0xdb,
+    0x17,0xfe,0x0d,0xeb,0x5d,0xdc,0x7b,0x43,0xef,0xcf,
+    0x7a,0xb7,0xb9,0xa9,0xdc,0x0a,0xdd,0xee,0x73,0xfb,
+    0xb8,0x8f,0xac,0x4f,0x50,0x9f,0xa1,0x7d,0x52,0xfa,
+    0x6c,0xed,0xd3,0xdc,0xe7,0x4c,0x9f,0x9f,0x55,0x2a,
+    0x55,0x82,0x2a,0x4b,0xb5,0x50,0xb5,0x49,0xb5,0x5b,
+    0xf5,0x8e,0xea,0x2b,0x15,0x55,0xeb,0xd4,0xb9,0xea,
+    0x2d,0xea,0x9f,0xdd,0xbd,0xdd,0x33,0xdd,0xef,0x73,
+    0x3f,0xe6,0xde,0xa6,0x89,0xd1,0xd4,0x69,0xb6,0x68,
+    0xbe,0xd4,0xca,0xb4,0x43,0xb4,0x85,0xda,0x0d,0xda,
+    0x7d,0xda,0x33,0xda,0xdf,0x3d,0xfa,0x7a,0x8c,0xf6,
+    0xb8,0xcf,0xe3,0x88,0xc7,0x4d,0xcf,0x08,0xcf,0xb9,
+    0x9e,0x87,0x3d,0xff,0xed,0xe5,0xe9,0x95,0xe4,0x55,
+    0xe7,0xd5,0xec,0xf5,0x55,0x5f,0x59,0xdf,0xc1,0x7d,
+    0xcb,0xfa,0xee,0xe9,0x7b,0xb3,0xdf,0x88,0x7e,0x1b,
+    0xfa,0x5d,0xed,0x1f,0xd6,0x7f,0x49,0xff,0xc3,0xfd,
+    0x6f,0x0d,0x08,0x1a,0x50,0x33,0x60,0xff,0x80,0x0f,
+    0x06,0xfc,0x34,0x50,0x35,0x30,0x66,0x60,0xfd,0xc0,
+    0x03,0x03,0xbf,0x1b,0xa4,0x1d,0x94,0x39,0xe8,0x91,
+    0x41,0x67,0x06,0xdd,0xf0,0x0e,0xf2,0xce,0xf3,0x7e,
+    0xd8,0xfb,0x03,0x1f,0x27,0x9f,0x04,0x9f,0xb9,0x3e,
+    0x47,0x7c,0x4e,0xf9,0xfc,0xa9,0x8b,0xd1,0x3d,0xa8,
+    0xfb,0x48,0x8f,0xf4,0x11,0xfa,0x42,0xfd,0x23,0xfa,
+    0x03,0xfa,0x8f,0xf4,0x3f,0xe9,0x5b,0x7c,0xfb,0xfb,
+    0xc6,0xf8,0xe6,0xf9,0xde,0xef,0xbb,0xc5,0xf7,0x1d,
+    0xdf,0x6f,0x0c,0xc4,0xa0,0x32,0x04,0x18,0x92,0x0c,
+    0x16,0x43,0xb1,0xa1,0xce,0xb0,0xc4,0xb0,0xcd,0xb0,
+    0xc7,0x70,0xc4,0xf0,0x8e,0xe1,0x53,0xc3,0x37,0x86,
+    0xdf,0xfd,0xfc,0xfc,0xd2,0xfd,0xe6,0xfb,0x6d,0xf5,
+    0x3b,0xee,0x77,0xc6,0xef,0x3b,0x7f,0xe2,0x1f,0xe6,
+    0x3f,0xc2,0x3f,0xdb,0xff,0x7e,0xff,0x6d,0xfe,0x6f,
+    0xf9,0xd3,0x00,0x6d,0xc0,0xb0,0x80,0x99,0x01,0x8f,
+    0x06,0x1c,0x0b,0xb8,0x13,0xd8,0x3f,0x30,0x21,0xb0,
+    0x2e,0x70,0x43,0xe0,0x3b,0x81,0xb7,0x83,0xdc,0x82,
+    0xa2,0x83,0x46,0x07,0x65,0x06,0x15,0x07,0x35,0x06,
+    0x3d,0x18,0xb4,0x33,0xe8,0xad,0xa0,0xaf,0x82,0x5a,
+    0x82,0x83,0x82,0x87,0x05,0xe7,0x05,0x1f,0x0b,0xfe,
+    0x38,0xf8,0x87,0xe0,0x3f,0x07,0x47,0x0d,0xae,0x19,
+    0xbc,0x75,0xf0,0x47,0x83,0x5b,0x42,0x86,0x86,0xcc,
+    0x0d,0x39,0x36,0x84,0x0c,0x19,0x3e,0x64,0xfe,0x90,
+    0x03,0x43,0xbe,0x09,0xf5,0x0c,0x4d,0x08,0xad,0x0a,
+    0xbd,0x2f,0x74,0x67,0xe8,0x67,0xa1,0x37,0xc3,0xdc,
+    0xc2,0x46,0x87,0x95,0x84,0xed,0x09,0xfb,0x77,0xb8,
+    0x2a,0x3c,0x21,0xfc,0x81,0xf0,0x43,0xe1,0x37,0x23,
+    0xfa,0x46,0x64,0x45,0x3c,0x1c,0xb1,0x2b,0xe2,0x40,
+    0xc4,0x01,0xd0,0x33,0x1b,0xdb,0x6f,0xe1,0x70,0xb0,
+    0x5d,0x05,0xd0,0x1c,0x48,0x63,0x10,0x8c,0x24,0xca,
+    0x43,0xab,0x30,0xf8,0xb6,0x99,0x0d,0x4d,0x6b,0xb6,
+    0x85,0x18,0x32,0x70,0xad,0x6c,0x4c,0x6b,0x9f,0x59,
+    0x31,0xd1,0xa2,0x35,0xbd,0x42,0xd8,0x4d,0x82,0x79,
+    0x79,0xa5,0x58,0x1e,0x43,0xf8,0x36,0x5e,0xbf,0x08,
+    0xbb,0xc2,0x05,0x6e,0xaa,0xac,0xb7,0x88,0x4a,0x2c,
+    0xeb,0x0f,0x0a,0x8c,0xd9,0xc5,0x03,0x40,0xd7,0x20,
+    0xec,0x01,0x05,0x21,0x18,0x34,0x3c,0x98,0x8c,0x3c,
+    0x80,0x79,0x0b,0x41,0x0e,0x57,0x21,0x7e,0x7f,0xe8,
+    0xbe,0x23,0x26,0x8b,0xf9,0x7a,0xcc,0x78,0x63,0xf3,
+    0x81,0xd0,0x03,0xc7,0xc2,0x2d,0x91,0x37,0x22,0xd3,
+    0xc3,0xe9,0xb1,0xd0,0xeb,0xe1,0x32,0xf7,0x6c,0x3a,
+    0x3b,0x97,0x86,0xe2,0x4f,0x58,0xc8,0xc5,0xeb,0xb2,
+    0xf1,0x2e,0x9a,0xc7,0x02,0xe4,0xe3,0x75,0xa2,0xae,
+    0xcc,0x6f,0x5f,0x4d,0x2e,0x29,0xb4,0xa0,0xdf,0x0c,
+    0xa0,0xc7,0x00,0xa3,0xa7,0x97,0x32,0x20,0x50,0xed,
+    0xe9,0xa9,0x55,0x28,0x3d,0x0c,0x26,0xdf,0x40,0x93,
+    0xa7,0xa7,0x51,0x1d,0x10,0x10,0x1d,0x63,0x36,0xa9,
+    0x15,0x0a,0x2d,0x88,0x8d,0x26,0x26,0x1a,0x4a,0xc4,
+    0xe0,0xb7,0xd7,0xce,0xf1,0x9f,0x53,0xb1,0xe9,0xbe,
+    0xcd,0x4b,0x2d,0x2f,0x15,0x1b,0x1f,0x1b,0xbb,0x61,
+    0xce,0x86,0x39,0x63,0xa7,0x07,0x06,0x67,0x5f,0x8c,
+    0xcc,0x2a,0x9c,0xa8,0xd0,0x1e,0x96,0x0f,0xcd,0x8e,
+    0x11,0xa8,0x2c,0x7e,0xeb,0x7f,0xf6,0x78,0xdc,0xf9,
+    0xdd,0x54,0xee,0xed,0x8b,0x6f,0x0e,0x7f,0xa2,0x65,
+    0xbf,0xf6,0x28,0xfd,0x59,0xb5,0xf8,0x80,0x39,0x66,
+    0x30,0x95,0xc5,0x3d,0x53,0x17,0x4c,0xe3,0x60,0x95,
+    0x05,0xfa,0x38,0xbf,0xfd,0x86,0x2c,0x57,0x7e,0x16,
+    0xb8,0xd4,0x0b,0xb4,0xef,0x20,0xd0,0xae,0xc8,0x3d,
+    0x26,0xca,0x53,0xa5,0xf0,0x0d,0xc0,0x06,0x6c,0x94,
+    0xfb,0x2a,0x54,0x9e,0xc6,0xa8,0x18,0x93,0x0a,0x49,
+    0xb9,0x1a,0x7b,0x4e,0x7e,0xd9,0xbb,0x95,0x55,0x27,
+    0xcb,0xf1,0xf0,0x1c,0xfc,0x45,0x8e,0x75,0xff,0x30,
+    0x63,0x74,0x7c,0x5c,0x0c,0x0e,0x29,0x7b,0xa7,0xb2,
+    0xea,0x44,0xf9,0x3b,0xc3,0xa2,0x8c,0xf0,0x53,0x76,
+    0xed,0xe7,0xeb,0x34,0xf9,0xf7,0x9b,0x6d,0x57,0xe4,
+    0x87,0x63,0x5f,0xa5,0x8b,0x8e,0xbc,0x76,0x02,0x2f,
+    0xb0,0x7a,0xff,0x70,0x9d,0x26,0xfe,0x76,0x8b,0x4c,
+    0xb1,0xe5,0x88,0x7c,0x19,0x0d,0x16,0x40,0x12,0xd0,
+    0x32,0x00,0x7a,0x04,0xac,0x4f,0xb9,0x6f,0x80,0xca,
+    0x1c,0x63,0x66,0x7c,0x60,0xa8,0x95,0x9a,0x18,0x93,
+    0x11,0x38,0xa4,0x31,0x04,0x2a,0x14,0x82,0xaf,0x42,
+    0xeb,0xe9,0x15,0x13,0x63,0x8a,0x26,0x90,0x88,0x8a,
+    0x31,0x0b,0x38,0x75,0xe1,0x9a,0x29,0x21,0x53,0xc7,
+    0x0d,0xa9,0x78,0xa5,0x62,0xdc,0xd4,0x1b,0xb1,0xf9,
+    0xc3,0x82,0xb6,0x55,0x17,0x8f,0x5b,0x1d,0x1f,0x16,
+    0x15,0x15,0x30,0xc2,0xf8,0x63,0x52,0xfe,0x96,0xb9,
+    0x31,0x54,0x7b,0x1a,0x17,0x2c,0x1c,0x91,0xbe,0xe6,
+    0xb9,0x5b,0x8f,0x6e,0xa1,0xbf,0x9d,0x9c,0x4a,0x73,
+    0xe7,0xbe,0x34,0xfd,0xab,0x14,0xda,0x76,0xa0,0x2e,
+    0x5b,0xbe,0xa2,0xfc,0xd5,0x13,0x23,0x47,0x36,0xcf,
+    0x7e,0xd7,0x4a,0xb6,0xb5,0x6c,0xcc,0x2b,0xc4,0xef,
+    0x8a,0x73,0x17,0xc8,0x12,0x46,0x5c,0x96,0xb8,0x24,
+    0x7d,0x2b,0x09,0x10,0xbf,0x57,0x41,0x8f,0xe1,0x6b,
+    0x70,0xaf,0x17,0xfc,0x50,0x10,0x95,0xbb,0x97,0x21,
+    0x00,0xae,0x66,0x7c,0x6d,0xe5,0xea,0xf5,0x4d,0x19,
+    0x8f,0x3c,0xbe,0x6d,0xad,0xfc,0xf0,0x7b,0xd4,0x48,
+    0x7d,0x68,0xd0,0xde,0x66,0xfc,0x01,0x11,0xf0,0xbf,
+    0x5f,0x60,0xf5,0xb2,0xa0,0xde,0x39,0xb1,0x9e,0xc6,
+    0xd3,0x5d,0x45,0x94,0x86,0x18,0xb8,0x06,0xee,0x7a,
+    0xe4,0xf1,0xad,0xeb,0x32,0xee,0x7b,0xf8,0xa1,0x15,
+    0xf2,0xc3,0x2f,0x50,0x7f,0x8a,0x69,0xe4,0xee,0x57,
+    0xf0,0x67,0xf8,0x0a,0xfe,0xe0,0x1d,0x8e,0x2f,0x5f,
+    0x38,0x4f,0x1e,0x02,0xd9,0x71,0x63,0xab,0x47,0x2f,
+    0xa5,0x97,0x32,0x50,0x19,0x68,0x0e,0x34,0x7b,0x05,
+    0x1a,0xf1,0xa6,0x1f,0xdd,0xbe,0xdd,0x56,0x54,0x35,
+    0x27,0xef,0xb1,0x2b,0xea,0xef,0x07,0x2c,0x90,0x0f,
+    0x88,0x9d,0xe5,0xf4,0x6d,0xe8,0xaf,0xbf,0x85,0x7f,
+    0xab,0x98,0x65,0xfe,0x0b,0xea,0xc6,0xa1,0x16,0x72,
+    0x47,0xb6,0x8f,0xd3,0xaa,0xf7,0xd0,0xab,0x0d,0x6a,
+    0xbd,0x49,0xaf,0x36,0xe2,0x93,0xd8,0x44,0xcf,0x5a,
+    0xe8,0x19,0x1c,0x63,0x21,0x6d,0x16,0x9a,0x89,0xf7,
+    0x5b,0xf0,0x01,0x28,0x9f,0x41,0xef,0x60,0x23,0xe8,
+    0x7d,0x58,0x67,0xfa,0x7b,0x29,0x80,0x42,0x33,0xf6,
+    0x77,0x4b,0x9c,0x31,0x32,0xad,0xff,0x39,0xaf,0xef,
+    0x2f,0xb7,0x5d,0x66,0xf4,0x98,0xf0,0x6d,0x7c,0x9e,
+    0xe4,0x31,0xde,0x60,0x80,0x86,0xcf,0xd3,0x32,0xbc,
+    0x15,0xdf,0x2e,0xe3,0x7c,0x83,0x31,0xab,0x47,0xa7,
+    0x59,0xfd,0x18,0x71,0xb4,0xae,0x60,0x23,0xf5,0xb4,
+    0x38,0x48,0x31,0xcc,0xd8,0x88,0xec,0x14,0xf9,0x6a,
+    0x04,0x59,0xdb,0x52,0x4a,0xfa,0x14,0xf2,0xe5,0x29,
+    0x8c,0xc9,0x9c,0xf6,0x1b,0xe4,0x32,0xc8,0x82,0x33,
+    0xd8,0x06,0x08,0x47,0x01,0x6f,0x74,0x81,0x01,0x6a,
+    0x95,0xdc,0x17,0xb8,0x6b,0x8c,0x52,0xe1,0x2d,0xcf,
+    0x6e,0xdb,0x49,0x5f,0x1b,0x3f,0x0e,0x27,0xcc,0xae,
+    0x9c,0x59,0xf7,0x85,0xfc,0x2c,0x7d,0xd8,0xaa,0xa2,
+    0xcb,0xf7,0xbf,0x8c,0x1f,0x21,0x37,0xf3,0xe9,0x71,
+    0x6b,0x29,0x3d,0x2a,0x37,0x88,0xfd,0xb7,0x89,0x01,
+    0x04,0xc0,0xa0,0x39,0xf4,0x06,0x75,0xb4,0x59,0xa1,
+    0x54,0x06,0x62,0x23,0x41,0x85,0x4e,0xda,0x8c,0x26,
+    0x23,0xee,0x9f,0x29,0x33,0x2e,0xd8,0x39,0x20,0xa3,
+    0x7e,0x24,0x96,0xf1,0xf2,0x69,0x50,0x9e,0xe1,0xee,
+    0xcf,0x30,0x7b,0x7a,0x68,0x95,0x0a,0x25,0xf6,0x00,
+    0x86,0x99,0x30,0x13,0xb8,0x00,0x83,0xaf,0x42,0x19,
+    0x18,0x13,0x83,0x17,0x6c,0x6e,0xce,0x1f,0x52,0x4e,
+    0xff,0x20,0x3e,0xd6,0xd9,0x38,0xf0,0xc1,0x82,0x85,
+    0x95,0x89,0xe5,0x31,0xa6,0x31,0x4b,0xe4,0x67,0xdf,
+    0x78,0xea,0xec,0x89,0x82,0x8d,0xb4,0xde,0x29,0x37,
+    0x03,0x1f,0x3f,0xdb,0xfe,0xf8,0xdc,0x35,0x81,0x21,
+    0xe3,0x4c,0x43,0x18,0xec,0x74,0x68,0xd7,0x79,0x80,
+    0xed,0x27,0xc2,0x56,0x29,0x3d,0x3c,0x01,0x83,0x42,
+    0x07,0x63,0x1e,0x06,0x95,0x2a,0xc0,0x00,0xda,0x26,
+    0xca,0xcc,0x12,0x12,0x96,0xa6,0x75,0x7b,0x7f,0x5d,
+    0xb4,0xfa,0x6d,0x7a,0xb0,0xba,0x69,0xf3,0xa2,0x95,
+    0x3b,0x1e,0x4f,0xcb,0x5c,0x9a,0x99,0x39,0xbb,0x2c,
+    0xb1,0x36,0x29,0x7e,0xec,0x7a,0xf9,0xd9,0xe3,0x1b,
+    0xe9,0xbf,0xb3,0x9c,0x06,0xbc,0xb9,0xfe,0xcd,0xab,
+    0xa6,0xaa,0xb1,0x2f,0xe3,0xb0,0x5d,0x79,0x53,0xa7,
+    0xe1,0x3e,0x6b,0x43,0x13,0x12,0xc6,0x8c,0x90,0x74,
+    0x5b,0x3f,0xf9,0xbb,0xd0,0x76,0xc6,0x47,0x50,0x6c,
+    0xbc,0xd7,0xb1,0x51,0x00,0x3e,0x18,0x94,0x98,0x34,
+    0x6d,0xdb,0x56,0x48,0x9d,0xf0,0xd7,0x0b,0x0a,0x9d,
+    0x14,0x69,0xf4,0x10,0xde,0x9d,0x0b,0x97,0xf4,0x2c,
+    0x59,0x60,0xeb,0xd7,0xe4,0x44,0xc3,0xa2,0x63,0x56,
+    0x57,0x91,0x87,0xc5,0x40,0xf7,0x25,0xe0,0x61,0x5f,
+    0xd6,0xcf,0x42,0x8c,0x91,0xf1,0x85,0x18,0x98,0xaa,
+    0xd2,0x71,0x62,0x95,0x81,0x1a,0x3d,0x59,0x49,0x8b,
+    0xfd,0xf2,0x2c,0xbb,0xde,0xfa,0xf8,0xa5,0x6d,0x39,
+    0x35,0x58,0xb9,0x6d,0x75,0x53,0x59,0x65,0x64,0x08,
+    0xfe,0x4d,0x9e,0x63,0xa5,0xda,0xcf,0xdf,0xbc,0x42,
+    0xef,0x98,0x6b,0xc6,0x7f,0x8e,0x33,0x77,0x7b,0x8f,
+    0x24,0xcb,0xc4,0x7e,0x2e,0x91,0xfa,0xd9,0x83,0xeb,
+    0x5e,0x36,0xce,0x0d,0xbe,0x44,0xad,0xd2,0x47,0x79,
+    0x79,0x00,0x54,0x22,0x18,0x63,0x62,0x50,0x80,0x2f,
+    0xd3,0x81,0xc0,0x1e,0x7c,0x68,0xd5,0x93,0xbb,0xd7,
+    0x3e,0xf9,0x2c,0x6e,0x4e,0x37,0xc6,0x66,0x3c,0xf2,
+    0x8c,0x8b,0x93,0xef,0x3c,0xdc,0xbb,0xf2,0xcc,0x82,
+    0x81,0xc3,0x56,0x97,0x54,0x0a,0x2b,0x7f,0xa7,0x13,
+    0x5b,0x70,0x1a,0x8e,0x15,0xf2,0xbc,0x0a,0xfb,0xd1,
+    0x43,0xf4,0xd4,0xf8,0xc9,0xf4,0xa7,0x63,0x3b,0xdb,
+    0x66,0x5e,0x3e,0xca,0xda,0x10,0x0b,0x08,0x6f,0x40,
+    0x1b,0x40,0x1e,0x35,0x26,0xbd,0x07,0xe8,0xb7,0x58,
+    0x72,0x90,0xc6,0x97,0xe1,0x77,0xe4,0x39,0xf9,0x96,
+    0x96,0x6d,0xf2,0x1c,0x51,0x0f,0xa5,0x02,0x4d,0x37,
+    0x81,0x26,0x2d,0xe8,0xc3,0x20,0x28,0x1b,0x1d,0xa3,
+    0xf3,0x62,0x62,0xe0,0xe9,0x05,0xe4,0xe9,0x02,0x4c,
+    0xa0,0x97,0x03,0x38,0x51,0xa0,0x81,0x4c,0x98,0xeb,
+    0x1f,0x53,0x74,0x60,0xa0,0x62,0xe6,0x0b,0x58,0x9d,
+    0x35,0xf9,0x56,0x95,0xa9,0xe6,0x35,0x7a,0xe9,0x54,
+    0xed,0x83,0x9f,0x10,0x54,0xfd,0x76,0x75,0xee,0xec,
+    0x8f,0x68,0x63,0xc4,0x03,0x9f,0x2d,0x3d,0x1f,0xb9,
+    0x40,0x36,0x6f,0xf3,0x1b,0xb9,0x39,0xdb,0xff,0x78,
+    0x78,0xec,0xd0,0x46,0x7a,0xfc,0xd2,0x87,0xbb,0x96,
+    0xbe,0x33,0x65,0x27,0x9e,0xf0,0xe0,0xca,0xaf,0xb6,
+    0x8e,0x6b,0x3a,0x6f,0x3d,0x66,0x69,0xdf,0xb2,0xfd,
+    0xa1,0x83,0x0f,0xeb,0xc7,0x73,0xde,0x58,0x80,0x8e,
+    0x77,0x81,0x0e,0x4f,0xb0,0x80,0x11,0x06,0x6d,0x18,
+    0xa3,0x73,0x57,0xab,0x80,0xeb,0x01,0x5c,0x5a,0xdc,
+    0x35,0x06,0xae,0x08,0x55,0x9e,0x4c,0x70,0x02,0xf0,
+    0xbc,0xd5,0xdb,0x9e,0xc7,0x61,0xdb,0x3f,0xff,0x34,
+    0x68,0x82,0xda,0x3c,0x75,0xfd,0x73,0xbd,0x80,0x3b,
+    0x43,0x4b,0x66,0x03,0x7b,0x4c,0x85,0x24,0xfc,0x36,
+    0x7e,0xa1,0x95,0xbe,0x49,0x3f,0xa2,0xe9,0x34,0xc5,
+    0xcd,0xa9,0xb0,0x2f,0x9e,0x80,0x87,0x8e,0x9f,0x2c,
+    0x8c,0x78,0x83,0x6e,0x3e,0xf6,0x3c,0xee,0xf5,0x6e,
+    0xb9,0x34,0x6f,0xb2,0x31,0x2b,0x1b,0x09,0x3c,0xea,
+    0x0d,0x33,0x81,0x38,0x6a,0x55,0x0e,0x83,0x97,0x05,
+    0xd9,0xc8,0x99,0x31,0x26,0xeb,0x34,0xfb,0x5c,0xcb,
+    0xf5,0x44,0x97,0x3a,0x1a,0x51,0x61,0xf0,0x3a,0x3b,
+    0x44,0xa5,0x21,0x56,0x9b,0x21,0xa9,0x0e,0xa6,0x8f,
+    0xb0,0x0f,0x69,0x91,0xad,0x60,0xfd,0xe1,0x4c,0x3c,
+    0xb0,0x09,0x93,0x16,0x6b,0x33,0xc9,0xb1,0x8e,0x22,
+    0x6f,0xca,0xf4,0xf4,0x00,0x3d,0x50,0x86,0x37,0x26,
+    0xf1,0x49,0x93,0x40,0xd9,0x0b,0xe4,0x8e,0x70,0x41,
+    0x9c,0xcf,0x99,0xa6,0x61,0xba,0x8b,0xdc,0xb1,0x26,
+    0x92,0x37,0x58,0x10,0x96,0x5a,0x28,0xd8,0xf0,0xd0,
+    0xc7,0x00,0xf3,0x8e,0x08,0x13,0x33,0x90,0xd8,0x04,
+    0x85,0x46,0x01,0xd0,0x66,0x72,0x3b,0x89,0x56,0x97,
+    0xe1,0x0c,0x9c,0x51,0x02,0xf0,0x0c,0xed,0xb7,0x88,
+    0x3b,0xf0,0xb6,0x1f,0xe3,0xad,0x26,0x86,0x89,0xb3,
+    0x42,0xa9,0x50,0x78,0xc0,0xfc,0x0b,0xdd,0x0b,0xff,
+    0xc4,0x71,0xae,0xf1,0x8d,0xe6,0xed,0x29,0x69,0x5f,
+    0x93,0x50,0x30,0x3c,0x3c,0x6d,0x70,0xec,0xd4,0x7e,
+    0x03,0x72,0x33,0x4d,0x13,0xc2,0x36,0x8f,0x7f,0x22,
+    0x44,0xbe,0x2c,0x6d,0xf7,0xf6,0x85,0xcf,0xae,0x9b,
+    0xb6,0xb2,0xc4,0xcf,0x58,0xb7,0x79,0xf2,0x83,0x13,
+    0x26,0x7c,0xdc,0x34,0xc8,0xa7,0xe5,0xf5,0x8b,0x76,
+    0xde,0xd4,0xb6,0xa7,0xcb,0x66,0xca,0xdf,0x86,0xf5,
+    0x48,0x32,0x9b,0xd1,0x88,0x3a,0xda,0xa4,0x72,0x87,
+    0xe1,0x03,0x03,0xc8,0xdd,0x43,0xc5,0xba,0x12,0x3a,
+    0x11,0x22,0x13,0x13,0x79,0xc1,0x43,0xcb,0x66,0xd6,
+    0x68,0x98,0xd5,0x00,0x3b,0xe0,0x27,0x1e,0x4c,0xdb,
+    0xc5,0x98,0x3d,0x58,0x3f,0x7b,0xa8,0x58,0x52,0x13,
+    0x40,0x52,0x7f,0xf8,0x63,0xc5,0xed,0xa7,0x04,0x61,
+    0xf5,0x95,0x39,0xd7,0x26,0xa6,0x11,0x67,0x75,0xda,
+    0xe8,0x9c,0x22,0xac,0xc8,0xce,0xd0,0x96,0x25,0x0e,
+    0x2f,0xd8,0x3b,0x8b,0x08,0x2b,0x3e,0xac,0xfd,0xf0,
+    0x95,0xc4,0xf9,0x01,0x25,0xa3,0xc7,0x65,0x54,0x84,
+    0x1a,0x9d,0x55,0x83,0x0e,0xe1,0x15,0xb8,0xc1,0x49,
+    0x09,0x6b,0x83,0x0d,0x97,0x5e,0xa7,0x2f,0x7d,0x46,
+    0x9d,0x2a,0xca,0xab,0x8b,0x5f,0xdf,0x83,0x2f,0x0f,
+    0xa2,0x86,0xf8,0xe6,0xf7,0x3f,0x93,0xc9,0x0e,0x63,
+    0xff,0x1d,0xef,0xd0,0x27,0xae,0xd3,0xd7,0xe8,0x63,
+    0x01,0x3e,0xf9,0xf1,0xb2,0x95,0xef,0x9f,0xa0,0x74,
+    0xf7,0x3e,0x1c,0xe9,0x64,0xf3,0x50,0x22,0x21,0x14,
+    0xc6,0x8f,0x92,0xcd,0x3e,0x7a,0x83,0xa0,0x17,0x40,
+    0x6b,0x6b,0x84,0x80,0x40,0x85,0x52,0x10,0x42,0x4b,
+    0x96,0xd1,0x27,0x97,0x96,0xe1,0xc2,0xd2,0xaa,0x65,
+    0x9e,0xce,0xce,0x9a,0x26,0xe2,0x6e,0xbd,0x29,0x3f,
+    0xdc,0xf6,0x26,0xd1,0x97,0x8f,0x99,0x36,0xc9,0xfa,
+    0xb5,0x38,0xb6,0x76,0xc0,0x25,0x0e,0x60,0xb8,0xc1,
+    0x3a,0x0f,0x46,0xbc,0x46,0xef,0xa0,0x04,0x0d,0x7a,
+    0x8d,0x9a,0xb7,0x3f,0xc0,0x20,0x40,0x42,0x0d,0xf1,
+    0x0e,0xdc,0xf7,0xc5,0x23,0x97,0x97,0x2c,0xd8,0xf7,
+    0x24,0xdd,0x5f,0x7c,0x64,0xe5,0xbc,0xfb,0x97,0x1c,
+    0xbe,0xf6,0xfb,0xda,0x65,0xf2,0xc3,0x2f,0xbf,0x40,
+    0x2f,0x85,0x38,0xf5,0x7f,0xe1,0xf1,0x53,0x5f,0xca,
+    0xf3,0xac,0xe7,0x1f,0x7d,0x72,0xf1,0x03,0xd6,0x39,
+    0xd6,0xd5,0x38,0x75,0xc3,0x93,0x5c,0xb6,0x6a,0xc1,
+    0x96,0x08,0x96,0x9f,0x83,0x11,0x6c,0xe7,0xba,0x31,
+    0x0a,0xcc,0x2c,0xa6,0x5d,0xb4,0x9c,0xab,0xa0,0x66,
+    0x3d,0x98,0xb2,0x31,0x7f,0xd8,0xf2,0xd7,0xa5,0x15,
+    0xa5,0xa1,0x59,0xb3,0x76,0x9f,0x78,0x6f,0x17,0x11,
+    0xea,0xb2,0x32,0x96,0x0a,0x5a,0xfc,0x28,0xce,0x52,
+    0xc8,0x71,0x01,0x5e,0x37,0x22,0x3b,0x86,0xee,0xa2,
+    0x67,0x14,0x72,0xfa,0x25,0xdd,0x16,0x9c,0x1b,0x2a,
+    0xf2,0x82,0xb5,0x63,0x0e,0xe7,0x45,0x1f,0xde,0x0a,
+    0x18,0x98,0x7a,0x46,0xbe,0x8e,0x0d,0xd0,0x1d,0xd8,
+    0xe5,0x9b,0xeb,0x34,0x9c,0xb6,0x15,0x6f,0xc3,0x75,
+    0xaf,0xbe,0x2c,0x3f,0x4c,0x37,0xd2,0x1d,0x56,0x2f,
+    0x79,0x5e,0x0b,0x25,0xab,0x71,0x0c,0x4e,0x14,0x75,
+    0x2a,0xc0,0x20,0x07,0x24,0xdb,0x01,0xe4,0xd9,0x43,
+    0x0a,0xe4,0x00,0x4c,0xc1,0x5b,0x68,0x05,0xde,0x6f,
+    0xbd,0x09,0x32,0x9a,0x63,0xbd,0x98,0x6f,0x5d,0x97,
+    0xcf,0x27,0x46,0xb1,0xce,0x21,0x48,0x3b,0xdb,0xeb,
+    0x80,0x3e,0x27,0x87,0x68,0x06,0xde,0x4a,0xcb,0x8a,
+    0x89,0x16,0x8a,0x3f,0x5a,0x60,0x6d,0x80,0x12,0x22,
+    0x0f,0xde,0x06,0x19,0xf7,0x82,0xb2,0x6a,0x68,0x2a,
+    0x2c,0xb4,0x6d,0x3c,0x60,0x0c,0x30,0xab,0x0d,0x26,
+    0xe1,0xed,0xe6,0x83,0xbf,0xc1,0xf0,0x55,0xdd,0x79,
+    0x6e,0x43,0xf8,0xea,0x65,0x1f,0x7c,0xfa,0xe9,0xa9,
+    0xb5,0xc5,0x57,0xc8,0x35,0x6b,0xfa,0x28,0x98,0x48,
+    0xdf,0xc5,0xab,0xf2,0xb3,0x73,0xe8,0x7e,0xeb,0x72,
+    0xda,0xec,0x4f,0xb4,0xf9,0x22,0x7e,0xa1,0x58,0xa4,
+    0x19,0xe6,0x52,0x86,0xdd,0x08,0x57,0xa3,0x50,0x5c,
+    0x4c,0x49,0x71,0x31,0xa6,0xc5,0xe4,0xbc,0x35,0x52,
+    0x7e,0xd8,0x3a,0x8f,0xac,0xb6,0xd1,0x8b,0x89,0x38,
+    0xc7,0x43,0x79,0x23,0x86,0x42,0x8c,0xb6,0xf6,0xdd,
+    0x74,0x1d,0xba,0x03,0x29,0x98,0x5e,0x34,0x6a,0xa6,
+    0x30,0x40,0xa5,0x41,0xd7,0xab,0xef,0xd4,0x55,0x27,
+    0x45,0x1a,0xef,0x03,0x73,0xbc,0xc5,0xf8,0xc2,0x4b,
+    0xfd,0xf2,0xb4,0x73,0xee,0x97,0x9f,0x97,0xf0,0xc6,
+    0x8a,0xe5,0x19,0x1c,0x30,0x85,0x8d,0x18,0x14,0xb8,
+    0x92,0x01,0x34,0xe2,0xa6,0x59,0x74,0x3d,0x7e,0xa8,
+    0x86,0x36,0xcf,0x06,0x89,0x6b,0x29,0x24,0xbb,0xad,
+    0x4d,0x6d,0xe7,0xc8,0xe5,0xc7,0x3a,0xf8,0xbc,0x1d,
+    0xea,0xca,0xc1,0x8e,0x61,0x1c,0x03,0x2a,0xf0,0x36,
+    0x20,0x37,0x9f,0x33,0x95,0xdf,0x97,0x7d,0x02,0x49,
+    0x2f,0xc9,0x3e,0x30,0x00,0x60,0x83,0xa7,0x07,0x6b,
+    0x1b,0xf6,0xf4,0x32,0x82,0xd9,0x63,0x94,0x7d,0x52,
+    0xec,0xe2,0x44,0x9b,0x6a,0xe9,0x22,0x27,0x97,0xfc,
+    0xf5,0x38,0x35,0xc4,0xcd,0xc9,0x35,0x0a,0x27,0x6f,
+    0x92,0xe9,0x53,0xdf,0x6b,0x39,0x2f,0x37,0xbe,0x37,
+    0xba,0x15,0x66,0xc7,0xd6,0x9d,0x8f,0x56,0x58,0x9a,
+    0x65,0x85,0x12,0xbd,0xcc,0xb6,0xe9,0xc3,0x60,0xda,
+    0xa1,0x19,0x03,0x4c,0xc0,0xab,0x9d,0x4d,0xd6,0x4b,
+    0x4e,0xae,0x85,0x4b,0x89,0xbf,0xc2,0xa9,0x50,0xee,
+    0xb3,0xba,0xa9,0xf5,0x47,0x68,0xee,0xad,0x7d,0x25,
+    0x02,0x95,0x74,0xc6,0x0d,0xe1,0x68,0x87,0xed,0x03,
+    0xb3,0x0e,0xd1,0xc1,0x9c,0x88,0xe0,0xaa,0x72,0xd7,
+    0xb9,0x13,0xaf,0x73,0x33,0xab,0x2e,0xd3,0x19,0x17,
+    0xc9,0xf7,0x3b,0xe8,0xc9,0x9d,0xcf,0xe0,0x61,0x3b,
+    0xe5,0x67,0x4f,0x9e,0xb0,0x86,0xd0,0x45,0x78,0x35,
+    0x9e,0x49,0x6e,0xd0,0x29,0x78,0x1c,0x3d,0x68,0x9d,
+    0x4f,0x0f,0xe0,0x71,0x36,0x59,0x95,0x71,0x99,0x01,
+    0x78,0x1a,0x23,0x9f,0x64,0xc1,0x0e,0xe0,0x83,0x0d,
+    0xe6,0xee,0x1d,0xef,0x7d,0xf6,0xce,0xb9,0x73,0x15,
+    0xc5,0xc5,0xc5,0x7b,0x1f,0xd9,0x08,0x7c,0x3a,0x43,
+    0x53,0x3e,0xb3,0xee,0x82,0x51,0x95,0xbb,0x13,0x57,
+    0x3e,0xc1,0xe8,0xa1,0xbb,0x38,0x3d,0x7d,0x18,0x87,
+    0x34,0x4c,0x51,0x79,0x82,0x94,0x83,0x21,0x2e,0x28,
+    0x7d,0x89,0x8d,0xaa,0x5a,0xdc,0x0c,0x64,0xad,0x5d,
+    0x71,0xb1,0xe9,0x68,0xd4,0x47,0x0e,0xa4,0x91,0xaf,
+    0xc9,0x8d,0x93,0x27,0xe8,0x66,0xfa,0x15,0x5d,0x3b,
+    0x82,0x6e,0xc5,0xe9,0x32,0xbc,0x9a,0xbc,0xe8,0x40,
+    0x20,0xb1,0xeb,0x84,0xde,0x60,0x05,0x70,0xfa,0x98,
+    0x2e,0x66,0x7d,0xe0,0x48,0xe3,0xa7,0xef,0xd5,0x2e,
+    0xc6,0xbe,0x35,0xf4,0xb7,0xa3,0xc5,0xc5,0xab,0x1f,
+    0x5c,0xb7,0xe1,0x29,0xb0,0xab,0xcf,0x6e,0x7b,0x3b,
+    0xc2,0x3a,0x93,0x2c,0xb5,0x2e,0x93,0x67,0x5b,0x97,
+    0x3f,0x8b,0x93,0x37,0xf2,0xfe,0xce,0x86,0x79,0xf3,
+    0x02,0xd0,0x0b,0xb6,0x8f,0x7f,0x14,0x5b,0x38,0x85,
+    0x11,0xa6,0x53,0xb9,0xd6,0x05,0xf1,0xe7,0x13,0xb7,
+    0x27,0xb7,0xeb,0xb8,0xd8,0x79,0xe2,0xda,0xba,0x47,
+    0xca,0xd7,0xd5,0xd7,0xc6,0x9c,0x5c,0x43,0x84,0xad,
+    0x35,0x01,0xb5,0x5f,0xaf,0x9c,0xf1,0xf0,0xa3,0xab,
+    0x4b,0x4a,0x1f,0x7f,0x69,0xe6,0xd0,0x2d,0x69,0x7b,
+    0xda,0xd6,0xa5,0x0c,0x9b,0xb9,0xb6,0x44,0xa1,0xd8,
+    0xfc,0xe1,0xf0,0xfc,0xd8,0x8d,0xff,0x7d,0x30,0x2d,
+    0xf5,0xed,0x7f,0x1d,0xaa,0xab,0x35,0xce,0xf4,0xd6,
+    0x33,0x7c,0xa0,0x0d,0xc9,0x61,0xae,0x0b,0xd8,0x98,
+    0xe4,0x56,0x35,0x39,0x4c,0xaf,0x14,0xd3,0x2b,0xa4,
+    0x59,0x9e,0xd3,0x02,0x21,0x9f,0xd3,0xb5,0x11,0xfa,
+    0xb5,0x50,0x94,0x09,0x0c,0xea,0xc2,0x97,0x09,0x83,
+    0x9a,0x5b,0x0f,0x6a,0xa1,0x90,0x6e,0x7f,0xf9,0xe8,
+    0x8c,0xd5,0xd6,0xfb,0x41,0x80,0xfd,0xa9,0xba,0xfd,
+    0x96,0xf0,0x45,0x5b,0xbf,0x37,0xde,0x7b,0xf7,0x84,
+    0xf0,0xad,0xcd,0x7f,0x26,0xf8,0xd8,0xc6,0x1d,0x68,
+    0x5d,0x4f,0xb0,0x3d,0x40,0x2e,0xf1,0xe9,0x6a,0xda,
+    0x5c,0x76,0x73,0x80,0xc6,0xd9,0xa3,0x37,0xee,0x5d,
+    0x0a,0x22,0xd8,0x56,0x37,0x77,0xd2,0x63,0x71,0xb2,
+    0x6a,0xa8,0x03,0xf6,0xae,0xbc,0x42,0xb4,0xd9,0x40,
+    0x5b,0x07,0x04,0x2a,0xb9,0xbe,0x66,0x15,0x35,0x2c,
+    0xe2,0xb1,0x2c,0x72,0xde,0xd7,0xca,0x81,0xfe,0x5f,
+    0x34,0xd2,0x77,0xca,0x3f,0x8c,0xec,0xed,0x69,0x38,
+    0x57,0xfb,0x81,0xaf,0xab,0xcb,0xc0,0x41,0x17,0x4b,
+    0x64,0x29,0xba,0xf3,0xbf,0xb6,0x1e,0x01,0x82,0xd4,
+    0x34,0xf7,0xa9,0x57,0x84,0x3f,0xda,0xd4,0x07,0xa7,
+    0xa5,0x5d,0x58,0x29,0xfc,0x06,0xb0,0xb5,0x52,0x9b,
+    0x99,0xee,0x82,0xa5,0x35,0x40,0x06,0xd0,0x1a,0x23,
+    0x3e,0x84,0x49,0xd9,0x17,0x74,0x06,0x8e,0xa2,0x7f,
+    0x95,0x5f,0xfe,0xa4,0x84,0xfc,0x6e,0x75,0x23,0x3b,
+    0xac,0x85,0x82,0x13,0xd9,0x67,0xdd,0x41,0x0a,0x6d,
+    0x6d,0x21,0xfb,0xa0,0xae,0x13,0x1f,0x6f,0x62,0x3d,
+    0xbc,0xb2,0x98,0x7e,0x51,0x71,0xeb,0x66,0x05,0xbd,
+    0x4c,0xe2,0x84,0x45,0xd6,0xde,0xe4,0x8f,0xb6,0x15,
+    0x92,0xcd,0x96,0x2b,0xea,0x3b,0x7f,0x66,0x81,0xeb,
+    0x99,0xe1,0x46,0x72,0xad,0x5f,0xe3,0x66,0x9a,0x4f,
+    0xfa,0x50,0x4b,0x7e,0x7e,0x8e,0x8c,0x16,0xe6,0xb6,
+    0x12,0x71,0xac,0xef,0xa3,0xc7,0x48,0x9c,0xbd,0x2f,
+    0x44,0x7d,0x1a,0x47,0x2f,0xe0,0x70,0xda,0x80,0xd7,
+    0xca,0xf3,0xfe,0x7a,0x7d,0x9a,0xa2,0xa5,0xcb,0xda,
+    0x83,0xf1,0x93,0xec,0x2c,0xb5,0xde,0x2e,0x94,0x74,
+    0x6c,0x1a,0xac,0xcd,0x2e,0xd9,0x60,0x88,0x96,0x06,
+    0xbe,0x04,0xf5,0xc3,0x01,0xce,0x5a,0x7a,0x6c,0x9a,
+    0x22,0x39,0x97,0x97,0xf3,0x27,0xb7,0x05,0x37,0xf9,
+    0x21,0x6e,0x6b,0x18,0x98,0x36,0x32,0x0a,0x6e,0x65,
+    0xf4,0x77,0xfa,0x5b,0x09,0xb6,0x24,0x92,0xdb,0x24,
+    0xc3,0x7a,0x80,0x1c,0x07,0x5d,0xd7,0x46,0x6f,0x0b,
+    0x19,0xed,0xa9,0xb6,0x35,0x92,0x90,0xd1,0xb6,0x4f,
+    0xb0,0xd0,0xdb,0x16,0xc6,0xba,0x03,0xb2,0xcb,0xe4,
+    0xa6,0x42,0xcf,0xf5,0xb9,0x11,0x3a,0xd5,0xc3,0x10,
+    0x10,0x10,0x88,0x0f,0x34,0x0d,0x9a,0x39,0x34,0x62,
+    0x64,0xb3,0xbf,0x42,0x9f,0xb8,0x27,0xc5,0xc3,0xf8,
+    0x66,0x32,0xb7,0xb3,0x40,0xae,0x97,0xcb,0x2c,0xa2,
+    0x3d,0xa8,0x89,0xd1,0x31,0xa5,0x02,0xe6,0x03,0x08,
+    0x31,0x98,0x86,0x66,0x33,0xcc,0x9b,0xbe,0x4a,0x41,
+    0xcb,0x17,0xe7,0x26,0xa5,0x6c,0x6b,0x1d,0x96,0xcd,
+    0xc9,0x70,0x95,0x65,0x6c,0x9f,0x95,0x90,0x70,0xb4,
+    0x79,0xce,0xf8,0x43,0x45,0x6a,0x4b,0x5a,0xd9,0xec,
+    0xd9,0x94,0xca,0x5c,0x53,0xf6,0x9c,0xb6,0x0e,0xda,
+    0xb2,0x37,0x6b,0x32,0x0e,0x7e,0xc5,0x49,0x91,0xfb,
+    0xf8,0xbf,0xe2,0xad,0x85,0x0d,0xb3,0xcf,0xbc,0x3a,
+    0x5b,0xd1,0x5b,0x9c,0xdf,0xd6,0x83,0xac,0xfa,0xc0,
+    0x3a,0x53,0x0d,0xab,0x71,0x84,0x75,0x92,0xd9,0x69,
+    0x50,0x32,0xdd,0xab,0x34,0xc6,0x08,0xdc,0x18,0x51,
+    0xc1,0x58,0xc2,0xd7,0xf0,0x88,0xed,0x8f,0x4d,0x58,
+    0x3a,0xd8,0xa9,0x77,0x46,0x81,0xcc,0x29,0x3b,0xf7,
+    0x3f,0xb5,0x55,0xb3,0xfe,0x53,0x27,0xcb,0xb4,0x5e,
+    0xa0,0x37,0xe8,0xd7,0x53,0x26,0x6d,0x52,0x68,0xe9,
+    0xa0,0xe5,0x3b,0xad,0x17,0xfa,0xd1,0x61,0xbf,0xe0,
+    0x6f,0xae,0x7f,0xc9,0x79,0x57,0x08,0x6d,0xb1,0x40,
+    0x5b,0xdc,0xf9,0xfc,0x6c,0x9f,0x9c,0x55,0x7c,0x56,
+    0x56,0xe0,0xe6,0x9d,0xbb,0x9b,0x77,0x96,0x26,0xfa,
+    0x8f,0x8e,0xfd,0xed,0xb7,0x94,0x2c,0x9f,0x42,0x2d,
+    0x1e,0x40,0x82,0xb1,0xaf,0x7f,0x96,0x4f,0x5b,0x9a,
+    0x2e,0x53,0xed,0xc1,0x69,0xcc,0x07,0x18,0x37,0x6c,
+    0x34,0xea,0x39,0x2b,0x80,0x50,0x00,0x05,0x4a,0x3b,
+    0x10,0xf4,0x2c,0x63,0x08,0xb7,0x8e,0xc9,0x8d,0x0c,
+    0x27,0xe7,0x89,0x3b,0xe9,0xa9,0xa7,0x1e,0x1f,0xbb,
+    0x3c,0xd0,0x49,0x56,0x50,0x30,0xf7,0xd7,0xca,0xaa,
+    0x1f,0x16,0x6e,0xd9,0x4b,0x22,0xc1,0x4a,0xd4,0x65,
+    0xa5,0x2d,0xc0,0x3f,0xb6,0x9e,0x1d,0xf1,0xdf,0x1f,
+    0x7e,0xa3,0x7e,0x37,0x3f,0x65,0xb0,0x19,0x7d,0x27,
+    0x81,0x3e,0x35,0xd3,0x79,0x72,0xc6,0x61,0x80,0xeb,
+    0xee,0xe1,0xa1,0x77,0xd7,0x33,0x0a,0x35,0xcc,0x3c,
+    0x14,0xf0,0xe9,0xbd,0xd3,0xf3,0x9e,0x7d,0x62,0xe5,
+    0x36,0x2b,0x95,0x61,0x59,0x79,0x5d,0xc5,0x90,0xea,
+    0xe9,0xa7,0x34,0xda,0x0d,0x8f,0x92,0x01,0xd8,0xbf,
+    0x1d,0x7d,0x91,0x43,0x03,0x13,0xf3,0x46,0x91,0xd5,
+    0x07,0x3f,0xa5,0x0b,0xc4,0x31,0x83,0xef,0x28,0x7c,
+    0xb8,0x96,0x63,0xda,0x88,0xb5,0x58,0xa1,0x50,0x7a,
+    0x88,0xab,0x32,0x83,0xc9,0xbc,0xbd,0x78,0xc1,0x98,
+    0xa1,0x7a,0x63,0x68,0x6a,0x24,0xd9,0xb3,0x27,0xff,
+    0x5f,0xff,0x92,0x6d,0x3d,0x7f,0xb8,0x5f,0x4e,0x3f,
+    0xa1,0xe9,0xa5,0x69,0x59,0x6d,0x5e,0xc2,0xf5,0x98,
+    0x60,0x6e,0x43,0x19,0xa8,0x96,0x7c,0x01,0xb4,0x05,
+    0xa1,0x48,0x14,0x0f,0xe3,0x42,0xd4,0x98,0xcc,0x88,
+    0x8c,0x36,0x8b,0xab,0x93,0x00,0xae,0xed,0xbc,0x8c,
+    0x1e,0x4a,0xd1,0xb0,0x62,0x2e,0x13,0xad,0xa7,0x7b,
+    0x80,0xe8,0xbb,0x51,0x0b,0x06,0xa6,0x03,0x45,0x53,
+    0x0b,0x97,0x25,0x6d,0x78,0xea,0xd2,0xfe,0x8d,0xdb,
+    0x2f,0xd5,0x0e,0x1f,0x65,0xc9,0xde,0xb0,0x34,0x31,
+    0xfc,0x87,0x47,0x07,0x05,0xae,0x9b,0xd3,0xd7,0x23,
+    0xda,0x98,0xfa,0x67,0xee,0x0b,0x79,0x85,0x93,0xf6,
+    0x35,0xa4,0x14,0x2f,0xab,0x9e,0xb9,0x72,0xdb,0xac,
+    0xf5,0x9b,0xd7,0x3e,0x75,0xf4,0xb1,0x35,0x1f,0x4d,
+    0x8c,0x98,0x19,0x96,0x1e,0x11,0xd0,0x3c,0xe7,0xc5,
+    0xf7,0x3c,0x12,0xd5,0x01,0x8f,0x64,0x3c,0x75,0x92,
+    0xf8,0x27,0xe6,0x44,0x93,0x2f,0x37,0x3f,0x41,0x6f,
+    0xad,0xc1,0x7d,0xad,0x99,0xab,0x2e,0xd7,0xaf,0x59,
+    0x38,0x63,0x26,0xb4,0x7b,0x3d,0x5b,0x4f,0x43,0x3f,
+    0x79,0xf1,0xb9,0x1e,0xa4,0xc7,0xcc,0xd7,0x8f,0xd0,
+    0x66,0x6e,0x64,0xb3,0xc4,0x2d,0x99,0x93,0x0e,0x56,
+    0xac,0x2b,0xe7,0xe5,0xa7,0xe7,0x34,0x36,0x14,0x80,
+    0xc8,0x28,0xd3,0x82,0x2d,0x21,0xa1,0xfb,0x0f,0x5b,
+    0xb5,0xe4,0xc6,0x86,0xc5,0xe7,0x2f,0x5b,0xf7,0x01,
+    0x04,0x82,0x96,0x33,0xe1,0x91,0xbf,0xcf,0xfd,0x55,
+    0xdc,0x53,0xa5,0x65,0x3e,0x29,0x90,0xca,0xe5,0x7e,
+    0xb1,0x3a,0xdd,0x50,0xff,0xea,0x82,0x02,0xf9,0x26,
+    0x63,0x54,0x8e,0x31,0xba,0xe5,0x2d,0x59,0x3c,0x97,
+    0x65,0x18,0x7f,0x5a,0xa9,0x8e,0x87,0x43,0x1d,0x9b,
+    0xd5,0xc1,0xd8,0xa0,0xb6,0xd5,0xce,0x9e,0x16,0xdc,
+    0xdf,0x47,0x17,0x16,0x24,0xc1,0xa0,0xd6,0x96,0x96,
+    0xc7,0x1e,0x56,0xe7,0xaa,0xa6,0x16,0xc9,0xb5,0x5c,
+    0x6e,0x59,0x5b,0x8e,0x88,0xfe,0x17,0xa3,0x38,0x16,
+    0x40,0x0b,0x0b,0xa0,0x01,0x95,0xb7,0x0a,0x0a,0x94,
+    0xce,0xf1,0xd8,0xb5,0xbc,0x05,0xab,0x4a,0x6e,0xcc,
+    0x57,0x68,0xdb,0x5e,0x3f,0x5c,0x83,0x0f,0xd3,0xd9,
+    0x56,0x0b,0xc9,0xde,0x2e,0xd5,0x45,0xb7,0xa0,0xae,
+    0x20,0xd6,0x85,0x0a,0x0a,0xad,0x94,0x2f,0x5b,0x0d,
+    0xfd,0xa9,0xe3,0xb3,0x7d,0x8c,0x8d,0x39,0x2a,0x89,
+    0x37,0x76,0x26,0x19,0xc1,0x16,0xc1,0xe7,0xf7,0x84,
+    0x07,0xd6,0x4f,0x5b,0x54,0x9f,0xbf,0xa3,0x6a,0x46,
+    0x7e,0x86,0x65,0xd6,0x8c,0x82,0x4c,0x27,0xe7,0x04,
+    0x99,0xe5,0x58,0x49,0xce,0xf1,0xf3,0xd6,0x38,0xf2,
+    0x2d,0x56,0xbf,0x7e,0xdc,0xba,0x82,0x7c,0xfb,0xaf,
+    0x95,0x27,0xaf,0x58,0xf7,0xca,0xe2,0x37,0xef,0xb5,
+    0xd1,0x7d,0x19,0x70,0x68,0x44,0xbf,0x83,0x03,0x78,
+    0x06,0x35,0x06,0x5f,0xb9,0x6f,0x71,0xfe,0x8e,0x85,
+    0xb3,0x19,0x30,0xfd,0x7d,0x32,0xcb,0x0b,0xaf,0x59,
+    0xdd,0xc9,0x0d,0xec,0x76,0xe6,0x4b,0x0e,0x22,0x33,
+    0xcf,0x36,0xde,0xfe,0x04,0x18,0x4e,0xec,0xc4,0x86,
+    0xe8,0x93,0x21,0xcc,0x25,0xc3,0x57,0x26,0x2a,0xbc,
+    0x67,0xdb,0xbe,0x17,0xe9,0x5b,0xcf,0xe3,0xb4,0xf9,
+    0xb5,0x3f,0x5e,0x97,0x59,0xe8,0xe7,0xd6,0x6f,0xe9,
+    0x15,0xd0,0x8a,0xee,0x24,0x32,0xf7,0xfa,0x4d,0xea,
+    0x2f,0x30,0x3f,0xee,0x7a,0xaa,0x15,0x7c,0xf8,0xb8,
+    0x1f,0xe8,0xa8,0x57,0xbc,0x6c,0x84,0xc0,0x12,0xc8,
+    0xb3,0x43,0xb1,0x3c,0xf9,0xa8,0x65,0xa5,0xc1,0x59,
+    0x59,0x90,0xe1,0xe2,0x1c,0xd4,0xf4,0xdc,0xdc,0xeb,
+    0xd5,0x95,0xb7,0x1a,0x64,0x16,0xeb,0x79,0x7a,0x8b,
+    0x7e,0x31,0x6d,0xc2,0x3c,0xeb,0x7f,0x15,0xc1,0x8f,
+    0x59,0x72,0xac,0x7f,0xfa,0xfc,0x75,0xe3,0x67,0xfc,
+    0xc3,0x0f,0x9f,0x88,0xba,0x2b,0x1f,0xc6,0xc7,0x0d,
+    0xc0,0xa1,0x62,0x1e,0x1c,0x7f,0x51,0x29,0xe8,0xbc,
+    0x8c,0x66,0x23,0x63,0xa6,0xd9,0x41,0x2d,0xac,0x9d,
+    0xbc,0x9d,0x9e,0x7a,0x16,0x47,0x5b,0x9c,0xfa,0xa4,
+    0x17,0x38,0x3b,0x83,0x52,0xa8,0xfe,0x61,0xc1,0xf6,
+    0x03,0xa0,0x14,0xfa,0xe3,0x01,0xbb,0xd7,0xff,0x75,
+    0x09,0x5f,0x4c,0xac,0xc7,0x19,0x91,0x4c,0x2f,0xf4,
+    0xbf,0xf6,0xb9,0x8d,0x8f,0x83,0x00,0xb6,0x96,0xf7,
+    0x95,0x52,0x5c,0xa6,0x29,0x3c,0xb4,0xf6,0xfe,0x39,
+    0x1e,0x15,0xea,0xe5,0x17,0x20,0x10,0xe3,0x74,0x33,
+    0x90,0xad,0x4c,0x97,0x59,0xdc,0x0a,0xfa,0xcc,0x7e,
+    0xbf,0x41,0x26,0xb3,0xbe,0x2d,0x8b,0x3f,0xfe,0x09,
+    0x9b,0x5f,0x80,0x8f,0xf1,0x00,0xc3,0x87,0xdb,0x27,
+    0xa6,0xe8,0x30,0x20,0x29,0x46,0xb2,0x4c,0xbc,0x3c,
+    0xbd,0x44,0x37,0x03,0x37,0x4c,0x82,0xb3,0x0a,0xc7,
+    0x5c,0x98,0x30,0xe4,0xa9,0xd6,0xa9,0x91,0x96,0xfd,
+    0x25,0xbe,0xbe,0x35,0xb3,0x82,0x32,0xd7,0xd3,0xff,
+    0x4c,0xf4,0x5f,0x98,0x52,0x3d,0x7d,0x4c,0xd9,0x0a,
+    0x4b,0xf9,0xd8,0x39,0x8f,0x8f,0x98,0x64,0x9e,0xf1,
+    0x78,0x64,0x44,0x72,0xca,0xe0,0x6c,0x7a,0x7b,0x6b,
+    0x7c,0xad,0x7f,0x28,0xe0,0x08,0x69,0xbf,0x81,0x77,
+    0xcb,0x47,0x32,0x3a,0x35,0x4c,0xbf,0xb0,0xe1,0xce,
+    0xd7,0x3b,0x26,0xa6,0x68,0x34,0xc6,0x1b,0x7b,0xf7,
+    0x46,0x0c,0x1f,0xe2,0x1b,0x9a,0xd4,0x5c,0x5c,0xe8,
+    0x33,0x5a,0x16,0x9f,0x65,0xed,0x57,0x93,0xe9,0x9a,
+    0xa9,0x6d,0x15,0xc8,0xd0,0x81,0x58,0x3c,0x8d,0xb2,
+    0x16,0xe8,0xbc,0x08,0x83,0xc8,0x43,0xd2,0xae,0x7c,
+    0xa6,0x11,0x6d,0x16,0x3e,0x68,0x8c,0xe4,0x62,0xa6,
+    0xab,0x93,0x61,0x51,0xda,0xf2,0xf8,0xe1,0x05,0xe9,
+    0x13,0x17,0xd7,0xe7,0x6f,0xb1,0xe4,0x4e,0x9f,0xfe,
+    0x09,0x39,0x65,0x1d,0xbe,0xe3,0xb1,0xf7,0xae,0x90,
+    0x2c,0x71,0x4e,0x76,0x61,0x3b,0xe9,0x00,0xc7,0x6e,
+    0xbb,0xb0,0x8e,0x86,0x39,0x7f,0xd1,0xec,0x76,0x54,
+    0xb8,0x73,0x60,0x7f,0x27,0x67,0xdd,0xfe,0x42,0x59,
+    0xbc,0x35,0x65,0xc1,0xba,0x84,0xad,0xe4,0x27,0x5e,
+    0x07,0xe8,0x96,0x65,0x42,0x9d,0xfe,0xdc,0x76,0x09,
+    0x84,0x99,0x07,0xac,0x17,0x81,0x99,0x0a,0xa2,0xf5,
+    0xa2,0xe1,0x20,0x84,0xbc,0xba,0x4d,0x32,0x1f,0xe2,
+    0xe6,0xf5,0xc4,0xec,0x1b,0x05,0x2b,0x47,0x2a,0x34,
+    0x81,0x2b,0x4b,0x56,0xa9,0x82,0x15,0x64,0xc8,0xe3,
+    0xf9,0xe4,0x6b,0xf5,0x5b,0x93,0x17,0x5b,0xf5,0x00,
+    0x78,0x15,0x3d,0xfc,0xd8,0xab,0x64,0xae,0x75,0xd5,
+    0x18,0x6a,0x1d,0x70,0x8d,0xbc,0x03,0xf0,0x0d,0x40,
+    0xd3,0x32,0x91,0x26,0xac,0xe1,0xf6,0x0b,0x07,0x8e,
+    0x97,0xd3,0x92,0xb3,0xe7,0x8a,0x31,0xb9,0x59,0x7e,
+    0xf8,0xf8,0x0c,0x12,0x68,0xbd,0x8c,0x2f,0xd2,0x10,
+    0x62,0x24,0x2e,0x34,0x15,0x1f,0x81,0xb9,0x9c,0x82,
+    0x6c,0xb1,0xb6,0x78,0x02,0x5f,0x25,0xed,0x61,0x36,
+    0x4b,0x6d,0x02,0xc2,0xb0,0x42,0x91,0xe5,0x1f,0x39,
+    0xd8,0x2f,0x2e,0x65,0x60,0x04,0xfd,0x4f,0xe1,0x2e,
+    0xef,0xfe,0x4e,0x1e,0xba,0x1d,0x85,0xf4,0xa4,0x5f,
+    0x3d,0xd5,0xaa,0xb3,0xdd,0x4a,0x1b,0x8f,0xc9,0xe2,
+    0xac,0xd3,0x96,0x6d,0x58,0xf7,0x20,0x79,0xa6,0xe5,
+    0xf6,0xc6,0x35,0xdc,0x0f,0x02,0x97,0x9b,0x00,0xb3,
+    0x93,0x8d,0x83,0x6f,0xd2,0xf1,0x38,0x81,0x5e,0xc4,
+    0xeb,0xe8,0xdb,0x59,0x59,0xe9,0xc2,0x93,0x59,0xe3,
+    0xdb,0x4a,0x44,0x7e,0x56,0x83,0x8d,0xb3,0x00,0xec,
+    0x13,0x66,0x7c,0xaa,0xd9,0x9e,0x01,0x28,0x79,0xe8,
+    0x13,0x2f,0x0f,0xd0,0xfb,0xa0,0x2d,0x02,0x0c,0xa6,
+    0x28,0x33,0x74,0x4f,0x74,0x0c,0x9f,0x4a,0xb7,0x4f,
+    0xab,0x98,0x39,0x75,0x56,0xdd,0xe6,0xe7,0x02,0xa6,
+    0x4e,0xd8,0x10,0xa4,0x6d,0xde,0x54,0x37,0x4b,0xb6,
+    0x88,0x9e,0x5a,0xd8,0xa8,0x75,0xd2,0xcc,0x9b,0x4f,
+    0x4f,0xcf,0x6b,0x20,0x99,0xb2,0xe7,0x37,0xe2,0xc4,
+    0x9c,0xec,0xc1,0xc9,0x96,0xd0,0x1c,0x9c,0xb4,0xb1,
+    0x59,0x96,0x49,0xea,0x39,0x2e,0x3c,0x13,0x74,0xe7,
+    0xfb,0xa2,0xce,0xc2,0x6c,0x05,0xf3,0x7e,0x41,0x01,
+    0xd5,0x3a,0x21,0x9b,0xef,0x9b,0xb0,0x35,0xb0,0x2f,
+    0xa7,0x03,0xc4,0xd6,0xe8,0xe1,0xab,0x04,0x9d,0x02,
+    0x24,0x99,0x62,0x44,0x02,0x4c,0x22,0x49,0x5c,0x98,
+    0x77,0x07,0x86,0x86,0x8d,0xdf,0x18,0xa4,0x7d,0x6e,
+    0x73,0x5d,0x55,0x6e,0x45,0x59,0x5e,0x55,0xdd,0xa6,
+    0x66,0xd9,0x3c,0x7a,0x2c,0x67,0xb2,0xa7,0x36,0x79,
+    0x52,0x48,0x2e,0x7d,0x63,0xe3,0xf3,0x80,0xb8,0x61,
+    0x1e,0x8e,0x9b,0x3f,0x4f,0xe3,0xa4,0x99,0xbb,0x00,
+    0x0f,0x9f,0x57,0x0f,0xc4,0x35,0x33,0x1e,0x91,0x99,
+    0xe4,0x8e,0x10,0xc7,0xec,0x05,0xec,0x1b,0x46,0x7c,
+    0x19,0x0a,0xd0,0x93,0x9e,0xdc,0x39,0x42,0x92,0x8c,
+    0x23,0x1e,0x1c,0x3e,0x76,0xc6,0xe0,0x71,0x35,0xc1,
+    0x63,0x9e,0x9d,0x59,0x10,0x90,0x46,0x66,0x6b,0xd2,
+    0x3c,0x46,0x0d,0x9d,0x31,0x53,0x33,0x7d,0xa4,0xa9,
+    0xb8,0x42,0xd4,0x0b,0x1b,0xe9,0x02,0x1c,0xce,0xfd,
+    0x54,0x6c,0x0f,0x89,0x4d,0x9a,0xbe,0xd1,0x1a,0x83,
+    0xc6,0x78,0xcd,0x10,0xb2,0x6d,0x4d,0x93,0xc1,0x2c,
+    0x1b,0x19,0x1d,0x33,0xeb,0x62,0xcb,0x30,0x59,0xaa,
+    0xd8,0xbe,0x66,0x90,0xff,0xad,0xd2,0xfa,0x99,0xef,
+    0xd1,0x18,0x44,0x55,0x07,0x18,0xd9,0x3e,0x8d,0x9f,
+    0xca,0xdf,0x44,0x9c,0x72,0x86,0xf9,0xa7,0x1a,0x17,
+    0x35,0xdc,0x4c,0xce,0x32,0xe6,0x58,0xe8,0xef,0xd8,
+    0x4d,0x7e,0xb6,0x59,0xe1,0x93,0x3d,0xe8,0xb7,0x9f,
+    0x69,0x88,0x2e,0xcb,0xdb,0xf9,0xa3,0x8b,0xe1,0xc2,
+    0x6d,0xf3,0x3e,0x06,0x2f,0x13,0x88,0xf8,0x1e,0xe0,
+    0x79,0xb3,0x79,0x90,0x39,0x15,0x95,0x01,0x81,0xa2,
+    0x6e,0xe7,0x23,0x54,0xc9,0x5c,0xcc,0x8c,0x6f,0x06,
+    0xd3,0xcd,0xfb,0xb1,0xba,0xc4,0x6c,0x1c,0x1c,0x18,
+    0x35,0x75,0x42,0x4b,0xcb,0x02,0xe2,0x62,0x5d,0x94,
+    0x3c,0x7e,0xbb,0x80,0x70,0xf1,0x91,0x97,0x73,0xd2,
+    0x43,0xfa,0xa8,0xee,0x5f,0x47,0x77,0x64,0xd3,0x6b,
+    0x9f,0x4d,0xc9,0xb7,0x0c,0xda,0x35,0x17,0xeb,0xb3,
+    0x59,0xfb,0x9a,0x70,0x3f,0xe1,0x96,0xec,0x21,0xa0,
+    0x97,0xd9,0x09,0x2a,0xb6,0x39,0x00,0x7a,0x44,0x19,
+    0x68,0x0e,0x50,0xb1,0x2d,0x02,0x40,0x68,0xf6,0x52,
+    0xfa,0xfb,0x32,0x6d,0xa5,0xf5,0xd4,0x71,0x3f,0x13,
+    0xa0,0xf7,0x15,0xde,0x9e,0xba,0x6a,0xd8,0xea,0x59,
+    0xf4,0xfb,0x99,0x2b,0x62,0x57,0x64,0x67,0xaf,0x8c,
+    0x5d,0x59,0x8d,0xfb,0xcd,0x5c,0x39,0x7c,0x15,0x7d,
+    0x77,0xd1,0x91,0xc3,0xd8,0xe5,0xb5,0xd7,0x17,0xc9,
+    0x9c,0x84,0x7c,0xfa,0x73,0xf5,0xea,0xd8,0x95,0xd9,
+    0x39,0x2b,0xe3,0x56,0xd4,0x60,0xf7,0x9a,0xd5,0xb1,
+    0xab,0x73,0x73,0xa0,0x6c,0xf2,0x6b,0x0b,0xe5,0xf2,
+    0x15,0x87,0x5f,0x7d,0x40,0x2e,0x5f,0x70,0x54,0xe4,
+    0xdb,0x4c,0x20,0xe6,0x5d,0x71,0x3d,0x8d,0x3d,0x0c,
+    0x76,0xf3,0xc6,0x68,0x0a,0x84,0x0b,0x1f,0x66,0x02,
+    0x69,0xbe,0x72,0xe5,0x4a,0xf9,0xa5,0x4b,0xe4,0xe2,
+    0x9b,0xdf,0x14,0x9d,0x3f,0x33,0xe3,0x3b,0xb2,0xce,
+    0xf2,0x9e,0x85,0x4d,0x17,0x96,0x77,0x88,0x45,0x08,
+    0xb4,0x12,0x42,0xdb,0x2e,0x23,0xe2,0x20,0x7f,0x4a,
+    0x51,0x02,0xd5,0x92,0x14,0x16,0x14,0x80,0xf5,0xed,
+    0x7d,0x07,0xb1,0xf3,0x5d,0xcc,0x57,0x8a,0x8a,0x49,
+    0x0e,0x94,0x1b,0xcc,0x4e,0xd3,0x68,0x98,0x0d,0xc4,
+    0x4d,0x20,0xd6,0x6b,0x8c,0xc5,0x5a,0x6f,0x01,0xa4,
+    0xd2,0xd1,0xd5,0x0e,0x42,0x19,0x18,0xe0,0x2e,0xfa,
+    0x70,0xa3,0x03,0x03,0x02,0x2d,0x19,0xc9,0x4b,0x9f,
+    0x98,0x1f,0x3f,0x71,0x64,0x60,0x64,0x5a,0xf8,0xc4,
+    0xa2,0xc4,0x2b,0x19,0x81,0xa3,0x4d,0x09,0xe6,0x1d,
+    0xf4,0xf7,0x9c,0x49,0x6b,0x72,0x6b,0x13,0x67,0xe4,
+    0xef,0x7a,0x62,0x64,0xe5,0xca,0xbc,0xd4,0xc0,0x42,
+    0x21,0x37,0x73,0x8e,0x77,0xce,0xfd,0xb3,0xd7,0x68,
+    0x0d,0x69,0x83,0x3c,0x72,0x57,0x4f,0xbe,0x2f,0x3d,
+    0x67,0xf9,0x12,0x5d,0x64,0x59,0xc2,0xa2,0x47,0x87,
+    0x96,0xa4,0x55,0xae,0xcd,0x89,0x33,0x17,0xe2,0xa0,
+    0xa9,0x4b,0x2a,0x47,0x99,0xe6,0xe5,0x0f,0xd5,0x19,
+    0xa1,0x1d,0x79,0xf2,0x7e,0x82,0x8b,0xfc,0xb8,0xe8,
+    0x2f,0x42,0x92,0x0d,0xe2,0x27,0xc5,0x38,0xcf,0xdf,
+    0x64,0x30,0x98,0xfc,0x71,0xa4,0x9f,0xc9,0x0f,0xfe,
+    0xcb,0x1f,0x0b,0x0e,0xb6,0x0c,0x1e,0x6c,0x61,0xd7,
+    0x10,0xd1,0x6f,0x56,0xd2,0x7e,0x43,0xc1,0xf6,0xc6,
+    0x7a,0x01,0x57,0x21,0x4b,0xe6,0x07,0x36,0xb3,0x9f,
+    0x4e,0x06,0x73,0xb0,0x0c,0x11,0x48,0xc0,0x4f,0x99,
+    0xce,0xcf,0x9d,0x7b,0x89,0x25,0x5b,0x1a,0x64,0x95,
+    0xdb,0xaa,0x64,0x05,0xdd,0x79,0xf2,0x7d,0x9c,0x8f,
+    0xd7,0xe3,0x82,0xf7,0x4f,0xd1,0x67,0xf0,0xa9,0xbd,
+    0xf4,0x1c,0x7d,0x92,0x7e,0xb0,0x7f,0x3f,0x8e,0xc4,
+    0x25,0x38,0xfc,0x80,0x75,0xd5,0xeb,0x67,0xbf,0x3a,
+    0x3a,0x7f,0x96,0x7f,0x71,0xde,0xc3,0x4f,0xe3,0xc0,
+    0xc9,0xb3,0xcb,0xb4,0x1f,0xe2,0x5c,0xbc,0x0e,0xca,
+    0xbf,0x4f,0x77,0xd2,0xd9,0xf4,0xd9,0x0f,0x85,0x6d,
+    0x38,0xe2,0xd5,0x83,0x50,0xef,0x29,0xfa,0xf1,0x81,
+    0x97,0x71,0x04,0xbd,0xf9,0x23,0xde,0xdd,0x12,0x3d,
+    0x29,0xf4,0xf8,0xf3,0xf4,0xd1,0x90,0x9c,0x50,0xd6,
+    0x07,0xb1,0x82,0x3f,0x3e,0x2f,0x7f,0x57,0xf4,0xe5,
+    0x73,0x9f,0xaa,0xb4,0x3e,0x61,0x3b,0x99,0xe2,0xf2,
+    0x44,0xad,0x15,0x57,0x27,0x0a,0x45,0xc3,0xc4,0x23,
+    0x93,0x62,0xfb,0x38,0x25,0x97,0x27,0x65,0xd7,0x2e,
+    0xc8,0x8b,0x98,0x37,0xa6,0x20,0x69,0xdc,0x88,0xc2,
+    0x4c,0xf9,0xd6,0xd0,0x19,0x55,0x34,0x36,0xab,0xb0,
+    0x64,0x7f,0x71,0x2f,0xa7,0xd4,0x71,0x09,0x81,0x74,
+    0xd9,0xec,0xf2,0xbc,0xd1,0x4a,0xe7,0x91,0x52,0x3f,
+    0x6f,0x14,0x14,0xc2,0x43,0xa2,0xaf,0x19,0x0b,0x1a,
+    0x25,0x36,0x61,0xb9,0x18,0xe1,0x7d,0x5f,0x7c,0x11,
+    0x4f,0xaf,0x61,0x1f,0xfc,0xd8,0xe5,0xcb,0x71,0xf4,
+    0x6b,0xac,0x17,0x2a,0x68,0x33,0x6d,0xf6,0xc7,0xb5,
+    0x03,0x70,0x8d,0xa1,0x23,0x89,0xa4,0xbd,0xb0,0x6f,
+    0x49,0x1b,0xf7,0x09,0x89,0x2b,0xf6,0x6f,0x2d,0xd6,
+    0x3d,0xa4,0xb9,0x05,0xef,0xb7,0xdc,0x7b,0x5f,0x4b,
+    0xd6,0xa9,0x2f,0xfc,0xd0,0x90,0x7b,0xf4,0x06,0xb7,
+    0xcc,0x99,0xa3,0xc4,0xe6,0xca,0x30,0x45,0x1b,0xfe,
+    0xbe,0x3b,0xda,0x16,0x7c,0xb2,0xe1,0x89,0x8d,0xef,
+    0xd4,0xef,0xdb,0x57,0x5a,0x5a,0x97,0x57,0x7e,0xfa,
+    0x6f,0x3b,0x83,0xcc,0x5c,0xb2,0x74,0x7f,0x02,0x6d,
+    0xc2,0x15,0x74,0x8b,0xd0,0x9f,0x6e,0xcf,0xcf,0x61,
+    0x36,0x5f,0xfb,0x1d,0x85,0x56,0xb0,0x28,0xca,0xec,
+    0xeb,0x4e,0x4b,0xdb,0x6e,0x21,0x57,0xa1,0xb5,0x30,
+    0x3e,0x3e,0x24,0xcc,0x21,0xd7,0xf8,0xbe,0x2f,0xdb,
+    0xc7,0x14,0xb7,0x76,0x55,0x28,0x86,0xf5,0x11,0x8c,
+    0x09,0x3c,0xb4,0xed,0xc5,0x17,0xdb,0xf7,0xe0,0xfb,
+    0x16,0xcf,0x3f,0x38,0x3c,0x6e,0xa1,0xfc,0xec,0x73,
+    0xf4,0xce,0x73,0xcf,0x62,0x17,0xfa,0xcc,0xe2,0xd7,
+    0x9a,0x12,0x46,0x1d,0x6a,0x12,0x7d,0xf2,0x70,0x11,
+    0xf7,0x13,0xfb,0x74,0xd9,0x51,0x64,0x1c,0x73,0xd8,
+    0x55,0xc4,0x26,0xe6,0xa3,0xef,0xd8,0x5b,0x6c,0xb5,
+    0x70,0x1e,0x47,0x92,0x34,0xe2,0xc4,0xf7,0x37,0xc4,
+    0x7d,0x36,0x85,0x92,0xab,0x40,0xf3,0x08,0x12,0xcd,
+    0x77,0x94,0x62,0xb0,0xaa,0x66,0xf1,0xb8,0x55,0xeb,
+    0x71,0x3d,0x0d,0x3e,0x00,0xab,0xc0,0xf4,0xd1,0x39,
+    0xe9,0xe6,0x02,0xf9,0xd9,0xc5,0x55,0xd9,0x4f,0xec,
+    0xde,0x6f,0xc9,0xf8,0x3a,0x7b,0xc9,0x94,0x07,0x26,
+    0x58,0xe2,0x67,0x01,0xac,0x70,0x12,0x4b,0xdc,0xe4,
+    0xe7,0xec,0x92,0xc7,0xa7,0x45,0x0f,0xbb,0x63,0x31,
+    0x5a,0xdc,0x58,0xe3,0xed,0x0b,0x9f,0xf1,0xc3,0xc2,
+    0xb1,0xa3,0x76,0x6f,0x5a,0x52,0x5a,0x98,0x7f,0x6a,
+    0x6a,0x45,0x69,0xfc,0xa8,0xac,0xe9,0x13,0x9e,0x48,
+    0x93,0x37,0xe4,0x2e,0xac,0x4a,0x9d,0xd9,0xd7,0x39,
+    0xec,0x60,0xcd,0x9a,0x90,0x82,0xe8,0x29,0xcd,0xf9,
+    0x13,0x0b,0x36,0x8c,0x15,0xe7,0x02,0xfb,0x3a,0xdd,
+    0x89,0xe9,0x34,0x58,0xb4,0x19,0x4c,0x31,0x66,0x72,
+    0xd3,0xff,0xe9,0x31,0xe1,0x4b,0x46,0x29,0xf4,0xea,
+    0xd1,0x47,0xe3,0x3c,0x76,0xad,0x63,0xf6,0x21,0xd8,
+    0x07,0x97,0x61,0x2e,0xf7,0x72,0xb0,0x99,0x24,0xef,
+    0x9f,0x5a,0x25,0x59,0x4d,0x97,0xc1,0x6a,0xd2,0x2f,
+    0x4c,0x9a,0x1b,0xe1,0xec,0x5c,0x50,0xf0,0x24,0x33,
+    0x9b,0x32,0xf3,0x66,0xce,0x1f,0x49,0xe7,0x28,0x82,
+    0xad,0x06,0xfa,0x9d,0x64,0x38,0x61,0xb4,0x89,0xb6,
+    0x09,0x48,0xda,0xeb,0xe5,0x2a,0x94,0x39,0x71,0xd9,
+    0x42,0x54,0x2f,0xa0,0xfc,0x0d,0xf9,0xde,0x81,0xb5,
+    0x15,0xf7,0xad,0xc2,0xc5,0xb4,0x4d,0x71,0xe4,0xaf,
+    0x54,0xc1,0xe8,0xfe,0x5f,0x42,0xf8,0x29,0xad,0x15,
+    0xa4,0x0c,0x64,0x3f,0x8e,0xf9,0x25,0xdc,0x1d,0xb6,
+    0x6e,0x84,0xb8,0x99,0x31,0x26,0x2e,0xfb,0xa0,0x53,
+    0x17,0x01,0x06,0xe6,0x5d,0xec,0x58,0x04,0x81,0x42,
+    0x34,0x1b,0x95,0x9e,0x78,0xd1,0xa2,0xda,0xf8,0x7e,
+    0xfa,0xd0,0xf4,0xf4,0x2c,0x4b,0xea,0x38,0xe3,0x0e,
+    0x7a,0xa5,0xb8,0xbc,0x57,0x46,0xaf,0x51,0xf5,0x23,
+    0x7a,0xef,0x68,0x08,0xe4,0x74,0x59,0x48,0x1a,0x5e,
+    0x2b,0xee,0xa7,0x62,0xbe,0x9f,0xaa,0x80,0x39,0xc6,
+    0x88,0xd7,0x66,0x2b,0x74,0x31,0x25,0x91,0xbf,0x66,
+    0x40,0xb7,0x96,0x65,0x67,0xf9,0x84,0x8c,0x19,0xb5,
+    0x97,0xcb,0x49,0x8a,0xe0,0x4f,0xfc,0x41,0x2f,0x70,
+    0x59,0x73,0xb7,0x9f,0x23,0x50,0x8b,0x96,0x7e,0xca,
+    0xd2,0xef,0x17,0x2d,0xfc,0x65,0xe1,0x6f,0x8f,0x8d,
+    0x79,0x2a,0x79,0x8c,0xdc,0x6b,0x7f,0x33,0x3d,0xf8,
+    0xe2,0x5e,0xbc,0x97,0xb6,0xfc,0x6b,0xc9,0x62,0xec,
+    0xb9,0xb8,0xdb,0x98,0xf7,0xc0,0x81,0x1a,0xc1,0x6c,
+    0x8b,0xf6,0xd1,0xaf,0xe3,0x60,0xb4,0x93,0x05,0xf4,
+    0x5a,0x3c,0x0c,0x7f,0x32,0x68,0x00,0x5d,0xef,0x8f,
+    0x73,0x70,0x8e,0x81,0x6e,0xb0,0x27,0x61,0xcc,0x46,
+    0xc3,0x2a,0xbe,0x2f,0xa7,0xd9,0x4d,0xdc,0xf3,0x71,
+    0xa0,0x5c,0xc3,0x8c,0x52,0x98,0xa5,0x60,0x4e,0xb7,
+    0x6d,0x8d,0x2a,0x14,0x02,0xae,0xb5,0xb5,0x07,0xe7,
+    0x09,0x28,0x2f,0xa9,0xa4,0x24,0x9b,0x1e,0xc0,0x59,
+    0x99,0xd9,0x32,0x59,0xfa,0x93,0x0e,0x4d,0x6c,0x49,
+    0x93,0x1f,0x6e,0xad,0xb1,0x5c,0xb8,0x30,0x8a,0x14,
+    0x5a,0x5f,0xc6,0xfd,0x97,0x86,0xb8,0x6e,0xa5,0xdf,
+    0x30,0x9d,0xcd,0x70,0x9a,0x25,0x9c,0xfe,0x9d,0x30,
+    0x32,0x47,0x9c,0xd0,0xb3,0xc8,0xdb,0xb1,0x7a,0x31,
+    0xac,0xfd,0x7a,0x18,0x00,0x5d,0x70,0x5b,0x3f,0xe8,
+    0x3e,0x1e,0x64,0x28,0x1c,0x70,0x8f,0xe4,0xe3,0xc1,
+    0x80,0xc2,0xf8,0x9c,0xf8,0x37,0xa3,0x02,0xf7,0xc8,
+    0x84,0xbb,0x8c,0x15,0x6c,0x62,0xc4,0x8d,0xee,0x60,
+    0x89,0x7c,0xdc,0x93,0x77,0x1b,0x3f,0x2d,0x17,0x7a,
+    0xe6,0x0f,0x41,0xe1,0xb4,0x84,0xf8,0x70,0x7b,0x8c,
+    0xef,0xfd,0x6a,0x7d,0x61,0xca,0xd6,0x00,0x75,0x0a,
+    0xa5,0xe8,0x9d,0x30,0x7b,0x29,0xc4,0x23,0x20,0x60,
+    0x14,0x99,0x70,0x4e,0xc6,0xb6,0x90,0x8c,0xc1,0x4b,
+    0x3d,0x23,0xa7,0x4d,0x30,0x4d,0x08,0x0f,0x2f,0xa7,
+    0x0f,0x45,0xf6,0x9f,0x3c,0x2c,0x4c,0x36,0x92,0x6d,
+    0xb6,0xd1,0xfb,0xa3,0x1b,0x36,0x9c,0x8c,0xac,0xfa,
+    0xb5,0x69,0x90,0x4f,0x7a,0xda,0xf3,0x38,0xa0,0x32,
+    0x76,0xd9,0xb4,0x07,0x67,0x04,0xda,0xce,0x26,0x0a,
+    0xa1,0xca,0x06,0xee,0xff,0xee,0xcb,0xd6,0x43,0x76,
+    0x3f,0x5b,0xe7,0x3d,0xac,0x0d,0x36,0xaf,0x1b,0x79,
+    0xa2,0xeb,0x66,0x96,0xb2,0x41,0xf2,0xc3,0xdd,0xd9,
+    0xde,0xf3,0xbe,0x96,0x0d,0x07,0x5b,0x1b,0x7b,0x39,
+    0xe8,0x88,0x2e,0x28,0xc8,0x3a,0xff,0x9d,0x29,0xa0,
+    0x32,0xf0,0x80,0xee,0x18,0x24,0x25,0x72,0x67,0x6d,
+    0x77,0x0c,0x1d,0xf0,0xd5,0x36,0xe9,0x05,0xf3,0x05,
+    0xf8,0xc4,0x71,0x18,0xd9,0x9a,0x51,0xd3,0x05,0xd1,
+    0x92,0xf0,0xc1,0x91,0x45,0x9a,0x21,0x13,0x23,0x43,
+    0x16,0x8c,0x2a,0xf0,0x32,0x0f,0x8f,0x7e,0xa9,0x2b,
+    0x46,0x45,0xc8,0xe0,0xb8,0x3a,0x0f,0x63,0x7e,0xb8,
+    0xa6,0x79,0x6d,0xcc,0xb4,0x82,0xe4,0xbf,0x4e,0x74,
+    0x43,0x6c,0xc3,0x8b,0xf8,0xd9,0x20,0x3f,0xbe,0x0b,
+    0x1d,0x08,0xcb,0x54,0xa5,0x81,0x7b,0x29,0xd8,0xa6,
+    0xbc,0xd9,0xa8,0x50,0x74,0xc5,0xdd,0x47,0x97,0x36,
+    0x30,0x3d,0x61,0x88,0x73,0x9a,0x6b,0x56,0x8a,0x6e,
+    0xec,0x80,0xb1,0xfe,0x71,0xda,0x34,0xe7,0xac,0x2f,
+    0xba,0x11,0x10,0x1a,0xe4,0x95,0x90,0x12,0x57,0x52,
+    0x1b,0xd4,0x77,0xe4,0xb2,0xd2,0x9a,0xbf,0x3e,0xe9,
+    0x86,0x5f,0x26,0xe1,0x57,0x71,0xbb,0xc9,0x8b,0x59,
+    0xce,0xee,0x5d,0x6d,0xa7,0xce,0xb8,0xdf,0xec,0x6c,
+    0x49,0xe1,0xf8,0x6e,0x48,0x7f,0x74,0xb0,0xad,0xfe,
+    0x9a,0x79,0x57,0x5e,0x2b,0x7e,0xb1,0x61,0x44,0xfc,
+    0x00,0x12,0xdf,0x92,0xe0,0xa8,0xdc,0xf9,0x8e,0x7f,
+    0x74,0x80,0x84,0x11,0x6b,0x53,0x66,0x1d,0xac,0x1b,
+    0x9b,0x80,0x73,0x25,0x54,0x93,0x5c,0x13,0x47,0xcc,
+    0x4e,0x1c,0x59,0x2c,0xe2,0x93,0xaf,0x9b,0xbe,0xb5,
+    0xb4,0x64,0x6b,0xa1,0xaa,0x65,0x39,0xc7,0xb5,0x04,
+    0x07,0x8e,0xaa,0x1c,0x99,0x50,0x99,0xd0,0xfa,0x51,
+    0x07,0x4e,0xee,0xbc,0x96,0xf9,0xf0,0xbd,0x01,0x4d,
+    0xe7,0xdd,0x40,0x40,0xa8,0xc7,0x6a,0x83,0x20,0xf3,
+    0x81,0xc9,0x73,0x33,0xad,0xc4,0xfb,0xad,0xbf,0xd2,
+    0x3f,0xb7,0x54,0xe0,0x03,0xa4,0xda,0xfa,0xeb,0xc0,
+    0x8b,0xf2,0x6c,0xeb,0x25,0xb6,0x3f,0x68,0x6f,0xc8,
+    0xd7,0x56,0x3d,0xdb,0xfb,0xa3,0x5a,0xbe,0xff,0xc9,
+    0x0e,0x9d,0x74,0xd9,0xf2,0x54,0xda,0x35,0x80,0xa4,
+    0xf5,0x03,0x1c,0xf6,0x47,0x49,0xbc,0x7d,0x17,0x74,
+    0xc9,0xe0,0x1d,0x1d,0x53,0xc1,0xe8,0x57,0x3e,0x16,
+    0x77,0x49,0xe5,0xb5,0x9d,0x76,0x43,0x0b,0x02,0x57,
+    0xdb,0xe7,0x87,0x0d,0x7a,0xfc,0x10,0x36,0xc1,0x92,
+    0x53,0xdc,0x35,0xb5,0xed,0x93,0x92,0x03,0x7c,0xec,
+    0x79,0x74,0x1a,0x79,0x0e,0x2d,0x7c,0xd7,0x36,0xec,
+    0xf0,0x2f,0x8e,0x1b,0x9f,0xf6,0x21,0x67,0xbd,0x6d,
+    0xdf,0x01,0xed,0x80,0xe7,0xc4,0x3d,0x30,0xb6,0x51,
+    0xa6,0x71,0xdc,0x3e,0xbd,0x4f,0x9c,0x95,0x5f,0xea,
+    0x0c,0x4c,0x1a,0x5d,0xd6,0xef,0x1d,0xb6,0x53,0x1d,
+    0xe0,0xa9,0xd9,0x4e,0x71,0xf7,0x51,0xe5,0xe5,0x08,
+    0x78,0x4d,0xd7,0x21,0x15,0xe0,0x88,0xa2,0xeb,0x70,
+    0xfa,0xc1,0x01,0x91,0x20,0xe1,0x11,0xe5,0x78,0x40,
+    0x77,0x29,0x76,0x6c,0xc0,0x99,0xce,0x22,0xfc,0x6a,
+    0x27,0x24,0x8e,0xd2,0x4b,0x4f,0x74,0x6a,0x4b,0xfb,
+    0x57,0xd0,0x82,0xfe,0x9c,0xd7,0x30,0x4f,0x0a,0x0e,
+    0x5a,0x4e,0x6d,0xf4,0xb5,0xf3,0xd8,0xaf,0xb8,0xd8,
+    0x41,0x99,0x71,0x9e,0x6e,0x85,0x7a,0x9f,0x71,0x9e,
+    0xba,0x3a,0xf0,0x54,0x60,0x0b,0xad,0xcf,0x44,0x5e,
+    0x4e,0x61,0x95,0xec,0xfa,0xc9,0x86,0xef,0x07,0x28,
+    0xfd,0x06,0xe7,0x9d,0x47,0x4f,0xbc,0xe3,0x00,0xde,
+    0xb0,0xf3,0x6c,0x61,0x02,0xe7,0xd9,0xeb,0xc5,0xc5,
+    0xdd,0x15,0x0f,0x83,0x28,0xb4,0xb7,0x02,0x94,0xe7,
+    0x25,0x1e,0xc1,0x28,0x20,0x5d,0x78,0xc4,0xe0,0xc9,
+    0x3b,0xf3,0x66,0x30,0x00,0xeb,0x3c,0x9e,0x6d,0xfd,
+    0x1a,0x2f,0xed,0xcf,0xf7,0xe2,0x5e,0x67,0x69,0x7f,
+    0x9e,0x2d,0x42,0x35,0x7c,0xb1,0xdd,0x65,0x9f,0x7e,
+    0xc6,0x8c,0xe2,0x6b,0xd7,0x3a,0xed,0xd5,0x93,0x63,
+    0xd3,0x48,0xb2,0xf5,0xf5,0x69,0xd6,0xed,0xb6,0x1d,
+    0x7b,0x71,0x9f,0x72,0x27,0xd7,0x85,0xfe,0x77,0xd7,
+    0x84,0x9d,0xf7,0x7a,0xc9,0x8b,0x3d,0xaa,0xc2,0x03,
+    0x8e,0x3b,0xc0,0xdd,0xd4,0x60,0xb7,0x2d,0x61,0x90,
+    0x1f,0xbe,0x27,0xcc,0xfb,0x56,0xc3,0x77,0x64,0xec,
+    0xbd,0xab,0xe9,0xb6,0x3f,0x8c,0x07,0xd8,0x3a,0xbb,
+    0xad,0xdb,0x46,0xb1,0xbd,0xeb,0x69,0xe5,0xdd,0x77,
+    0x8c,0x1d,0xf1,0x39,0x21,0x77,0x7e,0x0e,0xce,0x2e,
+    0x15,0xdd,0xd0,0x09,0x4a,0x71,0x4a,0x6b,0xe8,0x01,
+    0x99,0x24,0x32,0x34,0xe7,0x1e,0xc8,0x3a,0x70,0xb1,
+    0x7d,0x1c,0x43,0x4f,0x92,0xa4,0xec,0xbe,0x07,0xde,
+    0xde,0x55,0xae,0x7e,0xea,0x86,0xbe,0xab,0x98,0x35,
+    0xdc,0x9d,0x08,0x1b,0x0d,0x88,0xaf,0x5d,0x03,0xef,
+    0xd6,0xbb,0x3d,0xd0,0xb1,0xa9,0xc7,0xfe,0x3d,0xd1,
+    0x9d,0x98,0xce,0x9d,0x5c,0x7c,0x77,0x5a,0x64,0x12,
+    0x2d,0xe2,0x38,0xe8,0xc7,0x9f,0xdb,0xeb,0x32,0x12,
+    0xba,0xd3,0x81,0x53,0x3a,0x0f,0x8c,0xc2,0xee,0x04,
+    0x38,0x8e,0x93,0x7b,0x1c,0x17,0xe0,0xe7,0xb2,0xe6,
+    0xc0,0xba,0x2e,0x92,0xf9,0x46,0x9d,0x89,0x12,0xe3,
+    0x40,0x8c,0xcd,0x18,0x93,0x3b,0xf4,0x0b,0xec,0x33,
+    0x8c,0x5e,0xa5,0x57,0x86,0x61,0x03,0xfd,0x7a,0x18,
+    0xcc,0x4b,0x7e,0x02,0x64,0xd2,0xaf,0x63,0xb1,0x9e,
+    0x7e,0x11,0x07,0x16,0xa4,0x3e,0x16,0x96,0xdd,0xec,
+    0xc8,0x21,0x2a,0x6c,0xdf,0x29,0x5c,0x52,0x28,0xb8,
+    0xc5,0xc5,0xec,0x15,0x4f,0xe6,0xe8,0xe7,0xbe,0x28,
+    0x7e,0xb8,0xcf,0xec,0xc5,0x76,0xfd,0xbc,0x70,0x80,
+    0x00,0x23,0x33,0x3a,0x10,0x7b,0x0a,0x79,0xf9,0x97,
+    0xcf,0x6d,0x2f,0xcb,0xb7,0xcc,0xab,0xc0,0xcd,0xcf,
+    0xcc,0x2a,0xb4,0xd0,0x84,0x1d,0x3b,0xe3,0xf0,0x77,
+    0x99,0x8f,0x6c,0xdf,0x19,0x49,0x7d,0xc6,0xcb,0x6e,
+    0xbe,0x61,0x4d,0xa0,0x8b,0xea,0x8f,0xf9,0xff,0x7a,
+    0x02,0x57,0x92,0x1b,0xcb,0x8f,0x07,0xd7,0x01,0xd1,
+    0xbb,0x9e,0x12,0x8e,0xff,0xab,0xe5,0x0a,0x1e,0x87,
+    0x53,0xad,0x4f,0xb5,0x25,0x37,0x8a,0x7e,0x3e,0xb6,
+    0xcf,0xce,0xc7,0x4a,0xbf,0x4e,0xbb,0xaa,0x5d,0xf6,
+    0xdc,0xb1,0x87,0xdd,0xde,0x1b,0x67,0xdb,0x7d,0xef,
+    0x18,0x1f,0x59,0x3d,0x6c,0xc3,0x3b,0xc0,0x76,0xe2,
+    0x27,0x21,0xed,0xf3,0x4f,0x17,0xd0,0xe4,0x5b,0x71,
+    0x4c,0xb4,0x74,0xc0,0xb5,0x0d,0x85,0xc4,0x7b,0xc3,
+    0x55,0x73,0xaf,0x6e,0xf7,0x79,0xa8,0x2b,0x82,0x1f,
+    0xba,0xce,0x45,0x0b,0x6d,0xa8,0xba,0x8a,0xfd,0xaa,
+    0x1e,0x10,0x0a,0x12,0x3e,0x51,0xc6,0x7c,0xba,0x4b,
+    0x98,0xbc,0x2b,0xaf,0xfc,0xba,0xd8,0x55,0xbd,0xec,
+    0xe8,0x1c,0xe5,0xea,0x6a,0x0f,0xb8,0x88,0xb8,0xdf,
+    0xcf,0x79,0xa6,0xee,0x3c,0xbf,0x88,0x5b,0xff,0x64,
+    0x9c,0xc8,0xac,0x31,0xf6,0x13,0x00,0x8e,0xb6,0x70,
+    0xc7,0x61,0x00,0xe4,0x78,0x96,0xa5,0x17,0x9f,0x73,
+    0x98,0x7f,0x45,0xa5,0x37,0xf0,0xd5,0xb5,0x9a,0x9f,
+    0x9b,0x0d,0x0c,0x30,0x60,0x52,0x76,0xf1,0x5d,0x5a,
+    0x39,0xab,0xb8,0xb8,0xf8,0xf9,0xb4,0xb1,0xa9,0x29,
+    0xcf,0xc8,0x9a,0xdf,0xf9,0x98,0x8e,0xa0,0x07,0x40,
+    0xb7,0x6f,0xb0,0x96,0x8c,0x1f,0x8f,0x67,0x8d,0x4b,
+    0xe7,0x7b,0x39,0xed,0x37,0xc8,0x2d,0x85,0x0f,0xf3,
+    0x96,0x1a,0xd5,0xcc,0x5b,0xa8,0xd6,0x2a,0x3c,0xb4,
+    0xc0,0x6c,0x4f,0x95,0x52,0x21,0x9e,0xc2,0xe7,0xdb,
+    0x33,0x84,0x9d,0x08,0x34,0x45,0x73,0x4f,0xed,0xfa,
+    0x0d,0x8b,0xff,0x3c,0x1c,0x9e,0x10,0x57,0x39,0x66,
+    0xcc,0x8f,0x23,0x86,0x4c,0x88,0xce,0x98,0x1c,0xba,
+    0x63,0x54,0x50,0xe4,0xd4,0x8d,0x93,0xa7,0xc9,0x0e,
+    0xed,0x7d,0x93,0xfe,0x32,0xff,0x97,0xb1,0xb1,0x79,
+    0x99,0x29,0xf3,0xe9,0xe5,0xc9,0x93,0x4c,0x25,0xde,
+    0xfa,0xc6,0xca,0xe1,0xb5,0x6f,0xaf,0x99,0x9b,0x1b,
+    0x5f,0x37,0xf7,0xd5,0x95,0xf7,0xb5,0x8e,0x06,0xde,
+    0xf3,0x7d,0x7c,0xbe,0xe7,0xaf,0x63,0xe7,0xff,0x3b,
+    0xac,0x22,0xe1,0xef,0xf6,0xf4,0x9f,0xb1,0x49,0xac,
+    0xf3,0xdd,0x37,0xf7,0xed,0x47,0x06,0xac,0x6d,0xf7,
+    0xdc,0xe5,0xef,0xa0,0xc3,0x09,0x71,0x1e,0x74,0xac,
+    0x59,0xfe,0x8e,0x0c,0x92,0x2f,0x9a,0x05,0xf4,0xb5,
+    0x7b,0x91,0x61,0xb3,0xb8,0x7e,0xb9,0xf7,0x61,0x03,
+    0x1b,0x1d,0x06,0x90,0x8e,0x20,0x14,0xd5,0x93,0xf4,
+    0xcb,0xff,0x96,0xa0,0xea,0xae,0xd3,0x01,0x0d,0xbd,
+    0xc7,0xf1,0x87,0x2f,0x3a,0x8f,0x90,0x6f,0xfe,0x01,
+    0x9f,0x9e,0x95,0xef,0x03,0x89,0x1b,0x82,0x62,0xee,
+    0x36,0x37,0xfc,0x3d,0x8d,0xf2,0x1e,0xa7,0x0a,0x6a,
+    0xb9,0x17,0xa1,0x9d,0x26,0x8d,0xf3,0xf7,0xa4,0x53,
+    0x26,0xf2,0x51,0xf2,0x31,0x07,0xa0,0x88,0x1e,0xd6,
+    0x4a,0x7f,0x47,0xe3,0xb3,0x9d,0x47,0x39,0x3d,0x75,
+    0x77,0xda,0x3a,0xf9,0xa8,0xe9,0x7b,0xf7,0xee,0x63,
+    0x89,0x36,0x45,0x4e,0x0f,0xb4,0xf1,0xf3,0x58,0x51,
+    0x31,0x7f,0x4b,0xdb,0x6b,0xb0,0xca,0xaa,0x3a,0x32,
+    0x13,0x27,0x8c,0xac,0x63,0xeb,0x2b,0xfa,0xf4,0x3d,
+    0x68,0xfb,0xa3,0xb4,0xe4,0x85,0xb2,0x92,0x87,0x12,
+    0xd8,0x4a,0x8b,0x3e,0xf3,0x0f,0xe4,0x4f,0xf6,0x90,
+    0xcc,0x82,0x7c,0x61,0x14,0x18,0xc5,0x3d,0x78,0xa6,
+    0x58,0x3c,0xf4,0xee,0x7c,0xc1,0x04,0xdd,0xad,0x50,
+    0x38,0xd2,0x14,0x18,0x83,0xf9,0xce,0x89,0x20,0x53,
+    0xd8,0xa8,0xc3,0x2b,0x0e,0x18,0xb3,0x76,0xaf,0x7a,
+    0xca,0x4a,0x9d,0xff,0x9a,0x5d,0x55,0xfa,0xed,0xd3,
+    0x81,0xa1,0x6b,0x3f,0xe2,0x64,0x65,0xbe,0x5c,0x14,
+    0x3c,0x5b,0xf0,0xad,0x99,0x7e,0xc2,0x83,0xee,0x6a,
+    0xe2,0x04,0xca,0x2c,0x7b,0xf7,0xb6,0x7f,0x99,0x43,
+    0x0d,0x89,0x39,0xa3,0x96,0xd6,0x2f,0x69,0xb0,0x11,
+    0xb6,0xf1,0x91,0xf8,0x71,0x29,0xd4,0xe0,0xfa,0xe2,
+    0x07,0x74,0xd1,0xa4,0x25,0xb7,0x39,0x85,0xfc,0xac,
+    0x0c,0xd5,0xf2,0xb3,0x32,0x7c,0xfd,0x2d,0x9d,0x90,
+    0x31,0xf4,0xb0,0x8c,0x53,0x4b,0x6b,0x38,0x7c,0x40,
+    0x3c,0x34,0xe3,0x2f,0x38,0xae,0xe0,0x12,0xa9,0x78,
+    0xa2,0x46,0xb8,0x23,0x1e,0xa1,0x71,0x5c,0xb9,0x3d,
+    0x3a,0x02,0xff,0x88,0xbd,0xf8,0xf9,0x1a,0x3e,0x77,
+    0xdf,0x20,0x27,0xb9,0x7e,0x1a,0xc0,0x66,0x23,0x87,
+    0x55,0xdb,0x5d,0xce,0xc1,0x9c,0xb6,0xaf,0x2e,0x50,
+    0x4f,0x07,0x62,0xec,0x1a,0xe9,0xaf,0x2f,0x7b,0x3e,
+    0x1a,0xe3,0x80,0xd3,0x09,0xac,0x4d,0x9d,0xe3,0x2c,
+    0x71,0x17,0x94,0x64,0xa3,0x38,0x69,0x4c,0xec,0x19,
+    0xa1,0xa4,0x7b,0xfe,0x3a,0xdb,0x33,0xc2,0x0e,0x7c,
+    0x6a,0xb0,0x38,0x83,0x7b,0x5c,0xbd,0xdc,0x0d,0xf1,
+    0xaa,0xae,0x33,0xef,0xc9,0x9e,0x48,0x90,0x5d,0xee,
+    0xac,0x63,0x5a,0xd1,0x5d,0x9a,0x0e,0x63,0x83,0xd3,
+    0x22,0x8d,0x5b,0xbd,0xed,0x09,0xac,0x4e,0x2b,0x9f,
+    0xbb,0xd0,0x72,0xb2,0xf3,0x70,0x0d,0xef,0x89,0x90,
+    0x4e,0xe3,0xb4,0xa5,0xb9,0x67,0x2a,0x48,0xfb,0x55,
+    0xe0,0xc1,0x40,0xde,0xe7,0xdd,0xd6,0x8e,0x3a,0x7b,
+    0xef,0xaa,0x0a,0x0a,0x3a,0xfa,0xf2,0x96,0x2c,0x1e,
+    0xe6,0xe3,0xd9,0x50,0xef,0x45,0xde,0x6f,0xdd,0xd6,
+    0x8e,0x2f,0x8a,0x3d,0x94,0xc0,0x2a,0xd9,0xfa,0xe3,
+    0x6b,0xdb,0x99,0x9c,0xcf,0xa4,0x7a,0xf7,0x5a,0x3b,
+    0xbe,0xd8,0x55,0xa9,0xbf,0x51,0x50,0xd0,0x8d,0xaf,
+    0x5a,0x06,0x51,0x68,0xbf,0x01,0x50,0xb6,0x4a,0x3c,
+    0xbc,0xcb,0xda,0x51,0xdb,0x99,0x5b,0xa1,0x05,0x05,
+    0x9d,0x79,0x73,0x4c,0xa2,0x8d,0x9f,0x73,0x69,0xe1,
+    0xe7,0x95,0x98,0x2d,0x06,0x86,0x10,0x51,0xc5,0xe8,
+    0xbc,0x8c,0x84,0x9b,0xaf,0x81,0x66,0x4f,0xb6,0x8d,
+    0x8a,0xe4,0xe2,0x19,0x12,0x50,0x04,0xa4,0x85,0xee,
+    0x7b,0xf4,0xf0,0xd3,0x38,0x72,0xac,0x53,0xf4,0xd1,
+    0x7d,0x81,0x3b,0x62,0x86,0x85,0x8f,0x1b,0x7d,0x2c,
+    0x70,0x1f,0x1e,0x40,0x0f,0xcf,0x5d,0xbc,0xec,0x7a,
+    0xfd,0xfd,0x84,0x58,0x7f,0xc6,0x7d,0xf0,0xa9,0xd6,
+    0x45,0x38,0xe0,0xdf,0x65,0xa3,0xf3,0x8d,0xa1,0xf1,
+    0xe1,0xa3,0x6a,0x46,0x95,0xd3,0xd7,0x4f,0x9f,0xa3,
+    0x0f,0x5c,0x3c,0xf7,0xe9,0xee,0x4b,0xfc,0xcc,0x1d,
+    0x7f,0xee,0x88,0xcd,0x33,0xc1,0x77,0x5f,0x81,0x74,
+    0x3f,0xbb,0x43,0x62,0x7a,0x9c,0x58,0xb6,0x75,0x3a,
+    0xd1,0xd3,0x79,0x26,0x59,0xdd,0xc3,0xf9,0x1e,0x41,
+    0x3c,0xdf,0xc3,0x65,0x80,0xaf,0xf9,0x34,0x0e,0x6b,
+    0xcc,0x2e,0x67,0x7d,0x3e,0xb4,0x89,0xc4,0x97,0x8e,
+    0x67,0x7e,0xec,0xb2,0x41,0x47,0xf7,0x74,0xf8,0x07,
+    0x39,0xe2,0x70,0xe2,0x9e,0x4c,0xc7,0x75,0x65,0x17,
+    0x14,0x64,0xbd,0x28,0x3e,0x33,0x3b,0x63,0xb0,0x99,
+    0xd1,0x91,0x3d,0x62,0xe8,0x80,0xaf,0x86,0x16,0xf8,
+    0xf6,0xbc,0x96,0xec,0x8a,0x68,0x53,0xd7,0x01,0x7d,
+    0xa3,0xd3,0x41,0xa6,0x2e,0x02,0xb7,0xb5,0x27,0xc4,
+    0x12,0x5e,0xde,0x77,0xde,0x30,0xbf,0xdd,0xb5,0xf7,
+    0xba,0xe2,0xd6,0xf7,0xd8,0x75,0x47,0x3b,0x11,0xd0,
+    0xa5,0xeb,0x7a,0xc2,0x2f,0x93,0xf0,0x8b,0xf2,0xcf,
+    0x57,0x5c,0xee,0xdd,0xd6,0x8c,0x5d,0x70,0x7f,0xdc,
+    0x79,0x38,0x4c,0x75,0xc4,0xd9,0x69,0x60,0xfc,0xde,
+    0x73,0x67,0x0a,0xb0,0x4e,0x74,0x81,0x75,0xe2,0x56,
+    0x7e,0x9e,0x82,0x59,0xf6,0xe2,0xb3,0x32,0x7c,0xf3,
+    0x4f,0x4a,0x6e,0xcd,0x78,0x62,0x30,0x8e,0x63,0x9b,
+    0x7f,0x74,0x27,0x24,0x85,0xd3,0xdc,0x57,0xff,0xbd,
+    0x85,0xba,0x5d,0xe4,0x7b,0x51,0x02,0x4a,0x6a,0x9f,
+    0x2d,0xb8,0xc9,0x76,0xf3,0x75,0xa2,0x4f,0xcf,0xeb,
+    0x44,0x85,0xb8,0x4e,0xe4,0xcb,0x44,0xd2,0x9c,0xfe,
+    0xe2,0xd3,0xf5,0x29,0x05,0xe3,0xea,0xb2,0x71,0xfa,
+    0x9c,0xcc,0xac,0x71,0x74,0xeb,0xfc,0xda,0x00,0x3c,
+    0x6d,0x68,0xf1,0x75,0x1d,0xdd,0x63,0x14,0xf6,0x3e,
+    0x6a,0xfd,0x5f,0xf4,0x4a,0xf2,0x5b,0xc1,0xdf,0x6e,
+    0x60,0xd4,0x66,0xef,0x09,0x5e,0x71,0x9d,0xa6,0xd5,
+    0x93,0xd7,0xb3,0xdb,0x32,0xf0,0x17,0x07,0x2b,0xad,
+    0xe9,0x89,0xe2,0x18,0xe7,0x67,0x9b,0xb8,0xac,0xfb,
+    0x74,0xde,0x11,0xe8,0xe9,0x9c,0xd3,0x49,0xfb,0x42,
+    0xd1,0xbd,0xcb,0x81,0x27,0x07,0x75,0xd8,0xd3,0xd9,
+    0xa7,0x0e,0x3c,0x4e,0xcc,0x93,0xdc,0xb1,0x5e,0xec,
+    0xf9,0x38,0xd5,0x13,0xa2,0xc8,0xbf,0xda,0x0d,0x89,
+    0x5d,0x7d,0xf6,0x80,0xa4,0x03,0x87,0x9a,0x7b,0x2e,
+    0x7a,0xd8,0x19,0xe8,0x11,0x59,0x37,0xb1,0x1f,0xd9,
+    0x05,0x6d,0x77,0x55,0xdb,0x0d,0xbb,0x20,0xe2,0x96,
+    0xe4,0xce,0xbf,0x07,0xbf,0x66,0x8f,0xb8,0x3f,0xef,
+    0x2c,0x7a,0x67,0xba,0x20,0xee,0xa2,0x96,0x7b,0x6a,
+    0xb3,0x78,0x0e,0x4b,0x5a,0xbb,0x38,0xac,0x5c,0x7a,
+    0x3e,0x92,0x45,0x62,0x45,0xc6,0xd2,0x2d,0x77,0x39,
+    0x9b,0x65,0xe7,0xf0,0xff,0xfa,0xa3,0xc7,0x43,0x5a,
+    0xd2,0xb9,0x45,0x98,0x13,0x34,0x1c,0x5f,0xe7,0x73,
+    0x8b,0xec,0x40,0x34,0x3f,0xb8,0x28,0x3e,0xb9,0x69,
+    0x3b,0xba,0x38,0x69,0xb5,0xaf,0xb2,0xd7,0x8c,0x02,
+    0x99,0x2c,0x70,0xe9,0xee,0xb9,0x0b,0x6a,0x62,0xcc,
+    0x95,0x37,0xed,0x87,0x17,0xf3,0x32,0xe6,0x59,0xff,
+    0xeb,0x84,0xe8,0xc0,0x55,0x13,0xa7,0xf2,0xe3,0x8b,
+    0xb3,0x6b,0xf1,0xed,0xab,0xfc,0xfc,0xa2,0x20,0xb6,
+    0xcd,0x6e,0xc7,0x77,0xb7,0xe2,0x7b,0x6e,0x64,0x63,
+    0x17,0xdb,0xfd,0xa5,0xbb,0xb4,0xb5,0x13,0x77,0xef,
+    0x7c,0xd4,0x63,0x7b,0xa5,0xb3,0xaa,0x30,0x21,0x76,
+    0x9c,0x55,0x65,0xb3,0x23,0x7b,0x36,0xa5,0x45,0x56,
+    0x2b,0x3f,0x66,0xd3,0xde,0x76,0xb7,0xb5,0x92,0x9f,
+    0xbc,0xf6,0x12,0xd4,0xbe,0x4a,0x18,0xaf,0x9e,0xb2,
+    0x5a,0x3a,0x81,0x7b,0xad,0x5f,0xa6,0x39,0x4d,0xd4,
+    0xff,0xf6,0xaf,0x0d,0x95,0xef,0x17,0x4c,0xcf,0x9b,
+    0x2e,0x3f,0x9c,0x2f,0xfa,0xac,0x15,0xe4,0x7b,0x3c,
+    0x13,0x37,0x28,0x5a,0x76,0xca,0x15,0x9b,0x36,0x59,
+    0x73,0xb6,0x6e,0xb1,0xcf,0x0f,0xb2,0xdf,0xc1,0xd6,
+    0x65,0xda,0x20,0x88,0x9f,0xbc,0xb6,0x3f,0x10,0x1a,
+    0xd3,0xc9,0x00,0x12,0x2d,0x70,0xa5,0x89,0x4f,0x85,
+    0x2a,0x9d,0xf0,0xe7,0xe7,0x53,0x27,0x7c,0xf0,0xd4,
+    0xf3,0x38,0xfd,0xed,0x49,0x99,0x6f,0x77,0xb2,0x81,
+    0x4e,0x6a,0x67,0xfc,0x38,0xbf,0x16,0x7f,0xa8,0xfd,
+    0xf1,0x47,0x51,0x87,0x7d,0xfb,0x2d,0xb7,0x7f,0x98,
+    0xf9,0x4d,0x56,0xbb,0xbe,0xf0,0x21,0x5d,0x54,0xdd,
+    0x0f,0x5f,0x02,0xc5,0xa6,0x17,0xc7,0x2c,0x7f,0x7e,
+    0x44,0xd9,0x00,0xdc,0x37,0xd9,0x64,0x2b,0x20,0xd0,
+    0xc4,0x74,0x84,0x19,0x44,0xec,0x9f,0x3c,0x51,0x42,
+    0x9e,0x19,0x5a,0xd3,0xb7,0x20,0xa5,0x31,0x24,0xb2,
+    0x49,0x13,0x59,0x3b,0x90,0xb6,0xde,0xeb,0x01,0x13,
+    0x65,0x83,0x26,0xf5,0xd5,0x98,0xc7,0x76,0x68,0xc2,
+    0xd7,0x7b,0x98,0x57,0xf4,0xbb,0x73,0xe9,0xde,0x0f,
+    0x9c,0x10,0xf1,0xfc,0x28,0xc8,0x7e,0x1f,0xb6,0xcb,
+    0xdb,0x95,0x3e,0xe1,0x9e,0x27,0x4a,0xc9,0x70,0x46,
+    0xd8,0x98,0x06,0x89,0xb0,0xef,0xee,0x7a,0xbe,0x54,
+    0xa1,0xef,0x44,0x54,0x8b,0xff,0x3d,0xcf,0x9b,0x0a,
+    0x92,0x8f,0x47,0x25,0xcd,0x3f,0xdd,0x2d,0x58,0x9b,
+    0xb3,0xe7,0xfe,0xce,0x52,0x3a,0xc4,0xee,0xf3,0xe9,
+    0xba,0x2f,0xd7,0xc5,0xef,0xc3,0x9f,0x03,0xe1,0x7d,
+    0xd2,0xaf,0x7b,0x9b,0x35,0x1d,0x4f,0x86,0x44,0x75,
+    0x6a,0xdf,0x94,0x8e,0xe7,0x44,0xba,0x72,0xf9,0x17,
+    0xc7,0xe7,0x46,0x08,0xf3,0x3b,0x10,0x67,0xce,0xd3,
+    0x7b,0xc3,0x77,0xee,0xd4,0xb1,0xda,0x8e,0x33,0x9a,
+    0x5d,0x19,0x66,0xec,0x7c,0x66,0x33,0x93,0x9d,0xd9,
+    0x97,0x9f,0xe5,0xda,0xa3,0xeb,0xd9,0x7f,0xc7,0x83,
+    0xe8,0x06,0x93,0x19,0x17,0x97,0x37,0x8e,0x9b,0x14,
+    0x3c,0x32,0x72,0xac,0x49,0x38,0x7e,0xbc,0x76,0x79,
+    0xf2,0xb0,0xd4,0x48,0xcb,0x98,0xa7,0x9f,0x96,0x95,
+    0xbd,0xba,0x2f,0x30,0x5b,0x8f,0x17,0x6e,0x3f,0x94,
+    0xd5,0x96,0xf8,0xce,0xab,0xbd,0xf3,0xdd,0x17,0x3f,
+    0x20,0x5c,0x33,0x31,0xa5,0x8f,0xb3,0x65,0x97,0x85,
+    0x50,0x3e,0x07,0xf4,0x64,0x4d,0x87,0x76,0xb5,0xa4,
+    0xbb,0xea,0x76,0xe4,0x08,0xa3,0x4f,0x0f,0x52,0x15,
+    0xda,0xa9,0xdd,0x5d,0x1a,0x0b,0x75,0x2b,0x64,0x57,
+    0x84,0x01,0xf2,0x77,0xf9,0x79,0x5a,0xdf,0x40,0xa3,
+    0xa7,0x64,0xf1,0x90,0xb8,0xd3,0x6e,0x49,0xca,0xf4,
+    0x84,0x65,0x9a,0x54,0x61,0xae,0xec,0xca,0xcf,0x63,
+    0xc7,0x6f,0xaa,0x59,0xcc,0xf8,0xb1,0x5c,0xee,0x2a,
+    0x9d,0xc9,0xb7,0xcb,0x8a,0x74,0x06,0x5f,0x3a,0x7a,
+    0x8f,0x08,0x5e,0x2d,0xfb,0x56,0xf0,0x92,0x7c,0x06,
+    0x1d,0x1e,0x4a,0x9b,0xbf,0x60,0x75,0x67,0x7f,0x40,
+    0xa7,0x35,0xbf,0xc8,0xf3,0x24,0x3a,0x1a,0x9b,0x21,
+    0xc5,0x9e,0xd0,0xd4,0xda,0x8e,0x3f,0x47,0xc7,0x30,
+    0xba,0xb6,0x17,0x06,0xba,0x7b,0x87,0x36,0x4f,0x19,
+    0x9e,0x96,0x12,0x4f,0xdb,0xaa,0xc1,0xfe,0xda,0x3f,
+    0xee,0xb1,0xb0,0x94,0x45,0x9c,0x0f,0xc1,0xc0,0x87,
+    0x5c,0x6e,0xcb,0xdd,0xc5,0x8e,0x23,0x47,0x7b,0x34,
+    0xdb,0xba,0x58,0x6a,0x4c,0xae,0xb0,0x1e,0x60,0xa5,
+    0x03,0x4f,0x5d,0xa4,0xfd,0x4a,0xb1,0x5b,0x62,0xcc,
+    0x7a,0x69,0xca,0x8a,0x31,0x93,0xd1,0xc1,0xc9,0xc9,
+    0x23,0xc3,0x87,0x94,0xf5,0xc5,0xcb,0xfc,0xd7,0x26,
+    0xb0,0x04,0x4c,0x47,0xa9,0xd3,0x73,0x87,0x7a,0xc4,
+    0xbe,0x1d,0xab,0x4e,0x7d,0x65,0x18,0x8b,0xd9,0x9c,
+    0x77,0x8a,0xba,0xa3,0x51,0xed,0xfb,0x91,0x9c,0x71,
+    0xd9,0x2b,0x4a,0x6b,0xf0,0x8d,0xd6,0xf0,0x2b,0x4e,
+    0x48,0x88,0x8f,0x87,0x90,0xb9,0x69,0x13,0xfd,0x6b,
+    0xf3,0x66,0x50,0x9b,0xec,0xad,0x84,0x78,0xbc,0x54,
+    0x96,0x3d,0xc3,0xc2,0x9e,0x83,0xe5,0x65,0xf5,0x0e,
+    0x57,0xec,0x90,0xa6,0xb7,0x46,0x8e,0x8c,0xc7,0x79,
+    0xec,0x12,0x97,0x90,0x30,0x9c,0xbe,0x08,0xf0,0xf0,
+    0x07,0x90,0x02,0xa0,0xec,0x8f,0x01,0x66,0xa0,0x91,
+    0x40,0xaf,0x01,0x6c,0x6f,0x0e,0xdb,0x99,0xf1,0x56,
+    0xa4,0x44,0x09,0xe3,0x43,0x4c,0x7d,0x05,0x35,0xf3,
+    0xe8,0x36,0x5c,0xf2,0xb8,0x48,0x52,0xcd,0x98,0xab,
+    0xac,0xa2,0x63,0xbd,0xde,0x6c,0x8d,0x26,0xd5,0x63,
+    0x27,0x4e,0x0c,0x9d,0xea,0x3e,0x9c,0xfa,0x70,0x47,
+    0xe5,0x33,0x67,0xc4,0xea,0x08,0xb7,0x9f,0x6c,0xef,
+    0x8f,0x12,0x78,0x7d,0xe4,0xc1,0x4b,0x8b,0x45,0xb8,
+    0x3d,0x60,0x84,0x7b,0x1f,0xda,0x78,0xa3,0x74,0x68,
+    0xd7,0x23,0xb6,0x66,0xf1,0x76,0xf0,0xf9,0xd5,0x04,
+    0x7c,0xfc,0xc8,0xce,0x9b,0x4e,0xa5,0x05,0x7e,0x7d,
+    0xd8,0x56,0x27,0x4b,0xc4,0x60,0x63,0x2b,0xd0,0x90,
+    0xd1,0x3e,0x16,0x1d,0x6c,0x5f,0xcf,0x34,0x9e,0x17,
+    0xb4,0xf8,0x20,0x7d,0x02,0x97,0xbe,0x2a,0x9e,0x11,
+    0x6b,0xcf,0xa0,0xf7,0xf1,0x7b,0x20,0xd3,0x5e,0x52,
+    0xab,0x0e,0xae,0x1b,0xb3,0x0e,0x0a,0xbc,0xff,0x7e,
+    0x2a,0xa3,0x5f,0x7e,0x3f,0x4a,0x50,0xf4,0x65,0xf4,
+    0xab,0x6d,0xf4,0x2b,0xfa,0x32,0xa2,0x70,0xfb,0xa9,
+    0xee,0xf7,0x86,0x8b,0xf7,0xee,0x42,0xaf,0x97,0xc3,
+    0x95,0xd1,0x7b,0x16,0x80,0x7d,0x28,0x36,0x73,0xf9,
+    0xe6,0xcd,0x0f,0x70,0x72,0x19,0x4e,0x32,0x09,0x25,
+    0x90,0xeb,0x9d,0x70,0x92,0xeb,0x22,0xce,0x4f,0x68,
+    0x32,0x1a,0xd2,0x3e,0x4f,0x7c,0xaf,0x89,0xda,0x38,
+    0x64,0xea,0x54,0x9a,0x8c,0xa3,0xc4,0xb1,0x63,0x92,
+    0x3d,0x83,0xcf,0xcb,0x9d,0x3b,0x9f,0x7f,0x94,0x3d,
+    0x53,0x86,0xfe,0xa6,0x1d,0x27,0xe0,0xde,0x48,0xf1,
+    0x9e,0x60,0x97,0x4d,0x7e,0x13,0xb7,0xd7,0xb4,0xbb,
+    0x80,0xbd,0xf8,0xae,0x23,0x7f,0xd6,0x56,0x8d,0xa9,
+    0xc2,0x3e,0xcb,0xe6,0xcc,0x01,0xfe,0x20,0x60,0x23,
+    0x79,0x53,0xee,0xc2,0xf7,0x37,0xd9,0x21,0x72,0xf6,
+    0xae,0x17,0x30,0x6c,0xf8,0x33,0x30,0x66,0x18,0x29,
+    0x82,0x91,0xbd,0x80,0x43,0x4d,0x0e,0xb9,0xa8,0xf4,
+    0xb5,0xaf,0x94,0xd3,0x53,0xa3,0x86,0x4e,0x1b,0xa8,
+    0x4e,0x8f,0x3d,0x50,0x86,0x87,0x8e,0x8c,0x96,0xbb,
+    0xd0,0x21,0xf1,0xd3,0x63,0x1b,0xcd,0x34,0x55,0x10,
+    0x06,0x3f,0xbe,0x98,0x0e,0xc7,0xa7,0xe7,0x94,0x0d,
+    0x2f,0x18,0x88,0x0f,0x5a,0x15,0x81,0xab,0xe7,0xe1,
+    0x4f,0xf8,0xfb,0x53,0x00,0xc7,0x39,0xb9,0x37,0xdf,
+    0x15,0x06,0x8d,0x02,0x43,0x9a,0x9d,0xbe,0x66,0xa7,
+    0x16,0xd9,0x21,0x60,0x76,0x06,0x4b,0x99,0x5f,0xf6,
+    0x7c,0x7e,0xf6,0x80,0xb8,0x6c,0xeb,0x06,0xfc,0x9a,
+    0xbf,0xcf,0x44,0xdf,0xf0,0xcc,0x32,0x6f,0xb9,0xd6,
+    0x45,0x1d,0x1e,0x94,0xbd,0xa7,0x6d,0x7b,0x56,0x96,
+    0x50,0xbc,0x72,0x94,0xb9,0xb7,0xc2,0x89,0xb1,0x06,
+    0x35,0xb4,0xb7,0x11,0x01,0xe0,0x31,0x9a,0xa3,0xd4,
+    0xdc,0x7f,0xc9,0x8d,0x00,0xb3,0xa8,0xce,0xa3,0x39,
+    0x48,0x53,0x0c,0xf6,0xfc,0x35,0xd3,0x45,0x39,0xa8,
+    0xdf,0x88,0xc5,0xde,0x7a,0x77,0x2f,0x9f,0x39,0x8d,
+    0xfd,0xbd,0xf3,0x0d,0x23,0xcc,0x72,0x6f,0x7a,0xa5,
+    0x4d,0x7e,0x71,0xaa,0xff,0xb4,0x5e,0xf9,0xbd,0xaf,
+    0x9c,0xc1,0x6d,0xd3,0xa2,0x47,0xa8,0x73,0xfa,0x00,
+    0x5c,0xe8,0x67,0xb2,0x52,0xee,0x62,0xdf,0x31,0x11,
+    0xb9,0xc0,0xde,0x4c,0x60,0xd6,0x9b,0xc8,0xca,0x44,
+    0x8b,0x36,0xb4,0x60,0xa0,0x36,0xd8,0xc7,0x8d,0xc6,
+    0xca,0x5d,0xc6,0x7a,0x8d,0x1c,0x94,0x5c,0xd9,0x56,
+    0x28,0xec,0x88,0x2b,0xf5,0x1e,0xe1,0xee,0x24,0xad,
+    0x3d,0xc0,0x86,0x13,0x94,0x40,0x1b,0xf7,0x88,0x40,
+    0x6b,0xbd,0x09,0x07,0x12,0x46,0x7c,0x95,0xac,0xbf,
+    0xd7,0x7f,0xb0,0x75,0x69,0x49,0x68,0xe1,0xc0,0xd4,
+    0xe9,0x35,0x3f,0x16,0x14,0x14,0xc8,0x5d,0xb4,0x03,
+    0xc7,0x3f,0x52,0xdb,0x96,0x26,0x1c,0xce,0xad,0x1a,
+    0xe6,0xee,0xd1,0x3a,0x5e,0x08,0x45,0xc8,0xfe,0xdc,
+    0x12,0xd0,0xd2,0x61,0x0b,0xca,0xd9,0xd1,0x3f,0xb4,
+    0x12,0x2e,0x6b,0x20,0x29,0x79,0x7e,0x24,0x0a,0x0d,
+    0x26,0xbc,0x66,0x68,0x72,0x41,0x9a,0xff,0x16,0x20,
+    0x6c,0xc8,0xe7,0x6b,0xda,0x2e,0x08,0xe1,0x9b,0x2e,
+    0xe8,0xb2,0xec,0xb0,0x38,0x4d,0x6a,0xb6,0xe7,0xd2,
+    0x89,0x24,0x75,0x07,0x3d,0xf7,0x37,0x76,0x21,0xc6,
+    0xb5,0x35,0x89,0xf5,0x5d,0xfb,0x0d,0xc1,0x13,0xea,
+    0xb2,0x9d,0x37,0x9d,0x4a,0xa7,0x61,0x47,0x2a,0xbd,
+    0xf8,0x23,0x00,0x31,0x6a,0x15,0x98,0x64,0x8c,0xcf,
+    0x47,0x71,0x9e,0x35,0x15,0x17,0x8e,0xf3,0x9b,0x5c,
+    0x93,0xe5,0x97,0x96,0xe6,0x37,0xb9,0x24,0x3c,0x4c,
+    0xee,0xdd,0xf2,0x21,0x79,0x9c,0xac,0xb0,0x2e,0xa2,
+    0xaf,0x2c,0x1b,0x61,0x32,0x8d,0x58,0x8a,0xc7,0xe3,
+    0xf4,0x65,0x23,0x62,0x88,0x4b,0x8e,0x13,0xc0,0x5d,
+    0x83,0xbf,0x41,0xbf,0x40,0x3b,0x64,0xec,0x5c,0x3e,
+    0x58,0xf3,0x6b,0x0a,0xb2,0xf1,0x37,0x42,0x90,0x35,
+    0xa5,0x46,0xa4,0x39,0x18,0xe6,0xee,0x01,0x80,0x97,
+    0xbd,0xab,0x47,0xa7,0x16,0xdd,0x2f,0x80,0xeb,0x7d,
+    0x6c,0x29,0xfa,0x7d,0x62,0xc6,0x18,0xb9,0xb7,0xf5,
+    0x60,0x6b,0xa2,0xec,0x0d,0xfc,0x47,0x54,0xb9,0x3f,
+    0x2f,0x0f,0xf6,0x19,0x2b,0xdf,0x9f,0x97,0xf7,0x50,
+    0xe9,0x7d,0x03,0xf9,0xf4,0x6e,0x1e,0x41,0xcc,0x31,
+    0x26,0x93,0xbd,0x36,0xdd,0x97,0x9c,0xe0,0x11,0x5b,
+    0x58,0x33,0xdc,0xd0,0xd7,0x89,0x08,0x36,0x50,0x6f,
+    0x58,0xff,0xad,0x55,0xe6,0xe9,0xcb,0x86,0x37,0xc4,
+    0xf9,0x9b,0x03,0x6c,0x50,0x19,0x5c,0x76,0xc8,0x7a,
+    0x04,0x9f,0x4b,0x90,0x46,0xef,0x21,0x08,0x06,0x8d,
+    0x46,0xaf,0x36,0xae,0xc1,0x07,0xb6,0x4f,0x2b,0x9a,
+    0xfa,0x3c,0x1d,0x53,0x20,0x57,0xd5,0x58,0xa7,0x52,
+    0x39,0xbe,0x45,0x4e,0xe1,0xea,0xce,0x32,0xe0,0xcc,
+    0xe6,0x1f,0xc6,0x71,0x51,0xe4,0x03,0x41,0x32,0xc3,
+    0x04,0xce,0xf4,0x47,0xeb,0xa7,0xf7,0x0d,0x2f,0xf0,
+    0xe8,0xed,0x9b,0x9c,0x36,0x9b,0xf1,0xbd,0x4f,0x70,
+    0xd0,0xc4,0x17,0xda,0x46,0x64,0x09,0x35,0x4d,0x91,
+    0x3e,0x3a,0xad,0xdc,0xb5,0x75,0x8b,0xf8,0x8c,0x0a,
+    0xf9,0x10,0xe0,0xf8,0x8b,0x33,0x31,0x07,0xa2,0x37,
+    0x19,0xc5,0x51,0xe3,0xcb,0xc6,0xaa,0x12,0xe8,0xe1,
+    0xef,0x41,0x31,0x8a,0xcf,0xcc,0x4f,0x9f,0x52,0x95,
+    0x65,0xec,0xd3,0x97,0x9e,0xfc,0x4a,0xd3,0x37,0xa0,
+    0xef,0xa4,0xc9,0xfd,0x4d,0x2a,0xe5,0xf4,0xc2,0xe9,
+    0x64,0x88,0xba,0x74,0x60,0x1f,0x85,0x4f,0x94,0xac,
+    0xcd,0x37,0x38,0x25,0xb6,0x60,0x57,0xdb,0xda,0x2c,
+    0xc1,0xe7,0x2d,0x53,0x92,0xbb,0x4b,0xa8,0x3e,0x29,
+    0xca,0xab,0x4d,0x23,0xfc,0xea,0xe5,0x93,0x38,0x2f,
+    0x74,0x54,0xca,0x88,0x40,0xb1,0xdd,0x0d,0x54,0x8b,
+    0x05,0xe8,0x1f,0xf6,0x8c,0x2c,0x7f,0x1e,0x8e,0xe1,
+    0xc0,0x42,0x41,0x5f,0xd7,0xde,0x85,0x11,0xc2,0xea,
+    0x96,0x87,0xe4,0x73,0x26,0xbe,0x6d,0x1e,0x7a,0x92,
+    0x95,0x65,0xc6,0xd0,0x8b,0x40,0x27,0x3b,0x6d,0x04,
+    0xe3,0x91,0x1f,0xb0,0x34,0xe9,0x1d,0x46,0xe2,0x5b,
+    0xbf,0x6a,0x5c,0x5c,0xe8,0xd3,0xd8,0x75,0x40,0xc7,
+    0x10,0xb4,0x66,0x24,0xed,0x8a,0x8c,0xc8,0x5a,0x3a,
+    0x97,0x1c,0x90,0x06,0xa0,0xcd,0x0f,0xc8,0xe5,0xcd,
+    0x85,0x9f,0x80,0x00,0x89,0x53,0x47,0xbb,0x9b,0x01,
+    0x84,0x82,0xa8,0xbc,0x49,0xd4,0x08,0xa2,0x0a,0x23,
+    0x06,0xa5,0x28,0x71,0x23,0xb3,0x96,0x5c,0x9d,0x90,
+    0x18,0x90,0x9a,0x55,0x93,0x95,0x1a,0x00,0x91,0x39,
+    0x5f,0x14,0xba,0xb3,0x58,0x51,0xa9,0xcc,0x71,0x3b,
+    0x44,0xff,0x43,0x57,0x5c,0x5f,0x6c,0x32,0x2d,0xbe,
+    0x8e,0xd3,0x20,0x16,0x9f,0xaf,0x4a,0x6d,0x3f,0x2f,
+    0x84,0xcb,0x45,0xcb,0x40,0x60,0x2c,0x54,0x28,0xe5,
+    0x26,0xbe,0xaa,0xd3,0xb0,0x81,0xae,0x11,0xc2,0x87,
+    0xf5,0xd3,0x46,0x2c,0xce,0x5a,0x4a,0xdb,0x5b,0x7c,
+    0xe8,0x6f,0x85,0x0f,0x36,0x2d,0x8f,0x18,0xe8,0x31,
+    0x54,0xee,0x62,0x3d,0x7b,0x7b,0xda,0x17,0xd3,0x47,
+    0x6a,0x42,0x26,0x0f,0x56,0xc8,0x0e,0x5b,0x8f,0x58,
+    0x5f,0x4e,0xb9,0xb8,0xe4,0x0c,0x89,0x66,0x63,0x04,
+    0xd6,0xa9,0x32,0x51,0xbf,0x89,0xcf,0x02,0xd8,0x04,
+    0x96,0xa9,0x10,0xf6,0x16,0x1d,0xa3,0x12,0xaf,0xda,
+    0xb2,0xe1,0xd0,0x26,0x9c,0x57,0x60,0x8d,0x2f,0x1c,
+    0x18,0x9b,0x18,0x5d,0xec,0xa6,0xc2,0xaf,0x7d,0x85,
+    0xd7,0xb4,0x5a,0xcb,0x5b,0xd7,0xc9,0x66,0x93,0x91,
+    0x29,0x43,0xeb,0x16,0x9d,0xb6,0x24,0x8c,0x43,0xd2,
+    0x98,0x93,0x89,0xfd,0x6e,0x83,0xc7,0x3d,0x34,0xa2,
+    0xbd,0x2a,0x8e,0xbc,0x80,0x80,0x1e,0xa0,0xbf,0xf5,
+    0x62,0xe5,0x94,0x41,0xe5,0x73,0x43,0xd2,0x52,0xfa,
+    0x9a,0xd3,0xfc,0xb2,0x1a,0xbb,0xa2,0xa2,0x07,0xe8,
+    0x2b,0x7d,0xe4,0x53,0x35,0x3e,0x99,0x23,0x1f,0xc6,
+    0x02,0x1e,0xbf,0x74,0x84,0xc9,0x11,0x2f,0x82,0x31,
+    0x17,0x09,0xbc,0x51,0xf1,0xb9,0x40,0x09,0x1a,0x10,
+    0x9a,0x21,0x18,0x35,0x7c,0x02,0x88,0x8c,0x1a,0x30,
+    0x2b,0xad,0xec,0xfd,0xb2,0xf7,0x27,0x64,0x81,0xd6,
+    0x4f,0x69,0xaa,0x1e,0x96,0xeb,0xd1,0x36,0x45,0xe6,
+    0x4e,0xbe,0xb3,0x7a,0x84,0xac,0x9b,0x8f,0x5f,0x13,
+    0xe5,0x86,0xc9,0xec,0xf3,0x00,0xc3,0x1d,0x21,0x3d,
+    0x3b,0xff,0x8e,0x8d,0xd8,0x2b,0x86,0xad,0x96,0x05,
+    0x00,0xa7,0x21,0x4f,0x5b,0xb7,0xe2,0x5f,0x2f,0xd2,
+    0x9f,0x4a,0x71,0x3f,0x65,0xc4,0x90,0x3e,0xba,0x7c,
+    0x1f,0x6d,0xe2,0xd8,0x57,0xb3,0xb0,0x95,0xbc,0x66,
+    0x1d,0xa3,0x19,0x7f,0x7a,0x05,0x3b,0xc0,0xfe,0xce,
+    0xb7,0x99,0x74,0x82,0xb4,0xfe,0xef,0x0d,0xb0,0xfa,
+    0x31,0x4b,0xca,0x9f,0xbd,0x25,0xc6,0x6c,0x1e,0x21,
+    0x98,0x35,0x6c,0x55,0x20,0xb8,0xc9,0x95,0x0a,0xee,
+    0xb1,0xfe,0xf7,0x74,0x67,0xb7,0x5e,0xc3,0x7a,0x0d,
+    0x12,0xf6,0x5a,0xbf,0x25,0x8b,0xf7,0xba,0xea,0xfb,
+    0xf7,0xf1,0x70,0x55,0xb8,0x82,0x7a,0x55,0xab,0xd5,
+    0x81,0xa1,0x63,0x4d,0x9f,0x0e,0x2e,0x71,0x25,0xa5,
+    0x59,0x59,0xd6,0x27,0x82,0xe7,0xe7,0x0d,0xb7,0xc4,
+    0xfa,0x8c,0xb0,0x7e,0x27,0xfb,0x16,0x68,0x85,0xfe,
+    0x22,0x2a,0xe0,0xb3,0x4d,0x53,0x7b,0x79,0x4a,0x8a,
+    0x91,0xcd,0x48,0x5e,0xe3,0xb7,0xe5,0x4d,0x88,0x72,
+    0xd7,0x17,0x68,0xe3,0x26,0xc7,0x66,0x67,0x7a,0xc1,
+    0x6c,0xd4,0xcb,0xc7,0x18,0x34,0x76,0x2b,0xd3,0x8f,
+    0x79,0x95,0xc3,0xd5,0xe2,0x5c,0x94,0x06,0x63,0xfd,
+    0x43,0xa0,0xd1,0x9b,0x3f,0x33,0xc7,0x78,0x65,0x36,
+    0x1b,0x95,0x6e,0x82,0x52,0xc3,0xbc,0x05,0x31,0xec,
+    0xb9,0x1b,0x85,0xd2,0x8d,0x60,0x5d,0x65,0x75,0x4e,
+    0xfc,0x9c,0x3a,0xcf,0x7e,0x59,0xfd,0x7a,0x07,0x8e,
+    0x6d,0xcc,0xd6,0xf5,0x6b,0x38,0x99,0xb4,0x66,0x50,
+    0xcc,0x64,0xb3,0x57,0xae,0x71,0xf5,0x39,0x90,0x2f,
+    0x83,0xe9,0xd3,0xcf,0x28,0x5d,0xb2,0x77,0x43,0xa1,
+    0x8e,0xae,0x2c,0x9e,0x72,0x10,0x0f,0x24,0x21,0xd6,
+    0x8b,0x37,0x5e,0x2a,0x5a,0x9b,0x0d,0x78,0xa0,0x4f,
+    0xc8,0x75,0xa0,0xd5,0xdb,0x61,0x0e,0x35,0x48,0x9a,
+    0x40,0xd9,0xb1,0x9a,0x31,0xa9,0x95,0x09,0x27,0x3e,
+    0x2e,0x99,0x3a,0x70,0x78,0x41,0x90,0x6f,0xb6,0xdf,
+    0xc4,0x15,0x63,0xc7,0x06,0x04,0x0d,0x51,0x27,0x4d,
+    0x94,0x3b,0x79,0xaa,0xc3,0x82,0xb2,0x5f,0x60,0xd4,
+    0xaf,0x4a,0x80,0xa9,0x54,0xd9,0xd6,0xab,0x76,0xba,
+    0xd3,0x34,0xa7,0xd9,0xc2,0x0d,0xf6,0xce,0xed,0x10,
+    0x21,0x1a,0xab,0xa5,0xf1,0xee,0x05,0x03,0xd8,0xc0,
+    0x1a,0x82,0x65,0xbd,0x4d,0x83,0x26,0x8f,0x0c,0x0f,
+    0x52,0x2a,0x41,0x49,0x3d,0x9f,0x76,0x7e,0xeb,0xf7,
+    0x21,0x43,0xc4,0x71,0x0a,0xe5,0x49,0x08,0x2f,0xaf,
+    0x71,0xac,0xa1,0xef,0xa9,0x2e,0x7e,0xb8,0x07,0x30,
+    0x76,0x70,0xec,0x6c,0x3b,0x12,0xf6,0x11,0x8b,0xfd,
+    0x99,0x89,0x7d,0x6d,0xbb,0x84,0x3c,0x76,0x04,0x5d,
+    0xbc,0xa7,0x74,0xb8,0xa7,0xdc,0x77,0x67,0x97,0xd2,
+    0x76,0x2f,0x44,0xb8,0x86,0x55,0xd2,0xbb,0xa5,0x8c,
+    0x60,0xd9,0x07,0xc6,0x5c,0x18,0x99,0xd6,0xbf,0xc1,
+    0x2d,0x51,0x7e,0xb8,0xed,0xb2,0xd7,0xf7,0xa8,0x4b,
+    0x19,0x2c,0xbd,0x4f,0x8d,0xb8,0x8d,0x2e,0x81,0x72,
+    0xf2,0xc3,0x9e,0x57,0xbe,0x69,0xbb,0xfc,0x8f,0xde,
+    0xb9,0xc6,0xda,0x7b,0x0d,0xda,0x7b,0x58,0x3c,0x0f,
+    0x2f,0x61,0xf3,0xef,0x84,0x14,0x2f,0x71,0x44,0x7e,
+    0x99,0x53,0xd0,0xa5,0x9e,0x44,0x81,0xbe,0x33,0x21,
+    0xf8,0xe1,0x4e,0x04,0x89,0x54,0x31,0x9c,0x7a,0x7a,
+    0x87,0xe8,0x39,0x5d,0x50,0xd7,0x2c,0x56,0xd2,0xb8,
+    0x9b,0x8d,0x90,0xba,0x23,0xd2,0x77,0x38,0xc3,0xab,
+    0xbe,0x4f,0xdc,0x2c,0x91,0x4c,0x1a,0x82,0x55,0xa7,
+    0xbd,0xce,0xfc,0xc9,0xdb,0xbd,0x88,0x3d,0x27,0xa2,
+    0xd0,0xf2,0xb5,0xa1,0xbf,0x87,0xbf,0xc6,0xa0,0x91,
+    0x9b,0xe4,0x60,0xcc,0x5d,0xc0,0x81,0xf4,0x72,0xdf,
+    0xc6,0xbe,0xf4,0x26,0x76,0xef,0xdb,0x28,0xab,0xd0,
+    0xe4,0xb9,0xb4,0x5e,0x92,0x05,0xbb,0xe4,0x69,0xf0,
+    0x5e,0xc7,0x7a,0x1e,0x52,0x3d,0xa1,0xa3,0xb2,0x23,
+    0x04,0x17,0x17,0x07,0x38,0xae,0xae,0x12,0xb4,0x4d,
+    0xee,0x79,0x2e,0xf4,0x18,0xdd,0xdb,0x2b,0x4f,0x45,
+    0x97,0xe3,0x26,0x55,0x5e,0x2f,0x9c,0x85,0x93,0x5c,
+    0xf2,0xdc,0xf1,0x12,0xfe,0x6c,0x1f,0x6e,0x21,0xb9,
+    0xc2,0x15,0xfe,0xf6,0x75,0x71,0x61,0x19,0x8d,0xfb,
+    0x7e,0x5c,0x57,0xf7,0x51,0xbd,0x70,0x65,0xe1,0x8d,
+    0xa6,0xa6,0x1b,0xd0,0xcb,0x2b,0xda,0x6f,0xc9,0xaa,
+    0xf9,0xfb,0xeb,0x7a,0x33,0x1d,0x2d,0xbd,0xc3,0xce,
+    0xaf,0x53,0xc4,0x9f,0xac,0xc0,0xbb,0x3b,0xae,0xec,
+    0xed,0x76,0x17,0xa5,0x00,0xd0,0x41,0x7f,0x2a,0x46,
+    0x3a,0xbc,0x5f,0xd1,0x1f,0x85,0x33,0x5f,0xc6,0xbd,
+    0xdf,0xb1,0x68,0x7b,0x1e,0xc7,0xdf,0x7e,0x47,0xdf,
+    0xed,0xad,0x8b,0x23,0xa6,0xe3,0xaf,0xba,0xbd,0x75,
+    0x91,0x8c,0xe3,0x11,0xbd,0x26,0xbe,0x7d,0x11,0xcf,
+    0xe6,0xb7,0x4d,0xf7,0x7e,0x0b,0xe3,0xb3,0xd7,0x69,
+    0xca,0xef,0xbf,0xe1,0x63,0xdb,0x6c,0x77,0x58,0x7c,
+    0xe4,0x24,0x7b,0x2b,0x23,0x66,0xcf,0x5e,0xe0,0x7d,
+    0xfc,0xd9,0x0b,0xdb,0xd3,0x56,0xf6,0xc7,0xac,0x1c,
+    0x9f,0xae,0x42,0x5d,0xcb,0xda,0x1f,0xcf,0xe8,0xfa,
+    0x58,0x06,0xc2,0x94,0x6d,0x76,0x19,0xc5,0x77,0x6f,
+    0x18,0xa0,0xfd,0xe7,0xd8,0xb3,0x04,0xb6,0x73,0x9b,
+    0xcc,0x5e,0xf9,0x1a,0xc6,0xb2,0x86,0x79,0x3e,0xd9,
+    0xbb,0x60,0x1c,0xb5,0x0b,0x7b,0x6b,0x8d,0xb8,0x32,
+    0xe0,0xef,0x00,0x62,0xee,0x56,0xf6,0xa0,0xeb,0xfa,
+    0xb5,0xd3,0x57,0xcc,0x33,0x8c,0x2f,0x88,0x8f,0x5e,
+    0x64,0x1c,0x17,0x56,0x20,0x64,0x84,0x0f,0xad,0xa6,
+    0xdf,0xcd,0x2d,0xf0,0x7a,0x6b,0xfa,0x64,0x0f,0x17,
+    0xb9,0x8b,0x2a,0x2c,0x68,0xf2,0x1e,0xeb,0x0c,0xf2,
+    0xe4,0x4a,0xa6,0x6c,0x5a,0xd3,0x40,0xc1,0x35,0x3d,
+    0xf3,0x43,0x76,0xb3,0x8c,0xb4,0x59,0x72,0x2d,0xc7,
+    0xb2,0xe6,0x91,0xe5,0x9c,0x7e,0x03,0x9f,0xeb,0xce,
+    0x89,0x98,0xdd,0x6d,0xaf,0xa4,0x10,0x98,0x77,0xd3,
+    0xc3,0x0b,0xae,0x9e,0xb6,0x67,0xa8,0x89,0x60,0x30,
+    0x19,0x03,0x4d,0x66,0x83,0x61,0xad,0xea,0xec,0xd6,
+    0x85,0xa5,0xc6,0x6c,0xcb,0xaf,0xfe,0x38,0x99,0x1e,
+    0x26,0x04,0x07,0xd3,0x2f,0xfb,0xac,0x7b,0xa0,0x34,
+    0x3b,0xbb,0x74,0xff,0x49,0xcf,0xb5,0xab,0x09,0x59,
+    0x2d,0x2c,0xc7,0xbd,0x71,0x7c,0x5a,0x76,0x3c,0xed,
+    0x67,0x49,0x1f,0x1b,0x3d,0xf1,0xfa,0xd5,0xf0,0x92,
+    0x50,0xac,0xc1,0x7d,0x27,0x96,0x06,0x72,0x9f,0xaa,
+    0x1b,0xf9,0x5e,0x3e,0x80,0xbf,0x6f,0xa4,0xaf,0xed,
+    0x49,0x1f,0x58,0x71,0x19,0xd4,0x66,0x83,0x00,0xff,
+    0xb8,0x8b,0x19,0x74,0x37,0xe9,0xf7,0x65,0xf6,0x65,
+    0xd2,0x4b,0x20,0xd9,0x0a,0xa7,0xef,0xc6,0x7e,0xe5,
+    0xa4,0xb0,0x34,0x5d,0xb9,0xda,0x24,0xaf,0xb0,0x36,
+    0x91,0xe5,0x19,0xd6,0x70,0xfc,0xf0,0x79,0xeb,0x33,
+    0xa4,0xe8,0x7d,0x5a,0x41,0x2e,0x58,0x77,0x92,0x7c,
+    0xe0,0x2e,0x7b,0x47,0xcb,0x69,0xfe,0xbe,0x89,0x41,
+    0x7c,0x1f,0xbf,0xc7,0x77,0x4e,0x20,0x87,0x77,0x28,
+    0x74,0x7d,0xff,0x04,0xde,0x63,0x7f,0xa9,0x42,0xf7,
+    0x57,0x51,0xe0,0x8c,0x8e,0xd7,0x2c,0x10,0x8e,0xeb,
+    0x15,0x8e,0xab,0xdf,0xdd,0x30,0xe1,0x1e,0x30,0x10,
+    0xaf,0x9e,0x40,0xb7,0x1e,0xe1,0xef,0x7a,0x60,0xf3,
+    0xd9,0x55,0xbe,0x96,0xe4,0x6f,0x4b,0xe4,0xab,0xc9,
+    0x7b,0xcc,0x6b,0xc2,0x0e,0x58,0x6a,0x5a,0xdf,0xb8,
+    0xf7,0xe4,0xc6,0x96,0xa2,0x7f,0xfd,0xf4,0x37,0x53,
+    0x1c,0xe0,0x0e,0x63,0x73,0xa9,0x0d,0xb7,0xe8,0x65,
+    0xd1,0xdc,0x03,0xf7,0x2c,0x40,0xfd,0xfb,0xff,0x0b,
+    0xcc,0xcc,0x07,0xee,0xd8,0xee,0xc1,0xff,0xa4,0xe5,
+    0x22,0x7d,0xff,0xa8,0xfd,0xb5,0xd2,0x72,0xfc,0xef,
+    0x28,0x21,0x02,0xf7,0x3d,0x74,0xe2,0xc3,0xe0,0x7f,
+    0xc2,0x09,0xb1,0xc4,0x3f,0xe0,0xc7,0xff,0x19,0x25,
+    0xac,0x4f,0x52,0xe9,0x17,0x92,0x7f,0xc0,0xe7,0xde,
+    0x1e,0x02,0x81,0x3d,0xcf,0xd9,0xb3,0x97,0x20,0x92,
+    0x39,0x6c,0xfe,0xde,0x55,0xf0,0xd7,0x85,0x54,0x1b,
+    0x4e,0x77,0x09,0xa7,0xe1,0x6f,0x70,0x4a,0x1e,0x8d,
+    0xbb,0xe1,0xe5,0x8e,0xa0,0x7f,0x82,0x98,0xf9,0x8a,
+    0x88,0x83,0x2f,0x44,0x7f,0x6f,0xbc,0xa2,0x74,0xdc,
+    0x05,0x2b,0xbd,0x0a,0x4c,0xfe,0x7b,0xa4,0x6d,0x8d,
+    0xc0,0x62,0xe2,0xe0,0x1b,0x19,0x74,0x77,0xef,0x88,
+    0xd8,0xbf,0x3d,0xf9,0x48,0xde,0x60,0xb8,0x7a,0xf2,
+    0x93,0xd0,0x21,0x9b,0xf8,0x2b,0x58,0x3b,0x7c,0x25,
+    0xfa,0x7b,0x7b,0x4b,0x24,0xaf,0x66,0xcf,0x3e,0x93,
+    0x7e,0x0c,0x4d,0xcf,0x7e,0x13,0xeb,0x59,0xde,0x8e,
+    0x0e,0xdf,0x89,0x57,0x4f,0xde,0x13,0x11,0x7a,0x67,
+    0x1f,0xca,0x59,0xce,0xa7,0x6e,0x7e,0x14,0xeb,0xd7,
+    0xa2,0xec,0x09,0x9d,0x7c,0x29,0xfd,0xba,0x7a,0x53,
+    0xd4,0x30,0x19,0x89,0x50,0x3b,0xf9,0x54,0x3e,0xe7,
+    0x40,0xbb,0x7b,0x55,0xda,0x3e,0x11,0x3d,0x70,0xcc,
+    0x6f,0xf9,0x81,0xdd,0xb7,0xe2,0xcc,0xd6,0xe7,0x46,
+    0xb5,0xe8,0x35,0x5b,0x5f,0xf0,0x23,0xaf,0xdc,0x72,
+    0x9b,0x17,0x25,0xfc,0x7c,0x8b,0xe8,0x6b,0x71,0xef,
+    0xe2,0x6d,0x91,0xdc,0x6c,0x92,0xcf,0x25,0x5f,0x6c,
+    0x88,0x83,0xdf,0xc5,0xd6,0x06,0xe2,0xe0,0x3f,0xf1,
+    0xbe,0xbb,0x07,0x45,0xe2,0x7d,0x4f,0x7e,0x94,0x70,
+    0xce,0xf9,0x7b,0xf8,0x52,0x44,0xfe,0xb7,0x9f,0xb1,
+    0xfb,0x53,0x5c,0x24,0x8f,0x8a,0x48,0xe3,0x9a,0x82,
+    0xec,0x87,0x99,0x57,0x59,0xf4,0xad,0xe0,0xc5,0x36,
+    0xba,0x3a,0xfc,0x2b,0xea,0xce,0x1e,0x16,0x91,0x16,
+    0x9b,0x9f,0x65,0x22,0x47,0xef,0xe0,0x6b,0xe1,0xe8,
+    0x58,0x7d,0xbb,0xbf,0x45,0x77,0x2f,0x8f,0x8b,0x1d,
+    0x5a,0x77,0xbf,0x8b,0x0d,0x74,0x4f,0xbe,0x17,0x11,
+    0x0b,0xc3,0xd3,0xe1,0x7f,0x61,0xab,0x52,0xbb,0x03,
+    0x46,0xea,0x7a,0x32,0xc2,0xe6,0x86,0x51,0x32,0x68,
+    0x8e,0xae,0x18,0xfa,0x9b,0xf5,0xb2,0xe8,0xa7,0x76,
+    0xf0,0xa3,0x84,0xfc,0x53,0x4f,0x8a,0xd4,0x23,0x7f,
+    0xe7,0x4f,0x99,0x09,0x58,0xff,0x89,0x4f,0x85,0x62,
+    0x5b,0x7b,0x3a,0x7c,0x25,0x03,0xee,0xe6,0x2d,0x11,
+    0x71,0x77,0xf5,0x99,0xd8,0x86,0x60,0x37,0xbf,0x89,
+    0x8d,0x57,0x42,0x27,0xdf,0x89,0xee,0xee,0xde,0x13,
+    0x47,0x69,0xeb,0xee,0x43,0xc9,0xb7,0x0b,0xdc,0xdd,
+    0xfc,0x28,0x34,0x50,0xe2,0x6b,0x87,0xdf,0x63,0xd0,
+    0xdd,0x3d,0x1f,0x12,0xb6,0xee,0xfe,0x0f,0x17,0x26,
+    0x96,0x3d,0xfa,0x40,0xf0,0x35,0x51,0xc6,0x3a,0xfc,
+    0x20,0x21,0xff,0xd4,0x13,0xd2,0x19,0xdb,0xdd,0xfc,
+    0x21,0x7e,0x0e,0xa8,0xef,0xe1,0x13,0xb1,0xd1,0xd1,
+    0xe1,0xd3,0xe8,0xdb,0xa3,0x57,0x43,0x9a,0x0e,0x7a,
+    0xf6,0x6d,0x50,0x1d,0x20,0xeb,0xc9,0xc1,0x81,0x97,
+    0xd9,0xf5,0x9c,0x83,0x9f,0xc3,0xd0,0xb3,0xa7,0x03,
+    0xdb,0x45,0xfe,0x6e,0xfe,0x0e,0x7a,0xb4,0x60,0x03,
+    0x60,0xba,0xa7,0xcf,0xa3,0x75,0x90,0xec,0xa2,0xd4,
+    0x77,0x1d,0xbe,0x8f,0x7e,0x3d,0x79,0x3f,0x44,0x5c,
+    0x5d,0x7d,0x20,0xa7,0xc5,0xd9,0xa6,0xab,0x1f,0xc4,
+    0x36,0xd7,0x74,0xf8,0x42,0xfc,0xee,0xed,0x0d,0x91,
+    0x5a,0xa2,0xfb,0x7b,0x63,0xe5,0x1f,0x98,0x29,0xc4,
+    0xc1,0x37,0xe2,0xf7,0xb7,0xde,0x11,0xb1,0xaf,0x7a,
+    0xf6,0x91,0xe0,0x26,0x86,0xf1,0x5e,0x8e,0x12,0x3a,
+    0xd4,0x36,0x8e,0xcb,0xf9,0x7b,0xc5,0xfa,0xf2,0xfd,
+    0x38,0x9b,0x85,0x06,0x7d,0xb4,0x0b,0x20,0x0c,0x2e,
+    0xb0,0x99,0x58,0x2d,0xb7,0xf9,0x7e,0x90,0x87,0xfc,
+    0x79,0xd0,0xcd,0x6d,0x7c,0xcf,0x07,0x7a,0xf4,0x17,
+    0x3a,0x18,0x7f,0x26,0x7f,0x7e,0x12,0xff,0x92,0x87,
+    0x0e,0x3f,0x68,0xff,0xc6,0xcb,0x1c,0xfb,0x57,0x5b,
+    0x30,0x8c,0xdf,0x39,0x52,0x9a,0xc0,0x1a,0xe5,0x31,
+    0x29,0x2d,0xa0,0x20,0xb4,0xcd,0xfe,0x65,0x97,0x8e,
+    0x32,0x72,0x34,0x1c,0x9d,0x92,0xd2,0x0a,0x34,0xc8,
+    0xfe,0xdd,0x18,0x25,0xb2,0xe0,0x41,0x52,0xda,0x09,
+    0xf9,0xe2,0x5a,0x29,0xdd,0x0b,0x45,0xe1,0xf5,0x52,
+    0xda,0x15,0x0d,0xc7,0x27,0xa5,0x74,0x6f,0x14,0x86,
+    0xdb,0xa5,0xb4,0x1b,0x1a,0x4c,0x42,0xa5,0xb4,0x0a,
+    0xf5,0x27,0x53,0xa4,0xb4,0x1a,0xc9,0xc9,0x6c,0x29,
+    0xed,0xce,0x69,0x10,0x10,0x96,0x01,0x17,0xd0,0xcf,
+    0x64,0xae,0x94,0xc6,0x28,0x41,0x28,0x94,0xd2,0xb0,
+    0xd6,0x12,0x76,0x48,0x69,0x01,0x65,0x0a,0xfb,0xa4,
+    0xb4,0xcc,0xa1,0x8c,0x1c,0xcd,0x17,0xa8,0x94,0x56,
+    0xa0,0x61,0x32,0x1b,0x1c,0x25,0xda,0x25,0xdb,0x2f,
+    0xa5,0x9d,0x50,0x92,0x3c,0x4b,0x4a,0xf7,0x42,0x25,
+    0xf2,0x2d,0x52,0xda,0x15,0xcd,0xe7,0xbc,0x65,0xe9,
+    0xde,0x28,0x4f,0xd1,0x28,0xa5,0xdd,0x50,0x96,0xe2,
+    0x23,0x29,0xad,0x42,0xd1,0x4a,0x3f,0x29,0xad,0x46,
+    0x2e,0xca,0x1c,0x29,0xed,0xce,0x68,0x48,0xaa,0x2c,
+    0xaf,0x6c,0xac,0x5c,0x58,0x5a,0xa2,0x2b,0x29,0x6a,
+    0x2c,0xd2,0xcd,0xa8,0xad,0x5b,0x50,0x5f,0x59,0x5e,
+    0xd1,0xa8,0x0b,0x9a,0x11,0xac,0x8b,0x8a,0x88,0x8c,
+    0x1c,0xa2,0x1b,0x53,0x5b,0x5b,0x5e,0x55,0xaa,0x4b,
+    0xac,0xad,0xaf,0xab,0xad,0x2f,0x6a,0xac,0xac,0xad,
+    0x09,0x83,0x1f,0x5d,0xca,0x45,0x0d,0x61,0x57,0xa3,
+    0x6e,0x6a,0x51,0x4d,0xe9,0x2c,0xdd,0xd8,0xda,0x9a,
+    0xc6,0xd2,0x32,0x5d,0xd0,0x02,0xf6,0x2b,0xa1,0xa6,
+    0xb4,0x71,0x6e,0x65,0x03,0xab,0x07,0xa9,0xb0,0xca,
+    0xaa,0xe0,0x09,0x75,0xa5,0x35,0xba,0x49,0x45,0x35,
+    0x0d,0xba,0xd4,0xd2,0xe2,0xfa,0xd2,0x79,0x00,0xae,
+    0xa6,0xa4,0xb4,0xa6,0x01,0xa8,0x48,0x67,0x40,0x2d,
+    0xa5,0xe5,0x73,0xaa,0x8a,0xea,0xa3,0xc2,0x22,0x22,
+    0x22,0xe3,0xd8,0xd7,0xe5,0xe2,0x58,0x0d,0x56,0x41,
+    0x2c,0x6f,0x2f,0x1e,0xca,0x8b,0x67,0x97,0xd6,0x33,
+    0xe8,0x3a,0xb1,0x7c,0xe6,0x24,0x5d,0x44,0x84,0x98,
+    0xac,0xa8,0x6d,0x9c,0x51,0x5b,0x33,0x57,0x17,0x19,
+    0x16,0x11,0x66,0x8e,0x88,0xab,0x2e,0x9a,0x55,0x5a,
+    0xdb,0x58,0x16,0x56,0x55,0x59,0x1c,0x15,0x66,0x0a,
+    0x33,0x0d,0x35,0x46,0xc5,0xde,0x13,0x70,0x07,0x9d,
+    0x95,0x0d,0xba,0x22,0x5d,0x63,0x7d,0x51,0x49,0x69,
+    0x75,0x51,0xfd,0x2c,0x5d,0x6d,0x99,0x8d,0x2b,0x45,
+    0x35,0x25,0xba,0xea,0xa2,0x05,0xba,0xe2,0x52,0x5d,
+    0x7d,0x69,0x79,0x65,0x43,0x63,0x69,0x3d,0xb4,0xa2,
+    0xb2,0x46,0x37,0xa3,0xb4,0xbe,0xb1,0x08,0xe2,0x99,
+    0x73,0xea,0x2b,0x1b,0x4a,0x2a,0x67,0x30,0xbe,0x35,
+    0x84,0x8d,0x6a,0x98,0x51,0x0a,0x28,0xea,0x1d,0xb9,
+    0x39,0xa4,0x13,0xd3,0x2a,0x1a,0x1b,0xeb,0x86,0x85,
+    0x87,0xcf,0x9b,0x37,0x2f,0xac,0x48,0x2a,0x3c,0x03,
+    0xca,0x86,0xcd,0xa8,0xad,0x0e,0xd7,0x39,0xdc,0x2c,
+    0xe3,0xa5,0x59,0xf6,0xbd,0x6a,0x34,0x2e,0xa8,0x2b,
+    0x2d,0x29,0x6d,0xa8,0x2c,0xaf,0x01,0x1e,0x85,0x55,
+    0x34,0x56,0x57,0x75,0xc6,0x96,0x5e,0x39,0x43,0xe4,
+    0xfb,0x1c,0x4e,0x55,0x63,0x45,0xa9,0x6e,0x54,0x5d,
+    0xd1,0x0c,0x88,0xa4,0x3b,0x43,0x74,0x0e,0xdc,0x75,
+    0xc4,0xc4,0x4b,0x85,0xd5,0xd6,0x97,0x87,0x57,0x89,
+    0x25,0x1b,0xc2,0xd3,0xc7,0x26,0x26,0x67,0x4c,0x4a,
+    0x0e,0x85,0x92,0x77,0xef,0x61,0xce,0x58,0x94,0x84,
+    0x2a,0x41,0x8b,0x54,0xa2,0x46,0x08,0x0b,0x51,0x29,
+    0x2a,0x81,0xb1,0x54,0x82,0x8a,0xe0,0x77,0x11,0xa4,
+    0x66,0xa0,0x5a,0x54,0x87,0x16,0xa0,0x7a,0x5e,0xaa,
+    0x02,0x72,0x75,0x30,0xf6,0x67,0xa0,0x60,0x88,0xa3,
+    0xf8,0xd7,0x97,0x22,0xd1,0x10,0x48,0x8f,0x81,0x72,
+    0xb5,0x50,0xa2,0x0a,0x20,0xe8,0x50,0x22,0xa4,0xeb,
+    0xa1,0x1e,0xbb,0x16,0x71,0xc8,0xb5,0xa8,0x06,0xd6,
+    0x93,0xe2,0x9d,0x7b,0xc3,0x8b,0xe2,0xf0,0xc4,0xb4,
+    0x11,0x52,0x53,0x01,0x42,0x0d,0x40,0x9d,0x05,0xe9,
+    0xb1,0x1c,0x4e,0x23,0xff,0x92,0x12,0xab,0xb7,0xc0,
+    0x7e,0x2f,0x81,0xc7,0x8d,0x68,0x2e,0xc0,0x6d,0xb0,
+    0xe3,0x13,0xf3,0xc2,0xe0,0x77,0x15,0x60,0x98,0x00,
+    0x98,0x4b,0x21,0x4f,0x87,0x26,0xf1,0x7a,0x0d,0x90,
+    0x4a,0x85,0x9c,0x62,0xa0,0xa6,0x14,0xcd,0x93,0xa8,
+    0xab,0x81,0xd6,0x97,0xf2,0xbb,0x22,0x2f,0xd2,0xed,
+    0x94,0x5a,0x20,0xa7,0x1c,0xf4,0x4c,0x15,0xd4,0xae,
+    0x07,0x0a,0xc3,0x80,0x46,0x46,0x65,0x1c,0x9a,0x8c,
+    0xc6,0xa1,0x29,0x28,0x03,0x52,0x36,0x1c,0x36,0x0c,
+    0x8e,0xf0,0xbb,0x43,0x0f,0x75,0x80,0x9e,0x0d,0x39,
+    0xf5,0x76,0xda,0x75,0x9d,0xe0,0x67,0x02,0x3c,0x1d,
+    0xff,0xe5,0x98,0x5b,0x01,0x25,0x1b,0x79,0x0f,0xd5,
+    0x40,0xbb,0x75,0x90,0xc7,0xee,0x85,0x21,0x33,0x5c,
+    0xe3,0x50,0x35,0x50,0x30,0x0b,0x60,0xb2,0x32,0x65,
+    0x90,0x5b,0x05,0x90,0x8b,0x79,0x7d,0x13,0x0f,0x43,
+    0x81,0xbb,0x51,0x28,0xf6,0xff,0x82,0xe2,0x9e,0xf8,
+    0x59,0xc9,0xaf,0x4c,0x72,0x1a,0x79,0xdf,0xb3,0xba,
+    0xd5,0x9c,0x5f,0xac,0xff,0x6a,0x79,0xbf,0x75,0x96,
+    0x95,0x22,0x8e,0x41,0xc7,0x4b,0x2d,0x80,0xb8,0x98,
+    0xe7,0xd6,0x73,0x5e,0x33,0x68,0x8d,0x9c,0x2f,0x62,
+    0x5f,0x54,0x72,0x6c,0x33,0x78,0x0e,0x93,0x4f,0xf1,
+    0xf7,0x4c,0xe8,0x93,0x7a,0x5e,0xb6,0x04,0xae,0x33,
+    0xec,0xf2,0xd6,0x00,0xed,0x1c,0x05,0xd7,0x19,0x9c,
+    0xca,0x12,0x5e,0xeb,0x6e,0xb2,0x39,0xe4,0x1e,0x92,
+    0xc6,0xda,0xda,0x08,0x35,0x86,0xa1,0x70,0xf8,0x37,
+    0x8f,0xff,0x0b,0x83,0xb2,0x9d,0x21,0xcf,0x90,0xe0,
+    0x86,0xf1,0x54,0x35,0x94,0xd4,0xdd,0xa5,0x66,0x99,
+    0x03,0x6c,0x5b,0xe9,0xff,0x29,0x8e,0x46,0xe0,0x59,
+    0x1d,0xe7,0x4e,0x29,0x97,0x9d,0x72,0xde,0x82,0x7a,
+    0xde,0x76,0x06,0xb3,0x1a,0xb8,0x7c,0xaf,0xb6,0xa5,
+    0x73,0x8e,0x39,0xca,0xfb,0x1c,0x07,0x5e,0x35,0x02,
+    0x0c,0xd6,0x1b,0xa3,0x00,0x47,0x11,0x94,0x13,0x7f,
+    0x75,0xae,0xc3,0xa0,0xf7,0x2c,0xbb,0x77,0x6b,0x53,
+    0x07,0xac,0x30,0xde,0x9e,0x72,0xb8,0x5b,0xd5,0x09,
+    0x66,0x03,0xe4,0xa4,0x03,0x9d,0x89,0x28,0x19,0x46,
+    0xd5,0x24,0xb8,0x86,0x4a,0x30,0xff,0x27,0x63,0xb8,
+    0x43,0x62,0xa5,0x6f,0xd6,0xb5,0xbf,0x82,0xa2,0x7a,
+    0xfc,0x54,0x9d,0x59,0xfc,0xb2,0x1d,0x26,0x30,0x2f,
+    0xff,0x7f,0xfc,0xc5,0x3a,0x2c,0xa0,0x67,0xd0,0x03,
+    0x68,0x05,0x7a,0x03,0x6d,0x42,0x3f,0xa1,0x07,0xf9,
+    0xd7,0xde,0x9e,0x44,0xcf,0xa3,0x5d,0x58,0x86,0xfe,
+    0x85,0xe5,0x68,0x39,0xda,0x88,0x7e,0x47,0x7f,0xa0,
+    0xb5,0x58,0x81,0x56,0xa1,0x93,0xe8,0x2b,0xf4,0x1f,
+    0xb4,0x1d,0xed,0x41,0xff,0x45,0x7f,0xa2,0xdb,0x68,
+    0x27,0x7a,0x11,0xbd,0x8f,0xde,0x45,0xfb,0x80,0xab,
+    0x33,0xd0,0x23,0xc0,0xc1,0xb3,0xc0,0xc7,0xf7,0xd0,
+    0x19,0x74,0x1e,0x7d,0x80,0xce,0xa1,0x0f,0xd1,0x75,
+    0x90,0x9c,0x4f,0xd0,0x47,0xe8,0x02,0x7a,0x09,0x38,
+    0x7b,0x0b,0xad,0x47,0x9f,0xa1,0x4f,0xd1,0x45,0xe0,
+    0xf1,0x2f,0xe8,0x57,0xb4,0x1a,0x46,0x64,0x25,0x48,
+    0x1a,0x93,0xbd,0x1a,0xb4,0x03,0xfa,0x63,0x36,0xf4,
+    0x1a,0x93,0x8f,0x39,0x5c,0x43,0xcf,0x43,0x3f,0xa3,
+    0xf9,0x30,0xd7,0x2c,0x40,0x8b,0x50,0x13,0x5a,0x8c,
+    0x8e,0xa0,0xa7,0xd1,0x52,0xb4,0x04,0xdd,0x87,0x96,
+    0xa1,0x1b,0xe8,0x26,0x3a,0x8a,0x2e,0xa1,0xfd,0xe8,
+    0x65,0xf4,0x1d,0xfa,0x1e,0xbd,0x8e,0x7e,0x40,0x3f,
+    0xa2,0xdd,0xe8,0xdf,0xe8,0x1a,0xfa,0x02,0x7d,0x89,
+    0xae,0xa0,0xab,0xe8,0x32,0xfa,0x1a,0x2b,0xf9,0xd7,
+    0xee,0x5c,0x70,0x2f,0xec,0x8a,0x7b,0x63,0x37,0xdc,
+    0x87,0x7f,0xe9,0xce,0x1d,0x6b,0xb0,0x16,0x7b,0xf0,
+    0x2f,0xde,0xf5,0xc5,0xfd,0xd8,0xab,0x5c,0xf1,0x40,
+    0x3c,0x08,0x7b,0x63,0x1f,0xac,0xc3,0x7a,0xec,0x8b,
+    0x0d,0xd8,0x0f,0xfb,0xe3,0x00,0x1c,0x88,0x83,0x70,
+    0x30,0x1e,0x8c,0x43,0xf0,0x10,0x1c,0x8a,0xc3,0x70,
+    0x38,0x8e,0xc0,0x91,0x38,0x0a,0x16,0x54,0xd1,0xd8,
+    0x84,0x0e,0xa0,0x83,0xe8,0x30,0x7a,0x15,0x6c,0xd9,
+    0x43,0xe8,0x15,0x74,0x1a,0xdd,0x8f,0x4e,0xa0,0x95,
+    0xe8,0x05,0xf4,0x0e,0xfb,0x96,0x1f,0x3a,0x86,0x63,
+    0x40,0x52,0xd6,0xe0,0xa1,0x38,0x16,0x0f,0xc3,0x71,
+    0x78,0x38,0x8e,0xc7,0x23,0xf0,0x48,0x9c,0x80,0x47,
+    0xe1,0xd1,0x38,0x11,0x27,0xe1,0x64,0x9c,0x82,0xc7,
+    0xe0,0x54,0x3c,0x16,0xa7,0xe1,0x71,0x38,0x1d,0x8f,
+    0xc7,0x19,0x78,0x02,0xce,0xc4,0x13,0xb1,0x05,0x4f,
+    0xc2,0x59,0x78,0x32,0xce,0xc6,0x53,0xd0,0x5e,0x92,
+    0x68,0x51,0xce,0xa9,0xa9,0x8c,0x88,0x18,0x15,0x21,
+    0xc5,0x49,0xce,0xb5,0x73,0x61,0x92,0x07,0xa3,0xa1,
+    0x54,0xcc,0x19,0x6d,0xe2,0xb1,0x69,0x74,0x84,0x14,
+    0x47,0x4a,0x71,0x94,0x14,0x1b,0xa5,0x38,0x5a,0x8a,
+    0x6d,0xe5,0x63,0xa4,0xd8,0x2c,0xc5,0x43,0xa5,0x38,
+    0x56,0x8a,0x47,0x49,0xf1,0x68,0x29,0x4e,0x94,0xe2,
+    0x24,0x29,0x4e,0x16,0xe3,0x44,0x09,0x5f,0xa2,0x84,
+    0x2f,0x51,0x82,0x97,0x24,0xd1,0x93,0x24,0xdd,0x4f,
+    0x92,0xee,0x27,0x49,0xf4,0x24,0x49,0xf4,0x24,0x49,
+    0xf4,0x24,0x49,0xf4,0x24,0xd9,0xea,0x4b,0xf4,0x24,
+    0x49,0xf4,0x24,0x49,0xf4,0x24,0x49,0xf4,0x24,0x49,
+    0xf4,0x24,0x49,0xf4,0x24,0x49,0xf4,0x24,0xa5,0x88,
+    0x71,0xb2,0x84,0x3f,0x59,0xc2,0x9f,0x2c,0xe1,0x4f,
+    0x96,0xf0,0x27,0x4b,0xf8,0x93,0x25,0xfc,0xc9,0x12,
+    0xfe,0x64,0x09,0x7f,0xb2,0x84,0x3f,0x59,0xc2,0x9f,
+    0x3c,0xca,0xa9,0x1c,0xec,0xc5,0x86,0x8a,0x8a,0xe2,
+    0x5e,0x90,0x68,0xa8,0x28,0x5a,0x50,0x59,0x5d,0x51,
+    0xcc,0x6e,0x46,0x45,0x8c,0x1a,0x25,0x4b,0x9e,0x53,
+    0x5f,0xcb,0x7e,0xa4,0x8c,0x8e,0x88,0x94,0xe2,0x28,
+    0x31,0x8e,0x1a,0x25,0xc5,0xa3,0x35,0x0d,0x15,0x95,
+    0x35,0x25,0x45,0xe5,0x00,0x85,0xa7,0x6a,0x1b,0x2b,
+    0x8a,0xdd,0x1d,0xf2,0xa4,0xac,0x5e,0x45,0x55,0xa5,
+    0x65,0x75,0x60,0xe2,0x03,0x2e,0x57,0x96,0x9e,0x5d,
+    0x54,0x5d,0xd4,0xd8,0x20,0xfd,0x10,0xcb,0x42,0xa9,
+    0xe2,0xd2,0x46,0x5b,0xba,0x77,0x79,0x65,0x75,0x69,
+    0x95,0xfd,0x57,0x09,0x94,0xb3,0xdf,0x73,0xa9,0x28,
+    0xb5,0x25,0x45,0x3a,0x8c,0xa6,0xde,0x0b,0x81,0xf8,
+    0x1a,0x3b,0xa0,0xc6,0x8e,0xc2,0xbd,0x16,0xd4,0x96,
+    0xd8,0xd2,0xaa,0xb2,0xca,0x9a,0xa2,0xaa,0x59,0x45,
+    0x1d,0x18,0x1d,0xd2,0xbd,0xab,0x8a,0xaa,0x4b,0xed,
+    0x45,0x7b,0x55,0x97,0x56,0xdb,0xd3,0x35,0x73,0xec,
+    0xa0,0xdd,0x1a,0xa0,0xd4,0xac,0x0a,0xdb,0xcf,0x3e,
+    0x1c,0x62,0x9d,0x9d,0x1e,0x97,0x8e,0x64,0xef,0xc6,
+    0x86,0xa2,0x92,0x4a,0x3b,0x8c,0xd9,0xb5,0x76,0x4c,
+    0xae,0x8c,0xe9,0xf6,0x1f,0x1d,0xdc,0x62,0x84,0x17,
+    0xcd,0xed,0xdc,0xb4,0xe8,0xd1,0xca,0xfa,0xa2,0xb2,
+    0x52,0xf8,0x2d,0x7e,0x31,0xbb,0xbd,0x9d,0x9f,0x0e,
+    0xe6,0x6b,0xc0,0x0f,0xaa,0x5f,0x9e,0xcc,0xbf,0xcb,
+    0x5d,0x42,0x27,0xda,0xbf,0xd3,0x8d,0xf9,0xba,0x12,
+    0xb1,0x9d,0x0c,0xf6,0x19,0x30,0xd0,0xea,0xec,0x1d,
+    0xcc,0x9f,0x82,0x2e,0x11,0xd0,0x37,0xf0,0x0f,0xa3,
+    0x6f,0x41,0xc7,0x08,0xe8,0x07,0x18,0xf3,0x18,0xc9,
+    0x1c,0xd6,0xbd,0x08,0x31,0xff,0xc1,0x10,0x84,0x2b,
+    0xc0,0x68,0x86,0x39,0x80,0xbf,0x8d,0xaa,0x5d,0x5c,
+    0x93,0x62,0xb6,0xf0,0xe0,0x5f,0xfc,0xe6,0xbf,0xe0,
+    0x9e,0x58,0x93,0x9d,0x27,0x73,0x65,0x5f,0x99,0x05,
+    0xbd,0xff,0x00,0xe0,0x23,0x1c,0x13,0xe2,0x38,0xdc,
+    0xe0,0x17,0x06,0x3c,0xe2,0xca,0x15,0xa1,0x9c,0xbf,
+    0x0d,0x98,0x7f,0xd3,0xc8,0xc2,0xd3,0x04,0x66,0x02,
+    0x16,0x0b,0x30,0x0b,0xd8,0xf2,0x30,0xfb,0xb2,0x09,
+    0xbb,0xca,0xf2,0x19,0x27,0xd8,0x95,0x7f,0x19,0x74,
+    0x00,0xfa,0x9c,0x54,0xa1,0xab,0x64,0x3e,0x68,0xce,
+    0x1b,0xe8,0x77,0x88,0xef,0x20,0x8a,0x65,0x64,0x3e,
+    0x68,0x4b,0x15,0x49,0x85,0x78,0x31,0xe8,0xc7,0x55,
+    0x10,0x0f,0x04,0x7d,0x18,0x04,0x71,0x18,0x3e,0x83,
+    0xa3,0x59,0x3e,0x89,0xe0,0xf9,0xa7,0x40,0xab,0x7d,
+    0x04,0x71,0x02,0x68,0xb1,0x74,0x88,0x2d,0xc4,0x1b,
+    0x97,0x40,0x9c,0x83,0xf3,0x79,0x3c,0x13,0xd7,0xe1,
+    0xb9,0x1c,0xce,0xfd,0xbc,0xfc,0xc3,0xf8,0x51,0xbc,
+    0x15,0xe2,0x1d,0x78,0x37,0xde,0x0b,0xf1,0x01,0x7c,
+    0x04,0x1f,0xe7,0x70,0xce,0x70,0x38,0x9f,0x91,0x2c,
+    0xfc,0x25,0xc4,0xdf,0xe0,0x9f,0xf0,0x4d,0x88,0xff,
+    0xc4,0x2d,0xc0,0x9c,0xf9,0x44,0x41,0x5c,0x89,0x3b,
+    0xc4,0x7d,0x89,0x37,0xf1,0x83,0x78,0x30,0x89,0x20,
+    0x31,0x10,0x0f,0x27,0xa3,0x19,0x9d,0x24,0x83,0x64,
+    0x91,0x5c,0x52,0x48,0xca,0x48,0x15,0xa9,0x87,0x76,
+    0x60,0xcc,0x3d,0x13,0xa0,0x75,0x8d,0x70,0x7d,0x9c,
+    0xf3,0x7c,0x19,0x6b,0x37,0x1e,0xc0,0x38,0x81,0x53,
+    0x79,0xce,0x7b,0x9c,0x13,0x56,0x9e,0x33,0x89,0xe7,
+    0x8c,0xe5,0x39,0x87,0xf8,0xf5,0x6d,0x9e,0xf3,0x0c,
+    0x4f,0x3b,0x73,0xfe,0x5d,0x11,0xcf,0xf9,0xf1,0xf4,
+    0x1a,0x9e,0x7f,0x8c,0xe7,0x3c,0xc7,0xd3,0x4a,0x41,
+    0x03,0xd7,0x44,0x9c,0x05,0xd0,0x46,0xf0,0xfc,0xe9,
+    0x22,0x1c,0x0e,0x3f,0x9c,0xfb,0x55,0xde,0xe0,0x39,
+    0x1b,0x79,0xce,0x19,0x5e,0xe6,0x75,0x4e,0xd5,0x19,
+    0x9e,0xb3,0x8f,0xe7,0x2c,0xe4,0x39,0xfb,0x58,0x4e,
+    0xfb,0x24,0x3c,0x8d,0xbd,0xa9,0x91,0xd7,0xd2,0xf3,
+    0x32,0x83,0x78,0x99,0xa5,0x3c,0xe7,0x39,0x9e,0x73,
+    0x54,0xfc,0x6a,0x08,0xaf,0x75,0x94,0xe7,0x3c,0xc7,
+    0xdb,0xfe,0x23,0x4f,0xc7,0x32,0x7a,0xd0,0xe3,0xfc,
+    0xee,0x66,0x61,0x02,0x5c,0x5f,0xe6,0xe5,0x1f,0xe2,
+    0x39,0x2f,0xb3,0x9c,0xf6,0x45,0xbc,0x8c,0x96,0xe7,
+    0x0c,0x25,0xe1,0x70,0x5d,0x28,0x3e,0x8d,0x20,0xd2,
+    0x8f,0x8b,0x10,0x26,0x53,0x78,0xce,0x8b,0xbc,0xcc,
+    0x72,0x0e,0xf9,0x47,0x9e,0x93,0xc8,0xcb,0x7c,0xc9,
+    0x72,0x88,0x2b,0xcf,0x99,0xc5,0x72,0x88,0x2b,0x7b,
+    0x0f,0xb6,0xb0,0x83,0x97,0x7f,0x83,0xe7,0x97,0x88,
+    0x69,0x51,0x12,0x1d,0xc6,0xce,0x40,0xf6,0xf5,0xe5,
+    0x2e,0x63,0x87,0xff,0xfd,0x6f,0x4e,0x7e,0xfc,0x97
 };
 
@@ -1,3245 +1,1863 @@
-//this file was auto-generated from "opensans_hebrew_condensed_regular.ttf" by res2h
+//this file was auto-generated from "opensans_hebrew_condensed_regular.ttf" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t opensans_hebrew_condensed_regular_ttf_size = 32364;
-const unsigned char opensans_hebrew_condensed_regular_ttf_data[32364] = {
-    0x00,0x01,0x00,0x00,0x00,0x11,0x01,0x00,0x00,0x04,
-    0x00,0x10,0x44,0x53,0x49,0x47,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x7e,0x64,0x00,0x00,0x00,0x08,0x46,0x46,
-    0x54,0x4d,0x67,0x93,0xcc,0x09,0x00,0x00,0x79,0x84,
-    0x00,0x00,0x00,0x1c,0x47,0x44,0x45,0x46,0x04,0xf1,
-    0x03,0x96,0x00,0x00,0x79,0xa0,0x00,0x00,0x00,0x38,
-    0x47,0x50,0x4f,0x53,0x27,0x89,0xa7,0x91,0x00,0x00,
-    0x79,0xd8,0x00,0x00,0x04,0x6c,0x47,0x53,0x55,0x42,
-    0x68,0x95,0x62,0x93,0x00,0x00,0x7e,0x44,0x00,0x00,
-    0x00,0x20,0x4f,0x53,0x2f,0x32,0x7f,0xef,0xcd,0xa7,
-    0x00,0x00,0x01,0x98,0x00,0x00,0x00,0x60,0x63,0x6d,
-    0x61,0x70,0xc6,0x3a,0x2e,0x6a,0x00,0x00,0x06,0xd0,
-    0x00,0x00,0x03,0x4e,0x67,0x61,0x73,0x70,0x00,0x00,
-    0x00,0x10,0x00,0x00,0x79,0x7c,0x00,0x00,0x00,0x08,
-    0x67,0x6c,0x79,0x66,0xd6,0x72,0x55,0xa8,0x00,0x00,
-    0x0c,0x98,0x00,0x00,0x63,0x74,0x68,0x65,0x61,0x64,
-    0x02,0x27,0x83,0x65,0x00,0x00,0x01,0x1c,0x00,0x00,
-    0x00,0x36,0x68,0x68,0x65,0x61,0x0d,0x24,0x05,0x2e,
-    0x00,0x00,0x01,0x54,0x00,0x00,0x00,0x24,0x68,0x6d,
-    0x74,0x78,0xbf,0x6a,0x52,0x02,0x00,0x00,0x01,0xf8,
-    0x00,0x00,0x04,0xd8,0x6c,0x6f,0x63,0x61,0x7b,0x16,
-    0x62,0x24,0x00,0x00,0x0a,0x28,0x00,0x00,0x02,0x6e,
-    0x6d,0x61,0x78,0x70,0x01,0x7f,0x00,0x43,0x00,0x00,
-    0x01,0x78,0x00,0x00,0x00,0x20,0x6e,0x61,0x6d,0x65,
-    0x78,0xf3,0xd2,0xfd,0x00,0x00,0x70,0x0c,0x00,0x00,
-    0x03,0xa8,0x70,0x6f,0x73,0x74,0xa5,0x58,0x36,0xcf,
-    0x00,0x00,0x73,0xb4,0x00,0x00,0x05,0xc8,0x70,0x72,
-    0x65,0x70,0x68,0x06,0x8c,0x85,0x00,0x00,0x0a,0x20,
-    0x00,0x00,0x00,0x07,0x00,0x01,0x00,0x00,0x00,0x02,
-    0x00,0x41,0x97,0x7a,0xdb,0x67,0x5f,0x0f,0x3c,0xf5,
-    0x02,0x0b,0x08,0x00,0x00,0x00,0x00,0x00,0xcd,0xc1,
-    0x1c,0x70,0x00,0x00,0x00,0x00,0xcd,0xc1,0x1c,0x70,
-    0xfe,0x70,0xfd,0xd4,0x07,0x17,0x07,0x73,0x00,0x00,
-    0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x01,0x00,0x00,0x07,0x9a,0xfe,0x00,0x00,0x00,
-    0x07,0x65,0xfe,0x70,0xfe,0x92,0x07,0x17,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x36,0x00,0x01,0x00,0x00,
-    0x01,0x36,0x00,0x40,0x00,0x07,0x00,0x00,0x00,0x00,
-    0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,
-    0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
-    0x03,0x4c,0x01,0x90,0x00,0x03,0x00,0x08,0x05,0x33,
-    0x04,0xcc,0x00,0x00,0x00,0x99,0x05,0x33,0x04,0xcc,
-    0x00,0x00,0x02,0xcc,0x00,0x32,0x02,0x66,0x00,0x00,
-    0x00,0x00,0x05,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x08,0x03,0x40,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x4b,0x57,0x4e,
-    0x00,0x40,0x00,0x0d,0xfb,0x4b,0x06,0x00,0xfe,0x00,
-    0x01,0x9a,0x07,0x9a,0x02,0x00,0x20,0x00,0x00,0x21,
-    0x00,0x00,0x00,0x00,0x04,0x46,0x05,0xb6,0x00,0x00,
-    0x00,0x20,0x00,0x04,0x02,0xee,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x02,0xaa,0x00,0x00,0x02,0x14,0x00,0x00,
-    0x01,0xa9,0x00,0x00,0x01,0xe5,0x00,0x87,0x02,0xf9,
-    0x00,0x81,0x03,0xb5,0x00,0x26,0x03,0x5e,0x00,0x57,
-    0x05,0x2a,0x00,0x54,0x03,0xb7,0x00,0x3f,0x01,0xab,
-    0x00,0x81,0x02,0x56,0x00,0x5e,0x02,0x56,0x00,0x4a,
-    0x03,0x2d,0x00,0x50,0x03,0x54,0x00,0x4b,0x01,0xd1,
-    0x00,0x45,0x02,0x2f,0x00,0x3b,0x01,0xd1,0x00,0x7e,
-    0x02,0xef,0x00,0x27,0x03,0x5e,0x00,0x53,0x03,0x5e,
-    0x00,0x85,0x03,0x5e,0x00,0x4a,0x03,0x5e,0x00,0x47,
-    0x03,0x5e,0x00,0x25,0x03,0x5e,0x00,0x5f,0x03,0x5e,
-    0x00,0x5b,0x03,0x5e,0x00,0x41,0x03,0x5e,0x00,0x48,
-    0x03,0x5e,0x00,0x4d,0x01,0xd1,0x00,0x7e,0x01,0xd1,
-    0x00,0x45,0x03,0x54,0x00,0x4b,0x03,0x54,0x00,0x4b,
-    0x03,0x54,0x00,0x49,0x02,0x85,0x00,0x1f,0x05,0x24,
-    0x00,0x62,0x03,0x8a,0x00,0x00,0x03,0xb6,0x00,0x95,
-    0x03,0x79,0x00,0x66,0x04,0x14,0x00,0x95,0x03,0x30,
-    0x00,0x96,0x02,0xfd,0x00,0x96,0x04,0x3f,0x00,0x66,
-    0x04,0x2f,0x00,0x96,0x01,0xe3,0x00,0xa6,0x01,0xbc,
-    0xff,0x91,0x03,0x80,0x00,0x95,0x02,0xec,0x00,0x96,
-    0x05,0xb9,0x00,0x95,0x04,0x81,0x00,0x96,0x04,0x5c,
-    0x00,0x66,0x03,0x77,0x00,0x95,0x04,0x5c,0x00,0x66,
-    0x03,0x99,0x00,0x96,0x03,0x35,0x00,0x50,0x03,0x00,
-    0x00,0x12,0x04,0x22,0x00,0x8b,0x03,0x6c,0x00,0x00,
-    0x05,0xbe,0x00,0x0c,0x03,0x1f,0x00,0x0d,0x03,0x09,
-    0x00,0x00,0x02,0xd0,0x00,0x34,0x02,0x86,0x00,0xa0,
-    0x02,0xef,0x00,0x27,0x02,0x86,0x00,0x41,0x03,0x8c,
-    0x00,0x1d,0x03,0x1a,0xff,0xfc,0x04,0x62,0x01,0x89,
-    0x03,0x49,0x00,0x46,0x03,0xa6,0x00,0x86,0x02,0xa4,
-    0x00,0x58,0x03,0xa6,0x00,0x57,0x03,0x51,0x00,0x58,
-    0x01,0xf9,0x00,0x16,0x03,0x25,0x00,0x1d,0x03,0x9d,
-    0x00,0x86,0x01,0xa6,0x00,0x7a,0x01,0xa7,0xff,0xea,
-    0x03,0x1b,0x00,0x86,0x01,0xa3,0x00,0x86,0x05,0x75,
-    0x00,0x86,0x03,0x9d,0x00,0x86,0x03,0x87,0x00,0x57,
-    0x03,0xa6,0x00,0x86,0x03,0xa6,0x00,0x57,0x02,0x5a,
-    0x00,0x86,0x02,0xad,0x00,0x46,0x02,0x08,0x00,0x27,
-    0x03,0x9d,0x00,0x80,0x02,0xe3,0x00,0x06,0x04,0xd9,
-    0x00,0x14,0x02,0xea,0x00,0x1c,0x02,0xe3,0x00,0x06,
-    0x02,0x5c,0x00,0x35,0x02,0xe1,0x00,0x51,0x03,0x7b,
-    0x01,0x7b,0x02,0xe1,0x00,0x50,0x03,0x54,0x00,0x70,
-    0x02,0x14,0x00,0x00,0x01,0xe5,0x00,0x87,0x03,0x5e,
-    0x00,0xa1,0x03,0x5e,0x00,0x4f,0x04,0x67,0x00,0x71,
-    0x03,0x5e,0x00,0x49,0x03,0x7b,0x01,0x7b,0x02,0xf3,
-    0x00,0x52,0x04,0x67,0x01,0x36,0x06,0xa3,0x00,0x61,
-    0x02,0x64,0x00,0x39,0x03,0xb6,0x00,0x4f,0x03,0x54,
-    0x00,0x4b,0x02,0x2f,0x00,0x3b,0x06,0xa3,0x00,0x61,
-    0x03,0x86,0xff,0xf9,0x03,0x5e,0x00,0x76,0x03,0x54,
-    0x00,0x4b,0x02,0x7e,0x00,0x32,0x02,0x7e,0x00,0x32,
-    0x04,0x62,0x01,0x89,0x03,0xa0,0x00,0x82,0x03,0xed,
-    0x00,0x79,0x01,0xd1,0x00,0x7e,0x01,0xc1,0x00,0x1f,
-    0x02,0x7e,0x00,0x4c,0x02,0x80,0x00,0x43,0x03,0xb6,
-    0x00,0x4f,0x05,0xcd,0x00,0x36,0x05,0xcd,0x00,0x36,
-    0x05,0xcd,0x00,0x33,0x02,0x85,0x00,0x31,0x03,0x8a,
-    0x00,0x00,0x03,0x8a,0x00,0x00,0x03,0x8a,0x00,0x00,
-    0x03,0x8a,0x00,0x00,0x03,0x8a,0x00,0x00,0x03,0x8a,
-    0x00,0x00,0x04,0xdb,0x00,0x00,0x03,0x79,0x00,0x66,
-    0x03,0x30,0x00,0x96,0x03,0x30,0x00,0x96,0x03,0x30,
-    0x00,0x96,0x03,0x30,0x00,0x96,0x01,0xe3,0xff,0xd9,
-    0x01,0xe3,0x00,0x9e,0x01,0xe3,0xff,0xde,0x01,0xe3,
-    0xff,0xf5,0x04,0x14,0x00,0x28,0x04,0x81,0x00,0x96,
-    0x04,0x5c,0x00,0x66,0x04,0x5c,0x00,0x66,0x04,0x5c,
-    0x00,0x66,0x04,0x5c,0x00,0x66,0x04,0x5c,0x00,0x66,
-    0x03,0x54,0x00,0x45,0x04,0x5c,0x00,0x66,0x04,0x22,
-    0x00,0x8b,0x04,0x22,0x00,0x8b,0x04,0x22,0x00,0x8b,
-    0x04,0x22,0x00,0x8b,0x03,0x09,0x00,0x00,0x03,0x77,
-    0x00,0x95,0x03,0x95,0x00,0x86,0x03,0x49,0x00,0x46,
-    0x03,0x49,0x00,0x46,0x03,0x49,0x00,0x46,0x03,0x49,
-    0x00,0x46,0x03,0x49,0x00,0x46,0x03,0x49,0x00,0x46,
-    0x05,0x29,0x00,0x46,0x02,0xa4,0x00,0x58,0x03,0x51,
-    0x00,0x58,0x03,0x51,0x00,0x58,0x03,0x51,0x00,0x58,
-    0x03,0x51,0x00,0x58,0x01,0xa6,0xff,0xc6,0x01,0xa6,
-    0x00,0x71,0x01,0xa6,0xff,0xbf,0x01,0xa6,0xff,0xd7,
-    0x03,0x8b,0x00,0x57,0x03,0x9d,0x00,0x86,0x03,0x87,
-    0x00,0x57,0x03,0x87,0x00,0x57,0x03,0x87,0x00,0x57,
-    0x03,0x87,0x00,0x57,0x03,0x87,0x00,0x57,0x03,0x54,
-    0x00,0x4a,0x03,0x87,0x00,0x54,0x03,0x9d,0x00,0x80,
-    0x03,0x9d,0x00,0x80,0x03,0x9d,0x00,0x80,0x03,0x9d,
-    0x00,0x80,0x02,0xe3,0x00,0x06,0x03,0xa6,0x00,0x86,
-    0x02,0xe3,0x00,0x06,0x01,0xa6,0x00,0x87,0x05,0x17,
-    0x00,0x66,0x05,0x8a,0x00,0x57,0x03,0x35,0x00,0x50,
-    0x02,0xad,0x00,0x46,0x03,0x09,0x00,0x00,0x02,0xd0,
-    0x00,0x34,0x02,0x5c,0x00,0x26,0x03,0x5e,0x00,0x45,
-    0x04,0x7e,0x01,0x2a,0x04,0x7e,0x01,0x2a,0x04,0x7b,
-    0x01,0x44,0x01,0xbe,0x00,0x83,0x04,0x88,0x01,0x6d,
-    0x01,0x8a,0x00,0x25,0x04,0x7e,0x01,0x10,0x04,0x85,
-    0x00,0xf4,0x00,0x00,0xff,0xba,0x00,0x00,0xfe,0x70,
-    0x00,0x00,0xfe,0xb6,0x00,0x00,0xfe,0xbb,0x00,0x00,
-    0xff,0xb9,0x00,0x00,0xff,0x14,0x00,0x00,0xff,0x16,
-    0x00,0x00,0xff,0x34,0x00,0x00,0xff,0x2f,0x00,0x00,
-    0xff,0xb9,0x00,0x00,0xff,0xb9,0x00,0x00,0xff,0x6d,
-    0x00,0x00,0xff,0xba,0x00,0x00,0xff,0xcd,0x02,0x2f,
-    0x00,0x3b,0x00,0x00,0xff,0xba,0x00,0x00,0xff,0xba,
-    0x00,0x00,0xff,0x34,0x03,0x5b,0x00,0x44,0x03,0x2a,
-    0x00,0x5d,0x02,0xbb,0x00,0x59,0x02,0xdd,0x00,0x14,
-    0x03,0xbc,0x00,0x86,0x01,0xa4,0x00,0x86,0x01,0xe1,
-    0x00,0x81,0x03,0xbc,0x00,0x86,0x03,0xa7,0x00,0x5f,
-    0x01,0x9e,0x00,0x83,0x02,0xd7,0x00,0x2d,0x02,0xaf,
-    0x00,0x2d,0x02,0xa6,0x00,0x2c,0x03,0xbc,0x00,0x86,
-    0x03,0xa5,0x00,0x35,0x01,0xa8,0x00,0x58,0x02,0x69,
-    0x00,0x28,0x03,0x9e,0x00,0x57,0x03,0x78,0x00,0x41,
-    0x03,0xaf,0x00,0x50,0x03,0x87,0x00,0x51,0x02,0xdb,
-    0x00,0x03,0x03,0x45,0x00,0x3a,0x03,0x98,0x00,0x8d,
-    0x02,0xcf,0x00,0x1d,0x04,0x68,0x00,0x40,0x03,0xb4,
-    0x00,0x15,0x01,0x5e,0x00,0x23,0x02,0xab,0x00,0x23,
-    0x03,0xef,0x00,0x4e,0x07,0x65,0x00,0x4e,0x01,0x5e,
-    0x00,0x23,0x01,0x5e,0x00,0x23,0x01,0xd1,0x00,0x45,
-    0x02,0xaa,0x00,0x23,0x02,0xaa,0x00,0x23,0x02,0xff,
-    0x00,0x26,0x03,0xa2,0x00,0x78,0x03,0xa2,0x00,0x74,
-    0x02,0xfb,0x00,0x91,0x05,0x74,0x00,0x7e,0x07,0x57,
-    0x00,0x53,0x02,0x2f,0x00,0x4f,0x02,0x2f,0x00,0x4f,
-    0x00,0xf5,0xfe,0xbe,0x05,0x02,0x00,0x8d,0x03,0x5e,
-    0x00,0x24,0x05,0x90,0x00,0x0d,0x03,0x9f,0x00,0x16,
-    0x03,0x9d,0x00,0x16,0x04,0x68,0x00,0x40,0x04,0x68,
-    0x00,0x25,0x04,0x68,0x00,0x40,0x04,0x68,0x00,0x25,
-    0x03,0x5b,0x00,0x44,0x03,0x5b,0x00,0x44,0x03,0x5b,
-    0x00,0x44,0x03,0x2a,0x00,0x5d,0x02,0xbb,0x00,0x59,
-    0x02,0xdd,0x00,0x14,0x03,0xbc,0x00,0x86,0x01,0xa4,
-    0xff,0xab,0x01,0xe1,0xff,0xd5,0x03,0xa7,0x00,0x5f,
-    0x01,0x9e,0xff,0xd6,0x02,0xd7,0x00,0x2d,0x02,0xaf,
-    0x00,0x2d,0x02,0xa6,0x00,0x2b,0x03,0xa5,0x00,0x35,
-    0x02,0x69,0x00,0x28,0x03,0x9e,0x00,0x57,0x03,0xaf,
-    0x00,0x50,0x03,0x87,0x00,0x51,0x03,0x45,0x00,0x3a,
-    0x03,0x98,0x00,0x8d,0x02,0xcf,0x00,0x1d,0x04,0x68,
-    0x00,0x40,0x03,0xb4,0x00,0x15,0x01,0xa4,0x00,0x64,
-    0x00,0x00,0xff,0x12,0x00,0x00,0x00,0x03,0x00,0x00,
-    0x00,0x03,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x01,0x44,0x00,0x03,0x00,0x01,0x00,0x00,
-    0x00,0x1c,0x00,0x04,0x01,0x28,0x00,0x00,0x00,0x46,
-    0x00,0x40,0x00,0x05,0x00,0x06,0x00,0x0d,0x00,0x7e,
-    0x00,0xff,0x01,0x31,0x01,0x53,0x01,0x61,0x01,0x78,
-    0x01,0x7e,0x01,0x92,0x02,0xc7,0x02,0xdd,0x05,0xbe,
-    0x05,0xc2,0x05,0xc7,0x05,0xea,0x05,0xf4,0x20,0x14,
-    0x20,0x1a,0x20,0x1e,0x20,0x22,0x20,0x26,0x20,0x30,
-    0x20,0x3a,0x20,0x44,0x20,0xaa,0x20,0xac,0x21,0x22,
-    0xfb,0x02,0xfb,0x36,0xfb,0x3c,0xfb,0x3e,0xfb,0x41,
-    0xfb,0x44,0xfb,0x4b,0xff,0xff,0x00,0x00,0x00,0x0d,
-    0x00,0x20,0x00,0xa0,0x01,0x31,0x01,0x52,0x01,0x60,
-    0x01,0x78,0x01,0x7d,0x01,0x92,0x02,0xc6,0x02,0xd8,
-    0x05,0xb0,0x05,0xc1,0x05,0xc7,0x05,0xd0,0x05,0xf3,
-    0x20,0x13,0x20,0x18,0x20,0x1c,0x20,0x20,0x20,0x26,
-    0x20,0x30,0x20,0x39,0x20,0x44,0x20,0xaa,0x20,0xac,
-    0x21,0x22,0xfb,0x01,0xfb,0x2a,0xfb,0x38,0xfb,0x3e,
-    0xfb,0x40,0xfb,0x43,0xfb,0x46,0xff,0xff,0xff,0xf6,
-    0xff,0xe4,0xff,0xc3,0xff,0x92,0xff,0x72,0xff,0x66,
-    0xff,0x50,0xff,0x4c,0xff,0x39,0xfe,0x06,0xfd,0xf6,
-    0xfb,0x24,0xfb,0x22,0xfb,0x1e,0xfb,0x16,0xfb,0x0e,
-    0xe0,0xf0,0xe0,0xed,0xe0,0xec,0xe0,0xeb,0xe0,0xe8,
-    0xe0,0xdf,0xe0,0xd7,0xe0,0xce,0xe0,0x69,0xe0,0x68,
-    0xdf,0xf3,0x06,0x15,0x05,0xee,0x05,0xed,0x05,0xec,
-    0x05,0xeb,0x05,0xea,0x05,0xe9,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,
-    0x02,0x0a,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x04,0x00,0x05,0x00,0x06,0x00,0x07,
-    0x00,0x08,0x00,0x09,0x00,0x0a,0x00,0x0b,0x00,0x0c,
-    0x00,0x0d,0x00,0x0e,0x00,0x0f,0x00,0x10,0x00,0x11,
-    0x00,0x12,0x00,0x13,0x00,0x14,0x00,0x15,0x00,0x16,
-    0x00,0x17,0x00,0x18,0x00,0x19,0x00,0x1a,0x00,0x1b,
-    0x00,0x1c,0x00,0x1d,0x00,0x1e,0x00,0x1f,0x00,0x20,
-    0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,
-    0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,0x00,0x2a,
-    0x00,0x2b,0x00,0x2c,0x00,0x2d,0x00,0x2e,0x00,0x2f,
-    0x00,0x30,0x00,0x31,0x00,0x32,0x00,0x33,0x00,0x34,
-    0x00,0x35,0x00,0x36,0x00,0x37,0x00,0x38,0x00,0x39,
-    0x00,0x3a,0x00,0x3b,0x00,0x3c,0x00,0x3d,0x00,0x3e,
-    0x00,0x3f,0x00,0x40,0x00,0x41,0x00,0x42,0x00,0x43,
-    0x00,0x44,0x00,0x45,0x00,0x46,0x00,0x47,0x00,0x48,
-    0x00,0x49,0x00,0x4a,0x00,0x4b,0x00,0x4c,0x00,0x4d,
-    0x00,0x4e,0x00,0x4f,0x00,0x50,0x00,0x51,0x00,0x52,
-    0x00,0x53,0x00,0x54,0x00,0x55,0x00,0x56,0x00,0x57,
-    0x00,0x58,0x00,0x59,0x00,0x5a,0x00,0x5b,0x00,0x5c,
-    0x00,0x5d,0x00,0x5e,0x00,0x5f,0x00,0x60,0x00,0x61,
-    0x00,0x62,0x00,0x00,0x00,0x87,0x00,0x88,0x00,0x8a,
-    0x00,0x8c,0x00,0x94,0x00,0x99,0x00,0x9f,0x00,0xa4,
-    0x00,0xa3,0x00,0xa5,0x00,0xa7,0x00,0xa6,0x00,0xa8,
-    0x00,0xaa,0x00,0xac,0x00,0xab,0x00,0xad,0x00,0xae,
-    0x00,0xb0,0x00,0xaf,0x00,0xb1,0x00,0xb2,0x00,0xb4,
-    0x00,0xb6,0x00,0xb5,0x00,0xb7,0x00,0xb9,0x00,0xb8,
-    0x00,0xbd,0x00,0xbc,0x00,0xbe,0x00,0xbf,0x01,0x0b,
-    0x00,0x73,0x00,0x65,0x00,0x66,0x00,0x6a,0x01,0x0d,
-    0x00,0x79,0x00,0xa2,0x00,0x71,0x00,0x6c,0x01,0x15,
-    0x00,0x77,0x00,0x6b,0x00,0x00,0x00,0x89,0x00,0x9b,
-    0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x00,0x00,0x68,
-    0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x6d,0x00,0x7d,0x00,0x00,0x00,0xa9,
-    0x00,0xbb,0x00,0x82,0x00,0x64,0x00,0x6f,0x00,0x00,
-    0x00,0xcb,0x00,0x00,0x00,0x00,0x00,0x6e,0x00,0x7e,
-    0x01,0x0e,0x00,0x63,0x00,0x83,0x00,0x86,0x00,0x98,
-    0x00,0xc4,0x00,0xc5,0x01,0x03,0x01,0x04,0x01,0x08,
-    0x01,0x09,0x01,0x05,0x01,0x06,0x00,0xba,0x00,0x00,
-    0x00,0xc2,0x00,0xc8,0x01,0x12,0x01,0x14,0x01,0x10,
-    0x01,0x11,0x01,0x16,0x01,0x17,0x01,0x0c,0x00,0x7a,
-    0x01,0x07,0x01,0x0a,0x01,0x0f,0x00,0x85,0x00,0x8d,
-    0x00,0x84,0x00,0x8e,0x00,0x8b,0x00,0x90,0x00,0x91,
-    0x00,0x92,0x00,0x8f,0x00,0x96,0x00,0x97,0x00,0x00,
-    0x00,0x95,0x00,0x9d,0x00,0x9e,0x00,0x9c,0x00,0xc3,
-    0x00,0xcc,0x00,0xd2,0x00,0x72,0x00,0xce,0x00,0xcf,
-    0x00,0xd0,0x00,0x7b,0x00,0xd3,0x00,0xd1,0x00,0xcd,
-    0x00,0x00,0xb8,0x01,0xff,0x85,0xb0,0x04,0x8d,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x18,0x00,0x2e,0x00,0x66,0x00,0xae,
-    0x00,0xf2,0x01,0x44,0x01,0x52,0x01,0x6e,0x01,0x8a,
-    0x01,0xaa,0x01,0xc2,0x01,0xd4,0x01,0xe2,0x01,0xf2,
-    0x02,0x00,0x02,0x2a,0x02,0x44,0x02,0x76,0x02,0xac,
-    0x02,0xd0,0x03,0x02,0x03,0x36,0x03,0x4a,0x03,0x8a,
-    0x03,0xc0,0x03,0xda,0x03,0xf6,0x04,0x0c,0x04,0x20,
-    0x04,0x34,0x04,0x64,0x04,0xbe,0x04,0xe6,0x05,0x18,
-    0x05,0x3c,0x05,0x5e,0x05,0x78,0x05,0x8e,0x05,0xba,
-    0x05,0xd2,0x05,0xde,0x05,0xfa,0x06,0x1c,0x06,0x2c,
-    0x06,0x56,0x06,0x74,0x06,0x9c,0x06,0xbe,0x06,0xf0,
-    0x07,0x18,0x07,0x4a,0x07,0x5e,0x07,0x7c,0x07,0x98,
-    0x07,0xd6,0x07,0xf4,0x08,0x0a,0x08,0x22,0x08,0x36,
-    0x08,0x44,0x08,0x58,0x08,0x6c,0x08,0x7a,0x08,0x92,
-    0x08,0xc6,0x08,0xf4,0x09,0x16,0x09,0x46,0x09,0x70,
-    0x09,0x94,0x09,0xee,0x0a,0x14,0x0a,0x2e,0x0a,0x52,
-    0x0a,0x70,0x0a,0x7c,0x0a,0xb2,0x0a,0xd4,0x0a,0xf6,
-    0x0b,0x28,0x0b,0x5a,0x0b,0x78,0x0b,0xb2,0x0b,0xd4,
-    0x0b,0xf8,0x0c,0x14,0x0c,0x46,0x0c,0x64,0x0c,0x94,
-    0x0c,0xac,0x0c,0xe0,0x0c,0xee,0x0d,0x1e,0x0d,0x4c,
-    0x0d,0x4c,0x0d,0x66,0x0d,0x8e,0x0d,0xbc,0x0d,0xf8,
-    0x0e,0x24,0x0e,0x38,0x0e,0x92,0x0e,0xb0,0x0f,0x0a,
-    0x0f,0x40,0x0f,0x64,0x0f,0x74,0x0f,0x82,0x0f,0xe4,
-    0x0f,0xf2,0x10,0x14,0x10,0x34,0x10,0x60,0x10,0x94,
-    0x10,0xaa,0x10,0xd0,0x10,0xec,0x10,0xfc,0x11,0x1a,
-    0x11,0x32,0x11,0x52,0x11,0x74,0x11,0xb0,0x11,0xf4,
-    0x12,0x4a,0x12,0x7c,0x12,0xb4,0x12,0xec,0x13,0x2a,
-    0x13,0x70,0x13,0xae,0x13,0xee,0x14,0x18,0x14,0x54,
-    0x14,0x7e,0x14,0xa6,0x14,0xd6,0x15,0x06,0x15,0x24,
-    0x15,0x40,0x15,0x64,0x15,0x88,0x15,0xb2,0x15,0xee,
-    0x16,0x26,0x16,0x5c,0x16,0x9a,0x16,0xde,0x17,0x1c,
-    0x17,0x42,0x17,0x82,0x17,0xb2,0x17,0xe0,0x18,0x14,
-    0x18,0x4a,0x18,0x70,0x18,0x94,0x18,0xd8,0x19,0x1e,
-    0x19,0x62,0x19,0xae,0x1a,0x00,0x1a,0x4c,0x1a,0x9a,
-    0x1a,0xea,0x1b,0x20,0x1b,0x5a,0x1b,0x92,0x1b,0xd2,
-    0x1c,0x12,0x1c,0x30,0x1c,0x4c,0x1c,0x70,0x1c,0x94,
-    0x1c,0xd4,0x1d,0x14,0x1d,0x48,0x1d,0x7a,0x1d,0xb4,
-    0x1d,0xf4,0x1e,0x2e,0x1e,0x50,0x1e,0x92,0x1e,0xc6,
-    0x1e,0xfa,0x1f,0x34,0x1f,0x70,0x1f,0xb0,0x1f,0xe2,
-    0x20,0x28,0x20,0x34,0x20,0x6a,0x20,0xaa,0x20,0xf2,
-    0x21,0x42,0x21,0x70,0x21,0x9c,0x21,0xc8,0x21,0xfa,
-    0x22,0x18,0x22,0x34,0x22,0x4e,0x22,0x60,0x22,0x80,
-    0x22,0xa4,0x22,0xc8,0x22,0xec,0x23,0x02,0x23,0x30,
-    0x23,0x4e,0x23,0x6e,0x23,0x7c,0x23,0x92,0x23,0xb0,
-    0x23,0xbe,0x23,0xce,0x23,0xdc,0x23,0xea,0x24,0x08,
-    0x24,0x16,0x24,0x24,0x24,0x32,0x24,0x40,0x24,0x4e,
-    0x24,0x5e,0x24,0x92,0x24,0xb6,0x24,0xea,0x25,0x06,
-    0x25,0x28,0x25,0x34,0x25,0x50,0x25,0x72,0x25,0xa8,
-    0x25,0xb8,0x25,0xd4,0x26,0x04,0x26,0x24,0x26,0x44,
-    0x26,0x88,0x26,0xa0,0x26,0xcc,0x27,0x0c,0x27,0x38,
-    0x27,0x6a,0x27,0xa8,0x27,0xca,0x27,0xf0,0x28,0x24,
-    0x28,0x40,0x28,0x74,0x28,0xa8,0x28,0xc0,0x28,0xe6,
-    0x28,0xf4,0x29,0x02,0x29,0x14,0x29,0x26,0x29,0x38,
-    0x29,0x56,0x29,0x74,0x29,0x92,0x29,0xae,0x29,0xdc,
-    0x29,0xee,0x2a,0x12,0x2a,0x74,0x2a,0x8a,0x2a,0x9e,
-    0x2a,0xac,0x2a,0xf0,0x2b,0x2a,0x2b,0x56,0x2b,0x8e,
-    0x2b,0xba,0x2b,0xf8,0x2c,0x36,0x2c,0x7c,0x2c,0xc2,
-    0x2c,0xfe,0x2d,0x3e,0x2d,0x7c,0x2d,0xa8,0x2d,0xe4,
-    0x2e,0x08,0x2e,0x32,0x2e,0x48,0x2e,0x6c,0x2e,0xaa,
-    0x2e,0xc2,0x2e,0xe6,0x2f,0x1e,0x2f,0x48,0x2f,0x94,
-    0x2f,0xc8,0x30,0x10,0x30,0x4a,0x30,0x90,0x30,0xbe,
-    0x30,0xfa,0x31,0x1e,0x31,0x5a,0x31,0x96,0x31,0xac,
-    0x31,0xba,0x00,0x00,0x00,0x02,0x00,0x87,0xff,0xec,
-    0x01,0x5d,0x05,0xb6,0x00,0x03,0x00,0x0a,0x00,0x00,
-    0x01,0x23,0x03,0x33,0x02,0x32,0x15,0x14,0x06,0x23,
-    0x22,0x01,0x29,0x6e,0x27,0xbd,0xca,0xd6,0x3a,0x31,
-    0x6b,0x01,0x91,0x04,0x25,0xfb,0x31,0x7d,0x3e,0x40,
-    0x00,0x00,0x00,0x02,0x00,0x81,0x03,0xa6,0x02,0x78,
-    0x05,0xb6,0x00,0x03,0x00,0x07,0x00,0x00,0x01,0x23,
-    0x03,0x33,0x01,0x23,0x03,0x33,0x01,0x09,0x64,0x24,
-    0xa9,0x01,0x2d,0x64,0x24,0xa9,0x03,0xa6,0x02,0x10,
-    0xfd,0xf0,0x02,0x10,0x00,0x00,0x00,0x02,0x00,0x26,
-    0x00,0x00,0x03,0x8e,0x05,0xb6,0x00,0x1b,0x00,0x1f,
-    0x00,0x00,0x01,0x15,0x23,0x03,0x33,0x15,0x23,0x03,
-    0x23,0x13,0x23,0x03,0x23,0x13,0x23,0x35,0x33,0x13,
-    0x23,0x35,0x33,0x13,0x33,0x03,0x33,0x13,0x33,0x03,
-    0x05,0x03,0x33,0x13,0x03,0x8e,0xbe,0x2a,0xb7,0xc7,
-    0x37,0x76,0x39,0xd8,0x38,0x73,0x36,0xaf,0xbf,0x2b,
-    0xba,0xca,0x33,0x75,0x35,0xdb,0x35,0x71,0x33,0xfe,
-    0xa2,0x29,0xd7,0x2c,0x04,0x14,0x79,0xfe,0xa2,0x7d,
-    0xfe,0x40,0x01,0xc0,0xfe,0x40,0x01,0xc0,0x7d,0x01,
-    0x5e,0x79,0x01,0xa2,0xfe,0x5e,0x01,0xa2,0xfe,0x5e,
-    0x79,0xfe,0xa2,0x01,0x5e,0x00,0x00,0x00,0x00,0x03,
-    0x00,0x57,0xff,0x89,0x03,0x07,0x06,0x14,0x00,0x1f,
-    0x00,0x25,0x00,0x2b,0x00,0x00,0x01,0x06,0x07,0x26,
-    0x27,0x11,0x1e,0x01,0x10,0x06,0x07,0x15,0x23,0x35,
-    0x26,0x27,0x35,0x1e,0x01,0x17,0x11,0x26,0x27,0x2e,
-    0x01,0x34,0x36,0x37,0x35,0x33,0x15,0x16,0x04,0x06,
-    0x14,0x16,0x17,0x11,0x12,0x36,0x34,0x26,0x27,0x11,
-    0x02,0xee,0x31,0x02,0x77,0x69,0xa1,0x8b,0xa1,0x8b,
-    0x5d,0xb6,0x71,0x3c,0x9f,0x4c,0x15,0x24,0x82,0x65,
-    0x9f,0x81,0x5d,0x90,0xfe,0xcf,0x4e,0x43,0x4f,0xa6,
-    0x54,0x47,0x56,0x05,0x20,0x7b,0x05,0x38,0x06,0xfe,
-    0x43,0x43,0x9e,0xfe,0xf9,0xb2,0x13,0xeb,0xe5,0x03,
-    0x3d,0x96,0x24,0x2a,0x02,0x01,0xbb,0x08,0x12,0x41,
-    0x95,0xfc,0xb4,0x13,0xb2,0xaf,0x06,0x94,0x67,0x9a,
-    0x5c,0x25,0x01,0x91,0xfc,0x32,0x66,0x91,0x5d,0x27,
-    0xfe,0x75,0x00,0x05,0x00,0x54,0xff,0xed,0x04,0xd6,
-    0x05,0xcb,0x00,0x07,0x00,0x0b,0x00,0x14,0x00,0x1c,
-    0x00,0x25,0x00,0x00,0x12,0x36,0x32,0x16,0x10,0x06,
-    0x22,0x26,0x01,0x23,0x01,0x33,0x05,0x22,0x06,0x10,
-    0x16,0x32,0x36,0x35,0x10,0x00,0x36,0x32,0x16,0x10,
-    0x06,0x22,0x26,0x13,0x22,0x06,0x10,0x16,0x32,0x36,
-    0x35,0x10,0x54,0x74,0xe6,0x77,0x7a,0xe4,0x73,0x01,
-    0x7d,0x7f,0x02,0x05,0x80,0xfd,0x62,0x34,0x2f,0x2f,
-    0x6d,0x30,0x01,0x64,0x75,0xe5,0x76,0x7a,0xe2,0x74,
-    0xe5,0x34,0x2e,0x2f,0x6c,0x30,0x04,0xe2,0xe9,0xe8,
-    0xfe,0x41,0xef,0xeb,0xfc,0xe0,0x05,0xb6,0x5f,0xa5,
-    0xfe,0xa0,0xa5,0xa6,0xb0,0x01,0x54,0xfd,0x43,0xe8,
-    0xe7,0xfe,0x3f,0xed,0xeb,0x02,0x35,0xa4,0xfe,0xa0,
-    0xa5,0xa5,0xb0,0x01,0x54,0x00,0x00,0x00,0x00,0x03,
-    0x00,0x3f,0xff,0xec,0x03,0xb2,0x05,0xcb,0x00,0x20,
-    0x00,0x2a,0x00,0x32,0x00,0x00,0x05,0x22,0x26,0x35,
-    0x34,0x36,0x37,0x2e,0x01,0x35,0x34,0x36,0x32,0x16,
-    0x10,0x06,0x07,0x16,0x12,0x17,0x36,0x37,0x33,0x0e,
-    0x01,0x07,0x13,0x23,0x2e,0x01,0x27,0x0e,0x01,0x03,
-    0x22,0x06,0x14,0x16,0x17,0x3e,0x01,0x35,0x34,0x02,
-    0x06,0x14,0x16,0x33,0x32,0x37,0x03,0x01,0x74,0x91,
-    0xa4,0x67,0x7c,0x49,0x30,0x84,0xde,0x84,0x57,0x66,
-    0x2d,0xa5,0x10,0x38,0x0a,0x8c,0x07,0x44,0x2d,0xa8,
-    0xac,0x0f,0x3b,0x0f,0x46,0x91,0x3b,0x2e,0x33,0x2f,
-    0x27,0x3d,0x32,0xe9,0x3e,0x5c,0x4f,0x7d,0x61,0xfa,
-    0x14,0xcc,0xb7,0x84,0xc1,0x66,0x80,0x96,0x5d,0x92,
-    0xac,0xa3,0xfe,0xf4,0xbe,0x5b,0x4a,0xfe,0xea,0x1a,
-    0x72,0xb2,0x6a,0xed,0x4f,0xfe,0xf9,0x19,0x66,0x19,
-    0x5e,0x4e,0x05,0x58,0x5b,0xa0,0xa0,0x3c,0x3a,0x8e,
-    0x60,0xaf,0xfd,0x23,0x8b,0xde,0x85,0x96,0x01,0xa3,
-    0x00,0x00,0x00,0x01,0x00,0x81,0x03,0xa6,0x01,0x2a,
-    0x05,0xb6,0x00,0x03,0x00,0x00,0x01,0x23,0x03,0x33,
-    0x01,0x09,0x64,0x24,0xa9,0x03,0xa6,0x02,0x10,0x00,
-    0x00,0x01,0x00,0x5e,0xfe,0xbc,0x02,0x0b,0x05,0xb6,
-    0x00,0x0b,0x00,0x00,0x00,0x02,0x10,0x12,0x17,0x23,
-    0x26,0x02,0x10,0x12,0x37,0x33,0x01,0x84,0x8d,0x92,
-    0x80,0x81,0x8f,0x9b,0x9c,0x8e,0x83,0x04,0xf3,0xfe,
-    0x30,0xfe,0x1f,0xfe,0x2a,0xb0,0xa7,0x01,0xcb,0x02,
-    0x05,0x01,0xd7,0xac,0x00,0x00,0x00,0x01,0x00,0x4a,
-    0xfe,0xbc,0x01,0xf8,0x05,0xb6,0x00,0x0b,0x00,0x00,
-    0x00,0x12,0x10,0x02,0x07,0x23,0x36,0x12,0x10,0x02,
-    0x27,0x33,0x01,0x5c,0x9c,0x9b,0x90,0x81,0x82,0x90,
-    0x8c,0x88,0x83,0x05,0x0a,0xfe,0x28,0xfd,0xfd,0xfe,
-    0x35,0xa8,0xb6,0x01,0xd3,0x01,0xe0,0x01,0xcd,0xc4,
-    0x00,0x00,0x00,0x01,0x00,0x50,0x03,0x80,0x02,0xdd,
-    0x06,0x14,0x00,0x0e,0x00,0x00,0x01,0x25,0x17,0x07,
-    0x17,0x07,0x27,0x07,0x27,0x37,0x27,0x37,0x17,0x03,
-    0x33,0x01,0xc8,0x01,0x01,0x14,0xf6,0xa6,0x83,0x73,
-    0x75,0x81,0xa0,0xf1,0x18,0xfd,0x1e,0xa0,0x05,0x08,
-    0x42,0x92,0x0b,0xe9,0x42,0xf4,0xf6,0x44,0xe9,0x0b,
-    0x91,0x41,0x01,0x0c,0x00,0x00,0x00,0x01,0x00,0x4b,
-    0x00,0xfa,0x03,0x09,0x04,0xae,0x00,0x0b,0x00,0x00,
-    0x01,0x21,0x15,0x21,0x11,0x23,0x11,0x21,0x35,0x21,
-    0x11,0x33,0x01,0xe6,0x01,0x23,0xfe,0xdd,0x78,0xfe,
-    0xdd,0x01,0x23,0x78,0x03,0x10,0x7b,0xfe,0x65,0x01,
-    0x9b,0x7b,0x01,0x9e,0x00,0x01,0x00,0x45,0xfe,0xf8,
-    0x01,0x5c,0x00,0xd8,0x00,0x06,0x00,0x00,0x25,0x17,
-    0x06,0x07,0x23,0x12,0x37,0x01,0x4e,0x0e,0x3f,0x6b,
-    0x6d,0x47,0x1d,0xd8,0x17,0xde,0xeb,0x00,0xff,0xe1,
-    0x00,0x01,0x00,0x3b,0x01,0xdf,0x01,0xf4,0x02,0x70,
-    0x00,0x03,0x00,0x00,0x01,0x21,0x35,0x21,0x01,0xf4,
-    0xfe,0x47,0x01,0xb9,0x01,0xdf,0x91,0x00,0x00,0x01,
-    0x00,0x7e,0xff,0xec,0x01,0x53,0x00,0xe7,0x00,0x06,
-    0x00,0x00,0x17,0x22,0x34,0x32,0x15,0x14,0x06,0xe8,
-    0x6a,0xd5,0x39,0x14,0xfb,0x7d,0x3f,0x3f,0x00,0x00,
-    0x00,0x01,0x00,0x27,0x00,0x00,0x02,0xd1,0x05,0xb6,
-    0x00,0x03,0x00,0x00,0x33,0x23,0x01,0x33,0xc0,0x99,
-    0x02,0x15,0x95,0x05,0xb6,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x53,0xff,0xec,0x03,0x08,0x05,0xcb,0x00,0x07,
-    0x00,0x13,0x00,0x00,0x1a,0x01,0x20,0x12,0x10,0x02,
-    0x20,0x02,0x01,0x22,0x02,0x10,0x12,0x33,0x32,0x37,
-    0x36,0x11,0x10,0x02,0x53,0xaa,0x01,0x66,0xa5,0xaa,
-    0xfe,0x96,0xa1,0x01,0x5a,0x65,0x57,0x57,0x65,0x3f,
-    0x28,0x56,0x5c,0x04,0x5c,0x01,0x6f,0xfe,0x96,0xfc,
-    0xfc,0xfe,0x8f,0x01,0x5f,0x03,0xf5,0xfe,0xe1,0xfd,
-    0x74,0xfe,0xe2,0x39,0x78,0x01,0xb4,0x01,0x3f,0x01,
-    0x25,0x00,0x00,0x01,0x00,0x85,0x00,0x00,0x02,0x48,
-    0x05,0xb6,0x00,0x0b,0x00,0x00,0x21,0x23,0x11,0x34,
-    0x37,0x06,0x07,0x06,0x07,0x27,0x01,0x33,0x02,0x48,
-    0x99,0x0a,0x20,0x39,0x5f,0x28,0x54,0x01,0x3d,0x86,
-    0x03,0xeb,0x76,0xb2,0x2b,0x36,0x5a,0x28,0x61,0x01,
-    0x25,0x00,0x00,0x00,0x00,0x01,0x00,0x4a,0x00,0x00,
-    0x03,0x03,0x05,0xcb,0x00,0x1e,0x00,0x00,0x13,0x26,
-    0x27,0x3e,0x01,0x33,0x32,0x16,0x15,0x14,0x06,0x07,
-    0x06,0x07,0x0e,0x01,0x07,0x15,0x21,0x15,0x21,0x35,
-    0x01,0x3e,0x01,0x35,0x34,0x26,0x23,0x22,0x06,0xa8,
-    0x03,0x52,0x50,0x90,0x5e,0x9e,0xb4,0x3e,0x49,0x36,
-    0xa0,0x16,0x67,0x10,0x02,0x0a,0xfd,0x47,0x01,0x1b,
-    0x86,0x5e,0x67,0x5a,0x40,0x66,0x04,0xde,0x03,0x64,
-    0x4a,0x3c,0xc4,0xa7,0x79,0xd7,0x76,0x61,0xe0,0x1e,
-    0x91,0x16,0x08,0x8c,0x77,0x01,0xa4,0xc7,0xe3,0x96,
-    0x5a,0x89,0x2c,0x00,0x00,0x01,0x00,0x47,0xff,0xec,
-    0x02,0xfc,0x05,0xcb,0x00,0x22,0x00,0x00,0x01,0x32,
-    0x16,0x15,0x10,0x07,0x15,0x1e,0x01,0x15,0x14,0x06,
-    0x20,0x27,0x35,0x16,0x33,0x32,0x36,0x10,0x26,0x2b,
-    0x01,0x35,0x33,0x32,0x36,0x34,0x26,0x23,0x22,0x06,
-    0x07,0x27,0x36,0x01,0x8f,0x9b,0xb9,0xf4,0x80,0x8d,
-    0xd4,0xfe,0x9b,0x76,0x82,0x97,0x78,0x82,0x9a,0x91,
-    0x4d,0x50,0x7d,0x94,0x66,0x5d,0x43,0x6d,0x3d,0x52,
-    0x8d,0x05,0xcb,0xbf,0x94,0xfe,0xda,0x53,0x08,0x19,
-    0xb9,0x92,0xc1,0xe6,0x3a,0x99,0x4e,0x99,0x01,0x12,
-    0x96,0x81,0x9e,0xf6,0x7c,0x2f,0x3a,0x67,0x8a,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x25,0x00,0x00,0x03,0x42,
-    0x05,0xc1,0x00,0x0a,0x00,0x12,0x00,0x00,0x01,0x33,
-    0x15,0x23,0x11,0x23,0x11,0x21,0x35,0x01,0x33,0x03,
-    0x11,0x34,0x37,0x23,0x06,0x07,0x03,0x02,0xa8,0x9a,
-    0x9a,0x94,0xfe,0x11,0x01,0xd2,0xb1,0x94,0x09,0x07,
-    0x23,0x4c,0xf4,0x01,0xca,0x87,0xfe,0xbd,0x01,0x43,
-    0x81,0x03,0xfd,0xfc,0x09,0x01,0xe0,0xc7,0x8f,0x62,
-    0xb2,0xfd,0xde,0x00,0x00,0x01,0x00,0x5f,0xff,0xec,
-    0x03,0x03,0x05,0xb6,0x00,0x1e,0x00,0x00,0x37,0x16,
-    0x33,0x32,0x36,0x35,0x34,0x35,0x34,0x26,0x23,0x22,
-    0x07,0x27,0x13,0x21,0x15,0x21,0x03,0x36,0x33,0x1e,
-    0x01,0x17,0x06,0x07,0x0e,0x01,0x07,0x22,0x27,0x5f,
-    0x69,0x6f,0x87,0xa7,0x7e,0x76,0x5c,0x69,0x3e,0x2c,
-    0x02,0x1a,0xfe,0x69,0x1f,0x50,0x50,0xab,0xb8,0x02,
-    0x02,0x5f,0x2f,0xa1,0x69,0xa8,0x62,0xc6,0x49,0xb0,
-    0x9a,0x03,0x04,0x93,0x95,0x1f,0x40,0x02,0x9f,0x8f,
-    0xfe,0x3f,0x12,0x02,0xe7,0xb7,0xc7,0x8b,0x46,0x52,
-    0x02,0x3d,0x00,0x00,0x00,0x02,0x00,0x5b,0xff,0xec,
-    0x03,0x08,0x05,0xca,0x00,0x15,0x00,0x1e,0x00,0x00,
-    0x01,0x32,0x16,0x10,0x02,0x23,0x22,0x02,0x11,0x10,
-    0x12,0x33,0x32,0x17,0x15,0x26,0x23,0x20,0x03,0x33,
-    0x3e,0x01,0x12,0x26,0x22,0x06,0x15,0x14,0x16,0x32,
-    0x36,0x01,0xdd,0x8c,0x9f,0xb6,0x9c,0xaa,0xb1,0xe9,
-    0xed,0x55,0x34,0x3c,0x4b,0xfe,0xcb,0x11,0x09,0x22,
-    0x77,0xdf,0x5d,0xaf,0x6a,0x6b,0xad,0x5e,0x03,0x94,
-    0xf3,0xfe,0x4c,0xfe,0xff,0x01,0x48,0x01,0x3a,0x01,
-    0xb7,0x01,0xa5,0x15,0x8b,0x16,0xfd,0xb0,0x4e,0x56,
-    0xfe,0xd1,0xa9,0x95,0x72,0xbc,0xd5,0xaa,0x00,0x01,
-    0x00,0x41,0x00,0x00,0x03,0x12,0x05,0xb5,0x00,0x06,
-    0x00,0x00,0x13,0x35,0x21,0x15,0x01,0x23,0x01,0x41,
-    0x02,0xd1,0xfe,0x4d,0xa1,0x01,0xb8,0x05,0x27,0x8e,
-    0x73,0xfa,0xbe,0x05,0x27,0x00,0x00,0x00,0x00,0x03,
-    0x00,0x48,0xff,0xec,0x03,0x17,0x05,0xca,0x00,0x13,
-    0x00,0x1c,0x00,0x26,0x00,0x00,0x12,0x36,0x20,0x16,
-    0x15,0x14,0x07,0x1e,0x01,0x15,0x14,0x06,0x20,0x26,
-    0x35,0x34,0x36,0x37,0x26,0x35,0x24,0x26,0x22,0x06,
-    0x14,0x16,0x17,0x3e,0x01,0x00,0x06,0x14,0x16,0x32,
-    0x36,0x35,0x34,0x2f,0x01,0x67,0xb9,0x01,0x26,0xb4,
-    0xe6,0x8c,0x77,0xc3,0xfe,0xbb,0xc7,0x6f,0x7d,0xcd,
-    0x01,0xf9,0x5d,0xa7,0x5c,0x4d,0x62,0x5d,0x54,0xfe,
-    0xd7,0x56,0x71,0xbd,0x6e,0xb9,0x26,0x05,0x0a,0xc0,
-    0xba,0x9e,0xe7,0x8e,0x5f,0xb4,0x7b,0xaa,0xd9,0xcd,
-    0xab,0x83,0xc1,0x52,0x9d,0xd8,0x65,0x74,0x75,0xc9,
-    0x83,0x45,0x3c,0x8f,0xfe,0x68,0x99,0xe6,0x88,0x8e,
-    0x78,0xa6,0x83,0x1b,0x00,0x00,0x00,0x02,0x00,0x4d,
-    0xff,0xec,0x02,0xfa,0x05,0xca,0x00,0x15,0x00,0x1e,
-    0x00,0x00,0x01,0x22,0x26,0x10,0x12,0x20,0x12,0x11,
-    0x10,0x02,0x23,0x22,0x27,0x35,0x16,0x33,0x32,0x12,
-    0x13,0x23,0x0e,0x01,0x12,0x26,0x22,0x06,0x10,0x16,
-    0x32,0x36,0x35,0x01,0x78,0x8c,0x9f,0xb9,0x01,0x46,
-    0xae,0xef,0xeb,0x55,0x3a,0x3d,0x4e,0x99,0xa8,0x0a,
-    0x08,0x22,0x77,0x98,0x69,0xab,0x62,0x5b,0xae,0x6d,
-    0x02,0x20,0xf6,0x01,0xb3,0x01,0x01,0xfe,0xb9,0xfe,
-    0xcc,0xfe,0x50,0xfe,0x4d,0x14,0x8b,0x17,0x01,0x2c,
-    0x01,0x24,0x4e,0x56,0x02,0x4f,0xcf,0xaa,0xfe,0xba,
-    0xa8,0x9f,0x78,0x00,0x00,0x02,0x00,0x7e,0xff,0xec,
-    0x01,0x53,0x04,0x4f,0x00,0x06,0x00,0x0d,0x00,0x00,
-    0x12,0x34,0x32,0x15,0x14,0x06,0x23,0x11,0x22,0x34,
-    0x32,0x15,0x14,0x06,0x7e,0xd5,0x39,0x32,0x6a,0xd5,
-    0x39,0x03,0x55,0xfa,0x7d,0x3e,0x3f,0xfc,0x97,0xfb,
-    0x7d,0x3f,0x3f,0x00,0x00,0x00,0x00,0x02,0x00,0x45,
-    0xfe,0xf8,0x01,0x5b,0x04,0x4f,0x00,0x06,0x00,0x0d,
-    0x00,0x00,0x12,0x32,0x15,0x14,0x06,0x23,0x22,0x13,
-    0x17,0x06,0x07,0x23,0x12,0x37,0x7d,0xd6,0x3a,0x31,
-    0x6b,0xd0,0x0e,0x3d,0x6c,0x6d,0x49,0x1b,0x04,0x4f,
-    0x7d,0x3e,0x40,0xfd,0x83,0x17,0xd8,0xf0,0x01,0x0b,
-    0xd4,0x00,0x00,0x01,0x00,0x4b,0x01,0x05,0x03,0x0a,
-    0x04,0x9f,0x00,0x06,0x00,0x00,0x09,0x02,0x15,0x01,
-    0x35,0x01,0x03,0x0a,0xfd,0xcd,0x02,0x33,0xfd,0x41,
-    0x02,0xbf,0x04,0x11,0xfe,0xc2,0xfe,0xc1,0x8f,0x01,
-    0x9e,0x61,0x01,0x9b,0x00,0x00,0x00,0x02,0x00,0x4b,
-    0x01,0xc3,0x03,0x09,0x03,0xdf,0x00,0x03,0x00,0x07,
-    0x00,0x00,0x01,0x21,0x35,0x21,0x11,0x21,0x35,0x21,
-    0x03,0x09,0xfd,0x42,0x02,0xbe,0xfd,0x42,0x02,0xbe,
-    0x03,0x65,0x7a,0xfd,0xe4,0x7b,0x00,0x01,0x00,0x49,
-    0x01,0x05,0x03,0x09,0x04,0x9f,0x00,0x06,0x00,0x00,
-    0x01,0x15,0x01,0x35,0x09,0x01,0x35,0x03,0x09,0xfd,
-    0x40,0x02,0x34,0xfd,0xcc,0x03,0x04,0x61,0xfe,0x62,
-    0x8f,0x01,0x3f,0x01,0x3e,0x8e,0x00,0x02,0x00,0x1f,
-    0xff,0xed,0x02,0x52,0x05,0xcb,0x00,0x15,0x00,0x1d,
-    0x00,0x00,0x13,0x36,0x20,0x16,0x15,0x14,0x0e,0x02,
-    0x1d,0x01,0x23,0x35,0x34,0x36,0x37,0x3e,0x01,0x34,
-    0x26,0x22,0x07,0x13,0x32,0x16,0x14,0x06,0x23,0x22,
-    0x34,0x1f,0x78,0x01,0x22,0x99,0x3d,0xa5,0x29,0x80,
-    0x2e,0x42,0x53,0x31,0x54,0xa9,0x60,0xad,0x32,0x39,
-    0x39,0x32,0x6a,0x05,0x76,0x55,0xb3,0xa6,0x74,0x94,
-    0xe3,0x6f,0x5b,0x2c,0x39,0x70,0x8e,0x55,0x75,0x83,
-    0xc1,0x6b,0x40,0xfb,0xe6,0x3f,0x7c,0x3f,0xfa,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x62,0xff,0x50,0x04,0xc6,
-    0x05,0xc2,0x00,0x2f,0x00,0x3a,0x00,0x00,0x05,0x22,
-    0x00,0x11,0x10,0x00,0x21,0x32,0x16,0x12,0x10,0x02,
-    0x23,0x22,0x27,0x23,0x0e,0x01,0x23,0x22,0x26,0x35,
-    0x34,0x36,0x33,0x32,0x17,0x03,0x15,0x14,0x16,0x33,
-    0x32,0x11,0x10,0x02,0x23,0x22,0x06,0x02,0x15,0x10,
-    0x12,0x33,0x32,0x37,0x15,0x06,0x03,0x22,0x06,0x15,
-    0x14,0x33,0x32,0x36,0x37,0x13,0x26,0x02,0x7a,0xfe,
-    0xfe,0xe6,0x01,0x48,0x01,0x11,0xa1,0xee,0x7c,0x82,
-    0x7c,0x99,0x0e,0x09,0x17,0x55,0x42,0x64,0x6f,0x9c,
-    0x8c,0x62,0x60,0x14,0x2e,0x2e,0x79,0xd4,0xb2,0x8f,
-    0xd8,0x71,0xd9,0xc2,0x94,0x7b,0x79,0x61,0x47,0x4f,
-    0x63,0x2e,0x32,0x09,0x0f,0x1f,0xb0,0x01,0x8a,0x01,
-    0x6a,0x01,0x9c,0x01,0xe2,0xba,0xfe,0xb4,0xfe,0x2b,
-    0xff,0x00,0xb8,0x5d,0x5b,0xbb,0xaf,0xe4,0xfa,0x21,
-    0xfe,0x26,0x35,0x55,0x4b,0x01,0x88,0x01,0x18,0x01,
-    0x4c,0xc3,0xfe,0xaa,0xdc,0xfe,0xcb,0xfe,0xa4,0x4b,
-    0x7a,0x46,0x04,0x70,0xc1,0xb1,0xef,0x9b,0xa5,0x01,
-    0x18,0x09,0x00,0x02,0x00,0x00,0x00,0x00,0x03,0x89,
-    0x05,0xb7,0x00,0x09,0x00,0x13,0x00,0x00,0x01,0x33,
-    0x16,0x01,0x23,0x03,0x21,0x03,0x23,0x00,0x17,0x27,
-    0x26,0x27,0x0e,0x03,0x07,0x21,0x01,0x63,0xbd,0x3d,
-    0x01,0x2c,0x9d,0x72,0xfe,0x94,0x70,0x9e,0x01,0x26,
-    0xd9,0x20,0x13,0x0b,0x10,0x2d,0x16,0x36,0x0b,0x01,
-    0x2d,0x05,0xb7,0xf7,0xfb,0x40,0x01,0xdc,0xfe,0x24,
-    0x04,0xbc,0xcc,0x8f,0x55,0x56,0x7d,0xca,0x61,0xe4,
-    0x30,0x00,0x00,0x03,0x00,0x95,0x00,0x00,0x03,0x69,
-    0x05,0xb6,0x00,0x0e,0x00,0x16,0x00,0x1e,0x00,0x00,
-    0x13,0x21,0x20,0x11,0x14,0x06,0x07,0x15,0x1e,0x01,
-    0x15,0x14,0x06,0x23,0x21,0x13,0x11,0x33,0x32,0x36,
-    0x35,0x34,0x23,0x03,0x11,0x33,0x32,0x11,0x34,0x26,
-    0x23,0x95,0x01,0x37,0x01,0x7f,0x6e,0x67,0x7c,0x77,
-    0xbb,0xa6,0xfe,0x8d,0x96,0xa5,0x76,0x68,0xe3,0xa0,
-    0xc4,0xda,0x7b,0x73,0x05,0xb6,0xfe,0x9c,0x8c,0xac,
-    0x14,0x08,0x1c,0xaa,0x96,0xc4,0xde,0x05,0x2c,0xfe,
-    0x13,0x81,0x88,0xe4,0xfd,0x8c,0xfd,0xd2,0x01,0x22,
-    0x82,0x8a,0x00,0x01,0x00,0x66,0xff,0xec,0x03,0x4a,
-    0x05,0xcc,0x00,0x13,0x00,0x00,0x05,0x22,0x00,0x10,
-    0x12,0x33,0x32,0x17,0x07,0x26,0x23,0x22,0x02,0x10,
-    0x12,0x33,0x32,0x37,0x15,0x06,0x02,0x44,0xdd,0xfe,
-    0xff,0xfd,0xe4,0x8c,0x77,0x3c,0x5f,0x65,0x97,0xad,
-    0xb0,0x9b,0x75,0x62,0x58,0x14,0x01,0x89,0x02,0xbf,
-    0x01,0x98,0x4a,0x83,0x3f,0xfe,0xb9,0xfd,0xc7,0xfe,
-    0xbb,0x34,0x8c,0x35,0x00,0x02,0x00,0x95,0x00,0x00,
-    0x03,0xae,0x05,0xb6,0x00,0x07,0x00,0x0f,0x00,0x00,
-    0x13,0x21,0x32,0x12,0x10,0x02,0x23,0x21,0x13,0x11,
-    0x33,0x20,0x11,0x10,0x02,0x23,0x95,0x01,0x34,0xea,
-    0xfb,0xfc,0xf8,0xfe,0xdb,0x9c,0x85,0x01,0x57,0xa7,
-    0xa3,0x05,0xb6,0xfe,0x90,0xfd,0x30,0xfe,0x8a,0x05,
-    0x2c,0xfb,0x5e,0x02,0x58,0x01,0x21,0x01,0x29,0x00,
-    0x00,0x00,0x00,0x01,0x00,0x96,0x00,0x00,0x02,0xd2,
-    0x05,0xb6,0x00,0x0b,0x00,0x00,0x01,0x21,0x11,0x21,
-    0x15,0x21,0x11,0x21,0x15,0x21,0x11,0x21,0x02,0xd2,
-    0xfe,0x5f,0x01,0x88,0xfe,0x78,0x01,0xa1,0xfd,0xc4,
-    0x02,0x3c,0x05,0x29,0xfe,0x1a,0x8d,0xfd,0xd8,0x8e,
-    0x05,0xb6,0x00,0x00,0x00,0x01,0x00,0x96,0x00,0x00,
-    0x02,0xd2,0x05,0xb6,0x00,0x09,0x00,0x00,0x01,0x21,
-    0x11,0x21,0x15,0x21,0x11,0x23,0x11,0x21,0x02,0xd2,
-    0xfe,0x5f,0x01,0x89,0xfe,0x77,0x9b,0x02,0x3c,0x05,
-    0x29,0xfd,0xdb,0x8d,0xfd,0x89,0x05,0xb6,0x00,0x01,
-    0x00,0x66,0xff,0xec,0x03,0xd3,0x05,0xcb,0x00,0x18,
-    0x00,0x00,0x01,0x11,0x06,0x23,0x22,0x00,0x10,0x00,
-    0x21,0x32,0x17,0x06,0x07,0x26,0x23,0x22,0x02,0x10,
-    0x12,0x33,0x32,0x37,0x11,0x23,0x35,0x03,0xd3,0xad,
-    0xc0,0xf4,0xfe,0xf4,0x01,0x1d,0x01,0x04,0xaa,0x96,
-    0x32,0x0a,0x86,0x78,0xbc,0xca,0xbc,0xaa,0x75,0x57,
-    0xd0,0x02,0xf9,0xfd,0x39,0x46,0x01,0x8b,0x02,0xc8,
-    0x01,0x8c,0x5d,0x6f,0x14,0x53,0xfe,0xc1,0xfd,0xba,
-    0xfe,0xc0,0x1f,0x01,0xd3,0x8e,0x00,0x01,0x00,0x96,
-    0x00,0x00,0x03,0x99,0x05,0xb6,0x00,0x0b,0x00,0x00,
-    0x21,0x23,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,
-    0x11,0x33,0x03,0x99,0x9c,0xfe,0x34,0x9b,0x9b,0x01,
-    0xcc,0x9c,0x02,0xb5,0xfd,0x4b,0x05,0xb6,0xfd,0x8d,
-    0x02,0x73,0x00,0x00,0x00,0x01,0x00,0xa6,0x00,0x00,
-    0x01,0x3c,0x05,0xb6,0x00,0x03,0x00,0x00,0x21,0x23,
-    0x11,0x33,0x01,0x3c,0x96,0x96,0x05,0xb6,0x00,0x01,
-    0xff,0x91,0xfe,0x7d,0x01,0x2a,0x05,0xb6,0x00,0x0e,
-    0x00,0x00,0x01,0x11,0x16,0x06,0x23,0x22,0x23,0x22,
-    0x27,0x35,0x16,0x32,0x36,0x35,0x11,0x01,0x2a,0x01,
-    0x91,0x80,0x02,0x01,0x51,0x35,0x37,0x85,0x42,0x05,
-    0xb6,0xfa,0x49,0xb8,0xc9,0x19,0x8b,0x14,0x71,0x7a,
-    0x05,0xbd,0x00,0x00,0x00,0x01,0x00,0x95,0x00,0x00,
-    0x03,0x7f,0x05,0xb6,0x00,0x0f,0x00,0x00,0x21,0x23,
-    0x11,0x33,0x11,0x36,0x01,0x33,0x01,0x16,0x00,0x17,
-    0x23,0x02,0x27,0x07,0x01,0x31,0x9c,0x9c,0x2f,0x01,
-    0x64,0xa7,0xfe,0x9b,0x33,0x01,0x00,0x46,0xa9,0xfc,
-    0x3a,0x6f,0x05,0xb6,0xfd,0x0a,0x62,0x02,0x94,0xfd,
-    0x80,0x6f,0xfd,0xd0,0x97,0x02,0x36,0x80,0x88,0x00,
-    0x00,0x00,0x00,0x01,0x00,0x96,0x00,0x00,0x02,0xc2,
-    0x05,0xb6,0x00,0x05,0x00,0x00,0x25,0x21,0x15,0x21,
-    0x11,0x33,0x01,0x31,0x01,0x91,0xfd,0xd4,0x9b,0x8e,
-    0x8e,0x05,0xb6,0x00,0x00,0x01,0x00,0x95,0x00,0x00,
-    0x05,0x22,0x05,0xb6,0x00,0x17,0x00,0x00,0x21,0x23,
-    0x11,0x34,0x37,0x23,0x01,0x23,0x01,0x23,0x16,0x15,
-    0x11,0x23,0x11,0x33,0x01,0x16,0x17,0x33,0x36,0x37,
-    0x01,0x33,0x05,0x22,0x96,0x0b,0x08,0xfe,0xa1,0xac,
-    0xfe,0x9f,0x09,0x0d,0x92,0xeb,0x01,0x21,0x23,0x11,
-    0x08,0x0e,0x29,0x01,0x1e,0xf0,0x04,0x0b,0x61,0xa8,
-    0xfa,0xec,0x05,0x16,0xb5,0x54,0xfb,0xf3,0x05,0xb6,
-    0xfb,0xd7,0x81,0x68,0x55,0x92,0x04,0x2b,0x00,0x01,
-    0x00,0x96,0x00,0x00,0x03,0xec,0x05,0xb6,0x00,0x0f,
-    0x00,0x00,0x21,0x23,0x01,0x23,0x16,0x15,0x11,0x23,
-    0x11,0x33,0x01,0x33,0x26,0x35,0x11,0x33,0x03,0xec,
-    0xc2,0xfd,0xf9,0x0a,0x10,0x93,0xc3,0x02,0x04,0x07,
-    0x0b,0x93,0x04,0xcc,0x80,0x86,0xfc,0x3a,0x05,0xb6,
-    0xfb,0x42,0x97,0x73,0x03,0xb4,0x00,0x00,0x00,0x02,
-    0x00,0x66,0xff,0xec,0x03,0xf5,0x05,0xcb,0x00,0x08,
-    0x00,0x11,0x00,0x00,0x01,0x32,0x12,0x10,0x02,0x20,
-    0x02,0x11,0x10,0x05,0x22,0x02,0x10,0x12,0x20,0x12,
-    0x11,0x10,0x02,0x30,0xdb,0xea,0xeb,0xfe,0x44,0xe8,
-    0x01,0xca,0x94,0x96,0x96,0x01,0x23,0x96,0x05,0xcb,
-    0xfe,0x7a,0xfd,0x2e,0xfe,0x79,0x01,0x87,0x01,0x6c,
-    0x02,0xec,0x8e,0xfe,0xcb,0xfd,0xa8,0xfe,0xca,0x01,
-    0x33,0x01,0x30,0x02,0x60,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x95,0x00,0x00,0x03,0x36,0x05,0xb6,0x00,0x09,
-    0x00,0x11,0x00,0x00,0x13,0x21,0x32,0x16,0x15,0x10,
-    0x21,0x23,0x11,0x23,0x13,0x11,0x33,0x32,0x36,0x10,
-    0x26,0x23,0x95,0x01,0x01,0xd5,0xcb,0xfe,0x57,0x5c,
-    0x9c,0x9c,0x53,0x93,0x82,0x81,0x88,0x05,0xb6,0xd2,
-    0xdc,0xfe,0x3b,0xfd,0xbd,0x05,0x2c,0xfd,0xa1,0x91,
-    0x01,0x41,0x8d,0x00,0x00,0x00,0x00,0x02,0x00,0x66,
-    0xfe,0xa4,0x03,0xf5,0x05,0xcb,0x00,0x10,0x00,0x19,
-    0x00,0x00,0x05,0x22,0x02,0x11,0x10,0x21,0x32,0x12,
-    0x11,0x10,0x02,0x07,0x13,0x23,0x03,0x26,0x06,0x03,
-    0x22,0x02,0x10,0x12,0x20,0x12,0x11,0x10,0x02,0x2d,
-    0xdf,0xe8,0x01,0xca,0xdb,0xea,0x8a,0x84,0xe7,0xbb,
-    0xbf,0x07,0x1a,0x03,0x94,0x96,0x96,0x01,0x23,0x96,
-    0x14,0x01,0x87,0x01,0x6c,0x02,0xec,0xfe,0x7a,0xfe,
-    0x98,0xfe,0xea,0xfe,0x96,0x46,0xfe,0x8d,0x01,0x4b,
-    0x01,0x04,0x05,0x51,0xfe,0xcb,0xfd,0xa8,0xfe,0xca,
-    0x01,0x33,0x01,0x30,0x02,0x60,0x00,0x02,0x00,0x96,
-    0x00,0x00,0x03,0x7b,0x05,0xb6,0x00,0x0d,0x00,0x15,
-    0x00,0x00,0x13,0x33,0x32,0x16,0x15,0x14,0x06,0x07,
-    0x01,0x23,0x01,0x23,0x11,0x23,0x13,0x11,0x33,0x32,
-    0x36,0x10,0x26,0x23,0x96,0xfb,0xd9,0xcd,0x69,0x72,
-    0x01,0x1f,0xaa,0xfe,0xfd,0x9d,0x9b,0x9b,0x73,0x79,
-    0x7c,0x7e,0x8a,0x05,0xb6,0xcc,0xd1,0x96,0xc2,0x32,
-    0xfd,0x71,0x02,0x68,0xfd,0x98,0x05,0x28,0xfd,0xc9,
-    0x92,0x01,0x23,0x82,0x00,0x00,0x00,0x01,0x00,0x50,
-    0xff,0xec,0x02,0xe9,0x05,0xcb,0x00,0x1d,0x00,0x00,
-    0x25,0x32,0x36,0x34,0x26,0x27,0x2e,0x01,0x10,0x36,
-    0x20,0x17,0x06,0x07,0x26,0x22,0x06,0x14,0x16,0x17,
-    0x1e,0x01,0x15,0x14,0x06,0x20,0x27,0x35,0x1e,0x01,
-    0x01,0x6f,0x64,0x7b,0x6e,0x64,0x9f,0x81,0xc7,0x01,
-    0x3c,0x7b,0x13,0x24,0x74,0xc5,0x75,0x56,0x8a,0x92,
-    0x82,0xcb,0xfe,0xa8,0x76,0x3c,0x9c,0x79,0x90,0xcf,
-    0x8b,0x3d,0x59,0xb8,0x01,0x44,0xd6,0x48,0x2d,0x5a,
-    0x3e,0x83,0xd0,0x7b,0x4d,0x4f,0xc2,0x89,0xbb,0xde,
-    0x3a,0xa0,0x23,0x2a,0x00,0x00,0x00,0x01,0x00,0x12,
-    0x00,0x00,0x02,0xec,0x05,0xb6,0x00,0x07,0x00,0x00,
-    0x01,0x21,0x11,0x23,0x11,0x21,0x35,0x21,0x02,0xec,
-    0xfe,0xe1,0x9b,0xfe,0xe0,0x02,0xda,0x05,0x28,0xfa,
-    0xd8,0x05,0x28,0x8e,0x00,0x00,0x00,0x01,0x00,0x8b,
-    0xff,0xec,0x03,0x96,0x05,0xb6,0x00,0x0f,0x00,0x00,
-    0x01,0x11,0x14,0x02,0x20,0x02,0x35,0x11,0x33,0x11,
-    0x14,0x16,0x32,0x36,0x35,0x11,0x03,0x96,0xc4,0xfe,
-    0x81,0xc8,0x9c,0x7a,0xe4,0x76,0x05,0xb6,0xfc,0x33,
-    0xfc,0xfe,0xff,0x01,0x06,0xf8,0x03,0xcc,0xfc,0x25,
-    0xad,0xb3,0xb4,0xad,0x03,0xda,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x03,0x6b,0x05,0xb6,0x00,0x0c,0x00,0x00,
-    0x21,0x23,0x02,0x03,0x33,0x12,0x13,0x16,0x17,0x36,
-    0x37,0x13,0x33,0x02,0x12,0xbb,0x58,0xff,0x9e,0x78,
-    0x67,0x21,0x14,0x13,0x16,0xf2,0x9e,0x01,0x75,0x04,
-    0x41,0xfd,0xe8,0xfe,0x40,0x96,0xa8,0x8f,0x69,0x04,
-    0x1e,0x00,0x00,0x01,0x00,0x0c,0x00,0x00,0x05,0xb0,
-    0x05,0xb6,0x00,0x22,0x00,0x00,0x01,0x02,0x03,0x23,
-    0x03,0x2e,0x05,0x27,0x0f,0x01,0x06,0x07,0x03,0x23,
-    0x02,0x03,0x33,0x12,0x17,0x12,0x17,0x36,0x37,0x13,
-    0x33,0x13,0x16,0x17,0x36,0x37,0x13,0x05,0xb0,0x3a,
-    0xed,0xc0,0x93,0x05,0x17,0x07,0x11,0x0a,0x11,0x0a,
-    0x0c,0x0f,0x2a,0x14,0x90,0xbe,0xda,0x50,0x9d,0x7e,
-    0x2a,0x42,0x06,0x1f,0x12,0xc1,0xa8,0xa5,0x2b,0x22,
-    0x1e,0x19,0xb8,0x05,0xb6,0xfe,0xe4,0xfb,0x66,0x02,
-    0xe5,0x19,0x6c,0x23,0x5a,0x48,0x78,0x4d,0x58,0x5f,
-    0xe6,0x72,0xfd,0x1b,0x04,0x32,0x01,0x84,0xfd,0x75,
-    0xe9,0xfe,0x8b,0x31,0xe2,0x61,0x03,0xd7,0xfc,0xbb,
-    0xdc,0xfa,0xf2,0x76,0x03,0xb3,0x00,0x01,0x00,0x0d,
-    0x00,0x00,0x03,0x11,0x05,0xb6,0x00,0x0b,0x00,0x00,
-    0x09,0x01,0x23,0x0b,0x01,0x23,0x09,0x01,0x33,0x1b,
-    0x01,0x33,0x01,0xf6,0x01,0x1b,0xa2,0xd8,0xea,0xa0,
-    0x01,0x3c,0xfe,0xe9,0xa0,0xd1,0xc4,0xa1,0x02,0xf0,
-    0xfd,0x10,0x02,0x6f,0xfd,0x91,0x03,0x03,0x02,0xb3,
-    0xfd,0xca,0x02,0x36,0x00,0x00,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x03,0x09,0x05,0xb6,0x00,0x08,0x00,0x00,
-    0x21,0x23,0x11,0x01,0x33,0x1b,0x01,0x33,0x01,0x01,
-    0xd1,0x9b,0xfe,0xca,0xa4,0xe1,0xe0,0xa4,0xfe,0xc8,
-    0x02,0x3c,0x03,0x7a,0xfd,0x48,0x02,0xb8,0xfc,0x8a,
-    0x00,0x01,0x00,0x34,0x00,0x00,0x02,0xa7,0x05,0xb6,
-    0x00,0x09,0x00,0x00,0x25,0x15,0x21,0x35,0x01,0x21,
-    0x35,0x21,0x15,0x01,0x02,0xa7,0xfd,0x8d,0x01,0xb7,
-    0xfe,0x52,0x02,0x5d,0xfe,0x45,0x8e,0x8e,0x7a,0x04,
-    0xad,0x8f,0x7b,0xfb,0x53,0x00,0x00,0x00,0x00,0x01,
-    0x00,0xa0,0xfe,0xbc,0x02,0x45,0x05,0xb6,0x00,0x07,
-    0x00,0x00,0x01,0x21,0x11,0x21,0x15,0x21,0x11,0x21,
-    0x02,0x45,0xfe,0xec,0x01,0x14,0xfe,0x5b,0x01,0xa5,
-    0x05,0x38,0xfa,0x03,0x7f,0x06,0xfa,0x00,0x00,0x01,
-    0x00,0x27,0x00,0x00,0x02,0xd1,0x05,0xb6,0x00,0x03,
-    0x00,0x00,0x21,0x23,0x01,0x33,0x02,0xd1,0x99,0xfd,
-    0xef,0x95,0x05,0xb6,0x00,0x00,0x00,0x01,0x00,0x41,
-    0xfe,0xbc,0x01,0xe6,0x05,0xb6,0x00,0x07,0x00,0x00,
-    0x01,0x21,0x35,0x21,0x11,0x21,0x35,0x21,0x01,0xe6,
-    0xfe,0x5b,0x01,0x15,0xfe,0xeb,0x01,0xa5,0xfe,0xbc,
-    0x7f,0x05,0xfd,0x7e,0x00,0x00,0x00,0x01,0x00,0x1d,
-    0x02,0xa9,0x03,0x70,0x05,0xb7,0x00,0x06,0x00,0x00,
-    0x01,0x23,0x09,0x01,0x23,0x01,0x33,0x03,0x70,0x8f,
-    0xfe,0xdf,0xfe,0xea,0x8d,0x01,0x73,0x5a,0x02,0xa9,
-    0x02,0x66,0xfd,0x9a,0x03,0x0e,0x00,0x01,0xff,0xfc,
-    0xfe,0xe3,0x03,0x1e,0xff,0x48,0x00,0x03,0x00,0x00,
-    0x01,0x21,0x35,0x21,0x03,0x1e,0xfc,0xde,0x03,0x22,
-    0xfe,0xe3,0x65,0x00,0x00,0x01,0x01,0x89,0x04,0xd9,
-    0x02,0xff,0x06,0x21,0x00,0x0a,0x00,0x00,0x01,0x33,
-    0x1e,0x01,0x17,0x15,0x23,0x26,0x27,0x26,0x27,0x01,
-    0x89,0xbd,0x1d,0x6b,0x31,0x5e,0x44,0x5a,0x59,0x21,
-    0x06,0x21,0x43,0xb1,0x3d,0x17,0x38,0x60,0x61,0x3d,
-    0x00,0x00,0x00,0x02,0x00,0x46,0xff,0xee,0x02,0xc8,
-    0x04,0x5c,0x00,0x15,0x00,0x20,0x00,0x00,0x13,0x27,
-    0x36,0x20,0x16,0x15,0x11,0x23,0x27,0x23,0x06,0x23,
-    0x22,0x26,0x10,0x36,0x3f,0x01,0x35,0x34,0x26,0x22,
-    0x13,0x35,0x06,0x07,0x0e,0x01,0x15,0x14,0x33,0x32,
-    0x36,0xcc,0x3a,0x82,0x01,0x26,0x8e,0x74,0x1a,0x05,
-    0x52,0x9f,0x78,0x86,0xbc,0xb0,0x7f,0x48,0xb2,0xfa,
-    0x22,0x44,0x76,0x71,0x89,0x5c,0x68,0x03,0x9b,0x6f,
-    0x52,0xb6,0xc1,0xfd,0x1b,0x98,0xaa,0xa8,0x01,0x3a,
-    0xb3,0x08,0x06,0x56,0x80,0x77,0xfd,0xda,0x6a,0x01,
-    0x04,0x06,0x77,0x73,0xc7,0xb3,0x00,0x02,0x00,0x86,
-    0xff,0xec,0x03,0x4e,0x06,0x14,0x00,0x0f,0x00,0x19,
-    0x00,0x00,0x01,0x07,0x33,0x36,0x20,0x12,0x10,0x02,
-    0x20,0x27,0x23,0x06,0x07,0x23,0x11,0x33,0x11,0x15,
-    0x14,0x16,0x32,0x36,0x10,0x26,0x22,0x06,0x01,0x1d,
-    0x07,0x0a,0x57,0x01,0x31,0xa6,0xa5,0xfe,0xcd,0x59,
-    0x0b,0x08,0x0f,0x75,0x97,0x66,0xcf,0x60,0x60,0xd3,
-    0x62,0x04,0x48,0x92,0xa4,0xfe,0xe0,0xfd,0xd7,0xfe,
-    0xdb,0xa2,0x37,0x57,0x06,0x14,0xfc,0x1b,0x1a,0xd6,
-    0xce,0xd7,0x01,0xb7,0xd5,0xc2,0x00,0x00,0x00,0x01,
-    0x00,0x58,0xff,0xec,0x02,0x7e,0x04,0x5b,0x00,0x13,
-    0x00,0x00,0x05,0x22,0x02,0x11,0x10,0x21,0x32,0x17,
-    0x07,0x26,0x23,0x22,0x11,0x14,0x16,0x33,0x32,0x37,
-    0x15,0x06,0x01,0xba,0xaf,0xb3,0x01,0x62,0x72,0x52,
-    0x32,0x47,0x3c,0xd5,0x6b,0x70,0x4a,0x5c,0x59,0x14,
-    0x01,0x1d,0x01,0x14,0x02,0x3e,0x30,0x7c,0x25,0xfe,
-    0x4b,0xdc,0xd0,0x2a,0x83,0x2e,0x00,0x02,0x00,0x57,
-    0xff,0xec,0x03,0x1f,0x06,0x14,0x00,0x12,0x00,0x1c,
-    0x00,0x00,0x21,0x23,0x26,0x27,0x23,0x06,0x20,0x02,
-    0x10,0x12,0x33,0x32,0x16,0x17,0x33,0x26,0x27,0x11,
-    0x33,0x03,0x35,0x34,0x26,0x22,0x06,0x10,0x16,0x32,
-    0x36,0x03,0x1f,0x75,0x0f,0x05,0x09,0x53,0xfe,0xc3,
-    0xa6,0xa4,0x99,0x47,0x80,0x29,0x0b,0x05,0x02,0x97,
-    0x98,0x67,0xd0,0x5c,0x5f,0xca,0x6a,0x6a,0x2b,0xa9,
-    0x01,0x20,0x02,0x27,0x01,0x28,0x54,0x4c,0x4d,0x4a,
-    0x01,0xc2,0xfb,0xd7,0x35,0xe2,0xd1,0xdb,0xfe,0x4d,
-    0xd8,0xbe,0x00,0x02,0x00,0x58,0xff,0xec,0x02,0xfb,
-    0x04,0x5b,0x00,0x10,0x00,0x16,0x00,0x00,0x05,0x22,
-    0x02,0x10,0x12,0x33,0x32,0x12,0x1d,0x01,0x21,0x12,
-    0x33,0x32,0x37,0x15,0x06,0x13,0x34,0x26,0x23,0x22,
-    0x03,0x01,0xdc,0xb9,0xcb,0xb6,0xa9,0x96,0xae,0xfd,
-    0xf7,0x06,0xf4,0x72,0x76,0x70,0x01,0x60,0x53,0xad,
-    0x10,0x14,0x01,0x25,0x02,0x20,0x01,0x2a,0xfe,0xfb,
-    0xdf,0x6a,0xfe,0x62,0x47,0x86,0x44,0x02,0x9a,0x9d,
-    0xbb,0xfe,0xa8,0x00,0x00,0x00,0x00,0x01,0x00,0x16,
-    0x00,0x00,0x02,0x33,0x06,0x1f,0x00,0x16,0x00,0x00,
-    0x13,0x34,0x36,0x33,0x32,0x17,0x07,0x26,0x23,0x0e,
-    0x01,0x1d,0x01,0x33,0x15,0x23,0x11,0x23,0x11,0x23,
-    0x35,0x36,0x37,0x9e,0x76,0x87,0x52,0x46,0x2d,0x33,
-    0x2f,0x3f,0x31,0xaf,0xaf,0x96,0x88,0x19,0x6f,0x04,
-    0xa1,0xc7,0xb7,0x20,0x7e,0x19,0x02,0x6e,0x8c,0x58,
-    0x7e,0xfc,0x38,0x03,0xc8,0x50,0x0b,0x2b,0x00,0x03,
-    0x00,0x1d,0xfe,0x14,0x03,0x13,0x04,0x5b,0x00,0x2b,
-    0x00,0x34,0x00,0x3f,0x00,0x00,0x25,0x33,0x32,0x16,
-    0x15,0x14,0x06,0x23,0x22,0x26,0x35,0x34,0x37,0x2e,
-    0x01,0x34,0x36,0x37,0x2e,0x01,0x35,0x34,0x36,0x33,
-    0x32,0x17,0x36,0x32,0x17,0x15,0x07,0x1e,0x01,0x15,
-    0x14,0x06,0x2b,0x01,0x22,0x27,0x0e,0x01,0x14,0x16,
-    0x12,0x26,0x22,0x06,0x14,0x16,0x33,0x32,0x35,0x03,
-    0x23,0x22,0x06,0x14,0x16,0x33,0x32,0x36,0x35,0x34,
-    0x01,0x84,0x63,0x91,0x9b,0xe7,0xc4,0xa0,0xab,0xd7,
-    0x34,0x3d,0x38,0x42,0x4e,0x54,0xa1,0x90,0x3d,0x3c,
-    0x0d,0x82,0x77,0x8f,0x1a,0x21,0xa4,0x83,0x08,0x1e,
-    0x10,0x2b,0x2c,0x44,0xdc,0x4e,0x96,0x51,0x53,0x4a,
-    0x98,0x5e,0x4c,0x61,0x6c,0x64,0x61,0x81,0x91,0xaa,
-    0x9a,0x94,0xa7,0xc1,0x99,0x8f,0xcb,0x4e,0x16,0x51,
-    0x64,0x4d,0x33,0x26,0xab,0x72,0xb1,0xc7,0x16,0x01,
-    0x01,0x60,0x15,0x25,0x81,0x43,0xa4,0xc5,0x04,0x20,
-    0x3b,0x4f,0x2e,0x02,0xbb,0x87,0x8a,0xf9,0x7e,0xfd,
-    0xfd,0x37,0x73,0xbf,0x65,0x7c,0x6d,0xae,0x00,0x01,
-    0x00,0x86,0x00,0x00,0x03,0x1d,0x06,0x14,0x00,0x16,
-    0x00,0x00,0x01,0x11,0x14,0x07,0x33,0x3e,0x01,0x33,
-    0x32,0x16,0x15,0x11,0x23,0x11,0x34,0x26,0x23,0x22,
-    0x06,0x15,0x11,0x23,0x11,0x01,0x1d,0x06,0x0a,0x21,
-    0x7f,0x4c,0x8d,0x83,0x98,0x47,0x4f,0x6b,0x67,0x97,
-    0x06,0x14,0xfe,0x3b,0x43,0x59,0x4e,0x5a,0xba,0xbc,
-    0xfd,0x1b,0x02,0xd0,0x8a,0x7c,0xc9,0xcf,0xfd,0xc2,
-    0x06,0x14,0x00,0x00,0x00,0x02,0x00,0x7a,0x00,0x00,
-    0x01,0x2d,0x05,0xdf,0x00,0x07,0x00,0x0b,0x00,0x00,
-    0x12,0x36,0x32,0x16,0x14,0x06,0x22,0x26,0x13,0x23,
-    0x11,0x33,0x7a,0x32,0x52,0x2f,0x30,0x51,0x32,0xa5,
-    0x98,0x98,0x05,0xa4,0x3b,0x3b,0x67,0x3b,0x3b,0xfa,
-    0xc3,0x04,0x47,0x00,0x00,0x00,0x00,0x02,0xff,0xea,
-    0xfe,0x14,0x01,0x2f,0x05,0xdf,0x00,0x07,0x00,0x14,
-    0x00,0x00,0x12,0x36,0x32,0x16,0x14,0x06,0x22,0x26,
-    0x17,0x11,0x10,0x23,0x22,0x27,0x35,0x16,0x33,0x32,
-    0x36,0x35,0x11,0x7c,0x32,0x53,0x2e,0x2f,0x51,0x33,
-    0xa5,0xdc,0x38,0x23,0x25,0x21,0x2f,0x2a,0x05,0xa4,
-    0x3b,0x3b,0x66,0x3c,0x3c,0xf7,0xfb,0x08,0xfe,0xc5,
-    0x14,0x85,0x11,0x58,0x5d,0x04,0xf6,0x00,0x00,0x01,
-    0x00,0x86,0x00,0x00,0x03,0x10,0x06,0x14,0x00,0x0e,
-    0x00,0x00,0x21,0x23,0x11,0x33,0x11,0x07,0x33,0x37,
-    0x13,0x33,0x09,0x01,0x23,0x03,0x07,0x01,0x1e,0x98,
-    0x98,0x09,0x09,0x3f,0xfc,0xa2,0xfe,0xfc,0x01,0x19,
-    0x9f,0xe0,0x73,0x06,0x14,0xfc,0xdd,0xc3,0x75,0x01,
-    0xa4,0xfe,0x5d,0xfd,0x5c,0x02,0x2c,0x89,0x00,0x01,
-    0x00,0x86,0x00,0x00,0x01,0x1e,0x06,0x14,0x00,0x03,
-    0x00,0x00,0x21,0x23,0x11,0x33,0x01,0x1e,0x98,0x98,
-    0x06,0x14,0x00,0x01,0x00,0x86,0x00,0x00,0x04,0xf4,
-    0x04,0x5b,0x00,0x22,0x00,0x00,0x01,0x17,0x33,0x36,
-    0x33,0x32,0x17,0x3e,0x02,0x37,0x36,0x33,0x32,0x16,
-    0x15,0x11,0x23,0x11,0x10,0x23,0x22,0x06,0x15,0x11,
-    0x23,0x11,0x10,0x23,0x22,0x06,0x15,0x11,0x23,0x11,
-    0x01,0x01,0x10,0x0c,0x44,0xa5,0xb4,0x37,0x14,0x17,
-    0x33,0x18,0x3f,0x4c,0x83,0x7f,0x97,0x93,0x66,0x5b,
-    0x98,0x93,0x65,0x5c,0x97,0x04,0x46,0x94,0xa9,0xbe,
-    0x22,0x25,0x3d,0x10,0x2a,0xc4,0xcd,0xfd,0x36,0x02,
-    0xca,0x01,0x08,0xb7,0xc0,0xfd,0xa5,0x02,0xca,0x01,
-    0x08,0xbd,0xd6,0xfd,0xc1,0x04,0x46,0x00,0x00,0x00,
-    0x00,0x01,0x00,0x86,0x00,0x00,0x03,0x1d,0x04,0x5b,
-    0x00,0x13,0x00,0x00,0x01,0x17,0x33,0x3e,0x01,0x33,
-    0x32,0x16,0x15,0x11,0x23,0x11,0x10,0x23,0x22,0x06,
-    0x19,0x01,0x23,0x11,0x01,0x01,0x10,0x0c,0x22,0x82,
-    0x4f,0x88,0x85,0x98,0x93,0x7a,0x5b,0x97,0x04,0x46,
-    0x94,0x50,0x59,0xb7,0xbe,0xfd,0x1a,0x02,0xd0,0x01,
-    0x06,0xdb,0xfe,0xf5,0xfe,0x10,0x04,0x46,0x00,0x02,
-    0x00,0x57,0xff,0xec,0x03,0x30,0x04,0x5b,0x00,0x07,
-    0x00,0x0f,0x00,0x00,0x1a,0x01,0x20,0x12,0x10,0x02,
-    0x20,0x02,0x01,0x22,0x06,0x10,0x16,0x33,0x32,0x10,
-    0x57,0xbd,0x01,0x5a,0xc2,0xc0,0xfe,0xa7,0xc0,0x01,
-    0x6c,0x6d,0x63,0x65,0x6b,0xd0,0x03,0x36,0x01,0x25,
-    0xfe,0xd3,0xfd,0xe6,0xfe,0xd8,0x01,0x29,0x02,0xbf,
-    0xd4,0xfe,0x4c,0xd9,0x03,0x61,0x00,0x02,0x00,0x86,
-    0xfe,0x14,0x03,0x4e,0x04,0x58,0x00,0x12,0x00,0x1c,
-    0x00,0x00,0x01,0x32,0x12,0x10,0x02,0x23,0x22,0x26,
-    0x27,0x23,0x16,0x17,0x11,0x23,0x11,0x33,0x17,0x33,
-    0x36,0x03,0x14,0x16,0x32,0x36,0x10,0x26,0x22,0x06,
-    0x07,0x02,0x18,0x97,0x9f,0xa3,0x97,0x4f,0x7f,0x27,
-    0x0b,0x09,0x01,0x98,0x78,0x16,0x0a,0x51,0x52,0x66,
-    0xcf,0x60,0x5d,0xd3,0x64,0x01,0x04,0x58,0xfe,0xdb,
-    0xfd,0xe3,0xfe,0xd6,0x53,0x4f,0x67,0x1f,0xfe,0x0c,
-    0x06,0x32,0x94,0xa6,0xfd,0xd2,0xe3,0xd6,0xd7,0x01,
-    0xb9,0xd3,0xbd,0xcd,0x00,0x00,0x00,0x02,0x00,0x57,
-    0xfe,0x14,0x03,0x1f,0x04,0x57,0x00,0x12,0x00,0x1c,
-    0x00,0x00,0x25,0x06,0x20,0x02,0x10,0x12,0x33,0x32,
-    0x16,0x17,0x33,0x36,0x37,0x33,0x11,0x23,0x11,0x34,
-    0x37,0x03,0x35,0x34,0x26,0x22,0x06,0x10,0x16,0x32,
-    0x36,0x02,0x89,0x54,0xfe,0xc7,0xa5,0xa5,0x94,0x52,
-    0x78,0x2b,0x0a,0x0c,0x07,0x7d,0x97,0x0a,0x0b,0x66,
-    0xd0,0x5d,0x5f,0xcb,0x69,0x99,0xad,0x01,0x1f,0x02,
-    0x2a,0x01,0x22,0x4c,0x55,0x60,0x30,0xf9,0xce,0x01,
-    0xd5,0x3e,0x72,0x01,0x5a,0x2d,0xe1,0xd2,0xdb,0xfe,
-    0x45,0xce,0xc4,0x00,0x00,0x00,0x00,0x01,0x00,0x86,
-    0x00,0x00,0x02,0x4c,0x04,0x5c,0x00,0x0f,0x00,0x00,
-    0x00,0x36,0x32,0x17,0x07,0x26,0x23,0x22,0x06,0x15,
-    0x11,0x23,0x11,0x33,0x17,0x33,0x01,0x43,0x67,0x76,
-    0x2c,0x19,0x24,0x26,0x57,0x74,0x98,0x7d,0x11,0x07,
-    0x03,0xf8,0x64,0x0f,0x95,0x0e,0xde,0xaa,0xfd,0xc2,
-    0x04,0x47,0xb9,0x00,0x00,0x00,0x00,0x01,0x00,0x46,
-    0xff,0xec,0x02,0x69,0x04,0x5c,0x00,0x25,0x00,0x00,
-    0x36,0x16,0x32,0x36,0x35,0x34,0x27,0x2e,0x03,0x27,
-    0x26,0x35,0x34,0x37,0x36,0x20,0x17,0x07,0x26,0x22,
-    0x06,0x15,0x14,0x1f,0x01,0x1e,0x02,0x17,0x16,0x15,
-    0x14,0x06,0x20,0x27,0x35,0x68,0x8b,0x8f,0x58,0x18,
-    0x07,0x2e,0x14,0x7e,0x3b,0x7a,0x55,0x57,0x01,0x0f,
-    0x68,0x3e,0x5b,0xa0,0x55,0x3c,0x82,0x2b,0x33,0x3c,
-    0x10,0x26,0x9f,0xfe,0xd6,0x5a,0xa2,0x2d,0x58,0x42,
-    0x32,0x31,0x0f,0x2b,0x0f,0x5a,0x2f,0x61,0x9c,0x7d,
-    0x4f,0x4f,0x44,0x76,0x38,0x54,0x44,0x58,0x2e,0x61,
-    0x20,0x2a,0x40,0x1f,0x48,0x5b,0x91,0x92,0x3e,0x97,
-    0x00,0x00,0x00,0x01,0x00,0x27,0xff,0xec,0x01,0xe7,
-    0x05,0x42,0x00,0x14,0x00,0x00,0x01,0x33,0x15,0x23,
-    0x11,0x14,0x16,0x32,0x37,0x15,0x06,0x23,0x22,0x26,
-    0x35,0x11,0x23,0x35,0x3f,0x01,0x33,0x01,0x25,0xb6,
-    0xb6,0x2e,0x6b,0x29,0x33,0x59,0x74,0x5a,0x66,0x6e,
-    0x2c,0x64,0x04,0x46,0x7e,0xfd,0x4d,0x59,0x4b,0x11,
-    0x7a,0x1c,0xb0,0xc0,0x02,0x6c,0x4d,0x32,0xfb,0x00,
-    0x00,0x01,0x00,0x80,0xff,0xec,0x03,0x17,0x04,0x46,
-    0x00,0x15,0x00,0x00,0x21,0x23,0x26,0x27,0x23,0x0e,
-    0x01,0x23,0x22,0x26,0x35,0x11,0x33,0x11,0x14,0x16,
-    0x33,0x32,0x36,0x35,0x11,0x33,0x03,0x17,0x7b,0x08,
-    0x0b,0x0a,0x24,0x80,0x4e,0x89,0x84,0x98,0x46,0x4c,
-    0x6e,0x68,0x97,0x38,0x5d,0x50,0x59,0xc1,0xcf,0x02,
-    0xca,0xfd,0x4b,0x95,0x8b,0xc0,0xd6,0x02,0x3f,0x00,
-    0x00,0x00,0x00,0x01,0x00,0x06,0x00,0x00,0x02,0xdc,
-    0x04,0x46,0x00,0x0c,0x00,0x00,0x21,0x23,0x01,0x33,
-    0x16,0x17,0x12,0x13,0x33,0x3e,0x01,0x13,0x33,0x01,
-    0xca,0xb8,0xfe,0xf4,0x9c,0x10,0x30,0x5c,0x2f,0x07,
-    0x0a,0x1b,0xa7,0x9c,0x04,0x46,0x46,0xce,0xfe,0x7c,
-    0xfe,0xea,0x4c,0x8d,0x02,0xd5,0x00,0x00,0x00,0x01,
-    0x00,0x14,0x00,0x00,0x04,0xc4,0x04,0x46,0x00,0x1a,
-    0x00,0x00,0x01,0x06,0x03,0x23,0x03,0x33,0x1a,0x01,
-    0x17,0x33,0x36,0x37,0x13,0x33,0x13,0x16,0x17,0x33,
-    0x36,0x13,0x33,0x06,0x03,0x23,0x03,0x26,0x27,0x02,
-    0x6a,0x1a,0x99,0xbc,0xe7,0x97,0x61,0x3e,0x12,0x06,
-    0x14,0x1e,0x7e,0xb4,0x7f,0x11,0x20,0x06,0x07,0xad,
-    0x94,0x1c,0xd1,0xbd,0x90,0x14,0x09,0x03,0xa8,0xa9,
-    0xfd,0x01,0x04,0x46,0xfe,0x2a,0xfe,0xa2,0x7e,0xb0,
-    0x92,0x02,0x70,0xfd,0x8e,0x4a,0xf6,0x5d,0x03,0x55,
-    0x82,0xfc,0x3c,0x02,0xeb,0x7e,0x3f,0x00,0x00,0x01,
-    0x00,0x1c,0x00,0x00,0x02,0xce,0x04,0x47,0x00,0x0b,
-    0x00,0x00,0x09,0x01,0x23,0x0b,0x01,0x23,0x01,0x03,
-    0x33,0x1b,0x01,0x33,0x01,0xc3,0x01,0x0b,0x9f,0xbc,
-    0xba,0x9d,0x01,0x0d,0xfb,0xa0,0xab,0xac,0x9d,0x02,
-    0x2d,0xfd,0xd3,0x01,0xb0,0xfe,0x50,0x02,0x35,0x02,
-    0x12,0xfe,0x69,0x01,0x97,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x06,0xfe,0x14,0x02,0xdc,0x04,0x46,0x00,0x1a,
-    0x00,0x00,0x00,0x06,0x22,0x27,0x35,0x16,0x33,0x32,
-    0x36,0x3f,0x01,0x01,0x33,0x13,0x16,0x17,0x33,0x36,
-    0x37,0x12,0x37,0x33,0x02,0x03,0x0e,0x02,0x01,0x06,
-    0x59,0x6b,0x36,0x2a,0x29,0x3e,0x4c,0x19,0x27,0xfe,
-    0xdd,0x9c,0xa0,0x1c,0x16,0x07,0x15,0x18,0x6c,0x2b,
-    0x9d,0x86,0x91,0x1c,0x29,0x3b,0xfe,0x40,0x2c,0x11,
-    0x84,0x0e,0x61,0x6b,0x95,0x04,0x4a,0xfd,0x6b,0x73,
-    0x93,0x8a,0x75,0x01,0xda,0xc2,0xfd,0xf4,0xfd,0xc0,
-    0x6a,0x83,0x86,0x00,0x00,0x01,0x00,0x35,0x00,0x00,
-    0x02,0x2f,0x04,0x47,0x00,0x09,0x00,0x00,0x25,0x15,
-    0x21,0x35,0x01,0x21,0x35,0x21,0x15,0x01,0x02,0x2f,
-    0xfe,0x06,0x01,0x47,0xfe,0xce,0x01,0xd6,0xfe,0xbd,
-    0x7f,0x7f,0x6b,0x03,0x5c,0x80,0x72,0xfc,0xaa,0x00,
-    0x00,0x00,0x00,0x01,0x00,0x51,0xfe,0xbc,0x02,0x90,
-    0x05,0xb6,0x00,0x1f,0x00,0x00,0x01,0x11,0x0e,0x01,
-    0x07,0x15,0x1e,0x01,0x15,0x11,0x14,0x16,0x17,0x15,
-    0x2e,0x01,0x27,0x11,0x34,0x26,0x23,0x35,0x32,0x36,
-    0x35,0x11,0x34,0x36,0x37,0x15,0x0e,0x01,0x01,0xc4,
-    0x01,0x63,0x6b,0x6b,0x64,0x5a,0x72,0xb3,0xab,0x02,
-    0x65,0x7a,0x78,0x67,0xaf,0xb1,0x6a,0x62,0x04,0x6d,
-    0xfe,0xc8,0x6f,0x75,0x14,0x09,0x13,0x75,0x6c,0xfe,
-    0xde,0x78,0x6d,0x01,0x7c,0x04,0x98,0x98,0x01,0x40,
-    0x6f,0x5e,0x78,0x56,0x72,0x01,0x46,0x98,0x97,0x04,
-    0x7c,0x01,0x63,0x00,0x00,0x00,0x00,0x01,0x01,0x7b,
-    0xfe,0x1b,0x01,0xff,0x06,0x12,0x00,0x03,0x00,0x00,
-    0x01,0x23,0x11,0x33,0x01,0xff,0x84,0x84,0xfe,0x1b,
-    0x07,0xf7,0x00,0x00,0x00,0x01,0x00,0x50,0xfe,0xbc,
-    0x02,0x90,0x05,0xb6,0x00,0x1d,0x00,0x00,0x01,0x11,
-    0x14,0x16,0x33,0x15,0x22,0x06,0x15,0x11,0x10,0x05,
-    0x35,0x3e,0x01,0x35,0x11,0x34,0x36,0x37,0x35,0x2e,
-    0x01,0x35,0x11,0x34,0x26,0x27,0x35,0x04,0x01,0xb1,
-    0x65,0x7a,0x73,0x6c,0xfe,0x9f,0x6c,0x62,0x63,0x6b,
-    0x6a,0x64,0x62,0x6c,0x01,0x61,0x04,0x83,0xfe,0xba,
-    0x6e,0x5a,0x78,0x55,0x78,0xfe,0xc0,0xfe,0xd4,0x08,
-    0x7c,0x01,0x65,0x67,0x01,0x3a,0x6d,0x74,0x14,0x09,
-    0x13,0x76,0x6f,0x01,0x38,0x68,0x64,0x01,0x7c,0x09,
-    0x00,0x01,0x00,0x70,0x02,0x5b,0x03,0x14,0x03,0x4f,
-    0x00,0x1c,0x00,0x00,0x01,0x22,0x27,0x2e,0x01,0x27,
-    0x22,0x07,0x06,0x07,0x35,0x3e,0x01,0x33,0x1e,0x07,
-    0x17,0x16,0x33,0x32,0x37,0x15,0x06,0x02,0x57,0x3c,
-    0x41,0x0b,0x86,0x26,0x4e,0x57,0x0c,0x02,0x1c,0x66,
-    0x29,0x22,0x26,0x0e,0x1b,0x0b,0x1d,0x08,0x20,0x03,
-    0x4a,0x34,0x5d,0x5a,0x4d,0x02,0x5b,0x1c,0x04,0x43,
-    0x09,0x45,0x0a,0x01,0x8d,0x19,0x2b,0x03,0x0d,0x04,
-    0x0c,0x04,0x0e,0x05,0x0f,0x02,0x27,0x76,0x8a,0x6a,
-    0x00,0x00,0x00,0x02,0x00,0x87,0xfe,0x81,0x01,0x5c,
-    0x04,0x49,0x00,0x08,0x00,0x0c,0x00,0x00,0x12,0x36,
-    0x32,0x16,0x14,0x06,0x23,0x22,0x35,0x13,0x23,0x13,
-    0x33,0x87,0x37,0x65,0x39,0x39,0x32,0x6a,0xc9,0xbf,
-    0x29,0x6d,0x04,0x09,0x40,0x3f,0x7e,0x3e,0x7e,0xfa,
-    0xb5,0x04,0x24,0x00,0x00,0x01,0x00,0xa1,0xff,0xec,
-    0x02,0xc7,0x05,0xc9,0x00,0x17,0x00,0x00,0x01,0x07,
-    0x26,0x23,0x22,0x06,0x15,0x10,0x33,0x32,0x37,0x15,
-    0x06,0x07,0x15,0x23,0x35,0x24,0x10,0x25,0x35,0x33,
-    0x15,0x16,0x02,0xc7,0x32,0x4e,0x35,0x6e,0x66,0xd3,
-    0x51,0x5a,0x3a,0x5c,0x6e,0xfe,0xe9,0x01,0x17,0x6e,
-    0x5c,0x04,0xf5,0x7e,0x24,0xd9,0xd9,0xfe,0x54,0x2d,
-    0x86,0x23,0x0b,0xca,0xd0,0x39,0x03,0xed,0x3b,0xac,
-    0xa5,0x09,0x00,0x00,0x00,0x01,0x00,0x4f,0x00,0x00,
-    0x03,0x17,0x05,0xcb,0x00,0x1e,0x00,0x00,0x13,0x11,
-    0x34,0x36,0x33,0x32,0x17,0x07,0x26,0x23,0x22,0x06,
-    0x15,0x11,0x33,0x15,0x23,0x15,0x14,0x07,0x06,0x07,
-    0x21,0x15,0x21,0x35,0x36,0x3d,0x01,0x23,0x35,0xec,
-    0x8b,0xa1,0x8d,0x6e,0x41,0x55,0x61,0x4f,0x47,0xf7,
-    0xf7,0x0b,0x0b,0x67,0x02,0x0e,0xfd,0x3f,0x96,0x9d,
-    0x03,0x1c,0x01,0x06,0xda,0xcf,0x53,0x79,0x43,0x75,
-    0x7f,0xfe,0xce,0x7d,0x8c,0x4a,0x4a,0xa7,0x4a,0x8e,
-    0x82,0x44,0xe4,0xf5,0x7d,0x00,0x00,0x02,0x00,0x71,
-    0x01,0x12,0x03,0xf4,0x04,0x93,0x00,0x1a,0x00,0x22,
-    0x00,0x00,0x01,0x16,0x10,0x07,0x16,0x17,0x07,0x27,
-    0x06,0x20,0x27,0x07,0x27,0x37,0x26,0x10,0x37,0x27,
-    0x37,0x17,0x36,0x20,0x17,0x36,0x37,0x17,0x0e,0x01,
-    0x26,0x22,0x06,0x14,0x16,0x32,0x36,0x03,0x6e,0x4e,
-    0x4e,0x42,0x43,0x54,0x86,0x68,0xfe,0xfb,0x64,0x82,
-    0x53,0x83,0x4c,0x4c,0x85,0x53,0x85,0x69,0x01,0x01,
-    0x66,0x43,0x42,0x56,0x2c,0x7d,0xa2,0xe6,0xa5,0xa1,
-    0xe7,0xa5,0x03,0xbc,0x68,0xfe,0xfb,0x66,0x43,0x42,
-    0x52,0x83,0x4b,0x4d,0x83,0x54,0x82,0x67,0x00,0xff,
-    0x6a,0x85,0x54,0x86,0x4f,0x4e,0x42,0x43,0x52,0x2d,
-    0xd3,0xa8,0xa1,0xe9,0xa1,0xa2,0x00,0x01,0x00,0x49,
-    0x00,0x00,0x03,0x13,0x05,0xb6,0x00,0x1b,0x00,0x00,
-    0x01,0x15,0x23,0x15,0x33,0x15,0x23,0x11,0x23,0x11,
-    0x23,0x35,0x33,0x35,0x22,0x35,0x23,0x35,0x33,0x26,
-    0x02,0x27,0x33,0x1b,0x01,0x33,0x02,0x03,0x02,0xe0,
-    0xe4,0xe4,0xe4,0x9d,0xe1,0xe1,0x01,0xe0,0xbd,0x28,
-    0xa2,0x28,0x9e,0xc8,0xc4,0xa0,0x52,0xa2,0x02,0xa1,
-    0x6f,0xb5,0x6f,0xfe,0xf2,0x01,0x0e,0x6f,0xb4,0x01,
-    0x6f,0x83,0x02,0x0e,0x84,0xfd,0x32,0x02,0xce,0xfe,
-    0xf9,0xfd,0xf2,0x00,0x00,0x02,0x01,0x7b,0xfe,0x1b,
-    0x01,0xff,0x06,0x12,0x00,0x03,0x00,0x07,0x00,0x00,
-    0x01,0x23,0x11,0x33,0x11,0x23,0x11,0x33,0x01,0xff,
-    0x84,0x84,0x84,0x84,0x02,0xf1,0x03,0x21,0xf8,0x09,
-    0x03,0x22,0x00,0x00,0x00,0x02,0x00,0x52,0x00,0x36,
-    0x02,0x93,0x06,0x14,0x00,0x30,0x00,0x3b,0x00,0x00,
-    0x01,0x33,0x1e,0x01,0x17,0x07,0x26,0x22,0x06,0x15,
-    0x14,0x17,0x16,0x1f,0x01,0x1e,0x01,0x14,0x06,0x07,
-    0x1e,0x01,0x15,0x14,0x06,0x20,0x27,0x35,0x16,0x33,
-    0x32,0x36,0x35,0x34,0x2e,0x04,0x35,0x34,0x36,0x37,
-    0x26,0x35,0x34,0x3f,0x01,0x36,0x13,0x34,0x26,0x27,
-    0x0e,0x01,0x14,0x16,0x1f,0x01,0x36,0x01,0x8f,0x15,
-    0x3f,0x5f,0x42,0x2f,0x67,0xa8,0x57,0x17,0x11,0x7c,
-    0x3d,0x6b,0x57,0x41,0x38,0x3e,0x38,0xab,0xfe,0xd0,
-    0x62,0x69,0x8d,0x56,0x66,0x40,0xa9,0x58,0x4e,0x20,
-    0x4b,0x43,0x7e,0x52,0x0e,0x50,0xf5,0x4e,0x79,0x33,
-    0x37,0x4e,0x62,0x36,0x4b,0x06,0x14,0x01,0x1a,0x20,
-    0x6f,0x38,0x4c,0x41,0x2d,0x1b,0x2e,0x4a,0x25,0x41,
-    0x78,0xa9,0x82,0x23,0x2f,0x65,0x42,0x82,0x9b,0x38,
-    0x83,0x4a,0x5b,0x47,0x31,0x54,0x63,0x3b,0x4c,0x52,
-    0x34,0x4f,0x7a,0x21,0x57,0x8d,0x77,0x49,0x09,0x3f,
-    0xfc,0xf5,0x45,0x5f,0x40,0x13,0x54,0x74,0x59,0x34,
-    0x1d,0x38,0x00,0x00,0x00,0x02,0x01,0x36,0x05,0x0f,
-    0x03,0x31,0x05,0xd2,0x00,0x07,0x00,0x0f,0x00,0x00,
-    0x00,0x32,0x16,0x14,0x06,0x22,0x26,0x34,0x24,0x32,
-    0x16,0x14,0x06,0x22,0x26,0x34,0x01,0x66,0x4c,0x2f,
-    0x2f,0x4c,0x30,0x01,0x7f,0x4c,0x30,0x2f,0x4c,0x30,
-    0x05,0xd2,0x32,0x5d,0x34,0x33,0x5f,0x31,0x31,0x5f,
-    0x33,0x34,0x5d,0x00,0x00,0x03,0x00,0x61,0xff,0xec,
-    0x06,0x41,0x05,0xcb,0x00,0x10,0x00,0x21,0x00,0x35,
-    0x00,0x00,0x01,0x32,0x04,0x12,0x15,0x14,0x02,0x06,
-    0x04,0x20,0x24,0x26,0x02,0x10,0x12,0x36,0x24,0x04,
-    0x26,0x20,0x0e,0x02,0x15,0x14,0x12,0x04,0x33,0x32,
-    0x3e,0x02,0x10,0x26,0x01,0x22,0x26,0x10,0x36,0x33,
-    0x32,0x17,0x07,0x26,0x23,0x22,0x06,0x10,0x16,0x33,
-    0x32,0x37,0x15,0x06,0x03,0x51,0xcd,0x01,0x5c,0xc7,
-    0x79,0xca,0xfe,0xea,0xfe,0xc8,0xfe,0xe4,0xc3,0x70,
-    0x7c,0xcd,0x01,0x14,0x02,0x02,0xee,0xfe,0xfa,0xf1,
-    0xab,0x64,0xb2,0x01,0x28,0xab,0x85,0xf1,0xab,0x64,
-    0x68,0xfe,0x01,0xc1,0xd0,0xde,0xbd,0x80,0x79,0x30,
-    0x65,0x60,0x80,0x91,0x83,0x89,0x65,0x6e,0x6b,0x05,
-    0xcb,0xcf,0xfe,0xa6,0xc7,0x9a,0xfe,0xe9,0xc8,0x76,
-    0x7e,0xd0,0x01,0x11,0x01,0x2c,0x01,0x1a,0xc6,0x74,
-    0xd2,0x67,0x69,0xb0,0xed,0x7f,0xb3,0xfe,0xd6,0xa8,
-    0x69,0xaf,0xed,0x01,0x03,0xef,0xfc,0xc5,0xec,0x01,
-    0xab,0xf9,0x3b,0x6d,0x31,0xb3,0xfe,0xb8,0xa7,0x30,
-    0x77,0x30,0x00,0x00,0x00,0x02,0x00,0x39,0x03,0x15,
-    0x01,0xf7,0x05,0xc7,0x00,0x17,0x00,0x21,0x00,0x00,
-    0x01,0x34,0x26,0x22,0x07,0x26,0x27,0x36,0x32,0x16,
-    0x15,0x11,0x23,0x26,0x27,0x0e,0x01,0x23,0x22,0x26,
-    0x34,0x36,0x3f,0x01,0x07,0x14,0x33,0x32,0x36,0x3d,
-    0x01,0x07,0x0e,0x01,0x01,0x89,0x32,0x77,0x4f,0x1e,
-    0x07,0x61,0xcc,0x5e,0x4d,0x0c,0x07,0x2c,0x55,0x36,
-    0x4c,0x5b,0x77,0x80,0x59,0xde,0x55,0x41,0x48,0x42,
-    0x54,0x48,0x04,0xe2,0x46,0x3f,0x2d,0x45,0x10,0x38,
-    0x6f,0x73,0xfe,0x3c,0x3c,0x1f,0x34,0x33,0x67,0xbd,
-    0x67,0x09,0x06,0xd7,0x66,0x60,0x55,0x39,0x07,0x09,
-    0x39,0x00,0x00,0x02,0x00,0x4f,0x00,0x83,0x03,0x67,
-    0x03,0xaf,0x00,0x06,0x00,0x0d,0x00,0x00,0x01,0x03,
-    0x13,0x07,0x01,0x35,0x01,0x05,0x03,0x13,0x07,0x01,
-    0x35,0x01,0x01,0xdf,0xdb,0xdb,0x6a,0xfe,0xda,0x01,
-    0x26,0x01,0xf2,0xda,0xda,0x6a,0xfe,0xda,0x01,0x26,
-    0x03,0x73,0xfe,0xa7,0xfe,0xa6,0x3d,0x01,0x89,0x1a,
-    0x01,0x89,0x3c,0xfe,0xa7,0xfe,0xa6,0x3d,0x01,0x89,
-    0x1a,0x01,0x89,0x00,0x00,0x01,0x00,0x4b,0x00,0xfa,
-    0x02,0xfb,0x03,0x10,0x00,0x05,0x00,0x00,0x25,0x23,
-    0x11,0x21,0x35,0x21,0x02,0xfb,0x78,0xfd,0xc8,0x02,
-    0xb0,0xfa,0x01,0x9b,0x7b,0x00,0x00,0x01,0x00,0x3b,
-    0x01,0xdf,0x01,0xf4,0x02,0x70,0x00,0x03,0x00,0x00,
-    0x01,0x21,0x35,0x21,0x01,0xf4,0xfe,0x47,0x01,0xb9,
-    0x01,0xdf,0x91,0x00,0x00,0x04,0x00,0x61,0xff,0xec,
-    0x06,0x41,0x05,0xcb,0x00,0x10,0x00,0x21,0x00,0x2f,
-    0x00,0x3a,0x00,0x00,0x01,0x32,0x04,0x12,0x15,0x14,
-    0x02,0x06,0x04,0x20,0x24,0x26,0x02,0x10,0x12,0x36,
-    0x24,0x04,0x26,0x20,0x0e,0x02,0x15,0x14,0x12,0x04,
-    0x33,0x32,0x3e,0x02,0x10,0x26,0x25,0x33,0x20,0x11,
-    0x14,0x07,0x17,0x16,0x17,0x23,0x03,0x23,0x11,0x23,
-    0x13,0x11,0x33,0x32,0x37,0x3e,0x01,0x35,0x34,0x26,
-    0x23,0x03,0x51,0xcd,0x01,0x5c,0xc7,0x79,0xca,0xfe,
-    0xea,0xfe,0xc8,0xfe,0xe4,0xc3,0x70,0x7c,0xcd,0x01,
-    0x14,0x02,0x02,0xee,0xfe,0xfa,0xf1,0xab,0x64,0xb2,
-    0x01,0x28,0xab,0x85,0xf1,0xab,0x64,0x68,0xfc,0xdc,
-    0xe3,0x01,0x3b,0x93,0x21,0x3c,0x76,0x9b,0xb1,0x87,
-    0x8b,0x8b,0x32,0x2c,0x1b,0x43,0x4a,0x65,0x70,0x05,
-    0xcb,0xcf,0xfe,0xa6,0xc7,0x9a,0xfe,0xe9,0xc8,0x76,
-    0x7e,0xd0,0x01,0x11,0x01,0x2c,0x01,0x1a,0xc6,0x74,
-    0xd2,0x67,0x69,0xb0,0xed,0x7f,0xb3,0xfe,0xd6,0xa8,
-    0x69,0xaf,0xed,0x01,0x03,0xef,0x4a,0xfe,0xfb,0xae,
-    0x40,0x3d,0x6e,0xdc,0x01,0x62,0xfe,0x9e,0x03,0x0b,
-    0xfe,0xc1,0x0a,0x05,0x4f,0x46,0x58,0x43,0x00,0x00,
-    0x00,0x01,0xff,0xf9,0x06,0x14,0x03,0x8d,0x06,0x89,
-    0x00,0x03,0x00,0x00,0x01,0x21,0x35,0x21,0x03,0x8d,
-    0xfc,0x6c,0x03,0x94,0x06,0x14,0x75,0x00,0x00,0x02,
-    0x00,0x76,0x03,0x5b,0x02,0xe7,0x05,0xcb,0x00,0x08,
-    0x00,0x11,0x00,0x00,0x13,0x36,0x20,0x16,0x10,0x06,
-    0x20,0x26,0x10,0x25,0x26,0x22,0x06,0x14,0x16,0x32,
-    0x36,0x34,0xd0,0x5c,0x01,0x04,0xb7,0xb4,0xfe,0xf5,
-    0xb2,0x01,0xc2,0x37,0xa5,0x6f,0x72,0x9f,0x72,0x05,
-    0x71,0x5a,0xb1,0xfe,0xf1,0xb0,0xaf,0x01,0x0d,0x09,
-    0x3a,0x76,0xa6,0x72,0x72,0xaa,0x00,0x02,0x00,0x4b,
-    0x00,0x00,0x03,0x09,0x04,0xae,0x00,0x0b,0x00,0x0f,
-    0x00,0x00,0x01,0x21,0x15,0x21,0x11,0x23,0x11,0x21,
-    0x35,0x21,0x11,0x33,0x01,0x21,0x35,0x21,0x01,0xe6,
-    0x01,0x23,0xfe,0xdd,0x78,0xfe,0xdd,0x01,0x23,0x78,
-    0x01,0x23,0xfd,0x42,0x02,0xbe,0x03,0x10,0x7b,0xfe,
-    0x65,0x01,0x9b,0x7b,0x01,0x9e,0xfb,0x52,0x7b,0x00,
-    0x00,0x01,0x00,0x32,0x02,0x4a,0x02,0x29,0x05,0xcb,
-    0x00,0x1a,0x00,0x00,0x13,0x35,0x36,0x12,0x36,0x35,
-    0x34,0x26,0x23,0x22,0x07,0x26,0x27,0x36,0x33,0x32,
-    0x16,0x15,0x14,0x07,0x0e,0x03,0x07,0x21,0x15,0x32,
-    0x3d,0xea,0x3f,0x44,0x38,0x54,0x4f,0x30,0x17,0x69,
-    0x8a,0x72,0x81,0x39,0x1f,0x77,0x21,0x53,0x0f,0x01,
-    0x63,0x02,0x4a,0x68,0x4a,0x01,0x18,0x74,0x4f,0x38,
-    0x47,0x54,0x3a,0x1d,0x72,0x7f,0x6f,0x6b,0x58,0x30,
-    0x90,0x28,0x62,0x12,0x74,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x32,0x02,0x39,0x02,0x2b,0x05,0xcb,0x00,0x22,
-    0x00,0x00,0x13,0x33,0x32,0x36,0x34,0x26,0x23,0x22,
-    0x07,0x26,0x27,0x36,0x33,0x32,0x16,0x15,0x14,0x06,
-    0x07,0x15,0x16,0x15,0x14,0x06,0x22,0x27,0x35,0x16,
-    0x33,0x32,0x36,0x34,0x26,0x2b,0x01,0xa9,0x47,0x51,
-    0x57,0x45,0x3f,0x52,0x50,0x16,0x2a,0x6c,0x82,0x6e,
-    0x81,0x49,0x44,0xa9,0x9b,0xfb,0x5d,0x60,0x71,0x53,
-    0x52,0x5f,0x5d,0x49,0x04,0x44,0x52,0x85,0x41,0x4a,
-    0x1e,0x3c,0x5f,0x7c,0x6a,0x49,0x67,0x19,0x0a,0x2c,
-    0xb0,0x72,0x8b,0x2f,0x7a,0x3b,0x4d,0x96,0x52,0x00,
-    0x00,0x00,0x00,0x01,0x01,0x89,0x04,0xd9,0x02,0xfe,
-    0x06,0x21,0x00,0x09,0x00,0x00,0x01,0x15,0x0e,0x01,
-    0x07,0x23,0x35,0x3e,0x01,0x37,0x02,0xfe,0x1d,0xb1,
-    0x4a,0x5d,0x34,0x67,0x1e,0x06,0x21,0x13,0x37,0xc1,
-    0x3d,0x16,0x45,0xab,0x42,0x00,0x00,0x01,0x00,0x82,
-    0xfe,0x14,0x03,0x1a,0x04,0x46,0x00,0x17,0x00,0x00,
-    0x21,0x23,0x26,0x27,0x23,0x0e,0x01,0x22,0x26,0x27,
-    0x16,0x15,0x11,0x23,0x11,0x33,0x11,0x10,0x33,0x32,
-    0x36,0x35,0x11,0x33,0x03,0x1a,0x7c,0x0b,0x08,0x0a,
-    0x21,0x72,0x7b,0x39,0x28,0x09,0x99,0x99,0x92,0x6f,
-    0x66,0x98,0x5d,0x38,0x51,0x58,0x22,0x32,0x8c,0x8a,
-    0xfe,0xea,0x06,0x32,0xfd,0x2e,0xfe,0xfd,0xc0,0xd6,
-    0x02,0x3f,0x00,0x01,0x00,0x79,0xfe,0xfc,0x03,0x3b,
-    0x06,0x14,0x00,0x0e,0x00,0x00,0x01,0x23,0x11,0x23,
-    0x11,0x23,0x11,0x06,0x23,0x22,0x26,0x10,0x12,0x33,
-    0x21,0x03,0x3b,0x71,0x97,0x72,0x23,0x2e,0x7f,0x78,
-    0x8c,0x94,0x01,0xa2,0xfe,0xfc,0x06,0x98,0xf9,0x68,
-    0x03,0x33,0x12,0xf6,0x02,0x02,0x00,0xff,0x00,0x01,
-    0x00,0x7e,0x02,0x54,0x01,0x53,0x03,0x4f,0x00,0x06,
-    0x00,0x00,0x13,0x22,0x34,0x32,0x15,0x14,0x06,0xe8,
-    0x6a,0xd5,0x39,0x02,0x54,0xfb,0x7d,0x3f,0x3f,0x00,
-    0x00,0x01,0x00,0x1f,0xfe,0x14,0x01,0x81,0x00,0x00,
-    0x00,0x10,0x00,0x00,0x01,0x14,0x06,0x23,0x22,0x27,
-    0x35,0x16,0x32,0x36,0x35,0x34,0x27,0x37,0x33,0x07,
-    0x16,0x01,0x81,0x83,0x7a,0x40,0x25,0x2d,0x71,0x41,
-    0xa3,0x4b,0x6b,0x2e,0x9e,0xfe,0xe7,0x66,0x6d,0x0e,
-    0x67,0x0d,0x36,0x31,0x64,0x1a,0x9f,0x66,0x27,0x00,
-    0x00,0x01,0x00,0x4c,0x02,0x4a,0x01,0xae,0x05,0xb6,
-    0x00,0x0a,0x00,0x00,0x01,0x23,0x11,0x34,0x37,0x0e,
-    0x01,0x07,0x27,0x37,0x33,0x01,0xae,0x7a,0x07,0x20,
-    0x3c,0x54,0x3f,0xf9,0x69,0x02,0x4a,0x01,0xe1,0xb1,
-    0x58,0x20,0x30,0x3f,0x52,0xbf,0x00,0x00,0x00,0x02,
-    0x00,0x43,0x03,0x15,0x02,0x3e,0x05,0xc7,0x00,0x07,
-    0x00,0x10,0x00,0x00,0x12,0x36,0x32,0x16,0x10,0x06,
-    0x22,0x26,0x13,0x22,0x15,0x14,0x16,0x32,0x36,0x10,
-    0x26,0x43,0x85,0xf0,0x86,0x84,0xf5,0x82,0xfd,0x88,
-    0x41,0x90,0x40,0x42,0x05,0x12,0xb5,0xb2,0xfe,0xb3,
-    0xb3,0xb4,0x01,0x99,0xf3,0x80,0x76,0x75,0x01,0x00,
-    0x74,0x00,0x00,0x02,0x00,0x4f,0x00,0x83,0x03,0x67,
-    0x03,0xaf,0x00,0x06,0x00,0x0d,0x00,0x00,0x01,0x15,
-    0x01,0x27,0x13,0x03,0x37,0x01,0x15,0x01,0x27,0x13,
-    0x03,0x37,0x01,0xdf,0xfe,0xd9,0x69,0xda,0xda,0x69,
-    0x02,0xaf,0xfe,0xda,0x6a,0xdb,0xdb,0x6a,0x02,0x26,
-    0x1a,0xfe,0x77,0x3d,0x01,0x5a,0x01,0x59,0x3c,0xfe,
-    0x77,0x1a,0xfe,0x77,0x3d,0x01,0x5a,0x01,0x59,0x3c,
-    0x00,0x04,0x00,0x36,0x00,0x00,0x05,0x52,0x05,0xb6,
-    0x00,0x0c,0x00,0x10,0x00,0x1b,0x00,0x21,0x00,0x00,
-    0x01,0x23,0x11,0x36,0x37,0x30,0x07,0x0e,0x01,0x07,
-    0x27,0x37,0x33,0x03,0x23,0x01,0x33,0x09,0x01,0x33,
-    0x11,0x33,0x15,0x23,0x15,0x23,0x35,0x21,0x25,0x11,
-    0x36,0x37,0x06,0x03,0x01,0x98,0x7b,0x06,0x01,0x18,
-    0x13,0x70,0x14,0x3f,0xf8,0x6a,0x04,0x80,0x02,0xf7,
-    0x81,0xfe,0x92,0x01,0x57,0x75,0x68,0x68,0x7a,0xfe,
-    0xae,0x01,0x52,0x02,0x02,0x33,0xab,0x02,0x4a,0x01,
-    0xe1,0xf5,0x14,0x18,0x13,0x54,0x10,0x52,0xbf,0xfa,
-    0x4a,0x05,0xb6,0xfb,0x67,0x02,0x56,0xfd,0xba,0x6c,
-    0xc0,0xc0,0x6c,0x01,0x09,0x72,0x29,0x76,0xfe,0xd2,
-    0x00,0x03,0x00,0x36,0x00,0x00,0x05,0x72,0x05,0xb6,
-    0x00,0x0a,0x00,0x0e,0x00,0x29,0x00,0x00,0x01,0x23,
-    0x11,0x34,0x37,0x0e,0x01,0x07,0x27,0x37,0x33,0x03,
-    0x23,0x01,0x33,0x01,0x35,0x36,0x12,0x36,0x35,0x34,
-    0x26,0x23,0x22,0x07,0x26,0x27,0x36,0x33,0x32,0x16,
-    0x15,0x14,0x07,0x0e,0x03,0x07,0x21,0x15,0x01,0x98,
-    0x7a,0x07,0x20,0x3c,0x54,0x3f,0xf9,0x69,0x13,0x81,
-    0x02,0xf7,0x81,0xfe,0xff,0x3d,0xea,0x3f,0x44,0x38,
-    0x53,0x50,0x30,0x17,0x69,0x8a,0x72,0x81,0x39,0x1f,
-    0x77,0x21,0x53,0x0f,0x01,0x63,0x02,0x4a,0x01,0xe1,
-    0xb1,0x58,0x20,0x30,0x3f,0x52,0xbf,0xfa,0x4a,0x05,
-    0xb6,0xfa,0x4b,0x68,0x4a,0x01,0x18,0x74,0x4f,0x38,
-    0x47,0x54,0x3a,0x1d,0x72,0x7f,0x6f,0x6b,0x57,0x31,
-    0x90,0x28,0x62,0x12,0x74,0x00,0x00,0x04,0x00,0x33,
-    0x00,0x00,0x05,0x6e,0x05,0xcb,0x00,0x21,0x00,0x26,
-    0x00,0x31,0x00,0x37,0x00,0x00,0x13,0x27,0x36,0x33,
-    0x32,0x16,0x15,0x14,0x06,0x07,0x15,0x16,0x15,0x14,
-    0x06,0x22,0x27,0x35,0x16,0x33,0x32,0x36,0x34,0x26,
-    0x2b,0x01,0x35,0x33,0x32,0x36,0x34,0x26,0x23,0x22,
-    0x25,0x33,0x00,0x07,0x23,0x09,0x01,0x33,0x11,0x33,
-    0x15,0x23,0x15,0x23,0x35,0x21,0x25,0x11,0x36,0x37,
-    0x06,0x03,0x73,0x40,0x6d,0x81,0x6f,0x81,0x4a,0x44,
-    0xa9,0x9b,0xfb,0x5d,0x61,0x70,0x54,0x52,0x60,0x5d,
-    0x49,0x47,0x51,0x57,0x45,0x3f,0x52,0x03,0x6f,0x81,
-    0xfd,0x82,0x7a,0x80,0x01,0xff,0x01,0x57,0x75,0x68,
-    0x68,0x7a,0xfe,0xae,0x01,0x52,0x02,0x02,0x33,0xab,
-    0x05,0x12,0x5a,0x5f,0x7c,0x6a,0x49,0x67,0x19,0x0a,
-    0x2c,0xb0,0x72,0x8b,0x2f,0x7a,0x3b,0x4d,0x95,0x53,
-    0x68,0x52,0x85,0x41,0x5a,0xfb,0x34,0xea,0x01,0x1d,
-    0x02,0x56,0xfd,0xba,0x6c,0xc0,0xc0,0x6c,0x01,0x09,
-    0x72,0x29,0x76,0xfe,0xd2,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x31,0xfe,0x6b,0x02,0x65,0x04,0x49,0x00,0x07,
-    0x00,0x1f,0x00,0x00,0x01,0x32,0x14,0x23,0x22,0x26,
-    0x34,0x36,0x13,0x15,0x14,0x0e,0x02,0x07,0x06,0x14,
-    0x16,0x32,0x37,0x17,0x06,0x20,0x26,0x35,0x34,0x3e,
-    0x03,0x3d,0x01,0x01,0x78,0x6c,0x6c,0x31,0x39,0x3a,
-    0x75,0x26,0x4e,0x4f,0x09,0x28,0x53,0xa6,0x64,0x3f,
-    0x79,0xfe,0xde,0x99,0x19,0x3f,0x8a,0x29,0x04,0x49,
-    0xfb,0x3e,0x7e,0x3f,0xfe,0x5c,0x3b,0x6d,0x71,0x80,
-    0x74,0x13,0x58,0xcc,0x6c,0x40,0x75,0x55,0xb4,0xa5,
-    0x51,0x6a,0x6f,0xbe,0x70,0x5a,0x2f,0x00,0x00,0x03,
-    0x00,0x00,0x00,0x00,0x03,0x89,0x07,0x73,0x00,0x0a,
-    0x00,0x14,0x00,0x1e,0x00,0x00,0x13,0x33,0x1e,0x01,
-    0x17,0x15,0x23,0x26,0x27,0x26,0x27,0x13,0x33,0x16,
-    0x01,0x23,0x03,0x21,0x03,0x23,0x00,0x17,0x27,0x26,
-    0x27,0x0e,0x03,0x07,0x21,0xa2,0xbd,0x1d,0x6b,0x31,
-    0x5e,0x44,0x5a,0x59,0x21,0xc1,0xbd,0x3d,0x01,0x2c,
-    0x9d,0x72,0xfe,0x94,0x70,0x9e,0x01,0x26,0xd9,0x20,
-    0x13,0x0b,0x10,0x2d,0x16,0x36,0x0b,0x01,0x2d,0x07,
-    0x73,0x43,0xb1,0x3d,0x17,0x38,0x60,0x61,0x3d,0xfe,
-    0x56,0xf7,0xfb,0x40,0x01,0xdc,0xfe,0x24,0x04,0xbc,
-    0xcc,0x8f,0x55,0x56,0x7d,0xca,0x61,0xe4,0x30,0x00,
-    0x00,0x03,0x00,0x00,0x00,0x00,0x03,0x89,0x07,0x73,
-    0x00,0x09,0x00,0x13,0x00,0x1d,0x00,0x00,0x01,0x15,
-    0x0e,0x01,0x07,0x23,0x35,0x3e,0x01,0x37,0x03,0x33,
-    0x16,0x01,0x23,0x03,0x21,0x03,0x23,0x00,0x17,0x27,
-    0x26,0x27,0x0e,0x03,0x07,0x21,0x02,0xde,0x1d,0xb1,
-    0x4a,0x5d,0x34,0x67,0x1e,0xbf,0xbd,0x3d,0x01,0x2c,
-    0x9d,0x72,0xfe,0x94,0x70,0x9e,0x01,0x26,0xd9,0x20,
-    0x13,0x0b,0x10,0x2d,0x16,0x36,0x0b,0x01,0x2d,0x07,
-    0x73,0x13,0x37,0xc1,0x3d,0x16,0x45,0xab,0x42,0xfe,
-    0x44,0xf7,0xfb,0x40,0x01,0xdc,0xfe,0x24,0x04,0xbc,
-    0xcc,0x8f,0x55,0x56,0x7d,0xca,0x61,0xe4,0x30,0x00,
-    0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x03,0x89,
-    0x07,0x73,0x00,0x0e,0x00,0x18,0x00,0x22,0x00,0x00,
-    0x01,0x23,0x26,0x2f,0x01,0x06,0x07,0x23,0x35,0x36,
-    0x37,0x33,0x1e,0x01,0x17,0x05,0x33,0x16,0x01,0x23,
-    0x03,0x21,0x03,0x23,0x00,0x17,0x27,0x26,0x27,0x0e,
-    0x03,0x07,0x21,0x02,0xd5,0x56,0x2a,0x39,0x5a,0x86,
-    0x38,0x55,0x8d,0x38,0x9b,0x15,0x70,0x41,0xfe,0x8e,
-    0xbd,0x3d,0x01,0x2c,0x9d,0x72,0xfe,0x94,0x70,0x9e,
-    0x01,0x26,0xd9,0x20,0x13,0x0b,0x10,0x2d,0x16,0x36,
-    0x0b,0x01,0x2d,0x06,0x2b,0x24,0x40,0x65,0x97,0x32,
-    0x15,0xbd,0x76,0x31,0xaf,0x53,0x89,0xf7,0xfb,0x40,
-    0x01,0xdc,0xfe,0x24,0x04,0xbc,0xcc,0x8f,0x55,0x56,
-    0x7d,0xca,0x61,0xe4,0x30,0x00,0x00,0x03,0x00,0x00,
-    0x00,0x00,0x03,0x89,0x07,0x1d,0x00,0x14,0x00,0x1e,
-    0x00,0x28,0x00,0x00,0x01,0x22,0x26,0x27,0x26,0x23,
-    0x22,0x07,0x23,0x3e,0x01,0x33,0x32,0x1e,0x01,0x32,
-    0x36,0x37,0x33,0x0e,0x01,0x05,0x33,0x16,0x01,0x23,
-    0x03,0x21,0x03,0x23,0x00,0x17,0x27,0x26,0x27,0x0e,
-    0x03,0x07,0x21,0x02,0x43,0x22,0x4c,0x1b,0x49,0x25,
-    0x3f,0x13,0x60,0x0c,0x5d,0x4e,0x2b,0x5e,0x52,0x3e,
-    0x22,0x0b,0x60,0x0a,0x5e,0xfe,0xd4,0xbd,0x3d,0x01,
-    0x2c,0x9d,0x72,0xfe,0x94,0x70,0x9e,0x01,0x26,0xd9,
-    0x20,0x13,0x0b,0x10,0x2d,0x16,0x36,0x0b,0x01,0x2d,
-    0x06,0x2c,0x26,0x16,0x3d,0x7b,0x75,0x7c,0x3c,0x3c,
-    0x3c,0x3e,0x75,0x7c,0x75,0xf7,0xfb,0x40,0x01,0xdc,
-    0xfe,0x24,0x04,0xbc,0xcc,0x8f,0x55,0x56,0x7d,0xca,
-    0x61,0xe4,0x30,0x00,0x00,0x00,0x00,0x04,0x00,0x00,
-    0x00,0x00,0x03,0x89,0x07,0x24,0x00,0x07,0x00,0x0f,
-    0x00,0x19,0x00,0x23,0x00,0x00,0x12,0x32,0x16,0x14,
-    0x06,0x22,0x26,0x34,0x24,0x32,0x16,0x14,0x06,0x22,
-    0x26,0x34,0x03,0x33,0x16,0x01,0x23,0x03,0x21,0x03,
-    0x23,0x00,0x17,0x27,0x26,0x27,0x0e,0x03,0x07,0x21,
-    0xf8,0x4c,0x2f,0x2f,0x4c,0x30,0x01,0x7f,0x4c,0x30,
-    0x2f,0x4c,0x30,0xb5,0xbd,0x3d,0x01,0x2c,0x9d,0x72,
-    0xfe,0x94,0x70,0x9e,0x01,0x26,0xd9,0x20,0x13,0x0b,
-    0x10,0x2d,0x16,0x36,0x0b,0x01,0x2d,0x07,0x24,0x32,
-    0x5d,0x34,0x33,0x5f,0x31,0x31,0x5f,0x33,0x34,0x5d,
-    0xfe,0xc5,0xf7,0xfb,0x40,0x01,0xdc,0xfe,0x24,0x04,
-    0xbc,0xcc,0x8f,0x55,0x56,0x7d,0xca,0x61,0xe4,0x30,
-    0x00,0x03,0x00,0x00,0x00,0x00,0x03,0x89,0x06,0xf5,
-    0x00,0x12,0x00,0x1a,0x00,0x24,0x00,0x00,0x13,0x34,
-    0x36,0x32,0x16,0x15,0x14,0x06,0x07,0x12,0x13,0x23,
-    0x03,0x21,0x03,0x23,0x00,0x37,0x26,0x24,0x26,0x22,
-    0x06,0x14,0x16,0x32,0x36,0x13,0x03,0x27,0x26,0x27,
-    0x0e,0x03,0x07,0xed,0x76,0xbe,0x7a,0x38,0x33,0xc7,
-    0x92,0x9d,0x72,0xfe,0x94,0x70,0x9e,0x01,0x2b,0x29,
-    0x67,0x01,0x48,0x3d,0x67,0x40,0x3b,0x6a,0x3f,0x25,
-    0x5b,0x20,0x13,0x0b,0x10,0x2d,0x16,0x36,0x0b,0x06,
-    0x2b,0x5c,0x6e,0x6f,0x58,0x40,0x5e,0x18,0xfc,0xd1,
-    0xfd,0xb7,0x01,0xdc,0xfe,0x24,0x04,0xd1,0xa8,0x32,
-    0xb2,0x3d,0x3e,0x65,0x3c,0x3d,0xfc,0x76,0x01,0x82,
-    0x8f,0x55,0x56,0x7d,0xca,0x61,0xe4,0x30,0x00,0x02,
-    0x00,0x00,0x00,0x00,0x04,0x7c,0x05,0xb6,0x00,0x0f,
-    0x00,0x15,0x00,0x00,0x01,0x03,0x23,0x01,0x21,0x15,
-    0x21,0x11,0x21,0x15,0x21,0x11,0x21,0x15,0x21,0x11,
-    0x35,0x11,0x23,0x06,0x02,0x07,0x01,0x2a,0x8b,0x9f,
-    0x01,0xbe,0x02,0xbe,0xfe,0x60,0x01,0x86,0xfe,0x7a,
-    0x01,0xa0,0xfd,0xc4,0x1f,0x35,0x7d,0x1a,0x01,0xdc,
-    0xfe,0x24,0x05,0xb6,0x8e,0xfe,0x1a,0x8d,0xfd,0xd8,
-    0x8d,0x01,0xdc,0x92,0x02,0xb8,0xb4,0xfe,0x52,0x56,
-    0x00,0x00,0x00,0x01,0x00,0x66,0xfe,0x14,0x03,0x4a,
-    0x05,0xcc,0x00,0x24,0x00,0x00,0x01,0x22,0x02,0x10,
-    0x12,0x33,0x32,0x37,0x15,0x06,0x0f,0x01,0x16,0x15,
-    0x14,0x06,0x23,0x22,0x27,0x35,0x16,0x32,0x36,0x35,
-    0x34,0x27,0x37,0x26,0x02,0x11,0x10,0x12,0x33,0x32,
-    0x17,0x07,0x26,0x02,0x4a,0x97,0xad,0xb0,0x9b,0x75,
-    0x62,0x55,0x86,0x25,0x9e,0x83,0x7a,0x40,0x25,0x2e,
-    0x70,0x41,0xa3,0x46,0xb4,0xcc,0xfd,0xe4,0x8c,0x77,
-    0x3c,0x5f,0x05,0x3e,0xfe,0xb9,0xfd,0xc7,0xfe,0xbb,
-    0x34,0x8c,0x34,0x01,0x52,0x27,0x8c,0x66,0x6d,0x0e,
-    0x67,0x0d,0x36,0x31,0x64,0x1a,0x95,0x29,0x01,0x7e,
-    0x01,0x32,0x01,0x65,0x01,0x98,0x4a,0x83,0x3f,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x96,0x00,0x00,0x02,0xd2,
-    0x07,0x73,0x00,0x0a,0x00,0x16,0x00,0x00,0x13,0x33,
-    0x1e,0x01,0x17,0x15,0x23,0x26,0x27,0x26,0x27,0x01,
-    0x21,0x11,0x21,0x15,0x21,0x11,0x21,0x15,0x21,0x11,
-    0x21,0xa3,0xbd,0x1d,0x6b,0x31,0x5e,0x44,0x5a,0x59,
-    0x21,0x02,0x2f,0xfe,0x5f,0x01,0x88,0xfe,0x78,0x01,
-    0xa1,0xfd,0xc4,0x02,0x3c,0x07,0x73,0x43,0xb1,0x3d,
-    0x17,0x38,0x60,0x61,0x3d,0xfd,0xc8,0xfe,0x1a,0x8d,
-    0xfd,0xd8,0x8e,0x05,0xb6,0x00,0x00,0x02,0x00,0x96,
-    0x00,0x00,0x02,0xd2,0x07,0x73,0x00,0x09,0x00,0x15,
-    0x00,0x00,0x01,0x15,0x0e,0x01,0x07,0x23,0x35,0x3e,
-    0x01,0x37,0x13,0x21,0x11,0x21,0x15,0x21,0x11,0x21,
-    0x15,0x21,0x11,0x21,0x02,0xbd,0x1d,0xb1,0x4a,0x5d,
-    0x34,0x67,0x1e,0xd1,0xfe,0x5f,0x01,0x88,0xfe,0x78,
-    0x01,0xa1,0xfd,0xc4,0x02,0x3c,0x07,0x73,0x13,0x37,
-    0xc1,0x3d,0x16,0x45,0xab,0x42,0xfd,0xb6,0xfe,0x1a,
-    0x8d,0xfd,0xd8,0x8e,0x05,0xb6,0x00,0x02,0x00,0x96,
-    0x00,0x00,0x02,0xd2,0x07,0x73,0x00,0x0e,0x00,0x1a,
-    0x00,0x00,0x01,0x23,0x26,0x2f,0x01,0x06,0x07,0x23,
-    0x35,0x36,0x37,0x33,0x1e,0x01,0x17,0x13,0x21,0x11,
-    0x21,0x15,0x21,0x11,0x21,0x15,0x21,0x11,0x21,0x02,
-    0xc1,0x56,0x2a,0x39,0x5a,0x86,0x38,0x55,0x8d,0x38,
-    0x9b,0x15,0x70,0x41,0x11,0xfe,0x5f,0x01,0x88,0xfe,
-    0x78,0x01,0xa1,0xfd,0xc4,0x02,0x3c,0x06,0x2b,0x24,
-    0x40,0x65,0x97,0x32,0x15,0xbd,0x76,0x31,0xaf,0x53,
-    0xfe,0xe9,0xfe,0x1a,0x8d,0xfd,0xd8,0x8e,0x05,0xb6,
-    0x00,0x00,0x00,0x03,0x00,0x96,0x00,0x00,0x02,0xd2,
-    0x07,0x24,0x00,0x07,0x00,0x0f,0x00,0x1b,0x00,0x00,
-    0x12,0x32,0x16,0x14,0x06,0x22,0x26,0x34,0x24,0x32,
-    0x16,0x14,0x06,0x22,0x26,0x34,0x13,0x21,0x11,0x21,
-    0x15,0x21,0x11,0x21,0x15,0x21,0x11,0x21,0xe3,0x4c,
-    0x2f,0x2f,0x4c,0x30,0x01,0x7f,0x4c,0x30,0x2f,0x4c,
-    0x30,0xcf,0xfe,0x5f,0x01,0x88,0xfe,0x78,0x01,0xa1,
-    0xfd,0xc4,0x02,0x3c,0x07,0x24,0x32,0x5d,0x34,0x33,
-    0x5f,0x31,0x31,0x5f,0x33,0x34,0x5d,0xfe,0x37,0xfe,
-    0x1a,0x8d,0xfd,0xd8,0x8e,0x05,0xb6,0x00,0x00,0x02,
-    0xff,0xd9,0x00,0x00,0x01,0x4f,0x07,0x73,0x00,0x0a,
-    0x00,0x0e,0x00,0x00,0x03,0x33,0x1e,0x01,0x17,0x15,
-    0x23,0x26,0x27,0x26,0x27,0x01,0x23,0x11,0x33,0x27,
-    0xbd,0x1d,0x6b,0x31,0x5e,0x44,0x5a,0x59,0x21,0x01,
-    0x63,0x96,0x96,0x07,0x73,0x43,0xb1,0x3d,0x17,0x38,
-    0x60,0x61,0x3d,0xf8,0x9f,0x05,0xb6,0x00,0x00,0x02,
-    0x00,0x9e,0x00,0x00,0x02,0x13,0x07,0x73,0x00,0x09,
-    0x00,0x0d,0x00,0x00,0x01,0x15,0x0e,0x01,0x07,0x23,
-    0x35,0x3e,0x01,0x37,0x03,0x23,0x11,0x33,0x02,0x13,
-    0x1d,0xb1,0x4a,0x5d,0x34,0x67,0x1e,0x1b,0x96,0x96,
-    0x07,0x73,0x13,0x37,0xc1,0x3d,0x16,0x45,0xab,0x42,
-    0xf8,0x8d,0x05,0xb6,0x00,0x02,0xff,0xde,0x00,0x00,
-    0x02,0x04,0x07,0x73,0x00,0x0e,0x00,0x12,0x00,0x00,
-    0x01,0x23,0x26,0x2f,0x01,0x06,0x07,0x23,0x35,0x36,
-    0x37,0x33,0x1e,0x01,0x17,0x03,0x23,0x11,0x33,0x02,
-    0x04,0x56,0x2a,0x39,0x5a,0x86,0x38,0x55,0x8d,0x38,
-    0x9b,0x15,0x70,0x41,0xc8,0x96,0x96,0x06,0x2b,0x24,
-    0x40,0x65,0x97,0x32,0x15,0xbd,0x76,0x31,0xaf,0x53,
-    0xf9,0xc0,0x05,0xb6,0x00,0x00,0x00,0x03,0xff,0xf5,
-    0x00,0x00,0x01,0xf0,0x07,0x24,0x00,0x07,0x00,0x0f,
-    0x00,0x13,0x00,0x00,0x12,0x32,0x16,0x14,0x06,0x22,
-    0x26,0x34,0x24,0x32,0x16,0x14,0x06,0x22,0x26,0x34,
-    0x03,0x23,0x11,0x33,0x25,0x4c,0x2f,0x2f,0x4c,0x30,
-    0x01,0x7f,0x4c,0x30,0x2f,0x4c,0x30,0x09,0x96,0x96,
-    0x07,0x24,0x32,0x5d,0x34,0x33,0x5f,0x31,0x31,0x5f,
-    0x33,0x34,0x5d,0xf9,0x0e,0x05,0xb6,0x00,0x00,0x02,
-    0x00,0x28,0x00,0x00,0x03,0xae,0x05,0xb6,0x00,0x0b,
-    0x00,0x17,0x00,0x00,0x13,0x21,0x32,0x12,0x10,0x02,
-    0x23,0x21,0x11,0x23,0x35,0x33,0x13,0x11,0x33,0x15,
-    0x23,0x11,0x33,0x20,0x11,0x10,0x02,0x23,0x95,0x01,
-    0x34,0xeb,0xfa,0xfc,0xf8,0xfe,0xdb,0x6d,0x6d,0x9c,
-    0xd3,0xd3,0x85,0x01,0x57,0xa7,0xa3,0x05,0xb6,0xfe,
-    0x8e,0xfd,0x34,0xfe,0x88,0x02,0x9c,0x8b,0x02,0x05,
-    0xfd,0xfb,0x8b,0xfd,0xee,0x02,0x58,0x01,0x21,0x01,
-    0x29,0x00,0x00,0x02,0x00,0x96,0x00,0x00,0x03,0xec,
-    0x07,0x1d,0x00,0x14,0x00,0x24,0x00,0x00,0x01,0x22,
-    0x26,0x27,0x26,0x23,0x22,0x07,0x23,0x3e,0x01,0x33,
-    0x32,0x1e,0x01,0x32,0x36,0x37,0x33,0x0e,0x01,0x13,
-    0x23,0x01,0x23,0x16,0x15,0x11,0x23,0x11,0x33,0x01,
-    0x33,0x26,0x35,0x11,0x33,0x02,0xcb,0x22,0x4c,0x1b,
-    0x49,0x25,0x3f,0x13,0x60,0x0c,0x5d,0x4e,0x2b,0x5e,
-    0x52,0x3e,0x22,0x0b,0x60,0x0a,0x5e,0xd5,0xc2,0xfd,
-    0xf9,0x0a,0x10,0x93,0xc3,0x02,0x04,0x07,0x0b,0x93,
-    0x06,0x2c,0x26,0x16,0x3d,0x7b,0x75,0x7c,0x3c,0x3c,
-    0x3c,0x3e,0x75,0x7c,0xf9,0xd4,0x04,0xcc,0x80,0x86,
-    0xfc,0x3a,0x05,0xb6,0xfb,0x42,0x97,0x73,0x03,0xb4,
-    0x00,0x00,0x00,0x03,0x00,0x66,0xff,0xec,0x03,0xf5,
-    0x07,0x73,0x00,0x0a,0x00,0x13,0x00,0x1c,0x00,0x00,
-    0x01,0x33,0x1e,0x01,0x17,0x15,0x23,0x26,0x27,0x26,
-    0x27,0x01,0x32,0x12,0x10,0x02,0x20,0x02,0x11,0x10,
-    0x05,0x22,0x02,0x10,0x12,0x20,0x12,0x11,0x10,0x01,
-    0x0e,0xbd,0x1d,0x6b,0x31,0x5e,0x44,0x5a,0x59,0x21,
-    0x01,0x22,0xdb,0xea,0xeb,0xfe,0x44,0xe8,0x01,0xca,
-    0x94,0x96,0x96,0x01,0x23,0x96,0x07,0x73,0x43,0xb1,
-    0x3d,0x17,0x38,0x60,0x61,0x3d,0xfe,0x6a,0xfe,0x7a,
-    0xfd,0x2e,0xfe,0x79,0x01,0x87,0x01,0x6c,0x02,0xec,
-    0x8e,0xfe,0xcb,0xfd,0xa8,0xfe,0xca,0x01,0x33,0x01,
-    0x30,0x02,0x60,0x00,0x00,0x03,0x00,0x66,0xff,0xec,
-    0x03,0xf5,0x07,0x73,0x00,0x09,0x00,0x12,0x00,0x1b,
-    0x00,0x00,0x01,0x15,0x0e,0x01,0x07,0x23,0x35,0x3e,
-    0x01,0x37,0x03,0x32,0x12,0x10,0x02,0x20,0x02,0x11,
-    0x10,0x05,0x22,0x02,0x10,0x12,0x20,0x12,0x11,0x10,
-    0x03,0x45,0x1d,0xb1,0x4a,0x5d,0x34,0x67,0x1e,0x59,
-    0xdb,0xea,0xeb,0xfe,0x44,0xe8,0x01,0xca,0x94,0x96,
-    0x96,0x01,0x23,0x96,0x07,0x73,0x13,0x37,0xc1,0x3d,
-    0x16,0x45,0xab,0x42,0xfe,0x58,0xfe,0x7a,0xfd,0x2e,
-    0xfe,0x79,0x01,0x87,0x01,0x6c,0x02,0xec,0x8e,0xfe,
-    0xcb,0xfd,0xa8,0xfe,0xca,0x01,0x33,0x01,0x30,0x02,
-    0x60,0x00,0x00,0x03,0x00,0x66,0xff,0xec,0x03,0xf5,
-    0x07,0x73,0x00,0x0e,0x00,0x17,0x00,0x20,0x00,0x00,
-    0x01,0x23,0x26,0x2f,0x01,0x06,0x07,0x23,0x35,0x36,
-    0x37,0x33,0x1e,0x01,0x17,0x05,0x32,0x12,0x10,0x02,
-    0x20,0x02,0x11,0x10,0x05,0x22,0x02,0x10,0x12,0x20,
-    0x12,0x11,0x10,0x03,0x3f,0x56,0x2a,0x39,0x5a,0x86,
-    0x38,0x55,0x8d,0x38,0x9b,0x15,0x70,0x41,0xfe,0xf1,
-    0xdb,0xea,0xeb,0xfe,0x44,0xe8,0x01,0xca,0x94,0x96,
-    0x96,0x01,0x23,0x96,0x06,0x2b,0x24,0x40,0x65,0x97,
-    0x32,0x15,0xbd,0x76,0x31,0xaf,0x53,0x75,0xfe,0x7a,
-    0xfd,0x2e,0xfe,0x79,0x01,0x87,0x01,0x6c,0x02,0xec,
-    0x8e,0xfe,0xcb,0xfd,0xa8,0xfe,0xca,0x01,0x33,0x01,
-    0x30,0x02,0x60,0x00,0x00,0x00,0x00,0x03,0x00,0x66,
-    0xff,0xec,0x03,0xf5,0x07,0x1d,0x00,0x14,0x00,0x1d,
-    0x00,0x26,0x00,0x00,0x01,0x22,0x26,0x27,0x26,0x23,
-    0x22,0x07,0x23,0x3e,0x01,0x33,0x32,0x1e,0x01,0x32,
-    0x36,0x37,0x33,0x0e,0x01,0x07,0x32,0x12,0x10,0x02,
-    0x20,0x02,0x11,0x10,0x05,0x22,0x02,0x10,0x12,0x20,
-    0x12,0x11,0x10,0x02,0xb2,0x22,0x4c,0x1b,0x49,0x25,
-    0x3f,0x13,0x60,0x0c,0x5d,0x4e,0x2b,0x5e,0x52,0x3e,
-    0x22,0x0b,0x60,0x0a,0x5e,0xce,0xdb,0xea,0xeb,0xfe,
-    0x44,0xe8,0x01,0xca,0x94,0x96,0x96,0x01,0x23,0x96,
-    0x06,0x2c,0x26,0x16,0x3d,0x7b,0x75,0x7c,0x3c,0x3c,
-    0x3c,0x3e,0x75,0x7c,0x61,0xfe,0x7a,0xfd,0x2e,0xfe,
-    0x79,0x01,0x87,0x01,0x6c,0x02,0xec,0x8e,0xfe,0xcb,
-    0xfd,0xa8,0xfe,0xca,0x01,0x33,0x01,0x30,0x02,0x60,
-    0x00,0x00,0x00,0x04,0x00,0x66,0xff,0xec,0x03,0xf5,
-    0x07,0x24,0x00,0x07,0x00,0x0f,0x00,0x18,0x00,0x21,
-    0x00,0x00,0x00,0x32,0x16,0x14,0x06,0x22,0x26,0x34,
-    0x24,0x32,0x16,0x14,0x06,0x22,0x26,0x34,0x03,0x32,
-    0x12,0x10,0x02,0x20,0x02,0x11,0x10,0x05,0x22,0x02,
-    0x10,0x12,0x20,0x12,0x11,0x10,0x01,0x66,0x4c,0x2f,
-    0x2f,0x4c,0x30,0x01,0x7f,0x4c,0x30,0x2f,0x4c,0x30,
-    0x56,0xdb,0xea,0xeb,0xfe,0x44,0xe8,0x01,0xca,0x94,
-    0x96,0x96,0x01,0x23,0x96,0x07,0x24,0x32,0x5d,0x34,
-    0x33,0x5f,0x31,0x31,0x5f,0x33,0x34,0x5d,0xfe,0xd9,
-    0xfe,0x7a,0xfd,0x2e,0xfe,0x79,0x01,0x87,0x01,0x6c,
-    0x02,0xec,0x8e,0xfe,0xcb,0xfd,0xa8,0xfe,0xca,0x01,
-    0x33,0x01,0x30,0x02,0x60,0x00,0x00,0x01,0x00,0x45,
-    0x01,0x54,0x03,0x0c,0x04,0x4f,0x00,0x0f,0x00,0x00,
-    0x09,0x01,0x17,0x06,0x07,0x01,0x06,0x07,0x09,0x01,
-    0x26,0x27,0x01,0x26,0x27,0x37,0x01,0xa8,0x01,0x0a,
-    0x5a,0xb8,0x5d,0x01,0x11,0x04,0x54,0xfe,0xf8,0xfe,
-    0xf6,0x4d,0x0c,0x01,0x15,0x8c,0x87,0x59,0x03,0x2d,
-    0x01,0x22,0x4b,0xcc,0x65,0xfe,0xd0,0x04,0x48,0x01,
-    0x21,0xfe,0xdc,0x44,0x09,0x01,0x32,0x99,0x95,0x4b,
-    0x00,0x00,0x00,0x03,0x00,0x66,0xff,0xa0,0x03,0xfe,
-    0x06,0x0b,0x00,0x13,0x00,0x1b,0x00,0x22,0x00,0x00,
-    0x01,0x16,0x10,0x02,0x23,0x22,0x27,0x07,0x27,0x36,
-    0x37,0x26,0x11,0x10,0x21,0x32,0x17,0x37,0x16,0x17,
-    0x05,0x22,0x02,0x11,0x14,0x17,0x01,0x26,0x03,0x20,
-    0x11,0x34,0x27,0x01,0x16,0x03,0x8a,0x6b,0xeb,0xdd,
-    0x97,0x66,0x57,0x6d,0x25,0x4a,0x75,0x01,0xca,0x9a,
-    0x6e,0x58,0x02,0x6c,0xfe,0x32,0x94,0x96,0x2e,0x01,
-    0xbf,0x46,0x80,0x01,0x26,0x23,0xfe,0x46,0x43,0x04,
-    0xf5,0xbd,0xfd,0x3b,0xfe,0x79,0x5f,0xab,0x32,0x48,
-    0x94,0xc2,0x01,0x6f,0x02,0xec,0x6e,0xae,0x01,0x33,
-    0x9a,0xfe,0xcb,0xfe,0xd5,0xf4,0x8b,0x03,0x72,0x6d,
-    0xfb,0x3d,0x02,0x69,0xd1,0x8a,0xfc,0x97,0x5b,0x00,
-    0x00,0x02,0x00,0x8b,0xff,0xec,0x03,0x96,0x07,0x73,
-    0x00,0x0a,0x00,0x1a,0x00,0x00,0x01,0x33,0x1e,0x01,
-    0x17,0x15,0x23,0x26,0x27,0x26,0x27,0x01,0x11,0x14,
-    0x02,0x20,0x02,0x35,0x11,0x33,0x11,0x14,0x16,0x32,
-    0x36,0x35,0x11,0x00,0xff,0xbd,0x1d,0x6b,0x31,0x5e,
-    0x44,0x5a,0x59,0x21,0x02,0x97,0xc4,0xfe,0x81,0xc8,
-    0x9c,0x7a,0xe4,0x76,0x07,0x73,0x43,0xb1,0x3d,0x17,
-    0x38,0x60,0x61,0x3d,0xfe,0x55,0xfc,0x33,0xfc,0xfe,
-    0xff,0x01,0x06,0xf8,0x03,0xcc,0xfc,0x25,0xad,0xb3,
-    0xb4,0xad,0x03,0xda,0x00,0x00,0x00,0x02,0x00,0x8b,
-    0xff,0xec,0x03,0x96,0x07,0x73,0x00,0x09,0x00,0x19,
-    0x00,0x00,0x01,0x15,0x0e,0x01,0x07,0x23,0x35,0x3e,
-    0x01,0x37,0x01,0x11,0x14,0x02,0x20,0x02,0x35,0x11,
-    0x33,0x11,0x14,0x16,0x32,0x36,0x35,0x11,0x03,0x22,
-    0x1d,0xb1,0x4a,0x5d,0x34,0x67,0x1e,0x01,0x30,0xc4,
-    0xfe,0x81,0xc8,0x9c,0x7a,0xe4,0x76,0x07,0x73,0x13,
-    0x37,0xc1,0x3d,0x16,0x45,0xab,0x42,0xfe,0x43,0xfc,
-    0x33,0xfc,0xfe,0xff,0x01,0x06,0xf8,0x03,0xcc,0xfc,
-    0x25,0xad,0xb3,0xb4,0xad,0x03,0xda,0x00,0x00,0x02,
-    0x00,0x8b,0xff,0xec,0x03,0x96,0x07,0x73,0x00,0x0e,
-    0x00,0x1e,0x00,0x00,0x01,0x23,0x26,0x2f,0x01,0x06,
-    0x07,0x23,0x35,0x36,0x37,0x33,0x1e,0x01,0x1f,0x01,
-    0x11,0x14,0x02,0x20,0x02,0x35,0x11,0x33,0x11,0x14,
-    0x16,0x32,0x36,0x35,0x11,0x03,0x24,0x56,0x2a,0x39,
-    0x5a,0x86,0x38,0x55,0x8d,0x38,0x9b,0x15,0x70,0x41,
-    0x72,0xc4,0xfe,0x81,0xc8,0x9c,0x7a,0xe4,0x76,0x06,
-    0x2b,0x24,0x40,0x65,0x97,0x32,0x15,0xbd,0x76,0x31,
-    0xaf,0x53,0x8a,0xfc,0x33,0xfc,0xfe,0xff,0x01,0x06,
-    0xf8,0x03,0xcc,0xfc,0x25,0xad,0xb3,0xb4,0xad,0x03,
-    0xda,0x00,0x00,0x03,0x00,0x8b,0xff,0xec,0x03,0x96,
-    0x07,0x24,0x00,0x07,0x00,0x0f,0x00,0x1f,0x00,0x00,
-    0x00,0x32,0x16,0x14,0x06,0x22,0x26,0x34,0x24,0x32,
-    0x16,0x14,0x06,0x22,0x26,0x34,0x01,0x11,0x14,0x02,
-    0x20,0x02,0x35,0x11,0x33,0x11,0x14,0x16,0x32,0x36,
-    0x35,0x11,0x01,0x44,0x4c,0x2f,0x2f,0x4c,0x30,0x01,
-    0x7f,0x4c,0x30,0x2f,0x4c,0x30,0x01,0x32,0xc4,0xfe,
-    0x81,0xc8,0x9c,0x7a,0xe4,0x76,0x07,0x24,0x32,0x5d,
-    0x34,0x33,0x5f,0x31,0x31,0x5f,0x33,0x34,0x5d,0xfe,
-    0xc4,0xfc,0x33,0xfc,0xfe,0xff,0x01,0x06,0xf8,0x03,
-    0xcc,0xfc,0x25,0xad,0xb3,0xb4,0xad,0x03,0xda,0x00,
-    0x00,0x02,0x00,0x00,0x00,0x00,0x03,0x09,0x07,0x73,
-    0x00,0x09,0x00,0x12,0x00,0x00,0x01,0x15,0x0e,0x01,
-    0x07,0x23,0x35,0x3e,0x01,0x37,0x03,0x23,0x11,0x01,
-    0x33,0x1b,0x01,0x33,0x01,0x02,0x9d,0x1d,0xb1,0x4a,
-    0x5d,0x34,0x67,0x1e,0x10,0x9b,0xfe,0xca,0xa4,0xe1,
-    0xe0,0xa4,0xfe,0xc8,0x07,0x73,0x13,0x37,0xc1,0x3d,
-    0x16,0x45,0xab,0x42,0xf8,0x8d,0x02,0x3c,0x03,0x7a,
-    0xfd,0x48,0x02,0xb8,0xfc,0x8a,0x00,0x02,0x00,0x95,
-    0x00,0x00,0x03,0x36,0x05,0xb6,0x00,0x0b,0x00,0x13,
-    0x00,0x00,0x01,0x33,0x32,0x16,0x10,0x06,0x2b,0x01,
-    0x11,0x23,0x11,0x33,0x19,0x01,0x33,0x32,0x36,0x10,
-    0x26,0x23,0x01,0x31,0x64,0xd5,0xcc,0xd6,0xd1,0x5e,
-    0x9c,0x9c,0x53,0x94,0x81,0x7f,0x8a,0x04,0xb4,0xcf,
-    0xfe,0x45,0xe9,0xfe,0xbf,0x05,0xb6,0xfe,0x70,0xfd,
-    0xa7,0x8e,0x01,0x3f,0x8c,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x86,0xff,0xec,0x03,0x57,0x06,0x1f,0x00,0x2c,
-    0x00,0x00,0x33,0x11,0x34,0x37,0x3e,0x01,0x20,0x16,
-    0x10,0x0f,0x01,0x06,0x14,0x16,0x1f,0x01,0x1e,0x01,
-    0x17,0x14,0x06,0x20,0x27,0x35,0x16,0x32,0x36,0x35,
-    0x34,0x26,0x27,0x2e,0x01,0x35,0x34,0x37,0x3e,0x01,
-    0x35,0x34,0x23,0x22,0x06,0x15,0x11,0x86,0x03,0x09,
-    0xaa,0x01,0x1e,0x9d,0x60,0x09,0x57,0x23,0x3e,0x2f,
-    0x4b,0x44,0x01,0xa0,0xfe,0xf5,0x43,0x5b,0xa4,0x54,
-    0x32,0x53,0x52,0x43,0x6e,0x29,0x24,0x94,0x54,0x58,
-    0x04,0x5f,0x35,0x32,0xa4,0xb5,0x9c,0xfe,0xf6,0x75,
-    0x09,0x6c,0x6b,0x48,0x46,0x2e,0x4b,0x8c,0x5b,0x9b,
-    0xaf,0x35,0x8d,0x40,0x63,0x5a,0x40,0x65,0x55,0x55,
-    0x84,0x4b,0x72,0x6e,0x38,0x59,0x34,0xab,0x7c,0x77,
-    0xfb,0x5a,0x00,0x00,0x00,0x03,0x00,0x46,0xff,0xee,
-    0x02,0xc8,0x06,0x21,0x00,0x0a,0x00,0x20,0x00,0x2b,
-    0x00,0x00,0x13,0x33,0x1e,0x01,0x17,0x15,0x23,0x26,
-    0x27,0x26,0x27,0x13,0x27,0x36,0x20,0x16,0x15,0x11,
-    0x23,0x27,0x23,0x06,0x23,0x22,0x26,0x10,0x36,0x3f,
-    0x01,0x35,0x34,0x26,0x22,0x13,0x35,0x06,0x07,0x0e,
-    0x01,0x15,0x14,0x33,0x32,0x36,0x9d,0xbd,0x1d,0x6b,
-    0x31,0x5e,0x44,0x5a,0x59,0x21,0x2f,0x3a,0x82,0x01,
-    0x26,0x8e,0x74,0x1a,0x05,0x52,0x9f,0x78,0x86,0xbc,
-    0xb0,0x7f,0x48,0xb2,0xfa,0x22,0x44,0x76,0x71,0x89,
-    0x5c,0x68,0x06,0x21,0x43,0xb1,0x3d,0x17,0x38,0x60,
-    0x61,0x3d,0xfd,0x8c,0x6f,0x52,0xb6,0xc1,0xfd,0x1b,
-    0x98,0xaa,0xa8,0x01,0x3a,0xb3,0x08,0x06,0x56,0x80,
-    0x77,0xfd,0xda,0x6a,0x01,0x04,0x06,0x77,0x73,0xc7,
-    0xb3,0x00,0x00,0x00,0x00,0x03,0x00,0x46,0xff,0xee,
-    0x02,0xc8,0x06,0x21,0x00,0x09,0x00,0x1f,0x00,0x2a,
-    0x00,0x00,0x01,0x15,0x0e,0x01,0x07,0x23,0x35,0x3e,
-    0x01,0x37,0x01,0x27,0x36,0x20,0x16,0x15,0x11,0x23,
-    0x27,0x23,0x06,0x23,0x22,0x26,0x10,0x36,0x3f,0x01,
-    0x35,0x34,0x26,0x22,0x13,0x35,0x06,0x07,0x0e,0x01,
-    0x15,0x14,0x33,0x32,0x36,0x02,0xaf,0x1d,0xb1,0x4a,
-    0x5d,0x34,0x67,0x1e,0xfe,0xd9,0x3a,0x82,0x01,0x26,
-    0x8e,0x74,0x1a,0x05,0x52,0x9f,0x78,0x86,0xbc,0xb0,
-    0x7f,0x48,0xb2,0xfa,0x22,0x44,0x76,0x71,0x89,0x5c,
-    0x68,0x06,0x21,0x13,0x37,0xc1,0x3d,0x16,0x45,0xab,
-    0x42,0xfd,0x7a,0x6f,0x52,0xb6,0xc1,0xfd,0x1b,0x98,
-    0xaa,0xa8,0x01,0x3a,0xb3,0x08,0x06,0x56,0x80,0x77,
-    0xfd,0xda,0x6a,0x01,0x04,0x06,0x77,0x73,0xc7,0xb3,
-    0x00,0x03,0x00,0x46,0xff,0xee,0x02,0xc8,0x06,0x22,
-    0x00,0x0e,0x00,0x24,0x00,0x2f,0x00,0x00,0x01,0x23,
-    0x26,0x2f,0x01,0x06,0x07,0x23,0x35,0x36,0x37,0x33,
-    0x1e,0x01,0x17,0x01,0x27,0x36,0x20,0x16,0x15,0x11,
-    0x23,0x27,0x23,0x06,0x23,0x22,0x26,0x10,0x36,0x3f,
-    0x01,0x35,0x34,0x26,0x22,0x13,0x35,0x06,0x07,0x0e,
-    0x01,0x15,0x14,0x33,0x32,0x36,0x02,0xb8,0x56,0x2a,
-    0x39,0x5a,0x86,0x38,0x55,0x8d,0x38,0x9b,0x15,0x70,
-    0x41,0xfe,0x14,0x3a,0x82,0x01,0x26,0x8e,0x74,0x1a,
-    0x05,0x52,0x9f,0x78,0x86,0xbc,0xb0,0x7f,0x48,0xb2,
-    0xfa,0x22,0x44,0x76,0x71,0x89,0x5c,0x68,0x04,0xda,
-    0x24,0x40,0x65,0x97,0x32,0x15,0xbd,0x76,0x31,0xaf,
-    0x53,0xfe,0xac,0x6f,0x52,0xb6,0xc1,0xfd,0x1b,0x98,
-    0xaa,0xa8,0x01,0x3a,0xb3,0x08,0x06,0x56,0x80,0x77,
-    0xfd,0xda,0x6a,0x01,0x04,0x06,0x77,0x73,0xc7,0xb3,
-    0x00,0x00,0x00,0x03,0x00,0x46,0xff,0xee,0x02,0xe0,
-    0x05,0xcb,0x00,0x14,0x00,0x2a,0x00,0x35,0x00,0x00,
-    0x01,0x22,0x26,0x27,0x26,0x23,0x22,0x07,0x23,0x3e,
-    0x01,0x33,0x32,0x1e,0x01,0x32,0x36,0x37,0x33,0x0e,
-    0x01,0x01,0x27,0x36,0x20,0x16,0x15,0x11,0x23,0x27,
-    0x23,0x06,0x23,0x22,0x26,0x10,0x36,0x3f,0x01,0x35,
-    0x34,0x26,0x22,0x13,0x35,0x06,0x07,0x0e,0x01,0x15,
-    0x14,0x33,0x32,0x36,0x02,0x2c,0x22,0x4c,0x1b,0x49,
-    0x25,0x3f,0x13,0x60,0x0c,0x5d,0x4e,0x2b,0x5e,0x52,
-    0x3e,0x22,0x0b,0x60,0x0a,0x5e,0xfe,0x54,0x3a,0x82,
-    0x01,0x26,0x8e,0x74,0x1a,0x05,0x52,0x9f,0x78,0x86,
-    0xbc,0xb0,0x7f,0x48,0xb2,0xfa,0x22,0x44,0x76,0x71,
-    0x89,0x5c,0x68,0x04,0xda,0x26,0x16,0x3d,0x7b,0x75,
-    0x7c,0x3c,0x3c,0x3c,0x3e,0x75,0x7c,0xfe,0xc1,0x6f,
-    0x52,0xb6,0xc1,0xfd,0x1b,0x98,0xaa,0xa8,0x01,0x3a,
-    0xb3,0x08,0x06,0x56,0x80,0x77,0xfd,0xda,0x6a,0x01,
-    0x04,0x06,0x77,0x73,0xc7,0xb3,0x00,0x04,0x00,0x46,
-    0xff,0xee,0x02,0xc8,0x05,0xd2,0x00,0x07,0x00,0x0f,
-    0x00,0x25,0x00,0x30,0x00,0x00,0x12,0x32,0x16,0x14,
-    0x06,0x22,0x26,0x34,0x24,0x32,0x16,0x14,0x06,0x22,
-    0x26,0x34,0x01,0x27,0x36,0x20,0x16,0x15,0x11,0x23,
-    0x27,0x23,0x06,0x23,0x22,0x26,0x10,0x36,0x3f,0x01,
-    0x35,0x34,0x26,0x22,0x13,0x35,0x06,0x07,0x0e,0x01,
-    0x15,0x14,0x33,0x32,0x36,0xd5,0x4c,0x2f,0x2f,0x4c,
-    0x30,0x01,0x7f,0x4c,0x30,0x2f,0x4c,0x30,0xfe,0xd7,
-    0x3a,0x82,0x01,0x26,0x8e,0x74,0x1a,0x05,0x52,0x9f,
-    0x78,0x86,0xbc,0xb0,0x7f,0x48,0xb2,0xfa,0x22,0x44,
-    0x76,0x71,0x89,0x5c,0x68,0x05,0xd2,0x32,0x5d,0x34,
-    0x33,0x5f,0x31,0x31,0x5f,0x33,0x34,0x5d,0xfd,0xfb,
-    0x6f,0x52,0xb6,0xc1,0xfd,0x1b,0x98,0xaa,0xa8,0x01,
-    0x3a,0xb3,0x08,0x06,0x56,0x80,0x77,0xfd,0xda,0x6a,
-    0x01,0x04,0x06,0x77,0x73,0xc7,0xb3,0x00,0x00,0x04,
-    0x00,0x46,0xff,0xee,0x02,0xc8,0x06,0x73,0x00,0x07,
-    0x00,0x0f,0x00,0x25,0x00,0x30,0x00,0x00,0x12,0x36,
-    0x32,0x16,0x14,0x06,0x22,0x26,0x24,0x26,0x22,0x06,
-    0x14,0x16,0x32,0x36,0x01,0x27,0x36,0x20,0x16,0x15,
-    0x11,0x23,0x27,0x23,0x06,0x23,0x22,0x26,0x10,0x36,
-    0x3f,0x01,0x35,0x34,0x26,0x22,0x13,0x35,0x06,0x07,
-    0x0e,0x01,0x15,0x14,0x33,0x32,0x36,0xce,0x76,0xbe,
-    0x7a,0x76,0xc3,0x75,0x01,0x48,0x3d,0x67,0x40,0x3b,
-    0x6a,0x3f,0xfe,0xb6,0x3a,0x82,0x01,0x26,0x8e,0x74,
-    0x1a,0x05,0x52,0x9f,0x78,0x86,0xbc,0xb0,0x7f,0x48,
-    0xb2,0xfa,0x22,0x44,0x76,0x71,0x89,0x5c,0x68,0x06,
-    0x05,0x6e,0x6f,0xb6,0x6f,0x6c,0x90,0x3d,0x3e,0x65,
-    0x3c,0x3d,0xfe,0x25,0x6f,0x52,0xb6,0xc1,0xfd,0x1b,
-    0x98,0xaa,0xa8,0x01,0x3a,0xb3,0x08,0x06,0x56,0x80,
-    0x77,0xfd,0xda,0x6a,0x01,0x04,0x06,0x77,0x73,0xc7,
-    0xb3,0x00,0x00,0x00,0x00,0x03,0x00,0x46,0xff,0xec,
-    0x04,0xd3,0x04,0x5b,0x00,0x23,0x00,0x29,0x00,0x34,
-    0x00,0x00,0x13,0x27,0x36,0x33,0x32,0x17,0x36,0x20,
-    0x12,0x1d,0x01,0x21,0x12,0x33,0x32,0x37,0x15,0x06,
-    0x23,0x22,0x26,0x27,0x0e,0x01,0x23,0x22,0x26,0x10,
-    0x36,0x3f,0x01,0x35,0x34,0x26,0x23,0x22,0x01,0x34,
-    0x26,0x23,0x22,0x03,0x07,0x35,0x06,0x07,0x0e,0x01,
-    0x15,0x14,0x33,0x32,0x36,0xcc,0x3a,0x82,0x8a,0xb0,
-    0x47,0x58,0x01,0x37,0xaf,0xfd,0xf7,0x09,0xed,0x79,
-    0x73,0x6e,0x8d,0x6d,0xa4,0x2d,0x31,0x90,0x66,0x7c,
-    0x8a,0xbc,0xb0,0x7f,0x4b,0x4f,0x60,0x03,0x08,0x61,
-    0x53,0xab,0x13,0x9c,0x22,0x44,0x77,0x70,0x89,0x5c,
-    0x68,0x03,0x9b,0x6f,0x50,0x90,0x91,0xfe,0xfc,0xe0,
-    0x6a,0xfe,0x5f,0x48,0x84,0x44,0x72,0x6a,0x73,0x69,
-    0xab,0x01,0x39,0xb3,0x08,0x06,0x56,0x7c,0x7b,0xfe,
-    0xa8,0x9d,0xb9,0xfe,0xaa,0xce,0x6a,0x01,0x04,0x06,
-    0x73,0x77,0xc7,0xb3,0x00,0x01,0x00,0x58,0xfe,0x14,
-    0x02,0x7e,0x04,0x5b,0x00,0x22,0x00,0x00,0x01,0x22,
-    0x11,0x14,0x16,0x33,0x32,0x37,0x15,0x06,0x0f,0x01,
-    0x16,0x15,0x14,0x06,0x23,0x22,0x27,0x35,0x16,0x32,
-    0x36,0x35,0x34,0x27,0x37,0x24,0x11,0x10,0x21,0x32,
-    0x17,0x07,0x26,0x01,0xc9,0xd5,0x6b,0x70,0x4a,0x5c,
-    0x54,0x5d,0x25,0x9e,0x83,0x7a,0x40,0x25,0x2d,0x71,
-    0x41,0xa3,0x47,0xfe,0xfa,0x01,0x62,0x72,0x52,0x32,
-    0x47,0x03,0xd4,0xfe,0x4b,0xdc,0xd0,0x2a,0x83,0x2b,
-    0x03,0x52,0x27,0x8c,0x66,0x6d,0x0e,0x67,0x0d,0x36,
-    0x31,0x64,0x1a,0x97,0x46,0x01,0xdf,0x02,0x3e,0x30,
-    0x7c,0x25,0x00,0x03,0x00,0x58,0xff,0xec,0x02,0xfb,
-    0x06,0x21,0x00,0x0a,0x00,0x1b,0x00,0x21,0x00,0x00,
-    0x13,0x33,0x1e,0x01,0x17,0x15,0x23,0x26,0x27,0x26,
-    0x27,0x01,0x22,0x02,0x10,0x12,0x33,0x32,0x12,0x1d,
-    0x01,0x21,0x12,0x33,0x32,0x37,0x15,0x06,0x13,0x34,
-    0x26,0x23,0x22,0x03,0xb4,0xbd,0x1d,0x6b,0x31,0x5e,
-    0x44,0x5a,0x59,0x21,0x01,0x28,0xb9,0xcb,0xb6,0xa9,
-    0x96,0xae,0xfd,0xf7,0x06,0xf4,0x72,0x76,0x70,0x01,
-    0x60,0x53,0xad,0x10,0x06,0x21,0x43,0xb1,0x3d,0x17,
-    0x38,0x60,0x61,0x3d,0xf9,0xdd,0x01,0x25,0x02,0x20,
-    0x01,0x2a,0xfe,0xfb,0xdf,0x6a,0xfe,0x62,0x47,0x86,
-    0x44,0x02,0x9a,0x9d,0xbb,0xfe,0xa8,0x00,0x00,0x03,
-    0x00,0x58,0xff,0xec,0x02,0xfb,0x06,0x21,0x00,0x09,
-    0x00,0x1a,0x00,0x20,0x00,0x00,0x01,0x15,0x0e,0x01,
-    0x07,0x23,0x35,0x3e,0x01,0x37,0x03,0x22,0x02,0x10,
-    0x12,0x33,0x32,0x12,0x1d,0x01,0x21,0x12,0x33,0x32,
-    0x37,0x15,0x06,0x13,0x34,0x26,0x23,0x22,0x03,0x02,
-    0xce,0x1d,0xb1,0x4a,0x5d,0x34,0x67,0x1e,0x36,0xb9,
-    0xcb,0xb6,0xa9,0x96,0xae,0xfd,0xf7,0x06,0xf4,0x72,
-    0x76,0x70,0x01,0x60,0x53,0xad,0x10,0x06,0x21,0x13,
-    0x37,0xc1,0x3d,0x16,0x45,0xab,0x42,0xf9,0xcb,0x01,
-    0x25,0x02,0x20,0x01,0x2a,0xfe,0xfb,0xdf,0x6a,0xfe,
-    0x62,0x47,0x86,0x44,0x02,0x9a,0x9d,0xbb,0xfe,0xa8,
-    0x00,0x03,0x00,0x58,0xff,0xec,0x02,0xfb,0x06,0x21,
-    0x00,0x0e,0x00,0x1f,0x00,0x25,0x00,0x00,0x01,0x23,
-    0x26,0x2f,0x01,0x06,0x07,0x23,0x35,0x36,0x37,0x33,
-    0x1e,0x01,0x17,0x03,0x22,0x02,0x10,0x12,0x33,0x32,
-    0x12,0x1d,0x01,0x21,0x12,0x33,0x32,0x37,0x15,0x06,
-    0x13,0x34,0x26,0x23,0x22,0x03,0x02,0xc8,0x56,0x2a,
-    0x39,0x5a,0x86,0x38,0x55,0x8d,0x38,0x9b,0x15,0x70,
-    0x41,0xec,0xb9,0xcb,0xb6,0xa9,0x96,0xae,0xfd,0xf7,
-    0x06,0xf4,0x72,0x76,0x70,0x01,0x60,0x53,0xad,0x10,
-    0x04,0xd9,0x24,0x40,0x65,0x97,0x32,0x15,0xbd,0x76,
-    0x31,0xaf,0x53,0xfa,0xfe,0x01,0x25,0x02,0x20,0x01,
-    0x2a,0xfe,0xfb,0xdf,0x6a,0xfe,0x62,0x47,0x86,0x44,
-    0x02,0x9a,0x9d,0xbb,0xfe,0xa8,0x00,0x00,0x00,0x04,
-    0x00,0x58,0xff,0xec,0x02,0xfb,0x05,0xd2,0x00,0x07,
-    0x00,0x0f,0x00,0x20,0x00,0x26,0x00,0x00,0x12,0x32,
-    0x16,0x14,0x06,0x22,0x26,0x34,0x24,0x32,0x16,0x14,
-    0x06,0x22,0x26,0x34,0x03,0x22,0x02,0x10,0x12,0x33,
-    0x32,0x12,0x1d,0x01,0x21,0x12,0x33,0x32,0x37,0x15,
-    0x06,0x13,0x34,0x26,0x23,0x22,0x03,0xe7,0x4c,0x2f,
-    0x2f,0x4c,0x30,0x01,0x7f,0x4c,0x30,0x2f,0x4c,0x30,
-    0x2b,0xb9,0xcb,0xb6,0xa9,0x96,0xae,0xfd,0xf7,0x06,
-    0xf4,0x72,0x76,0x70,0x01,0x60,0x53,0xad,0x10,0x05,
-    0xd2,0x32,0x5d,0x34,0x33,0x5f,0x31,0x31,0x5f,0x33,
-    0x34,0x5d,0xfa,0x4c,0x01,0x25,0x02,0x20,0x01,0x2a,
-    0xfe,0xfb,0xdf,0x6a,0xfe,0x62,0x47,0x86,0x44,0x02,
-    0x9a,0x9d,0xbb,0xfe,0xa8,0x00,0x00,0x02,0xff,0xc6,
-    0x00,0x00,0x01,0x3c,0x06,0x21,0x00,0x0a,0x00,0x0e,
-    0x00,0x00,0x03,0x33,0x1e,0x01,0x17,0x15,0x23,0x26,
-    0x27,0x26,0x27,0x01,0x23,0x11,0x33,0x3a,0xbd,0x1d,
-    0x6b,0x31,0x5e,0x44,0x5a,0x59,0x21,0x01,0x59,0x98,
-    0x98,0x06,0x21,0x43,0xb1,0x3d,0x17,0x38,0x60,0x61,
-    0x3d,0xf9,0xf1,0x04,0x47,0x00,0x00,0x02,0x00,0x71,
-    0x00,0x00,0x01,0xe6,0x06,0x21,0x00,0x09,0x00,0x0d,
-    0x00,0x00,0x01,0x15,0x0e,0x01,0x07,0x23,0x35,0x3e,
-    0x01,0x37,0x03,0x23,0x11,0x33,0x01,0xe6,0x1d,0xb1,
-    0x4a,0x5d,0x34,0x67,0x1e,0x0b,0x98,0x98,0x06,0x21,
-    0x13,0x37,0xc1,0x3d,0x16,0x45,0xab,0x42,0xf9,0xdf,
-    0x04,0x47,0x00,0x02,0xff,0xbf,0x00,0x00,0x01,0xe5,
-    0x06,0x21,0x00,0x0e,0x00,0x12,0x00,0x00,0x01,0x23,
-    0x26,0x2f,0x01,0x06,0x07,0x23,0x35,0x36,0x37,0x33,
-    0x1e,0x01,0x17,0x03,0x23,0x11,0x33,0x01,0xe5,0x56,
-    0x2a,0x39,0x5a,0x86,0x38,0x55,0x8d,0x38,0x9b,0x15,
-    0x70,0x41,0xc6,0x98,0x98,0x04,0xd9,0x24,0x40,0x65,
-    0x97,0x32,0x15,0xbd,0x76,0x31,0xaf,0x53,0xfb,0x12,
-    0x04,0x47,0x00,0x00,0x00,0x03,0xff,0xd7,0x00,0x00,
-    0x01,0xd2,0x05,0xd2,0x00,0x07,0x00,0x0f,0x00,0x13,
-    0x00,0x00,0x12,0x32,0x16,0x14,0x06,0x22,0x26,0x34,
-    0x24,0x32,0x16,0x14,0x06,0x22,0x26,0x34,0x03,0x23,
-    0x11,0x33,0x07,0x4c,0x2f,0x2f,0x4c,0x30,0x01,0x7f,
-    0x4c,0x30,0x2f,0x4c,0x30,0x08,0x98,0x98,0x05,0xd2,
-    0x32,0x5d,0x34,0x33,0x5f,0x31,0x31,0x5f,0x33,0x34,
-    0x5d,0xfa,0x60,0x04,0x47,0x00,0x00,0x02,0x00,0x57,
-    0xff,0xec,0x03,0x34,0x06,0x18,0x00,0x1b,0x00,0x25,
-    0x00,0x00,0x13,0x37,0x16,0x17,0x36,0x37,0x17,0x07,
-    0x00,0x11,0x10,0x02,0x23,0x22,0x02,0x10,0x12,0x33,
-    0x32,0x17,0x32,0x37,0x26,0x27,0x07,0x27,0x37,0x26,
-    0x13,0x22,0x11,0x14,0x16,0x32,0x36,0x35,0x34,0x26,
-    0xe7,0x3e,0x60,0x4c,0x9a,0x28,0x39,0xac,0x01,0x14,
-    0xbe,0xb5,0xa5,0xc5,0xaf,0xa1,0x8d,0x4f,0x06,0x03,
-    0x32,0xa9,0xbe,0x39,0xaa,0x36,0x9b,0xd8,0x71,0xd2,
-    0x66,0x75,0x05,0xbb,0x5d,0x36,0x44,0x5f,0x19,0x5b,
-    0x6a,0xfe,0xcd,0xfd,0xf6,0xfe,0xf2,0xfe,0xe6,0x01,
-    0x10,0x01,0xc9,0x01,0x01,0x79,0x01,0xfd,0xc1,0x74,
-    0x5c,0x67,0x30,0xfd,0xb9,0xfe,0x90,0xa4,0xc0,0xbe,
-    0xc4,0x95,0xbd,0x00,0x00,0x02,0x00,0x86,0x00,0x00,
-    0x03,0x1d,0x05,0xcb,0x00,0x14,0x00,0x28,0x00,0x00,
-    0x01,0x22,0x26,0x27,0x26,0x23,0x22,0x07,0x23,0x3e,
-    0x01,0x33,0x32,0x1e,0x01,0x32,0x36,0x37,0x33,0x0e,
-    0x01,0x05,0x17,0x33,0x3e,0x01,0x33,0x32,0x16,0x15,
-    0x11,0x23,0x11,0x10,0x23,0x22,0x06,0x19,0x01,0x23,
-    0x11,0x02,0x55,0x22,0x4c,0x1b,0x49,0x25,0x3f,0x13,
-    0x60,0x0c,0x5d,0x4e,0x2b,0x5e,0x52,0x3e,0x22,0x0b,
-    0x60,0x0a,0x5e,0xfe,0x60,0x10,0x0c,0x22,0x82,0x4f,
-    0x88,0x85,0x98,0x93,0x7a,0x5b,0x97,0x04,0xda,0x26,
-    0x16,0x3d,0x7b,0x75,0x7c,0x3c,0x3c,0x3c,0x3e,0x75,
-    0x7c,0x94,0x94,0x50,0x59,0xb7,0xbe,0xfd,0x1a,0x02,
-    0xd0,0x01,0x06,0xdb,0xfe,0xf5,0xfe,0x10,0x04,0x46,
-    0x00,0x00,0x00,0x03,0x00,0x57,0xff,0xec,0x03,0x30,
-    0x06,0x21,0x00,0x0a,0x00,0x12,0x00,0x1a,0x00,0x00,
-    0x13,0x33,0x1e,0x01,0x17,0x15,0x23,0x26,0x27,0x26,
-    0x27,0x02,0x12,0x20,0x12,0x10,0x02,0x20,0x02,0x01,
-    0x22,0x06,0x10,0x16,0x33,0x32,0x10,0xbe,0xbd,0x1d,
-    0x6b,0x31,0x5e,0x44,0x5a,0x59,0x21,0x67,0xbd,0x01,
-    0x5a,0xc2,0xc0,0xfe,0xa7,0xc0,0x01,0x6c,0x6d,0x63,
-    0x65,0x6b,0xd0,0x06,0x21,0x43,0xb1,0x3d,0x17,0x38,
-    0x60,0x61,0x3d,0xfd,0x27,0x01,0x25,0xfe,0xd3,0xfd,
-    0xe6,0xfe,0xd8,0x01,0x29,0x02,0xbf,0xd4,0xfe,0x4c,
-    0xd9,0x03,0x61,0x00,0x00,0x00,0x00,0x03,0x00,0x57,
-    0xff,0xec,0x03,0x30,0x06,0x21,0x00,0x09,0x00,0x11,
-    0x00,0x19,0x00,0x00,0x01,0x15,0x0e,0x01,0x07,0x23,
-    0x35,0x3e,0x01,0x37,0x00,0x12,0x20,0x12,0x10,0x02,
-    0x20,0x02,0x01,0x22,0x06,0x10,0x16,0x33,0x32,0x10,
-    0x02,0xd2,0x1d,0xb1,0x4a,0x5d,0x34,0x67,0x1e,0xfe,
-    0x41,0xbd,0x01,0x5a,0xc2,0xc0,0xfe,0xa7,0xc0,0x01,
-    0x6c,0x6d,0x63,0x65,0x6b,0xd0,0x06,0x21,0x13,0x37,
-    0xc1,0x3d,0x16,0x45,0xab,0x42,0xfd,0x15,0x01,0x25,
-    0xfe,0xd3,0xfd,0xe6,0xfe,0xd8,0x01,0x29,0x02,0xbf,
-    0xd4,0xfe,0x4c,0xd9,0x03,0x61,0x00,0x03,0x00,0x57,
-    0xff,0xec,0x03,0x30,0x06,0x21,0x00,0x0e,0x00,0x16,
-    0x00,0x1e,0x00,0x00,0x01,0x23,0x26,0x2f,0x01,0x06,
-    0x07,0x23,0x35,0x36,0x37,0x33,0x1e,0x01,0x17,0x00,
-    0x12,0x20,0x12,0x10,0x02,0x20,0x02,0x01,0x22,0x06,
-    0x10,0x16,0x33,0x32,0x10,0x02,0xd8,0x56,0x2a,0x39,
-    0x5a,0x86,0x38,0x55,0x8d,0x38,0x9b,0x15,0x70,0x41,
-    0xfd,0x7f,0xbd,0x01,0x5a,0xc2,0xc0,0xfe,0xa7,0xc0,
-    0x01,0x6c,0x6d,0x63,0x65,0x6b,0xd0,0x04,0xd9,0x24,
-    0x40,0x65,0x97,0x32,0x15,0xbd,0x76,0x31,0xaf,0x53,
-    0xfe,0x48,0x01,0x25,0xfe,0xd3,0xfd,0xe6,0xfe,0xd8,
-    0x01,0x29,0x02,0xbf,0xd4,0xfe,0x4c,0xd9,0x03,0x61,
-    0x00,0x00,0x00,0x03,0x00,0x57,0xff,0xec,0x03,0x30,
-    0x05,0xcb,0x00,0x14,0x00,0x1c,0x00,0x24,0x00,0x00,
-    0x01,0x22,0x26,0x27,0x26,0x23,0x22,0x07,0x23,0x3e,
-    0x01,0x33,0x32,0x1e,0x01,0x32,0x36,0x37,0x33,0x0e,
-    0x01,0x00,0x12,0x20,0x12,0x10,0x02,0x20,0x02,0x01,
-    0x22,0x06,0x10,0x16,0x33,0x32,0x10,0x02,0x42,0x22,
-    0x4c,0x1b,0x49,0x25,0x3f,0x13,0x60,0x0c,0x5d,0x4e,
-    0x2b,0x5e,0x52,0x3e,0x22,0x0b,0x60,0x0a,0x5e,0xfd,
-    0xc9,0xbd,0x01,0x5a,0xc2,0xc0,0xfe,0xa7,0xc0,0x01,
-    0x6c,0x6d,0x63,0x65,0x6b,0xd0,0x04,0xda,0x26,0x16,
-    0x3d,0x7b,0x75,0x7c,0x3c,0x3c,0x3c,0x3e,0x75,0x7c,
-    0xfe,0x5c,0x01,0x25,0xfe,0xd3,0xfd,0xe6,0xfe,0xd8,
-    0x01,0x29,0x02,0xbf,0xd4,0xfe,0x4c,0xd9,0x03,0x61,
-    0x00,0x04,0x00,0x57,0xff,0xec,0x03,0x30,0x05,0xd2,
-    0x00,0x07,0x00,0x0f,0x00,0x17,0x00,0x1f,0x00,0x00,
-    0x12,0x32,0x16,0x14,0x06,0x22,0x26,0x34,0x24,0x32,
-    0x16,0x14,0x06,0x22,0x26,0x34,0x00,0x12,0x20,0x12,
-    0x10,0x02,0x20,0x02,0x01,0x22,0x06,0x10,0x16,0x33,
-    0x32,0x10,0xf7,0x4c,0x2f,0x2f,0x4c,0x30,0x01,0x7f,
-    0x4c,0x30,0x2f,0x4c,0x30,0xfe,0x40,0xbd,0x01,0x5a,
-    0xc2,0xc0,0xfe,0xa7,0xc0,0x01,0x6c,0x6d,0x63,0x65,
-    0x6b,0xd0,0x05,0xd2,0x32,0x5d,0x34,0x33,0x5f,0x31,
-    0x31,0x5f,0x33,0x34,0x5d,0xfd,0x96,0x01,0x25,0xfe,
-    0xd3,0xfd,0xe6,0xfe,0xd8,0x01,0x29,0x02,0xbf,0xd4,
-    0xfe,0x4c,0xd9,0x03,0x61,0x00,0x00,0x03,0x00,0x4a,
-    0x00,0xfd,0x03,0x08,0x04,0xa6,0x00,0x06,0x00,0x0a,
-    0x00,0x11,0x00,0x00,0x00,0x34,0x32,0x15,0x14,0x06,
-    0x23,0x01,0x21,0x35,0x21,0x01,0x22,0x34,0x32,0x15,
-    0x14,0x06,0x01,0x4c,0xb9,0x32,0x2a,0x01,0x5f,0xfd,
-    0x42,0x02,0xbe,0xfe,0xa1,0x5d,0xb9,0x32,0x03,0xb8,
-    0xee,0x77,0x3b,0x3c,0xfe,0xdc,0x7c,0xfd,0xed,0xee,
-    0x76,0x3b,0x3d,0x00,0x00,0x03,0x00,0x54,0xff,0x81,
-    0x03,0x33,0x04,0xa6,0x00,0x14,0x00,0x1d,0x00,0x25,
-    0x00,0x00,0x25,0x06,0x07,0x27,0x36,0x37,0x26,0x10,
-    0x12,0x33,0x32,0x17,0x37,0x16,0x17,0x07,0x16,0x10,
-    0x02,0x23,0x22,0x13,0x22,0x06,0x15,0x14,0x17,0x12,
-    0x13,0x26,0x03,0x32,0x36,0x35,0x26,0x27,0x01,0x16,
-    0x01,0x0f,0x08,0x4b,0x68,0x55,0x10,0x62,0xbc,0xb2,
-    0x6e,0x50,0x49,0x11,0x56,0x5c,0x59,0xbf,0xb0,0x6a,
-    0x6c,0x6d,0x66,0x1a,0x8c,0xad,0x31,0x4f,0x69,0x6b,
-    0x01,0x16,0xfe,0xce,0x2a,0x26,0x0f,0x96,0x35,0xa7,
-    0x21,0x97,0x02,0x22,0x01,0x24,0x47,0x92,0x09,0x2b,
-    0xbb,0x95,0xfd,0xf1,0xfe,0xd9,0x03,0xe8,0xd6,0xd9,
-    0x85,0x7c,0x01,0x15,0x01,0x5c,0x3f,0xfc,0x9f,0xdc,
-    0xd6,0x8a,0x5b,0xfd,0x9a,0x31,0x00,0x02,0x00,0x80,
-    0xff,0xec,0x03,0x17,0x06,0x21,0x00,0x0a,0x00,0x20,
-    0x00,0x00,0x13,0x33,0x1e,0x01,0x17,0x15,0x23,0x26,
-    0x27,0x26,0x27,0x01,0x23,0x26,0x27,0x23,0x0e,0x01,
-    0x23,0x22,0x26,0x35,0x11,0x33,0x11,0x14,0x16,0x33,
-    0x32,0x36,0x35,0x11,0x33,0xb8,0xbd,0x1d,0x6b,0x31,
-    0x5e,0x44,0x5a,0x59,0x21,0x02,0x5f,0x7b,0x08,0x0b,
-    0x0a,0x24,0x80,0x4e,0x89,0x84,0x98,0x46,0x4c,0x6e,
-    0x68,0x97,0x06,0x21,0x43,0xb1,0x3d,0x17,0x38,0x60,
-    0x61,0x3d,0xf9,0xf1,0x38,0x5d,0x50,0x59,0xc1,0xcf,
-    0x02,0xca,0xfd,0x4b,0x95,0x8b,0xc0,0xd6,0x02,0x3f,
-    0x00,0x02,0x00,0x80,0xff,0xec,0x03,0x17,0x06,0x21,
-    0x00,0x09,0x00,0x1f,0x00,0x00,0x01,0x15,0x0e,0x01,
-    0x07,0x23,0x35,0x3e,0x01,0x37,0x13,0x23,0x26,0x27,
-    0x23,0x0e,0x01,0x23,0x22,0x26,0x35,0x11,0x33,0x11,
-    0x14,0x16,0x33,0x32,0x36,0x35,0x11,0x33,0x02,0xde,
-    0x1d,0xb1,0x4a,0x5d,0x34,0x67,0x1e,0xf5,0x7b,0x08,
-    0x0b,0x0a,0x24,0x80,0x4e,0x89,0x84,0x98,0x46,0x4c,
-    0x6e,0x68,0x97,0x06,0x21,0x13,0x37,0xc1,0x3d,0x16,
-    0x45,0xab,0x42,0xf9,0xdf,0x38,0x5d,0x50,0x59,0xc1,
-    0xcf,0x02,0xca,0xfd,0x4b,0x95,0x8b,0xc0,0xd6,0x02,
-    0x3f,0x00,0x00,0x00,0x00,0x02,0x00,0x80,0xff,0xec,
-    0x03,0x17,0x06,0x21,0x00,0x0e,0x00,0x24,0x00,0x00,
-    0x01,0x23,0x26,0x2f,0x01,0x06,0x07,0x23,0x35,0x36,
-    0x37,0x33,0x1e,0x01,0x17,0x13,0x23,0x26,0x27,0x23,
-    0x0e,0x01,0x23,0x22,0x26,0x35,0x11,0x33,0x11,0x14,
-    0x16,0x33,0x32,0x36,0x35,0x11,0x33,0x02,0xdb,0x56,
-    0x2a,0x39,0x5a,0x86,0x38,0x55,0x8d,0x38,0x9b,0x15,
-    0x70,0x41,0x3c,0x7b,0x08,0x0b,0x0a,0x24,0x80,0x4e,
-    0x89,0x84,0x98,0x46,0x4c,0x6e,0x68,0x97,0x04,0xd9,
-    0x24,0x40,0x65,0x97,0x32,0x15,0xbd,0x76,0x31,0xaf,
-    0x53,0xfb,0x12,0x38,0x5d,0x50,0x59,0xc1,0xcf,0x02,
-    0xca,0xfd,0x4b,0x95,0x8b,0xc0,0xd6,0x02,0x3f,0x00,
-    0x00,0x03,0x00,0x80,0xff,0xec,0x03,0x17,0x05,0xd2,
-    0x00,0x07,0x00,0x0f,0x00,0x25,0x00,0x00,0x00,0x32,
-    0x16,0x14,0x06,0x22,0x26,0x34,0x24,0x32,0x16,0x14,
-    0x06,0x22,0x26,0x34,0x13,0x23,0x26,0x27,0x23,0x0e,
-    0x01,0x23,0x22,0x26,0x35,0x11,0x33,0x11,0x14,0x16,
-    0x33,0x32,0x36,0x35,0x11,0x33,0x01,0x00,0x4c,0x2f,
-    0x2f,0x4c,0x30,0x01,0x7f,0x4c,0x30,0x2f,0x4c,0x30,
-    0xf7,0x7b,0x08,0x0b,0x0a,0x24,0x80,0x4e,0x89,0x84,
-    0x98,0x46,0x4c,0x6e,0x68,0x97,0x05,0xd2,0x32,0x5d,
-    0x34,0x33,0x5f,0x31,0x31,0x5f,0x33,0x34,0x5d,0xfa,
-    0x60,0x38,0x5d,0x50,0x59,0xc1,0xcf,0x02,0xca,0xfd,
-    0x4b,0x95,0x8b,0xc0,0xd6,0x02,0x3f,0x00,0x00,0x00,
-    0x00,0x02,0x00,0x06,0xfe,0x14,0x02,0xdc,0x06,0x21,
-    0x00,0x09,0x00,0x24,0x00,0x00,0x01,0x15,0x0e,0x01,
-    0x07,0x23,0x35,0x3e,0x01,0x37,0x02,0x06,0x22,0x27,
-    0x35,0x16,0x33,0x32,0x36,0x3f,0x01,0x01,0x33,0x13,
-    0x16,0x17,0x33,0x36,0x37,0x12,0x37,0x33,0x02,0x03,
-    0x0e,0x02,0x02,0x85,0x1d,0xb1,0x4a,0x5d,0x34,0x67,
-    0x1e,0xc3,0x59,0x6b,0x36,0x2a,0x29,0x3e,0x4c,0x19,
-    0x27,0xfe,0xdd,0x9c,0xa0,0x1c,0x16,0x07,0x15,0x18,
-    0x6c,0x2b,0x9d,0x86,0x91,0x1c,0x29,0x3b,0x06,0x21,
-    0x13,0x37,0xc1,0x3d,0x16,0x45,0xab,0x42,0xf8,0x1f,
-    0x2c,0x11,0x84,0x0e,0x61,0x6b,0x95,0x04,0x4a,0xfd,
-    0x6b,0x73,0x93,0x8a,0x75,0x01,0xda,0xc2,0xfd,0xf4,
-    0xfd,0xc0,0x6a,0x83,0x86,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x86,0xfe,0x14,0x03,0x4e,0x06,0x14,0x00,0x11,
-    0x00,0x1c,0x00,0x00,0x01,0x07,0x33,0x36,0x20,0x12,
-    0x10,0x02,0x23,0x22,0x26,0x27,0x23,0x17,0x11,0x23,
-    0x11,0x33,0x11,0x14,0x16,0x33,0x32,0x36,0x10,0x26,
-    0x22,0x06,0x07,0x01,0x1d,0x07,0x07,0x55,0x01,0x37,
-    0xa5,0xa6,0x95,0x50,0x80,0x26,0x09,0x0d,0x9b,0x97,
-    0x66,0x6c,0x61,0x60,0x5d,0xd1,0x64,0x01,0x04,0x47,
-    0x95,0xa9,0xfe,0xe0,0xfd,0xdc,0xfe,0xd5,0x54,0x4e,
-    0x86,0xfe,0x0c,0x08,0x00,0xfc,0x16,0xe3,0xd6,0xd2,
-    0x01,0xc3,0xce,0xbd,0xcd,0x00,0x00,0x00,0x00,0x03,
-    0x00,0x06,0xfe,0x14,0x02,0xdc,0x05,0xd2,0x00,0x07,
-    0x00,0x0f,0x00,0x2a,0x00,0x00,0x12,0x32,0x16,0x14,
-    0x06,0x22,0x26,0x34,0x24,0x32,0x16,0x14,0x06,0x22,
-    0x26,0x34,0x02,0x06,0x22,0x27,0x35,0x16,0x33,0x32,
-    0x36,0x3f,0x01,0x01,0x33,0x13,0x16,0x17,0x33,0x36,
-    0x37,0x12,0x37,0x33,0x02,0x03,0x0e,0x02,0xa7,0x4c,
-    0x2f,0x2f,0x4c,0x30,0x01,0x7f,0x4c,0x30,0x2f,0x4c,
-    0x30,0xc1,0x59,0x6b,0x36,0x2a,0x29,0x3e,0x4c,0x19,
-    0x27,0xfe,0xdd,0x9c,0xa0,0x1c,0x16,0x07,0x15,0x18,
-    0x6c,0x2b,0x9d,0x86,0x91,0x1c,0x29,0x3b,0x05,0xd2,
-    0x32,0x5d,0x34,0x33,0x5f,0x31,0x31,0x5f,0x33,0x34,
-    0x5d,0xf8,0xa0,0x2c,0x11,0x84,0x0e,0x61,0x6b,0x95,
-    0x04,0x4a,0xfd,0x6b,0x73,0x93,0x8a,0x75,0x01,0xda,
-    0xc2,0xfd,0xf4,0xfd,0xc0,0x6a,0x83,0x86,0x00,0x01,
-    0x00,0x87,0x00,0x00,0x01,0x1f,0x04,0x47,0x00,0x03,
-    0x00,0x00,0x21,0x23,0x11,0x33,0x01,0x1f,0x98,0x98,
-    0x04,0x47,0x00,0x02,0x00,0x66,0xff,0xf6,0x04,0xb9,
-    0x05,0xc1,0x00,0x14,0x00,0x1e,0x00,0x00,0x29,0x01,
-    0x22,0x06,0x07,0x22,0x02,0x10,0x12,0x33,0x32,0x17,
-    0x21,0x15,0x21,0x11,0x21,0x15,0x21,0x11,0x21,0x01,
-    0x22,0x02,0x10,0x12,0x33,0x32,0x37,0x11,0x26,0x04,
-    0xb9,0xfe,0x45,0x1f,0x76,0x18,0xf3,0xf8,0xfe,0xf3,
-    0x33,0x4f,0x01,0xe0,0xfe,0x5f,0x01,0x86,0xfe,0x7a,
-    0x01,0xa1,0xfd,0xa0,0xae,0xa4,0xa4,0xb0,0x17,0x0b,
-    0x0c,0x09,0x01,0x01,0x7a,0x02,0xd8,0x01,0x79,0x0b,
-    0x8d,0xfe,0x19,0x8d,0xfd,0xd8,0x04,0xa2,0xfe,0xe5,
-    0xfd,0x90,0xfe,0xe3,0x01,0x04,0xa6,0x01,0x00,0x00,
-    0x00,0x03,0x00,0x57,0xff,0xec,0x05,0x34,0x04,0x5b,
-    0x00,0x17,0x00,0x1d,0x00,0x26,0x00,0x00,0x05,0x22,
-    0x27,0x06,0x23,0x22,0x02,0x10,0x12,0x20,0x17,0x36,
-    0x33,0x32,0x12,0x1d,0x01,0x21,0x12,0x33,0x32,0x37,
-    0x15,0x06,0x13,0x34,0x26,0x23,0x22,0x03,0x07,0x35,
-    0x10,0x23,0x22,0x06,0x15,0x10,0x20,0x04,0x16,0xd4,
-    0x61,0x5b,0xc5,0xaa,0xc0,0xb9,0x01,0x70,0x5d,0x59,
-    0xbb,0x95,0xae,0xfd,0xf8,0x07,0xf9,0x6c,0x76,0x71,
-    0x02,0x60,0x53,0xad,0x10,0x9d,0xcf,0x6d,0x63,0x01,
-    0x9f,0x14,0xc9,0xc9,0x01,0x29,0x02,0x24,0x01,0x22,
-    0xc6,0xc6,0xfe,0xfc,0xe0,0x6a,0xfe,0x61,0x46,0x84,
-    0x44,0x02,0x9a,0x9e,0xb8,0xfe,0xaa,0x72,0x11,0x01,
-    0xaf,0xd4,0xdb,0xfe,0x4b,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x50,0xff,0xec,0x02,0xe9,0x07,0x73,0x00,0x0d,
-    0x00,0x2b,0x00,0x00,0x01,0x15,0x0e,0x01,0x07,0x23,
-    0x26,0x27,0x35,0x33,0x16,0x17,0x36,0x37,0x01,0x32,
-    0x36,0x34,0x26,0x27,0x2e,0x01,0x10,0x36,0x20,0x17,
-    0x06,0x07,0x26,0x22,0x06,0x14,0x16,0x17,0x1e,0x01,
-    0x15,0x14,0x06,0x20,0x27,0x35,0x1e,0x01,0x02,0xc9,
-    0x3c,0x72,0x18,0x9b,0x41,0x84,0x55,0x37,0x89,0x78,
-    0x43,0xfe,0xfc,0x64,0x7b,0x6e,0x64,0x9f,0x81,0xc7,
-    0x01,0x3c,0x7b,0x13,0x24,0x74,0xc5,0x75,0x56,0x8a,
-    0x92,0x82,0xcb,0xfe,0xa8,0x76,0x3c,0x9c,0x07,0x73,
-    0x16,0x4e,0xb2,0x32,0x82,0xb0,0x16,0x30,0x9a,0x92,
-    0x38,0xf9,0x06,0x90,0xcf,0x8b,0x3d,0x59,0xb8,0x01,
-    0x44,0xd6,0x48,0x2d,0x5a,0x3e,0x83,0xd0,0x7b,0x4d,
-    0x4f,0xc2,0x89,0xbb,0xde,0x3a,0xa0,0x23,0x2a,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x46,0xff,0xec,0x02,0x73,
-    0x06,0x21,0x00,0x0d,0x00,0x33,0x00,0x00,0x01,0x15,
-    0x0e,0x01,0x07,0x23,0x26,0x27,0x35,0x33,0x16,0x17,
-    0x36,0x37,0x00,0x16,0x32,0x36,0x35,0x34,0x27,0x2e,
-    0x03,0x27,0x26,0x35,0x34,0x37,0x36,0x20,0x17,0x07,
-    0x26,0x22,0x06,0x15,0x14,0x1f,0x01,0x1e,0x02,0x17,
-    0x16,0x15,0x14,0x06,0x20,0x27,0x35,0x02,0x73,0x3c,
-    0x72,0x18,0x9b,0x41,0x84,0x55,0x37,0x89,0x78,0x43,
-    0xfe,0x4b,0x8b,0x8f,0x58,0x18,0x07,0x2e,0x14,0x7e,
-    0x3b,0x7a,0x55,0x57,0x01,0x0f,0x68,0x3e,0x5b,0xa0,
-    0x55,0x3c,0x82,0x2b,0x33,0x3c,0x10,0x26,0x9f,0xfe,
-    0xd6,0x5a,0x06,0x21,0x16,0x4e,0xb2,0x32,0x82,0xb0,
-    0x16,0x30,0x9a,0x92,0x38,0xfa,0x81,0x2d,0x58,0x42,
-    0x32,0x31,0x0f,0x2b,0x0f,0x5a,0x2f,0x61,0x9c,0x7d,
-    0x4f,0x4f,0x44,0x76,0x38,0x54,0x44,0x58,0x2e,0x61,
-    0x20,0x2a,0x40,0x1f,0x48,0x5b,0x91,0x92,0x3e,0x97,
-    0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x03,0x09,
-    0x07,0x24,0x00,0x07,0x00,0x0f,0x00,0x18,0x00,0x00,
-    0x12,0x32,0x16,0x14,0x06,0x22,0x26,0x34,0x24,0x32,
-    0x16,0x14,0x06,0x22,0x26,0x34,0x03,0x23,0x11,0x01,
-    0x33,0x1b,0x01,0x33,0x01,0xb9,0x4c,0x2f,0x2f,0x4c,
-    0x30,0x01,0x7f,0x4c,0x30,0x2f,0x4c,0x30,0x08,0x9b,
-    0xfe,0xca,0xa4,0xe1,0xe0,0xa4,0xfe,0xc8,0x07,0x24,
-    0x32,0x5d,0x34,0x33,0x5f,0x31,0x31,0x5f,0x33,0x34,
-    0x5d,0xf9,0x0e,0x02,0x3c,0x03,0x7a,0xfd,0x48,0x02,
-    0xb8,0xfc,0x8a,0x00,0x00,0x02,0x00,0x34,0x00,0x00,
-    0x02,0xa7,0x07,0x73,0x00,0x0d,0x00,0x17,0x00,0x00,
-    0x01,0x15,0x0e,0x01,0x07,0x23,0x26,0x27,0x35,0x33,
-    0x16,0x17,0x36,0x37,0x13,0x15,0x21,0x35,0x01,0x21,
-    0x35,0x21,0x15,0x01,0x02,0x7d,0x3c,0x72,0x18,0x9b,
-    0x41,0x84,0x55,0x37,0x89,0x78,0x43,0x80,0xfd,0x8d,
-    0x01,0xb7,0xfe,0x52,0x02,0x5d,0xfe,0x45,0x07,0x73,
-    0x16,0x4e,0xb2,0x32,0x82,0xb0,0x16,0x30,0x9a,0x92,
-    0x38,0xf9,0x1b,0x8e,0x7a,0x04,0xad,0x8f,0x7b,0xfb,
-    0x53,0x00,0x00,0x02,0x00,0x26,0x00,0x00,0x02,0x4c,
-    0x06,0x21,0x00,0x0d,0x00,0x17,0x00,0x00,0x01,0x15,
-    0x0e,0x01,0x07,0x23,0x26,0x27,0x35,0x33,0x16,0x17,
-    0x36,0x37,0x13,0x15,0x21,0x35,0x01,0x21,0x35,0x21,
-    0x15,0x01,0x02,0x4c,0x3c,0x72,0x18,0x9b,0x41,0x84,
-    0x55,0x37,0x89,0x78,0x43,0x39,0xfe,0x06,0x01,0x47,
-    0xfe,0xce,0x01,0xd6,0xfe,0xbd,0x06,0x21,0x16,0x4e,
-    0xb2,0x32,0x82,0xb0,0x16,0x30,0x9a,0x92,0x38,0xfa,
-    0x5e,0x7f,0x6b,0x03,0x5c,0x80,0x72,0xfc,0xaa,0x00,
-    0x00,0x01,0x00,0x45,0xfe,0x14,0x03,0x11,0x05,0xcb,
-    0x00,0x20,0x00,0x00,0x01,0x34,0x36,0x33,0x32,0x17,
-    0x07,0x26,0x23,0x22,0x06,0x07,0x15,0x33,0x15,0x23,
-    0x02,0x11,0x14,0x06,0x23,0x22,0x27,0x35,0x16,0x33,
-    0x32,0x36,0x35,0x11,0x23,0x35,0x37,0x01,0x4f,0x77,
-    0x90,0x5e,0x5d,0x32,0x42,0x37,0x44,0x34,0x02,0xc7,
-    0xc7,0x01,0x8a,0x8e,0x48,0x46,0x43,0x35,0x4e,0x44,
-    0xa2,0xa2,0x04,0x38,0xd1,0xc2,0x29,0x7e,0x1f,0x6c,
-    0x83,0x91,0x7f,0xfe,0xc3,0xfd,0x87,0xbf,0xbb,0x11,
-    0x88,0x12,0x6f,0x78,0x03,0xc2,0x50,0x34,0x00,0x00,
-    0x00,0x01,0x01,0x2a,0x04,0xd9,0x03,0x50,0x06,0x21,
-    0x00,0x0e,0x00,0x00,0x01,0x23,0x26,0x2f,0x01,0x06,
-    0x07,0x23,0x35,0x36,0x37,0x33,0x1e,0x01,0x17,0x03,
-    0x50,0x56,0x2a,0x39,0x5a,0x86,0x38,0x55,0x8d,0x38,
-    0x9b,0x15,0x70,0x41,0x04,0xd9,0x24,0x40,0x65,0x97,
-    0x32,0x15,0xbd,0x76,0x31,0xaf,0x53,0x00,0x00,0x00,
-    0x00,0x01,0x01,0x2a,0x04,0xd9,0x03,0x50,0x06,0x21,
-    0x00,0x0d,0x00,0x00,0x01,0x15,0x0e,0x01,0x07,0x23,
-    0x26,0x27,0x35,0x33,0x16,0x17,0x36,0x37,0x03,0x50,
-    0x3c,0x72,0x18,0x9b,0x41,0x84,0x55,0x37,0x89,0x78,
-    0x43,0x06,0x21,0x16,0x4e,0xb2,0x32,0x82,0xb0,0x16,
-    0x30,0x9a,0x92,0x38,0x00,0x00,0x00,0x01,0x01,0x44,
-    0x04,0xdb,0x03,0x34,0x05,0xe4,0x00,0x0b,0x00,0x00,
-    0x01,0x22,0x03,0x33,0x1e,0x01,0x32,0x36,0x37,0x33,
-    0x0e,0x01,0x02,0x37,0xe5,0x0e,0x62,0x07,0x47,0x8a,
-    0x46,0x0b,0x65,0x06,0x84,0x04,0xdb,0x01,0x09,0x4b,
-    0x43,0x43,0x4b,0x7e,0x8b,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x83,0x05,0x02,0x01,0x3c,0x05,0xdf,0x00,0x07,
-    0x00,0x00,0x12,0x36,0x32,0x16,0x14,0x06,0x22,0x26,
-    0x83,0x32,0x59,0x2e,0x30,0x56,0x33,0x05,0xa6,0x39,
-    0x39,0x6a,0x3a,0x3a,0x00,0x02,0x01,0x6d,0x04,0xdf,
-    0x03,0x1b,0x06,0x73,0x00,0x07,0x00,0x0f,0x00,0x00,
-    0x00,0x36,0x32,0x16,0x14,0x06,0x22,0x26,0x24,0x26,
-    0x22,0x06,0x14,0x16,0x32,0x36,0x01,0x6d,0x76,0xbe,
-    0x7a,0x76,0xc3,0x75,0x01,0x48,0x3d,0x67,0x40,0x3b,
-    0x6a,0x3f,0x06,0x05,0x6e,0x6f,0xb6,0x6f,0x6c,0x90,
-    0x3d,0x3e,0x65,0x3c,0x3d,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x25,0xfe,0x37,0x01,0x53,0x00,0x00,0x00,0x13,
-    0x00,0x00,0x01,0x06,0x22,0x27,0x26,0x35,0x37,0x36,
-    0x35,0x34,0x27,0x36,0x37,0x33,0x06,0x07,0x16,0x1f,
-    0x01,0x14,0x01,0x42,0x2f,0xa3,0x36,0x15,0x2f,0x34,
-    0x26,0x27,0x2a,0x6a,0x5e,0x06,0x23,0x4e,0x29,0xfe,
-    0x56,0x1f,0x2a,0x36,0x4c,0x2c,0x26,0x2c,0x20,0x12,
-    0x41,0x2c,0x64,0x63,0x50,0x23,0x0d,0x35,0x00,0x00,
-    0x00,0x01,0x01,0x10,0x04,0xd8,0x03,0x6d,0x05,0xcb,
-    0x00,0x14,0x00,0x00,0x01,0x22,0x26,0x27,0x26,0x23,
-    0x22,0x07,0x23,0x3e,0x01,0x33,0x32,0x1e,0x01,0x32,
-    0x36,0x37,0x33,0x0e,0x01,0x02,0xb9,0x22,0x4c,0x1b,
-    0x49,0x25,0x3f,0x13,0x60,0x0c,0x5d,0x4e,0x2b,0x5e,
-    0x52,0x3e,0x22,0x0b,0x60,0x0a,0x5e,0x04,0xda,0x26,
-    0x16,0x3d,0x7b,0x75,0x7c,0x3c,0x3c,0x3c,0x3e,0x75,
-    0x7c,0x00,0x00,0x02,0x00,0xf4,0x04,0xd9,0x03,0x7e,
-    0x06,0x21,0x00,0x09,0x00,0x13,0x00,0x00,0x01,0x15,
-    0x0e,0x01,0x07,0x23,0x35,0x3e,0x01,0x37,0x21,0x15,
-    0x0e,0x01,0x07,0x23,0x35,0x3e,0x01,0x37,0x02,0x4b,
-    0x24,0x9d,0x45,0x51,0x2c,0x67,0x18,0x01,0xdf,0x20,
-    0x9a,0x4c,0x51,0x2c,0x67,0x18,0x06,0x21,0x12,0x42,
-    0xb8,0x3c,0x17,0x3b,0xbe,0x38,0x12,0x3e,0xb4,0x44,
-    0x17,0x3b,0xbe,0x38,0x00,0x02,0xff,0xba,0xfd,0xd4,
-    0x00,0x49,0xff,0xb0,0x00,0x05,0x00,0x0b,0x00,0x00,
-    0x15,0x32,0x14,0x23,0x22,0x34,0x13,0x32,0x14,0x23,
-    0x22,0x34,0x49,0x49,0x46,0x46,0x49,0x49,0x46,0x50,
-    0xad,0xad,0xfe,0xd1,0xad,0xad,0x00,0x00,0x00,0x05,
-    0xfe,0x70,0xfd,0xd4,0x01,0x6e,0xff,0xb0,0x00,0x05,
-    0x00,0x0b,0x00,0x11,0x00,0x17,0x00,0x1d,0x00,0x00,
-    0x05,0x32,0x14,0x23,0x22,0x34,0x21,0x32,0x14,0x23,
-    0x22,0x34,0x21,0x32,0x14,0x23,0x22,0x34,0x01,0x32,
-    0x14,0x23,0x22,0x34,0x21,0x32,0x14,0x23,0x22,0x34,
-    0xfe,0xb6,0x49,0x49,0x46,0x01,0x90,0x49,0x49,0x46,
-    0x01,0x6b,0x49,0x49,0x46,0xfe,0x7b,0x49,0x49,0x46,
-    0x02,0x11,0x49,0x49,0x46,0x50,0xad,0xad,0xad,0xad,
-    0xad,0xad,0xfe,0xd1,0xad,0xad,0xad,0xad,0x00,0x00,
-    0x00,0x03,0xfe,0xb6,0xfd,0xd4,0x01,0x49,0xff,0xb0,
-    0x00,0x05,0x00,0x09,0x00,0x0f,0x00,0x00,0x05,0x32,
-    0x14,0x23,0x22,0x34,0x07,0x21,0x35,0x21,0x13,0x32,
-    0x14,0x23,0x22,0x34,0x01,0x00,0x49,0x49,0x46,0x6a,
-    0xfe,0x66,0x01,0x9a,0xb0,0x49,0x49,0x46,0x50,0xad,
-    0xad,0x7f,0x52,0xfe,0xfe,0xad,0xad,0x00,0x00,0x00,
-    0x00,0x03,0xfe,0xbb,0xfd,0xd4,0x01,0x4e,0xff,0xb0,
-    0x00,0x05,0x00,0x0d,0x00,0x13,0x00,0x00,0x05,0x32,
-    0x14,0x23,0x22,0x34,0x07,0x23,0x15,0x23,0x35,0x23,
-    0x35,0x21,0x13,0x32,0x14,0x23,0x22,0x34,0x01,0x05,
-    0x49,0x49,0x46,0x6a,0xa4,0x52,0xa4,0x01,0x9a,0xb0,
-    0x49,0x49,0x46,0x50,0xad,0xad,0x7f,0xe8,0xe8,0x52,
-    0xfe,0xfe,0xad,0xad,0x00,0x01,0xff,0xb9,0xff,0x03,
-    0x00,0x48,0xff,0xb0,0x00,0x05,0x00,0x00,0x07,0x32,
-    0x14,0x23,0x22,0x34,0x01,0x49,0x49,0x46,0x50,0xad,
-    0xad,0x00,0x00,0x02,0xff,0x14,0xff,0x03,0x00,0xed,
-    0xff,0xb0,0x00,0x05,0x00,0x0b,0x00,0x00,0x07,0x32,
-    0x14,0x23,0x22,0x34,0x21,0x32,0x14,0x23,0x22,0x34,
-    0xa6,0x49,0x49,0x46,0x01,0x90,0x49,0x49,0x46,0x50,
-    0xad,0xad,0xad,0xad,0x00,0x00,0x00,0x03,0xff,0x16,
-    0xfd,0xd4,0x00,0xef,0xff,0xb0,0x00,0x05,0x00,0x0b,
-    0x00,0x11,0x00,0x00,0x07,0x32,0x14,0x23,0x22,0x34,
-    0x21,0x32,0x14,0x23,0x22,0x34,0x03,0x32,0x14,0x23,
-    0x22,0x34,0xa4,0x49,0x49,0x46,0x01,0x90,0x49,0x49,
-    0x46,0x60,0x49,0x49,0x46,0x50,0xad,0xad,0xad,0xad,
-    0xfe,0xd1,0xad,0xad,0x00,0x00,0x00,0x01,0xff,0x34,
-    0xff,0x3a,0x00,0xce,0xff,0x8c,0x00,0x03,0x00,0x00,
-    0x17,0x21,0x35,0x21,0xce,0xfe,0x66,0x01,0x9a,0xc6,
-    0x52,0x00,0x00,0x00,0x00,0x01,0xff,0x2f,0xfe,0x52,
-    0x00,0xc9,0xff,0x8c,0x00,0x07,0x00,0x00,0x17,0x23,
-    0x15,0x23,0x35,0x23,0x35,0x21,0xc9,0xa4,0x52,0xa4,
-    0x01,0x9a,0xc6,0xe8,0xe8,0x52,0x00,0x01,0xff,0xb9,
-    0x05,0x82,0x00,0x48,0x06,0x2f,0x00,0x05,0x00,0x00,
-    0x03,0x32,0x14,0x23,0x22,0x34,0x01,0x49,0x49,0x46,
-    0x06,0x2f,0xad,0xad,0x00,0x01,0xff,0xb9,0x05,0x82,
-    0x00,0x48,0x06,0x2f,0x00,0x05,0x00,0x00,0x03,0x32,
-    0x14,0x23,0x22,0x34,0x01,0x49,0x49,0x46,0x06,0x2f,
-    0xad,0xad,0x00,0x03,0xff,0x6d,0xfd,0xd4,0x01,0x46,
-    0xff,0xb0,0x00,0x05,0x00,0x0b,0x00,0x11,0x00,0x00,
-    0x07,0x32,0x14,0x23,0x22,0x34,0x17,0x32,0x14,0x23,
-    0x22,0x34,0x17,0x32,0x14,0x23,0x22,0x34,0x4d,0x49,
-    0x49,0x46,0xea,0x49,0x49,0x46,0xec,0x49,0x49,0x46,
-    0x50,0xad,0xad,0x97,0xad,0xad,0x98,0xad,0xad,0x00,
-    0x00,0x00,0x00,0x01,0xff,0xba,0x02,0x73,0x00,0x49,
-    0x03,0x20,0x00,0x05,0x00,0x00,0x11,0x32,0x14,0x23,
-    0x22,0x34,0x49,0x49,0x46,0x03,0x20,0xad,0xad,0x00,
-    0x00,0x01,0xff,0xcd,0xfe,0x03,0x00,0x34,0xff,0x63,
-    0x00,0x03,0x00,0x00,0x13,0x23,0x11,0x33,0x34,0x67,
-    0x67,0xfe,0x03,0x01,0x60,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x3b,0x04,0x78,0x01,0xf4,0x05,0x09,0x00,0x03,
-    0x00,0x00,0x01,0x21,0x35,0x21,0x01,0xf4,0xfe,0x47,
-    0x01,0xb9,0x04,0x78,0x91,0x00,0x00,0x01,0xff,0xba,
-    0x05,0x82,0x00,0x49,0x06,0x2f,0x00,0x05,0x00,0x00,
-    0x11,0x32,0x14,0x23,0x22,0x34,0x49,0x49,0x46,0x06,
-    0x2f,0xad,0xad,0x00,0x00,0x01,0xff,0xba,0x05,0x6e,
-    0x00,0x49,0x06,0x1b,0x00,0x05,0x00,0x00,0x11,0x32,
-    0x14,0x23,0x22,0x34,0x49,0x49,0x46,0x06,0x1b,0xad,
-    0xad,0x00,0x00,0x01,0xff,0x34,0xfe,0x50,0x00,0xce,
-    0xff,0x9e,0x00,0x07,0x00,0x00,0x17,0x23,0x15,0x23,
-    0x35,0x23,0x35,0x21,0xce,0xa1,0x5d,0x9c,0x01,0x9a,
-    0xc6,0xea,0xea,0x64,0x00,0x01,0x00,0x44,0x00,0x00,
-    0x03,0x13,0x05,0x0a,0x00,0x1d,0x00,0x00,0x01,0x11,
-    0x14,0x06,0x07,0x06,0x07,0x16,0x12,0x17,0x23,0x01,
-    0x0e,0x01,0x15,0x11,0x23,0x11,0x34,0x37,0x36,0x37,
-    0x03,0x33,0x13,0x17,0x3e,0x01,0x35,0x11,0x03,0x0f,
-    0x0c,0x12,0x26,0x79,0x23,0x84,0x1a,0xab,0xfe,0xd8,
-    0x37,0x28,0x95,0x58,0x28,0x3c,0xc4,0xaa,0xc3,0x69,
-    0x38,0x28,0x05,0x0a,0xfe,0x2d,0x3c,0x5e,0x37,0x73,
-    0x34,0x53,0xfe,0xd1,0x3d,0x02,0xce,0x28,0x8f,0x76,
-    0xfe,0x5f,0x01,0xc7,0xd6,0x65,0x2d,0x1c,0x01,0xbf,
-    0xfe,0x19,0xe7,0x24,0x85,0x78,0x01,0xad,0x00,0x01,
-    0x00,0x5d,0x00,0x00,0x03,0x0a,0x05,0x1e,0x00,0x15,
-    0x00,0x00,0x13,0x36,0x32,0x1e,0x03,0x15,0x11,0x33,
-    0x15,0x21,0x35,0x21,0x11,0x34,0x27,0x26,0x23,0x22,
-    0x0f,0x01,0x5d,0x6b,0xcf,0x80,0x4f,0x2e,0x10,0x66,
-    0xfd,0x54,0x01,0xae,0x5c,0x2d,0x43,0x7d,0x4b,0x1b,
-    0x05,0x12,0x0c,0x24,0x3e,0x66,0x71,0x4f,0xfc,0xe9,
-    0x7f,0x7f,0x03,0x17,0xca,0x28,0x14,0x0a,0x03,0x00,
-    0x00,0x01,0x00,0x59,0xff,0xf7,0x02,0x3a,0x05,0x1e,
-    0x00,0x22,0x00,0x00,0x21,0x27,0x23,0x07,0x0e,0x03,
-    0x07,0x06,0x23,0x22,0x27,0x37,0x14,0x16,0x33,0x32,
-    0x36,0x35,0x11,0x34,0x26,0x23,0x22,0x07,0x35,0x36,
-    0x32,0x1e,0x03,0x15,0x11,0x01,0xc5,0x15,0x0a,0x0a,
-    0x02,0x19,0x15,0x2b,0x17,0x3f,0x47,0x25,0x26,0x13,
-    0x31,0x0f,0x84,0x73,0x38,0x54,0x26,0x47,0x43,0x82,
-    0x66,0x3a,0x21,0x0a,0xcc,0x1e,0x06,0x3a,0x1c,0x2f,
-    0x0c,0x20,0x0a,0x91,0x03,0x08,0xbd,0xbf,0x01,0xbb,
-    0x72,0x6a,0x13,0x85,0x12,0x27,0x3d,0x61,0x5c,0x3f,
-    0xfc,0x42,0x00,0x00,0x00,0x01,0x00,0x14,0x00,0x00,
-    0x02,0xc2,0x05,0x0a,0x00,0x0e,0x00,0x00,0x01,0x15,
-    0x06,0x15,0x11,0x23,0x11,0x34,0x36,0x37,0x36,0x3f,
-    0x01,0x21,0x35,0x02,0xc2,0xc2,0x97,0x1d,0x14,0x2a,
-    0x22,0x0e,0xfe,0x20,0x05,0x0a,0x74,0x46,0xd4,0xfc,
-    0x84,0x03,0x7e,0x3a,0x61,0x1d,0x3b,0x11,0x08,0x80,
-    0x00,0x02,0x00,0x86,0x00,0x00,0x03,0x3c,0x05,0x1e,
-    0x00,0x0e,0x00,0x12,0x00,0x00,0x01,0x32,0x16,0x15,
-    0x11,0x23,0x11,0x34,0x2e,0x02,0x22,0x07,0x35,0x36,
-    0x03,0x23,0x11,0x33,0x01,0xbb,0xd5,0xac,0x99,0x19,
-    0x3e,0x57,0xb2,0xbd,0xa3,0x0b,0x98,0x98,0x05,0x1e,
-    0xa9,0xdd,0xfc,0x68,0x03,0x98,0x52,0x66,0x38,0x14,
-    0x1b,0x81,0x1c,0xfa,0xe2,0x03,0x30,0x00,0x00,0x01,
-    0x00,0x86,0x00,0x00,0x01,0x1d,0x05,0x0a,0x00,0x03,
-    0x00,0x00,0x21,0x23,0x11,0x33,0x01,0x1d,0x97,0x97,
-    0x05,0x0a,0x00,0x01,0x00,0x81,0x00,0x00,0x01,0xc2,
-    0x05,0x0a,0x00,0x0e,0x00,0x00,0x01,0x15,0x0e,0x01,
-    0x07,0x06,0x15,0x11,0x23,0x11,0x34,0x12,0x37,0x23,
-    0x35,0x01,0xc2,0x32,0x47,0x07,0x03,0x97,0x50,0x43,
-    0xba,0x05,0x0a,0x78,0x37,0xd1,0xbe,0x40,0x14,0xfd,
-    0x88,0x02,0x2b,0xd1,0x01,0x35,0x59,0x80,0x00,0x01,
-    0x00,0x86,0x00,0x00,0x03,0x3c,0x05,0x1e,0x00,0x13,
-    0x00,0x00,0x33,0x11,0x32,0x36,0x37,0x36,0x33,0x32,
-    0x16,0x15,0x11,0x23,0x11,0x34,0x2e,0x02,0x22,0x07,
-    0x11,0x86,0x04,0x5b,0x20,0x69,0x4d,0xd5,0xac,0x99,
-    0x19,0x3e,0x57,0x7f,0x58,0x05,0x02,0x0d,0x03,0x0c,
-    0xa9,0xdd,0xfc,0x68,0x03,0x98,0x52,0x66,0x38,0x14,
-    0x0b,0xfb,0x6f,0x00,0x00,0x00,0x00,0x01,0x00,0x5f,
-    0xff,0xec,0x03,0x4f,0x05,0x1e,0x00,0x20,0x00,0x00,
-    0x01,0x32,0x17,0x16,0x11,0x10,0x07,0x06,0x23,0x22,
-    0x27,0x26,0x19,0x01,0x33,0x11,0x10,0x17,0x1e,0x01,
-    0x32,0x36,0x37,0x36,0x11,0x10,0x27,0x2e,0x01,0x22,
-    0x07,0x35,0x36,0x01,0xe2,0x7c,0x53,0x9e,0x9f,0x5b,
-    0x7d,0x7e,0x5b,0xa0,0x9c,0x41,0x20,0x4c,0x60,0x4b,
-    0x1f,0x41,0x41,0x1f,0x4c,0x55,0x2f,0x34,0x05,0x1e,
-    0x54,0xa1,0xfe,0x5c,0xfe,0x61,0x9f,0x5b,0x5b,0xa0,
-    0x01,0x9e,0x02,0x84,0xfd,0x7c,0xfe,0xcc,0x77,0x3a,
-    0x32,0x32,0x3a,0x78,0x01,0x33,0x01,0x31,0x7a,0x3a,
-    0x32,0x0a,0x81,0x0b,0x00,0x01,0x00,0x83,0x01,0xd2,
-    0x01,0x1a,0x05,0x0a,0x00,0x05,0x00,0x00,0x01,0x06,
-    0x07,0x23,0x11,0x33,0x01,0x1a,0x6d,0x03,0x27,0x97,
-    0x02,0x71,0x9b,0x04,0x03,0x38,0x00,0x01,0x00,0x2d,
-    0xfe,0x14,0x02,0x56,0x05,0x1e,0x00,0x0e,0x00,0x00,
-    0x13,0x36,0x32,0x1e,0x01,0x17,0x16,0x15,0x11,0x23,
-    0x11,0x10,0x23,0x22,0x07,0x2d,0x66,0xac,0x7f,0x51,
-    0x19,0x2e,0x99,0xd9,0x5b,0x5c,0x04,0xfc,0x22,0x3d,
-    0x67,0x4c,0x88,0xd0,0xfb,0x3e,0x04,0xc2,0x01,0xc0,
-    0x28,0x00,0x00,0x01,0x00,0x2d,0xff,0xec,0x02,0x56,
-    0x05,0x1e,0x00,0x1e,0x00,0x00,0x13,0x36,0x32,0x1e,
-    0x01,0x17,0x16,0x1d,0x01,0x14,0x0e,0x03,0x22,0x27,
-    0x35,0x1e,0x01,0x32,0x3e,0x02,0x37,0x36,0x3d,0x01,
-    0x10,0x23,0x22,0x07,0x2d,0x66,0xac,0x7f,0x51,0x19,
-    0x2e,0x10,0x31,0x4d,0x85,0xbe,0x54,0x4d,0x4b,0x4b,
-    0x4b,0x2d,0x1e,0x06,0x0b,0xd7,0x51,0x66,0x04,0xfc,
-    0x22,0x3d,0x67,0x4c,0x88,0xd0,0xc6,0x52,0x8e,0x96,
-    0x6a,0x44,0x1c,0x89,0x1a,0x07,0x2c,0x4d,0x53,0x34,
-    0x55,0x4b,0xc6,0x01,0xc0,0x27,0x00,0x00,0x00,0x01,
-    0x00,0x2c,0x00,0x00,0x02,0x81,0x06,0x1c,0x00,0x0f,
-    0x00,0x00,0x13,0x21,0x15,0x06,0x02,0x07,0x06,0x03,
-    0x23,0x36,0x12,0x37,0x13,0x21,0x11,0x33,0xc3,0x01,
-    0xbe,0x1d,0x6c,0x18,0x19,0x46,0x96,0x09,0x4a,0x0a,
-    0xa6,0xfe,0x3e,0x97,0x05,0x0e,0x86,0x75,0xfe,0x46,
-    0x62,0x88,0xfe,0x91,0x34,0x01,0x82,0x3a,0x02,0x99,
-    0x01,0x93,0x00,0x02,0x00,0x86,0x00,0x00,0x03,0x3c,
-    0x05,0x1e,0x00,0x08,0x00,0x11,0x00,0x00,0x33,0x11,
-    0x36,0x20,0x1e,0x02,0x15,0x11,0x27,0x11,0x34,0x2e,
-    0x02,0x22,0x07,0x11,0x86,0xa1,0x01,0x0b,0x90,0x5a,
-    0x20,0x98,0x13,0x3c,0x57,0x90,0x50,0x05,0x07,0x17,
-    0x22,0x5b,0x8d,0x73,0xfc,0x5f,0x7f,0x03,0x22,0x55,
-    0x5f,0x38,0x10,0x0a,0xfb,0xec,0x00,0x01,0x00,0x35,
-    0x00,0x00,0x03,0x24,0x05,0x1e,0x00,0x2b,0x00,0x00,
-    0x00,0x32,0x1e,0x03,0x17,0x16,0x15,0x11,0x21,0x35,
-    0x33,0x11,0x34,0x27,0x26,0x27,0x26,0x22,0x06,0x07,
-    0x06,0x0f,0x01,0x03,0x23,0x13,0x3e,0x01,0x2e,0x04,
-    0x35,0x33,0x1e,0x01,0x17,0x33,0x3e,0x02,0x01,0xee,
-    0x66,0x52,0x35,0x27,0x14,0x06,0x08,0xfe,0x85,0xe4,
-    0x13,0x18,0x27,0x18,0x4f,0x50,0x18,0x30,0x11,0x07,
-    0x57,0x98,0x4d,0x0a,0x01,0x08,0x0b,0x12,0x0a,0x12,
-    0x97,0x06,0x22,0x06,0x09,0x09,0x37,0x37,0x05,0x1e,
-    0x21,0x32,0x51,0x4b,0x35,0x52,0x65,0xfc,0xbd,0x7f,
-    0x02,0xc4,0xb0,0x3b,0x4a,0x15,0x0d,0x2c,0x20,0x40,
-    0x35,0x16,0xfc,0x3d,0x03,0x55,0x73,0x4d,0x3b,0x2f,
-    0x3c,0x1f,0x2f,0x01,0x0f,0x6c,0x1b,0x16,0x42,0x2d,
-    0x00,0x00,0x00,0x01,0x00,0x58,0xfe,0x14,0x01,0x24,
-    0x05,0x0a,0x00,0x0a,0x00,0x00,0x01,0x11,0x23,0x11,
-    0x34,0x26,0x2f,0x01,0x33,0x1e,0x01,0x01,0x24,0x98,
-    0x1a,0x0d,0x0d,0x99,0x14,0x1f,0x03,0x6e,0xfa,0xa6,
-    0x05,0x5a,0x62,0xce,0x36,0x36,0x45,0xf3,0x00,0x00,
-    0x00,0x01,0x00,0x28,0x00,0x00,0x01,0xe9,0x05,0x1e,
-    0x00,0x1a,0x00,0x00,0x13,0x36,0x32,0x1e,0x03,0x17,
-    0x16,0x15,0x11,0x14,0x06,0x0f,0x01,0x21,0x35,0x21,
-    0x36,0x35,0x11,0x34,0x27,0x26,0x23,0x22,0x07,0x5b,
-    0x4a,0x68,0x54,0x39,0x28,0x17,0x07,0x09,0x15,0x0a,
-    0x0b,0xfe,0x69,0x01,0x12,0x18,0x18,0x1d,0x57,0x24,
-    0x47,0x05,0x0d,0x11,0x15,0x22,0x3b,0x3a,0x2c,0x40,
-    0x6d,0xfd,0xbb,0x4c,0xaa,0x2f,0x2f,0x7f,0x53,0x82,
-    0x02,0x88,0x53,0x31,0x3a,0x11,0x00,0x00,0x00,0x02,
-    0x00,0x57,0xff,0xec,0x03,0x46,0x05,0x1e,0x00,0x15,
-    0x00,0x26,0x00,0x00,0x01,0x32,0x17,0x16,0x17,0x16,
-    0x10,0x0e,0x01,0x07,0x06,0x23,0x22,0x27,0x26,0x02,
-    0x35,0x10,0x37,0x07,0x35,0x36,0x0e,0x01,0x10,0x1e,
-    0x02,0x32,0x36,0x37,0x36,0x11,0x10,0x27,0x2e,0x01,
-    0x23,0x07,0x01,0xce,0x7e,0x5b,0x64,0x27,0x14,0x29,
-    0x45,0x31,0x5b,0x7e,0x9d,0x67,0x36,0x3d,0x92,0x80,
-    0xc9,0x06,0x39,0x21,0x3f,0x4b,0x60,0x4b,0x1f,0x42,
-    0x5a,0x1d,0x3f,0x26,0x56,0x05,0x1e,0x5b,0x64,0xd6,
-    0x73,0xfe,0xde,0xe6,0x96,0x31,0x5b,0x90,0x4b,0x01,
-    0x0a,0xb4,0x01,0x4d,0xbf,0x07,0x81,0x13,0xdb,0xfa,
-    0xfe,0xa2,0xd7,0x74,0x31,0x31,0x3a,0x79,0x01,0x32,
-    0x01,0x5e,0x75,0x25,0x1d,0x05,0x00,0x01,0x00,0x41,
-    0xff,0xcc,0x03,0x54,0x05,0x0a,0x00,0x16,0x00,0x00,
-    0x01,0x13,0x36,0x12,0x37,0x36,0x12,0x37,0x33,0x03,
-    0x06,0x07,0x06,0x07,0x06,0x07,0x06,0x07,0x35,0x36,
-    0x37,0x03,0x33,0x01,0x59,0x5d,0x5d,0x5d,0x15,0x0a,
-    0x24,0x09,0x98,0x37,0x16,0x1a,0x3e,0xa9,0x51,0x6b,
-    0x45,0xc4,0xc5,0x3c,0xff,0x98,0x02,0xc2,0xfd,0xe9,
-    0x3d,0x01,0x06,0xd4,0x61,0x01,0x85,0x61,0xfd,0xc7,
-    0xe2,0x65,0xef,0x60,0x2d,0x12,0x0c,0x23,0x80,0x20,
-    0x0e,0x04,0x90,0x00,0x00,0x01,0x00,0x50,0xfe,0x14,
-    0x03,0x2f,0x05,0x1e,0x00,0x1d,0x00,0x00,0x01,0x22,
-    0x26,0x10,0x36,0x33,0x32,0x17,0x16,0x17,0x16,0x15,
-    0x11,0x23,0x11,0x10,0x27,0x2e,0x01,0x22,0x06,0x07,
-    0x06,0x15,0x10,0x17,0x32,0x17,0x07,0x22,0x01,0x9c,
-    0x99,0xb3,0xca,0x9d,0x7e,0x5b,0x64,0x26,0x15,0x98,
-    0x43,0x20,0x4c,0x69,0x56,0x17,0x2d,0xc0,0x06,0x10,
-    0x1c,0x01,0x01,0xb4,0xd3,0x01,0x9f,0xf8,0x5b,0x64,
-    0xd6,0x73,0x91,0xfb,0x8f,0x04,0x71,0x01,0x32,0x79,
-    0x39,0x31,0x43,0x33,0x65,0x63,0xfe,0xdc,0x0b,0x02,
-    0x77,0x00,0x00,0x00,0x00,0x01,0x00,0x51,0xff,0xec,
-    0x03,0x2f,0x05,0x1e,0x00,0x26,0x00,0x00,0x12,0x26,
-    0x10,0x36,0x33,0x32,0x17,0x16,0x17,0x16,0x10,0x0e,
-    0x01,0x07,0x06,0x23,0x22,0x2f,0x01,0x35,0x16,0x33,
-    0x32,0x11,0x10,0x27,0x2e,0x01,0x22,0x06,0x07,0x06,
-    0x15,0x14,0x16,0x1f,0x01,0x07,0x27,0xf9,0xa8,0xca,
-    0x9d,0x7e,0x5a,0x65,0x25,0x15,0x2b,0x49,0x33,0x5d,
-    0x7f,0x76,0x64,0x20,0x85,0x75,0xe7,0x41,0x1f,0x4a,
-    0x69,0x57,0x17,0x2d,0x59,0x67,0x16,0x1b,0x15,0x01,
-    0xbb,0xd5,0x01,0x97,0xf7,0x5b,0x65,0xd5,0x73,0xfe,
-    0xde,0xe6,0x95,0x31,0x5c,0x12,0x05,0x85,0x18,0x02,
-    0x15,0x01,0x35,0x76,0x39,0x31,0x44,0x34,0x67,0x62,
-    0x8f,0x98,0x04,0x02,0x78,0x02,0x00,0x00,0x00,0x01,
-    0x00,0x03,0xfe,0x14,0x02,0x98,0x05,0x0a,0x00,0x10,
-    0x00,0x00,0x01,0x11,0x14,0x07,0x0e,0x01,0x07,0x11,
-    0x23,0x11,0x03,0x33,0x13,0x3e,0x01,0x35,0x11,0x02,
-    0x98,0x3c,0x20,0x7e,0x59,0x9c,0xc6,0xa6,0xbd,0x4e,
-    0x4d,0x05,0x0a,0xfe,0x39,0x86,0x6d,0x3a,0x50,0x0d,
-    0xfc,0x5b,0x04,0x1a,0x02,0xdc,0xfd,0x29,0x1b,0x82,
-    0x73,0x01,0xc7,0x00,0x00,0x00,0x00,0x01,0x00,0x3a,
-    0x00,0x00,0x03,0x05,0x05,0x0a,0x00,0x11,0x00,0x00,
-    0x29,0x01,0x35,0x21,0x17,0x03,0x01,0x33,0x01,0x36,
-    0x1b,0x01,0x33,0x07,0x06,0x02,0x07,0x13,0x02,0xeb,
-    0xfd,0x52,0x01,0x54,0xaf,0xb6,0xfe,0xb0,0x9f,0x01,
-    0x10,0x4b,0x1c,0x1d,0x98,0x15,0x16,0x4f,0x60,0xc0,
-    0x7f,0x04,0x01,0x65,0x03,0x2a,0xfd,0x53,0x52,0x01,
-    0x2e,0x01,0x2c,0xd8,0xe8,0xfe,0xf6,0x5e,0xfe,0x6f,
-    0x00,0x00,0x00,0x02,0x00,0x8d,0xfe,0x14,0x03,0x59,
-    0x05,0x0a,0x00,0x1b,0x00,0x1f,0x00,0x00,0x25,0x15,
-    0x23,0x35,0x34,0x3e,0x04,0x37,0x36,0x12,0x37,0x21,
-    0x35,0x21,0x15,0x03,0x0e,0x06,0x07,0x06,0x01,0x23,
-    0x11,0x33,0x02,0x38,0x95,0x0e,0x09,0x11,0x0c,0x17,
-    0x06,0x1b,0x79,0x33,0xfd,0xd2,0x02,0xcc,0xa7,0x03,
-    0x1c,0x0a,0x1a,0x0b,0x13,0x0a,0x05,0x0a,0xfe,0xed,
-    0x97,0x97,0x16,0x16,0x16,0x2a,0x4e,0x31,0x49,0x31,
-    0x57,0x18,0x5e,0x01,0xcc,0xb8,0x80,0x70,0xfd,0x9d,
-    0x0b,0x68,0x24,0x60,0x2d,0x52,0x30,0x1f,0x34,0xfd,
-    0xd6,0x04,0xe7,0x00,0x00,0x00,0x00,0x01,0x00,0x1d,
-    0x00,0x00,0x02,0x4f,0x05,0x1e,0x00,0x0e,0x00,0x00,
-    0x13,0x32,0x16,0x15,0x11,0x23,0x11,0x34,0x2e,0x02,
-    0x22,0x07,0x35,0x36,0xe4,0xd3,0x98,0x98,0x12,0x35,
-    0x52,0x89,0x78,0x74,0x05,0x1e,0xa5,0xe1,0xfc,0x68,
-    0x03,0x98,0x53,0x60,0x3d,0x14,0x0c,0x82,0x0c,0x00,
-    0x00,0x00,0x00,0x01,0x00,0x40,0x00,0x00,0x04,0x2a,
-    0x05,0x0a,0x00,0x1c,0x00,0x00,0x21,0x23,0x03,0x33,
-    0x13,0x3e,0x01,0x37,0x13,0x33,0x03,0x06,0x07,0x06,
-    0x07,0x13,0x33,0x32,0x36,0x12,0x37,0x13,0x33,0x03,
-    0x02,0x07,0x0e,0x02,0x01,0x69,0xbe,0x6b,0x92,0x3b,
-    0x66,0x61,0x0f,0x1d,0x8f,0x1d,0x10,0x2c,0x4b,0xd3,
-    0x1b,0x36,0x90,0xde,0x7f,0x10,0x34,0x90,0x34,0x1e,
-    0xa8,0x33,0x7e,0xaf,0x05,0x0a,0xfd,0x3a,0x25,0xab,
-    0xac,0x01,0x4a,0xfe,0xb7,0xaf,0x66,0xb2,0x33,0xfe,
-    0xba,0x9b,0x01,0x0b,0xb0,0x02,0x33,0xfd,0xcd,0xfe,
-    0xae,0xc3,0x3c,0x53,0x33,0x00,0x00,0x01,0x00,0x15,
-    0xff,0xfa,0x03,0x30,0x05,0x1e,0x00,0x21,0x00,0x00,
-    0x13,0x32,0x36,0x37,0x36,0x32,0x1e,0x03,0x15,0x11,
-    0x23,0x11,0x34,0x27,0x26,0x22,0x07,0x11,0x14,0x06,
-    0x23,0x22,0x27,0x35,0x16,0x33,0x32,0x36,0x35,0x11,
-    0x06,0x07,0x47,0x03,0x55,0x29,0x73,0xe2,0x88,0x4f,
-    0x2e,0x0e,0x97,0x62,0x2f,0x82,0x51,0x4f,0x74,0x25,
-    0x38,0x30,0x05,0x2d,0x26,0x19,0x3d,0x04,0xff,0x0c,
-    0x05,0x0e,0x2c,0x45,0x6b,0x68,0x44,0xfc,0x6a,0x03,
-    0x96,0xca,0x28,0x14,0x05,0xfc,0xca,0xcb,0x9c,0x0d,
-    0x84,0x09,0x3f,0x3f,0x03,0x89,0x03,0x08,0x00,0x00,
-    0x00,0x01,0x00,0x23,0x03,0x29,0x01,0x3a,0x05,0x0a,
-    0x00,0x09,0x00,0x00,0x01,0x17,0x06,0x07,0x06,0x07,
-    0x23,0x3e,0x01,0x37,0x01,0x2d,0x0d,0x08,0x1e,0x2c,
-    0x58,0x6d,0x18,0x27,0x26,0x05,0x0a,0x15,0x1f,0x5c,
-    0x85,0xcc,0x53,0xb4,0xda,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x23,0x03,0x29,0x02,0x87,0x05,0x0a,0x00,0x09,
-    0x00,0x12,0x00,0x00,0x01,0x17,0x06,0x07,0x06,0x07,
-    0x23,0x3e,0x01,0x37,0x05,0x06,0x03,0x23,0x36,0x37,
-    0x36,0x37,0x33,0x01,0x2d,0x0d,0x08,0x1e,0x2c,0x58,
-    0x6d,0x18,0x27,0x26,0x01,0xff,0x31,0x79,0x6e,0x37,
-    0x04,0x19,0x11,0xa6,0x05,0x0a,0x15,0x1f,0x5c,0x85,
-    0xcc,0x53,0xb4,0xda,0x15,0xb7,0xfe,0xeb,0xdc,0x13,
-    0x7d,0x75,0x00,0x00,0x00,0x01,0x00,0x4e,0x01,0xe9,
-    0x03,0xa1,0x02,0x67,0x00,0x03,0x00,0x00,0x01,0x21,
-    0x35,0x21,0x03,0xa1,0xfc,0xad,0x03,0x53,0x01,0xe9,
-    0x7e,0x00,0x00,0x01,0x00,0x4e,0x01,0xe9,0x07,0x17,
-    0x02,0x67,0x00,0x03,0x00,0x00,0x01,0x21,0x35,0x21,
-    0x07,0x17,0xf9,0x37,0x06,0xc9,0x01,0xe9,0x7e,0x00,
-    0x00,0x01,0x00,0x23,0x03,0xd6,0x01,0x39,0x05,0xb6,
-    0x00,0x06,0x00,0x00,0x13,0x33,0x02,0x07,0x23,0x27,
-    0x36,0xcd,0x6c,0x4b,0x19,0xa4,0x0e,0x42,0x05,0xb6,
-    0xfe,0xee,0xce,0x17,0xe9,0x00,0x00,0x01,0x00,0x23,
-    0x03,0xd6,0x01,0x39,0x05,0xb6,0x00,0x06,0x00,0x00,
-    0x01,0x17,0x06,0x07,0x23,0x36,0x37,0x01,0x2b,0x0e,
-    0x39,0x70,0x6d,0x47,0x1d,0x05,0xb6,0x16,0xcf,0xfb,
-    0xfc,0xe4,0x00,0x01,0x00,0x45,0xfe,0xf8,0x01,0x5c,
-    0x00,0xd8,0x00,0x06,0x00,0x00,0x25,0x17,0x06,0x07,
-    0x23,0x12,0x37,0x01,0x4e,0x0e,0x3f,0x6b,0x6d,0x47,
-    0x1d,0xd8,0x17,0xde,0xeb,0x00,0xff,0xe1,0x00,0x02,
-    0x00,0x23,0x03,0xd6,0x02,0x87,0x05,0xb6,0x00,0x06,
-    0x00,0x0d,0x00,0x00,0x13,0x33,0x02,0x07,0x23,0x27,
-    0x36,0x25,0x33,0x02,0x07,0x23,0x27,0x36,0xcd,0x6c,
-    0x4b,0x19,0xa4,0x0e,0x42,0x01,0xb4,0x6e,0x49,0x1c,
-    0xa4,0x0e,0x40,0x05,0xb6,0xfe,0xee,0xce,0x17,0xe9,
-    0xe0,0xfe,0xf9,0xd9,0x17,0xdd,0x00,0x00,0x00,0x02,
-    0x00,0x23,0x03,0xd6,0x02,0x87,0x05,0xb6,0x00,0x06,
-    0x00,0x0d,0x00,0x00,0x01,0x17,0x06,0x07,0x23,0x36,
-    0x37,0x21,0x17,0x06,0x07,0x23,0x36,0x37,0x01,0x2c,
-    0x0e,0x3d,0x6c,0x6e,0x46,0x1f,0x01,0xf1,0x0e,0x3e,
-    0x6c,0x6c,0x46,0x1e,0x05,0xb6,0x16,0xd7,0xf3,0xfb,
-    0xe5,0x16,0xd8,0xf2,0xf9,0xe7,0x00,0x00,0x00,0x02,
-    0x00,0x26,0xfe,0xf8,0x02,0x8a,0x00,0xd7,0x00,0x06,
-    0x00,0x0d,0x00,0x00,0x25,0x17,0x06,0x07,0x23,0x36,
-    0x37,0x21,0x17,0x06,0x03,0x23,0x12,0x37,0x01,0x2f,
-    0x0e,0x3d,0x6c,0x6e,0x46,0x1f,0x01,0xf0,0x0f,0x37,
-    0x73,0x6d,0x4a,0x1b,0xd7,0x17,0xd8,0xf0,0xfd,0xe2,
-    0x17,0xc5,0xfe,0xfd,0x01,0x19,0xc6,0x00,0x00,0x01,
-    0x00,0x78,0x00,0x00,0x03,0x2a,0x06,0x14,0x00,0x0b,
-    0x00,0x00,0x01,0x25,0x15,0x25,0x13,0x23,0x13,0x05,
-    0x35,0x05,0x03,0x33,0x01,0xf7,0x01,0x33,0xfe,0xcd,
-    0x22,0xa5,0x22,0xfe,0xe2,0x01,0x1e,0x22,0xa5,0x04,
-    0x6c,0x16,0x89,0x11,0xfb,0xf6,0x04,0x0a,0x11,0x89,
-    0x16,0x01,0xa8,0x00,0x00,0x01,0x00,0x74,0x00,0x00,
-    0x03,0x2d,0x06,0x14,0x00,0x15,0x00,0x00,0x01,0x25,
-    0x15,0x25,0x13,0x03,0x25,0x15,0x25,0x13,0x23,0x13,
-    0x05,0x35,0x05,0x03,0x13,0x05,0x35,0x05,0x03,0x33,
-    0x01,0xfa,0x01,0x33,0xfe,0xcd,0x16,0x16,0x01,0x33,
-    0xfe,0xcd,0x22,0xa5,0x22,0xfe,0xdb,0x01,0x25,0x17,
-    0x17,0xfe,0xdb,0x01,0x25,0x22,0xa5,0x04,0x98,0x16,
-    0x89,0x11,0xfe,0xdc,0xfe,0xcd,0x11,0x89,0x15,0xfe,
-    0x84,0x01,0x7c,0x15,0x89,0x11,0x01,0x33,0x01,0x24,
-    0x11,0x89,0x16,0x01,0x7c,0x00,0x00,0x01,0x00,0x91,
-    0x01,0xe4,0x02,0x6a,0x03,0xf3,0x00,0x07,0x00,0x00,
-    0x12,0x36,0x32,0x16,0x14,0x06,0x22,0x26,0x91,0x7a,
-    0xe5,0x7a,0x7b,0xe3,0x7b,0x03,0x6d,0x86,0x87,0xff,
-    0x89,0x89,0x00,0x03,0x00,0x7e,0xff,0xec,0x04,0xf6,
-    0x00,0xe7,0x00,0x06,0x00,0x0e,0x00,0x15,0x00,0x00,
-    0x17,0x22,0x34,0x32,0x15,0x14,0x06,0x25,0x32,0x16,
-    0x14,0x06,0x23,0x22,0x34,0x20,0x32,0x15,0x14,0x06,
-    0x23,0x22,0xe8,0x6a,0xd5,0x39,0x01,0xa0,0x32,0x39,
-    0x3a,0x31,0x6b,0x01,0xd1,0xd6,0x3a,0x31,0x6b,0x14,
-    0xfb,0x7d,0x3f,0x3f,0xfb,0x3e,0x7d,0x40,0xfb,0x7d,
-    0x3e,0x40,0x00,0x00,0x00,0x07,0x00,0x53,0xff,0xed,
-    0x06,0xf2,0x05,0xcb,0x00,0x07,0x00,0x0c,0x00,0x15,
-    0x00,0x1e,0x00,0x26,0x00,0x30,0x00,0x39,0x00,0x00,
-    0x12,0x36,0x32,0x16,0x10,0x06,0x22,0x26,0x01,0x33,
-    0x02,0x01,0x23,0x03,0x22,0x06,0x10,0x16,0x32,0x36,
-    0x35,0x10,0x01,0x32,0x16,0x10,0x06,0x22,0x26,0x35,
-    0x10,0x04,0x36,0x32,0x16,0x10,0x06,0x22,0x26,0x01,
-    0x22,0x06,0x10,0x16,0x33,0x32,0x36,0x35,0x10,0x21,
-    0x22,0x06,0x10,0x16,0x32,0x36,0x35,0x10,0x53,0x74,
-    0xe6,0x77,0x7a,0xe4,0x73,0x03,0x04,0x80,0x70,0xfe,
-    0x6b,0x82,0x17,0x35,0x2e,0x2f,0x6b,0x31,0x02,0x4b,
-    0x74,0x77,0x7b,0xe2,0x74,0x02,0x1c,0x74,0xe5,0x77,
-    0x7a,0xe3,0x73,0xfe,0xc9,0x35,0x2e,0x2f,0x37,0x35,
-    0x31,0x01,0xb3,0x34,0x2e,0x2f,0x6b,0x30,0x04,0xe1,
-    0xea,0xe8,0xfe,0x41,0xef,0xea,0x02,0x97,0xfe,0xc5,
-    0xfb,0x85,0x05,0x57,0xa4,0xfe,0x9e,0xa5,0xa6,0xb0,
-    0x01,0x55,0xfe,0x2a,0xe8,0xfe,0x41,0xed,0xeb,0xdf,
-    0x01,0xca,0xe9,0xe9,0xe7,0xfe,0x41,0xee,0xea,0x02,
-    0x36,0xa4,0xfe,0x9f,0xa5,0xa8,0xae,0x01,0x54,0xa4,
-    0xfe,0x9f,0xa5,0xa5,0xb1,0x01,0x54,0x00,0x00,0x00,
-    0x00,0x01,0x00,0x4f,0x00,0x83,0x01,0xdf,0x03,0xaf,
-    0x00,0x06,0x00,0x00,0x01,0x03,0x13,0x07,0x01,0x35,
-    0x01,0x01,0xdf,0xdb,0xdb,0x6a,0xfe,0xda,0x01,0x26,
-    0x03,0x73,0xfe,0xa7,0xfe,0xa6,0x3d,0x01,0x89,0x1a,
-    0x01,0x89,0x00,0x00,0x00,0x01,0x00,0x4f,0x00,0x83,
-    0x01,0xdf,0x03,0xaf,0x00,0x06,0x00,0x00,0x01,0x15,
-    0x01,0x27,0x13,0x03,0x37,0x01,0xdf,0xfe,0xdb,0x6b,
-    0xdb,0xdb,0x6b,0x02,0x26,0x1a,0xfe,0x77,0x3d,0x01,
-    0x5a,0x01,0x59,0x3c,0x00,0x01,0xfe,0xbe,0x00,0x00,
-    0x02,0x36,0x05,0xb6,0x00,0x03,0x00,0x00,0x2b,0x01,
-    0x01,0x33,0xc1,0x81,0x02,0xf7,0x81,0x05,0xb6,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x8d,0x00,0x00,0x04,0x82,
-    0x05,0x0a,0x00,0x18,0x00,0x2d,0x00,0x00,0x13,0x21,
-    0x32,0x17,0x1e,0x04,0x15,0x30,0x11,0x23,0x11,0x34,
-    0x2e,0x03,0x27,0x26,0x2b,0x01,0x11,0x23,0x01,0x11,
-    0x10,0x07,0x0e,0x03,0x2b,0x01,0x11,0x33,0x11,0x33,
-    0x32,0x37,0x36,0x37,0x36,0x35,0x11,0x8d,0x01,0x4e,
-    0x93,0x66,0x29,0x38,0x1d,0x0e,0x02,0x93,0x10,0x10,
-    0x1a,0x23,0x19,0x3c,0x42,0xb7,0x97,0x03,0xf5,0x39,
-    0x17,0x53,0x72,0xa9,0x69,0xb9,0x97,0x22,0xbe,0x5e,
-    0x56,0x17,0x0b,0x05,0x0a,0x32,0x14,0x52,0x3f,0x78,
-    0x46,0x25,0xfd,0xf9,0x01,0xe0,0xa5,0x42,0x31,0x18,
-    0x1a,0x05,0x0c,0xfb,0x7c,0x05,0x0a,0xfd,0xa7,0xfe,
-    0xf4,0x8b,0x38,0x6f,0x47,0x2c,0x03,0xc0,0xfc,0xc5,
-    0x5c,0x54,0xb8,0x53,0x71,0x02,0x59,0x00,0x00,0x01,
-    0x00,0x24,0xff,0xec,0x03,0x37,0x05,0xcd,0x00,0x25,
-    0x00,0x00,0x13,0x33,0x1a,0x01,0x33,0x32,0x17,0x07,
-    0x26,0x23,0x22,0x03,0x21,0x15,0x21,0x07,0x17,0x21,
-    0x15,0x21,0x12,0x33,0x32,0x37,0x15,0x06,0x23,0x20,
-    0x03,0x23,0x35,0x33,0x26,0x3d,0x01,0x34,0x37,0x23,
-    0x24,0x8a,0x18,0xdc,0xa3,0x84,0x6e,0x40,0x5a,0x52,
-    0xd6,0x29,0x01,0x3b,0xfe,0xbd,0x02,0x02,0x01,0x1e,
-    0xfe,0xea,0x27,0xe3,0x6f,0x60,0x5e,0x75,0xfe,0x92,
-    0x36,0x8a,0x83,0x01,0x01,0x83,0x03,0x92,0x01,0x08,
-    0x01,0x33,0x49,0x81,0x39,0xfe,0x56,0x6e,0x48,0x68,
-    0x6d,0xfe,0x76,0x37,0x93,0x35,0x02,0x1b,0x6d,0x1e,
-    0x3a,0x1a,0x29,0x15,0x00,0x02,0x00,0x0d,0x02,0xe5,
-    0x05,0x0a,0x05,0xb6,0x00,0x07,0x00,0x18,0x00,0x00,
-    0x01,0x23,0x11,0x23,0x11,0x23,0x35,0x21,0x01,0x23,
-    0x11,0x37,0x23,0x03,0x23,0x03,0x23,0x17,0x11,0x23,
-    0x11,0x33,0x1b,0x01,0x33,0x02,0x0f,0xcc,0x6c,0xca,
-    0x02,0x02,0x02,0xfb,0x6c,0x05,0x07,0xc2,0x62,0xbd,
-    0x08,0x06,0x68,0xa3,0xb7,0xbd,0xa2,0x05,0x53,0xfd,
-    0x92,0x02,0x6e,0x63,0xfd,0x2f,0x01,0xa0,0xa5,0xfd,
-    0xbb,0x02,0x48,0xc5,0xfe,0x7d,0x02,0xd1,0xfd,0xc9,
-    0x02,0x37,0x00,0x03,0x00,0x16,0x00,0x00,0x03,0x26,
-    0x06,0x1f,0x00,0x16,0x00,0x1e,0x00,0x22,0x00,0x00,
-    0x13,0x34,0x36,0x33,0x32,0x17,0x07,0x26,0x23,0x0e,
-    0x01,0x1d,0x01,0x33,0x15,0x23,0x11,0x23,0x11,0x23,
-    0x35,0x36,0x37,0x00,0x36,0x32,0x16,0x14,0x06,0x22,
-    0x26,0x13,0x23,0x11,0x33,0x9e,0x76,0x87,0x52,0x46,
-    0x2d,0x33,0x2f,0x3f,0x31,0xaf,0xaf,0x96,0x88,0x19,
-    0x6f,0x01,0xd5,0x32,0x52,0x2f,0x30,0x51,0x32,0xa5,
-    0x98,0x98,0x04,0xa1,0xc7,0xb7,0x20,0x7e,0x19,0x02,
-    0x6e,0x8c,0x58,0x7e,0xfc,0x38,0x03,0xc8,0x50,0x0b,
-    0x2b,0x01,0x56,0x3b,0x3b,0x67,0x3b,0x3b,0xfa,0xc3,
-    0x04,0x47,0x00,0x00,0x00,0x02,0x00,0x16,0x00,0x00,
-    0x03,0x17,0x06,0x1f,0x00,0x16,0x00,0x1a,0x00,0x00,
-    0x13,0x34,0x36,0x33,0x32,0x17,0x07,0x26,0x23,0x0e,
-    0x01,0x1d,0x01,0x33,0x15,0x23,0x11,0x23,0x11,0x23,
-    0x35,0x36,0x37,0x01,0x23,0x11,0x33,0x9e,0x76,0x87,
-    0x52,0x46,0x2d,0x33,0x2f,0x3f,0x31,0xaf,0xaf,0x96,
-    0x88,0x19,0x6f,0x02,0x79,0x98,0x98,0x04,0xa1,0xc7,
-    0xb7,0x20,0x7e,0x19,0x02,0x6e,0x8c,0x58,0x7e,0xfc,
-    0x38,0x03,0xc8,0x50,0x0b,0x2b,0xfb,0xb2,0x06,0x14,
-    0x00,0x00,0x00,0x02,0x00,0x40,0x00,0x00,0x04,0x3c,
-    0x06,0x06,0x00,0x05,0x00,0x22,0x00,0x00,0x01,0x32,
-    0x14,0x23,0x22,0x34,0x01,0x23,0x03,0x33,0x13,0x3e,
-    0x01,0x37,0x13,0x33,0x03,0x06,0x07,0x06,0x07,0x13,
-    0x33,0x32,0x36,0x12,0x37,0x13,0x33,0x03,0x02,0x07,
-    0x0e,0x02,0x03,0xf3,0x49,0x49,0x46,0xfd,0xbc,0xbe,
-    0x6b,0x92,0x3b,0x66,0x61,0x0f,0x1d,0x8f,0x1d,0x10,
-    0x2c,0x4b,0xd3,0x1b,0x36,0x90,0xde,0x7f,0x10,0x34,
-    0x90,0x34,0x1e,0xa8,0x33,0x7e,0xaf,0x06,0x06,0xad,
-    0xad,0xf9,0xfa,0x05,0x0a,0xfd,0x3a,0x25,0xab,0xac,
-    0x01,0x4a,0xfe,0xb7,0xaf,0x66,0xb2,0x33,0xfe,0xba,
-    0x9b,0x01,0x0b,0xb0,0x02,0x33,0xfd,0xcd,0xfe,0xae,
-    0xc3,0x3c,0x53,0x33,0x00,0x00,0x00,0x02,0x00,0x25,
-    0x00,0x00,0x04,0x2a,0x05,0xf2,0x00,0x05,0x00,0x22,
-    0x00,0x00,0x13,0x32,0x14,0x23,0x22,0x34,0x01,0x23,
-    0x03,0x33,0x13,0x3e,0x01,0x37,0x13,0x33,0x03,0x06,
-    0x07,0x06,0x07,0x13,0x33,0x32,0x36,0x12,0x37,0x13,
-    0x33,0x03,0x02,0x07,0x0e,0x02,0x6b,0x49,0x49,0x46,
-    0x01,0x44,0xbe,0x6b,0x92,0x3b,0x66,0x61,0x0f,0x1d,
-    0x8f,0x1d,0x10,0x2c,0x4b,0xd3,0x1b,0x36,0x90,0xde,
-    0x7f,0x10,0x34,0x90,0x34,0x1e,0xa8,0x33,0x7e,0xaf,
-    0x05,0xf2,0xad,0xad,0xfa,0x0e,0x05,0x0a,0xfd,0x3a,
-    0x25,0xab,0xac,0x01,0x4a,0xfe,0xb7,0xaf,0x66,0xb2,
-    0x33,0xfe,0xba,0x9b,0x01,0x0b,0xb0,0x02,0x33,0xfd,
-    0xcd,0xfe,0xae,0xc3,0x3c,0x53,0x33,0x00,0x00,0x00,
-    0x00,0x03,0x00,0x40,0x00,0x00,0x04,0x3c,0x06,0x06,
-    0x00,0x05,0x00,0x22,0x00,0x28,0x00,0x00,0x01,0x32,
-    0x14,0x23,0x22,0x34,0x01,0x23,0x03,0x33,0x13,0x3e,
-    0x01,0x37,0x13,0x33,0x03,0x06,0x07,0x06,0x07,0x13,
-    0x33,0x32,0x36,0x12,0x37,0x13,0x33,0x03,0x02,0x07,
-    0x0e,0x02,0x13,0x32,0x14,0x23,0x22,0x34,0x03,0xf3,
-    0x49,0x49,0x46,0xfd,0xbc,0xbe,0x6b,0x92,0x3b,0x66,
-    0x61,0x0f,0x1d,0x8f,0x1d,0x10,0x2c,0x4b,0xd3,0x1b,
-    0x36,0x90,0xde,0x7f,0x10,0x34,0x90,0x34,0x1e,0xa8,
-    0x33,0x7e,0xaf,0x60,0x49,0x49,0x46,0x06,0x06,0xad,
-    0xad,0xf9,0xfa,0x05,0x0a,0xfd,0x3a,0x25,0xab,0xac,
-    0x01,0x4a,0xfe,0xb7,0xaf,0x66,0xb2,0x33,0xfe,0xba,
-    0x9b,0x01,0x0b,0xb0,0x02,0x33,0xfd,0xcd,0xfe,0xae,
-    0xc3,0x3c,0x53,0x33,0x02,0x08,0xad,0xad,0x00,0x00,
-    0x00,0x03,0x00,0x25,0x00,0x00,0x04,0x2a,0x05,0xf2,
-    0x00,0x05,0x00,0x22,0x00,0x28,0x00,0x00,0x13,0x32,
-    0x14,0x23,0x22,0x34,0x01,0x23,0x03,0x33,0x13,0x3e,
-    0x01,0x37,0x13,0x33,0x03,0x06,0x07,0x06,0x07,0x13,
-    0x33,0x32,0x36,0x12,0x37,0x13,0x33,0x03,0x02,0x07,
-    0x0e,0x02,0x13,0x32,0x14,0x23,0x22,0x34,0x6b,0x49,
-    0x49,0x46,0x01,0x44,0xbe,0x6b,0x92,0x3b,0x66,0x61,
-    0x0f,0x1d,0x8f,0x1d,0x10,0x2c,0x4b,0xd3,0x1b,0x36,
-    0x90,0xde,0x7f,0x10,0x34,0x90,0x34,0x1e,0xa8,0x33,
-    0x7e,0xaf,0x60,0x49,0x49,0x46,0x05,0xf2,0xad,0xad,
-    0xfa,0x0e,0x05,0x0a,0xfd,0x3a,0x25,0xab,0xac,0x01,
-    0x4a,0xfe,0xb7,0xaf,0x66,0xb2,0x33,0xfe,0xba,0x9b,
-    0x01,0x0b,0xb0,0x02,0x33,0xfd,0xcd,0xfe,0xae,0xc3,
-    0x3c,0x53,0x33,0x02,0x08,0xad,0xad,0x00,0x00,0x00,
-    0x00,0x02,0x00,0x44,0xfe,0xcc,0x03,0x13,0x05,0x0a,
-    0x00,0x1d,0x00,0x21,0x00,0x00,0x01,0x11,0x14,0x06,
-    0x07,0x06,0x07,0x16,0x12,0x17,0x23,0x01,0x0e,0x01,
-    0x15,0x11,0x23,0x11,0x34,0x37,0x36,0x37,0x03,0x33,
-    0x13,0x17,0x3e,0x01,0x35,0x11,0x13,0x21,0x35,0x21,
-    0x03,0x0f,0x0c,0x12,0x26,0x79,0x23,0x84,0x1a,0xab,
-    0xfe,0xd8,0x37,0x28,0x95,0x58,0x28,0x3c,0xc4,0xaa,
-    0xc3,0x69,0x38,0x28,0x02,0xfe,0x66,0x01,0x9a,0x05,
-    0x0a,0xfe,0x2d,0x3c,0x5e,0x37,0x73,0x34,0x53,0xfe,
-    0xd1,0x3d,0x02,0xce,0x28,0x8f,0x76,0xfe,0x5f,0x01,
-    0xc7,0xd6,0x65,0x2d,0x1c,0x01,0xbf,0xfe,0x19,0xe7,
-    0x24,0x85,0x78,0x01,0xad,0xf9,0xc2,0x52,0x00,0x00,
-    0x00,0x02,0x00,0x44,0xfd,0xe4,0x03,0x13,0x05,0x0a,
-    0x00,0x1d,0x00,0x25,0x00,0x00,0x01,0x11,0x14,0x06,
-    0x07,0x06,0x07,0x16,0x12,0x17,0x23,0x01,0x0e,0x01,
-    0x15,0x11,0x23,0x11,0x34,0x37,0x36,0x37,0x03,0x33,
-    0x13,0x17,0x3e,0x01,0x35,0x11,0x03,0x23,0x15,0x23,
-    0x35,0x23,0x35,0x21,0x03,0x0f,0x0c,0x12,0x26,0x79,
-    0x23,0x84,0x1a,0xab,0xfe,0xd8,0x37,0x28,0x95,0x58,
-    0x28,0x3c,0xc4,0xaa,0xc3,0x69,0x38,0x28,0x03,0xa4,
-    0x52,0xa4,0x01,0x9a,0x05,0x0a,0xfe,0x2d,0x3c,0x5e,
-    0x37,0x73,0x34,0x53,0xfe,0xd1,0x3d,0x02,0xce,0x28,
-    0x8f,0x76,0xfe,0x5f,0x01,0xc7,0xd6,0x65,0x2d,0x1c,
-    0x01,0xbf,0xfe,0x19,0xe7,0x24,0x85,0x78,0x01,0xad,
-    0xf9,0xc2,0xe8,0xe8,0x52,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x44,0x00,0x00,0x03,0x13,0x05,0x0a,0x00,0x1d,
-    0x00,0x23,0x00,0x00,0x01,0x11,0x14,0x06,0x07,0x06,
-    0x07,0x16,0x12,0x17,0x23,0x01,0x0e,0x01,0x15,0x11,
-    0x23,0x11,0x34,0x37,0x36,0x37,0x03,0x33,0x13,0x17,
-    0x3e,0x01,0x35,0x11,0x01,0x32,0x14,0x23,0x22,0x34,
-    0x03,0x0f,0x0c,0x12,0x26,0x79,0x23,0x84,0x1a,0xab,
-    0xfe,0xd8,0x37,0x28,0x95,0x58,0x28,0x3c,0xc4,0xaa,
-    0xc3,0x69,0x38,0x28,0xfe,0xe7,0x49,0x49,0x46,0x05,
-    0x0a,0xfe,0x2d,0x3c,0x5e,0x37,0x73,0x34,0x53,0xfe,
-    0xd1,0x3d,0x02,0xce,0x28,0x8f,0x76,0xfe,0x5f,0x01,
-    0xc7,0xd6,0x65,0x2d,0x1c,0x01,0xbf,0xfe,0x19,0xe7,
-    0x24,0x85,0x78,0x01,0xad,0xfc,0x3d,0xad,0xad,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x5d,0x00,0x00,0x03,0x0a,
-    0x05,0x1e,0x00,0x15,0x00,0x1b,0x00,0x00,0x13,0x36,
-    0x32,0x1e,0x03,0x15,0x11,0x33,0x15,0x21,0x35,0x21,
-    0x11,0x34,0x27,0x26,0x23,0x22,0x0f,0x01,0x13,0x32,
-    0x14,0x23,0x22,0x34,0x5d,0x6b,0xcf,0x80,0x4f,0x2e,
-    0x10,0x66,0xfd,0x54,0x01,0xae,0x5c,0x2d,0x43,0x7d,
-    0x4b,0x1b,0xc8,0x49,0x49,0x46,0x05,0x12,0x0c,0x24,
-    0x3e,0x66,0x71,0x4f,0xfc,0xe9,0x7f,0x7f,0x03,0x17,
-    0xca,0x28,0x14,0x0a,0x03,0xfe,0x4d,0xad,0xad,0x00,
-    0x00,0x02,0x00,0x59,0xff,0xf7,0x02,0x3a,0x05,0x1e,
-    0x00,0x22,0x00,0x28,0x00,0x00,0x21,0x27,0x23,0x07,
-    0x0e,0x03,0x07,0x06,0x23,0x22,0x27,0x37,0x14,0x16,
-    0x33,0x32,0x36,0x35,0x11,0x34,0x26,0x23,0x22,0x07,
-    0x35,0x36,0x32,0x1e,0x03,0x15,0x11,0x01,0x32,0x14,
-    0x23,0x22,0x34,0x01,0xc5,0x15,0x0a,0x0a,0x02,0x19,
-    0x15,0x2b,0x17,0x3f,0x47,0x25,0x26,0x13,0x31,0x0f,
-    0x84,0x73,0x38,0x54,0x26,0x47,0x43,0x82,0x66,0x3a,
-    0x21,0x0a,0xfe,0xbd,0x49,0x49,0x46,0xcc,0x1e,0x06,
-    0x3a,0x1c,0x2f,0x0c,0x20,0x0a,0x91,0x03,0x08,0xbd,
-    0xbf,0x01,0xbb,0x72,0x6a,0x13,0x85,0x12,0x27,0x3d,
-    0x61,0x5c,0x3f,0xfc,0x42,0x02,0xdc,0xad,0xad,0x00,
-    0x00,0x02,0x00,0x14,0x00,0x00,0x02,0xc2,0x05,0x0a,
-    0x00,0x0e,0x00,0x14,0x00,0x00,0x01,0x15,0x06,0x15,
-    0x11,0x23,0x11,0x34,0x36,0x37,0x36,0x3f,0x01,0x21,
-    0x35,0x13,0x32,0x14,0x23,0x22,0x34,0x02,0xc2,0xc2,
-    0x97,0x1d,0x14,0x2a,0x22,0x0e,0xfe,0x20,0xbb,0x49,
-    0x49,0x46,0x05,0x0a,0x74,0x46,0xd4,0xfc,0x84,0x03,
-    0x7e,0x3a,0x61,0x1d,0x3b,0x11,0x08,0x80,0xfd,0xd2,
-    0xad,0xad,0x00,0x03,0x00,0x86,0x00,0x00,0x03,0x3c,
-    0x05,0x1e,0x00,0x0e,0x00,0x12,0x00,0x18,0x00,0x00,
-    0x01,0x32,0x16,0x15,0x11,0x23,0x11,0x34,0x2e,0x02,
-    0x22,0x07,0x35,0x36,0x03,0x11,0x33,0x11,0x13,0x32,
-    0x14,0x23,0x22,0x34,0x01,0xbb,0xd5,0xac,0x99,0x19,
-    0x3e,0x57,0xb2,0xbd,0xa3,0xa3,0x98,0xc0,0x49,0x49,
-    0x46,0x05,0x1e,0xa9,0xdd,0xfc,0x68,0x03,0x98,0x52,
-    0x66,0x38,0x14,0x1b,0x81,0x1c,0xfa,0xe2,0x03,0x30,
-    0xfc,0xd0,0x02,0xdc,0xad,0xad,0x00,0x02,0xff,0xab,
-    0x00,0x00,0x01,0x1d,0x05,0x0a,0x00,0x03,0x00,0x09,
-    0x00,0x00,0x33,0x11,0x33,0x11,0x01,0x32,0x14,0x23,
-    0x22,0x34,0x86,0x97,0xfe,0xd4,0x49,0x49,0x46,0x05,
-    0x0a,0xfa,0xf6,0x02,0xdc,0xad,0xad,0x00,0x00,0x00,
-    0x00,0x02,0xff,0xd5,0x00,0x00,0x01,0xc2,0x05,0x0a,
-    0x00,0x0e,0x00,0x14,0x00,0x00,0x01,0x15,0x0e,0x01,
-    0x07,0x06,0x15,0x11,0x23,0x11,0x34,0x12,0x37,0x23,
-    0x35,0x03,0x32,0x14,0x23,0x22,0x34,0x01,0xc2,0x32,
-    0x47,0x07,0x03,0x97,0x50,0x43,0xba,0x66,0x49,0x49,
-    0x46,0x05,0x0a,0x78,0x37,0xd1,0xbe,0x40,0x14,0xfd,
-    0x88,0x02,0x2b,0xd1,0x01,0x35,0x59,0x80,0xfd,0xd2,
-    0xad,0xad,0x00,0x02,0x00,0x5f,0xff,0xec,0x03,0x4f,
-    0x05,0x1e,0x00,0x20,0x00,0x26,0x00,0x00,0x01,0x32,
-    0x17,0x16,0x11,0x10,0x07,0x06,0x23,0x22,0x27,0x26,
-    0x19,0x01,0x33,0x11,0x10,0x17,0x1e,0x01,0x32,0x36,
-    0x37,0x36,0x11,0x10,0x27,0x2e,0x01,0x22,0x07,0x35,
-    0x36,0x13,0x32,0x14,0x23,0x22,0x34,0x01,0xe2,0x7c,
-    0x53,0x9e,0x9f,0x5b,0x7d,0x7e,0x5b,0xa0,0x9c,0x41,
-    0x20,0x4c,0x60,0x4b,0x1f,0x41,0x41,0x1f,0x4c,0x55,
-    0x2f,0x34,0x1d,0x49,0x49,0x46,0x05,0x1e,0x54,0xa1,
-    0xfe,0x5c,0xfe,0x61,0x9f,0x5b,0x5b,0xa0,0x01,0x9e,
-    0x02,0x84,0xfd,0x7c,0xfe,0xcc,0x77,0x3a,0x32,0x32,
-    0x3a,0x78,0x01,0x33,0x01,0x31,0x7a,0x3a,0x32,0x0a,
-    0x81,0x0b,0xfd,0xbe,0xad,0xad,0x00,0x02,0xff,0xd6,
-    0x01,0xd2,0x01,0x1a,0x05,0x0a,0x00,0x05,0x00,0x0b,
-    0x00,0x00,0x01,0x06,0x07,0x23,0x11,0x33,0x03,0x32,
-    0x14,0x23,0x22,0x34,0x01,0x1a,0x6d,0x03,0x27,0x97,
-    0xfe,0x49,0x49,0x46,0x02,0x71,0x9b,0x04,0x03,0x38,
-    0xfe,0xac,0xad,0xad,0x00,0x02,0x00,0x2d,0xfe,0x14,
-    0x02,0x56,0x05,0x1e,0x00,0x0e,0x00,0x14,0x00,0x00,
-    0x13,0x36,0x32,0x1e,0x01,0x17,0x16,0x15,0x11,0x23,
-    0x11,0x10,0x23,0x22,0x07,0x13,0x32,0x14,0x23,0x22,
-    0x34,0x2d,0x66,0xac,0x7f,0x51,0x19,0x2e,0x99,0xd9,
-    0x5b,0x5c,0xbc,0x49,0x49,0x46,0x04,0xfc,0x22,0x3d,
-    0x67,0x4c,0x88,0xd0,0xfb,0x3e,0x04,0xc2,0x01,0xc0,
-    0x28,0xfe,0x6e,0xad,0xad,0x00,0x00,0x02,0x00,0x2d,
-    0xff,0xec,0x02,0x56,0x05,0x1e,0x00,0x1e,0x00,0x24,
-    0x00,0x00,0x13,0x36,0x32,0x1e,0x01,0x17,0x16,0x1d,
-    0x01,0x14,0x0e,0x03,0x22,0x27,0x35,0x1e,0x01,0x32,
-    0x3e,0x02,0x37,0x36,0x3d,0x01,0x10,0x23,0x22,0x07,
-    0x13,0x32,0x14,0x23,0x22,0x34,0x2d,0x66,0xac,0x7f,
-    0x51,0x19,0x2e,0x10,0x31,0x4d,0x85,0xbe,0x54,0x4d,
-    0x4b,0x4b,0x4b,0x2d,0x1e,0x06,0x0b,0xd7,0x51,0x66,
-    0xa8,0x49,0x49,0x46,0x04,0xfc,0x22,0x3d,0x67,0x4c,
-    0x88,0xd0,0xc6,0x52,0x8e,0x96,0x6a,0x44,0x1c,0x89,
-    0x1a,0x07,0x2c,0x4d,0x53,0x34,0x55,0x4b,0xc6,0x01,
-    0xc0,0x27,0xfe,0x6d,0xad,0xad,0x00,0x00,0x00,0x02,
-    0x00,0x2b,0x00,0x00,0x02,0x81,0x06,0x1c,0x00,0x0f,
-    0x00,0x15,0x00,0x00,0x01,0x15,0x06,0x02,0x07,0x06,
-    0x03,0x23,0x36,0x12,0x37,0x13,0x21,0x11,0x33,0x11,
-    0x03,0x32,0x14,0x23,0x22,0x34,0x02,0x81,0x1d,0x6c,
-    0x18,0x19,0x46,0x96,0x09,0x4a,0x0a,0xa6,0xfe,0x3e,
-    0x97,0x52,0x49,0x49,0x46,0x05,0x0e,0x86,0x75,0xfe,
-    0x46,0x62,0x88,0xfe,0x91,0x34,0x01,0x82,0x3a,0x02,
-    0x99,0x01,0x93,0xfe,0xf2,0xfd,0xce,0xad,0xad,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x35,0x00,0x00,0x03,0x24,
-    0x05,0x1e,0x00,0x2b,0x00,0x31,0x00,0x00,0x00,0x32,
-    0x1e,0x03,0x17,0x16,0x15,0x11,0x21,0x35,0x33,0x11,
-    0x34,0x27,0x26,0x27,0x26,0x22,0x06,0x07,0x06,0x0f,
-    0x01,0x03,0x23,0x13,0x3e,0x01,0x2e,0x04,0x35,0x33,
-    0x1e,0x01,0x17,0x33,0x3e,0x02,0x13,0x32,0x14,0x23,
-    0x22,0x34,0x01,0xee,0x66,0x52,0x35,0x27,0x14,0x06,
-    0x08,0xfe,0x85,0xe4,0x13,0x18,0x27,0x18,0x4f,0x50,
-    0x18,0x30,0x11,0x07,0x57,0x98,0x4d,0x0a,0x01,0x08,
-    0x0b,0x12,0x0a,0x12,0x97,0x06,0x22,0x06,0x09,0x09,
-    0x37,0x37,0x42,0x49,0x49,0x46,0x05,0x1e,0x21,0x32,
-    0x51,0x4b,0x35,0x52,0x65,0xfc,0xbd,0x7f,0x02,0xc4,
-    0xb0,0x3b,0x4a,0x15,0x0d,0x2c,0x20,0x40,0x35,0x16,
-    0xfc,0x3d,0x03,0x55,0x73,0x4d,0x3b,0x2f,0x3c,0x1f,
-    0x2f,0x01,0x0f,0x6c,0x1b,0x16,0x42,0x2d,0xfd,0xe3,
-    0xad,0xad,0x00,0x00,0x00,0x02,0x00,0x28,0x00,0x00,
-    0x01,0xe9,0x05,0x1e,0x00,0x1a,0x00,0x20,0x00,0x00,
-    0x13,0x36,0x32,0x1e,0x03,0x17,0x16,0x15,0x11,0x14,
-    0x06,0x0f,0x01,0x21,0x35,0x21,0x36,0x35,0x11,0x34,
-    0x27,0x26,0x23,0x22,0x07,0x13,0x32,0x14,0x23,0x22,
-    0x34,0x5b,0x4a,0x68,0x54,0x39,0x28,0x17,0x07,0x09,
-    0x15,0x0a,0x0b,0xfe,0x69,0x01,0x12,0x18,0x18,0x1d,
-    0x57,0x24,0x47,0x60,0x49,0x49,0x46,0x05,0x0d,0x11,
-    0x15,0x22,0x3b,0x3a,0x2c,0x40,0x6d,0xfd,0xbb,0x4c,
-    0xaa,0x2f,0x2f,0x7f,0x53,0x82,0x02,0x88,0x53,0x31,
-    0x3a,0x11,0xfe,0x53,0xad,0xad,0x00,0x00,0x00,0x03,
-    0x00,0x57,0xff,0xec,0x03,0x46,0x05,0x1e,0x00,0x15,
-    0x00,0x26,0x00,0x2c,0x00,0x00,0x01,0x32,0x17,0x16,
-    0x17,0x16,0x10,0x0e,0x01,0x07,0x06,0x23,0x22,0x27,
-    0x26,0x02,0x35,0x10,0x37,0x07,0x35,0x36,0x0e,0x01,
-    0x10,0x1e,0x02,0x32,0x36,0x37,0x36,0x11,0x10,0x27,
-    0x2e,0x01,0x23,0x07,0x13,0x32,0x14,0x23,0x22,0x34,
-    0x01,0xce,0x7e,0x5b,0x64,0x27,0x14,0x29,0x45,0x31,
-    0x5b,0x7e,0x9d,0x67,0x36,0x3d,0x92,0x80,0xc9,0x06,
-    0x39,0x21,0x3f,0x4b,0x60,0x4b,0x1f,0x42,0x5a,0x1d,
-    0x3f,0x26,0x56,0x57,0x49,0x49,0x46,0x05,0x1e,0x5b,
-    0x64,0xd6,0x73,0xfe,0xde,0xe6,0x96,0x31,0x5b,0x90,
-    0x4b,0x01,0x0a,0xb4,0x01,0x4d,0xbf,0x07,0x81,0x13,
-    0xdb,0xfa,0xfe,0xa2,0xd7,0x74,0x31,0x31,0x3a,0x79,
-    0x01,0x32,0x01,0x5e,0x75,0x25,0x1d,0x05,0xfe,0x47,
-    0xad,0xad,0x00,0x02,0x00,0x50,0xfe,0x14,0x03,0x2f,
-    0x05,0x1e,0x00,0x1d,0x00,0x23,0x00,0x00,0x01,0x22,
-    0x26,0x10,0x36,0x33,0x32,0x17,0x16,0x17,0x16,0x15,
-    0x11,0x23,0x11,0x10,0x27,0x2e,0x01,0x22,0x06,0x07,
-    0x06,0x15,0x10,0x17,0x32,0x17,0x07,0x22,0x13,0x32,
-    0x14,0x23,0x22,0x34,0x01,0x9c,0x99,0xb3,0xca,0x9d,
-    0x7e,0x5b,0x64,0x26,0x15,0x98,0x43,0x20,0x4c,0x69,
-    0x56,0x17,0x2d,0xc0,0x06,0x10,0x1c,0x01,0x3a,0x49,
-    0x49,0x46,0x01,0xb4,0xd3,0x01,0x9f,0xf8,0x5b,0x64,
-    0xd6,0x73,0x91,0xfb,0x8f,0x04,0x71,0x01,0x32,0x79,
-    0x39,0x31,0x43,0x33,0x65,0x63,0xfe,0xdc,0x0b,0x02,
-    0x77,0x02,0x0c,0xad,0xad,0x00,0x00,0x00,0x00,0x02,
-    0x00,0x51,0xff,0xec,0x03,0x2f,0x05,0x1e,0x00,0x26,
-    0x00,0x2c,0x00,0x00,0x12,0x26,0x10,0x36,0x33,0x32,
-    0x17,0x16,0x17,0x16,0x10,0x0e,0x01,0x07,0x06,0x23,
-    0x22,0x2f,0x01,0x35,0x16,0x33,0x32,0x11,0x10,0x27,
-    0x2e,0x01,0x22,0x06,0x07,0x06,0x15,0x14,0x16,0x1f,
-    0x01,0x07,0x27,0x13,0x32,0x14,0x23,0x22,0x34,0xf9,
-    0xa8,0xca,0x9d,0x7e,0x5a,0x65,0x25,0x15,0x2b,0x49,
-    0x33,0x5d,0x7f,0x76,0x64,0x20,0x85,0x75,0xe7,0x41,
-    0x1f,0x4a,0x69,0x57,0x17,0x2d,0x59,0x67,0x16,0x1b,
-    0x15,0x39,0x49,0x49,0x46,0x01,0xbb,0xd5,0x01,0x97,
-    0xf7,0x5b,0x65,0xd5,0x73,0xfe,0xde,0xe6,0x95,0x31,
-    0x5c,0x12,0x05,0x85,0x18,0x02,0x15,0x01,0x35,0x76,
-    0x39,0x31,0x44,0x34,0x67,0x62,0x8f,0x98,0x04,0x02,
-    0x78,0x02,0x02,0x0a,0xad,0xad,0x00,0x00,0x00,0x02,
-    0x00,0x3a,0x00,0x00,0x03,0x05,0x05,0x0a,0x00,0x11,
-    0x00,0x17,0x00,0x00,0x29,0x01,0x35,0x21,0x17,0x03,
-    0x01,0x33,0x01,0x36,0x1b,0x01,0x33,0x07,0x06,0x02,
-    0x07,0x13,0x01,0x32,0x14,0x23,0x22,0x34,0x02,0xeb,
-    0xfd,0x52,0x01,0x54,0xaf,0xb6,0xfe,0xb0,0x9f,0x01,
-    0x10,0x4b,0x1c,0x1d,0x98,0x15,0x16,0x4f,0x60,0xc0,
-    0xfd,0xbc,0x49,0x49,0x46,0x7f,0x04,0x01,0x65,0x03,
-    0x2a,0xfd,0x53,0x52,0x01,0x2e,0x01,0x2c,0xd8,0xe8,
-    0xfe,0xf6,0x5e,0xfe,0x6f,0x02,0x37,0xad,0xad,0x00,
-    0x00,0x03,0x00,0x8d,0xfe,0x14,0x03,0x59,0x05,0x0a,
-    0x00,0x1b,0x00,0x21,0x00,0x25,0x00,0x00,0x25,0x15,
-    0x23,0x35,0x34,0x3e,0x04,0x37,0x36,0x12,0x37,0x21,
-    0x35,0x21,0x15,0x03,0x0e,0x06,0x07,0x06,0x03,0x32,
-    0x14,0x23,0x22,0x34,0x03,0x11,0x33,0x11,0x02,0x38,
-    0x95,0x0e,0x09,0x11,0x0c,0x17,0x06,0x1b,0x79,0x33,
-    0xfd,0xd2,0x02,0xcc,0xa7,0x03,0x1c,0x0a,0x1a,0x0b,
-    0x13,0x0a,0x05,0x0a,0x99,0x49,0x49,0x46,0xcb,0x97,
-    0x16,0x16,0x16,0x2a,0x4e,0x31,0x49,0x31,0x57,0x18,
-    0x5e,0x01,0xcc,0xb8,0x80,0x70,0xfd,0x9d,0x0b,0x68,
-    0x24,0x60,0x2d,0x52,0x30,0x1f,0x34,0x02,0xc4,0xad,
-    0xad,0xfb,0x12,0x04,0xe7,0xfb,0x19,0x00,0x00,0x00,
-    0x00,0x02,0x00,0x1d,0x00,0x00,0x02,0x4f,0x05,0x1e,
-    0x00,0x0e,0x00,0x14,0x00,0x00,0x13,0x32,0x16,0x15,
-    0x11,0x23,0x11,0x34,0x2e,0x02,0x22,0x07,0x35,0x36,
-    0x13,0x32,0x14,0x23,0x22,0x34,0xe4,0xd3,0x98,0x98,
-    0x12,0x35,0x52,0x89,0x78,0x74,0x66,0x49,0x49,0x46,
-    0x05,0x1e,0xa5,0xe1,0xfc,0x68,0x03,0x98,0x53,0x60,
-    0x3d,0x14,0x0c,0x82,0x0c,0xfd,0xbe,0xad,0xad,0x00,
-    0x00,0x00,0x00,0x02,0x00,0x40,0x00,0x00,0x04,0x2a,
-    0x05,0x0a,0x00,0x1c,0x00,0x22,0x00,0x00,0x21,0x23,
-    0x03,0x33,0x13,0x3e,0x01,0x37,0x13,0x33,0x03,0x06,
-    0x07,0x06,0x07,0x13,0x33,0x32,0x36,0x12,0x37,0x13,
-    0x33,0x03,0x02,0x07,0x0e,0x02,0x13,0x32,0x14,0x23,
-    0x22,0x34,0x01,0x69,0xbe,0x6b,0x92,0x3b,0x66,0x61,
-    0x0f,0x1d,0x8f,0x1d,0x10,0x2c,0x4b,0xd3,0x1b,0x36,
-    0x90,0xde,0x7f,0x10,0x34,0x90,0x34,0x1e,0xa8,0x33,
-    0x7e,0xaf,0x60,0x49,0x49,0x46,0x05,0x0a,0xfd,0x3a,
-    0x25,0xab,0xac,0x01,0x4a,0xfe,0xb7,0xaf,0x66,0xb2,
-    0x33,0xfe,0xba,0x9b,0x01,0x0b,0xb0,0x02,0x33,0xfd,
-    0xcd,0xfe,0xae,0xc3,0x3c,0x53,0x33,0x02,0x08,0xad,
-    0xad,0x00,0x00,0x02,0x00,0x15,0xff,0xfa,0x03,0x30,
-    0x05,0x1e,0x00,0x21,0x00,0x27,0x00,0x00,0x13,0x32,
-    0x36,0x37,0x36,0x32,0x1e,0x03,0x15,0x11,0x23,0x11,
-    0x34,0x27,0x26,0x22,0x07,0x11,0x14,0x06,0x23,0x22,
-    0x27,0x35,0x16,0x33,0x32,0x36,0x35,0x11,0x06,0x07,
-    0x01,0x32,0x14,0x23,0x22,0x34,0x47,0x03,0x55,0x29,
-    0x73,0xe2,0x88,0x4f,0x2e,0x0e,0x97,0x62,0x2f,0x82,
-    0x51,0x4f,0x74,0x25,0x38,0x30,0x05,0x2d,0x26,0x19,
-    0x3d,0x01,0x93,0x49,0x49,0x46,0x04,0xff,0x0c,0x05,
-    0x0e,0x2c,0x45,0x6b,0x68,0x44,0xfc,0x6a,0x03,0x96,
-    0xca,0x28,0x14,0x05,0xfc,0xca,0xcb,0x9c,0x0d,0x84,
-    0x09,0x3f,0x3f,0x03,0x89,0x03,0x08,0xfe,0x5e,0xad,
-    0xad,0x00,0x00,0x02,0x00,0x64,0x00,0x00,0x01,0x1d,
-    0x06,0x06,0x00,0x05,0x00,0x09,0x00,0x00,0x13,0x32,
-    0x14,0x23,0x22,0x34,0x13,0x11,0x33,0x11,0xaa,0x49,
-    0x49,0x46,0x22,0x97,0x06,0x06,0xad,0xad,0xf9,0xfa,
-    0x05,0x0a,0xfa,0xf6,0x00,0x00,0x00,0x01,0xff,0x12,
-    0x05,0xa9,0x00,0xe8,0x05,0xfc,0x00,0x03,0x00,0x00,
-    0x13,0x21,0x35,0x21,0xe8,0xfe,0x2a,0x01,0xd6,0x05,
-    0xa9,0x53,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0xc6,
-    0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,
-    0x00,0x24,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x1a,0x00,0x6c,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x02,0x00,0x07,0x00,0x97,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x03,0x00,0x2a,0x00,0xf5,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x1a,0x01,0x56,
-    0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x3c,
-    0x01,0xeb,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x06,
-    0x00,0x1f,0x02,0x68,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x12,0x00,0x1d,0x02,0xc4,0x00,0x03,0x00,0x01,
-    0x04,0x09,0x00,0x00,0x00,0x22,0x00,0x00,0x00,0x03,
-    0x00,0x01,0x04,0x09,0x00,0x01,0x00,0x34,0x00,0x36,
-    0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x02,0x00,0x0e,
-    0x00,0x87,0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x03,
-    0x00,0x54,0x00,0x9f,0x00,0x03,0x00,0x01,0x04,0x09,
-    0x00,0x04,0x00,0x34,0x01,0x20,0x00,0x03,0x00,0x01,
-    0x04,0x09,0x00,0x05,0x00,0x78,0x01,0x71,0x00,0x03,
-    0x00,0x01,0x04,0x09,0x00,0x06,0x00,0x3e,0x02,0x28,
-    0x00,0x03,0x00,0x01,0x04,0x09,0x00,0x12,0x00,0x3a,
-    0x02,0x88,0x00,0x63,0x00,0x6f,0x00,0x70,0x00,0x79,
-    0x00,0x72,0x00,0x69,0x00,0x67,0x00,0x68,0x00,0x74,
-    0x00,0x20,0x00,0x6d,0x00,0x69,0x00,0x73,0x00,0x73,
-    0x00,0x69,0x00,0x6e,0x00,0x67,0x00,0x00,0x63,0x6f,
-    0x70,0x79,0x72,0x69,0x67,0x68,0x74,0x20,0x6d,0x69,
-    0x73,0x73,0x69,0x6e,0x67,0x00,0x00,0x4f,0x00,0x70,
-    0x00,0x65,0x00,0x6e,0x00,0x20,0x00,0x53,0x00,0x61,
-    0x00,0x6e,0x00,0x73,0x00,0x20,0x00,0x48,0x00,0x65,
-    0x00,0x62,0x00,0x72,0x00,0x65,0x00,0x77,0x00,0x20,
-    0x00,0x43,0x00,0x6f,0x00,0x6e,0x00,0x64,0x00,0x65,
-    0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x64,0x00,0x00,
-    0x4f,0x70,0x65,0x6e,0x20,0x53,0x61,0x6e,0x73,0x20,
-    0x48,0x65,0x62,0x72,0x65,0x77,0x20,0x43,0x6f,0x6e,
-    0x64,0x65,0x6e,0x73,0x65,0x64,0x00,0x00,0x52,0x00,
-    0x65,0x00,0x67,0x00,0x75,0x00,0x6c,0x00,0x61,0x00,
-    0x72,0x00,0x00,0x52,0x65,0x67,0x75,0x6c,0x61,0x72,
-    0x00,0x00,0x32,0x00,0x2e,0x00,0x30,0x00,0x30,0x00,
-    0x31,0x00,0x3b,0x00,0x55,0x00,0x4b,0x00,0x57,0x00,
-    0x4e,0x00,0x3b,0x00,0x4f,0x00,0x70,0x00,0x65,0x00,
-    0x6e,0x00,0x53,0x00,0x61,0x00,0x6e,0x00,0x73,0x00,
-    0x48,0x00,0x65,0x00,0x62,0x00,0x72,0x00,0x65,0x00,
-    0x77,0x00,0x43,0x00,0x6f,0x00,0x6e,0x00,0x64,0x00,
-    0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x64,0x00,
-    0x2d,0x00,0x52,0x00,0x65,0x00,0x67,0x00,0x75,0x00,
-    0x6c,0x00,0x61,0x00,0x72,0x00,0x00,0x32,0x2e,0x30,
-    0x30,0x31,0x3b,0x55,0x4b,0x57,0x4e,0x3b,0x4f,0x70,
-    0x65,0x6e,0x53,0x61,0x6e,0x73,0x48,0x65,0x62,0x72,
-    0x65,0x77,0x43,0x6f,0x6e,0x64,0x65,0x6e,0x73,0x65,
-    0x64,0x2d,0x52,0x65,0x67,0x75,0x6c,0x61,0x72,0x00,
-    0x00,0x4f,0x00,0x70,0x00,0x65,0x00,0x6e,0x00,0x20,
-    0x00,0x53,0x00,0x61,0x00,0x6e,0x00,0x73,0x00,0x20,
-    0x00,0x48,0x00,0x65,0x00,0x62,0x00,0x72,0x00,0x65,
-    0x00,0x77,0x00,0x20,0x00,0x43,0x00,0x6f,0x00,0x6e,
-    0x00,0x64,0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,
-    0x00,0x64,0x00,0x00,0x4f,0x70,0x65,0x6e,0x20,0x53,
-    0x61,0x6e,0x73,0x20,0x48,0x65,0x62,0x72,0x65,0x77,
-    0x20,0x43,0x6f,0x6e,0x64,0x65,0x6e,0x73,0x65,0x64,
-    0x00,0x00,0x56,0x00,0x65,0x00,0x72,0x00,0x73,0x00,
-    0x69,0x00,0x6f,0x00,0x6e,0x00,0x20,0x00,0x32,0x00,
-    0x2e,0x00,0x30,0x00,0x30,0x00,0x31,0x00,0x3b,0x00,
-    0x50,0x00,0x53,0x00,0x20,0x00,0x30,0x00,0x30,0x00,
-    0x32,0x00,0x2e,0x00,0x30,0x00,0x30,0x00,0x31,0x00,
-    0x3b,0x00,0x68,0x00,0x6f,0x00,0x74,0x00,0x63,0x00,
-    0x6f,0x00,0x6e,0x00,0x76,0x00,0x20,0x00,0x31,0x00,
-    0x2e,0x00,0x30,0x00,0x2e,0x00,0x37,0x00,0x30,0x00,
-    0x3b,0x00,0x6d,0x00,0x61,0x00,0x6b,0x00,0x65,0x00,
-    0x6f,0x00,0x74,0x00,0x66,0x00,0x2e,0x00,0x6c,0x00,
-    0x69,0x00,0x62,0x00,0x32,0x00,0x2e,0x00,0x35,0x00,
-    0x2e,0x00,0x35,0x00,0x38,0x00,0x33,0x00,0x32,0x00,
-    0x39,0x00,0x00,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,
-    0x20,0x32,0x2e,0x30,0x30,0x31,0x3b,0x50,0x53,0x20,
-    0x30,0x30,0x32,0x2e,0x30,0x30,0x31,0x3b,0x68,0x6f,
-    0x74,0x63,0x6f,0x6e,0x76,0x20,0x31,0x2e,0x30,0x2e,
-    0x37,0x30,0x3b,0x6d,0x61,0x6b,0x65,0x6f,0x74,0x66,
-    0x2e,0x6c,0x69,0x62,0x32,0x2e,0x35,0x2e,0x35,0x38,
-    0x33,0x32,0x39,0x00,0x00,0x4f,0x00,0x70,0x00,0x65,
-    0x00,0x6e,0x00,0x53,0x00,0x61,0x00,0x6e,0x00,0x73,
-    0x00,0x48,0x00,0x65,0x00,0x62,0x00,0x72,0x00,0x65,
-    0x00,0x77,0x00,0x43,0x00,0x6f,0x00,0x6e,0x00,0x64,
-    0x00,0x65,0x00,0x6e,0x00,0x73,0x00,0x65,0x00,0x64,
-    0x00,0x2d,0x00,0x52,0x00,0x65,0x00,0x67,0x00,0x75,
-    0x00,0x6c,0x00,0x61,0x00,0x72,0x00,0x00,0x4f,0x70,
-    0x65,0x6e,0x53,0x61,0x6e,0x73,0x48,0x65,0x62,0x72,
-    0x65,0x77,0x43,0x6f,0x6e,0x64,0x65,0x6e,0x73,0x65,
-    0x64,0x2d,0x52,0x65,0x67,0x75,0x6c,0x61,0x72,0x00,
-    0x00,0x4f,0x00,0x70,0x00,0x65,0x00,0x6e,0x00,0x20,
-    0x00,0x53,0x00,0x61,0x00,0x6e,0x00,0x73,0x00,0x20,
-    0x00,0x48,0x00,0x65,0x00,0x62,0x00,0x72,0x00,0x65,
-    0x00,0x77,0x00,0x20,0x00,0x43,0x00,0x6f,0x00,0x6e,
-    0x00,0x64,0x00,0x20,0x00,0x52,0x00,0x65,0x00,0x67,
-    0x00,0x75,0x00,0x6c,0x00,0x61,0x00,0x72,0x00,0x00,
-    0x4f,0x70,0x65,0x6e,0x20,0x53,0x61,0x6e,0x73,0x20,
-    0x48,0x65,0x62,0x72,0x65,0x77,0x20,0x43,0x6f,0x6e,
-    0x64,0x20,0x52,0x65,0x67,0x75,0x6c,0x61,0x72,0x00,
-    0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xb5,
-    0x00,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x01,0x36,0x00,0x00,0x00,0x01,0x00,0x02,
-    0x01,0x02,0x00,0x03,0x00,0x04,0x00,0x05,0x00,0x06,
-    0x00,0x07,0x00,0x08,0x00,0x09,0x00,0x0a,0x00,0x0b,
-    0x00,0x0c,0x00,0x0d,0x00,0x0e,0x00,0x0f,0x00,0x10,
-    0x00,0x11,0x00,0x12,0x00,0x13,0x00,0x14,0x00,0x15,
-    0x00,0x16,0x00,0x17,0x00,0x18,0x00,0x19,0x00,0x1a,
-    0x00,0x1b,0x00,0x1c,0x00,0x1d,0x00,0x1e,0x00,0x1f,
-    0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x24,
-    0x00,0x25,0x00,0x26,0x00,0x27,0x00,0x28,0x00,0x29,
-    0x00,0x2a,0x00,0x2b,0x00,0x2c,0x00,0x2d,0x00,0x2e,
-    0x00,0x2f,0x00,0x30,0x00,0x31,0x00,0x32,0x00,0x33,
-    0x00,0x34,0x00,0x35,0x00,0x36,0x00,0x37,0x00,0x38,
-    0x00,0x39,0x00,0x3a,0x00,0x3b,0x00,0x3c,0x00,0x3d,
-    0x00,0x3e,0x00,0x3f,0x00,0x40,0x00,0x41,0x00,0x42,
-    0x00,0x43,0x00,0x44,0x00,0x45,0x00,0x46,0x00,0x47,
-    0x00,0x48,0x00,0x49,0x00,0x4a,0x00,0x4b,0x00,0x4c,
-    0x00,0x4d,0x00,0x4e,0x00,0x4f,0x00,0x50,0x00,0x51,
-    0x00,0x52,0x00,0x53,0x00,0x54,0x00,0x55,0x00,0x56,
-    0x00,0x57,0x00,0x58,0x00,0x59,0x00,0x5a,0x00,0x5b,
-    0x00,0x5c,0x00,0x5d,0x00,0x5e,0x00,0x5f,0x00,0x60,
-    0x00,0x61,0x01,0x03,0x00,0xa3,0x00,0x84,0x00,0x85,
-    0x00,0xbd,0x00,0x96,0x00,0xe8,0x00,0x86,0x00,0x8e,
-    0x00,0x8b,0x00,0x9d,0x00,0xa9,0x00,0xa4,0x01,0x04,
-    0x00,0x8a,0x01,0x05,0x00,0x83,0x00,0x93,0x00,0xf2,
-    0x00,0xf3,0x00,0x8d,0x01,0x06,0x00,0x88,0x00,0xc3,
-    0x00,0xde,0x00,0xf1,0x00,0x9e,0x00,0xaa,0x00,0xf5,
-    0x00,0xf4,0x00,0xf6,0x00,0xa2,0x00,0xad,0x00,0xc9,
-    0x00,0xc7,0x00,0xae,0x00,0x62,0x00,0x63,0x00,0x90,
-    0x00,0x64,0x00,0xcb,0x00,0x65,0x00,0xc8,0x00,0xca,
-    0x00,0xcf,0x00,0xcc,0x00,0xcd,0x00,0xce,0x00,0xe9,
-    0x00,0x66,0x00,0xd3,0x00,0xd0,0x00,0xd1,0x00,0xaf,
-    0x00,0x67,0x00,0xf0,0x00,0x91,0x00,0xd6,0x00,0xd4,
-    0x00,0xd5,0x00,0x68,0x00,0xeb,0x00,0xed,0x00,0x89,
-    0x00,0x6a,0x00,0x69,0x00,0x6b,0x00,0x6d,0x00,0x6c,
-    0x00,0x6e,0x00,0xa0,0x00,0x6f,0x00,0x71,0x00,0x70,
-    0x00,0x72,0x00,0x73,0x00,0x75,0x00,0x74,0x00,0x76,
-    0x00,0x77,0x00,0xea,0x00,0x78,0x00,0x7a,0x00,0x79,
-    0x00,0x7b,0x00,0x7d,0x00,0x7c,0x00,0xb8,0x00,0xa1,
-    0x00,0x7f,0x00,0x7e,0x00,0x80,0x00,0x81,0x00,0xec,
-    0x00,0xee,0x00,0xba,0x00,0xd7,0x00,0xb0,0x00,0xb1,
-    0x00,0xe4,0x00,0xe5,0x00,0xbb,0x00,0xe6,0x00,0xe7,
-    0x00,0xa6,0x00,0xd8,0x00,0xe1,0x00,0xdb,0x00,0xdc,
-    0x00,0xdd,0x00,0xe0,0x00,0xd9,0x00,0xdf,0x01,0x07,
-    0x01,0x08,0x01,0x09,0x01,0x0a,0x01,0x0b,0x01,0x0c,
-    0x01,0x0d,0x01,0x0e,0x01,0x0f,0x01,0x10,0x01,0x11,
-    0x01,0x12,0x01,0x13,0x01,0x14,0x01,0x15,0x01,0x16,
-    0x01,0x17,0x01,0x18,0x01,0x19,0x01,0x1a,0x01,0x1b,
-    0x01,0x1c,0x01,0x1d,0x01,0x1e,0x01,0x1f,0x01,0x20,
-    0x01,0x21,0x01,0x22,0x01,0x23,0x01,0x24,0x01,0x25,
-    0x01,0x26,0x01,0x27,0x01,0x28,0x01,0x29,0x01,0x2a,
-    0x01,0x2b,0x01,0x2c,0x01,0x2d,0x01,0x2e,0x01,0x2f,
-    0x01,0x30,0x01,0x31,0x01,0x32,0x01,0x33,0x01,0x34,
-    0x01,0x35,0x00,0xb2,0x00,0xb3,0x00,0xb6,0x00,0xb7,
-    0x00,0xc4,0x00,0xb4,0x00,0xb5,0x00,0xc5,0x00,0x82,
-    0x00,0xc2,0x00,0x87,0x00,0xab,0x00,0xc6,0x00,0xbe,
-    0x00,0xbf,0x00,0xbc,0x01,0x36,0x01,0x37,0x00,0x8c,
-    0x01,0x38,0x01,0x39,0x01,0x3a,0x01,0x3b,0x01,0x3c,
-    0x01,0x3d,0x01,0x3e,0x01,0x3f,0x01,0x40,0x01,0x41,
-    0x01,0x42,0x01,0x43,0x01,0x44,0x01,0x45,0x01,0x46,
-    0x01,0x47,0x01,0x48,0x01,0x49,0x01,0x4a,0x01,0x4b,
-    0x01,0x4c,0x01,0x4d,0x01,0x4e,0x01,0x4f,0x01,0x50,
-    0x01,0x51,0x01,0x52,0x01,0x53,0x01,0x54,0x01,0x55,
-    0x01,0x56,0x01,0x57,0x02,0x43,0x52,0x07,0x75,0x6e,
-    0x69,0x30,0x30,0x41,0x30,0x07,0x75,0x6e,0x69,0x30,
-    0x30,0x41,0x44,0x09,0x6f,0x76,0x65,0x72,0x73,0x63,
-    0x6f,0x72,0x65,0x07,0x75,0x6e,0x69,0x30,0x30,0x42,
-    0x35,0x07,0x75,0x6e,0x69,0x30,0x35,0x42,0x30,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x42,0x31,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x42,0x32,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x42,0x33,0x07,0x75,0x6e,0x69,0x30,0x35,0x42,
-    0x34,0x07,0x75,0x6e,0x69,0x30,0x35,0x42,0x35,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x42,0x36,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x42,0x37,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x42,0x38,0x07,0x75,0x6e,0x69,0x30,0x35,0x42,
-    0x39,0x07,0x75,0x6e,0x69,0x30,0x35,0x42,0x41,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x42,0x42,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x42,0x43,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x42,0x44,0x07,0x75,0x6e,0x69,0x30,0x35,0x42,
-    0x45,0x07,0x75,0x6e,0x69,0x30,0x35,0x43,0x31,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x43,0x32,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x43,0x37,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x44,0x30,0x07,0x75,0x6e,0x69,0x30,0x35,0x44,
-    0x31,0x07,0x75,0x6e,0x69,0x30,0x35,0x44,0x32,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x44,0x33,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x44,0x34,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x44,0x35,0x07,0x75,0x6e,0x69,0x30,0x35,0x44,
-    0x36,0x07,0x75,0x6e,0x69,0x30,0x35,0x44,0x37,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x44,0x38,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x44,0x39,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x44,0x41,0x07,0x75,0x6e,0x69,0x30,0x35,0x44,
-    0x42,0x07,0x75,0x6e,0x69,0x30,0x35,0x44,0x43,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x44,0x44,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x44,0x45,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x44,0x46,0x07,0x75,0x6e,0x69,0x30,0x35,0x45,
-    0x30,0x07,0x75,0x6e,0x69,0x30,0x35,0x45,0x31,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x45,0x32,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x45,0x33,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x45,0x34,0x07,0x75,0x6e,0x69,0x30,0x35,0x45,
-    0x35,0x07,0x75,0x6e,0x69,0x30,0x35,0x45,0x36,0x07,
-    0x75,0x6e,0x69,0x30,0x35,0x45,0x37,0x07,0x75,0x6e,
-    0x69,0x30,0x35,0x45,0x38,0x07,0x75,0x6e,0x69,0x30,
-    0x35,0x45,0x39,0x07,0x75,0x6e,0x69,0x30,0x35,0x45,
-    0x41,0x08,0x67,0x65,0x72,0x65,0x73,0x68,0x68,0x62,
-    0x0b,0x67,0x65,0x72,0x73,0x68,0x61,0x79,0x69,0x6d,
-    0x68,0x62,0x07,0x75,0x6e,0x69,0x32,0x30,0x41,0x41,
-    0x04,0x45,0x75,0x72,0x6f,0x07,0x75,0x6e,0x69,0x46,
-    0x42,0x30,0x31,0x07,0x75,0x6e,0x69,0x46,0x42,0x30,
-    0x32,0x07,0x75,0x6e,0x69,0x46,0x42,0x32,0x41,0x07,
-    0x75,0x6e,0x69,0x46,0x42,0x32,0x42,0x13,0x73,0x68,
-    0x69,0x6e,0x64,0x61,0x67,0x65,0x73,0x68,0x73,0x68,
-    0x69,0x6e,0x64,0x6f,0x74,0x68,0x62,0x12,0x73,0x68,
-    0x69,0x6e,0x64,0x61,0x67,0x65,0x73,0x68,0x73,0x69,
-    0x6e,0x64,0x6f,0x74,0x68,0x62,0x0b,0x61,0x6c,0x65,
-    0x66,0x70,0x61,0x74,0x61,0x68,0x68,0x62,0x0c,0x61,
-    0x6c,0x65,0x66,0x71,0x61,0x6d,0x61,0x74,0x73,0x68,
-    0x62,0x0c,0x61,0x6c,0x65,0x66,0x64,0x61,0x67,0x65,
-    0x73,0x68,0x68,0x62,0x0b,0x62,0x65,0x74,0x64,0x61,
-    0x67,0x65,0x73,0x68,0x68,0x62,0x0d,0x67,0x69,0x6d,
-    0x65,0x6c,0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,
-    0x0d,0x64,0x61,0x6c,0x65,0x74,0x64,0x61,0x67,0x65,
-    0x73,0x68,0x68,0x62,0x0a,0x68,0x65,0x64,0x61,0x67,
-    0x65,0x73,0x68,0x68,0x62,0x07,0x75,0x6e,0x69,0x46,
-    0x42,0x33,0x35,0x0d,0x7a,0x61,0x79,0x69,0x6e,0x64,
-    0x61,0x67,0x65,0x73,0x68,0x68,0x62,0x0b,0x74,0x65,
-    0x74,0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,0x0b,
-    0x79,0x6f,0x64,0x64,0x61,0x67,0x65,0x73,0x68,0x68,
-    0x62,0x10,0x66,0x69,0x6e,0x61,0x6c,0x6b,0x61,0x66,
-    0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,0x0b,0x6b,
-    0x61,0x66,0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,
-    0x0d,0x6c,0x61,0x6d,0x65,0x64,0x64,0x61,0x67,0x65,
-    0x73,0x68,0x68,0x62,0x0b,0x6d,0x65,0x6d,0x64,0x61,
-    0x67,0x65,0x73,0x68,0x68,0x62,0x0b,0x6e,0x75,0x6e,
-    0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,0x0e,0x73,
-    0x61,0x6d,0x65,0x6b,0x68,0x64,0x61,0x67,0x65,0x73,
-    0x68,0x68,0x62,0x0f,0x66,0x69,0x6e,0x61,0x6c,0x70,
-    0x65,0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,0x0a,
-    0x70,0x65,0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,
-    0x0d,0x74,0x73,0x61,0x64,0x69,0x64,0x61,0x67,0x65,
-    0x73,0x68,0x68,0x62,0x0b,0x71,0x6f,0x66,0x64,0x61,
-    0x67,0x65,0x73,0x68,0x68,0x62,0x0c,0x72,0x65,0x73,
-    0x68,0x64,0x61,0x67,0x65,0x73,0x68,0x68,0x62,0x0c,
-    0x73,0x68,0x69,0x6e,0x64,0x61,0x67,0x65,0x73,0x68,
-    0x68,0x62,0x0b,0x74,0x61,0x76,0x64,0x61,0x67,0x65,
-    0x73,0x68,0x68,0x62,0x07,0x75,0x6e,0x69,0x46,0x42,
-    0x34,0x42,0x07,0x72,0x61,0x66,0x65,0x68,0x68,0x62,
-    0x00,0x01,0x00,0x01,0xff,0xff,0x00,0x0f,0x00,0x00,
-    0x00,0x01,0x00,0x00,0x00,0x00,0xcc,0x6d,0xb1,0x55,
-    0x00,0x00,0x00,0x00,0xcd,0x64,0xfe,0x43,0x00,0x00,
-    0x00,0x00,0xcd,0xc1,0x1c,0x70,0x00,0x01,0x00,0x00,
-    0x00,0x0e,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,
-    0x00,0x02,0x00,0x05,0x00,0x03,0x00,0xd3,0x00,0x01,
-    0x00,0xd4,0x00,0xe1,0x00,0x03,0x00,0xe2,0x00,0xe2,
-    0x00,0x01,0x00,0xe3,0x00,0xe5,0x00,0x03,0x00,0xe6,
-    0x01,0x35,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x02,
-    0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x0a,0x00,0x1e,
-    0x00,0x2c,0x00,0x01,0x68,0x65,0x62,0x72,0x00,0x08,
-    0x00,0x04,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x01,
-    0x00,0x00,0x00,0x01,0x6d,0x61,0x72,0x6b,0x00,0x08,
-    0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x00,0x04,
-    0x00,0x04,0x00,0x00,0x00,0x01,0x00,0x08,0x00,0x01,
-    0x03,0x78,0x03,0x6e,0x00,0x04,0x03,0x88,0x00,0x0c,
-    0x00,0x1b,0x00,0xda,0x00,0xe0,0x00,0xe6,0x00,0xec,
-    0x00,0xf2,0x00,0xf8,0x00,0xfe,0x01,0x04,0x01,0x0a,
-    0x01,0x10,0x01,0x16,0x01,0x1c,0x01,0x22,0x01,0x28,
-    0x01,0x2e,0x01,0x34,0x01,0x3a,0x01,0x40,0x01,0x46,
-    0x01,0x4c,0x01,0x52,0x01,0x58,0x01,0x5e,0x01,0x64,
-    0x01,0x6a,0x01,0x70,0x01,0x76,0x01,0x7c,0x01,0x82,
-    0x01,0x88,0x01,0x8e,0x01,0x94,0x01,0x9a,0x01,0xa0,
-    0x01,0xa6,0x01,0xac,0x01,0xb2,0x01,0xb8,0x01,0xbe,
-    0x01,0xc4,0x01,0xca,0x01,0xd0,0x01,0xd6,0x01,0xdc,
-    0x01,0xe2,0x01,0xe8,0x01,0xee,0x01,0xf4,0x01,0xfa,
-    0x02,0x00,0x02,0x06,0x02,0x0c,0x02,0x12,0x02,0x18,
-    0x02,0x1e,0x02,0x24,0x02,0x2a,0x02,0x30,0x02,0x36,
-    0x02,0x3c,0x02,0x42,0x02,0x48,0x02,0x4e,0x02,0x54,
-    0x02,0x5a,0x02,0x60,0x02,0x66,0x02,0x6c,0x02,0x72,
-    0x02,0x78,0x02,0x7e,0x02,0x84,0x02,0x8a,0x02,0x90,
-    0x02,0x96,0x02,0x9c,0x02,0xa2,0x02,0xa8,0x02,0xae,
-    0x02,0xb4,0x02,0xba,0x02,0xc0,0x02,0xc6,0x02,0xcc,
-    0x02,0xd2,0x02,0xd8,0x02,0xde,0x02,0xe4,0x02,0xea,
-    0x02,0xf0,0x02,0xf6,0x02,0xfc,0x03,0x02,0x03,0x08,
-    0x03,0x0e,0x03,0x14,0x03,0x1a,0x03,0x20,0x03,0x26,
-    0x03,0x2c,0x03,0x32,0x03,0x38,0x03,0x3e,0x03,0x44,
-    0x03,0x4a,0x03,0x50,0x03,0x56,0x03,0x5c,0x00,0x01,
-    0x01,0xae,0x00,0x00,0x00,0x01,0x00,0x71,0x04,0x67,
-    0x00,0x01,0x01,0x61,0x00,0x6b,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x01,0x01,0x95,0x00,0x00,0x00,0x01,
-    0x00,0x93,0x04,0x67,0x00,0x01,0x01,0x25,0x02,0x00,
-    0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x5e,
-    0x00,0x00,0x00,0x01,0x00,0xc8,0x04,0x67,0x00,0x01,
-    0x00,0xf7,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x01,0x01,0xb1,0x00,0x00,0x00,0x01,0x00,0x57,
-    0x04,0x67,0x00,0x01,0x00,0xcf,0x02,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x01,0xde,0x00,0x00,
-    0x00,0x01,0x00,0xb4,0x04,0x67,0x00,0x01,0x01,0xde,
-    0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0xd2,0x00,0x00,0x00,0x01,0x00,0xab,0x04,0x67,
-    0x00,0x01,0xff,0xf1,0x02,0x00,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x01,0x00,0xf1,0x00,0x00,0x00,0x01,
-    0x00,0x90,0x04,0x67,0x00,0x01,0x00,0x1b,0x02,0x00,
-    0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0xde,
-    0x00,0x00,0x00,0x01,0x00,0xbb,0x04,0x67,0x00,0x01,
-    0x01,0xde,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x01,0x01,0xd4,0x00,0x00,0x00,0x01,0x00,0x78,
-    0x04,0x67,0x00,0x01,0x01,0xd4,0x02,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x00,0xcf,0x00,0x00,
-    0x00,0x01,0x00,0xa7,0x04,0x67,0x00,0x01,0x00,0x1c,
-    0x02,0xda,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x35,0x01,0x68,0x00,0x01,0x00,0x64,0x04,0x67,
-    0x00,0x01,0x00,0xe9,0x02,0x00,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x01,0x01,0x58,0x00,0x00,0x00,0x01,
-    0x00,0x64,0x04,0x67,0x00,0x01,0x00,0xd5,0x02,0x00,
-    0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x53,
-    0x00,0x00,0x00,0x01,0xff,0xb7,0x04,0x67,0x00,0x01,
-    0x00,0x71,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x01,0x01,0xde,0x00,0x00,0x00,0x01,0x00,0xa7,
-    0x04,0x67,0x00,0x01,0x01,0xde,0x02,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x01,0xd3,0x00,0x00,
-    0x00,0x01,0x00,0x6b,0x04,0x67,0x00,0x01,0x01,0xd3,
-    0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,
-    0xff,0x09,0x01,0x6f,0x00,0x01,0x00,0x6b,0x04,0x67,
-    0x00,0x01,0x00,0x0d,0x02,0x00,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x01,0x01,0x35,0x00,0x00,0x00,0x01,
-    0x00,0x85,0x04,0x67,0x00,0x01,0x00,0xbb,0x02,0x00,
-    0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0xcf,
-    0x00,0x00,0x00,0x01,0x00,0xa7,0x04,0x67,0x00,0x01,
-    0x01,0xcf,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x01,0x01,0xbc,0x00,0x00,0x00,0x01,0x00,0x50,
-    0x04,0x67,0x00,0x01,0x01,0xf4,0x02,0x44,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x18,0x01,0x6f,
-    0x00,0x01,0x00,0x7f,0x04,0x67,0x00,0x01,0x01,0xd8,
-    0x02,0xe4,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x01,0xc4,0x00,0x00,0x00,0x01,0x00,0x93,0x04,0x67,
-    0x00,0x01,0x01,0xc4,0x02,0xe4,0x00,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x01,0xff,0x4c,0x01,0x6f,0x00,0x01,
-    0x00,0x38,0x04,0x67,0x00,0x01,0x01,0x6e,0x02,0x00,
-    0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0xa3,
-    0x00,0x00,0x00,0x01,0x00,0x7f,0x04,0x67,0x00,0x01,
-    0x00,0xa7,0x01,0xab,0x00,0x01,0x00,0x00,0x00,0x00,
-    0x00,0x01,0x02,0xc6,0x00,0x00,0x00,0x01,0x00,0xa7,
-    0x04,0x67,0x00,0x01,0x01,0x9f,0x02,0x26,0x00,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x08,0x00,0x00,
-    0x00,0x01,0x00,0x50,0x04,0x67,0x00,0x01,0x00,0xf7,
-    0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x02,0x34,0x00,0x00,0x00,0x01,0x00,0x6b,0x04,0x67,
-    0x00,0x01,0x02,0x30,0x01,0x2c,0x00,0x01,0x03,0xf3,
-    0x04,0x67,0x00,0x01,0x01,0xda,0x00,0x00,0x00,0x01,
-    0x00,0x6b,0x04,0x67,0x00,0x01,0x01,0xda,0x02,0x00,
-    0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,
-    0x00,0xe6,0x01,0x00,0x00,0x00,0x00,0x02,0x00,0x02,
-    0x00,0xd4,0x00,0xe1,0x00,0x00,0x00,0xe3,0x00,0xe5,
-    0x00,0x0e,0x00,0x11,0x00,0x00,0x00,0x46,0x00,0x00,
-    0x00,0x4c,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x58,
-    0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x64,0x00,0x00,
-    0x00,0x6a,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x76,
-    0x00,0x01,0x00,0x7c,0x00,0x01,0x00,0x82,0x00,0x00,
-    0x00,0x88,0x00,0x02,0x00,0x8e,0x00,0x00,0x00,0x94,
-    0x00,0x03,0x00,0x9a,0x00,0x01,0x00,0xa0,0x00,0x00,
-    0x00,0xa6,0x00,0x01,0x00,0x00,0x00,0x6e,0x00,0x01,
-    0x00,0x00,0x00,0x6e,0x00,0x01,0x00,0x00,0x00,0x6e,
-    0x00,0x01,0x00,0x00,0x00,0x6e,0x00,0x01,0x00,0x00,
-    0x00,0x6e,0x00,0x01,0x00,0x00,0x00,0x6e,0x00,0x01,
-    0x00,0x00,0x00,0x6e,0x00,0x01,0x00,0x00,0x00,0x6e,
-    0x00,0x01,0x00,0x00,0x00,0x6e,0x00,0x01,0x00,0x00,
-    0x04,0x90,0x00,0x01,0x00,0x00,0x04,0x90,0x00,0x01,
-    0x00,0x00,0x00,0x6e,0x00,0x01,0x00,0x00,0x02,0x44,
-    0x00,0x01,0x00,0x00,0x00,0x6e,0x00,0x01,0x00,0x00,
-    0x04,0x90,0x00,0x01,0x00,0x00,0x04,0x90,0x00,0x01,
-    0x00,0x00,0x00,0x6e,0x00,0x01,0x00,0x00,0x00,0x0a,
-    0x00,0x1c,0x00,0x1e,0x00,0x01,0x68,0x65,0x62,0x72,
-    0x00,0x08,0x00,0x04,0x00,0x00,0x00,0x00,0xff,0xff,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-    0x00,0x00,0x00,0x00
+const size_t opensans_hebrew_condensed_regular_ttf_size = 18544;
+const unsigned char opensans_hebrew_condensed_regular_ttf_data[18544] = {
+    0x45,0x53,0x5a,0x31,0x6c,0x7e,0x00,0x00,0x78,0xda,
+    0xd5,0xbd,0x79,0x5c,0x14,0x47,0x13,0x30,0xdc,0xd5,
+    0xb3,0x07,0x87,0xe2,0x2e,0x2c,0x2c,0xa2,0xc2,0xc2,
+    0xc2,0xa2,0x88,0x5c,0xcb,0xa5,0x22,0x78,0x20,0x1e,
+    0xa0,0x28,0xe0,0x7d,0xa2,0x02,0xa2,0x5c,0x02,0x2a,
+    0xde,0xb7,0xf1,0x8e,0x1a,0x05,0xbc,0x35,0xf1,0x36,
+    0x46,0x63,0x8c,0xd1,0x18,0xcf,0x98,0x98,0x18,0x35,
+    0x6a,0x8c,0x9a,0x68,0x8c,0x49,0x8c,0x89,0xc6,0xe4,
+    0xc9,0x61,0x4c,0x14,0x76,0xf6,0xad,0xee,0x19,0x60,
+    0x11,0x34,0xfe,0xde,0xef,0xfd,0xe7,0x43,0x67,0x67,
+    0xb6,0x67,0xba,0xaa,0xba,0xba,0xaa,0xba,0xba,0xba,
+    0x7a,0x96,0x00,0x21,0x44,0x8b,0x1f,0x0a,0xa2,0x89,
+    0x4f,0xed,0xd6,0x05,0xbf,0xe1,0x97,0xe9,0xa3,0xf0,
+    0x6c,0x97,0x90,0x90,0xd6,0x23,0xeb,0xb5,0xf3,0xf6,
+    0x84,0x4c,0x9a,0x8b,0xdf,0x9b,0x76,0x89,0xef,0x9c,
+    0xa0,0xf8,0x43,0x28,0xc5,0xef,0x9b,0xf1,0x7b,0x74,
+    0x97,0x5e,0xc9,0xa9,0xfe,0x0b,0x77,0xac,0xc0,0xef,
+    0x37,0x10,0x40,0x4e,0x97,0xd4,0x3e,0x1d,0x47,0xaf,
+    0x1e,0xf1,0x1a,0xd6,0x8f,0xc7,0xfb,0x86,0xe4,0xd4,
+    0xe0,0xb0,0x19,0xff,0xbb,0xb0,0x03,0x41,0x96,0xe3,
+    0xf7,0xe1,0x23,0x73,0xd3,0x0b,0x3e,0x6e,0x13,0x34,
+    0x86,0x10,0xd5,0x25,0x42,0x84,0x9e,0x59,0xe9,0x45,
+    0x05,0x58,0xae,0xc1,0xfa,0x53,0x19,0xbe,0xac,0x9c,
+    0x49,0x99,0xd7,0x0a,0xfb,0xec,0x24,0xa4,0x01,0x3e,
+    0x3f,0xb2,0x78,0x74,0x46,0xfa,0x28,0xea,0x3f,0x27,
+    0x03,0xeb,0x37,0xc5,0xfb,0x91,0xa3,0xb1,0xa0,0xa1,
+    0xaf,0x32,0x08,0xbf,0xa7,0xe1,0x77,0xdf,0xd1,0xb9,
+    0xc5,0x25,0x27,0xc6,0xa4,0x50,0xfc,0xfe,0x2f,0xe2,
+    0xbf,0x91,0x93,0x3f,0x32,0x7d,0x8a,0xdb,0x08,0x5f,
+    0x42,0x1c,0x9a,0x13,0x42,0xf3,0x72,0xd3,0x4b,0x0a,
+    0x60,0x06,0xe9,0x84,0xf7,0x4b,0x18,0x3d,0x79,0xe9,
+    0xb9,0x19,0x25,0x7f,0x5d,0xb1,0x10,0x52,0xd0,0x00,
+    0xf1,0xef,0x2c,0xc8,0x2f,0x2a,0xde,0xd6,0x3f,0xf2,
+    0x73,0x42,0x8a,0x0e,0x12,0xa2,0xfc,0xa4,0xa0,0x30,
+    0xa3,0x60,0xb4,0x6a,0xc9,0x3c,0xac,0x6f,0xc0,0xe7,
+    0xd5,0x8c,0x13,0x84,0x92,0x0e,0x65,0x93,0x6f,0x66,
+    0x0d,0x6b,0x14,0xf3,0x37,0x75,0xb4,0x23,0xec,0xef,
+    0xc2,0xa9,0xa6,0x05,0x55,0x67,0xb1,0xc0,0x72,0x55,
+    0xad,0x57,0x17,0x31,0xfa,0x49,0xd5,0x1f,0xd6,0x53,
+    0xaf,0x15,0x19,0x88,0x0c,0xb1,0x40,0x5c,0xa9,0xd6,
+    0x73,0x48,0x36,0x7f,0x10,0xc9,0x4a,0xf0,0xb3,0x3d,
+    0x62,0x21,0x1c,0x0b,0xab,0xc5,0x9e,0x6a,0x2f,0x3f,
+    0x22,0x08,0x49,0xb0,0x9c,0x08,0xc4,0x4e,0x69,0x56,
+    0x9c,0xc7,0xef,0x6b,0xa4,0x33,0x3d,0x4f,0xc2,0x68,
+    0x26,0x7b,0x40,0xa9,0xaa,0x82,0x66,0x27,0xb4,0xb7,
+    0x81,0xdd,0x27,0xb1,0x5f,0x4f,0x84,0xd2,0xb0,0x22,
+    0x51,0x45,0x44,0x02,0x6b,0xd5,0x6b,0x29,0xc1,0xe6,
+    0x78,0xb3,0x7b,0x8a,0x04,0xe5,0x21,0xc6,0x09,0xa2,
+    0xa0,0xbf,0x49,0x4f,0xd3,0xdd,0x78,0xe8,0x10,0xf9,
+    0x2e,0x3c,0x7e,0x24,0xaf,0xd0,0x27,0x64,0x96,0xf0,
+    0x2e,0x31,0x09,0x43,0x49,0x3f,0x65,0x00,0x49,0x13,
+    0xde,0x23,0x71,0xb0,0x87,0xcc,0xa2,0x7d,0xc9,0x50,
+    0x3c,0xba,0x0b,0xad,0x48,0x2f,0x21,0x8d,0x24,0xc2,
+    0x65,0xd2,0x99,0x06,0x93,0xb6,0x78,0x9e,0x4e,0xff,
+    0x47,0xfc,0xf1,0xf9,0x54,0x3c,0xe6,0xe1,0xd1,0x1d,
+    0x8f,0x2e,0x78,0xf8,0xe1,0x31,0x0c,0x8f,0x41,0x78,
+    0x74,0xc0,0xa3,0x2b,0x1e,0x3d,0xd8,0xf3,0xac,0x2e,
+    0x83,0x21,0x1f,0xdd,0xe8,0x3c,0xe2,0xa5,0xf4,0x25,
+    0x23,0x84,0x45,0xd8,0xec,0x43,0x64,0xb5,0x30,0x89,
+    0x64,0x2a,0x74,0x78,0x0e,0x21,0xa5,0xd4,0x42,0x4a,
+    0x15,0x71,0xf8,0x3d,0x98,0x94,0xc2,0x0f,0x64,0x3b,
+    0x7c,0x60,0x5d,0x21,0xcc,0x24,0xab,0xe9,0x43,0x52,
+    0xaa,0x3c,0x42,0x56,0x2b,0x66,0xe1,0xfd,0xc1,0x24,
+    0x53,0x98,0x88,0xd7,0xec,0xbc,0x86,0x94,0x0a,0x11,
+    0x48,0x23,0x21,0xce,0x0a,0x1f,0xb2,0x58,0xc8,0x41,
+    0x4e,0x1d,0x27,0x0d,0x04,0x2f,0xd2,0x50,0x40,0x49,
+    0xa6,0x97,0x48,0x38,0x9d,0x4f,0x36,0x33,0x9a,0xf1,
+    0xdc,0x41,0x58,0x42,0x9a,0x09,0x1e,0xd6,0x4a,0xc5,
+    0x08,0x58,0x28,0x74,0x23,0x09,0xc2,0x76,0x32,0x9f,
+    0x6e,0x25,0xfd,0xf1,0xdc,0x4f,0xe8,0x4d,0xfa,0xc3,
+    0x13,0xe2,0x26,0xf8,0xe1,0x33,0x1b,0xc8,0x7c,0xd8,
+    0x4e,0x26,0xc3,0x0e,0xeb,0x03,0xa1,0x09,0x5e,0xbf,
+    0x41,0xe6,0x2b,0xc7,0x93,0xf9,0xac,0x5c,0x78,0x05,
+    0x9f,0xc5,0x7a,0xac,0x0e,0x1d,0x88,0xf5,0xf7,0x92,
+    0x04,0x6a,0x87,0x3c,0xd9,0x40,0x66,0xd2,0x1f,0x88,
+    0x4a,0xf1,0x15,0xd1,0xd1,0x07,0xa4,0x29,0xbb,0xa6,
+    0x83,0x49,0x04,0xfd,0x8e,0xf4,0x16,0xa6,0xc0,0x14,
+    0x3c,0x33,0x5e,0x16,0x70,0xfe,0x23,0xef,0x91,0x3f,
+    0x5b,0xf0,0x48,0x56,0x64,0x91,0x71,0x78,0xee,0xc6,
+    0x9f,0xf9,0x8b,0xa4,0x28,0xb2,0x20,0x52,0xf5,0x06,
+    0x49,0xa7,0xa3,0x48,0x6b,0xe4,0x4f,0x32,0xe3,0x1b,
+    0xe3,0x3d,0x2b,0x13,0xe6,0x5b,0x9f,0xe0,0xb3,0x13,
+    0x78,0xd9,0x74,0x94,0x0d,0x3c,0x78,0x5b,0x36,0x93,
+    0xd9,0xc2,0xaf,0x64,0x12,0xe7,0xf7,0x29,0xe2,0x85,
+    0xe5,0x49,0x74,0x26,0xe9,0xc4,0xea,0x2b,0x2f,0x90,
+    0x48,0xf9,0x30,0x23,0xef,0x43,0x39,0xdf,0xeb,0x39,
+    0x14,0x37,0xf1,0x8c,0x7d,0xc1,0xfa,0xc1,0xf6,0x80,
+    0x1f,0xac,0x5f,0x61,0x5f,0x6c,0xc4,0xf3,0x6d,0x3c,
+    0xfe,0xc6,0xbe,0x6a,0x5e,0xd5,0x0f,0xcf,0x1e,0x48,
+    0x57,0x67,0x7e,0x8d,0x7d,0x61,0x7b,0xb0,0xbe,0x60,
+    0x7d,0x26,0xac,0x46,0xbe,0x31,0xbe,0xd7,0x73,0x28,
+    0x5b,0x20,0x1f,0x59,0x5f,0xf4,0xae,0x7d,0xc0,0x76,
+    0xeb,0xc7,0xd8,0x17,0xe3,0xf0,0x7c,0x02,0x8f,0xeb,
+    0xc2,0x62,0xe4,0x7f,0x55,0x3f,0x3c,0x7b,0xa4,0xa1,
+    0x3c,0xbe,0x82,0x72,0x8c,0x7d,0x61,0x7b,0xb0,0xbe,
+    0xe0,0x7d,0x8d,0x67,0x84,0xf5,0x8a,0x52,0x4f,0x32,
+    0x95,0x8b,0xf0,0x79,0x94,0x1d,0xd6,0x7f,0xd5,0xb2,
+    0x32,0x98,0xeb,0x42,0x67,0xc5,0x74,0x08,0xe0,0xc7,
+    0x14,0x88,0x87,0xe3,0x64,0x8e,0x62,0x01,0xe4,0xc2,
+    0x22,0xe2,0x87,0x65,0x1a,0xc5,0x3c,0xf2,0x88,0x10,
+    0xeb,0xfb,0x84,0x88,0x68,0x17,0x44,0xd4,0x30,0xf1,
+    0x28,0x7e,0x3f,0x82,0x07,0xf6,0xac,0xd5,0x0d,0x8f,
+    0x70,0x3c,0x82,0xe5,0x32,0x76,0xe4,0x4a,0xcf,0x5b,
+    0x2f,0xb0,0x7e,0x94,0xaf,0xd9,0x11,0x2e,0x0c,0x22,
+    0xf1,0x42,0x00,0x19,0x42,0x8f,0x92,0x01,0xf4,0x1b,
+    0xa2,0x13,0x3e,0x40,0x59,0xdb,0x8a,0xc7,0x77,0xa8,
+    0x97,0x78,0x2d,0xec,0x20,0xc3,0x60,0x23,0x99,0x43,
+    0xaf,0x93,0x56,0x74,0x1f,0x1e,0xdb,0x49,0x20,0x2f,
+    0xdf,0x46,0x22,0x60,0x27,0xe9,0x4f,0xb3,0x49,0x73,
+    0x61,0x23,0xb6,0xa3,0x04,0x65,0x7b,0x1f,0xca,0xd7,
+    0x2b,0xa4,0x37,0xbd,0x89,0xd6,0xa4,0x33,0x69,0x23,
+    0x94,0x93,0xa5,0xf4,0x73,0xd2,0x4c,0x31,0x9a,0xb4,
+    0x17,0x0e,0x12,0x57,0x18,0x4a,0x8c,0x74,0x0f,0x31,
+    0x0a,0xff,0x23,0x3d,0xd5,0x19,0xa4,0x27,0xfb,0xce,
+    0x0f,0xa6,0xdb,0xbb,0xf1,0x1e,0x3b,0xac,0xd8,0xfe,
+    0xd7,0x49,0x09,0x1e,0xc5,0xb4,0x82,0xac,0x50,0x16,
+    0x93,0xe9,0xea,0x7e,0x24,0x15,0xe9,0x4e,0x66,0x07,
+    0xf9,0x5b,0x3c,0xae,0xa4,0x64,0x29,0xf2,0xc8,0x57,
+    0xb9,0x1c,0x75,0x6c,0x13,0xea,0xcb,0x06,0xe2,0xc6,
+    0x70,0xe0,0xe1,0x57,0x75,0xe6,0xed,0xaa,0x3a,0xea,
+    0xb4,0xcf,0xba,0x07,0xbe,0xb3,0x7e,0x29,0xb5,0xcd,
+    0x7a,0xcd,0xa6,0x6d,0x2d,0x59,0xbb,0xaa,0xdb,0x24,
+    0xb7,0xa7,0xde,0xb6,0x6c,0x25,0x38,0x66,0x59,0x9d,
+    0x99,0xe5,0x94,0x8f,0xa6,0x92,0xd5,0x85,0x78,0xfc,
+    0x06,0xfc,0xbb,0x02,0x70,0x5c,0x20,0x09,0x68,0x1d,
+    0x95,0x44,0x45,0x1a,0x92,0xe9,0xc4,0x0a,0xa1,0x90,
+    0x0a,0xe9,0x50,0x02,0xd3,0x61,0x25,0x3d,0x4b,0xbf,
+    0x51,0x1e,0x57,0x9e,0x56,0x9e,0x55,0x3e,0x50,0x3e,
+    0x32,0xe8,0x0c,0x1e,0x06,0x4f,0x83,0x8f,0xc1,0x64,
+    0x08,0x31,0xb4,0x31,0xc4,0x1b,0x76,0x1b,0xde,0xf4,
+    0xf6,0xa9,0xa0,0x15,0x91,0x15,0x31,0x15,0xb1,0x15,
+    0x1d,0x2a,0xe2,0x2b,0x12,0xad,0x56,0x84,0xd7,0x10,
+    0xed,0xe9,0x66,0x84,0x93,0x02,0xc3,0x11,0xce,0x34,
+    0x84,0xf3,0x31,0xbd,0xa1,0xdc,0xaf,0x3c,0x85,0x70,
+    0x2e,0x29,0xff,0x32,0xb8,0x18,0xdc,0x0d,0x4d,0x0d,
+    0x06,0x0e,0xa7,0x75,0x35,0x1c,0xa8,0x08,0xa8,0x88,
+    0x46,0x38,0xed,0x2b,0x3a,0x55,0x24,0x58,0xad,0xd6,
+    0xc7,0xd6,0xbb,0xd6,0x0f,0xad,0x2b,0xad,0x85,0xd6,
+    0x4c,0x6b,0x2f,0x6b,0x92,0xb5,0xb5,0xa8,0xb2,0x3c,
+    0xae,0xf0,0xad,0xf0,0xa9,0xf0,0xac,0x70,0xab,0x70,
+    0xba,0xf3,0xfb,0x9d,0x5f,0xef,0x3c,0xbc,0xf3,0xcb,
+    0x9d,0x9f,0xef,0x7c,0x7b,0xe7,0xfa,0x9d,0x8b,0x77,
+    0xb2,0xef,0x8c,0xfe,0xf6,0x2f,0x95,0xab,0xf2,0x37,
+    0xe5,0xaf,0xca,0x87,0xca,0x5f,0x90,0xe2,0xfb,0xcf,
+    0x8e,0x32,0xff,0xd7,0x7f,0x2a,0xea,0x20,0x0f,0x63,
+    0xcf,0x42,0x04,0x3e,0x52,0x11,0x99,0xc3,0x2f,0xfa,
+    0x93,0x6a,0x2a,0x38,0xa7,0xd5,0x38,0x36,0xda,0x13,
+    0x07,0xe2,0x48,0x1a,0x20,0xb7,0x9c,0x48,0x23,0x1c,
+    0xf3,0xb5,0xc4,0x99,0xb8,0x10,0x1d,0x71,0x25,0x6e,
+    0x44,0x4f,0xdc,0x49,0x63,0xe2,0x41,0x9a,0x60,0x1f,
+    0x35,0x23,0x9e,0xc4,0x0b,0x39,0xea,0x4d,0x7c,0x88,
+    0x91,0xf8,0x12,0x3f,0x62,0x22,0xfe,0xa4,0x39,0x69,
+    0x41,0x02,0x48,0x4b,0x12,0x48,0x5a,0x91,0x20,0x12,
+    0x4c,0x42,0x48,0x28,0x09,0x23,0x66,0x12,0x4e,0x22,
+    0x48,0x24,0x89,0x22,0xd1,0xa4,0x35,0x69,0x83,0x9a,
+    0x14,0x43,0xda,0x91,0x58,0x12,0x87,0x3d,0xdc,0x81,
+    0x74,0xc4,0x91,0x3f,0x9e,0x74,0xc6,0xfe,0xee,0x42,
+    0xba,0x92,0x6e,0xa4,0x3b,0x49,0x24,0x49,0xa4,0x07,
+    0xe9,0x89,0x52,0xdb,0x8b,0xf4,0x26,0x29,0x24,0x95,
+    0xa4,0x91,0x3e,0xa4,0x2f,0xe9,0x47,0xfa,0x93,0x01,
+    0x64,0x20,0x19,0x44,0x06,0x93,0x21,0x04,0x47,0x2d,
+    0x32,0x9c,0xa4,0x93,0x11,0x48,0xff,0x2b,0x64,0x01,
+    0x59,0x44,0x96,0x90,0x55,0x64,0x0d,0xd9,0x44,0xb6,
+    0x92,0x37,0xc8,0x36,0xb2,0x83,0x6c,0x27,0x3b,0xc9,
+    0x6e,0xf2,0x26,0xd9,0x43,0xf6,0x92,0xb7,0xc8,0x7e,
+    0xb2,0x8f,0xbc,0x4d,0x0e,0x90,0x83,0xe4,0x10,0x79,
+    0x97,0xbc,0x47,0x8e,0x90,0xc3,0xe4,0x18,0xf9,0x80,
+    0x1c,0x27,0x27,0xc0,0x91,0x14,0x91,0x0c,0x92,0x49,
+    0xc6,0x40,0x43,0x32,0x89,0xbc,0x4e,0xc6,0x91,0x1c,
+    0x70,0x25,0x13,0xc9,0x58,0x84,0xbd,0x90,0xac,0xc3,
+    0xcf,0x62,0xce,0xa7,0xd1,0xa4,0xc4,0x86,0x77,0xb9,
+    0x64,0x1a,0x7e,0xee,0x22,0x47,0xc9,0x6c,0x94,0xea,
+    0x7c,0xbc,0xfe,0x8c,0x97,0xe7,0xa1,0x2d,0x77,0x22,
+    0x23,0xc9,0x1c,0x32,0x9f,0x94,0x93,0x33,0xe4,0x23,
+    0x10,0x40,0x01,0x76,0x60,0x0f,0x4a,0x50,0x11,0xb4,
+    0x1f,0xe4,0x34,0xf9,0x04,0x9c,0x41,0x07,0x1a,0xd0,
+    0x82,0x1b,0xe8,0xa1,0x01,0x8e,0x58,0x6a,0x70,0x80,
+    0x46,0x64,0x1e,0x59,0x4a,0xe6,0x92,0x65,0x64,0x31,
+    0x59,0x4e,0x56,0x90,0x95,0xe4,0x55,0x52,0x4a,0xca,
+    0xb0,0xc6,0x6a,0xb2,0x81,0x6c,0x24,0xeb,0xc9,0x87,
+    0xe4,0x3c,0xb9,0x42,0x0a,0xc9,0x45,0xf2,0x39,0xb9,
+    0x44,0xa6,0x90,0x2f,0xc8,0x65,0x72,0x81,0x90,0xc3,
+    0x60,0x9d,0xb7,0x5f,0xb1,0xb4,0x76,0xdf,0xba,0x63,
+    0x1f,0x64,0x62,0xcb,0xff,0x44,0x5b,0x98,0x02,0x79,
+    0xb0,0x08,0x76,0xc3,0x69,0xb8,0x0a,0xdf,0xc3,0x9f,
+    0x94,0xd0,0x00,0x1a,0x4f,0x27,0xd0,0x37,0xe9,0x25,
+    0x81,0x0a,0x91,0x42,0x77,0x61,0x91,0x70,0x52,0xf8,
+    0x5a,0x78,0xac,0x68,0xa0,0x30,0x28,0xc2,0x15,0xa3,
+    0x14,0xc7,0x15,0xf7,0x94,0xee,0xca,0x18,0xe5,0x50,
+    0x65,0x89,0x72,0x99,0xf2,0x7d,0xe5,0x15,0xe5,0x6d,
+    0xe5,0x53,0x55,0x53,0x55,0xa0,0xaa,0xaf,0xaa,0x58,
+    0xb5,0x5e,0x75,0x5c,0xf5,0xbb,0xda,0x5d,0xdd,0x5d,
+    0x3d,0x54,0x3d,0x55,0x5d,0xae,0xbe,0xa6,0x7e,0x64,
+    0xe7,0x60,0xe7,0x63,0x17,0x69,0x17,0x6f,0xd7,0xdf,
+    0x2e,0xc7,0x6e,0xb2,0xdd,0x4a,0xbb,0x8f,0xed,0x1e,
+    0xd9,0xbb,0xd9,0x27,0xd8,0x17,0xd8,0xaf,0xb2,0xff,
+    0xcd,0x41,0xe7,0x10,0xe4,0x90,0xe2,0x50,0xe0,0x30,
+    0xd5,0xe1,0x80,0xc3,0x55,0x87,0xc7,0x8e,0xcd,0x1d,
+    0x07,0x3a,0x96,0x38,0x1e,0x70,0xbc,0xea,0xf8,0x6f,
+    0x03,0x5d,0x83,0x84,0x06,0xa3,0x1a,0xac,0x6a,0xf0,
+    0x66,0x83,0x3b,0x0d,0x7e,0x6b,0xe8,0xd9,0x30,0x09,
+    0xff,0x65,0x36,0x5c,0xd6,0xf0,0x83,0x86,0xff,0x3a,
+    0xf9,0x3a,0x45,0x3b,0xad,0x74,0xda,0xdf,0xc8,0xa1,
+    0x51,0xfb,0x46,0xa3,0x1a,0x15,0x37,0x9a,0xdd,0xe8,
+    0x6e,0xa3,0x3f,0x35,0x3a,0x4d,0xb8,0x66,0xb8,0x66,
+    0x95,0x66,0xb7,0xe6,0x92,0xe6,0xa1,0xa6,0x52,0xeb,
+    0xa1,0x0d,0xd3,0xa6,0x68,0x8b,0xb5,0xfb,0xb5,0x8f,
+    0x9c,0xbb,0x3b,0x4f,0x75,0x3e,0xe8,0xfc,0xd0,0x25,
+    0xc0,0xa5,0xc0,0xe5,0x2d,0x97,0xdf,0x74,0xee,0xba,
+    0x34,0xdd,0x74,0xdd,0x76,0xdd,0x35,0x57,0x95,0xab,
+    0xaf,0x6b,0x7b,0xd7,0x51,0xae,0x0b,0x5c,0x0f,0xb8,
+    0xfe,0xe6,0x66,0x72,0x1b,0xec,0xb6,0xd6,0xed,0xb6,
+    0xbe,0xa9,0xbe,0xa3,0x7e,0xb6,0xfe,0x80,0xfe,0x8e,
+    0xbb,0xce,0xbd,0xbb,0x7b,0x81,0xfb,0x2a,0xf7,0x1b,
+    0x8d,0x3d,0x1b,0x8f,0x68,0xfc,0x96,0x07,0xf1,0x48,
+    0xf2,0x58,0xeb,0xf1,0xa0,0x89,0xa1,0xc9,0xc0,0x26,
+    0x2b,0x9b,0x5c,0x69,0xea,0xdc,0x34,0xa4,0x69,0x52,
+    0xd3,0x82,0xa6,0xab,0x9a,0x5e,0x6d,0xa6,0x6b,0xd6,
+    0xb5,0xd9,0xe4,0x66,0x07,0x9b,0x3d,0xf2,0x0c,0xf2,
+    0xec,0xe5,0xb9,0xd2,0xf3,0x63,0xcf,0xa7,0x5e,0xe1,
+    0x5e,0x05,0x5e,0xfb,0xbd,0xbe,0x37,0x34,0x37,0x84,
+    0x1b,0xc6,0xa0,0x05,0xf9,0xd3,0xbb,0xa3,0x77,0x81,
+    0xf7,0x7a,0xef,0x4f,0xbc,0x9f,0xfa,0xb8,0xfb,0x84,
+    0xfb,0xf4,0xf4,0x19,0xee,0x33,0xd3,0x67,0xab,0xcf,
+    0x27,0x3e,0x0f,0x8d,0xd4,0x18,0x62,0xec,0x69,0xcc,
+    0x33,0x4e,0x35,0xae,0x34,0xee,0x37,0x1e,0x37,0x5e,
+    0x34,0xde,0x32,0x3e,0xf0,0xb5,0xf3,0x75,0xf3,0xf5,
+    0xf5,0x0d,0xf3,0x6d,0xef,0xdb,0xd3,0x77,0xa8,0xef,
+    0x4a,0xdf,0x43,0xbe,0x0f,0xfc,0x54,0x7e,0xcd,0xfd,
+    0xc2,0xfd,0x7a,0xf9,0x15,0xfa,0xed,0xf4,0x3b,0xec,
+    0x77,0xd5,0xa4,0x30,0xf9,0x9a,0xe2,0x4d,0x0b,0x4c,
+    0x9b,0x4d,0xe7,0xfd,0x1b,0xf8,0x47,0xfb,0x8f,0xf1,
+    0xdf,0xe9,0x7f,0xce,0xff,0xf7,0xe6,0xbe,0xcd,0xdb,
+    0x37,0x2f,0x6e,0xbe,0xb3,0xf9,0xc9,0xe6,0xf7,0x9a,
+    0x3f,0x6a,0x41,0x5b,0xe8,0x5a,0x98,0x5a,0x44,0xb7,
+    0xe8,0xdb,0xa2,0xb8,0xc5,0xca,0x16,0x6f,0xb5,0xb8,
+    0xd5,0xe2,0xb7,0x00,0xe7,0x80,0xe2,0x80,0x45,0x01,
+    0x1b,0x03,0xde,0x0c,0xf8,0xbd,0x65,0x40,0xcb,0xbe,
+    0x2d,0x97,0xb5,0x7c,0xbf,0xe5,0xbf,0x81,0x91,0x81,
+    0x53,0x03,0x4f,0x07,0x8a,0xad,0x62,0x5b,0x4d,0x6d,
+    0xb5,0xb3,0xd5,0xdd,0x20,0xbb,0xa0,0xb0,0xa0,0xae,
+    0x41,0x39,0x41,0xbb,0x83,0x4e,0x07,0xdd,0x0b,0xf6,
+    0x0c,0xee,0x1a,0xbc,0x2a,0xf8,0x93,0x10,0x4d,0x48,
+    0xf7,0x90,0xe5,0x21,0xc7,0x43,0x9e,0x86,0x7a,0x86,
+    0x0e,0x0c,0x2d,0x0d,0x7d,0x33,0xf4,0x7d,0xee,0x11,
+    0xbf,0x62,0x7d,0x08,0x43,0xd0,0x5f,0x15,0xd0,0x72,
+    0x10,0x30,0x0a,0x66,0x1a,0xe6,0xaa,0x53,0x19,0x7d,
+    0xa0,0x45,0x9e,0xff,0xb1,0x73,0xd7,0xda,0x84,0x8e,
+    0x85,0x15,0x0a,0xbf,0x8a,0xd0,0x69,0xb1,0xed,0xf9,
+    0xf3,0xb3,0x84,0xed,0xb4,0x84,0x3f,0xaf,0x96,0x9e,
+    0xe7,0x87,0xfd,0x28,0xdf,0x5d,0xd0,0x0a,0x3f,0xf0,
+    0xae,0xc6,0xf2,0x3b,0xd5,0xf0,0x67,0x4d,0x68,0xc0,
+    0x96,0xe1,0xb3,0x4d,0xd0,0xd6,0x10,0x70,0xc5,0x07,
+    0xf1,0x30,0xba,0xf0,0x23,0xc2,0xcc,0x0f,0xb3,0xc0,
+    0x0e,0x25,0x7e,0x0a,0xcb,0x8e,0x07,0xbc,0x77,0x36,
+    0x6a,0x42,0xeb,0x1b,0xd1,0x45,0x91,0xfb,0x4e,0xb4,
+    0x7c,0xff,0x9c,0x79,0x7c,0xc4,0xcd,0x88,0x71,0x66,
+    0xf1,0xf5,0x16,0xd7,0x03,0x15,0xba,0x49,0xe2,0xeb,
+    0xd3,0xc4,0xf6,0x70,0x92,0x1d,0xd3,0x60,0xe8,0x24,
+    0x78,0x5d,0x1c,0xca,0x0e,0x2c,0xc7,0xe1,0x94,0xdb,
+    0xca,0x7e,0xd6,0x85,0x82,0x5a,0xa5,0x43,0x6c,0x7e,
+    0x68,0xc5,0x08,0xa8,0xd4,0x26,0x7f,0xad,0x27,0x68,
+    0x54,0x6a,0x57,0x63,0x84,0xc9,0x3f,0xc2,0x13,0xf4,
+    0x5a,0x93,0x7f,0x10,0x84,0x47,0x46,0x45,0x98,0x5d,
+    0xdd,0x14,0x2a,0x9d,0x9b,0x5e,0xeb,0x1c,0x19,0x8e,
+    0x4f,0xd1,0xdf,0x42,0xe9,0xc4,0xec,0x2d,0x8b,0xb7,
+    0x2c,0x1e,0x72,0x68,0x5c,0xcc,0xa6,0x24,0x57,0xdf,
+    0xd9,0x19,0x9b,0x66,0x0d,0x59,0x2e,0x7e,0xde,0xb3,
+    0x53,0xf2,0xf6,0xb4,0x2e,0x7d,0x95,0x86,0x29,0xca,
+    0x68,0x95,0xd8,0xa9,0xd3,0x46,0xf1,0xc9,0x01,0x97,
+    0x5f,0x7e,0x14,0xda,0x95,0xfa,0x06,0x50,0x38,0x6a,
+    0xe7,0xdc,0x61,0x75,0xe5,0x41,0x97,0x03,0xfb,0x54,
+    0xab,0xb2,0xd6,0x0e,0xf6,0x83,0x15,0x95,0x61,0x99,
+    0x2b,0x86,0xf8,0x8b,0xe3,0xd1,0x26,0xa7,0x59,0x7f,
+    0x55,0x5c,0x53,0x7e,0x86,0x9c,0x72,0x44,0x1b,0xdc,
+    0x14,0xa9,0x22,0xce,0x91,0x61,0x6e,0x1a,0x95,0x8f,
+    0x09,0x8c,0x60,0x56,0xfa,0xa8,0x34,0x6e,0x61,0x91,
+    0x11,0x1a,0x22,0x17,0xba,0x54,0x15,0xa4,0x15,0xdf,
+    0x9b,0x38,0xf9,0x6e,0x11,0x4c,0x9b,0x41,0x95,0x33,
+    0x2d,0x23,0xc2,0x83,0x83,0x73,0x43,0x60,0xd4,0xf8,
+    0x1f,0x27,0x4c,0xfe,0xbe,0xf8,0xc7,0xf0,0xa0,0xe0,
+    0x9c,0x10,0xc5,0xf7,0xf7,0x7f,0x16,0x3b,0xfc,0xef,
+    0x97,0xca,0x3b,0xca,0x43,0xc3,0xb6,0x89,0x9b,0xb7,
+    0x6d,0xdf,0x0f,0x69,0x96,0x4e,0x3f,0xff,0x24,0xc6,
+    0xfd,0xfa,0x0b,0x8d,0xd8,0x8a,0x25,0xdb,0xf6,0xf3,
+    0x09,0x1c,0xf2,0x25,0xce,0xfa,0x50,0x38,0x80,0x74,
+    0x18,0xd0,0xba,0x87,0xa1,0xa7,0xee,0x63,0x8a,0x40,
+    0x16,0x04,0x01,0x7e,0x32,0xc4,0x6a,0x37,0x67,0x7d,
+    0x64,0x94,0xd9,0x09,0xd4,0x2e,0xc6,0x20,0xf0,0x77,
+    0x02,0xc1,0x87,0x71,0x26,0x16,0xef,0x53,0xbc,0x30,
+    0x87,0x45,0x09,0x50,0xbc,0x62,0x6b,0xd6,0xd4,0x6e,
+    0x21,0x73,0x6f,0xcf,0xed,0x97,0xd9,0x6a,0x9b,0x26,
+    0xda,0x61,0x89,0x3a,0xbe,0xd5,0xce,0x37,0x1b,0xb5,
+    0x6d,0x94,0xb0,0xa2,0x6d,0x90,0x39,0xd8,0xbf,0x5d,
+    0xd8,0xfd,0xd8,0xc1,0xc9,0xd3,0xd2,0x9f,0xea,0xce,
+    0xbf,0x37,0xf7,0x54,0xe6,0xcc,0xd2,0x21,0x2b,0xdf,
+    0x7c,0x43,0x7c,0x74,0x7c,0x50,0x77,0xf1,0x81,0x47,
+    0xe1,0x81,0x31,0xbf,0x26,0x8b,0x4f,0x1a,0x67,0x36,
+    0x1e,0xda,0x53,0xd9,0x7f,0xd0,0xe6,0xcd,0x31,0x6d,
+    0x96,0x0d,0xdf,0x67,0x31,0x2e,0xbe,0x3d,0xaf,0x14,
+    0x7d,0x7c,0x36,0x8e,0xa1,0x5c,0x41,0x00,0x97,0x2b,
+    0x52,0x2d,0x51,0x4c,0x98,0xd8,0xbd,0xa1,0xe2,0x07,
+    0xd4,0x11,0xef,0x39,0x32,0xa9,0xd2,0x38,0xeb,0x8d,
+    0x26,0xfc,0x8c,0x32,0xc3,0xdc,0xa5,0x2b,0x67,0xce,
+    0x7a,0x75,0xdd,0xfa,0x65,0x73,0x14,0x7f,0x89,0x21,
+    0xa2,0x97,0x18,0xb0,0x7f,0x07,0x7c,0x46,0x95,0x70,
+    0xfd,0x4d,0x0e,0xb3,0xbb,0xf8,0x01,0xfc,0x2b,0xd7,
+    0x73,0xd6,0x50,0xb5,0x31,0x12,0x3f,0xfd,0xcd,0x30,
+    0x78,0xfd,0xba,0xe5,0xb3,0x66,0x2f,0x5f,0xb2,0x60,
+    0x8e,0xd2,0x41,0x6c,0x6e,0xb1,0x88,0x11,0x3b,0x0f,
+    0xc1,0x17,0x70,0x07,0x2e,0x9c,0xe1,0xf5,0x7a,0x09,
+    0x33,0xe9,0x37,0x28,0x47,0x4e,0xf8,0xc5,0x4f,0x8f,
+    0x13,0x4f,0x7f,0xb5,0x7f,0x94,0x7f,0x94,0x1e,0xc9,
+    0xfa,0x04,0x40,0xf7,0x78,0xfb,0x9c,0xa2,0xf1,0xb3,
+    0x36,0xff,0xe1,0x6e,0xf1,0xdc,0xac,0xb4,0xeb,0xb8,
+    0xd2,0xf1,0x7e,0xc7,0x47,0x8f,0xe3,0xef,0x3b,0xae,
+    0xe8,0x80,0x23,0x01,0xab,0x9f,0x48,0x9e,0x0a,0xf6,
+    0x8a,0xb7,0x18,0x5e,0xf0,0x76,0xf5,0xd6,0x1a,0xb5,
+    0xde,0x11,0xde,0x5a,0x33,0xdc,0x03,0xa3,0xf8,0x4d,
+    0x89,0xf8,0x0d,0x18,0x4b,0x04,0xcd,0x14,0x31,0x03,
+    0xd6,0x4d,0x41,0x2f,0x13,0x48,0x67,0xf1,0x5f,0x18,
+    0x4c,0x6e,0xe0,0x18,0x4e,0xfc,0xf4,0x2a,0xb5,0xd1,
+    0x39,0x0a,0x7a,0x3a,0xc5,0x8d,0xcd,0xed,0xd2,0xec,
+    0x86,0xfe,0xf6,0x2f,0xc4,0xfa,0x1d,0x3e,0xd3,0x16,
+    0xbe,0x85,0x47,0xb4,0x80,0xf3,0x07,0xa1,0xc1,0x23,
+    0xb1,0x0b,0x1c,0x81,0x6f,0x57,0x30,0x7c,0xd3,0x51,
+    0x87,0x53,0xc9,0x4f,0xac,0xbe,0xde,0x27,0x9c,0xe9,
+    0xef,0xcf,0x63,0xbe,0x6c,0xad,0xab,0x98,0x16,0x17,
+    0xc7,0xe9,0xf1,0x47,0xb6,0x5d,0x96,0x78,0x6b,0x46,
+    0xb9,0x3b,0xb9,0x86,0xba,0xae,0xe6,0x53,0x54,0xd4,
+    0xd1,0x54,0x94,0x0d,0x3b,0x2e,0xa3,0x2e,0x84,0x78,
+    0x80,0x01,0x39,0x64,0xa0,0xe0,0x83,0x0c,0xc6,0x7e,
+    0x8f,0xd4,0x6a,0x68,0xea,0x6e,0xc8,0xdc,0xb6,0x5b,
+    0x2c,0xdd,0x02,0x03,0x33,0xfa,0xf5,0xcb,0x88,0x6b,
+    0xde,0x77,0xb0,0x62,0x30,0xe4,0x8b,0xa5,0x95,0x95,
+    0xe2,0xab,0x30,0x4c,0xf8,0x5b,0xfc,0xce,0x52,0x2c,
+    0x7e,0xdf,0xba,0x04,0x0e,0x42,0x1c,0xf8,0x31,0x7c,
+    0x38,0xb7,0xa7,0x5d,0x25,0xbe,0x7b,0x1b,0xb5,0xe1,
+    0x51,0x2a,0xb5,0x4a,0xed,0x0f,0x66,0xda,0x75,0x8d,
+    0x83,0xa1,0xf5,0xb0,0xe6,0x69,0xd0,0x6e,0xbe,0xf0,
+    0xcb,0x84,0x03,0x2d,0x23,0x07,0x36,0x4f,0x67,0x35,
+    0x78,0x5f,0xb1,0xc9,0x38,0xd2,0xe1,0x49,0x88,0x8b,
+    0xc9,0x3f,0x16,0xcc,0x61,0x6e,0xd8,0x0e,0xac,0x88,
+    0x62,0xe9,0x8a,0x4c,0x8c,0x00,0x26,0x8f,0x26,0xa3,
+    0x8f,0x6a,0xa7,0x90,0xd2,0x6b,0xf9,0xd0,0x8d,0x07,
+    0x63,0xbb,0x45,0x6e,0x76,0xcb,0xd2,0x50,0x07,0x4b,
+    0x17,0x68,0x32,0x7f,0x68,0xd6,0xc0,0xf6,0x99,0x8a,
+    0xdb,0xc2,0xa8,0xee,0x31,0x67,0x76,0x4c,0xba,0x3e,
+    0x21,0xfd,0x8e,0xe7,0x0a,0x37,0xbb,0x25,0x13,0x61,
+    0xeb,0xd9,0x1f,0x4a,0x07,0x2e,0x0c,0x64,0x38,0xba,
+    0x58,0x1f,0xd2,0x4a,0xc4,0xe1,0x83,0x5f,0x10,0xbc,
+    0x46,0xed,0xea,0x09,0x88,0xc4,0xe0,0x1f,0x81,0x42,
+    0x1e,0xa9,0x31,0xb5,0x84,0x08,0x3c,0x73,0x24,0x6a,
+    0xff,0x48,0x78,0x75,0xdd,0x91,0x47,0x33,0x97,0x5e,
+    0x15,0xd7,0x4d,0x98,0x5d,0x56,0x32,0x7b,0xed,0x8a,
+    0x1e,0xbd,0xa6,0xad,0xca,0x1c,0xd2,0x29,0xb7,0x5d,
+    0xca,0x52,0xe5,0x67,0x27,0x56,0x89,0x5f,0xa7,0xda,
+    0x35,0x3e,0xb2,0xf2,0xd4,0xbd,0x36,0x6b,0x7a,0xae,
+    0x01,0xe7,0xd2,0x59,0x1b,0x1f,0x4f,0x0d,0x6e,0x93,
+    0xb5,0x48,0xe2,0x2b,0x36,0x4b,0xe8,0xa8,0x3c,0x85,
+    0x56,0x15,0xbd,0x65,0x40,0xc3,0xc7,0xa5,0x00,0xcc,
+    0x02,0xf2,0xc3,0xa8,0x52,0x0b,0x74,0xe7,0xda,0xb5,
+    0xab,0x44,0x2d,0x5c,0x79,0x7b,0x95,0xbd,0xda,0x98,
+    0xf4,0x08,0xce,0xbd,0x22,0x1e,0x83,0x4e,0xb3,0x04,
+    0x4b,0xa5,0x3d,0xdc,0x39,0xfb,0xea,0x88,0x03,0x96,
+    0xdb,0x8c,0xe6,0x61,0xd8,0x3f,0x02,0xf2,0x12,0xf9,
+    0x12,0xc5,0xa8,0x8c,0x08,0xe7,0x5c,0x50,0xfb,0xbb,
+    0x20,0x53,0x84,0x48,0x33,0xda,0x34,0xce,0x23,0x1f,
+    0xff,0x61,0xd9,0xf9,0xaf,0xec,0x98,0x3e,0x61,0x70,
+    0x76,0x6c,0x20,0xf5,0x10,0xb3,0xbd,0x7a,0xf5,0xda,
+    0x73,0x98,0xd2,0x61,0xc1,0x5b,0xb2,0x77,0x8e,0xf8,
+    0xb8,0xdb,0xfe,0xb5,0x82,0xe2,0xb5,0xd5,0x5e,0xed,
+    0xe9,0xa6,0x57,0xc5,0x38,0x67,0xfa,0xd3,0x7b,0x67,
+    0x17,0x27,0xa4,0xd0,0x76,0x9c,0xd6,0x41,0x5c,0x06,
+    0xce,0xa1,0x97,0xe8,0xc9,0x39,0xa3,0xa1,0x46,0x1f,
+    0xaa,0x65,0x12,0xa0,0x77,0x35,0x19,0x0d,0x82,0x39,
+    0x16,0x9c,0x4d,0x3e,0x2a,0x57,0x1d,0x1a,0x27,0xf8,
+    0x66,0xc9,0xa6,0x43,0xeb,0x77,0xbf,0x7d,0xff,0xd7,
+    0x3e,0xe1,0x31,0x89,0xe2,0x67,0x5a,0x7b,0x9f,0x89,
+    0xdf,0x0e,0xd9,0x37,0x66,0xec,0xde,0xa1,0xc2,0xaa,
+    0xbf,0xc4,0x24,0xd1,0x0a,0x5d,0xa1,0x0d,0xbc,0x07,
+    0xdb,0x5c,0x17,0xbb,0x59,0xf6,0xf7,0xec,0x2b,0x5e,
+    0xde,0xb5,0xba,0xf0,0x83,0x2f,0x77,0x63,0x5b,0x3a,
+    0x20,0x4f,0x9c,0x95,0xef,0x32,0x39,0x75,0x89,0xf0,
+    0x76,0x45,0x1b,0xd8,0x81,0x5e,0x16,0x7b,0x6c,0x81,
+    0xc3,0x4a,0xff,0x65,0x45,0x4f,0x8f,0x2b,0xfd,0x25,
+    0x7b,0xd5,0x15,0xe9,0xd1,0x23,0x3d,0x2e,0x68,0x33,
+    0x4d,0xcc,0x66,0x1a,0x50,0x16,0xd4,0x52,0x5f,0x71,
+    0xd3,0x65,0x8a,0xf0,0x35,0xc9,0x36,0x8a,0xa8,0x18,
+    0x55,0x11,0xe1,0xc1,0x90,0x75,0x04,0x4c,0x07,0xef,
+    0x2d,0x99,0xf8,0xa1,0x78,0xf4,0x6c,0xfe,0xb4,0x0b,
+    0xf0,0x64,0xc8,0x8e,0xc1,0x3d,0x46,0x0c,0x49,0x13,
+    0xaf,0xf7,0x1d,0x77,0x2c,0xef,0x88,0x49,0xe9,0x70,
+    0xf2,0xfd,0x8d,0x3f,0x2d,0x1b,0x76,0x70,0xca,0xee,
+    0xaf,0x2e,0xec,0x99,0x73,0x2a,0x65,0xc3,0x8d,0x8c,
+    0xe2,0xf1,0x9f,0xce,0xe9,0x1c,0xf3,0xaa,0x38,0x7a,
+    0xcd,0xbd,0x05,0xcb,0x4a,0xb6,0xcf,0x69,0xc2,0xf9,
+    0xd1,0x03,0xe5,0xe4,0x69,0x35,0x3f,0x7c,0x4c,0x1a,
+    0x67,0x83,0xb3,0x96,0x31,0x85,0x0b,0x8a,0xb3,0x8b,
+    0xd1,0x89,0xf3,0x83,0xdb,0x6a,0x28,0x59,0xb2,0xe9,
+    0x08,0x24,0xbc,0xf5,0xbf,0x5f,0xfa,0xb4,0x69,0xd7,
+    0x73,0xcd,0x4e,0xf4,0xa2,0x26,0x96,0x67,0xef,0x19,
+    0x31,0xe8,0xad,0x5c,0x6a,0x78,0x0c,0xef,0x00,0x88,
+    0x47,0xc4,0xf3,0x62,0x2f,0xb1,0x87,0x6e,0xb1,0x1e,
+    0x02,0xc1,0xb7,0x67,0x5f,0x9a,0xfc,0xf9,0x6e,0xf1,
+    0xfd,0x9d,0x9b,0x4a,0x18,0x2e,0xae,0xbb,0x8a,0x64,
+    0x3e,0x53,0x22,0xce,0x5c,0x79,0x8d,0x5a,0x49,0x89,
+    0xa7,0x7f,0xd9,0x3a,0x0c,0xf5,0x58,0xe8,0xf3,0x74,
+    0x5a,0x6c,0x5c,0x65,0x99,0xac,0xce,0x58,0x87,0xd9,
+    0x8b,0x41,0xd5,0x75,0xa4,0xf1,0xda,0x45,0x32,0x1c,
+    0xd3,0xd8,0x88,0x7d,0xc9,0xa9,0x5d,0x4e,0x6e,0xb7,
+    0x26,0x8a,0x64,0x1c,0xb4,0x2d,0x73,0xf4,0x37,0x7e,
+    0x07,0xc7,0xab,0xdc,0x2e,0x81,0x52,0x70,0x50,0x6c,
+    0x62,0xfc,0xb7,0xa7,0xae,0x10,0x01,0x82,0x83,0xe5,
+    0x02,0x35,0x5b,0x3a,0xd0,0x13,0x0a,0xad,0x78,0x5a,
+    0x3c,0xf5,0x2a,0x6c,0x4c,0x87,0x75,0x1c,0x47,0x22,
+    0x7c,0x28,0xd8,0x0b,0xdf,0xca,0xe3,0x3c,0xb3,0x5f,
+    0x78,0x08,0xf6,0x96,0x8e,0xf4,0x38,0x3b,0x84,0x8c,
+    0xc9,0x96,0xbb,0x53,0x10,0x66,0x37,0x84,0x69,0x2f,
+    0xc1,0x04,0x04,0x69,0x0f,0x11,0xf8,0x50,0x7b,0x1a,
+    0x6e,0x39,0x2f,0x28,0xd2,0xc5,0x11,0xaf,0xa2,0x4d,
+    0x88,0x5d,0x86,0xf0,0xbc,0xac,0xbf,0xd2,0x14,0xd4,
+    0x3d,0x57,0x9c,0x7b,0x10,0x17,0xde,0xa3,0x4e,0xb4,
+    0x19,0x18,0x59,0x77,0xc6,0x42,0xb8,0xc9,0x47,0xed,
+    0x12,0xe6,0xc6,0x1a,0x12,0xee,0x55,0x02,0x3e,0x6b,
+    0xda,0x6d,0x6b,0x31,0x33,0xa8,0x63,0x6a,0x68,0xda,
+    0xae,0xe1,0x7b,0xc3,0x5a,0x23,0x1f,0x94,0x13,0xfa,
+    0xbc,0xb3,0xbd,0x78,0xd5,0x0f,0xf9,0x83,0x02,0x5b,
+    0x17,0x2c,0xeb,0x33,0x7e,0xce,0xa9,0xb1,0xed,0x2b,
+    0xee,0xc5,0x4d,0x8d,0x7b,0x2a,0xf1,0x64,0x84,0xb5,
+    0x97,0xe2,0x63,0xe5,0x69,0x9c,0xb5,0xb4,0x61,0x23,
+    0x1c,0xd1,0x6a,0x88,0x77,0x98,0x9b,0x33,0xef,0x35,
+    0xec,0x2f,0x23,0x1f,0xf3,0x50,0xa0,0x05,0x57,0x36,
+    0xa2,0xf1,0xde,0x54,0x51,0x57,0x6e,0xe5,0x5c,0x55,
+    0x02,0x13,0x6e,0x54,0xae,0x28,0x17,0x13,0x9d,0x2c,
+    0x8a,0xf7,0x50,0x84,0xb5,0x5b,0x7e,0x9b,0x3a,0x7b,
+    0xea,0x1a,0x27,0x7b,0x7d,0x9f,0x8e,0xa3,0xf2,0xd7,
+    0x2f,0x19,0x31,0x5c,0x17,0x14,0x34,0xe9,0xea,0x81,
+    0x57,0x6f,0x8c,0xfb,0xea,0xf4,0xaa,0x29,0x93,0xd2,
+    0xbb,0x24,0x8f,0x0c,0x0a,0xb3,0x6f,0xe4,0xb5,0x1f,
+    0x1d,0xf3,0x31,0xb0,0x1e,0xbe,0x7f,0x5f,0x3c,0x28,
+    0xb6,0xb4,0x92,0xc3,0x43,0x06,0x1d,0xdd,0x77,0xf7,
+    0xa9,0xb7,0x68,0x8a,0xe8,0x93,0x08,0x0b,0xc0,0x1d,
+    0x92,0x3e,0x14,0x77,0xdf,0x12,0x3f,0x13,0xb7,0x26,
+    0x4e,0x4e,0x50,0x14,0x9c,0x7a,0xfb,0x7f,0xeb,0xb6,
+    0x81,0xbb,0xbd,0x34,0xc7,0x13,0x16,0x2a,0xdf,0xc3,
+    0x59,0x9b,0x0b,0xb3,0x11,0x6e,0x38,0xf0,0x79,0x0b,
+    0x46,0xa2,0xf7,0x37,0xf9,0x3b,0x09,0x6a,0x6f,0x18,
+    0x79,0xac,0x1d,0x04,0x6e,0x28,0x14,0x57,0x15,0x6c,
+    0x04,0xd3,0x57,0x06,0x17,0x47,0x4d,0x2b,0xb7,0x48,
+    0x47,0x68,0xa5,0x7c,0xef,0x9f,0x8a,0xf6,0x70,0x4b,
+    0xf4,0x55,0x7c,0x70,0xfe,0xd5,0x3e,0x7d,0xa7,0x9d,
+    0x4b,0xbf,0x1b,0xc2,0xf4,0x66,0x35,0x7e,0x64,0xa3,
+    0xad,0x70,0xc2,0xd9,0x1e,0xb3,0xa3,0xde,0x06,0x2d,
+    0x9a,0x50,0xc9,0xc8,0x19,0xbd,0x5d,0xb4,0xdc,0x7c,
+    0x18,0x05,0x3c,0x6b,0xd1,0x86,0xac,0x86,0x28,0x98,
+    0x91,0x97,0x35,0x75,0xe2,0xd1,0xed,0xe2,0xd2,0xd2,
+    0x6d,0x13,0x46,0xff,0xb0,0xf9,0xcc,0xd7,0x53,0x8a,
+    0x94,0x87,0xc4,0xf5,0x4b,0xde,0xd4,0xd9,0x35,0xdd,
+    0x5d,0x7a,0xe6,0xb6,0x32,0x50,0x74,0x99,0xb5,0xe0,
+    0xae,0x65,0x89,0xe5,0x0a,0xf8,0xcc,0x5e,0x84,0xfd,
+    0x9d,0x89,0xba,0xd9,0x5d,0x79,0x9e,0x51,0x8c,0x5c,
+    0xe6,0x36,0x42,0x8d,0xf6,0x88,0xca,0x9c,0xa4,0xf1,
+    0xdf,0x88,0x56,0xcb,0xdd,0x25,0x13,0x63,0x86,0x65,
+    0x94,0xed,0xdd,0xbf,0x6e,0xfc,0x88,0xfe,0x3a,0x58,
+    0x48,0x4f,0x40,0x79,0xf7,0x39,0x71,0xe2,0x11,0xcb,
+    0x59,0xf1,0x68,0xf8,0x92,0x08,0x6c,0x3b,0xa3,0xf5,
+    0x2d,0xa4,0x55,0x8d,0xf3,0x54,0xa4,0x34,0x8c,0xf5,
+    0x14,0x23,0xd1,0xc0,0xba,0x66,0x35,0x84,0x3f,0xa8,
+    0xa8,0xfc,0x57,0xbc,0xb9,0x7e,0x1e,0xf4,0xdb,0xf1,
+    0x06,0x92,0xb4,0xdc,0x12,0x22,0x2e,0x52,0x06,0x56,
+    0x0c,0xa5,0xfd,0xc1,0x1b,0x5a,0x48,0x63,0x46,0x29,
+    0x76,0xfc,0x15,0x69,0x9c,0x01,0x94,0x4f,0x57,0xf9,
+    0xa0,0x57,0xc4,0x61,0xb0,0x40,0x2c,0x81,0x2d,0x96,
+    0x33,0x34,0x46,0xd9,0x42,0xf4,0x58,0x6a,0xb9,0xb1,
+    0x8c,0x0f,0x78,0x35,0x75,0xec,0xab,0xeb,0x18,0xe5,
+    0x1a,0x0b,0xc5,0x89,0xeb,0xd8,0xe3,0x96,0x9b,0x4b,
+    0x2d,0x0b,0xf1,0x09,0xa9,0xad,0x5f,0xa0,0xcc,0xba,
+    0xe3,0xb3,0x5a,0x14,0x4d,0xc2,0x64,0x0a,0xf5,0xac,
+    0xba,0xbd,0x5a,0x63,0x84,0xf0,0xc5,0xde,0x93,0x8f,
+    0xc4,0x47,0xd0,0x0c,0x14,0xbb,0x4b,0xc3,0x1c,0xe6,
+    0x97,0x7c,0x70,0xee,0x83,0xdd,0xe3,0xfb,0x5d,0xa2,
+    0x4f,0x2c,0xad,0x13,0x60,0x31,0xfd,0x04,0x96,0x0c,
+    0xc9,0xd7,0xa5,0x8a,0xa7,0x2c,0xef,0x8b,0x27,0xbd,
+    0xe0,0x8b,0x65,0x12,0x0d,0xc2,0x9a,0xea,0xf1,0x91,
+    0x51,0x60,0xc6,0x4f,0xb3,0xb0,0x66,0xbd,0x18,0xbe,
+    0x6e,0x1d,0x9c,0x5f,0x4f,0xdf,0xb5,0x24,0x2a,0x0f,
+    0x59,0x96,0xd2,0x22,0x4e,0xf3,0x76,0xfc,0x88,0x91,
+    0xc6,0x6f,0x7c,0xde,0x0c,0x31,0xa5,0xa5,0x8c,0x3e,
+    0xeb,0x0a,0x71,0x1a,0xf7,0x99,0x98,0x9f,0xa2,0x75,
+    0x43,0x02,0xb9,0x85,0xc2,0x4e,0xd6,0x42,0x00,0xac,
+    0x98,0x49,0xa1,0x77,0x44,0xd4,0xbc,0x8e,0xca,0x43,
+    0x4f,0xbb,0x1d,0xfe,0xb4,0xf1,0x62,0xdd,0xb8,0xc9,
+    0xca,0x63,0x1c,0x1e,0xe3,0xfd,0x0c,0xac,0xd7,0x48,
+    0x82,0xa7,0x8d,0x04,0x33,0xb8,0x11,0xbd,0x91,0xfa,
+    0xab,0x21,0x74,0xfd,0xfa,0x60,0x18,0xb5,0x43,0x5c,
+    0x67,0x06,0x92,0xb0,0xab,0xb2,0x4d,0x3e,0xd2,0xe1,
+    0x30,0x82,0xae,0xb2,0xcc,0xcc,0xb7,0x5c,0x2a,0xa3,
+    0x91,0x33,0x17,0xd4,0xf0,0xfe,0x34,0xc2,0x50,0xa2,
+    0xcf,0xc2,0xb8,0x68,0x86,0x50,0x58,0x61,0xb9,0xba,
+    0x6e,0x19,0x67,0x34,0xc7,0xa1,0xf4,0xc1,0x4b,0xbd,
+    0xec,0x03,0x18,0xd1,0xda,0x1b,0xdd,0x5c,0x59,0x5b,
+    0xc1,0x4d,0x6f,0x8e,0x8c,0x62,0xfe,0x6f,0xa9,0xa3,
+    0x9d,0xb8,0xe5,0x4d,0x71,0x93,0x7d,0xc3,0x95,0xbf,
+    0x00,0x3e,0x66,0xe7,0xd4,0x02,0x3c,0x7f,0x57,0x38,
+    0xa6,0xef,0x7c,0xfa,0x50,0xe9,0xf6,0x6e,0x5a,0xc5,
+    0x5f,0xca,0x43,0x15,0xd7,0x67,0x8d,0xee,0xb3,0x52,
+    0xd1,0x52,0xe6,0xdb,0xc3,0x2a,0xba,0xab,0xa1,0x99,
+    0x4d,0x11,0xc8,0xbb,0x87,0xa7,0x2d,0x4f,0x1c,0x34,
+    0xaf,0x7d,0x48,0x15,0x6a,0xc7,0xd7,0x14,0xe7,0x67,
+    0xce,0xaf,0x6c,0x83,0x75,0x3b,0x96,0x15,0x09,0x07,
+    0xb9,0x7d,0x60,0x7d,0xf9,0x37,0xf6,0xa5,0x1d,0xd1,
+    0xb2,0x31,0x8e,0xbb,0x39,0x5a,0x8d,0x92,0x75,0x24,
+    0x37,0xee,0x21,0x37,0x1f,0xfc,0x22,0xc6,0xff,0x0c,
+    0xe7,0x56,0x95,0x96,0x82,0xb1,0x54,0xf9,0x99,0x38,
+    0xd9,0x12,0x24,0x4e,0x82,0x57,0x20,0x87,0x3e,0x5c,
+    0x26,0x7e,0x66,0xd9,0x29,0x9e,0x43,0x36,0x85,0xd0,
+    0xe1,0x92,0xbd,0x61,0x3c,0x8c,0xe4,0x72,0xa4,0xe5,
+    0xf2,0x8b,0xee,0x04,0x36,0xc0,0xc8,0x95,0x4c,0xc3,
+    0x94,0x0b,0xbe,0xfc,0x4c,0xec,0x37,0x78,0xfd,0xfa,
+    0xd4,0xd7,0x66,0xcf,0x5a,0xa0,0x3c,0x74,0xe5,0x96,
+    0xd8,0xd6,0x72,0x4c,0x19,0x68,0xd9,0xb2,0x02,0x3a,
+    0x2c,0x95,0x60,0x64,0x8a,0x5b,0x39,0x4d,0x1a,0xd2,
+    0x98,0x71,0x0b,0xe9,0x41,0x3d,0x40,0x5a,0xd0,0x0f,
+    0x17,0x4c,0x68,0x94,0xaa,0x68,0x6b,0xf5,0x2d,0xd2,
+    0x75,0xf3,0xc1,0xa2,0xb9,0x3f,0x1d,0x3d,0xa1,0xf6,
+    0x10,0x24,0x0a,0x75,0x12,0x69,0xe2,0x64,0xb1,0x5c,
+    0x7c,0x20,0x96,0x26,0x88,0x4b,0x21,0x11,0x14,0xca,
+    0xde,0xb5,0x48,0xa5,0x9c,0x67,0x53,0x90,0xce,0x86,
+    0x68,0x79,0x89,0x8b,0xec,0x55,0xb1,0xbe,0xa8,0xa1,
+    0xb5,0xb4,0xe2,0xab,0x0b,0xd9,0x85,0xe0,0xb5,0x5b,
+    0xb4,0x6c,0x58,0xb7,0xae,0x68,0xd2,0xd4,0xe9,0x8b,
+    0x94,0x87,0xce,0x5f,0x2e,0x3d,0x1d,0x66,0x19,0x47,
+    0x47,0x5b,0xca,0x95,0xcd,0x2d,0x9f,0xae,0x04,0xe3,
+    0x6c,0xc9,0x37,0xc6,0xb1,0xf1,0x3e,0xd2,0x8c,0x56,
+    0xdc,0x8f,0xf9,0x4a,0x38,0x9d,0xd2,0x44,0x1a,0x98,
+    0x52,0xf0,0x01,0xb9,0xca,0xa1,0xf2,0x04,0xc8,0x1f,
+    0x35,0x25,0x6f,0xd4,0xa6,0x59,0x67,0x21,0x66,0x8a,
+    0x8b,0x6f,0xf1,0x47,0xe3,0xfb,0x2e,0x5a,0x39,0xfb,
+    0x33,0x71,0xe7,0x84,0x98,0xf5,0x93,0x96,0x7f,0xbe,
+    0xb8,0xdd,0x80,0xc3,0x10,0x7f,0xad,0x6b,0xab,0x81,
+    0xb1,0x73,0x2e,0x4d,0xe9,0x91,0x7c,0x7a,0xe1,0xd1,
+    0xdb,0x6d,0x36,0x1b,0x03,0x38,0x0e,0xf4,0x98,0xe8,
+    0x43,0x6e,0x1b,0x98,0x8e,0x72,0xef,0x19,0x1b,0xfa,
+    0xdd,0x3a,0xf1,0x0e,0xfd,0x5a,0xd9,0xfc,0xe9,0x0d,
+    0x65,0xf3,0x65,0xfc,0xb9,0xc5,0xd8,0xa7,0xa5,0x92,
+    0x3c,0x80,0x56,0x87,0x1d,0x8a,0x82,0xa0,0xe5,0xee,
+    0x80,0x56,0x28,0x3d,0x23,0xce,0xfa,0x64,0xfd,0xe4,
+    0xbb,0x13,0x94,0x87,0x2a,0xcd,0x95,0xe8,0x95,0xa8,
+    0xfe,0x15,0xce,0x57,0xfa,0xed,0x7d,0xe7,0xe0,0x5e,
+    0xe1,0x6b,0x29,0x6e,0x26,0x8c,0xc5,0xba,0x0d,0x98,
+    0x2c,0x51,0xc1,0xec,0xec,0xe2,0x86,0x93,0x20,0x17,
+    0x33,0x75,0x3e,0xda,0xdf,0xba,0xb1,0x24,0xcb,0x5b,
+    0xe7,0xe2,0xf6,0xe7,0x46,0x18,0xaf,0xe8,0x60,0xf9,
+    0x59,0x6c,0x5f,0xba,0xf3,0xd5,0x6c,0x05,0x73,0x06,
+    0xd8,0xf3,0xca,0xfd,0x58,0x8f,0xf9,0x90,0x54,0x30,
+    0x0a,0x41,0x4a,0xff,0x46,0x38,0xd1,0x14,0x38,0x0c,
+    0xbd,0x33,0x87,0x21,0x81,0x52,0xee,0x6f,0xf3,0xeb,
+    0xc9,0xd7,0x94,0x7a,0xb5,0xd6,0x41,0xeb,0xd0,0xa0,
+    0x51,0x80,0x6e,0xf9,0xf1,0xaf,0x7b,0x6d,0x98,0x1e,
+    0xd0,0x51,0xe5,0xe5,0x7c,0x6a,0xe7,0xb6,0x96,0x3e,
+    0x9e,0x8d,0x0f,0xa3,0x65,0xbb,0x5b,0x91,0x49,0x7f,
+    0x6c,0x9c,0x63,0x1c,0xd8,0xb5,0xa4,0x47,0xff,0x61,
+    0xf7,0x0a,0x2d,0x4d,0x14,0x61,0x30,0xd7,0x32,0xfe,
+    0xbe,0xb8,0x38,0xf4,0xfb,0x74,0xe1,0x7a,0xe5,0xd1,
+    0x5b,0x4f,0xff,0x9c,0x20,0xbc,0x83,0xb8,0x71,0xb4,
+    0x17,0xb4,0x92,0xdd,0xb0,0x07,0xa3,0x23,0x18,0xed,
+    0xc1,0xdc,0x04,0x7b,0xfa,0x31,0x34,0x79,0xfd,0xc6,
+    0x83,0xcd,0x10,0x23,0xde,0xdf,0x7c,0xf9,0xcc,0x16,
+    0xfa,0xbb,0x45,0x43,0xf3,0x2d,0x2b,0x04,0x81,0xbe,
+    0x63,0x39,0x47,0x23,0xab,0xe2,0x84,0x82,0x3d,0xd6,
+    0xb5,0xe3,0xfa,0x28,0xd5,0x83,0xcb,0xeb,0xc4,0x73,
+    0x5b,0xbf,0xbb,0xb3,0x55,0xfc,0x84,0xc6,0x08,0x93,
+    0x2d,0x5d,0xe9,0xe1,0x4a,0x66,0xe3,0xc3,0x91,0xff,
+    0x3b,0x24,0x1b,0xe9,0xc7,0x3c,0x6f,0x6f,0xe6,0xac,
+    0xd1,0x1d,0x96,0xa5,0xf0,0x9e,0x98,0x42,0x87,0x88,
+    0x9d,0x97,0x2d,0x9b,0xac,0xd8,0xfb,0xea,0x94,0x8a,
+    0x54,0xc9,0x16,0x6c,0xc6,0xf9,0x59,0xe7,0xea,0xfe,
+    0x92,0x6c,0x70,0x67,0xf1,0x21,0xe8,0xc4,0x41,0xb0,
+    0x4d,0x19,0xfd,0x54,0x98,0xa1,0x7a,0xfa,0xcc,0x3c,
+    0x04,0xf5,0xd7,0x4c,0x2f,0xaf,0xb1,0xfc,0x6f,0xb5,
+    0x6c,0x97,0x3b,0xe0,0x5c,0xed,0x5e,0x15,0x0c,0xc9,
+    0xdb,0x80,0x7b,0x58,0xdf,0x55,0xfc,0x05,0xb6,0x89,
+    0x1f,0xcc,0x50,0x5a,0xa6,0xf3,0xe7,0x9a,0xd1,0x5d,
+    0x42,0x01,0x8e,0x99,0xcc,0xdf,0xc0,0xf6,0x23,0x18,
+    0xa1,0xe0,0x55,0xf1,0x5b,0xf1,0xc1,0x52,0x28,0x1a,
+    0x48,0x77,0xd1,0x4c,0xcb,0x5a,0xc1,0x09,0x6d,0x63,
+    0xa5,0xf8,0x83,0xe0,0x69,0xed,0x5a,0x35,0x5f,0x12,
+    0x3c,0x2b,0x6f,0x0b,0x3e,0xe2,0x0f,0x6c,0x99,0x13,
+    0x16,0x2a,0xbe,0xa2,0x56,0x95,0x37,0x8f,0x78,0x30,
+    0x07,0xda,0xd5,0x68,0xc2,0x21,0x17,0x16,0x1e,0x6b,
+    0x36,0x36,0x74,0x68,0xfc,0xc0,0x01,0xde,0x2a,0xef,
+    0x4e,0x6f,0xb7,0xd3,0x47,0x0f,0x4f,0x97,0xfc,0xe3,
+    0x04,0xeb,0x6f,0xf4,0x13,0xc5,0x60,0xd4,0x20,0x03,
+    0xea,0x90,0x3f,0x73,0x5e,0xb4,0x46,0x7f,0x23,0x1a,
+    0x5c,0x93,0x26,0x32,0x8e,0x4d,0x4b,0x7c,0x5c,0x22,
+    0x98,0x17,0xce,0x9d,0x88,0xf3,0x6d,0x66,0x83,0x69,
+    0x59,0xb1,0x87,0x32,0x65,0x53,0xc9,0xfc,0x0f,0xf6,
+    0xcf,0xe8,0x7a,0xe0,0xa9,0x4f,0xfc,0x84,0x71,0x0b,
+    0x07,0x8f,0x16,0xd6,0xe5,0xa7,0x1c,0x3a,0x65,0x69,
+    0x52,0xbe,0x7b,0x27,0xb4,0x79,0xc7,0x4e,0xd5,0x77,
+    0xe6,0x44,0xcb,0xd7,0x63,0x40,0xa1,0x9a,0x58,0x74,
+    0xf6,0x1d,0xc4,0x33,0x1f,0xe5,0xb9,0x27,0xce,0x3b,
+    0x1b,0x31,0x7b,0x00,0x6a,0x73,0x24,0x9f,0x8d,0x21,
+    0x22,0x35,0xb3,0xd2,0xdc,0xfd,0xd6,0xa0,0x9a,0x41,
+    0x33,0xb5,0x43,0x3f,0x08,0xdd,0xbe,0x4d,0xbc,0x30,
+    0xc0,0xd1,0xae,0xd1,0xf8,0xb2,0xcc,0xcf,0x87,0x0f,
+    0xff,0x62,0x84,0xa2,0xeb,0xca,0xad,0xe2,0x1d,0xcb,
+    0x75,0xf1,0xe6,0xeb,0x51,0xfd,0x54,0xba,0xca,0x26,
+    0x1e,0xd7,0x2e,0x5e,0x87,0xf7,0xbe,0x3c,0xcd,0xf9,
+    0xd6,0x1f,0xf5,0x76,0xba,0x62,0x90,0x34,0x6e,0x73,
+    0x4b,0xc3,0xc7,0x6d,0x2d,0x9f,0xdf,0xbb,0xaa,0xe0,
+    0xfd,0x7d,0xef,0xc0,0x88,0xc2,0x94,0xb0,0x2e,0x31,
+    0x5f,0x8e,0x2d,0xe8,0x3e,0x78,0x80,0x0e,0x47,0x34,
+    0x1d,0x8d,0x0d,0x99,0xea,0x27,0x26,0xde,0xba,0x14,
+    0x30,0x27,0x08,0xe9,0xeb,0x87,0xf4,0x79,0x21,0x7d,
+    0xce,0xe8,0x97,0x63,0x0f,0x9a,0x90,0x32,0x03,0x1f,
+    0x08,0xd1,0xa0,0x9b,0xfc,0xd1,0x08,0x33,0x4e,0x70,
+    0xb7,0x58,0xf0,0x1a,0xdf,0x48,0x69,0x9f,0x2a,0x7e,
+    0xb8,0x7d,0xeb,0x9a,0x2e,0x33,0x5b,0x38,0x2a,0x69,
+    0x59,0x79,0xd6,0xa5,0xc1,0xc3,0xce,0x8d,0x19,0xd3,
+    0x72,0x17,0x18,0xa8,0x3f,0x34,0x4f,0x4b,0xea,0xd1,
+    0x1d,0x4e,0x57,0x5c,0x8f,0xf8,0xfe,0xf2,0x4d,0xb1,
+    0xc7,0x8d,0xe3,0x08,0x9f,0xd1,0x58,0x81,0x34,0x6a,
+    0xd0,0x7f,0x21,0x4a,0x69,0x8c,0x75,0x6e,0x06,0xde,
+    0x92,0x6b,0xe1,0xc2,0xe6,0x3d,0x02,0xdc,0x3a,0xf2,
+    0xd9,0xa1,0x5d,0xa5,0x6f,0x59,0xfe,0x51,0x3d,0x2a,
+    0x9c,0x50,0x00,0xc3,0x53,0xf7,0x6a,0x74,0xe0,0x47,
+    0x0d,0x10,0x20,0x56,0x7c,0x3b,0x46,0x1c,0xd1,0x65,
+    0x7e,0x3c,0x5d,0xbb,0xe1,0xa8,0xb8,0x53,0x92,0x4d,
+    0x84,0x44,0xcd,0x2a,0x2f,0x76,0x76,0xe1,0x0e,0x20,
+    0xb6,0xda,0x09,0xdb,0x26,0xcd,0xc8,0x8c,0x11,0x91,
+    0x51,0x1b,0x27,0xbc,0x92,0x92,0xd0,0xca,0x1c,0x1c,
+    0x17,0xba,0x6f,0x5f,0xe9,0x82,0xc6,0xf9,0x8a,0x2d,
+    0x67,0xdf,0x33,0x4c,0x6f,0x4c,0xf3,0x96,0xf4,0x9f,
+    0x5e,0x19,0x2d,0x7c,0xd2,0xcb,0xb1,0x25,0x4a,0x51,
+    0x33,0x51,0x27,0xb8,0x20,0x6d,0x2d,0x51,0x3b,0xd0,
+    0x0d,0xf7,0x93,0x2c,0x29,0x77,0x2b,0xa3,0x78,0x44,
+    0x89,0x87,0x53,0x10,0x7e,0x24,0x4e,0x9a,0xa4,0xb9,
+    0x4a,0x4b,0xf0,0xf1,0x77,0x02,0x9d,0x9b,0x33,0x37,
+    0x8d,0xe6,0xb0,0x08,0xc1,0x28,0x5d,0xa0,0x17,0x06,
+    0x73,0x47,0xae,0x58,0xf7,0xd3,0x99,0xcd,0x7b,0xae,
+    0x87,0xb7,0x8b,0xee,0xd8,0x33,0x6d,0xcb,0xf2,0x76,
+    0x31,0x0d,0x67,0x4f,0x7c,0xd5,0xc3,0x7b,0xeb,0x1c,
+    0x3b,0x4f,0x4d,0xcb,0xc0,0xf8,0x5b,0x3d,0x4b,0x7b,
+    0xa7,0x76,0x2f,0x1f,0x9a,0x94,0x9e,0x33,0x2a,0x7d,
+    0xd6,0x8a,0xdd,0x6b,0x57,0xed,0x38,0xb5,0xe6,0xd5,
+    0xcf,0x7a,0xba,0xf5,0x1e,0xd5,0xc3,0x6c,0xda,0x53,
+    0xf8,0xf6,0x59,0x37,0x80,0xe1,0xae,0x7e,0xb3,0x3a,
+    0x6d,0xfd,0x48,0x61,0x68,0x9b,0x1c,0x44,0x8f,0xbe,
+    0xb2,0xe8,0xc9,0x74,0x8b,0x25,0xaa,0xe8,0x44,0xc6,
+    0xd4,0xdc,0xb7,0xb0,0xed,0xf3,0x51,0xe7,0x9b,0x61,
+    0x7f,0xb9,0x71,0xfb,0xa8,0x36,0x4b,0xb3,0x6a,0x6c,
+    0x36,0x9f,0xe2,0xb2,0x0b,0x68,0xa6,0x72,0xf0,0x9e,
+    0x91,0xb4,0x74,0x4e,0x79,0x97,0xe4,0xb1,0x59,0x65,
+    0x2a,0x9d,0xd8,0xb6,0xd3,0x80,0x9e,0x03,0xdf,0xff,
+    0xc0,0xd2,0x84,0x5e,0x5a,0x34,0xf5,0xd3,0xcf,0x2d,
+    0xa7,0xb1,0x3e,0xd3,0x81,0xc9,0x08,0xa3,0x95,0xf2,
+    0x5b,0x1e,0xcb,0xe2,0x51,0x2c,0x1d,0x0b,0x58,0xa1,
+    0x5c,0x4e,0x0e,0x4b,0x09,0x0e,0xe9,0x1d,0xb6,0xad,
+    0xbc,0x5c,0xb9,0xb5,0x6d,0xdb,0xac,0xb6,0x6d,0x9f,
+    0x7e,0xa8,0xe8,0xc2,0xc7,0x37,0xeb,0x03,0x51,0x07,
+    0xc1,0xbc,0x8e,0xae,0xa6,0x8e,0x5e,0xab,0x91,0x27,
+    0x52,0x68,0xa6,0xa7,0x86,0xa5,0x06,0x05,0xf7,0x36,
+    0x6f,0xbb,0x15,0x6d,0xf4,0xf3,0x0e,0x0e,0x60,0x10,
+    0x32,0x63,0x62,0xfe,0xa9,0xb0,0x13,0x3f,0xd2,0xcd,
+    0xd3,0xf6,0x1f,0xa2,0x78,0x4c,0xe4,0x76,0x68,0xa4,
+    0x78,0x0c,0xf7,0x57,0xd4,0x66,0x34,0xb2,0xa8,0xfb,
+    0x82,0x1a,0x3c,0xcb,0xcb,0xed,0xed,0xe3,0x2a,0x5f,
+    0x17,0x2b,0xa1,0xf1,0xa6,0x3b,0x45,0x28,0xf6,0xdf,
+    0x7c,0x38,0x1e,0xb6,0x8a,0x43,0x2c,0x83,0x69,0xe0,
+    0x42,0xa9,0x2e,0x78,0x62,0xdd,0x2a,0xdf,0x09,0x2b,
+    0xe0,0x37,0x5e,0xae,0x78,0x84,0xfd,0xc9,0xec,0x38,
+    0xba,0x23,0xd8,0x71,0xb1,0x34,0x2a,0x52,0xe6,0x8f,
+    0x46,0x66,0x4f,0xd5,0x19,0x40,0xd3,0x20,0x7e,0xdb,
+    0xc1,0x28,0x9d,0xde,0xec,0x1e,0x97,0x34,0x67,0x46,
+    0xd9,0x6b,0x99,0x83,0xca,0x5f,0xcb,0x18,0x5c,0xa6,
+    0x48,0x58,0xb5,0xeb,0xb8,0x8f,0x5f,0x3b,0x4d,0xc0,
+    0x99,0x0b,0x96,0x48,0x7a,0x0e,0xec,0xde,0x3b,0x69,
+    0xd9,0xc6,0xce,0xc7,0xae,0x59,0x4e,0x29,0x12,0x24,
+    0x19,0xe4,0xfd,0x20,0xe9,0x1e,0xe2,0xaa,0xee,0x05,
+    0x06,0xbd,0x31,0x48,0xd0,0x7d,0x66,0x27,0x2f,0x98,
+    0x57,0xfe,0xda,0xe4,0x41,0x0c,0x64,0xaf,0x01,0xef,
+    0x1d,0xb7,0x78,0xd0,0x4b,0xa0,0xba,0x29,0xfe,0x2d,
+    0x6a,0x10,0x8c,0xa4,0x7b,0x21,0x08,0x83,0xfb,0xcb,
+    0x35,0x71,0x1a,0xd4,0x36,0x73,0x98,0xa6,0xdf,0x31,
+    0x18,0x78,0xfa,0xa4,0xb8,0xe3,0x24,0xe4,0xe4,0x8e,
+    0xcc,0x18,0x7b,0x49,0x88,0x04,0x3f,0xf1,0x0b,0xcb,
+    0x3d,0xf1,0x06,0xb4,0xa0,0x27,0xae,0x8a,0x49,0x5f,
+    0x09,0xe9,0xcc,0xbe,0xa0,0x0c,0xf7,0x54,0xf4,0x97,
+    0xf4,0x97,0xfb,0x40,0x28,0xbf,0xfe,0x46,0x37,0x3d,
+    0xf3,0xa3,0x90,0x09,0x42,0x95,0x85,0x51,0x53,0xf7,
+    0xb2,0x4d,0x6f,0x94,0x25,0xcf,0xf0,0x77,0xb4,0x87,
+    0xf2,0x12,0x37,0x87,0xde,0x29,0x68,0x63,0x86,0x7c,
+    0x31,0x0a,0x14,0xfd,0xc5,0x9b,0x96,0x1f,0xc4,0x6b,
+    0xa9,0xc9,0x59,0x5e,0x62,0x03,0x55,0xd8,0xaa,0xed,
+    0x96,0x2b,0x3f,0x5c,0xbb,0x0e,0x47,0xbe,0x38,0x76,
+    0x81,0xcb,0x49,0x3f,0xc4,0xe1,0xa5,0xe8,0x27,0xe1,
+    0xf0,0xab,0xb1,0x0f,0x91,0x51,0x66,0x26,0x78,0x51,
+    0x35,0x36,0x82,0x2e,0x4c,0x13,0xcf,0x6e,0xdb,0xb6,
+    0x2a,0xa5,0xa4,0xa5,0x43,0x03,0xf5,0xb4,0x32,0x07,
+    0xc7,0xcc,0x4b,0x43,0x86,0x7d,0x96,0xbd,0x66,0x2f,
+    0x78,0xd1,0x00,0xf0,0x49,0xea,0x33,0x3c,0xe4,0xc9,
+    0x45,0xf8,0x32,0xb6,0x10,0x06,0xb6,0xfa,0xee,0xca,
+    0x4d,0xb1,0xf3,0xc5,0x33,0xd5,0xfc,0xa4,0x49,0x68,
+    0x8f,0x1b,0xb1,0x7c,0x15,0xc9,0x8e,0xf1,0x6e,0xc2,
+    0x36,0x40,0xa7,0xac,0x09,0x81,0x8d,0x7d,0x4d,0xfd,
+    0x8a,0xcb,0xa7,0x69,0xd5,0xc2,0xbf,0xa3,0x1a,0xad,
+    0x76,0xba,0xbd,0xdb,0x72,0x5a,0xd1,0xe5,0x88,0x54,
+    0x37,0x01,0x6d,0x4c,0x36,0xd6,0xf5,0xc3,0xaa,0x3c,
+    0x70,0xe0,0x1f,0x24,0xf8,0x33,0x25,0x46,0x27,0x46,
+    0xcd,0x83,0x1c,0x5e,0xe0,0x49,0xf5,0x6e,0x92,0x1b,
+    0x33,0x7a,0xf1,0xab,0xfd,0xdd,0xd5,0x41,0xba,0xe9,
+    0x6d,0x27,0xf7,0xe9,0x07,0x8d,0x46,0xc7,0x0e,0xda,
+    0xdc,0x27,0x66,0x76,0x4b,0x73,0x8c,0xc6,0xb4,0x49,
+    0xbc,0x36,0xf0,0xf5,0x56,0xfd,0x3b,0x86,0x85,0x36,
+    0x6a,0xd9,0x68,0x60,0x70,0xfa,0xfa,0x69,0xc9,0xc9,
+    0xf1,0x13,0xa2,0xd3,0xe2,0xfb,0x07,0xa5,0x1b,0x02,
+    0xda,0x7b,0x75,0x1d,0xb4,0x62,0x65,0x6c,0x99,0x14,
+    0x7f,0xc3,0x39,0xfe,0x4f,0xca,0x8e,0x4c,0x0b,0xb8,
+    0xdd,0x41,0x36,0xa3,0x3d,0x63,0xb6,0x03,0x0d,0x50,
+    0x1c,0x0e,0xc4,0x7e,0x87,0x0e,0x05,0x8d,0x6d,0x61,
+    0x1e,0x50,0x3c,0x30,0x33,0x2f,0x70,0x94,0x22,0x61,
+    0xba,0xa5,0xc7,0x80,0x44,0xed,0xe4,0xa6,0xfb,0x4f,
+    0xd2,0x9c,0x1e,0x61,0x15,0x0c,0xc6,0x4c,0x16,0x13,
+    0x41,0x49,0x70,0x95,0x2d,0xaf,0x34,0xa5,0xe5,0xfe,
+    0x0e,0xd7,0x24,0xb3,0xa0,0x9f,0x62,0xe7,0xe8,0xe0,
+    0x3b,0xb3,0xe7,0xc2,0xb9,0xe5,0x09,0x49,0x79,0xa3,
+    0xcb,0xa2,0x87,0xf4,0x1a,0x70,0xea,0x73,0x7a,0xce,
+    0x92,0xb8,0x7a,0xf1,0xc9,0x6b,0x34,0x4e,0x6a,0x3f,
+    0x8e,0x9b,0xf4,0x16,0xc2,0x69,0x20,0x8d,0xc1,0x6e,
+    0x7a,0x67,0x17,0x94,0x48,0x17,0x33,0x9c,0x3b,0x2c,
+    0x3e,0x5a,0xaf,0x09,0x19,0x1c,0xac,0x76,0x68,0xb2,
+    0x63,0xbd,0x22,0x21,0xe1,0xa2,0x38,0x55,0x7c,0x90,
+    0xb4,0x94,0x7e,0xc9,0xeb,0x21,0xed,0x8a,0x33,0x58,
+    0xcf,0x83,0xc5,0xd5,0xd1,0xef,0x31,0x7b,0x30,0xb5,
+    0x91,0x9c,0x1d,0x73,0xa4,0x8b,0x99,0x95,0x99,0xfc,
+    0xe9,0x18,0x8f,0x35,0x1f,0xfc,0x54,0x96,0x1e,0xeb,
+    0xac,0xd2,0x79,0x4e,0x3f,0x38,0x43,0x6b,0x50,0xa9,
+    0xf7,0xae,0x6a,0x7a,0xf9,0xd8,0x72,0x9d,0xbd,0xb0,
+    0x73,0x97,0x05,0x14,0x09,0x62,0x80,0xf8,0xfa,0xf4,
+    0xfd,0x2b,0x69,0x81,0x65,0x59,0xf7,0xc7,0x43,0x84,
+    0x3e,0xb3,0x2b,0x63,0xe8,0x2f,0xd3,0xe3,0x18,0x0e,
+    0x94,0x18,0x7a,0x11,0x8d,0x47,0xb5,0x7f,0x03,0x02,
+    0xf7,0x53,0x3e,0x04,0xc7,0x4d,0x1f,0xbc,0xbf,0x01,
+    0x1a,0x56,0x6c,0xde,0xf3,0xe6,0x06,0xda,0xca,0xf2,
+    0x05,0xec,0x17,0x7b,0xd1,0x08,0xea,0x2c,0x66,0x43,
+    0x99,0xdc,0x2e,0x51,0xc7,0xdb,0xe5,0xc1,0x56,0x56,
+    0x65,0xfb,0x12,0x07,0x20,0x91,0x17,0xe5,0x1c,0x65,
+    0xa6,0x82,0x13,0x05,0xd5,0x80,0xb1,0x91,0x01,0x2d,
+    0x62,0x93,0x1a,0xfb,0x8b,0xdf,0xac,0xdf,0xdc,0xd4,
+    0x4d,0xed,0xea,0x9e,0xd3,0x72,0xc3,0xfc,0x15,0x4d,
+    0x5b,0xb4,0x15,0xdb,0x07,0x6a,0xe7,0x3a,0xa5,0x8f,
+    0x5d,0xad,0xe8,0x6e,0x19,0x5b,0xf4,0xda,0xa2,0xf1,
+    0xf0,0xf5,0x69,0xcb,0x23,0xcb,0xc9,0x31,0x73,0x98,
+    0x09,0x21,0x11,0x48,0x5b,0x30,0xd2,0x56,0xdb,0x27,
+    0x0a,0x16,0x55,0xd0,0x45,0xbc,0x08,0xd7,0xc4,0x63,
+    0x33,0x66,0x8c,0x15,0x06,0xcf,0x2c,0xac,0xdc,0x2d,
+    0xd1,0xd3,0x1b,0x7d,0xa2,0xe5,0xe8,0xcf,0xb0,0x95,
+    0x0f,0x2d,0x8b,0x61,0xe2,0x90,0x80,0x7d,0xa5,0x77,
+    0x0d,0x02,0x7f,0x66,0x7f,0x23,0x58,0xa7,0xe1,0xb0,
+    0xe1,0xea,0x04,0x70,0x06,0x46,0x8e,0x1d,0x3b,0x6a,
+    0x60,0xe1,0x3b,0x7b,0x68,0xc6,0xe4,0x92,0xac,0x7d,
+    0x6f,0x8f,0x19,0xa1,0xc8,0x15,0x3f,0xc9,0x1f,0xaf,
+    0xb3,0x77,0x19,0x9f,0x23,0xde,0x2e,0xc9,0x85,0xa9,
+    0x8a,0xf2,0x72,0x68,0x9f,0x3f,0xb4,0xa4,0x6f,0x21,
+    0x24,0x94,0x97,0x29,0xa6,0xc2,0x48,0x8e,0x07,0xa6,
+    0x88,0x4d,0xc0,0xaa,0x72,0x96,0xe2,0xe6,0x68,0xdf,
+    0xac,0x73,0xe7,0x8a,0x4d,0xd4,0xff,0x48,0xbe,0xba,
+    0x4c,0x43,0x33,0x6e,0xff,0xdd,0xcc,0xae,0x4c,0x4d,
+    0x34,0xca,0x88,0x58,0xe0,0xa8,0x23,0x82,0xd8,0xd9,
+    0xe4,0x1f,0xa1,0x80,0xb7,0x33,0x26,0x17,0xe5,0x88,
+    0x9b,0x72,0x46,0x8c,0x1c,0x3b,0x66,0xd4,0x88,0x1c,
+    0x48,0x57,0xcc,0x11,0xdf,0xcf,0x1b,0x58,0xd2,0xa7,
+    0x44,0x3c,0x29,0x5e,0xb5,0x9b,0x0a,0x19,0x59,0xd0,
+    0x26,0xb7,0x18,0xe9,0x99,0x90,0x0f,0xd1,0xa3,0x47,
+    0xc1,0x54,0x7b,0x84,0x5f,0x40,0x07,0x09,0x3a,0x21,
+    0x99,0x5b,0x13,0x1f,0x9c,0x08,0xf8,0xfb,0xa8,0x55,
+    0x6a,0x84,0x6e,0xf6,0x54,0xeb,0x25,0xb7,0x82,0xf6,
+    0x8b,0xe9,0xe0,0x38,0xdf,0xd4,0xb3,0x5f,0x03,0xda,
+    0x34,0xb3,0x85,0x8f,0xc9,0xa9,0x89,0x63,0x33,0x3b,
+    0x83,0xd0,0x3d,0x7c,0xc8,0xc0,0x1e,0x74,0x50,0x53,
+    0x45,0x27,0xfb,0xce,0x0e,0xb0,0xb4,0x71,0x4b,0xa1,
+    0xa1,0xa2,0x81,0xc2,0x49,0xd9,0x88,0xfa,0x4f,0x58,
+    0x34,0x46,0x5a,0x97,0x12,0x67,0xc1,0x60,0x45,0x37,
+    0xf4,0x57,0x1b,0x54,0x8d,0x1d,0x46,0x9f,0x08,0x17,
+    0xa3,0x8b,0xf9,0x95,0xa8,0x0c,0x16,0x10,0xfa,0xf4,
+    0x44,0x8b,0x5c,0x85,0x7d,0xfb,0xb8,0xe9,0xb1,0xd3,
+    0x9f,0xbe,0xab,0xf0,0x65,0xed,0xdd,0x82,0xba,0x7d,
+    0x56,0xf9,0x29,0x9b,0x73,0x82,0x64,0x14,0x34,0x9c,
+    0x0a,0xb6,0xfc,0xe3,0xab,0xf1,0x63,0x6b,0x3e,0xf4,
+    0x6c,0x58,0xcf,0x88,0xbc,0xcc,0x2f,0x7a,0x0f,0x6c,
+    0x33,0x38,0x4f,0xbc,0x0f,0xfa,0xbc,0xc1,0x8a,0xbf,
+    0xa7,0xfb,0x7e,0xf5,0x95,0x98,0xd6,0x6a,0xbe,0xd1,
+    0xf1,0xdc,0xa5,0xd6,0xc2,0xaf,0x6d,0xdf,0xdc,0x66,
+    0xcf,0xf9,0x97,0x8c,0x76,0x5b,0x2f,0xc7,0xa4,0xb5,
+    0x55,0xce,0x03,0xe3,0x21,0x2a,0xb1,0xab,0x0e,0xdb,
+    0xca,0xe2,0xd2,0x91,0xed,0xc0,0x18,0xf1,0x70,0xf1,
+    0x96,0xa5,0x79,0x1d,0xfa,0xa4,0x27,0x77,0xf9,0xe7,
+    0x1f,0x47,0xc7,0x2c,0xea,0x64,0x89,0x2b,0xdd,0x20,
+    0x34,0x05,0xd5,0xd7,0x9f,0xa7,0x4e,0xea,0x34,0x7e,
+    0x86,0x78,0x71,0xda,0x92,0xee,0xdd,0x77,0x74,0x5f,
+    0x36,0x3b,0xfe,0xee,0xdf,0xd3,0x58,0xfb,0xc6,0x81,
+    0xb3,0xf0,0x48,0xf1,0x1a,0xca,0x2b,0x1b,0x81,0xdc,
+    0x34,0x6a,0x37,0xbd,0xda,0x1f,0x4d,0x8e,0xda,0x3f,
+    0xca,0xa4,0x61,0x8b,0x0d,0x68,0x8f,0x22,0xa3,0xf4,
+    0x4e,0xc0,0x9d,0x07,0xf4,0xa8,0xf2,0x7a,0xf6,0xec,
+    0xd8,0x29,0x6d,0xfe,0x68,0xb1,0x62,0xd4,0xec,0xd4,
+    0x39,0x49,0x49,0xf3,0x52,0xe7,0x65,0x03,0x64,0x76,
+    0xea,0xd8,0x37,0x70,0xda,0xeb,0xf7,0xb6,0x6d,0xf9,
+    0x69,0x9b,0xf0,0x01,0xde,0xc4,0x82,0x94,0x39,0x89,
+    0x3d,0xe6,0xa4,0xcd,0xce,0x22,0xd6,0x31,0xf3,0xd2,
+    0xe6,0x27,0x63,0xb5,0x94,0x56,0x5f,0xec,0xdc,0x72,
+    0x7f,0xcb,0xeb,0x2c,0x5e,0x87,0x6d,0x72,0xe1,0x6b,
+    0x72,0x6c,0x45,0xce,0xb5,0xca,0x0d,0x32,0x47,0xf8,
+    0x44,0xe0,0xa7,0x89,0xfa,0x33,0x8d,0xa3,0x02,0xbd,
+    0x73,0xf7,0xee,0xdd,0x0d,0xdf,0x7d,0x07,0x77,0x8e,
+    0x35,0x7f,0xbd,0xf9,0xc6,0x4f,0xce,0x6c,0x4e,0x79,
+    0x9d,0x6e,0xc9,0x7f,0x37,0x5f,0xfc,0x13,0x9c,0xf2,
+    0x0f,0x42,0xfe,0x1c,0xea,0x34,0xd7,0x12,0x46,0x2f,
+    0x8a,0x4f,0x2c,0x7f,0x62,0x7b,0x6c,0xe4,0x50,0x2d,
+    0x49,0xa2,0x56,0x96,0xc6,0xb9,0x73,0xe9,0x1f,0x82,
+    0xf7,0xbf,0xf6,0x82,0x0f,0xef,0xd7,0x14,0x12,0x49,
+    0x5f,0xc3,0x11,0x38,0x84,0x65,0xe4,0x70,0xef,0x5b,
+    0xb2,0xba,0x7a,0x37,0xb4,0xbb,0x80,0x73,0x53,0xdb,
+    0x90,0x7c,0x44,0x78,0x90,0x42,0x8a,0xf7,0x86,0xc7,
+    0x41,0x24,0x3a,0x80,0xdc,0x9f,0xf2,0x82,0x48,0x78,
+    0xd5,0x35,0x6e,0x58,0xc7,0xe0,0xac,0x9d,0xfd,0xf4,
+    0xda,0xa9,0xed,0xc6,0xf6,0xeb,0x10,0x1d,0x1b,0xbd,
+    0x47,0xbc,0x34,0x22,0x7b,0x69,0xdf,0xcc,0xf6,0xbb,
+    0xfa,0xf7,0x34,0x24,0x76,0x9a,0x9e,0xe2,0xd4,0xeb,
+    0xef,0x9e,0x93,0xcc,0x51,0x3d,0x47,0x44,0x26,0xaa,
+    0x74,0xe0,0x61,0xc8,0x8f,0x4e,0xea,0xd0,0xaa,0x49,
+    0x50,0x77,0xbf,0x0e,0x25,0xbb,0x66,0x1b,0x83,0x33,
+    0x3a,0xce,0x5e,0x17,0x3d,0xa7,0xfb,0xa0,0x2e,0xa1,
+    0x69,0x23,0xdb,0x26,0xa5,0x84,0x27,0x4f,0xf6,0xee,
+    0xb7,0x74,0x62,0x37,0xf4,0x26,0xfe,0xee,0x3c,0xac,
+    0xbd,0x4b,0x5a,0xf1,0x80,0xf0,0x66,0xd1,0x8c,0x66,
+    0x88,0x54,0x36,0x12,0x42,0x95,0x57,0xa4,0xb1,0x97,
+    0x48,0x6e,0x4c,0xb8,0xaf,0x7c,0x86,0xcc,0xa4,0xe0,
+    0xe0,0xa4,0x10,0x98,0x91,0x14,0x82,0x27,0xe5,0x95,
+    0xb0,0x21,0xe1,0xe6,0x61,0xa1,0xa1,0xc3,0xcc,0xe1,
+    0x43,0x58,0x4c,0x2e,0xdd,0xfa,0x50,0xd5,0x81,0xcf,
+    0xf1,0xbd,0x99,0x0d,0x81,0x30,0x85,0xb3,0xab,0x8e,
+    0xaa,0x14,0x06,0x5f,0xb6,0x88,0x15,0xe9,0xab,0x30,
+    0x19,0x9c,0xa8,0xab,0xce,0x59,0x61,0x0e,0x8b,0xa5,
+    0x1a,0x13,0x8b,0x36,0x57,0x0b,0x9a,0x46,0x52,0x22,
+    0xa1,0xf7,0x05,0x18,0x7c,0x76,0xd2,0x39,0x9c,0xe6,
+    0x7f,0x22,0xde,0xfd,0xb0,0x60,0xea,0x05,0xf4,0xcc,
+    0xe9,0x6f,0xe2,0xd3,0x3f,0xf6,0x8c,0x3a,0x00,0xcd,
+    0xf7,0xcc,0xc3,0xf3,0x68,0x11,0x4e,0x5d,0xba,0x7d,
+    0x6c,0xe6,0xa4,0x90,0x8c,0xe1,0x33,0x57,0xcc,0x59,
+    0x98,0x91,0x37,0x56,0xf9,0xd9,0xe7,0xe2,0xf6,0xb3,
+    0x6b,0xc5,0xfb,0x9f,0x4c,0x98,0x7e,0x09,0xb4,0x10,
+    0x08,0x1e,0x1f,0x17,0x5f,0xc9,0xca,0xde,0xff,0xeb,
+    0x8c,0x77,0xc4,0x6b,0x3b,0xb3,0xf7,0xfd,0x0a,0xc2,
+    0xff,0x2a,0x3f,0x7a,0x08,0x7b,0x9e,0xb4,0xcd,0x0d,
+    0x7d,0x47,0x3c,0xbc,0x23,0x64,0x62,0x08,0xef,0xa3,
+    0xd6,0x82,0x2b,0xfc,0xa3,0x3c,0x8b,0x7a,0xe4,0x8d,
+    0x14,0xb3,0xd8,0xac,0xc9,0x3f,0x92,0xfb,0x2c,0xac,
+    0x03,0x70,0xdc,0x09,0x47,0xd3,0xaa,0x66,0x73,0x9d,
+    0x76,0x80,0xb3,0x1e,0x58,0x18,0x36,0x31,0xd9,0x53,
+    0x9d,0x7e,0x7e,0x68,0x8f,0x06,0xea,0xc0,0x3e,0x91,
+    0x49,0x83,0x26,0xce,0x1c,0x70,0xbb,0x4f,0x87,0xae,
+    0x1d,0xd3,0xba,0x2a,0xbe,0x4f,0x88,0x6b,0xd5,0x59,
+    0x13,0x9d,0x5f,0x24,0xc6,0xc4,0x78,0x85,0x9b,0xb3,
+    0x8e,0x65,0xd9,0xab,0xae,0x67,0x0e,0xef,0xd3,0x5a,
+    0x6d,0xdf,0x9a,0xe1,0x4a,0x26,0x73,0x84,0x2c,0x61,
+    0x9f,0x14,0xcb,0x06,0xc1,0x45,0x0d,0x11,0xa0,0x94,
+    0x4e,0xf0,0xed,0xcd,0x9b,0x63,0xc4,0xaf,0xc1,0x04,
+    0x7f,0x7e,0xfd,0x35,0xbf,0x10,0x8a,0xc4,0x1d,0xe2,
+    0xf6,0x76,0xb0,0xd0,0x03,0x16,0xc6,0xd4,0x5c,0xca,
+    0x6b,0x6e,0xb4,0x42,0xd0,0xf0,0x78,0x94,0x14,0x31,
+    0xa8,0x28,0xb1,0x7c,0x42,0xf7,0x3f,0x85,0x75,0x53,
+    0xc8,0x0b,0xd7,0xcf,0x14,0xb5,0xfa,0x88,0xc7,0x8f,
+    0xff,0xab,0x97,0xfc,0xcc,0x06,0xf4,0xa7,0xf5,0x6e,
+    0x7a,0xa3,0x20,0xc7,0x51,0xa2,0xa4,0xd5,0xa9,0x97,
+    0xea,0xaa,0xca,0x5b,0x3f,0x40,0xdb,0xd7,0xbc,0x63,
+    0x26,0xac,0x7b,0xfb,0x95,0xc5,0x8b,0xc3,0x02,0x9b,
+    0x74,0xea,0x9e,0x51,0xf0,0x52,0xbd,0xd5,0x5d,0xac,
+    0x78,0xab,0x7d,0xbb,0xbc,0x5b,0x30,0x42,0xdc,0x28,
+    0x38,0x8a,0xa7,0x1c,0x94,0xc9,0x09,0xfd,0x3b,0x31,
+    0x5b,0x65,0x7d,0xa2,0xd2,0x09,0x4b,0x55,0x0b,0xab,
+    0xe7,0xbb,0x4b,0x2b,0x73,0x84,0x55,0x2a,0xdd,0x78,
+    0xc6,0xe3,0x09,0xc2,0x20,0xfa,0x53,0x55,0xec,0x8b,
+    0xc5,0xde,0x35,0x2a,0x83,0x49,0xe3,0x27,0x5b,0x96,
+    0xf0,0x4b,0x83,0x41,0xf1,0xde,0x41,0xf1,0xef,0x03,
+    0x70,0x3a,0x6a,0x5b,0x7e,0xe1,0xa6,0x42,0xe5,0xb8,
+    0x81,0x6f,0x8b,0x7f,0xec,0xdf,0x07,0x0d,0xed,0xdb,
+    0x4c,0xd8,0x5e,0x58,0xb8,0x9b,0xad,0x07,0xb0,0xf8,
+    0x01,0x5f,0xd3,0x6c,0xf4,0xcc,0xaa,0x26,0x9f,0xa9,
+    0xd7,0xac,0x6c,0x82,0x91,0xaf,0x0f,0x54,0xaf,0x6f,
+    0x56,0xa4,0x70,0xfe,0x87,0xd1,0xee,0xb4,0x05,0xd2,
+    0xe0,0xc1,0xd6,0x7e,0x22,0x9d,0x23,0xa5,0x55,0x2c,
+    0x94,0x2b,0x3e,0x91,0x52,0xb3,0x78,0xb7,0x6b,0x58,
+    0xbb,0x07,0x71,0xf1,0xd1,0x69,0xc9,0x21,0xfa,0xec,
+    0x45,0x85,0xb3,0x5a,0x7b,0x4d,0xf4,0x4e,0x6d,0x04,
+    0x23,0x69,0xf7,0xd1,0xdd,0xc1,0xbd,0x38,0x39,0xba,
+    0x4b,0x5a,0x9b,0x66,0x85,0x33,0xf2,0xc7,0xf6,0x0f,
+    0x59,0xde,0x7c,0x84,0x73,0xb1,0x34,0xce,0x86,0xd1,
+    0xd6,0xb4,0xa5,0xb4,0xa6,0xe7,0x22,0x2f,0xde,0x55,
+    0x43,0x45,0xc3,0xcf,0x3e,0x65,0x6f,0x20,0xdc,0xd4,
+    0x12,0x76,0x75,0xe9,0xdd,0xaf,0x73,0x5c,0x4a,0x2f,
+    0xb7,0x80,0x9c,0xd9,0x79,0xb3,0xba,0xc5,0xef,0x5a,
+    0x57,0x31,0x64,0xf8,0xb8,0xd4,0x94,0x61,0x43,0xba,
+    0x29,0xe2,0x53,0xe6,0x75,0xe8,0xee,0x19,0x33,0x6c,
+    0xea,0x98,0x6e,0x59,0x8d,0x1d,0x02,0xf7,0x17,0x2e,
+    0x0e,0x9e,0xdc,0xb6,0x47,0x69,0x8a,0x34,0xce,0xb2,
+    0x98,0x81,0xa8,0xf2,0xe6,0x71,0x63,0x1c,0xb3,0xd5,
+    0x46,0x1c,0xe7,0xa2,0xa8,0xd8,0xec,0xed,0xee,0x43,
+    0xc2,0xb3,0x3c,0x55,0xde,0x2e,0x51,0xa7,0xda,0xb9,
+    0x75,0xde,0xd3,0x91,0xd1,0x34,0x1b,0x7d,0x60,0x0f,
+    0xf4,0x45,0xf4,0xd5,0xbe,0x1a,0xba,0xd9,0x52,0xb4,
+    0x52,0xab,0x91,0xbd,0x35,0x8f,0xa9,0x8e,0x76,0x0e,
+    0xde,0x85,0x53,0x5a,0x37,0xb7,0x5f,0xb3,0x66,0x65,
+    0x7e,0x66,0xf9,0x90,0xe8,0xde,0xfd,0x7d,0xc2,0x96,
+    0x2c,0x12,0x1f,0xa8,0xc2,0x2c,0x41,0xa2,0x85,0xbb,
+    0x6c,0x40,0x26,0x89,0x95,0x42,0x5b,0x79,0x2d,0x9a,
+    0x9b,0x6a,0x2d,0x0f,0x3b,0x38,0x9b,0xbd,0x85,0xb6,
+    0xe3,0xca,0x0a,0x8d,0x41,0x33,0x4a,0x96,0xac,0x02,
+    0x9c,0xff,0xa8,0xca,0x9f,0x8c,0x16,0xcc,0xce,0x8f,
+    0x29,0x25,0x56,0xb6,0x26,0x4c,0xd3,0x20,0x55,0x48,
+    0xe6,0x6b,0x6d,0x35,0x6b,0xc2,0x34,0x4d,0x5a,0x45,
+    0x02,0xe2,0x85,0x73,0xb3,0x59,0x52,0x5e,0x38,0xb0,
+    0xa1,0x55,0x0a,0x1c,0x87,0xfb,0x47,0x99,0xd5,0x6e,
+    0x30,0x6b,0xce,0xe4,0xf6,0x7e,0xad,0xc6,0x75,0x78,
+    0x23,0x71,0x6c,0xd0,0x46,0xf1,0xa7,0xcc,0x5c,0xa7,
+    0xac,0x86,0x91,0xa1,0xa3,0x3c,0x36,0x65,0xfa,0xb3,
+    0xba,0x49,0xb4,0x3b,0xb0,0xd8,0x3d,0xcf,0x18,0x41,
+    0x9f,0x1e,0xd9,0x81,0xf5,0xe0,0xad,0xc9,0x6a,0x43,
+    0x4c,0x5a,0xdc,0x93,0x6c,0xbc,0xfd,0xdd,0xdb,0xfd,
+    0x0d,0x21,0x71,0x29,0x27,0xb8,0x3d,0xe9,0x24,0xb8,
+    0xd2,0x58,0xb4,0x27,0x6a,0x86,0xcd,0xb9,0x3a,0xd9,
+    0x41,0x0e,0x68,0x74,0x9a,0xf7,0xfb,0xfc,0xb9,0x7f,
+    0xcf,0xb6,0x2c,0xe8,0xb0,0xbc,0x7d,0x47,0xa5,0xf3,
+    0xbb,0x07,0xc4,0x77,0xde,0x39,0x08,0x6b,0xfe,0x9a,
+    0x39,0x61,0x3c,0xb0,0xc4,0xad,0x67,0x6d,0x84,0x2b,
+    0xf8,0xbb,0x08,0x51,0x55,0xa7,0x6f,0xc5,0xaf,0xb2,
+    0xbf,0xfe,0x3a,0x9b,0xee,0x13,0xbf,0x1e,0x83,0xe6,
+    0x82,0x9a,0x3c,0xc4,0x89,0xed,0x60,0x20,0x0c,0x88,
+    0x11,0x27,0x56,0x5f,0xa2,0x8e,0x47,0x12,0xa2,0x4c,
+    0xe1,0xf1,0x3e,0x0d,0x8e,0x7d,0xde,0x9c,0xf2,0xc8,
+    0xa8,0x10,0xb5,0x44,0xbb,0x80,0xae,0xb0,0x3d,0x98,
+    0xf9,0xc0,0x6e,0x8c,0xf0,0xf6,0xc3,0x5b,0x2a,0x01,
+    0xca,0xa7,0xa8,0xc0,0xdd,0xa5,0x40,0x17,0xf7,0xef,
+    0x18,0xc5,0x4c,0xfa,0xcf,0x2c,0x71,0x25,0xf4,0x1b,
+    0x3f,0x7a,0xf4,0x64,0xf1,0x2d,0x48,0xa1,0xd4,0xbc,
+    0x87,0xb5,0xf3,0x6f,0x9d,0xbb,0x4b,0x9a,0x26,0xe5,
+    0xc4,0xd3,0xee,0xca,0x43,0x15,0x59,0xb4,0xaf,0xe5,
+    0xfd,0x9c,0x93,0x27,0x73,0xc0,0xbe,0xb0,0xc5,0x04,
+    0xf1,0x0a,0x6a,0x23,0xc3,0x5b,0xc8,0x79,0xe5,0x44,
+    0x5a,0xd4,0xe2,0x17,0xc3,0x09,0xcf,0x53,0x05,0x28,
+    0xaf,0x62,0xa6,0xcb,0x2c,0x86,0xd9,0xca,0x55,0x23,
+    0xb5,0xd7,0xb3,0xaa,0x51,0xcd,0x68,0x86,0xff,0x69,
+    0xe2,0x33,0x9a,0xd2,0x2f,0x54,0xd6,0x14,0x05,0x31,
+    0x23,0x1d,0x79,0xa8,0x27,0xde,0xc4,0x44,0x42,0x49,
+    0x14,0x8f,0x63,0x3d,0x47,0x49,0xaa,0x16,0xc1,0xfd,
+    0xcc,0x44,0x6d,0xac,0xc3,0x95,0xa2,0xf6,0xb9,0xb3,
+    0xf2,0x67,0x75,0xe7,0xaa,0x93,0x5e,0x90,0x96,0x32,
+    0x7c,0x48,0x37,0x49,0xa9,0x84,0xfc,0x59,0x96,0xd9,
+    0x93,0x67,0x82,0xb5,0x36,0x93,0x94,0xce,0x03,0x9f,
+    0x51,0xa9,0xd5,0xa9,0xa3,0x51,0xd5,0x06,0x56,0x84,
+    0x3f,0x80,0x66,0xcf,0x32,0x8c,0xcb,0x4b,0xa8,0x38,
+    0x96,0x66,0xa0,0xef,0xa7,0xe6,0xde,0x73,0x98,0x8e,
+    0x8f,0x38,0x2e,0x6c,0xc1,0x50,0xcd,0x2c,0x56,0x94,
+    0x9e,0x2f,0x03,0xc7,0x0a,0xed,0x00,0x4a,0x72,0x72,
+    0x42,0x5b,0xb7,0x19,0x6f,0xea,0x99,0x6c,0xdf,0x3c,
+    0x75,0xfb,0xa8,0xb8,0x49,0xe2,0xed,0x35,0x8d,0xe3,
+    0x16,0xb5,0x50,0x74,0xab,0x88,0x9d,0x1e,0x27,0x0e,
+    0x6e,0x9b,0x3b,0x6e,0x66,0xb1,0x4b,0xff,0xf3,0x39,
+    0xed,0xc7,0xf7,0x39,0xb8,0xad,0xf7,0x98,0xfc,0xe3,
+    0x05,0x03,0x83,0xe5,0xbc,0x4a,0x61,0xa1,0xba,0x08,
+    0xfb,0x45,0xc7,0xfd,0xbb,0x9a,0x38,0xa0,0x4b,0x9d,
+    0x85,0xb8,0xd7,0xab,0x03,0x83,0xa7,0x9e,0xb3,0x22,
+    0xa7,0x2e,0xaa,0x0a,0x18,0x8a,0x7d,0xeb,0x5f,0x9b,
+    0xab,0xc2,0xc7,0xd6,0xfa,0x9a,0xd9,0xda,0x10,0xa1,
+    0x0e,0x3a,0x7a,0x5b,0xb6,0x2a,0x27,0x9e,0x8b,0xad,
+    0xca,0xda,0x88,0xf1,0xf5,0x61,0xb3,0xc5,0xe7,0x44,
+    0xdc,0xb9,0x87,0x69,0x34,0x05,0x83,0x4a,0xcd,0xe2,
+    0x5d,0xac,0xa5,0xca,0xba,0x48,0xbf,0xec,0x1b,0xd0,
+    0x7a,0xe0,0xfc,0xe8,0x3e,0x4b,0xa3,0xd7,0xb9,0x16,
+    0x74,0x10,0x97,0x3d,0x07,0xb7,0xaa,0xa5,0x6f,0xfb,
+    0x8c,0xb2,0x30,0xd7,0x63,0x13,0x42,0xf7,0xa5,0x2e,
+    0x7c,0x51,0x5b,0x9b,0x71,0xce,0x36,0xe7,0x2b,0xe8,
+    0xfe,0x4c,0xc2,0x8d,0x2c,0xf2,0xe1,0x09,0x61,0x3c,
+    0xd7,0xa8,0x1e,0x0a,0x3a,0xf9,0x24,0x35,0xe9,0xe6,
+    0x17,0xe7,0x32,0xbc,0xc1,0x90,0x9e,0x2d,0x87,0xa6,
+    0xc4,0xfa,0x38,0x0e,0x77,0x18,0x2a,0x5e,0x7d,0x1e,
+    0x21,0x81,0x26,0xb7,0x76,0x53,0xc6,0x4f,0x8d,0x89,
+    0x89,0x89,0x1d,0x3f,0x75,0x7c,0xfd,0x7c,0x50,0xc8,
+    0xb4,0xf8,0x72,0xdf,0xad,0x31,0x31,0xb2,0xf5,0xf2,
+    0xda,0xfe,0x5b,0x5d,0xfe,0xff,0x6b,0xeb,0xd0,0xbd,
+    0xfb,0xbc,0x3e,0xf0,0xb5,0x71,0xf4,0xc4,0x8f,0xea,
+    0x41,0x2f,0xf3,0x41,0xf5,0x37,0x71,0xc6,0x51,0xcf,
+    0x97,0xc7,0x1f,0x25,0x85,0x73,0x76,0x91,0x10,0x46,
+    0x99,0x7c,0xe5,0x31,0xd8,0x45,0x90,0x70,0xff,0x3a,
+    0xe1,0xf8,0xe4,0x68,0xf3,0xd9,0x95,0x32,0xc2,0x96,
+    0x2d,0xb2,0xa0,0x6b,0xbb,0xac,0xf6,0x6d,0xc7,0xc4,
+    0xf9,0x0d,0xaa,0xc2,0xad,0x6a,0x39,0x38,0x2f,0xbf,
+    0x7f,0xfb,0xa1,0xee,0x95,0x97,0x2d,0xef,0x71,0xa4,
+    0x97,0x77,0x86,0x1d,0x68,0x17,0x9b,0x11,0xd3,0xae,
+    0x72,0x02,0xcc,0xae,0xc6,0xcf,0xd7,0x97,0x15,0x53,
+    0xf9,0xfa,0x88,0x2b,0xf3,0xad,0x8c,0x50,0xbd,0x44,
+    0x8a,0x47,0x84,0xd6,0xa8,0xa2,0x6a,0x08,0x58,0xbc,
+    0x09,0x8e,0xd3,0xe3,0xe2,0x70,0x98,0x2f,0x4e,0x86,
+    0xcd,0x96,0x33,0x5e,0x11,0xd3,0x3c,0x18,0x54,0xe5,
+    0xa1,0x65,0x7c,0xe1,0x74,0x29,0xdc,0x5a,0x49,0x0f,
+    0x1f,0x14,0x53,0xfa,0xf2,0xf1,0x36,0x13,0xc7,0x36,
+    0xb6,0xfe,0xcb,0x26,0x5c,0xd5,0xab,0xbe,0x8d,0x40,
+    0x0a,0x86,0x56,0x0f,0x22,0x26,0x39,0x7d,0x44,0x6d,
+    0xa2,0xdd,0xa5,0x65,0xe0,0x3e,0xf3,0xfd,0x36,0xb2,
+    0x51,0x25,0xa8,0xa0,0xc3,0x1b,0x09,0x07,0xcf,0x4b,
+    0x4b,0xc4,0xca,0xd8,0xaa,0x25,0xe1,0x70,0x48,0xf1,
+    0x5f,0x52,0x3d,0xce,0xac,0x6e,0x01,0xd3,0x21,0x0c,
+    0x32,0xf8,0xaa,0xb1,0x64,0x13,0xf8,0xba,0x2d,0xd7,
+    0x57,0xb7,0x5a,0xda,0x6a,0xbb,0xf0,0xfb,0x46,0xb5,
+    0x9e,0xe2,0xc4,0xdc,0x66,0x09,0xb8,0x46,0x3b,0x2d,
+    0x9f,0xd4,0x2c,0x06,0xd7,0xc0,0xb4,0xe7,0xfc,0xa9,
+    0xd6,0x48,0x17,0xdb,0xb5,0xe4,0x63,0xb2,0x2e,0x5e,
+    0xae,0x0d,0xb0,0x4a,0x01,0x2d,0x87,0xaa,0x01,0xd6,
+    0xc0,0x73,0xe2,0x51,0x92,0xda,0x1a,0x57,0x0b,0xe8,
+    0xa9,0x5a,0xba,0xa6,0xb5,0x05,0x5d,0x4b,0xbf,0xc4,
+    0xfb,0x36,0x6b,0xd7,0x82,0x0c,0x5f,0x92,0xe5,0x26,
+    0x75,0x25,0xd9,0x16,0xc5,0x0f,0xb6,0x32,0xfc,0x79,
+    0x2d,0xda,0x6b,0x09,0x6e,0x94,0x0d,0x3f,0xac,0x5f,
+    0x21,0xd5,0xc9,0x9c,0xc7,0xe8,0x6d,0x08,0x36,0x3c,
+    0x46,0xc7,0xc5,0xbf,0x9a,0xb7,0x30,0xb2,0xb4,0xb4,
+    0x86,0xa3,0xff,0x6e,0x92,0x78,0xb9,0x11,0x3f,0x5c,
+    0x38,0x2f,0x1b,0xd6,0xb2,0x6e,0x58,0x95,0xba,0xc8,
+    0x3c,0x6c,0xc2,0x2a,0x56,0x71,0xee,0xdf,0xa5,0x8c,
+    0x67,0xd6,0xdb,0x58,0x4f,0xc1,0x79,0xe6,0x5c,0x87,
+    0x67,0xbc,0xb2,0xa2,0x16,0xaf,0x3e,0x29,0x2d,0xad,
+    0xc5,0xa1,0x27,0x27,0x25,0xde,0x58,0xff,0xc6,0xda,
+    0xbf,0xcb,0xbc,0x71,0xa9,0x47,0xcb,0x11,0x94,0x9f,
+    0x2d,0x4f,0xec,0x91,0x16,0x5b,0x4e,0x3c,0x71,0x92,
+    0xda,0xd1,0x5c,0xce,0x4b,0x70,0x64,0xde,0x5b,0x55,
+    0x5e,0x02,0x9b,0x20,0xbb,0xb0,0x61,0xb0,0x26,0x3f,
+    0xe1,0x97,0xa7,0x2c,0x3f,0x21,0x37,0x77,0xfd,0x17,
+    0x5f,0x54,0xe5,0x28,0x2c,0xb3,0x84,0x8b,0x0b,0xe8,
+    0xfa,0xc5,0x54,0x69,0xa9,0x58,0x6c,0xf9,0xad,0x2a,
+    0x53,0x41,0x5a,0x83,0x7d,0xc8,0xed,0xa1,0xef,0x73,
+    0xac,0xa1,0xcb,0x33,0xcb,0xd9,0xf4,0xb3,0xfa,0x6c,
+    0xe1,0x97,0xb6,0x6b,0xdc,0xb5,0xed,0xdf,0x93,0xab,
+    0x75,0xd6,0xbc,0x05,0x69,0xcd,0x9b,0xf7,0xa7,0x0b,
+    0x8f,0xd1,0xd8,0xf4,0x68,0x9d,0x05,0x70,0x70,0xaa,
+    0xe9,0x60,0x9f,0xda,0x6b,0xe1,0x36,0x83,0xdb,0x98,
+    0x17,0xac,0x8a,0xd7,0xe0,0xb3,0xc7,0xbe,0x6c,0x52,
+    0x4b,0x0a,0xea,0xa0,0x13,0x3a,0xcb,0x32,0x31,0xe0,
+    0x59,0x5c,0xd5,0x43,0x5b,0xff,0x97,0xc2,0xe5,0x84,
+    0xfd,0x64,0xa8,0x3b,0xbe,0xd5,0x45,0x18,0x57,0x7b,
+    0x7c,0xfb,0xa3,0x36,0xde,0x5a,0x42,0x35,0xfe,0x85,
+    0x6b,0xff,0x55,0xb8,0x59,0x7f,0x36,0x63,0xf9,0x69,
+    0xf5,0xf6,0xa8,0xba,0x6e,0x8a,0xc1,0x81,0xfa,0xfa,
+    0xf4,0xe2,0x33,0x74,0xd4,0xea,0xd5,0xf4,0x17,0x11,
+    0xa2,0x90,0xe9,0x90,0x64,0xde,0x9d,0xef,0x3d,0x7c,
+    0x56,0xea,0xeb,0x76,0x73,0xad,0x68,0x45,0xdf,0x67,
+    0x98,0x5f,0xcb,0x34,0x7c,0xf5,0x02,0xe4,0x40,0x3a,
+    0x43,0x9a,0xd0,0x40,0x91,0xcc,0x66,0x83,0xf6,0x2c,
+    0x05,0x11,0x99,0x6f,0x0f,0x28,0x58,0x26,0xff,0x28,
+    0xd8,0x09,0x0e,0x03,0x0f,0x0f,0x01,0xad,0x22,0x4d,
+    0xfc,0x57,0x7c,0xdc,0xa3,0x01,0xb8,0x2e,0x79,0x65,
+    0x80,0xd0,0x0a,0x7c,0x12,0xcf,0x67,0x88,0x97,0x14,
+    0x5d,0xc1,0x5b,0xbc,0x15,0x6f,0x0f,0x61,0x6b,0x56,
+    0x27,0xca,0xfc,0xdc,0x2c,0x88,0x2a,0x47,0x94,0xd2,
+    0x26,0x72,0x34,0x8c,0x65,0x6d,0xa9,0xfd,0x23,0xa3,
+    0x4c,0x7c,0xa1,0x32,0xca,0x4d,0xcf,0xd6,0x2c,0x75,
+    0x7a,0x30,0x09,0x06,0x6d,0xb8,0x3f,0xb8,0x09,0x8b,
+    0xc6,0xfe,0xf2,0x4d,0x59,0x66,0xbf,0x5c,0xbf,0xee,
+    0xe3,0xe1,0xdc,0xda,0xbc,0xfe,0x34,0x47,0x0c,0x5b,
+    0x55,0x1a,0x04,0x27,0x12,0x66,0x82,0xc9,0x28,0x26,
+    0x74,0x52,0xfc,0x7d,0xcc,0xd2,0x56,0x9c,0x34,0x6c,
+    0x4f,0x58,0xd7,0x55,0xa7,0x21,0x9f,0x3e,0xcc,0x7b,
+    0x0b,0xcc,0x6b,0xc5,0xcf,0xc4,0x2f,0x1f,0x2d,0x16,
+    0x0a,0x73,0x2b,0xda,0xd1,0xec,0xcb,0x8b,0x2a,0xcb,
+    0x06,0x31,0xfd,0xe4,0x79,0x04,0x5c,0x4f,0x3c,0x6a,
+    0x6b,0xc9,0x33,0x49,0x05,0xc4,0x5a,0x33,0xc0,0x94,
+    0x55,0xe5,0x17,0xd8,0x68,0x47,0x9f,0x7a,0x32,0x0d,
+    0x6c,0xe1,0xdb,0xf3,0x75,0xdd,0x6a,0xad,0xa8,0x93,
+    0xb3,0xe0,0x23,0xeb,0x04,0x84,0xd4,0x00,0xaf,0x56,
+    0x87,0x4e,0xf5,0x01,0xaf,0x81,0xed,0xc4,0x73,0x15,
+    0x6b,0x69,0x81,0x57,0x1d,0x04,0xbe,0xb5,0x74,0xa0,
+    0xb0,0x0a,0x4b,0x2d,0xe1,0x5f,0x54,0x1f,0x1e,0x41,
+    0xc6,0x23,0xc9,0x9a,0x57,0x3d,0x51,0xb0,0x67,0x50,
+    0x41,0xbc,0xad,0x9c,0x41,0x58,0x75,0x83,0x6a,0x89,
+    0xd8,0x99,0xfa,0xdb,0xc4,0x73,0x15,0x64,0x3b,0x52,
+    0x7b,0x2c,0x91,0xf2,0x16,0xe8,0x06,0x99,0x51,0x9a,
+    0xea,0xfc,0x05,0xdb,0x71,0xc5,0x26,0x97,0xa1,0x26,
+    0x4f,0xc7,0x51,0xca,0xb1,0x63,0x73,0xcf,0x96,0xc0,
+    0x0c,0x6d,0x63,0x90,0xb2,0x5f,0x20,0x74,0xd4,0x97,
+    0xe7,0xaf,0x5d,0x1e,0xba,0x7e,0x7d,0xea,0xaa,0x59,
+    0x33,0x16,0x29,0x0e,0x7e,0x2e,0x76,0xbe,0x2f,0x9e,
+    0x40,0x7b,0x5e,0x60,0xd9,0xb1,0x0c,0xe2,0x96,0xc8,
+    0x6b,0x4e,0xd8,0xfe,0x7e,0x2a,0x2f,0x12,0x48,0x88,
+    0x19,0xa7,0x70,0xb1,0x60,0x70,0xd3,0x34,0x02,0x95,
+    0x8e,0x87,0x2d,0xf5,0x52,0xc4,0x92,0xf9,0x3e,0x2c,
+    0x21,0x26,0x22,0x9c,0x87,0x83,0x78,0xa8,0x78,0xbe,
+    0x60,0xbf,0x1b,0x3c,0x37,0x0c,0xb7,0xef,0x67,0x8c,
+    0x0d,0x4e,0x8c,0x87,0xcd,0xe2,0xdf,0x9d,0x06,0x6d,
+    0x4d,0x0b,0x4b,0x4d,0xe9,0x94,0xd7,0xc2,0x77,0x55,
+    0x5a,0x7f,0xc5,0xb0,0x88,0xb0,0xad,0xef,0xae,0x17,
+    0x1f,0x8f,0xb7,0xcf,0x19,0xdb,0x35,0x21,0x28,0x71,
+    0xc9,0xa0,0x75,0xfb,0x22,0x96,0xb6,0x1f,0x39,0xb0,
+    0x7d,0x46,0x9f,0x3e,0x73,0x13,0x0b,0xf3,0xa2,0x07,
+    0x84,0xef,0x99,0x3a,0xb1,0x62,0x20,0xd7,0x15,0x9e,
+    0x8b,0xc0,0x73,0x17,0x0c,0x6c,0x8f,0x83,0xed,0xbc,
+    0xe5,0xbf,0x12,0x13,0x36,0x54,0x4b,0x6f,0xf0,0x73,
+    0x53,0x14,0x6a,0x32,0x1f,0x2c,0x4b,0x5e,0x94,0xac,
+    0x50,0x8b,0x16,0x7b,0x94,0x88,0x80,0x5a,0x92,0xfd,
+    0x5f,0xa4,0xd0,0x7d,0x72,0x0f,0x8a,0x5f,0xbd,0x80,
+    0x94,0x6a,0x27,0x6b,0xf2,0x8b,0x48,0xa9,0xa2,0xc3,
+    0x07,0x75,0xc0,0x97,0x04,0xd7,0x19,0x0b,0xfe,0x9b,
+    0x98,0xc3,0xb5,0x87,0x06,0xdd,0x73,0x49,0x52,0x7c,
+    0x6d,0xeb,0x9c,0xbd,0xf9,0x62,0x06,0x49,0x74,0xdd,
+    0xc1,0x39,0xb7,0x0e,0xb9,0x13,0xf1,0x9c,0x71,0xe2,
+    0xbf,0xa9,0x0b,0xac,0x77,0x5a,0x94,0xf6,0x02,0x22,
+    0x6d,0x87,0x10,0xf1,0xd4,0x8b,0xa8,0x54,0x48,0xbc,
+    0x93,0x63,0xdb,0x7e,0x24,0xa4,0xae,0xe7,0xf4,0x9f,
+    0x04,0x7e,0x69,0xab,0xe9,0xe2,0xf5,0xe7,0xd2,0x55,
+    0x2b,0x34,0x6e,0xa9,0x78,0x21,0xf3,0x64,0xba,0x54,
+    0x45,0x36,0x74,0xc9,0xf9,0x03,0x55,0x53,0xa6,0xff,
+    0xa4,0xeb,0x22,0xce,0xa5,0x26,0x7c,0x38,0xbe,0x6a,
+    0x02,0x25,0x1e,0x7a,0xbe,0xa4,0x29,0xf3,0xf2,0x0f,
+    0xe5,0xe7,0x2c,0xe7,0x73,0x28,0xd1,0xef,0x25,0xe4,
+    0xfe,0xa1,0xe2,0x0b,0xc5,0x20,0x9c,0x4d,0xb6,0x60,
+    0xb9,0x52,0x3c,0x92,0xa2,0x8f,0x34,0xd4,0xa4,0xaa,
+    0xb0,0x65,0x75,0x1e,0x28,0x97,0xc9,0x32,0xfa,0x00,
+    0x4f,0x5e,0x51,0xd7,0xca,0x12,0x5a,0xb4,0xbf,0x4b,
+    0x7f,0x88,0xda,0x67,0xf9,0xc7,0xfe,0xd7,0x49,0x45,
+    0x79,0x4b,0x73,0xb7,0xb6,0x0a,0x5d,0x9e,0x39,0x75,
+    0x11,0x92,0x96,0x98,0x3c,0x5c,0xb0,0x4b,0x4f,0xdd,
+    0xe3,0xb2,0xde,0x27,0x7e,0x62,0x81,0x94,0x39,0xd4,
+    0x6b,0xf9,0x0a,0xb1,0xf2,0xce,0x18,0x71,0x58,0xd7,
+    0xb9,0xf1,0x85,0x63,0x8a,0xb2,0xf7,0x40,0x6b,0x46,
+    0xdd,0xd4,0x29,0xe2,0xce,0x0d,0x47,0xc4,0xdd,0x17,
+    0x19,0x89,0x45,0x13,0xcf,0xb2,0x3c,0xb1,0xfe,0xa2,
+    0x8e,0xe7,0xfa,0xb0,0xb1,0xb4,0x3a,0xc3,0xa7,0xce,
+    0x1c,0xcd,0x57,0x4e,0x02,0x82,0x4f,0x79,0xc6,0x4f,
+    0xda,0x10,0x69,0x82,0xc6,0xc2,0x7e,0x5d,0xc4,0xa7,
+    0x52,0x32,0x90,0x70,0x55,0xca,0xfe,0x69,0x29,0xd8,
+    0x4e,0xcf,0xca,0x12,0xe0,0x5b,0x9e,0x1a,0x84,0xbc,
+    0xe0,0x39,0x3b,0xdc,0x1e,0xf1,0xa8,0x9a,0xed,0xcc,
+    0xac,0xfe,0x04,0x9e,0x83,0x35,0x7e,0x66,0xf3,0xba,
+    0xa9,0x3c,0x35,0xf6,0xe7,0xc9,0x37,0xcf,0xc9,0xea,
+    0xa9,0xc1,0x69,0x8f,0xe3,0xb5,0xa1,0xd6,0x08,0x51,
+    0x3f,0x4a,0x7a,0x51,0xb6,0x36,0x91,0xf5,0x21,0xac,
+    0xb2,0x32,0x4f,0x3e,0xab,0x1f,0x61,0x0d,0x3e,0x27,
+    0xbe,0xb3,0xac,0xce,0x2c,0xe5,0x39,0x48,0x3f,0xa9,
+    0x65,0x55,0x1e,0xd6,0x45,0xad,0xf8,0xca,0xc6,0x9a,
+    0x3c,0x15,0x9f,0x97,0xc4,0xa4,0x90,0xf0,0xcb,0x3a,
+    0x6a,0xe0,0x3b,0x22,0x9e,0xf5,0xf3,0xea,0x27,0xe1,
+    0x27,0x5b,0xcd,0x6c,0x59,0x97,0x80,0x5a,0x1a,0xf9,
+    0x34,0xe9,0x39,0x04,0x50,0xeb,0xc7,0x2c,0xff,0x98,
+    0xf7,0x71,0xdd,0x79,0x61,0x9b,0x9a,0xee,0x1c,0x50,
+    0x5e,0x6e,0xd3,0x7d,0x7f,0xb0,0x2c,0x20,0x4a,0xc6,
+    0x61,0xdd,0x7b,0xbc,0xaf,0xea,0xcc,0x0b,0xe1,0x9e,
+    0xdc,0x2d,0x8e,0xac,0x62,0x75,0x37,0x7c,0x8b,0x15,
+    0xa9,0xf5,0x04,0x7b,0x5b,0x03,0xe7,0x79,0xfd,0xf3,
+    0x42,0xf8,0xb1,0x16,0x7b,0x3f,0x2e,0x2f,0xaf,0xc5,
+    0xce,0x0a,0x67,0x9e,0x84,0x24,0x58,0xaf,0x63,0xed,
+    0x2b,0x32,0xef,0x9e,0x33,0x2f,0x54,0xdb,0xb2,0xc9,
+    0xae,0xbc,0xbc,0x36,0x5b,0x86,0x4b,0xed,0x60,0xf9,
+    0x37,0xe1,0x2a,0x77,0x94,0x72,0x94,0x00,0x97,0x28,
+    0x96,0xe1,0xa9,0x57,0x13,0xbe,0x8f,0x80,0xf3,0x5e,
+    0x1f,0x16,0x65,0xe2,0x8b,0xb7,0x2e,0x3e,0x92,0x0b,
+    0x14,0x6e,0xfa,0x29,0x76,0x78,0xd2,0xda,0xe6,0xad,
+    0xdf,0x04,0xdd,0xf1,0x77,0xb7,0x7d,0xb4,0x6f,0xcb,
+    0xd2,0x64,0x95,0x10,0xb6,0xeb,0x78,0xeb,0xdd,0x91,
+    0xeb,0x6e,0x8c,0xbb,0x92,0x39,0x5e,0x79,0x74,0x48,
+    0x64,0xfc,0xb0,0xc6,0x83,0xc6,0x88,0x17,0x2c,0x8f,
+    0xc5,0x3f,0xc5,0x7b,0xa0,0x81,0x4f,0x01,0x26,0x81,
+    0xe5,0x54,0xf1,0xe0,0xac,0x10,0xcb,0x11,0x71,0xf9,
+    0xd6,0x93,0xc7,0xcf,0xac,0x3e,0xc6,0xf0,0xf3,0x1c,
+    0x22,0x3e,0x96,0x3c,0x37,0xa2,0x56,0x4f,0x6a,0x11,
+    0xed,0x53,0xef,0xe0,0x31,0xbc,0x56,0xc2,0x51,0xad,
+    0xf1,0x62,0x55,0x3d,0xd9,0x47,0xd2,0xde,0xca,0x87,
+    0x42,0x08,0x97,0x01,0x67,0xbe,0x86,0x53,0x23,0x05,
+    0xd4,0xb9,0x76,0x32,0xd2,0xf1,0x6a,0x89,0xc8,0x7a,
+    0x26,0x2d,0xc9,0xc6,0xb9,0xf0,0xaf,0x27,0x41,0xa9,
+    0x16,0x1e,0x96,0x57,0x5d,0xcb,0x5b,0x26,0xcf,0xa0,
+    0xa1,0x57,0xaa,0x5c,0x88,0x0e,0x75,0xd0,0x54,0x3b,
+    0x0e,0xae,0xf5,0xa0,0xa9,0xc1,0x21,0xef,0x93,0x78,
+    0x46,0xba,0xea,0x20,0xba,0x51,0x4b,0xd2,0x2c,0x33,
+    0x9e,0x41,0x57,0x4b,0xee,0xc4,0xae,0xf5,0x36,0x4c,
+    0xc6,0xc9,0xfb,0xaf,0xe9,0x73,0xa3,0x00,0x75,0x30,
+    0x77,0xac,0xaf,0xf7,0x2c,0x9f,0x3e,0x4b,0x40,0xed,
+    0x01,0x7f,0x70,0x3d,0x14,0x28,0x64,0xfc,0x92,0x1e,
+    0xe8,0x99,0x07,0xff,0xac,0x26,0x3c,0x8b,0xfc,0x9f,
+    0x5a,0xc3,0x7a,0xfb,0x67,0x70,0xd6,0x1e,0xcc,0x4b,
+    0xeb,0x6b,0xb4,0x40,0xba,0x13,0x8b,0x60,0xa7,0xd8,
+    0x4e,0x54,0x28,0x35,0x5a,0xe4,0x82,0xb4,0xbb,0x89,
+    0x2f,0x18,0x4a,0x4b,0x52,0x90,0x74,0x24,0x2c,0x00,
+    0x86,0xb1,0x05,0x43,0x71,0xcb,0x90,0x23,0x61,0xc2,
+    0xe1,0xdf,0x26,0xb6,0x8d,0x11,0x6f,0x4d,0xb5,0xfc,
+    0xfa,0xdb,0x84,0xb6,0xed,0x18,0x8c,0x34,0xeb,0x2c,
+    0xc1,0x8c,0x30,0xd8,0x5c,0xdb,0x8f,0x65,0x94,0xf1,
+    0x69,0x21,0xd7,0x38,0x54,0x42,0x35,0x9f,0x2a,0xba,
+    0xf0,0x04,0x02,0x67,0x17,0x93,0x80,0x7a,0x87,0x66,
+    0xc9,0x0d,0x1a,0xd9,0x25,0x8e,0xee,0xa3,0x19,0xf1,
+    0xc1,0x81,0xbc,0x5e,0xdd,0xb4,0x7d,0x07,0x0f,0x38,
+    0xb1,0x7f,0x4c,0x4e,0x6e,0xa6,0xc7,0x92,0xbd,0xa1,
+    0xc9,0xd9,0x63,0xc1,0x4d,0xbc,0x18,0x60,0x6a,0x54,
+    0x1a,0xb1,0xc3,0xbb,0x8c,0xfa,0x80,0x6f,0x97,0x95,
+    0xf6,0x2d,0x8f,0xae,0xb6,0xfc,0x21,0x7e,0x25,0xfc,
+    0x7c,0xed,0xab,0x79,0x53,0xc1,0x15,0x06,0xc7,0x55,
+    0x6e,0xba,0x75,0x6d,0xd1,0x20,0xcb,0xda,0x50,0xd4,
+    0x3d,0x9e,0x7b,0x25,0xfb,0xdc,0xb5,0x46,0xb8,0x7a,
+    0x13,0xb1,0x0e,0xd7,0x4c,0x12,0x87,0x3d,0x93,0x92,
+    0x65,0x6b,0x1e,0xeb,0xa4,0x67,0xd5,0xe0,0xb1,0x97,
+    0xf6,0x4b,0x57,0xc7,0x23,0xeb,0x45,0x53,0xbd,0x4a,
+    0xf0,0x77,0x1d,0x24,0x35,0xa6,0xb4,0xbe,0x1c,0xb0,
+    0x1a,0x3c,0x4e,0x5c,0x12,0x9f,0x89,0x53,0xd6,0x8f,
+    0xec,0x66,0x2d,0x1d,0x88,0x79,0x06,0xe5,0x33,0xa6,
+    0xb7,0x2e,0x56,0x41,0xc2,0x59,0xed,0x67,0xd6,0x99,
+    0x3f,0xd6,0x8f,0x16,0x88,0xad,0x10,0xfe,0xf3,0x0c,
+    0xd6,0x67,0xec,0x74,0xfd,0x6d,0xe5,0x79,0x61,0x9c,
+    0xa7,0xbe,0xb5,0x56,0x6e,0x9f,0x9b,0x23,0x46,0xe7,
+    0xc9,0x7c,0xfd,0xf0,0xf9,0xb9,0x62,0x35,0x2c,0xfe,
+    0xd7,0xeb,0x05,0x59,0x63,0xa4,0x2a,0xe7,0x52,0xa5,
+    0x43,0xf9,0x6f,0x5a,0x93,0xd3,0xcd,0xd3,0x2e,0x79,
+    0xd6,0xa5,0xd4,0x54,0x9e,0x73,0x09,0xcd,0xd4,0xea,
+    0x3e,0x10,0xb5,0x6d,0xfb,0xea,0x5e,0x33,0x4d,0xf6,
+    0x0d,0xd7,0x95,0x65,0xe6,0xa4,0x0f,0x1f,0x72,0x79,
+    0x14,0x28,0xba,0xac,0xde,0x25,0xde,0xb1,0xdc,0x12,
+    0xbf,0x4c,0xeb,0x39,0x5f,0x6c,0x60,0x47,0x2a,0xdd,
+    0x7e,0xb8,0x76,0x05,0x3e,0xbc,0xc8,0x53,0x2e,0x91,
+    0xb7,0xbc,0x8d,0x32,0x6f,0x03,0xea,0x6a,0xf6,0xf3,
+    0xdb,0xba,0xc3,0x96,0xbd,0xa7,0x9e,0xdf,0xde,0x5a,
+    0x9c,0xfe,0x77,0xf3,0xf3,0x9b,0x0c,0xe4,0x15,0x6c,
+    0xa5,0x17,0x0e,0x99,0x55,0xf9,0xb6,0x5e,0x38,0x30,
+    0x77,0xe1,0xfb,0x6f,0x1e,0x2b,0x8e,0x28,0x4f,0x49,
+    0xab,0x6d,0x2d,0xd0,0xc8,0xa8,0xe5,0x71,0xb3,0x3a,
+    0x64,0x5d,0xb5,0x9c,0xa0,0x35,0x29,0x8e,0x88,0x9d,
+    0xbd,0x26,0xb8,0xff,0xf5,0xaf,0xf8,0x97,0x39,0x19,
+    0xee,0x88,0xc3,0xf8,0xda,0xc4,0x16,0xcb,0xe6,0xb7,
+    0xb6,0x6e,0xdd,0xaf,0x77,0x6c,0x60,0x0f,0x30,0x99,
+    0xde,0x80,0x49,0x8e,0x4b,0xc5,0xc6,0x4b,0x2d,0x37,
+    0x14,0xaf,0x8b,0x3f,0x5a,0x96,0x8b,0x3f,0x80,0x62,
+    0x3b,0x54,0xd9,0x5a,0x65,0x38,0xfa,0xbf,0x7a,0x29,
+    0x3e,0xa7,0xf4,0xf1,0x57,0xf1,0x51,0xda,0xa0,0x8f,
+    0xac,0xeb,0x24,0xa9,0x23,0x78,0x96,0xaf,0xc6,0xa0,
+    0x70,0xbb,0x9a,0x3e,0xe8,0xa3,0xdd,0x27,0x8f,0x40,
+    0xc1,0x90,0x01,0x47,0x57,0xbf,0x65,0xf9,0x57,0xfd,
+    0x24,0x67,0xc2,0x38,0xca,0x3c,0xa5,0x0d,0x9f,0xe7,
+    0x8e,0x84,0x4d,0xba,0x4f,0x3f,0x45,0x03,0xe7,0x0b,
+    0x3e,0x1f,0x7f,0xcc,0x5d,0xf1,0xf4,0x84,0xb9,0xe8,
+    0x25,0x6d,0x3c,0x2c,0xee,0x2e,0xd4,0xc2,0xbe,0xab,
+    0x37,0xc5,0x44,0xa9,0xcf,0xf9,0x1e,0x19,0x75,0x11,
+    0x7a,0x3c,0x2d,0xab,0x64,0xce,0xe4,0x1f,0x61,0x66,
+    0x3e,0x03,0xbc,0x70,0xcf,0x0c,0xfd,0x34,0xa6,0xd0,
+    0x7d,0x5d,0x87,0xb9,0x7d,0xa2,0x16,0x96,0x74,0x12,
+    0x2b,0x9f,0xbb,0x81,0x46,0x5d,0xe4,0xd6,0xf3,0x40,
+    0xd8,0xec,0xfd,0x6e,0x21,0x6b,0x57,0x46,0x3f,0x51,
+    0xbd,0x70,0x3b,0x0d,0xdf,0xbf,0xf0,0x90,0x16,0xa1,
+    0x0e,0x34,0x64,0xab,0xc0,0xb5,0xe9,0x21,0xff,0x9d,
+    0x03,0x4b,0x8b,0x6c,0x89,0x4a,0x7c,0x71,0x46,0xac,
+    0xca,0xdb,0x86,0xb2,0xa7,0xb3,0x5e,0x26,0x3f,0x56,
+    0x90,0xe3,0x3d,0x55,0x71,0xcc,0xfa,0x7c,0x34,0x29,
+    0xee,0x73,0xa4,0x96,0xa3,0x56,0x13,0xfb,0xa9,0x1d,
+    0xc7,0xb7,0x09,0xff,0x60,0xdb,0xf9,0x5e,0x16,0xde,
+    0x17,0xfa,0x67,0xdb,0xee,0x52,0x93,0xc7,0x39,0xcd,
+    0xa6,0x89,0x33,0x6b,0xf6,0xb9,0xd4,0xe6,0x73,0x93,
+    0x9a,0x5d,0x2f,0xfc,0xdd,0x16,0x34,0x89,0xf3,0xf4,
+    0x45,0x70,0x93,0x6c,0xe0,0xb6,0xae,0xc9,0x15,0xad,
+    0xcd,0xa5,0xa1,0x35,0x99,0xa3,0xec,0x5d,0x00,0x3a,
+    0x41,0xcb,0xdf,0xd5,0x40,0xa0,0x26,0xe5,0x50,0xcd,
+    0x12,0xf5,0xa8,0x56,0x9e,0xbf,0x71,0xe3,0x68,0x8c,
+    0x88,0x82,0xe4,0x89,0xcb,0x87,0x0e,0x09,0xeb,0x18,
+    0x15,0x1f,0x4e,0xcf,0x9e,0x85,0x45,0xcb,0xba,0x26,
+    0x74,0x8a,0xe8,0x19,0xff,0xfa,0xeb,0x8a,0xe8,0xcb,
+    0xa7,0x5b,0x4c,0xf7,0xca,0x99,0xb3,0x62,0x86,0xf8,
+    0xa1,0xe5,0x95,0x13,0x47,0xb5,0x0b,0x9c,0xf3,0x4b,
+    0x84,0xd3,0xbd,0xc2,0x79,0x2e,0x4b,0x80,0xe2,0x2b,
+    0xa1,0x17,0xb7,0xff,0x75,0x3c,0xeb,0x5e,0xb5,0xec,
+    0x7c,0x2d,0xbb,0x4e,0x6a,0xd5,0x6d,0xf8,0x6c,0xab,
+    0x85,0x5e,0x36,0x6d,0xad,0xd5,0x40,0x5e,0x2f,0x5e,
+    0x71,0x53,0x08,0x57,0xde,0xe5,0x7b,0x35,0x7d,0xd8,
+    0x1c,0x42,0x72,0x79,0x68,0xd4,0x8f,0x4e,0x23,0xd4,
+    0x5d,0x16,0x25,0x38,0x66,0xa8,0xe6,0x2a,0x6e,0x82,
+    0x7d,0x62,0xa7,0x4e,0x89,0xd3,0x17,0x4b,0x31,0xb7,
+    0x39,0x4a,0x0a,0x31,0x7c,0xff,0x40,0xf5,0xec,0x7f,
+    0x4e,0xd8,0x80,0xa0,0x90,0xbe,0x66,0xe5,0xf6,0xd6,
+    0xad,0xc7,0xb4,0x69,0x43,0x28,0xe4,0x2a,0xbe,0x15,
+    0x9a,0xc8,0x71,0x02,0x96,0x0d,0x5e,0x3b,0x46,0x90,
+    0x5b,0x3b,0x06,0x50,0x6b,0xa2,0x2f,0xe1,0xf0,0x13,
+    0xa3,0x80,0x35,0x8d,0x45,0x07,0xd1,0x4e,0x9a,0x22,
+    0xa2,0x98,0x3e,0x20,0x6d,0x2a,0xb5,0x9b,0x17,0xe8,
+    0xa0,0x63,0xf0,0x1b,0x91,0xae,0xc1,0xa8,0xb3,0x01,
+    0x63,0x86,0xaa,0x8c,0x3d,0x5b,0x88,0x7d,0xbd,0x02,
+    0x22,0x93,0x02,0x4d,0x81,0x06,0xe7,0x0e,0x81,0xa3,
+    0x46,0xf6,0x32,0x36,0x8c,0xe0,0xed,0xd3,0x28,0x6e,
+    0x08,0xb9,0xdc,0xbf,0xab,0xdf,0xb7,0xa3,0x47,0xea,
+    0xf3,0xe5,0x6a,0xbb,0x6e,0x4c,0xae,0x1e,0x21,0x7f,
+    0xa7,0xf3,0xf1,0xca,0xc5,0x76,0xbc,0xf2,0xae,0x19,
+    0xb9,0x12,0x7d,0x37,0x74,0xee,0x1d,0x98,0xe5,0x0e,
+    0xdf,0x1a,0xd6,0x26,0xb1,0x0b,0x95,0xb7,0x73,0xc7,
+    0xc3,0x31,0xfa,0xb6,0xc7,0xa3,0x9d,0x63,0x0f,0xc6,
+    0xb3,0x33,0xce,0x9f,0xde,0xb7,0x5c,0x25,0xdd,0xac,
+    0xfb,0x89,0x92,0x71,0xdc,0x95,0xe5,0x50,0x84,0xbb,
+    0xf0,0xcf,0x6e,0xdd,0x12,0x12,0xf0,0xe8,0xb5,0x77,
+    0xaf,0x78,0x79,0xef,0x5e,0xf6,0x8a,0x43,0xf6,0x76,
+    0x45,0xc8,0x93,0x9f,0xd5,0x72,0xab,0x49,0x94,0xfc,
+    0x59,0x6f,0x9b,0x4f,0xb0,0xb9,0x16,0x0f,0x21,0x04,
+    0x58,0xce,0x3e,0xc6,0xe2,0x87,0x38,0x05,0x3f,0xa8,
+    0x56,0x82,0xca,0xfe,0x18,0x64,0x0e,0x5b,0x10,0x0f,
+    0x21,0x6c,0x89,0x0e,0x7b,0xd6,0x43,0x12,0x5c,0x35,
+    0x6a,0x87,0x44,0x0d,0x10,0xac,0x35,0x46,0xcc,0x84,
+    0xb5,0xfb,0xa5,0xea,0x33,0x52,0x44,0x91,0x57,0xc5,
+    0xba,0x47,0xb1,0x6e,0x4f,0x5e,0xb7,0x21,0xdf,0xb7,
+    0x24,0xd5,0x65,0xb9,0x28,0xc6,0xea,0xfa,0x4a,0x56,
+    0x7f,0x6b,0xca,0xd6,0x1a,0x00,0x3f,0xff,0x2c,0x81,
+    0x00,0xeb,0x11,0x2b,0x7b,0x97,0x00,0xab,0x4f,0xd4,
+    0xd2,0xd3,0xd2,0x23,0x6c,0x4e,0xab,0xc3,0x7b,0xbf,
+    0x56,0xf1,0x47,0x6d,0xd3,0xb6,0xed,0x55,0x4d,0xeb,
+    0x55,0xd5,0x06,0xab,0x1b,0xf2,0xf2,0x7f,0xd5,0xfc,
+    0xa9,0xf5,0xb4,0xc0,0x3f,0xb7,0x56,0xd5,0x19,0x5e,
+    0x55,0x4f,0xe6,0x2d,0x58,0xc3,0xad,0x6d,0xc8,0x45,
+    0xeb,0x12,0x66,0xe5,0xf4,0xd8,0xea,0x8b,0xac,0xa9,
+    0x1f,0x4b,0x39,0x65,0xd6,0x60,0x31,0x85,0x7c,0x8a,
+    0xf7,0x50,0xbe,0xf5,0x72,0xab,0x3e,0xe5,0x4d,0xf9,
+    0x18,0xdb,0xc0,0xe8,0x57,0xce,0x26,0x5d,0x55,0xc1,
+    0x8c,0x7e,0xa1,0x9a,0x7e,0x55,0xb0,0xd4,0xb6,0xe7,
+    0xde,0x13,0xac,0xb9,0xc8,0xb7,0x84,0x67,0xe9,0xd5,
+    0xdb,0x7c,0xf6,0xc0,0x67,0x1f,0xe0,0xf1,0x50,0x22,
+    0xb7,0x6c,0xef,0xde,0x72,0x89,0xe7,0x60,0x7d,0x9f,
+    0x16,0x91,0x6e,0x82,0x81,0xc1,0xd5,0x56,0xc9,0x8b,
+    0x60,0x60,0x77,0xc1,0x7a,0x41,0x14,0x48,0xb8,0x75,
+    0x24,0x6b,0x0b,0xdb,0xf9,0x13,0x9e,0x95,0x25,0x0a,
+    0x30,0x5c,0xd2,0xa3,0xb6,0x8a,0x12,0x78,0xa4,0xb4,
+    0xaf,0x9d,0x5f,0xa9,0x28,0x59,0xc1,0x61,0x22,0xad,
+    0xdd,0x24,0x5a,0xab,0x61,0x72,0x52,0xf9,0xbd,0x3c,
+    0xbc,0xd7,0xa4,0xf6,0xbd,0x26,0xd2,0xbd,0x70,0xb1,
+    0x17,0xf2,0x6e,0xa3,0x2d,0x7f,0x2e,0x6e,0x19,0xb2,
+    0x1e,0xf9,0xf3,0xe0,0xc1,0x28,0xc4,0x19,0xcf,0x73,
+    0x99,0x1d,0xe4,0xfc,0x76,0xf6,0xb2,0x10,0x37,0x67,
+    0xbd,0x11,0x9c,0x80,0xef,0x71,0x8a,0x42,0x9b,0x64,
+    0x76,0x61,0xaf,0xb1,0xd1,0x0a,0x8d,0x1a,0x38,0x9b,
+    0x26,0x19,0xe7,0x7a,0xec,0x11,0x6f,0x44,0x35,0x5f,
+    0xdd,0xbf,0x79,0xcc,0x99,0xdd,0x1f,0x66,0x47,0x37,
+    0x57,0x3a,0x88,0xad,0x62,0x86,0x46,0x15,0x85,0xa7,
+    0x8a,0x97,0xdb,0xd1,0x8b,0xcd,0x5f,0x9d,0x80,0xbe,
+    0xc6,0xd9,0x6b,0x19,0xad,0x9a,0xc2,0x09,0xb1,0xf1,
+    0x4f,0xbe,0xf3,0x4a,0x00,0x79,0x4d,0x58,0x22,0xaf,
+    0x83,0xd2,0x93,0xef,0xa0,0x8d,0x0c,0xf3,0x14,0x58,
+    0x02,0x38,0xcb,0x7d,0x0c,0x67,0x6a,0xde,0x08,0x86,
+    0x8c,0xfd,0x7c,0x66,0x72,0x90,0x26,0xd3,0x92,0x06,
+    0x6f,0x0d,0x6e,0xd5,0x69,0x5a,0x62,0x13,0xa5,0x73,
+    0x03,0xdf,0xd8,0xcc,0x71,0xc9,0x95,0xf7,0x67,0xcc,
+    0x10,0xf4,0xe7,0x9a,0xeb,0x1c,0x18,0x5b,0xc8,0x00,
+    0xeb,0x3f,0xb4,0x0d,0xc2,0xf1,0x41,0xdf,0xc8,0xdf,
+    0xc8,0x12,0xbd,0x98,0x3d,0x8f,0x92,0xbd,0x5d,0x9e,
+    0x05,0x16,0x21,0xc1,0x87,0x8f,0x5c,0x1d,0x1c,0x68,
+    0x63,0xd7,0x96,0xfa,0xb8,0x2e,0x7e,0x26,0x97,0xd0,
+    0x46,0x73,0x8b,0xa2,0xd3,0x4c,0x5d,0x3a,0xcd,0xce,
+    0x6c,0xe3,0xed,0x70,0xde,0x53,0xd5,0xa6,0x69,0x70,
+    0x03,0x83,0xc3,0x0a,0xc1,0xee,0xd8,0x09,0x38,0x5a,
+    0x38,0xc6,0x65,0x9e,0xb3,0x7f,0xbb,0x74,0x9c,0xb4,
+    0x74,0xac,0xda,0xab,0x41,0x4f,0x2b,0x79,0xb4,0x06,
+    0x5c,0xf9,0xce,0x98,0xf0,0xc8,0x28,0xf4,0xfe,0xbc,
+    0x23,0xe8,0xe9,0xd3,0x65,0xcd,0x74,0x01,0x3e,0x4e,
+    0xa2,0x41,0xe9,0x50,0x9c,0x70,0xb5,0x72,0xae,0x30,
+    0xbd,0x4d,0x7a,0xb3,0xb6,0x5a,0xbb,0x99,0x72,0x8c,
+    0x21,0x06,0xe9,0x93,0x62,0x2e,0xf2,0x56,0xb1,0x20,
+    0xca,0xa8,0xe2,0x21,0x97,0xa3,0x5f,0xbe,0xb9,0xa6,
+    0x71,0x6c,0xbf,0x03,0xc7,0xde,0x70,0x2c,0x2f,0x57,
+    0x7a,0xee,0xfa,0xa6,0x72,0xb4,0x50,0x9e,0x92,0x19,
+    0xad,0x6b,0x32,0xab,0xe9,0xd3,0xef,0x85,0x10,0x79,
+    0x6f,0x0e,0x34,0x43,0xdc,0x55,0xfe,0x5f,0xb3,0xb2,
+    0x32,0xfc,0x06,0x64,0x16,0x96,0x57,0xd3,0x84,0xb6,
+    0x4c,0x22,0xcb,0x39,0xca,0x18,0x01,0xa7,0xc3,0xba,
+    0xa8,0x85,0xb2,0x5e,0x9d,0xde,0x57,0x3a,0x94,0x44,
+    0x5d,0x3e,0xde,0x5e,0x67,0x59,0x40,0x5b,0x5e,0x86,
+    0x88,0x01,0x33,0xe5,0xbd,0x53,0x8c,0x26,0x17,0xb6,
+    0xee,0x82,0xa6,0xb4,0x6a,0x8b,0x16,0xa7,0x4b,0x3b,
+    0x5f,0x31,0xc8,0x90,0xdd,0x43,0x22,0x6b,0x46,0x7f,
+    0x25,0x6d,0x28,0x34,0xa8,0xa1,0xca,0xb1,0x22,0x5f,
+    0x92,0x4d,0xf6,0x0e,0x95,0x64,0x84,0xc1,0xc6,0xd4,
+    0x30,0xbd,0x9b,0x56,0xc3,0xf9,0x6e,0x6a,0x0c,0x66,
+    0xad,0x46,0xcf,0x0d,0x74,0xa4,0x56,0x83,0x4e,0x19,
+    0x6b,0x28,0x7c,0x3f,0x35,0x75,0xe3,0xa6,0x41,0xd3,
+    0xa6,0x0f,0xda,0xbc,0xbe,0x83,0x21,0x69,0x78,0xa2,
+    0x57,0x87,0x0e,0x5e,0x49,0x7d,0x82,0xc3,0x95,0x9e,
+    0x69,0x5b,0xc4,0xc1,0x62,0xfa,0xa6,0x41,0x83,0x36,
+    0xc3,0x46,0x3a,0xd7,0x32,0x55,0x3c,0x3f,0xb1,0x4d,
+    0x58,0x58,0x9b,0x12,0xf4,0x4c,0x42,0x27,0xb7,0x09,
+    0x73,0x98,0xe5,0xc8,0xc6,0x2c,0xb8,0x02,0x1e,0xd8,
+    0x4e,0x25,0x7f,0xff,0x14,0xe3,0x80,0x47,0xae,0xe0,
+    0x5f,0x46,0xc7,0xad,0x53,0x08,0xd1,0x78,0xbf,0x15,
+    0xfa,0xea,0x7d,0x39,0x8f,0xb9,0x2c,0x81,0xbe,0x2a,
+    0x5e,0xa3,0x6e,0x95,0xf9,0xe6,0x8c,0xde,0x8d,0x83,
+    0xd6,0x7c,0x35,0x68,0xb0,0xa2,0xd2,0xa7,0x5d,0x56,
+    0xd2,0x82,0x4b,0x15,0xb1,0x8a,0xd3,0x70,0x92,0x05,
+    0x7c,0x48,0x2b,0xf4,0xe1,0x58,0x3d,0xcf,0xea,0x7a,
+    0xcd,0x40,0xe7,0x24,0xf8,0x30,0xb7,0x31,0x8c,0x6d,
+    0x5d,0x6b,0x07,0x36,0x40,0x34,0xa1,0x3d,0xe6,0x1d,
+    0x4f,0xeb,0x91,0x98,0x98,0xd8,0xca,0x53,0xe5,0x78,
+    0xbd,0x77,0x66,0x15,0xc4,0x8f,0x53,0x96,0x95,0x8e,
+    0x89,0x6f,0xba,0xd0,0x43,0x1d,0xd8,0x23,0x35,0xbc,
+    0x4f,0xe2,0xc7,0x70,0xd2,0x9f,0xf3,0x28,0x10,0x65,
+    0x66,0x96,0xaa,0xa9,0xf4,0x36,0x06,0x57,0x15,0x55,
+    0xab,0x04,0x63,0xa4,0x33,0xcb,0x85,0x31,0x7f,0x08,
+    0xc7,0x9b,0xe5,0xb8,0x37,0x4e,0x28,0xb5,0xef,0xee,
+    0xb0,0x5d,0x8c,0x2d,0x53,0x3a,0xcd,0x1f,0x2f,0x26,
+    0x8c,0x58,0x20,0xae,0x08,0x87,0xd9,0x6d,0xe8,0x1a,
+    0x78,0xcd,0x46,0x76,0x78,0x8e,0xb1,0x59,0x1b,0x69,
+    0xf0,0xa4,0xae,0x5a,0xff,0xaa,0x6e,0xda,0x02,0x8e,
+    0xcb,0x07,0x1a,0xca,0x5d,0x62,0xfa,0x2d,0xef,0xa5,
+    0x54,0xeb,0x7d,0x06,0x2d,0x2d,0xaa,0x1c,0x36,0x43,
+    0xf0,0xe9,0x33,0x2c,0x5a,0xe3,0x50,0xf1,0x50,0xda,
+    0x5f,0x23,0xf8,0x62,0xfd,0x96,0x6c,0x6e,0xe8,0x29,
+    0x30,0xb6,0x78,0x47,0x98,0x99,0x8a,0xf9,0xb3,0xc9,
+    0x91,0xaa,0x11,0x08,0x46,0x97,0x58,0x08,0x52,0x44,
+    0x30,0x3f,0xc5,0x1c,0x4b,0xe1,0xb7,0xcc,0x94,0x08,
+    0x7f,0x9d,0xca,0x4e,0x9c,0x77,0xd7,0xc5,0xdd,0xdf,
+    0x3d,0xb9,0x97,0x7b,0x88,0x56,0xdd,0xaf,0xbc,0x87,
+    0x03,0xd8,0x39,0x3a,0x3b,0x38,0x97,0xa9,0x7c,0x54,
+    0xf6,0xf6,0x51,0x51,0x4a,0x4f,0xef,0xb0,0xde,0x89,
+    0x11,0x29,0x19,0x95,0xc7,0x66,0xd0,0x33,0xfb,0xdb,
+    0x76,0x77,0x6d,0x18,0x68,0x68,0x1f,0xe1,0x56,0xd9,
+    0x4e,0xe8,0x53,0xd4,0xa3,0x6d,0x70,0x8c,0x57,0x30,
+    0x34,0xca,0x69,0xe2,0xd6,0xb1,0x95,0xb4,0x4f,0x56,
+    0xd4,0x81,0x2f,0xf6,0x1f,0xcb,0x6d,0xe5,0x3b,0x25,
+    0x83,0xd9,0x82,0x30,0xf8,0x96,0x7b,0x34,0x6c,0xb8,
+    0x46,0xe7,0x25,0xe4,0x3d,0xdd,0xae,0x1c,0x38,0xe2,
+    0x62,0x64,0x64,0xe7,0xbf,0xf8,0xf3,0xac,0x73,0xee,
+    0x23,0xdd,0x1e,0xb2,0x6d,0x60,0x84,0xeb,0x90,0x5a,
+    0xb4,0x0f,0x4c,0xa7,0xb9,0x23,0x30,0xa8,0xfb,0xe8,
+    0xb4,0xd6,0xcd,0xf5,0x6a,0x7b,0x57,0x07,0x47,0x31,
+    0x1b,0x9c,0xdd,0xdd,0x9b,0xf5,0xf3,0xed,0xa2,0x6c,
+    0xa8,0x75,0xf5,0x69,0xdb,0x26,0xb0,0x7d,0xae,0xe5,
+    0x68,0xd2,0xee,0xe0,0xe0,0x19,0xa9,0xb3,0xe9,0x82,
+    0xd4,0xd0,0x36,0x5a,0x52,0x15,0x6f,0x4c,0xe0,0x36,
+    0xc7,0x24,0x49,0xad,0xde,0x4d,0xc3,0xd4,0x86,0x09,
+    0x2e,0x8d,0xd0,0x44,0xa1,0xa8,0x3a,0x81,0xc6,0x93,
+    0x56,0x0b,0xaf,0x51,0x0d,0x17,0xa7,0x0f,0x1a,0xe5,
+    0xaf,0x6b,0xd1,0x39,0x74,0xd0,0xf4,0x0d,0x59,0x91,
+    0xed,0x56,0xce,0xfc,0x54,0xd5,0xda,0x3b,0x2e,0x11,
+    0x65,0xb8,0xe3,0xc0,0x66,0x71,0x26,0x14,0x9f,0x41,
+    0xa3,0xae,0x15,0x89,0xb7,0xef,0x95,0x86,0x0e,0x5a,
+    0x9e,0x08,0x0e,0x07,0xa1,0xc7,0x09,0xf5,0x2c,0x97,
+    0x9b,0x4f,0xc5,0xd7,0xaf,0x17,0x87,0x86,0xb6,0x99,
+    0x04,0x61,0x30,0x74,0xbc,0x5f,0x33,0x25,0xdb,0x8f,
+    0x6d,0x3d,0x2f,0xa4,0x29,0x79,0xb6,0x15,0xb8,0xa0,
+    0x20,0xe0,0x7f,0xb3,0xc0,0x4c,0x2c,0xfb,0x17,0xc1,
+    0x4c,0x2b,0x0c,0x18,0x32,0x64,0x88,0xab,0x83,0xaf,
+    0x7d,0x79,0x94,0x9b,0x47,0xec,0xae,0xde,0x63,0x3b,
+    0x9f,0xf9,0x28,0xc6,0x5a,0x4e,0x4f,0x5b,0xee,0xb7,
+    0x03,0xd5,0xd5,0x74,0x98,0x97,0x6e,0x39,0xfb,0x7d,
+    0xc6,0xff,0x86,0xb7,0x72,0x6e,0x60,0x9c,0x69,0x70,
+    0x52,0x2c,0x97,0xf6,0x24,0xe9,0x84,0x60,0x6c,0x57,
+    0x33,0xe9,0xcd,0x3a,0xcc,0xc3,0x75,0x93,0x75,0x80,
+    0x69,0x20,0x42,0x77,0xd5,0xe8,0xd1,0xeb,0xf5,0x81,
+    0xf5,0x6b,0xde,0x39,0xb7,0x01,0x5b,0x64,0x72,0x2d,
+    0xef,0x64,0x48,0xca,0xee,0xab,0x6f,0x75,0x52,0xa5,
+    0x69,0x0a,0x70,0xf0,0x0b,0xd8,0xf4,0x2f,0x6b,0xc8,
+    0x8a,0x8a,0x57,0x15,0xe3,0x20,0x6c,0x52,0xeb,0xd0,
+    0x4e,0xe6,0x8c,0x91,0xe2,0x2d,0x47,0x3a,0x51,0xde,
+    0x7b,0x85,0xbc,0x63,0x38,0x58,0xa4,0xbc,0x1a,0x85,
+    0xcc,0xbd,0x60,0x88,0xe0,0xef,0x7f,0xa9,0x42,0xc6,
+    0x16,0x70,0xd5,0xfe,0x4f,0x76,0x22,0xaa,0x81,0x19,
+    0x7e,0xae,0x2d,0xbb,0x99,0x87,0xcc,0x98,0x30,0xca,
+    0x30,0x6f,0xfc,0x4f,0x1d,0xbc,0xba,0x67,0xf7,0xd3,
+    0xb7,0x1a,0x90,0xe5,0xd6,0xc4,0x15,0x4d,0x1f,0x94,
+    0xfd,0x33,0x28,0xe3,0x4b,0xc6,0xbd,0xd5,0xa1,0x83,
+    0x9d,0x95,0xf3,0xdc,0xd9,0x1b,0x74,0x26,0xb4,0x0e,
+    0x8d,0x0f,0xcf,0x1a,0xf1,0x6a,0xb9,0x82,0x96,0x48,
+    0x6f,0x97,0x16,0x50,0xbf,0xcb,0x91,0x6f,0x1a,0x69,
+    0xcf,0x2d,0x22,0xc5,0xa6,0xe1,0x38,0xc4,0x86,0x21,
+    0x5a,0x1e,0x63,0x98,0x3e,0x60,0xfd,0xc7,0xdb,0x8f,
+    0xf5,0xec,0x81,0x43,0x4f,0xeb,0xf9,0xb9,0x6d,0x7a,
+    0x35,0xac,0x1c,0xa4,0xf0,0xa0,0xb7,0x2c,0x2d,0x9a,
+    0xcc,0x2e,0x82,0xb3,0x12,0xfd,0x6d,0x50,0x17,0x94,
+    0x4a,0x1e,0x33,0x6b,0x01,0x11,0xde,0x7a,0x01,0x2d,
+    0x4c,0x24,0x4e,0x80,0xd4,0xa8,0x96,0x2e,0xf4,0x17,
+    0x4b,0x0a,0xa4,0xed,0x3b,0x24,0xee,0xdf,0x04,0x9a,
+    0xc4,0xa6,0xcd,0xca,0x5d,0xdd,0x92,0x87,0x9f,0x9c,
+    0xa1,0x80,0x0c,0x21,0xc0,0x92,0x9a,0x02,0x41,0x10,
+    0x78,0xe3,0x67,0xf1,0xf1,0x50,0x31,0x9f,0xcb,0xd1,
+    0x52,0xe4,0xf7,0x00,0xa5,0x83,0xf4,0x0e,0x3e,0x3f,
+    0x1c,0x44,0xc3,0x63,0x15,0xac,0x33,0xd9,0xfc,0x44,
+    0x70,0x42,0x0e,0xb0,0x20,0x3e,0x8d,0x5e,0xed,0x64,
+    0xaf,0x6d,0xa0,0x57,0x35,0x99,0x64,0xb6,0x5c,0xa1,
+    0xe7,0x77,0x08,0x4d,0x1d,0x3c,0x1c,0x5d,0x1c,0x90,
+    0xc8,0x5f,0xcb,0xca,0xdc,0xdc,0xdc,0x02,0x7a,0x86,
+    0x76,0x0b,0xed,0xe7,0x3e,0x14,0xce,0x1f,0x9e,0x59,
+    0x60,0xd9,0xe0,0x38,0xda,0x77,0x78,0xab,0x94,0x10,
+    0xaf,0x70,0xcb,0x35,0xc5,0x4f,0x12,0xcd,0xd8,0x9f,
+    0x34,0x59,0xb6,0x6b,0xb5,0x46,0x8e,0xbb,0x5f,0x94,
+    0x97,0x3b,0x47,0xa4,0x2c,0x2c,0x29,0x56,0x7a,0x6e,
+    0xfb,0x8e,0xd9,0xe6,0xd4,0xe1,0xed,0x74,0x0d,0x66,
+    0x37,0x90,0xea,0xb5,0x27,0x44,0x11,0x80,0xf4,0xf1,
+    0x1d,0xe5,0x9c,0x4f,0x51,0x2e,0x92,0xa0,0xb1,0x74,
+    0x7e,0x67,0xf6,0x85,0xaa,0x9d,0x28,0x64,0x1f,0x1f,
+    0xbb,0xb2,0x6d,0x66,0x7a,0xa3,0x66,0xaf,0x36,0xd3,
+    0x04,0x26,0x7e,0xd1,0x24,0x72,0xf9,0xed,0x19,0x9a,
+    0xf0,0xe5,0xe1,0x9e,0x3b,0xcd,0xd3,0xf7,0x29,0x1d,
+    0x2c,0x6d,0xfc,0xf6,0xbc,0x09,0xdd,0xc5,0xf7,0xf6,
+    0x65,0x1e,0x30,0x8b,0xef,0xaf,0x03,0xc7,0xfd,0xd4,
+    0x6c,0xb9,0x20,0xbe,0xf5,0x61,0x4c,0x2a,0x9b,0xf4,
+    0x12,0x57,0xeb,0x53,0x21,0x04,0xe9,0x63,0x6b,0x54,
+    0x4c,0x67,0xf8,0x30,0x6b,0x64,0x0a,0x8a,0xf6,0xc9,
+    0x76,0x5e,0xa5,0x52,0x77,0x11,0xfa,0xb4,0x28,0xfa,
+    0x7e,0x41,0x72,0x90,0x53,0xd9,0x88,0xe0,0xd9,0xbd,
+    0x93,0x8b,0xfd,0xa2,0x43,0x94,0xad,0x4c,0x8d,0xdb,
+    0x29,0xac,0x0d,0x94,0x4e,0x81,0x9d,0xc7,0x8e,0x8e,
+    0xaf,0x1c,0x23,0x94,0xe2,0xb0,0xae,0xac,0x3c,0xf7,
+    0xd9,0xfa,0x86,0x73,0xed,0xe3,0xe2,0x84,0x85,0x82,
+    0x1d,0x6f,0x8f,0x51,0x68,0x01,0x6d,0xb0,0x3d,0x6c,
+    0x9f,0x80,0x9e,0x35,0xc3,0xc8,0xd6,0xc3,0x5b,0x35,
+    0xb4,0xf3,0x0c,0xec,0x9f,0xeb,0xee,0x6f,0x52,0x3a,
+    0xb8,0x7a,0x0d,0x9e,0x77,0x3e,0xf5,0xe0,0xd7,0xd2,
+    0xdc,0x1c,0x9f,0xa7,0xaf,0xf0,0xe7,0x9d,0x6d,0x6b,
+    0x28,0x99,0xf9,0x45,0x0f,0xc6,0x6c,0x53,0x15,0xac,
+    0xa1,0x93,0xf2,0xa2,0x14,0x8d,0xb5,0xdb,0x6b,0x80,
+    0xb8,0xbe,0x27,0xfe,0x72,0xcb,0x65,0xda,0x78,0x8e,
+    0xbb,0x27,0xdc,0x17,0xb6,0xd0,0xac,0xea,0x3d,0x20,
+    0x5b,0x2a,0xf7,0x0a,0xa9,0x70,0x7f,0xba,0x7c,0x4f,
+    0xad,0xaf,0xb9,0xa7,0xd6,0x3f,0x89,0x52,0x7d,0x2a,
+    0xdf,0x33,0x0a,0xd7,0xa0,0xb5,0xf2,0x10,0xdf,0x2b,
+    0x60,0xa6,0x6a,0xa3,0x7f,0xe4,0x85,0x9c,0xc4,0xc6,
+    0x5b,0x9d,0x3a,0x2a,0x0f,0x89,0xbf,0x5d,0xd4,0xdf,
+    0x7f,0xe6,0x19,0x46,0x25,0x12,0x07,0x2d,0x9d,0x5a,
+    0x17,0xe4,0x76,0x69,0xa6,0x3c,0xe4,0xf6,0x79,0x45,
+    0xe5,0xdd,0x97,0x7a,0x8f,0x1d,0x6b,0xef,0x35,0x6c,
+    0xef,0x21,0x29,0x97,0x5f,0xc6,0xe6,0x57,0x0b,0x29,
+    0x1c,0xcc,0xeb,0xd6,0x74,0xab,0x53,0x7b,0x19,0xf9,
+    0x1d,0xf1,0xc9,0x57,0xfa,0x6f,0x64,0x5e,0xd9,0xd4,
+    0x95,0xa9,0xf0,0x96,0x89,0x09,0x74,0x6a,0x97,0x93,
+    0x97,0xe0,0x05,0x7f,0x38,0xc5,0xe6,0xe4,0x24,0x78,
+    0x22,0x51,0xd7,0xff,0xaa,0xf8,0xd1,0xed,0xc6,0x9f,
+    0x4f,0x7e,0x92,0xde,0x45,0x29,0xfe,0x4b,0x17,0x91,
+    0xeb,0x52,0x5d,0xbf,0xea,0xba,0x02,0x23,0x32,0x58,
+    0xae,0xfb,0x7b,0xa3,0xa8,0xa2,0xdc,0xee,0x4d,0xae,
+    0xeb,0x6f,0xfc,0x6e,0xf9,0x5e,0xff,0x91,0x68,0x81,
+    0xc6,0x6c,0xe9,0x8b,0xbd,0x35,0x56,0x08,0x50,0xe9,
+    0xf8,0xdc,0xd5,0xcf,0xd5,0xcf,0xc5,0xe8,0xa2,0x8c,
+    0x50,0xa2,0x01,0xfc,0x07,0xcc,0xe2,0x05,0x9f,0x6d,
+    0x3e,0xe2,0xf7,0xe0,0xe9,0xb3,0x4d,0x91,0xe3,0xb6,
+    0x50,0x5b,0xf1,0x58,0xe1,0xa0,0x5d,0xe8,0x06,0x3b,
+    0x59,0xbd,0x62,0xac,0xd7,0x4a,0xa5,0xe3,0xd9,0xa5,
+    0xac,0x9e,0x50,0x53,0x59,0x86,0xf0,0x94,0x41,0x70,
+    0x73,0xab,0x82,0x73,0x13,0xfc,0xf4,0x7a,0xf6,0x89,
+    0xd0,0xca,0x11,0x9a,0x78,0x4b,0xbc,0xa0,0x5d,0xe8,
+    0x2a,0xce,0x85,0xa9,0xae,0x0b,0xb5,0x68,0x05,0x7c,
+    0x19,0xec,0xa9,0x0c,0xf6,0x0a,0xb8,0x4b,0xc7,0x08,
+    0x7f,0xd9,0xce,0x8d,0x57,0x4c,0xfe,0x71,0xf2,0x94,
+    0x1f,0xa6,0x08,0xb9,0xf3,0x5f,0xb1,0x2e,0x64,0x3b,
+    0x81,0xa6,0x5b,0x1f,0x2a,0x1e,0xf3,0xf7,0x02,0x3a,
+    0x31,0x1a,0xe4,0x77,0x03,0xfa,0xc9,0xef,0xd9,0x32,
+    0x48,0x2f,0x0e,0x63,0xdb,0x42,0x60,0x73,0x58,0x6b,
+    0xf6,0xa6,0xcf,0xcb,0xec,0xed,0x61,0xfc,0xbd,0x81,
+    0x15,0xb1,0xd3,0xda,0x57,0x48,0xef,0xfc,0x54,0x93,
+    0x54,0xeb,0xaf,0xaa,0x3f,0xf9,0x3b,0x02,0x1b,0xf0,
+    0x77,0xa2,0x99,0x48,0x08,0x69,0x6d,0xf3,0x2e,0x4b,
+    0x33,0x05,0xa3,0x50,0xf5,0xee,0x4a,0x90,0x0a,0x23,
+    0x34,0x8a,0xaa,0xdb,0xd2,0x82,0x02,0xde,0xf2,0xae,
+    0x7a,0x26,0x55,0x7a,0xbf,0xa5,0xa0,0x98,0x59,0x20,
+    0x8e,0x9d,0xad,0x8f,0x08,0x0a,0x1e,0x1b,0x4a,0x13,
+    0x8b,0x27,0x4e,0xf9,0xbe,0x98,0x36,0x2d,0xfe,0x71,
+    0xe2,0xe4,0x1f,0x8a,0xc4,0x4f,0xb1,0x34,0x2a,0x22,
+    0x14,0xde,0x09,0xc7,0xbb,0x21,0x8a,0xef,0x1e,0xb0,
+    0xf7,0x5d,0x3e,0xa0,0x65,0xe2,0x47,0x15,0xf3,0x94,
+    0xfd,0xb6,0x8a,0x1b,0xd9,0x2b,0x2f,0xfb,0x88,0x01,
+    0x58,0xfc,0xeb,0x2f,0xdf,0xc2,0xb9,0xfb,0xf7,0x7f,
+    0x12,0x3b,0xfc,0xf6,0x80,0x46,0x6e,0x15,0x37,0x6d,
+    0xdb,0xf9,0x16,0xa4,0xb1,0xf3,0xb6,0xb7,0xa5,0x77,
+    0x60,0xb2,0xbd,0x9c,0x73,0xe0,0x5b,0xbe,0x87,0xa4,
+    0x6a,0x97,0x59,0xf5,0xf6,0x32,0xdb,0x5d,0x65,0x75,
+    0x9e,0xad,0xde,0x66,0x72,0x73,0xec,0xcd,0x9b,0x63,
+    0x6d,0xb6,0x97,0x10,0x10,0x8f,0xa3,0x60,0x45,0x4a,
+    0xef,0x33,0x69,0x09,0x60,0x3e,0xc5,0x76,0x6a,0x54,
+    0xbd,0x57,0x71,0x29,0xda,0xb5,0xd9,0xa8,0xd7,0xee,
+    0xa4,0x15,0xcf,0x23,0xd5,0x7b,0x2a,0x5c,0x43,0xb8,
+    0x55,0x14,0xfc,0x4d,0x2c,0x03,0x09,0xd0,0x0d,0x75,
+    0x12,0xf0,0xca,0xcc,0xb6,0x8f,0xa1,0xae,0x47,0x68,
+    0x97,0x42,0xcf,0xd7,0x32,0x5b,0x44,0x37,0x73,0xa2,
+    0xaf,0x69,0x34,0x1e,0xc6,0xc6,0x31,0x1d,0xdf,0x2b,
+    0x13,0xfe,0x6e,0xad,0x4f,0x2d,0xdc,0x95,0x7d,0xa4,
+    0xcc,0xe7,0xf8,0xd0,0xbe,0x7a,0x47,0xa5,0x43,0x98,
+    0x2e,0x25,0xae,0x24,0xc1,0xcf,0xf2,0x04,0xee,0x6c,
+    0xeb,0x18,0xea,0xee,0xa1,0x6c,0x50,0x31,0x15,0x0d,
+    0xe0,0x0e,0xf1,0xd1,0xe2,0xe8,0xfc,0x2e,0x81,0xc2,
+    0xc9,0xca,0x8f,0x06,0xa7,0x1d,0x4e,0x1d,0x47,0x07,
+    0xb0,0xb6,0xf8,0xe2,0x58,0x18,0xa5,0xbc,0xc0,0x57,
+    0x2d,0xcd,0x1e,0x20,0x07,0x94,0x04,0x6f,0x57,0x34,
+    0x01,0xf8,0x21,0xe7,0x2b,0x18,0x04,0xb6,0xf9,0xb3,
+    0x1d,0x84,0x47,0x19,0x7d,0x17,0xb9,0xdf,0x7a,0x63,
+    0x6e,0x5e,0xfb,0x81,0x29,0xd7,0x5a,0x40,0x5b,0xf1,
+    0x18,0xa5,0xe0,0x29,0x3e,0xf0,0xff,0x21,0x7f,0xf8,
+    0xd0,0xf1,0xe2,0xca,0xc8,0x45,0x73,0x00,0xe6,0x08,
+    0x2b,0xc1,0x0e,0xcc,0xdd,0x66,0xb5,0x16,0xfb,0xe6,
+    0x75,0x1d,0x9d,0x2b,0x4e,0x88,0x7a,0x2d,0x82,0x36,
+    0xc9,0xf5,0x6c,0xe3,0xd1,0xc2,0x15,0xdb,0xde,0x90,
+    0xfe,0xa8,0x74,0xe0,0xef,0x72,0x71,0xaf,0xda,0xb5,
+    0x84,0x33,0x42,0xa3,0x36,0xca,0x28,0xe0,0x3f,0x1e,
+    0xf7,0x66,0x9b,0x4c,0x1b,0x9d,0xcf,0x39,0x47,0x29,
+    0xad,0xc8,0x51,0xaa,0x4f,0x8f,0x38,0x66,0xa7,0x1a,
+    0xfd,0xc6,0x7b,0xc7,0x5e,0x57,0xa6,0x5a,0x56,0xd2,
+    0xbc,0x91,0x96,0x60,0xd8,0xbc,0xcd,0x72,0x94,0x76,
+    0xfd,0x48,0x9c,0x46,0x2f,0x5b,0x3e,0xa5,0x51,0xc8,
+    0x65,0xf4,0x45,0x04,0x13,0x7f,0x97,0x07,0x9f,0x43,
+    0x3d,0xe7,0x7d,0x1e,0xc4,0xe6,0xe5,0x14,0xcf,0xbe,
+    0xdb,0x03,0xbe,0xac,0x7e,0x5b,0x45,0x3d,0xaf,0xf9,
+    0x80,0xbe,0xb6,0x2f,0xb0,0xa0,0x1c,0x9f,0x9e,0xe3,
+    0xf3,0x78,0x2e,0x36,0xa8,0x07,0x0b,0x9d,0x54,0x2f,
+    0xf8,0x8a,0x03,0xf2,0xbb,0x34,0xd8,0x98,0x17,0xa3,
+    0x52,0xe1,0x1c,0xc1,0x47,0xde,0xdf,0x12,0x0e,0x2f,
+    0x18,0xfb,0x84,0xbf,0x70,0x4e,0x6c,0xf9,0xe0,0x45,
+    0x03,0xa0,0x4a,0xb5,0x77,0xef,0x93,0xa7,0xff,0x39,
+    0x0c,0x4a,0xef,0xa5,0xc4,0xf1,0xf6,0x4f,0x09,0xb7,
+    0xcb,0x7f,0xe2,0x66,0xe1,0x1d,0x88,0x7f,0xe1,0xd8,
+    0xfb,0xe7,0xde,0xbd,0x4f,0x9d,0xfe,0x1b,0x35,0xf6,
+    0x9f,0x6d,0xbb,0x9b,0xbf,0x4c,0xcb,0x25,0xfa,0x5e,
+    0xa2,0xfd,0x2c,0xee,0xf2,0x52,0x3c,0xa0,0x76,0x52,
+    0x4c,0xa7,0x16,0x1f,0x9a,0xbf,0x0c,0x27,0xa4,0x27,
+    0xfe,0x9b,0x1f,0x8c,0x94,0x97,0xe2,0x89,0x4c,0x0a,
+    0xf6,0x49,0xbc,0x78,0x5e,0x8e,0x63,0x78,0xff,0x57,
+    0x24,0xc3,0x85,0x8d,0xeb,0xcf,0x89,0x66,0x50,0x16,
+    0x5b,0x7a,0x99,0x90,0xc6,0x93,0xd3,0x29,0x12,0x5e,
+    0xcb,0x5d,0x19,0xaf,0xdf,0x7f,0x46,0x50,0xe4,0xf8,
+    0xcb,0xf3,0x70,0x0b,0x3c,0x6e,0xf5,0x72,0xc8,0x59,
+    0x70,0x4b,0xc2,0x5f,0x1d,0xbf,0x31,0xfe,0x17,0x7e,
+    0x49,0x56,0x9e,0x87,0x5d,0xfc,0x89,0x31,0xfd,0x25,
+    0x90,0x57,0xb6,0xab,0xe2,0x79,0x4d,0x4c,0xa7,0x49,
+    0xfd,0x51,0x1d,0xa9,0xbf,0xeb,0xc6,0x76,0x3e,0x61,
+    0xa8,0xea,0xc6,0x77,0xc4,0x1e,0x3c,0xae,0x68,0x13,
+    0xe3,0x69,0xfe,0xdf,0x51,0x1e,0x49,0xe8,0x5e,0x14,
+    0xeb,0x11,0x8f,0x21,0xba,0x17,0x05,0x7c,0xe8,0x2d,
+    0x09,0x6f,0x4d,0xcc,0x47,0x57,0x27,0xea,0x23,0x35,
+    0xc5,0x26,0xf6,0x73,0x94,0xb3,0xab,0x76,0xfc,0xc7,
+    0x72,0x85,0xc5,0x0e,0x6b,0xc5,0x80,0xdc,0xeb,0x44,
+    0x81,0x70,0xb0,0x92,0x35,0xa5,0x26,0x16,0xf4,0x46,
+    0xf9,0x49,0x06,0xae,0x6e,0x38,0xa8,0xf2,0x12,0x27,
+    0x8e,0x5a,0xf7,0x54,0xc7,0x84,0xec,0x59,0x6c,0xc0,
+    0x2c,0x37,0x7c,0x7e,0x99,0x78,0x95,0x13,0xf2,0xf4,
+    0xb1,0xd4,0x0a,0x16,0x97,0xfd,0xb2,0x3a,0x4e,0xa4,
+    0xab,0x13,0x29,0x92,0x03,0x9d,0xd5,0xf1,0xa2,0x4c,
+    0x5e,0xfb,0x99,0x98,0x11,0x6f,0x07,0xb5,0x89,0xf9,
+    0x98,0x5e,0x22,0xea,0x23,0x37,0xea,0x79,0xb1,0x9f,
+    0x66,0xbc,0x81,0xff,0x1d,0xff,0xb1,0x1c,0xe7,0xed,
+    0xbd,0x56,0x1d,0x03,0x72,0xac,0x8a,0x02,0xc9,0xa4,
+    0xf3,0x58,0x90,0xc8,0xa2,0xe5,0x3c,0x1e,0x24,0xbe,
+    0xc9,0x69,0xad,0x89,0x09,0xe9,0xea,0x44,0x85,0x24,
+    0xca,0x6c,0x62,0x43,0x1f,0x60,0xed,0x67,0xe2,0x43,
+    0x62,0x9e,0x24,0x03,0x35,0x31,0x22,0xdf,0x17,0x47,
+    0x89,0x6a,0x01,0xad,0x13,0x2b,0xda,0x69,0x83,0xa1,
+    0xbe,0x78,0x91,0x98,0xcb,0x3b,0x8b,0xb2,0x58,0x8d,
+    0x1c,0x33,0xe2,0xfb,0xa7,0x6a,0x05,0x8d,0xb4,0x52,
+    0x8b,0xe9,0xac,0x5a,0xa1,0xa3,0x14,0xc6,0xc8,0x3a,
+    0xe1,0x23,0xf1,0x4f,0xcb,0xc5,0x2a,0xbd,0xac,0x89,
+    0x03,0x85,0xbe,0x6c,0x24,0x48,0xee,0xbc,0x97,0x8c,
+    0x07,0x75,0xe4,0x7d,0xf9,0xb2,0x31,0x21,0xcb,0x0f,
+    0x72,0x5b,0x6b,0xe2,0x3c,0x86,0x17,0x44,0x7a,0x24,
+    0x52,0xea,0x8f,0xf7,0xf0,0x81,0xe1,0x79,0x31,0x1f,
+    0x31,0x55,0x1e,0x97,0x6c,0xe3,0x3e,0x81,0x2f,0x1b,
+    0xf9,0x91,0x39,0xf0,0x5f,0xf1,0x9f,0x7e,0xbc,0xe9,
+    0x2f,0x19,0x03,0x12,0xbb,0x70,0xd9,0xac,0x89,0xd7,
+    0x18,0xff,0x2b,0x62,0x23,0x53,0xf1,0x9c,0xb8,0x4d,
+    0x1b,0x36,0x72,0xbe,0x28,0x76,0x43,0x1b,0x54,0xc9,
+    0x40,0x4d,0xfc,0x26,0xf0,0xa5,0x23,0x38,0x12,0xf2,
+    0xff,0x8a,0xe3,0xb4,0x66,0x44,0xbc,0x4c,0x2c,0x87,
+    0x3a,0xc8,0xfd,0x5e,0x13,0x8b,0xd1,0xd7,0x17,0x8d,
+    0x91,0x2c,0x59,0xfd,0x31,0x19,0x0b,0x53,0xd5,0xfa,
+    0x02,0x33,0x34,0x8a,0x01,0x17,0x6c,0x62,0x33,0xde,
+    0x3c,0xb7,0xa9,0x9e,0xe8,0x8c,0xa4,0x45,0xcc,0xee,
+    0x3e,0x3f,0x46,0xb3,0x06,0xd1,0x7c,0xf6,0xa2,0x28,
+    0x0d,0x3d,0xb3,0x77,0x6f,0x85,0xb3,0xe2,0xa7,0x8a,
+    0xc6,0x12,0x7f,0x6b,0x62,0x35,0xba,0x67,0xa3,0x35,
+    0x12,0x1b,0x6b,0x62,0x36,0xdc,0xc4,0xd6,0x8e,0xdb,
+    0x70,0x23,0x57,0xed,0xc7,0x4a,0xb1,0x1b,0x9f,0x17,
+    0x47,0x6f,0x64,0xc9,0xc8,0xfe,0x4f,0xbf,0xe9,0x65,
+    0x3c,0x26,0x6a,0x13,0xcb,0xf1,0xff,0xef,0x68,0x8e,
+    0xd4,0x43,0xcf,0x8d,0xe9,0xc0,0x6b,0xcc,0xda,0xbd,
+    0x38,0xb0,0x23,0x0e,0x95,0xf0,0x8e,0x62,0xe3,0x18,
+    0xf7,0x5f,0xed,0xab,0x3c,0x46,0x17,0xec,0x99,0xdd,
+    0x08,0xc1,0xa7,0xac,0xca,0xfd,0x7c,0xfa,0x98,0xaf,
+    0xa3,0x39,0x2b,0x77,0x91,0x9f,0x95,0x95,0x7c,0xad,
+    0x0c,0x7b,0xf3,0x67,0x31,0x00,0xae,0x29,0x77,0xf1,
+    0x45,0x74,0xa2,0x21,0x1f,0x57,0xff,0xe6,0x8f,0x16,
+    0x6d,0x35,0xc8,0xbf,0xe5,0xe3,0x41,0x72,0xe4,0x6b,
+    0x8a,0x73,0xa7,0x32,0xf9,0x5a,0x20,0x01,0xe4,0xef,
+    0xea,0x5f,0xfa,0xf1,0x80,0xbe,0xf2,0xb5,0x92,0xc4,
+    0xc0,0x2f,0xf2,0xb5,0x8a,0x78,0xd1,0xd1,0xf2,0xb5,
+    0x33,0x69,0x46,0xcf,0xb0,0x5f,0x63,0x52,0xb0,0xb7,
+    0x18,0xf9,0x70,0x08,0xec,0x9a,0xbd,0xd7,0x33,0x52,
+    0xbe,0xa6,0xd8,0xf7,0xaf,0xc8,0xd7,0x02,0x49,0x23,
+    0x9b,0xe4,0x6b,0x05,0x09,0x07,0x83,0x7c,0xad,0x24,
+    0x25,0x30,0x4e,0xbe,0x56,0x91,0x58,0xda,0x5c,0xbe,
+    0x76,0x26,0x6d,0xe8,0x02,0x32,0x92,0xe4,0x93,0x02,
+    0x32,0x89,0x14,0x92,0x6c,0x92,0x45,0x46,0x93,0x62,
+    0xb4,0x8b,0xb9,0x78,0x5d,0x84,0xff,0xb2,0x49,0x1e,
+    0x96,0x91,0x91,0xf9,0x05,0x93,0x0a,0xb3,0xb3,0x46,
+    0x17,0x1b,0x72,0xb3,0x8b,0x8a,0xb2,0xf3,0xb0,0x28,
+    0x19,0xeb,0x64,0xe0,0x5d,0x03,0x49,0x25,0xe9,0x78,
+    0x2e,0xc2,0xab,0xae,0x58,0x32,0x02,0xe1,0x64,0x90,
+    0x89,0xf8,0xad,0x13,0xc2,0xcd,0x43,0x4e,0x67,0xf0,
+    0xbb,0x19,0x8c,0xe7,0xc9,0x05,0x19,0x79,0x86,0xd4,
+    0xf4,0xbc,0x22,0x43,0xd7,0x8c,0x11,0x85,0x19,0x13,
+    0x0d,0x9d,0xf2,0xf3,0x46,0x65,0xe4,0x15,0x65,0xe0,
+    0xbd,0x14,0x7c,0x24,0x8b,0x8c,0x47,0xc6,0xa5,0x23,
+    0x08,0x92,0x92,0x91,0x35,0x3e,0x27,0x1d,0x2f,0xc2,
+    0x48,0x10,0x09,0xe1,0x3f,0x60,0xd4,0x96,0xf4,0x21,
+    0x89,0xa4,0x1f,0xe9,0x89,0x57,0x55,0xe8,0xab,0x90,
+    0xdb,0xa2,0xae,0x8b,0xb8,0xd5,0xb3,0xd0,0xc3,0x82,
+    0x42,0x42,0x42,0xdb,0xb2,0x9f,0xfe,0x6b,0xcb,0x68,
+    0x62,0x24,0x49,0x14,0x55,0x13,0xd4,0xaa,0x9a,0x80,
+    0xff,0xe7,0x2d,0xed,0x8b,0x8f,0x14,0x72,0xe6,0xe6,
+    0x73,0xb0,0xb6,0x2d,0xec,0x85,0x48,0x0c,0xfc,0x9b,
+    0x6d,0xe9,0x68,0x7c,0xb2,0x98,0x77,0x54,0x1e,0x99,
+    0x80,0xf7,0x43,0xf9,0xbd,0x20,0x12,0xc5,0x5f,0xbe,
+    0x94,0x8b,0x64,0x8d,0x45,0x98,0xec,0x99,0x4c,0x2c,
+    0xcd,0x41,0xc8,0x23,0x78,0xfd,0x08,0x7e,0x44,0x13,
+    0x33,0x7e,0x6b,0x8d,0x88,0x33,0x0a,0x8b,0xb2,0xf3,
+    0xf3,0x0c,0x52,0xeb,0x7b,0xa5,0x1a,0x42,0x42,0xa4,
+    0xcb,0xd1,0xf9,0xc5,0x23,0xf3,0xf3,0x26,0x18,0x42,
+    0x83,0x42,0x82,0xa2,0x42,0xda,0xe6,0xa6,0x8f,0xcd,
+    0xc8,0x2f,0xce,0x0c,0xca,0xc9,0x1e,0x11,0x16,0x14,
+    0x11,0x14,0x11,0x6d,0x0e,0x6b,0x4d,0xfe,0xbf,0xb2,
+    0xfc,0xff,0x21,0x9f,0x0d,0xf5,0xc1,0xae,0xc3,0x6d,
+    0x43,0x35,0x64,0xf9,0x37,0xb8,0xac,0xef,0xb2,0xdf,
+    0x4c,0xa9,0xe7,0xa7,0xb7,0xa4,0xf7,0xea,0x52,0xa0,
+    0xa8,0x17,0xff,0x3f,0xfe,0x05,0x2e,0x10,0xc8,0x1b,
+    0x64,0x2e,0x99,0x47,0x8e,0x91,0x52,0xf2,0x33,0xfa,
+    0xff,0xec,0xd7,0xab,0x36,0x90,0x5d,0x64,0x2b,0x28,
+    0xc8,0x22,0x50,0x92,0x39,0xe4,0x35,0xf2,0x27,0xf9,
+    0x8b,0x2c,0x05,0x15,0x59,0x40,0x3e,0x24,0xb7,0xc9,
+    0x1f,0x64,0x23,0xd9,0x8d,0x36,0xe9,0x11,0x79,0x4c,
+    0x5e,0x27,0x7b,0xc9,0xa7,0xe4,0x2c,0x79,0x0b,0x39,
+    0x3e,0x92,0x2c,0x47,0x3e,0x7f,0x86,0x5c,0xfe,0x84,
+    0x9c,0x23,0x9f,0x93,0xf3,0xe4,0x02,0xb9,0x48,0xee,
+    0xa3,0x78,0x7d,0x41,0x2e,0x91,0xcb,0x64,0x1f,0x72,
+    0xff,0x77,0xb2,0x82,0x5c,0x23,0x57,0xc9,0x97,0x28,
+    0x9e,0xbf,0x90,0x5f,0xc9,0x42,0x32,0x06,0x05,0x6f,
+    0x2c,0x8a,0x63,0x0e,0xf6,0xd2,0x66,0xec,0xab,0x71,
+    0xd8,0xa3,0x4c,0xd0,0xc7,0xa3,0x60,0x4e,0xc0,0x1e,
+    0x7c,0x40,0x4a,0xc8,0x64,0xb4,0x34,0x53,0xc8,0x34,
+    0x32,0x95,0x1c,0x26,0x5b,0xc8,0x0c,0x32,0x9d,0xcc,
+    0x24,0xb3,0xc8,0x43,0xf2,0x1b,0x79,0x9f,0x5c,0x27,
+    0xfb,0xc9,0xdb,0xe4,0x2e,0xf9,0x91,0x1c,0x25,0xf7,
+    0xc8,0x4f,0x64,0x3b,0xb9,0x41,0xbe,0x23,0x37,0xc9,
+    0x2d,0xf2,0x0d,0xb9,0x43,0xbe,0x22,0xdf,0x82,0x9a,
+    0xff,0x7a,0x97,0x03,0x38,0x42,0x03,0x68,0x88,0x93,
+    0xcb,0x46,0xfc,0x97,0xbb,0x9c,0xc1,0x05,0x74,0xe0,
+    0xca,0x7f,0xc1,0xcb,0x1d,0x1a,0x83,0x07,0x34,0x81,
+    0xa6,0xd0,0x0c,0xd8,0xc6,0x49,0x03,0x78,0x83,0x0f,
+    0x18,0xc1,0x17,0xfc,0xc0,0x04,0xfe,0xd0,0x1c,0x5a,
+    0x40,0x00,0xb4,0x84,0x40,0x68,0x85,0xe3,0x78,0x30,
+    0x84,0x40,0x28,0xfa,0x49,0x66,0x08,0x87,0x08,0x72,
+    0x80,0xbc,0x43,0x0e,0x91,0xf7,0xc8,0x19,0x72,0x90,
+    0xbc,0x4b,0x3e,0x22,0xb3,0xc9,0x69,0xb4,0xad,0x7b,
+    0xd0,0xc6,0x1f,0x27,0x27,0xc8,0x07,0x10,0x09,0x51,
+    0x64,0x09,0x44,0x43,0x6b,0x68,0x03,0x6d,0x21,0x06,
+    0xda,0x41,0x2c,0xc4,0x41,0x7b,0xe8,0x00,0x1d,0xa1,
+    0x13,0xc4,0x43,0x67,0x48,0x80,0x2e,0xd0,0x15,0xba,
+    0x41,0x77,0x48,0x84,0x24,0xe8,0x01,0x3d,0x21,0x19,
+    0x7a,0x41,0x6f,0x48,0x81,0x54,0x48,0x83,0x3e,0xd0,
+    0x17,0xfa,0xd1,0x4e,0x29,0xea,0xf1,0x79,0xd9,0x21,
+    0x21,0x1d,0x42,0xe4,0x73,0xbc,0x7d,0xfe,0x04,0xd4,
+    0xcc,0x91,0xf9,0x85,0x19,0x52,0x49,0xc7,0x08,0x7e,
+    0x8e,0xe8,0x18,0x22,0x9f,0x43,0xe5,0x73,0x98,0x7c,
+    0x36,0xcb,0xe7,0x70,0xf9,0x5c,0xf5,0x7c,0xa4,0x7c,
+    0x8e,0x92,0xcf,0xd1,0xf2,0xb9,0xb5,0x7c,0xee,0x20,
+    0x9f,0x3b,0xca,0xe7,0x4e,0xf2,0x39,0x5e,0x3e,0x77,
+    0x96,0xce,0x9d,0x64,0x7c,0x9d,0x64,0x7c,0x9d,0x64,
+    0x78,0xf1,0x32,0x3d,0xf1,0xf2,0xfd,0x78,0xf9,0x7e,
+    0xbc,0x4c,0x4f,0xbc,0x4c,0x4f,0xbc,0x4c,0x4f,0xbc,
+    0x4c,0x4f,0x7c,0x55,0x7d,0x99,0x9e,0x78,0x99,0x9e,
+    0x78,0x99,0x9e,0x78,0x99,0x9e,0x78,0x99,0x9e,0x78,
+    0x99,0x9e,0x78,0x99,0x9e,0xf8,0x04,0xe9,0xdc,0x59,
+    0xc6,0xdf,0x59,0xc6,0xdf,0x59,0xc6,0xdf,0x59,0xc6,
+    0xdf,0x59,0xc6,0xdf,0x59,0xc6,0xdf,0x59,0xc6,0xdf,
+    0x59,0xc6,0xdf,0x59,0xc6,0xdf,0x59,0xc6,0xdf,0xb9,
+    0x83,0x5d,0x56,0x46,0x61,0x46,0xd1,0xe8,0xd1,0x23,
+    0x1c,0xf1,0xa2,0x68,0x74,0xfa,0xa4,0xec,0xdc,0xd1,
+    0x23,0xd8,0xcd,0xb0,0x90,0x0e,0x1d,0x14,0x9d,0xc7,
+    0x17,0xe6,0xb3,0x2f,0x09,0x1d,0x43,0x42,0xe5,0x73,
+    0x98,0x74,0x0e,0xeb,0x20,0x9f,0x3b,0xba,0x14,0x8d,
+    0xce,0xce,0x1b,0x95,0x9e,0x85,0x50,0xf8,0x55,0x7e,
+    0xf1,0xe8,0x11,0xce,0x36,0x65,0x72,0x91,0x63,0x7a,
+    0x4e,0x46,0x66,0x41,0x7a,0x71,0x3a,0xe2,0x6a,0xc0,
+    0xae,0xc7,0xa5,0xe7,0xa6,0x17,0x17,0xc9,0x5f,0xa4,
+    0x67,0xf1,0xa9,0x11,0x19,0xc5,0x55,0xd7,0x0d,0xb3,
+    0xb2,0x73,0x33,0x72,0xaa,0xbf,0x8d,0xc2,0xe7,0xaa,
+    0xef,0x39,0x8c,0xce,0xa8,0xba,0x94,0xe8,0x30,0x47,
+    0x34,0x9c,0x8c,0xc4,0xe7,0x55,0x03,0x2a,0xae,0x79,
+    0xd8,0x71,0x52,0xfe,0xa8,0xaa,0x6b,0x4d,0x66,0x76,
+    0x5e,0x7a,0xce,0xd8,0xf4,0x1a,0x8c,0x36,0xd7,0x0d,
+    0x73,0xd2,0x73,0x33,0xaa,0x1f,0x75,0xcc,0xcd,0xc8,
+    0xad,0xbe,0xce,0x1b,0x5f,0x0d,0xda,0xa9,0x08,0x9f,
+    0x1a,0x3b,0xba,0xea,0x6b,0x23,0x0e,0xb1,0xa0,0x9a,
+    0x1e,0x87,0x9a,0xcb,0x86,0xc5,0x45,0xe9,0xa3,0xb2,
+    0xab,0x61,0x8c,0xcb,0xaf,0xc6,0xd4,0x80,0x31,0xbd,
+    0xfa,0x4b,0x0d,0xb7,0x18,0xe1,0xe9,0x13,0x6a,0x37,
+    0x2d,0xbc,0xa3,0xba,0x30,0x3d,0x33,0x03,0xbf,0xb3,
+    0x5f,0xfc,0xb5,0x5a,0x79,0x76,0x20,0xf7,0x8f,0xce,
+    0xe7,0xbe,0xdd,0x87,0xff,0xae,0xf0,0x28,0xb1,0x53,
+    0xf5,0xef,0x0c,0xb3,0x3b,0x4e,0x78,0x84,0xc8,0xde,
+    0x97,0x12,0x6d,0xfa,0x17,0x58,0x7a,0x15,0x2d,0x89,
+    0x40,0xbe,0xc7,0x7f,0x40,0x7e,0x40,0x0b,0x23,0x90,
+    0x7b,0xa8,0xf1,0xc0,0xdf,0x2b,0x43,0x65,0x88,0x0e,
+    0x68,0xc9,0x03,0x09,0x8c,0xc6,0x31,0x04,0xed,0x3f,
+    0x7f,0xe3,0x8c,0xd5,0xca,0xef,0x40,0x6e,0x7a,0xe1,
+    0x58,0x62,0x27,0x3f,0xc7,0x6a,0x29,0xf8,0xd9,0x8e,
+    0x80,0x50,0x22,0xe4,0x11,0x85,0xb0,0x00,0x47,0x8a,
+    0x26,0xe4,0x6b,0xb4,0x53,0xf7,0xd0,0x9a,0xfd,0x49,
+    0xfe,0x25,0x22,0x28,0xd0,0x52,0x69,0xd0,0x2a,0x35,
+    0x45,0x0b,0xd4,0x1c,0xad,0x4d,0x38,0xda,0x8d,0xf6,
+    0x68,0x23,0x92,0xd0,0x1e,0xf4,0x87,0xa1,0x30,0x0a,
+    0xc6,0x40,0x01,0x4c,0x80,0xa9,0x30,0x1b,0x16,0xc0,
+    0x32,0x58,0x05,0x6b,0x61,0x33,0x6c,0x87,0x37,0xe1,
+    0x00,0x1c,0x86,0xe3,0x70,0x06,0xce,0xc1,0x25,0xb8,
+    0x06,0xb7,0xe0,0x7b,0xf8,0x19,0x7e,0x83,0x47,0xf0,
+    0x94,0x12,0xaa,0xa2,0x0d,0xa8,0x33,0x75,0xa7,0x9e,
+    0xd4,0x97,0x06,0xd0,0x10,0x1a,0x49,0x63,0x68,0x47,
+    0xda,0x95,0xf6,0xa4,0x69,0x74,0x20,0x1d,0x4e,0x33,
+    0x69,0x0e,0x2d,0xc4,0x89,0xcf,0x74,0x3a,0x97,0x2e,
+    0xa2,0xcb,0x69,0x29,0x5d,0x4f,0x5f,0xa7,0x3b,0xe9,
+    0x5b,0xf4,0x20,0x7d,0x9f,0x9e,0xa4,0x1f,0xd3,0xf3,
+    0xf4,0x0a,0xbd,0x41,0x6f,0xd3,0xbb,0xf4,0x01,0xfd,
+    0x9d,0x3e,0xa6,0x95,0x02,0x15,0xec,0x04,0x27,0x41,
+    0x27,0x78,0x08,0x06,0xc1,0x24,0x04,0x0a,0x61,0x42,
+    0xb4,0x10,0x2b,0xc4,0x0b,0xdd,0x85,0x5e,0x42,0x5f,
+    0x61,0x30,0x01,0x78,0x8b,0xb7,0x77,0x9c,0x22,0x0b,
+    0xaf,0x99,0xbb,0x21,0x7b,0xba,0xb0,0x9a,0x97,0xbf,
+    0xc6,0xcb,0xfd,0x28,0xa9,0x2e,0x1f,0xca,0xcb,0x3f,
+    0x61,0xe5,0xe4,0x1f,0x9b,0xf2,0xb7,0x79,0x79,0x3f,
+    0x5e,0xfe,0xb9,0x4d,0xf9,0x6d,0x5e,0x7e,0x90,0xc3,
+    0xb9,0x5d,0x53,0x4e,0xae,0xf0,0xcf,0x3d,0xac,0xdc,
+    0xfa,0x87,0x4d,0xf9,0x1f,0xfc,0x73,0x39,0x87,0xd3,
+    0xa4,0x0e,0x9c,0xa3,0xcf,0xc2,0x81,0xab,0xbc,0xbc,
+    0x84,0x97,0x5f,0xb5,0x81,0xf3,0x39,0xff,0xdc,0xc1,
+    0xe1,0x34,0xa5,0x5f,0x57,0x97,0x47,0x00,0xf3,0xc2,
+    0x47,0xf1,0xf2,0xfb,0x36,0x70,0xfa,0xf3,0xbb,0x52,
+    0xf9,0x97,0x36,0xe5,0xa9,0x7c,0xae,0xf0,0x1e,0x2f,
+    0x1f,0x57,0x87,0x9e,0x1d,0x75,0xe8,0xf9,0x82,0x97,
+    0x8f,0xe5,0xe5,0x5f,0xd4,0x94,0x5b,0xed,0x21,0xbf,
+    0xaa,0x9c,0x34,0xb4,0x79,0x9e,0xe7,0xa6,0x92,0x79,
+    0xbc,0xfc,0xa8,0x4d,0xb9,0x0d,0xfd,0x60,0xcb,0xcf,
+    0x0f,0xa4,0xf7,0xc6,0xf2,0xf2,0x47,0x34,0xbe,0xba,
+    0xdc,0x9d,0xc3,0x9f,0xc1,0xcb,0x6f,0xd0,0xbb,0xd5,
+    0xe5,0x67,0x6c,0xfa,0xf1,0x4c,0x4d,0xb9,0x35,0x89,
+    0x3f,0x1f,0xcd,0xcb,0xf3,0x6c,0xe0,0x4b,0xbf,0xf5,
+    0xc6,0xe1,0x90,0x1d,0xb0,0xa7,0xaa,0x9c,0x7e,0x6c,
+    0x43,0xcf,0x26,0x6a,0xaa,0x2e,0xb7,0xab,0xa1,0xc7,
+    0x56,0x1e,0x68,0x78,0x0d,0x1f,0x68,0x08,0xa0,0xf6,
+    0x09,0x7f,0xf1,0xba,0x5f,0xdb,0xf0,0xe7,0xeb,0xea,
+    0xe7,0x29,0x9e,0xef,0x81,0x74,0x45,0xb9,0x4e,0x13,
+    0xae,0xcd,0x4e,0x7c,0x57,0x12,0xdb,0xdf,0x96,0x44,
+    0xd8,0x54,0x82,0x10,0xd6,0x4f,0x4c,0x06,0xd9,0x2f,
+    0xb3,0xb3,0xf7,0xd0,0xb2,0x5f,0x20,0x9f,0x80,0xb5,
+    0xa7,0xb2,0xb7,0xfa,0xe1,0xf5,0x02,0xac,0xcf,0x7e,
+    0x7b,0x62,0x15,0x5a,0x82,0xb5,0xec,0x97,0x0f,0xf0,
+    0x7a,0x3b,0xc7,0x92,0xf7,0x7f,0xf3,0xa9,0x58,0x5e,
+    0xf3,0x29,0x95,0xc8,0x3c,0x7f,0xce,0x5d,0xc2,0xe6,
+    0xda,0x9e,0x75,0x6c,0x4d,0xad,0x5f,0x83,0xfd,0x3f,
+    0x02,0x0e,0x09,0xf1
 };
 
@@ -1,92 +1,61 @@
-//this file was auto-generated from "option_arrow.svg" by res2h
+//this file was auto-generated from "option_arrow.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t option_arrow_svg_size = 839;
-const unsigned char option_arrow_svg_data[839] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x45,0x62,0x65,0x6e,
-    0x65,0x5f,0x31,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,
-    0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,
-    0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,
-    0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,
-    0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,
-    0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x32,
-    0x2e,0x31,0x35,0x38,0x70,0x78,0x22,0x20,0x68,0x65,
-    0x69,0x67,0x68,0x74,0x3d,0x22,0x32,0x31,0x2e,0x39,
-    0x31,0x33,0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,
-    0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x31,
-    0x32,0x2e,0x31,0x35,0x38,0x20,0x32,0x31,0x2e,0x39,
-    0x31,0x33,0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,
-    0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-    0x64,0x3d,0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,
-    0x20,0x31,0x32,0x2e,0x31,0x35,0x38,0x20,0x32,0x31,
-    0x2e,0x39,0x31,0x33,0x22,0x20,0x78,0x6d,0x6c,0x3a,
-    0x73,0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,
-    0x73,0x65,0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x67,
-    0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x37,0x37,0x37,0x37,
-    0x37,0x37,0x22,0x20,0x64,0x3d,0x22,0x4d,0x30,0x2e,
-    0x37,0x35,0x2c,0x32,0x31,0x2e,0x39,0x31,0x33,0x63,
-    0x2d,0x30,0x2e,0x31,0x2c,0x30,0x2d,0x30,0x2e,0x32,
-    0x2d,0x30,0x2e,0x30,0x32,0x2d,0x30,0x2e,0x32,0x39,
-    0x34,0x2d,0x30,0x2e,0x30,0x36,0x31,0x43,0x30,0x2e,
-    0x31,0x37,0x39,0x2c,0x32,0x31,0x2e,0x37,0x33,0x35,
-    0x2c,0x30,0x2c,0x32,0x31,0x2e,0x34,0x36,0x33,0x2c,
-    0x30,0x2c,0x32,0x31,0x2e,0x31,0x36,0x33,0x56,0x30,
-    0x2e,0x37,0x35,0x0a,0x09,0x09,0x63,0x30,0x2d,0x30,
-    0x2e,0x33,0x2c,0x30,0x2e,0x31,0x37,0x39,0x2d,0x30,
-    0x2e,0x35,0x37,0x32,0x2c,0x30,0x2e,0x34,0x35,0x36,
-    0x2d,0x30,0x2e,0x36,0x39,0x43,0x30,0x2e,0x37,0x33,
-    0x2d,0x30,0x2e,0x30,0x35,0x37,0x2c,0x31,0x2e,0x30,
-    0x35,0x32,0x2c,0x30,0x2c,0x31,0x2e,0x32,0x36,0x39,
-    0x2c,0x30,0x2e,0x32,0x30,0x38,0x6c,0x31,0x30,0x2e,
-    0x36,0x35,0x38,0x2c,0x31,0x30,0x2e,0x32,0x30,0x36,
-    0x63,0x30,0x2e,0x31,0x34,0x37,0x2c,0x30,0x2e,0x31,
-    0x34,0x31,0x2c,0x30,0x2e,0x32,0x33,0x31,0x2c,0x30,
-    0x2e,0x33,0x33,0x37,0x2c,0x30,0x2e,0x32,0x33,0x31,
-    0x2c,0x30,0x2e,0x35,0x34,0x32,0x0a,0x09,0x09,0x73,
-    0x2d,0x30,0x2e,0x30,0x38,0x34,0x2c,0x30,0x2e,0x34,
-    0x2d,0x30,0x2e,0x32,0x33,0x31,0x2c,0x30,0x2e,0x35,
-    0x34,0x32,0x4c,0x31,0x2e,0x32,0x36,0x39,0x2c,0x32,
-    0x31,0x2e,0x37,0x30,0x35,0x43,0x31,0x2e,0x31,0x32,
-    0x36,0x2c,0x32,0x31,0x2e,0x38,0x34,0x2c,0x30,0x2e,
-    0x39,0x33,0x39,0x2c,0x32,0x31,0x2e,0x39,0x31,0x33,
-    0x2c,0x30,0x2e,0x37,0x35,0x2c,0x32,0x31,0x2e,0x39,
-    0x31,0x33,0x7a,0x20,0x4d,0x31,0x2e,0x35,0x2c,0x32,
-    0x2e,0x35,0x30,0x36,0x76,0x31,0x36,0x2e,0x38,0x39,
-    0x39,0x6c,0x38,0x2e,0x38,0x32,0x34,0x2d,0x38,0x2e,
-    0x34,0x35,0x4c,0x31,0x2e,0x35,0x2c,0x32,0x2e,0x35,
-    0x30,0x36,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x67,
-    0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a
+const size_t option_arrow_svg_size = 528;
+const unsigned char option_arrow_svg_data[528] = {
+    0x45,0x53,0x5a,0x31,0x47,0x03,0x00,0x00,0x78,0xda,
+    0x6d,0x52,0xdb,0x8e,0x9b,0x40,0x0c,0x7d,0x4e,0xbe,
+    0xc2,0x9d,0x3e,0x55,0x82,0xb9,0x70,0x27,0x0a,0x59,
+    0x35,0xd9,0x28,0x8a,0x94,0x6d,0x23,0x75,0x9b,0xaa,
+    0x4f,0x15,0x81,0x59,0x82,0x96,0x02,0x02,0x12,0xd2,
+    0xfd,0xfa,0xda,0xb0,0x5a,0xe5,0x21,0x48,0x78,0x6c,
+    0x9f,0x33,0xc7,0xf6,0xcc,0xcc,0x1f,0xae,0x7f,0x0b,
+    0xb8,0xe8,0xa6,0xcd,0xab,0x32,0x62,0x8a,0x4b,0x06,
+    0xba,0x4c,0xaa,0x34,0x2f,0xb3,0x88,0x9d,0xbb,0x17,
+    0x33,0x60,0x0f,0x8b,0xe9,0xfc,0x93,0x69,0xc2,0x46,
+    0x97,0xba,0x89,0xbb,0xaa,0x99,0xc1,0xd7,0xb4,0x3a,
+    0x6a,0xd8,0x16,0xc5,0xb9,0xed,0x86,0x14,0x28,0x8f,
+    0x4b,0x6e,0x1b,0xf0,0xe3,0xb0,0x81,0xf5,0xb5,0xae,
+    0x9a,0x0e,0xf6,0xc5,0x39,0x33,0xb7,0x25,0xf0,0x21,
+    0x79,0x18,0x6b,0xcc,0x00,0x89,0x12,0x96,0xe7,0xbc,
+    0x48,0x41,0x7e,0x01,0x30,0x4d,0x92,0x7f,0xfc,0xbe,
+    0x7a,0xfe,0xbd,0x5f,0x43,0x7b,0xc9,0x60,0xff,0x73,
+    0xb9,0xdb,0xae,0x80,0x99,0x42,0xfc,0xb2,0x57,0x42,
+    0x3c,0x3e,0x3f,0x0e,0x0a,0x8a,0x2b,0x21,0xd6,0xdf,
+    0x18,0xb0,0x53,0xd7,0xd5,0x33,0x21,0xfa,0xbe,0xe7,
+    0xbd,0xcd,0xab,0x26,0x13,0x9b,0x26,0xae,0x4f,0x79,
+    0xd2,0x0a,0x24,0x0a,0x22,0xe2,0x26,0x81,0x62,0x4a,
+    0xf1,0xb4,0x4b,0x19,0x96,0x20,0xe5,0x9b,0x39,0x15,
+    0x83,0x3c,0x8d,0xd8,0xfa,0x88,0x43,0xfd,0xc1,0x00,
+    0x8f,0xa1,0x6c,0xa3,0x3b,0xca,0x96,0x94,0x92,0x94,
+    0xde,0x29,0xb3,0x6b,0x91,0x97,0xaf,0xf7,0x88,0x2a,
+    0x0c,0x43,0x31,0xa0,0x48,0x8d,0x98,0xac,0xaf,0x0c,
+    0xfe,0x8d,0xeb,0x74,0x02,0x7d,0x9e,0x76,0x27,0x2c,
+    0x6c,0x71,0xe5,0x06,0x04,0x9d,0x74,0x9e,0x9d,0xba,
+    0x88,0x59,0x8a,0x87,0xca,0xa6,0xcc,0x25,0xd7,0xfd,
+    0xb2,0xa2,0xad,0x20,0x61,0x24,0xc2,0x88,0xd2,0x9d,
+    0xc4,0xc7,0x42,0x9b,0xc7,0x38,0x79,0xcd,0x9a,0xea,
+    0x5c,0x62,0xeb,0xa5,0xee,0xe1,0x0e,0x13,0xbb,0x9c,
+    0xb5,0x75,0x9c,0xe8,0x88,0xd5,0x8d,0x6e,0x75,0x73,
+    0xd1,0x34,0x7e,0xb6,0x98,0x4e,0xe6,0x75,0xdc,0x9d,
+    0xe0,0x25,0x2f,0x8a,0x88,0x7d,0xf6,0x87,0x8f,0x01,
+    0x2a,0x3d,0x49,0xee,0xbb,0xc6,0x28,0x90,0x98,0x92,
+    0x2b,0x43,0xa2,0xb5,0xf0,0x97,0x64,0xac,0xd0,0x21,
+    0xd7,0x53,0x2b,0x84,0xfc,0x90,0x88,0xbe,0xed,0x1a,
+    0x92,0x1c,0xc7,0xb3,0x47,0x47,0x79,0xf6,0x81,0x64,
+    0xa6,0x93,0x49,0x42,0xbb,0x31,0x4d,0x64,0xf4,0x5c,
+    0xdf,0x42,0xdf,0x71,0x3d,0xf4,0xbd,0x10,0x35,0x7c,
+    0x9b,0xe4,0x5c,0xdf,0xc0,0xd7,0xe6,0x22,0x86,0xab,
+    0xe5,0x85,0xc8,0xb1,0x64,0x50,0x28,0x24,0xb9,0x81,
+    0xa1,0x28,0xf2,0x12,0xd4,0x70,0x7c,0x52,0x72,0x14,
+    0xe1,0x36,0x59,0xdb,0xf6,0x3f,0x7c,0xd7,0xb1,0xb0,
+    0x60,0x4b,0x7a,0x81,0x43,0x55,0xcc,0x1b,0x64,0x37,
+    0xea,0x52,0xbb,0xd2,0x5d,0x61,0x8b,0x96,0x47,0xc1,
+    0x40,0x0c,0xed,0xf0,0x7d,0x60,0xe3,0x66,0xf8,0x37,
+    0x78,0x52,0x1c,0x03,0xee,0x4a,0xef,0x82,0x2f,0x3a,
+    0x08,0xc3,0x22,0xe0,0x81,0xe5,0x98,0x01,0x0e,0xb0,
+    0xfb,0xc0,0xde,0x98,0xc0,0x23,0x15,0x19,0x19,0x7c,
+    0x1a,0x8b,0xe9,0x7f,0xc5,0x48,0xd8,0x67
 };
 
@@ -1,70 +1,50 @@
-//this file was auto-generated from "slider_knob.svg" by res2h
+//this file was auto-generated from "slider_knob.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t slider_knob_svg_size = 619;
-const unsigned char slider_knob_svg_data[619] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x45,0x62,0x65,0x6e,
-    0x65,0x5f,0x31,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,
-    0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,
-    0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,
-    0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,
-    0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,
-    0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x36,
-    0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,0x68,0x74,
-    0x3d,0x22,0x31,0x36,0x70,0x78,0x22,0x20,0x76,0x69,
-    0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,
-    0x20,0x31,0x36,0x20,0x31,0x36,0x22,0x20,0x65,0x6e,
-    0x61,0x62,0x6c,0x65,0x2d,0x62,0x61,0x63,0x6b,0x67,
-    0x72,0x6f,0x75,0x6e,0x64,0x3d,0x22,0x6e,0x65,0x77,
-    0x20,0x30,0x20,0x30,0x20,0x31,0x36,0x20,0x31,0x36,
-    0x22,0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,0x61,0x63,
-    0x65,0x3d,0x22,0x70,0x72,0x65,0x73,0x65,0x72,0x76,
-    0x65,0x22,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x66,0x69,0x6c,0x6c,0x2d,0x72,0x75,0x6c,0x65,0x3d,
-    0x22,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,0x22,0x20,
-    0x63,0x6c,0x69,0x70,0x2d,0x72,0x75,0x6c,0x65,0x3d,
-    0x22,0x65,0x76,0x65,0x6e,0x6f,0x64,0x64,0x22,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x37,0x37,0x37,
-    0x37,0x37,0x37,0x22,0x20,0x64,0x3d,0x22,0x4d,0x38,
-    0x2c,0x30,0x63,0x34,0x2e,0x34,0x31,0x38,0x2c,0x30,
-    0x2c,0x38,0x2c,0x33,0x2e,0x35,0x38,0x32,0x2c,0x38,
-    0x2c,0x38,0x63,0x30,0x2c,0x34,0x2e,0x34,0x31,0x38,
-    0x2d,0x33,0x2e,0x35,0x38,0x32,0x2c,0x38,0x2d,0x38,
-    0x2c,0x38,0x73,0x2d,0x38,0x2d,0x33,0x2e,0x35,0x38,
-    0x32,0x2d,0x38,0x2d,0x38,0x0a,0x09,0x43,0x30,0x2c,
-    0x33,0x2e,0x35,0x38,0x32,0x2c,0x33,0x2e,0x35,0x38,
-    0x33,0x2c,0x30,0x2c,0x38,0x2c,0x30,0x7a,0x22,0x2f,
-    0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,0x0a
+const size_t slider_knob_svg_size = 411;
+const unsigned char slider_knob_svg_data[411] = {
+    0x45,0x53,0x5a,0x31,0x6b,0x02,0x00,0x00,0x78,0xda,
+    0x6d,0x51,0xdb,0x4e,0xdc,0x30,0x10,0x7d,0x66,0xbf,
+    0x62,0x70,0x9f,0x2a,0xc5,0x97,0x10,0x0a,0xd9,0x88,
+    0x80,0xba,0x17,0xad,0x56,0x2a,0xed,0x4a,0x50,0xaa,
+    0x3e,0x55,0xd9,0xd8,0x24,0x16,0xae,0x13,0x39,0x4e,
+    0xb2,0xf4,0xeb,0x19,0x87,0xad,0x84,0x10,0x96,0xe5,
+    0xd1,0x9c,0x39,0x73,0xe6,0xe2,0xab,0x9b,0xc3,0x5f,
+    0x03,0x83,0x72,0x9d,0x6e,0x6c,0x4e,0x62,0x26,0x08,
+    0x28,0x5b,0x36,0x52,0xdb,0x2a,0x27,0xbd,0x7f,0xa4,
+    0x29,0xb9,0xb9,0x9e,0x5d,0x9d,0x52,0x0a,0x1b,0x65,
+    0x95,0x2b,0x7c,0xe3,0x32,0xf8,0x2a,0x9b,0xbd,0x82,
+    0xad,0x31,0x7d,0xe7,0x27,0x08,0xe2,0x0b,0x26,0x58,
+    0x12,0xc1,0xdd,0xc3,0x06,0xd6,0x87,0xb6,0x71,0x1e,
+    0x76,0xa6,0xaf,0xe8,0xd6,0x02,0x9b,0xc0,0x87,0xd7,
+    0x1a,0x19,0x20,0x51,0xc0,0xa2,0xd7,0x46,0x82,0xf8,
+    0x0c,0x40,0x69,0x90,0x5f,0xfd,0x58,0xde,0xff,0xde,
+    0xad,0xa1,0x1b,0x2a,0xd8,0xfd,0x5c,0x7c,0xdb,0x2e,
+    0x81,0x50,0xce,0x7f,0x25,0x4b,0xce,0x57,0xf7,0xab,
+    0x49,0x21,0x66,0x31,0xe7,0xeb,0xef,0x04,0x48,0xed,
+    0x7d,0x9b,0x71,0x3e,0x8e,0x23,0x1b,0x13,0xd6,0xb8,
+    0x8a,0x6f,0x5c,0xd1,0xd6,0xba,0xec,0x38,0x12,0x79,
+    0x20,0x62,0x12,0x47,0xb1,0x38,0x66,0xd2,0x4b,0x82,
+    0x25,0x82,0xf2,0x9b,0x39,0x63,0x02,0x5a,0xe6,0x64,
+    0xbd,0xc7,0xa1,0xfe,0xa0,0x83,0x6b,0xb0,0x5d,0xfe,
+    0x81,0xf2,0x99,0x10,0x22,0x28,0x1d,0x29,0xd9,0xc1,
+    0x68,0xfb,0xf4,0x11,0x31,0x9e,0xcf,0xe7,0x7c,0x8a,
+    0x22,0x35,0x27,0xa2,0x3d,0x10,0x78,0x7e,0xb5,0xb3,
+    0x13,0x18,0xb5,0xf4,0x35,0x16,0xbe,0x08,0x70,0xad,
+    0x74,0x55,0xfb,0xff,0xde,0xa0,0xd5,0xb8,0x68,0x42,
+    0x0a,0x08,0xdc,0x23,0xde,0xf0,0x07,0xc5,0xde,0x28,
+    0xba,0x2f,0xca,0xa7,0xca,0x35,0xbd,0xc5,0x56,0xad,
+    0x1a,0xe1,0x0d,0x03,0xbb,0xc9,0xba,0xb6,0x28,0x55,
+    0x4e,0x5a,0xa7,0x3a,0xe5,0x06,0x15,0xc6,0x6c,0x0b,
+    0x5f,0xc3,0xa3,0x36,0x86,0xba,0xde,0x60,0x4c,0x0d,
+    0xca,0x36,0x52,0x12,0x28,0x8d,0x6e,0xdf,0x63,0x81,
+    0x97,0x93,0x4f,0x97,0xd3,0x21,0x80,0x45,0x6e,0xd3,
+    0x48,0x94,0xe7,0xec,0x3c,0x46,0x1b,0xa5,0x51,0xc2,
+    0xbe,0xa4,0x67,0x68,0xd3,0x52,0x44,0x13,0x4a,0x8f,
+    0x08,0x45,0xac,0xa3,0x47,0x17,0x6d,0x3a,0x3b,0x59,
+    0x8a,0x23,0x3d,0xbc,0xc9,0x94,0x2e,0xfe,0x11,0x8e,
+    0x3d,0x85,0xf5,0x5d,0xcf,0x5e,0x00,0x8d,0x9d,0xb3,
+    0x5d
 };
 
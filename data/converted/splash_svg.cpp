@@ -1,1785 +1,575 @@
-//this file was auto-generated from "splash.svg" by res2h
+//this file was auto-generated from "splash.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t splash_svg_size = 17764;
-const unsigned char splash_svg_data[17764] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x30,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x45,0x62,0x65,0x6e,
-    0x65,0x5f,0x31,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,
-    0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,
-    0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,
-    0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,
-    0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,
-    0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x31,0x32,
-    0x38,0x30,0x70,0x78,0x22,0x20,0x68,0x65,0x69,0x67,
-    0x68,0x74,0x3d,0x22,0x37,0x32,0x30,0x70,0x78,0x22,
-    0x20,0x76,0x69,0x65,0x77,0x42,0x6f,0x78,0x3d,0x22,
-    0x30,0x20,0x30,0x20,0x31,0x32,0x38,0x30,0x20,0x37,
-    0x32,0x30,0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,
-    0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-    0x64,0x3d,0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,
-    0x20,0x31,0x32,0x38,0x30,0x20,0x37,0x32,0x30,0x22,
-    0x20,0x78,0x6d,0x6c,0x3a,0x73,0x70,0x61,0x63,0x65,
-    0x3d,0x22,0x70,0x72,0x65,0x73,0x65,0x72,0x76,0x65,
-    0x22,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,
-    0x69,0x6c,0x6c,0x3d,0x22,0x23,0x43,0x39,0x30,0x30,
-    0x31,0x32,0x22,0x20,0x64,0x3d,0x22,0x4d,0x34,0x33,
-    0x31,0x2e,0x35,0x32,0x39,0x2c,0x34,0x34,0x32,0x2e,
-    0x30,0x39,0x37,0x4c,0x34,0x33,0x31,0x2e,0x35,0x32,
-    0x39,0x2c,0x34,0x34,0x32,0x2e,0x30,0x39,0x37,0x4c,
-    0x34,0x33,0x31,0x2e,0x35,0x32,0x39,0x2c,0x34,0x34,
-    0x32,0x2e,0x30,0x39,0x37,0x7a,0x22,0x2f,0x3e,0x0a,
-    0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,
-    0x3d,0x22,0x23,0x43,0x39,0x30,0x30,0x31,0x32,0x22,
-    0x20,0x64,0x3d,0x22,0x4d,0x34,0x33,0x31,0x2e,0x35,
-    0x32,0x39,0x2c,0x33,0x35,0x39,0x2e,0x32,0x31,0x36,
-    0x4c,0x34,0x33,0x31,0x2e,0x35,0x32,0x39,0x2c,0x33,
-    0x35,0x39,0x2e,0x32,0x31,0x36,0x4c,0x34,0x33,0x31,
-    0x2e,0x35,0x32,0x39,0x2c,0x33,0x35,0x39,0x2e,0x32,
-    0x31,0x36,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,
-    0x43,0x39,0x30,0x30,0x31,0x32,0x22,0x20,0x64,0x3d,
-    0x22,0x4d,0x34,0x33,0x31,0x2e,0x35,0x32,0x39,0x2c,
-    0x32,0x37,0x36,0x2e,0x33,0x30,0x36,0x4c,0x34,0x33,
-    0x31,0x2e,0x35,0x32,0x39,0x2c,0x32,0x37,0x36,0x2e,
-    0x33,0x30,0x36,0x4c,0x34,0x33,0x31,0x2e,0x35,0x32,
-    0x39,0x2c,0x32,0x37,0x36,0x2e,0x33,0x30,0x36,0x7a,
-    0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x43,0x39,0x30,
-    0x30,0x31,0x32,0x22,0x20,0x64,0x3d,0x22,0x4d,0x34,
-    0x33,0x31,0x2e,0x35,0x32,0x39,0x2c,0x33,0x31,0x37,
-    0x2e,0x37,0x35,0x33,0x4c,0x34,0x33,0x31,0x2e,0x35,
-    0x32,0x39,0x2c,0x33,0x31,0x37,0x2e,0x37,0x35,0x33,
-    0x4c,0x34,0x33,0x31,0x2e,0x35,0x32,0x39,0x2c,0x33,
-    0x31,0x37,0x2e,0x37,0x35,0x33,0x7a,0x22,0x2f,0x3e,
-    0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,
-    0x6c,0x3d,0x22,0x23,0x43,0x39,0x30,0x30,0x31,0x32,
-    0x22,0x20,0x64,0x3d,0x22,0x4d,0x34,0x33,0x31,0x2e,
-    0x35,0x32,0x39,0x2c,0x34,0x38,0x33,0x2e,0x35,0x34,
-    0x34,0x4c,0x34,0x33,0x31,0x2e,0x35,0x32,0x39,0x2c,
-    0x34,0x38,0x33,0x2e,0x35,0x34,0x34,0x4c,0x34,0x33,
-    0x31,0x2e,0x35,0x32,0x39,0x2c,0x34,0x38,0x33,0x2e,
-    0x35,0x34,0x34,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,
-    0x23,0x43,0x39,0x30,0x30,0x31,0x32,0x22,0x20,0x64,
-    0x3d,0x22,0x4d,0x34,0x33,0x31,0x2e,0x35,0x32,0x39,
-    0x2c,0x34,0x30,0x30,0x2e,0x36,0x34,0x32,0x4c,0x34,
-    0x33,0x31,0x2e,0x35,0x32,0x39,0x2c,0x34,0x30,0x30,
-    0x2e,0x36,0x34,0x32,0x4c,0x34,0x33,0x31,0x2e,0x35,
-    0x32,0x39,0x2c,0x34,0x30,0x30,0x2e,0x36,0x34,0x32,
-    0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,0x23,0x43,0x39,
-    0x30,0x30,0x31,0x32,0x22,0x20,0x64,0x3d,0x22,0x4d,
-    0x34,0x33,0x31,0x2e,0x35,0x32,0x39,0x2c,0x32,0x33,
-    0x34,0x2e,0x38,0x34,0x32,0x4c,0x34,0x33,0x31,0x2e,
-    0x35,0x32,0x39,0x2c,0x32,0x33,0x34,0x2e,0x38,0x34,
-    0x32,0x4c,0x34,0x33,0x31,0x2e,0x35,0x32,0x39,0x2c,
-    0x32,0x33,0x34,0x2e,0x38,0x34,0x32,0x7a,0x22,0x2f,
-    0x3e,0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,
-    0x6c,0x6c,0x3d,0x22,0x23,0x30,0x30,0x34,0x45,0x37,
-    0x33,0x22,0x20,0x64,0x3d,0x22,0x4d,0x34,0x33,0x31,
-    0x2e,0x35,0x32,0x39,0x2c,0x32,0x34,0x35,0x2e,0x39,
-    0x35,0x31,0x63,0x30,0x2d,0x36,0x2e,0x31,0x31,0x2d,
-    0x34,0x2e,0x39,0x39,0x39,0x2d,0x31,0x31,0x2e,0x31,
-    0x30,0x38,0x2d,0x31,0x31,0x2e,0x31,0x30,0x35,0x2d,
-    0x31,0x31,0x2e,0x31,0x30,0x38,0x48,0x36,0x39,0x2e,
-    0x35,0x36,0x33,0x63,0x2d,0x36,0x2e,0x31,0x31,0x32,
-    0x2c,0x30,0x2d,0x31,0x34,0x2e,0x36,0x34,0x34,0x2c,
-    0x33,0x2e,0x35,0x33,0x34,0x2d,0x31,0x38,0x2e,0x39,
-    0x36,0x33,0x2c,0x37,0x2e,0x38,0x35,0x35,0x0a,0x09,
-    0x6c,0x2d,0x32,0x35,0x2e,0x37,0x34,0x35,0x2c,0x32,
-    0x35,0x2e,0x37,0x34,0x35,0x43,0x32,0x30,0x2e,0x35,
-    0x33,0x33,0x2c,0x32,0x37,0x32,0x2e,0x37,0x36,0x34,
-    0x2c,0x31,0x37,0x2c,0x32,0x38,0x31,0x2e,0x32,0x39,
-    0x36,0x2c,0x31,0x37,0x2c,0x32,0x38,0x37,0x2e,0x34,
-    0x30,0x36,0x76,0x32,0x32,0x36,0x2e,0x34,0x36,0x38,
-    0x63,0x30,0x2c,0x36,0x2e,0x31,0x31,0x31,0x2c,0x34,
-    0x2e,0x39,0x39,0x39,0x2c,0x31,0x31,0x2e,0x31,0x30,
-    0x39,0x2c,0x31,0x31,0x2e,0x31,0x30,0x36,0x2c,0x31,
-    0x31,0x2e,0x31,0x30,0x39,0x68,0x33,0x35,0x30,0x2e,
-    0x38,0x36,0x0a,0x09,0x63,0x36,0x2e,0x31,0x30,0x37,
-    0x2c,0x30,0x2c,0x31,0x34,0x2e,0x36,0x34,0x33,0x2d,
-    0x33,0x2e,0x35,0x33,0x35,0x2c,0x31,0x38,0x2e,0x39,
-    0x36,0x33,0x2d,0x37,0x2e,0x38,0x35,0x34,0x6c,0x32,
-    0x35,0x2e,0x37,0x34,0x31,0x2d,0x32,0x35,0x2e,0x37,
-    0x33,0x36,0x63,0x34,0x2e,0x33,0x32,0x2d,0x34,0x2e,
-    0x33,0x31,0x37,0x2c,0x37,0x2e,0x38,0x35,0x34,0x2d,
-    0x31,0x32,0x2e,0x38,0x35,0x33,0x2c,0x37,0x2e,0x38,
-    0x35,0x34,0x2d,0x31,0x38,0x2e,0x39,0x36,0x35,0x4c,
-    0x34,0x33,0x31,0x2e,0x35,0x32,0x39,0x2c,0x32,0x34,
-    0x35,0x2e,0x39,0x35,0x31,0x7a,0x22,0x2f,0x3e,0x0a,
-    0x3c,0x70,0x61,0x74,0x68,0x20,0x6f,0x70,0x61,0x63,
-    0x69,0x74,0x79,0x3d,0x22,0x30,0x2e,0x32,0x22,0x20,
-    0x65,0x6e,0x61,0x62,0x6c,0x65,0x2d,0x62,0x61,0x63,
-    0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3d,0x22,0x6e,
-    0x65,0x77,0x20,0x20,0x20,0x20,0x22,0x20,0x64,0x3d,
-    0x22,0x4d,0x33,0x38,0x32,0x2e,0x32,0x32,0x2c,0x33,
-    0x39,0x32,0x2e,0x37,0x38,0x39,0x6c,0x2d,0x32,0x35,
-    0x2e,0x37,0x33,0x2d,0x32,0x35,0x2e,0x37,0x32,0x39,
-    0x63,0x2d,0x34,0x2e,0x33,0x31,0x39,0x2d,0x34,0x2e,
-    0x33,0x31,0x38,0x2d,0x31,0x32,0x2e,0x38,0x35,0x34,
-    0x2d,0x37,0x2e,0x38,0x35,0x34,0x2d,0x31,0x38,0x2e,
-    0x39,0x36,0x33,0x2d,0x37,0x2e,0x38,0x35,0x32,0x48,
-    0x33,0x31,0x38,0x2e,0x32,0x38,0x0a,0x09,0x63,0x2d,
-    0x36,0x2e,0x31,0x31,0x32,0x2c,0x30,0x2e,0x30,0x30,
-    0x31,0x2d,0x31,0x31,0x2e,0x31,0x31,0x2c,0x30,0x2e,
-    0x30,0x30,0x31,0x2d,0x31,0x31,0x2e,0x31,0x31,0x2c,
-    0x30,0x2e,0x30,0x30,0x31,0x73,0x33,0x2e,0x35,0x33,
-    0x32,0x2d,0x33,0x2e,0x35,0x33,0x34,0x2c,0x37,0x2e,
-    0x38,0x35,0x34,0x2d,0x37,0x2e,0x38,0x35,0x35,0x6c,
-    0x36,0x37,0x2e,0x31,0x39,0x37,0x2d,0x36,0x37,0x2e,
-    0x31,0x39,0x33,0x63,0x34,0x2e,0x33,0x32,0x2d,0x34,
-    0x2e,0x33,0x32,0x31,0x2c,0x32,0x2e,0x38,0x35,0x34,
-    0x2d,0x37,0x2e,0x38,0x35,0x35,0x2d,0x33,0x2e,0x32,
-    0x35,0x33,0x2d,0x37,0x2e,0x38,0x35,0x35,0x48,0x32,
-    0x37,0x36,0x2e,0x38,0x33,0x32,0x0a,0x09,0x63,0x2d,
-    0x36,0x2e,0x31,0x31,0x31,0x2c,0x30,0x2d,0x31,0x34,
-    0x2e,0x36,0x34,0x33,0x2c,0x33,0x2e,0x35,0x33,0x34,
-    0x2d,0x31,0x38,0x2e,0x39,0x36,0x33,0x2c,0x37,0x2e,
-    0x38,0x35,0x35,0x4c,0x32,0x35,0x2e,0x31,0x34,0x32,
-    0x2c,0x35,0x31,0x36,0x2e,0x38,0x36,0x63,0x2d,0x31,
-    0x2e,0x38,0x32,0x35,0x2c,0x31,0x2e,0x38,0x32,0x32,
-    0x2d,0x33,0x2e,0x35,0x31,0x37,0x2c,0x33,0x2e,0x35,
-    0x31,0x34,0x2d,0x34,0x2e,0x38,0x37,0x31,0x2c,0x34,
-    0x2e,0x38,0x36,0x37,0x63,0x32,0x2e,0x30,0x31,0x32,
-    0x2c,0x32,0x2e,0x30,0x31,0x2c,0x34,0x2e,0x37,0x38,
-    0x36,0x2c,0x33,0x2e,0x32,0x35,0x38,0x2c,0x37,0x2e,
-    0x38,0x33,0x36,0x2c,0x33,0x2e,0x32,0x35,0x38,0x0a,
-    0x09,0x63,0x30,0x2e,0x30,0x30,0x35,0x2c,0x30,0x2c,
-    0x30,0x2e,0x30,0x31,0x2c,0x30,0x2c,0x30,0x2e,0x30,
-    0x31,0x36,0x2c,0x30,0x68,0x39,0x39,0x2e,0x39,0x35,
-    0x33,0x68,0x31,0x36,0x37,0x2e,0x39,0x38,0x38,0x63,
-    0x36,0x2e,0x31,0x31,0x31,0x2c,0x30,0x2c,0x31,0x31,
-    0x2e,0x31,0x32,0x32,0x2d,0x30,0x2e,0x30,0x31,0x32,
-    0x2c,0x31,0x31,0x2e,0x31,0x33,0x33,0x2d,0x30,0x2e,
-    0x30,0x32,0x33,0x63,0x30,0x2e,0x30,0x31,0x35,0x2d,
-    0x30,0x2e,0x30,0x31,0x36,0x2c,0x33,0x2e,0x35,0x35,
-    0x39,0x2d,0x33,0x2e,0x35,0x36,0x32,0x2c,0x37,0x2e,
-    0x38,0x38,0x2d,0x37,0x2e,0x38,0x38,0x6c,0x36,0x37,
-    0x2e,0x31,0x34,0x34,0x2d,0x36,0x37,0x2e,0x31,0x33,
-    0x32,0x0a,0x09,0x63,0x34,0x2e,0x33,0x32,0x2d,0x34,
-    0x2e,0x33,0x31,0x36,0x2c,0x37,0x2e,0x38,0x35,0x33,
-    0x2d,0x31,0x32,0x2e,0x38,0x35,0x32,0x2c,0x37,0x2e,
-    0x38,0x35,0x33,0x2d,0x31,0x38,0x2e,0x39,0x36,0x33,
-    0x76,0x2d,0x31,0x39,0x2e,0x32,0x33,0x35,0x43,0x33,
-    0x39,0x30,0x2e,0x30,0x37,0x33,0x2c,0x34,0x30,0x35,
-    0x2e,0x36,0x34,0x2c,0x33,0x38,0x36,0x2e,0x35,0x34,
-    0x2c,0x33,0x39,0x37,0x2e,0x31,0x30,0x34,0x2c,0x33,
-    0x38,0x32,0x2e,0x32,0x32,0x2c,0x33,0x39,0x32,0x2e,
-    0x37,0x38,0x39,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,
-    0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x22,0x20,0x64,
-    0x3d,0x22,0x4d,0x32,0x37,0x36,0x2e,0x38,0x32,0x34,
-    0x2c,0x34,0x30,0x30,0x2e,0x36,0x34,0x39,0x63,0x2d,
-    0x36,0x2e,0x31,0x30,0x38,0x2c,0x30,0x2d,0x31,0x34,
-    0x2e,0x36,0x34,0x33,0x2d,0x33,0x2e,0x35,0x33,0x36,
-    0x2d,0x31,0x38,0x2e,0x39,0x36,0x2d,0x37,0x2e,0x38,
-    0x35,0x37,0x6c,0x2d,0x32,0x35,0x2e,0x37,0x31,0x2d,
-    0x32,0x35,0x2e,0x37,0x31,0x38,0x63,0x2d,0x34,0x2e,
-    0x33,0x32,0x31,0x2d,0x34,0x2e,0x33,0x32,0x31,0x2d,
-    0x37,0x2e,0x38,0x35,0x37,0x2d,0x31,0x32,0x2e,0x38,
-    0x35,0x35,0x2d,0x37,0x2e,0x38,0x36,0x35,0x2d,0x31,
-    0x38,0x2e,0x39,0x36,0x36,0x0a,0x09,0x6c,0x2d,0x30,
-    0x2e,0x30,0x31,0x32,0x2d,0x31,0x39,0x2e,0x32,0x34,
-    0x36,0x63,0x2d,0x30,0x2e,0x30,0x30,0x38,0x2d,0x36,
-    0x2e,0x31,0x31,0x2c,0x33,0x2e,0x35,0x32,0x35,0x2d,
-    0x31,0x34,0x2e,0x36,0x34,0x33,0x2c,0x37,0x2e,0x38,
-    0x34,0x36,0x2d,0x31,0x38,0x2e,0x39,0x36,0x34,0x6c,
-    0x32,0x35,0x2e,0x37,0x34,0x31,0x2d,0x32,0x35,0x2e,
-    0x37,0x33,0x37,0x63,0x34,0x2e,0x33,0x32,0x31,0x2d,
-    0x34,0x2e,0x33,0x32,0x31,0x2c,0x31,0x32,0x2e,0x38,
-    0x35,0x32,0x2d,0x37,0x2e,0x38,0x35,0x35,0x2c,0x31,
-    0x38,0x2e,0x39,0x36,0x33,0x2d,0x37,0x2e,0x38,0x35,
-    0x35,0x68,0x31,0x30,0x32,0x2e,0x31,0x34,0x0a,0x09,
-    0x63,0x36,0x2e,0x31,0x30,0x37,0x2c,0x30,0x2c,0x37,
-    0x2e,0x35,0x37,0x33,0x2c,0x33,0x2e,0x35,0x33,0x34,
-    0x2c,0x33,0x2e,0x32,0x35,0x33,0x2c,0x37,0x2e,0x38,
-    0x35,0x35,0x6c,0x2d,0x32,0x35,0x2e,0x37,0x34,0x31,
-    0x2c,0x32,0x35,0x2e,0x37,0x33,0x37,0x63,0x2d,0x34,
-    0x2e,0x33,0x32,0x31,0x2c,0x34,0x2e,0x33,0x32,0x31,
-    0x2d,0x31,0x32,0x2e,0x38,0x35,0x32,0x2c,0x37,0x2e,
-    0x38,0x35,0x35,0x2d,0x31,0x38,0x2e,0x39,0x36,0x33,
-    0x2c,0x37,0x2e,0x38,0x35,0x35,0x68,0x2d,0x36,0x30,
-    0x2e,0x36,0x38,0x38,0x0a,0x09,0x63,0x2d,0x36,0x2e,
-    0x31,0x31,0x32,0x2c,0x30,0x2d,0x31,0x31,0x2e,0x31,
-    0x31,0x2c,0x34,0x2e,0x39,0x39,0x38,0x2d,0x31,0x31,
-    0x2e,0x31,0x31,0x2c,0x31,0x31,0x2e,0x31,0x30,0x38,
-    0x76,0x31,0x39,0x2e,0x32,0x34,0x36,0x63,0x30,0x2c,
-    0x36,0x2e,0x31,0x31,0x2c,0x34,0x2e,0x39,0x39,0x38,
-    0x2c,0x31,0x31,0x2e,0x31,0x30,0x38,0x2c,0x31,0x31,
-    0x2e,0x31,0x30,0x36,0x2c,0x31,0x31,0x2e,0x31,0x30,
-    0x36,0x6c,0x36,0x30,0x2e,0x37,0x30,0x32,0x2d,0x30,
-    0x2e,0x30,0x30,0x37,0x63,0x36,0x2e,0x31,0x30,0x38,
-    0x2d,0x30,0x2e,0x30,0x30,0x32,0x2c,0x31,0x34,0x2e,
-    0x36,0x34,0x34,0x2c,0x33,0x2e,0x35,0x33,0x33,0x2c,
-    0x31,0x38,0x2e,0x39,0x36,0x33,0x2c,0x37,0x2e,0x38,
-    0x35,0x32,0x0a,0x09,0x6c,0x32,0x35,0x2e,0x37,0x33,
-    0x2c,0x32,0x35,0x2e,0x37,0x32,0x39,0x63,0x34,0x2e,
-    0x33,0x32,0x2c,0x34,0x2e,0x33,0x31,0x35,0x2c,0x37,
-    0x2e,0x38,0x35,0x33,0x2c,0x31,0x32,0x2e,0x38,0x35,
-    0x31,0x2c,0x37,0x2e,0x38,0x35,0x33,0x2c,0x31,0x38,
-    0x2e,0x39,0x36,0x33,0x76,0x31,0x39,0x2e,0x32,0x33,
-    0x35,0x63,0x30,0x2c,0x36,0x2e,0x31,0x31,0x2d,0x33,
-    0x2e,0x35,0x33,0x32,0x2c,0x31,0x34,0x2e,0x36,0x34,
-    0x36,0x2d,0x37,0x2e,0x38,0x35,0x33,0x2c,0x31,0x38,
-    0x2e,0x39,0x36,0x33,0x6c,0x2d,0x32,0x35,0x2e,0x37,
-    0x34,0x31,0x2c,0x32,0x35,0x2e,0x37,0x34,0x0a,0x09,
-    0x63,0x2d,0x34,0x2e,0x33,0x32,0x31,0x2c,0x34,0x2e,
-    0x33,0x31,0x37,0x2d,0x31,0x32,0x2e,0x38,0x35,0x32,
-    0x2c,0x37,0x2e,0x38,0x35,0x34,0x2d,0x31,0x38,0x2e,
-    0x39,0x36,0x33,0x2c,0x37,0x2e,0x38,0x35,0x34,0x68,
-    0x2d,0x36,0x30,0x2e,0x36,0x38,0x38,0x63,0x2d,0x36,
-    0x2e,0x31,0x31,0x32,0x2c,0x30,0x2d,0x31,0x34,0x2e,
-    0x36,0x34,0x33,0x2d,0x33,0x2e,0x35,0x33,0x36,0x2d,
-    0x31,0x38,0x2e,0x39,0x36,0x33,0x2d,0x37,0x2e,0x38,
-    0x35,0x34,0x6c,0x2d,0x32,0x35,0x2e,0x37,0x34,0x31,
-    0x2d,0x32,0x35,0x2e,0x37,0x34,0x0a,0x09,0x63,0x2d,
-    0x34,0x2e,0x33,0x32,0x2d,0x34,0x2e,0x33,0x31,0x36,
-    0x2d,0x32,0x2e,0x38,0x35,0x38,0x2d,0x37,0x2e,0x38,
-    0x35,0x34,0x2c,0x33,0x2e,0x32,0x35,0x33,0x2d,0x37,
-    0x2e,0x38,0x35,0x34,0x68,0x31,0x30,0x32,0x2e,0x31,
-    0x34,0x63,0x36,0x2e,0x31,0x31,0x32,0x2c,0x30,0x2c,
-    0x31,0x31,0x2e,0x31,0x31,0x2d,0x34,0x2e,0x39,0x39,
-    0x38,0x2c,0x31,0x31,0x2e,0x31,0x31,0x2d,0x31,0x31,
-    0x2e,0x31,0x30,0x39,0x56,0x34,0x31,0x31,0x2e,0x37,
-    0x35,0x63,0x30,0x2d,0x36,0x2e,0x31,0x31,0x32,0x2c,
-    0x30,0x2d,0x31,0x31,0x2e,0x31,0x31,0x2c,0x30,0x2e,
-    0x30,0x30,0x33,0x2d,0x31,0x31,0x2e,0x31,0x31,0x0a,
-    0x09,0x63,0x30,0x2e,0x30,0x30,0x34,0x2c,0x30,0x2d,
-    0x34,0x2e,0x39,0x39,0x34,0x2c,0x30,0x2d,0x31,0x31,
-    0x2e,0x31,0x30,0x33,0x2c,0x30,0x4c,0x32,0x37,0x36,
-    0x2e,0x38,0x32,0x34,0x2c,0x34,0x30,0x30,0x2e,0x36,
-    0x34,0x39,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x67,0x20,
-    0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3d,0x22,0x30,
-    0x2e,0x32,0x22,0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,
-    0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,0x37,0x2e,0x30,
-    0x30,0x38,0x2c,0x33,0x37,0x30,0x2e,0x38,0x37,0x37,
-    0x63,0x30,0x2d,0x36,0x2e,0x31,0x31,0x2c,0x30,0x2d,
-    0x31,0x31,0x2e,0x32,0x33,0x38,0x2c,0x30,0x2d,0x31,
-    0x31,0x2e,0x33,0x39,0x33,0x63,0x30,0x2d,0x30,0x2e,
-    0x31,0x35,0x35,0x2c,0x33,0x2e,0x35,0x33,0x32,0x2d,
-    0x33,0x2e,0x38,0x31,0x38,0x2c,0x37,0x2e,0x38,0x35,
-    0x34,0x2d,0x38,0x2e,0x31,0x33,0x38,0x6c,0x36,0x37,
-    0x2e,0x31,0x38,0x35,0x2d,0x36,0x37,0x2e,0x31,0x38,
-    0x36,0x0a,0x09,0x09,0x63,0x34,0x2e,0x33,0x32,0x31,
-    0x2d,0x34,0x2e,0x33,0x32,0x31,0x2c,0x31,0x32,0x2e,
-    0x38,0x35,0x35,0x2d,0x37,0x2e,0x38,0x35,0x35,0x2c,
-    0x31,0x38,0x2e,0x39,0x36,0x33,0x2d,0x37,0x2e,0x38,
-    0x35,0x35,0x68,0x31,0x30,0x32,0x2e,0x31,0x35,0x63,
-    0x36,0x2e,0x31,0x30,0x38,0x2c,0x30,0x2c,0x37,0x2e,
-    0x35,0x37,0x34,0x2c,0x33,0x2e,0x35,0x33,0x34,0x2c,
-    0x33,0x2e,0x32,0x35,0x33,0x2c,0x37,0x2e,0x38,0x35,
-    0x35,0x6c,0x2d,0x36,0x37,0x2e,0x31,0x39,0x37,0x2c,
-    0x36,0x37,0x2e,0x31,0x38,0x32,0x0a,0x09,0x09,0x63,
-    0x2d,0x34,0x2e,0x33,0x32,0x2c,0x34,0x2e,0x33,0x32,
-    0x31,0x2d,0x37,0x2e,0x38,0x35,0x33,0x2c,0x37,0x2e,
-    0x38,0x35,0x35,0x2d,0x37,0x2e,0x38,0x35,0x33,0x2c,
-    0x37,0x2e,0x38,0x35,0x35,0x73,0x34,0x2e,0x39,0x39,
-    0x38,0x2c,0x30,0x2e,0x30,0x30,0x32,0x2c,0x31,0x31,
-    0x2e,0x31,0x31,0x2c,0x30,0x2e,0x30,0x30,0x36,0x6c,
-    0x31,0x39,0x2e,0x32,0x32,0x38,0x2c,0x30,0x2e,0x30,
-    0x30,0x37,0x63,0x36,0x2e,0x31,0x30,0x38,0x2c,0x30,
-    0x2e,0x30,0x30,0x34,0x2c,0x31,0x30,0x2e,0x37,0x35,
-    0x2c,0x34,0x2e,0x39,0x39,0x33,0x2c,0x31,0x30,0x2e,
-    0x33,0x31,0x38,0x2c,0x31,0x31,0x2e,0x30,0x38,0x36,
-    0x6c,0x2d,0x31,0x2e,0x31,0x31,0x34,0x2c,0x31,0x35,
-    0x2e,0x35,0x39,0x32,0x0a,0x09,0x09,0x63,0x2d,0x30,
-    0x2e,0x34,0x33,0x33,0x2c,0x36,0x2e,0x30,0x39,0x32,
-    0x2d,0x31,0x2e,0x37,0x30,0x37,0x2c,0x31,0x31,0x2e,
-    0x39,0x39,0x38,0x2d,0x32,0x2e,0x38,0x33,0x33,0x2c,
-    0x31,0x33,0x2e,0x31,0x32,0x33,0x63,0x2d,0x31,0x2e,
-    0x31,0x32,0x35,0x2c,0x31,0x2e,0x31,0x32,0x35,0x2d,
-    0x35,0x2e,0x35,0x37,0x36,0x2c,0x35,0x2e,0x35,0x38,
-    0x2d,0x39,0x2e,0x38,0x39,0x36,0x2c,0x39,0x2e,0x38,
-    0x39,0x36,0x6c,0x2d,0x32,0x35,0x2e,0x32,0x30,0x31,
-    0x2c,0x32,0x35,0x2e,0x32,0x30,0x31,0x63,0x2d,0x34,
-    0x2e,0x33,0x32,0x2c,0x34,0x2e,0x33,0x31,0x36,0x2d,
-    0x37,0x2e,0x38,0x38,0x35,0x2c,0x37,0x2e,0x38,0x38,
-    0x35,0x2d,0x37,0x2e,0x39,0x32,0x32,0x2c,0x37,0x2e,
-    0x39,0x31,0x38,0x0a,0x09,0x09,0x63,0x2d,0x30,0x2e,
-    0x30,0x33,0x34,0x2c,0x30,0x2e,0x30,0x33,0x35,0x2c,
-    0x34,0x2e,0x39,0x33,0x33,0x2c,0x30,0x2e,0x30,0x36,
-    0x35,0x2c,0x31,0x31,0x2e,0x30,0x34,0x31,0x2c,0x30,
-    0x2e,0x30,0x36,0x32,0x68,0x31,0x37,0x2e,0x39,0x37,
-    0x39,0x63,0x36,0x2e,0x31,0x30,0x38,0x2d,0x30,0x2e,
-    0x30,0x30,0x34,0x2c,0x31,0x34,0x2e,0x37,0x38,0x34,
-    0x2c,0x33,0x2e,0x33,0x37,0x39,0x2c,0x31,0x39,0x2e,
-    0x32,0x38,0x31,0x2c,0x37,0x2e,0x35,0x31,0x38,0x6c,
-    0x32,0x36,0x2e,0x38,0x33,0x36,0x2c,0x32,0x34,0x2e,
-    0x36,0x39,0x35,0x0a,0x09,0x09,0x63,0x34,0x2e,0x34,
-    0x39,0x37,0x2c,0x34,0x2e,0x31,0x33,0x37,0x2c,0x38,
-    0x2e,0x31,0x38,0x31,0x2c,0x37,0x2e,0x36,0x32,0x33,
-    0x2c,0x38,0x2e,0x30,0x35,0x38,0x2c,0x37,0x2e,0x37,
-    0x35,0x63,0x2d,0x30,0x2e,0x31,0x32,0x36,0x2c,0x30,
-    0x2e,0x31,0x32,0x36,0x2d,0x33,0x2e,0x37,0x36,0x36,
-    0x2c,0x33,0x2e,0x37,0x36,0x32,0x2d,0x38,0x2e,0x30,
-    0x38,0x37,0x2c,0x38,0x2e,0x30,0x38,0x33,0x6c,0x2d,
-    0x33,0x34,0x2e,0x38,0x32,0x37,0x2c,0x33,0x34,0x2e,
-    0x38,0x34,0x39,0x6c,0x2d,0x31,0x34,0x37,0x2e,0x32,
-    0x31,0x32,0x2c,0x30,0x2e,0x30,0x30,0x32,0x0a,0x09,
-    0x09,0x63,0x2d,0x36,0x2e,0x31,0x30,0x37,0x2c,0x30,
-    0x2d,0x31,0x31,0x2e,0x31,0x30,0x35,0x2d,0x34,0x2e,
-    0x39,0x39,0x38,0x2d,0x31,0x31,0x2e,0x31,0x30,0x35,
-    0x2d,0x31,0x31,0x2e,0x31,0x31,0x4c,0x31,0x37,0x2e,
-    0x30,0x30,0x38,0x2c,0x33,0x37,0x30,0x2e,0x38,0x37,
-    0x37,0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x67,0x3e,
-    0x0a,0x3c,0x70,0x61,0x74,0x68,0x20,0x66,0x69,0x6c,
-    0x6c,0x3d,0x22,0x23,0x46,0x46,0x46,0x46,0x46,0x46,
-    0x22,0x20,0x64,0x3d,0x22,0x4d,0x31,0x31,0x31,0x2e,
-    0x30,0x31,0x2c,0x34,0x34,0x32,0x2e,0x30,0x39,0x37,
-    0x63,0x2d,0x36,0x2e,0x31,0x30,0x37,0x2c,0x30,0x2d,
-    0x31,0x31,0x2e,0x31,0x30,0x35,0x2d,0x34,0x2e,0x39,
-    0x39,0x38,0x2d,0x31,0x31,0x2e,0x31,0x30,0x35,0x2d,
-    0x31,0x31,0x2e,0x31,0x30,0x39,0x76,0x2d,0x31,0x39,
-    0x2e,0x32,0x33,0x35,0x63,0x30,0x2d,0x36,0x2e,0x31,
-    0x31,0x32,0x2c,0x34,0x2e,0x39,0x39,0x38,0x2d,0x31,
-    0x31,0x2e,0x31,0x31,0x2c,0x31,0x31,0x2e,0x31,0x30,
-    0x35,0x2d,0x31,0x31,0x2e,0x31,0x31,0x68,0x36,0x30,
-    0x2e,0x36,0x39,0x0a,0x09,0x63,0x36,0x2e,0x31,0x30,
-    0x38,0x2c,0x30,0x2c,0x31,0x31,0x2e,0x31,0x30,0x36,
-    0x2d,0x34,0x2e,0x39,0x39,0x38,0x2c,0x31,0x31,0x2e,
-    0x31,0x30,0x36,0x2d,0x31,0x31,0x2e,0x31,0x30,0x39,
-    0x76,0x2d,0x31,0x39,0x2e,0x32,0x30,0x34,0x63,0x30,
-    0x2d,0x36,0x2e,0x31,0x31,0x32,0x2d,0x34,0x2e,0x39,
-    0x39,0x38,0x2d,0x31,0x31,0x2e,0x31,0x31,0x2d,0x31,
-    0x31,0x2e,0x31,0x30,0x36,0x2d,0x31,0x31,0x2e,0x31,
-    0x31,0x68,0x2d,0x36,0x30,0x2e,0x36,0x39,0x63,0x2d,
-    0x36,0x2e,0x31,0x30,0x37,0x2c,0x30,0x2d,0x31,0x31,
-    0x2e,0x31,0x30,0x35,0x2d,0x34,0x2e,0x39,0x39,0x38,
-    0x2d,0x31,0x31,0x2e,0x31,0x30,0x35,0x2d,0x31,0x31,
-    0x2e,0x31,0x30,0x38,0x76,0x2d,0x31,0x39,0x2e,0x32,
-    0x34,0x36,0x0a,0x09,0x63,0x30,0x2d,0x36,0x2e,0x31,
-    0x31,0x2c,0x34,0x2e,0x39,0x39,0x38,0x2d,0x31,0x31,
-    0x2e,0x31,0x30,0x38,0x2c,0x31,0x31,0x2e,0x31,0x30,
-    0x35,0x2d,0x31,0x31,0x2e,0x31,0x30,0x38,0x68,0x36,
-    0x30,0x2e,0x36,0x39,0x63,0x36,0x2e,0x31,0x30,0x38,
-    0x2c,0x30,0x2c,0x31,0x34,0x2e,0x36,0x34,0x33,0x2d,
-    0x33,0x2e,0x35,0x33,0x34,0x2c,0x31,0x38,0x2e,0x39,
-    0x36,0x34,0x2d,0x37,0x2e,0x38,0x35,0x34,0x6c,0x32,
-    0x35,0x2e,0x37,0x34,0x39,0x2d,0x32,0x35,0x2e,0x37,
-    0x34,0x31,0x63,0x34,0x2e,0x33,0x32,0x31,0x2d,0x34,
-    0x2e,0x33,0x31,0x39,0x2c,0x32,0x2e,0x38,0x35,0x35,
-    0x2d,0x37,0x2e,0x38,0x35,0x33,0x2d,0x33,0x2e,0x32,
-    0x35,0x33,0x2d,0x37,0x2e,0x38,0x35,0x33,0x0a,0x09,
-    0x48,0x31,0x31,0x31,0x2e,0x30,0x31,0x63,0x2d,0x36,
-    0x2e,0x31,0x30,0x37,0x2c,0x30,0x2d,0x31,0x34,0x2e,
-    0x36,0x34,0x33,0x2c,0x33,0x2e,0x35,0x33,0x34,0x2d,
-    0x31,0x38,0x2e,0x39,0x36,0x33,0x2c,0x37,0x2e,0x38,
-    0x35,0x35,0x4c,0x36,0x36,0x2e,0x33,0x31,0x2c,0x33,
-    0x30,0x39,0x2e,0x39,0x63,0x2d,0x34,0x2e,0x33,0x32,
-    0x2c,0x34,0x2e,0x33,0x32,0x31,0x2d,0x37,0x2e,0x38,
-    0x35,0x37,0x2c,0x31,0x32,0x2e,0x38,0x35,0x34,0x2d,
-    0x37,0x2e,0x38,0x35,0x37,0x2c,0x31,0x38,0x2e,0x39,
-    0x36,0x34,0x76,0x31,0x30,0x32,0x2e,0x31,0x32,0x35,
-    0x0a,0x09,0x63,0x30,0x2c,0x36,0x2e,0x31,0x31,0x31,
-    0x2c,0x33,0x2e,0x35,0x33,0x37,0x2c,0x31,0x34,0x2e,
-    0x36,0x34,0x36,0x2c,0x37,0x2e,0x38,0x35,0x37,0x2c,
-    0x31,0x38,0x2e,0x39,0x36,0x33,0x6c,0x32,0x35,0x2e,
-    0x37,0x33,0x37,0x2c,0x32,0x35,0x2e,0x37,0x34,0x63,
-    0x34,0x2e,0x33,0x32,0x31,0x2c,0x34,0x2e,0x33,0x31,
-    0x37,0x2c,0x31,0x32,0x2e,0x38,0x35,0x35,0x2c,0x37,
-    0x2e,0x38,0x35,0x34,0x2c,0x31,0x38,0x2e,0x39,0x36,
-    0x33,0x2c,0x37,0x2e,0x38,0x35,0x34,0x68,0x31,0x30,
-    0x32,0x2e,0x31,0x34,0x33,0x63,0x36,0x2e,0x31,0x31,
-    0x32,0x2c,0x30,0x2c,0x37,0x2e,0x35,0x37,0x34,0x2d,
-    0x33,0x2e,0x35,0x33,0x36,0x2c,0x33,0x2e,0x32,0x35,
-    0x33,0x2d,0x37,0x2e,0x38,0x35,0x36,0x0a,0x09,0x6c,
-    0x2d,0x32,0x35,0x2e,0x37,0x34,0x31,0x2d,0x32,0x35,
-    0x2e,0x37,0x34,0x34,0x63,0x2d,0x34,0x2e,0x33,0x32,
-    0x2d,0x34,0x2e,0x33,0x32,0x31,0x2d,0x31,0x32,0x2e,
-    0x38,0x35,0x34,0x2d,0x37,0x2e,0x38,0x35,0x37,0x2d,
-    0x31,0x38,0x2e,0x39,0x36,0x34,0x2d,0x37,0x2e,0x38,
-    0x35,0x37,0x4c,0x31,0x31,0x31,0x2e,0x30,0x31,0x2c,
-    0x34,0x34,0x32,0x2e,0x30,0x39,0x37,0x7a,0x22,0x2f,
-    0x3e,0x0a,0x3c,0x67,0x3e,0x0a,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x35,0x35,0x38,
-    0x2e,0x36,0x30,0x35,0x2c,0x33,0x32,0x36,0x2e,0x35,
-    0x36,0x32,0x63,0x2d,0x31,0x2e,0x36,0x32,0x33,0x2c,
-    0x33,0x2e,0x38,0x2d,0x33,0x2e,0x38,0x35,0x2c,0x37,
-    0x2e,0x31,0x31,0x35,0x2d,0x36,0x2e,0x36,0x38,0x32,
-    0x2c,0x39,0x2e,0x39,0x34,0x33,0x63,0x2d,0x32,0x2e,
-    0x38,0x33,0x32,0x2c,0x32,0x2e,0x38,0x33,0x36,0x2d,
-    0x36,0x2e,0x31,0x34,0x36,0x2c,0x35,0x2e,0x30,0x36,
-    0x2d,0x39,0x2e,0x39,0x34,0x37,0x2c,0x36,0x2e,0x36,
-    0x38,0x32,0x0a,0x09,0x09,0x63,0x2d,0x33,0x2e,0x37,
-    0x39,0x36,0x2c,0x31,0x2e,0x36,0x32,0x33,0x2d,0x37,
-    0x2e,0x38,0x33,0x38,0x2c,0x32,0x2e,0x34,0x33,0x34,
-    0x2d,0x31,0x32,0x2e,0x31,0x31,0x37,0x2c,0x32,0x2e,
-    0x34,0x33,0x34,0x68,0x2d,0x38,0x2e,0x34,0x39,0x36,
-    0x63,0x2d,0x34,0x2e,0x32,0x38,0x33,0x2c,0x30,0x2d,
-    0x38,0x2e,0x33,0x32,0x34,0x2d,0x30,0x2e,0x38,0x31,
-    0x32,0x2d,0x31,0x32,0x2e,0x31,0x32,0x31,0x2d,0x32,
-    0x2e,0x34,0x33,0x34,0x63,0x2d,0x33,0x2e,0x38,0x2d,
-    0x31,0x2e,0x36,0x32,0x33,0x2d,0x37,0x2e,0x31,0x31,
-    0x35,0x2d,0x33,0x2e,0x38,0x34,0x36,0x2d,0x39,0x2e,
-    0x39,0x34,0x32,0x2d,0x36,0x2e,0x36,0x38,0x32,0x0a,
-    0x09,0x09,0x63,0x2d,0x32,0x2e,0x38,0x33,0x36,0x2d,
-    0x32,0x2e,0x38,0x32,0x38,0x2d,0x35,0x2e,0x30,0x36,
-    0x33,0x2d,0x36,0x2e,0x31,0x34,0x33,0x2d,0x36,0x2e,
-    0x36,0x38,0x33,0x2d,0x39,0x2e,0x39,0x34,0x33,0x63,
-    0x2d,0x31,0x2e,0x36,0x32,0x36,0x2d,0x33,0x2e,0x37,
-    0x39,0x36,0x2d,0x32,0x2e,0x34,0x33,0x34,0x2d,0x37,
-    0x2e,0x38,0x33,0x38,0x2d,0x32,0x2e,0x34,0x33,0x34,
-    0x2d,0x31,0x32,0x2e,0x31,0x32,0x31,0x76,0x2d,0x34,
-    0x37,0x2e,0x38,0x35,0x38,0x63,0x30,0x2d,0x34,0x2e,
-    0x32,0x38,0x32,0x2c,0x30,0x2e,0x38,0x30,0x38,0x2d,
-    0x38,0x2e,0x33,0x32,0x34,0x2c,0x32,0x2e,0x34,0x33,
-    0x34,0x2d,0x31,0x32,0x2e,0x31,0x32,0x0a,0x09,0x09,
-    0x63,0x31,0x2e,0x36,0x31,0x39,0x2d,0x33,0x2e,0x38,
-    0x30,0x31,0x2c,0x33,0x2e,0x38,0x34,0x37,0x2d,0x37,
-    0x2e,0x31,0x31,0x35,0x2c,0x36,0x2e,0x36,0x38,0x33,
-    0x2d,0x39,0x2e,0x39,0x34,0x37,0x63,0x32,0x2e,0x38,
-    0x32,0x37,0x2d,0x32,0x2e,0x38,0x33,0x33,0x2c,0x36,
-    0x2e,0x31,0x34,0x33,0x2d,0x35,0x2e,0x30,0x35,0x36,
-    0x2c,0x39,0x2e,0x39,0x34,0x32,0x2d,0x36,0x2e,0x36,
-    0x38,0x32,0x63,0x33,0x2e,0x37,0x39,0x36,0x2d,0x31,
-    0x2e,0x36,0x31,0x39,0x2c,0x37,0x2e,0x38,0x33,0x38,
-    0x2d,0x32,0x2e,0x34,0x33,0x34,0x2c,0x31,0x32,0x2e,
-    0x31,0x32,0x31,0x2d,0x32,0x2e,0x34,0x33,0x34,0x68,
-    0x38,0x2e,0x34,0x39,0x36,0x0a,0x09,0x09,0x63,0x34,
-    0x2e,0x32,0x37,0x39,0x2c,0x30,0x2c,0x38,0x2e,0x33,
-    0x32,0x2c,0x30,0x2e,0x38,0x31,0x35,0x2c,0x31,0x32,
-    0x2e,0x31,0x31,0x37,0x2c,0x32,0x2e,0x34,0x33,0x34,
-    0x63,0x33,0x2e,0x38,0x2c,0x31,0x2e,0x36,0x32,0x36,
-    0x2c,0x37,0x2e,0x31,0x31,0x35,0x2c,0x33,0x2e,0x38,
-    0x35,0x2c,0x39,0x2e,0x39,0x34,0x37,0x2c,0x36,0x2e,
-    0x36,0x38,0x32,0x73,0x35,0x2e,0x30,0x36,0x2c,0x36,
-    0x2e,0x31,0x34,0x36,0x2c,0x36,0x2e,0x36,0x38,0x32,
-    0x2c,0x39,0x2e,0x39,0x34,0x37,0x63,0x31,0x2e,0x36,
-    0x32,0x33,0x2c,0x33,0x2e,0x37,0x39,0x36,0x2c,0x32,
-    0x2e,0x34,0x33,0x34,0x2c,0x37,0x2e,0x38,0x33,0x38,
-    0x2c,0x32,0x2e,0x34,0x33,0x34,0x2c,0x31,0x32,0x2e,
-    0x31,0x32,0x0a,0x09,0x09,0x76,0x32,0x34,0x2e,0x39,
-    0x36,0x34,0x68,0x2d,0x35,0x38,0x2e,0x31,0x31,0x34,
-    0x76,0x32,0x33,0x2e,0x36,0x31,0x38,0x63,0x30,0x2c,
-    0x32,0x2e,0x35,0x35,0x36,0x2c,0x30,0x2e,0x34,0x38,
-    0x31,0x2c,0x34,0x2e,0x39,0x35,0x36,0x2c,0x31,0x2e,
-    0x34,0x35,0x2c,0x37,0x2e,0x32,0x30,0x32,0x63,0x30,
-    0x2e,0x39,0x36,0x35,0x2c,0x32,0x2e,0x32,0x34,0x33,
-    0x2c,0x32,0x2e,0x32,0x37,0x37,0x2c,0x34,0x2e,0x31,
-    0x39,0x35,0x2c,0x33,0x2e,0x39,0x33,0x35,0x2c,0x35,
-    0x2e,0x38,0x35,0x32,0x63,0x31,0x2e,0x36,0x36,0x31,
-    0x2c,0x31,0x2e,0x36,0x35,0x37,0x2c,0x33,0x2e,0x36,
-    0x30,0x39,0x2c,0x32,0x2e,0x39,0x37,0x2c,0x35,0x2e,
-    0x38,0x35,0x35,0x2c,0x33,0x2e,0x39,0x33,0x38,0x0a,
-    0x09,0x09,0x63,0x32,0x2e,0x32,0x34,0x33,0x2c,0x30,
-    0x2e,0x39,0x36,0x34,0x2c,0x34,0x2e,0x36,0x34,0x33,
-    0x2c,0x31,0x2e,0x34,0x34,0x37,0x2c,0x37,0x2e,0x31,
-    0x39,0x39,0x2c,0x31,0x2e,0x34,0x34,0x37,0x68,0x38,
-    0x2e,0x34,0x39,0x36,0x63,0x32,0x2e,0x35,0x35,0x33,
-    0x2c,0x30,0x2c,0x34,0x2e,0x39,0x35,0x32,0x2d,0x30,
-    0x2e,0x34,0x38,0x32,0x2c,0x37,0x2e,0x31,0x39,0x39,
-    0x2d,0x31,0x2e,0x34,0x34,0x37,0x63,0x32,0x2e,0x32,
-    0x34,0x33,0x2d,0x30,0x2e,0x39,0x36,0x38,0x2c,0x34,
-    0x2e,0x31,0x39,0x35,0x2d,0x32,0x2e,0x32,0x38,0x31,
-    0x2c,0x35,0x2e,0x38,0x35,0x32,0x2d,0x33,0x2e,0x39,
-    0x33,0x38,0x0a,0x09,0x09,0x63,0x31,0x2e,0x36,0x35,
-    0x37,0x2d,0x31,0x2e,0x36,0x35,0x37,0x2c,0x32,0x2e,
-    0x39,0x37,0x31,0x2d,0x33,0x2e,0x36,0x30,0x39,0x2c,
-    0x33,0x2e,0x39,0x33,0x38,0x2d,0x35,0x2e,0x38,0x35,
-    0x32,0x63,0x30,0x2e,0x39,0x36,0x34,0x2d,0x32,0x2e,
-    0x32,0x34,0x36,0x2c,0x31,0x2e,0x34,0x35,0x31,0x2d,
-    0x34,0x2e,0x36,0x34,0x36,0x2c,0x31,0x2e,0x34,0x35,
-    0x31,0x2d,0x37,0x2e,0x32,0x30,0x32,0x76,0x2d,0x37,
-    0x2e,0x30,0x34,0x32,0x6c,0x31,0x32,0x2e,0x37,0x33,
-    0x39,0x2c,0x32,0x2e,0x30,0x37,0x76,0x34,0x2e,0x32,
-    0x34,0x38,0x0a,0x09,0x09,0x43,0x35,0x36,0x31,0x2e,
-    0x30,0x33,0x38,0x2c,0x33,0x31,0x38,0x2e,0x37,0x32,
-    0x34,0x2c,0x35,0x36,0x30,0x2e,0x32,0x32,0x38,0x2c,
-    0x33,0x32,0x32,0x2e,0x37,0x36,0x35,0x2c,0x35,0x35,
-    0x38,0x2e,0x36,0x30,0x35,0x2c,0x33,0x32,0x36,0x2e,
-    0x35,0x36,0x32,0x7a,0x20,0x4d,0x35,0x34,0x38,0x2e,
-    0x32,0x39,0x39,0x2c,0x32,0x36,0x35,0x2e,0x38,0x35,
-    0x35,0x63,0x30,0x2d,0x32,0x2e,0x35,0x35,0x33,0x2d,
-    0x30,0x2e,0x34,0x38,0x36,0x2d,0x34,0x2e,0x39,0x35,
-    0x32,0x2d,0x31,0x2e,0x34,0x35,0x31,0x2d,0x37,0x2e,
-    0x31,0x39,0x39,0x0a,0x09,0x09,0x63,0x2d,0x30,0x2e,
-    0x39,0x36,0x38,0x2d,0x32,0x2e,0x32,0x34,0x33,0x2d,
-    0x32,0x2e,0x32,0x38,0x31,0x2d,0x34,0x2e,0x31,0x39,
-    0x34,0x2d,0x33,0x2e,0x39,0x33,0x38,0x2d,0x35,0x2e,
-    0x38,0x35,0x32,0x63,0x2d,0x31,0x2e,0x36,0x35,0x36,
-    0x2d,0x31,0x2e,0x36,0x35,0x38,0x2d,0x33,0x2e,0x36,
-    0x30,0x38,0x2d,0x32,0x2e,0x39,0x37,0x2d,0x35,0x2e,
-    0x38,0x35,0x32,0x2d,0x33,0x2e,0x39,0x33,0x38,0x63,
-    0x2d,0x32,0x2e,0x32,0x34,0x37,0x2d,0x30,0x2e,0x39,
-    0x36,0x34,0x2d,0x34,0x2e,0x36,0x34,0x36,0x2d,0x31,
-    0x2e,0x34,0x35,0x2d,0x37,0x2e,0x31,0x39,0x39,0x2d,
-    0x31,0x2e,0x34,0x35,0x68,0x2d,0x38,0x2e,0x34,0x39,
-    0x36,0x0a,0x09,0x09,0x63,0x2d,0x32,0x2e,0x35,0x35,
-    0x37,0x2c,0x30,0x2d,0x34,0x2e,0x39,0x35,0x36,0x2c,
-    0x30,0x2e,0x34,0x38,0x36,0x2d,0x37,0x2e,0x31,0x39,
-    0x39,0x2c,0x31,0x2e,0x34,0x35,0x63,0x2d,0x32,0x2e,
-    0x32,0x34,0x36,0x2c,0x30,0x2e,0x39,0x36,0x39,0x2d,
-    0x34,0x2e,0x31,0x39,0x34,0x2c,0x32,0x2e,0x32,0x38,
-    0x31,0x2d,0x35,0x2e,0x38,0x35,0x35,0x2c,0x33,0x2e,
-    0x39,0x33,0x38,0x63,0x2d,0x31,0x2e,0x36,0x35,0x37,
-    0x2c,0x31,0x2e,0x36,0x35,0x37,0x2d,0x32,0x2e,0x39,
-    0x37,0x2c,0x33,0x2e,0x36,0x30,0x39,0x2d,0x33,0x2e,
-    0x39,0x33,0x34,0x2c,0x35,0x2e,0x38,0x35,0x32,0x0a,
-    0x09,0x09,0x63,0x2d,0x30,0x2e,0x39,0x36,0x39,0x2c,
-    0x32,0x2e,0x32,0x34,0x37,0x2d,0x31,0x2e,0x34,0x35,
-    0x31,0x2c,0x34,0x2e,0x36,0x34,0x36,0x2d,0x31,0x2e,
-    0x34,0x35,0x31,0x2c,0x37,0x2e,0x31,0x39,0x39,0x56,
-    0x32,0x38,0x31,0x2e,0x36,0x68,0x34,0x35,0x2e,0x33,
-    0x37,0x35,0x4c,0x35,0x34,0x38,0x2e,0x32,0x39,0x39,
-    0x2c,0x32,0x36,0x35,0x2e,0x38,0x35,0x35,0x4c,0x35,
-    0x34,0x38,0x2e,0x32,0x39,0x39,0x2c,0x32,0x36,0x35,
-    0x2e,0x38,0x35,0x35,0x7a,0x22,0x2f,0x3e,0x0a,0x09,
-    0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,
-    0x36,0x39,0x38,0x2e,0x35,0x30,0x36,0x2c,0x33,0x34,
-    0x33,0x2e,0x35,0x35,0x76,0x2d,0x37,0x37,0x2e,0x36,
-    0x39,0x35,0x63,0x30,0x2d,0x32,0x2e,0x35,0x35,0x33,
-    0x2d,0x30,0x2e,0x34,0x38,0x32,0x2d,0x34,0x2e,0x39,
-    0x35,0x32,0x2d,0x31,0x2e,0x34,0x35,0x2d,0x37,0x2e,
-    0x31,0x39,0x39,0x63,0x2d,0x30,0x2e,0x39,0x36,0x39,
-    0x2d,0x32,0x2e,0x32,0x34,0x33,0x2d,0x32,0x2e,0x32,
-    0x37,0x37,0x2d,0x34,0x2e,0x31,0x39,0x34,0x2d,0x33,
-    0x2e,0x39,0x33,0x38,0x2d,0x35,0x2e,0x38,0x35,0x32,
-    0x0a,0x09,0x09,0x63,0x2d,0x31,0x2e,0x36,0x35,0x32,
-    0x2d,0x31,0x2e,0x36,0x35,0x37,0x2d,0x33,0x2e,0x36,
-    0x30,0x38,0x2d,0x32,0x2e,0x39,0x37,0x2d,0x35,0x2e,
-    0x38,0x35,0x32,0x2d,0x33,0x2e,0x39,0x33,0x38,0x63,
-    0x2d,0x32,0x2e,0x32,0x34,0x37,0x2d,0x30,0x2e,0x39,
-    0x36,0x34,0x2d,0x34,0x2e,0x36,0x34,0x36,0x2d,0x31,
-    0x2e,0x34,0x35,0x2d,0x37,0x2e,0x31,0x39,0x39,0x2d,
-    0x31,0x2e,0x34,0x35,0x68,0x2d,0x36,0x2e,0x33,0x31,
-    0x37,0x63,0x2d,0x32,0x2e,0x35,0x35,0x38,0x2c,0x30,
-    0x2d,0x34,0x2e,0x39,0x35,0x36,0x2c,0x30,0x2e,0x34,
-    0x38,0x36,0x2d,0x37,0x2e,0x32,0x30,0x32,0x2c,0x31,
-    0x2e,0x34,0x35,0x0a,0x09,0x09,0x63,0x2d,0x32,0x2e,
-    0x32,0x34,0x33,0x2c,0x30,0x2e,0x39,0x36,0x39,0x2d,
-    0x34,0x2e,0x32,0x31,0x2c,0x32,0x2e,0x32,0x38,0x31,
-    0x2d,0x35,0x2e,0x39,0x30,0x32,0x2c,0x33,0x2e,0x39,
-    0x33,0x38,0x63,0x2d,0x31,0x2e,0x36,0x39,0x35,0x2c,
-    0x31,0x2e,0x36,0x35,0x37,0x2d,0x33,0x2e,0x30,0x32,
-    0x33,0x2c,0x33,0x2e,0x36,0x30,0x39,0x2d,0x33,0x2e,
-    0x39,0x39,0x31,0x2c,0x35,0x2e,0x38,0x35,0x32,0x63,
-    0x2d,0x30,0x2e,0x39,0x36,0x35,0x2c,0x32,0x2e,0x32,
-    0x34,0x37,0x2d,0x31,0x2e,0x34,0x34,0x35,0x2c,0x34,
-    0x2e,0x36,0x34,0x36,0x2d,0x31,0x2e,0x34,0x34,0x35,
-    0x2c,0x37,0x2e,0x31,0x39,0x39,0x76,0x37,0x37,0x2e,
-    0x36,0x39,0x35,0x68,0x2d,0x31,0x32,0x2e,0x36,0x34,
-    0x33,0x0a,0x09,0x09,0x76,0x2d,0x37,0x37,0x2e,0x36,
-    0x39,0x35,0x63,0x30,0x2d,0x32,0x2e,0x35,0x35,0x33,
-    0x2d,0x30,0x2e,0x34,0x38,0x32,0x2d,0x34,0x2e,0x39,
-    0x35,0x32,0x2d,0x31,0x2e,0x34,0x35,0x2d,0x37,0x2e,
-    0x31,0x39,0x39,0x63,0x2d,0x30,0x2e,0x39,0x36,0x38,
-    0x2d,0x32,0x2e,0x32,0x34,0x33,0x2d,0x32,0x2e,0x32,
-    0x39,0x36,0x2d,0x34,0x2e,0x31,0x39,0x34,0x2d,0x33,
-    0x2e,0x39,0x38,0x37,0x2d,0x35,0x2e,0x38,0x35,0x32,
-    0x63,0x2d,0x31,0x2e,0x36,0x39,0x31,0x2d,0x31,0x2e,
-    0x36,0x35,0x37,0x2d,0x33,0x2e,0x36,0x35,0x38,0x2d,
-    0x32,0x2e,0x39,0x37,0x2d,0x35,0x2e,0x39,0x30,0x35,
-    0x2d,0x33,0x2e,0x39,0x33,0x38,0x0a,0x09,0x09,0x63,
-    0x2d,0x32,0x2e,0x32,0x34,0x32,0x2d,0x30,0x2e,0x39,
-    0x36,0x34,0x2d,0x34,0x2e,0x36,0x34,0x33,0x2d,0x31,
-    0x2e,0x34,0x35,0x2d,0x37,0x2e,0x31,0x39,0x39,0x2d,
-    0x31,0x2e,0x34,0x35,0x68,0x2d,0x36,0x2e,0x33,0x31,
-    0x38,0x63,0x2d,0x32,0x2e,0x35,0x35,0x37,0x2c,0x30,
-    0x2d,0x34,0x2e,0x39,0x35,0x36,0x2c,0x30,0x2e,0x34,
-    0x38,0x36,0x2d,0x37,0x2e,0x31,0x39,0x38,0x2c,0x31,
-    0x2e,0x34,0x35,0x63,0x2d,0x32,0x2e,0x32,0x34,0x37,
-    0x2c,0x30,0x2e,0x39,0x36,0x39,0x2d,0x34,0x2e,0x31,
-    0x39,0x35,0x2c,0x32,0x2e,0x32,0x38,0x31,0x2d,0x35,
-    0x2e,0x38,0x35,0x35,0x2c,0x33,0x2e,0x39,0x33,0x38,
-    0x0a,0x09,0x09,0x63,0x2d,0x31,0x2e,0x36,0x35,0x37,
-    0x2c,0x31,0x2e,0x36,0x35,0x37,0x2d,0x32,0x2e,0x39,
-    0x37,0x2c,0x33,0x2e,0x36,0x30,0x39,0x2d,0x33,0x2e,
-    0x39,0x33,0x35,0x2c,0x35,0x2e,0x38,0x35,0x32,0x63,
-    0x2d,0x30,0x2e,0x39,0x36,0x38,0x2c,0x32,0x2e,0x32,
-    0x34,0x37,0x2d,0x31,0x2e,0x34,0x35,0x2c,0x34,0x2e,
-    0x36,0x34,0x36,0x2d,0x31,0x2e,0x34,0x35,0x2c,0x37,
-    0x2e,0x31,0x39,0x39,0x76,0x37,0x37,0x2e,0x36,0x39,
-    0x35,0x68,0x2d,0x31,0x32,0x2e,0x37,0x34,0x31,0x56,
-    0x32,0x33,0x37,0x2e,0x34,0x37,0x34,0x68,0x34,0x2e,
-    0x32,0x34,0x34,0x6c,0x36,0x2e,0x39,0x34,0x33,0x2c,
-    0x31,0x30,0x2e,0x37,0x37,0x33,0x0a,0x09,0x09,0x63,
-    0x32,0x2e,0x38,0x39,0x39,0x2d,0x33,0x2e,0x39,0x33,
-    0x38,0x2c,0x36,0x2e,0x35,0x34,0x2d,0x37,0x2e,0x30,
-    0x36,0x31,0x2c,0x31,0x30,0x2e,0x39,0x33,0x2d,0x39,
-    0x2e,0x33,0x37,0x36,0x63,0x34,0x2e,0x33,0x38,0x32,
-    0x2d,0x32,0x2e,0x33,0x31,0x32,0x2c,0x39,0x2e,0x31,
-    0x36,0x36,0x2d,0x33,0x2e,0x34,0x37,0x31,0x2c,0x31,
-    0x34,0x2e,0x33,0x34,0x34,0x2d,0x33,0x2e,0x34,0x37,
-    0x31,0x68,0x31,0x2e,0x30,0x33,0x37,0x63,0x36,0x2e,
-    0x30,0x30,0x39,0x2c,0x30,0x2c,0x31,0x31,0x2e,0x34,
-    0x32,0x38,0x2c,0x31,0x2e,0x34,0x38,0x35,0x2c,0x31,
-    0x36,0x2e,0x32,0x36,0x36,0x2c,0x34,0x2e,0x34,0x35,
-    0x35,0x0a,0x09,0x09,0x63,0x34,0x2e,0x38,0x33,0x33,
-    0x2c,0x32,0x2e,0x39,0x37,0x2c,0x38,0x2e,0x35,0x36,
-    0x32,0x2c,0x36,0x2e,0x39,0x30,0x38,0x2c,0x31,0x31,
-    0x2e,0x31,0x38,0x37,0x2c,0x31,0x31,0x2e,0x38,0x31,
-    0x31,0x63,0x31,0x2e,0x33,0x31,0x32,0x2d,0x32,0x2e,
-    0x34,0x31,0x39,0x2c,0x32,0x2e,0x39,0x33,0x36,0x2d,
-    0x34,0x2e,0x36,0x32,0x37,0x2c,0x34,0x2e,0x38,0x36,
-    0x39,0x2d,0x36,0x2e,0x36,0x32,0x39,0x63,0x31,0x2e,
-    0x39,0x33,0x33,0x2d,0x32,0x2e,0x30,0x30,0x35,0x2c,
-    0x34,0x2e,0x30,0x37,0x35,0x2d,0x33,0x2e,0x37,0x31,
-    0x32,0x2c,0x36,0x2e,0x34,0x32,0x32,0x2d,0x35,0x2e,
-    0x31,0x32,0x38,0x0a,0x09,0x09,0x63,0x32,0x2e,0x33,
-    0x35,0x2d,0x31,0x2e,0x34,0x31,0x36,0x2c,0x34,0x2e,
-    0x39,0x30,0x36,0x2d,0x32,0x2e,0x35,0x32,0x32,0x2c,
-    0x37,0x2e,0x36,0x36,0x39,0x2d,0x33,0x2e,0x33,0x31,
-    0x38,0x63,0x32,0x2e,0x37,0x36,0x2d,0x30,0x2e,0x37,
-    0x39,0x32,0x2c,0x35,0x2e,0x36,0x32,0x36,0x2d,0x31,
-    0x2e,0x31,0x39,0x2c,0x38,0x2e,0x35,0x39,0x36,0x2d,
-    0x31,0x2e,0x31,0x39,0x68,0x31,0x2e,0x30,0x33,0x37,
-    0x63,0x34,0x2e,0x32,0x37,0x39,0x2c,0x30,0x2c,0x38,
-    0x2e,0x33,0x32,0x2c,0x30,0x2e,0x38,0x31,0x35,0x2c,
-    0x31,0x32,0x2e,0x31,0x32,0x31,0x2c,0x32,0x2e,0x34,
-    0x33,0x34,0x0a,0x09,0x09,0x63,0x33,0x2e,0x37,0x39,
-    0x36,0x2c,0x31,0x2e,0x36,0x32,0x36,0x2c,0x37,0x2e,
-    0x31,0x31,0x34,0x2c,0x33,0x2e,0x38,0x35,0x2c,0x39,
-    0x2e,0x39,0x34,0x36,0x2c,0x36,0x2e,0x36,0x38,0x32,
-    0x63,0x32,0x2e,0x38,0x32,0x38,0x2c,0x32,0x2e,0x38,
-    0x33,0x32,0x2c,0x35,0x2e,0x30,0x35,0x36,0x2c,0x36,
-    0x2e,0x31,0x34,0x36,0x2c,0x36,0x2e,0x36,0x38,0x33,
-    0x2c,0x39,0x2e,0x39,0x34,0x37,0x63,0x31,0x2e,0x36,
-    0x31,0x38,0x2c,0x33,0x2e,0x37,0x39,0x36,0x2c,0x32,
-    0x2e,0x34,0x33,0x35,0x2c,0x37,0x2e,0x38,0x33,0x38,
-    0x2c,0x32,0x2e,0x34,0x33,0x35,0x2c,0x31,0x32,0x2e,
-    0x31,0x32,0x76,0x37,0x36,0x2e,0x39,0x36,0x38,0x68,
-    0x2d,0x31,0x32,0x2e,0x37,0x34,0x37,0x0a,0x09,0x09,
-    0x56,0x33,0x34,0x33,0x2e,0x35,0x35,0x7a,0x22,0x2f,
-    0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,
-    0x3d,0x22,0x4d,0x38,0x30,0x33,0x2e,0x33,0x34,0x33,
-    0x2c,0x33,0x34,0x33,0x2e,0x35,0x35,0x6c,0x2d,0x37,
-    0x2e,0x30,0x34,0x36,0x2d,0x31,0x30,0x2e,0x37,0x37,
-    0x33,0x63,0x2d,0x32,0x2e,0x39,0x30,0x31,0x2c,0x33,
-    0x2e,0x39,0x33,0x38,0x2d,0x36,0x2e,0x35,0x32,0x35,
-    0x2c,0x37,0x2e,0x30,0x36,0x31,0x2d,0x31,0x30,0x2e,
-    0x38,0x37,0x38,0x2c,0x39,0x2e,0x33,0x37,0x36,0x63,
-    0x2d,0x34,0x2e,0x33,0x34,0x38,0x2c,0x32,0x2e,0x33,
-    0x31,0x32,0x2d,0x39,0x2e,0x31,0x31,0x35,0x2c,0x33,
-    0x2e,0x34,0x36,0x37,0x2d,0x31,0x34,0x2e,0x32,0x39,
-    0x34,0x2c,0x33,0x2e,0x34,0x36,0x37,0x68,0x2d,0x33,
-    0x2e,0x32,0x31,0x31,0x0a,0x09,0x09,0x63,0x2d,0x34,
-    0x2e,0x32,0x38,0x36,0x2c,0x30,0x2d,0x38,0x2e,0x33,
-    0x32,0x33,0x2d,0x30,0x2e,0x38,0x31,0x32,0x2d,0x31,
-    0x32,0x2e,0x31,0x32,0x2d,0x32,0x2e,0x34,0x33,0x34,
-    0x63,0x2d,0x33,0x2e,0x38,0x30,0x31,0x2d,0x31,0x2e,
-    0x36,0x32,0x33,0x2d,0x37,0x2e,0x31,0x31,0x34,0x2d,
-    0x33,0x2e,0x38,0x34,0x36,0x2d,0x39,0x2e,0x39,0x34,
-    0x36,0x2d,0x36,0x2e,0x36,0x38,0x32,0x63,0x2d,0x32,
-    0x2e,0x38,0x33,0x32,0x2d,0x32,0x2e,0x38,0x32,0x38,
-    0x2d,0x35,0x2e,0x30,0x36,0x31,0x2d,0x36,0x2e,0x31,
-    0x34,0x33,0x2d,0x36,0x2e,0x36,0x38,0x34,0x2d,0x39,
-    0x2e,0x39,0x34,0x33,0x0a,0x09,0x09,0x63,0x2d,0x31,
-    0x2e,0x36,0x32,0x32,0x2d,0x33,0x2e,0x37,0x39,0x36,
-    0x2d,0x32,0x2e,0x34,0x33,0x34,0x2d,0x37,0x2e,0x38,
-    0x33,0x38,0x2d,0x32,0x2e,0x34,0x33,0x34,0x2d,0x31,
-    0x32,0x2e,0x31,0x32,0x31,0x76,0x2d,0x37,0x36,0x2e,
-    0x39,0x36,0x36,0x68,0x31,0x32,0x2e,0x37,0x34,0x34,
-    0x76,0x37,0x37,0x2e,0x36,0x39,0x31,0x63,0x30,0x2c,
-    0x32,0x2e,0x35,0x35,0x36,0x2c,0x30,0x2e,0x34,0x38,
-    0x31,0x2c,0x34,0x2e,0x39,0x35,0x36,0x2c,0x31,0x2e,
-    0x34,0x34,0x36,0x2c,0x37,0x2e,0x32,0x30,0x32,0x0a,
-    0x09,0x09,0x63,0x30,0x2e,0x39,0x36,0x39,0x2c,0x32,
-    0x2e,0x32,0x34,0x33,0x2c,0x32,0x2e,0x32,0x38,0x2c,
-    0x34,0x2e,0x31,0x39,0x35,0x2c,0x33,0x2e,0x39,0x33,
-    0x38,0x2c,0x35,0x2e,0x38,0x35,0x32,0x63,0x31,0x2e,
-    0x36,0x35,0x37,0x2c,0x31,0x2e,0x36,0x35,0x37,0x2c,
-    0x33,0x2e,0x36,0x30,0x39,0x2c,0x32,0x2e,0x39,0x37,
-    0x2c,0x35,0x2e,0x38,0x35,0x32,0x2c,0x33,0x2e,0x39,
-    0x33,0x38,0x63,0x32,0x2e,0x32,0x34,0x32,0x2c,0x30,
-    0x2e,0x39,0x36,0x34,0x2c,0x34,0x2e,0x36,0x34,0x36,
-    0x2c,0x31,0x2e,0x34,0x34,0x37,0x2c,0x37,0x2e,0x32,
-    0x30,0x33,0x2c,0x31,0x2e,0x34,0x34,0x37,0x68,0x38,
-    0x2e,0x34,0x39,0x36,0x0a,0x09,0x09,0x63,0x32,0x2e,
-    0x35,0x34,0x39,0x2c,0x30,0x2c,0x34,0x2e,0x39,0x35,
-    0x32,0x2d,0x30,0x2e,0x34,0x38,0x32,0x2c,0x37,0x2e,
-    0x31,0x39,0x34,0x2d,0x31,0x2e,0x34,0x34,0x37,0x63,
-    0x32,0x2e,0x32,0x34,0x33,0x2d,0x30,0x2e,0x39,0x36,
-    0x38,0x2c,0x34,0x2e,0x31,0x39,0x38,0x2d,0x32,0x2e,
-    0x32,0x38,0x31,0x2c,0x35,0x2e,0x38,0x35,0x34,0x2d,
-    0x33,0x2e,0x39,0x33,0x38,0x63,0x31,0x2e,0x36,0x35,
-    0x37,0x2d,0x31,0x2e,0x36,0x35,0x37,0x2c,0x32,0x2e,
-    0x39,0x37,0x31,0x2d,0x33,0x2e,0x36,0x30,0x39,0x2c,
-    0x33,0x2e,0x39,0x33,0x36,0x2d,0x35,0x2e,0x38,0x35,
-    0x32,0x0a,0x09,0x09,0x63,0x30,0x2e,0x39,0x36,0x39,
-    0x2d,0x32,0x2e,0x32,0x34,0x36,0x2c,0x31,0x2e,0x34,
-    0x35,0x34,0x2d,0x34,0x2e,0x36,0x34,0x36,0x2c,0x31,
-    0x2e,0x34,0x35,0x34,0x2d,0x37,0x2e,0x32,0x30,0x32,
-    0x76,0x2d,0x37,0x37,0x2e,0x36,0x39,0x31,0x68,0x31,
-    0x32,0x2e,0x37,0x33,0x36,0x56,0x33,0x34,0x33,0x2e,
-    0x35,0x35,0x48,0x38,0x30,0x33,0x2e,0x33,0x34,0x33,
-    0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,
-    0x68,0x20,0x64,0x3d,0x22,0x4d,0x38,0x33,0x37,0x2e,
-    0x33,0x31,0x39,0x2c,0x33,0x34,0x33,0x2e,0x35,0x35,
-    0x56,0x31,0x39,0x35,0x68,0x31,0x32,0x2e,0x37,0x34,
-    0x76,0x31,0x34,0x38,0x2e,0x35,0x35,0x48,0x38,0x33,
-    0x37,0x2e,0x33,0x31,0x39,0x7a,0x22,0x2f,0x3e,0x0a,
-    0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,
-    0x4d,0x39,0x34,0x36,0x2e,0x34,0x30,0x34,0x2c,0x33,
-    0x34,0x33,0x2e,0x35,0x35,0x6c,0x2d,0x37,0x2e,0x30,
-    0x34,0x36,0x2d,0x31,0x30,0x2e,0x35,0x36,0x37,0x63,
-    0x2d,0x32,0x2e,0x39,0x2c,0x33,0x2e,0x38,0x2d,0x36,
-    0x2e,0x35,0x32,0x35,0x2c,0x36,0x2e,0x38,0x35,0x34,
-    0x2d,0x31,0x30,0x2e,0x38,0x38,0x31,0x2c,0x39,0x2e,
-    0x31,0x37,0x63,0x2d,0x34,0x2e,0x33,0x34,0x38,0x2c,
-    0x32,0x2e,0x33,0x31,0x32,0x2d,0x39,0x2e,0x31,0x31,
-    0x36,0x2c,0x33,0x2e,0x34,0x36,0x37,0x2d,0x31,0x34,
-    0x2e,0x32,0x39,0x2c,0x33,0x2e,0x34,0x36,0x37,0x68,
-    0x2d,0x33,0x2e,0x32,0x31,0x35,0x0a,0x09,0x09,0x63,
-    0x2d,0x34,0x2e,0x32,0x38,0x32,0x2c,0x30,0x2d,0x38,
-    0x2e,0x33,0x32,0x2d,0x30,0x2e,0x38,0x31,0x32,0x2d,
-    0x31,0x32,0x2e,0x31,0x31,0x36,0x2d,0x32,0x2e,0x34,
-    0x33,0x34,0x63,0x2d,0x33,0x2e,0x38,0x30,0x35,0x2d,
-    0x31,0x2e,0x36,0x32,0x33,0x2d,0x37,0x2e,0x31,0x31,
-    0x39,0x2d,0x33,0x2e,0x38,0x34,0x36,0x2d,0x39,0x2e,
-    0x39,0x34,0x37,0x2d,0x36,0x2e,0x36,0x38,0x32,0x63,
-    0x2d,0x32,0x2e,0x38,0x33,0x36,0x2d,0x32,0x2e,0x38,
-    0x32,0x38,0x2d,0x35,0x2e,0x30,0x36,0x32,0x2d,0x36,
-    0x2e,0x31,0x34,0x33,0x2d,0x36,0x2e,0x36,0x38,0x32,
-    0x2d,0x39,0x2e,0x39,0x34,0x33,0x0a,0x09,0x09,0x63,
-    0x2d,0x31,0x2e,0x36,0x32,0x37,0x2d,0x33,0x2e,0x37,
-    0x39,0x36,0x2d,0x32,0x2e,0x34,0x33,0x36,0x2d,0x37,
-    0x2e,0x38,0x33,0x38,0x2d,0x32,0x2e,0x34,0x33,0x36,
-    0x2d,0x31,0x32,0x2e,0x31,0x32,0x31,0x76,0x2d,0x31,
-    0x2e,0x30,0x33,0x37,0x63,0x30,0x2d,0x34,0x2e,0x32,
-    0x37,0x39,0x2c,0x30,0x2e,0x38,0x30,0x39,0x2d,0x38,
-    0x2e,0x33,0x32,0x2c,0x32,0x2e,0x34,0x33,0x36,0x2d,
-    0x31,0x32,0x2e,0x31,0x32,0x31,0x63,0x31,0x2e,0x36,
-    0x31,0x38,0x2d,0x33,0x2e,0x37,0x39,0x36,0x2c,0x33,
-    0x2e,0x38,0x34,0x36,0x2d,0x37,0x2e,0x31,0x31,0x31,
-    0x2c,0x36,0x2e,0x36,0x38,0x32,0x2d,0x39,0x2e,0x39,
-    0x34,0x33,0x0a,0x09,0x09,0x63,0x32,0x2e,0x38,0x32,
-    0x38,0x2d,0x32,0x2e,0x38,0x33,0x32,0x2c,0x36,0x2e,
-    0x31,0x34,0x34,0x2d,0x35,0x2e,0x30,0x36,0x2c,0x39,
-    0x2e,0x39,0x34,0x37,0x2d,0x36,0x2e,0x36,0x38,0x32,
-    0x63,0x33,0x2e,0x37,0x39,0x36,0x2d,0x31,0x2e,0x36,
-    0x32,0x33,0x2c,0x37,0x2e,0x38,0x33,0x34,0x2d,0x32,
-    0x2e,0x34,0x33,0x34,0x2c,0x31,0x32,0x2e,0x31,0x31,
-    0x36,0x2d,0x32,0x2e,0x34,0x33,0x34,0x68,0x32,0x36,
-    0x2e,0x39,0x33,0x36,0x76,0x2d,0x31,0x36,0x2e,0x33,
-    0x36,0x38,0x63,0x30,0x2d,0x32,0x2e,0x35,0x35,0x33,
-    0x2d,0x30,0x2e,0x34,0x38,0x31,0x2d,0x34,0x2e,0x39,
-    0x35,0x32,0x2d,0x31,0x2e,0x34,0x35,0x2d,0x37,0x2e,
-    0x31,0x39,0x39,0x0a,0x09,0x09,0x63,0x2d,0x30,0x2e,
-    0x39,0x36,0x39,0x2d,0x32,0x2e,0x32,0x34,0x33,0x2d,
-    0x32,0x2e,0x32,0x37,0x36,0x2d,0x34,0x2e,0x31,0x39,
-    0x34,0x2d,0x33,0x2e,0x39,0x33,0x38,0x2d,0x35,0x2e,
-    0x38,0x35,0x32,0x63,0x2d,0x31,0x2e,0x36,0x35,0x33,
-    0x2d,0x31,0x2e,0x36,0x35,0x37,0x2d,0x33,0x2e,0x36,
-    0x30,0x39,0x2d,0x32,0x2e,0x39,0x37,0x2d,0x35,0x2e,
-    0x38,0x35,0x33,0x2d,0x33,0x2e,0x39,0x33,0x38,0x63,
-    0x2d,0x32,0x2e,0x32,0x34,0x36,0x2d,0x30,0x2e,0x39,
-    0x36,0x34,0x2d,0x34,0x2e,0x36,0x34,0x36,0x2d,0x31,
-    0x2e,0x34,0x35,0x2d,0x37,0x2e,0x31,0x39,0x38,0x2d,
-    0x31,0x2e,0x34,0x35,0x68,0x2d,0x37,0x2e,0x34,0x35,
-    0x39,0x0a,0x09,0x09,0x63,0x2d,0x32,0x2e,0x35,0x35,
-    0x38,0x2c,0x30,0x2d,0x34,0x2e,0x39,0x35,0x36,0x2c,
-    0x30,0x2e,0x34,0x38,0x36,0x2d,0x37,0x2e,0x31,0x39,
-    0x38,0x2c,0x31,0x2e,0x34,0x35,0x63,0x2d,0x32,0x2e,
-    0x32,0x34,0x37,0x2c,0x30,0x2e,0x39,0x36,0x39,0x2d,
-    0x34,0x2e,0x31,0x39,0x35,0x2c,0x32,0x2e,0x32,0x38,
-    0x31,0x2d,0x35,0x2e,0x38,0x35,0x36,0x2c,0x33,0x2e,
-    0x39,0x33,0x38,0x63,0x2d,0x31,0x2e,0x36,0x35,0x32,
-    0x2c,0x31,0x2e,0x36,0x35,0x37,0x2d,0x32,0x2e,0x39,
-    0x37,0x2c,0x33,0x2e,0x36,0x30,0x39,0x2d,0x33,0x2e,
-    0x39,0x33,0x34,0x2c,0x35,0x2e,0x38,0x35,0x32,0x0a,
-    0x09,0x09,0x63,0x2d,0x30,0x2e,0x39,0x36,0x39,0x2c,
-    0x32,0x2e,0x32,0x34,0x37,0x2d,0x31,0x2e,0x34,0x35,
-    0x31,0x2c,0x34,0x2e,0x36,0x34,0x36,0x2d,0x31,0x2e,
-    0x34,0x35,0x31,0x2c,0x37,0x2e,0x31,0x39,0x39,0x76,
-    0x33,0x2e,0x38,0x33,0x35,0x6c,0x2d,0x31,0x32,0x2e,
-    0x37,0x34,0x2d,0x32,0x2e,0x30,0x37,0x35,0x76,0x2d,
-    0x31,0x2e,0x30,0x33,0x33,0x63,0x30,0x2d,0x34,0x2e,
-    0x32,0x38,0x32,0x2c,0x30,0x2e,0x38,0x31,0x32,0x2d,
-    0x38,0x2e,0x33,0x32,0x34,0x2c,0x32,0x2e,0x34,0x33,
-    0x36,0x2d,0x31,0x32,0x2e,0x31,0x32,0x0a,0x09,0x09,
-    0x63,0x31,0x2e,0x36,0x32,0x32,0x2d,0x33,0x2e,0x38,
-    0x30,0x31,0x2c,0x33,0x2e,0x38,0x35,0x2d,0x37,0x2e,
-    0x31,0x31,0x35,0x2c,0x36,0x2e,0x36,0x38,0x32,0x2d,
-    0x39,0x2e,0x39,0x34,0x37,0x63,0x32,0x2e,0x38,0x32,
-    0x38,0x2d,0x32,0x2e,0x38,0x33,0x33,0x2c,0x36,0x2e,
-    0x31,0x34,0x36,0x2d,0x35,0x2e,0x30,0x35,0x36,0x2c,
-    0x39,0x2e,0x39,0x34,0x33,0x2d,0x36,0x2e,0x36,0x38,
-    0x32,0x63,0x33,0x2e,0x37,0x39,0x36,0x2d,0x31,0x2e,
-    0x36,0x31,0x39,0x2c,0x37,0x2e,0x38,0x33,0x38,0x2d,
-    0x32,0x2e,0x34,0x33,0x34,0x2c,0x31,0x32,0x2e,0x31,
-    0x32,0x2d,0x32,0x2e,0x34,0x33,0x34,0x68,0x37,0x2e,
-    0x34,0x35,0x39,0x0a,0x09,0x09,0x63,0x34,0x2e,0x32,
-    0x37,0x38,0x2c,0x30,0x2c,0x38,0x2e,0x33,0x31,0x39,
-    0x2c,0x30,0x2e,0x38,0x31,0x35,0x2c,0x31,0x32,0x2e,
-    0x31,0x31,0x37,0x2c,0x32,0x2e,0x34,0x33,0x34,0x63,
-    0x33,0x2e,0x38,0x2c,0x31,0x2e,0x36,0x32,0x36,0x2c,
-    0x37,0x2e,0x31,0x31,0x33,0x2c,0x33,0x2e,0x38,0x35,
-    0x2c,0x39,0x2e,0x39,0x34,0x39,0x2c,0x36,0x2e,0x36,
-    0x38,0x32,0x63,0x32,0x2e,0x38,0x32,0x38,0x2c,0x32,
-    0x2e,0x38,0x33,0x32,0x2c,0x35,0x2e,0x30,0x35,0x37,
-    0x2c,0x36,0x2e,0x31,0x34,0x36,0x2c,0x36,0x2e,0x36,
-    0x38,0x2c,0x39,0x2e,0x39,0x34,0x37,0x0a,0x09,0x09,
-    0x63,0x31,0x2e,0x36,0x32,0x32,0x2c,0x33,0x2e,0x37,
-    0x39,0x36,0x2c,0x32,0x2e,0x34,0x33,0x34,0x2c,0x37,
-    0x2e,0x38,0x33,0x38,0x2c,0x32,0x2e,0x34,0x33,0x34,
-    0x2c,0x31,0x32,0x2e,0x31,0x32,0x76,0x37,0x36,0x2e,
-    0x39,0x36,0x38,0x48,0x39,0x34,0x36,0x2e,0x34,0x30,
-    0x34,0x4c,0x39,0x34,0x36,0x2e,0x34,0x30,0x34,0x2c,
-    0x33,0x34,0x33,0x2e,0x35,0x35,0x7a,0x20,0x4d,0x39,
-    0x33,0x37,0x2e,0x39,0x30,0x37,0x2c,0x32,0x39,0x32,
-    0x2e,0x31,0x36,0x37,0x68,0x2d,0x32,0x36,0x2e,0x39,
-    0x33,0x36,0x63,0x2d,0x32,0x2e,0x35,0x35,0x38,0x2c,
-    0x30,0x2d,0x34,0x2e,0x39,0x35,0x36,0x2c,0x30,0x2e,
-    0x34,0x38,0x36,0x2d,0x37,0x2e,0x31,0x39,0x39,0x2c,
-    0x31,0x2e,0x34,0x35,0x31,0x0a,0x09,0x09,0x63,0x2d,
-    0x32,0x2e,0x32,0x34,0x36,0x2c,0x30,0x2e,0x39,0x36,
-    0x38,0x2d,0x34,0x2e,0x31,0x39,0x34,0x2c,0x32,0x2e,
-    0x32,0x39,0x36,0x2d,0x35,0x2e,0x38,0x35,0x32,0x2c,
-    0x33,0x2e,0x39,0x38,0x38,0x63,0x2d,0x31,0x2e,0x36,
-    0x36,0x31,0x2c,0x31,0x2e,0x36,0x39,0x35,0x2d,0x32,
-    0x2e,0x39,0x37,0x31,0x2c,0x33,0x2e,0x36,0x36,0x33,
-    0x2d,0x33,0x2e,0x39,0x33,0x38,0x2c,0x35,0x2e,0x39,
-    0x30,0x35,0x63,0x2d,0x30,0x2e,0x39,0x36,0x39,0x2c,
-    0x32,0x2e,0x32,0x34,0x37,0x2d,0x31,0x2e,0x34,0x35,
-    0x31,0x2c,0x34,0x2e,0x36,0x34,0x36,0x2d,0x31,0x2e,
-    0x34,0x35,0x31,0x2c,0x37,0x2e,0x32,0x30,0x33,0x76,
-    0x34,0x2e,0x34,0x35,0x31,0x0a,0x09,0x09,0x63,0x30,
-    0x2c,0x32,0x2e,0x35,0x35,0x36,0x2c,0x30,0x2e,0x34,
-    0x38,0x32,0x2c,0x34,0x2e,0x39,0x35,0x36,0x2c,0x31,
-    0x2e,0x34,0x35,0x31,0x2c,0x37,0x2e,0x32,0x30,0x32,
-    0x63,0x30,0x2e,0x39,0x36,0x38,0x2c,0x32,0x2e,0x32,
-    0x34,0x33,0x2c,0x32,0x2e,0x32,0x37,0x36,0x2c,0x34,
-    0x2e,0x31,0x39,0x35,0x2c,0x33,0x2e,0x39,0x33,0x38,
-    0x2c,0x35,0x2e,0x38,0x35,0x32,0x63,0x31,0x2e,0x36,
-    0x35,0x36,0x2c,0x31,0x2e,0x36,0x35,0x37,0x2c,0x33,
-    0x2e,0x36,0x30,0x34,0x2c,0x32,0x2e,0x39,0x37,0x2c,
-    0x35,0x2e,0x38,0x35,0x32,0x2c,0x33,0x2e,0x39,0x33,
-    0x38,0x0a,0x09,0x09,0x63,0x32,0x2e,0x32,0x34,0x33,
-    0x2c,0x30,0x2e,0x39,0x36,0x34,0x2c,0x34,0x2e,0x36,
-    0x34,0x33,0x2c,0x31,0x2e,0x34,0x34,0x37,0x2c,0x37,
-    0x2e,0x31,0x39,0x39,0x2c,0x31,0x2e,0x34,0x34,0x37,
-    0x68,0x38,0x2e,0x34,0x39,0x36,0x63,0x32,0x2e,0x35,
-    0x35,0x33,0x2c,0x30,0x2c,0x34,0x2e,0x39,0x35,0x32,
-    0x2d,0x30,0x2e,0x34,0x38,0x32,0x2c,0x37,0x2e,0x31,
-    0x39,0x38,0x2d,0x31,0x2e,0x34,0x34,0x37,0x63,0x32,
-    0x2e,0x32,0x34,0x32,0x2d,0x30,0x2e,0x39,0x36,0x38,
-    0x2c,0x34,0x2e,0x31,0x39,0x38,0x2d,0x32,0x2e,0x32,
-    0x38,0x31,0x2c,0x35,0x2e,0x38,0x35,0x33,0x2d,0x33,
-    0x2e,0x39,0x33,0x38,0x0a,0x09,0x09,0x63,0x31,0x2e,
-    0x36,0x36,0x31,0x2d,0x31,0x2e,0x36,0x35,0x37,0x2c,
-    0x32,0x2e,0x39,0x37,0x2d,0x33,0x2e,0x36,0x30,0x39,
-    0x2c,0x33,0x2e,0x39,0x33,0x38,0x2d,0x35,0x2e,0x38,
-    0x35,0x32,0x63,0x30,0x2e,0x39,0x36,0x39,0x2d,0x32,
-    0x2e,0x32,0x34,0x36,0x2c,0x31,0x2e,0x34,0x35,0x2d,
-    0x34,0x2e,0x36,0x34,0x36,0x2c,0x31,0x2e,0x34,0x35,
-    0x2d,0x37,0x2e,0x32,0x30,0x32,0x4c,0x39,0x33,0x37,
-    0x2e,0x39,0x30,0x37,0x2c,0x32,0x39,0x32,0x2e,0x31,
-    0x36,0x37,0x4c,0x39,0x33,0x37,0x2e,0x39,0x30,0x37,
-    0x2c,0x32,0x39,0x32,0x2e,0x31,0x36,0x37,0x7a,0x22,
-    0x2f,0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,
-    0x64,0x3d,0x22,0x4d,0x31,0x30,0x31,0x34,0x2e,0x37,
-    0x37,0x32,0x2c,0x33,0x34,0x33,0x2e,0x35,0x35,0x63,
-    0x2d,0x33,0x2e,0x38,0x36,0x35,0x2c,0x30,0x2d,0x37,
-    0x2e,0x35,0x30,0x39,0x2d,0x30,0x2e,0x37,0x32,0x34,
-    0x2d,0x31,0x30,0x2e,0x39,0x33,0x31,0x2d,0x32,0x2e,
-    0x31,0x37,0x34,0x63,0x2d,0x33,0x2e,0x34,0x31,0x38,
-    0x2d,0x31,0x2e,0x34,0x35,0x31,0x2d,0x36,0x2e,0x33,
-    0x38,0x39,0x2d,0x33,0x2e,0x34,0x35,0x36,0x2d,0x38,
-    0x2e,0x39,0x30,0x39,0x2d,0x36,0x2e,0x30,0x30,0x39,
-    0x0a,0x09,0x09,0x63,0x2d,0x32,0x2e,0x35,0x32,0x2d,
-    0x32,0x2e,0x35,0x35,0x37,0x2d,0x34,0x2e,0x35,0x32,
-    0x34,0x2d,0x35,0x2e,0x35,0x32,0x36,0x2d,0x36,0x2e,
-    0x30,0x30,0x39,0x2d,0x38,0x2e,0x39,0x31,0x63,0x2d,
-    0x31,0x2e,0x34,0x38,0x35,0x2d,0x33,0x2e,0x33,0x38,
-    0x33,0x2d,0x32,0x2e,0x32,0x32,0x35,0x2d,0x37,0x2e,
-    0x30,0x30,0x37,0x2d,0x32,0x2e,0x32,0x32,0x35,0x2d,
-    0x31,0x30,0x2e,0x38,0x37,0x36,0x56,0x32,0x34,0x39,
-    0x2e,0x35,0x39,0x68,0x2d,0x31,0x39,0x2e,0x30,0x36,
-    0x32,0x76,0x2d,0x31,0x32,0x2e,0x31,0x31,0x36,0x68,
-    0x31,0x39,0x2e,0x30,0x36,0x32,0x76,0x2d,0x32,0x35,
-    0x2e,0x34,0x38,0x35,0x6c,0x31,0x32,0x2e,0x37,0x34,
-    0x2d,0x32,0x2e,0x30,0x37,0x0a,0x09,0x09,0x76,0x32,
-    0x37,0x2e,0x35,0x35,0x35,0x68,0x32,0x36,0x2e,0x39,
-    0x33,0x36,0x76,0x31,0x32,0x2e,0x31,0x31,0x36,0x68,
-    0x2d,0x32,0x36,0x2e,0x39,0x33,0x36,0x76,0x36,0x36,
-    0x2e,0x36,0x31,0x31,0x63,0x30,0x2c,0x32,0x2e,0x31,
-    0x34,0x33,0x2c,0x30,0x2e,0x33,0x39,0x38,0x2c,0x34,
-    0x2e,0x31,0x32,0x39,0x2c,0x31,0x2e,0x31,0x39,0x34,
-    0x2c,0x35,0x2e,0x39,0x35,0x35,0x63,0x30,0x2e,0x37,
-    0x38,0x38,0x2c,0x31,0x2e,0x38,0x33,0x33,0x2c,0x31,
-    0x2e,0x38,0x37,0x39,0x2c,0x33,0x2e,0x34,0x33,0x37,
-    0x2c,0x33,0x2e,0x32,0x36,0x31,0x2c,0x34,0x2e,0x38,
-    0x31,0x38,0x0a,0x09,0x09,0x63,0x31,0x2e,0x33,0x38,
-    0x32,0x2c,0x31,0x2e,0x33,0x38,0x31,0x2c,0x33,0x2e,
-    0x30,0x30,0x34,0x2c,0x32,0x2e,0x34,0x37,0x32,0x2c,
-    0x34,0x2e,0x38,0x36,0x38,0x2c,0x33,0x2e,0x32,0x36,
-    0x34,0x63,0x31,0x2e,0x38,0x36,0x36,0x2c,0x30,0x2e,
-    0x37,0x39,0x32,0x2c,0x33,0x2e,0x38,0x36,0x34,0x2c,
-    0x31,0x2e,0x31,0x38,0x39,0x2c,0x36,0x2e,0x30,0x30,
-    0x39,0x2c,0x31,0x2e,0x31,0x38,0x39,0x68,0x31,0x31,
-    0x2e,0x36,0x30,0x34,0x76,0x31,0x32,0x2e,0x31,0x32,
-    0x31,0x4c,0x31,0x30,0x31,0x34,0x2e,0x37,0x37,0x32,
-    0x2c,0x33,0x34,0x33,0x2e,0x35,0x35,0x4c,0x31,0x30,
-    0x31,0x34,0x2e,0x37,0x37,0x32,0x2c,0x33,0x34,0x33,
-    0x2e,0x35,0x35,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,
-    0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,
-    0x30,0x35,0x32,0x2e,0x39,0x39,0x36,0x2c,0x32,0x31,
-    0x31,0x2e,0x39,0x38,0x39,0x56,0x31,0x39,0x35,0x68,
-    0x31,0x34,0x2e,0x38,0x31,0x35,0x76,0x31,0x36,0x2e,
-    0x39,0x38,0x39,0x48,0x31,0x30,0x35,0x32,0x2e,0x39,
-    0x39,0x36,0x7a,0x20,0x4d,0x31,0x30,0x35,0x34,0x2e,
-    0x30,0x33,0x33,0x2c,0x33,0x34,0x33,0x2e,0x35,0x35,
-    0x56,0x32,0x33,0x37,0x2e,0x34,0x37,0x34,0x68,0x31,
-    0x32,0x2e,0x37,0x34,0x31,0x56,0x33,0x34,0x33,0x2e,
-    0x35,0x35,0x48,0x31,0x30,0x35,0x34,0x2e,0x30,0x33,
-    0x33,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x70,0x61,
-    0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x31,0x31,0x36,
-    0x34,0x2e,0x39,0x33,0x2c,0x33,0x32,0x36,0x2e,0x35,
-    0x36,0x32,0x63,0x2d,0x31,0x2e,0x36,0x32,0x33,0x2c,
-    0x33,0x2e,0x38,0x2d,0x33,0x2e,0x38,0x35,0x32,0x2c,
-    0x37,0x2e,0x31,0x31,0x35,0x2d,0x36,0x2e,0x36,0x37,
-    0x39,0x2c,0x39,0x2e,0x39,0x34,0x33,0x63,0x2d,0x32,
-    0x2e,0x38,0x33,0x37,0x2c,0x32,0x2e,0x38,0x33,0x36,
-    0x2d,0x36,0x2e,0x31,0x35,0x2c,0x35,0x2e,0x30,0x36,
-    0x2d,0x39,0x2e,0x39,0x35,0x2c,0x36,0x2e,0x36,0x38,
-    0x32,0x0a,0x09,0x09,0x63,0x2d,0x33,0x2e,0x37,0x39,
-    0x37,0x2c,0x31,0x2e,0x36,0x32,0x33,0x2d,0x37,0x2e,
-    0x38,0x33,0x38,0x2c,0x32,0x2e,0x34,0x33,0x34,0x2d,
-    0x31,0x32,0x2e,0x31,0x31,0x37,0x2c,0x32,0x2e,0x34,
-    0x33,0x34,0x68,0x2d,0x38,0x2e,0x34,0x39,0x36,0x63,
-    0x2d,0x34,0x2e,0x32,0x38,0x32,0x2c,0x30,0x2d,0x38,
-    0x2e,0x33,0x31,0x39,0x2d,0x30,0x2e,0x38,0x31,0x32,
-    0x2d,0x31,0x32,0x2e,0x31,0x31,0x36,0x2d,0x32,0x2e,
-    0x34,0x33,0x34,0x63,0x2d,0x33,0x2e,0x38,0x30,0x35,
-    0x2d,0x31,0x2e,0x36,0x32,0x33,0x2d,0x37,0x2e,0x31,
-    0x31,0x39,0x2d,0x33,0x2e,0x38,0x34,0x36,0x2d,0x39,
-    0x2e,0x39,0x34,0x36,0x2d,0x36,0x2e,0x36,0x38,0x32,
-    0x0a,0x09,0x09,0x63,0x2d,0x32,0x2e,0x38,0x33,0x37,
-    0x2d,0x32,0x2e,0x38,0x32,0x38,0x2d,0x35,0x2e,0x30,
-    0x36,0x32,0x2d,0x36,0x2e,0x31,0x34,0x33,0x2d,0x36,
-    0x2e,0x36,0x38,0x33,0x2d,0x39,0x2e,0x39,0x34,0x33,
-    0x63,0x2d,0x31,0x2e,0x36,0x32,0x37,0x2d,0x33,0x2e,
-    0x37,0x39,0x36,0x2d,0x32,0x2e,0x34,0x33,0x35,0x2d,
-    0x37,0x2e,0x38,0x33,0x38,0x2d,0x32,0x2e,0x34,0x33,
-    0x35,0x2d,0x31,0x32,0x2e,0x31,0x32,0x31,0x76,0x2d,
-    0x34,0x37,0x2e,0x38,0x35,0x38,0x63,0x30,0x2d,0x34,
-    0x2e,0x32,0x38,0x32,0x2c,0x30,0x2e,0x38,0x30,0x38,
-    0x2d,0x38,0x2e,0x33,0x32,0x34,0x2c,0x32,0x2e,0x34,
-    0x33,0x35,0x2d,0x31,0x32,0x2e,0x31,0x32,0x0a,0x09,
-    0x09,0x63,0x31,0x2e,0x36,0x31,0x39,0x2d,0x33,0x2e,
-    0x38,0x30,0x31,0x2c,0x33,0x2e,0x38,0x34,0x36,0x2d,
-    0x37,0x2e,0x31,0x31,0x35,0x2c,0x36,0x2e,0x36,0x38,
-    0x33,0x2d,0x39,0x2e,0x39,0x34,0x37,0x63,0x32,0x2e,
-    0x38,0x32,0x37,0x2d,0x32,0x2e,0x38,0x33,0x33,0x2c,
-    0x36,0x2e,0x31,0x34,0x33,0x2d,0x35,0x2e,0x30,0x35,
-    0x36,0x2c,0x39,0x2e,0x39,0x34,0x36,0x2d,0x36,0x2e,
-    0x36,0x38,0x32,0x63,0x33,0x2e,0x37,0x39,0x37,0x2d,
-    0x31,0x2e,0x36,0x31,0x39,0x2c,0x37,0x2e,0x38,0x33,
-    0x34,0x2d,0x32,0x2e,0x34,0x33,0x34,0x2c,0x31,0x32,
-    0x2e,0x31,0x31,0x36,0x2d,0x32,0x2e,0x34,0x33,0x34,
-    0x68,0x38,0x2e,0x34,0x39,0x36,0x0a,0x09,0x09,0x63,
-    0x34,0x2e,0x32,0x37,0x39,0x2c,0x30,0x2c,0x38,0x2e,
-    0x33,0x32,0x2c,0x30,0x2e,0x38,0x31,0x35,0x2c,0x31,
-    0x32,0x2e,0x31,0x31,0x37,0x2c,0x32,0x2e,0x34,0x33,
-    0x34,0x63,0x33,0x2e,0x38,0x2c,0x31,0x2e,0x36,0x32,
-    0x36,0x2c,0x37,0x2e,0x31,0x31,0x34,0x2c,0x33,0x2e,
-    0x38,0x35,0x2c,0x39,0x2e,0x39,0x35,0x2c,0x36,0x2e,
-    0x36,0x38,0x32,0x63,0x32,0x2e,0x38,0x32,0x37,0x2c,
-    0x32,0x2e,0x38,0x33,0x32,0x2c,0x35,0x2e,0x30,0x35,
-    0x36,0x2c,0x36,0x2e,0x31,0x34,0x36,0x2c,0x36,0x2e,
-    0x36,0x37,0x39,0x2c,0x39,0x2e,0x39,0x34,0x37,0x0a,
-    0x09,0x09,0x63,0x31,0x2e,0x36,0x32,0x32,0x2c,0x33,
-    0x2e,0x37,0x39,0x36,0x2c,0x32,0x2e,0x34,0x33,0x34,
-    0x2c,0x37,0x2e,0x38,0x33,0x38,0x2c,0x32,0x2e,0x34,
-    0x33,0x34,0x2c,0x31,0x32,0x2e,0x31,0x32,0x76,0x34,
-    0x37,0x2e,0x38,0x35,0x38,0x43,0x31,0x31,0x36,0x37,
-    0x2e,0x33,0x36,0x33,0x2c,0x33,0x31,0x38,0x2e,0x37,
-    0x32,0x34,0x2c,0x31,0x31,0x36,0x36,0x2e,0x35,0x35,
-    0x32,0x2c,0x33,0x32,0x32,0x2e,0x37,0x36,0x35,0x2c,
-    0x31,0x31,0x36,0x34,0x2e,0x39,0x33,0x2c,0x33,0x32,
-    0x36,0x2e,0x35,0x36,0x32,0x7a,0x20,0x4d,0x31,0x31,
-    0x35,0x34,0x2e,0x36,0x32,0x32,0x2c,0x32,0x36,0x35,
-    0x2e,0x38,0x35,0x35,0x0a,0x09,0x09,0x63,0x30,0x2d,
-    0x32,0x2e,0x35,0x35,0x33,0x2d,0x30,0x2e,0x34,0x38,
-    0x31,0x2d,0x34,0x2e,0x39,0x35,0x32,0x2d,0x31,0x2e,
-    0x34,0x34,0x39,0x2d,0x37,0x2e,0x31,0x39,0x39,0x63,
-    0x2d,0x30,0x2e,0x39,0x37,0x2d,0x32,0x2e,0x32,0x34,
-    0x33,0x2d,0x32,0x2e,0x32,0x37,0x37,0x2d,0x34,0x2e,
-    0x31,0x39,0x34,0x2d,0x33,0x2e,0x39,0x33,0x38,0x2d,
-    0x35,0x2e,0x38,0x35,0x32,0x63,0x2d,0x31,0x2e,0x36,
-    0x35,0x33,0x2d,0x31,0x2e,0x36,0x35,0x37,0x2d,0x33,
-    0x2e,0x36,0x30,0x38,0x2d,0x32,0x2e,0x39,0x37,0x2d,
-    0x35,0x2e,0x38,0x35,0x32,0x2d,0x33,0x2e,0x39,0x33,
-    0x38,0x0a,0x09,0x09,0x63,0x2d,0x32,0x2e,0x32,0x34,
-    0x36,0x2d,0x30,0x2e,0x39,0x36,0x34,0x2d,0x34,0x2e,
-    0x36,0x34,0x36,0x2d,0x31,0x2e,0x34,0x35,0x2d,0x37,
-    0x2e,0x31,0x39,0x39,0x2d,0x31,0x2e,0x34,0x35,0x68,
-    0x2d,0x38,0x2e,0x34,0x39,0x36,0x63,0x2d,0x32,0x2e,
-    0x35,0x35,0x37,0x2c,0x30,0x2d,0x34,0x2e,0x39,0x35,
-    0x36,0x2c,0x30,0x2e,0x34,0x38,0x36,0x2d,0x37,0x2e,
-    0x31,0x39,0x38,0x2c,0x31,0x2e,0x34,0x35,0x63,0x2d,
-    0x32,0x2e,0x32,0x34,0x37,0x2c,0x30,0x2e,0x39,0x36,
-    0x39,0x2d,0x34,0x2e,0x31,0x39,0x34,0x2c,0x32,0x2e,
-    0x32,0x38,0x31,0x2d,0x35,0x2e,0x38,0x35,0x32,0x2c,
-    0x33,0x2e,0x39,0x33,0x38,0x0a,0x09,0x09,0x63,0x2d,
-    0x31,0x2e,0x36,0x36,0x31,0x2c,0x31,0x2e,0x36,0x35,
-    0x37,0x2d,0x32,0x2e,0x39,0x37,0x31,0x2c,0x33,0x2e,
-    0x36,0x30,0x39,0x2d,0x33,0x2e,0x39,0x33,0x38,0x2c,
-    0x35,0x2e,0x38,0x35,0x32,0x63,0x2d,0x30,0x2e,0x39,
-    0x36,0x39,0x2c,0x32,0x2e,0x32,0x34,0x37,0x2d,0x31,
-    0x2e,0x34,0x35,0x2c,0x34,0x2e,0x36,0x34,0x36,0x2d,
-    0x31,0x2e,0x34,0x35,0x2c,0x37,0x2e,0x31,0x39,0x39,
-    0x76,0x34,0x39,0x2e,0x33,0x30,0x39,0x63,0x30,0x2c,
-    0x32,0x2e,0x35,0x35,0x36,0x2c,0x30,0x2e,0x34,0x38,
-    0x31,0x2c,0x34,0x2e,0x39,0x35,0x36,0x2c,0x31,0x2e,
-    0x34,0x35,0x2c,0x37,0x2e,0x32,0x30,0x32,0x0a,0x09,
-    0x09,0x63,0x30,0x2e,0x39,0x36,0x38,0x2c,0x32,0x2e,
-    0x32,0x34,0x33,0x2c,0x32,0x2e,0x32,0x37,0x37,0x2c,
-    0x34,0x2e,0x31,0x39,0x35,0x2c,0x33,0x2e,0x39,0x33,
-    0x38,0x2c,0x35,0x2e,0x38,0x35,0x32,0x63,0x31,0x2e,
-    0x36,0x35,0x36,0x2c,0x31,0x2e,0x36,0x35,0x37,0x2c,
-    0x33,0x2e,0x36,0x30,0x34,0x2c,0x32,0x2e,0x39,0x37,
-    0x2c,0x35,0x2e,0x38,0x35,0x32,0x2c,0x33,0x2e,0x39,
-    0x33,0x38,0x63,0x32,0x2e,0x32,0x34,0x32,0x2c,0x30,
-    0x2e,0x39,0x36,0x34,0x2c,0x34,0x2e,0x36,0x34,0x33,
-    0x2c,0x31,0x2e,0x34,0x34,0x37,0x2c,0x37,0x2e,0x31,
-    0x39,0x38,0x2c,0x31,0x2e,0x34,0x34,0x37,0x68,0x38,
-    0x2e,0x34,0x39,0x36,0x0a,0x09,0x09,0x63,0x32,0x2e,
-    0x35,0x35,0x33,0x2c,0x30,0x2c,0x34,0x2e,0x39,0x35,
-    0x33,0x2d,0x30,0x2e,0x34,0x38,0x32,0x2c,0x37,0x2e,
-    0x31,0x39,0x39,0x2d,0x31,0x2e,0x34,0x34,0x37,0x63,
-    0x32,0x2e,0x32,0x34,0x33,0x2d,0x30,0x2e,0x39,0x36,
-    0x38,0x2c,0x34,0x2e,0x31,0x39,0x37,0x2d,0x32,0x2e,
-    0x32,0x38,0x31,0x2c,0x35,0x2e,0x38,0x35,0x32,0x2d,
-    0x33,0x2e,0x39,0x33,0x38,0x63,0x31,0x2e,0x36,0x36,
-    0x31,0x2d,0x31,0x2e,0x36,0x35,0x37,0x2c,0x32,0x2e,
-    0x39,0x37,0x2d,0x33,0x2e,0x36,0x30,0x39,0x2c,0x33,
-    0x2e,0x39,0x33,0x38,0x2d,0x35,0x2e,0x38,0x35,0x32,
-    0x0a,0x09,0x09,0x63,0x30,0x2e,0x39,0x36,0x38,0x2d,
-    0x32,0x2e,0x32,0x34,0x36,0x2c,0x31,0x2e,0x34,0x34,
-    0x39,0x2d,0x34,0x2e,0x36,0x34,0x36,0x2c,0x31,0x2e,
-    0x34,0x34,0x39,0x2d,0x37,0x2e,0x32,0x30,0x32,0x56,
-    0x32,0x36,0x35,0x2e,0x38,0x35,0x35,0x7a,0x22,0x2f,
-    0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,
-    0x3d,0x22,0x4d,0x31,0x32,0x35,0x30,0x2e,0x39,0x36,
-    0x34,0x2c,0x33,0x34,0x33,0x2e,0x35,0x35,0x76,0x2d,
-    0x37,0x37,0x2e,0x36,0x39,0x35,0x63,0x30,0x2d,0x32,
-    0x2e,0x35,0x35,0x33,0x2d,0x30,0x2e,0x34,0x38,0x36,
-    0x2d,0x34,0x2e,0x39,0x35,0x32,0x2d,0x31,0x2e,0x34,
-    0x35,0x31,0x2d,0x37,0x2e,0x31,0x39,0x39,0x63,0x2d,
-    0x30,0x2e,0x39,0x36,0x39,0x2d,0x32,0x2e,0x32,0x34,
-    0x33,0x2d,0x32,0x2e,0x32,0x38,0x2d,0x34,0x2e,0x31,
-    0x39,0x34,0x2d,0x33,0x2e,0x39,0x33,0x35,0x2d,0x35,
-    0x2e,0x38,0x35,0x32,0x0a,0x09,0x09,0x63,0x2d,0x31,
-    0x2e,0x36,0x36,0x31,0x2d,0x31,0x2e,0x36,0x35,0x37,
-    0x2d,0x33,0x2e,0x36,0x31,0x32,0x2d,0x32,0x2e,0x39,
-    0x37,0x2d,0x35,0x2e,0x38,0x35,0x35,0x2d,0x33,0x2e,
-    0x39,0x33,0x38,0x63,0x2d,0x32,0x2e,0x32,0x34,0x32,
-    0x2d,0x30,0x2e,0x39,0x36,0x34,0x2d,0x34,0x2e,0x36,
-    0x34,0x36,0x2d,0x31,0x2e,0x34,0x35,0x2d,0x37,0x2e,
-    0x31,0x39,0x38,0x2d,0x31,0x2e,0x34,0x35,0x68,0x2d,
-    0x38,0x2e,0x34,0x39,0x32,0x63,0x2d,0x32,0x2e,0x35,
-    0x35,0x37,0x2c,0x30,0x2d,0x34,0x2e,0x39,0x36,0x2c,
-    0x30,0x2e,0x34,0x38,0x36,0x2d,0x37,0x2e,0x32,0x30,
-    0x33,0x2c,0x31,0x2e,0x34,0x35,0x0a,0x09,0x09,0x63,
-    0x2d,0x32,0x2e,0x32,0x34,0x31,0x2c,0x30,0x2e,0x39,
-    0x36,0x39,0x2d,0x34,0x2e,0x31,0x39,0x33,0x2c,0x32,
-    0x2e,0x32,0x38,0x31,0x2d,0x35,0x2e,0x38,0x35,0x34,
-    0x2c,0x33,0x2e,0x39,0x33,0x38,0x63,0x2d,0x31,0x2e,
-    0x36,0x35,0x33,0x2c,0x31,0x2e,0x36,0x35,0x37,0x2d,
-    0x32,0x2e,0x39,0x37,0x2c,0x33,0x2e,0x36,0x30,0x39,
-    0x2d,0x33,0x2e,0x39,0x33,0x35,0x2c,0x35,0x2e,0x38,
-    0x35,0x32,0x63,0x2d,0x30,0x2e,0x39,0x36,0x39,0x2c,
-    0x32,0x2e,0x32,0x34,0x37,0x2d,0x31,0x2e,0x34,0x35,
-    0x2c,0x34,0x2e,0x36,0x34,0x36,0x2d,0x31,0x2e,0x34,
-    0x35,0x2c,0x37,0x2e,0x31,0x39,0x39,0x76,0x37,0x37,
-    0x2e,0x36,0x39,0x35,0x68,0x2d,0x31,0x32,0x2e,0x37,
-    0x34,0x0a,0x09,0x09,0x56,0x32,0x33,0x37,0x2e,0x34,
-    0x37,0x34,0x68,0x34,0x2e,0x32,0x34,0x38,0x6c,0x36,
-    0x2e,0x39,0x33,0x38,0x2c,0x31,0x30,0x2e,0x37,0x37,
-    0x33,0x63,0x32,0x2e,0x39,0x2d,0x33,0x2e,0x39,0x33,
-    0x38,0x2c,0x36,0x2e,0x35,0x34,0x31,0x2d,0x37,0x2e,
-    0x30,0x36,0x31,0x2c,0x31,0x30,0x2e,0x39,0x33,0x31,
-    0x2d,0x39,0x2e,0x33,0x37,0x36,0x63,0x34,0x2e,0x33,
-    0x38,0x32,0x2d,0x32,0x2e,0x33,0x31,0x32,0x2c,0x39,
-    0x2e,0x31,0x36,0x36,0x2d,0x33,0x2e,0x34,0x37,0x31,
-    0x2c,0x31,0x34,0x2e,0x33,0x34,0x38,0x2d,0x33,0x2e,
-    0x34,0x37,0x31,0x68,0x33,0x2e,0x32,0x31,0x31,0x0a,
-    0x09,0x09,0x63,0x34,0x2e,0x32,0x38,0x32,0x2c,0x30,
-    0x2c,0x38,0x2e,0x33,0x32,0x2c,0x30,0x2e,0x38,0x31,
-    0x35,0x2c,0x31,0x32,0x2e,0x31,0x32,0x2c,0x32,0x2e,
-    0x34,0x33,0x34,0x63,0x33,0x2e,0x37,0x39,0x37,0x2c,
-    0x31,0x2e,0x36,0x32,0x36,0x2c,0x37,0x2e,0x31,0x31,
-    0x31,0x2c,0x33,0x2e,0x38,0x35,0x2c,0x39,0x2e,0x39,
-    0x34,0x33,0x2c,0x36,0x2e,0x36,0x38,0x32,0x73,0x35,
-    0x2e,0x30,0x36,0x2c,0x36,0x2e,0x31,0x34,0x36,0x2c,
-    0x36,0x2e,0x36,0x38,0x32,0x2c,0x39,0x2e,0x39,0x34,
-    0x37,0x63,0x31,0x2e,0x36,0x32,0x33,0x2c,0x33,0x2e,
-    0x37,0x39,0x36,0x2c,0x32,0x2e,0x34,0x33,0x36,0x2c,
-    0x37,0x2e,0x38,0x33,0x38,0x2c,0x32,0x2e,0x34,0x33,
-    0x36,0x2c,0x31,0x32,0x2e,0x31,0x32,0x0a,0x09,0x09,
-    0x76,0x37,0x36,0x2e,0x39,0x36,0x38,0x4c,0x31,0x32,
-    0x35,0x30,0x2e,0x39,0x36,0x34,0x2c,0x33,0x34,0x33,
-    0x2e,0x35,0x35,0x4c,0x31,0x32,0x35,0x30,0x2e,0x39,
-    0x36,0x34,0x2c,0x33,0x34,0x33,0x2e,0x35,0x35,0x7a,
-    0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x64,0x3d,0x22,0x4d,0x35,0x36,0x33,0x2e,0x31,
-    0x30,0x39,0x2c,0x34,0x39,0x36,0x2e,0x32,0x35,0x38,
-    0x63,0x30,0x2c,0x34,0x2e,0x32,0x37,0x38,0x2d,0x30,
-    0x2e,0x38,0x36,0x35,0x2c,0x38,0x2e,0x31,0x39,0x38,
-    0x2d,0x32,0x2e,0x35,0x38,0x37,0x2c,0x31,0x31,0x2e,
-    0x37,0x35,0x37,0x63,0x2d,0x31,0x2e,0x37,0x32,0x39,
-    0x2c,0x33,0x2e,0x35,0x36,0x31,0x2d,0x34,0x2e,0x30,
-    0x37,0x36,0x2c,0x36,0x2e,0x36,0x31,0x33,0x2d,0x37,
-    0x2e,0x30,0x34,0x36,0x2c,0x39,0x2e,0x31,0x37,0x0a,
-    0x09,0x09,0x63,0x2d,0x32,0x2e,0x39,0x37,0x2c,0x32,
-    0x2e,0x35,0x35,0x38,0x2d,0x36,0x2e,0x34,0x30,0x36,
-    0x2c,0x34,0x2e,0x35,0x33,0x39,0x2d,0x31,0x30,0x2e,
-    0x33,0x30,0x37,0x2c,0x35,0x2e,0x39,0x35,0x35,0x63,
-    0x2d,0x33,0x2e,0x39,0x30,0x33,0x2c,0x31,0x2e,0x34,
-    0x31,0x36,0x2d,0x37,0x2e,0x39,0x39,0x35,0x2c,0x32,
-    0x2e,0x31,0x32,0x2d,0x31,0x32,0x2e,0x32,0x37,0x37,
-    0x2c,0x32,0x2e,0x31,0x32,0x48,0x35,0x32,0x32,0x2e,
-    0x34,0x63,0x2d,0x34,0x2e,0x32,0x38,0x33,0x2c,0x30,
-    0x2d,0x38,0x2e,0x33,0x37,0x37,0x2d,0x30,0x2e,0x38,
-    0x31,0x32,0x2d,0x31,0x32,0x2e,0x32,0x37,0x37,0x2d,
-    0x32,0x2e,0x34,0x33,0x34,0x0a,0x09,0x09,0x63,0x2d,
-    0x33,0x2e,0x39,0x30,0x33,0x2d,0x31,0x2e,0x36,0x32,
-    0x33,0x2d,0x37,0x2e,0x33,0x32,0x2d,0x33,0x2e,0x38,
-    0x34,0x33,0x2d,0x31,0x30,0x2e,0x32,0x35,0x37,0x2d,
-    0x36,0x2e,0x36,0x38,0x33,0x63,0x2d,0x32,0x2e,0x39,
-    0x33,0x36,0x2d,0x32,0x2e,0x38,0x32,0x34,0x2d,0x35,
-    0x2e,0x32,0x38,0x2d,0x36,0x2e,0x31,0x34,0x2d,0x37,
-    0x2e,0x30,0x34,0x32,0x2d,0x39,0x2e,0x39,0x34,0x33,
-    0x63,0x2d,0x31,0x2e,0x37,0x36,0x2d,0x33,0x2e,0x37,
-    0x39,0x37,0x2d,0x32,0x2e,0x36,0x34,0x31,0x2d,0x37,
-    0x2e,0x38,0x33,0x38,0x2d,0x32,0x2e,0x36,0x34,0x31,
-    0x2d,0x31,0x32,0x2e,0x31,0x31,0x36,0x76,0x2d,0x34,
-    0x2e,0x32,0x34,0x38,0x0a,0x09,0x09,0x6c,0x31,0x32,
-    0x2e,0x37,0x34,0x2d,0x32,0x2e,0x30,0x37,0x34,0x76,
-    0x37,0x2e,0x30,0x34,0x32,0x63,0x30,0x2c,0x32,0x2e,
-    0x35,0x35,0x37,0x2c,0x30,0x2e,0x35,0x33,0x31,0x2c,
-    0x34,0x2e,0x39,0x36,0x31,0x2c,0x31,0x2e,0x36,0x30,
-    0x34,0x2c,0x37,0x2e,0x32,0x30,0x32,0x63,0x31,0x2e,
-    0x30,0x37,0x31,0x2c,0x32,0x2e,0x32,0x34,0x33,0x2c,
-    0x32,0x2e,0x35,0x30,0x33,0x2c,0x34,0x2e,0x31,0x39,
-    0x34,0x2c,0x34,0x2e,0x33,0x30,0x31,0x2c,0x35,0x2e,
-    0x38,0x35,0x34,0x63,0x31,0x2e,0x37,0x39,0x35,0x2c,
-    0x31,0x2e,0x36,0x35,0x34,0x2c,0x33,0x2e,0x38,0x36,
-    0x36,0x2c,0x32,0x2e,0x39,0x37,0x31,0x2c,0x36,0x2e,
-    0x32,0x31,0x37,0x2c,0x33,0x2e,0x39,0x33,0x36,0x0a,
-    0x09,0x09,0x63,0x32,0x2e,0x33,0x34,0x36,0x2c,0x30,
-    0x2e,0x39,0x36,0x35,0x2c,0x34,0x2e,0x37,0x39,0x39,
-    0x2c,0x31,0x2e,0x34,0x34,0x37,0x2c,0x37,0x2e,0x33,
-    0x35,0x34,0x2c,0x31,0x2e,0x34,0x34,0x37,0x68,0x38,
-    0x2e,0x34,0x39,0x32,0x63,0x32,0x2e,0x35,0x35,0x37,
-    0x2c,0x30,0x2c,0x35,0x2e,0x30,0x30,0x36,0x2d,0x30,
-    0x2e,0x33,0x37,0x36,0x2c,0x37,0x2e,0x33,0x35,0x35,
-    0x2d,0x31,0x2e,0x31,0x33,0x35,0x63,0x32,0x2e,0x33,
-    0x34,0x37,0x2d,0x30,0x2e,0x37,0x36,0x35,0x2c,0x34,
-    0x2e,0x34,0x33,0x37,0x2d,0x31,0x2e,0x38,0x35,0x32,
-    0x2c,0x36,0x2e,0x32,0x37,0x2d,0x33,0x2e,0x32,0x36,
-    0x38,0x0a,0x09,0x09,0x63,0x31,0x2e,0x38,0x32,0x39,
-    0x2d,0x31,0x2e,0x34,0x31,0x36,0x2c,0x33,0x2e,0x32,
-    0x38,0x2d,0x33,0x2e,0x31,0x32,0x33,0x2c,0x34,0x2e,
-    0x33,0x35,0x31,0x2d,0x35,0x2e,0x31,0x32,0x39,0x63,
-    0x31,0x2e,0x30,0x36,0x38,0x2d,0x31,0x2e,0x39,0x39,
-    0x37,0x2c,0x31,0x2e,0x36,0x30,0x34,0x2d,0x34,0x2e,
-    0x32,0x37,0x37,0x2c,0x31,0x2e,0x36,0x30,0x34,0x2d,
-    0x36,0x2e,0x38,0x33,0x35,0x63,0x30,0x2d,0x33,0x2e,
-    0x37,0x39,0x37,0x2d,0x30,0x2e,0x38,0x32,0x37,0x2d,
-    0x36,0x2e,0x39,0x30,0x33,0x2d,0x32,0x2e,0x34,0x38,
-    0x38,0x2d,0x39,0x2e,0x33,0x32,0x33,0x0a,0x09,0x09,
-    0x63,0x2d,0x31,0x2e,0x36,0x35,0x37,0x2d,0x32,0x2e,
-    0x34,0x31,0x39,0x2d,0x33,0x2e,0x38,0x35,0x2d,0x34,
-    0x2e,0x34,0x33,0x38,0x2d,0x36,0x2e,0x35,0x37,0x35,
-    0x2d,0x36,0x2e,0x30,0x36,0x32,0x63,0x2d,0x32,0x2e,
-    0x37,0x32,0x39,0x2d,0x31,0x2e,0x36,0x32,0x33,0x2d,
-    0x35,0x2e,0x38,0x33,0x36,0x2d,0x32,0x2e,0x39,0x36,
-    0x34,0x2d,0x39,0x2e,0x33,0x32,0x32,0x2d,0x34,0x2e,
-    0x30,0x33,0x34,0x63,0x2d,0x33,0x2e,0x34,0x39,0x2d,
-    0x31,0x2e,0x30,0x37,0x31,0x2d,0x37,0x2e,0x30,0x36,
-    0x35,0x2d,0x32,0x2e,0x31,0x34,0x35,0x2d,0x31,0x30,
-    0x2e,0x37,0x32,0x35,0x2d,0x33,0x2e,0x32,0x31,0x35,
-    0x0a,0x09,0x09,0x63,0x2d,0x33,0x2e,0x36,0x36,0x33,
-    0x2d,0x31,0x2e,0x30,0x37,0x31,0x2d,0x37,0x2e,0x32,
-    0x33,0x36,0x2d,0x32,0x2e,0x32,0x39,0x36,0x2d,0x31,
-    0x30,0x2e,0x37,0x32,0x34,0x2d,0x33,0x2e,0x36,0x37,
-    0x34,0x63,0x2d,0x33,0x2e,0x34,0x38,0x36,0x2d,0x31,
-    0x2e,0x33,0x38,0x37,0x2d,0x36,0x2e,0x35,0x39,0x34,
-    0x2d,0x33,0x2e,0x32,0x2d,0x39,0x2e,0x33,0x32,0x33,
-    0x2d,0x35,0x2e,0x34,0x34,0x32,0x63,0x2d,0x32,0x2e,
-    0x37,0x32,0x39,0x2d,0x32,0x2e,0x32,0x34,0x32,0x2d,
-    0x34,0x2e,0x39,0x31,0x38,0x2d,0x35,0x2e,0x30,0x36,
-    0x2d,0x36,0x2e,0x35,0x37,0x35,0x2d,0x38,0x2e,0x34,
-    0x34,0x32,0x0a,0x09,0x09,0x63,0x2d,0x31,0x2e,0x36,
-    0x36,0x31,0x2d,0x33,0x2e,0x33,0x38,0x34,0x2d,0x32,
-    0x2e,0x34,0x38,0x37,0x2d,0x37,0x2e,0x35,0x39,0x33,
-    0x2d,0x32,0x2e,0x34,0x38,0x37,0x2d,0x31,0x32,0x2e,
-    0x36,0x33,0x38,0x63,0x30,0x2d,0x34,0x2e,0x32,0x37,
-    0x38,0x2c,0x30,0x2e,0x38,0x32,0x36,0x2d,0x38,0x2e,
-    0x31,0x39,0x36,0x2c,0x32,0x2e,0x34,0x38,0x37,0x2d,
-    0x31,0x31,0x2e,0x37,0x35,0x37,0x63,0x31,0x2e,0x36,
-    0x35,0x37,0x2d,0x33,0x2e,0x35,0x36,0x31,0x2c,0x33,
-    0x2e,0x39,0x2d,0x36,0x2e,0x36,0x31,0x33,0x2c,0x36,
-    0x2e,0x37,0x33,0x32,0x2d,0x39,0x2e,0x31,0x37,0x0a,
-    0x09,0x09,0x73,0x36,0x2e,0x31,0x32,0x37,0x2d,0x34,
-    0x2e,0x35,0x33,0x39,0x2c,0x39,0x2e,0x38,0x39,0x33,
-    0x2d,0x35,0x2e,0x39,0x35,0x35,0x63,0x33,0x2e,0x37,
-    0x36,0x33,0x2d,0x31,0x2e,0x34,0x31,0x36,0x2c,0x37,
-    0x2e,0x37,0x38,0x35,0x2d,0x32,0x2e,0x31,0x32,0x38,
-    0x2c,0x31,0x32,0x2e,0x30,0x36,0x37,0x2d,0x32,0x2e,
-    0x31,0x32,0x38,0x68,0x37,0x2e,0x34,0x35,0x39,0x63,
-    0x34,0x2e,0x32,0x38,0x33,0x2c,0x30,0x2c,0x38,0x2e,
-    0x33,0x32,0x34,0x2c,0x30,0x2e,0x38,0x31,0x39,0x2c,
-    0x31,0x32,0x2e,0x31,0x32,0x31,0x2c,0x32,0x2e,0x34,
-    0x33,0x35,0x0a,0x09,0x09,0x63,0x33,0x2e,0x37,0x39,
-    0x36,0x2c,0x31,0x2e,0x36,0x33,0x31,0x2c,0x37,0x2e,
-    0x31,0x31,0x35,0x2c,0x33,0x2e,0x38,0x35,0x31,0x2c,
-    0x39,0x2e,0x39,0x34,0x37,0x2c,0x36,0x2e,0x36,0x38,
-    0x32,0x63,0x32,0x2e,0x38,0x32,0x37,0x2c,0x32,0x2e,
-    0x38,0x33,0x34,0x2c,0x35,0x2e,0x30,0x35,0x36,0x2c,
-    0x36,0x2e,0x31,0x34,0x36,0x2c,0x36,0x2e,0x36,0x38,
-    0x32,0x2c,0x39,0x2e,0x39,0x35,0x31,0x63,0x31,0x2e,
-    0x36,0x31,0x39,0x2c,0x33,0x2e,0x37,0x39,0x37,0x2c,
-    0x32,0x2e,0x34,0x33,0x34,0x2c,0x37,0x2e,0x38,0x33,
-    0x38,0x2c,0x32,0x2e,0x34,0x33,0x34,0x2c,0x31,0x32,
-    0x2e,0x31,0x31,0x37,0x76,0x30,0x2e,0x34,0x31,0x33,
-    0x0a,0x09,0x09,0x6c,0x2d,0x31,0x32,0x2e,0x37,0x34,
-    0x34,0x2c,0x32,0x2e,0x30,0x37,0x34,0x76,0x2d,0x33,
-    0x2e,0x32,0x31,0x35,0x63,0x30,0x2d,0x32,0x2e,0x35,
-    0x35,0x2d,0x30,0x2e,0x34,0x38,0x31,0x2d,0x34,0x2e,
-    0x39,0x35,0x33,0x2d,0x31,0x2e,0x34,0x35,0x2d,0x37,
-    0x2e,0x31,0x39,0x35,0x63,0x2d,0x30,0x2e,0x39,0x37,
-    0x2d,0x32,0x2e,0x32,0x34,0x31,0x2d,0x32,0x2e,0x32,
-    0x37,0x37,0x2d,0x34,0x2e,0x31,0x39,0x34,0x2d,0x33,
-    0x2e,0x39,0x33,0x35,0x2d,0x35,0x2e,0x38,0x35,0x34,
-    0x63,0x2d,0x31,0x2e,0x36,0x35,0x37,0x2d,0x31,0x2e,
-    0x36,0x35,0x33,0x2d,0x33,0x2e,0x36,0x30,0x38,0x2d,
-    0x32,0x2e,0x39,0x37,0x31,0x2d,0x35,0x2e,0x38,0x35,
-    0x34,0x2d,0x33,0x2e,0x39,0x33,0x36,0x0a,0x09,0x09,
-    0x63,0x2d,0x32,0x2e,0x32,0x34,0x33,0x2d,0x30,0x2e,
-    0x39,0x36,0x34,0x2d,0x34,0x2e,0x36,0x34,0x34,0x2d,
-    0x31,0x2e,0x34,0x35,0x33,0x2d,0x37,0x2e,0x31,0x39,
-    0x39,0x2d,0x31,0x2e,0x34,0x35,0x33,0x68,0x2d,0x37,
-    0x2e,0x34,0x35,0x39,0x63,0x2d,0x32,0x2e,0x35,0x35,
-    0x33,0x2c,0x30,0x2d,0x34,0x2e,0x39,0x35,0x36,0x2c,
-    0x30,0x2e,0x33,0x38,0x33,0x2d,0x37,0x2e,0x31,0x39,
-    0x39,0x2c,0x31,0x2e,0x31,0x34,0x31,0x63,0x2d,0x32,
-    0x2e,0x32,0x34,0x33,0x2c,0x30,0x2e,0x37,0x36,0x36,
-    0x2d,0x34,0x2e,0x31,0x39,0x35,0x2c,0x31,0x2e,0x38,
-    0x35,0x33,0x2d,0x35,0x2e,0x38,0x35,0x32,0x2c,0x33,
-    0x2e,0x32,0x36,0x31,0x0a,0x09,0x09,0x63,0x2d,0x31,
-    0x2e,0x36,0x35,0x37,0x2c,0x31,0x2e,0x34,0x32,0x34,
-    0x2d,0x32,0x2e,0x39,0x37,0x31,0x2c,0x33,0x2e,0x31,
-    0x33,0x2d,0x33,0x2e,0x39,0x33,0x38,0x2c,0x35,0x2e,
-    0x31,0x32,0x38,0x63,0x2d,0x30,0x2e,0x39,0x36,0x39,
-    0x2c,0x32,0x2e,0x30,0x30,0x36,0x2d,0x31,0x2e,0x34,
-    0x35,0x31,0x2c,0x34,0x2e,0x32,0x38,0x37,0x2d,0x31,
-    0x2e,0x34,0x35,0x31,0x2c,0x36,0x2e,0x38,0x34,0x34,
-    0x63,0x30,0x2c,0x33,0x2e,0x36,0x35,0x38,0x2c,0x30,
-    0x2e,0x38,0x33,0x31,0x2c,0x36,0x2e,0x36,0x34,0x35,
-    0x2c,0x32,0x2e,0x34,0x38,0x38,0x2c,0x38,0x2e,0x39,
-    0x35,0x35,0x0a,0x09,0x09,0x63,0x31,0x2e,0x36,0x35,
-    0x37,0x2c,0x32,0x2e,0x33,0x31,0x39,0x2c,0x33,0x2e,
-    0x38,0x35,0x2c,0x34,0x2e,0x32,0x37,0x31,0x2c,0x36,
-    0x2e,0x35,0x37,0x39,0x2c,0x35,0x2e,0x38,0x35,0x35,
-    0x63,0x32,0x2e,0x37,0x32,0x35,0x2c,0x31,0x2e,0x35,
-    0x39,0x32,0x2c,0x35,0x2e,0x38,0x33,0x33,0x2c,0x32,
-    0x2e,0x39,0x31,0x36,0x2c,0x39,0x2e,0x33,0x32,0x33,
-    0x2c,0x33,0x2e,0x39,0x38,0x36,0x63,0x33,0x2e,0x34,
-    0x38,0x36,0x2c,0x31,0x2e,0x30,0x37,0x32,0x2c,0x37,
-    0x2e,0x30,0x34,0x32,0x2c,0x32,0x2e,0x31,0x37,0x34,
-    0x2c,0x31,0x30,0x2e,0x36,0x37,0x2c,0x33,0x2e,0x33,
-    0x31,0x34,0x0a,0x09,0x09,0x63,0x33,0x2e,0x36,0x32,
-    0x35,0x2c,0x31,0x2e,0x31,0x34,0x31,0x2c,0x37,0x2e,
-    0x31,0x38,0x2c,0x32,0x2e,0x34,0x33,0x36,0x2c,0x31,
-    0x30,0x2e,0x36,0x37,0x2c,0x33,0x2e,0x38,0x38,0x39,
-    0x63,0x33,0x2e,0x34,0x38,0x36,0x2c,0x31,0x2e,0x34,
-    0x34,0x36,0x2c,0x36,0x2e,0x35,0x39,0x34,0x2c,0x33,
-    0x2e,0x33,0x31,0x34,0x2c,0x39,0x2e,0x33,0x32,0x33,
-    0x2c,0x35,0x2e,0x35,0x38,0x38,0x63,0x32,0x2e,0x37,
-    0x32,0x39,0x2c,0x32,0x2e,0x32,0x38,0x2c,0x34,0x2e,
-    0x39,0x32,0x32,0x2c,0x35,0x2e,0x31,0x32,0x39,0x2c,
-    0x36,0x2e,0x35,0x37,0x39,0x2c,0x38,0x2e,0x35,0x35,
-    0x31,0x0a,0x09,0x09,0x43,0x35,0x36,0x32,0x2e,0x32,
-    0x38,0x32,0x2c,0x34,0x38,0x36,0x2e,0x39,0x38,0x39,
-    0x2c,0x35,0x36,0x33,0x2e,0x31,0x30,0x39,0x2c,0x34,
-    0x39,0x31,0x2e,0x32,0x31,0x34,0x2c,0x35,0x36,0x33,
-    0x2e,0x31,0x30,0x39,0x2c,0x34,0x39,0x36,0x2e,0x32,
-    0x35,0x38,0x7a,0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x64,0x3d,0x22,0x4d,0x36,0x32,
-    0x36,0x2e,0x31,0x39,0x36,0x2c,0x35,0x32,0x33,0x2e,
-    0x31,0x39,0x34,0x63,0x2d,0x33,0x2e,0x38,0x36,0x35,
-    0x2c,0x30,0x2d,0x37,0x2e,0x35,0x30,0x39,0x2d,0x30,
-    0x2e,0x37,0x32,0x39,0x2d,0x31,0x30,0x2e,0x39,0x32,
-    0x36,0x2d,0x32,0x2e,0x31,0x37,0x34,0x63,0x2d,0x33,
-    0x2e,0x34,0x32,0x31,0x2d,0x31,0x2e,0x34,0x35,0x35,
-    0x2d,0x36,0x2e,0x33,0x39,0x32,0x2d,0x33,0x2e,0x34,
-    0x36,0x31,0x2d,0x38,0x2e,0x39,0x31,0x2d,0x36,0x2e,
-    0x30,0x31,0x0a,0x09,0x09,0x63,0x2d,0x32,0x2e,0x35,
-    0x32,0x31,0x2d,0x32,0x2e,0x35,0x35,0x37,0x2d,0x34,
-    0x2e,0x35,0x32,0x32,0x2d,0x35,0x2e,0x35,0x32,0x35,
-    0x2d,0x36,0x2e,0x30,0x30,0x38,0x2d,0x38,0x2e,0x39,
-    0x30,0x38,0x63,0x2d,0x31,0x2e,0x34,0x38,0x35,0x2d,
-    0x33,0x2e,0x33,0x38,0x35,0x2d,0x32,0x2e,0x32,0x32,
-    0x39,0x2d,0x37,0x2e,0x30,0x31,0x33,0x2d,0x32,0x2e,
-    0x32,0x32,0x39,0x2d,0x31,0x30,0x2e,0x38,0x37,0x37,
-    0x76,0x2d,0x36,0x35,0x2e,0x39,0x39,0x36,0x68,0x2d,
-    0x31,0x39,0x2e,0x30,0x35,0x39,0x76,0x2d,0x31,0x32,
-    0x2e,0x31,0x31,0x37,0x68,0x31,0x39,0x2e,0x30,0x35,
-    0x39,0x76,0x2d,0x32,0x35,0x2e,0x34,0x37,0x39,0x6c,
-    0x31,0x32,0x2e,0x37,0x34,0x2d,0x32,0x2e,0x30,0x37,
-    0x33,0x0a,0x09,0x09,0x76,0x32,0x37,0x2e,0x35,0x35,
-    0x35,0x48,0x36,0x33,0x37,0x2e,0x38,0x76,0x31,0x32,
-    0x2e,0x31,0x31,0x37,0x68,0x2d,0x32,0x36,0x2e,0x39,
-    0x33,0x37,0x76,0x36,0x36,0x2e,0x36,0x31,0x34,0x63,
-    0x30,0x2c,0x32,0x2e,0x31,0x34,0x34,0x2c,0x30,0x2e,
-    0x33,0x39,0x38,0x2c,0x34,0x2e,0x31,0x32,0x36,0x2c,
-    0x31,0x2e,0x31,0x39,0x34,0x2c,0x35,0x2e,0x39,0x35,
-    0x35,0x63,0x30,0x2e,0x37,0x39,0x32,0x2c,0x31,0x2e,
-    0x38,0x32,0x39,0x2c,0x31,0x2e,0x38,0x37,0x39,0x2c,
-    0x33,0x2e,0x34,0x33,0x37,0x2c,0x33,0x2e,0x32,0x36,
-    0x31,0x2c,0x34,0x2e,0x38,0x31,0x33,0x0a,0x09,0x09,
-    0x63,0x31,0x2e,0x33,0x38,0x31,0x2c,0x31,0x2e,0x33,
-    0x38,0x36,0x2c,0x33,0x2e,0x30,0x30,0x34,0x2c,0x32,
-    0x2e,0x34,0x37,0x33,0x2c,0x34,0x2e,0x38,0x36,0x38,
-    0x2c,0x33,0x2e,0x32,0x37,0x63,0x31,0x2e,0x38,0x36,
-    0x38,0x2c,0x30,0x2e,0x37,0x38,0x38,0x2c,0x33,0x2e,
-    0x38,0x36,0x39,0x2c,0x31,0x2e,0x31,0x38,0x38,0x2c,
-    0x36,0x2e,0x30,0x30,0x38,0x2c,0x31,0x2e,0x31,0x38,
-    0x38,0x68,0x31,0x31,0x2e,0x36,0x30,0x34,0x76,0x31,
-    0x32,0x2e,0x31,0x32,0x33,0x48,0x36,0x32,0x36,0x2e,
-    0x31,0x39,0x36,0x4c,0x36,0x32,0x36,0x2e,0x31,0x39,
-    0x36,0x2c,0x35,0x32,0x33,0x2e,0x31,0x39,0x34,0x7a,
-    0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x64,0x3d,0x22,0x4d,0x37,0x32,0x37,0x2e,0x38,
-    0x32,0x31,0x2c,0x35,0x32,0x33,0x2e,0x31,0x39,0x34,
-    0x6c,0x2d,0x37,0x2e,0x30,0x34,0x32,0x2d,0x31,0x30,
-    0x2e,0x35,0x37,0x63,0x2d,0x32,0x2e,0x38,0x39,0x39,
-    0x2c,0x33,0x2e,0x38,0x30,0x34,0x2d,0x36,0x2e,0x35,
-    0x32,0x37,0x2c,0x36,0x2e,0x38,0x35,0x37,0x2d,0x31,
-    0x30,0x2e,0x38,0x37,0x36,0x2c,0x39,0x2e,0x31,0x36,
-    0x39,0x63,0x2d,0x34,0x2e,0x33,0x35,0x32,0x2c,0x32,
-    0x2e,0x33,0x31,0x32,0x2d,0x39,0x2e,0x31,0x31,0x36,
-    0x2c,0x33,0x2e,0x34,0x36,0x38,0x2d,0x31,0x34,0x2e,
-    0x32,0x39,0x39,0x2c,0x33,0x2e,0x34,0x36,0x38,0x68,
-    0x2d,0x33,0x2e,0x32,0x30,0x37,0x0a,0x09,0x09,0x63,
-    0x2d,0x34,0x2e,0x32,0x38,0x36,0x2c,0x30,0x2d,0x38,
-    0x2e,0x33,0x32,0x38,0x2d,0x30,0x2e,0x38,0x31,0x32,
-    0x2d,0x31,0x32,0x2e,0x31,0x32,0x34,0x2d,0x32,0x2e,
-    0x34,0x33,0x34,0x63,0x2d,0x33,0x2e,0x38,0x30,0x31,
-    0x2d,0x31,0x2e,0x36,0x32,0x33,0x2d,0x37,0x2e,0x31,
-    0x31,0x34,0x2d,0x33,0x2e,0x38,0x34,0x34,0x2d,0x39,
-    0x2e,0x39,0x34,0x33,0x2d,0x36,0x2e,0x36,0x38,0x34,
-    0x63,0x2d,0x32,0x2e,0x38,0x33,0x36,0x2d,0x32,0x2e,
-    0x38,0x32,0x34,0x2d,0x35,0x2e,0x30,0x36,0x32,0x2d,
-    0x36,0x2e,0x31,0x33,0x39,0x2d,0x36,0x2e,0x36,0x38,
-    0x32,0x2d,0x39,0x2e,0x39,0x34,0x32,0x0a,0x09,0x09,
-    0x63,0x2d,0x31,0x2e,0x36,0x32,0x37,0x2d,0x33,0x2e,
-    0x37,0x39,0x36,0x2d,0x32,0x2e,0x34,0x33,0x35,0x2d,
-    0x37,0x2e,0x38,0x33,0x39,0x2d,0x32,0x2e,0x34,0x33,
-    0x35,0x2d,0x31,0x32,0x2e,0x31,0x31,0x36,0x76,0x2d,
-    0x31,0x2e,0x30,0x34,0x31,0x63,0x30,0x2d,0x34,0x2e,
-    0x32,0x37,0x37,0x2c,0x30,0x2e,0x38,0x30,0x38,0x2d,
-    0x38,0x2e,0x33,0x32,0x2c,0x32,0x2e,0x34,0x33,0x35,
-    0x2d,0x31,0x32,0x2e,0x31,0x31,0x36,0x63,0x31,0x2e,
-    0x36,0x31,0x38,0x2d,0x33,0x2e,0x37,0x39,0x37,0x2c,
-    0x33,0x2e,0x38,0x34,0x36,0x2d,0x37,0x2e,0x31,0x31,
-    0x2c,0x36,0x2e,0x36,0x38,0x32,0x2d,0x39,0x2e,0x39,
-    0x34,0x32,0x0a,0x09,0x09,0x63,0x32,0x2e,0x38,0x32,
-    0x39,0x2d,0x32,0x2e,0x38,0x33,0x32,0x2c,0x36,0x2e,
-    0x31,0x34,0x34,0x2d,0x35,0x2e,0x30,0x36,0x31,0x2c,
-    0x39,0x2e,0x39,0x34,0x33,0x2d,0x36,0x2e,0x36,0x38,
-    0x33,0x63,0x33,0x2e,0x37,0x39,0x36,0x2d,0x31,0x2e,
-    0x36,0x32,0x32,0x2c,0x37,0x2e,0x38,0x33,0x38,0x2d,
-    0x32,0x2e,0x34,0x33,0x35,0x2c,0x31,0x32,0x2e,0x31,
-    0x32,0x34,0x2d,0x32,0x2e,0x34,0x33,0x35,0x68,0x32,
-    0x36,0x2e,0x39,0x33,0x32,0x76,0x2d,0x31,0x36,0x2e,
-    0x33,0x37,0x32,0x63,0x30,0x2d,0x32,0x2e,0x35,0x34,
-    0x39,0x2d,0x30,0x2e,0x34,0x38,0x35,0x2d,0x34,0x2e,
-    0x39,0x35,0x33,0x2d,0x31,0x2e,0x34,0x34,0x39,0x2d,
-    0x37,0x2e,0x31,0x39,0x35,0x0a,0x09,0x09,0x63,0x2d,
-    0x30,0x2e,0x39,0x37,0x2d,0x32,0x2e,0x32,0x34,0x31,
-    0x2d,0x32,0x2e,0x32,0x38,0x31,0x2d,0x34,0x2e,0x31,
-    0x39,0x34,0x2d,0x33,0x2e,0x39,0x33,0x36,0x2d,0x35,
-    0x2e,0x38,0x35,0x34,0x63,0x2d,0x31,0x2e,0x36,0x36,
-    0x31,0x2d,0x31,0x2e,0x36,0x35,0x33,0x2d,0x33,0x2e,
-    0x36,0x31,0x32,0x2d,0x32,0x2e,0x39,0x37,0x31,0x2d,
-    0x35,0x2e,0x38,0x35,0x34,0x2d,0x33,0x2e,0x39,0x33,
-    0x36,0x63,0x2d,0x32,0x2e,0x32,0x34,0x32,0x2d,0x30,
-    0x2e,0x39,0x36,0x34,0x2d,0x34,0x2e,0x36,0x34,0x36,
-    0x2d,0x31,0x2e,0x34,0x35,0x33,0x2d,0x37,0x2e,0x31,
-    0x39,0x39,0x2d,0x31,0x2e,0x34,0x35,0x33,0x68,0x2d,
-    0x37,0x2e,0x34,0x35,0x39,0x0a,0x09,0x09,0x63,0x2d,
-    0x32,0x2e,0x35,0x35,0x37,0x2c,0x30,0x2d,0x34,0x2e,
-    0x39,0x35,0x36,0x2c,0x30,0x2e,0x34,0x38,0x39,0x2d,
-    0x37,0x2e,0x32,0x30,0x32,0x2c,0x31,0x2e,0x34,0x35,
-    0x33,0x63,0x2d,0x32,0x2e,0x32,0x34,0x33,0x2c,0x30,
-    0x2e,0x39,0x36,0x35,0x2d,0x34,0x2e,0x31,0x39,0x34,
-    0x2c,0x32,0x2e,0x32,0x38,0x31,0x2d,0x35,0x2e,0x38,
-    0x35,0x32,0x2c,0x33,0x2e,0x39,0x33,0x36,0x63,0x2d,
-    0x31,0x2e,0x36,0x35,0x37,0x2c,0x31,0x2e,0x36,0x36,
-    0x2d,0x32,0x2e,0x39,0x37,0x31,0x2c,0x33,0x2e,0x36,
-    0x31,0x33,0x2d,0x33,0x2e,0x39,0x33,0x36,0x2c,0x35,
-    0x2e,0x38,0x35,0x34,0x0a,0x09,0x09,0x63,0x2d,0x30,
-    0x2e,0x39,0x36,0x39,0x2c,0x32,0x2e,0x32,0x34,0x32,
-    0x2d,0x31,0x2e,0x34,0x35,0x2c,0x34,0x2e,0x36,0x34,
-    0x36,0x2d,0x31,0x2e,0x34,0x35,0x2c,0x37,0x2e,0x31,
-    0x39,0x35,0x76,0x33,0x2e,0x38,0x33,0x34,0x6c,0x2d,
-    0x31,0x32,0x2e,0x37,0x34,0x34,0x2d,0x32,0x2e,0x30,
-    0x37,0x34,0x76,0x2d,0x31,0x2e,0x30,0x33,0x32,0x63,
-    0x30,0x2d,0x34,0x2e,0x32,0x37,0x39,0x2c,0x30,0x2e,
-    0x38,0x31,0x32,0x2d,0x38,0x2e,0x33,0x32,0x2c,0x32,
-    0x2e,0x34,0x33,0x35,0x2d,0x31,0x32,0x2e,0x31,0x31,
-    0x37,0x0a,0x09,0x09,0x63,0x31,0x2e,0x36,0x32,0x33,
-    0x2d,0x33,0x2e,0x38,0x30,0x35,0x2c,0x33,0x2e,0x38,
-    0x35,0x2d,0x37,0x2e,0x31,0x31,0x37,0x2c,0x36,0x2e,
-    0x36,0x38,0x33,0x2d,0x39,0x2e,0x39,0x35,0x63,0x32,
-    0x2e,0x38,0x33,0x32,0x2d,0x32,0x2e,0x38,0x33,0x32,
-    0x2c,0x36,0x2e,0x31,0x34,0x36,0x2d,0x35,0x2e,0x30,
-    0x35,0x32,0x2c,0x39,0x2e,0x39,0x34,0x36,0x2d,0x36,
-    0x2e,0x36,0x38,0x33,0x63,0x33,0x2e,0x37,0x39,0x36,
-    0x2d,0x31,0x2e,0x36,0x31,0x35,0x2c,0x37,0x2e,0x38,
-    0x33,0x38,0x2d,0x32,0x2e,0x34,0x33,0x35,0x2c,0x31,
-    0x32,0x2e,0x31,0x32,0x2d,0x32,0x2e,0x34,0x33,0x35,
-    0x68,0x37,0x2e,0x34,0x35,0x39,0x0a,0x09,0x09,0x63,
-    0x34,0x2e,0x32,0x38,0x33,0x2c,0x30,0x2c,0x38,0x2e,
-    0x33,0x32,0x2c,0x30,0x2e,0x38,0x31,0x39,0x2c,0x31,
-    0x32,0x2e,0x31,0x32,0x31,0x2c,0x32,0x2e,0x34,0x33,
-    0x35,0x63,0x33,0x2e,0x37,0x39,0x37,0x2c,0x31,0x2e,
-    0x36,0x33,0x31,0x2c,0x37,0x2e,0x31,0x30,0x39,0x2c,
-    0x33,0x2e,0x38,0x35,0x31,0x2c,0x39,0x2e,0x39,0x34,
-    0x31,0x2c,0x36,0x2e,0x36,0x38,0x33,0x63,0x32,0x2e,
-    0x38,0x33,0x32,0x2c,0x32,0x2e,0x38,0x33,0x33,0x2c,
-    0x35,0x2e,0x30,0x36,0x31,0x2c,0x36,0x2e,0x31,0x34,
-    0x36,0x2c,0x36,0x2e,0x36,0x38,0x34,0x2c,0x39,0x2e,
-    0x39,0x35,0x0a,0x09,0x09,0x63,0x31,0x2e,0x36,0x32,
-    0x33,0x2c,0x33,0x2e,0x37,0x39,0x37,0x2c,0x32,0x2e,
-    0x34,0x33,0x34,0x2c,0x37,0x2e,0x38,0x33,0x38,0x2c,
-    0x32,0x2e,0x34,0x33,0x34,0x2c,0x31,0x32,0x2e,0x31,
-    0x31,0x37,0x76,0x37,0x36,0x2e,0x39,0x37,0x31,0x48,
-    0x37,0x32,0x37,0x2e,0x38,0x32,0x31,0x4c,0x37,0x32,
-    0x37,0x2e,0x38,0x32,0x31,0x2c,0x35,0x32,0x33,0x2e,
-    0x31,0x39,0x34,0x7a,0x20,0x4d,0x37,0x31,0x39,0x2e,
-    0x33,0x32,0x38,0x2c,0x34,0x37,0x31,0x2e,0x38,0x31,
-    0x68,0x2d,0x32,0x36,0x2e,0x39,0x33,0x32,0x63,0x2d,
-    0x32,0x2e,0x35,0x36,0x31,0x2c,0x30,0x2d,0x34,0x2e,
-    0x39,0x36,0x2c,0x30,0x2e,0x34,0x38,0x32,0x2d,0x37,
-    0x2e,0x32,0x30,0x32,0x2c,0x31,0x2e,0x34,0x34,0x37,
-    0x0a,0x09,0x09,0x63,0x2d,0x32,0x2e,0x32,0x34,0x37,
-    0x2c,0x30,0x2e,0x39,0x37,0x33,0x2d,0x34,0x2e,0x31,
-    0x39,0x33,0x2c,0x32,0x2e,0x32,0x39,0x36,0x2d,0x35,
-    0x2e,0x38,0x35,0x34,0x2c,0x33,0x2e,0x39,0x38,0x38,
-    0x63,0x2d,0x31,0x2e,0x36,0x35,0x37,0x2c,0x31,0x2e,
-    0x36,0x39,0x39,0x2d,0x32,0x2e,0x39,0x37,0x31,0x2c,
-    0x33,0x2e,0x36,0x36,0x36,0x2d,0x33,0x2e,0x39,0x33,
-    0x36,0x2c,0x35,0x2e,0x39,0x30,0x38,0x63,0x2d,0x30,
-    0x2e,0x39,0x36,0x39,0x2c,0x32,0x2e,0x32,0x34,0x32,
-    0x2d,0x31,0x2e,0x34,0x35,0x2c,0x34,0x2e,0x36,0x34,
-    0x36,0x2d,0x31,0x2e,0x34,0x35,0x2c,0x37,0x2e,0x32,
-    0x30,0x33,0x76,0x34,0x2e,0x34,0x34,0x36,0x0a,0x09,
-    0x09,0x63,0x30,0x2c,0x32,0x2e,0x35,0x35,0x38,0x2c,
-    0x30,0x2e,0x34,0x38,0x31,0x2c,0x34,0x2e,0x39,0x36,
-    0x2c,0x31,0x2e,0x34,0x35,0x2c,0x37,0x2e,0x32,0x30,
-    0x32,0x63,0x30,0x2e,0x39,0x36,0x35,0x2c,0x32,0x2e,
-    0x32,0x34,0x33,0x2c,0x32,0x2e,0x32,0x37,0x37,0x2c,
-    0x34,0x2e,0x31,0x39,0x34,0x2c,0x33,0x2e,0x39,0x33,
-    0x36,0x2c,0x35,0x2e,0x38,0x35,0x35,0x63,0x31,0x2e,
-    0x36,0x36,0x31,0x2c,0x31,0x2e,0x36,0x35,0x32,0x2c,
-    0x33,0x2e,0x36,0x30,0x37,0x2c,0x32,0x2e,0x39,0x37,
-    0x2c,0x35,0x2e,0x38,0x35,0x34,0x2c,0x33,0x2e,0x39,
-    0x33,0x35,0x0a,0x09,0x09,0x63,0x32,0x2e,0x32,0x34,
-    0x32,0x2c,0x30,0x2e,0x39,0x36,0x35,0x2c,0x34,0x2e,
-    0x36,0x34,0x33,0x2c,0x31,0x2e,0x34,0x34,0x37,0x2c,
-    0x37,0x2e,0x32,0x30,0x32,0x2c,0x31,0x2e,0x34,0x34,
-    0x37,0x68,0x38,0x2e,0x34,0x39,0x32,0x63,0x32,0x2e,
-    0x35,0x35,0x33,0x2c,0x30,0x2c,0x34,0x2e,0x39,0x35,
-    0x37,0x2d,0x30,0x2e,0x34,0x38,0x32,0x2c,0x37,0x2e,
-    0x31,0x39,0x39,0x2d,0x31,0x2e,0x34,0x34,0x37,0x63,
-    0x32,0x2e,0x32,0x34,0x31,0x2d,0x30,0x2e,0x39,0x36,
-    0x35,0x2c,0x34,0x2e,0x31,0x39,0x33,0x2d,0x32,0x2e,
-    0x32,0x38,0x2c,0x35,0x2e,0x38,0x35,0x34,0x2d,0x33,
-    0x2e,0x39,0x33,0x35,0x0a,0x09,0x09,0x63,0x31,0x2e,
-    0x36,0x35,0x33,0x2d,0x31,0x2e,0x36,0x36,0x31,0x2c,
-    0x32,0x2e,0x39,0x36,0x36,0x2d,0x33,0x2e,0x36,0x31,
-    0x32,0x2c,0x33,0x2e,0x39,0x33,0x36,0x2d,0x35,0x2e,
-    0x38,0x35,0x35,0x63,0x30,0x2e,0x39,0x36,0x34,0x2d,
-    0x32,0x2e,0x32,0x34,0x32,0x2c,0x31,0x2e,0x34,0x34,
-    0x39,0x2d,0x34,0x2e,0x36,0x34,0x36,0x2c,0x31,0x2e,
-    0x34,0x34,0x39,0x2d,0x37,0x2e,0x32,0x30,0x32,0x4c,
-    0x37,0x31,0x39,0x2e,0x33,0x32,0x38,0x2c,0x34,0x37,
-    0x31,0x2e,0x38,0x31,0x4c,0x37,0x31,0x39,0x2e,0x33,
-    0x32,0x38,0x2c,0x34,0x37,0x31,0x2e,0x38,0x31,0x7a,
-    0x22,0x2f,0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,
-    0x20,0x64,0x3d,0x22,0x4d,0x37,0x39,0x36,0x2e,0x31,
-    0x39,0x33,0x2c,0x35,0x32,0x33,0x2e,0x31,0x39,0x34,
-    0x63,0x2d,0x33,0x2e,0x38,0x36,0x39,0x2c,0x30,0x2d,
-    0x37,0x2e,0x35,0x31,0x33,0x2d,0x30,0x2e,0x37,0x32,
-    0x39,0x2d,0x31,0x30,0x2e,0x39,0x32,0x37,0x2d,0x32,
-    0x2e,0x31,0x37,0x34,0x63,0x2d,0x33,0x2e,0x34,0x32,
-    0x31,0x2d,0x31,0x2e,0x34,0x35,0x35,0x2d,0x36,0x2e,
-    0x33,0x39,0x32,0x2d,0x33,0x2e,0x34,0x36,0x31,0x2d,
-    0x38,0x2e,0x39,0x30,0x39,0x2d,0x36,0x2e,0x30,0x31,
-    0x0a,0x09,0x09,0x63,0x2d,0x32,0x2e,0x35,0x32,0x36,
-    0x2d,0x32,0x2e,0x35,0x35,0x37,0x2d,0x34,0x2e,0x35,
-    0x32,0x33,0x2d,0x35,0x2e,0x35,0x32,0x35,0x2d,0x36,
-    0x2e,0x30,0x30,0x39,0x2d,0x38,0x2e,0x39,0x30,0x38,
-    0x63,0x2d,0x31,0x2e,0x34,0x38,0x35,0x2d,0x33,0x2e,
-    0x33,0x38,0x35,0x2d,0x32,0x2e,0x32,0x32,0x39,0x2d,
-    0x37,0x2e,0x30,0x31,0x33,0x2d,0x32,0x2e,0x32,0x32,
-    0x39,0x2d,0x31,0x30,0x2e,0x38,0x37,0x37,0x76,0x2d,
-    0x36,0x35,0x2e,0x39,0x39,0x36,0x68,0x2d,0x31,0x39,
-    0x2e,0x30,0x35,0x39,0x76,0x2d,0x31,0x32,0x2e,0x31,
-    0x31,0x37,0x68,0x31,0x39,0x2e,0x30,0x35,0x39,0x76,
-    0x2d,0x32,0x35,0x2e,0x34,0x37,0x39,0x0a,0x09,0x09,
-    0x6c,0x31,0x32,0x2e,0x37,0x34,0x31,0x2d,0x32,0x2e,
-    0x30,0x37,0x33,0x76,0x32,0x37,0x2e,0x35,0x35,0x35,
-    0x68,0x32,0x36,0x2e,0x39,0x33,0x32,0x76,0x31,0x32,
-    0x2e,0x31,0x31,0x37,0x68,0x2d,0x32,0x36,0x2e,0x39,
-    0x33,0x32,0x76,0x36,0x36,0x2e,0x36,0x31,0x34,0x63,
-    0x30,0x2c,0x32,0x2e,0x31,0x34,0x34,0x2c,0x30,0x2e,
-    0x33,0x39,0x35,0x2c,0x34,0x2e,0x31,0x32,0x36,0x2c,
-    0x31,0x2e,0x31,0x38,0x39,0x2c,0x35,0x2e,0x39,0x35,
-    0x35,0x63,0x30,0x2e,0x37,0x39,0x36,0x2c,0x31,0x2e,
-    0x38,0x32,0x39,0x2c,0x31,0x2e,0x38,0x38,0x33,0x2c,
-    0x33,0x2e,0x34,0x33,0x37,0x2c,0x33,0x2e,0x32,0x36,
-    0x35,0x2c,0x34,0x2e,0x38,0x31,0x33,0x0a,0x09,0x09,
-    0x63,0x31,0x2e,0x33,0x38,0x32,0x2c,0x31,0x2e,0x33,
-    0x38,0x36,0x2c,0x33,0x2e,0x30,0x30,0x35,0x2c,0x32,
-    0x2e,0x34,0x37,0x33,0x2c,0x34,0x2e,0x38,0x36,0x38,
-    0x2c,0x33,0x2e,0x32,0x37,0x63,0x31,0x2e,0x38,0x36,
-    0x34,0x2c,0x30,0x2e,0x37,0x38,0x38,0x2c,0x33,0x2e,
-    0x38,0x36,0x39,0x2c,0x31,0x2e,0x31,0x38,0x38,0x2c,
-    0x36,0x2e,0x30,0x30,0x39,0x2c,0x31,0x2e,0x31,0x38,
-    0x38,0x68,0x31,0x31,0x2e,0x36,0x76,0x31,0x32,0x2e,
-    0x31,0x32,0x33,0x48,0x37,0x39,0x36,0x2e,0x31,0x39,
-    0x33,0x4c,0x37,0x39,0x36,0x2e,0x31,0x39,0x33,0x2c,
-    0x35,0x32,0x33,0x2e,0x31,0x39,0x34,0x7a,0x22,0x2f,
-    0x3e,0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,
-    0x3d,0x22,0x4d,0x38,0x33,0x34,0x2e,0x34,0x31,0x39,
-    0x2c,0x33,0x39,0x31,0x2e,0x36,0x33,0x32,0x76,0x2d,
-    0x31,0x36,0x2e,0x39,0x38,0x38,0x68,0x31,0x34,0x2e,
-    0x38,0x31,0x33,0x76,0x31,0x36,0x2e,0x39,0x38,0x38,
-    0x48,0x38,0x33,0x34,0x2e,0x34,0x31,0x39,0x7a,0x20,
-    0x4d,0x38,0x33,0x35,0x2e,0x34,0x35,0x35,0x2c,0x35,
-    0x32,0x33,0x2e,0x31,0x39,0x34,0x56,0x34,0x31,0x37,
-    0x2e,0x31,0x31,0x33,0x68,0x31,0x32,0x2e,0x37,0x34,
-    0x76,0x31,0x30,0x36,0x2e,0x30,0x38,0x31,0x48,0x38,
-    0x33,0x35,0x2e,0x34,0x35,0x35,0x7a,0x22,0x2f,0x3e,
-    0x0a,0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,
-    0x22,0x4d,0x39,0x34,0x36,0x2e,0x33,0x35,0x31,0x2c,
-    0x35,0x30,0x36,0x2e,0x32,0x30,0x31,0x63,0x2d,0x31,
-    0x2e,0x36,0x32,0x33,0x2c,0x33,0x2e,0x38,0x30,0x35,
-    0x2d,0x33,0x2e,0x38,0x35,0x2c,0x37,0x2e,0x31,0x31,
-    0x38,0x2d,0x36,0x2e,0x36,0x38,0x32,0x2c,0x39,0x2e,
-    0x39,0x34,0x32,0x63,0x2d,0x32,0x2e,0x38,0x33,0x32,
-    0x2c,0x32,0x2e,0x38,0x34,0x2d,0x36,0x2e,0x31,0x34,
-    0x36,0x2c,0x35,0x2e,0x30,0x36,0x31,0x2d,0x39,0x2e,
-    0x39,0x34,0x33,0x2c,0x36,0x2e,0x36,0x38,0x34,0x0a,
-    0x09,0x09,0x63,0x2d,0x33,0x2e,0x38,0x30,0x31,0x2c,
-    0x31,0x2e,0x36,0x32,0x32,0x2d,0x37,0x2e,0x38,0x33,
-    0x38,0x2c,0x32,0x2e,0x34,0x33,0x34,0x2d,0x31,0x32,
-    0x2e,0x31,0x32,0x2c,0x32,0x2e,0x34,0x33,0x34,0x68,
-    0x2d,0x38,0x2e,0x34,0x39,0x33,0x63,0x2d,0x34,0x2e,
-    0x32,0x38,0x36,0x2c,0x30,0x2d,0x38,0x2e,0x33,0x32,
-    0x37,0x2d,0x30,0x2e,0x38,0x31,0x32,0x2d,0x31,0x32,
-    0x2e,0x31,0x32,0x34,0x2d,0x32,0x2e,0x34,0x33,0x34,
-    0x63,0x2d,0x33,0x2e,0x37,0x39,0x36,0x2d,0x31,0x2e,
-    0x36,0x32,0x33,0x2d,0x37,0x2e,0x31,0x30,0x39,0x2d,
-    0x33,0x2e,0x38,0x34,0x34,0x2d,0x39,0x2e,0x39,0x34,
-    0x31,0x2d,0x36,0x2e,0x36,0x38,0x34,0x0a,0x09,0x09,
-    0x63,0x2d,0x32,0x2e,0x38,0x33,0x32,0x2d,0x32,0x2e,
-    0x38,0x32,0x34,0x2d,0x35,0x2e,0x30,0x36,0x31,0x2d,
-    0x36,0x2e,0x31,0x33,0x39,0x2d,0x36,0x2e,0x36,0x38,
-    0x34,0x2d,0x39,0x2e,0x39,0x34,0x32,0x63,0x2d,0x31,
-    0x2e,0x36,0x32,0x33,0x2d,0x33,0x2e,0x37,0x39,0x36,
-    0x2d,0x32,0x2e,0x34,0x33,0x35,0x2d,0x37,0x2e,0x38,
-    0x33,0x39,0x2d,0x32,0x2e,0x34,0x33,0x35,0x2d,0x31,
-    0x32,0x2e,0x31,0x31,0x36,0x76,0x2d,0x34,0x37,0x2e,
-    0x38,0x36,0x31,0x63,0x30,0x2d,0x34,0x2e,0x32,0x37,
-    0x39,0x2c,0x30,0x2e,0x38,0x31,0x32,0x2d,0x38,0x2e,
-    0x33,0x32,0x2c,0x32,0x2e,0x34,0x33,0x35,0x2d,0x31,
-    0x32,0x2e,0x31,0x31,0x37,0x0a,0x09,0x09,0x63,0x31,
-    0x2e,0x36,0x32,0x33,0x2d,0x33,0x2e,0x38,0x30,0x35,
-    0x2c,0x33,0x2e,0x38,0x35,0x32,0x2d,0x37,0x2e,0x31,
-    0x31,0x37,0x2c,0x36,0x2e,0x36,0x38,0x34,0x2d,0x39,
-    0x2e,0x39,0x35,0x63,0x32,0x2e,0x38,0x33,0x31,0x2d,
-    0x32,0x2e,0x38,0x33,0x32,0x2c,0x36,0x2e,0x31,0x34,
-    0x36,0x2d,0x35,0x2e,0x30,0x35,0x32,0x2c,0x39,0x2e,
-    0x39,0x34,0x31,0x2d,0x36,0x2e,0x36,0x38,0x33,0x63,
-    0x33,0x2e,0x37,0x39,0x37,0x2d,0x31,0x2e,0x36,0x31,
-    0x35,0x2c,0x37,0x2e,0x38,0x33,0x38,0x2d,0x32,0x2e,
-    0x34,0x33,0x35,0x2c,0x31,0x32,0x2e,0x31,0x32,0x34,
-    0x2d,0x32,0x2e,0x34,0x33,0x35,0x68,0x38,0x2e,0x34,
-    0x39,0x33,0x0a,0x09,0x09,0x63,0x34,0x2e,0x32,0x38,
-    0x32,0x2c,0x30,0x2c,0x38,0x2e,0x33,0x31,0x39,0x2c,
-    0x30,0x2e,0x38,0x31,0x39,0x2c,0x31,0x32,0x2e,0x31,
-    0x32,0x2c,0x32,0x2e,0x34,0x33,0x35,0x63,0x33,0x2e,
-    0x37,0x39,0x37,0x2c,0x31,0x2e,0x36,0x33,0x31,0x2c,
-    0x37,0x2e,0x31,0x31,0x31,0x2c,0x33,0x2e,0x38,0x35,
-    0x31,0x2c,0x39,0x2e,0x39,0x34,0x33,0x2c,0x36,0x2e,
-    0x36,0x38,0x33,0x63,0x32,0x2e,0x38,0x33,0x31,0x2c,
-    0x32,0x2e,0x38,0x33,0x33,0x2c,0x35,0x2e,0x30,0x35,
-    0x39,0x2c,0x36,0x2e,0x31,0x34,0x36,0x2c,0x36,0x2e,
-    0x36,0x38,0x32,0x2c,0x39,0x2e,0x39,0x35,0x0a,0x09,
-    0x09,0x63,0x31,0x2e,0x36,0x32,0x33,0x2c,0x33,0x2e,
-    0x37,0x39,0x37,0x2c,0x32,0x2e,0x34,0x33,0x34,0x2c,
-    0x37,0x2e,0x38,0x33,0x38,0x2c,0x32,0x2e,0x34,0x33,
-    0x34,0x2c,0x31,0x32,0x2e,0x31,0x31,0x37,0x76,0x34,
-    0x37,0x2e,0x38,0x36,0x31,0x43,0x39,0x34,0x38,0x2e,
-    0x37,0x38,0x33,0x2c,0x34,0x39,0x38,0x2e,0x33,0x36,
-    0x33,0x2c,0x39,0x34,0x37,0x2e,0x39,0x37,0x34,0x2c,
-    0x35,0x30,0x32,0x2e,0x34,0x30,0x35,0x2c,0x39,0x34,
-    0x36,0x2e,0x33,0x35,0x31,0x2c,0x35,0x30,0x36,0x2e,
-    0x32,0x30,0x31,0x7a,0x20,0x4d,0x39,0x33,0x36,0x2e,
-    0x30,0x34,0x34,0x2c,0x34,0x34,0x35,0x2e,0x34,0x39,
-    0x36,0x0a,0x09,0x09,0x63,0x30,0x2d,0x32,0x2e,0x35,
-    0x34,0x39,0x2d,0x30,0x2e,0x34,0x38,0x35,0x2d,0x34,
-    0x2e,0x39,0x35,0x33,0x2d,0x31,0x2e,0x34,0x35,0x2d,
-    0x37,0x2e,0x31,0x39,0x35,0x63,0x2d,0x30,0x2e,0x39,
-    0x36,0x38,0x2d,0x32,0x2e,0x32,0x34,0x31,0x2d,0x32,
-    0x2e,0x32,0x38,0x31,0x2d,0x34,0x2e,0x31,0x39,0x34,
-    0x2d,0x33,0x2e,0x39,0x33,0x36,0x2d,0x35,0x2e,0x38,
-    0x35,0x34,0x63,0x2d,0x31,0x2e,0x36,0x36,0x31,0x2d,
-    0x31,0x2e,0x36,0x35,0x33,0x2d,0x33,0x2e,0x36,0x31,
-    0x31,0x2d,0x32,0x2e,0x39,0x37,0x31,0x2d,0x35,0x2e,
-    0x38,0x35,0x34,0x2d,0x33,0x2e,0x39,0x33,0x36,0x0a,
-    0x09,0x09,0x63,0x2d,0x32,0x2e,0x32,0x34,0x32,0x2d,
-    0x30,0x2e,0x39,0x36,0x34,0x2d,0x34,0x2e,0x36,0x34,
-    0x36,0x2d,0x31,0x2e,0x34,0x35,0x33,0x2d,0x37,0x2e,
-    0x31,0x39,0x38,0x2d,0x31,0x2e,0x34,0x35,0x33,0x68,
-    0x2d,0x38,0x2e,0x34,0x39,0x33,0x63,0x2d,0x32,0x2e,
-    0x35,0x35,0x37,0x2c,0x30,0x2d,0x34,0x2e,0x39,0x36,
-    0x2c,0x30,0x2e,0x34,0x38,0x39,0x2d,0x37,0x2e,0x32,
-    0x30,0x32,0x2c,0x31,0x2e,0x34,0x35,0x33,0x63,0x2d,
-    0x32,0x2e,0x32,0x34,0x32,0x2c,0x30,0x2e,0x39,0x36,
-    0x35,0x2d,0x34,0x2e,0x31,0x39,0x33,0x2c,0x32,0x2e,
-    0x32,0x38,0x31,0x2d,0x35,0x2e,0x38,0x35,0x34,0x2c,
-    0x33,0x2e,0x39,0x33,0x36,0x0a,0x09,0x09,0x63,0x2d,
-    0x31,0x2e,0x36,0x35,0x33,0x2c,0x31,0x2e,0x36,0x36,
-    0x2d,0x32,0x2e,0x39,0x37,0x2c,0x33,0x2e,0x36,0x31,
-    0x33,0x2d,0x33,0x2e,0x39,0x33,0x36,0x2c,0x35,0x2e,
-    0x38,0x35,0x34,0x63,0x2d,0x30,0x2e,0x39,0x36,0x38,
-    0x2c,0x32,0x2e,0x32,0x34,0x32,0x2d,0x31,0x2e,0x34,
-    0x34,0x39,0x2c,0x34,0x2e,0x36,0x34,0x36,0x2d,0x31,
-    0x2e,0x34,0x34,0x39,0x2c,0x37,0x2e,0x31,0x39,0x35,
-    0x76,0x34,0x39,0x2e,0x33,0x31,0x63,0x30,0x2c,0x32,
-    0x2e,0x35,0x35,0x37,0x2c,0x30,0x2e,0x34,0x38,0x31,
-    0x2c,0x34,0x2e,0x39,0x35,0x39,0x2c,0x31,0x2e,0x34,
-    0x34,0x39,0x2c,0x37,0x2e,0x32,0x30,0x31,0x0a,0x09,
-    0x09,0x63,0x30,0x2e,0x39,0x36,0x36,0x2c,0x32,0x2e,
-    0x32,0x34,0x33,0x2c,0x32,0x2e,0x32,0x38,0x31,0x2c,
-    0x34,0x2e,0x31,0x39,0x34,0x2c,0x33,0x2e,0x39,0x33,
-    0x36,0x2c,0x35,0x2e,0x38,0x35,0x35,0x63,0x31,0x2e,
-    0x36,0x36,0x31,0x2c,0x31,0x2e,0x36,0x35,0x32,0x2c,
-    0x33,0x2e,0x36,0x31,0x32,0x2c,0x32,0x2e,0x39,0x37,
-    0x2c,0x35,0x2e,0x38,0x35,0x34,0x2c,0x33,0x2e,0x39,
-    0x33,0x35,0x63,0x32,0x2e,0x32,0x34,0x32,0x2c,0x30,
-    0x2e,0x39,0x36,0x36,0x2c,0x34,0x2e,0x36,0x34,0x36,
-    0x2c,0x31,0x2e,0x34,0x34,0x37,0x2c,0x37,0x2e,0x32,
-    0x30,0x32,0x2c,0x31,0x2e,0x34,0x34,0x37,0x68,0x38,
-    0x2e,0x34,0x39,0x33,0x0a,0x09,0x09,0x63,0x32,0x2e,
-    0x35,0x35,0x33,0x2c,0x30,0x2c,0x34,0x2e,0x39,0x35,
-    0x36,0x2d,0x30,0x2e,0x34,0x38,0x31,0x2c,0x37,0x2e,
-    0x31,0x39,0x38,0x2d,0x31,0x2e,0x34,0x34,0x37,0x63,
-    0x32,0x2e,0x32,0x34,0x33,0x2d,0x30,0x2e,0x39,0x36,
-    0x35,0x2c,0x34,0x2e,0x31,0x39,0x33,0x2d,0x32,0x2e,
-    0x32,0x38,0x2c,0x35,0x2e,0x38,0x35,0x34,0x2d,0x33,
-    0x2e,0x39,0x33,0x35,0x63,0x31,0x2e,0x36,0x35,0x33,
-    0x2d,0x31,0x2e,0x36,0x36,0x31,0x2c,0x32,0x2e,0x39,
-    0x36,0x38,0x2d,0x33,0x2e,0x36,0x31,0x32,0x2c,0x33,
-    0x2e,0x39,0x33,0x36,0x2d,0x35,0x2e,0x38,0x35,0x35,
-    0x0a,0x09,0x09,0x63,0x30,0x2e,0x39,0x36,0x35,0x2d,
-    0x32,0x2e,0x32,0x34,0x32,0x2c,0x31,0x2e,0x34,0x35,
-    0x2d,0x34,0x2e,0x36,0x34,0x36,0x2c,0x31,0x2e,0x34,
-    0x35,0x2d,0x37,0x2e,0x32,0x30,0x31,0x56,0x34,0x34,
-    0x35,0x2e,0x34,0x39,0x36,0x7a,0x22,0x2f,0x3e,0x0a,
-    0x09,0x3c,0x70,0x61,0x74,0x68,0x20,0x64,0x3d,0x22,
-    0x4d,0x31,0x30,0x33,0x32,0x2e,0x33,0x38,0x35,0x2c,
-    0x35,0x32,0x33,0x2e,0x31,0x39,0x34,0x76,0x2d,0x37,
-    0x37,0x2e,0x36,0x39,0x38,0x63,0x30,0x2d,0x32,0x2e,
-    0x35,0x34,0x39,0x2d,0x30,0x2e,0x34,0x38,0x32,0x2d,
-    0x34,0x2e,0x39,0x35,0x33,0x2d,0x31,0x2e,0x34,0x35,
-    0x2d,0x37,0x2e,0x31,0x39,0x35,0x63,0x2d,0x30,0x2e,
-    0x39,0x36,0x39,0x2d,0x32,0x2e,0x32,0x34,0x31,0x2d,
-    0x32,0x2e,0x32,0x37,0x37,0x2d,0x34,0x2e,0x31,0x39,
-    0x34,0x2d,0x33,0x2e,0x39,0x33,0x38,0x2d,0x35,0x2e,
-    0x38,0x35,0x34,0x0a,0x09,0x09,0x63,0x2d,0x31,0x2e,
-    0x36,0x35,0x32,0x2d,0x31,0x2e,0x36,0x35,0x33,0x2d,
-    0x33,0x2e,0x36,0x30,0x38,0x2d,0x32,0x2e,0x39,0x37,
-    0x31,0x2d,0x35,0x2e,0x38,0x35,0x32,0x2d,0x33,0x2e,
-    0x39,0x33,0x36,0x63,0x2d,0x32,0x2e,0x32,0x34,0x37,
-    0x2d,0x30,0x2e,0x39,0x36,0x34,0x2d,0x34,0x2e,0x36,
-    0x34,0x36,0x2d,0x31,0x2e,0x34,0x35,0x33,0x2d,0x37,
-    0x2e,0x31,0x39,0x39,0x2d,0x31,0x2e,0x34,0x35,0x33,
-    0x68,0x2d,0x38,0x2e,0x34,0x39,0x36,0x63,0x2d,0x32,
-    0x2e,0x35,0x35,0x37,0x2c,0x30,0x2d,0x34,0x2e,0x39,
-    0x35,0x36,0x2c,0x30,0x2e,0x34,0x38,0x39,0x2d,0x37,
-    0x2e,0x31,0x39,0x38,0x2c,0x31,0x2e,0x34,0x35,0x33,
-    0x0a,0x09,0x09,0x63,0x2d,0x32,0x2e,0x32,0x34,0x36,
-    0x2c,0x30,0x2e,0x39,0x36,0x35,0x2d,0x34,0x2e,0x31,
-    0x39,0x34,0x2c,0x32,0x2e,0x32,0x38,0x31,0x2d,0x35,
-    0x2e,0x38,0x35,0x33,0x2c,0x33,0x2e,0x39,0x33,0x36,
-    0x63,0x2d,0x31,0x2e,0x36,0x36,0x31,0x2c,0x31,0x2e,
-    0x36,0x36,0x2d,0x32,0x2e,0x39,0x37,0x2c,0x33,0x2e,
-    0x36,0x31,0x33,0x2d,0x33,0x2e,0x39,0x33,0x38,0x2c,
-    0x35,0x2e,0x38,0x35,0x34,0x63,0x2d,0x30,0x2e,0x39,
-    0x37,0x2c,0x32,0x2e,0x32,0x34,0x32,0x2d,0x31,0x2e,
-    0x34,0x35,0x31,0x2c,0x34,0x2e,0x36,0x34,0x36,0x2d,
-    0x31,0x2e,0x34,0x35,0x31,0x2c,0x37,0x2e,0x31,0x39,
-    0x35,0x76,0x37,0x37,0x2e,0x36,0x39,0x38,0x68,0x2d,
-    0x31,0x32,0x2e,0x37,0x34,0x0a,0x09,0x09,0x56,0x34,
-    0x31,0x37,0x2e,0x31,0x31,0x33,0x68,0x34,0x2e,0x32,
-    0x34,0x34,0x6c,0x36,0x2e,0x39,0x34,0x32,0x2c,0x31,
-    0x30,0x2e,0x37,0x37,0x36,0x63,0x32,0x2e,0x39,0x2d,
-    0x33,0x2e,0x39,0x34,0x2c,0x36,0x2e,0x35,0x34,0x35,
-    0x2d,0x37,0x2e,0x30,0x36,0x33,0x2c,0x31,0x30,0x2e,
-    0x39,0x33,0x31,0x2d,0x39,0x2e,0x33,0x37,0x35,0x63,
-    0x34,0x2e,0x33,0x38,0x36,0x2d,0x32,0x2e,0x33,0x31,
-    0x32,0x2c,0x39,0x2e,0x31,0x37,0x2d,0x33,0x2e,0x34,
-    0x37,0x37,0x2c,0x31,0x34,0x2e,0x33,0x34,0x34,0x2d,
-    0x33,0x2e,0x34,0x37,0x37,0x68,0x33,0x2e,0x32,0x31,
-    0x35,0x0a,0x09,0x09,0x63,0x34,0x2e,0x32,0x37,0x38,
-    0x2c,0x30,0x2c,0x38,0x2e,0x33,0x32,0x2c,0x30,0x2e,
-    0x38,0x31,0x38,0x2c,0x31,0x32,0x2e,0x31,0x31,0x37,
-    0x2c,0x32,0x2e,0x34,0x33,0x36,0x63,0x33,0x2e,0x38,
-    0x2c,0x31,0x2e,0x36,0x32,0x39,0x2c,0x37,0x2e,0x31,
-    0x31,0x34,0x2c,0x33,0x2e,0x38,0x35,0x2c,0x39,0x2e,
-    0x39,0x35,0x2c,0x36,0x2e,0x36,0x38,0x32,0x63,0x32,
-    0x2e,0x38,0x32,0x38,0x2c,0x32,0x2e,0x38,0x33,0x33,
-    0x2c,0x35,0x2e,0x30,0x35,0x36,0x2c,0x36,0x2e,0x31,
-    0x34,0x36,0x2c,0x36,0x2e,0x36,0x37,0x39,0x2c,0x39,
-    0x2e,0x39,0x35,0x31,0x0a,0x09,0x09,0x63,0x31,0x2e,
-    0x36,0x32,0x32,0x2c,0x33,0x2e,0x37,0x39,0x35,0x2c,
-    0x32,0x2e,0x34,0x33,0x35,0x2c,0x37,0x2e,0x38,0x33,
-    0x38,0x2c,0x32,0x2e,0x34,0x33,0x35,0x2c,0x31,0x32,
-    0x2e,0x31,0x31,0x35,0x76,0x37,0x36,0x2e,0x39,0x37,
-    0x33,0x48,0x31,0x30,0x33,0x32,0x2e,0x33,0x38,0x35,
-    0x4c,0x31,0x30,0x33,0x32,0x2e,0x33,0x38,0x35,0x2c,
-    0x35,0x32,0x33,0x2e,0x31,0x39,0x34,0x7a,0x22,0x2f,
-    0x3e,0x0a,0x3c,0x2f,0x67,0x3e,0x0a,0x3c,0x2f,0x73,
-    0x76,0x67,0x3e,0x0a
+const size_t splash_svg_size = 5670;
+const unsigned char splash_svg_data[5670] = {
+    0x45,0x53,0x5a,0x31,0x64,0x45,0x00,0x00,0x78,0xda,
+    0xb5,0x5c,0x6d,0x6f,0x1c,0x47,0x72,0xfe,0x2c,0xfd,
+    0x8a,0x0d,0xf3,0x29,0xc0,0xcc,0xb0,0xdf,0x5f,0x8c,
+    0x93,0x0f,0xb1,0xec,0x33,0x0d,0xd0,0x77,0x06,0x72,
+    0x61,0x90,0x4f,0x81,0xbc,0xe2,0x69,0x89,0x63,0x24,
+    0x41,0xa4,0x57,0x8e,0x7f,0x7d,0xea,0xa9,0xea,0x99,
+    0xae,0xdd,0xe1,0x92,0x94,0x73,0xb9,0x0f,0xcb,0x19,
+    0x6d,0x6f,0x77,0x75,0x75,0x55,0x3d,0x4f,0x55,0xb5,
+    0xef,0x0f,0x7f,0xfc,0xf5,0xbf,0x6f,0x37,0xfb,0xeb,
+    0x4f,0x77,0x37,0x1f,0xde,0xbf,0x3a,0xb3,0x93,0x39,
+    0xdb,0x5c,0xbf,0xdf,0x7e,0x78,0x7b,0xf3,0xfe,0xdd,
+    0xab,0xb3,0x5f,0xee,0xff,0x36,0x96,0xb3,0x3f,0x7e,
+    0xfd,0xf2,0x0f,0xff,0x34,0x8e,0x9b,0xef,0xaf,0xdf,
+    0x5f,0x7f,0x7a,0x73,0xff,0xe1,0xd3,0x57,0x9b,0x7f,
+    0x7d,0xfb,0xe1,0xe7,0xeb,0xcd,0x0f,0xb7,0xb7,0xbf,
+    0xdc,0xdd,0xf3,0x3f,0x6d,0x6c,0x9a,0xcc,0x64,0x86,
+    0xcd,0xbf,0x5d,0x7d,0xbf,0xf9,0xee,0xd7,0x8f,0x1f,
+    0x3e,0xdd,0x6f,0x7e,0xba,0xfd,0xe5,0xdd,0xf8,0xc3,
+    0xfb,0xcd,0xc4,0xff,0x78,0x25,0x6b,0x7c,0xb5,0xa1,
+    0x81,0x66,0xf3,0xcd,0x2f,0x37,0xb7,0x6f,0x37,0xe6,
+    0x5f,0x36,0x9b,0x71,0xc4,0xf4,0xdf,0xfe,0xe5,0xf5,
+    0x5f,0xff,0xf3,0xa7,0xef,0x36,0x77,0xfb,0x77,0x9b,
+    0x9f,0xfe,0xfd,0x9b,0xcb,0x1f,0x5e,0x6f,0xce,0xc6,
+    0xf3,0xf3,0xff,0xf0,0xaf,0xcf,0xcf,0xbf,0xfd,0xeb,
+    0xb7,0x3c,0x83,0x9d,0xec,0xf9,0xf9,0x77,0x7f,0x3e,
+    0xdb,0x9c,0xed,0xee,0xef,0x3f,0x7e,0x75,0x7e,0xfe,
+    0xf9,0xf3,0xe7,0xe9,0xb3,0x9f,0x3e,0x7c,0x7a,0x77,
+    0xfe,0xfd,0xa7,0x37,0x1f,0x77,0x37,0xdb,0xbb,0x73,
+    0x1a,0x78,0x8e,0x81,0xf4,0xa3,0x73,0x9a,0xcc,0xda,
+    0xe9,0xed,0xfd,0xdb,0x33,0x5a,0x02,0x33,0xab,0x7d,
+    0xda,0xb3,0xcd,0xcd,0xdb,0x57,0x67,0xdf,0xfd,0x4c,
+    0x9b,0xfa,0x2f,0x7a,0x21,0x35,0xbc,0xbf,0x7b,0xf5,
+    0xc0,0xcc,0xce,0x18,0x83,0x99,0xda,0x90,0xaf,0x7e,
+    0xbd,0xbd,0x79,0xff,0xf7,0x87,0x06,0xda,0x5a,0xeb,
+    0x39,0x7f,0x4b,0x43,0x5f,0x9d,0x99,0x8f,0xbf,0x9e,
+    0x6d,0xfe,0x47,0xfe,0xbe,0x7c,0xb1,0xf9,0x7c,0xf3,
+    0xf6,0x7e,0x47,0x0b,0xbb,0xc2,0x5f,0xec,0xae,0x6f,
+    0xde,0xed,0xee,0x5f,0x9d,0x65,0xc7,0xaf,0xfb,0x9b,
+    0xeb,0xcf,0xdf,0x7c,0xc0,0xaf,0x36,0x66,0x83,0x31,
+    0x1b,0xfa,0x02,0x27,0xf1,0xe6,0xe7,0xdb,0xeb,0xf1,
+    0xe7,0x37,0xdb,0xbf,0xbf,0xfb,0xf4,0xe1,0x97,0xf7,
+    0x24,0xf0,0xfb,0xeb,0xcf,0x9b,0xc3,0x41,0x24,0xd6,
+    0x57,0x77,0x1f,0xdf,0x6c,0xaf,0x5f,0x9d,0x7d,0xfc,
+    0x74,0x7d,0x77,0xfd,0x69,0x7f,0x8d,0xfd,0x7e,0x7c,
+    0x73,0xbf,0xdb,0xfc,0xed,0xe6,0xf6,0xf6,0xd5,0xd9,
+    0x3f,0xbf,0xae,0xc6,0x58,0x77,0xb6,0xa1,0xdf,0xff,
+    0x18,0xbc,0x9d,0xa2,0xab,0x43,0x08,0x6e,0x32,0x35,
+    0x5f,0x3e,0xf1,0xfe,0xdb,0xd9,0xf9,0x33,0x26,0xf3,
+    0xb1,0x4e,0xce,0xa6,0xcb,0x27,0xde,0x9f,0x37,0x99,
+    0xcb,0x69,0xf2,0xa6,0xff,0xf8,0xc4,0xfb,0x33,0x25,
+    0xb3,0x79,0xca,0xd1,0x5f,0x3e,0xf1,0xfe,0xbc,0xc9,
+    0x42,0xf1,0x53,0x0c,0xe1,0xf2,0x89,0xf7,0x67,0x4e,
+    0x66,0xcc,0x94,0x82,0xbb,0x7c,0xe2,0xfd,0x99,0x3a,
+    0xf3,0x61,0x2a,0xea,0xc7,0x27,0xde,0xd7,0x93,0x19,
+    0x13,0xbe,0xcb,0xfe,0x68,0xb2,0x10,0xa7,0x1a,0xed,
+    0xd6,0x8c,0x69,0xb2,0x76,0x0c,0x13,0x59,0xf6,0x48,
+    0x9e,0x64,0x4d,0x91,0x3f,0xb1,0xbd,0x5d,0xa4,0x3a,
+    0xc5,0xe4,0xb7,0x3c,0xce,0x0d,0x66,0xb4,0x81,0x44,
+    0x0e,0x03,0x69,0xc1,0x87,0xd1,0x96,0xa9,0x26,0x3f,
+    0xe4,0xa9,0xc4,0xf8,0xf2,0xc5,0xed,0xe8,0xe2,0x94,
+    0x43,0x1c,0xe4,0xcf,0x6b,0x67,0x68,0x90,0xa7,0xc3,
+    0x74,0x53,0x4e,0x61,0xb0,0x79,0x70,0xc5,0x4e,0xae,
+    0x26,0x79,0xcc,0x53,0x30,0x69,0xef,0x5c,0x9a,0x42,
+    0x2a,0x5b,0x33,0x60,0x05,0x3b,0xb0,0x28,0x03,0x2f,
+    0xde,0xfe,0xa4,0xf6,0xb6,0xf3,0xd1,0x4c,0x25,0xbd,
+    0x7c,0xb1,0xa5,0x91,0x26,0x0f,0x66,0x60,0x59,0xfc,
+    0x08,0x59,0xe2,0x20,0xb2,0x8c,0x90,0x25,0xdc,0xb2,
+    0x04,0x96,0xe5,0xf1,0x69,0x1b,0x26,0xef,0x68,0x8f,
+    0x64,0x08,0x2c,0x2a,0xc9,0xed,0xe8,0x8f,0x9f,0x5f,
+    0xf0,0xc3,0x78,0x79,0xa4,0x1a,0xa5,0xc7,0x0f,0xe4,
+    0x7a,0x37,0xf7,0x70,0xf4,0xc9,0x9d,0xf4,0x58,0xfa,
+    0x9f,0xa8,0xd8,0x17,0x37,0x39,0x37,0xf8,0x4a,0xbb,
+    0x2e,0x55,0x74,0xe2,0xf9,0xd3,0xd5,0x2d,0x4b,0x51,
+    0xf9,0xb3,0x88,0x14,0x61,0x54,0x52,0x88,0xf8,0xee,
+    0x82,0xbe,0x9d,0x5c,0xa1,0x9d,0xce,0x6a,0xa7,0x80,
+    0x6a,0xf9,0x44,0xec,0xfa,0xf9,0x0e,0xfb,0x77,0xac,
+    0x85,0xd0,0xb6,0xc4,0x07,0x72,0x9b,0xf2,0x64,0x6b,
+    0x1e,0xf9,0x8f,0x5f,0x94,0xe0,0xec,0xd0,0xd7,0x8d,
+    0xf4,0x33,0x17,0x65,0xd9,0x78,0x01,0xb7,0x2b,0xde,
+    0xcd,0xeb,0xda,0xf9,0xb8,0xfd,0x03,0xc7,0x7d,0x49,
+    0x3b,0xb2,0xc1,0x0d,0x91,0x60,0xa1,0xa4,0xed,0x68,
+    0xa7,0xe2,0xe8,0x10,0xe8,0x93,0x45,0x21,0x55,0xe3,
+    0x33,0xd0,0x8a,0x25,0xe3,0x54,0x4b,0xca,0x5b,0x0a,
+    0x37,0xb4,0x19,0x7c,0xd2,0x3f,0xe4,0x92,0x06,0x2c,
+    0x5e,0x30,0x9f,0x6f,0xcf,0xb4,0x34,0xf6,0x14,0xe9,
+    0x70,0x0d,0x86,0xc9,0x9f,0x34,0x98,0x5d,0xad,0x74,
+    0x2a,0x7e,0x67,0x69,0x37,0xb5,0x94,0x6d,0x93,0x8f,
+    0x4d,0x83,0x56,0x34,0x3c,0x33,0x5e,0xbc,0xc7,0x8b,
+    0xf3,0x98,0xc7,0xc6,0x51,0x7e,0x4e,0xa2,0xc4,0x0a,
+    0xb1,0x92,0xc3,0x6a,0x05,0xfb,0x2d,0xac,0x9f,0x10,
+    0x58,0x3f,0xbc,0xe9,0xc5,0x4c,0x12,0x6f,0xd1,0xcb,
+    0x01,0xb9,0xf9,0x85,0x37,0xbf,0x1f,0x2d,0xc5,0x39,
+    0x1f,0x5f,0xfb,0x4a,0x53,0x67,0x4f,0x3e,0x1c,0x49,
+    0x43,0x83,0x2f,0x89,0xe2,0x02,0x9d,0x3a,0x4d,0x66,
+    0xf0,0xaa,0x8d,0x60,0xed,0x93,0x7f,0xe2,0xff,0x89,
+    0xc1,0xb0,0xd6,0x5d,0x68,0xd1,0xa0,0xb2,0xee,0x4d,
+    0x59,0x74,0xcf,0x07,0x9b,0x64,0x79,0x3e,0xa7,0x2c,
+    0x36,0x25,0xd6,0x6d,0xcb,0x56,0x0e,0xb5,0x7d,0xf2,
+    0x00,0x11,0x3c,0xe2,0x25,0x45,0xf9,0x65,0x82,0x7b,
+    0xb2,0x96,0x78,0x03,0x81,0x4e,0x0c,0x8a,0x2e,0x7c,
+    0xd0,0xd0,0x8f,0x8b,0xf3,0x59,0xd3,0xaf,0x42,0x5b,
+    0xef,0xd0,0x91,0xf2,0x56,0xad,0x34,0x88,0x72,0xc4,
+    0x72,0xb4,0xf3,0xc5,0x9d,0x35,0x8e,0x14,0xab,0xfc,
+    0x34,0x4f,0x31,0x37,0x1b,0xe2,0x63,0x6e,0x26,0xd4,
+    0xe2,0x85,0x1d,0xda,0xec,0x6d,0x62,0x59,0x44,0xe9,
+    0x3e,0x1e,0x18,0xde,0x6e,0x4c,0xa4,0xa7,0xa2,0xbd,
+    0xa3,0x79,0x03,0x42,0x47,0x69,0xcf,0x12,0xbd,0xf6,
+    0x6d,0xaf,0x12,0x5c,0x64,0x40,0xfb,0xea,0x20,0xb6,
+    0xa4,0x5b,0x9a,0x33,0x1b,0xb6,0x23,0x93,0x59,0xee,
+    0xc2,0xcf,0x6e,0x50,0xf1,0xce,0x0f,0x4a,0x0e,0x32,
+    0x18,0x56,0x8e,0x1f,0x9a,0x6b,0x43,0x6c,0xc8,0x6e,
+    0xa3,0x18,0x8c,0x28,0xc8,0xce,0x2f,0x62,0x3d,0x62,
+    0x3c,0x4d,0x1e,0x3e,0xd9,0xb6,0x82,0x1c,0xed,0x3c,
+    0xee,0x40,0x33,0xd0,0x64,0x57,0x8d,0xcd,0x5a,0x35,
+    0x07,0x3e,0x19,0x66,0xd5,0x1c,0x45,0xeb,0x03,0x13,
+    0x9a,0x23,0xe4,0xa8,0x4e,0x76,0x59,0x41,0xac,0x7f,
+    0xc4,0xfc,0x45,0xc6,0x0d,0x3d,0x3e,0x84,0x76,0xb0,
+    0xdb,0x36,0x39,0xab,0x4e,0xb0,0xa3,0xb4,0x67,0x09,
+    0xd4,0x57,0x81,0xfe,0xe6,0xd8,0xc0,0xa5,0x9f,0x0f,
+    0x14,0xea,0xe5,0xb9,0xf9,0x79,0xa0,0xef,0xf0,0xfb,
+    0xd0,0xc6,0x18,0x3f,0x98,0xcb,0x23,0x7f,0x10,0xe7,
+    0x79,0x77,0x18,0x85,0xbf,0x7e,0xf9,0x42,0xfc,0x09,
+    0x0e,0x44,0xf8,0x4e,0x96,0x3c,0xf8,0x4c,0xf0,0x90,
+    0x73,0x5b,0x56,0x66,0x74,0xbe,0xc8,0x83,0xa7,0x08,
+    0x68,0xe8,0x48,0x2d,0x19,0xeb,0x1c,0x2f,0x8b,0x2d,
+    0x4d,0x89,0x85,0x22,0x80,0xc4,0x83,0x12,0x39,0x1e,
+    0x00,0x66,0x5e,0xac,0xcd,0x3d,0x9e,0x34,0xf7,0xb8,
+    0x6d,0x5e,0xcb,0xc6,0x1e,0x1e,0x32,0x76,0x09,0xc7,
+    0x03,0x4f,0xef,0x30,0xfd,0x38,0x9b,0x4c,0xf3,0xdb,
+    0x36,0x52,0x3f,0xdf,0x89,0x76,0x9b,0x29,0x2e,0x5a,
+    0x4c,0xb7,0x30,0x24,0x27,0x5f,0xe4,0x79,0x69,0x56,
+    0xa8,0x25,0x43,0x8e,0x6c,0xe9,0x1e,0xcf,0x84,0x24,
+    0xf8,0x9d,0x29,0xe9,0x76,0xc4,0xcf,0x69,0x40,0x9c,
+    0x62,0x95,0xf5,0xcd,0x14,0xc8,0xa8,0x89,0xad,0x57,
+    0x8a,0x0a,0x64,0xff,0x19,0x43,0xe1,0x43,0xb4,0x57,
+    0x58,0xbb,0xa7,0xd8,0xea,0x11,0xda,0x2d,0x87,0x76,
+    0xfa,0x1c,0xe9,0xc7,0x39,0x0d,0xf4,0x59,0xc6,0x3a,
+    0x15,0x82,0x72,0xfe,0x64,0x6b,0x72,0x86,0xed,0x95,
+    0xfe,0xf4,0x9d,0x59,0xb6,0xeb,0xc2,0x2e,0x51,0xb0,
+    0xb3,0xea,0x60,0xb8,0xd5,0x96,0x26,0x80,0x21,0x2d,
+    0xe1,0x93,0x45,0xa6,0x35,0xe9,0x39,0x45,0x96,0x38,
+    0xf0,0x56,0x93,0xdb,0xd1,0xf1,0xd6,0x5c,0x95,0x53,
+    0x06,0xb8,0x4c,0x2e,0x50,0xaf,0xcf,0x44,0x12,0x48,
+    0x15,0x05,0x7e,0x16,0x6d,0xb9,0x75,0x89,0xc1,0xc4,
+    0x91,0xdd,0xd7,0x28,0x67,0x18,0x48,0xe9,0x81,0x0e,
+    0x38,0x0f,0x74,0xcc,0x3c,0x30,0x39,0x4f,0xcf,0x86,
+    0xa1,0x87,0xec,0x14,0x66,0xe1,0x08,0x63,0xf0,0x49,
+    0x66,0x91,0x13,0x00,0x23,0x27,0x47,0x66,0x61,0x0a,
+    0x7e,0x65,0x0a,0x79,0x24,0xe8,0x95,0x23,0x54,0x03,
+    0xcb,0x22,0x58,0xb7,0x21,0x13,0xdf,0x15,0x68,0x16,
+    0x6d,0xb6,0x68,0x37,0xf3,0xa7,0x1e,0x8d,0x1a,0x99,
+    0xb2,0x97,0x87,0x86,0x2a,0x86,0x7d,0xfe,0xee,0x11,
+    0x68,0xb0,0x50,0x84,0x9d,0x89,0xfa,0xd3,0x4b,0x98,
+    0x3a,0xe3,0xd3,0xe2,0x7c,0xab,0xa0,0xd8,0x84,0xd9,
+    0x21,0x54,0xd4,0x16,0xa4,0x4b,0xf3,0x66,0x93,0x94,
+    0x3b,0xd3,0x8b,0x9e,0xd3,0x84,0x79,0x4e,0xb5,0x6e,
+    0x73,0xf9,0xd4,0xe6,0xe4,0xf8,0x53,0x9f,0x21,0x67,
+    0xd9,0x37,0x18,0x42,0x20,0x18,0xd3,0x61,0xf4,0x9e,
+    0x83,0xf3,0x3c,0x56,0x44,0xed,0x82,0xf6,0x98,0x16,
+    0xc4,0x13,0x83,0x66,0x7d,0xb5,0x45,0xb6,0xee,0xbd,
+    0xb6,0x0e,0xdd,0x79,0xbd,0x62,0x3c,0xfe,0xe5,0x8b,
+    0x0b,0x51,0xb1,0x12,0xf9,0x24,0xe1,0x49,0x94,0x93,
+    0x10,0x54,0x1a,0x22,0x22,0x2b,0xd7,0xcd,0x83,0x22,
+    0x73,0xb9,0x49,0xb5,0xe7,0xc8,0xe0,0x22,0xf6,0xd8,
+    0xd8,0x2d,0xa6,0xcd,0x2d,0xe2,0x0f,0x6a,0xac,0x17,
+    0x2c,0xc9,0x12,0xf0,0xb7,0x2a,0xda,0xb7,0xc0,0x23,
+    0x81,0x6a,0x38,0x88,0xf6,0x12,0x8e,0xfd,0x12,0x8f,
+    0x39,0xf2,0x48,0xac,0x57,0x61,0x3b,0x2d,0xc4,0xbc,
+    0x05,0xfb,0xd0,0x63,0xfd,0x8c,0xb3,0x61,0xe6,0x0d,
+    0x5d,0x9b,0xf9,0xf2,0xd0,0xf8,0x5a,0x18,0x3e,0x08,
+    0xbc,0x31,0x96,0x29,0x11,0x59,0xf3,0xe4,0x75,0x44,
+    0xad,0x10,0x29,0xe0,0x5a,0x14,0x59,0x11,0x5d,0x21,
+    0xb3,0x25,0x0a,0x96,0x08,0x92,0x1c,0xc5,0x89,0x4a,
+    0xa2,0x72,0x64,0x01,0x05,0x24,0x27,0x85,0xca,0x03,
+    0x62,0x09,0x99,0x0f,0xbe,0xa5,0xd0,0x88,0x91,0xec,
+    0x4b,0xe4,0x7f,0x48,0x13,0x30,0x1d,0xa4,0xa1,0x28,
+    0xee,0x28,0x56,0x31,0x71,0xb7,0x48,0x1e,0xf0,0xb2,
+    0x23,0xff,0x0c,0x35,0x61,0x37,0xae,0x50,0xe4,0xa0,
+    0x57,0xef,0x02,0x39,0x73,0x01,0xc9,0x81,0xe6,0x69,
+    0xc3,0x18,0x88,0xe9,0xca,0x38,0x4f,0x06,0x91,0x3c,
+    0x53,0x1c,0x2c,0xea,0xc6,0xbe,0xa8,0x48,0x45,0x9f,
+    0xae,0x8c,0x90,0xca,0xb3,0x84,0x9e,0x47,0xf8,0xb1,
+    0x6d,0x00,0xd3,0x24,0x91,0x4f,0x66,0x17,0xf9,0xc6,
+    0x2e,0x9f,0xb3,0xfb,0x31,0x40,0x85,0x94,0xd4,0xb0,
+    0x6c,0x08,0x12,0x85,0x62,0x17,0xcb,0xa7,0x36,0xc2,
+    0xab,0xd2,0x7c,0x16,0xd4,0xb4,0x18,0x58,0x47,0x09,
+    0x59,0x44,0x1c,0xfa,0xa2,0xe0,0xcd,0x14,0x79,0x5a,
+    0x50,0x16,0x91,0x48,0xbc,0x98,0x06,0xb5,0x81,0xad,
+    0x48,0xc4,0xb3,0x0d,0x4a,0xa2,0x41,0x2b,0x62,0xc7,
+    0x0a,0x93,0xa8,0xe8,0x28,0x72,0x9a,0x01,0x22,0x41,
+    0x3a,0x5a,0x50,0xab,0x96,0x66,0x2b,0xac,0xfd,0x24,
+    0x67,0x38,0xf0,0x71,0xaa,0x43,0xba,0x83,0x7e,0x06,
+    0x39,0xc0,0x7e,0xbe,0x79,0x3b,0x1b,0x00,0x4e,0x4f,
+    0xd6,0x57,0xa7,0x37,0xcc,0x9b,0xde,0x53,0x78,0x26,
+    0x3b,0xdb,0x8d,0x64,0x3f,0x04,0x49,0x7b,0xe7,0x49,
+    0x6c,0xa4,0x80,0x8e,0x78,0x3a,0x02,0x71,0x28,0x1c,
+    0x0f,0x22,0x4c,0x20,0xc0,0x8e,0x9c,0x71,0x44,0x18,
+    0x28,0x4d,0xa3,0x21,0x8e,0xdc,0x93,0x3e,0x33,0x47,
+    0xf5,0x0a,0xd9,0x2a,0xc1,0x47,0x04,0x27,0xc2,0xfa,
+    0xc9,0x42,0xf2,0x88,0xfc,0x23,0x19,0x78,0x3e,0x85,
+    0xff,0xc8,0x2e,0x84,0x81,0x8c,0x3b,0x32,0x07,0xe6,
+    0x23,0x96,0xc1,0xee,0x4e,0xcb,0x04,0x24,0x87,0x16,
+    0xb9,0x27,0x9e,0x45,0x55,0x5b,0x08,0x44,0x23,0x59,
+    0x18,0xb0,0xc3,0x50,0x9c,0x8c,0x1a,0x79,0x94,0xcc,
+    0x34,0x62,0xa6,0x22,0xd2,0x90,0xa2,0x01,0x46,0x2c,
+    0xcd,0xb8,0x2c,0xc8,0x02,0x8d,0x22,0x16,0x04,0x02,
+    0xf5,0x83,0x70,0x3c,0x60,0x14,0xd1,0x59,0x1c,0xfc,
+    0x3c,0xc8,0xae,0x11,0xba,0xd2,0xf2,0xcc,0x2a,0xd8,
+    0xd3,0x1f,0x13,0xdc,0x2d,0xe9,0x31,0x7b,0x6c,0xcd,
+    0xe4,0x3d,0x9d,0x64,0xc0,0x1a,0xaf,0x63,0x22,0x77,
+    0x25,0x55,0x23,0x77,0xcc,0x64,0x67,0x91,0xa2,0x26,
+    0x28,0x82,0x77,0x48,0xbf,0x49,0x41,0x87,0xce,0xfa,
+    0xdb,0xe6,0xc7,0x18,0x28,0xcb,0xa4,0x0d,0xbb,0xc4,
+    0xfa,0x21,0x6b,0xe5,0xed,0xf2,0x36,0x19,0x08,0x22,
+    0x68,0x81,0xac,0x4e,0x5b,0x6e,0x88,0x4d,0x5b,0x1d,
+    0x65,0xdb,0xbc,0xd5,0x11,0xdb,0x0e,0xa3,0xde,0x09,
+    0x6f,0x94,0x6d,0x31,0x16,0xde,0x28,0x7e,0x40,0x89,
+    0xa8,0x52,0xca,0x96,0xa7,0xc8,0xa3,0x6c,0x5a,0x08,
+    0x30,0x96,0x1a,0x17,0xe5,0xc6,0xe6,0xde,0xcd,0x33,
+    0x63,0xcc,0xc2,0x15,0x9b,0x7d,0xa4,0x71,0x39,0xac,
+    0xb8,0x6d,0x5a,0xc3,0x64,0x55,0xe4,0x19,0x44,0x36,
+    0x75,0xee,0xdb,0xa6,0x7e,0x39,0x0a,0xb6,0x0a,0x3e,
+    0x03,0x96,0x27,0xc8,0x81,0x2d,0x3b,0xac,0x83,0x88,
+    0xc7,0xbb,0x1f,0xba,0x78,0x56,0x0e,0xff,0x0a,0x75,
+    0x8c,0xb4,0x0b,0x91,0xf8,0x47,0xbc,0x3c,0x52,0xe3,
+    0xf1,0x3b,0x07,0x4e,0x15,0x34,0x53,0x2d,0x53,0x24,
+    0xe7,0xf1,0x01,0x59,0x29,0x1d,0x69,0x06,0x55,0x39,
+    0x50,0xbe,0x53,0xca,0x97,0x7d,0x36,0xb1,0xba,0xe2,
+    0x73,0x5e,0x2b,0x9e,0xc5,0xc7,0xfe,0x9c,0xec,0xf5,
+    0xff,0xa2,0x7b,0x60,0x5d,0x16,0xc5,0x97,0x95,0xe2,
+    0x1d,0xc8,0x28,0x0d,0x6b,0x67,0x33,0x3b,0x13,0x74,
+    0xcf,0xd5,0x05,0x51,0x7d,0xa5,0x51,0x5d,0xf5,0x35,
+    0x0e,0xb3,0x50,0x86,0x43,0x44,0xd3,0x7d,0x6d,0xce,
+    0x22,0x3b,0x8c,0x5d,0xf1,0x21,0x76,0xc5,0x73,0x0c,
+    0x20,0xe1,0xf6,0xa2,0xac,0x1d,0xc2,0x27,0xb9,0x2d,
+    0x42,0xc9,0x97,0xe8,0x4f,0x19,0x6e,0x4d,0x5d,0x7f,
+    0x25,0x2b,0xc3,0xad,0xb6,0x2b,0x2f,0x2e,0xca,0xab,
+    0x26,0x76,0x6f,0xe6,0x59,0x9c,0xd2,0x9f,0x7f,0x58,
+    0x7f,0xe5,0xb4,0xe1,0x16,0x65,0xb8,0x59,0x19,0x6e,
+    0x5c,0x1b,0xee,0x72,0xaa,0x27,0x6c,0x37,0x6a,0xfd,
+    0x15,0x65,0xb8,0xca,0x6e,0xd7,0xda,0x23,0x36,0x70,
+    0xe5,0x7c,0x9e,0x42,0x0e,0x3b,0x84,0x90,0x70,0x9b,
+    0x80,0x6f,0x9c,0x3e,0x64,0x2f,0x41,0xb2,0x54,0x59,
+    0xa1,0x0c,0xa8,0x6d,0x20,0xf6,0x20,0xb6,0xd2,0x32,
+    0xc0,0x25,0x9f,0xb9,0xae,0x46,0xba,0x76,0xb4,0x55,
+    0xc4,0x7f,0x9b,0x80,0x8b,0x21,0x5b,0xf0,0x1b,0x1f,
+    0x82,0xbc,0xec,0x10,0x95,0x90,0xa2,0x18,0x53,0x85,
+    0x65,0x06,0xc7,0xbb,0x27,0x40,0xb1,0x69,0x72,0x44,
+    0xb6,0x89,0xa2,0xc7,0xc6,0xd5,0x81,0x70,0xbc,0xbf,
+    0xc2,0xb5,0x1a,0x92,0xa9,0x91,0xc1,0xc2,0xb9,0x49,
+    0xb1,0x96,0x62,0x29,0x2d,0x07,0x3c,0x63,0x5a,0x57,
+    0x3d,0x0e,0x32,0xb9,0xcc,0x25,0xa6,0x0a,0x30,0xa4,
+    0x5c,0xdc,0x22,0x97,0xa0,0x31,0xa8,0x24,0x05,0x8a,
+    0x92,0x38,0xbc,0x6c,0x31,0x5f,0x70,0x8e,0x94,0x6b,
+    0x5d,0xc3,0x01,0x1f,0xa1,0x1f,0x0b,0x19,0xaa,0x01,
+    0xa0,0x47,0xce,0x4f,0x52,0xc2,0xce,0x71,0x82,0x88,
+    0x9d,0xa4,0xd9,0x5c,0x1d,0xa9,0x19,0xc8,0x4f,0xb2,
+    0x54,0x48,0x57,0xe5,0xb1,0x6d,0xef,0x04,0x9e,0xb2,
+    0x37,0x10,0xf2,0x61,0xb1,0x4e,0x69,0x04,0x54,0x43,
+    0x07,0xd5,0x86,0xa1,0x8c,0xf3,0x65,0x10,0x8a,0x24,
+    0x08,0xdf,0x11,0xd6,0x77,0x84,0xa5,0x94,0xae,0x23,
+    0x6c,0x54,0x08,0xdb,0x16,0xdd,0x53,0x02,0x4d,0xa6,
+    0xd0,0xce,0x39,0xd3,0xe2,0x57,0x12,0x6c,0x8e,0x43,
+    0x51,0x31,0xb4,0x49,0x90,0x5d,0xfe,0xf6,0x96,0xd1,
+    0x85,0xb6,0xc5,0x26,0x00,0xdb,0xac,0xcc,0x49,0x10,
+    0x5f,0x12,0x0a,0x44,0x03,0x5b,0x00,0xbe,0x2f,0xb9,
+    0x0c,0x62,0x02,0x60,0x91,0x01,0xab,0xe3,0x50,0x6a,
+    0xe3,0x0a,0x21,0x65,0xf0,0x68,0x57,0x83,0xbc,0xec,
+    0xc0,0xb9,0x91,0xf4,0xbf,0x10,0xb2,0x96,0x1a,0x59,
+    0xf3,0x9a,0xac,0x29,0xae,0x66,0xac,0x62,0x6b,0x41,
+    0xb1,0xb5,0xd4,0xc8,0x8e,0xd0,0x48,0x45,0xd5,0xac,
+    0xa2,0x6a,0x41,0xa8,0xda,0xec,0x37,0x5c,0x8f,0x7c,
+    0x9c,0xad,0xb1,0xbe,0xd2,0x8e,0xd5,0x15,0xc4,0x4b,
+    0xec,0x29,0x36,0xc2,0xbc,0xdd,0x49,0xca,0xd7,0xa1,
+    0x82,0x19,0x49,0x51,0x84,0xa4,0x74,0x42,0x32,0x3b,
+    0xee,0x31,0x21,0x99,0xa3,0x23,0x47,0x13,0xc5,0x46,
+    0xd2,0xc2,0x46,0x9c,0xf1,0x9a,0x8d,0x88,0xc9,0xc6,
+    0x50,0x1f,0x20,0x24,0xe1,0x04,0x21,0x29,0x8a,0x90,
+    0x34,0xb0,0x78,0x94,0x8d,0xa4,0x0e,0x25,0x1d,0x71,
+    0x84,0x84,0x04,0x45,0x48,0xc2,0x42,0x48,0x58,0x59,
+    0xac,0x3a,0x9f,0x9a,0x99,0x5d,0x34,0xbb,0x5a,0x99,
+    0x1b,0xc5,0x1b,0x24,0x63,0x32,0xea,0x8a,0x54,0x25,
+    0x2a,0xdf,0x5b,0x42,0x4c,0xfc,0x4c,0xbe,0x3f,0xfe,
+    0x19,0x1d,0xfb,0x14,0x50,0x53,0x3d,0xb6,0xd2,0x98,
+    0x18,0xa1,0x2a,0x27,0x1c,0x62,0xa1,0x49,0x6a,0x62,
+    0x64,0x56,0xb4,0x67,0x32,0xc7,0xbc,0x36,0xd0,0xa4,
+    0x0d,0x54,0xdb,0x67,0x5c,0xec,0xd3,0x35,0xfb,0x54,
+    0xe6,0x69,0x93,0xb6,0xcf,0xa8,0xec,0xb3,0x2a,0xfb,
+    0xcc,0xda,0x3e,0x75,0x2a,0xe1,0x94,0x7d,0xba,0x23,
+    0xfb,0xcc,0xca,0x3e,0x93,0xb2,0xcf,0xb4,0xd8,0xa7,
+    0xc4,0x18,0x4e,0x26,0x10,0x65,0x48,0x80,0xca,0xf2,
+    0x0d,0x7a,0x98,0x44,0x86,0x96,0x39,0x89,0x48,0x99,
+    0x73,0xce,0xa3,0x35,0x45,0x28,0x09,0x32,0x89,0x0b,
+    0xe0,0xcc,0xe5,0xb5,0xf8,0x4b,0x2e,0xe1,0x38,0xd5,
+    0xf4,0x41,0xe5,0x12,0xb3,0x22,0x76,0x44,0x23,0xc9,
+    0x5c,0x48,0x38,0x82,0x3a,0xf4,0x6f,0x14,0xfe,0xda,
+    0x15,0xfe,0x76,0x66,0xa5,0x28,0x4c,0x3a,0xc5,0x1d,
+    0xbd,0xe2,0x2f,0xb5,0xf3,0x17,0xaf,0xf9,0x4b,0x7a,
+    0x98,0xbf,0x94,0x86,0xbf,0x84,0x6c,0xb1,0x2e,0xdc,
+    0xb1,0xfc,0x4e,0x08,0x4e,0x9a,0x3b,0xba,0x7f,0x08,
+    0x77,0xdc,0xd3,0xd1,0x78,0xb2,0x62,0xb6,0x7c,0x40,
+    0x54,0x8e,0x72,0xc0,0x5e,0x67,0x8b,0xd6,0xa9,0x6c,
+    0x31,0x1d,0x64,0x8b,0x1c,0xcf,0x5a,0xb6,0x18,0x55,
+    0xb2,0xe8,0x54,0xb2,0x58,0x54,0xb2,0x98,0x54,0xb2,
+    0xe8,0x9f,0x93,0x2c,0xb6,0xf3,0x5d,0x34,0x08,0xab,
+    0x2b,0x82,0x6d,0xb6,0x3e,0x9d,0x2c,0xfa,0x8e,0x6b,
+    0xf5,0x04,0xae,0x65,0x85,0x6b,0x62,0x78,0xcb,0xde,
+    0x1e,0xcf,0x1d,0x1b,0xb2,0x5d,0xb4,0x90,0x70,0x79,
+    0x18,0x1a,0x28,0xa5,0xa9,0x14,0x42,0xaa,0x21,0xc1,
+    0x2a,0x0d,0x87,0x63,0x8b,0x95,0x9e,0xb6,0x02,0xc9,
+    0x20,0xec,0x42,0xeb,0x24,0x8b,0x28,0x3d,0x8b,0xa8,
+    0x2d,0x22,0xc2,0x12,0x8a,0x58,0x82,0x64,0x98,0x9c,
+    0xeb,0x51,0xf0,0x84,0x29,0xa4,0x66,0x9a,0x03,0x33,
+    0xc5,0xa7,0xed,0x80,0x02,0xfb,0x3e,0xcc,0xeb,0x6a,
+    0xa0,0x71,0x2a,0xed,0xb5,0x2a,0xef,0x2d,0x2a,0xef,
+    0x4d,0x27,0x60,0x26,0x29,0x98,0x09,0x2b,0x98,0xf9,
+    0xc7,0xe4,0xbd,0x45,0xc1,0x8c,0x3b,0x01,0x33,0xfe,
+    0x20,0xef,0x4d,0x56,0x21,0xcd,0x89,0xb4,0x57,0xa3,
+    0x8c,0x02,0x19,0xc1,0x98,0xcb,0xa3,0x33,0x3d,0x7e,
+    0x3f,0x86,0x0b,0x6b,0x50,0x1d,0xce,0xae,0x19,0x05,
+    0x07,0x6c,0xca,0x2b,0x0c,0xcd,0x16,0xc9,0x65,0x0d,
+    0x92,0xe3,0x91,0x59,0x2c,0xaa,0x22,0x36,0x73,0x48,
+    0x0f,0xb6,0xb4,0x54,0x97,0xa2,0x59,0x81,0x63,0x07,
+    0xca,0x60,0x0b,0xad,0x03,0x4a,0x49,0xd4,0x75,0x0e,
+    0x25,0x4e,0x28,0x3d,0x49,0x19,0x1d,0x22,0x67,0x74,
+    0x49,0x06,0x60,0xb0,0x85,0x79,0x10,0xb1,0x05,0x77,
+    0x2c,0x1c,0xe3,0x1c,0x36,0x61,0x4c,0x6e,0xcf,0x4c,
+    0x9d,0xd2,0x95,0x0b,0x95,0x08,0xe4,0x0e,0x25,0x50,
+    0x82,0x86,0x7d,0x03,0x98,0xdd,0xfc,0xea,0x22,0x26,
+    0xb9,0xed,0x11,0x82,0x4b,0x26,0x24,0x7e,0x8c,0x73,
+    0xd4,0x6d,0xbf,0x68,0xe6,0xbd,0x4f,0xe4,0x49,0x56,
+    0x28,0x8b,0xe5,0x13,0xf6,0x95,0xcf,0xc5,0xe1,0x54,
+    0x61,0xc8,0x68,0x69,0x53,0x8e,0x34,0xe5,0x02,0x57,
+    0xe5,0xe2,0x3e,0x49,0xc2,0xf0,0xe7,0x61,0x31,0x2e,
+    0x71,0x8f,0xd6,0xb6,0x53,0x23,0x5a,0x3f,0xe0,0x13,
+    0xc6,0x6d,0xd8,0x98,0x42,0x76,0xcc,0xb0,0x0b,0x0f,
+    0x0e,0x34,0xa6,0x24,0x98,0x2c,0x88,0x31,0x14,0x1c,
+    0xb0,0x50,0x81,0xc3,0x83,0xe7,0xf3,0xf3,0x8e,0x08,
+    0x3b,0x59,0xe2,0x5e,0xe0,0xe9,0xf2,0xe8,0x5c,0x8e,
+    0xdf,0xd7,0xc7,0x18,0xc9,0x62,0x10,0x0a,0xd0,0x93,
+    0x28,0x55,0xe8,0x02,0x64,0x8c,0x7b,0x82,0x1c,0xfa,
+    0x97,0x8b,0x79,0x08,0xf9,0x3d,0x3d,0x06,0xc4,0xd0,
+    0x99,0x5b,0xcc,0xa9,0x4d,0xcb,0x74,0x1a,0x2f,0x99,
+    0x47,0xad,0xd6,0xb2,0x09,0xdd,0x87,0x53,0x75,0x4c,
+    0xd7,0x0b,0x99,0xa4,0x32,0x55,0xc8,0xcc,0xbd,0x90,
+    0x19,0x97,0x3a,0x66,0x3c,0x2a,0x63,0xe6,0x2f,0x29,
+    0x63,0x36,0xe6,0x61,0xeb,0x17,0x53,0x8f,0x74,0x54,
+    0xc8,0xcc,0x27,0xd8,0xc7,0x41,0x21,0x53,0x53,0x8f,
+    0xa8,0xa8,0x47,0x7c,0x6e,0x21,0x33,0x9e,0x2e,0x64,
+    0xa6,0x2f,0x2c,0x64,0x26,0x85,0x4d,0x59,0x61,0xd3,
+    0x83,0xe4,0xe3,0x77,0x16,0x32,0x7b,0xce,0x15,0x15,
+    0x34,0xe5,0x87,0x53,0xae,0x76,0xd6,0xcf,0xc6,0x26,
+    0x51,0xd5,0x6b,0x8b,0x2b,0x0a,0x3e,0xf9,0xa5,0x10,
+    0x47,0xff,0x40,0x66,0x85,0x38,0xdc,0x2a,0x71,0x47,
+    0xe6,0x06,0xf3,0xb5,0x31,0xf0,0x0a,0xad,0x66,0xc4,
+    0xb0,0xf0,0x30,0xa1,0x0a,0x55,0x55,0x34,0xf2,0xe3,
+    0x05,0xa1,0x35,0x9b,0x5a,0x57,0x83,0x3a,0xf2,0x3d,
+    0xa3,0x18,0xf7,0xe5,0x05,0x0d,0x5d,0x89,0x73,0x87,
+    0x05,0x8d,0xb9,0x50,0xdb,0x61,0xd4,0xd4,0x51,0x83,
+    0xda,0x0a,0x46,0xd7,0x15,0x0d,0x0a,0xa4,0xde,0xd4,
+    0x27,0x2a,0xc7,0x73,0x32,0x53,0x4e,0x14,0x8f,0x9f,
+    0x0f,0xa2,0xab,0x5c,0x4d,0x23,0x68,0x79,0x20,0x57,
+    0x5b,0x40,0xd4,0x3f,0xa3,0x78,0x9c,0xd7,0xc5,0xe3,
+    0x67,0x20,0xe8,0xb2,0xbb,0x0e,0xa2,0xa1,0x76,0x14,
+    0x65,0x7b,0x21,0x25,0x5c,0x9d,0x28,0x47,0x5a,0x17,
+    0x65,0x3b,0x8f,0xd4,0x23,0x1f,0x28,0x06,0xaf,0xd8,
+    0x7c,0x51,0xe6,0x17,0x0f,0xeb,0x91,0x49,0x95,0xd4,
+    0x98,0x5e,0x36,0x0b,0x8c,0x9a,0xcf,0xbb,0xc7,0xf9,
+    0x3c,0x94,0xea,0x0e,0xcc,0x4f,0x97,0x23,0xfd,0x61,
+    0x39,0xd2,0x2a,0x03,0xf4,0xca,0x00,0x83,0xa6,0xf3,
+    0xfe,0x19,0xe5,0xb4,0xfa,0xfc,0x72,0x1a,0xaa,0x2c,
+    0xba,0xa0,0x56,0x50,0x50,0x23,0xd3,0x6a,0xd5,0x14,
+    0x5a,0x45,0xd5,0xd2,0xac,0x2e,0xa6,0xd9,0xe7,0x54,
+    0xd3,0x4a,0xab,0xa6,0x2d,0x85,0x94,0x16,0x8f,0x57,
+    0x15,0xa7,0x25,0xee,0xcd,0xc8,0x23,0x91,0xcf,0x76,
+    0x56,0xee,0xbf,0xac,0x85,0x93,0x54,0xa8,0x4b,0xbd,
+    0x85,0x23,0x4c,0xfc,0xf2,0xc8,0x7c,0x8e,0xdf,0x8f,
+    0xad,0x2d,0x26,0xcf,0x17,0xfb,0xc8,0x43,0x70,0xdd,
+    0x6b,0x0b,0xe7,0xa0,0xec,0x02,0x68,0x47,0x81,0xb1,
+    0x34,0x26,0x19,0xa5,0xda,0x97,0x63,0xc6,0x51,0x65,
+    0x4e,0xd3,0x63,0x42,0x10,0x34,0x99,0x85,0xb5,0x5e,
+    0xaa,0x00,0x9c,0xe2,0xb7,0x63,0xaf,0x99,0x83,0x00,
+    0x2a,0x01,0xc1,0x80,0x23,0x47,0x5f,0x41,0xb8,0xbc,
+    0xc9,0x8d,0xfe,0xe0,0x00,0xc4,0x54,0xf8,0x5a,0x42,
+    0xe5,0x54,0x4f,0x40,0x16,0x01,0x01,0xcf,0x17,0x91,
+    0x62,0x74,0x38,0x68,0x29,0xe6,0xdc,0xb1,0x18,0x51,
+    0x76,0x29,0xe8,0xc9,0x74,0x0b,0x1c,0xcb,0x95,0x12,
+    0xd4,0x82,0x0d,0x6d,0x4d,0x52,0x69,0xa9,0xa2,0xb5,
+    0x4a,0x00,0xe8,0xa2,0xe3,0x0b,0x57,0x41,0xfa,0x38,
+    0x1d,0x89,0xb3,0x74,0x14,0x31,0x79,0x62,0xe3,0x10,
+    0x20,0xc6,0xb3,0xc0,0xde,0x7e,0x9c,0xfb,0x3c,0x8a,
+    0x16,0x86,0x3d,0x4f,0xd3,0xa2,0x1f,0xa2,0x6e,0xf4,
+    0x1c,0xfd,0x24,0xb2,0x9a,0xd0,0x12,0x08,0xca,0x2e,
+    0xb3,0x5d,0x62,0x5f,0x24,0x15,0x48,0x64,0x26,0xbb,
+    0x32,0xad,0x32,0x44,0x63,0x72,0xab,0xd0,0x33,0x46,
+    0xa6,0x24,0x95,0x21,0x52,0xb6,0xe3,0xab,0x7c,0xb4,
+    0x89,0x56,0x31,0x6d,0x29,0x12,0xfc,0x21,0xcf,0x59,
+    0x03,0x2d,0xe4,0xd1,0x9d,0x5e,0xe2,0x9f,0xdb,0x36,
+    0x91,0x00,0xaa,0x06,0xd0,0x42,0x16,0xce,0xa3,0xc0,
+    0x5f,0xac,0x8f,0x3c,0x13,0x34,0x9b,0x79,0x26,0x62,
+    0xa1,0xb8,0x41,0x18,0x51,0x92,0x60,0x56,0xe2,0x52,
+    0xa3,0xa2,0xc5,0xd5,0x56,0xa2,0xf5,0xd0,0x1e,0x5f,
+    0x49,0x81,0xe4,0xd1,0x72,0x1d,0x17,0xb5,0x5e,0x93,
+    0x10,0x25,0xaa,0xd8,0xbb,0x09,0x5c,0x26,0x99,0x9f,
+    0x71,0x1d,0x04,0xc1,0x4c,0xd4,0x6b,0x98,0x7f,0x24,
+    0x3e,0x37,0x3a,0xc7,0x82,0x4b,0x2c,0xde,0xf9,0x5e,
+    0x62,0x97,0xba,0x32,0xb3,0xbe,0x11,0x52,0x71,0x5d,
+    0x29,0x83,0xfa,0x99,0xc4,0xe1,0x27,0xb3,0x38,0x38,
+    0xf1,0xd8,0x4a,0x3c,0x08,0x5a,0x98,0x05,0x4d,0x07,
+    0x23,0x2c,0x2d,0x60,0x0c,0xe9,0x9c,0xbd,0x1c,0x69,
+    0xa2,0x0d,0xcc,0xfd,0xb3,0x8b,0xaa,0xd2,0x24,0x79,
+    0xe3,0x3c,0xd0,0xf1,0x64,0x48,0x37,0xad,0xa4,0x28,
+    0xf4,0x75,0xcb,0x4d,0x0a,0xa2,0x8e,0x2f,0x10,0x3c,
+    0x72,0x84,0x75,0x22,0x36,0x89,0x10,0xc2,0x22,0x95,
+    0x04,0xd1,0x80,0xbb,0x35,0x4c,0xfa,0x9a,0xe4,0x05,
+    0x63,0x54,0x24,0x46,0x6a,0xc2,0x94,0xaa,0xa0,0xd3,
+    0x1c,0xab,0x6f,0xcf,0xe8,0xa8,0xf8,0x46,0xf4,0x90,
+    0xee,0x93,0xa6,0x90,0x00,0x59,0x89,0x02,0x18,0x20,
+    0x0e,0x39,0x47,0x72,0xf2,0x47,0x98,0xc5,0xc8,0xde,
+    0x48,0xa7,0x96,0x3d,0x97,0xd7,0xe0,0x8d,0x77,0x64,
+    0xe2,0x8e,0x53,0x24,0x5f,0xf9,0x7e,0x10,0x24,0x85,
+    0x03,0xe2,0x56,0x8d,0x6f,0xa7,0x99,0x29,0x17,0x61,
+    0xd5,0xa0,0x1b,0x40,0xd6,0x9c,0xb2,0xbc,0x48,0xdd,
+    0x61,0xdb,0x1c,0x70,0x10,0xaa,0x09,0x07,0xac,0xba,
+    0xa2,0x1e,0x0f,0x2a,0xea,0xde,0xaa,0x36,0xb5,0xd5,
+    0x7d,0x6a,0xc5,0xef,0xc2,0xaa,0xa4,0xce,0x11,0x2f,
+    0x4a,0xe1,0xac,0x0e,0x12,0x31,0x1f,0x26,0x77,0x36,
+    0xef,0x09,0x6c,0x2c,0x0c,0xa5,0x55,0x6e,0xc2,0x20,
+    0x1e,0x28,0xe7,0xd9,0xd0,0x52,0x71,0x35,0xd5,0x12,
+    0x8a,0x8a,0xaa,0xd9,0x15,0x55,0x13,0xac,0x0c,0xb3,
+    0xfd,0x09,0x61,0xeb,0x54,0xad,0x01,0xd7,0xb8,0x78,
+    0xe0,0xd8,0x59,0x83,0x80,0x25,0x57,0x7e,0xf9,0xae,
+    0xc7,0x4c,0xd6,0x7c,0x2b,0x7f,0x09,0x5c,0x7a,0xc5,
+    0xd6,0x90,0x95,0xce,0xc9,0xbe,0x0d,0xb6,0x37,0xef,
+    0x72,0x4a,0xad,0xf8,0x65,0x39,0x83,0x9f,0x39,0x0f,
+    0xe5,0x85,0x07,0xfd,0xa7,0xe0,0xc2,0x42,0xd7,0x6c,
+    0x2f,0x7a,0xd0,0xb9,0x75,0xc0,0x84,0xbf,0xcf,0x45,
+    0x0f,0x57,0xe6,0x02,0x08,0x39,0x62,0x08,0x14,0xaa,
+    0xb8,0xad,0x86,0x03,0xf5,0x5c,0x99,0xc4,0x6d,0x71,
+    0x38,0x22,0x1d,0x74,0x15,0xde,0x3b,0x73,0x1d,0xae,
+    0x14,0x03,0xb3,0x60,0x90,0x18,0x1b,0x89,0x90,0x4b,
+    0xa3,0x1a,0x06,0x0f,0x49,0x23,0x77,0x65,0x5a,0xcf,
+    0xc8,0x02,0x0d,0x3c,0x43,0x57,0x2d,0x69,0xcb,0x7e,
+    0x33,0xc0,0xbb,0x40,0xba,0x28,0x4c,0x0e,0x9c,0xec,
+    0x03,0x72,0x13,0x02,0x9a,0xb7,0xad,0x2b,0x93,0xe4,
+    0x6e,0x5b,0x60,0x1b,0x5a,0x60,0xae,0x8d,0x2a,0xa5,
+    0x2e,0x33,0x05,0x36,0x9b,0xc8,0x4d,0x0d,0xfa,0x75,
+    0x5b,0x0d,0x57,0xe1,0xb8,0x4d,0xe4,0xea,0xdc,0x03,
+    0xc0,0x1d,0x37,0x8e,0x4d,0x4d,0x68,0x14,0xb7,0xad,
+    0xb4,0xe8,0x1d,0xa3,0x36,0xcd,0x87,0x04,0x76,0xe8,
+    0x68,0x68,0xc9,0x8a,0xc2,0x70,0x84,0x8e,0xab,0xce,
+    0x31,0xe5,0x0b,0xf0,0xc7,0xe8,0x3c,0xcc,0xe7,0xa1,
+    0xca,0x06,0x23,0x5e,0x75,0x49,0x55,0x36,0x70,0xc7,
+    0x07,0x0d,0x36,0x54,0x36,0x2a,0x30,0x2a,0x50,0x14,
+    0x40,0xb1,0x02,0x41,0xcd,0x2e,0x75,0x0d,0xab,0x0a,
+    0x1b,0x8e,0x0b,0x1b,0x1c,0xf5,0x38,0xdb,0xab,0xa6,
+    0xe8,0xca,0x06,0x5f,0x72,0x70,0xe0,0x95,0xc6,0xfa,
+    0xf6,0xcc,0x95,0x8d,0xbc,0x1f,0x89,0x64,0x52,0x46,
+    0x2e,0xa5,0x8d,0x58,0x5b,0x69,0x23,0xef,0xe6,0x57,
+    0x94,0x36,0x72,0x55,0x18,0xe6,0x7b,0x6d,0xe3,0x22,
+    0x11,0x7d,0x2a,0xfb,0xf6,0x0b,0x29,0x6d,0x64,0x29,
+    0x6d,0x84,0x56,0xda,0x08,0xaa,0xb4,0x91,0x8e,0x4b,
+    0x1b,0xd5,0xf1,0xf5,0xf3,0x7a,0xa2,0xb4,0xe1,0xe7,
+    0xd2,0x86,0xe5,0xd2,0x46,0x52,0xa5,0x0d,0xdf,0x4b,
+    0x1b,0x99,0x2b,0x1b,0x30,0x50,0x94,0x4a,0xa0,0x60,
+    0xa9,0x66,0x14,0xae,0x6c,0x14,0x79,0x3e,0xa8,0x6c,
+    0xf8,0x8b,0x76,0x2e,0x97,0x47,0xe7,0x73,0x7c,0x7c,
+    0x99,0xb6,0x59,0x28,0x7e,0xb5,0xaf,0x6f,0x1b,0x09,
+    0x40,0x23,0x83,0xfb,0x18,0xa5,0xb2,0xc1,0x33,0x68,
+    0x45,0x97,0xb9,0x97,0x91,0x5b,0xc9,0x88,0x09,0xa1,
+    0x5c,0x3b,0x8b,0x6e,0xd5,0xcc,0x28,0xd2,0xcc,0x90,
+    0x6e,0x46,0xe1,0x6e,0x86,0xc9,0xab,0x6e,0x5b,0xd1,
+    0xdd,0xb6,0xf0,0x78,0xbb,0xad,0xf5,0xd0,0xa4,0x9f,
+    0xa6,0xdb,0x19,0xa1,0x17,0x14,0x7c,0x55,0xed,0x0c,
+    0xf7,0x60,0x3b,0x43,0x6a,0x0a,0x55,0xd5,0x14,0x40,
+    0x65,0xf8,0x72,0x67,0x43,0x9a,0xac,0x4a,0x0a,0x83,
+    0x1e,0xa6,0xda,0x19,0x59,0xd5,0x13,0x86,0xa3,0x25,
+    0x1d,0x13,0x84,0xe3,0x6e,0x86,0x55,0xd5,0x6e,0xaf,
+    0xda,0x19,0x4e,0x55,0xbb,0x1b,0x5f,0x16,0x45,0xb4,
+    0xc2,0x9a,0x93,0x76,0x46,0x76,0x12,0xd0,0x43,0xe5,
+    0x88,0x1e,0x7b,0x44,0x6f,0xd9,0x77,0x9c,0xab,0xfd,
+    0x2a,0xaa,0x1f,0x5c,0x85,0x49,0x2a,0xaa,0xb7,0xf4,
+    0xc7,0xab,0xf4,0xe7,0x20,0xaa,0x9f,0xca,0x7f,0x1e,
+    0x0a,0xe9,0x27,0x6e,0xc3,0x54,0x75,0x29,0xc3,0xeb,
+    0x2b,0x19,0xf1,0x44,0x12,0x9e,0xd4,0x95,0x82,0xd4,
+    0x13,0xf0,0x16,0xd2,0x93,0x90,0xc2,0xa3,0x96,0x86,
+    0x7b,0x30,0x0d,0x8a,0xdc,0xd0,0x08,0x33,0x2c,0x36,
+    0x62,0xca,0x1d,0x0d,0xa7,0x5b,0x56,0xad,0xa3,0xa1,
+    0xcf,0x78,0xa9,0xac,0x78,0xa9,0x6c,0xf5,0x8e,0x46,
+    0xee,0x55,0x23,0x44,0xfb,0xd6,0xeb,0x6d,0x47,0x2c,
+    0x0d,0x0d,0xa7,0x8a,0x46,0xea,0x88,0x6d,0x5c,0x1f,
+    0x71,0x3b,0x61,0xdd,0xd0,0x58,0xb8,0xc5,0x03,0xd4,
+    0xa2,0xe7,0x4e,0xc2,0x2b,0x4c,0x55,0xbc,0x42,0x0c,
+    0xd0,0x6f,0xfb,0x3d,0x46,0x3f,0x88,0xc5,0x75,0x5e,
+    0x11,0x98,0x57,0x2c,0x9b,0x7b,0x8a,0x59,0x20,0x93,
+    0xca,0xf6,0xa2,0x85,0x87,0xcb,0xa3,0x30,0xf1,0xdb,
+    0xe6,0xc7,0x6c,0x01,0x35,0x14,0xf5,0x32,0x6e,0x40,
+    0xb4,0xc8,0x28,0xc9,0x70,0xb2,0x3a,0x19,0x76,0xdd,
+    0x0c,0x42,0x5e,0xc8,0x02,0x97,0x63,0xb2,0xef,0xd9,
+    0x70,0x6b,0x69,0x04,0xd5,0xd2,0x10,0x4b,0xa8,0x55,
+    0xb5,0x34,0xd2,0x62,0x0a,0x1c,0xfe,0x1f,0xb7,0x83,
+    0xd6,0xd0,0x08,0xa9,0x37,0x34,0x4a,0xaf,0xc6,0x3c,
+    0xe3,0x1a,0x9f,0xa4,0xe6,0xa9,0x01,0x7c,0xaf,0x0e,
+    0x39,0x4e,0xcd,0x73,0xaf,0xc4,0xc8,0xc0,0x38,0xb7,
+    0x33,0xdc,0x92,0x8c,0xe8,0x62,0xcc,0xa2,0x04,0x95,
+    0x8c,0xcc,0x95,0x98,0x7c,0xa2,0x12,0x63,0xc7,0x79,
+    0x26,0x5b,0xa5,0xa2,0xa1,0x9a,0xe6,0x0b,0x33,0xf1,
+    0xad,0x72,0x05,0xde,0x9f,0xc4,0xa3,0x55,0xdf,0x3c,
+    0xaa,0x5b,0x7c,0xee,0x54,0x25,0xe6,0xf2,0xf0,0x3c,
+    0x8f,0x5e,0x57,0xa8,0x51,0x13,0x9f,0xdb,0x01,0xe8,
+    0x57,0x01,0x7d,0xeb,0x35,0xe8,0xe7,0x67,0x80,0xbe,
+    0xb4,0x33,0x3a,0xea,0x27,0x85,0xfa,0x5e,0xa1,0x7e,
+    0xfd,0x7f,0x40,0xfd,0x25,0x79,0xb5,0x82,0xfc,0x07,
+    0x2d,0x0d,0x77,0x88,0xfb,0xee,0x21,0xdc,0x8f,0x1d,
+    0xf7,0x41,0x9e,0x16,0xdc,0x4f,0x1d,0xf7,0x8b,0x57,
+    0xb8,0x1f,0x0f,0x71,0xdf,0x29,0xdc,0x8f,0x0f,0xe3,
+    0x7e,0x38,0x81,0xfb,0x55,0xe1,0xfe,0x8c,0xfa,0xed,
+    0x60,0x2e,0x8f,0x0e,0x68,0x7d,0xe9,0x21,0xf0,0x55,
+    0x25,0x5f,0x11,0x50,0x04,0x60,0x2a,0xa6,0x62,0xd9,
+    0xa4,0x95,0x51,0x2e,0xda,0x28,0x72,0x76,0x4a,0x57,
+    0x71,0x70,0xf3,0x74,0x57,0xc1,0x72,0x53,0x75,0xbe,
+    0x29,0x61,0x48,0x9c,0x62,0x2f,0xda,0xa8,0x87,0xae,
+    0x4a,0x50,0x66,0x3c,0x44,0x1a,0xc6,0xff,0x1d,0xc6,
+    0xd2,0xc8,0xe0,0xfb,0x6b,0xed,0x4a,0x76,0x51,0x57,
+    0xb2,0x9d,0xba,0x92,0x1d,0xd4,0x8d,0x6c,0x3b,0xf6,
+    0x52,0xd1,0x5c,0xed,0x40,0x65,0x5f,0x1a,0xd0,0xc7,
+    0xbd,0x0c,0xa7,0x5b,0x19,0xfe,0x90,0x76,0xe4,0x13,
+    0xb4,0x63,0xb9,0x62,0x30,0x72,0x8c,0x55,0xb4,0xc3,
+    0x8e,0x7d,0xd5,0x7e,0xd1,0x27,0xf4,0x8b,0x3e,0x8d,
+    0x79,0xc8,0xe8,0xb9,0x5d,0xf3,0x24,0xed,0x40,0x7d,
+    0x3e,0xd9,0xdf,0x83,0x49,0x4e,0x81,0x52,0xe8,0xa0,
+    0x64,0x4f,0x80,0x92,0x55,0xa0,0x94,0x4f,0x81,0xd2,
+    0xcc,0x3b,0x58,0x63,0x47,0x05,0xbd,0xd6,0x66,0xaf,
+    0xaa,0xa2,0xb7,0x42,0xa5,0x56,0xd1,0xb3,0xaa,0xa4,
+    0x27,0xa8,0x64,0x3b,0x2a,0xc5,0xba,0xca,0x76,0x9f,
+    0x8d,0x4a,0xa2,0xad,0xd7,0x35,0x14,0xf2,0x08,0x72,
+    0x94,0x5a,0xb8,0xa9,0x41,0x99,0x35,0x45,0x62,0x62,
+    0xdd,0x86,0x46,0x93,0x7a,0x8e,0x2c,0x8e,0x5b,0xf0,
+    0x64,0xa2,0xe4,0xb1,0x21,0xc4,0xb9,0x10,0x7e,0x82,
+    0x4c,0xe9,0xf4,0xb8,0x95,0xaf,0xbf,0x80,0x49,0xd9,
+    0x47,0xf2,0xe3,0x53,0x64,0xaa,0xcc,0x64,0xaa,0xd9,
+    0xe9,0xaa,0x9c,0xfc,0x00,0x91,0x72,0x8a,0x48,0xad,
+    0x8b,0xc9,0x69,0x49,0x8f,0x7d,0xe7,0x52,0x6b,0x2a,
+    0xa5,0x6f,0x67,0xb6,0x36,0x8e,0xba,0xdd,0x5a,0x1b,
+    0x93,0x42,0x37,0xc3,0xaa,0x72,0xde,0xdc,0xcc,0x90,
+    0x2a,0x5b,0x65,0x60,0xb3,0x73,0xbd,0x3f,0xa9,0x8b,
+    0x67,0xf6,0x69,0x0c,0x65,0x3b,0x3a,0xc4,0x50,0x05,
+    0xa0,0x69,0x75,0xf3,0x4c,0x03,0xa8,0x3f,0xee,0x66,
+    0x24,0xa9,0x74,0xac,0xae,0x04,0xf8,0x47,0x31,0x74,
+    0x05,0xa0,0x65,0x0d,0xa0,0xf3,0xee,0x62,0xc7,0xd0,
+    0xd5,0x95,0x00,0x7b,0xd5,0x6c,0x6b,0xdd,0x33,0xf6,
+    0x0e,0x48,0x35,0x07,0xcf,0xd6,0xcc,0x28,0x07,0x06,
+    0xe8,0x4e,0x18,0x60,0x3d,0x51,0xa0,0x91,0x36,0x4b,
+    0x38,0xba,0x5c,0xbd,0xae,0xd1,0x38,0xcd,0xe6,0xf3,
+    0x53,0x6c,0xfe,0x64,0x3b,0xad,0xaa,0x76,0x9a,0x3f,
+    0xba,0x96,0xb2,0x66,0xf3,0x5e,0xb1,0x79,0x39,0xed,
+    0x95,0x05,0x16,0x65,0x81,0x59,0x11,0xb8,0xf5,0xdd,
+    0xa4,0x28,0x1d,0x8d,0xa2,0x3a,0x1a,0x33,0xfa,0xf4,
+    0x2b,0xc2,0x4e,0x3a,0x1a,0x69,0xee,0x68,0x04,0x6e,
+    0x68,0xf0,0x35,0x87,0xe4,0x75,0x43,0x23,0x72,0x43,
+    0x23,0xf5,0x86,0x46,0xe6,0x16,0x46,0xd6,0xb7,0x83,
+    0xf3,0x6e,0x29,0x87,0xaa,0x5b,0x46,0x42,0xca,0x8b,
+    0x6e,0xe4,0xa6,0xa5,0x91,0x5b,0x1f,0x69,0xe4,0x16,
+    0x15,0xfa,0x56,0x8d,0x5c,0xb9,0x6c,0xd3,0x1b,0xb9,
+    0xf1,0xc4,0xf5,0x59,0x1b,0x85,0x91,0xfb,0x8b,0xd9,
+    0x9c,0x2e,0x8f,0xed,0x4a,0xfd,0x97,0x7b,0xf8,0xff,
+    0x0d,0xf9,0xfa,0xe5,0xff,0x02,0x16,0x11,0x3a,0xc9
 };
 
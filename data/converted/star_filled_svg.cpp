@@ -1,124 +1,76 @@
-//this file was auto-generated from "star_filled.svg" by res2h
+//this file was auto-generated from "star_filled.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t star_filled_svg_size = 1152;
-const unsigned char star_filled_svg_data[1152] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x45,0x62,0x65,0x6e,
-    0x65,0x5f,0x31,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,
-    0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,
-    0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,
-    0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,
-    0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,
-    0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x32,0x31,
-    0x2e,0x37,0x37,0x35,0x70,0x78,0x22,0x20,0x68,0x65,
-    0x69,0x67,0x68,0x74,0x3d,0x22,0x32,0x30,0x2e,0x37,
-    0x36,0x32,0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,
-    0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x32,
-    0x31,0x2e,0x37,0x37,0x35,0x20,0x32,0x30,0x2e,0x37,
-    0x36,0x32,0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,
-    0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-    0x64,0x3d,0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,
-    0x20,0x32,0x31,0x2e,0x37,0x37,0x35,0x20,0x32,0x30,
-    0x2e,0x37,0x36,0x32,0x22,0x20,0x78,0x6d,0x6c,0x3a,
-    0x73,0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,
-    0x73,0x65,0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,
-    0x23,0x37,0x37,0x37,0x37,0x37,0x37,0x22,0x20,0x64,
-    0x3d,0x22,0x4d,0x38,0x2e,0x37,0x31,0x2c,0x32,0x2e,
-    0x30,0x37,0x36,0x63,0x2d,0x30,0x2e,0x31,0x38,0x32,
-    0x2c,0x30,0x2d,0x30,0x2e,0x33,0x36,0x34,0x2c,0x30,
-    0x2e,0x31,0x34,0x2d,0x30,0x2e,0x35,0x30,0x31,0x2c,
-    0x30,0x2e,0x34,0x31,0x39,0x4c,0x36,0x2e,0x33,0x35,
-    0x2c,0x36,0x2e,0x32,0x36,0x31,0x63,0x2d,0x30,0x2e,
-    0x32,0x37,0x36,0x2c,0x30,0x2e,0x35,0x36,0x2d,0x31,
-    0x2e,0x30,0x30,0x37,0x2c,0x31,0x2e,0x30,0x39,0x31,
-    0x2d,0x31,0x2e,0x36,0x32,0x34,0x2c,0x31,0x2e,0x31,
-    0x38,0x4c,0x30,0x2e,0x35,0x37,0x32,0x2c,0x38,0x2e,
-    0x30,0x34,0x35,0x0a,0x09,0x43,0x2d,0x30,0x2e,0x30,
-    0x34,0x36,0x2c,0x38,0x2e,0x31,0x33,0x35,0x2d,0x30,
-    0x2e,0x31,0x38,0x35,0x2c,0x38,0x2e,0x35,0x36,0x34,
-    0x2c,0x30,0x2e,0x32,0x36,0x32,0x2c,0x39,0x6c,0x33,
-    0x2e,0x30,0x30,0x37,0x2c,0x32,0x2e,0x39,0x33,0x31,
-    0x63,0x30,0x2e,0x34,0x34,0x37,0x2c,0x30,0x2e,0x34,
-    0x33,0x36,0x2c,0x30,0x2e,0x37,0x32,0x36,0x2c,0x31,
-    0x2e,0x32,0x39,0x35,0x2c,0x30,0x2e,0x36,0x32,0x2c,
-    0x31,0x2e,0x39,0x30,0x39,0x6c,0x2d,0x30,0x2e,0x37,
-    0x31,0x2c,0x34,0x2e,0x31,0x34,0x0a,0x09,0x63,0x2d,
-    0x30,0x2e,0x30,0x37,0x37,0x2c,0x30,0x2e,0x34,0x34,
-    0x36,0x2c,0x30,0x2e,0x30,0x39,0x34,0x2c,0x30,0x2e,
-    0x37,0x30,0x38,0x2c,0x30,0x2e,0x34,0x30,0x35,0x2c,
-    0x30,0x2e,0x37,0x30,0x38,0x63,0x30,0x2e,0x31,0x31,
-    0x38,0x2c,0x30,0x2c,0x30,0x2e,0x32,0x35,0x35,0x2d,
-    0x30,0x2e,0x30,0x33,0x38,0x2c,0x30,0x2e,0x34,0x30,
-    0x37,0x2d,0x30,0x2e,0x31,0x31,0x37,0x6c,0x33,0x2e,
-    0x37,0x31,0x37,0x2d,0x31,0x2e,0x39,0x35,0x36,0x63,
-    0x30,0x2e,0x32,0x37,0x36,0x2d,0x30,0x2e,0x31,0x34,
-    0x35,0x2c,0x30,0x2e,0x36,0x34,0x2d,0x30,0x2e,0x32,
-    0x31,0x36,0x2c,0x31,0x2e,0x30,0x30,0x33,0x2d,0x30,
-    0x2e,0x32,0x31,0x36,0x0a,0x09,0x63,0x30,0x2e,0x33,
-    0x36,0x34,0x2c,0x30,0x2c,0x30,0x2e,0x37,0x32,0x39,
-    0x2c,0x30,0x2e,0x30,0x37,0x32,0x2c,0x31,0x2e,0x30,
-    0x30,0x34,0x2c,0x30,0x2e,0x32,0x31,0x36,0x6c,0x33,
-    0x2e,0x37,0x31,0x37,0x2c,0x31,0x2e,0x39,0x35,0x36,
-    0x63,0x30,0x2e,0x31,0x35,0x2c,0x30,0x2e,0x30,0x37,
-    0x39,0x2c,0x30,0x2e,0x32,0x38,0x39,0x2c,0x30,0x2e,
-    0x31,0x31,0x37,0x2c,0x30,0x2e,0x34,0x30,0x37,0x2c,
-    0x30,0x2e,0x31,0x31,0x37,0x63,0x30,0x2e,0x33,0x31,
-    0x31,0x2c,0x30,0x2c,0x30,0x2e,0x34,0x38,0x31,0x2d,
-    0x30,0x2e,0x32,0x36,0x32,0x2c,0x30,0x2e,0x34,0x30,
-    0x35,0x2d,0x30,0x2e,0x37,0x30,0x38,0x6c,0x2d,0x30,
-    0x2e,0x37,0x31,0x31,0x2d,0x34,0x2e,0x31,0x34,0x0a,
-    0x09,0x63,0x2d,0x30,0x2e,0x31,0x30,0x35,0x2d,0x30,
-    0x2e,0x36,0x31,0x34,0x2c,0x30,0x2e,0x31,0x37,0x34,
-    0x2d,0x31,0x2e,0x34,0x37,0x34,0x2c,0x30,0x2e,0x36,
-    0x31,0x39,0x2d,0x31,0x2e,0x39,0x30,0x39,0x4c,0x31,
-    0x37,0x2e,0x31,0x36,0x2c,0x39,0x63,0x30,0x2e,0x34,
-    0x34,0x36,0x2d,0x30,0x2e,0x34,0x33,0x36,0x2c,0x30,
-    0x2e,0x33,0x30,0x37,0x2d,0x30,0x2e,0x38,0x36,0x35,
-    0x2d,0x30,0x2e,0x33,0x31,0x31,0x2d,0x30,0x2e,0x39,
-    0x35,0x35,0x6c,0x2d,0x34,0x2e,0x31,0x35,0x34,0x2d,
-    0x30,0x2e,0x36,0x30,0x33,0x0a,0x09,0x63,0x2d,0x30,
-    0x2e,0x36,0x31,0x37,0x2d,0x30,0x2e,0x30,0x38,0x39,
-    0x2d,0x31,0x2e,0x33,0x34,0x39,0x2d,0x30,0x2e,0x36,
-    0x32,0x2d,0x31,0x2e,0x36,0x32,0x34,0x2d,0x31,0x2e,
-    0x31,0x38,0x4c,0x39,0x2e,0x32,0x31,0x33,0x2c,0x32,
-    0x2e,0x34,0x39,0x35,0x43,0x39,0x2e,0x30,0x37,0x34,
-    0x2c,0x32,0x2e,0x32,0x31,0x36,0x2c,0x38,0x2e,0x38,
-    0x39,0x33,0x2c,0x32,0x2e,0x30,0x37,0x36,0x2c,0x38,
-    0x2e,0x37,0x31,0x2c,0x32,0x2e,0x30,0x37,0x36,0x4c,
-    0x38,0x2e,0x37,0x31,0x2c,0x32,0x2e,0x30,0x37,0x36,
-    0x7a,0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,
-    0x3e,0x0a
+const size_t star_filled_svg_size = 675;
+const unsigned char star_filled_svg_data[675] = {
+    0x45,0x53,0x5a,0x31,0x80,0x04,0x00,0x00,0x78,0xda,
+    0x6d,0x53,0xc9,0x6e,0xdb,0x30,0x10,0x3d,0xc7,0x5f,
+    0xc1,0xb2,0xa7,0x02,0x12,0xc5,0xe1,0x2a,0x1a,0x51,
+    0x82,0xc6,0x09,0x82,0x00,0x6e,0x1b,0xa0,0x69,0x8a,
+    0x9e,0x0a,0x2f,0x8a,0x2d,0x44,0x95,0x0d,0x59,0x5e,
+    0xda,0xaf,0xef,0x0c,0x99,0x22,0x3d,0xc4,0x07,0x69,
+    0x34,0x7c,0x7c,0xcb,0x90,0x3e,0xbf,0x3c,0xfd,0x6a,
+    0xd9,0xa1,0xee,0x77,0xcd,0xa6,0xab,0x38,0x08,0xc9,
+    0x59,0xdd,0x2d,0x36,0xcb,0xa6,0x5b,0x55,0x7c,0x3f,
+    0x3c,0xe5,0x25,0xbf,0xbc,0x18,0x9d,0xbf,0xcb,0x73,
+    0x76,0x5b,0x77,0x75,0x3f,0x1b,0x36,0xfd,0x98,0x7d,
+    0x5c,0x6e,0xe6,0x35,0xbb,0x6b,0xdb,0xfd,0x6e,0x88,
+    0x2d,0x06,0x4e,0x48,0xa1,0x33,0xf6,0xf5,0xf1,0x96,
+    0xdd,0x9c,0xb6,0x9b,0x7e,0x60,0xf7,0xed,0x7e,0x95,
+    0xdf,0x75,0x4c,0xc4,0xe6,0x63,0xd2,0x18,0x33,0x04,
+    0x4a,0x76,0xb5,0x6f,0xda,0x25,0x93,0x1f,0x18,0xcb,
+    0x73,0xa2,0xbf,0xfe,0x32,0x79,0xf8,0x71,0x7f,0xc3,
+    0x76,0x87,0x15,0xbb,0xff,0x76,0x35,0xbd,0x9b,0x30,
+    0x9e,0x17,0xc5,0x77,0x3d,0x29,0x8a,0xeb,0x87,0xeb,
+    0xc8,0x00,0x02,0x8a,0xe2,0xe6,0x33,0x67,0x7c,0x3d,
+    0x0c,0xdb,0x71,0x51,0x1c,0x8f,0x47,0x71,0xd4,0x62,
+    0xd3,0xaf,0x8a,0xdb,0x7e,0xb6,0x5d,0x37,0x8b,0x5d,
+    0x81,0xc0,0x82,0x80,0xb8,0xa9,0x40,0x32,0x00,0xb1,
+    0x1c,0x96,0x1c,0x25,0x88,0xf9,0xbf,0x9c,0xc0,0x59,
+    0xb3,0xac,0xf8,0xcd,0x1c,0x43,0xfd,0xc4,0x0f,0x1c,
+    0x43,0xb7,0xab,0xde,0x60,0x56,0x52,0x4a,0x62,0x7a,
+    0x81,0x8c,0x4f,0x6d,0xd3,0x3d,0xbf,0x05,0x84,0x10,
+    0x42,0x11,0x57,0x11,0x5a,0x71,0xb9,0x3d,0x71,0xf6,
+    0x3b,0xbd,0x47,0x67,0xec,0xd8,0x2c,0x87,0x75,0xc5,
+    0x15,0x08,0xef,0x2d,0x2d,0xad,0xeb,0x66,0xb5,0x1e,
+    0xb0,0x23,0x85,0x77,0x8a,0x3a,0x87,0xa6,0x3e,0x5e,
+    0x6d,0x68,0x2b,0x93,0x2c,0x01,0x59,0x5a,0xa5,0x33,
+    0x99,0xcd,0xdb,0x3a,0x9f,0xcf,0x16,0xcf,0xab,0x7e,
+    0xb3,0xef,0xd0,0x7a,0x57,0x1f,0xd9,0x1b,0x48,0x74,
+    0x39,0xde,0x6d,0x67,0x8b,0xba,0xe2,0xdb,0xbe,0xde,
+    0xd5,0xfd,0xa1,0xa6,0xf8,0xdb,0xd9,0xb0,0x66,0x4f,
+    0x4d,0xdb,0x56,0xfc,0xbd,0x8f,0x3f,0xce,0x90,0xe4,
+    0x53,0x29,0x3c,0x64,0x4a,0x48,0xef,0x16,0xb9,0x14,
+    0x50,0xaa,0x4c,0xe2,0x5b,0x3b,0x93,0xe1,0x97,0xc1,
+    0xd2,0x4a,0xc0,0xd2,0x40,0x98,0x3a,0xa1,0x6d,0xe6,
+    0x84,0x72,0x40,0x50,0xe5,0x1d,0xf6,0xad,0xcb,0xf1,
+    0xce,0x48,0x9f,0xe1,0x33,0x00,0xd6,0x4e,0x19,0xac,
+    0xa1,0x9c,0xe2,0x9a,0x57,0x59,0x29,0xa4,0xb1,0xa3,
+    0xb3,0x09,0x6e,0x90,0xc6,0xe1,0x27,0x68,0x1b,0x75,
+    0x2c,0xd6,0x36,0xaa,0x28,0xa7,0xb2,0xd0,0xea,0xc8,
+    0xa2,0x44,0xd0,0xb0,0x40,0x39,0xe3,0x49,0x54,0x93,
+    0x84,0x57,0x0e,0x19,0x55,0xb0,0x58,0x23,0x14,0x44,
+    0x90,0xa1,0x45,0x0e,0xf4,0x6d,0xd0,0xe2,0xe8,0x8c,
+    0xdc,0x48,0x1f,0x37,0x18,0xda,0x20,0x03,0xd1,0x7a,
+    0x59,0x52,0x47,0xda,0x54,0x23,0x29,0x00,0x76,0x48,
+    0xd0,0x92,0x05,0xa9,0xd3,0xba,0x27,0x3b,0xe0,0xd1,
+    0x80,0x07,0x8f,0x01,0x82,0x75,0x8b,0x98,0x8e,0xfa,
+    0x26,0x8a,0xd2,0x18,0x14,0x90,0x0b,0x29,0x75,0xaa,
+    0x51,0xf5,0x65,0x4a,0xd1,0x61,0x20,0x59,0xaf,0x22,
+    0x22,0x66,0x02,0x97,0x08,0xb3,0x7f,0x84,0x60,0x23,
+    0x84,0x80,0xaa,0xa4,0x27,0x6a,0x26,0xfd,0x54,0x13,
+    0x1d,0x40,0xa4,0x33,0x25,0xe4,0x69,0x2c,0xd1,0x7f,
+    0x1e,0xfd,0xa7,0xc4,0x90,0xbf,0x46,0x86,0xb8,0xe4,
+    0x20,0x9e,0x94,0x37,0x68,0xdd,0x78,0xaa,0x1d,0x84,
+    0x3c,0x0e,0x69,0x0a,0x5e,0xa0,0xeb,0x10,0xe7,0x49,
+    0x71,0xd2,0x3c,0x75,0x8c,0x5c,0x3a,0xda,0x8d,0x92,
+    0xf8,0x0c,0xd6,0xb6,0x44,0x6c,0x29,0xa8,0x93,0x3a,
+    0xf1,0x3b,0x20,0x9c,0x2c,0x89,0x4d,0x9b,0x40,0x1d,
+    0x95,0x0e,0x38,0x8f,0x07,0x1c,0x30,0xa5,0xc6,0x13,
+    0x33,0xc1,0x4e,0x02,0x46,0x33,0x58,0xd3,0x94,0x4a,
+    0x51,0x06,0x9d,0xae,0x54,0xf6,0x7a,0xbb,0xa6,0xaf,
+    0xe5,0x1f,0x5e,0xe0,0x85,0xa4,0xff,0xd4,0xc5,0xe8,
+    0x2f,0xf4,0xe3,0x16,0x2e
 };
 
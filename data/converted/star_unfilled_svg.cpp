@@ -1,196 +1,108 @@
-//this file was auto-generated from "star_unfilled.svg" by res2h
+//this file was auto-generated from "star_unfilled.svg" by res2h (compressed by compress_resources.py)
 
 #include "../Resources.h"
 
-const size_t star_unfilled_svg_size = 1871;
-const unsigned char star_unfilled_svg_data[1871] = {
-    0x3c,0x3f,0x78,0x6d,0x6c,0x20,0x76,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x30,0x22,0x20,
-    0x65,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,0x3d,0x22,
-    0x75,0x74,0x66,0x2d,0x38,0x22,0x3f,0x3e,0x0a,0x3c,
-    0x21,0x2d,0x2d,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,
-    0x74,0x6f,0x72,0x3a,0x20,0x41,0x64,0x6f,0x62,0x65,
-    0x20,0x49,0x6c,0x6c,0x75,0x73,0x74,0x72,0x61,0x74,
-    0x6f,0x72,0x20,0x31,0x36,0x2e,0x30,0x2e,0x33,0x2c,
-    0x20,0x53,0x56,0x47,0x20,0x45,0x78,0x70,0x6f,0x72,
-    0x74,0x20,0x50,0x6c,0x75,0x67,0x2d,0x49,0x6e,0x20,
-    0x2e,0x20,0x53,0x56,0x47,0x20,0x56,0x65,0x72,0x73,
-    0x69,0x6f,0x6e,0x3a,0x20,0x36,0x2e,0x30,0x30,0x20,
-    0x42,0x75,0x69,0x6c,0x64,0x20,0x30,0x29,0x20,0x20,
-    0x2d,0x2d,0x3e,0x0a,0x3c,0x21,0x44,0x4f,0x43,0x54,
-    0x59,0x50,0x45,0x20,0x73,0x76,0x67,0x20,0x50,0x55,
-    0x42,0x4c,0x49,0x43,0x20,0x22,0x2d,0x2f,0x2f,0x57,
-    0x33,0x43,0x2f,0x2f,0x44,0x54,0x44,0x20,0x53,0x56,
-    0x47,0x20,0x31,0x2e,0x31,0x2f,0x2f,0x45,0x4e,0x22,
-    0x20,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x47,0x72,0x61,0x70,0x68,0x69,0x63,0x73,0x2f,0x53,
-    0x56,0x47,0x2f,0x31,0x2e,0x31,0x2f,0x44,0x54,0x44,
-    0x2f,0x73,0x76,0x67,0x31,0x31,0x2e,0x64,0x74,0x64,
-    0x22,0x3e,0x0a,0x3c,0x73,0x76,0x67,0x20,0x76,0x65,
-    0x72,0x73,0x69,0x6f,0x6e,0x3d,0x22,0x31,0x2e,0x31,
-    0x22,0x20,0x69,0x64,0x3d,0x22,0x45,0x62,0x65,0x6e,
-    0x65,0x5f,0x31,0x22,0x20,0x78,0x6d,0x6c,0x6e,0x73,
-    0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x77,
-    0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,0x2f,
-    0x32,0x30,0x30,0x30,0x2f,0x73,0x76,0x67,0x22,0x20,
-    0x78,0x6d,0x6c,0x6e,0x73,0x3a,0x78,0x6c,0x69,0x6e,
-    0x6b,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
-    0x77,0x77,0x77,0x2e,0x77,0x33,0x2e,0x6f,0x72,0x67,
-    0x2f,0x31,0x39,0x39,0x39,0x2f,0x78,0x6c,0x69,0x6e,
-    0x6b,0x22,0x20,0x78,0x3d,0x22,0x30,0x70,0x78,0x22,
-    0x20,0x79,0x3d,0x22,0x30,0x70,0x78,0x22,0x0a,0x09,
-    0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x32,0x31,
-    0x2e,0x37,0x37,0x35,0x70,0x78,0x22,0x20,0x68,0x65,
-    0x69,0x67,0x68,0x74,0x3d,0x22,0x32,0x30,0x2e,0x37,
-    0x36,0x32,0x70,0x78,0x22,0x20,0x76,0x69,0x65,0x77,
-    0x42,0x6f,0x78,0x3d,0x22,0x30,0x20,0x30,0x20,0x32,
-    0x31,0x2e,0x37,0x37,0x35,0x20,0x32,0x30,0x2e,0x37,
-    0x36,0x32,0x22,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,
-    0x2d,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-    0x64,0x3d,0x22,0x6e,0x65,0x77,0x20,0x30,0x20,0x30,
-    0x20,0x32,0x31,0x2e,0x37,0x37,0x35,0x20,0x32,0x30,
-    0x2e,0x37,0x36,0x32,0x22,0x20,0x78,0x6d,0x6c,0x3a,
-    0x73,0x70,0x61,0x63,0x65,0x3d,0x22,0x70,0x72,0x65,
-    0x73,0x65,0x72,0x76,0x65,0x22,0x3e,0x0a,0x3c,0x70,
-    0x61,0x74,0x68,0x20,0x66,0x69,0x6c,0x6c,0x3d,0x22,
-    0x23,0x37,0x37,0x37,0x37,0x37,0x37,0x22,0x20,0x64,
-    0x3d,0x22,0x4d,0x38,0x2e,0x37,0x31,0x2c,0x32,0x2e,
-    0x34,0x38,0x63,0x30,0x2e,0x30,0x32,0x36,0x2c,0x30,
-    0x2e,0x30,0x31,0x38,0x2c,0x30,0x2e,0x30,0x38,0x33,
-    0x2c,0x30,0x2e,0x30,0x37,0x2c,0x30,0x2e,0x31,0x34,
-    0x33,0x2c,0x30,0x2e,0x31,0x39,0x33,0x6c,0x31,0x2e,
-    0x38,0x35,0x39,0x2c,0x33,0x2e,0x37,0x36,0x36,0x63,
-    0x30,0x2e,0x33,0x33,0x33,0x2c,0x30,0x2e,0x36,0x37,
-    0x36,0x2c,0x31,0x2e,0x31,0x38,0x2c,0x31,0x2e,0x32,
-    0x39,0x31,0x2c,0x31,0x2e,0x39,0x32,0x34,0x2c,0x31,
-    0x2e,0x33,0x39,0x38,0x6c,0x34,0x2e,0x31,0x35,0x35,
-    0x2c,0x30,0x2e,0x36,0x30,0x33,0x0a,0x09,0x63,0x30,
-    0x2e,0x31,0x35,0x2c,0x30,0x2e,0x30,0x32,0x32,0x2c,
-    0x30,0x2e,0x32,0x31,0x38,0x2c,0x30,0x2e,0x30,0x36,
-    0x36,0x2c,0x30,0x2e,0x32,0x32,0x37,0x2c,0x30,0x2e,
-    0x30,0x36,0x36,0x63,0x30,0x2e,0x30,0x30,0x31,0x2c,
-    0x30,0x2c,0x30,0x2e,0x30,0x30,0x31,0x2c,0x30,0x2c,
-    0x30,0x2e,0x30,0x30,0x31,0x2c,0x30,0x63,0x30,0x2c,
-    0x30,0x2e,0x30,0x31,0x39,0x2d,0x30,0x2e,0x30,0x32,
-    0x35,0x2c,0x30,0x2e,0x30,0x39,0x36,0x2d,0x30,0x2e,
-    0x31,0x34,0x2c,0x30,0x2e,0x32,0x30,0x37,0x6c,0x2d,
-    0x33,0x2e,0x30,0x30,0x39,0x2c,0x32,0x2e,0x39,0x33,
-    0x31,0x0a,0x09,0x63,0x2d,0x30,0x2e,0x35,0x33,0x39,
-    0x2c,0x30,0x2e,0x35,0x32,0x36,0x2d,0x30,0x2e,0x38,
-    0x36,0x32,0x2c,0x31,0x2e,0x35,0x32,0x31,0x2d,0x30,
-    0x2e,0x37,0x33,0x35,0x2c,0x32,0x2e,0x32,0x36,0x33,
-    0x6c,0x30,0x2e,0x37,0x31,0x31,0x2c,0x34,0x2e,0x31,
-    0x34,0x63,0x30,0x2e,0x30,0x32,0x37,0x2c,0x30,0x2e,
-    0x31,0x35,0x36,0x2c,0x30,0x2e,0x30,0x30,0x33,0x2c,
-    0x30,0x2e,0x32,0x33,0x34,0x2d,0x30,0x2e,0x30,0x31,
-    0x31,0x2c,0x30,0x2e,0x32,0x33,0x39,0x63,0x2d,0x30,
-    0x2e,0x30,0x32,0x35,0x2c,0x30,0x2d,0x30,0x2e,0x30,
-    0x39,0x38,0x2d,0x30,0x2e,0x30,0x30,0x38,0x2d,0x30,
-    0x2e,0x32,0x32,0x31,0x2d,0x30,0x2e,0x30,0x37,0x31,
-    0x4c,0x39,0x2e,0x39,0x2c,0x31,0x36,0x2e,0x32,0x36,
-    0x0a,0x09,0x63,0x2d,0x30,0x2e,0x33,0x32,0x34,0x2d,
-    0x30,0x2e,0x31,0x37,0x31,0x2d,0x30,0x2e,0x37,0x34,
-    0x37,0x2d,0x30,0x2e,0x32,0x36,0x34,0x2d,0x31,0x2e,
-    0x31,0x39,0x2d,0x30,0x2e,0x32,0x36,0x34,0x53,0x37,
-    0x2e,0x38,0x34,0x33,0x2c,0x31,0x36,0x2e,0x30,0x39,
-    0x2c,0x37,0x2e,0x35,0x32,0x2c,0x31,0x36,0x2e,0x32,
-    0x36,0x6c,0x2d,0x33,0x2e,0x37,0x31,0x36,0x2c,0x31,
-    0x2e,0x39,0x35,0x34,0x63,0x2d,0x30,0x2e,0x31,0x32,
-    0x33,0x2c,0x30,0x2e,0x30,0x36,0x33,0x2d,0x30,0x2e,
-    0x31,0x39,0x36,0x2c,0x30,0x2e,0x30,0x37,0x31,0x2d,
-    0x30,0x2e,0x32,0x32,0x34,0x2c,0x30,0x2e,0x30,0x38,
-    0x32,0x0a,0x09,0x63,0x2d,0x30,0x2e,0x30,0x31,0x2d,
-    0x30,0x2e,0x30,0x31,0x36,0x2d,0x30,0x2e,0x30,0x33,
-    0x34,0x2d,0x30,0x2e,0x30,0x39,0x34,0x2d,0x30,0x2e,
-    0x30,0x30,0x38,0x2d,0x30,0x2e,0x32,0x35,0x6c,0x30,
-    0x2e,0x37,0x31,0x2d,0x34,0x2e,0x31,0x34,0x63,0x30,
-    0x2e,0x31,0x32,0x38,0x2d,0x30,0x2e,0x37,0x34,0x33,
-    0x2d,0x30,0x2e,0x31,0x39,0x35,0x2d,0x31,0x2e,0x37,
-    0x33,0x37,0x2d,0x30,0x2e,0x37,0x33,0x35,0x2d,0x32,
-    0x2e,0x32,0x36,0x33,0x4c,0x30,0x2e,0x35,0x34,0x31,
-    0x2c,0x38,0x2e,0x37,0x31,0x32,0x43,0x30,0x2e,0x34,
-    0x32,0x37,0x2c,0x38,0x2e,0x36,0x30,0x32,0x2c,0x30,
-    0x2e,0x34,0x2c,0x38,0x2e,0x35,0x32,0x35,0x2c,0x30,
-    0x2e,0x33,0x39,0x35,0x2c,0x38,0x2e,0x35,0x32,0x35,
-    0x0a,0x09,0x6c,0x30,0x2c,0x30,0x43,0x30,0x2e,0x34,
-    0x30,0x35,0x2c,0x38,0x2e,0x35,0x31,0x2c,0x30,0x2e,
-    0x34,0x37,0x32,0x2c,0x38,0x2e,0x34,0x36,0x34,0x2c,
-    0x30,0x2e,0x36,0x33,0x2c,0x38,0x2e,0x34,0x34,0x31,
-    0x6c,0x34,0x2e,0x31,0x35,0x33,0x2d,0x30,0x2e,0x36,
-    0x30,0x33,0x43,0x35,0x2e,0x35,0x33,0x2c,0x37,0x2e,
-    0x37,0x33,0x2c,0x36,0x2e,0x33,0x37,0x35,0x2c,0x37,
-    0x2e,0x31,0x31,0x35,0x2c,0x36,0x2e,0x37,0x30,0x39,
-    0x2c,0x36,0x2e,0x34,0x33,0x39,0x6c,0x31,0x2e,0x38,
-    0x35,0x39,0x2d,0x33,0x2e,0x37,0x36,0x36,0x0a,0x09,
-    0x43,0x38,0x2e,0x36,0x32,0x38,0x2c,0x32,0x2e,0x35,
-    0x35,0x2c,0x38,0x2e,0x36,0x38,0x35,0x2c,0x32,0x2e,
-    0x34,0x39,0x36,0x2c,0x38,0x2e,0x37,0x31,0x2c,0x32,
-    0x2e,0x34,0x38,0x20,0x4d,0x38,0x2e,0x37,0x31,0x2c,
-    0x32,0x2e,0x30,0x37,0x36,0x63,0x2d,0x30,0x2e,0x31,
-    0x38,0x32,0x2c,0x30,0x2d,0x30,0x2e,0x33,0x36,0x34,
-    0x2c,0x30,0x2e,0x31,0x34,0x2d,0x30,0x2e,0x35,0x30,
-    0x31,0x2c,0x30,0x2e,0x34,0x31,0x39,0x4c,0x36,0x2e,
-    0x33,0x35,0x2c,0x36,0x2e,0x32,0x36,0x32,0x63,0x2d,
-    0x30,0x2e,0x32,0x37,0x36,0x2c,0x30,0x2e,0x35,0x36,
-    0x2d,0x31,0x2e,0x30,0x30,0x37,0x2c,0x31,0x2e,0x30,
-    0x39,0x31,0x2d,0x31,0x2e,0x36,0x32,0x34,0x2c,0x31,
-    0x2e,0x31,0x38,0x0a,0x09,0x4c,0x30,0x2e,0x35,0x37,
-    0x32,0x2c,0x38,0x2e,0x30,0x34,0x35,0x63,0x2d,0x30,
-    0x2e,0x36,0x31,0x38,0x2c,0x30,0x2e,0x30,0x39,0x2d,
-    0x30,0x2e,0x37,0x35,0x37,0x2c,0x30,0x2e,0x35,0x32,
-    0x2d,0x30,0x2e,0x33,0x31,0x2c,0x30,0x2e,0x39,0x35,
-    0x35,0x6c,0x33,0x2e,0x30,0x30,0x37,0x2c,0x32,0x2e,
-    0x39,0x33,0x31,0x63,0x30,0x2e,0x34,0x34,0x37,0x2c,
-    0x30,0x2e,0x34,0x33,0x36,0x2c,0x30,0x2e,0x37,0x32,
-    0x36,0x2c,0x31,0x2e,0x32,0x39,0x35,0x2c,0x30,0x2e,
-    0x36,0x32,0x2c,0x31,0x2e,0x39,0x30,0x39,0x6c,0x2d,
-    0x30,0x2e,0x37,0x31,0x2c,0x34,0x2e,0x31,0x33,0x39,
-    0x0a,0x09,0x63,0x2d,0x30,0x2e,0x30,0x37,0x37,0x2c,
-    0x30,0x2e,0x34,0x34,0x36,0x2c,0x30,0x2e,0x30,0x39,
-    0x34,0x2c,0x30,0x2e,0x37,0x30,0x38,0x2c,0x30,0x2e,
-    0x34,0x30,0x35,0x2c,0x30,0x2e,0x37,0x30,0x38,0x63,
-    0x30,0x2e,0x31,0x31,0x38,0x2c,0x30,0x2c,0x30,0x2e,
-    0x32,0x35,0x35,0x2d,0x30,0x2e,0x30,0x33,0x38,0x2c,
-    0x30,0x2e,0x34,0x30,0x37,0x2d,0x30,0x2e,0x31,0x31,
-    0x37,0x6c,0x33,0x2e,0x37,0x31,0x37,0x2d,0x31,0x2e,
-    0x39,0x35,0x35,0x63,0x30,0x2e,0x32,0x37,0x36,0x2d,
-    0x30,0x2e,0x31,0x34,0x35,0x2c,0x30,0x2e,0x36,0x34,
-    0x2d,0x30,0x2e,0x32,0x31,0x36,0x2c,0x31,0x2e,0x30,
-    0x30,0x33,0x2d,0x30,0x2e,0x32,0x31,0x36,0x0a,0x09,
-    0x63,0x30,0x2e,0x33,0x36,0x34,0x2c,0x30,0x2c,0x30,
-    0x2e,0x37,0x32,0x39,0x2c,0x30,0x2e,0x30,0x37,0x32,
-    0x2c,0x31,0x2e,0x30,0x30,0x34,0x2c,0x30,0x2e,0x32,
-    0x31,0x36,0x6c,0x33,0x2e,0x37,0x31,0x37,0x2c,0x31,
-    0x2e,0x39,0x35,0x35,0x63,0x30,0x2e,0x31,0x35,0x2c,
-    0x30,0x2e,0x30,0x37,0x39,0x2c,0x30,0x2e,0x32,0x38,
-    0x39,0x2c,0x30,0x2e,0x31,0x31,0x37,0x2c,0x30,0x2e,
-    0x34,0x30,0x37,0x2c,0x30,0x2e,0x31,0x31,0x37,0x63,
-    0x30,0x2e,0x33,0x31,0x31,0x2c,0x30,0x2c,0x30,0x2e,
-    0x34,0x38,0x31,0x2d,0x30,0x2e,0x32,0x36,0x32,0x2c,
-    0x30,0x2e,0x34,0x30,0x35,0x2d,0x30,0x2e,0x37,0x30,
-    0x38,0x6c,0x2d,0x30,0x2e,0x37,0x31,0x31,0x2d,0x34,
-    0x2e,0x31,0x33,0x39,0x0a,0x09,0x63,0x2d,0x30,0x2e,
-    0x31,0x30,0x35,0x2d,0x30,0x2e,0x36,0x31,0x34,0x2c,
-    0x30,0x2e,0x31,0x37,0x34,0x2d,0x31,0x2e,0x34,0x37,
-    0x34,0x2c,0x30,0x2e,0x36,0x31,0x39,0x2d,0x31,0x2e,
-    0x39,0x30,0x39,0x6c,0x33,0x2e,0x30,0x30,0x39,0x2d,
-    0x32,0x2e,0x39,0x33,0x31,0x63,0x30,0x2e,0x34,0x34,
-    0x36,0x2d,0x30,0x2e,0x34,0x33,0x35,0x2c,0x30,0x2e,
-    0x33,0x30,0x37,0x2d,0x30,0x2e,0x38,0x36,0x35,0x2d,
-    0x30,0x2e,0x33,0x31,0x31,0x2d,0x30,0x2e,0x39,0x35,
-    0x35,0x6c,0x2d,0x34,0x2e,0x31,0x35,0x34,0x2d,0x30,
-    0x2e,0x36,0x30,0x33,0x0a,0x09,0x63,0x2d,0x30,0x2e,
-    0x36,0x31,0x37,0x2d,0x30,0x2e,0x30,0x38,0x39,0x2d,
-    0x31,0x2e,0x33,0x34,0x39,0x2d,0x30,0x2e,0x36,0x32,
-    0x2d,0x31,0x2e,0x36,0x32,0x34,0x2d,0x31,0x2e,0x31,
-    0x38,0x4c,0x39,0x2e,0x32,0x31,0x33,0x2c,0x32,0x2e,
-    0x34,0x39,0x35,0x43,0x39,0x2e,0x30,0x37,0x34,0x2c,
-    0x32,0x2e,0x32,0x31,0x36,0x2c,0x38,0x2e,0x38,0x39,
-    0x33,0x2c,0x32,0x2e,0x30,0x37,0x36,0x2c,0x38,0x2e,
-    0x37,0x31,0x2c,0x32,0x2e,0x30,0x37,0x36,0x4c,0x38,
-    0x2e,0x37,0x31,0x2c,0x32,0x2e,0x30,0x37,0x36,0x7a,
-    0x22,0x2f,0x3e,0x0a,0x3c,0x2f,0x73,0x76,0x67,0x3e,
-    0x0a
+const size_t star_unfilled_svg_size = 999;
+const unsigned char star_unfilled_svg_data[999] = {
+    0x45,0x53,0x5a,0x31,0x4f,0x07,0x00,0x00,0x78,0xda,
+    0x6d,0x55,0xdb,0x6e,0x1b,0x47,0x0c,0x7d,0x96,0xbe,
+    0x62,0xba,0x7d,0x2a,0xb0,0x97,0xe1,0xdc,0x47,0x88,
+    0x12,0xd4,0xb2,0x61,0x18,0x70,0x5b,0x03,0x49,0x53,
+    0xf4,0xa9,0x90,0xa5,0x8d,0x24,0x64,0x2b,0x09,0x92,
+    0x6c,0xb9,0xfd,0xfa,0xf2,0x70,0xec,0x38,0x28,0xec,
+    0x07,0x2e,0xb5,0xc3,0xe1,0x21,0x0f,0x0f,0xd7,0xef,
+    0x3e,0x3c,0xfd,0x3d,0xa8,0xc7,0xfe,0x70,0xdc,0xec,
+    0xb6,0xd3,0x8a,0x5a,0x5d,0xa9,0x7e,0xbb,0xd8,0x2d,
+    0x37,0xdb,0xd5,0xb4,0x7a,0x38,0x7d,0x69,0x52,0xf5,
+    0xe1,0xfd,0xf8,0xdd,0x0f,0x4d,0xa3,0xae,0xfb,0x6d,
+    0x7f,0x98,0x9f,0x76,0x87,0x89,0xfa,0x79,0xb9,0xbb,
+    0xef,0xd5,0xcd,0x30,0x3c,0x1c,0x4f,0xf2,0x4a,0x51,
+    0x68,0x75,0x6b,0x6b,0xf5,0xf1,0xf3,0xb5,0xba,0x7a,
+    0xda,0xef,0x0e,0x27,0x75,0x37,0x3c,0xac,0x9a,0x9b,
+    0xad,0x6a,0xe5,0xe5,0xe7,0x82,0x31,0x51,0x1c,0xa8,
+    0xd5,0xc5,0xc3,0x66,0x58,0x2a,0xfd,0x93,0x52,0x4d,
+    0x83,0xf4,0x97,0xbf,0xcd,0x3e,0xfd,0x79,0x77,0xa5,
+    0x8e,0x8f,0x2b,0x75,0xf7,0xfb,0xc5,0xed,0xcd,0x4c,
+    0x55,0x4d,0xd7,0xfd,0x61,0x67,0x5d,0x77,0xf9,0xe9,
+    0x52,0x32,0x50,0x4b,0x5d,0x77,0xf5,0x6b,0xa5,0xaa,
+    0xf5,0xe9,0xb4,0x9f,0x74,0xdd,0xf9,0x7c,0x6e,0xcf,
+    0xb6,0xdd,0x1d,0x56,0xdd,0xf5,0x61,0xbe,0x5f,0x6f,
+    0x16,0xc7,0x8e,0x03,0x3b,0x04,0xf2,0xa5,0x8e,0x93,
+    0x11,0xb5,0xcb,0xd3,0xb2,0x62,0x08,0x64,0xfe,0xae,
+    0x4f,0xaa,0xd4,0x66,0x39,0xad,0xae,0xee,0xb9,0xa9,
+    0xbf,0xf8,0x07,0xd3,0xb0,0x3d,0x4e,0xdf,0xc8,0x6c,
+    0xb4,0xd6,0xc8,0xf4,0x1c,0x32,0x79,0x1a,0x36,0xdb,
+    0xaf,0x6f,0x05,0x52,0xce,0xb9,0x93,0x53,0x0e,0x9d,
+    0x56,0x7a,0xff,0x54,0xa9,0x7f,0xca,0x73,0x3c,0x52,
+    0xe7,0xcd,0xf2,0xb4,0x9e,0x56,0x86,0xda,0x18,0x3d,
+    0x8e,0xd6,0xfd,0x66,0xb5,0x3e,0xf1,0x1b,0xdd,0xc6,
+    0x60,0xf0,0xe6,0x71,0xd3,0x9f,0x2f,0x76,0xb8,0xaa,
+    0xb4,0x2a,0x81,0xaa,0x9c,0x62,0x26,0xf3,0xfb,0xa1,
+    0x6f,0xee,0xe7,0x8b,0xaf,0xab,0xc3,0xee,0x61,0xcb,
+    0xa5,0x6f,0xfb,0xb3,0x7a,0x23,0x92,0xab,0x9c,0x1c,
+    0xf7,0xf3,0x45,0x3f,0xad,0xf6,0x87,0xfe,0xd8,0x1f,
+    0x1e,0x7b,0xb4,0xbf,0x9f,0x9f,0xd6,0xea,0xcb,0x66,
+    0x18,0xa6,0xd5,0x8f,0x51,0xfe,0x2a,0xc5,0x49,0x7e,
+    0x49,0x6d,0xa4,0xda,0xb4,0x2e,0x2d,0x74,0xab,0x4d,
+    0xa8,0xd9,0x52,0x82,0x4d,0x16,0x36,0xb2,0x21,0x07,
+    0x97,0xb2,0x1d,0xa8,0x4d,0x3e,0xd7,0x96,0x81,0x02,
+    0x87,0x5b,0x8b,0xf7,0x21,0x86,0x9a,0xe9,0x4c,0x6c,
+    0x4c,0x26,0xb6,0xd9,0x38,0xb6,0x36,0xa7,0xc1,0xb5,
+    0xe4,0x3d,0x42,0xb4,0x1d,0x8f,0xf8,0x02,0xe1,0x87,
+    0x36,0x86,0xad,0x29,0x20,0x01,0x80,0xc6,0xc4,0xe2,
+    0xa3,0x04,0x4d,0xb5,0xae,0xff,0xf7,0x5c,0x88,0x47,
+    0xb9,0xc1,0x6d,0xc9,0x91,0x43,0x83,0xba,0x70,0x59,
+    0xc7,0xa1,0xb1,0x1c,0x97,0xb9,0x8b,0x6c,0x89,0x81,
+    0xf8,0xc8,0xdb,0xcc,0x67,0xde,0x20,0x2c,0x05,0xc3,
+    0xf5,0x78,0x43,0xec,0x47,0xeb,0x39,0xcc,0x04,0x3b,
+    0xb0,0x4f,0x54,0x73,0x85,0x4e,0x1a,0x97,0x3e,0xbd,
+    0xb4,0xaf,0xd1,0x95,0xb1,0x0e,0x68,0x1c,0x02,0x3f,
+    0x2f,0x5e,0xa0,0xf1,0xcc,0x09,0x56,0xc3,0x1a,0xc9,
+    0xaa,0x23,0xdd,0xe6,0x36,0xd7,0xbc,0x03,0x26,0x94,
+    0x02,0xac,0xc1,0x7d,0x8a,0x02,0xea,0x22,0x42,0x83,
+    0x6b,0x98,0xa7,0x5c,0xdc,0x8f,0xb1,0x4d,0x4c,0x2b,
+    0xb6,0x26,0xd7,0x91,0xab,0x2b,0x97,0xd1,0x4a,0x24,
+    0x10,0x9a,0xbd,0x43,0x1e,0x32,0x32,0x86,0x60,0xe1,
+    0x67,0xa9,0x4f,0x72,0x1a,0xe3,0x64,0x48,0xa6,0xc0,
+    0x69,0x29,0x83,0xd0,0xae,0x2e,0x95,0x67,0xf7,0x5a,
+    0xa4,0x97,0x6e,0x9b,0xe7,0x66,0xc9,0x24,0x29,0xaa,
+    0xa4,0xf4,0x5c,0x54,0xb4,0xb1,0x70,0xd3,0x08,0x37,
+    0xb7,0xcc,0x9c,0xa3,0x1a,0xca,0x30,0x33,0xdd,0x3a,
+    0x26,0x27,0xf1,0x0c,0x31,0x36,0xc7,0x9e,0x97,0x11,
+    0xd8,0xec,0x8b,0x3f,0x1e,0x0d,0x3c,0x1e,0xc4,0x69,
+    0x79,0x03,0xc6,0x5c,0x34,0xec,0xba,0x80,0x1a,0x83,
+    0x85,0xeb,0x48,0xd4,0x00,0x4c,0x56,0xc3,0xcc,0xf3,
+    0x84,0xb8,0xed,0x68,0xeb,0xd0,0xda,0xe8,0xd9,0x25,
+    0x16,0x47,0x68,0x23,0xb3,0x11,0x5a,0x67,0x73,0x91,
+    0x5a,0x23,0x52,0x1b,0x8f,0x66,0x8c,0x6f,0x12,0x4f,
+    0xce,0x03,0x22,0x24,0x0c,0xd1,0x31,0x1b,0xdf,0xc4,
+    0xab,0x5e,0x74,0xac,0x63,0x10,0xda,0x92,0x91,0x59,
+    0x59,0x29,0x81,0xc0,0x85,0xd7,0x52,0x19,0xe5,0x5b,
+    0x86,0x04,0x96,0x09,0x06,0xa1,0x26,0x82,0x55,0x1f,
+    0x98,0x07,0xcd,0x72,0x67,0x9b,0x89,0xfd,0x20,0x2a,
+    0xa6,0x34,0x1e,0x81,0x0e,0xe9,0x47,0x3b,0x8f,0x0b,
+    0xa1,0x48,0x17,0x83,0x8c,0x3e,0x8a,0xcc,0x80,0x84,
+    0xec,0xd9,0xfb,0xc1,0x4a,0x1a,0xd1,0x22,0x93,0xed,
+    0x1c,0x22,0x9c,0x05,0x46,0x34,0x41,0x96,0x44,0x56,
+    0x02,0x9a,0xcc,0x3a,0x0f,0xc8,0x22,0x3a,0xb4,0xf9,
+    0x79,0x94,0x51,0x6e,0x38,0x99,0x75,0x46,0xf9,0x51,
+    0x03,0x10,0xf4,0x8a,0x8f,0x11,0xa2,0x04,0x28,0xd3,
+    0x7b,0x99,0x78,0x39,0xc7,0x10,0x89,0xe2,0x00,0x09,
+    0xc5,0x06,0x12,0xf2,0x0b,0xe9,0x4f,0x76,0x45,0x50,
+    0x41,0x84,0x11,0x7d,0xb1,0xcc,0x8b,0x2f,0x9b,0x29,
+    0x3c,0x49,0x89,0x59,0x24,0x66,0x24,0x42,0xf6,0x8b,
+    0x42,0x49,0x58,0xbf,0x24,0x2c,0x5b,0x1c,0x11,0x68,
+    0x12,0x2c,0x63,0x16,0xfc,0xe2,0x23,0x1d,0x95,0xed,
+    0x75,0x49,0xb4,0x1a,0x4c,0xa9,0xbf,0x91,0xfa,0x4b,
+    0xcb,0x22,0xc7,0x97,0x9e,0x49,0xce,0x82,0x2c,0x34,
+    0x45,0xec,0x89,0x8b,0xa2,0x1d,0x5e,0x97,0x42,0x93,
+    0x6c,0x78,0xf3,0xca,0x2a,0x7a,0x72,0x56,0x84,0x28,
+    0x7d,0xa7,0xe0,0x65,0x08,0xc0,0xc3,0x14,0x90,0xdd,
+    0xbb,0xe6,0xe5,0xdb,0x23,0xd9,0x11,0xa7,0x13,0x32,
+    0x5a,0x87,0xe9,0x05,0x53,0xe6,0x8c,0xb5,0x4c,0xbc,
+    0xc0,0x86,0xac,0xe8,0xca,0xcf,0x32,0xf7,0xe7,0xf0,
+    0xa1,0x20,0x68,0x2c,0x65,0x5b,0x94,0x55,0xbf,0x8a,
+    0xec,0xf6,0xd5,0xfd,0xb7,0xea,0xf8,0xfb,0x8a,0x7f,
+    0x11,0xef,0xc7,0xff,0x01,0x48,0x1e,0xa4,0x0b
 };
 
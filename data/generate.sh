@@ -1,3 +1,4 @@
 #get res2h here: https://github.com/HorstBaerbel/res2h
 
 res2h ./resources ./converted -s -h Resources.h -u ResourceUtil.cpp
+python compress_resources.py
@@ -0,0 +1,327 @@
+#include "ArchiveIndex.h"
+#include "BinaryIO.h"
+#include "Log.h"
+#include "platform.h"
+#include <boost/filesystem/fstream.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+#include <fstream>
+#include <sstream>
+#include <string.h>
+#include <algorithm>
+
+namespace fs = boost::filesystem;
+
+// bump this if the layout below changes
+static const char ARCHIVES_MAGIC[4] = { 'E', 'S', 'A', 'I' };
+static const uint32_t ARCHIVES_VERSION = 1;
+static const uint32_t UNREADABLE = 0xFFFFFFFF; // entry count of an archive that couldn't be read
+
+#define ZIP_EOCD_SIZE 22
+#define ZIP_MAX_COMMENT 0xFFFF
+#define ZIP_CD_HEADER_SIZE 46
+#define ZIP_MAX_DIRECTORY (64 * 1024 * 1024) // anything bigger is surely damaged
+
+// zips are little endian
+static uint16_t getLE16(const unsigned char* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static uint32_t getLE32(const unsigned char* p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+static uint64_t getLE64(const unsigned char* p) { return (uint64_t)getLE32(p) | ((uint64_t)getLE32(p + 4) << 32); }
+
+ArchiveIndex* ArchiveIndex::getInstance()
+{
+	static ArchiveIndex instance;
+	return &instance;
+}
+
+ArchiveIndex::ArchiveIndex() : mDirty(false), mCacheLoaded(false)
+{
+}
+
+ArchiveIndex::~ArchiveIndex()
+{
+	// in case we exit without going through main's shutdown (the command line scraper)
+	save();
+}
+
+bool ArchiveIndex::isArchive(const fs::path& path)
+{
+	return boost::iequals(path.extension().string(), ".zip");
+}
+
+std::string ArchiveIndex::getCachePath()
+{
+	return getHomePath() + "/.emulationstation/cache/archives.cache";
+}
+
+void ArchiveIndex::loadCache()
+{
+	if(mCacheLoaded)
+		return;
+	mCacheLoaded = true;
+
+	const std::string path = getCachePath();
+	std::ifstream in(path.c_str(), std::ios::in | std::ios::binary);
+	if(!in.is_open())
+		return;
+
+	char magic[4];
+	uint32_t version, count;
+	if(!in.read(magic, 4) || memcmp(magic, ARCHIVES_MAGIC, 4) != 0 || !readU32(in, version) || version != ARCHIVES_VERSION || !readU32(in, count))
+	{
+		LOG(LogWarning) << "Archive cache \"" << path << "\" is from an incompatible version, ignoring it";
+		return;
+	}
+
+	bool ok = true;
+	for(uint32_t i = 0; i < count && ok; i++)
+	{
+		uint32_t len, entries;
+		std::string file;
+		Entry entry;
+		uint64_t mtime;
+		ok = readU32(in, len) && len <= 64 * 1024;
+		if(ok)
+		{
+			file.resize(len);
+			ok = (!len || in.read(&file[0], len)) && readU64(in, entry.size) && readU64(in, mtime) && readU32(in, entries);
+		}
+		if(!ok)
+			break;
+
+		entry.mtime = (int64_t)mtime;
+		if(entries != UNREADABLE)
+		{
+			if(entries > ZIP_MAX_DIRECTORY / ZIP_CD_HEADER_SIZE)
+			{
+				ok = false;
+				break;
+			}
+
+			std::shared_ptr<ArchiveContents> contents = std::make_shared<ArchiveContents>();
+			contents->resize(entries);
+			for(auto it = contents->begin(); it != contents->end() && ok; it++)
+			{
+				ok = readU32(in, len) && len <= 64 * 1024;
+				if(ok)
+				{
+					it->name.resize(len);
+					ok = (!len || in.read(&it->name[0], len)) && readU64(in, it->size) && readU32(in, it->crc32);
+				}
+			}
+			entry.contents = contents;
+		}
+
+		if(ok)
+			mCache[file] = entry;
+	}
+
+	if(!ok)
+		LOG(LogWarning) << "Archive cache \"" << path << "\" is truncated";
+
+	LOG(LogInfo) << "Loaded the contents of " << mCache.size() << " archives";
+}
+
+void ArchiveIndex::save()
+{
+	// serialized under the lock, written without it
+	std::ostringstream out(std::ios::out | std::ios::binary);
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		if(!mDirty)
+			return;
+		mDirty = false;
+
+		out.write(ARCHIVES_MAGIC, 4);
+		writeU32(out, ARCHIVES_VERSION);
+		writeU32(out, mCache.size());
+		for(auto it = mCache.begin(); it != mCache.end(); it++)
+		{
+			writeU32(out, it->first.length());
+			out.write(it->first.data(), it->first.length());
+			writeU64(out, it->second.size);
+			writeU64(out, (uint64_t)it->second.mtime);
+
+			const ArchiveContents* contents = it->second.contents.get();
+			writeU32(out, contents ? contents->size() : UNREADABLE);
+			if(!contents)
+				continue;
+
+			for(auto entry = contents->begin(); entry != contents->end(); entry++)
+			{
+				writeU32(out, entry->name.length());
+				out.write(entry->name.data(), entry->name.length());
+				writeU64(out, entry->size);
+				writeU32(out, entry->crc32);
+			}
+		}
+	}
+
+	// write and rename, so a crash never leaves half a cache behind
+	const std::string path = getCachePath();
+	const std::string tmpPath = path + ".tmp";
+	{
+		std::ofstream file(tmpPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		const std::string data = out.str();
+		if(!file.write(data.data(), data.size()))
+		{
+			LOG(LogError) << "Could not write archive cache \"" << tmpPath << "\"";
+			return;
+		}
+	}
+
+	boost::system::error_code ec;
+	fs::rename(tmpPath, path, ec);
+	if(ec)
+		LOG(LogError) << "Could not replace archive cache \"" << path << "\": " << ec.message();
+}
+
+std::shared_ptr<const ArchiveContents> ArchiveIndex::getContents(const fs::path& path)
+{
+	if(!isArchive(path))
+		return NULL;
+
+	boost::system::error_code ec;
+	const uint64_t size = fs::file_size(path, ec);
+	if(ec)
+		return NULL;
+	const int64_t mtime = fs::last_write_time(path, ec);
+	if(ec)
+		return NULL;
+
+	const std::string key = path.generic_string();
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		loadCache();
+
+		auto it = mCache.find(key);
+		if(it != mCache.end() && it->second.size == size && it->second.mtime == mtime)
+			return it->second.contents;
+	}
+
+	// read without the lock, two threads reading the same archive at once just do it twice
+	Entry entry;
+	entry.size = size;
+	entry.mtime = mtime;
+
+	std::shared_ptr<ArchiveContents> contents = std::make_shared<ArchiveContents>();
+	if(readZipDirectory(path, *contents))
+		entry.contents = contents;
+	else
+		LOG(LogWarning) << "Could not read the directory of \"" << key << "\"";
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	mCache[key] = entry;
+	mDirty = true;
+	return entry.contents;
+}
+
+bool ArchiveIndex::readZipDirectory(const fs::path& path, ArchiveContents& out)
+{
+	out.clear();
+
+	fs::ifstream file(path, std::ios::in | std::ios::binary);
+	if(!file.is_open())
+		return false;
+
+	file.seekg(0, std::ios::end);
+	const uint64_t fileSize = (uint64_t)file.tellg();
+	if(fileSize < ZIP_EOCD_SIZE)
+		return false;
+
+	// the end of central directory record is the last thing in the file, before a comment of up to 64KB
+	const size_t tailSize = (size_t)std::min<uint64_t>(fileSize, ZIP_EOCD_SIZE + ZIP_MAX_COMMENT);
+	std::vector<unsigned char> tail(tailSize);
+	file.seekg(fileSize - tailSize);
+	if(!file.read((char*)tail.data(), tailSize))
+		return false;
+
+	int eocd = -1;
+	for(int i = (int)tailSize - ZIP_EOCD_SIZE; i >= 0; i--)
+	{
+		if(getLE32(&tail[i]) == 0x06054b50)
+		{
+			eocd = i;
+			break;
+		}
+	}
+	if(eocd < 0)
+		return false;
+
+	uint64_t entryCount = getLE16(&tail[eocd + 10]);
+	uint64_t dirSize = getLE32(&tail[eocd + 12]);
+	uint64_t dirOffset = getLE32(&tail[eocd + 16]);
+
+	// zip64: the real numbers are in another record, found through a locator just before this one
+	if(entryCount == 0xFFFF || dirSize == 0xFFFFFFFF || dirOffset == 0xFFFFFFFF)
+	{
+		if(eocd < 20 || getLE32(&tail[eocd - 20]) != 0x07064b50)
+			return false;
+
+		const uint64_t recordOffset = getLE64(&tail[eocd - 20 + 8]);
+		unsigned char record[56];
+		file.seekg(recordOffset);
+		if(recordOffset + sizeof(record) > fileSize || !file.read((char*)record, sizeof(record)) || getLE32(record) != 0x06064b50)
+			return false;
+
+		entryCount = getLE64(&record[32]);
+		dirSize = getLE64(&record[40]);
+		dirOffset = getLE64(&record[48]);
+	}
+
+	if(dirSize > ZIP_MAX_DIRECTORY || dirOffset + dirSize > fileSize || entryCount > dirSize / ZIP_CD_HEADER_SIZE)
+		return false;
+
+	std::vector<unsigned char> dir((size_t)dirSize);
+	file.seekg(dirOffset);
+	if(dirSize && !file.read((char*)dir.data(), dir.size()))
+		return false;
+
+	out.reserve((size_t)entryCount);
+	size_t pos = 0;
+	for(uint64_t i = 0; i < entryCount; i++)
+	{
+		if(pos + ZIP_CD_HEADER_SIZE > dir.size() || getLE32(&dir[pos]) != 0x02014b50)
+			return false;
+
+		const unsigned char* header = &dir[pos];
+		const uint32_t crc = getLE32(header + 16);
+		uint64_t size = getLE32(header + 24);
+		const uint16_t nameLen = getLE16(header + 28);
+		const uint16_t extraLen = getLE16(header + 30);
+		const uint16_t commentLen = getLE16(header + 32);
+
+		const size_t nameStart = pos + ZIP_CD_HEADER_SIZE;
+		const size_t extraStart = nameStart + nameLen;
+		pos = extraStart + extraLen + commentLen;
+		if(pos > dir.size())
+			return false;
+
+		// a zip64 extra field has the real size, it comes first when the header's doesn't fit
+		if(size == 0xFFFFFFFF)
+		{
+			for(size_t e = extraStart; e + 4 <= extraStart + extraLen; )
+			{
+				const uint16_t id = getLE16(&dir[e]);
+				const uint16_t len = getLE16(&dir[e + 2]);
+				if(id == 0x0001 && len >= 8 && e + 4 + 8 <= extraStart + extraLen)
+				{
+					size = getLE64(&dir[e + 4]);
+					break;
+				}
+				e += 4 + len;
+			}
+		}
+
+		std::string name((const char*)&dir[nameStart], nameLen);
+		std::replace(name.begin(), name.end(), '\\', '/');
+		if(name.empty() || name[name.length() - 1] == '/')
+			continue; // a folder
+
+		ArchiveEntry entry;
+		entry.name = name;
+		entry.size = size;
+		entry.crc32 = crc;
+		out.push_back(entry);
+	}
+
+	return true;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <stdint.h>
+#include <boost/filesystem.hpp>
+
+struct ArchiveEntry
+{
+	std::string name; // path inside the archive, '/' separated
+	uint64_t size; // uncompressed
+	uint32_t crc32; // of the uncompressed data, straight from the archive's directory
+};
+
+typedef std::vector<ArchiveEntry> ArchiveContents;
+
+// What's inside .zip archives (names, sizes and CRCs), read from the central directory without decompressing anything.
+// Each archive's directory is read once and kept in ~/.emulationstation/cache/archives.cache by path, size and mtime,
+// so it's only read again if the archive changed.
+class ArchiveIndex
+{
+public:
+	static ArchiveIndex* getInstance();
+
+	// By extension, whether getContents() can look inside it.
+	static bool isArchive(const boost::filesystem::path& path);
+
+	// NULL if it isn't an archive or couldn't be read. Costs a stat if the archive is cached, otherwise reads its
+	// directory (a few small reads at the end of the file). Any thread.
+	std::shared_ptr<const ArchiveContents> getContents(const boost::filesystem::path& path);
+
+	// Writes the cache if anything was added, call before exiting.
+	void save();
+
+	// Reads the central directory of a zip (zip64 too), false if it isn't one or it's damaged.
+	static bool readZipDirectory(const boost::filesystem::path& path, ArchiveContents& out);
+
+private:
+	ArchiveIndex();
+	~ArchiveIndex();
+
+	struct Entry
+	{
+		uint64_t size;
+		int64_t mtime;
+		std::shared_ptr<const ArchiveContents> contents; // NULL if it couldn't be read, that's remembered until it changes
+	};
+
+	static std::string getCachePath();
+	void loadCache();
+
+	std::mutex mMutex;
+	std::unordered_map<std::string, Entry> mCache; // by generic path
+	bool mDirty;
+	bool mCacheLoaded;
+};
@@ -1,8 +1,24 @@
 #include "FileData.h"
 #include "SystemData.h"
+#include "MemoryStats.h"
+#include "Util.h"
+#include <boost/locale.hpp>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <string.h>
 
 namespace fs = boost::filesystem;
 
+// a slot in mChildren plus a node and bucket in mChildrenByFilename (the key is the child's interned name)
+static const size_t CHILD_ENTRY_SIZE = sizeof(FileData*) + sizeof(std::pair<const FileNameKey, FileData*>) + 2 * sizeof(void*);
+
+// how many orders each folder remembers, there are only a handful of sort types
+#define SORT_CACHE_SIZE 4
+
+// below this many children in folders waiting to be sorted, starting threads costs more than it saves
+#define PARALLEL_SORT_MIN_CHILDREN 5000
+
 std::string removeParenthesis(const std::string& str)
 {
 	// remove anything in parenthesis or brackets
@@ -44,11 +60,17 @@ std::string removeParenthesis(const std::string& str)
 
 
 FileData::FileData(FileType type, const fs::path& path, SystemData* system)
-	: mType(type), mPath(path), mSystem(system), mParent(NULL), metadata(type == GAME ? GAME_METADATA : FOLDER_METADATA) // metadata is REALLY set in the constructor!
+	: mType(type), mDetachedPath(new fs::path(path)), mSystem(system), mParent(NULL), mRemovedChildren(0), mChildrenVersion(0), mIndexInParent(0), mGameCount(0), mLetterIndexDirty(true), mSortPending(false), mSortNameSource(NULL), mCleanNames(NULL), 
+	metadata(type == GAME ? GAME_METADATA : FOLDER_METADATA, system ? system->getMetaDataPool() : MetaDataStringPool::getDefault()) // metadata is REALLY set in the constructor!
 {
-	// metadata needs at least a name field (since that's what getName() will return)
-	if(metadata.get("name").empty())
-		metadata.set("name", getDisplayName());
+	mSortKey.comparator = NULL;
+	mSortKey.ascending = true;
+
+	mName = (system ? system->getMetaDataPool() : MetaDataStringPool::getDefault())->intern(path.filename().string());
+
+	// the name is filled in by getName() when it's first needed, most files get theirs from the gamelist anyway
+	// (the detached path is only counted for as long as there's no parent, see addChild())
+	MemoryStats::add(MemoryStats::FILE_DATA, sizeof(FileData));
 }
 
 FileData::~FileData()
@@ -56,48 +78,155 @@ FileData::~FileData()
 	if(mParent)
 		mParent->removeChild(this);
 
-		mChildren.clear();
+	clearSortCache();
+
+	ptrdiff_t bytes = sizeof(FileData) + mChildrenByFilename.size() * CHILD_ENTRY_SIZE;
+	if(mCleanNames)
+		bytes += sizeof(CleanNames) + mCleanNames->clean.capacity() + mCleanNames->normalized.capacity();
+	MemoryStats::add(MemoryStats::FILE_DATA, -bytes);
+
+	delete mCleanNames;
+	delete mDetachedPath;
+	mChildren.clear();
+}
+
+fs::path FileData::getPath() const
+{
+	if(!mParent)
+		return *mDetachedPath;
+
+	// measure first, so the string is only allocated once
+	const FileData* root = this;
+	size_t length = 0;
+	for(; root->mParent; root = root->mParent)
+		length += root->mName->size() + 1;
+
+	std::string path = root->mDetachedPath->generic_string();
+	if(!path.empty() && path[path.size() - 1] == '/')
+		path.erase(path.size() - 1);
+	const size_t rootLength = path.size();
+	path.resize(rootLength + length);
+
+	// and then fill it in from the end
+	size_t pos = path.size();
+	for(const FileData* node = this; node != root; node = node->mParent)
+	{
+		pos -= node->mName->size();
+		memcpy(&path[pos], node->mName->data(), node->mName->size());
+		path[--pos] = '/';
+	}
+
+	return path;
+}
+
+FileData* FileData::findChild(const std::string& fileName) const
+{
+	auto it = mChildrenByFilename.find(FileNameKey(fileName));
+	return it != mChildrenByFilename.end() ? it->second : NULL;
+}
+
+const std::string& FileData::getName() const
+{
+	const std::string& name = metadata.get(MetaDataIds::NAME);
+	if(!name.empty())
+		return name;
+
+	// metadata needs at least a name field, fall back to the default one
+	// the default name is never saved, so it doesn't count as a change
+	MetaDataList& md = const_cast<MetaDataList&>(metadata);
+	bool wasChanged = md.wasChanged();
+	md.set(MetaDataIds::NAME, getDisplayName());
+	if(!wasChanged)
+		md.resetChangedFlag();
+
+	return md.get(MetaDataIds::NAME);
 }
 
 std::string FileData::getDisplayName() const
 {
-	std::string stem = mPath.stem().generic_string();
+	std::string stem = fs::path(*mName).stem().generic_string();
 	if(mSystem && mSystem->hasPlatformId(PlatformIds::ARCADE) || mSystem->hasPlatformId(PlatformIds::NEOGEO))
 		stem = PlatformIds::getCleanMameName(stem.c_str());
 
 	return stem;
 }
 
-std::string FileData::getCleanName() const
+const FileData::CleanNames& FileData::getCleanNames() const
 {
-	return removeParenthesis(this->getDisplayName());
+	if(!mCleanNames)
+	{
+		mCleanNames = new CleanNames();
+		mCleanNames->source = NULL;
+		MemoryStats::add(MemoryStats::FILE_DATA, sizeof(CleanNames));
+	}
+
+	// the display name comes from the file name (which is interned, so a new address means a rename)
+	if(mCleanNames->source != mName)
+	{
+		const ptrdiff_t oldBytes = mCleanNames->clean.capacity() + mCleanNames->normalized.capacity();
+		mCleanNames->clean = removeParenthesis(getDisplayName());
+		mCleanNames->normalized = normalizeGameName(mCleanNames->clean);
+		mCleanNames->source = mName;
+		MemoryStats::add(MemoryStats::FILE_DATA, (ptrdiff_t)(mCleanNames->clean.capacity() + mCleanNames->normalized.capacity()) - oldBytes);
+	}
+
+	return *mCleanNames;
 }
 
-const std::string& FileData::getThumbnailPath() const
+const std::string& FileData::getCleanName() const
 {
-	if(!metadata.get("thumbnail").empty())
-		return metadata.get("thumbnail");
-	else
-		return metadata.get("image");
+	return getCleanNames().clean;
 }
 
-
-std::vector<FileData*> FileData::getFilesRecursive(unsigned int typeMask) const
+const std::string& FileData::getNormalizedName() const
 {
-	std::vector<FileData*> out;
+	return getCleanNames().normalized;
+}
 
-	for(auto it = mChildren.begin(); it != mChildren.end(); it++)
+const std::string& FileData::getSortName() const
+{
+	const std::string& name = getName();
+	if(mSortNameSource != &name)
 	{
-		if((*it)->getType() & typeMask)
-			out.push_back(*it);
-		
-		if((*it)->getChildren().size() > 0)
+		// upper case rather than lower case so punctuation sorts where it always has relative to letters
+		try
 		{
-			std::vector<FileData*> subchildren = (*it)->getFilesRecursive(typeMask);
-			out.insert(out.end(), subchildren.cbegin(), subchildren.cend());
+			mSortName = boost::locale::to_upper(name);
+		}catch(std::exception&)
+		{
+			// the global locale has no boost::locale facets, fall back to ASCII
+			mSortName = name;
+			for(unsigned int i = 0; i < mSortName.size(); i++)
+				mSortName[i] = toupper(mSortName[i]);
 		}
+
+		mSortNameSource = &name;
 	}
 
+	return mSortName;
+}
+
+const std::string& FileData::getThumbnailPath() const
+{
+	if(!metadata.get(MetaDataIds::THUMBNAIL).empty())
+		return metadata.get(MetaDataIds::THUMBNAIL);
+	else
+		return metadata.get(MetaDataIds::IMAGE);
+}
+
+std::shared_ptr<const ArchiveContents> FileData::getArchiveContents() const
+{
+	if(mType != GAME)
+		return NULL;
+
+	return ArchiveIndex::getInstance()->getContents(getPath());
+}
+
+
+std::vector<FileData*> FileData::getFilesRecursive(unsigned int typeMask) const
+{
+	std::vector<FileData*> out;
+	visitRecursive(typeMask, [&out](FileData* file) { out.push_back(file); return true; });
 	return out;
 }
 
@@ -106,12 +235,29 @@ void FileData::addChild(FileData* file)
 	assert(mType == FOLDER);
 	assert(file->getParent() == NULL);
 
-	const std::string key = file->getPath().filename().string();
-	if (mChildrenByFilename.find(key) == mChildrenByFilename.end())
+	auto entry = mChildrenByFilename.insert(std::make_pair(FileNameKey(*file->mName), file));
+	if(entry.second)
 	{
-		mChildrenByFilename[key] = file;
+		// from now on the path comes from ours
+		delete file->mDetachedPath;
+		file->mDetachedPath = NULL;
+
+		file->mIndexInParent = mChildren.size();
 		mChildren.push_back(file);
+		mChildrenVersion++;
 		file->mParent = this;
+
+		addToGameCount((file->getType() == GAME ? 1 : 0) + file->mGameCount);
+		mLetterIndexDirty = true;
+
+		// goes where the current order puts it, and every remembered order is missing it
+		clearSortCache();
+		if(mSortKey.comparator)
+		{
+			mSortPending = true;
+			file->setSortKey(mSortKey);
+		}
+		MemoryStats::add(MemoryStats::FILE_DATA, CHILD_ENTRY_SIZE);
 	}
 }
 
@@ -119,36 +265,300 @@ void FileData::removeChild(FileData* file)
 {
 	assert(mType == FOLDER);
 	assert(file->getParent() == this);
-	mChildrenByFilename.erase(file->getPath().filename().string());
-	for(auto it = mChildren.begin(); it != mChildren.end(); it++)
+	assert(file->mIndexInParent < mChildren.size() && mChildren[file->mIndexInParent] == file);
+
+	auto entry = mChildrenByFilename.find(FileNameKey(*file->mName));
+	if(entry != mChildrenByFilename.end())
+	{
+		MemoryStats::add(MemoryStats::FILE_DATA, -(ptrdiff_t)CHILD_ENTRY_SIZE);
+		mChildrenByFilename.erase(entry);
+	}
+	file->mDetachedPath = new fs::path(file->getPath());
+	mChildren[file->mIndexInParent] = NULL;
+	mRemovedChildren++;
+	mChildrenVersion++;
+	mLetterIndexDirty = true;
+	clearSortCache();
+	file->mParent = NULL;
+
+	addToGameCount(-(int)((file->getType() == GAME ? 1 : 0) + file->mGameCount));
+}
+
+void FileData::addToGameCount(int delta)
+{
+	for(FileData* node = this; node != NULL; node = node->mParent)
+		node->mGameCount += delta;
+}
+
+void FileData::compactChildren() const
+{
+	unsigned int count = 0;
+	for(unsigned int i = 0; i < mChildren.size(); i++)
 	{
-		if(*it == file)
+		if(mChildren[i] != NULL)
 		{
-			mChildren.erase(it);
-			return;
+			mChildren[i]->mIndexInParent = count;
+			mChildren[count++] = mChildren[i];
 		}
 	}
 
-	// File somehow wasn't in our children.
-	assert(false);
+	mChildren.resize(count);
+	mRemovedChildren = 0;
+	mChildrenVersion++;
+}
 
+void FileData::prepareChildren() const
+{
+	if(mRemovedChildren)
+		compactChildren();
+
+	if(mSortPending)
+		applySort();
 }
 
-void FileData::sort(ComparisonFunction& comparator, bool ascending)
+void FileData::setSortKey(const SortKey& key)
 {
-	std::sort(mChildren.begin(), mChildren.end(), comparator);
+	if(mType != FOLDER)
+		return;
 
+	if(!(mSortKey == key))
+	{
+		mSortKey = key;
+		mSortPending = true;
+	}
+
+	// just marks them, the actual sorting waits until they're looked at
 	for(auto it = mChildren.begin(); it != mChildren.end(); it++)
 	{
-		if((*it)->getChildren().size() > 0)
-			(*it)->sort(comparator, ascending);
+		if(*it != NULL && (*it)->mType == FOLDER)
+			(*it)->setSortKey(key);
+	}
+}
+
+void FileData::applySort() const
+{
+	mSortPending = false;
+	if(mSortKey.comparator == NULL)
+		return;
+
+	auto cached = mSortCache.begin();
+	while(cached != mSortCache.end() && !(cached->first == mSortKey))
+		cached++;
+
+	if(cached != mSortCache.end())
+	{
+		mChildren = cached->second;
+		std::rotate(mSortCache.begin(), cached, cached + 1);
+	}else{
+		// the ROM cache keeps listings in the order the last run showed them, so after loading this is usually one pass
+		// instead of a sort
+		if(mSortKey.ascending)
+		{
+			if(!std::is_sorted(mChildren.begin(), mChildren.end(), mSortKey.comparator))
+				std::sort(mChildren.begin(), mChildren.end(), mSortKey.comparator);
+		}else{
+			ComparisonFunction* comparator = mSortKey.comparator;
+			auto descending = [comparator](const FileData* a, const FileData* b) { return comparator(b, a); };
+			if(!std::is_sorted(mChildren.begin(), mChildren.end(), descending))
+				std::sort(mChildren.begin(), mChildren.end(), descending);
+		}
+
+		if(mSortCache.size() >= SORT_CACHE_SIZE)
+		{
+			MemoryStats::add(MemoryStats::FILE_DATA, -(ptrdiff_t)(mSortCache.back().second.capacity() * sizeof(FileData*)));
+			mSortCache.pop_back();
+		}
+		mSortCache.insert(mSortCache.begin(), std::make_pair(mSortKey, mChildren));
+		MemoryStats::add(MemoryStats::FILE_DATA, mSortCache.front().second.capacity() * sizeof(FileData*));
+	}
+
+	for(unsigned int i = 0; i < mChildren.size(); i++)
+		mChildren[i]->mIndexInParent = i;
+
+	mChildrenVersion++;
+	mLetterIndexDirty = true;
+}
+
+void FileData::clearSortCache() const
+{
+	ptrdiff_t bytes = 0;
+	for(auto it = mSortCache.begin(); it != mSortCache.end(); it++)
+		bytes += it->second.capacity() * sizeof(FileData*);
+	MemoryStats::add(MemoryStats::FILE_DATA, -bytes);
+
+	mSortCache.clear();
+}
+
+void FileData::invalidateSort()
+{
+	clearSortCache();
+	if(mSortKey.comparator)
+		mSortPending = true;
+}
+
+void FileData::moveToPool(const std::shared_ptr<MetaDataStringPool>& pool)
+{
+	metadata.moveToPool(pool);
+	mName = pool->intern(*mName);
+
+	// the cached names only check the address they came from, which the old pool could hand out again
+	mSortNameSource = NULL;
+	if(mCleanNames)
+		mCleanNames->source = NULL;
+
+	if(mChildrenByFilename.empty())
+		return;
+
+	// the keys point at the children's names, so they're rebuilt
+	FileNameMap byName;
+	byName.reserve(mChildrenByFilename.size());
+	for(auto it = mChildrenByFilename.begin(); it != mChildrenByFilename.end(); it++)
+	{
+		it->second->moveToPool(pool);
+		byName.insert(std::make_pair(FileNameKey(*it->second->mName), it->second));
+	}
+	mChildrenByFilename.swap(byName);
+}
+
+void FileData::sortPending(unsigned int threadCount)
+{
+	// find the folders, and fill in every sort name on this thread - getName() can put a default name in the system's shared pool
+	std::vector<FileData*> folders;
+	std::vector<FileData*> stack(1, this);
+	size_t childCount = 0;
+	while(!stack.empty())
+	{
+		FileData* folder = stack.back();
+		stack.pop_back();
+
+		if(folder->mRemovedChildren)
+			folder->compactChildren();
+
+		for(auto it = folder->mChildren.begin(); it != folder->mChildren.end(); it++)
+		{
+			(*it)->getSortName();
+			if((*it)->mType == FOLDER)
+				stack.push_back(*it);
+		}
+
+		if(folder->mSortPending)
+		{
+			folders.push_back(folder);
+			childCount += folder->mChildren.size();
+		}
+	}
+
+	if(threadCount > folders.size())
+		threadCount = folders.size();
+
+	if(threadCount <= 1 || childCount < PARALLEL_SORT_MIN_CHILDREN)
+	{
+		for(auto it = folders.begin(); it != folders.end(); it++)
+			(*it)->applySort();
+		return;
 	}
 
-	if(!ascending)
-		std::reverse(mChildren.begin(), mChildren.end());
+	// every folder only touches its own children, so they can be sorted in any order on any thread; biggest first so one doesn't hold up the end
+	std::sort(folders.begin(), folders.end(), [](const FileData* a, const FileData* b) { return a->mChildren.size() > b->mChildren.size(); });
+
+	std::atomic<unsigned int> next(0);
+	auto worker = [&] {
+		unsigned int i;
+		while((i = next++) < folders.size())
+			folders[i]->applySort();
+	};
+
+	std::vector<std::thread> threads;
+	for(unsigned int i = 1; i < threadCount; i++)
+		threads.push_back(std::thread(worker));
+	worker();
+	for(auto it = threads.begin(); it != threads.end(); it++)
+		it->join();
+}
+
+void FileData::sort(ComparisonFunction& comparator, bool ascending)
+{
+	SortKey key = { &comparator, ascending };
+	setSortKey(key);
+
+	// this is the folder that's about to be shown
+	prepareChildren();
 }
 
 void FileData::sort(const SortType& type)
 {
 	sort(*type.comparisonFunction, type.ascending);
 }
+
+// bytes in the first UTF-8 character of a non-empty string, anything that isn't valid UTF-8 counts as one byte
+static size_t getInitialLength(const std::string& str)
+{
+	const unsigned char c = str[0];
+	size_t length = 1;
+	if((c & 0xE0) == 0xC0)
+		length = 2;
+	else if((c & 0xF0) == 0xE0)
+		length = 3;
+	else if((c & 0xF8) == 0xF0)
+		length = 4;
+
+	return length <= str.size() ? length : 1;
+}
+
+std::string FileData::getInitial(const std::string& sortName)
+{
+	if(sortName.empty())
+		return sortName;
+
+	return sortName.substr(0, getInitialLength(sortName));
+}
+
+void FileData::buildLetterIndex() const
+{
+	mLetterIndex.clear();
+
+	const std::vector<FileData*>& children = getChildren();
+	for(unsigned int i = 0; i < children.size(); i++)
+	{
+		const std::string& name = children[i]->getSortName();
+		if(name.empty())
+			continue;
+
+		// sorted by name, the initial is the same as the previous child's most of the time
+		const size_t length = getInitialLength(name);
+		if(!mLetterIndex.empty() && mLetterIndex.back().letter.compare(0, std::string::npos, name, 0, length) == 0)
+			continue;
+
+		bool found = false;
+		for(auto it = mLetterIndex.begin(); it != mLetterIndex.end() && !found; it++)
+			found = (it->letter.compare(0, std::string::npos, name, 0, length) == 0);
+
+		if(!found)
+		{
+			LetterIndexEntry entry = { name.substr(0, length), i };
+			mLetterIndex.push_back(entry);
+		}
+	}
+
+	mLetterIndexDirty = false;
+}
+
+const std::vector<FileData::LetterIndexEntry>& FileData::getLetterIndex() const
+{
+	if(mLetterIndexDirty)
+		buildLetterIndex();
+
+	return mLetterIndex;
+}
+
+FileData* FileData::getFirstWithInitial(const std::string& letter) const
+{
+	const std::vector<LetterIndexEntry>& index = getLetterIndex();
+	for(auto it = index.begin(); it != index.end(); it++)
+	{
+		if(it->letter == letter)
+			return getChildren().at(it->position);
+	}
+
+	return NULL;
+}
@@ -5,8 +5,10 @@
 #include <vector>
 #include <boost/filesystem.hpp>
 #include "MetaData.h"
+#include "ArchiveIndex.h"
 
 class SystemData;
+class FileData;
 
 enum FileType
 {
@@ -29,25 +31,73 @@ FileType stringToFileType(const char* str);
 // Remove (.*) and [.*] from str
 std::string removeParenthesis(const std::string& str);
 
+// Key of a folder's children by filename. It points at the child's interned name instead of holding a copy.
+struct FileNameKey
+{
+	explicit FileNameKey(const std::string& str) : name(&str) {}
+	inline bool operator==(const FileNameKey& other) const { return *name == *other.name; }
+
+	const std::string* name;
+};
+
+struct FileNameKeyHash
+{
+	inline size_t operator()(const FileNameKey& key) const { return std::hash<std::string>()(*key.name); }
+};
+
+typedef std::unordered_map<FileNameKey, FileData*, FileNameKeyHash> FileNameMap;
+
 // A tree node that holds information for a file.
+// Only its own filename is stored (interned in the system's pool), the full path is put together from the parents'.
 class FileData
 {
 public:
+	// Nodes belonging to a system should come from SystemData::createFileData() and go back through deleteFileData().
 	FileData(FileType type, const boost::filesystem::path& path, SystemData* system);
 	virtual ~FileData();
 
-	inline const std::string& getName() const { return metadata.get("name"); }
+	// If no name was set (e.g. no gamelist entry), this fills in getDisplayName() the first time it's called.
+	const std::string& getName() const;
 	inline FileType getType() const { return mType; }
-	inline const boost::filesystem::path& getPath() const { return mPath; }
+	boost::filesystem::path getPath() const; // built on every call, hold on to it rather than calling it in a loop
+	inline const std::string& getFileName() const { return *mName; }
 	inline FileData* getParent() const { return mParent; }
-	inline const std::unordered_map<std::string, FileData*>& getChildrenByFilename() const { return mChildrenByFilename; }
-	inline const std::vector<FileData*>& getChildren() const { return mChildren; }
+	inline const FileNameMap& getChildrenByFilename() const { return mChildrenByFilename; }
+	FileData* findChild(const std::string& fileName) const; // NULL if there's no child by that name
+	inline const std::vector<FileData*>& getChildren() const { if(mRemovedChildren || mSortPending) prepareChildren(); return mChildren; }
 	inline SystemData* getSystem() const { return mSystem; }
+
+	// Changes whenever the children, or their order, change (for things that keep positions in getChildren()).
+	inline unsigned int getChildrenVersion() const { return mChildrenVersion; }
+
+	// Number of games anywhere below this node, kept up to date as children are added and removed.
+	inline unsigned int getGameCount() const { return mGameCount; }
 	
 	virtual const std::string& getThumbnailPath() const;
 
+	// What's inside if this is a game in an archive ArchiveIndex can read (see there), NULL otherwise.
+	std::shared_ptr<const ArchiveContents> getArchiveContents() const;
+
 	std::vector<FileData*> getFilesRecursive(unsigned int typeMask) const;
 
+	// Calls visitor(FileData*) for every descendant whose type is in typeMask, depth-first in child order, without
+	// building a list first. The visitor returns false to stop early (then so does this). Don't add/remove children from it.
+	template<typename Visitor>
+	bool visitRecursive(unsigned int typeMask, Visitor&& visitor) const
+	{
+		const std::vector<FileData*>& children = getChildren();
+		for(auto it = children.begin(); it != children.end(); it++)
+		{
+			if(((*it)->getType() & typeMask) && !visitor(*it))
+				return false;
+
+			if(!(*it)->mChildren.empty() && !(*it)->visitRecursive(typeMask, visitor))
+				return false;
+		}
+
+		return true;
+	}
+
 	void addChild(FileData* file); // Error if mType != FOLDER
 	void removeChild(FileData* file); //Error if mType != FOLDER
 
@@ -55,7 +105,16 @@ public:
 	std::string getDisplayName() const;
 
 	// As above, but also remove parenthesis
-	std::string getCleanName() const;
+	// Worked out on first use and kept until the file is renamed, since the scrapers ask for it over and over.
+	const std::string& getCleanName() const;
+
+	// normalizeGameName() of the clean name (lower case letters and digits only), what the scrapers match titles on.
+	// Cached with getCleanName().
+	const std::string& getNormalizedName() const;
+
+	// Case-folded copy of getName() for sorting (so comparing two names is a plain byte compare).
+	// Recomputed on demand whenever the name changes.
+	const std::string& getSortName() const;
 
 	typedef bool ComparisonFunction(const FileData* a, const FileData* b);
 	struct SortType
@@ -68,16 +127,106 @@ public:
 			: comparisonFunction(sortFunction), ascending(sortAscending), description(sortDescription) {}
 	};
 
+	typedef bool FilterFunction(const FileData* file);
+	struct FilterType
+	{
+		FilterFunction* filterFunction; // NULL lets everything through
+		std::string description;
+
+		FilterType(FilterFunction* function, const std::string& filterDescription) : filterFunction(function), description(filterDescription) {}
+	};
+
+	// Sorts this folder and everything below it, into the order it's loaded in (by name). Views that show another order
+	// do it through a FileProjection instead of reordering the tree.
+	// Only this folder is sorted right away, folders below it are sorted the next time their children are looked at.
+	// Each folder remembers its last few orders, so going back to one is a copy.
 	void sort(ComparisonFunction& comparator, bool ascending = true);
 	void sort(const SortType& type);
 
+	// Sorts every folder below that's still waiting to be sorted, spread over up to threadCount threads if there's enough of them.
+	// For right after loading, so nothing is left to sort when a folder is opened. Nothing else may touch the tree meanwhile.
+	void sortPending(unsigned int threadCount);
+
+	// For when a child's metadata changed: forgets the remembered orders and re-sorts the next time the children are looked at.
+	void invalidateSort();
+
+	// Moves the name and metadata of this node and everything below it into pool (see SystemData::compactMetaDataPool()).
+	void moveToPool(const std::shared_ptr<MetaDataStringPool>& pool);
+
+	// The first character of a sort name (upper case UTF-8), empty if the name is.
+	static std::string getInitial(const std::string& sortName);
+
+	// Every initial among the children, in list order, with the position of the first child that has it.
+	// Rebuilt by sort(), or when it's next asked for after children were added or removed.
+	struct LetterIndexEntry
+	{
+		std::string letter;
+		unsigned int position;
+	};
+	const std::vector<LetterIndexEntry>& getLetterIndex() const;
+
+	// First child whose sort name starts with letter, NULL if there isn't one.
+	FileData* getFirstWithInitial(const std::string& letter) const;
+
 	MetaDataList metadata;
 
 private:
+	friend class FileDataArena;
+
 	FileType mType;
-	boost::filesystem::path mPath;
+	const std::string* mName; // the filename, interned
+	boost::filesystem::path* mDetachedPath; // the full path while there's no parent (always, for the root), NULL otherwise
 	SystemData* mSystem;
 	FileData* mParent;
-	std::unordered_map<std::string,FileData*> mChildrenByFilename;
-	std::vector<FileData*> mChildren;
+	FileNameMap mChildrenByFilename;
+
+	// removeChild() just clears the child's slot (found through mIndexInParent), the holes are
+	// squeezed out in one pass the next time the children are looked at
+	mutable std::vector<FileData*> mChildren;
+	mutable unsigned int mRemovedChildren;
+	mutable unsigned int mChildrenVersion;
+	unsigned int mIndexInParent;
+
+	unsigned int mGameCount;
+	void addToGameCount(int delta);
+
+	void compactChildren() const;
+	void buildLetterIndex() const;
+
+	struct SortKey
+	{
+		ComparisonFunction* comparator; // NULL if never sorted
+		bool ascending;
+
+		inline bool operator==(const SortKey& other) const { return comparator == other.comparator && ascending == other.ascending; }
+	};
+
+	void setSortKey(const SortKey& key);
+	void prepareChildren() const;
+	void applySort() const;
+	void clearSortCache() const;
+
+	// the order the children should be in, and whether mChildren isn't in it yet
+	SortKey mSortKey;
+	mutable bool mSortPending;
+
+	// last few orders of mChildren, most recently used first; cleared when children are added or removed
+	mutable std::vector< std::pair< SortKey, std::vector<FileData*> > > mSortCache;
+
+	mutable std::vector<LetterIndexEntry> mLetterIndex;
+	mutable bool mLetterIndexDirty;
+
+	// metadata values are interned and never modified in place, so the name's address changing means the name changed
+	mutable const std::string* mSortNameSource;
+	mutable std::string mSortName;
+
+	// most files are never scraped, so the clean names are kept on the side, NULL until asked for
+	struct CleanNames
+	{
+		const std::string* source; // mName they were worked out from
+		std::string clean;
+		std::string normalized;
+	};
+	mutable CleanNames* mCleanNames;
+	const CleanNames& getCleanNames() const;
 };
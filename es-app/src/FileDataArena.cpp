@@ -0,0 +1,76 @@
+#include "FileDataArena.h"
+#include <new>
+
+FileDataArena::FileDataArena() : mUsedInLastBlock(BLOCK_SIZE), mLiveCount(0)
+{
+}
+
+FileDataArena::~FileDataArena()
+{
+	clear();
+}
+
+FileData* FileDataArena::create(FileType type, const boost::filesystem::path& path, SystemData* system)
+{
+	Slot* slot;
+	if(!mFreeSlots.empty())
+	{
+		slot = mFreeSlots.back();
+		mFreeSlots.pop_back();
+	}else{
+		if(mUsedInLastBlock == BLOCK_SIZE)
+		{
+			mBlocks.push_back(new Slot[BLOCK_SIZE]);
+			mUsedInLastBlock = 0;
+		}
+
+		slot = &mBlocks.back()[mUsedInLastBlock++];
+	}
+
+	FileData* file = new (&slot->storage) FileData(type, path, system);
+	slot->alive = true;
+	mLiveCount++;
+	return file;
+}
+
+void FileDataArena::destroy(FileData* file)
+{
+	Slot* slot = reinterpret_cast<Slot*>(file);
+	assert(slot->alive);
+
+	file->~FileData();
+	slot->alive = false;
+	mFreeSlots.push_back(slot);
+	mLiveCount--;
+}
+
+void FileDataArena::clear()
+{
+	// the whole tree is going away, so there's no point in each node removing itself from its parent
+	for(unsigned int i = 0; i < mBlocks.size(); i++)
+	{
+		unsigned int used = (i == mBlocks.size() - 1) ? mUsedInLastBlock : BLOCK_SIZE;
+		for(unsigned int j = 0; j < used; j++)
+		{
+			if(mBlocks[i][j].alive)
+				mBlocks[i][j].get()->mParent = NULL;
+		}
+	}
+
+	for(unsigned int i = 0; i < mBlocks.size(); i++)
+	{
+		unsigned int used = (i == mBlocks.size() - 1) ? mUsedInLastBlock : BLOCK_SIZE;
+		for(unsigned int j = 0; j < used; j++)
+		{
+			if(mBlocks[i][j].alive)
+				mBlocks[i][j].get()->~FileData();
+		}
+
+		delete[] mBlocks[i];
+	}
+
+	mBlocks.clear();
+	mFreeSlots.clear();
+	mUsedInLastBlock = BLOCK_SIZE;
+	mLiveCount = 0;
+}
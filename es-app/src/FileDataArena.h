@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+#include <type_traits>
+#include "FileData.h"
+
+// Allocates the FileData nodes of one system's tree in blocks, so building a tree isn't a heap allocation
+// per node and tearing it down is a few frees instead of one per file.
+// Not thread-safe, but every system owns (and loads) its own.
+class FileDataArena
+{
+public:
+	FileDataArena();
+	~FileDataArena();
+
+	FileData* create(FileType type, const boost::filesystem::path& path, SystemData* system);
+
+	// Removes file from its parent (like deleting it used to) and makes its slot available again.
+	void destroy(FileData* file);
+
+	// Destroys every node in one go, without unlinking them from each other first.
+	void clear();
+
+	inline unsigned int size() const { return mLiveCount; }
+
+private:
+	static const unsigned int BLOCK_SIZE = 512;
+
+	// storage must stay the first member, a FileData* is cast straight back to its Slot*
+	struct Slot
+	{
+		std::aligned_storage<sizeof(FileData), std::alignment_of<FileData>::value>::type storage;
+		bool alive;
+
+		inline FileData* get() { return reinterpret_cast<FileData*>(&storage); }
+	};
+
+	std::vector<Slot*> mBlocks;
+	unsigned int mUsedInLastBlock;
+	std::vector<Slot*> mFreeSlots;
+	unsigned int mLiveCount;
+};
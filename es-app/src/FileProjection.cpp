@@ -0,0 +1,96 @@
+#include "FileProjection.h"
+#include <algorithm>
+
+FileProjection::FileProjection() : mFolder(NULL), mComparator(NULL), mAscending(true), mFilter(NULL), mFolderVersion(0), mDirty(true)
+{
+}
+
+void FileProjection::setFolder(FileData* folder)
+{
+	if(folder != mFolder)
+	{
+		mFolder = folder;
+		mDirty = true;
+	}
+}
+
+void FileProjection::setSort(FileData::ComparisonFunction* comparator, bool ascending)
+{
+	if(comparator != mComparator || ascending != mAscending)
+	{
+		mComparator = comparator;
+		mAscending = ascending;
+		mDirty = true;
+	}
+}
+
+void FileProjection::setFilter(FileData::FilterFunction* filter)
+{
+	if(filter != mFilter)
+	{
+		mFilter = filter;
+		mDirty = true;
+	}
+}
+
+void FileProjection::update()
+{
+	if(mFolder == NULL)
+	{
+		mIndices.clear();
+		return;
+	}
+
+	// first, this may squeeze out removed children or apply a pending sort, which changes the version
+	const std::vector<FileData*>& children = mFolder->getChildren();
+	if(!mDirty && mFolderVersion == mFolder->getChildrenVersion())
+		return;
+
+	mIndices.clear();
+	for(uint32_t i = 0; i < children.size(); i++)
+	{
+		if(mFilter == NULL || children[i]->getType() == FOLDER || mFilter(children[i]))
+			mIndices.push_back(i);
+	}
+
+	if(mComparator != NULL)
+	{
+		FileData::ComparisonFunction* comparator = mComparator;
+		if(mAscending)
+			std::stable_sort(mIndices.begin(), mIndices.end(), [&](uint32_t a, uint32_t b) { return comparator(children[a], children[b]); });
+		else
+			std::stable_sort(mIndices.begin(), mIndices.end(), [&](uint32_t a, uint32_t b) { return comparator(children[b], children[a]); });
+	}
+
+	mFolderVersion = mFolder->getChildrenVersion();
+	mDirty = false;
+}
+
+unsigned int FileProjection::size()
+{
+	update();
+	return mIndices.size();
+}
+
+FileData* FileProjection::at(unsigned int i)
+{
+	update();
+	return mFolder->getChildren().at(mIndices.at(i));
+}
+
+std::vector<FileData*> FileProjection::getFiles()
+{
+	update();
+
+	std::vector<FileData*> files;
+	if(mFolder == NULL)
+		return files;
+
+	files.reserve(mIndices.size());
+
+	const std::vector<FileData*>& children = mFolder->getChildren();
+	for(auto it = mIndices.begin(); it != mIndices.end(); it++)
+		files.push_back(children[*it]);
+
+	return files;
+}
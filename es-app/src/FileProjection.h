@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+#include "FileData.h"
+
+// A filtered and/or sorted look at one folder's children that leaves the folder alone: just indices into its
+// getChildren(), recomputed when the folder's children change (or the folder, sort or filter do).
+// Lets each view show its own order or subset without touching the tree or copying nodes.
+class FileProjection
+{
+public:
+	FileProjection();
+
+	void setFolder(FileData* folder);
+	inline FileData* getFolder() const { return mFolder; }
+
+	// NULL keeps the folder's own order. The sort is stable, so ties stay in the folder's order.
+	void setSort(FileData::ComparisonFunction* comparator, bool ascending = true);
+
+	// NULL lets everything through. Folders always get through, only games are filtered.
+	void setFilter(FileData::FilterFunction* filter);
+	inline FileData::FilterFunction* getFilter() const { return mFilter; }
+
+	// For changes it can't see, like the metadata its sort or filter looks at.
+	inline void invalidate() { mDirty = true; }
+
+	unsigned int size();
+	FileData* at(unsigned int i);
+	std::vector<FileData*> getFiles();
+
+private:
+	void update();
+
+	FileData* mFolder;
+	FileData::ComparisonFunction* mComparator;
+	bool mAscending;
+	FileData::FilterFunction* mFilter;
+
+	std::vector<uint32_t> mIndices;
+	unsigned int mFolderVersion; // of mFolder's children when mIndices was built
+	bool mDirty;
+};
@@ -18,23 +18,20 @@ namespace FileSorts
 
 	const std::vector<FileData::SortType> SortTypes(typesArr, typesArr + sizeof(typesArr)/sizeof(typesArr[0]));
 
+	const FileData::FilterType filtersArr[] = {
+		FileData::FilterType(NULL, "all games"),
+		FileData::FilterType(&isUnplayed, "never played"),
+		FileData::FilterType(&isPlayed, "played"),
+		FileData::FilterType(&isRated, "rated")
+	};
+
+	const std::vector<FileData::FilterType> FilterTypes(filtersArr, filtersArr + sizeof(filtersArr)/sizeof(filtersArr[0]));
+
 	//returns if file1 should come before file2
 	bool compareFileName(const FileData* file1, const FileData* file2)
 	{
-		std::string name1 = file1->getName();
-		std::string name2 = file2->getName();
-
-		//min of name1/name2 .length()s
-		unsigned int count = name1.length() > name2.length() ? name2.length() : name1.length();
-		for(unsigned int i = 0; i < count; i++)
-		{
-			if(toupper(name1[i]) != toupper(name2[i]))
-			{
-				return toupper(name1[i]) < toupper(name2[i]);
-			}
-		}
-
-		return name1.length() < name2.length();
+		// sort names are already case folded, this is a byte-wise compare (shorter first if one is a prefix of the other)
+		return file1->getSortName().compare(file2->getSortName()) < 0;
 	}
 
 	bool compareRating(const FileData* file1, const FileData* file2)
@@ -42,7 +39,7 @@ namespace FileSorts
 		//only games have rating metadata
 		if(file1->metadata.getType() == GAME_METADATA && file2->metadata.getType() == GAME_METADATA)
 		{
-			return file1->metadata.getFloat("rating") < file2->metadata.getFloat("rating");
+			return file1->metadata.getRating() < file2->metadata.getRating();
 		}
 
 		return false;
@@ -53,7 +50,7 @@ namespace FileSorts
 		//only games have playcount metadata
 		if(file1->metadata.getType() == GAME_METADATA && file2->metadata.getType() == GAME_METADATA)
 		{
-			return (file1)->metadata.getInt("playcount") < (file2)->metadata.getInt("playcount");
+			return (file1)->metadata.getPlayCount() < (file2)->metadata.getPlayCount();
 		}
 
 		return false;
@@ -64,9 +61,24 @@ namespace FileSorts
 		//only games have lastplayed metadata
 		if(file1->metadata.getType() == GAME_METADATA && file2->metadata.getType() == GAME_METADATA)
 		{
-			return (file1)->metadata.getTime("lastplayed") < (file2)->metadata.getTime("lastplayed");
+			return (file1)->metadata.getLastPlayed() < (file2)->metadata.getLastPlayed();
 		}
 
 		return false;
 	}
+
+	bool isUnplayed(const FileData* file)
+	{
+		return file->metadata.getType() == GAME_METADATA && file->metadata.getPlayCount() == 0;
+	}
+
+	bool isPlayed(const FileData* file)
+	{
+		return file->metadata.getType() == GAME_METADATA && file->metadata.getPlayCount() > 0;
+	}
+
+	bool isRated(const FileData* file)
+	{
+		return file->metadata.getType() == GAME_METADATA && file->metadata.getRating() > 0;
+	}
 };
@@ -11,4 +11,11 @@ namespace FileSorts
 	bool compareLastPlayed(const FileData* file1, const FileData* file2);
 
 	extern const std::vector<FileData::SortType> SortTypes;
+
+	// filters for FileProjection, true if the game should be shown
+	bool isUnplayed(const FileData* file);
+	bool isPlayed(const FileData* file);
+	bool isRated(const FileData* file);
+
+	extern const std::vector<FileData::FilterType> FilterTypes;
 };
@@ -5,9 +5,31 @@
 #include "Log.h"
 #include "Settings.h"
 #include "Util.h"
+#include "Trace.h"
+#include "Metrics.h"
+#include "GamelistStore.h"
+#include "TaskScheduler.h"
+#include <unordered_map>
+#include <string.h>
+#include <stdio.h>
+#include <deque>
+#include <memory>
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+
+#ifndef WIN32
+#include <unistd.h>
+#endif
 
 namespace fs = boost::filesystem;
 
+#define PLAY_JOURNAL_COMPACT 256 // records the play journal may have at load before the gamelist is saved to clear it
+
 FileData* findOrCreateFile(SystemData* system, const boost::filesystem::path& path, FileType type, bool trustGamelist)
 {
 	// first, verify that path is within the system's root folder
@@ -34,12 +56,10 @@ FileData* findOrCreateFile(SystemData* system, const boost::filesystem::path& pa
 	bool found = false;
 	while(path_it != relative.end())
 	{
-		const std::unordered_map<std::string, FileData*>& children = treeNode->getChildrenByFilename();
-
-		std::string key = path_it->string();
-		found = children.find(key) != children.end();
+		FileData* child = treeNode->findChild(path_it->string());
+		found = child != NULL;
 		if (found) {
-			treeNode = children.at(key);
+			treeNode = child;
 		}
 
 		// this is the end
@@ -54,7 +74,7 @@ FileData* findOrCreateFile(SystemData* system, const boost::filesystem::path& pa
 				return NULL;
 			}
 
-			FileData* file = new FileData(type, path, system);
+			FileData* file = system->createFileData(type, path);
 			treeNode->addChild(file);
 			return file;
 		}
@@ -70,7 +90,7 @@ FileData* findOrCreateFile(SystemData* system, const boost::filesystem::path& pa
 			}
 			
 			// create missing folder
-			FileData* folder = new FileData(FOLDER, treeNode->getPath().stem() / *path_it, system);
+			FileData* folder = system->createFileData(FOLDER, treeNode->getPath() / *path_it);
 			treeNode->addChild(folder);
 			treeNode = folder;
 		}
@@ -81,79 +101,574 @@ FileData* findOrCreateFile(SystemData* system, const boost::filesystem::path& pa
 	return NULL;
 }
 
+// Reads the top-level elements of a gamelist (<game>, <folder> and whatever else is in there) one at a time, without
+// ever holding more than one entry (plus a read buffer) in memory.
+// Every element is handed out as its own XML fragment, small enough to parse with pugixml on its own.
+class GamelistReader
+{
+public:
+	GamelistReader(const std::string& path) : mPos(0), mEOF(false), mSawRoot(false), mSawEnd(false), mEncoding(pugi::encoding_utf8)
+	{
+		mFile = fopen(path.c_str(), "rb");
+		readDeclaration();
+	}
+
+	~GamelistReader()
+	{
+		if(mFile)
+			fclose(mFile);
+	}
+
+	inline bool isOpen() const { return mFile != NULL; }
+	inline bool sawRoot() const { return mSawRoot; }
+	// the root was closed, so next() returning false wasn't the file being cut short (or malformed)
+	inline bool sawEnd() const { return mSawEnd; }
+	// the file's own "<?xml ...?>", empty if it has none
+	inline const std::string& getDeclaration() const { return mDeclaration; }
+	// what the fragments are encoded in, going by the declaration (they're handed out as the bytes in the file)
+	inline pugi::xml_encoding getEncoding() const { return mEncoding; }
+
+	// Returns false when there are no more entries (or the document is malformed).
+	bool next(std::string& tag, std::string& fragment)
+	{
+		while(true)
+		{
+			discardConsumed();
+
+			size_t start = find("<", mPos);
+			if(start == std::string::npos)
+				return false;
+
+			if(startsWith(start, "<?"))
+			{
+				if(!skipPast("?>", start))
+					return false;
+				continue;
+			}
+			if(startsWith(start, "<!--"))
+			{
+				if(!skipPast("-->", start))
+					return false;
+				continue;
+			}
+			if(startsWith(start, "</gameList"))
+				mSawEnd = true;
+			if(startsWith(start, "<!") || startsWith(start, "</"))
+			{
+				if(!skipPast(">", start))
+					return false;
+				continue;
+			}
+
+			size_t openEnd = find(">", start);
+			if(openEnd == std::string::npos)
+				return false;
+
+			size_t nameEnd = mBuffer.find_first_of(" \t\r\n/>", start + 1);
+			std::string name = mBuffer.substr(start + 1, nameEnd - start - 1);
+			bool selfClosing = mBuffer[openEnd - 1] == '/';
+
+			if(!mSawRoot)
+			{
+				// the first element has to be the root, everything we care about is inside it
+				if(name != "gameList")
+					return false;
+
+				mSawRoot = true;
+				mPos = openEnd + 1;
+				if(selfClosing)
+				{
+					mSawEnd = true;
+					return false;
+				}
+				continue;
+			}
+
+			// an empty <game/> has nothing to load, anything else is still kept when the gamelist is saved
+			if(selfClosing && (name == "game" || name == "folder"))
+			{
+				mPos = openEnd + 1;
+				continue;
+			}
+
+			size_t closeEnd = selfClosing ? openEnd : findClosingTag(name, openEnd + 1);
+			if(closeEnd == std::string::npos)
+				return false;
+
+			mPos = closeEnd + 1;
+			tag = name;
+			fragment.assign(mBuffer, start, closeEnd + 1 - start);
+			return true;
+		}
+	}
+
+private:
+	static const size_t CHUNK_SIZE = 64 * 1024;
+
+	FILE* mFile;
+	std::string mBuffer;
+	size_t mPos;
+	bool mEOF;
+	bool mSawRoot;
+	bool mSawEnd;
+	std::string mDeclaration;
+	pugi::xml_encoding mEncoding;
+
+	void readDeclaration()
+	{
+		// a UTF-8 BOM isn't kept, the declaration (or its absence) says the same
+		size_t start = startsWith(0, "\xEF\xBB\xBF") ? 3 : 0;
+		while(startsWith(start, " ") || startsWith(start, "\t") || startsWith(start, "\r") || startsWith(start, "\n"))
+			start++;
+
+		if(!startsWith(start, "<?xml") || !skipPast("?>", start))
+			return;
+
+		mDeclaration = mBuffer.substr(start, mPos - start);
+
+		size_t enc = mDeclaration.find("encoding");
+		if(enc == std::string::npos)
+			return;
+		enc = mDeclaration.find_first_of("\"'", enc);
+		if(enc == std::string::npos)
+			return;
+		const size_t encEnd = mDeclaration.find(mDeclaration[enc], enc + 1);
+		if(encEnd == std::string::npos)
+			return;
+
+		std::string name = mDeclaration.substr(enc + 1, encEnd - enc - 1);
+		std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+		if(name == "iso-8859-1" || name == "latin1" || name == "latin-1")
+			mEncoding = pugi::encoding_latin1;
+	}
+
+	bool readMore()
+	{
+		if(mEOF || !mFile)
+			return false;
+
+		char chunk[CHUNK_SIZE];
+		size_t read = fread(chunk, 1, CHUNK_SIZE, mFile);
+		if(read < CHUNK_SIZE)
+			mEOF = true;
+
+		mBuffer.append(chunk, read);
+		return read > 0;
+	}
+
+	// finds needle at or after from, reading more of the file as needed
+	size_t find(const char* needle, size_t from)
+	{
+		size_t len = strlen(needle);
+		while(true)
+		{
+			size_t found = mBuffer.find(needle, from);
+			if(found != std::string::npos)
+				return found;
+
+			// the needle could straddle the end of what we've read so far
+			if(mBuffer.size() >= len)
+				from = std::max(from, mBuffer.size() - len + 1);
+
+			if(!readMore())
+				return std::string::npos;
+		}
+	}
+
+	bool startsWith(size_t pos, const char* prefix)
+	{
+		size_t len = strlen(prefix);
+		while(mBuffer.size() < pos + len)
+		{
+			if(!readMore())
+				return false;
+		}
+
+		return mBuffer.compare(pos, len, prefix) == 0;
+	}
+
+	bool skipPast(const char* needle, size_t from)
+	{
+		size_t found = find(needle, from);
+		if(found == std::string::npos)
+			return false;
+
+		mPos = found + strlen(needle);
+		return true;
+	}
+
+	// returns the position of the '>' ending "</name>" (entries don't nest in one of their own, so the first one is ours)
+	size_t findClosingTag(const std::string& name, size_t from)
+	{
+		const std::string needle = "</" + name;
+		while(true)
+		{
+			size_t found = find(needle.c_str(), from);
+			if(found == std::string::npos)
+				return std::string::npos;
+
+			size_t end = find(">", found);
+			if(end == std::string::npos)
+				return std::string::npos;
+
+			// make sure it was "</game>" and not "</gameSomething>"
+			size_t after = found + needle.size();
+			if(mBuffer.find_first_not_of(" \t\r\n", after) == end)
+				return end;
+
+			from = after;
+		}
+	}
+
+	void discardConsumed()
+	{
+		// don't shuffle the buffer around for every little entry
+		if(mPos >= CHUNK_SIZE)
+		{
+			mBuffer.erase(0, mPos);
+			mPos = 0;
+		}
+	}
+};
+
+struct PendingFolder
+{
+	fs::path path;
+	MetaDataList metadata;
+};
+
+// Looks path up in the tree populateFolder() already built, going purely by the path's text (no syscalls).
+// Sets lexical to false if path can't be matched that way (outside the start path, or it has ".." in it).
+static FileData* findInTree(FileData* root, const fs::path& path, bool& lexical)
+{
+	const std::string rootStr = root->getPath().generic_string();
+	const std::string pathStr = path.generic_string();
+
+	lexical = false;
+	if(pathStr.size() <= rootStr.size() || pathStr.compare(0, rootStr.size(), rootStr) != 0 || 
+		(rootStr[rootStr.size() - 1] != '/' && pathStr[rootStr.size()] != '/'))
+		return NULL;
+
+	FileData* treeNode = root;
+	fs::path relative = pathStr.substr(rootStr.size());
+	for(auto it = relative.begin(); it != relative.end(); it++)
+	{
+		const std::string key = it->string();
+		if(key == "/" || key == "." || key.empty())
+			continue;
+		if(key == "..")
+		{
+			lexical = false;
+			return NULL;
+		}
+
+		FileData* child = treeNode->findChild(key);
+
+		lexical = true;
+		if(!child)
+			return NULL;
+
+		treeNode = child;
+	}
+
+	return treeNode != root ? treeNode : NULL;
+}
+
+// if checkTree is set the tree holds every file on disk, so anything not in it is missing (no need to stat it)
+static void loadGamelistEntry(SystemData* system, const fs::path& path, FileType type, const MetaDataList& metadata, bool trustGamelist, 
+	bool checkTree, unsigned int& missing)
+{
+	FileData* file = NULL;
+	if(checkTree)
+	{
+		bool lexical;
+		file = findInTree(system->getRootFolder(), path, lexical);
+		if(!file && lexical)
+		{
+			LOG(LogWarning) << "File \"" << path << "\" does not exist! Ignoring.";
+			missing++;
+			return;
+		}
+	}
+
+	// not something we could match by name alone, do it the slow way
+	if(!file && !trustGamelist && !boost::filesystem::exists(path))
+	{
+		LOG(LogWarning) << "File \"" << path << "\" does not exist! Ignoring.";
+		missing++;
+		return;
+	}
+
+	if(!file)
+		file = findOrCreateFile(system, path, type, trustGamelist);
+	if(!file)
+	{
+		LOG(LogError) << "Error finding/creating FileData for \"" << path << "\", skipping.";
+		return;
+	}
+
+	//load the metadata (if there's no name, FileData::getName() fills in the default one when needed)
+	file->metadata = metadata;
+	if(!file->getThumbnailPath().empty())
+		system->setHasImages();
+}
+
+// The row the store keeps for a file, paths made relative the same way gamelist.xml has them. Defaults are left out,
+// so a file whose metadata went back to the defaults gets a row with no fields (which still replaces its older rows).
+static GamelistStoreRow makeStoreRow(FileType type, const fs::path& path, const MetaDataList& metadata, const std::string& defaultName, 
+	const fs::path& startPath)
+{
+	GamelistStoreRow row;
+	row.type = type;
+	row.path = makeRelativePath(path, startPath, false).generic_string();
+
+	const std::vector<MetaDataDecl>& mdd = metadata.getMDD();
+	for(unsigned int i = 0; i < mdd.size(); i++)
+	{
+		const std::string& value = metadata.get((MetaDataIds::MetaDataId)i);
+		if(value == mdd[i].defaultValue || (i == MetaDataIds::NAME && value == defaultName))
+			continue;
+
+		if(mdd[i].type == MD_IMAGE_PATH || mdd[i].type == MD_VIDEO_PATH)
+			row.fields.push_back(std::make_pair((uint8_t)i, makeRelativePath(value, startPath, true).generic_string()));
+		else
+			row.fields.push_back(std::make_pair((uint8_t)i, value));
+	}
+
+	return row;
+}
+
+static MetaDataList metadataFromStoreRow(const GamelistStoreRow& row, const fs::path& startPath, const std::shared_ptr<MetaDataStringPool>& pool)
+{
+	MetaDataList metadata(GAME_METADATA, pool);
+	const std::vector<MetaDataDecl>& mdd = metadata.getMDD();
+	for(auto it = row.fields.begin(); it != row.fields.end(); it++)
+	{
+		if(it->first >= mdd.size())
+			continue;
+
+		if(mdd[it->first].type == MD_IMAGE_PATH || mdd[it->first].type == MD_VIDEO_PATH)
+			metadata.set((MetaDataIds::MetaDataId)it->first, resolvePath(it->second, startPath, true).generic_string());
+		else
+			metadata.set((MetaDataIds::MetaDataId)it->first, it->second);
+	}
+	return metadata;
+}
+
+// Loads the rows of a store, games first and then folders like the xml. If keepChanged is set the entries stay marked
+// as changed, so the next save writes them out (to gamelist.xml, when switching back from the store).
+static void loadGamelistRows(SystemData* system, const std::vector<GamelistStoreRow>& rows, bool trustGamelist, bool checkTree, 
+	bool keepChanged, unsigned int& missing)
+{
+	const fs::path relativeTo = system->getStartPath();
+	for(int pass = 0; pass < 2; pass++)
+	{
+		const FileType type = pass == 0 ? GAME : FOLDER;
+		for(auto it = rows.begin(); it != rows.end(); it++)
+		{
+			if(it->type != type || it->fields.empty())
+				continue;
+
+			MetaDataList metadata = metadataFromStoreRow(*it, relativeTo, system->getMetaDataPool());
+			if(!keepChanged)
+				metadata.resetChangedFlag();
+			loadGamelistEntry(system, resolvePath(it->path, relativeTo, false), type, metadata, trustGamelist, checkTree, missing);
+		}
+	}
+}
+
+static void queueStoreRewrite(SystemData* system, std::vector<GamelistStoreRow>& rows);
+
+// With "GamelistBackend" "store": the store if there is one, otherwise gamelist.xml (which then becomes the store).
+static bool parseGamelistStore(SystemData* system, bool trustGamelist, bool checkTree, unsigned int& missing)
+{
+	const std::string storePath = system->getGamelistStorePath(false);
+	if(!fs::exists(storePath))
+		return false;
+
+	LOG(LogInfo) << "Reading gamelist store \"" << storePath << "\"...";
+
+	std::vector<GamelistStoreRow> rows;
+	unsigned int records;
+	bool damaged;
+	if(!readGamelistStore(storePath, rows, records, damaged))
+	{
+		LOG(LogError) << "Error reading gamelist store \"" << storePath << "\", falling back to gamelist.xml";
+		return false;
+	}
+
+	loadGamelistRows(system, rows, trustGamelist, checkTree, false, missing);
+
+	// every save appends, so old versions of rows pile up until the store is compacted
+	if(damaged || records > 2 * rows.size() + 64)
+	{
+		rows.erase(std::remove_if(rows.begin(), rows.end(), [](const GamelistStoreRow& row) { return row.fields.empty(); }), rows.end());
+		queueStoreRewrite(system, rows);
+	}
+
+	return true;
+}
+
 void parseGamelist(SystemData* system)
 {
-	bool trustGamelist = Settings::getInstance()->getBool("ParseGamelistOnly");
+	TRACE_SCOPE("parseGamelist", system->getName());
+
+	// if the scan timed out the tree is only part of what's there, and checking each file could hang just the same
+	// may be on a loading thread, so the settings come from the system
+	const SystemData::LoadSettings& settings = system->getLoadSettings();
+	bool trustGamelist = settings.parseGamelistOnly || !system->isScanComplete();
+	bool checkTree = !trustGamelist && settings.gamelistCheckTree;
+	bool useStore = settings.gamelistStore;
+	unsigned int missing = 0;
 	std::string xmlpath = system->getGamelistPath(false);
+	const auto start = std::chrono::steady_clock::now();
+
+	if(useStore && parseGamelistStore(system, trustGamelist, checkTree, missing))
+	{
+		if(missing)
+			LOG(LogInfo) << missing << " gamelist entries for system \"" << system->getName() << "\" have no matching file";
+		return;
+	}
 
 	if(!boost::filesystem::exists(xmlpath))
 		return;
 
 	LOG(LogInfo) << "Parsing XML file \"" << xmlpath << "\"...";
 
-	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(xmlpath.c_str());
-
-	if(!result)
+	GamelistReader reader(xmlpath);
+	if(!reader.isOpen())
 	{
-		LOG(LogError) << "Error parsing XML file \"" << xmlpath << "\"!\n	" << result.description();
+		LOG(LogError) << "Error opening XML file \"" << xmlpath << "\"!";
 		return;
 	}
 
-	pugi::xml_node root = doc.child("gameList");
-	if(!root)
+	// the first load with the store backend turns every entry (even ones without a file) into a row
+	std::vector<GamelistStoreRow> imported;
+
+	fs::path relativeTo = system->getStartPath();
+
+	// folders are only ever matched against folders that already exist (games can create them),
+	// so like before, they're applied after all the games
+	std::vector<PendingFolder> folders;
+
+	std::string tag;
+	std::string fragment;
+	pugi::xml_document doc;
+	while(reader.next(tag, fragment))
+	{
+		if(tag != "game" && tag != "folder")
+			continue;
+
+		pugi::xml_parse_result result = doc.load_buffer(fragment.data(), fragment.size(), pugi::parse_default, reader.getEncoding());
+		if(!result)
+		{
+			LOG(LogError) << "Error parsing <" << tag << "> entry in XML file \"" << xmlpath << "\"!\n	" << result.description();
+			continue;
+		}
+
+		pugi::xml_node fileNode = doc.first_child();
+		fs::path path = resolvePath(fileNode.child("path").text().get(), relativeTo, false);
+		MetaDataList metadata = MetaDataList::createFromXML(GAME_METADATA, fileNode, relativeTo, system->getMetaDataPool());
+		if(useStore)
+			imported.push_back(makeStoreRow(tag == "game" ? GAME : FOLDER, path, metadata, "", relativeTo));
+
+		if(tag == "game")
+		{
+			loadGamelistEntry(system, path, GAME, metadata, trustGamelist, checkTree, missing);
+		}else{
+			PendingFolder folder = { path, metadata };
+			folders.push_back(folder);
+		}
+	}
+
+	if(!reader.sawRoot())
 	{
 		LOG(LogError) << "Could not find <gameList> node in gamelist \"" << xmlpath << "\"!";
 		return;
 	}
 
-	fs::path relativeTo = system->getStartPath();
+	for(auto it = folders.cbegin(); it != folders.cend(); it++)
+		loadGamelistEntry(system, it->path, FOLDER, it->metadata, trustGamelist, checkTree, missing);
 
-	const char* tagList[2] = { "game", "folder" };
-	FileType typeList[2] = { GAME, FOLDER };
-	for(int i = 0; i < 2; i++)
+	if(useStore)
 	{
-		const char* tag = tagList[i];
-		FileType type = typeList[i];
-		for(pugi::xml_node fileNode = root.child(tag); fileNode; fileNode = fileNode.next_sibling(tag))
+		LOG(LogInfo) << "Importing " << imported.size() << " gamelist entries into the gamelist store for system \"" << system->getName() << "\"";
+		queueStoreRewrite(system, imported);
+	}else{
+		// switching back from the store: whatever it has that's newer than the xml gets saved into the xml
+		const std::string storePath = system->getGamelistStorePath(false);
+		boost::system::error_code ec;
+		const std::time_t storeTime = fs::last_write_time(storePath, ec);
+		std::vector<GamelistStoreRow> rows;
+		unsigned int records;
+		bool damaged;
+		if(!ec && storeTime > fs::last_write_time(xmlpath, ec) && !ec && readGamelistStore(storePath, rows, records, damaged))
 		{
-			fs::path path = resolvePath(fileNode.child("path").text().get(), relativeTo, false);
-			
-			if(!trustGamelist && !boost::filesystem::exists(path))
-			{
-				LOG(LogWarning) << "File \"" << path << "\" does not exist! Ignoring.";
-				continue;
-			}
+			LOG(LogInfo) << "Gamelist store \"" << storePath << "\" is newer than \"" << xmlpath << "\", its entries will be saved to the xml";
+			loadGamelistRows(system, rows, trustGamelist, checkTree, true, missing);
+		}
+	}
 
-			FileData* file = findOrCreateFile(system, path, type, trustGamelist);
-			if(!file)
-			{
-				LOG(LogError) << "Error finding/creating FileData for \"" << path << "\", skipping.";
-				continue;
-			}
+	if(missing)
+		LOG(LogInfo) << missing << " gamelist entries for system \"" << system->getName() << "\" have no matching file";
 
-			//load the metadata
-			std::string defaultName = file->metadata.get("name");
-			file->metadata = MetaDataList::createFromXML(GAME_METADATA, fileNode, relativeTo);
+	static Metrics::Histogram* loadTime = Metrics::getHistogram("es_gamelist_load_ms", "Time to parse a system's gamelist.xml");
+	loadTime->record(std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count());
+}
 
-			//make sure name gets set if one didn't exist
-			if(file->metadata.get("name").empty())
-				file->metadata.set("name", defaultName);
-		}
+// Everything needed to write one file's entry, copied so the write doesn't touch the live FileData tree.
+struct GamelistEntry
+{
+	GamelistEntry(const FileData* file) : type(file->getType()), path(file->getPath()), 
+		defaultName(file->getDisplayName()), metadata(file->metadata), changeCount(file->metadata.getChangeCount())
+	{
+		// the name may never have been looked at
+		if(metadata.get(MetaDataIds::NAME).empty())
+			metadata.set(MetaDataIds::NAME, defaultName);
 	}
-}
 
-void addFileDataNode(pugi::xml_node& parent, const FileData* file, const char* tag, SystemData* system)
+	FileType type;
+	fs::path path;
+	std::string defaultName;
+	MetaDataList metadata;
+	unsigned int changeCount; // of the file's metadata when this was copied
+};
+
+struct GamelistJob
 {
+	enum Kind
+	{
+		XML, // merge entries into gamelist.xml
+		STORE_APPEND, // append entries to the store
+		STORE_REWRITE, // replace the store with rows (importing or compacting)
+		JOURNAL_APPEND // append rows to the play journal
+	};
+
+	GamelistJob() : kind(XML) {}
+
+	Kind kind;
+	std::string systemName;
+	fs::path startPath;
+	std::string readPath; // only used if writePath doesn't exist yet
+	std::string writePath;
+	std::vector<GamelistEntry> entries;
+	std::vector<GamelistStoreRow> rows;
+	std::string removeAfter; // deleted once the write succeeded (a play journal whose records are in entries)
+};
+
+static void addEntryNode(pugi::xml_node& parent, GamelistEntry& entry, const fs::path& startPath)
+{
+	const char* tag = (entry.type == GAME) ? "game" : "folder";
+
 	//create game and add to parent node
 	pugi::xml_node newNode = parent.append_child(tag);
 
 	//write metadata
-	file->metadata.appendToXML(newNode, true, system->getStartPath());
+	entry.metadata.appendToXML(newNode, true, startPath);
 	
 	if(newNode.children().begin() == newNode.child("name") //first element is name
 		&& ++newNode.children().begin() == newNode.children().end() //theres only one element
-		&& newNode.child("name").text().get() == file->getDisplayName()) //the name is the default
+		&& newNode.child("name").text().get() == entry.defaultName) //the name is the default
 	{
 		//if the only info is the default name, don't bother with this node
 		//delete it and ultimately do nothing
@@ -162,102 +677,603 @@ void addFileDataNode(pugi::xml_node& parent, const FileData* file, const char* t
 		//there's something useful in there so we'll keep the node, add the path
 
 		// try and make the path relative if we can so things still work if we change the rom folder location in the future
-		newNode.prepend_child("path").text().set(makeRelativePath(file->getPath(), system->getStartPath(), false).generic_string().c_str());
+		newNode.prepend_child("path").text().set(makeRelativePath(entry.path, startPath, false).generic_string().c_str());
 	}
 }
 
-void updateGamelist(SystemData* system)
+// lexically normalized path ("./a/../b.nes" -> "b.nes"), doesn't touch the filesystem
+static std::string getPathKey(const fs::path& path)
 {
-	//We do this by reading the XML again, adding changes and then writing it back,
-	//because there might be information missing in our systemdata which would then miss in the new XML.
-	//We have the complete information for every game though, so we can simply remove a game
-	//we already have in the system from the XML, and then add it back from its GameData information...
+	fs::path ret;
+	for(auto it = path.begin(); it != path.end(); ++it)
+	{
+		if(*it == ".")
+			continue;
 
-	if(Settings::getInstance()->getBool("IgnoreGamelist"))
-		return;
+		if(*it == ".." && !ret.empty() && ret.filename() != "..")
+		{
+			ret = ret.parent_path();
+			continue;
+		}
 
-	pugi::xml_document doc;
-	pugi::xml_node root;
-	std::string xmlReadPath = system->getGamelistPath(false);
+		ret /= *it;
+	}
 
-	if(boost::filesystem::exists(xmlReadPath))
+	return ret.generic_string();
+}
+
+// The changed entries of a save, by path, so each <game>/<folder> read from the old gamelist can be checked for
+// whether one of them replaces it without looking through all of them.
+class GamelistChanges
+{
+public:
+	GamelistChanges(std::vector<GamelistEntry>& entries) : mRemaining(0), mCanonicalBuilt(false)
 	{
-		//parse an existing file first
-		pugi::xml_parse_result result = doc.load_file(xmlReadPath.c_str());
-		
-		if(!result)
+		for(auto it = entries.begin(); it != entries.end(); it++)
 		{
-			LOG(LogError) << "Error parsing XML file \"" << xmlReadPath << "\"!\n	" << result.description();
-			return;
+			// entries with nothing but defaults aren't written, and don't replace what the gamelist has either
+			if(it->metadata.isDefault())
+				continue;
+
+			mEntries.push_back(&*it);
+			mByPath[getTypeIndex(it->type)].insert(std::make_pair(getPathKey(it->path), mEntries.size() - 1));
+			mByFilename[getTypeIndex(it->type)].insert(std::make_pair(it->path.filename().string(), mEntries.size() - 1));
 		}
+		mReplaced.resize(mEntries.size(), false);
+		mRemaining = mEntries.size();
+	}
+
+	// The changed entry that takes the place of the node for path, NULL if there isn't one. Each entry replaces one
+	// node, if the same path shows up twice the first node goes (same as the old linear search).
+	GamelistEntry* replaces(const std::string& tag, const fs::path& path)
+	{
+		if(mRemaining == 0)
+			return NULL;
+
+		const int t = tag == "game" ? 0 : 1;
+
+		auto it = mByPath[t].find(getPathKey(path));
+		if(it != mByPath[t].end() && !mReplaced[it->second])
+			return take(it->second);
+
+		// no lexical match - the gamelist might refer to a file through a symlink or some other
+		// equivalent path, so fall back to comparing canonical paths (built lazily). Resolving a node's path
+		// costs a few syscalls per component, so it's only done for nodes named like a pending entry (or its target).
+		if(!mCanonicalBuilt)
+			buildCanonical();
+		if(mByCanonicalPath[t].empty() || !isPendingFilename(t, path.filename().string()))
+			return NULL;
 
-		root = doc.child("gameList");
-		if(!root)
+		boost::system::error_code ec;
+		const fs::path canonical = fs::canonical(path, ec);
+		if(ec)
+			return NULL;
+
+		it = mByCanonicalPath[t].find(canonical.generic_string());
+		if(it != mByCanonicalPath[t].end() && !mReplaced[it->second])
+			return take(it->second);
+
+		return NULL;
+	}
+
+	// the ones that didn't replace anything, for the end of the file
+	std::vector<GamelistEntry*> getNewEntries() const
+	{
+		std::vector<GamelistEntry*> entries;
+		for(size_t i = 0; i < mEntries.size(); i++)
 		{
-			LOG(LogError) << "Could not find <gameList> node in gamelist \"" << xmlReadPath << "\"!";
-			return;
+			if(!mReplaced[i])
+				entries.push_back(mEntries[i]);
 		}
-	}else{
-		//set up an empty gamelist to append to
-		root = doc.append_child("gameList");
+		return entries;
 	}
 
+private:
+	static int getTypeIndex(FileType type) { return type == GAME ? 0 : 1; }
 
-	//now we have all the information from the XML. now iterate through all our games and add information from there
-	FileData* rootFolder = system->getRootFolder();
-	if (rootFolder != nullptr)
+	GamelistEntry* take(size_t i)
 	{
-		//get only files, no folders
-		std::vector<FileData*> files = rootFolder->getFilesRecursive(GAME | FOLDER);
-		//iterate through all files, checking if they're already in the XML
-		std::vector<FileData*>::const_iterator fit = files.cbegin();
-		while(fit != files.cend())
-		{
-			const char* tag = ((*fit)->getType() == GAME) ? "game" : "folder";
+		mReplaced[i] = true;
+		mRemaining--;
+		return mEntries[i];
+	}
+
+	void buildCanonical()
+	{
+		mCanonicalBuilt = true;
 
-			// check if current file has metadata, if no, skip it as it wont be in the gamelist anyway.
-			if ((*fit)->metadata.isDefault()) {
-				++fit;
+		for(size_t i = 0; i < mEntries.size(); i++)
+		{
+			boost::system::error_code ec;
+			const fs::path canonical = fs::canonical(mEntries[i]->path, ec);
+			if(ec)
 				continue;
-			}
 
-			// check if the file already exists in the XML
-			// if it does, remove it before adding
-			for(pugi::xml_node fileNode = root.child(tag); fileNode; fileNode = fileNode.next_sibling(tag))
+			const int t = getTypeIndex(mEntries[i]->type);
+			mByCanonicalPath[t].insert(std::make_pair(canonical.generic_string(), i));
+			if(canonical.filename() != mEntries[i]->path.filename())
+				mByFilename[t].insert(std::make_pair(canonical.filename().string(), i));
+		}
+	}
+
+	bool isPendingFilename(int t, const std::string& filename) const
+	{
+		auto range = mByFilename[t].equal_range(filename);
+		for(auto it = range.first; it != range.second; it++)
+		{
+			if(!mReplaced[it->second])
+				return true;
+		}
+		return false;
+	}
+
+	std::vector<GamelistEntry*> mEntries;
+	std::vector<bool> mReplaced;
+	size_t mRemaining; // entries that haven't replaced anything yet
+	std::unordered_map<std::string, size_t> mByPath[2];
+	std::unordered_map<std::string, size_t> mByCanonicalPath[2];
+	std::unordered_multimap<std::string, size_t> mByFilename[2]; // leaf names of entries' paths and of their canonical paths
+	bool mCanonicalBuilt;
+};
+
+// Flushes file (a temporary one next to path) to disk and renames it over path, so path always holds either the old
+// or the new gamelist - never half of one. If commit is false (or anything failed) the temporary file is deleted instead.
+static bool finishAtomicWrite(FILE* file, const std::string& tmpPath, const fs::path& path, bool commit)
+{
+	bool ok = commit && (fflush(file) == 0 && !ferror(file));
+#ifndef WIN32
+	ok = ok && (fsync(fileno(file)) == 0);
+#endif
+	ok = (fclose(file) == 0) && ok;
+
+	boost::system::error_code ec;
+	if(ok)
+	{
+		fs::rename(tmpPath, path, ec);
+		ok = !ec;
+	}
+
+	if(!ok)
+		fs::remove(tmpPath, ec);
+
+	return ok;
+}
+
+static bool writeGamelist(GamelistJob& job)
+{
+	//We do this by reading the XML again, adding changes and then writing it back,
+	//because there might be information missing in our systemdata which would then miss in the new XML.
+	//The old file is streamed through one entry at a time: entries are copied over as they are, except the ones
+	//of changed files, which are written from our complete information in their place (so a hand-edited
+	//gamelist keeps its layout and a save only touches the entries that changed). New entries go at the end.
+	//So no more than one entry of the old file is ever in memory, however big the gamelist is.
+
+	// an earlier job may have created writePath since this one was queued
+	std::string xmlReadPath = fs::exists(job.writePath) ? job.writePath : job.readPath;
+
+	const std::string tmpPath = job.writePath + ".tmp";
+	FILE* out = fopen(tmpPath.c_str(), "wb");
+	if(!out)
+	{
+		LOG(LogError) << "Error saving gamelist.xml to \"" << job.writePath << "\" (for system " << job.systemName << ")!";
+		return false;
+	}
+
+	// the old file's declaration is kept (and new entries are written in its encoding), its entries are copied byte for byte
+	std::unique_ptr<GamelistReader> reader;
+	if(boost::filesystem::exists(xmlReadPath))
+		reader.reset(new GamelistReader(xmlReadPath));
+	const pugi::xml_encoding encoding = reader ? reader->getEncoding() : pugi::encoding_utf8;
+
+	fputs(reader && !reader->getDeclaration().empty() ? reader->getDeclaration().c_str() : "<?xml version=\"1.0\"?>", out);
+	fputs("\n<gameList>\n", out);
+
+	GamelistChanges changes(job.entries);
+	bool ok = true;
+
+	pugi::xml_document entryDoc;
+	pugi::xml_node parent = entryDoc.append_child("gameList");
+	pugi::xml_writer_file writer(out);
+	auto writeEntry = [&](GamelistEntry& entry) {
+		addEntryNode(parent, entry, job.startPath);
+
+		// nothing is left if there was nothing but the default name in it
+		pugi::xml_node node = parent.first_child();
+		if(node)
+		{
+			node.print(writer, "\t", pugi::format_default, encoding, 1);
+			parent.remove_child(node);
+		}
+	};
+
+	if(reader)
+	{
+		std::string tag;
+		std::string fragment;
+		pugi::xml_document oldDoc;
+		while(reader->isOpen() && reader->next(tag, fragment))
+		{
+			if(tag == "game" || tag == "folder")
 			{
-				pugi::xml_node pathNode = fileNode.child("path");
+				// only the path is needed, the entry itself is copied as it was written
+				pugi::xml_parse_result result = oldDoc.load_buffer(fragment.data(), fragment.size(), pugi::parse_default, encoding);
+				pugi::xml_node pathNode = result ? oldDoc.first_child().child("path") : pugi::xml_node();
+				GamelistEntry* replacement = NULL;
 				if(!pathNode)
-				{
 					LOG(LogError) << "<" << tag << "> node contains no <path> child!";
-					continue;
-				}
+				else
+					replacement = changes.replaces(tag, resolvePath(pathNode.text().get(), job.startPath, true));
 
-				fs::path nodePath = resolvePath(pathNode.text().get(), system->getStartPath(), true);
-				fs::path gamePath((*fit)->getPath());
-				if(nodePath == gamePath || (fs::exists(nodePath) && fs::exists(gamePath) && fs::equivalent(nodePath, gamePath)))
+				if(replacement != NULL)
 				{
-					// found it
-					root.remove_child(fileNode);
-					break;
+					writeEntry(*replacement);
+					continue;
 				}
 			}
 
-			// it was either removed or never existed to begin with; either way, we can add it now
-			addFileDataNode(root, *fit, tag, system);
+			fputs("\t", out);
+			fwrite(fragment.data(), 1, fragment.size(), out);
+			fputs("\n", out);
+		}
 
-			++fit;
+		// saving what we could read would lose the rest
+		if(!reader->isOpen() || !reader->sawRoot() || !reader->sawEnd())
+		{
+			LOG(LogError) << "Error parsing XML file \"" << xmlReadPath << "\" (no complete <gameList>), not saving to it!";
+			ok = false;
 		}
+	}
+
+	if(ok)
+	{
+		const std::vector<GamelistEntry*> newEntries = changes.getNewEntries();
+		for(auto it = newEntries.begin(); it != newEntries.end(); it++)
+			writeEntry(**it);
 
-		//now write the file
+		fputs("</gameList>\n", out);
+	}
 
-		//make sure the folders leading up to this path exist (or the write will fail)
-		boost::filesystem::path xmlWritePath(system->getGamelistPath(true));
-		boost::filesystem::create_directories(xmlWritePath.parent_path());
+	if(!finishAtomicWrite(out, tmpPath, job.writePath, ok))
+	{
+		if(ok)
+			LOG(LogError) << "Error saving gamelist.xml to \"" << job.writePath << "\" (for system " << job.systemName << ")!";
+		return false;
+	}
 
-		if (!doc.save_file(xmlWritePath.c_str())) {
-			LOG(LogError) << "Error saving gamelist.xml to \"" << xmlWritePath << "\" (for system " << system->getName() << ")!";
+	LOG(LogInfo) << "Saved " << job.entries.size() << " changed entries to gamelist \"" << job.writePath << "\"";
+	return true;
+}
+
+static bool writeGamelistStore(GamelistJob& job)
+{
+	if(job.kind == GamelistJob::STORE_REWRITE)
+	{
+		if(!rewriteGamelistStore(job.writePath, job.rows))
+		{
+			LOG(LogError) << "Error writing gamelist store \"" << job.writePath << "\" (for system " << job.systemName << ")!";
+			return false;
 		}
-	}else{
+
+		LOG(LogInfo) << "Wrote " << job.rows.size() << " entries to gamelist store \"" << job.writePath << "\"";
+		return true;
+	}
+
+	if(job.kind == GamelistJob::JOURNAL_APPEND)
+	{
+		if(!appendGamelistStore(job.writePath, job.rows))
+		{
+			LOG(LogError) << "Error recording play in \"" << job.writePath << "\" (for system " << job.systemName << ")!";
+			return false;
+		}
+		return true;
+	}
+
+	std::vector<GamelistStoreRow> rows;
+	rows.reserve(job.entries.size());
+	for(auto it = job.entries.begin(); it != job.entries.end(); it++)
+		rows.push_back(makeStoreRow(it->type, it->path, it->metadata, it->defaultName, job.startPath));
+
+	if(!appendGamelistStore(job.writePath, rows))
+	{
+		LOG(LogError) << "Error saving to gamelist store \"" << job.writePath << "\" (for system " << job.systemName << ")!";
+		return false;
+	}
+
+	LOG(LogInfo) << "Saved " << rows.size() << " changed entries to gamelist store \"" << job.writePath << "\"";
+	return true;
+}
+
+// After a save that's renamed into place: clears the changed flags of the entries it wrote, on the main thread, unless
+// they were changed again since they were copied. Files are looked up again by path, they may be gone by now.
+static void clearSavedFlags(const GamelistJob& job)
+{
+	if(job.entries.empty())
+		return;
+
+	std::shared_ptr< std::vector< std::pair<fs::path, unsigned int> > > saved = std::make_shared< std::vector< std::pair<fs::path, unsigned int> > >();
+	for(auto it = job.entries.begin(); it != job.entries.end(); it++)
+		saved->push_back(std::make_pair(it->path, it->changeCount));
+
+	const std::string systemName = job.systemName;
+	TaskScheduler::getInstance()->runOnMainThread([systemName, saved] {
+		auto sys = std::find_if(SystemData::sSystemVector.begin(), SystemData::sSystemVector.end(), 
+			[&systemName](SystemData* system) { return system->getName() == systemName; });
+		if(sys == SystemData::sSystemVector.end())
+			return;
+
+		FileData* root = (*sys)->getRootFolder();
+		for(auto it = saved->begin(); it != saved->end(); it++)
+		{
+			bool lexical;
+			FileData* file = findInTree(root, it->first, lexical);
+			if(file)
+				file->metadata.resetChangedFlag(it->second);
+		}
+	});
+}
+
+// Runs queued gamelist writes on a background thread, in the order they were queued. flush() adds more threads to
+// drain what's left in parallel; writes to the same file still happen one at a time and in order.
+class GamelistWriter
+{
+public:
+	static void push(GamelistJob* job)
+	{
+		std::unique_lock<std::mutex> lock(sMutex);
+
+		if(sThreads.empty())
+		{
+			sQuit = false;
+			sThreads.push_back(std::thread(&GamelistWriter::run));
+		}
+
+		sQueue.push_back(job);
+		sCondition.notify_all();
+	}
+
+	static void flush(unsigned int threadCount)
+	{
+		std::unique_lock<std::mutex> lock(sMutex);
+		if(sThreads.empty())
+			return;
+
+		// no point in more threads than there are gamelists left
+		if(threadCount > sQueue.size())
+			threadCount = sQueue.size();
+		while(sThreads.size() < threadCount)
+			sThreads.push_back(std::thread(&GamelistWriter::run));
+
+		sQuit = true;
+		sCondition.notify_all();
+
+		std::vector<std::thread> threads;
+		threads.swap(sThreads);
+		lock.unlock();
+
+		// the threads finish everything still in the queue before they exit
+		for(auto it = threads.begin(); it != threads.end(); it++)
+			it->join();
+	}
+
+private:
+	// the first queued job whose file nobody is writing right now, or sQueue.end()
+	static std::deque<GamelistJob*>::iterator nextJob()
+	{
+		for(auto it = sQueue.begin(); it != sQueue.end(); it++)
+		{
+			if(sWriting.find((*it)->writePath) == sWriting.end())
+				return it;
+		}
+		return sQueue.end();
+	}
+
+	static void run()
+	{
+		std::unique_lock<std::mutex> lock(sMutex);
+		while(true)
+		{
+			std::deque<GamelistJob*>::iterator next;
+			sCondition.wait(lock, [&next] { next = nextJob(); return (sQuit && sQueue.empty()) || next != sQueue.end(); });
+			if(next == sQueue.end())
+				return;
+
+			GamelistJob* job = *next;
+			sQueue.erase(next);
+			sWriting.insert(job->writePath);
+
+			lock.unlock();
+			static Metrics::Histogram* saveTime = Metrics::getHistogram("es_gamelist_save_ms", "Time to write a system's gamelist.xml");
+			const auto start = std::chrono::steady_clock::now();
+			bool saved;
+			if(job->kind == GamelistJob::XML)
+				saved = writeGamelist(*job);
+			else
+				saved = writeGamelistStore(*job);
+			if(saved && job->kind != GamelistJob::JOURNAL_APPEND)
+				clearSavedFlags(*job);
+			if(saved && !job->removeAfter.empty())
+			{
+				boost::system::error_code ec;
+				fs::remove(job->removeAfter, ec);
+			}
+			saveTime->record(std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count());
+			lock.lock();
+
+			// a later job for the same file may be waiting on this one
+			sWriting.erase(job->writePath);
+			delete job;
+			sCondition.notify_all();
+		}
+	}
+
+	static std::mutex sMutex;
+	static std::condition_variable sCondition;
+	static std::deque<GamelistJob*> sQueue;
+	static std::set<std::string> sWriting; // writePaths being written right now
+	static std::vector<std::thread> sThreads;
+	static bool sQuit;
+};
+
+std::mutex GamelistWriter::sMutex;
+std::condition_variable GamelistWriter::sCondition;
+std::deque<GamelistJob*> GamelistWriter::sQueue;
+std::set<std::string> GamelistWriter::sWriting;
+std::vector<std::thread> GamelistWriter::sThreads;
+bool GamelistWriter::sQuit = false;
+
+// Moves the play journal aside for the save that's about to be queued (its records are in the changed entries: set by the
+// launches that recorded them, or replayed at load) and returns its path, so the save can delete it once it's done.
+// Launches from now on start a new journal. If an earlier save never got to delete one, that's the one returned.
+static std::string rotatePlayJournal(SystemData* system)
+{
+	const std::string journalPath = system->getPlayJournalPath(false);
+	const std::string oldPath = journalPath + ".old";
+
+	boost::system::error_code ec;
+	if(fs::exists(oldPath, ec))
+		return oldPath;
+
+	if(!fs::exists(journalPath, ec))
+		return "";
+
+	fs::rename(journalPath, oldPath, ec);
+	return ec ? "" : oldPath;
+}
+
+void updateGamelist(SystemData* system)
+{
+	if(Settings::getInstance()->getBool("IgnoreGamelist"))
+		return;
+
+	FileData* rootFolder = system->getRootFolder();
+	if(rootFolder == nullptr)
+	{
 		LOG(LogError) << "Found no root folder for system \"" << system->getName() << "\"!";
+		return;
+	}
+
+	// only files whose metadata changed since they were loaded (or last saved) need to be written, they stay
+	// changed until the write went through (see clearSavedFlags())
+	GamelistJob* job = new GamelistJob();
+	rootFolder->visitRecursive(GAME | FOLDER, [job](FileData* file) {
+		if(file->metadata.wasChanged())
+			job->entries.push_back(GamelistEntry(file));
+		return true;
+	});
+
+	if(job->entries.empty())
+	{
+		LOG(LogDebug) << "Gamelist for system \"" << system->getName() << "\" is unchanged, not saving";
+		delete job;
+		return;
+	}
+
+	job->systemName = system->getName();
+	job->startPath = system->getStartPath();
+	job->removeAfter = rotatePlayJournal(system);
+	if(Settings::getInstance()->getString("GamelistBackend") == "store")
+	{
+		job->kind = GamelistJob::STORE_APPEND;
+		job->writePath = system->getGamelistStorePath(true);
+	}else{
+		job->readPath = system->getGamelistPath(false);
+		job->writePath = system->getGamelistPath(true); // also makes sure the folders leading up to it exist
+	}
+
+	GamelistWriter::push(job);
+}
+
+static void queueStoreRewrite(SystemData* system, std::vector<GamelistStoreRow>& rows)
+{
+	if(Settings::getInstance()->getBool("IgnoreGamelist"))
+		return;
+
+	GamelistJob* job = new GamelistJob();
+	job->kind = GamelistJob::STORE_REWRITE;
+	job->systemName = system->getName();
+	job->startPath = system->getStartPath();
+	job->writePath = system->getGamelistStorePath(true);
+	job->rows.swap(rows);
+
+	GamelistWriter::push(job);
+}
+
+void recordPlay(SystemData* system, FileData* game)
+{
+	if(Settings::getInstance()->getBool("IgnoreGamelist"))
+		return;
+
+	GamelistStoreRow row;
+	row.type = GAME;
+	row.path = makeRelativePath(game->getPath(), system->getStartPath(), false).generic_string();
+	row.fields.push_back(std::make_pair((uint8_t)MetaDataIds::PLAYCOUNT, game->metadata.get(MetaDataIds::PLAYCOUNT)));
+	row.fields.push_back(std::make_pair((uint8_t)MetaDataIds::LASTPLAYED, game->metadata.get(MetaDataIds::LASTPLAYED)));
+
+	GamelistJob* job = new GamelistJob();
+	job->kind = GamelistJob::JOURNAL_APPEND;
+	job->systemName = system->getName();
+	job->writePath = system->getPlayJournalPath(true);
+	job->rows.push_back(row);
+
+	GamelistWriter::push(job);
+}
+
+void replayPlayJournal(SystemData* system)
+{
+	const std::string journalPath = system->getPlayJournalPath(false);
+	const std::string paths[] = { journalPath + ".old", journalPath };
+
+	const fs::path relativeTo = system->getStartPath();
+	unsigned int records = 0;
+	unsigned int applied = 0;
+	for(int i = 0; i < 2; i++)
+	{
+		if(!fs::exists(paths[i]))
+			continue;
+
+		std::vector<GamelistStoreRow> rows;
+		unsigned int count;
+		bool damaged;
+		if(!readGamelistStore(paths[i], rows, count, damaged))
+			continue;
+		records += count;
+
+		for(auto it = rows.begin(); it != rows.end(); it++)
+		{
+			bool lexical;
+			FileData* game = findInTree(system->getRootFolder(), resolvePath(it->path, relativeTo, false), lexical);
+			if(!game)
+				continue;
+
+			for(auto field = it->fields.begin(); field != it->fields.end(); field++)
+			{
+				const MetaDataIds::MetaDataId id = (MetaDataIds::MetaDataId)field->first;
+				if(id != MetaDataIds::PLAYCOUNT && id != MetaDataIds::LASTPLAYED)
+					continue;
+
+				// the gamelist may have been saved after it was recorded (then it's the same), never go backwards;
+				// lastplayed is an ISO time, those sort as strings
+				const bool newer = (id == MetaDataIds::PLAYCOUNT) ? atoi(field->second.c_str()) > game->metadata.getPlayCount()
+					: field->second > game->metadata.get(id);
+				if(newer)
+				{
+					// marked as changed, so the next save writes it to the gamelist
+					game->metadata.set(id, field->second);
+					applied++;
+				}
+			}
+		}
 	}
+
+	if(applied)
+		LOG(LogInfo) << "Replayed " << applied << " play statistics from the play journal of system \"" << system->getName() << "\"";
+
+	// the gamelist is only saved when something else changes (or on exit), don't let the journal grow forever
+	if(records > PLAY_JOURNAL_COMPACT)
+		updateGamelist(system);
+}
+
+void flushGamelistWrites(unsigned int threadCount)
+{
+	GamelistWriter::flush(threadCount);
 }
@@ -1,9 +1,22 @@
 #pragma once
 
 class SystemData;
+class FileData;
 
 // Loads gamelist.xml data into a SystemData.
 void parseGamelist(SystemData* system);
 
 // Writes currently loaded metadata for a SystemData to gamelist.xml.
+// Changed entries are copied right away, the file itself is written on a background thread.
 void updateGamelist(SystemData* system);
+
+// Appends the game's "playcount" and "lastplayed" (already set) to the system's play journal, one small fsync'd record,
+// instead of saving the gamelist. The next save of the gamelist takes them along and clears the journal.
+void recordPlay(SystemData* system, FileData* game);
+
+// Applies what the play journal has that the gamelist doesn't (after a power cut), call after parseGamelist().
+// Saves the gamelist right away if the journal has grown long.
+void replayPlayJournal(SystemData* system);
+
+// Blocks until every queued gamelist write has finished, writing up to threadCount of them at once.
+void flushGamelistWrites(unsigned int threadCount = 1);
@@ -0,0 +1,238 @@
+#include "GamelistStore.h"
+#include "Hash.h"
+#include "BinaryIO.h"
+#include "Log.h"
+#include <boost/filesystem.hpp>
+#include <unordered_map>
+#include <mutex>
+#include <fstream>
+#include <sstream>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef WIN32
+#include <unistd.h>
+#endif
+
+namespace fs = boost::filesystem;
+
+// bump this if the layout below changes
+static const char STORE_MAGIC[4] = { 'E', 'S', 'G', 'L' };
+static const uint32_t STORE_VERSION = 1;
+#define STORE_HEADER_SIZE 8
+#define STORE_MAX_RECORD (16 * 1024 * 1024) // anything bigger is surely damaged
+
+// where the last append or rewrite this session left each store, so the next append doesn't have to read it to find
+// out whether the tail is damaged
+static std::mutex sEndsMutex;
+static std::unordered_map<std::string, uint64_t> sEnds;
+
+// a record is its payload's length and CRC, then the payload: type, path, field count, then (id, value) pairs
+static void appendRecord(std::string& out, const GamelistStoreRow& row)
+{
+	std::string payload;
+	payload += (char)row.type;
+	putString(payload, row.path);
+	payload += (char)row.fields.size();
+	for(auto it = row.fields.begin(); it != row.fields.end(); it++)
+	{
+		payload += (char)it->first;
+		putString(payload, it->second);
+	}
+
+	putU32(out, payload.size());
+	putU32(out, crc32Update(0, payload.data(), payload.size()));
+	out += payload;
+}
+
+static bool parseRecord(const char* p, const char* end, GamelistStoreRow& row)
+{
+	if(p == end)
+		return false;
+	row.type = (FileType)(unsigned char)*p++;
+	if((row.type != GAME && row.type != FOLDER) || !getString(p, end, row.path) || p == end)
+		return false;
+
+	const unsigned int count = (unsigned char)*p++;
+	row.fields.resize(count);
+	for(unsigned int i = 0; i < count; i++)
+	{
+		if(p == end)
+			return false;
+		row.fields[i].first = (uint8_t)*p++;
+		if(!getString(p, end, row.fields[i].second))
+			return false;
+	}
+
+	return p == end;
+}
+
+// validEnd is set to the end of the last good record
+static bool readStore(const std::string& path, std::vector<GamelistStoreRow>* rows, unsigned int& records, uint64_t& validEnd)
+{
+	records = 0;
+	validEnd = 0;
+
+	std::ifstream in(path.c_str(), std::ios::in | std::ios::binary);
+	if(!in.is_open())
+		return false;
+
+	std::stringstream buffer;
+	buffer << in.rdbuf();
+	const std::string data = buffer.str();
+
+	uint32_t version;
+	const char* p = data.data() + 4;
+	if(data.size() < STORE_HEADER_SIZE || memcmp(data.data(), STORE_MAGIC, 4) != 0 || !getU32(p, data.data() + data.size(), version) || version != STORE_VERSION)
+	{
+		LOG(LogError) << "\"" << path << "\" is not a gamelist store (or it's from an incompatible version)";
+		return false;
+	}
+
+	std::unordered_map<std::string, size_t> byPath;
+	const char* end = data.data() + data.size();
+	validEnd = STORE_HEADER_SIZE;
+	while(p < end)
+	{
+		uint32_t len, crc;
+		if(!getU32(p, end, len) || !getU32(p, end, crc) || len > STORE_MAX_RECORD || (uint32_t)(end - p) < len || crc32Update(0, p, len) != crc)
+			break;
+
+		GamelistStoreRow row;
+		if(!parseRecord(p, p + len, row))
+			break;
+		p += len;
+		validEnd = p - data.data();
+		records++;
+
+		if(!rows)
+			continue;
+
+		auto found = byPath.find(row.path);
+		if(found != byPath.end())
+		{
+			(*rows)[found->second] = std::move(row);
+		}else{
+			byPath[row.path] = rows->size();
+			rows->push_back(std::move(row));
+		}
+	}
+
+	return true;
+}
+
+bool readGamelistStore(const std::string& path, std::vector<GamelistStoreRow>& rows, unsigned int& records, bool& damaged)
+{
+	rows.clear();
+
+	uint64_t validEnd;
+	if(!readStore(path, &rows, records, validEnd))
+		return false;
+
+	boost::system::error_code ec;
+	damaged = fs::file_size(path, ec) != validEnd;
+	if(damaged)
+		LOG(LogWarning) << "Gamelist store \"" << path << "\" ends in a damaged record (an interrupted save?), it's ignored";
+
+	return true;
+}
+
+// fflush, fsync and fclose, false if any of them failed
+static bool closeSynced(FILE* file)
+{
+	bool ok = (fflush(file) == 0 && !ferror(file));
+#ifndef WIN32
+	ok = ok && (fsync(fileno(file)) == 0);
+#endif
+	return (fclose(file) == 0) && ok;
+}
+
+bool appendGamelistStore(const std::string& path, const std::vector<GamelistStoreRow>& rows)
+{
+	boost::system::error_code ec;
+	const uint64_t size = fs::file_size(path, ec);
+	if(ec)
+		return rewriteGamelistStore(path, rows);
+
+	uint64_t known = 0;
+	{
+		std::lock_guard<std::mutex> lock(sEndsMutex);
+		auto it = sEnds.find(path);
+		if(it != sEnds.end())
+			known = it->second;
+	}
+
+	// first append this session (or someone else touched it): a damaged tail has to go, or everything after it would be lost
+	if(known != size)
+	{
+		unsigned int records;
+		uint64_t validEnd;
+		if(!readStore(path, NULL, records, validEnd))
+			return false;
+
+		if(validEnd != size)
+		{
+			fs::resize_file(path, validEnd, ec);
+			if(ec)
+			{
+				LOG(LogError) << "Could not cut the damaged end off gamelist store \"" << path << "\": " << ec.message();
+				return false;
+			}
+		}
+	}
+
+	std::string data;
+	for(auto it = rows.begin(); it != rows.end(); it++)
+		appendRecord(data, *it);
+
+	FILE* file = fopen(path.c_str(), "ab");
+	if(!file)
+		return false;
+
+	const bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+	if(!closeSynced(file) || !ok)
+	{
+		std::lock_guard<std::mutex> lock(sEndsMutex);
+		sEnds.erase(path);
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(sEndsMutex);
+	sEnds[path] = fs::file_size(path, ec);
+	return true;
+}
+
+bool rewriteGamelistStore(const std::string& path, const std::vector<GamelistStoreRow>& rows)
+{
+	std::string data(STORE_MAGIC, 4);
+	putU32(data, STORE_VERSION);
+	for(auto it = rows.begin(); it != rows.end(); it++)
+		appendRecord(data, *it);
+
+	// write and rename, so the store is always either the old or the new one
+	const std::string tmpPath = path + ".tmp";
+	FILE* file = fopen(tmpPath.c_str(), "wb");
+	if(!file)
+		return false;
+
+	bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+	ok = closeSynced(file) && ok;
+
+	boost::system::error_code ec;
+	if(ok)
+	{
+		fs::rename(tmpPath, path, ec);
+		ok = !ec;
+	}
+
+	std::lock_guard<std::mutex> lock(sEndsMutex);
+	if(!ok)
+	{
+		fs::remove(tmpPath, ec);
+		sEnds.erase(path);
+		return false;
+	}
+
+	sEnds[path] = data.size();
+	return true;
+}
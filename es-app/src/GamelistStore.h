@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <stdint.h>
+#include "FileData.h"
+
+// One <game>/<folder> entry as the store keeps it: the path and every non-default field, written the same way
+// gamelist.xml would have them (paths relative to the start path).
+struct GamelistStoreRow
+{
+	FileType type;
+	std::string path;
+	std::vector< std::pair<uint8_t, std::string> > fields; // MetaDataId and value
+};
+
+// The "store" gamelist backend ("GamelistBackend"): an append-only binary log of rows, ~/.emulationstation/gamelists/[name]/gamelist.esdb.
+// Saving appends only the rows that changed (the last record for a path wins), and every record carries a CRC,
+// so a write cut short by a power cut only loses that record. Nothing here knows about SystemData or the tree.
+
+// Reads every record and keeps the last one for each path, in the order the paths first appeared.
+// records is set to how many records there were (for deciding when to compact), damaged is set if the file ended in a
+// partial or corrupt record. False if the file doesn't exist or isn't a store.
+bool readGamelistStore(const std::string& path, std::vector<GamelistStoreRow>& rows, unsigned int& records, bool& damaged);
+
+// Appends rows to the store, creating it if needed, and flushes it to disk.
+bool appendGamelistStore(const std::string& path, const std::vector<GamelistStoreRow>& rows);
+
+// Replaces the store with just these rows (written next to it, then renamed over it).
+bool rewriteGamelistStore(const std::string& path, const std::vector<GamelistStoreRow>& rows);
@@ -0,0 +1,484 @@
+#include "GamelistSync.h"
+#include "SystemData.h"
+#include "Gamelist.h"
+#include "Hash.h"
+#include "BinaryIO.h"
+#include "Log.h"
+#include "Util.h"
+#include "platform.h"
+#include "pugixml/pugixml.hpp"
+#include <boost/filesystem.hpp>
+#include <unordered_map>
+#include <fstream>
+#include <sstream>
+#include <ctime>
+#include <random>
+#include <algorithm>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <ctype.h>
+
+#ifndef WIN32
+#include <unistd.h>
+#endif
+
+namespace fs = boost::filesystem;
+
+// bump this if the layout below changes
+static const char STATE_MAGIC[4] = { 'E', 'S', 'S', 'Y' };
+static const uint32_t STATE_VERSION = 1;
+
+// what the last export (or import) saw of an entry
+struct SyncState
+{
+	uint32_t hash; // of the fields that are synced
+	int64_t modified; // when they last changed, seconds since the epoch
+};
+
+typedef std::unordered_map<std::string, SyncState> SyncStates;
+
+static std::string getStatePath(const SystemData* system)
+{
+	return getHomePath() + "/.emulationstation/sync/" + system->getName() + ".state";
+}
+
+static void loadStates(const SystemData* system, SyncStates& states)
+{
+	const std::string path = getStatePath(system);
+	std::ifstream in(path.c_str(), std::ios::in | std::ios::binary);
+	if(!in.is_open())
+		return;
+
+	char magic[4];
+	uint32_t version, count;
+	if(!in.read(magic, 4) || memcmp(magic, STATE_MAGIC, 4) != 0 || !readU32(in, version) || version != STATE_VERSION || !readU32(in, count))
+	{
+		LOG(LogWarning) << "Sync state \"" << path << "\" is from an incompatible version, ignoring it";
+		return;
+	}
+
+	for(uint32_t i = 0; i < count; i++)
+	{
+		uint32_t len;
+		uint64_t modified;
+		std::string entry;
+		SyncState state;
+		if(!readU32(in, len) || len > 64 * 1024)
+			break;
+		entry.resize(len);
+		if((len && !in.read(&entry[0], len)) || !readU32(in, state.hash) || !readU64(in, modified))
+			break;
+
+		state.modified = (int64_t)modified;
+		states[entry] = state;
+	}
+}
+
+// written and renamed, so a crash never leaves half of it behind
+static bool writeFile(const fs::path& path, const std::string& data)
+{
+	boost::system::error_code ec;
+	fs::create_directories(path.parent_path(), ec);
+
+	const fs::path tmpPath = path.string() + ".tmp";
+	{
+		std::ofstream file(tmpPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if(!file.write(data.data(), data.size()))
+		{
+			LOG(LogError) << "Could not write \"" << tmpPath.generic_string() << "\"";
+			return false;
+		}
+	}
+
+	fs::rename(tmpPath, path, ec);
+	if(ec)
+	{
+		LOG(LogError) << "Could not replace \"" << path.generic_string() << "\": " << ec.message();
+		fs::remove(tmpPath, ec);
+		return false;
+	}
+	return true;
+}
+
+// Names this machine's file in a sync directory: its host name, plus a random part picked once, so cabinets cloned
+// from one image (and so with the same host name) still each have their own.
+static const std::string& getMachineId()
+{
+	static std::string id;
+	if(!id.empty())
+		return id;
+
+	const std::string path = getHomePath() + "/.emulationstation/sync/machine";
+	std::ifstream in(path.c_str());
+	if(in.is_open())
+		std::getline(in, id);
+	if(!id.empty())
+		return id;
+
+	char host[256] = "";
+#ifdef WIN32
+	const char* env = getenv("COMPUTERNAME");
+	if(env)
+		strncpy(host, env, sizeof(host) - 1);
+#else
+	gethostname(host, sizeof(host) - 1);
+#endif
+
+	for(const char* c = host; *c; c++)
+		id += (isalnum((unsigned char)*c) || *c == '-') ? *c : '_';
+	if(id.empty())
+		id = "es";
+
+	std::random_device random;
+	char suffix[16];
+	snprintf(suffix, sizeof(suffix), "-%08x", (unsigned int)random());
+	id += suffix;
+
+	writeFile(path, id + "\n");
+	return id;
+}
+
+static bool saveStates(const SystemData* system, const SyncStates& states)
+{
+	std::ostringstream out(std::ios::out | std::ios::binary);
+	out.write(STATE_MAGIC, 4);
+	writeU32(out, STATE_VERSION);
+	writeU32(out, states.size());
+	for(auto it = states.begin(); it != states.end(); it++)
+	{
+		writeU32(out, it->first.length());
+		out.write(it->first.data(), it->first.length());
+		writeU32(out, it->second.hash);
+		writeU64(out, (uint64_t)it->second.modified);
+	}
+
+	return writeFile(getStatePath(system), out.str());
+}
+
+static bool isMedia(const MetaDataDecl& decl)
+{
+	return decl.type == MD_IMAGE_PATH || decl.type == MD_VIDEO_PATH;
+}
+
+static uint32_t hashFields(const MetaDataList& mdl)
+{
+	uint32_t crc = 0;
+	const std::vector<MetaDataDecl>& mdd = mdl.getMDD();
+	for(unsigned int i = 0; i < mdd.size(); i++)
+	{
+		if(mdd[i].isStatistic)
+			continue;
+
+		const std::string& value = mdl.get((MetaDataIds::MetaDataId)i);
+		crc = crc32Update(crc, value.data(), value.size() + 1); // with the terminator, so "ab","c" isn't "a","bc"
+	}
+	return crc;
+}
+
+// empty if the file couldn't be read
+static std::string hashFile(const fs::path& path)
+{
+	std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+	if(!file.is_open())
+		return "";
+
+	Sha1 sha1;
+	char buffer[64 * 1024];
+	while(file.read(buffer, sizeof(buffer)) || file.gcount())
+		sha1.update(buffer, (size_t)file.gcount());
+	if(file.bad())
+		return "";
+
+	uint8_t hash[20];
+	sha1.finish(hash);
+	return hashToHex(hash, 20);
+}
+
+static bool copyFile(const fs::path& from, const fs::path& to)
+{
+	boost::system::error_code ec;
+	fs::create_directories(to.parent_path(), ec);
+
+	// another machine could be exporting the same file into a shared directory right now
+	const fs::path tmpPath = to.string() + "." + getMachineId() + ".tmp";
+	fs::copy_file(from, tmpPath, fs::copy_option::overwrite_if_exists, ec);
+	if(!ec)
+		fs::rename(tmpPath, to, ec);
+	if(ec)
+	{
+		LOG(LogError) << "Could not copy \"" << from.generic_string() << "\" to \"" << to.generic_string() << "\": " << ec.message();
+		fs::remove(tmpPath, ec);
+		return false;
+	}
+	return true;
+}
+
+static std::string getEntryKey(const SystemData* system, const FileData* file)
+{
+	bool contains;
+	return removeCommonPath(file->getPath(), system->getStartPath(), contains).generic_string();
+}
+
+// When entries we've never seen before changed: as far as we know, when the gamelist was last written (0 if there
+// isn't one). Calling that now would make every entry of a first export look newer than another machine's edits.
+static int64_t getUnseenModified(const SystemData* system)
+{
+	boost::system::error_code ec;
+	const std::time_t time = fs::last_write_time(system->getGamelistPath(false), ec);
+	return ec ? 0 : (int64_t)time;
+}
+
+static int64_t getModified(const pugi::xml_node& node)
+{
+	// this pugixml has no 64 bit attributes
+	return (int64_t)strtoll(node.attribute("modified").as_string(), NULL, 10);
+}
+
+bool exportGamelistChanges(const std::string& dir)
+{
+	const int64_t now = (int64_t)std::time(NULL);
+	bool ok = true;
+
+	for(auto sys = SystemData::sSystemVector.begin(); sys != SystemData::sSystemVector.end(); sys++)
+	{
+		SystemData* system = *sys;
+		// only ever written by this machine, so machines exporting into the same directory at once can't lose each other's
+		const fs::path changesPath = fs::path(dir) / system->getName() / (getMachineId() + ".xml");
+		const int64_t unseen = getUnseenModified(system);
+
+		SyncStates states;
+		loadStates(system, states);
+
+		// what's been exported here before stays, the entries that changed since replace theirs
+		pugi::xml_document doc;
+		if(fs::exists(changesPath) && !doc.load_file(changesPath.c_str()))
+		{
+			LOG(LogWarning) << "Could not read \"" << changesPath.generic_string() << "\", exporting every entry again";
+			doc.reset();
+		}
+
+		pugi::xml_node root = doc.child("changes");
+		if(!root)
+			root = doc.append_child("changes");
+
+		std::unordered_map<std::string, pugi::xml_node> exported;
+		for(pugi::xml_node node = root.first_child(); node; node = node.next_sibling())
+			exported[node.attribute("path").as_string()] = node;
+
+		unsigned int changed = 0;
+		system->getRootFolder()->visitRecursive(GAME | FOLDER, [&](FileData* file) {
+			const std::string key = getEntryKey(system, file);
+			const uint32_t hash = hashFields(file->metadata);
+
+			// the first export that sees something different is when it changed, as far as anyone else can tell
+			auto state = states.find(key);
+			if(state == states.end() || state->second.hash != hash)
+			{
+				const bool seen = state != states.end();
+				SyncState& updated = states[key];
+				updated.modified = seen ? now : unseen;
+				updated.hash = hash;
+				state = states.find(key);
+			}
+
+			auto old = exported.find(key);
+			if(old != exported.end() && getModified(old->second) >= state->second.modified)
+				return true;
+
+			pugi::xml_node node;
+			if(old != exported.end())
+			{
+				// in place, so the file doesn't reorder itself on every export
+				node = root.insert_child_before(file->getType() == GAME ? "game" : "folder", old->second);
+				root.remove_child(old->second);
+			}else{
+				node = root.append_child(file->getType() == GAME ? "game" : "folder");
+			}
+			node.append_attribute("path").set_value(key.c_str());
+			std::stringstream modified;
+			modified << state->second.modified;
+			node.append_attribute("modified").set_value(modified.str().c_str());
+			exported[key] = node;
+
+			file->metadata.appendToXML(node, true, system->getStartPath());
+
+			const std::vector<MetaDataDecl>& mdd = file->metadata.getMDD();
+			for(unsigned int i = 0; i < mdd.size(); i++)
+			{
+				pugi::xml_node field = node.child(mdd[i].key.c_str());
+				if(!field)
+					continue;
+
+				if(mdd[i].isStatistic)
+				{
+					node.remove_child(field);
+					continue;
+				}
+
+				if(!isMedia(mdd[i]))
+					continue;
+
+				// content addressed, so media that's already there (from this or an earlier export) isn't copied again
+				const fs::path media = file->metadata.get((MetaDataIds::MetaDataId)i);
+				const std::string sha1 = hashFile(media);
+				if(sha1.empty())
+					continue;
+
+				const fs::path target = fs::path(dir) / "media" / (sha1 + media.extension().string());
+				if(!fs::exists(target) && !copyFile(media, target))
+				{
+					ok = false;
+					continue;
+				}
+				field.append_attribute("sha1").set_value(sha1.c_str());
+			}
+
+			changed++;
+			return true;
+		});
+
+		if(!changed)
+			continue;
+
+		std::stringstream ss;
+		doc.save(ss);
+		if(!writeFile(changesPath, ss.str()) || !saveStates(system, states))
+		{
+			ok = false;
+			continue;
+		}
+
+		LOG(LogInfo) << "Exported " << changed << " changed entries of " << system->getName() << " to \"" << changesPath.generic_string() << "\"";
+	}
+
+	return ok;
+}
+
+// Takes the entries of one machine's file that are newer than ours into system, returns how many were.
+static unsigned int importChanges(SystemData* system, const fs::path& dir, const fs::path& changesPath, SyncStates& states,
+	const std::unordered_map<std::string, FileData*>& files, int64_t unseen)
+{
+	pugi::xml_document doc;
+	pugi::xml_parse_result result = doc.load_file(changesPath.c_str());
+	if(!result)
+	{
+		LOG(LogError) << "Error parsing \"" << changesPath.generic_string() << "\": " << result.description();
+		return 0;
+	}
+
+	unsigned int applied = 0;
+	unsigned int missing = 0;
+	for(pugi::xml_node node = doc.child("changes").first_child(); node; node = node.next_sibling())
+	{
+		const std::string key = node.attribute("path").as_string();
+		const int64_t modified = getModified(node);
+
+		auto found = files.find(key);
+		if(found == files.end())
+		{
+			missing++;
+			continue;
+		}
+
+		// newer wins; ours changed when our last export (or import) says so
+		FileData* file = found->second;
+		auto state = states.find(key);
+		if((state != states.end() ? state->second.modified : unseen) >= modified)
+			continue;
+
+		const MetaDataList theirs = MetaDataList::createFromXML(file->metadata.getType(), node, system->getStartPath());
+		const std::vector<MetaDataDecl>& mdd = file->metadata.getMDD();
+		for(unsigned int i = 0; i < mdd.size(); i++)
+		{
+			if(mdd[i].isStatistic)
+				continue;
+
+			const MetaDataIds::MetaDataId id = (MetaDataIds::MetaDataId)i;
+			const std::string& value = theirs.get(id);
+
+			const std::string sha1 = node.child(mdd[i].key.c_str()).attribute("sha1").as_string();
+			if(isMedia(mdd[i]) && !sha1.empty() && !value.empty() && hashFile(value) != sha1)
+			{
+				const fs::path media = dir / "media" / (sha1 + fs::path(value).extension().string());
+				if(!fs::exists(media))
+					LOG(LogWarning) << "\"" << media.generic_string() << "\" is missing from the sync directory";
+				else
+					copyFile(media, value);
+			}
+
+			// only what's different, so only the entries that really changed get saved
+			if(file->metadata.get(id) != value)
+				file->metadata.set(id, value);
+		}
+
+		SyncState& updated = states[key];
+		updated.hash = hashFields(file->metadata);
+		updated.modified = modified;
+
+		if(file->getParent())
+			file->getParent()->invalidateSort();
+		if(!file->getThumbnailPath().empty())
+			system->setHasImages();
+		applied++;
+	}
+
+	if(missing)
+		LOG(LogWarning) << missing << " entries in \"" << changesPath.generic_string() << "\" aren't in " << system->getName() << " here";
+
+	return applied;
+}
+
+bool importGamelistChanges(const std::string& dir)
+{
+	if(!fs::is_directory(dir))
+	{
+		LOG(LogError) << "\"" << dir << "\" is not a sync directory";
+		return false;
+	}
+
+	const std::string ownFile = getMachineId() + ".xml";
+	for(auto sys = SystemData::sSystemVector.begin(); sys != SystemData::sSystemVector.end(); sys++)
+	{
+		SystemData* system = *sys;
+		const fs::path systemDir = fs::path(dir) / system->getName();
+
+		// every other machine's file (and a changes.xml from before there was one per machine), in a fixed order
+		boost::system::error_code ec;
+		std::vector<fs::path> changesPaths;
+		for(fs::directory_iterator it(systemDir, ec), end; !ec && it != end; it.increment(ec))
+		{
+			const fs::path& path = it->path();
+			if(path.extension() == ".xml" && path.filename() != ownFile)
+				changesPaths.push_back(path);
+		}
+		if(changesPaths.empty())
+			continue;
+		std::sort(changesPaths.begin(), changesPaths.end());
+
+		SyncStates states;
+		loadStates(system, states);
+		const int64_t unseen = getUnseenModified(system);
+
+		std::unordered_map<std::string, FileData*> files;
+		system->getRootFolder()->visitRecursive(GAME | FOLDER, [&](FileData* file) {
+			files[getEntryKey(system, file)] = file;
+			return true;
+		});
+
+		// an entry several machines changed ends up with the newest, the states remember what was taken
+		unsigned int applied = 0;
+		for(auto it = changesPaths.begin(); it != changesPaths.end(); it++)
+			applied += importChanges(system, fs::path(dir), *it, states, files, unseen);
+
+		if(!applied)
+			continue;
+
+		updateGamelist(system);
+		saveStates(system, states);
+
+		LOG(LogInfo) << "Imported " << applied << " changed entries into " << system->getName();
+	}
+
+	return true;
+}
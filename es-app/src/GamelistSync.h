@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+
+// Keeps the gamelists and downloaded media of several machines the same without copying whole directories
+// (--sync-export and --sync-import). A sync directory has [system]/[machine].xml for each machine exporting to it,
+// one <game>/<folder> per entry keyed by its path with the time it last changed, and media/, every image and video an
+// entry points to, named by its SHA1. Each machine only writes its own file, so they can share a directory. Exporting into the same directory again only rewrites the entries that changed and only adds media that
+// isn't there yet, so whatever copies it around (rsync, a network share) only moves the differences.
+// Statistics (play count, last played) stay with the machine they happened on.
+// When each entry last changed is kept in ~/.emulationstation/sync/[system].state, noticed by the export. Entries it
+// hasn't seen before count as changed when the gamelist was last written. The machine's name is in .../sync/machine.
+
+// Adds what changed since the last export to dir, false if something couldn't be written.
+bool exportGamelistChanges(const std::string& dir);
+
+// Takes every entry in the other machines' files in dir that's newer than ours, copying in the media we don't have, and saves the gamelists
+// with just those entries changed. False if dir couldn't be read.
+bool importGamelistChanges(const std::string& dir);
@@ -2,9 +2,17 @@
 #include "components/TextComponent.h"
 #include "Log.h"
 #include "Util.h"
+#include "MemoryStats.h"
+#include "Settings.h"
+#include <zlib.h>
+#include <string.h>
+#include <stdint.h>
 
 namespace fs = boost::filesystem;
 
+#define DESC_PACK_MIN 256 // shorter descriptions don't shrink enough to be worth inflating
+#define DESC_UNPACK_SLOTS 4 // per thread, how many get(DESC) references stay good at once
+
 MetaDataDecl gameDecls[] = { 
 	// key,			type,					default,			statistic,	name in GuiMetaDataEd,	prompt in GuiMetaDataEd
 	{"name",		MD_STRING,				"", 				false,		"name",					"enter game name"}, 
@@ -18,9 +26,11 @@ MetaDataDecl gameDecls[] = {
 	{"genre",		MD_STRING,				"unknown",			false,		"genre",				"enter game genre"},
 	{"players",		MD_INT,					"1",				false,		"players",				"enter number of players"},
 	{"playcount",	MD_INT,					"0",				true,		"play count",			"enter number of times played"},
-	{"lastplayed",	MD_TIME,				"0", 				true,		"last played",			"enter last played date"}
+	{"lastplayed",	MD_TIME,				"0", 				true,		"last played",			"enter last played date"},
+	{"video",		MD_VIDEO_PATH,			"", 				false,		"video",				"enter path to video"}
 };
 const std::vector<MetaDataDecl> gameMDD(gameDecls, gameDecls + sizeof(gameDecls) / sizeof(gameDecls[0]));
+static_assert(sizeof(gameDecls) / sizeof(gameDecls[0]) == MetaDataIds::COUNT, "gameDecls must match MetaDataIds");
 
 MetaDataDecl folderDecls[] = { 
 	{"name",		MD_STRING,				"", 	false}, 
@@ -29,6 +39,7 @@ MetaDataDecl folderDecls[] = {
 	{"thumbnail",	MD_IMAGE_PATH,			"", 	false},
 };
 const std::vector<MetaDataDecl> folderMDD(folderDecls, folderDecls + sizeof(folderDecls) / sizeof(folderDecls[0]));
+static_assert(sizeof(folderDecls) / sizeof(folderDecls[0]) == MetaDataIds::FOLDER_COUNT, "folderDecls must match MetaDataIds");
 
 const std::vector<MetaDataDecl>& getMDDByType(MetaDataListType type)
 {
@@ -46,37 +57,91 @@ const std::vector<MetaDataDecl>& getMDDByType(MetaDataListType type)
 
 
 
-MetaDataList::MetaDataList(MetaDataListType type)
-	: mType(type)
+MetaDataIds::MetaDataId getMetaDataId(const std::string& key)
 {
-	const std::vector<MetaDataDecl>& mdd = getMDD();
-	for(auto iter = mdd.begin(); iter != mdd.end(); iter++)
-		set(iter->key, iter->defaultValue);
+	// folder keys are a prefix of the game keys, so this covers both
+	for(unsigned int i = 0; i < MetaDataIds::COUNT; i++)
+	{
+		if(gameDecls[i].key == key)
+			return (MetaDataIds::MetaDataId)i;
+	}
+
+	return MetaDataIds::COUNT;
+}
+
+MetaDataStringPool::MetaDataStringPool() : mBytes(0)
+{
+}
+
+MetaDataStringPool::~MetaDataStringPool()
+{
+	MemoryStats::add(MemoryStats::METADATA, -(ptrdiff_t)mBytes);
+}
+
+const std::string* MetaDataStringPool::intern(const std::string& str)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	auto result = mStrings.insert(str);
+	if(result.second)
+	{
+		// the string, its node and its bucket
+		const size_t bytes = sizeof(std::string) + MemoryStats::getHeapSize(*result.first) + 2 * sizeof(void*);
+		mBytes += bytes;
+		MemoryStats::add(MemoryStats::METADATA, bytes);
+	}
+	return &(*result.first);
+}
+
+static std::shared_ptr<MetaDataStringPool>& getDefaultPool()
+{
+	static std::shared_ptr<MetaDataStringPool> pool = std::make_shared<MetaDataStringPool>();
+	return pool;
+}
+
+std::shared_ptr<MetaDataStringPool> MetaDataStringPool::getDefault()
+{
+	// scraper threads take it while the main thread may be resetting it
+	return std::atomic_load(&getDefaultPool());
+}
+
+void MetaDataStringPool::resetDefault()
+{
+	std::atomic_store(&getDefaultPool(), std::make_shared<MetaDataStringPool>());
+}
+
+
+MetaDataList::MetaDataList(MetaDataListType type, const std::shared_ptr<MetaDataStringPool>& pool)
+	: mType(type), mWasChanged(false), mChangeCount(0), mPool(pool), mDescPacked(false), mRating(0.0f), mPlayCount(0) // mLastPlayed defaults to not_a_date_time, same as parsing "0"
+{
+	// defaults point straight at the declarations, so they don't cost anything in the pool
+	for(unsigned int i = 0; i < MetaDataIds::COUNT; i++)
+		mValues[i] = &gameDecls[i].defaultValue;
 }
 
 
-MetaDataList MetaDataList::createFromXML(MetaDataListType type, pugi::xml_node node, const fs::path& relativeTo)
+MetaDataList MetaDataList::createFromXML(MetaDataListType type, pugi::xml_node node, const fs::path& relativeTo, 
+	const std::shared_ptr<MetaDataStringPool>& pool)
 {
-	MetaDataList mdl(type);
+	MetaDataList mdl(type, pool);
 
 	const std::vector<MetaDataDecl>& mdd = mdl.getMDD();
 
-	for(auto iter = mdd.begin(); iter != mdd.end(); iter++)
+	for(unsigned int i = 0; i < mdd.size(); i++)
 	{
-		pugi::xml_node md = node.child(iter->key.c_str());
+		pugi::xml_node md = node.child(mdd[i].key.c_str());
 		if(md)
 		{
 			// if it's a path, resolve relative paths
 			std::string value = md.text().get();
-			if(iter->type == MD_IMAGE_PATH)
+			if(mdd[i].type == MD_IMAGE_PATH || mdd[i].type == MD_VIDEO_PATH)
 				value = resolvePath(value, relativeTo, true).generic_string();
 
-			mdl.set(iter->key, value);
-		}else{
-			mdl.set(iter->key, iter->defaultValue);
+			mdl.set((MetaDataIds::MetaDataId)i, value);
 		}
 	}
 
+	// this is what's on disk, so nothing needs saving yet
+	mdl.resetChangedFlag();
 	return mdl;
 }
 
@@ -84,60 +149,176 @@ void MetaDataList::appendToXML(pugi::xml_node parent, bool ignoreDefaults, const
 {
 	const std::vector<MetaDataDecl>& mdd = getMDD();
 
-	for(auto mddIter = mdd.begin(); mddIter != mdd.end(); mddIter++)
+	for(unsigned int i = 0; i < mdd.size(); i++)
 	{
-		auto mapIter = mMap.find(mddIter->key);
-		if(mapIter != mMap.end())
+		const std::string& value = get((MetaDataIds::MetaDataId)i);
+
+		// if it's just the default (and we ignore defaults), don't write it
+		if(ignoreDefaults && value == mdd[i].defaultValue)
+			continue;
+
+		// try and make paths relative if we can
+		if(mdd[i].type == MD_IMAGE_PATH || mdd[i].type == MD_VIDEO_PATH)
+			parent.append_child(mdd[i].key.c_str()).text().set(makeRelativePath(value, relativeTo, true).generic_string().c_str());
+		else
+			parent.append_child(mdd[i].key.c_str()).text().set(value.c_str());
+	}
+}
+
+// the original length, then the deflated bytes
+static bool packDescription(const std::string& value, std::string& out)
+{
+	uLongf size = compressBound(value.size());
+	out.resize(sizeof(uint32_t) + size);
+
+	const uint32_t length = value.size();
+	memcpy(&out[0], &length, sizeof(length));
+	if(compress2((Bytef*)&out[sizeof(length)], &size, (const Bytef*)value.data(), value.size(), Z_BEST_SPEED) != Z_OK)
+		return false;
+
+	out.resize(sizeof(length) + size);
+	return out.size() < value.size();
+}
+
+const std::string& MetaDataList::unpackDescription() const
+{
+	static thread_local std::string slots[DESC_UNPACK_SLOTS];
+	static thread_local unsigned int next = 0;
+
+	std::string& out = slots[next];
+	next = (next + 1) % DESC_UNPACK_SLOTS;
+
+	const std::string& packed = *mValues[MetaDataIds::DESC];
+	uint32_t length;
+	memcpy(&length, packed.data(), sizeof(length));
+	out.resize(length);
+
+	uLongf size = length;
+	if(uncompress((Bytef*)&out[0], &size, (const Bytef*)packed.data() + sizeof(length), packed.size() - sizeof(length)) != Z_OK || size != length)
+	{
+		LOG(LogError) << "Could not inflate a game description";
+		out.clear();
+	}
+
+	return out;
+}
+
+void MetaDataList::set(MetaDataIds::MetaDataId id, const std::string& value)
+{
+	if(get(id) == value)
+		return;
+
+	mWasChanged = true;
+	mChangeCount++;
+
+	if(id == MetaDataIds::DESC)
+	{
+		static const SettingHandle<bool> compress = Settings::getInstance()->getBoolHandle("CompressDescriptions");
+
+		std::string packed;
+		mDescPacked = compress && value.size() >= DESC_PACK_MIN && packDescription(value, packed);
+		if(mDescPacked)
 		{
-			// we have this value!
-			// if it's just the default (and we ignore defaults), don't write it
-			if(ignoreDefaults && mapIter->second == mddIter->defaultValue)
-				continue;
-			
-			// try and make paths relative if we can
-			std::string value = mapIter->second;
-			if(mddIter->type == MD_IMAGE_PATH)
-				value = makeRelativePath(value, relativeTo, true).generic_string();
-
-			parent.append_child(mapIter->first.c_str()).text().set(value.c_str());
+			mValues[id] = mPool->intern(packed);
+			return;
 		}
 	}
+
+	mValues[id] = (value == gameDecls[id].defaultValue) ? &gameDecls[id].defaultValue : mPool->intern(value);
+
+	switch(id)
+	{
+	case MetaDataIds::RATING:
+		mRating = (float)atof(value.c_str());
+		break;
+	case MetaDataIds::PLAYCOUNT:
+		mPlayCount = atoi(value.c_str());
+		break;
+	case MetaDataIds::LASTPLAYED:
+		mLastPlayed = parseIsoTime(value);
+		break;
+	default:
+		break;
+	}
+}
+
+void MetaDataList::moveToPool(const std::shared_ptr<MetaDataStringPool>& pool)
+{
+	if(pool == mPool)
+		return;
+
+	// defaults point at the declarations, the packed description is just bytes like any other value
+	for(unsigned int i = 0; i < MetaDataIds::COUNT; i++)
+	{
+		if(mValues[i] != &gameDecls[i].defaultValue)
+			mValues[i] = pool->intern(*mValues[i]);
+	}
+
+	mPool = pool;
 }
 
 void MetaDataList::set(const std::string& key, const std::string& value)
 {
-	mMap[key] = value;
+	MetaDataIds::MetaDataId id = getMetaDataId(key);
+	if(id == MetaDataIds::COUNT)
+	{
+		LOG(LogError) << "Tried to set unknown metadata \"" << key << "\"";
+		return;
+	}
+
+	set(id, value);
 }
 
 void MetaDataList::setTime(const std::string& key, const boost::posix_time::ptime& time)
 {
-	mMap[key] = boost::posix_time::to_iso_string(time);
+	set(key, formatIsoTime(time));
 }
 
 const std::string& MetaDataList::get(const std::string& key) const
 {
-	return mMap.at(key);
+	MetaDataIds::MetaDataId id = getMetaDataId(key);
+	if(id == MetaDataIds::COUNT)
+	{
+		LOG(LogError) << "Tried to get unknown metadata \"" << key << "\"";
+		static const std::string empty;
+		return empty;
+	}
+
+	return get(id);
 }
 
 int MetaDataList::getInt(const std::string& key) const
 {
+	if(key == "playcount")
+		return mPlayCount;
+
 	return atoi(get(key).c_str());
 }
 
 float MetaDataList::getFloat(const std::string& key) const
 {
+	if(key == "rating")
+		return mRating;
+
 	return (float)atof(get(key).c_str());
 }
 
 boost::posix_time::ptime MetaDataList::getTime(const std::string& key) const
 {
-	return string_to_ptime(get(key), "%Y%m%dT%H%M%S%F%q");
+	if(key == "lastplayed")
+		return mLastPlayed;
+
+	return parseIsoTime(get(key));
 }
 
 bool MetaDataList::isDefault()
 {
-	for (int i = 1; i < mMap.size(); i++) {
-		if (mMap.at(gameDecls[i].key) != gameDecls[i].defaultValue) return false;
+	// the name is always set, so it doesn't count
+	const std::vector<MetaDataDecl>& mdd = getMDD();
+	for(unsigned int i = 1; i < mdd.size(); i++)
+	{
+		if(*mValues[i] != mdd[i].defaultValue)
+			return false;
 	}
 
 	return true;
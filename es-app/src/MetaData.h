@@ -2,7 +2,9 @@
 
 #include "pugixml/pugixml.hpp"
 #include <string>
-#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
 #include "GuiComponent.h"
 #include <boost/date_time.hpp>
 #include <boost/filesystem.hpp>
@@ -17,11 +19,36 @@ enum MetaDataType
 	//specialized types
 	MD_MULTILINE_STRING,
 	MD_IMAGE_PATH,
+	MD_VIDEO_PATH,
 	MD_RATING,
 	MD_DATE,
 	MD_TIME //used for lastplayed
 };
 
+namespace MetaDataIds
+{
+	// Index of every key in the game MDD. Folders use the same indices, but only the first FOLDER_COUNT are declared for them.
+	enum MetaDataId : unsigned int
+	{
+		NAME = 0,
+		DESC,
+		IMAGE,
+		THUMBNAIL,
+		RATING,
+		RELEASEDATE,
+		DEVELOPER,
+		PUBLISHER,
+		GENRE,
+		PLAYERS,
+		PLAYCOUNT,
+		LASTPLAYED,
+		VIDEO,
+
+		COUNT,
+		FOLDER_COUNT = RATING
+	};
+}
+
 struct MetaDataDecl
 {
 	std::string key;
@@ -40,28 +67,92 @@ enum MetaDataListType
 
 const std::vector<MetaDataDecl>& getMDDByType(MetaDataListType type);
 
+// Returns the MetaDataId for a key, or MetaDataIds::COUNT if the key is unknown.
+MetaDataIds::MetaDataId getMetaDataId(const std::string& key);
+
+// Every distinct metadata value is stored once in a pool (each system has its own, so loading systems
+// in parallel doesn't contend). Pointers returned by intern() stay valid for as long as the pool lives.
+// Nothing is taken out of a pool: values nobody uses any more are dropped by moving what's still in use into a
+// new one (MetaDataList::moveToPool()), the old one goes with the last list that holds on to it.
+class MetaDataStringPool
+{
+public:
+	MetaDataStringPool();
+	~MetaDataStringPool();
+
+	const std::string* intern(const std::string& str);
+
+	// used by lists that don't belong to a system (e.g. scraper results), thread-safe
+	static std::shared_ptr<MetaDataStringPool> getDefault();
+
+	// Starts over with an empty default pool, for once the lists that were using it have been moved or dropped
+	// (lists still using the old one keep it alive). Thread-safe.
+	static void resetDefault();
+
+private:
+	std::mutex mMutex;
+	std::unordered_set<std::string> mStrings;
+	size_t mBytes; // what the strings were reported as to MemoryStats
+};
+
 class MetaDataList
 {
 public:
-	static MetaDataList createFromXML(MetaDataListType type, pugi::xml_node node, const boost::filesystem::path& relativeTo);
+	static MetaDataList createFromXML(MetaDataListType type, pugi::xml_node node, const boost::filesystem::path& relativeTo, 
+		const std::shared_ptr<MetaDataStringPool>& pool = MetaDataStringPool::getDefault());
 	void appendToXML(pugi::xml_node parent, bool ignoreDefaults, const boost::filesystem::path& relativeTo) const;
 
-	MetaDataList(MetaDataListType type);
+	MetaDataList(MetaDataListType type, const std::shared_ptr<MetaDataStringPool>& pool = MetaDataStringPool::getDefault());
 	
+	void set(MetaDataIds::MetaDataId id, const std::string& value);
 	void set(const std::string& key, const std::string& value);
 	void setTime(const std::string& key, const boost::posix_time::ptime& time); //times are internally stored as ISO strings (e.g. boost::posix_time::to_iso_string(ptime))
 
+	// a packed description is inflated into a small per-thread buffer, so don't hold on to that reference for long
+	inline const std::string& get(MetaDataIds::MetaDataId id) const { return (id == MetaDataIds::DESC && mDescPacked) ? unpackDescription() : *mValues[id]; }
 	const std::string& get(const std::string& key) const;
 	int getInt(const std::string& key) const;
 	float getFloat(const std::string& key) const;
 	boost::posix_time::ptime getTime(const std::string& key) const;
 
+	// parsed once when the value is set, so these are cheap enough to call from sort comparisons
+	inline float getRating() const { return mRating; }
+	inline int getPlayCount() const { return mPlayCount; }
+	inline const boost::posix_time::ptime& getLastPlayed() const { return mLastPlayed; }
+
 	bool isDefault();
 
+	// true if anything was set since this list was loaded (or since the last resetChangedFlag())
+	inline bool wasChanged() const { return mWasChanged; }
+	inline void resetChangedFlag() { mWasChanged = false; }
+
+	// Goes up with every change. For clearing the flag once a copy taken at getChangeCount() has been saved:
+	// if something was set since, that isn't saved yet and the flag stays.
+	inline unsigned int getChangeCount() const { return mChangeCount; }
+	inline void resetChangedFlag(unsigned int changeCount) { if(changeCount == mChangeCount) mWasChanged = false; }
+
+	// Re-interns every value in pool and keeps to that from now on. Doesn't count as a change.
+	void moveToPool(const std::shared_ptr<MetaDataStringPool>& pool);
+
 	inline MetaDataListType getType() const { return mType; }
 	inline const std::vector<MetaDataDecl>& getMDD() const { return getMDDByType(getType()); }
 
 private:
 	MetaDataListType mType;
-	std::map<std::string, std::string> mMap;
+	bool mWasChanged;
+	unsigned int mChangeCount;
+	std::shared_ptr<MetaDataStringPool> mPool;
+
+	// one slot per MetaDataId, pointing either into mPool or at the declared default value
+	const std::string* mValues[MetaDataIds::COUNT];
+
+	// with "CompressDescriptions", long descriptions go into the pool deflated (they're most of the metadata,
+	// and only the selected game's is ever shown)
+	bool mDescPacked;
+	const std::string& unpackDescription() const;
+
+	// native copies of the numeric fields, kept in sync with mValues by set()
+	float mRating;
+	int mPlayCount;
+	boost::posix_time::ptime mLastPlayed;
 };
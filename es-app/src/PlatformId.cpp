@@ -1,5 +1,7 @@
 #include "PlatformId.h"
 #include <string.h>
+#include <vector>
+#include <algorithm>
 
 extern const char* mameNameToRealName[];
 
@@ -86,15 +88,36 @@ namespace PlatformIds
 		return PlatformNames[id];
 	}
 
-	const char* getCleanMameName(const char* from)
+	// mameNameToRealName isn't sorted, so sort a list of pointers to its entries once and binary search that
+	static bool compareMameEntry(const char** a, const char** b)
 	{
-		const char** mameNames = mameNameToRealName;
+		return strcmp(*a, *b) < 0;
+	}
+
+	static const std::vector<const char**>& getSortedMameNames()
+	{
+		// built on first use (thread-safe, systems may be loading in parallel)
+		static const std::vector<const char**> sorted = [] {
+			std::vector<const char**> entries;
+			for(const char** mameNames = mameNameToRealName; *mameNames != NULL; mameNames += 2)
+				entries.push_back(mameNames);
+
+			// stable so that if a name is listed twice, the first one still wins
+			std::stable_sort(entries.begin(), entries.end(), compareMameEntry);
+			return entries;
+		}();
 
-		while(*mameNames != NULL && strcmp(from, *mameNames) != 0)
-			mameNames += 2;
+		return sorted;
+	}
+
+	const char* getCleanMameName(const char* from)
+	{
+		const std::vector<const char**>& sorted = getSortedMameNames();
 
-		if(*mameNames)
-			return *(mameNames + 1);
+		const char* key[1] = { from };
+		auto it = std::lower_bound(sorted.begin(), sorted.end(), (const char**)key, compareMameEntry);
+		if(it != sorted.end() && strcmp(**it, from) == 0)
+			return *(*it + 1);
 		
 		return from;
 	}
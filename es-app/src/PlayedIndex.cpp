@@ -0,0 +1,190 @@
+#include "PlayedIndex.h"
+#include "SystemData.h"
+#include <algorithm>
+#include <chrono>
+
+// ms per update spent looking through newly loaded systems
+#define PLAYED_SCAN_BUDGET 4
+// games read between looking at the clock
+#define PLAYED_SCAN_BATCH 256
+
+PlayedIndex* PlayedIndex::getInstance()
+{
+	static PlayedIndex instance;
+	return &instance;
+}
+
+PlayedIndex::PlayedIndex() : mScanSystem(NULL), mScanPos(0), mGeneration(0)
+{
+}
+
+bool PlayedIndex::RecentOrder::operator()(const Entry& a, const Entry& b) const
+{
+	if(a.lastPlayed != b.lastPlayed)
+		return a.lastPlayed > b.lastPlayed;
+	if(a.playCount != b.playCount)
+		return a.playCount > b.playCount;
+	return a.file < b.file;
+}
+
+bool PlayedIndex::MostPlayedOrder::operator()(const Entry& a, const Entry& b) const
+{
+	if(a.playCount != b.playCount)
+		return a.playCount > b.playCount;
+	if(a.lastPlayed != b.lastPlayed)
+		return a.lastPlayed > b.lastPlayed;
+	return a.file < b.file;
+}
+
+void PlayedIndex::addFile(FileData* file)
+{
+	Entry entry;
+	entry.file = file;
+	entry.lastPlayed = file->metadata.getLastPlayed();
+	entry.playCount = file->metadata.getPlayCount();
+
+	// a game that was never played isn't in either list (a play count typed in by hand still puts it in "most played")
+	const bool played = !entry.lastPlayed.is_special();
+	if(!played && entry.playCount <= 0)
+		return;
+
+	if(played)
+		mRecent.insert(entry);
+	if(entry.playCount > 0)
+		mMostPlayed.insert(entry);
+	mEntries[file] = entry;
+}
+
+void PlayedIndex::removeFile(FileData* file)
+{
+	auto it = mEntries.find(file);
+	if(it == mEntries.end())
+		return;
+
+	// the sets find it by the stats it was filed under, the game's own could have changed since
+	mRecent.erase(it->second);
+	mMostPlayed.erase(it->second);
+	mEntries.erase(it);
+}
+
+void PlayedIndex::update()
+{
+	const auto start = std::chrono::steady_clock::now();
+	const auto budget = std::chrono::milliseconds(PLAYED_SCAN_BUDGET);
+	bool added = false;
+	auto it = SystemData::sSystemVector.begin();
+	while(std::chrono::steady_clock::now() - start < budget)
+	{
+		if(mScanSystem == NULL)
+		{
+			while(it != SystemData::sSystemVector.end() && (!(*it)->isLoaded() || mSystems.find(*it) != mSystems.end()))
+				it++;
+			if(it == SystemData::sSystemVector.end())
+				break;
+
+			// collecting the pointers is cheap, reading their stats is what has to be spread out
+			mScanSystem = *it;
+			mScanFiles.clear();
+			mScanPos = 0;
+			mScanSystem->getRootFolder()->visitRecursive(GAME, [this](FileData* file) {
+				mScanFiles.push_back(file);
+				return true;
+			});
+		}
+
+		// a clock read per game would cost about as much as the game
+		const size_t end = std::min(mScanPos + PLAYED_SCAN_BATCH, mScanFiles.size());
+		for(; mScanPos < end; mScanPos++)
+		{
+			// a game that changed while we got here is in already, as it is now
+			FileData* file = mScanFiles[mScanPos];
+			if(file != NULL && mEntries.find(file) == mEntries.end())
+				addFile(file);
+		}
+		added = true;
+
+		if(mScanPos == mScanFiles.size())
+		{
+			mSystems.insert(mScanSystem);
+			mScanSystem = NULL;
+			mScanFiles.clear();
+			mScanFiles.shrink_to_fit();
+		}
+	}
+
+	if(added)
+		mGeneration++;
+}
+
+void PlayedIndex::onFileChanged(FileData* file, FileChangeType change)
+{
+	if(change != FILE_ADDED && change != FILE_METADATA_CHANGED)
+		return;
+
+	// not looked through yet, it'll be picked up as it is now
+	if(mSystems.find(file->getSystem()) == mSystems.end() && file->getSystem() != mScanSystem)
+		return;
+
+	if(file->getType() == GAME)
+	{
+		removeFile(file);
+		addFile(file);
+	}else if(change == FILE_ADDED)
+	{
+		file->visitRecursive(GAME, [this](FileData* game) { addFile(game); return true; });
+	}
+
+	mGeneration++;
+}
+
+void PlayedIndex::onFileDeleted(FileData* file)
+{
+	if(file->getSystem() == mScanSystem)
+		std::replace(mScanFiles.begin() + mScanPos, mScanFiles.end(), file, (FileData*)NULL);
+	else if(mSystems.find(file->getSystem()) == mSystems.end())
+		return;
+
+	removeFile(file);
+	mGeneration++;
+}
+
+void PlayedIndex::clear()
+{
+	mRecent.clear();
+	mMostPlayed.clear();
+	mEntries.clear();
+	mSystems.clear();
+	mScanSystem = NULL;
+	mScanFiles.clear();
+	mScanPos = 0;
+	mGeneration++;
+}
+
+bool PlayedIndex::isComplete() const
+{
+	if(SystemData::hasPendingSystems())
+		return false;
+
+	for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end(); it++)
+	{
+		if(mSystems.find(*it) == mSystems.end())
+			return false;
+	}
+	return true;
+}
+
+std::vector<FileData*> PlayedIndex::getRecentlyPlayed(unsigned int maxResults) const
+{
+	std::vector<FileData*> results;
+	for(auto it = mRecent.begin(); it != mRecent.end() && results.size() < maxResults; it++)
+		results.push_back(it->file);
+	return results;
+}
+
+std::vector<FileData*> PlayedIndex::getMostPlayed(unsigned int maxResults) const
+{
+	std::vector<FileData*> results;
+	for(auto it = mMostPlayed.begin(); it != mMostPlayed.end() && results.size() < maxResults; it++)
+		results.push_back(it->file);
+	return results;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <set>
+#include <vector>
+#include <unordered_map>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include "FileData.h"
+
+class SystemData;
+
+// The games of every system that were played, ordered by when they were last and by how often, for the
+// "recently played" and "most played" lists. Kept up to date from the changes ViewController sees (launchGame sets
+// "lastplayed" and "playcount" and reports them like any other metadata change), so a list is only as much work as
+// it is long. Systems are only looked through once, when they finish loading; the stats come from their gamelist and
+// play journal. Main thread only.
+class PlayedIndex
+{
+public:
+	static PlayedIndex* getInstance();
+
+	// Once a frame: adds the played games of systems that finished loading.
+	void update();
+
+	// Called by ViewController for every change, and by SystemData before it deletes a node of a loaded system.
+	void onFileChanged(FileData* file, FileChangeType change);
+	void onFileDeleted(FileData* file);
+
+	// Forgets every system, for when they're all about to be deleted.
+	void clear();
+
+	// false while some systems aren't loaded yet
+	bool isComplete() const;
+
+	// Changes whenever the lists could have changed.
+	inline unsigned int getGeneration() const { return mGeneration; }
+
+	// At most maxResults games, latest or most played first.
+	std::vector<FileData*> getRecentlyPlayed(unsigned int maxResults) const;
+	std::vector<FileData*> getMostPlayed(unsigned int maxResults) const;
+
+	inline unsigned int size() const { return mEntries.size(); }
+
+private:
+	PlayedIndex();
+
+	struct Entry
+	{
+		FileData* file;
+		boost::posix_time::ptime lastPlayed;
+		int playCount;
+	};
+
+	// later first, then more played, pointers break ties so every entry has its own place
+	struct RecentOrder
+	{
+		bool operator()(const Entry& a, const Entry& b) const;
+	};
+	// more played first, then later
+	struct MostPlayedOrder
+	{
+		bool operator()(const Entry& a, const Entry& b) const;
+	};
+
+	void addFile(FileData* file);
+	void removeFile(FileData* file);
+
+	std::set<Entry, RecentOrder> mRecent;
+	std::set<Entry, MostPlayedOrder> mMostPlayed;
+	std::unordered_map<FileData*, Entry> mEntries; // what each game was filed under
+	std::set<SystemData*> mSystems; // looked through already
+
+	// the system being looked through a few games per update, with its games (NULL once deleted) and how far it got
+	SystemData* mScanSystem;
+	std::vector<FileData*> mScanFiles;
+	size_t mScanPos;
+
+	unsigned int mGeneration;
+};
@@ -0,0 +1,169 @@
+#include "RomCache.h"
+#include "SystemData.h"
+#include "BinaryIO.h"
+#include "Log.h"
+#include "platform.h"
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <fstream>
+#include <stdint.h>
+#include <string.h>
+
+namespace fs = boost::filesystem;
+
+// bump this if the layout below changes
+static const char ROMCACHE_MAGIC[4] = { 'E', 'S', 'R', 'C' };
+static const uint32_t ROMCACHE_VERSION = 2; // 2: listings are in sort order
+
+// anything that changes what populateFolder() would pick up invalidates the whole cache
+static std::string getCacheKey(const SystemData* system)
+{
+	std::string key = system->getStartPath();
+	const std::vector<std::string>& extensions = system->getExtensions();
+	for(auto it = extensions.begin(); it != extensions.end(); it++)
+		key += " " + *it;
+
+	return key;
+}
+
+std::string getRomCachePath(const SystemData* system)
+{
+	return getHomePath() + "/.emulationstation/cache/" + system->getName() + ".romcache";
+}
+
+bool loadRomCache(const SystemData* system, RomCache& cache)
+{
+	cache.clear();
+
+	const std::string path = getRomCachePath(system);
+	std::ifstream in(path.c_str(), std::ios::in | std::ios::binary);
+	if(!in.is_open())
+		return false;
+
+	char magic[4];
+	uint32_t version, dirCount;
+	std::string key;
+	if(!in.read(magic, 4) || memcmp(magic, ROMCACHE_MAGIC, 4) != 0 || !readU32(in, version) || version != ROMCACHE_VERSION)
+	{
+		LOG(LogWarning) << "ROM cache \"" << path << "\" is from an incompatible version, ignoring it";
+		return false;
+	}
+
+	if(!readString(in, key) || key != getCacheKey(system))
+	{
+		LOG(LogInfo) << "ROM cache for system \"" << system->getName() << "\" is outdated (path or extensions changed)";
+		return false;
+	}
+
+	if(!readU32(in, dirCount))
+		return false;
+
+	for(uint32_t i = 0; i < dirCount; i++)
+	{
+		std::string dirPath;
+		int64_t mtime;
+		uint32_t entryCount;
+		if(!readString(in, dirPath) || !readI64(in, mtime) || !readU32(in, entryCount))
+		{
+			LOG(LogWarning) << "ROM cache \"" << path << "\" is truncated, ignoring it";
+			cache.clear();
+			return false;
+		}
+
+		RomCacheDir& dir = cache[dirPath];
+		dir.mtime = (std::time_t)mtime;
+		dir.entries.resize(entryCount);
+		for(uint32_t j = 0; j < entryCount; j++)
+		{
+			uint32_t type;
+			if(!readU32(in, type) || (type != GAME && type != FOLDER) || !readString(in, dir.entries[j].name))
+			{
+				LOG(LogWarning) << "ROM cache \"" << path << "\" is corrupt, ignoring it";
+				cache.clear();
+				return false;
+			}
+			dir.entries[j].type = (FileType)type;
+		}
+	}
+
+	return true;
+}
+
+void orderRomCache(FileData* folder, RomCache& cache)
+{
+	const std::vector<FileData*>& children = folder->getChildren();
+
+	auto dir = cache.find(folder->getPath().generic_string());
+	if(dir != cache.end())
+	{
+		std::unordered_map<std::string, size_t> position;
+		for(size_t i = 0; i < children.size(); i++)
+			position[children[i]->getFileName()] = i;
+
+		// whatever the tree doesn't have (any more) goes last
+		auto positionOf = [&position, &children](const RomCacheDir::Entry& entry) {
+			auto it = position.find(entry.name);
+			return it != position.end() ? it->second : children.size();
+		};
+		std::stable_sort(dir->second.entries.begin(), dir->second.entries.end(),
+			[&positionOf](const RomCacheDir::Entry& a, const RomCacheDir::Entry& b) { return positionOf(a) < positionOf(b); });
+	}
+
+	for(auto it = children.begin(); it != children.end(); it++)
+	{
+		if((*it)->getType() == FOLDER)
+			orderRomCache(*it, cache);
+	}
+}
+
+bool saveRomCache(const SystemData* system, const RomCache& cache)
+{
+	const fs::path path = getRomCachePath(system);
+	const fs::path tmpPath = path.generic_string() + ".tmp";
+
+	boost::system::error_code ec;
+	fs::create_directories(path.parent_path(), ec);
+
+	{
+		std::ofstream out(tmpPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if(!out.is_open())
+		{
+			LOG(LogError) << "Could not write ROM cache \"" << tmpPath.generic_string() << "\"";
+			return false;
+		}
+
+		out.write(ROMCACHE_MAGIC, 4);
+		writeU32(out, ROMCACHE_VERSION);
+		writeString(out, getCacheKey(system));
+		writeU32(out, cache.size());
+
+		for(auto it = cache.begin(); it != cache.end(); it++)
+		{
+			writeString(out, it->first);
+			writeI64(out, (int64_t)it->second.mtime);
+			writeU32(out, it->second.entries.size());
+			for(auto entry = it->second.entries.begin(); entry != it->second.entries.end(); entry++)
+			{
+				writeU32(out, entry->type);
+				writeString(out, entry->name);
+			}
+		}
+
+		if(!out.good())
+		{
+			LOG(LogError) << "Error writing ROM cache \"" << tmpPath.generic_string() << "\"";
+			return false;
+		}
+	}
+
+	// replace the old cache in one step so a crash never leaves a half-written file behind
+	fs::rename(tmpPath, path, ec);
+	if(ec)
+	{
+		LOG(LogError) << "Could not replace ROM cache \"" << path.generic_string() << "\": " << ec.message();
+		fs::remove(tmpPath, ec);
+		return false;
+	}
+
+	return true;
+}
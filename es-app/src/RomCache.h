@@ -0,0 +1,39 @@
+#pragma once
+
+#include <ctime>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "FileData.h"
+
+class SystemData;
+
+// A snapshot of what populateFolder() found in a single directory.
+struct RomCacheDir
+{
+	struct Entry
+	{
+		std::string name;
+		FileType type;
+	};
+
+	std::time_t mtime; // 0 means "don't trust this listing next time"
+	std::vector<Entry> entries; // saved in the order the sorted tree had them, see orderRomCache()
+};
+
+// Keyed by the generic string of the directory path.
+typedef std::unordered_map<std::string, RomCacheDir> RomCache;
+
+// Path of the binary ROM tree cache for a system (~/.emulationstation/cache/[name].romcache).
+std::string getRomCachePath(const SystemData* system);
+
+// Reads the cache for a system. Returns false (with an empty cache) if it is missing, corrupt
+// or was written for a different start path or extension list.
+bool loadRomCache(const SystemData* system, RomCache& cache);
+
+// Puts every listing below folder in the order folder's (sorted) children are in, so the next load adds them in an order
+// FileData::applySort() only has to check.
+void orderRomCache(FileData* folder, RomCache& cache);
+
+// Writes the cache for a system. Returns false on error.
+bool saveRomCache(const SystemData* system, const RomCache& cache);
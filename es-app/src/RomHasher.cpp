@@ -0,0 +1,348 @@
+#include "RomHasher.h"
+#include "FileData.h"
+#include "Settings.h"
+#include "Hash.h"
+#include "ArchiveIndex.h"
+#include "BinaryIO.h"
+#include "Log.h"
+#include "platform.h"
+#include <boost/filesystem/fstream.hpp>
+#include <fstream>
+#include <sstream>
+#include <string.h>
+
+namespace fs = boost::filesystem;
+
+// bump this if the layout below changes
+static const char ROMHASHES_MAGIC[4] = { 'E', 'S', 'R', 'H' };
+static const uint32_t ROMHASHES_VERSION = 1;
+
+#define HASH_CHUNK_SIZE (1024 * 1024)
+
+RomHasher* RomHasher::getInstance()
+{
+	static RomHasher instance;
+	return &instance;
+}
+
+RomHasher::RomHasher() : mBusy(0), mDirty(false), mCacheLoaded(false), mStop(false)
+{
+	mNextRead = std::chrono::steady_clock::now();
+}
+
+RomHasher::~RomHasher()
+{
+	// in case we exit without going through main's shutdown (the command line scraper)
+	stop();
+}
+
+std::string RomHasher::getCachePath()
+{
+	return getHomePath() + "/.emulationstation/cache/romhashes.cache";
+}
+
+void RomHasher::loadCache()
+{
+	if(mCacheLoaded)
+		return;
+	mCacheLoaded = true;
+
+	const std::string path = getCachePath();
+	std::ifstream in(path.c_str(), std::ios::in | std::ios::binary);
+	if(!in.is_open())
+		return;
+
+	char magic[4];
+	uint32_t version, count;
+	if(!in.read(magic, 4) || memcmp(magic, ROMHASHES_MAGIC, 4) != 0 || !readU32(in, version) || version != ROMHASHES_VERSION || !readU32(in, count))
+	{
+		LOG(LogWarning) << "ROM hash cache \"" << path << "\" is from an incompatible version, ignoring it";
+		return;
+	}
+
+	for(uint32_t i = 0; i < count; i++)
+	{
+		uint32_t len;
+		std::string file;
+		Entry entry;
+		uint64_t mtime;
+		if(!readU32(in, len) || len > 64 * 1024)
+			break;
+		file.resize(len);
+		if((len && !in.read(&file[0], len)) || !readU64(in, entry.size) || !readU64(in, mtime) || !readU32(in, entry.hashes.crc32)
+			|| !in.read((char*)entry.hashes.md5, 16) || !in.read((char*)entry.hashes.sha1, 20))
+		{
+			LOG(LogWarning) << "ROM hash cache \"" << path << "\" is truncated";
+			break;
+		}
+
+		entry.mtime = (int64_t)mtime;
+		entry.hashes.valid = true;
+		mCache[file] = entry;
+	}
+
+	LOG(LogInfo) << "Loaded " << mCache.size() << " ROM hashes";
+}
+
+void RomHasher::saveCache()
+{
+	// serialized under the lock, written without it
+	std::ostringstream out(std::ios::out | std::ios::binary);
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		if(!mDirty)
+			return;
+		mDirty = false;
+
+		out.write(ROMHASHES_MAGIC, 4);
+		writeU32(out, ROMHASHES_VERSION);
+		writeU32(out, mCache.size());
+		for(auto it = mCache.begin(); it != mCache.end(); it++)
+		{
+			writeU32(out, it->first.length());
+			out.write(it->first.data(), it->first.length());
+			writeU64(out, it->second.size);
+			writeU64(out, (uint64_t)it->second.mtime);
+			writeU32(out, it->second.hashes.crc32);
+			out.write((const char*)it->second.hashes.md5, 16);
+			out.write((const char*)it->second.hashes.sha1, 20);
+		}
+	}
+
+	// write and rename, so a crash never leaves half a cache behind
+	const std::string path = getCachePath();
+	const std::string tmpPath = path + ".tmp";
+	{
+		std::ofstream file(tmpPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		const std::string data = out.str();
+		if(!file.write(data.data(), data.size()))
+		{
+			LOG(LogError) << "Could not write ROM hash cache \"" << tmpPath << "\"";
+			return;
+		}
+	}
+
+	boost::system::error_code ec;
+	fs::rename(tmpPath, path, ec);
+	if(ec)
+		LOG(LogError) << "Could not replace ROM hash cache \"" << path << "\": " << ec.message();
+}
+
+bool RomHasher::statFile(const fs::path& path, uint64_t& size, int64_t& mtime)
+{
+	boost::system::error_code ec;
+	size = fs::file_size(path, ec);
+	if(ec)
+		return false;
+	mtime = fs::last_write_time(path, ec);
+	return !ec;
+}
+
+bool RomHasher::getHashes(const fs::path& path, RomHashes& out)
+{
+	// archives are matched by the CRCs in their directory, the workers only index them
+	if(ArchiveIndex::isArchive(path))
+	{
+		queue(path);
+		return false;
+	}
+
+	uint64_t size;
+	int64_t mtime;
+	if(!statFile(path, size, mtime))
+		return false;
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		loadCache();
+
+		auto it = mCache.find(path.generic_string());
+		if(it != mCache.end() && it->second.size == size && it->second.mtime == mtime)
+		{
+			out = it->second.hashes;
+			return true;
+		}
+	}
+
+	queue(path);
+	return false;
+}
+
+void RomHasher::queue(const fs::path& path)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	if(mStop)
+		return;
+
+	const std::string str = path.generic_string();
+	if(!mQueued.insert(str).second)
+		return;
+
+	mQueue.push_back(str);
+	mCondition.notify_one();
+
+	if(mWorkers.empty())
+	{
+		int count = Settings::getInstance()->getInt("HashThreads");
+		if(count < 1)
+			count = 1;
+		for(int i = 0; i < count; i++)
+			mWorkers.push_back(std::thread(&RomHasher::runWorker, this));
+	}
+}
+
+void RomHasher::queueFolder(FileData* folder)
+{
+	std::vector<fs::path> paths;
+	folder->visitRecursive(GAME, [&paths](FileData* game) {
+		paths.push_back(game->getPath());
+		return true;
+	});
+
+	for(auto it = paths.begin(); it != paths.end(); it++)
+		queue(*it);
+}
+
+void RomHasher::throttle(size_t bytes)
+{
+	static const SettingHandle<int> limit = Settings::getInstance()->getIntHandle("HashReadLimit");
+	const int mbPerSecond = limit;
+	if(mbPerSecond <= 0)
+		return;
+
+	// every worker books the bytes it just read in one shared schedule, so the limit holds for all of them together;
+	// sleeping to the end of the booked slot keeps the next read from starting early
+	const std::chrono::duration<double> cost(bytes / (mbPerSecond * 1024.0 * 1024.0));
+	std::chrono::steady_clock::time_point end;
+	{
+		std::lock_guard<std::mutex> lock(mThrottleMutex);
+		const std::chrono::steady_clock::time_point start = std::max(std::chrono::steady_clock::now(), mNextRead);
+		end = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(cost);
+		mNextRead = end;
+	}
+	std::this_thread::sleep_until(end);
+}
+
+bool RomHasher::hashFile(const fs::path& path, RomHashes& out, const std::atomic<bool>* stop)
+{
+	fs::ifstream file(path, std::ios::in | std::ios::binary);
+	if(!file.is_open())
+		return false;
+
+	uint32_t crc = 0;
+	Md5 md5;
+	Sha1 sha1;
+
+	std::vector<char> buffer(HASH_CHUNK_SIZE);
+	while(file)
+	{
+		if(stop && *stop)
+			return false;
+
+		file.read(buffer.data(), buffer.size());
+		const size_t len = (size_t)file.gcount();
+		throttle(len);
+
+		crc = crc32Update(crc, buffer.data(), len);
+		md5.update(buffer.data(), len);
+		sha1.update(buffer.data(), len);
+	}
+
+	if(file.bad())
+		return false;
+
+	out.crc32 = crc;
+	md5.finish(out.md5);
+	sha1.finish(out.sha1);
+	out.valid = true;
+	return true;
+}
+
+void RomHasher::runWorker()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	while(true)
+	{
+		mCondition.wait(lock, [this] { return mStop || !mQueue.empty(); });
+		if(mStop)
+			return;
+
+		const std::string path = mQueue.front();
+		mQueue.pop_front();
+		mBusy++;
+		loadCache();
+
+		lock.unlock();
+
+		if(ArchiveIndex::isArchive(path))
+		{
+			ArchiveIndex::getInstance()->getContents(path);
+			lock.lock();
+			mQueued.erase(path);
+			mBusy--;
+
+			if(mQueue.empty() && mBusy == 0)
+			{
+				lock.unlock();
+				ArchiveIndex::getInstance()->save();
+				lock.lock();
+			}
+			continue;
+		}
+
+		uint64_t size;
+		int64_t mtime;
+		bool needed = statFile(path, size, mtime);
+		if(needed)
+		{
+			std::lock_guard<std::mutex> check(mMutex);
+			auto it = mCache.find(path);
+			needed = it == mCache.end() || it->second.size != size || it->second.mtime != mtime;
+		}
+
+		Entry entry;
+		const bool hashed = needed && hashFile(path, entry.hashes, &mStop);
+		if(hashed)
+		{
+			entry.size = size;
+			entry.mtime = mtime;
+		}else if(needed && !mStop)
+		{
+			LOG(LogWarning) << "Could not hash \"" << path << "\"";
+		}
+
+		lock.lock();
+		if(hashed)
+		{
+			mCache[path] = entry;
+			mDirty = true;
+		}
+		mQueued.erase(path);
+		mBusy--;
+
+		// caught up, a good time to write what we have
+		if(mQueue.empty() && mBusy == 0 && mDirty)
+		{
+			lock.unlock();
+			saveCache();
+			lock.lock();
+		}
+	}
+}
+
+void RomHasher::stop()
+{
+	std::vector<std::thread> workers;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStop = true;
+		mCondition.notify_all();
+		workers.swap(mWorkers);
+	}
+
+	for(auto it = workers.begin(); it != workers.end(); it++)
+		it->join();
+
+	saveCache();
+	ArchiveIndex::getInstance()->save();
+}
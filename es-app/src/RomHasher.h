@@ -0,0 +1,83 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+#include <boost/filesystem.hpp>
+
+class FileData;
+
+struct RomHashes
+{
+	RomHashes() : valid(false), crc32(0) {}
+
+	bool valid;
+	uint32_t crc32;
+	uint8_t md5[16];
+	uint8_t sha1[20];
+};
+
+// Hashes ROMs (CRC32, MD5 and SHA1 in one read) on a few worker threads, at most "HashReadLimit" MB/s so it doesn't
+// starve the UI or the emulator of disk time. Results are kept in ~/.emulationstation/cache/romhashes.cache by
+// path, size and mtime, so a file is only ever read again if it changed.
+class RomHasher
+{
+public:
+	static RomHasher* getInstance();
+
+	// true with the hashes if they're known for the file as it is now, otherwise it's queued and this returns false.
+	// Costs a stat, never reads the file. Any thread.
+	bool getHashes(const boost::filesystem::path& path, RomHashes& out);
+
+	// Hashes these (unless they're cached already) in the background, in order. Any thread.
+	void queue(const boost::filesystem::path& path);
+	void queueFolder(FileData* folder); // every game in it
+
+	// Waits for the workers and writes the cache, call before exiting.
+	void stop();
+
+	// Reads the whole file, false if it couldn't. Stops early (returning false) once stop is set.
+	bool hashFile(const boost::filesystem::path& path, RomHashes& out, const std::atomic<bool>* stop);
+
+private:
+	RomHasher();
+	~RomHasher();
+
+	struct Entry
+	{
+		uint64_t size;
+		int64_t mtime;
+		RomHashes hashes;
+	};
+
+	static std::string getCachePath();
+	void loadCache();
+	void saveCache();
+	bool statFile(const boost::filesystem::path& path, uint64_t& size, int64_t& mtime);
+
+	void runWorker();
+	void throttle(size_t bytes);
+
+	std::mutex mMutex;
+	std::condition_variable mCondition;
+	std::unordered_map<std::string, Entry> mCache; // by generic path
+	std::deque<std::string> mQueue;
+	std::unordered_set<std::string> mQueued; // in mQueue or being hashed
+	unsigned int mBusy; // workers in the middle of a file
+	bool mDirty;
+	bool mCacheLoaded;
+
+	std::vector<std::thread> mWorkers;
+	std::atomic<bool> mStop;
+
+	std::mutex mThrottleMutex;
+	std::chrono::steady_clock::time_point mNextRead;
+};
@@ -0,0 +1,309 @@
+#include "RomWatcher.h"
+#include "SystemData.h"
+#include "FileSorts.h"
+#include "Settings.h"
+#include "Log.h"
+#include "views/ViewController.h"
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+namespace fs = boost::filesystem;
+
+#ifdef __linux__
+// a file is only picked up once it's complete, IN_CREATE is just for directories (which never get IN_CLOSE_WRITE)
+static const uint32_t WATCH_MASK = IN_CREATE | IN_CLOSE_WRITE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+#endif
+
+RomWatcher* RomWatcher::getInstance()
+{
+	static RomWatcher instance;
+	return &instance;
+}
+
+RomWatcher::RomWatcher() : mFd(-1)
+{
+}
+
+RomWatcher::~RomWatcher()
+{
+	stop();
+}
+
+void RomWatcher::start()
+{
+	stop();
+
+	if(!Settings::getInstance()->getBool("WatchRomFolders"))
+		return;
+
+#ifdef __linux__
+	mFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if(mFd < 0)
+	{
+		LOG(LogWarning) << "Could not start watching ROM folders (inotify_init1 failed, errno " << errno << ")";
+		return;
+	}
+
+	watchLoadedSystems();
+
+	LOG(LogInfo) << "Watching " << mWatches.size() << " ROM folders for changes";
+#endif
+}
+
+void RomWatcher::stop()
+{
+#ifdef __linux__
+	if(mFd >= 0)
+		close(mFd); // drops all the watches with it
+#endif
+
+	mFd = -1;
+	mWatches.clear();
+	mFolderWatches.clear();
+	mPathWatches.clear();
+	mWatchedSystems.clear();
+}
+
+void RomWatcher::watchLoadedSystems()
+{
+	for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end(); it++)
+	{
+		if((*it)->isLoaded() && mWatchedSystems.insert(*it).second)
+			watchFolder(*it, (*it)->getRootFolder());
+	}
+}
+
+void RomWatcher::watchFolder(SystemData* system, FileData* folder)
+{
+	WatchedDir dir = { system, folder, folder->getParent(), folder->getPath() };
+	watchDir(dir);
+
+	const std::vector<FileData*>& children = folder->getChildren();
+	for(auto it = children.begin(); it != children.end(); it++)
+	{
+		if((*it)->getType() == FOLDER)
+			watchFolder(system, *it);
+	}
+}
+
+void RomWatcher::watchDir(const WatchedDir& dir)
+{
+#ifdef __linux__
+	if(mFd < 0)
+		return;
+
+	// several systems can share a folder, inotify hands back the same watch for it so only the first one gets it
+	const std::string pathStr = dir.path.generic_string();
+	if(mPathWatches.find(pathStr) != mPathWatches.end())
+		return;
+
+	int wd = inotify_add_watch(mFd, pathStr.c_str(), WATCH_MASK);
+	if(wd < 0)
+	{
+		LOG(LogWarning) << "Could not watch \"" << pathStr << "\" for changes (errno " << errno << ")";
+		return;
+	}
+
+	mWatches[wd] = dir;
+	mPathWatches[pathStr] = wd;
+	if(dir.folder)
+		mFolderWatches[dir.folder] = wd;
+#endif
+}
+
+void RomWatcher::unwatchFolder(FileData* folder)
+{
+	const std::vector<FileData*>& children = folder->getChildren();
+	for(auto it = children.begin(); it != children.end(); it++)
+	{
+		if((*it)->getType() == FOLDER)
+			unwatchFolder(*it);
+	}
+
+	auto it = mFolderWatches.find(folder);
+	if(it == mFolderWatches.end())
+		return;
+
+#ifdef __linux__
+	inotify_rm_watch(mFd, it->second);
+#endif
+	mPathWatches.erase(mWatches[it->second].path.generic_string());
+	mWatches.erase(it->second);
+	mFolderWatches.erase(it);
+}
+
+void RomWatcher::update()
+{
+#ifdef __linux__
+	if(mFd < 0)
+		return;
+
+	if(mWatchedSystems.size() != SystemData::sSystemVector.size())
+		watchLoadedSystems();
+
+	char buffer[16 * 1024] __attribute__((aligned(__alignof__(struct inotify_event))));
+	while(true)
+	{
+		ssize_t len = read(mFd, buffer, sizeof(buffer));
+		if(len <= 0)
+			break; // EAGAIN, nothing (more) to do
+
+		for(char* ptr = buffer; ptr < buffer + len; )
+		{
+			const struct inotify_event* event = (const struct inotify_event*)ptr;
+			ptr += sizeof(struct inotify_event) + event->len;
+
+			if(event->mask & IN_Q_OVERFLOW)
+			{
+				LOG(LogWarning) << "Too many ROM folder changes at once, some were missed (reload to pick them up)";
+				continue;
+			}
+
+			auto it = mWatches.find(event->wd);
+			if(it == mWatches.end())
+				continue;
+
+			if(event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED))
+			{
+				// the folder itself is gone, its parent's watch reports it as removed
+				if(!it->second.folder)
+				{
+					mPathWatches.erase(it->second.path.generic_string());
+					mWatches.erase(it);
+				}
+				continue;
+			}
+
+			if(!event->len)
+				continue;
+
+			// a ROM that's still being copied in shows up when it's closed (or moved in from elsewhere, all at once)
+			const bool added = (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) || ((event->mask & IN_CREATE) && (event->mask & IN_ISDIR));
+			const bool removed = (event->mask & (IN_DELETE | IN_MOVED_FROM)) != 0;
+			if(!added && !removed)
+				continue;
+
+			if(!it->second.folder)
+			{
+				// something changed in a directory we're not listing, see if it has games now
+				onPendingChanged(event->wd);
+				continue;
+			}
+
+			if(added)
+				onAdded(it->second, event->name);
+			else
+				onRemoved(it->second, event->name);
+		}
+	}
+#endif
+}
+
+void RomWatcher::onAdded(WatchedDir& dir, const std::string& name)
+{
+	const fs::path path = dir.path / name;
+	FileData* file = dir.system->addFileFromDisk(dir.folder, path);
+	if(!file)
+	{
+		// an empty directory gets watched anyway, so we notice when games are copied into it
+		boost::system::error_code ec;
+		if(fs::is_directory(path, ec))
+		{
+			WatchedDir pending = { dir.system, NULL, dir.folder, path };
+			watchDir(pending);
+		}
+		return;
+	}
+
+	LOG(LogInfo) << "ROM folder change: added \"" << path.generic_string() << "\"";
+
+	if(file->getType() == FOLDER)
+		watchFolder(dir.system, file);
+
+	// back into the tree's own order (the one it was loaded in), each view puts it where its own sort wants it
+	dir.folder->sort(FileSorts::SortTypes.at(0));
+	ViewController::get()->onFileChanged(file, FILE_ADDED);
+}
+
+void RomWatcher::onRemoved(WatchedDir& dir, const std::string& name)
+{
+	FileData* folder = dir.folder;
+	FileData* file = folder->findChild(name);
+	if(!file)
+	{
+		// maybe it was a directory we were only keeping an eye on
+		auto pending = mPathWatches.find((dir.path / name).generic_string());
+		if(pending != mPathWatches.end() && !mWatches[pending->second].folder)
+		{
+#ifdef __linux__
+			inotify_rm_watch(mFd, pending->second);
+#endif
+			mWatches.erase(pending->second);
+			mPathWatches.erase(pending);
+		}
+		return;
+	}
+
+	SystemData* system = dir.system;
+
+	// the views can't show a system without any games
+	unsigned int removedGames = (file->getType() == GAME) ? 1 : file->getGameCount();
+	if(system->getGameCount() <= removedGames)
+	{
+		LOG(LogWarning) << "ROM folder change: \"" << file->getPath().generic_string() << "\" removed, but it's all " << system->getName() << " has left, keeping it listed";
+		return;
+	}
+
+	LOG(LogInfo) << "ROM folder change: removed \"" << file->getPath().generic_string() << "\"";
+
+	if(file->getType() == FOLDER)
+		unwatchFolder(file);
+
+	folder->removeChild(file);
+	ViewController::get()->onFileChanged(file, FILE_REMOVED);
+
+	// destroy the whole subtree, children first
+	std::vector<FileData*> subtree = file->getFilesRecursive(GAME | FOLDER);
+	for(auto it = subtree.rbegin(); it != subtree.rend(); it++)
+		system->deleteFileData(*it);
+	system->deleteFileData(file);
+
+	// the folder we removed it from might not have any games left
+	while(folder != system->getRootFolder() && folder->getChildren().empty())
+	{
+		FileData* parent = folder->getParent();
+		unwatchFolder(folder);
+		parent->removeChild(folder);
+		ViewController::get()->onFileChanged(folder, FILE_REMOVED);
+
+		// keep watching it in case games come back
+		WatchedDir pendingDir = { system, NULL, parent, folder->getPath() };
+		system->deleteFileData(folder);
+		watchDir(pendingDir);
+
+		folder = parent;
+	}
+}
+
+void RomWatcher::onPendingChanged(int wd)
+{
+	WatchedDir dir = mWatches[wd];
+
+	// the directory we'd add it to could have gone away in the meantime
+	if(mFolderWatches.find(dir.parent) == mFolderWatches.end())
+		return;
+
+	// watchFolder() will want this path for the real folder
+	mPathWatches.erase(dir.path.generic_string());
+	mWatches.erase(wd);
+
+#ifdef __linux__
+	inotify_rm_watch(mFd, wd);
+#endif
+
+	onAdded(mWatches[mFolderWatches[dir.parent]], dir.path.filename().string());
+}
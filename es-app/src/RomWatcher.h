@@ -0,0 +1,51 @@
+#pragma once
+
+#include <map>
+#include <set>
+#include <boost/filesystem.hpp>
+
+class SystemData;
+class FileData;
+
+// Watches the ROM folders of every loaded system and applies files being added or removed to the
+// FileData trees as it happens (notifying the ViewController), so new ROMs show up without a full reload.
+// Only implemented with inotify for now; on other platforms start() does nothing.
+class RomWatcher
+{
+public:
+	static RomWatcher* getInstance();
+
+	// (Re)builds the watch list from SystemData::sSystemVector. Call stop() before deleting the systems.
+	void start();
+	void stop();
+
+	// Applies any pending changes, call once per frame from the main thread. Never blocks.
+	void update();
+
+private:
+	RomWatcher();
+	~RomWatcher();
+
+	struct WatchedDir
+	{
+		SystemData* system;
+		FileData* folder; // NULL if the directory isn't in the tree (yet) because it has no games in it
+		FileData* parent; // the folder it would be added to if it gets some
+		boost::filesystem::path path;
+	};
+
+	void watchLoadedSystems();
+	void watchFolder(SystemData* system, FileData* folder);
+	void watchDir(const WatchedDir& dir);
+	void unwatchFolder(FileData* folder);
+
+	void onAdded(WatchedDir& dir, const std::string& name);
+	void onRemoved(WatchedDir& dir, const std::string& name);
+	void onPendingChanged(int wd);
+
+	int mFd;
+	std::map<int, WatchedDir> mWatches;
+	std::map<FileData*, int> mFolderWatches;
+	std::map<std::string, int> mPathWatches;
+	std::set<SystemData*> mWatchedSystems; // systems that are loaded lazily are watched once they're loaded
+};
@@ -0,0 +1,77 @@
+#include "ScrapeJournal.h"
+#include "FileData.h"
+#include "Log.h"
+#include "platform.h"
+#include <boost/filesystem.hpp>
+
+namespace fs = boost::filesystem;
+
+std::string ScrapeJournal::getPath()
+{
+	return getHomePath() + "/.emulationstation/scrape.journal";
+}
+
+ScrapeJournal::ScrapeJournal(const std::string& key) : mKey(key)
+{
+	const std::string path = getPath();
+
+	std::ifstream in(path.c_str());
+	if(in.is_open())
+	{
+		std::string line;
+		if(std::getline(in, line) && line == mKey)
+		{
+			while(std::getline(in, line))
+			{
+				if(!line.empty())
+					mDone.insert(line);
+			}
+		}
+		in.close();
+	}
+
+	// rewrite it so a journal left over from another batch doesn't linger
+	mOut.open(path.c_str(), std::ios::out | std::ios::trunc);
+	if(!mOut.is_open())
+	{
+		LOG(LogWarning) << "Could not write scrape journal \"" << path << "\", an interrupted scrape will start over";
+		return;
+	}
+
+	mOut << mKey << "\n";
+	for(auto it = mDone.begin(); it != mDone.end(); it++)
+		mOut << *it << "\n";
+	mOut.flush();
+
+	if(!mDone.empty())
+		LOG(LogInfo) << "Resuming scrape, " << mDone.size() << " games were already done";
+}
+
+bool ScrapeJournal::isDone(const FileData* game) const
+{
+	return mDone.find(game->getPath().generic_string()) != mDone.end();
+}
+
+void ScrapeJournal::markDone(const FileData* game)
+{
+	const std::string path = game->getPath().generic_string();
+	if(!mDone.insert(path).second)
+		return;
+
+	if(mOut.is_open())
+	{
+		mOut << path << "\n";
+		mOut.flush(); // this is the point of the journal, a crash shouldn't lose it
+	}
+}
+
+void ScrapeJournal::finish()
+{
+	if(mOut.is_open())
+		mOut.close();
+
+	mDone.clear();
+
+	boost::system::error_code ec;
+	fs::remove(getPath(), ec);
+}
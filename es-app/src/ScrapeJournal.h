@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+#include <fstream>
+#include <unordered_set>
+
+class FileData;
+
+// Remembers which games of a batch scrape have already been handled (scraped or skipped), one path per line
+// in ~/.emulationstation/scrape.journal, flushed after every game. Starting the same batch again (same key)
+// after a crash or STOP leaves those games out; a journal for a different batch is thrown away.
+class ScrapeJournal
+{
+public:
+	// key describes the batch (filter, systems...), anything that changes it starts from scratch.
+	ScrapeJournal(const std::string& key);
+
+	bool isDone(const FileData* game) const;
+	inline unsigned int getDoneCount() const { return (unsigned int)mDone.size(); }
+
+	void markDone(const FileData* game);
+
+	// The whole batch went through, the next one starts from scratch.
+	void finish();
+
+private:
+	static std::string getPath();
+
+	std::string mKey;
+	std::unordered_set<std::string> mDone;
+	std::ofstream mOut;
+};
@@ -1,285 +1,367 @@
 #include "ScraperCmdLine.h"
 #include <iostream>
+#include <fstream>
+#include <sstream>
 #include <vector>
+#include <deque>
+#include <memory>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <string.h>
 #include "SystemData.h"
 #include "Settings.h"
+#include "Gamelist.h"
+#include "ScrapeJournal.h"
+#include "RomHasher.h"
+#include "scrapers/Scraper.h"
+#include "Util.h"
+#include "TaskScheduler.h"
 #include <signal.h>
 #include "Log.h"
 
-std::ostream& out = std::cout;
+#define HASH_WAIT_MAX 60 // s a game waits for its ROM's hash with ACCEPT_HASH_MATCH before it's searched by name only
+#define MAIN_THREAD_BUDGET 100 // ms per turn of the loop for TaskScheduler jobs, nothing's waiting on a frame here
 
-void handle_interrupt_signal(int p)
-{
-	sleep(50);
+std::ostream& out = std::cout;
 
-	LOG(LogInfo) << "Interrupt received during scrape...";
+typedef std::chrono::steady_clock Clock;
 
-	SystemData::deleteSystems();
+static volatile sig_atomic_t sInterrupted = 0;
 
-	exit(1);
+void handle_interrupt_signal(int p)
+{
+	// the main loop stops at the next game, the games that are done are already saved
+	sInterrupted = 1;
 }
 
-int run_scraper_cmdline()
+namespace
 {
-	out << "EmulationStation scraper\n";
-	out << "========================\n";
-	out << "\n";
-
-	signal(SIGINT, handle_interrupt_signal);
-
-	//==================================================================================
-	//filter
-	//==================================================================================
-	enum FilterChoice
+	struct Job
 	{
-		FILTER_MISSING_IMAGES,
-		FILTER_ALL
+		ScraperSearchParams search;
+		Clock::time_point queued;
+		std::unique_ptr<ScraperSearchHandle> searchHandle;
+		std::unique_ptr<MDResolveHandle> resolveHandle;
+		bool hashMatch;
 	};
 
-	int filter_choice;
-	do {
-		out << "Select filter for games to be scraped:\n";
-		out << FILTER_MISSING_IMAGES << " - games missing images\n";
-		out << FILTER_ALL << " - all games period, can overwrite existing metadata\n";
-
-		std::cin >> filter_choice;
-		std::cin.ignore(1, '\n'); //skip the unconsumed newline
-	} while(filter_choice < FILTER_MISSING_IMAGES || filter_choice > FILTER_ALL);
+	class BatchScrape
+	{
+	public:
+		BatchScrape(const ScraperCmdLineOptions& options, unsigned int total, ScrapeJournal* journal, std::ostream* results) :
+			mOptions(options), mTotal(total), mJournal(journal), mResults(results), mDone(0), mScraped(0), mSkipped(0), mFailed(0) {};
+
+		void update(Job& job, bool& done);
+
+		inline unsigned int getDoneCount() const { return mDone; }
+		inline unsigned int getScrapedCount() const { return mScraped; }
+		inline unsigned int getSkippedCount() const { return mSkipped; }
+		inline unsigned int getFailedCount() const { return mFailed; }
+
+	private:
+		void save(Job& job, const ScraperSearchResult& result);
+		void report(const Job& job, const char* status, const std::string& detail);
+
+		const ScraperCmdLineOptions& mOptions;
+		unsigned int mTotal;
+		ScrapeJournal* mJournal;
+		std::ostream* mResults;
+
+		unsigned int mDone;
+		unsigned int mScraped;
+		unsigned int mSkipped;
+		unsigned int mFailed;
+	};
+}
 
-	out << "\n";
+void BatchScrape::update(Job& job, bool& done)
+{
+	done = false;
 
-	//==================================================================================
-	//platforms
-	//==================================================================================
+	if(!job.searchHandle && !job.resolveHandle)
+	{
+		// startScraperSearch() only uses the hashes if they're known by then
+		RomHashes hashes;
+		if(mOptions.accept != ScraperCmdLineOptions::ACCEPT_HASH_MATCH || RomHasher::getInstance()->getHashes(job.search.game->getPath(), hashes)
+			|| Clock::now() - job.queued > std::chrono::seconds(HASH_WAIT_MAX))
+			job.searchHandle = startScraperSearch(job.search);
+		return;
+	}
 
-	std::vector<SystemData*> systems;
+	if(job.searchHandle)
+	{
+		const AsyncHandleStatus status = job.searchHandle->status();
+		if(status == ASYNC_IN_PROGRESS)
+			return;
 
-	out << "You can scrape only specific platforms, or scrape all of them.\n";
-	out << "Would you like to scrape all platforms? (y/n)\n";
+		if(status == ASYNC_ERROR)
+		{
+			report(job, "error", job.searchHandle->getStatusString());
+			mFailed++;
+			done = true;
+			return; // not marked done, so the next run tries it again
+		}
 
-	std::string system_choice;
-	std::getline(std::cin, system_choice);
-	
-	if(system_choice == "y" || system_choice == "Y")
-	{
-		out << "Will scrape all platforms.\n";
-		for(auto i = SystemData::sSystemVector.begin(); i != SystemData::sSystemVector.end(); i++)
+		const std::vector<ScraperSearchResult>& results = job.searchHandle->getResults();
+		if(results.empty())
+		{
+			report(job, "no-results", "");
+			mSkipped++;
+			done = true;
+		}else if(mOptions.accept == ScraperCmdLineOptions::ACCEPT_HASH_MATCH && (results.size() != 1 || !results.front().hashMatch))
 		{
-			out << "   " << (*i)->getName() << " (" << (*i)->getGameCount() << " games)\n";
-			systems.push_back(*i);
+			report(job, "no-match", results.front().mdl.get("name"));
+			mSkipped++;
+			done = true;
+		}else{
+			job.hashMatch = results.front().hashMatch;
+			if(results.front().imageUrl.empty())
+			{
+				save(job, results.front());
+				done = true;
+			}else{
+				// resolve the image before saving
+				job.resolveHandle = resolveMetaDataAssets(results.front(), job.search);
+			}
 		}
 
+		job.searchHandle.reset();
+		if(done && mJournal)
+			mJournal->markDone(job.search.game);
+		return;
+	}
+
+	const AsyncHandleStatus status = job.resolveHandle->status();
+	if(status == ASYNC_IN_PROGRESS)
+		return;
+
+	if(status == ASYNC_DONE)
+	{
+		save(job, job.resolveHandle->getResult());
+		if(mJournal)
+			mJournal->markDone(job.search.game);
 	}else{
-		std::string sys_name;
+		report(job, "error", "downloading media: " + job.resolveHandle->getStatusString());
+		mFailed++;
+	}
 
-		out << "Enter the names of the platforms you would like to scrape, one at a time.\n";
-		out << "Type nothing and press enter when you are ready to continue.\n";
+	job.resolveHandle.reset();
+	done = true;
+}
 
-		do {
-			for(auto i = SystemData::sSystemVector.begin(); i != SystemData::sSystemVector.end(); i++)
-			{
-				if(std::find(systems.begin(), systems.end(), (*i)) != systems.end())
-					out << " C ";
-				else
-					out << "   ";
+void BatchScrape::save(Job& job, const ScraperSearchResult& result)
+{
+	const ScraperSearchParams& search = job.search;
+	search.game->metadata = result.mdl;
+	if(search.game->getParent())
+		search.game->getParent()->invalidateSort();
+	if(!search.game->getThumbnailPath().empty())
+		search.system->setHasImages();
+	updateGamelist(search.system);
+
+	report(job, "scraped", result.mdl.get("name"));
+	mScraped++;
+}
 
-				out << "\"" << (*i)->getName() << "\" (" << (*i)->getGameCount() << " games)\n";
-			}
+void BatchScrape::report(const Job& job, const char* status, const std::string& detail)
+{
+	mDone++;
+
+	const std::string file = job.search.game->getPath().filename().string();
+	out << "[" << mDone << "/" << mTotal << "] " << job.search.system->getName() << ": " << file << " - " << status;
+	if(!detail.empty())
+		out << " (" << detail << ")";
+	if(job.hashMatch)
+		out << " [hash]";
+	out << std::endl;
+
+	if(!mResults)
+		return;
+
+	const bool scraped = strcmp(status, "scraped") == 0;
+	*mResults << "{\"system\":";
+	writeJSONString(*mResults, job.search.system->getName());
+	*mResults << ",\"path\":";
+	writeJSONString(*mResults, job.search.game->getPath().generic_string());
+	*mResults << ",\"status\":\"" << status << "\"";
+	if(!detail.empty())
+	{
+		*mResults << (scraped ? ",\"name\":" : (strcmp(status, "no-match") == 0 ? ",\"bestResult\":" : ",\"error\":"));
+		writeJSONString(*mResults, detail);
+	}
+	if(scraped)
+		*mResults << ",\"hashMatch\":" << (job.hashMatch ? "true" : "false");
+	*mResults << "}" << std::endl;
+}
+
+int run_scraper_cmdline(const ScraperCmdLineOptions& options)
+{
+	out << "EmulationStation scraper\n";
+	out << "========================\n";
+	out << "\n";
 
-			std::getline(std::cin, sys_name);
-			
-			if(sys_name.empty())
-				break;
+	signal(SIGINT, handle_interrupt_signal);
+	signal(SIGTERM, handle_interrupt_signal);
 
-			bool found = false;
-			for(auto i = SystemData::sSystemVector.begin(); i != SystemData::sSystemVector.end(); i++)
+	//==================================================================================
+	//systems
+	//==================================================================================
+	std::vector<SystemData*> systems;
+	if(options.systems.empty())
+	{
+		// the same ones the scrape menu starts with
+		for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end(); it++)
+		{
+			if(!(*it)->getPlatformIds().empty() && !(*it)->hasPlatformId(PlatformIds::PLATFORM_IGNORE))
+				systems.push_back(*it);
+		}
+	}else{
+		for(auto name = options.systems.begin(); name != options.systems.end(); name++)
+		{
+			auto found = std::find_if(SystemData::sSystemVector.begin(), SystemData::sSystemVector.end(),
+				[&](SystemData* sys) { return sys->getName() == *name; });
+			if(found == SystemData::sSystemVector.end())
 			{
-				if((*i)->getName() == sys_name)
-				{
-					systems.push_back(*i);
-					found = true;
-					break;
-				}
+				std::cerr << "No system named \"" << *name << "\". Systems:";
+				for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end(); it++)
+					std::cerr << " " << (*it)->getName();
+				std::cerr << "\n";
+				return 1;
 			}
 
-			if(!found)
-				out << "System not found.\n";
+			if((*found)->getPlatformIds().empty())
+				out << "Warning: \"" << *name << "\" has no platform set, results may be even more inaccurate than usual!\n";
+			if(std::find(systems.begin(), systems.end(), *found) == systems.end())
+				systems.push_back(*found);
+		}
+	}
 
-		} while(true);
+	if(systems.empty())
+	{
+		std::cerr << "No systems to scrape.\n";
+		return 1;
 	}
 
 	//==================================================================================
-	//manual mode
+	//games
 	//==================================================================================
 
-	out << "\n";
-	out << "You can let the scraper try to automatically choose the best result, or\n";
-	out << "you can manually approve each result. This \"manual mode\" is much more accurate.\n";
-	out << "It is highly recommended you use manual mode unless you have a very large collection.\n";
-	out << "Scrape in manual mode? (y/n)\n";
+	// the same options started again pick up where the last run stopped
+	std::stringstream key;
+	key << "cmdline|" << Settings::getInstance()->getString("Scraper") << "|" << options.filter << "|" << options.accept;
+	for(auto it = systems.begin(); it != systems.end(); it++)
+		key << "|" << (*it)->getName();
+	ScrapeJournal journal(key.str());
+
+	std::deque<ScraperSearchParams> searches;
+	for(auto sys = systems.begin(); sys != systems.end(); sys++)
+	{
+		SystemData* system = *sys;
+		system->getRootFolder()->visitRecursive(GAME, [&](FileData* game) {
+			if(options.filter == ScraperCmdLineOptions::FILTER_MISSING_IMAGE && !game->metadata.get("image").empty())
+				return true;
+			if(journal.isDone(game))
+				return true;
+
+			ScraperSearchParams search;
+			search.game = game;
+			search.system = system;
+			search.bulk = true;
+			searches.push_back(search);
+
+			// the games further down get hashed while the first ones are being scraped
+			RomHasher::getInstance()->queue(game->getPath());
+			return true;
+		});
+
+		out << "   " << system->getName() << " (" << system->getGameCount() << " games)\n";
+	}
 
-	std::string manual_mode_str;
-	std::getline(std::cin, manual_mode_str);
+	if(journal.getDoneCount())
+		out << journal.getDoneCount() << " games were already done by an earlier run with these options.\n";
 
-	bool manual_mode = false;
+	if(searches.empty())
+	{
+		out << "No games to scrape.\n";
+		journal.finish();
+		return 0;
+	}
 
-	if(manual_mode_str == "y" || manual_mode_str == "Y")
+	std::unique_ptr<std::ofstream> resultsFile;
+	if(!options.resultsPath.empty())
 	{
-		manual_mode = true;
-		out << "Scraping in manual mode!\n";
-	}else{
-		out << "Scraping in automatic mode!\n";
+		resultsFile.reset(new std::ofstream(options.resultsPath.c_str(), std::ios::out | std::ios::trunc));
+		if(!resultsFile->is_open())
+		{
+			std::cerr << "Could not open \"" << options.resultsPath << "\" for the results.\n";
+			return 1;
+		}
 	}
 
+	unsigned int concurrency = options.concurrency;
+	if(concurrency == 0)
+		concurrency = (unsigned int)std::max(1, Settings::getInstance()->getInt("ScraperConcurrency"));
+
+	out << "\n";
+	out << "Scraping " << searches.size() << " games, " << concurrency << " at a time\n";
+	out << "=============================\n";
+
 	//==================================================================================
 	//scraping
 	//==================================================================================
-	out << "\n";
-	out << "Alright, let's do this thing!\n";
-	out << "=============================\n";
+	const unsigned int total = (unsigned int)searches.size();
+	BatchScrape batch(options, total, &journal, resultsFile.get());
+	std::vector< std::unique_ptr<Job> > jobs;
 
-	/*
-	std::shared_ptr<Scraper> scraper = Settings::getInstance()->getScraper();
-	for(auto sysIt = systems.begin(); sysIt != systems.end(); sysIt++)
+	while(!sInterrupted)
 	{
-		std::vector<FileData*> files = (*sysIt)->getRootFolder()->getFilesRecursive(GAME);
-
-		ScraperSearchParams params;
-		params.system = (*sysIt);
-
-		for(auto gameIt = files.begin(); gameIt != files.end(); gameIt++)
+		while(jobs.size() < concurrency && !searches.empty())
 		{
-			params.nameOverride = "";
-			params.game = *gameIt;
-
-			//print original search term
-			out << getCleanFileName(params.game->getPath()) << "...\n";
-
-			//need to take into account filter_choice
-			if(filter_choice == FILTER_MISSING_IMAGES)
-			{
-				if(!params.game->metadata.get("image").empty()) //maybe should also check if the image file exists/is a URL
-				{
-					out << "   Skipping, metadata \"image\" entry is not empty.\n";
-					continue;
-				}
-			}
-
-			//actually get some results
-			do {
-				std::vector<MetaDataList> mdls = scraper->getResults(params);
-
-				//no results
-				if(mdls.size() == 0)
-				{
-					if(manual_mode)
-					{
-						//in manual mode let the user enter a custom search
-						out << "   NO RESULTS FOUND! Enter a new name to search for, or nothing to skip.\n";
-
-						std::getline(std::cin, params.nameOverride);
-
-						if(params.nameOverride.empty())
-						{
-							out << "   Skipping...\n";
-							break;
-						}
-
-						continue;
-
-					}else{
-						out << "   NO RESULTS FOUND! Skipping...\n";
-						break;
-					}
-				}
-
-				//some results
-				if(manual_mode)
-				{
-					//print list of choices
-					for(unsigned int i = 0; i < mdls.size(); i++)
-					{
-						out << "   " << i << " - " << mdls.at(i).get("name") << "\n";
-					}
-
-					int choice = -1;
-					std::string choice_str;
-					
-					out << "Your choice: ";
-
-					std::getline(std::cin, choice_str);
-					std::stringstream choice_buff(choice_str); //convert to int
-					choice_buff >> choice;
-
-					if(choice >= 0 && choice < (int)mdls.size())
-					{
-						params.game->metadata = mdls.at(choice);
-						break;
-					}else{
-						out << "Invalid choice.\n";
-						continue;
-					}
-
-				}else{
-					//automatic mode
-					//always choose the first choice
-					out << "   name -> " << mdls.at(0).get("name") << "\n";
-					params.game->metadata = mdls.at(0);
-					break;
-				}
-
-			} while(true);
-
-			out << "===================\n";
+			std::unique_ptr<Job> job(new Job());
+			job->search = searches.front();
+			job->queued = Clock::now();
+			job->hashMatch = false;
+			searches.pop_front();
+			jobs.push_back(std::move(job));
 		}
-	}
 
-	out << "\n\n";
-	out << "Downloading boxart...\n";
+		if(jobs.empty())
+			break;
 
-	for(auto sysIt = systems.begin(); sysIt != systems.end(); sysIt++)
-	{
-		std::vector<FileData*> files = (*sysIt)->getRootFolder()->getFilesRecursive(GAME);
+		// there's no window to run what finished in the background (downloads, resizes) on the main thread
+		TaskScheduler::getInstance()->update(MAIN_THREAD_BUDGET);
 
-		for(auto gameIt = files.begin(); gameIt != files.end(); gameIt++)
+		for(auto it = jobs.begin(); it != jobs.end(); )
 		{
-			FileData* game = *gameIt;
-			const std::vector<MetaDataDecl>& mdd = game->metadata.getMDD();
-			for(auto i = mdd.begin(); i != mdd.end(); i++)
-			{
-				std::string key = i->key;
-				std::string url = game->metadata.get(key);
-
-				if(i->type == MD_IMAGE_PATH && HttpReq::isUrl(url))
-				{
-					std::string urlShort = url.substr(0, url.length() > 35 ? 35 : url.length());
-					if(url.length() != urlShort.length()) urlShort += "...";
-
-					out << "   " << game->metadata.get("name") << " [from: " << urlShort << "]...\n";
-
-					ScraperSearchParams p;
-					p.game = game;
-					p.system = *sysIt;
-					game->metadata.set(key, downloadImage(url, getSaveAsPath(p, key, url)));
-					if(game->metadata.get(key).empty())
-					{
-						out << "     FAILED! Skipping.\n";
-						game->metadata.set(key, url); //result URL to what it was if download failed, retry some other time
-					}
-				}
-			}
+			bool done;
+			batch.update(**it, done);
+			if(done)
+				it = jobs.erase(it);
+			else
+				it++;
 		}
-	}
 
+		// the requests run on the network thread, this only has to look in on them now and then
+		if(!jobs.empty())
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
 
-	out << "\n\n";
+	out << "\n";
 	out << "==============================\n";
-	out << "SCRAPE COMPLETE!\n";
+	if(sInterrupted)
+	{
+		out << "INTERRUPTED, " << (total - batch.getDoneCount()) << " games are left for the next run.\n";
+	}else{
+		// failed games go again in the next run with these options, until there are none
+		if(batch.getFailedCount() == 0)
+			journal.finish();
+		out << "SCRAPE COMPLETE!\n";
+	}
+	out << batch.getScrapedCount() << " scraped, " << batch.getSkippedCount() << " skipped, " << batch.getFailedCount() << " failed.\n";
 	out << "==============================\n";
-	*/
-
-	out << "\n\n";
-	out << "ACTUALLY THIS IS STILL TODO\n";
 
-	return 0;
+	if(sInterrupted)
+		return 1;
+	return batch.getFailedCount() ? 2 : 0;
 }
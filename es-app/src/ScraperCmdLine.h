@@ -1,3 +1,33 @@
 #pragma once
 
-int run_scraper_cmdline();
+#include <string>
+#include <vector>
+
+// What --scrape was told on the command line (see main.cpp). It never asks anything, so it can run on a box with no one at it.
+struct ScraperCmdLineOptions
+{
+	enum Filter
+	{
+		FILTER_MISSING_IMAGE,
+		FILTER_ALL
+	};
+
+	enum Accept
+	{
+		ACCEPT_FIRST, // the first result, whatever it is
+		ACCEPT_HASH_MATCH // only a single result found by the ROM's hash, the rest are skipped
+	};
+
+	ScraperCmdLineOptions() : filter(FILTER_MISSING_IMAGE), accept(ACCEPT_FIRST), concurrency(0) {};
+
+	std::vector<std::string> systems; // names, empty for every system with a platform set
+	Filter filter;
+	Accept accept;
+	unsigned int concurrency; // games scraped at once, 0 for "ScraperConcurrency"
+	std::string resultsPath; // if set, one JSON object per game is written here as it's done
+};
+
+// Scrapes the games the options pick, printing progress as it goes. An interrupted (or crashed) run started again with the
+// same options picks up where it stopped. Returns the exit code: 0 if every game was scraped or skipped, 2 if some of them
+// failed, 1 if it couldn't start or was interrupted.
+int run_scraper_cmdline(const ScraperCmdLineOptions& options);
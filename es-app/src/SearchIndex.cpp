@@ -0,0 +1,347 @@
+#include "SearchIndex.h"
+#include "SystemData.h"
+#include "Settings.h"
+#include "Log.h"
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+
+// ms per update spent copying names out of newly loaded systems for the worker
+#define SEARCH_SNAPSHOT_BUDGET 4
+
+SearchIndex* SearchIndex::getInstance()
+{
+	static SearchIndex instance;
+	return &instance;
+}
+
+SearchIndex::SearchIndex() : mGeneration(0), mStopWorker(false)
+{
+}
+
+void SearchIndex::tokenize(const std::string& text, std::vector<std::string>& out)
+{
+	out.clear();
+
+	std::string word;
+	for(size_t i = 0; i <= text.size(); i++)
+	{
+		const unsigned char c = i < text.size() ? (unsigned char)text[i] : 0;
+		if((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c >= 0x80)
+		{
+			word += (char)c;
+		}else if(c >= 'A' && c <= 'Z')
+		{
+			word += (char)(c - 'A' + 'a');
+		}else if(!word.empty())
+		{
+			out.push_back(word);
+			word.clear();
+		}
+	}
+
+	std::sort(out.begin(), out.end());
+	out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+std::string SearchIndex::getText(const FileData* file)
+{
+	if(!Settings::getInstance()->getBool("SearchDescriptions"))
+		return file->getName();
+
+	return file->getName() + " " + file->metadata.get(MetaDataIds::DESC);
+}
+
+SearchIndex::SystemIndex* SearchIndex::build(Job& job)
+{
+	SystemIndex* index = new SystemIndex();
+	index->system = job.system;
+	index->files.swap(job.files);
+	index->ids.reserve(index->files.size());
+	for(uint32_t i = 0; i < index->files.size(); i++)
+		index->ids[index->files[i]] = i;
+
+	// every (word, id) pair, sorted by word and then id
+	std::vector< std::pair<std::string, uint32_t> > pairs;
+	std::vector<std::string> words;
+	for(uint32_t i = 0; i < job.texts.size(); i++)
+	{
+		tokenize(job.texts[i], words);
+		for(auto it = words.begin(); it != words.end(); it++)
+			pairs.push_back(std::pair<std::string, uint32_t>(std::move(*it), i));
+	}
+	std::sort(pairs.begin(), pairs.end());
+
+	index->postings.reserve(pairs.size());
+	for(auto it = pairs.begin(); it != pairs.end(); it++)
+	{
+		if(index->words.empty() || index->words.back() != it->first)
+		{
+			index->postingStart.push_back(index->postings.size());
+			index->words.push_back(it->first);
+		}
+		index->postings.push_back(it->second);
+	}
+	index->postingStart.push_back(index->postings.size());
+
+	return index;
+}
+
+void SearchIndex::queueSystem(SystemData* system)
+{
+	Job* job = new Job();
+	job->system = system;
+	system->getRootFolder()->visitRecursive(GAME, [job](FileData* file) {
+		job->files.push_back(file);
+		job->texts.push_back(getText(file));
+		return true;
+	});
+
+	mQueued.insert(system);
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	mJobs.push_back(job);
+	if(!mWorker.joinable())
+	{
+		mStopWorker = false;
+		mWorker = std::thread(&SearchIndex::runWorker, this);
+	}
+	mCondition.notify_one();
+}
+
+void SearchIndex::runWorker()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	while(true)
+	{
+		mCondition.wait(lock, [this] { return mStopWorker || !mJobs.empty(); });
+		if(mStopWorker)
+			return;
+
+		Job* job = mJobs.front();
+		mJobs.pop_front();
+
+		lock.unlock();
+		SystemIndex* index = build(*job);
+		delete job;
+		lock.lock();
+
+		mDone.push_back(index);
+	}
+}
+
+void SearchIndex::stopWorker()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStopWorker = true;
+		mCondition.notify_one();
+	}
+
+	if(mWorker.joinable())
+		mWorker.join();
+
+	for(auto it = mJobs.begin(); it != mJobs.end(); it++)
+		delete *it;
+	mJobs.clear();
+	for(auto it = mDone.begin(); it != mDone.end(); it++)
+		delete *it;
+	mDone.clear();
+}
+
+void SearchIndex::update()
+{
+	// take finished systems
+	std::deque<SystemIndex*> done;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		done.swap(mDone);
+	}
+
+	for(auto it = done.begin(); it != done.end(); it++)
+	{
+		SystemIndex* index = *it;
+		mQueued.erase(index->system);
+
+		// something changed after the names were copied, it gets queued again below
+		if(mStale.erase(index->system))
+		{
+			delete index;
+			continue;
+		}
+
+		delete mIndices[index->system];
+		mIndices[index->system] = index;
+		mGeneration++;
+	}
+
+	// hand over systems that finished loading
+	const auto start = std::chrono::steady_clock::now();
+	for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end(); it++)
+	{
+		SystemData* system = *it;
+		if(!system->isLoaded() || mIndices.find(system) != mIndices.end() || mQueued.find(system) != mQueued.end())
+			continue;
+
+		queueSystem(system);
+
+		if(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(SEARCH_SNAPSHOT_BUDGET))
+			break;
+	}
+}
+
+bool SearchIndex::isComplete() const
+{
+	if(SystemData::hasPendingSystems())
+		return false;
+
+	for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end(); it++)
+	{
+		if(mIndices.find(*it) == mIndices.end())
+			return false;
+	}
+	return true;
+}
+
+void SearchIndex::addFile(SystemIndex& index, FileData* file)
+{
+	const uint32_t id = index.files.size();
+	index.files.push_back(file);
+	index.ids[file] = id;
+
+	std::vector<std::string> words;
+	tokenize(getText(file), words);
+	for(auto it = words.begin(); it != words.end(); it++)
+		index.added[*it].push_back(id);
+}
+
+void SearchIndex::removeFile(SystemIndex& index, FileData* file)
+{
+	// the id stays in the postings, search() skips it
+	auto it = index.ids.find(file);
+	if(it == index.ids.end())
+		return;
+
+	index.files[it->second] = NULL;
+	index.ids.erase(it);
+}
+
+void SearchIndex::onFileChanged(FileData* file, FileChangeType change)
+{
+	if(change != FILE_ADDED && change != FILE_METADATA_CHANGED)
+		return;
+
+	SystemData* system = file->getSystem();
+	if(mQueued.find(system) != mQueued.end())
+	{
+		mStale.insert(system);
+		return;
+	}
+
+	// not indexed yet, it'll be picked up as it is now
+	auto found = mIndices.find(system);
+	if(found == mIndices.end())
+		return;
+
+	SystemIndex& index = *found->second;
+	if(file->getType() == GAME)
+	{
+		removeFile(index, file);
+		addFile(index, file);
+	}else if(change == FILE_ADDED)
+	{
+		file->visitRecursive(GAME, [this, &index](FileData* game) { addFile(index, game); return true; });
+	}
+
+	mGeneration++;
+}
+
+void SearchIndex::onFileDeleted(FileData* file)
+{
+	SystemData* system = file->getSystem();
+	if(mQueued.find(system) != mQueued.end())
+	{
+		mStale.insert(system);
+		return;
+	}
+
+	auto found = mIndices.find(system);
+	if(found != mIndices.end())
+	{
+		removeFile(*found->second, file);
+		mGeneration++;
+	}
+}
+
+void SearchIndex::clear()
+{
+	stopWorker();
+
+	for(auto it = mIndices.begin(); it != mIndices.end(); it++)
+		delete it->second;
+	mIndices.clear();
+	mQueued.clear();
+	mStale.clear();
+	mGeneration++;
+}
+
+void SearchIndex::matchWord(const SystemIndex& index, const std::string& word, std::vector<uint32_t>& out)
+{
+	out.clear();
+
+	// every word with this prefix is in one run of the sorted list
+	for(auto it = std::lower_bound(index.words.begin(), index.words.end(), word);
+		it != index.words.end() && it->compare(0, word.size(), word) == 0; it++)
+	{
+		const size_t i = it - index.words.begin();
+		out.insert(out.end(), index.postings.begin() + index.postingStart[i], index.postings.begin() + index.postingStart[i + 1]);
+	}
+
+	for(auto it = index.added.lower_bound(word); it != index.added.end() && it->first.compare(0, word.size(), word) == 0; it++)
+		out.insert(out.end(), it->second.begin(), it->second.end());
+
+	std::sort(out.begin(), out.end());
+	out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+std::vector<FileData*> SearchIndex::search(const std::string& query, unsigned int maxResults, unsigned int& total) const
+{
+	std::vector<FileData*> results;
+	total = 0;
+
+	std::vector<std::string> words;
+	tokenize(query, words);
+	if(words.empty())
+		return results;
+
+	std::vector<uint32_t> matches, wordMatches, both;
+	for(auto sys = SystemData::sSystemVector.begin(); sys != SystemData::sSystemVector.end(); sys++)
+	{
+		auto found = mIndices.find(*sys);
+		if(found == mIndices.end())
+			continue;
+
+		const SystemIndex& index = *found->second;
+		matchWord(index, words[0], matches);
+		for(unsigned int i = 1; i < words.size() && !matches.empty(); i++)
+		{
+			matchWord(index, words[i], wordMatches);
+			both.clear();
+			std::set_intersection(matches.begin(), matches.end(), wordMatches.begin(), wordMatches.end(), std::back_inserter(both));
+			matches.swap(both);
+		}
+
+		for(auto it = matches.begin(); it != matches.end(); it++)
+		{
+			FileData* file = index.files[*it];
+			if(file == NULL)
+				continue;
+
+			total++;
+			if(results.size() < maxResults)
+				results.push_back(file);
+		}
+	}
+
+	return results;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <deque>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stdint.h>
+#include "FileData.h"
+
+class SystemData;
+
+// An inverted index (word -> games) over the names of every game, and their descriptions if "SearchDescriptions" is on.
+// Each system gets its own index, built on a worker thread from a copy of the names as soon as the system is loaded;
+// games added or changed afterwards go into a small per-system map on the side.
+// Everything but the worker is main thread only.
+class SearchIndex
+{
+public:
+	static SearchIndex* getInstance();
+
+	// Once a frame: picks up finished systems and hands newly loaded ones to the worker.
+	void update();
+
+	// Called by ViewController for every change, and by SystemData before it deletes a node of a loaded system.
+	void onFileChanged(FileData* file, FileChangeType change);
+	void onFileDeleted(FileData* file);
+
+	// Forgets every system (and waits for the worker), for when they're all about to be deleted.
+	void clear();
+
+	// false while some systems aren't indexed yet (or aren't even loaded)
+	bool isComplete() const;
+
+	// Changes whenever search results could have changed.
+	inline unsigned int getGeneration() const { return mGeneration; }
+
+	// Games that have a word starting with each word of query (case insensitive), in system and list order.
+	// Returns at most maxResults of them; total is set to how many there are in all.
+	std::vector<FileData*> search(const std::string& query, unsigned int maxResults, unsigned int& total) const;
+
+	// Lower case words in text (ASCII letters and digits, anything non-ASCII is kept as part of a word), sorted and unique.
+	static void tokenize(const std::string& text, std::vector<std::string>& out);
+
+private:
+	SearchIndex();
+
+	struct SystemIndex
+	{
+		SystemData* system;
+		std::vector<FileData*> files; // by id, NULL once removed or replaced
+		std::unordered_map<FileData*, uint32_t> ids;
+
+		// what the worker built: sorted unique words, and for word i the ids in postings[postingStart[i]..postingStart[i + 1]]
+		std::vector<std::string> words;
+		std::vector<uint32_t> postingStart;
+		std::vector<uint32_t> postings;
+
+		// words of games added after the build
+		std::map< std::string, std::vector<uint32_t> > added;
+	};
+
+	struct Job
+	{
+		SystemData* system;
+		std::vector<FileData*> files;
+		std::vector<std::string> texts;
+	};
+
+	static std::string getText(const FileData* file);
+	static SystemIndex* build(Job& job);
+	static void matchWord(const SystemIndex& index, const std::string& word, std::vector<uint32_t>& out);
+
+	void queueSystem(SystemData* system);
+	void addFile(SystemIndex& index, FileData* file);
+	void removeFile(SystemIndex& index, FileData* file);
+	void runWorker();
+	void stopWorker();
+
+	std::map<SystemData*, SystemIndex*> mIndices;
+	std::set<SystemData*> mQueued; // handed to the worker, not back yet
+	std::set<SystemData*> mStale; // changed while queued, the result is thrown away
+	unsigned int mGeneration;
+
+	std::thread mWorker;
+	std::mutex mMutex;
+	std::condition_variable mCondition;
+	std::deque<Job*> mJobs;
+	std::deque<SystemIndex*> mDone;
+	bool mStopWorker;
+};
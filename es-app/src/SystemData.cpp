@@ -11,15 +11,82 @@
 #include "InputManager.h"
 #include <iostream>
 #include "Settings.h"
+#include "XmlFile.h"
 #include "FileSorts.h"
+#include "RomCache.h"
+#include "Trace.h"
+#include "SearchIndex.h"
+#include "PlayedIndex.h"
+#include "RomHasher.h"
+#include "AsyncIO.h"
+#include "resources/ResourceManager.h"
+#include <thread>
+#include <atomic>
+#include <set>
+#include <algorithm>
 
 std::vector<SystemData*> SystemData::sSystemVector;
+std::vector<SystemData*> SystemData::sPendingSystems;
 
 namespace fs = boost::filesystem;
 
+// the summary is what lazy mode shows for a system before it's been loaded
+static std::string getSummaryPath(const SystemData* system)
+{
+	return getHomePath() + "/.emulationstation/cache/" + system->getName() + ".summary";
+}
+
+static bool readSummary(const SystemData* system, unsigned int& gameCount)
+{
+	std::ifstream in(getSummaryPath(system).c_str());
+	std::string key;
+	if(!(in >> key >> gameCount) || key != "games")
+		return false;
+
+	// systems without games get dropped, so that has to be checked for real
+	return gameCount > 0;
+}
+
+static void writeSummary(const SystemData* system, unsigned int gameCount)
+{
+	fs::path path = getSummaryPath(system);
+	boost::system::error_code ec;
+	fs::create_directories(path.parent_path(), ec);
+
+	std::ofstream out(path.string().c_str(), std::ios::out | std::ios::trunc);
+	if(!out.is_open())
+	{
+		LOG(LogWarning) << "Could not write system summary \"" << path.string() << "\"";
+		return;
+	}
+
+	out << "games " << gameCount << "\n";
+}
+
+SystemData::LoadSettings SystemData::LoadSettings::read()
+{
+	Settings* settings = Settings::getInstance();
+	LoadSettings out;
+	out.lazy = settings->getBool("LazyLoadSystems");
+	out.progressive = settings->getBool("ProgressiveStartup");
+	out.scanTimeout = settings->getInt("ScanTimeout");
+	out.parseGamelistOnly = settings->getBool("ParseGamelistOnly");
+	out.romCache = settings->getBool("RomCache");
+	out.ignoreGamelist = settings->getBool("IgnoreGamelist");
+	out.gamelistCheckTree = settings->getBool("GamelistCheckTree");
+	out.gamelistStore = settings->getString("GamelistBackend") == "store";
+	out.hashRoms = settings->getBool("HashRomsInBackground");
+	return out;
+}
+
 SystemData::SystemData(const std::string& name, const std::string& fullName, const std::string& startPath, const std::vector<std::string>& extensions, 
-	const std::string& command, const std::vector<PlatformIds::PlatformId>& platformIds, const std::string& themeFolder)
+	const std::string& command, const std::vector<PlatformIds::PlatformId>& platformIds, const std::string& themeFolder,
+	const LoadSettings& loadSettings) : mLoadSettings(loadSettings)
 {
+	TRACE_SCOPE("SystemData", name);
+
+	mThemeStale = false;
+
 	mName = name;
 	mFullName = fullName;
 	mStartPath = startPath;
@@ -33,194 +100,834 @@ SystemData::SystemData(const std::string& name, const std::string& fullName, con
 
 	mSearchExtensions = extensions;
 	mLaunchCommand = command;
+	parseLaunchCommand();
 	mPlatformIds = platformIds;
 	mThemeFolder = themeFolder;
+	mMetaDataPool = std::make_shared<MetaDataStringPool>();
 
-	mRootFolder = new FileData(FOLDER, mStartPath, this);
+	mRootFolder = createFileData(FOLDER, mStartPath);
 	mRootFolder->metadata.set("name", mFullName);
 
-	if(!Settings::getInstance()->getBool("ParseGamelistOnly"))
-		populateFolder(mRootFolder);
+	mLoaded = false;
+	mHasImages = false;
+	mLoading = false;
+	mCachedGameCount = 0;
+	mConfigIndex = 0;
+	mScanTimedOut = false;
+
+	// in lazy mode all the system view needs is the theme and a game count, the rest can wait;
+	// on a progressive startup even the count can wait, loadConfig() holds the system back until it's loaded
+	const bool lazy = mLoadSettings.lazy;
+	const bool progressive = mLoadSettings.progressive;
+	mGameCountKnown = (lazy || progressive) && readSummary(this, mCachedGameCount);
+	if(!progressive && !(lazy && mGameCountKnown))
+		ensureLoaded();
+
+	loadTheme();
+}
+
+void SystemData::load()
+{
+	TRACE_SCOPE("SystemData::load", mName);
+
+	// the whole scan gets "ScanTimeout", after that populateFolder() makes do with the cache
+	const int timeout = mLoadSettings.scanTimeout;
+	mScanDeadline = timeout > 0 ? std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout) : std::chrono::steady_clock::time_point::max();
+	mScanTimedOut = false;
+	mScanExtensions = std::make_shared< const std::vector<std::string> >(mSearchExtensions);
+
+	RomCache newCache;
+	bool saveCache = false;
+	if(!mLoadSettings.parseGamelistOnly)
+	{
+		if(mLoadSettings.romCache)
+		{
+			// only directories whose mtime changed since the last run get scanned again
+			RomCache oldCache;
+			loadRomCache(this, oldCache);
 
-	if(!Settings::getInstance()->getBool("IgnoreGamelist"))
+			bool changed = false;
+			populateFolder(mRootFolder, &oldCache, &newCache, changed);
+
+			// a timed out scan didn't see everything, the late one saves the cache instead
+			saveCache = !mScanTimedOut && (changed || oldCache.size() != newCache.size());
+		}else{
+			bool changed = false;
+			populateFolder(mRootFolder, NULL, NULL, changed);
+		}
+	}
+
+	if(!mLoadSettings.ignoreGamelist)
+	{
 		parseGamelist(this);
+		replayPlayJournal(this);
+	}
 
 	mRootFolder->sort(FileSorts::SortTypes.at(0));
+	mRootFolder->sortPending(std::thread::hardware_concurrency());
 
-	loadTheme();
+	// saved in the order it's shown in, so the next load's sort finds everything already in place
+	if(saveCache)
+	{
+		orderRomCache(mRootFolder, newCache);
+		saveRomCache(this, newCache);
+	}
+
+	collectNameCodePoints();
+
+	if(mLoadSettings.hashRoms)
+		RomHasher::getInstance()->queueFolder(mRootFolder);
+
+	writeSummary(this, mRootFolder->getGameCount());
+
+	if(mScanTimedOut)
+		startLateScan();
 }
 
-SystemData::~SystemData()
+void SystemData::deleteFileData(FileData* file)
 {
-	//save changed game data back to xml
-	if(!Settings::getInstance()->getBool("IgnoreGamelist") && Settings::getInstance()->getBool("SaveGamelistsOnExit"))
+	// while loading, the tree belongs to the loader and nothing else has seen it yet
+	if(mLoaded)
 	{
-		updateGamelist(this);
+		SearchIndex::getInstance()->onFileDeleted(file);
+		PlayedIndex::getInstance()->onFileDeleted(file);
 	}
 
-	delete mRootFolder;
+	mFileArena.destroy(file);
 }
 
+void SystemData::compactMetaDataPool()
+{
+	// until then the loader is still interning into it
+	if(!mLoaded)
+		return;
+
+	std::shared_ptr<MetaDataStringPool> pool = std::make_shared<MetaDataStringPool>();
+	mRootFolder->moveToPool(pool);
+	mMetaDataPool = pool;
+}
 
-std::string strreplace(std::string str, const std::string& replace, const std::string& with)
+FileData* SystemData::getRootFolder()
 {
-	size_t pos;
-	while((pos = str.find(replace)) != std::string::npos)
-		str = str.replace(pos, replace.length(), with.c_str(), with.length());
-	
-	return str;
+	if(!mLoaded)
+		ensureLoaded();
+
+	return mRootFolder;
 }
 
-// plaform-specific escape path function
+void SystemData::ensureLoaded()
+{
+	// if the background loader is busy with us, this waits for it to finish
+	std::lock_guard<std::recursive_mutex> lock(mLoadMutex);
+
+	// loading asks for the root folder too
+	if(mLoaded || mLoading)
+		return;
+
+	mLoading = true;
+	load();
+	mLoading = false;
+	mLoaded = true;
+}
+
+void SystemData::collectNameCodePoints()
+{
+	// fonts always have ASCII loaded
+	std::set<UnicodeChar> codePoints;
+	mRootFolder->visitRecursive(GAME | FOLDER, [&codePoints](FileData* file) {
+		const std::string& name = file->getName();
+		size_t cursor = 0;
+		while(cursor < name.length())
+		{
+			// skip ASCII, and bytes that don't start a complete sequence (names from old gamelists aren't always utf8)
+			const unsigned char lead = (unsigned char)name[cursor];
+			const size_t length = (lead & 0xE0) == 0xC0 ? 2 : (lead & 0xF0) == 0xE0 ? 3 : (lead & 0xF8) == 0xF0 ? 4 : 1;
+			if(length == 1 || cursor + length > name.length())
+			{
+				cursor++;
+				continue;
+			}
+
+			UnicodeChar c = Font::readUnicodeChar(name, cursor);
+			if(c != 0)
+				codePoints.insert(c);
+		}
+		return true;
+	});
+
+	mNameCodePoints.assign(codePoints.begin(), codePoints.end());
+}
+
+SystemData::~SystemData()
+{
+	saveGamelistOnExit();
+
+	// frees the whole tree at once
+	mFileArena.clear();
+	mRootFolder = NULL;
+}
+
+void SystemData::saveGamelistOnExit()
+{
+	//save changed game data back to xml (if it was never loaded, nothing could have changed)
+	if(mLoaded && !Settings::getInstance()->getBool("IgnoreGamelist") && Settings::getInstance()->getBool("SaveGamelistsOnExit"))
+	{
+		updateGamelist(this);
+	}
+}
+
+// plaform-specific escape path function, appends to out
 // on windows: just puts the path in quotes
 // everything else: assume bash and escape special characters with backslashes
-std::string escapePath(const boost::filesystem::path& path)
+static void appendEscapedPath(std::string& out, const boost::filesystem::path& path)
 {
 #ifdef WIN32
 	// windows escapes stuff by just putting everything in quotes
-	return '"' + fs::path(path).make_preferred().string() + '"';
+	out += '"';
+	out += fs::path(path).make_preferred().string();
+	out += '"';
 #else
-	// a quick and dirty way to insert a backslash before most characters that would mess up a bash path
-	std::string pathStr = path.string();
+	// insert a backslash before most characters that would mess up a bash path
+	static bool needsEscape[256];
+	static bool tableBuilt = false;
+	if(!tableBuilt)
+	{
+		for(const char* c = " '\"\\!$^&*(){}[]?;<>"; *c != '\0'; c++)
+			needsEscape[(unsigned char)*c] = true;
+		tableBuilt = true;
+	}
 
-	const char* invalidChars = " '\"\\!$^&*(){}[]?;<>";
+	const std::string& pathStr = path.string();
+	out.reserve(out.size() + pathStr.size() + 8);
 	for(unsigned int i = 0; i < pathStr.length(); i++)
 	{
-		char c;
-		unsigned int charNum = 0;
-		do {
-			c = invalidChars[charNum];
-			if(pathStr[i] == c)
+		if(needsEscape[(unsigned char)pathStr[i]])
+			out += '\\';
+		out += pathStr[i];
+	}
+#endif
+}
+
+void SystemData::parseLaunchCommand()
+{
+	static const struct { const char* name; LaunchVariable var; } variables[] = {
+		{ "ROM", LAUNCH_ROM },
+		{ "BASENAME", LAUNCH_BASENAME },
+		{ "ROM_RAW", LAUNCH_ROM_RAW },
+		{ "ROMDIR", LAUNCH_ROMDIR },
+		{ "SYSTEM", LAUNCH_SYSTEM }
+	};
+
+	mLaunchTemplate.clear();
+
+	const std::string& cmd = mLaunchCommand;
+	std::string text;
+	size_t i = 0;
+	while(i < cmd.size())
+	{
+		size_t end;
+		if(cmd[i] == '%' && (end = cmd.find('%', i + 1)) != std::string::npos)
+		{
+			const std::string name = cmd.substr(i + 1, end - i - 1);
+			bool found = false;
+			for(unsigned int v = 0; v < sizeof(variables) / sizeof(variables[0]); v++)
 			{
-				pathStr.insert(i, "\\");
-				i++;
-				break;
+				if(name == variables[v].name)
+				{
+					if(!text.empty())
+					{
+						LaunchToken literal = { LAUNCH_TEXT, text };
+						mLaunchTemplate.push_back(literal);
+						text.clear();
+					}
+					LaunchToken token = { variables[v].var, std::string() };
+					mLaunchTemplate.push_back(token);
+					i = end + 1;
+					found = true;
+					break;
+				}
 			}
-			charNum++;
-		} while(c != '\0');
+
+			if(found)
+				continue;
+		}
+
+		// not a variable we know, keep the % (the closing one might start a real variable)
+		text += cmd[i];
+		i++;
 	}
 
-	return pathStr;
-#endif
+	if(!text.empty())
+	{
+		LaunchToken literal = { LAUNCH_TEXT, text };
+		mLaunchTemplate.push_back(literal);
+	}
+}
+
+std::string SystemData::expandLaunchCommand(FileData* game) const
+{
+	const fs::path& path = game->getPath();
+
+	std::string command;
+	command.reserve(mLaunchCommand.size() + path.native().size() * 2);
+	for(auto it = mLaunchTemplate.begin(); it != mLaunchTemplate.end(); it++)
+	{
+		switch(it->var)
+		{
+		case LAUNCH_TEXT:
+			command += it->text;
+			break;
+		case LAUNCH_ROM:
+			appendEscapedPath(command, path);
+			break;
+		case LAUNCH_BASENAME:
+			command += path.stem().string();
+			break;
+		case LAUNCH_ROM_RAW:
+			command += fs::path(path).make_preferred().string();
+			break;
+		case LAUNCH_ROMDIR:
+			appendEscapedPath(command, path.parent_path());
+			break;
+		case LAUNCH_SYSTEM:
+			command += mName;
+			break;
+		}
+	}
+
+	return command;
 }
 
 void SystemData::launchGame(Window* window, FileData* game)
 {
 	LOG(LogInfo) << "Attempting to launch game...";
 
+	// tearing the renderer down frees the display for emulators that need it, but reloading every texture
+	// and font afterwards is most of the time it takes to get back
+	const bool keepVideo = Settings::getInstance()->getBool("KeepVideoOnLaunch");
+
 	AudioManager::getInstance()->deinit();
-	VolumeControl::getInstance()->deinit();
-	window->deinit();
+	if(keepVideo)
+		window->suspend();
+	else
+		window->deinit();
 
-	std::string command = mLaunchCommand;
+	const std::string command = expandLaunchCommand(game);
 
-	const std::string rom = escapePath(game->getPath());
-	const std::string basename = game->getPath().stem().string();
-	const std::string rom_raw = fs::path(game->getPath()).make_preferred().string();
+	LOG(LogInfo) << "	" << command;
 
-	command = strreplace(command, "%ROM%", rom);
-	command = strreplace(command, "%BASENAME%", basename);
-	command = strreplace(command, "%ROM_RAW%", rom_raw);
+	ProcessHandle process;
+	const bool started = startProcess(command, process);
+	if(!started)
+		LOG(LogError) << "...could not start the launch command!";
 
-	LOG(LogInfo) << "	" << command;
-	int exitCode = runSystemCommand(command);
+	//update number of times the game has been launched
+	int timesPlayed = game->metadata.getPlayCount() + 1;
+	game->metadata.set("playcount", std::to_string(static_cast<long long>(timesPlayed)));
 
+	//update last played time
+	boost::posix_time::ptime time = boost::posix_time::second_clock::universal_time();
+	game->metadata.setTime("lastplayed", time);
+
+	// recorded in the background while the game runs, so it's not lost if the machine is switched off mid-game
+	if(started)
+		recordPlay(this, game);
+
+	int exitCode = started ? waitProcess(process) : -1;
 	if(exitCode != 0)
 	{
 		LOG(LogWarning) << "...launch terminated with nonzero exit code " << exitCode << "!";
 	}
 
-	window->init();
-	VolumeControl::getInstance()->init();
+	if(keepVideo)
+		window->resume();
+	else
+		window->init();
+	// the mixer stays open, but the game may have changed the volume
+	VolumeControl::getInstance()->refresh();
 	AudioManager::getInstance()->init();
 	window->normalizeNextUpdate();
+}
 
-	//update number of times the game has been launched
-	int timesPlayed = game->metadata.getInt("playcount") + 1;
-	game->metadata.set("playcount", std::to_string(static_cast<long long>(timesPlayed)));
+std::vector<std::string> readList(const std::string& str, const char* delims = " \t\r\n,")
+{
+	std::vector<std::string> ret;
 
-	//update last played time
-	boost::posix_time::ptime time = boost::posix_time::second_clock::universal_time();
-	game->metadata.setTime("lastplayed", time);
+	size_t prevOff = str.find_first_not_of(delims, 0);
+	size_t off = str.find_first_of(delims, prevOff);
+	while(off != std::string::npos || prevOff != std::string::npos)
+	{
+		ret.push_back(str.substr(prevOff, off - prevOff));
+
+		prevOff = str.find_first_not_of(delims, off);
+		off = str.find_first_of(delims, prevOff);
+	}
+
+	return ret;
 }
 
-void SystemData::populateFolder(FileData* folder)
+// the files a disc image refers to: the tracks of a .cue, every disc of a .m3u (and their tracks)
+static void collectDiscFiles(const fs::path& path, std::vector<fs::path>& out, int depth)
 {
-	const fs::path& folderPath = folder->getPath();
-	if(!fs::is_directory(folderPath))
+	std::string ext = path.extension().string();
+	std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+	if(depth > 1 || (ext != ".cue" && ext != ".m3u"))
+		return;
+
+	std::ifstream file(path.string().c_str());
+	std::string line;
+	while(std::getline(file, line))
 	{
-		LOG(LogWarning) << "Error - folder with path \"" << folderPath << "\" is not a directory!";
+		if(!line.empty() && line.back() == '\r')
+			line.pop_back();
+
+		fs::path ref;
+		if(ext == ".cue")
+		{
+			// FILE "track 01.bin" BINARY
+			const size_t start = line.find("FILE \"");
+			const size_t end = line.rfind('"');
+			if(start == std::string::npos || end <= start + 6)
+				continue;
+			ref = line.substr(start + 6, end - start - 6);
+		}else{
+			if(line.empty() || line[0] == '#')
+				continue;
+			ref = line;
+		}
+
+		if(ref.is_relative())
+			ref = path.parent_path() / ref;
+
+		out.push_back(ref);
+		collectDiscFiles(ref, out, depth + 1);
+	}
+}
+
+void SystemData::prefetchGame(FileData* game)
+{
+	const size_t budget = (size_t)std::max(Settings::getInstance()->getInt("LaunchReadahead"), 0) * 1024 * 1024;
+	if(budget == 0)
 		return;
+
+	// Only the words of the command are picked out here, everything that touches the filesystem (reading a .cue,
+	// looking for the emulator) runs on an I/O thread, the game could be on a mount that doesn't answer.
+	const fs::path gamePath = game->getPath();
+	std::string program;
+	std::vector<std::string> words;
+	for(auto it = mLaunchTemplate.begin(); it != mLaunchTemplate.end(); it++)
+	{
+		if(it->var != LAUNCH_TEXT)
+			continue;
+
+		std::vector<std::string> list = readList(it->text, " \t\r\n\"'");
+		for(auto word = list.begin(); word != list.end(); word++)
+		{
+			std::string str = *word;
+			if(str[0] == '~')
+				str = getHomePath() + str.substr(1);
+
+			if(it == mLaunchTemplate.begin() && word == list.begin() && str.find('/') == std::string::npos)
+				program = str;
+			else
+				words.push_back(str);
+		}
 	}
 
-	const std::string folderStr = folderPath.generic_string();
+	const char* env = getenv("PATH");
+#ifdef WIN32
+	const std::vector<std::string> dirs = readList(env ? env : "", ";");
+#else
+	const std::vector<std::string> dirs = readList(env ? env : "", ":");
+#endif
+
+	// nothing waits for it; if the game starts first, the emulator just finds some of it cached already
+	AsyncIO::getInstance()->post([gamePath, program, words, dirs, budget] {
+		// the game first, it's usually the big one
+		std::vector<fs::path> paths;
+		paths.push_back(gamePath);
+		collectDiscFiles(gamePath, paths, 0);
+
+		// anything in the command that's a file (the emulator, a libretro core, a config), and the emulator from $PATH
+		boost::system::error_code ec;
+		for(auto dir = dirs.begin(); !program.empty() && dir != dirs.end(); dir++)
+		{
+			if(fs::is_regular_file(fs::path(*dir) / program, ec))
+			{
+				paths.push_back(fs::path(*dir) / program);
+				break;
+			}
+		}
+		for(auto it = words.begin(); it != words.end(); it++)
+		{
+			if(fs::is_regular_file(*it, ec))
+				paths.push_back(*it);
+		}
+
+		size_t remaining = budget;
+		for(auto it = paths.begin(); it != paths.end() && remaining > 0; it++)
+		{
+			const uintmax_t size = fs::file_size(*it, ec);
+			if(ec)
+				continue;
+
+			const size_t bytes = (size_t)std::min<uintmax_t>(size, remaining);
+			prefetchFile(it->string(), bytes);
+			remaining -= bytes;
+		}
+	});
+}
+
+// what populateFolder() needs from the disk for one directory
+struct DirScan
+{
+	DirScan() : listed(false), isDirectory(false), recursiveLink(false) {}
+
+	RomCacheDir dir;
+	bool listed; // false if the directory's mtime still matches the cached listing, which can be used as is
+	bool isDirectory;
+	bool recursiveLink;
+	std::string error;
+};
+
+static bool getEntryTypeFor(const fs::path& filePath, const std::vector<std::string>& extensions, FileType& type)
+{
+	//this is a little complicated because we allow a list of extensions to be defined (delimited with a space)
+	//we first get the extension of the file itself:
+	std::string extension = filePath.extension().string();
+	
+	//fyi, folders *can* also match the extension and be added as games - this is mostly just to support higan
+	//see issue #75: https://github.com/Aloshi/EmulationStation/issues/75
+
+	if(std::find(extensions.begin(), extensions.end(), extension) != extensions.end())
+		type = GAME;
+	else if(fs::is_directory(filePath)) //add directories that also do not match an extension as folders
+		type = FOLDER;
+	else
+		return false;
 
-	//make sure that this isn't a symlink to a thing we already have
-	if(fs::is_symlink(folderPath))
+	return true;
+}
+
+// Runs on an AsyncIO thread and may outlive the system, so it only gets copies. If checkMtime, the directory's
+// mtime is read first and nothing is listed if it's still cachedMtime (recursive symlinks are caught before that).
+static void scanDirectory(const fs::path& folderPath, const std::vector<std::string>& extensions, bool checkMtime, std::time_t cachedMtime, DirScan& out)
+{
+	try
 	{
-		//if this symlink resolves to somewhere that's at the beginning of our path, it's gonna recurse
-		if(folderStr.find(fs::canonical(folderPath).generic_string()) == 0)
+		//make sure that this isn't a symlink to a thing we already have, before the mtime check can skip the listing
+		if(fs::is_symlink(folderPath))
 		{
-			LOG(LogWarning) << "Skipping infinitely recursive symlink \"" << folderPath << "\"";
+			//if this symlink resolves to somewhere that's at the beginning of our path, it's gonna recurse
+			if(folderPath.generic_string().find(fs::canonical(folderPath).generic_string()) == 0)
+			{
+				out.listed = true;
+				out.isDirectory = true;
+				out.recursiveLink = true;
+				return;
+			}
+		}
+
+		std::time_t mtime = 0;
+		if(checkMtime)
+		{
+			boost::system::error_code ec;
+			mtime = fs::last_write_time(folderPath, ec);
+			if(ec)
+				mtime = 0;
+
+			if(mtime != 0 && mtime == cachedMtime)
+				return;
+		}
+
+		out.listed = true;
+		out.isDirectory = fs::is_directory(folderPath);
+		if(!out.isDirectory)
 			return;
+
+		// a directory modified within the last couple of seconds might still change in the same
+		// mtime tick, so don't trust this listing on the next run
+		out.dir.mtime = (std::time(NULL) - mtime > 2) ? mtime : 0;
+
+		fs::path filePath;
+		for(fs::directory_iterator end, dir(folderPath); dir != end; ++dir)
+		{
+			filePath = (*dir).path();
+
+			if(filePath.stem().empty())
+				continue;
+
+			FileType type;
+			if(!getEntryTypeFor(filePath, extensions, type))
+				continue;
+
+			RomCacheDir::Entry entry = { filePath.filename().string(), type };
+			out.dir.entries.push_back(entry);
 		}
+	}catch(const fs::filesystem_error& e)
+	{
+		out.error = e.what();
 	}
+}
 
-	fs::path filePath;
-	std::string extension;
-	bool isGame;
-	for(fs::directory_iterator end, dir(folderPath); dir != end; ++dir)
+bool SystemData::runScanJob(const std::function<void()>& job)
+{
+	// no timeout, no need for another thread
+	if(mScanDeadline == std::chrono::steady_clock::time_point::max())
 	{
-		filePath = (*dir).path();
+		job();
+		return true;
+	}
 
-		if(filePath.stem().empty())
-			continue;
+	return AsyncIO::getInstance()->run(job, mScanDeadline);
+}
 
-		//this is a little complicated because we allow a list of extensions to be defined (delimited with a space)
-		//we first get the extension of the file itself:
-		extension = filePath.extension().string();
-		
-		//fyi, folders *can* also match the extension and be added as games - this is mostly just to support higan
-		//see issue #75: https://github.com/Aloshi/EmulationStation/issues/75
+void SystemData::populateFolder(FileData* folder, const RomCache* oldCache, RomCache* newCache, bool& changed)
+{
+	const fs::path& folderPath = folder->getPath();
+	const std::string folderStr = folderPath.generic_string();
+	TRACE_SCOPE("populateFolder", folderStr);
+
+	const RomCacheDir* cached = NULL;
+	if(oldCache)
+	{
+		auto it = oldCache->find(folderStr);
+		if(it != oldCache->end())
+			cached = &it->second;
+	}
 
-		isGame = false;
-		if(std::find(mSearchExtensions.begin(), mSearchExtensions.end(), extension) != mSearchExtensions.end())
+	// the stat and the listing happen on an I/O thread, so a hung network mount can only hold us up until the deadline
+	std::shared_ptr<DirScan> scan = std::make_shared<DirScan>();
+	if(!mScanTimedOut)
+	{
+		std::shared_ptr<const std::vector<std::string> > extensions = mScanExtensions;
+		const bool checkMtime = oldCache != NULL;
+		const std::time_t cachedMtime = cached ? cached->mtime : 0;
+		if(!runScanJob([scan, folderPath, extensions, checkMtime, cachedMtime] { scanDirectory(folderPath, *extensions, checkMtime, cachedMtime, *scan); }))
 		{
-			FileData* newGame = new FileData(GAME, filePath.generic_string(), this);
-			folder->addChild(newGame);
-			isGame = true;
+			LOG(LogWarning) << "Listing \"" << folderStr << "\" is taking too long, system \"" << mName << "\" is shown with what was found so far and finished in the background";
+			mScanTimedOut = true;
 		}
+	}
 
-		//add directories that also do not match an extension as folders
-		if(!isGame && fs::is_directory(filePath))
+	// past the deadline whatever the last run saw has to do, the late scan fills in the rest
+	if(mScanTimedOut)
+	{
+		if(cached)
 		{
-			FileData* newFolder = new FileData(FOLDER, filePath.generic_string(), this);
-			populateFolder(newFolder);
-
-			//ignore folders that do not contain games
-			if(newFolder->getChildrenByFilename().size() == 0)
-				delete newFolder;
-			else
-				folder->addChild(newFolder);
+			for(auto it = cached->entries.begin(); it != cached->entries.end(); it++)
+				addFolderEntry(folder, folderPath / it->name, it->type, oldCache, newCache, changed);
 		}
+		return;
+	}
+
+	// before the cached listing is used: the mtime is the link target's, so a link pointed back up the tree can still match it
+	if(scan->recursiveLink)
+	{
+		LOG(LogWarning) << "Skipping infinitely recursive symlink \"" << folderPath << "\"";
+		return;
+	}
+
+	// if the directory hasn't been touched since we cached it, rebuild it from the cache
+	// (one stat instead of one per file)
+	if(!scan->listed)
+	{
+		for(auto it = cached->entries.begin(); it != cached->entries.end(); it++)
+			addFolderEntry(folder, folderPath / it->name, it->type, oldCache, newCache, changed);
+
+		(*newCache)[folderStr] = *cached;
+		return;
+	}
+
+	if(!scan->error.empty())
+	{
+		LOG(LogError) << "Error listing \"" << folderStr << "\": " << scan->error;
+		return;
 	}
+
+	if(!scan->isDirectory)
+	{
+		LOG(LogWarning) << "Error - folder with path \"" << folderPath << "\" is not a directory!";
+		return;
+	}
+
+	changed = true;
+
+	for(auto it = scan->dir.entries.begin(); it != scan->dir.entries.end(); it++)
+		addFolderEntry(folder, folderPath / it->name, it->type, oldCache, newCache, changed);
+
+	if(newCache)
+		(*newCache)[folderStr] = scan->dir;
 }
 
-std::vector<std::string> readList(const std::string& str, const char* delims = " \t\r\n,")
+bool SystemData::getEntryType(const boost::filesystem::path& filePath, FileType& type) const
 {
-	std::vector<std::string> ret;
+	return getEntryTypeFor(filePath, mSearchExtensions, type);
+}
 
-	size_t prevOff = str.find_first_not_of(delims, 0);
-	size_t off = str.find_first_of(delims, prevOff);
-	while(off != std::string::npos || prevOff != std::string::npos)
+// a full listing of a system whose scan ran out of time, done on an AsyncIO thread without a deadline
+struct SystemData::LateScan
+{
+	LateScan() : done(false) {}
+
+	std::atomic<bool> done;
+	RomCache scanned; // every directory below the start path, only the job touches it until done
+};
+
+static void scanTree(const fs::path& folderPath, const std::vector<std::string>& extensions, RomCache& out)
+{
+	DirScan scan;
+	scanDirectory(folderPath, extensions, true, 0, scan);
+	if(!scan.isDirectory || scan.recursiveLink || !scan.error.empty())
+		return;
+
+	for(auto it = scan.dir.entries.begin(); it != scan.dir.entries.end(); it++)
 	{
-		ret.push_back(str.substr(prevOff, off - prevOff));
+		if(it->type == FOLDER)
+			scanTree(folderPath / it->name, extensions, out);
+	}
 
-		prevOff = str.find_first_not_of(delims, off);
-		off = str.find_first_of(delims, prevOff);
+	out[folderPath.generic_string()] = std::move(scan.dir);
+}
+
+void SystemData::startLateScan()
+{
+	std::shared_ptr<LateScan> scan = std::make_shared<LateScan>();
+	std::shared_ptr<const std::vector<std::string> > extensions = mScanExtensions;
+	const fs::path root = mRootFolder->getPath();
+	AsyncIO::getInstance()->post([scan, extensions, root] {
+		scanTree(root, *extensions, scan->scanned);
+		scan->done = true;
+	});
+
+	mLateScan = scan;
+}
+
+void SystemData::mergeScannedFolder(FileData* folder, const RomCache& scanned, std::vector<FileData*>* added)
+{
+	const fs::path folderPath = folder->getPath();
+	auto dir = scanned.find(folderPath.generic_string());
+	if(dir == scanned.end())
+		return;
+
+	bool grew = false;
+	for(auto it = dir->second.entries.begin(); it != dir->second.entries.end(); it++)
+	{
+		FileData* existing = folder->findChild(it->name);
+		if(existing)
+		{
+			if(existing->getType() == FOLDER)
+				mergeScannedFolder(existing, scanned, added);
+			continue;
+		}
+
+		FileData* file = createFileData(it->type, (folderPath / it->name).generic_string());
+		if(it->type == FOLDER)
+		{
+			// nothing inside a new folder has been seen yet, only the folder itself is news
+			mergeScannedFolder(file, scanned, NULL);
+			if(file->getChildrenByFilename().size() == 0)
+			{
+				deleteFileData(file);
+				continue;
+			}
+		}
+
+		folder->addChild(file);
+		grew = true;
+		if(added)
+			added->push_back(file);
 	}
 
-	return ret;
+	if(grew)
+		folder->sort(FileSorts::SortTypes.at(0));
+}
+
+void SystemData::updateLateScans(std::vector<FileData*>& added)
+{
+	// pending systems aren't shown yet, nobody needs to hear about their new games
+	for(int shown = 0; shown < 2; shown++)
+	{
+		const std::vector<SystemData*>& systems = shown ? sSystemVector : sPendingSystems;
+		for(auto it = systems.begin(); it != systems.end(); it++)
+		{
+			SystemData* system = *it;
+			if(!system->isLoaded() || !system->mLateScan || !system->mLateScan->done)
+				continue;
+
+			std::shared_ptr<LateScan> scan = system->mLateScan;
+			system->mLateScan.reset();
+
+			const unsigned int before = system->mRootFolder->getGameCount();
+			system->mergeScannedFolder(system->mRootFolder, scan->scanned, shown ? &added : NULL);
+			system->mScanTimedOut = false;
+
+			const unsigned int count = system->mRootFolder->getGameCount();
+			LOG(LogInfo) << "Finished listing system \"" << system->getName() << "\" in the background, " << (count - before) << " more games";
+
+			if(system->mLoadSettings.romCache)
+			{
+				orderRomCache(system->mRootFolder, scan->scanned);
+				saveRomCache(system, scan->scanned);
+			}
+			system->collectNameCodePoints();
+			writeSummary(system, count);
+		}
+	}
+}
+
+FileData* SystemData::addFileFromDisk(FileData* folder, const boost::filesystem::path& filePath)
+{
+	if(filePath.stem().empty())
+		return NULL;
+
+	const std::string key = filePath.filename().string();
+	if(folder->findChild(key))
+		return NULL;
+
+	FileType type;
+	if(!getEntryType(filePath, type))
+		return NULL;
+
+	bool changed = false;
+	addFolderEntry(folder, filePath, type, NULL, NULL, changed);
+
+	return folder->findChild(key);
+}
+
+void SystemData::addFolderEntry(FileData* folder, const boost::filesystem::path& filePath, FileType type, const RomCache* oldCache, RomCache* newCache, bool& changed)
+{
+	if(type == GAME)
+	{
+		FileData* newGame = createFileData(GAME, filePath.generic_string());
+		folder->addChild(newGame);
+	}else{
+		FileData* newFolder = createFileData(FOLDER, filePath.generic_string());
+		populateFolder(newFolder, oldCache, newCache, changed);
+
+		//ignore folders that do not contain games
+		if(newFolder->getChildrenByFilename().size() == 0)
+			deleteFileData(newFolder);
+		else
+			folder->addChild(newFolder);
+	}
+}
+
+// everything read from a <system> tag that's needed to construct a SystemData
+struct SystemDecl
+{
+	std::string name;
+	std::string fullName;
+	std::string path;
+	std::vector<std::string> extensions;
+	std::string command;
+	std::vector<PlatformIds::PlatformId> platformIds;
+	std::string themeFolder;
+};
+
+static SystemData* createSystem(const SystemDecl& decl, const SystemData::LoadSettings& loadSettings)
+{
+	return new SystemData(decl.name, decl.fullName, decl.path, decl.extensions, decl.command, decl.platformIds, decl.themeFolder, loadSettings);
 }
 
 //creates systems from information located in a config file
@@ -239,8 +946,8 @@ bool SystemData::loadConfig()
 		return false;
 	}
 
-	pugi::xml_document doc;
-	pugi::xml_parse_result res = doc.load_file(path.c_str());
+	XmlFile doc;
+	pugi::xml_parse_result res = doc.load(path);
 
 	if(!res)
 	{
@@ -258,6 +965,7 @@ bool SystemData::loadConfig()
 		return false;
 	}
 
+	std::vector<SystemDecl> decls;
 	for(pugi::xml_node system = systemList.child("system"); system; system = system.next_sibling("system"))
 	{
 		std::string name, fullname, path, cmd, themeFolder;
@@ -310,16 +1018,96 @@ bool SystemData::loadConfig()
 		boost::filesystem::path genericPath(path);
 		path = genericPath.generic_string();
 
-		SystemData* newSys = new SystemData(name, fullname, path, extensions, cmd, platformIds, themeFolder);
-		if(newSys->getRootFolder()->getChildrenByFilename().size() == 0)
+		SystemDecl decl = { name, fullname, path, extensions, cmd, platformIds, themeFolder };
+		decls.push_back(decl);
+	}
+
+	// build the systems - they don't share any state, so this can be spread over a few threads
+	// (the settings are read here, Settings isn't safe to use from them)
+	std::vector<SystemData*> loaded(decls.size(), NULL);
+	const LoadSettings loadSettings = LoadSettings::read();
+
+	unsigned int threadCount = 1;
+	if(Settings::getInstance()->getBool("ParallelSystemLoad"))
+	{
+		threadCount = std::thread::hardware_concurrency();
+		if(threadCount == 0)
+			threadCount = 2;
+		if(threadCount > decls.size())
+			threadCount = decls.size();
+	}
+
+	if(threadCount <= 1)
+	{
+		for(unsigned int i = 0; i < decls.size(); i++)
+			loaded[i] = createSystem(decls[i], loadSettings);
+	}else{
+		// these lazily initialize shared state, make sure that happens on this thread and not in a worker
+		ResourceManager::getInstance();
+		ThemeData::getThemeFromCurrentSet("");
+
+		LOG(LogInfo) << "Loading " << decls.size() << " systems on " << threadCount << " threads...";
+
+		std::atomic<unsigned int> next(0);
+		auto worker = [&] {
+			unsigned int i;
+			while((i = next++) < decls.size())
+				loaded[i] = createSystem(decls[i], loadSettings);
+		};
+
+		std::vector<std::thread> threads;
+		for(unsigned int i = 0; i < threadCount; i++)
+			threads.push_back(std::thread(worker));
+		for(auto it = threads.begin(); it != threads.end(); it++)
+			it->join();
+	}
+
+	// keep the order from es_systems.cfg
+	for(unsigned int i = 0; i < loaded.size(); i++)
+	{
+		SystemData* system = loaded[i];
+		system->mConfigIndex = i;
+
+		// one whose scan timed out before finding anything might still have games, wait for the late scan
+		if((!system->isLoaded() && !system->mGameCountKnown) || (system->mLateScan && system->mRootFolder->getChildren().empty()))
+		{
+			sPendingSystems.push_back(system);
+		}else if(system->isLoaded() ? system->mRootFolder->getChildren().empty() : system->mCachedGameCount == 0)
+		{
+			LOG(LogWarning) << "System \"" << system->getName() << "\" has no games! Ignoring it.";
+			delete system;
+		}else{
+			sSystemVector.push_back(system);
+		}
+	}
+
+	// the system view needs something to show, load pending systems until one has games (only on the first run, normally)
+	std::vector<SystemData*> stillScanning;
+	while(sSystemVector.empty() && !sPendingSystems.empty())
+	{
+		SystemData* system = sPendingSystems.front();
+		sPendingSystems.erase(sPendingSystems.begin());
+
+		system->ensureLoaded();
+		if(system->mLateScan && system->mRootFolder->getChildren().empty())
+		{
+			stillScanning.push_back(system);
+		}else if(system->mRootFolder->getChildren().empty())
 		{
-			LOG(LogWarning) << "System \"" << name << "\" has no games! Ignoring it.";
-			delete newSys;
+			LOG(LogWarning) << "System \"" << system->getName() << "\" has no games! Ignoring it.";
+			delete system;
 		}else{
-			sSystemVector.push_back(newSys);
+			sSystemVector.push_back(system);
 		}
 	}
 
+	sPendingSystems.insert(sPendingSystems.end(), stillScanning.begin(), stillScanning.end());
+
+	if(!sPendingSystems.empty())
+		LOG(LogInfo) << sPendingSystems.size() << " systems will show up once they're loaded";
+
+	ThemeData::saveCache();
+
 	return true;
 }
 
@@ -369,13 +1157,140 @@ void SystemData::writeExampleConfig(const std::string& path)
 	LOG(LogError) << "Example config written!  Go read it at \"" << path << "\"!";
 }
 
+static std::thread sBackgroundLoader;
+static std::atomic<bool> sStopBackgroundLoader(false);
+
+void SystemData::loadRemainingInBackground()
+{
+	if(sBackgroundLoader.joinable())
+		return;
+
+	std::vector<SystemData*> systems;
+	for(auto it = sSystemVector.begin(); it != sSystemVector.end(); it++)
+	{
+		if(!(*it)->isLoaded())
+			systems.push_back(*it);
+	}
+	systems.insert(systems.end(), sPendingSystems.begin(), sPendingSystems.end());
+
+	if(systems.empty())
+		return;
+
+	std::sort(systems.begin(), systems.end(), [](SystemData* a, SystemData* b) { return a->mConfigIndex < b->mConfigIndex; });
+
+	sStopBackgroundLoader = false;
+	sBackgroundLoader = std::thread([systems] {
+		for(auto it = systems.begin(); it != systems.end() && !sStopBackgroundLoader; it++)
+			(*it)->ensureLoaded();
+	});
+}
+
+bool SystemData::updatePendingSystems()
+{
+	bool changed = false;
+	for(auto it = sPendingSystems.begin(); it != sPendingSystems.end(); )
+	{
+		SystemData* system = *it;
+		if(!system->isLoaded() || (system->mLateScan && system->mRootFolder->getChildren().empty()))
+		{
+			it++;
+			continue;
+		}
+
+		it = sPendingSystems.erase(it);
+		changed = true;
+
+		if(system->mRootFolder->getChildren().empty())
+		{
+			LOG(LogWarning) << "System \"" << system->getName() << "\" has no games! Ignoring it.";
+
+			// the background loader may still be on its way out of ensureLoaded()
+			{
+				std::lock_guard<std::recursive_mutex> lock(system->mLoadMutex);
+			}
+			delete system;
+			continue;
+		}
+
+		auto pos = std::find_if(sSystemVector.begin(), sSystemVector.end(), [system](SystemData* other) { return other->mConfigIndex > system->mConfigIndex; });
+		sSystemVector.insert(pos, system);
+	}
+
+	return changed;
+}
+
+void SystemData::getLoadProgress(unsigned int& loaded, unsigned int& total)
+{
+	loaded = 0;
+	total = sSystemVector.size() + sPendingSystems.size();
+	for(auto it = sSystemVector.begin(); it != sSystemVector.end(); it++)
+	{
+		if((*it)->isLoaded())
+			loaded++;
+	}
+	for(auto it = sPendingSystems.begin(); it != sPendingSystems.end(); it++)
+	{
+		if((*it)->isLoaded())
+			loaded++;
+	}
+}
+
+void SystemData::stopBackgroundLoader()
+{
+	if(sBackgroundLoader.joinable())
+	{
+		sStopBackgroundLoader = true;
+		sBackgroundLoader.join();
+	}
+}
+
 void SystemData::deleteSystems()
 {
+	// don't pull systems out from under the background loader
+	stopBackgroundLoader();
+
+	SearchIndex::getInstance()->clear();
+	PlayedIndex::getInstance()->clear();
+
 	for(unsigned int i = 0; i < sSystemVector.size(); i++)
 	{
 		delete sSystemVector.at(i);
 	}
 	sSystemVector.clear();
+
+	for(auto it = sPendingSystems.begin(); it != sPendingSystems.end(); it++)
+		delete *it;
+	sPendingSystems.clear();
+
+	// systems save their gamelists when deleted, make sure those are on disk before we go on
+	flushGamelistWrites();
+}
+
+void SystemData::shutdownSystems()
+{
+	if(!Settings::getInstance()->getBool("FastExit"))
+	{
+		deleteSystems();
+		return;
+	}
+
+	stopBackgroundLoader();
+	SearchIndex::getInstance()->clear(); // stops its worker
+
+	// every system's changes are copied out first, then written side by side
+	for(auto it = sSystemVector.begin(); it != sSystemVector.end(); it++)
+		(*it)->saveGamelistOnExit();
+	for(auto it = sPendingSystems.begin(); it != sPendingSystems.end(); it++)
+		(*it)->saveGamelistOnExit();
+
+	unsigned int threadCount = std::thread::hardware_concurrency();
+	if(threadCount < 2)
+		threadCount = 2; // the time goes into fsync, not the CPU
+	flushGamelistWrites(threadCount);
+
+	// the process is about to exit and takes the trees with it, freeing them first is wasted time
+	sSystemVector.clear();
+	sPendingSystems.clear();
 }
 
 std::string SystemData::getConfigPath(bool forWrite)
@@ -419,21 +1334,70 @@ std::string SystemData::getThemePath() const
 	return ThemeData::getThemeFromCurrentSet(mThemeFolder).generic_string();
 }
 
+std::string SystemData::getGamelistStorePath(bool forWrite) const
+{
+	fs::path filePath = getHomePath() + "/.emulationstation/gamelists/" + mName + "/gamelist.esdb";
+	if(forWrite)
+		fs::create_directories(filePath.parent_path());
+	return filePath.generic_string();
+}
+
+std::string SystemData::getPlayJournalPath(bool forWrite) const
+{
+	fs::path filePath = getHomePath() + "/.emulationstation/gamelists/" + mName + "/plays.esdb";
+	if(forWrite)
+		fs::create_directories(filePath.parent_path());
+	return filePath.generic_string();
+}
+
 bool SystemData::hasGamelist() const
 {
-	return (fs::exists(getGamelistPath(false)));
+	return fs::exists(getGamelistPath(false)) || fs::exists(getGamelistStorePath(false));
 }
 
 unsigned int SystemData::getGameCount() const
 {
-	return mRootFolder->getFilesRecursive(GAME).size();
+	if(!mLoaded)
+		return mCachedGameCount;
+
+	return mRootFolder->getGameCount();
+}
+
+bool SystemData::reloadTheme(bool logErrors)
+{
+	std::shared_ptr<ThemeData> theme = std::make_shared<ThemeData>();
+	try
+	{
+		theme->loadFile(mThemePath);
+	} catch(ThemeException& e)
+	{
+		if(logErrors)
+			LOG(LogError) << e.what();
+		return false;
+	}
+
+	mTheme = theme;
+	return true;
+}
+
+bool SystemData::invalidateTheme()
+{
+	if(getThemePath() == mThemePath)
+		return false;
+
+	mThemeStale = true;
+	return true;
 }
 
 void SystemData::loadTheme()
 {
+	TRACE_SCOPE("SystemData::loadTheme", mName);
+
 	mTheme = std::make_shared<ThemeData>();
 
 	std::string path = getThemePath();
+	mThemePath = path;
+	mThemeStale = false;
 
 	if(!fs::exists(path)) // no theme available for this platform
 		return;
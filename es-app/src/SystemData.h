@@ -2,20 +2,55 @@
 
 #include <vector>
 #include <string>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <functional>
 #include "FileData.h"
 #include "Window.h"
 #include "MetaData.h"
 #include "PlatformId.h"
 #include "ThemeData.h"
+#include "RomCache.h"
+#include "FileDataArena.h"
+#include "resources/Font.h"
 
 class SystemData
 {
 public:
+	// What loading a system goes by, read from Settings on the main thread: systems are built on loadConfig()'s
+	// worker threads and the background loader, which mustn't touch Settings while the UI may be changing it.
+	struct LoadSettings
+	{
+		bool lazy; // "LazyLoadSystems"
+		bool progressive; // "ProgressiveStartup"
+		int scanTimeout; // "ScanTimeout"
+		bool parseGamelistOnly; // "ParseGamelistOnly"
+		bool romCache; // "RomCache"
+		bool ignoreGamelist; // "IgnoreGamelist"
+		bool gamelistCheckTree; // "GamelistCheckTree"
+		bool gamelistStore; // "GamelistBackend" is "store"
+		bool hashRoms; // "HashRomsInBackground"
+
+		static LoadSettings read(); // main thread only
+	};
+
 	SystemData(const std::string& name, const std::string& fullName, const std::string& startPath, const std::vector<std::string>& extensions, 
-		const std::string& command, const std::vector<PlatformIds::PlatformId>& platformIds, const std::string& themeFolder);
+		const std::string& command, const std::vector<PlatformIds::PlatformId>& platformIds, const std::string& themeFolder,
+		const LoadSettings& loadSettings = LoadSettings::read());
 	~SystemData();
 
-	inline FileData* getRootFolder() const { return mRootFolder; };
+	inline const LoadSettings& getLoadSettings() const { return mLoadSettings; }
+
+	// In lazy mode ("LazyLoadSystems") the tree is only built when it's first asked for (or by the background loader).
+	FileData* getRootFolder();
+	inline bool isLoaded() const { return mLoaded; }
+	// false while the ROM folders are still being listed in the background because they took longer than "ScanTimeout"
+	inline bool isScanComplete() const { return !mScanTimedOut; }
+	// true once any game or folder got an image or thumbnail, decides between the basic and detailed gamelist view
+	inline bool hasImages() const { return mHasImages; }
+	inline void setHasImages() { mHasImages = true; }
 	inline const std::string& getName() const { return mName; }
 	inline const std::string& getFullName() const { return mFullName; }
 	inline const std::string& getStartPath() const { return mStartPath; }
@@ -25,23 +60,72 @@ public:
 	inline const std::vector<PlatformIds::PlatformId>& getPlatformIds() const { return mPlatformIds; }
 	inline bool hasPlatformId(PlatformIds::PlatformId id) { return std::find(mPlatformIds.begin(), mPlatformIds.end(), id) != mPlatformIds.end(); }
 
-	inline const std::shared_ptr<ThemeData>& getTheme() const { return mTheme; }
+	// loaded again first if invalidateTheme() found it changed
+	inline const std::shared_ptr<ThemeData>& getTheme() const { if(mThemeStale) const_cast<SystemData*>(this)->loadTheme(); return mTheme; }
+	inline const std::shared_ptr<MetaDataStringPool>& getMetaDataPool() const { return mMetaDataPool; }
+
+	// Moves the values and names still in the tree into a new pool, so ones left behind by scraping or removed games
+	// are freed. Walks the whole tree, so it's for after a batch of changes. Main thread only, does nothing until loaded.
+	void compactMetaDataPool();
+
+	// FileData nodes for this system's tree live in an arena that's freed along with the system
+	inline FileData* createFileData(FileType type, const boost::filesystem::path& path) { return mFileArena.create(type, path, this); }
+	void deleteFileData(FileData* file);
+
+	// Adds filePath to folder the same way a scan would have (a game with one of our extensions, or a folder
+	// containing games). Returns the new node, or NULL if it isn't something we'd list or it's already there.
+	FileData* addFileFromDisk(FileData* folder, const boost::filesystem::path& filePath);
 
 	std::string getGamelistPath(bool forWrite) const;
+	// where the "store" gamelist backend keeps this system's metadata (always in the home folder)
+	std::string getGamelistStorePath(bool forWrite) const;
+	// where launches are recorded until the gamelist is saved (see recordPlay())
+	std::string getPlayJournalPath(bool forWrite) const;
 	bool hasGamelist() const;
 	std::string getThemePath() const;
 	
 	unsigned int getGameCount() const;
 
+	// Every non-ASCII code point used by the names in this system (sorted), collected on load so
+	// the gamelist's fonts can rasterize them before it's shown. Only valid once loaded.
+	inline const std::vector<UnicodeChar>& getNameCodePoints() const { return mNameCodePoints; }
+
 	void launchGame(Window* window, FileData* game);
 
+	// Starts reading the game's files (tracks of a .cue, discs of a .m3u) and the emulator's into the OS cache
+	// on an AsyncIO thread, so launchGame() doesn't wait on a cold disk. Up to "LaunchReadahead" MB.
+	void prefetchGame(FileData* game);
+
+	// Loads whatever systems haven't been loaded yet on a background thread, in es_systems.cfg order.
+	static void loadRemainingInBackground();
+
+	// With "ProgressiveStartup", systems we don't have a game count for yet are loaded in the background before
+	// they're shown. This moves the finished ones into sSystemVector (in es_systems.cfg order) and drops the empty ones.
+	// Main thread only, returns true if sSystemVector changed.
+	static bool updatePendingSystems();
+	inline static bool hasPendingSystems() { return !sPendingSystems.empty(); }
+	// how many systems (shown or pending) are loaded so far, out of all of them
+	static void getLoadProgress(unsigned int& loaded, unsigned int& total);
+
+	// Merges in what the background listings of systems whose scan timed out found once they finish.
+	// Main thread only; the new nodes (only the topmost ones, for shown systems) are appended to added.
+	static void updateLateScans(std::vector<FileData*>& added);
+
 	static void deleteSystems();
+	// For exiting: saves the gamelists in parallel, waits for them, and leaves the trees to go with the process
+	// instead of freeing them (with "FastExit", otherwise it's just deleteSystems()).
+	static void shutdownSystems();
 	static bool loadConfig(); //Load the system config file at getConfigPath(). Returns true if no errors were encountered. An example will be written if the file doesn't exist.
 	static void writeExampleConfig(const std::string& path);
 	static std::string getConfigPath(bool forWrite); // if forWrite, will only return ~/.emulationstation/es_systems.cfg, never /etc/emulationstation/es_systems.cfg
 
 	static std::vector<SystemData*> sSystemVector;
 
+private:
+	static std::vector<SystemData*> sPendingSystems;
+
+public:
+
 	inline std::vector<SystemData*>::const_iterator getIterator() const { return std::find(sSystemVector.begin(), sSystemVector.end(), this); };
 	inline std::vector<SystemData*>::const_reverse_iterator getRevIterator() const { return std::find(sSystemVector.rbegin(), sSystemVector.rend(), this); };
 	
@@ -64,6 +148,14 @@ public:
 	// Load or re-load theme.
 	void loadTheme();
 
+	// Loads the same theme file again (for when it changed on disk). If it doesn't parse the old theme is kept
+	// and false is returned, with the error logged if logErrors is set.
+	bool reloadTheme(bool logErrors);
+
+	// For when the theme set changed: if our theme is now a different file, it's loaded again the next time
+	// getTheme() is called, and true is returned.
+	bool invalidateTheme();
+
 private:
 	std::string mName;
 	std::string mFullName;
@@ -73,8 +165,67 @@ private:
 	std::vector<PlatformIds::PlatformId> mPlatformIds;
 	std::string mThemeFolder;
 	std::shared_ptr<ThemeData> mTheme;
+	std::string mThemePath; // what mTheme was loaded from
+	bool mThemeStale;
+	std::shared_ptr<MetaDataStringPool> mMetaDataPool;
+
+	// mLaunchCommand split once into literal text and the variables to substitute, see launchGame()
+	enum LaunchVariable
+	{
+		LAUNCH_TEXT,
+		LAUNCH_ROM, // %ROM%, escaped for the shell
+		LAUNCH_BASENAME, // %BASENAME%
+		LAUNCH_ROM_RAW, // %ROM_RAW%
+		LAUNCH_ROMDIR, // %ROMDIR%, escaped like %ROM%
+		LAUNCH_SYSTEM // %SYSTEM%
+	};
+
+	struct LaunchToken
+	{
+		LaunchVariable var;
+		std::string text; // only for LAUNCH_TEXT
+	};
+
+	std::vector<LaunchToken> mLaunchTemplate;
+
+	void parseLaunchCommand();
+	std::string expandLaunchCommand(FileData* game) const;
+
+	// if oldCache is set, directories with an unchanged mtime are rebuilt from it instead of being scanned
+	// if newCache is set, every directory visited is recorded in it; changed is set if anything had to be scanned
+	void populateFolder(FileData* folder, const RomCache* oldCache, RomCache* newCache, bool& changed);
+	bool getEntryType(const boost::filesystem::path& filePath, FileType& type) const;
+	void addFolderEntry(FileData* folder, const boost::filesystem::path& filePath, FileType type, const RomCache* oldCache, RomCache* newCache, bool& changed);
 
-	void populateFolder(FileData* folder);
+	// runs a filesystem job on an AsyncIO thread, false if it didn't finish before mScanDeadline
+	bool runScanJob(const std::function<void()>& job);
+	void startLateScan();
+	void mergeScannedFolder(FileData* folder, const RomCache& scanned, std::vector<FileData*>* added);
 
+	// builds the tree (scan + gamelist), see getRootFolder()
+	void ensureLoaded();
+	void load();
+	void saveGamelistOnExit();
+	static void stopBackgroundLoader();
+	void collectNameCodePoints();
+
+	FileDataArena mFileArena;
 	FileData* mRootFolder;
+	LoadSettings mLoadSettings;
+
+	std::recursive_mutex mLoadMutex;
+	std::atomic<bool> mLoaded;
+	std::atomic<bool> mHasImages; // set by parseGamelist (possibly on the background loader) and when metadata changes
+	bool mLoading;
+	unsigned int mCachedGameCount; // from the summary written last time, until we're loaded
+	bool mGameCountKnown; // there was a summary (or we're loaded)
+	unsigned int mConfigIndex; // position in es_systems.cfg
+	std::vector<UnicodeChar> mNameCodePoints;
+
+	// a scan past its deadline goes on with cached listings only, the full one happens in mLateScan
+	std::chrono::steady_clock::time_point mScanDeadline;
+	std::atomic<bool> mScanTimedOut;
+	std::shared_ptr<const std::vector<std::string> > mScanExtensions; // for I/O jobs, which can outlive us
+	struct LateScan;
+	std::shared_ptr<LateScan> mLateScan;
 };
@@ -0,0 +1,212 @@
+#include "UIBenchmark.h"
+#include "Window.h"
+#include "Renderer.h"
+#include "InputConfig.h"
+#include "SystemData.h"
+#include "Log.h"
+#include "views/ViewController.h"
+#include "components/IList.h"
+#include <SDL.h>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <vector>
+#include <string.h>
+
+#define FRAME_MS 16 // every frame advances the UI by this much, however long it really took
+#define SETTLE_MS 1000 // long enough for camera moves and fades to finish
+#define SCROLL_FINAL_TIER_MS 2000 // how long to stay in the last (unbounded) scroll tier
+
+namespace
+{
+	// a keyboard of our own, so the script doesn't depend on how (or if) the real one is configured
+	const char* KEY_NAMES[] = { "up", "down", "left", "right", "a", "b", "start", "select" };
+	const SDL_Keycode KEYS[] = { SDLK_UP, SDLK_DOWN, SDLK_LEFT, SDLK_RIGHT, SDLK_RETURN, SDLK_ESCAPE, SDLK_F1, SDLK_F2 };
+	const int KEY_COUNT = sizeof(KEYS) / sizeof(KEYS[0]);
+
+	struct FrameSample
+	{
+		float ms;
+		unsigned int drawCalls;
+		unsigned int textureUploads;
+	};
+
+	class UIBenchmark
+	{
+	public:
+		UIBenchmark(Window* window) : mWindow(window), mConfig(DEVICE_KEYBOARD, "Benchmark", ""), mQuit(false)
+		{
+			for(int i = 0; i < KEY_COUNT; i++)
+				mConfig.mapInput(KEY_NAMES[i], Input(DEVICE_KEYBOARD, TYPE_KEY, KEYS[i], 1, true));
+		}
+
+		void run()
+		{
+			ViewController* view = ViewController::get();
+
+			for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end() && !mQuit; it++)
+			{
+				SystemData* system = *it;
+				if(system->getRootFolder()->getChildren().empty())
+					continue;
+
+				view->goToGameList(system);
+				settle("gamelist open");
+
+				// hold down long enough to go through every tier, recording each one separately
+				press("down");
+				for(int tier = 0; tier < LIST_SCROLL_STYLE_QUICK.count && !mQuit; tier++)
+				{
+					const int length = LIST_SCROLL_STYLE_QUICK.tiers[tier].length;
+					std::stringstream label;
+					label << "gamelist scroll tier " << tier;
+					frames(label.str(), length > 0 ? length : SCROLL_FINAL_TIER_MS);
+				}
+				release("down");
+				settle("gamelist settle");
+			}
+
+			if(!SystemData::sSystemVector.empty() && !mQuit)
+			{
+				view->goToSystemView(SystemData::sSystemVector.front());
+				settle("system view settle");
+
+				for(unsigned int i = 0; i < SystemData::sSystemVector.size() && !mQuit; i++)
+				{
+					tap("right", "system switch");
+					frames("system switch", SETTLE_MS / 2);
+				}
+
+				// the menu, scrolled through and closed again
+				tap("start", "menu open");
+				frames("menu open", SETTLE_MS / 2);
+				for(int i = 0; i < 10 && !mQuit; i++)
+				{
+					tap("down", "menu scroll");
+					frames("menu scroll", 100);
+				}
+				tap("b", "menu close");
+				settle("menu close");
+			}
+		}
+
+		bool wasQuit() const { return mQuit; }
+
+		void report(std::ostream& out)
+		{
+			out << std::left << std::setw(26) << "part" << std::right << std::setw(8) << "frames" << std::setw(8) << "p50" << std::setw(8) << "p95"
+				<< std::setw(8) << "p99" << std::setw(8) << "max" << std::setw(10) << "draws" << std::setw(10) << "uploads" << std::setw(8) << "max" << "\n";
+			out << std::fixed << std::setprecision(2);
+
+			for(auto it = mOrder.begin(); it != mOrder.end(); it++)
+			{
+				const std::vector<FrameSample>& samples = mSamples[*it];
+				if(samples.empty())
+					continue;
+
+				std::vector<float> times;
+				double draws = 0, uploads = 0;
+				unsigned int maxUploads = 0;
+				for(auto s = samples.begin(); s != samples.end(); s++)
+				{
+					times.push_back(s->ms);
+					draws += s->drawCalls;
+					uploads += s->textureUploads;
+					maxUploads = std::max(maxUploads, s->textureUploads);
+				}
+				std::sort(times.begin(), times.end());
+
+				out << std::left << std::setw(26) << *it << std::right << std::setw(8) << samples.size()
+					<< std::setw(8) << percentile(times, 0.5f) << std::setw(8) << percentile(times, 0.95f)
+					<< std::setw(8) << percentile(times, 0.99f) << std::setw(8) << times.back()
+					<< std::setw(10) << draws / samples.size() << std::setw(10) << uploads / samples.size() << std::setw(8) << maxUploads << "\n";
+			}
+		}
+
+	private:
+		static float percentile(const std::vector<float>& sorted, float fraction)
+		{
+			return sorted[std::min((size_t)(fraction * (sorted.size() - 1) + 0.5f), sorted.size() - 1)];
+		}
+
+		Input makeInput(const char* name, int value)
+		{
+			for(int i = 0; i < KEY_COUNT; i++)
+			{
+				if(strcmp(KEY_NAMES[i], name) == 0)
+					return Input(DEVICE_KEYBOARD, TYPE_KEY, KEYS[i], value, false, SDL_GetTicks());
+			}
+			return Input();
+		}
+
+		void press(const char* name) { mWindow->input(&mConfig, makeInput(name, 1)); }
+		void release(const char* name) { mWindow->input(&mConfig, makeInput(name, 0)); }
+
+		void tap(const char* name, const std::string& label)
+		{
+			press(name);
+			frame(label);
+			release(name);
+		}
+
+		void settle(const std::string& label) { frames(label, SETTLE_MS); }
+
+		void frames(const std::string& label, int ms)
+		{
+			for(int t = 0; t < ms && !mQuit; t += FRAME_MS)
+				frame(label);
+		}
+
+		void frame(const std::string& label)
+		{
+			// keep the OS happy, but don't let real input interfere with the script
+			SDL_Event event;
+			while(SDL_PollEvent(&event))
+			{
+				if(event.type == SDL_QUIT)
+					mQuit = true;
+			}
+
+			Renderer::resetFrameStats();
+			const Uint64 start = SDL_GetPerformanceCounter();
+
+			mWindow->update(FRAME_MS);
+			mWindow->render();
+			Renderer::swapBuffers();
+			glFinish(); // count the GPU's time too, not just handing it the commands
+
+			FrameSample sample;
+			sample.ms = (float)((SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency());
+			sample.drawCalls = Renderer::getFrameStats().drawCalls;
+			sample.textureUploads = Renderer::getFrameStats().textureUploads;
+
+			if(mSamples.find(label) == mSamples.end())
+				mOrder.push_back(label);
+			mSamples[label].push_back(sample);
+		}
+
+		Window* mWindow;
+		InputConfig mConfig;
+		bool mQuit;
+		std::vector<std::string> mOrder; // labels in the order they first showed up
+		std::map<std::string, std::vector<FrameSample> > mSamples;
+	};
+}
+
+int runUIBenchmark(Window* window)
+{
+	LOG(LogInfo) << "Running UI benchmark...";
+
+	UIBenchmark benchmark(window);
+	benchmark.run();
+
+	std::stringstream report;
+	benchmark.report(report);
+
+	std::cout << report.str();
+	LOG(LogInfo) << "UI benchmark (ms per frame, draws/uploads per frame):\n" << report.str();
+
+	return benchmark.wasQuit() ? 1 : 0;
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+class Window;
+
+// Drives the UI through a fixed script (scrolling every gamelist at each scroll tier, switching systems,
+// opening the menu) at a simulated 60fps, and prints frame time percentiles, draw calls and texture uploads
+// per frame for each part. Used by --benchmark-ui, which also runs headless. Returns the process exit code.
+int runUIBenchmark(Window* window);
@@ -24,11 +24,9 @@ VolumeControl::VolumeControl()
 #elif defined(WIN32) || defined(_WIN32)
 	, mixerHandle(nullptr), endpointVolume(nullptr)
 #endif
+	, mPendingVolume(-1), mRefresh(true), mVolumeKnown(false), mVolume(0), mStop(false)
 {
-	init();
-
-	//get original volume levels for system
-	originalVolume = getVolume();
+	mThread = std::thread(&VolumeControl::run, this);
 }
 
 VolumeControl::VolumeControl(const VolumeControl & right)
@@ -50,7 +48,12 @@ VolumeControl::~VolumeControl()
 	//set original volume levels for system
 	//setVolume(originalVolume);
 
-	deinit();
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mStop = true;
+	}
+	mCondition.notify_all();
+	mThread.join();
 }
 
 std::shared_ptr<VolumeControl> & VolumeControl::getInstance()
@@ -64,6 +67,88 @@ std::shared_ptr<VolumeControl> & VolumeControl::getInstance()
 	return sharedInstance;
 }
 
+void VolumeControl::run()
+{
+	init();
+
+	//get original volume levels for system
+	originalVolume = readVolume();
+
+	std::unique_lock<std::mutex> lock(mMutex);
+	while(true)
+	{
+		mCondition.wait(lock, [this] { return mStop || mRefresh || mPendingVolume >= 0; });
+
+		// a set still waiting goes out before stopping
+		if(mPendingVolume >= 0)
+		{
+			const int volume = mPendingVolume;
+			mPendingVolume = -1;
+			lock.unlock();
+			writeVolume(volume);
+			lock.lock();
+		}else if(mRefresh)
+		{
+			mRefresh = false;
+			lock.unlock();
+			const int volume = readVolume();
+			lock.lock();
+
+			// unless a set came in meanwhile, that one's newer
+			if(!mVolumeKnown)
+			{
+				mVolume = volume;
+				mVolumeKnown = true;
+			}
+			mCondition.notify_all();
+		}else if(mStop)
+		{
+			break;
+		}
+	}
+	lock.unlock();
+
+	deinit();
+}
+
+int VolumeControl::getVolume()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	mCondition.wait(lock, [this] { return mVolumeKnown; });
+	return mVolume;
+}
+
+void VolumeControl::setVolume(int volume)
+{
+	//clamp to 0-100 range
+	if (volume < 0)
+	{
+		volume = 0;
+	}
+	if (volume > 100)
+	{
+		volume = 100;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mPendingVolume = volume;
+		mVolume = volume;
+		mVolumeKnown = true;
+	}
+	mCondition.notify_all();
+}
+
+void VolumeControl::refresh()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mRefresh = true;
+		mVolumeKnown = false;
+	}
+	mCondition.notify_all();
+}
+
 void VolumeControl::init()
 {
 	//initialize audio mixer interface
@@ -234,7 +319,7 @@ void VolumeControl::deinit()
 #endif
 }
 
-int VolumeControl::getVolume() const
+int VolumeControl::readVolume() const
 {
 	int volume = 0;
 
@@ -243,6 +328,9 @@ int VolumeControl::getVolume() const
 #elif defined(__linux__)
 	if (mixerElem != nullptr)
 	{
+		//the handle stays open, pick up changes made by anyone else since the last read
+		snd_mixer_handle_events(mixerHandle);
+
 		//get volume range
 		long minVolume;
 		long maxVolume;
@@ -319,17 +407,8 @@ int VolumeControl::getVolume() const
 	return volume;
 }
 
-void VolumeControl::setVolume(int volume)
+void VolumeControl::writeVolume(int volume)
 {
-	//clamp to 0-100 range
-	if (volume < 0)
-	{
-		volume = 0;
-	}
-	if (volume > 100)
-	{
-		volume = 100;
-	}
 	//store values in internal variables
 	internalVolume = volume;
 #if defined (__APPLE__)
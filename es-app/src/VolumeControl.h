@@ -2,6 +2,9 @@
 
 #include <memory>
 #include <stdint.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #if defined (__APPLE__)
     #error TODO: Not implemented for MacOS yet!!!
@@ -18,9 +21,14 @@
 
 /*!
 Singleton pattern. Call getInstance() to get an object.
+The mixer is opened once and only ever touched from a background thread, getVolume() answers from a cached value and
+setVolume() just queues the latest value, so a slow mixer never holds up the UI.
 */
 class VolumeControl
 {
+	int originalVolume;
+	int internalVolume;
+
 #if defined (__APPLE__)
     #error TODO: Not implemented for MacOS yet!!!
 #elif defined(__linux__)
@@ -36,23 +44,38 @@ class VolumeControl
 	IAudioEndpointVolume * endpointVolume;
 #endif
 
-	int originalVolume;
-	int internalVolume;
-
 	static std::weak_ptr<VolumeControl> sInstance;
 
 	VolumeControl();
 	VolumeControl(const VolumeControl & right);
     VolumeControl & operator=(const VolumeControl & right);
 
-public:
-	static std::shared_ptr<VolumeControl> & getInstance();
-
+	// the mixer itself, only called on mThread
 	void init();
 	void deinit();
+	int readVolume() const;
+	void writeVolume(int volume);
+
+	void run();
+
+	std::thread mThread;
+	std::mutex mMutex;
+	std::condition_variable mCondition; // signalled on new work and when a read is done
+	int mPendingVolume; // the last setVolume() not applied yet, -1 if none
+	bool mRefresh; // read the mixer again
+	bool mVolumeKnown; // mVolume is current
+	int mVolume;
+	bool mStop;
+
+public:
+	static std::shared_ptr<VolumeControl> & getInstance();
 
-	int getVolume() const;
+	// the last volume read or set, waits for the mixer only the first time (or after refresh())
+	int getVolume();
+	// applied in the background, only the latest of several quick calls ever reaches the mixer
 	void setVolume(int volume);
+	// something else (a game) may have changed the volume, read it again
+	void refresh();
 
 	~VolumeControl();
 };
@@ -1,10 +1,12 @@
 #include "components/AsyncReqComponent.h"
 #include "Renderer.h"
+#include "Window.h"
 
 AsyncReqComponent::AsyncReqComponent(Window* window, std::shared_ptr<HttpReq> req, std::function<void(std::shared_ptr<HttpReq>)> onSuccess, std::function<void()> onCancel) 
 	: GuiComponent(window), 
 	mSuccessFunc(onSuccess), mCancelFunc(onCancel), mTime(0), mRequest(req)
 {
+	setUpdating(true);
 	
 }
 
@@ -30,7 +32,9 @@ void AsyncReqComponent::update(int deltaTime)
 		return;
 	}
 
+	// the spinner moves every frame
 	mTime += deltaTime;
+	invalidate();
 }
 
 void AsyncReqComponent::render(const Eigen::Affine3f& parentTrans)
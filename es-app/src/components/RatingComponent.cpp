@@ -3,11 +3,12 @@
 #include "Window.h"
 #include "Util.h"
 #include "resources/SVGResource.h"
+#include <algorithm>
 
-RatingComponent::RatingComponent(Window* window) : GuiComponent(window)
+RatingComponent::RatingComponent(Window* window) : GuiComponent(window), mFilledGeneration(0), mUnfilledGeneration(0)
 {
-	mFilledTexture = TextureResource::get(":/star_filled.svg", true);
-	mUnfilledTexture = TextureResource::get(":/star_unfilled.svg", true);
+	mFilledTexture = TextureResource::get(":/star_filled.svg");
+	mUnfilledTexture = TextureResource::get(":/star_unfilled.svg");
 	mValue = 0.5f;
 	mSize << 64 * NUM_RATING_STARS, 64;
 	updateVertices();
@@ -66,61 +67,86 @@ void RatingComponent::updateVertices()
 
 	const float h = round(getSize().y()); // is the same as a single star's width
 	const float w = round(h * mValue * numStars);
-	const float fw = round(h * numStars);
-
-	mVertices[0].pos << 0.0f, 0.0f;
-		mVertices[0].tex << 0.0f, 1.0f;
-	mVertices[1].pos << w, h;
-		mVertices[1].tex << mValue * numStars, 0.0f;
-	mVertices[2].pos << 0.0f, h;
-		mVertices[2].tex << 0.0f, 0.0f;
-
-	mVertices[3] = mVertices[0];
-	mVertices[4].pos << w, 0.0f;
-		mVertices[4].tex << mValue * numStars, 1.0f;
-	mVertices[5] = mVertices[1];
-
-	mVertices[6] = mVertices[4];
-	mVertices[7].pos << fw, h;
-		mVertices[7].tex << numStars, 0.0f;
-	mVertices[8] = mVertices[1];
-
-	mVertices[9] = mVertices[6];
-	mVertices[10].pos << fw, 0.0f;
-		mVertices[10].tex << numStars, 1.0f;
-	mVertices[11] = mVertices[7];
+
+	for(int star = 0; star < NUM_RATING_STARS; star++)
+	{
+		const float left = h * star;
+		const float right = h * (star + 1);
+
+		// where this star switches from filled to unfilled, in pixels and in texture space
+		const float split = std::min(std::max(w, left), right);
+		const float splitTex = (split - left) / h;
+
+		buildQuad(&mVertices[star * 6], mFilledTexture, left, split, 0.0f, splitTex);
+		buildQuad(&mVertices[(NUM_RATING_STARS + star) * 6], mUnfilledTexture, split, right, splitTex, 1.0f);
+	}
+
+	mVertexBuffer.markDirty();
+	mFilledGeneration = mFilledTexture->getGeneration();
+	mUnfilledGeneration = mUnfilledTexture->getGeneration();
+}
+
+void RatingComponent::buildQuad(Vertex* vertices, const std::shared_ptr<TextureResource>& texture, float x0, float x1, float u0, float u1)
+{
+	const float h = round(getSize().y());
+
+	vertices[0].pos << x0, 0.0f;
+		vertices[0].tex = texture->getTexCoord(u0, 1.0f);
+	vertices[1].pos << x1, h;
+		vertices[1].tex = texture->getTexCoord(u1, 0.0f);
+	vertices[2].pos << x0, h;
+		vertices[2].tex = texture->getTexCoord(u0, 0.0f);
+
+	vertices[3] = vertices[0];
+	vertices[4].pos << x1, 0.0f;
+		vertices[4].tex = texture->getTexCoord(u1, 1.0f);
+	vertices[5] = vertices[1];
 }
 
 void RatingComponent::render(const Eigen::Affine3f& parentTrans)
 {
-	Eigen::Affine3f trans = roundMatrix(parentTrans * getTransform());
+	Eigen::Affine3f trans = roundMatrix(getWorldTransform(parentTrans));
 	Renderer::setMatrix(trans);
 
-	glEnable(GL_TEXTURE_2D);
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	// SVGs are rasterized in the background
+	if(!mFilledTexture->isInitialized() || !mUnfilledTexture->isInitialized())
+	{
+		renderChildren(trans);
+		return;
+	}
 
-	glColor4ub(255, 255, 255, getOpacity());
+	Renderer::setTextureEnabled(true);
+	Renderer::setBlendEnabled(true);
+	Renderer::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	Renderer::setClientArrays(true, true, false);
 
-	glEnableClientState(GL_VERTEX_ARRAY);
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-	
-	glVertexPointer(2, GL_FLOAT, sizeof(Vertex), &mVertices[0].pos);
-	glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), &mVertices[0].tex);
+	Renderer::setConstantColor(0xFFFFFF00 | getOpacity());
 	
-	mFilledTexture->bind();
-	glDrawArrays(GL_TRIANGLES, 0, 6);
+	const int halfCount = NUM_RATING_STARS * 6;
 
+	// either was reuploaded (and maybe moved around in the atlas) since we last looked
+	mFilledTexture->bind();
 	mUnfilledTexture->bind();
-	glDrawArrays(GL_TRIANGLES, 6, 6);
+	if(mFilledTexture->getGeneration() != mFilledGeneration || mUnfilledTexture->getGeneration() != mUnfilledGeneration)
+		updateVertices();
 
-	glDisableClientState(GL_VERTEX_ARRAY);
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-	
-	glDisable(GL_TEXTURE_2D);
-	glDisable(GL_BLEND);
+	const char* base = mVertexBuffer.use(mVertices, sizeof(mVertices));
+	Renderer::vertexPointer(2, GL_FLOAT, sizeof(Vertex), base + offsetof(Vertex, pos));
+	Renderer::texCoordPointer(2, GL_FLOAT, sizeof(Vertex), base + offsetof(Vertex, tex));
+
+	if(mFilledTexture->sharesTextureWith(*mUnfilledTexture))
+	{
+		// same atlas page, one draw does it
+		Renderer::drawArrays(GL_TRIANGLES, 0, halfCount * 2);
+	}else{
+		mFilledTexture->bind();
+		Renderer::drawArrays(GL_TRIANGLES, 0, halfCount);
+
+		mUnfilledTexture->bind();
+		Renderer::drawArrays(GL_TRIANGLES, halfCount, halfCount);
+	}
 
-	glColor4ub(255, 255, 255, 255);
+	Renderer::setConstantColor(0xFFFFFFFF);
 
 	renderChildren(trans);
 }
@@ -150,14 +176,14 @@ void RatingComponent::applyTheme(const std::shared_ptr<ThemeData>& theme, const
 		return;
 
 	bool imgChanged = false;
-	if(properties & PATH && elem->has("filledPath"))
+	if(properties & PATH && elem->has(ThemeProperties::FILLED_PATH))
 	{
-		mFilledTexture = TextureResource::get(elem->get<std::string>("filledPath"), true);
+		mFilledTexture = TextureResource::get(elem->get<std::string>(ThemeProperties::FILLED_PATH));
 		imgChanged = true;
 	}
-	if(properties & PATH && elem->has("unfilledPath"))
+	if(properties & PATH && elem->has(ThemeProperties::UNFILLED_PATH))
 	{
-		mUnfilledTexture = TextureResource::get(elem->get<std::string>("unfilledPath"), true);
+		mUnfilledTexture = TextureResource::get(elem->get<std::string>(ThemeProperties::UNFILLED_PATH));
 		imgChanged = true;
 	}
 
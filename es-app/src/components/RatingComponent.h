@@ -2,6 +2,7 @@
 
 #include "GuiComponent.h"
 #include "resources/TextureResource.h"
+#include "Renderer.h"
 
 #define NUM_RATING_STARS 5
 
@@ -32,13 +33,20 @@ private:
 
 	float mValue;
 
+	// one quad per star for the filled part, then one per star for the unfilled part
+	// (stars are drawn one by one instead of repeating the texture, so they can come from the atlas)
 	struct Vertex
 	{
 		Eigen::Vector2f pos;
 		Eigen::Vector2f tex;
-	} mVertices[12];
+	} mVertices[NUM_RATING_STARS * 2 * 6];
+	Renderer::VertexBuffer mVertexBuffer;
+
+	void buildQuad(Vertex* vertices, const std::shared_ptr<TextureResource>& texture, float x0, float x1, float u0, float u1);
 
 	std::shared_ptr<TextureResource> mFilledTexture;
 	std::shared_ptr<TextureResource> mUnfilledTexture;
+	unsigned int mFilledGeneration; // getGeneration() of the textures when the vertices were built
+	unsigned int mUnfilledGeneration;
 };
 
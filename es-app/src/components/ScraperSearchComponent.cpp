@@ -15,10 +15,21 @@
 #include "guis/GuiTextEditPopup.h"
 #include "guis/GuiTextEditPopupKeyboard.h"
 
+#define THUMBNAIL_CACHE_MAX 64 // result thumbnails kept for the session (they're a few dozen KB each)
+
+std::map<std::string, std::string> ScraperSearchComponent::sThumbnails;
+std::list<std::string> ScraperSearchComponent::sThumbnailOrder;
+
+static const std::string& getThumbnailUrl(const ScraperSearchResult& result)
+{
+	return result.thumbnailUrl.empty() ? result.imageUrl : result.thumbnailUrl;
+}
+
 ScraperSearchComponent::ScraperSearchComponent(Window* window, SearchType type) : GuiComponent(window),
 	mGrid(window, Eigen::Vector2i(4, 3)), mBusyAnim(window), 
 	mSearchType(type)
 {
+	setUpdating(true);
 	addChild(&mGrid);
 
 	mBlockAccept = false;
@@ -208,7 +219,7 @@ void ScraperSearchComponent::search(const ScraperSearchParams& params)
 {
 	mResultList->clear();
 	mScraperResults.clear();
-	mThumbnailReq.reset();
+	mThumbnailReqs.clear();
 	mMDResolveHandle.reset();
 	updateInfoPane();
 
@@ -218,7 +229,7 @@ void ScraperSearchComponent::search(const ScraperSearchParams& params)
 
 void ScraperSearchComponent::stop()
 {
-	mThumbnailReq.reset();
+	mThumbnailReqs.clear();
 	mSearchHandle.reset();
 	mMDResolveHandle.reset();
 	mBlockAccept = false;
@@ -256,6 +267,13 @@ void ScraperSearchComponent::onSearchDone(const std::vector<ScraperSearchResult>
 		mGrid.resetCursor();
 	}
 
+	// all at once, so moving through the results doesn't wait on each one (accepting the first doesn't show the rest)
+	if(mSearchType != ALWAYS_ACCEPT_FIRST_RESULT)
+	{
+		for(int i = 0; i < end; i++)
+			requestThumbnail(getThumbnailUrl(results.at(i)));
+	}
+
 	mBlockAccept = false;
 	updateInfoPane();
 
@@ -267,7 +285,9 @@ void ScraperSearchComponent::onSearchDone(const std::vector<ScraperSearchResult>
 			returnResult(mScraperResults.front());
 	}else if(mSearchType == ALWAYS_ACCEPT_MATCHING_CRC)
 	{
-		// TODO
+		// a hash match is the game, anything else is left for the user to pick
+		if(mScraperResults.size() == 1 && mScraperResults.front().hashMatch)
+			returnResult(mScraperResults.front());
 	}
 }
 
@@ -303,13 +323,14 @@ void ScraperSearchComponent::updateInfoPane()
 		mResultDesc->setText(strToUpper(res.mdl.get("desc")));
 		mDescContainer->reset();
 
-		mResultThumbnail->setImage("");
-		const std::string& thumb = res.thumbnailUrl.empty() ? res.imageUrl : res.thumbnailUrl;
-		if(!thumb.empty())
+		mShownThumbnail = getThumbnailUrl(res);
+		auto cached = sThumbnails.find(mShownThumbnail);
+		if(cached != sThumbnails.end())
 		{
-			mThumbnailReq = std::unique_ptr<HttpReq>(new HttpReq(thumb));
+			showThumbnail(cached->second);
 		}else{
-			mThumbnailReq.reset();
+			mResultThumbnail->setImage("");
+			requestThumbnail(mShownThumbnail);
 		}
 
 		// metadata
@@ -324,6 +345,7 @@ void ScraperSearchComponent::updateInfoPane()
 		mResultName->setText("");
 		mResultDesc->setText("");
 		mResultThumbnail->setImage("");
+		mShownThumbnail.clear();
 
 		// metadata
 		mMD_Rating->setValue("");
@@ -348,7 +370,7 @@ bool ScraperSearchComponent::input(InputConfig* config, Input input)
 
 void ScraperSearchComponent::render(const Eigen::Affine3f& parentTrans)
 {
-	Eigen::Affine3f trans = parentTrans * getTransform();
+	Eigen::Affine3f trans = getWorldTransform(parentTrans);
 
 	renderChildren(trans);
 
@@ -386,10 +408,8 @@ void ScraperSearchComponent::update(int deltaTime)
 		mBusyAnim.update(deltaTime);
 	}
 
-	if(mThumbnailReq && mThumbnailReq->status() != HttpReq::REQ_IN_PROGRESS)
-	{
-		updateThumbnail();
-	}
+	if(!mThumbnailReqs.empty())
+		updateThumbnails();
 
 	if(mSearchHandle && mSearchHandle->status() != ASYNC_IN_PROGRESS)
 	{
@@ -427,19 +447,49 @@ void ScraperSearchComponent::update(int deltaTime)
 	}
 }
 
-void ScraperSearchComponent::updateThumbnail()
+void ScraperSearchComponent::requestThumbnail(const std::string& url)
+{
+	if(url.empty() || sThumbnails.find(url) != sThumbnails.end() || mThumbnailReqs.find(url) != mThumbnailReqs.end())
+		return;
+
+	mThumbnailReqs[url] = std::unique_ptr<HttpReq>(new HttpReq(url));
+}
+
+void ScraperSearchComponent::updateThumbnails()
 {
-	if(mThumbnailReq && mThumbnailReq->status() == HttpReq::REQ_SUCCESS)
+	for(auto it = mThumbnailReqs.begin(); it != mThumbnailReqs.end(); )
 	{
-		std::string content = mThumbnailReq->getContent();
-		mResultThumbnail->setImage(content.data(), content.length());
-		mGrid.onSizeChanged(); // a hack to fix the thumbnail position since its size changed
-	}else{
-		LOG(LogWarning) << "thumbnail req failed: " << mThumbnailReq->getErrorMsg();
-		mResultThumbnail->setImage("");
+		HttpReq* req = it->second.get();
+		if(req->status() == HttpReq::REQ_IN_PROGRESS)
+		{
+			it++;
+			continue;
+		}
+
+		if(req->status() == HttpReq::REQ_SUCCESS)
+		{
+			sThumbnails[it->first] = req->getContent();
+			sThumbnailOrder.push_back(it->first);
+			if(sThumbnailOrder.size() > THUMBNAIL_CACHE_MAX)
+			{
+				sThumbnails.erase(sThumbnailOrder.front());
+				sThumbnailOrder.pop_front();
+			}
+
+			if(it->first == mShownThumbnail)
+				showThumbnail(req->getContent());
+		}else{
+			LOG(LogWarning) << "thumbnail req failed: " << req->getErrorMsg();
+		}
+
+		it = mThumbnailReqs.erase(it);
 	}
+}
 
-	mThumbnailReq.reset();
+void ScraperSearchComponent::showThumbnail(const std::string& content)
+{
+	mResultThumbnail->setImage(content.data(), content.length());
+	mGrid.onSizeChanged(); // a hack to fix the thumbnail position since its size changed
 }
 
 void ScraperSearchComponent::openInputScreen(ScraperSearchParams& params)
@@ -5,6 +5,8 @@
 #include "components/ComponentGrid.h"
 #include "components/BusyComponent.h"
 #include <functional>
+#include <map>
+#include <list>
 
 class ComponentList;
 class ImageComponent;
@@ -47,7 +49,9 @@ public:
 
 private:
 	void updateViewStyle();
-	void updateThumbnail();
+	void updateThumbnails();
+	void showThumbnail(const std::string& content);
+	void requestThumbnail(const std::string& url); // unless it's cached or already on its way
 	void updateInfoPane();
 
 	void resizeMetadata();
@@ -98,7 +102,12 @@ private:
 	std::unique_ptr<ScraperSearchHandle> mSearchHandle;
 	std::unique_ptr<MDResolveHandle> mMDResolveHandle;
 	std::vector<ScraperSearchResult> mScraperResults;
-	std::unique_ptr<HttpReq> mThumbnailReq;
+
+	// every result's thumbnail is downloaded at once when the results come in, and kept for the rest of the session
+	std::map< std::string, std::unique_ptr<HttpReq> > mThumbnailReqs; // by URL
+	std::string mShownThumbnail; // URL of the selected result's thumbnail, shown as soon as it's here
+	static std::map<std::string, std::string> sThumbnails; // URL to image file
+	static std::list<std::string> sThumbnailOrder; // the URLs in sThumbnails, oldest first
 
 	BusyComponent mBusyAnim;
 };
@@ -0,0 +1,129 @@
+#include "components/SlideshowScreenSaver.h"
+#include "animations/LambdaAnimation.h"
+#include "SystemData.h"
+#include "Renderer.h"
+
+#define SLIDESHOW_PREFETCH 3 // images loaded ahead of the one on screen
+#define SLIDESHOW_INTERVAL 8000 // ms each image is shown
+#define SLIDESHOW_FADE 1000 // ms
+#define SLIDESHOW_PICK_TRIES 16 // games looked at for one with an image before giving up until the next update
+
+SlideshowScreenSaver::SlideshowScreenSaver(Window* window) : GuiComponent(window), mImageA(window), mImageB(window),
+	mFront(&mImageA), mBack(&mImageB), mTimeShown(0), mRandom(SDL_GetTicks())
+{
+	setUpdating(true);
+	setSize((float)Renderer::getScreenWidth(), (float)Renderer::getScreenHeight());
+
+	ImageComponent* images[2] = { &mImageA, &mImageB };
+	for(int i = 0; i < 2; i++)
+	{
+		images[i]->setLoadAsync(true);
+		images[i]->setDownscale(true);
+		images[i]->setOrigin(0.5f, 0.5f);
+		images[i]->setPosition(mSize.x() / 2, mSize.y() / 2);
+		images[i]->setMaxSize(mSize);
+		addChild(images[i]);
+	}
+}
+
+void SlideshowScreenSaver::start()
+{
+	mTimeShown = SLIDESHOW_INTERVAL; // the first one goes up as soon as it's loaded
+	fillQueue();
+}
+
+void SlideshowScreenSaver::stop()
+{
+	cancelAnimation(0);
+
+	// dropping them cancels anything still loading
+	mQueue.clear();
+	mImageA.setImage(std::shared_ptr<TextureResource>());
+	mImageB.setImage(std::shared_ptr<TextureResource>());
+}
+
+const FileData* SlideshowScreenSaver::pickGame()
+{
+	std::vector<SystemData*> systems;
+	for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end(); it++)
+	{
+		if((*it)->isLoaded())
+			systems.push_back(*it);
+	}
+	if(systems.empty())
+		return NULL;
+
+	// a random walk down from a random system's root, instead of collecting every game
+	for(int i = 0; i < SLIDESHOW_PICK_TRIES; i++)
+	{
+		const FileData* file = systems[mRandom() % systems.size()]->getRootFolder();
+		while(file->getType() == FOLDER && !file->getChildren().empty())
+			file = file->getChildren()[mRandom() % file->getChildren().size()];
+
+		if(file->getType() == GAME && !file->metadata.get(MetaDataIds::IMAGE).empty())
+			return file;
+	}
+
+	return NULL;
+}
+
+void SlideshowScreenSaver::fillQueue()
+{
+	while(mQueue.size() < SLIDESHOW_PREFETCH)
+	{
+		const FileData* game = pickGame();
+		if(game == NULL)
+			return;
+
+		std::shared_ptr<TextureResource> tex = mBack->prefetch(game->metadata.get(MetaDataIds::IMAGE));
+		if(tex)
+			mQueue.push_back(tex);
+	}
+}
+
+void SlideshowScreenSaver::showNext()
+{
+	mBack->setImage(mQueue.front());
+	mQueue.pop_front();
+	fillQueue();
+
+	mBack->setOpacity(0);
+	mTimeShown = 0;
+
+	setAnimation(new LambdaAnimation([this](float t) {
+		mBack->setOpacity((unsigned char)(t * 255));
+	}, SLIDESHOW_FADE), 0, [this] {
+		// the old one isn't needed any more
+		mFront->setImage(std::shared_ptr<TextureResource>());
+		std::swap(mFront, mBack);
+	});
+}
+
+void SlideshowScreenSaver::update(int deltaTime)
+{
+	GuiComponent::update(deltaTime);
+
+	mTimeShown += deltaTime;
+
+	// skip anything that failed to load
+	while(!mQueue.empty() && !mQueue.front()->isLoading() && !mQueue.front()->isInitialized())
+	{
+		mQueue.pop_front();
+		fillQueue();
+	}
+	if(mQueue.size() < SLIDESHOW_PREFETCH)
+		fillQueue();
+
+	if(mTimeShown >= SLIDESHOW_INTERVAL && !isAnimationPlaying(0) && !mQueue.empty() && !mQueue.front()->isLoading())
+		showNext();
+}
+
+void SlideshowScreenSaver::render(const Eigen::Affine3f& parentTrans)
+{
+	Eigen::Affine3f trans = getWorldTransform(parentTrans);
+
+	Renderer::setMatrix(trans);
+	Renderer::drawRect(0.f, 0.f, mSize.x(), mSize.y(), 0x000000FF);
+
+	renderChildren(trans);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "GuiComponent.h"
+#include "Window.h"
+#include "components/ImageComponent.h"
+#include <deque>
+#include <random>
+
+class FileData;
+
+// The "slideshow" screensaver: random game images from every loaded system, cross-faded one after another.
+// The next few are decoded in the background (scaled down to the screen) while one is shown, so memory stays at
+// a handful of screen-sized textures and nothing is ever loaded on the render thread.
+class SlideshowScreenSaver : public GuiComponent, public IScreenSaver
+{
+public:
+	SlideshowScreenSaver(Window* window);
+
+	void start() override;
+	void stop() override;
+	void update(int deltaTime) override;
+	void render(const Eigen::Affine3f& parentTrans) override;
+
+private:
+	const FileData* pickGame();
+	void fillQueue();
+	void showNext();
+
+	ImageComponent mImageA;
+	ImageComponent mImageB;
+	ImageComponent* mFront; // on screen
+	ImageComponent* mBack; // fading in over it
+
+	std::deque< std::shared_ptr<TextureResource> > mQueue; // loading or loaded, shown in this order
+	int mTimeShown;
+	std::mt19937 mRandom;
+};
@@ -16,10 +16,10 @@
 struct TextListData
 {
 	unsigned int colorId;
-	std::shared_ptr<TextCache> textCache;
 };
 
 //A graphical list. Supports multiple colors for rows and scrolling.
+//Text caches are only kept for the rows around what's on screen, so their cost doesn't grow with the list.
 template <typename T>
 class TextListComponent : public IList<TextListData, T>
 {
@@ -31,6 +31,7 @@ protected:
 	using IList<TextListData, T>::getTransform;
 	using IList<TextListData, T>::mSize;
 	using IList<TextListData, T>::mCursor;
+	using IList<TextListData, T>::mWindow;
 	using IList<TextListData, T>::Entry;
 
 public:
@@ -46,6 +47,7 @@ public:
 	void applyTheme(const std::shared_ptr<ThemeData>& theme, const std::string& view, const std::string& element, unsigned int properties) override;
 
 	void add(const std::string& name, const T& obj, unsigned int colorId);
+	void insert(int index, const std::string& name, const T& obj, unsigned int colorId);
 	
 	enum Alignment
 	{
@@ -61,15 +63,15 @@ public:
 	inline void setFont(const std::shared_ptr<Font>& font)
 	{
 		mFont = font;
-		for(auto it = mEntries.begin(); it != mEntries.end(); it++)
-			it->data.textCache.reset();
+		mRowCaches.clear();
 	}
 
+	inline const std::shared_ptr<Font>& getFont() const { return mFont; }
+
 	inline void setUppercase(bool uppercase) 
 	{
-		mUppercase = true;
-		for(auto it = mEntries.begin(); it != mEntries.end(); it++)
-			it->data.textCache.reset();
+		mUppercase = uppercase;
+		mRowCaches.clear();
 	}
 
 	inline void setSelectorColor(unsigned int color) { mSelectorColor = color; }
@@ -88,6 +90,23 @@ private:
 	static const int MARQUEE_SPEED = 8;
 	static const int MARQUEE_RATE = 1;
 
+	// rows cached beyond the ones on screen, so scrolling back and forth a bit doesn't rebuild them
+	static const int ROW_CACHE_SLACK = 8;
+
+	struct RowCache
+	{
+		int index; // entry it was built for
+		std::string text; // entry name it was built from, in case the entries changed since
+		std::unique_ptr<TextCache> cache;
+		unsigned int lastUsed;
+	};
+
+	TextCache* getRowCache(int index, int capacity);
+
+	std::vector<RowCache> mRowCaches;
+	unsigned int mRowCacheFrame;
+	std::string mUppercaseBuffer;
+
 	int mMarqueeOffset;
 	int mMarqueeTime;
 
@@ -110,6 +129,7 @@ template <typename T>
 TextListComponent<T>::TextListComponent(Window* window) : 
 	IList<TextListData, T>(window)
 {
+	this->setUpdating(true);
 	mMarqueeOffset = 0;
 	mMarqueeTime = -MARQUEE_DELAY;
 
@@ -123,12 +143,58 @@ TextListComponent<T>::TextListComponent(Window* window) :
 	mSelectedColor = 0;
 	mColors[0] = 0x0000FFFF;
 	mColors[1] = 0x00FF00FF;
+	mRowCacheFrame = 0;
+}
+
+template <typename T>
+TextCache* TextListComponent<T>::getRowCache(int index, int capacity)
+{
+	const std::string& name = mEntries.at((unsigned int)index).name;
+
+	RowCache* slot = NULL;
+	for(auto it = mRowCaches.begin(); it != mRowCaches.end(); it++)
+	{
+		if(it->index == index && it->text == name)
+		{
+			it->lastUsed = mRowCacheFrame;
+			return it->cache.get();
+		}
+
+		// least recently used one that isn't on screen this frame
+		if(it->lastUsed != mRowCacheFrame && (!slot || it->lastUsed < slot->lastUsed))
+			slot = &(*it);
+	}
+
+	if(!slot || (int)mRowCaches.size() < capacity)
+	{
+		mRowCaches.push_back(RowCache());
+		slot = &mRowCaches.back();
+	}
+
+	slot->index = index;
+	slot->text = name;
+	slot->lastUsed = mRowCacheFrame;
+
+	// recycle the old cache's memory, so scrolling doesn't allocate once the pool is warm
+	// (colours are set every frame, so they don't matter here)
+	if(mUppercase)
+	{
+		mUppercaseBuffer = name;
+		strToUpper(mUppercaseBuffer);
+	}
+	const std::string& text = mUppercase ? mUppercaseBuffer : name;
+
+	if(slot->cache)
+		mFont->rebuildTextCache(slot->cache.get(), text, 0, 0, 0x000000FF);
+	else
+		slot->cache = std::unique_ptr<TextCache>(mFont->buildTextCache(text, 0, 0, 0x000000FF));
+	return slot->cache.get();
 }
 
 template <typename T>
 void TextListComponent<T>::render(const Eigen::Affine3f& parentTrans)
 {
-	Eigen::Affine3f trans = parentTrans * getTransform();
+	Eigen::Affine3f trans = this->getWorldTransform(parentTrans);
 	
 	std::shared_ptr<Font>& font = mFont;
 
@@ -164,6 +230,10 @@ void TextListComponent<T>::render(const Eigen::Affine3f& parentTrans)
 		Renderer::drawRect(0.f, (mCursor - startEntry)*entrySize + (entrySize - font->getHeight())/2, mSize.x(), font->getHeight(), mSelectorColor);
 	}
 
+	mRowCacheFrame++;
+	if((int)mRowCaches.size() > screenCount + ROW_CACHE_SLACK)
+		mRowCaches.clear(); // got smaller (e.g. a new font), start over
+
 	// clip to inside margins
 	Eigen::Vector3f dim(mSize.x(), mSize.y(), 0);
 	dim = trans * dim - trans.translation();
@@ -180,10 +250,8 @@ void TextListComponent<T>::render(const Eigen::Affine3f& parentTrans)
 		else
 			color = mColors[entry.data.colorId];
 
-		if(!entry.data.textCache)
-			entry.data.textCache = std::unique_ptr<TextCache>(font->buildTextCache(mUppercase ? strToUpper(entry.name) : entry.name, 0, 0, 0x000000FF));
-
-		entry.data.textCache->setColor(color);
+		TextCache* textCache = getRowCache(i, screenCount + ROW_CACHE_SLACK);
+		textCache->setColor(color);
 
 		Eigen::Vector3f offset(0, y, 0);
 
@@ -193,12 +261,12 @@ void TextListComponent<T>::render(const Eigen::Affine3f& parentTrans)
 			offset[0] = mHorizontalMargin;
 			break;
 		case ALIGN_CENTER:
-			offset[0] = (mSize.x() - entry.data.textCache->metrics.size.x()) / 2;
+			offset[0] = (mSize.x() - textCache->metrics.size.x()) / 2;
 			if(offset[0] < 0)
 				offset[0] = 0;
 			break;
 		case ALIGN_RIGHT:
-			offset[0] = (mSize.x() - entry.data.textCache->metrics.size.x());
+			offset[0] = (mSize.x() - textCache->metrics.size.x());
 			offset[0] -= mHorizontalMargin;
 			if(offset[0] < 0)
 				offset[0] = 0;
@@ -210,13 +278,15 @@ void TextListComponent<T>::render(const Eigen::Affine3f& parentTrans)
 		
 		Eigen::Affine3f drawTrans = trans;
 		drawTrans.translate(offset);
-		Renderer::setMatrix(drawTrans);
 
-		font->renderTextCache(entry.data.textCache.get());
+		// all the rows go out in one draw call per glyph texture
+		font->queueTextCache(textCache, drawTrans);
 		
 		y += entrySize;
 	}
 
+	font->flushTextBatch();
+
 	Renderer::popClipRect();
 
 	listRenderTitleOverlay(trans);
@@ -284,6 +354,7 @@ void TextListComponent<T>::update(int deltaTime)
 			{
 				mMarqueeOffset += MARQUEE_RATE;
 				mMarqueeTime -= MARQUEE_SPEED;
+				this->invalidate();
 			}
 		}
 	}
@@ -304,6 +375,18 @@ void TextListComponent<T>::add(const std::string& name, const T& obj, unsigned i
 	static_cast<IList< TextListData, T >*>(this)->add(entry);
 }
 
+template <typename T>
+void TextListComponent<T>::insert(int index, const std::string& name, const T& obj, unsigned int color)
+{
+	assert(color < COLOR_ID_COUNT);
+
+	typename IList<TextListData, T>::Entry entry;
+	entry.name = name;
+	entry.object = obj;
+	entry.data.colorId = color;
+	static_cast<IList< TextListData, T >*>(this)->insert(index, entry);
+}
+
 template <typename T>
 void TextListComponent<T>::onCursorChanged(const CursorState& state)
 {
@@ -326,26 +409,26 @@ void TextListComponent<T>::applyTheme(const std::shared_ptr<ThemeData>& theme, c
 	using namespace ThemeFlags;
 	if(properties & COLOR)
 	{
-		if(elem->has("selectorColor"))
-			setSelectorColor(elem->get<unsigned int>("selectorColor"));
-		if(elem->has("selectedColor"))
-			setSelectedColor(elem->get<unsigned int>("selectedColor"));
-		if(elem->has("primaryColor"))
-			setColor(0, elem->get<unsigned int>("primaryColor"));
-		if(elem->has("secondaryColor"))
-			setColor(1, elem->get<unsigned int>("secondaryColor"));
+		if(elem->has(ThemeProperties::SELECTOR_COLOR))
+			setSelectorColor(elem->get<unsigned int>(ThemeProperties::SELECTOR_COLOR));
+		if(elem->has(ThemeProperties::SELECTED_COLOR))
+			setSelectedColor(elem->get<unsigned int>(ThemeProperties::SELECTED_COLOR));
+		if(elem->has(ThemeProperties::PRIMARY_COLOR))
+			setColor(0, elem->get<unsigned int>(ThemeProperties::PRIMARY_COLOR));
+		if(elem->has(ThemeProperties::SECONDARY_COLOR))
+			setColor(1, elem->get<unsigned int>(ThemeProperties::SECONDARY_COLOR));
 	}
 
 	setFont(Font::getFromTheme(elem, properties, mFont));
 	
-	if(properties & SOUND && elem->has("scrollSound"))
-		setSound(Sound::get(elem->get<std::string>("scrollSound")));
+	if(properties & SOUND && elem->has(ThemeProperties::SCROLL_SOUND))
+		setSound(Sound::get(elem->get<std::string>(ThemeProperties::SCROLL_SOUND)));
 
 	if(properties & ALIGNMENT)
 	{
-		if(elem->has("alignment"))
+		if(elem->has(ThemeProperties::ALIGNMENT))
 		{
-			const std::string& str = elem->get<std::string>("alignment");
+			const std::string& str = elem->get<std::string>(ThemeProperties::ALIGNMENT);
 			if(str == "left")
 				setAlignment(ALIGN_LEFT);
 			else if(str == "center")
@@ -355,15 +438,15 @@ void TextListComponent<T>::applyTheme(const std::shared_ptr<ThemeData>& theme, c
 			else
 				LOG(LogError) << "Unknown TextListComponent alignment \"" << str << "\"!";
 		}
-		if(elem->has("horizontalMargin"))
+		if(elem->has(ThemeProperties::HORIZONTAL_MARGIN))
 		{
-			mHorizontalMargin = elem->get<float>("horizontalMargin") * (this->mParent ? this->mParent->getSize().x() : (float)Renderer::getScreenWidth());
+			mHorizontalMargin = elem->get<float>(ThemeProperties::HORIZONTAL_MARGIN) * (this->mParent ? this->mParent->getSize().x() : (float)Renderer::getScreenWidth());
 		}
 	}
 
-	if(properties & FORCE_UPPERCASE && elem->has("forceUppercase"))
-		setUppercase(elem->get<bool>("forceUppercase"));
+	if(properties & FORCE_UPPERCASE && elem->has(ThemeProperties::FORCE_UPPERCASE))
+		setUppercase(elem->get<bool>(ThemeProperties::FORCE_UPPERCASE));
 
-	if(properties & LINE_SPACING && elem->has("lineSpacing"))
-		setLineSpacing(elem->get<float>("lineSpacing"));
+	if(properties & LINE_SPACING && elem->has(ThemeProperties::LINE_SPACING))
+		setLineSpacing(elem->get<float>(ThemeProperties::LINE_SPACING));
 }
@@ -2,8 +2,7 @@
 #include "ThemeData.h"
 #include "FileSorts.h"
 #include "SystemData.h"
-
-static const std::string LETTERS = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+#include <algorithm>
 
 GuiFastSelect::GuiFastSelect(Window* window, IGameListView* gamelist) : GuiComponent(window), 
 	mBackground(window), mSortText(window), mLetterText(window), mGameList(gamelist)
@@ -31,12 +30,18 @@ GuiFastSelect::GuiFastSelect(Window* window, IGameListView* gamelist) : GuiCompo
 	// TODO - set font size
 	addChild(&mSortText);
 
-	mSortId = 0; // TODO
+	const FileData::SortType* currentSort = mGameList->getSort();
+	mSortId = currentSort ? (int)(currentSort - &FileSorts::SortTypes.front()) : 0;
 	updateSortText();
 
-	mLetterId = LETTERS.find(mGameList->getCursor()->getName()[0]);
-	if(mLetterId == std::string::npos)
-		mLetterId = 0;
+	FileData* cursor = mGameList->getCursor();
+	const std::vector<FileData::LetterIndexEntry>& index = cursor->getParent()->getLetterIndex();
+	for(auto it = index.begin(); it != index.end(); it++)
+		mLetters.push_back(it->letter);
+	std::sort(mLetters.begin(), mLetters.end());
+
+	auto current = std::find(mLetters.begin(), mLetters.end(), FileData::getInitial(cursor->getSortName()));
+	mLetterId = (current != mLetters.end()) ? (int)(current - mLetters.begin()) : 0;
 
 	mScrollDir = 0;
 	mScrollAccumulator = 0;
@@ -112,13 +117,16 @@ void GuiFastSelect::update(int deltaTime)
 
 void GuiFastSelect::scroll()
 {
+	if(mLetters.empty())
+		return;
+
 	mLetterId += mScrollDir;
 	if(mLetterId < 0)
-		mLetterId += LETTERS.length();
-	else if(mLetterId >= (int)LETTERS.length())
-		mLetterId -= LETTERS.length();
+		mLetterId += mLetters.size();
+	else if(mLetterId >= (int)mLetters.size())
+		mLetterId -= mLetters.size();
 
-	mLetterText.setText(LETTERS.substr(mLetterId, 1));
+	mLetterText.setText(mLetters.at(mLetterId));
 }
 
 void GuiFastSelect::updateSortText()
@@ -130,34 +138,18 @@ void GuiFastSelect::updateSortText()
 
 void GuiFastSelect::updateGameListSort()
 {
-	const FileData::SortType& sort = FileSorts::SortTypes.at(mSortId);
-
-	FileData* root = mGameList->getCursor()->getSystem()->getRootFolder();
-	root->sort(sort); // will also recursively sort children
-
-	// notify that the root folder was sorted
-	mGameList->onFileChanged(root, FILE_SORTED);
+	mGameList->setSort(&FileSorts::SortTypes.at(mSortId));
 }
 
 void GuiFastSelect::updateGameListCursor()
 {
-	const std::vector<FileData*>& list = mGameList->getCursor()->getParent()->getChildren();
-
 	// only skip by letter when the sort mode is alphabetical
 	const FileData::SortType& sort = FileSorts::SortTypes.at(mSortId);
-	if(sort.comparisonFunction != &FileSorts::compareFileName)
+	if(sort.comparisonFunction != &FileSorts::compareFileName || mLetters.empty())
 		return;
 
-	// find the first entry in the list that either exactly matches our target letter or is beyond our target letter
-	for(auto it = list.cbegin(); it != list.cend(); it++)
-	{
-		char check = (*it)->getName().empty() ? 'A' : (*it)->getName()[0];
-
-		// if there's an exact match or we've passed it, set the cursor to this one
-		if(check == LETTERS[mLetterId] || (sort.ascending && check > LETTERS[mLetterId]) || (!sort.ascending && check < LETTERS[mLetterId]))
-		{
-			mGameList->setCursor(*it);
-			break;
-		}
-	}
+	// folders stay in name order whatever the view shows, so their index is good for this
+	FileData* target = mGameList->getCursor()->getParent()->getFirstWithInitial(mLetters.at(mLetterId));
+	if(target != NULL)
+		mGameList->setCursor(target);
 }
@@ -22,6 +22,9 @@ private:
 	void updateSortText();
 
 	int mSortId;
+
+	// initials the folder's games actually have, in alphabetical order
+	std::vector<std::string> mLetters;
 	int mLetterId;
 
 	int mScrollDir;
@@ -2,6 +2,7 @@
 #include "GuiMetaDataEd.h"
 #include "views/gamelist/IGameListView.h"
 #include "views/ViewController.h"
+#include <algorithm>
 
 GuiGamelistOptions::GuiGamelistOptions(Window* window, SystemData* system) : GuiComponent(window), 
 	mSystem(system), 
@@ -9,14 +10,20 @@ GuiGamelistOptions::GuiGamelistOptions(Window* window, SystemData* system) : Gui
 {
 	addChild(&mMenu);
 
-	// jump to letter
-	char curChar = toupper(getGamelist()->getCursor()->getName()[0]);
-	if(curChar < 'A' || curChar > 'Z')
-		curChar = 'A';
+	// jump to letter, only offering the initials the folder actually has
+	FileData* cursor = getGamelist()->getCursor();
+	const std::string curLetter = FileData::getInitial(cursor->getSortName());
+
+	std::vector<std::string> letters;
+	const std::vector<FileData::LetterIndexEntry>& index = cursor->getParent()->getLetterIndex();
+	for(auto it = index.begin(); it != index.end(); it++)
+		letters.push_back(it->letter);
+	std::sort(letters.begin(), letters.end());
+	const bool hasCurLetter = std::find(letters.begin(), letters.end(), curLetter) != letters.end();
 
 	mJumpToLetterList = std::make_shared<LetterList>(mWindow, "JUMP TO LETTER", false);
-	for(char c = 'A'; c <= 'Z'; c++)
-		mJumpToLetterList->add(std::string(1, c), c, c == curChar);
+	for(auto it = letters.begin(); it != letters.end(); it++)
+		mJumpToLetterList->add(*it, *it, hasCurLetter ? *it == curLetter : it == letters.begin());
 
 	ComponentListRow row;
 	row.addElement(std::make_shared<TextComponent>(mWindow, "JUMP TO LETTER", Font::get(FONT_SIZE_MEDIUM), 0x777777FF), true);
@@ -35,16 +42,27 @@ GuiGamelistOptions::GuiGamelistOptions(Window* window, SystemData* system) : Gui
 	};
 	mMenu.addRow(row);
 
-	// sort list by
+	// sort list by, just in this view
+	const FileData::SortType* currentSort = getGamelist()->getSort();
 	mListSort = std::make_shared<SortList>(mWindow, "SORT GAMES BY", false);
 	for(unsigned int i = 0; i < FileSorts::SortTypes.size(); i++)
 	{
 		const FileData::SortType& sort = FileSorts::SortTypes.at(i);
-		mListSort->add(sort.description, &sort, i == 0); // TODO - actually make the sort type persistent
+		mListSort->add(sort.description, &sort, currentSort ? &sort == currentSort : i == 0);
 	}
 
 	mMenu.addWithLabel("SORT GAMES BY", mListSort);
 
+	// only show some games (unplayed, rated...), just in this view
+	mListFilter = std::make_shared<FilterList>(mWindow, "SHOW", false);
+	for(unsigned int i = 0; i < FileSorts::FilterTypes.size(); i++)
+	{
+		const FileData::FilterType& filter = FileSorts::FilterTypes.at(i);
+		mListFilter->add(filter.description, &filter, filter.filterFunction == getGamelist()->getFilter());
+	}
+
+	mMenu.addWithLabel("SHOW", mListFilter);
+
 	// edit game metadata
 	row.elements.clear();
 	row.addElement(std::make_shared<TextComponent>(mWindow, "EDIT THIS GAME'S METADATA", Font::get(FONT_SIZE_MEDIUM), 0x777777FF), true);
@@ -59,58 +77,33 @@ GuiGamelistOptions::GuiGamelistOptions(Window* window, SystemData* system) : Gui
 
 GuiGamelistOptions::~GuiGamelistOptions()
 {
-	// apply sort
-	FileData* root = getGamelist()->getCursor()->getSystem()->getRootFolder();
-	root->sort(*mListSort->getSelected()); // will also recursively sort children
-
-	// notify that the root folder was sorted
-	getGamelist()->onFileChanged(root, FILE_SORTED);
+	// the view's projection filters and sorts, the folders themselves aren't reordered
+	getGamelist()->setFilter(mListFilter->getSelected()->filterFunction);
+	getGamelist()->setSort(mListSort->getSelected());
 }
 
 void GuiGamelistOptions::openMetaDataEd()
 {
 	// open metadata editor
 	FileData* file = getGamelist()->getCursor();
+	file->getName(); // make sure the default name is filled in so the editor shows it
 	ScraperSearchParams p;
 	p.game = file;
 	p.system = file->getSystem();
 	mWindow->pushGui(new GuiMetaDataEd(mWindow, &file->metadata, file->metadata.getMDD(), p, file->getPath().filename().string(), 
-		std::bind(&IGameListView::onFileChanged, getGamelist(), file, FILE_METADATA_CHANGED), [this, file] { 
+		std::bind(&ViewController::onFileChanged, ViewController::get(), file, FILE_METADATA_CHANGED), [this, file] { 
 			getGamelist()->remove(file);
 	}));
 }
 
 void GuiGamelistOptions::jumpToLetter()
 {
-	char letter = mJumpToLetterList->getSelected();
 	IGameListView* gamelist = getGamelist();
 
-	// this is a really shitty way to get a list of files
-	const std::vector<FileData*>& files = gamelist->getCursor()->getParent()->getChildren();
-	
-	long min = 0;
-	long max = files.size() - 1;
-	long mid = 0;
-
-	while(max >= min)
-	{
-		mid = ((max - min) / 2) + min;
-
-		// game somehow has no first character to check
-		if(files.at(mid)->getName().empty())
-			continue;
-
-		char checkLetter = toupper(files.at(mid)->getName()[0]);
-
-		if(checkLetter < letter)
-			min = mid + 1;
-		else if(checkLetter > letter)
-			max = mid - 1;
-		else
-			break; //exact match found
-	}
-
-	gamelist->setCursor(files.at(mid));
+	const std::vector<std::string> selected = mJumpToLetterList->getSelectedObjects();
+	FileData* target = selected.empty() ? NULL : gamelist->getCursor()->getParent()->getFirstWithInitial(selected.at(0));
+	if(target != NULL)
+		gamelist->setCursor(target);
 
 	delete this;
 }
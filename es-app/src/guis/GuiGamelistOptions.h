@@ -20,11 +20,14 @@ private:
 	
 	MenuComponent mMenu;
 
-	typedef OptionListComponent<char> LetterList;
+	typedef OptionListComponent<std::string> LetterList;
 	std::shared_ptr<LetterList> mJumpToLetterList;
 
 	typedef OptionListComponent<const FileData::SortType*> SortList;
 	std::shared_ptr<SortList> mListSort;
+
+	typedef OptionListComponent<const FileData::FilterType*> FilterList;
+	std::shared_ptr<FilterList> mListFilter;
 	
 	SystemData* mSystem;
 	IGameListView* getGamelist();
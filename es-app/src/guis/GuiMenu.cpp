@@ -8,6 +8,8 @@
 #include "guis/GuiSettings.h"
 #include "guis/GuiScraperStart.h"
 #include "guis/GuiDetectDevice.h"
+#include "guis/GuiSearch.h"
+#include "guis/GuiPlayedGames.h"
 #include "views/ViewController.h"
 
 #include "components/ButtonComponent.h"
@@ -24,6 +26,7 @@ GuiMenu::GuiMenu(Window* window) : GuiComponent(window), mMenu(window, "MAIN MEN
 {
 	// MAIN MENU
 
+	// SEARCH GAMES >
 	// SCRAPER >
 	// SOUND SETTINGS >
 	// UI SETTINGS >
@@ -32,6 +35,15 @@ GuiMenu::GuiMenu(Window* window) : GuiComponent(window), mMenu(window, "MAIN MEN
 
 	// [version]
 
+	addEntry("SEARCH GAMES", 0x777777FF, true, 
+		[this] { mWindow->pushGui(new GuiSearch(mWindow, [this] { delete this; })); });
+
+	addEntry("RECENTLY PLAYED", 0x777777FF, true, 
+		[this] { mWindow->pushGui(new GuiPlayedGames(mWindow, false, [this] { delete this; })); });
+
+	addEntry("MOST PLAYED", 0x777777FF, true, 
+		[this] { mWindow->pushGui(new GuiPlayedGames(mWindow, true, [this] { delete this; })); });
+
 	auto openScrapeNow = [this] { mWindow->pushGui(new GuiScraperStart(mWindow)); };
 	addEntry("SCRAPER", 0x777777FF, true, 
 		[this, openScrapeNow] { 
@@ -101,6 +113,8 @@ GuiMenu::GuiMenu(Window* window) : GuiComponent(window), mMenu(window, "MAIN MEN
 			std::vector<std::string> screensavers;
 			screensavers.push_back("dim");
 			screensavers.push_back("black");
+			screensavers.push_back("off");
+			screensavers.push_back("slideshow");
 			for(auto it = screensavers.begin(); it != screensavers.end(); it++)
 				screensaver_behavior->add(*it, *it, Settings::getInstance()->getString("ScreenSaverBehavior") == *it);
 			s->addWithLabel("SCREENSAVER BEHAVIOR", screensaver_behavior);
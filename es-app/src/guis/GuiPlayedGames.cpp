@@ -0,0 +1,139 @@
+#include "guis/GuiPlayedGames.h"
+#include "views/ViewController.h"
+#include "PlayedIndex.h"
+#include "SystemData.h"
+#include "Renderer.h"
+#include <sstream>
+
+// a list, not a second gamelist
+#define PLAYED_MAX_RESULTS 50
+
+GuiPlayedGames::GuiPlayedGames(Window* window, bool mostPlayed, const std::function<void()>& onJump) : GuiComponent(window), 
+	mMostPlayed(mostPlayed), mIndexGeneration(0), mBackground(window, ":/frame.png"), mTitle(window), mStatus(window), mResults(window), mOnJump(onJump)
+{
+	setSize(Renderer::getScreenWidth() * 0.8f, Renderer::getScreenHeight() * 0.9f);
+	setPosition((Renderer::getScreenWidth() - mSize.x()) / 2, (Renderer::getScreenHeight() - mSize.y()) / 2);
+
+	mBackground.fitTo(mSize, Eigen::Vector3f::Zero(), Eigen::Vector2f(-32, -32));
+	addChild(&mBackground);
+
+	const float padding = Renderer::getScreenWidth() * 0.02f;
+
+	mTitle.setFont(Font::get(FONT_SIZE_LARGE));
+	mTitle.setColor(0x555555FF);
+	mTitle.setAlignment(ALIGN_CENTER);
+	mTitle.setText(mostPlayed ? "MOST PLAYED" : "RECENTLY PLAYED");
+	mTitle.setPosition(0, padding);
+	mTitle.setSize(mSize.x(), 0);
+	addChild(&mTitle);
+
+	mStatus.setFont(Font::get(FONT_SIZE_SMALL));
+	mStatus.setColor(0x777777FF);
+	mStatus.setAlignment(ALIGN_CENTER);
+	mStatus.setPosition(0, mTitle.getPosition().y() + mTitle.getSize().y());
+	mStatus.setSize(mSize.x(), Font::get(FONT_SIZE_SMALL)->getHeight());
+	addChild(&mStatus);
+
+	const float listTop = mStatus.getPosition().y() + mStatus.getSize().y() + padding;
+	mResults.setPosition(padding, listTop);
+	mResults.setSize(mSize.x() - padding * 2, mSize.y() - listTop - padding);
+	mResults.setAlignment(TextListComponent<FileData*>::ALIGN_LEFT);
+	mResults.setSelectorColor(0xC6C7C6FF);
+	mResults.setSelectedColor(0x555555FF);
+	mResults.setColor(0, 0x777777FF);
+	addChild(&mResults);
+
+	refresh();
+}
+
+void GuiPlayedGames::refresh()
+{
+	PlayedIndex* index = PlayedIndex::getInstance();
+	mIndexGeneration = index->getGeneration();
+
+	// keep the cursor on the same game if it's still there
+	FileData* selected = mResults.size() > 0 ? mResults.getSelected() : NULL;
+
+	const std::vector<FileData*> results = mMostPlayed ? index->getMostPlayed(PLAYED_MAX_RESULTS) : index->getRecentlyPlayed(PLAYED_MAX_RESULTS);
+
+	mResults.clear();
+	for(auto it = results.begin(); it != results.end(); it++)
+	{
+		std::stringstream name;
+		name << (*it)->getName() << "  [" << (*it)->getSystem()->getFullName() << "]";
+		if(mMostPlayed)
+			name << "  " << (*it)->metadata.getPlayCount() << "x";
+		mResults.add(name.str(), *it, 0);
+	}
+
+	if(selected != NULL)
+		mResults.setCursor(selected);
+
+	std::stringstream ss;
+	if(results.empty())
+		ss << "NO GAMES PLAYED YET";
+	else
+		ss << results.size() << (results.size() == 1 ? " GAME" : " GAMES");
+
+	if(!index->isComplete())
+		ss << " (STILL LOADING)";
+
+	mStatus.setText(ss.str());
+}
+
+void GuiPlayedGames::update(int deltaTime)
+{
+	// only the top gui is updated, so the ViewController isn't doing this for us
+	PlayedIndex::getInstance()->update();
+
+	if(PlayedIndex::getInstance()->getGeneration() != mIndexGeneration)
+		refresh();
+
+	GuiComponent::update(deltaTime);
+}
+
+void GuiPlayedGames::jumpToSelected()
+{
+	if(mResults.size() == 0)
+		return;
+
+	FileData* game = mResults.getSelected();
+	SystemData* system = game->getSystem();
+
+	std::function<void()> onJump = mOnJump;
+	delete this;
+	if(onJump)
+		onJump();
+
+	ViewController::get()->goToGameList(system);
+	ViewController::get()->getGameListView(system)->setCursor(game);
+}
+
+bool GuiPlayedGames::input(InputConfig* config, Input input)
+{
+	if(input.value != 0)
+	{
+		if(config->isMappedTo("a", input))
+		{
+			jumpToSelected();
+			return true;
+		}
+
+		if(config->isMappedTo("b", input))
+		{
+			delete this;
+			return true;
+		}
+	}
+
+	return GuiComponent::input(config, input);
+}
+
+std::vector<HelpPrompt> GuiPlayedGames::getHelpPrompts()
+{
+	std::vector<HelpPrompt> prompts;
+	prompts.push_back(HelpPrompt("up/down", "choose"));
+	prompts.push_back(HelpPrompt("a", "go to game"));
+	prompts.push_back(HelpPrompt("b", "back"));
+	return prompts;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "GuiComponent.h"
+#include "components/NinePatchComponent.h"
+#include "components/TextComponent.h"
+#include "components/TextListComponent.h"
+#include <functional>
+
+class FileData;
+
+// The games played last (or most) in every system, from PlayedIndex; updates if systems finish loading while open.
+// Picking one goes to it in its gamelist; onJump is called first so whatever opened us can close too.
+class GuiPlayedGames : public GuiComponent
+{
+public:
+	GuiPlayedGames(Window* window, bool mostPlayed, const std::function<void()>& onJump = nullptr);
+
+	bool input(InputConfig* config, Input input) override;
+	void update(int deltaTime) override;
+	std::vector<HelpPrompt> getHelpPrompts() override;
+
+private:
+	void refresh();
+	void jumpToSelected();
+
+	bool mMostPlayed;
+	unsigned int mIndexGeneration; // of the PlayedIndex when the list was made
+
+	NinePatchComponent mBackground;
+	TextComponent mTitle;
+	TextComponent mStatus;
+	TextListComponent<FileData*> mResults;
+
+	std::function<void()> mOnJump;
+};
@@ -3,6 +3,8 @@
 #include "Log.h"
 #include "views/ViewController.h"
 #include "Gamelist.h"
+#include "Settings.h"
+#include "ScrapeJournal.h"
 
 #include "components/TextComponent.h"
 #include "components/ButtonComponent.h"
@@ -12,9 +14,10 @@
 
 using namespace Eigen;
 
-GuiScraperMulti::GuiScraperMulti(Window* window, const std::queue<ScraperSearchParams>& searches, bool approveResults) : 
+GuiScraperMulti::GuiScraperMulti(Window* window, const std::queue<ScraperSearchParams>& searches, bool approveResults,
+	const std::shared_ptr<ScrapeJournal>& journal) : 
 	GuiComponent(window), mBackground(window, ":/frame.png"), mGrid(window, Vector2i(1, 5)), 
-	mSearchQueue(searches)
+	mSearchQueue(searches), mJournal(journal)
 {
 	assert(mSearchQueue.size());
 
@@ -25,6 +28,12 @@ GuiScraperMulti::GuiScraperMulti(Window* window, const std::queue<ScraperSearchP
 	mCurrentGame = 0;
 	mTotalSuccessful = 0;
 	mTotalSkipped = 0;
+	mJobsFinished = false;
+
+	// results that need approval have to go through the UI one at a time
+	mConcurrency = 1;
+	if(!approveResults && Settings::getInstance()->getInt("ScraperConcurrency") > 1)
+		mConcurrency = (unsigned int)Settings::getInstance()->getInt("ScraperConcurrency");
 
 	// set up grid
 	mTitle = std::make_shared<TextComponent>(mWindow, "SCRAPING IN PROGRESS", Font::get(FONT_SIZE_LARGE), 0x555555FF, ALIGN_CENTER);
@@ -66,11 +75,21 @@ GuiScraperMulti::GuiScraperMulti(Window* window, const std::queue<ScraperSearchP
 	setSize(Renderer::getScreenWidth() * 0.95f, Renderer::getScreenHeight() * 0.849f);
 	setPosition((Renderer::getScreenWidth() - mSize.x()) / 2, (Renderer::getScreenHeight() - mSize.y()) / 2);
 
-	doNextSearch();
+	if(mConcurrency > 1)
+		startJobs();
+	else
+		doNextSearch();
 }
 
 GuiScraperMulti::~GuiScraperMulti()
 {
+	// the values the scraped games had are still in their systems' pools, and the new ones in the scrapers' default pool
+	mJobs.clear();
+	for(auto it = mScrapedSystems.begin(); it != mScrapedSystems.end(); it++)
+		(*it)->compactMetaDataPool();
+	if(!mScrapedSystems.empty())
+		MetaDataStringPool::resetDefault();
+
 	// view type probably changed (basic -> detailed)
 	for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end(); it++)
 		ViewController::get()->reloadGameListView(*it, false);
@@ -87,47 +106,161 @@ void GuiScraperMulti::onSizeChanged()
 	mGrid.setSize(mSize);
 }
 
-void GuiScraperMulti::doNextSearch()
+void GuiScraperMulti::update(int deltaTime)
 {
-	if(mSearchQueue.empty())
-	{
-		finish();
-		return;
-	}
+	GuiComponent::update(deltaTime);
+
+	if(mConcurrency > 1 && !mJobsFinished)
+		updateJobs();
+}
 
+void GuiScraperMulti::updateProgress(const ScraperSearchParams& search)
+{
 	// update title
 	std::stringstream ss;
-	mSystem->setText(strToUpper(mSearchQueue.front().system->getFullName()));
+	mSystem->setText(strToUpper(search.system->getFullName()));
 
 	// update subtitle
 	ss.str(""); // clear
-	ss << "GAME " << (mCurrentGame + 1) << " OF " << mTotalGames << " - " << strToUpper(mSearchQueue.front().game->getPath().filename().string());
+	ss << "GAME " << (mCurrentGame + 1) << " OF " << mTotalGames << " - " << strToUpper(search.game->getPath().filename().string());
 	mSubtitle->setText(ss.str());
+}
 
+void GuiScraperMulti::doNextSearch()
+{
+	if(mSearchQueue.empty())
+	{
+		if(mJournal)
+			mJournal->finish();
+		finish();
+		return;
+	}
+
+	updateProgress(mSearchQueue.front());
 	mSearchComp->search(mSearchQueue.front());
 }
 
-void GuiScraperMulti::acceptResult(const ScraperSearchResult& result)
+void GuiScraperMulti::startJobs()
 {
-	ScraperSearchParams& search = mSearchQueue.front();
+	while(mJobs.size() < mConcurrency && !mSearchQueue.empty())
+	{
+		std::unique_ptr<Job> job(new Job());
+		job->search = mSearchQueue.front();
+		job->searchHandle = startScraperSearch(job->search);
+		mSearchQueue.pop();
+
+		updateProgress(job->search);
+		mJobs.push_back(std::move(job));
+	}
+}
 
+void GuiScraperMulti::updateJobs()
+{
+	for(auto it = mJobs.begin(); it != mJobs.end(); )
+	{
+		Job& job = **it;
+		bool done = false;
+
+		if(job.searchHandle && job.searchHandle->status() != ASYNC_IN_PROGRESS)
+		{
+			if(job.searchHandle->status() == ASYNC_DONE && !job.searchHandle->getResults().empty())
+			{
+				const ScraperSearchResult& result = job.searchHandle->getResults().front();
+				if(!result.imageUrl.empty())
+				{
+					// resolve metadata image before saving
+					job.resolveHandle = resolveMetaDataAssets(result, job.search);
+				}else{
+					saveResult(job.search, result);
+					done = true;
+				}
+			}else{
+				// nobody is around to answer a retry prompt, so errors just skip the game
+				if(job.searchHandle->status() == ASYNC_ERROR)
+					LOG(LogWarning) << "Error scraping \"" << job.search.game->getPath().string() << "\": " << job.searchHandle->getStatusString();
+
+				markDone(job.search);
+				mCurrentGame++;
+				mTotalSkipped++;
+				done = true;
+			}
+
+			job.searchHandle.reset();
+		}else if(job.resolveHandle && job.resolveHandle->status() != ASYNC_IN_PROGRESS)
+		{
+			if(job.resolveHandle->status() == ASYNC_DONE)
+			{
+				saveResult(job.search, job.resolveHandle->getResult());
+			}else{
+				LOG(LogWarning) << "Error downloading media for \"" << job.search.game->getPath().string() << "\": " << job.resolveHandle->getStatusString();
+				markDone(job.search);
+				mCurrentGame++;
+				mTotalSkipped++;
+			}
+			done = true;
+		}
+
+		if(done)
+			it = mJobs.erase(it);
+		else
+			it++;
+	}
+
+	startJobs();
+
+	if(mJobs.empty())
+	{
+		mJobsFinished = true;
+		if(mJournal)
+			mJournal->finish();
+		finish();
+		return;
+	}
+
+	// the requests are only polled while updating, so don't let the main loop go idle
+	mWindow->invalidate();
+}
+
+void GuiScraperMulti::saveResult(const ScraperSearchParams& search, const ScraperSearchResult& result)
+{
 	search.game->metadata = result.mdl;
+	mScrapedSystems.insert(search.system);
+	if(search.game->getParent())
+		search.game->getParent()->invalidateSort();
+	if(!search.game->getThumbnailPath().empty())
+		search.system->setHasImages();
 	updateGamelist(search.system);
+	markDone(search);
 
-	mSearchQueue.pop();
 	mCurrentGame++;
 	mTotalSuccessful++;
+}
+
+void GuiScraperMulti::acceptResult(const ScraperSearchResult& result)
+{
+	ScraperSearchParams search = mSearchQueue.front();
+	mSearchQueue.pop();
+
+	saveResult(search, result);
 	doNextSearch();
 }
 
 void GuiScraperMulti::skip()
 {
+	markDone(mSearchQueue.front());
 	mSearchQueue.pop();
 	mCurrentGame++;
 	mTotalSkipped++;
 	doNextSearch();
 }
 
+void GuiScraperMulti::markDone(const ScraperSearchParams& search)
+{
+	// the gamelist is already written at this point, so a resumed scrape can leave the game out
+	if(mJournal)
+		mJournal->markDone(search.game);
+}
+
 void GuiScraperMulti::finish()
 {
 	std::stringstream ss;
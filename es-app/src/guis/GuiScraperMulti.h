@@ -6,31 +6,57 @@
 #include "scrapers/Scraper.h"
 
 #include <queue>
+#include <set>
 
 class ScraperSearchComponent;
 class TextComponent;
+class ScrapeJournal;
 
 class GuiScraperMulti : public GuiComponent
 {
 public:
-	GuiScraperMulti(Window* window, const std::queue<ScraperSearchParams>& searches, bool approveResults);
+	// journal may be NULL, otherwise every game that's done (scraped or skipped) is recorded in it.
+	GuiScraperMulti(Window* window, const std::queue<ScraperSearchParams>& searches, bool approveResults,
+		const std::shared_ptr<ScrapeJournal>& journal = nullptr);
 	virtual ~GuiScraperMulti();
 
 	void onSizeChanged() override;
+	void update(int deltaTime) override;
 	std::vector<HelpPrompt> getHelpPrompts() override;
 
 private:
 	void acceptResult(const ScraperSearchResult& result);
 	void skip();
 	void doNextSearch();
+	void saveResult(const ScraperSearchParams& search, const ScraperSearchResult& result);
 	
 	void finish();
+	void markDone(const ScraperSearchParams& search);
+
+	// When results are accepted automatically, several games are scraped at once ("ScraperConcurrency")
+	// without going through mSearchComp, so waiting on one server round-trip doesn't hold up the rest.
+	struct Job
+	{
+		ScraperSearchParams search;
+		std::unique_ptr<ScraperSearchHandle> searchHandle;
+		std::unique_ptr<MDResolveHandle> resolveHandle;
+	};
+
+	void startJobs();
+	void updateJobs();
+	void updateProgress(const ScraperSearchParams& search);
+
+	unsigned int mConcurrency; // 1 means one game at a time through mSearchComp
+	std::vector< std::unique_ptr<Job> > mJobs;
+	bool mJobsFinished;
 
 	unsigned int mTotalGames;
 	unsigned int mCurrentGame;
 	unsigned int mTotalSuccessful;
 	unsigned int mTotalSkipped;
 	std::queue<ScraperSearchParams> mSearchQueue;
+	std::shared_ptr<ScrapeJournal> mJournal;
+	std::set<SystemData*> mScrapedSystems; // their pools get compacted when we're done
 
 	NinePatchComponent mBackground;
 	ComponentGrid mGrid;
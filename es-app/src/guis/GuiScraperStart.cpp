@@ -2,6 +2,9 @@
 #include "guis/GuiScraperMulti.h"
 #include "guis/GuiMsgBox.h"
 #include "views/ViewController.h"
+#include "ScrapeJournal.h"
+#include "RomHasher.h"
+#include "Settings.h"
 
 #include "components/TextComponent.h"
 #include "components/OptionListComponent.h"
@@ -59,36 +62,50 @@ void GuiScraperStart::pressedStart()
 
 void GuiScraperStart::start()
 {
-	std::queue<ScraperSearchParams> searches = getSearches(mSystems->getSelectedObjects(), mFilters->getSelected());
+	std::vector<SystemData*> systems = mSystems->getSelectedObjects();
+
+	// the same batch started again picks up where the last one stopped
+	std::stringstream key;
+	key << Settings::getInstance()->getString("Scraper") << "|" << mFilters->getSelectedName() << "|" << mApproveResults->getState();
+	for(auto it = systems.begin(); it != systems.end(); it++)
+		key << "|" << (*it)->getName();
+	std::shared_ptr<ScrapeJournal> journal = std::make_shared<ScrapeJournal>(key.str());
+
+	std::queue<ScraperSearchParams> searches = getSearches(systems, mFilters->getSelected(), journal.get());
 
 	if(searches.empty())
 	{
+		journal->finish();
 		mWindow->pushGui(new GuiMsgBox(mWindow,
 			"NO GAMES FIT THAT CRITERIA."));
 	}else{
-		GuiScraperMulti* gsm = new GuiScraperMulti(mWindow, searches, mApproveResults->getState());
+		GuiScraperMulti* gsm = new GuiScraperMulti(mWindow, searches, mApproveResults->getState(), journal);
 		mWindow->pushGui(gsm);
 		delete this;
 	}
 }
 
-std::queue<ScraperSearchParams> GuiScraperStart::getSearches(std::vector<SystemData*> systems, GameFilterFunc selector)
+std::queue<ScraperSearchParams> GuiScraperStart::getSearches(std::vector<SystemData*> systems, GameFilterFunc selector, const ScrapeJournal* journal)
 {
 	std::queue<ScraperSearchParams> queue;
 	for(auto sys = systems.begin(); sys != systems.end(); sys++)
 	{
-		std::vector<FileData*> games = (*sys)->getRootFolder()->getFilesRecursive(GAME);
-		for(auto game = games.begin(); game != games.end(); game++)
-		{
-			if(selector((*sys), (*game)))
+		SystemData* system = *sys;
+		system->getRootFolder()->visitRecursive(GAME, [&](FileData* game) {
+			if(selector(system, game) && !journal->isDone(game))
 			{
 				ScraperSearchParams search;
-				search.game = *game;
-				search.system = *sys;
+				search.game = game;
+				search.system = system;
+				search.bulk = true;
 				
 				queue.push(search);
+
+				// the games further down the queue get hashed while the first ones are being scraped
+				RomHasher::getInstance()->queue(game->getPath());
 			}
-		}
+			return true;
+		});
 	}
 
 	return queue;
@@ -12,6 +12,7 @@ template<typename T>
 class OptionListComponent;
 
 class SwitchComponent;
+class ScrapeJournal;
 
 //The starting point for a multi-game scrape.
 //Allows the user to set various parameters (to set filters, to set which systems to scrape, to enable manual mode).
@@ -28,7 +29,7 @@ public:
 private:
 	void pressedStart();
 	void start();
-	std::queue<ScraperSearchParams> getSearches(std::vector<SystemData*> systems, GameFilterFunc selector);
+	std::queue<ScraperSearchParams> getSearches(std::vector<SystemData*> systems, GameFilterFunc selector, const ScrapeJournal* journal);
 
 	std::shared_ptr< OptionListComponent<GameFilterFunc> > mFilters;
 	std::shared_ptr< OptionListComponent<SystemData*> > mSystems;
@@ -0,0 +1,161 @@
+#include "guis/GuiSearch.h"
+#include "guis/GuiTextEditPopupKeyboard.h"
+#include "views/ViewController.h"
+#include "SearchIndex.h"
+#include "SystemData.h"
+#include "Renderer.h"
+#include <sstream>
+
+// more than this many results would only be scrolled past, type more instead
+#define SEARCH_MAX_RESULTS 200
+
+GuiSearch::GuiSearch(Window* window, const std::function<void()>& onJump) : GuiComponent(window), 
+	mIndexGeneration(0), mBackground(window, ":/frame.png"), mTitle(window), mStatus(window), mResults(window), mOnJump(onJump)
+{
+	setSize(Renderer::getScreenWidth() * 0.8f, Renderer::getScreenHeight() * 0.9f);
+	setPosition((Renderer::getScreenWidth() - mSize.x()) / 2, (Renderer::getScreenHeight() - mSize.y()) / 2);
+
+	mBackground.fitTo(mSize, Eigen::Vector3f::Zero(), Eigen::Vector2f(-32, -32));
+	addChild(&mBackground);
+
+	const float padding = Renderer::getScreenWidth() * 0.02f;
+
+	mTitle.setFont(Font::get(FONT_SIZE_LARGE));
+	mTitle.setColor(0x555555FF);
+	mTitle.setAlignment(ALIGN_CENTER);
+	mTitle.setText("SEARCH");
+	mTitle.setPosition(0, padding);
+	mTitle.setSize(mSize.x(), 0);
+	addChild(&mTitle);
+
+	mStatus.setFont(Font::get(FONT_SIZE_SMALL));
+	mStatus.setColor(0x777777FF);
+	mStatus.setAlignment(ALIGN_CENTER);
+	mStatus.setPosition(0, mTitle.getPosition().y() + mTitle.getSize().y());
+	mStatus.setSize(mSize.x(), Font::get(FONT_SIZE_SMALL)->getHeight());
+	addChild(&mStatus);
+
+	const float listTop = mStatus.getPosition().y() + mStatus.getSize().y() + padding;
+	mResults.setPosition(padding, listTop);
+	mResults.setSize(mSize.x() - padding * 2, mSize.y() - listTop - padding);
+	mResults.setAlignment(TextListComponent<FileData*>::ALIGN_LEFT);
+	mResults.setSelectorColor(0xC6C7C6FF);
+	mResults.setSelectedColor(0x555555FF);
+	mResults.setColor(0, 0x777777FF);
+	addChild(&mResults);
+
+	refresh();
+	openKeyboard();
+}
+
+void GuiSearch::openKeyboard()
+{
+	auto keyboard = new GuiTextEditPopupKeyboard(mWindow, "SEARCH", mQuery, [this](const std::string& query) { setQuery(query); }, false, "DONE");
+	keyboard->setChangedCallback([this](const std::string& query) { setQuery(query); });
+
+	// keep the top of the results in view while typing
+	keyboard->setPosition(keyboard->getPosition().x(), Renderer::getScreenHeight() - keyboard->getSize().y());
+	mWindow->pushGui(keyboard);
+}
+
+void GuiSearch::setQuery(const std::string& query)
+{
+	if(query == mQuery)
+		return;
+
+	mQuery = query;
+	refresh();
+}
+
+void GuiSearch::refresh()
+{
+	SearchIndex* index = SearchIndex::getInstance();
+	mIndexGeneration = index->getGeneration();
+
+	unsigned int total = 0;
+	const std::vector<FileData*> results = index->search(mQuery, SEARCH_MAX_RESULTS, total);
+
+	mResults.clear();
+	for(auto it = results.begin(); it != results.end(); it++)
+		mResults.add((*it)->getName() + "  [" + (*it)->getSystem()->getFullName() + "]", *it, 0);
+
+	std::stringstream ss;
+	if(mQuery.empty())
+		ss << "TYPE PART OF A GAME'S NAME";
+	else if(total == 0)
+		ss << "NO GAMES FOUND FOR \"" << mQuery << "\"";
+	else if(total > results.size())
+		ss << total << " GAMES FOUND, SHOWING THE FIRST " << results.size();
+	else
+		ss << total << (total == 1 ? " GAME" : " GAMES") << " FOUND";
+
+	if(!index->isComplete())
+		ss << " (STILL INDEXING)";
+
+	mStatus.setText(ss.str());
+}
+
+void GuiSearch::update(int deltaTime)
+{
+	// only the top gui is updated, so the ViewController isn't doing this for us
+	SearchIndex::getInstance()->update();
+
+	// systems finishing indexing (or games changing) while we're open
+	if(SearchIndex::getInstance()->getGeneration() != mIndexGeneration)
+		refresh();
+
+	GuiComponent::update(deltaTime);
+}
+
+void GuiSearch::jumpToSelected()
+{
+	if(mResults.size() == 0)
+		return;
+
+	FileData* game = mResults.getSelected();
+	SystemData* system = game->getSystem();
+
+	std::function<void()> onJump = mOnJump;
+	delete this;
+	if(onJump)
+		onJump();
+
+	ViewController::get()->goToGameList(system);
+	ViewController::get()->getGameListView(system)->setCursor(game);
+}
+
+bool GuiSearch::input(InputConfig* config, Input input)
+{
+	if(input.value != 0)
+	{
+		if(config->isMappedTo("a", input))
+		{
+			jumpToSelected();
+			return true;
+		}
+
+		if(config->isMappedTo("x", input))
+		{
+			openKeyboard();
+			return true;
+		}
+
+		if(config->isMappedTo("b", input))
+		{
+			delete this;
+			return true;
+		}
+	}
+
+	return GuiComponent::input(config, input);
+}
+
+std::vector<HelpPrompt> GuiSearch::getHelpPrompts()
+{
+	std::vector<HelpPrompt> prompts;
+	prompts.push_back(HelpPrompt("up/down", "choose"));
+	prompts.push_back(HelpPrompt("a", "go to game"));
+	prompts.push_back(HelpPrompt("x", "edit search"));
+	prompts.push_back(HelpPrompt("b", "back"));
+	return prompts;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "GuiComponent.h"
+#include "components/NinePatchComponent.h"
+#include "components/TextComponent.h"
+#include "components/TextListComponent.h"
+#include <functional>
+
+class FileData;
+
+// Searches the names of every game in every system (see SearchIndex), results update as the user types.
+// Picking one goes to it in its gamelist; onJump is called first so whatever opened us can close too.
+class GuiSearch : public GuiComponent
+{
+public:
+	GuiSearch(Window* window, const std::function<void()>& onJump = nullptr);
+
+	bool input(InputConfig* config, Input input) override;
+	void update(int deltaTime) override;
+	std::vector<HelpPrompt> getHelpPrompts() override;
+
+private:
+	void openKeyboard();
+	void setQuery(const std::string& query);
+	void refresh();
+	void jumpToSelected();
+
+	std::string mQuery;
+	unsigned int mIndexGeneration; // of the SearchIndex when the results were found
+
+	NinePatchComponent mBackground;
+	TextComponent mTitle;
+	TextComponent mStatus;
+	TextListComponent<FileData*> mResults;
+
+	std::function<void()> mOnJump;
+};
@@ -17,6 +17,19 @@
 #include "EmulationStation.h"
 #include "Settings.h"
 #include "ScraperCmdLine.h"
+#include "GamelistSync.h"
+#include "RomHasher.h"
+#include "RomWatcher.h"
+#include "FramePacer.h"
+#include "ThermalGovernor.h"
+#include "FrameProfiler.h"
+#include "GpuProfiler.h"
+#include "Trace.h"
+#include "Metrics.h"
+#include "UIBenchmark.h"
+#include "InputRecorder.h"
+#include "components/SlideshowScreenSaver.h"
+#include "resources/ThumbnailCache.h"
 #include <sstream>
 #include <boost/locale.hpp>
 
@@ -27,6 +40,27 @@
 namespace fs = boost::filesystem;
 
 bool scrape_cmdline = false;
+ScraperCmdLineOptions scrape_options;
+std::string sync_export_dir;
+std::string sync_import_dir;
+
+// the command line scraper and gamelist sync do their thing and quit without ever opening a window
+static bool runsWithoutWindow()
+{
+	return scrape_cmdline || !sync_export_dir.empty() || !sync_import_dir.empty();
+}
+
+// every game has to be there before they start, and there's no UI to leave disk time for
+static void setupWithoutWindow()
+{
+	Settings::getInstance()->setBool("LazyLoadSystems", false);
+	Settings::getInstance()->setBool("ProgressiveStartup", false);
+	Settings::getInstance()->setInt("ScanTimeout", 0);
+	Settings::getInstance()->setInt("HashReadLimit", 0);
+}
+bool benchmark_ui = false;
+std::string record_input_path;
+std::string replay_input_path;
 
 bool parseArgs(int argc, char* argv[], unsigned int* width, unsigned int* height)
 {
@@ -52,6 +86,19 @@ bool parseArgs(int argc, char* argv[], unsigned int* width, unsigned int* height
 		}else if(strcmp(argv[i], "--draw-framerate") == 0)
 		{
 			Settings::getInstance()->setBool("DrawFramerate", true);
+		}else if(strcmp(argv[i], "--profile-frames") == 0)
+		{
+			Settings::getInstance()->setBool("ProfileFrames", true);
+		}else if(strcmp(argv[i], "--trace") == 0)
+		{
+			if(i >= argc - 1)
+			{
+				std::cerr << "No trace file supplied.";
+				return false;
+			}
+
+			Trace::start(argv[i + 1]);
+			i++; // skip the file name
 		}else if(strcmp(argv[i], "--no-exit") == 0)
 		{
 			Settings::getInstance()->setBool("ShowExit", false);
@@ -71,6 +118,100 @@ bool parseArgs(int argc, char* argv[], unsigned int* width, unsigned int* height
 		}else if(strcmp(argv[i], "--scrape") == 0)
 		{
 			scrape_cmdline = true;
+			setupWithoutWindow();
+		}else if(strcmp(argv[i], "--sync-export") == 0 || strcmp(argv[i], "--sync-import") == 0)
+		{
+			if(i >= argc - 1)
+			{
+				std::cerr << "No sync directory supplied.";
+				return false;
+			}
+
+			if(strcmp(argv[i], "--sync-export") == 0)
+				sync_export_dir = argv[i + 1];
+			else
+				sync_import_dir = argv[i + 1];
+			setupWithoutWindow();
+			i++; // skip the directory
+		}else if(strcmp(argv[i], "--scrape-systems") == 0)
+		{
+			if(i >= argc - 1)
+			{
+				std::cerr << "No systems supplied.";
+				return false;
+			}
+
+			std::stringstream names(argv[i + 1]);
+			std::string name;
+			while(std::getline(names, name, ','))
+			{
+				if(!name.empty())
+					scrape_options.systems.push_back(name);
+			}
+			i++; // skip the systems
+		}else if(strcmp(argv[i], "--scrape-filter") == 0)
+		{
+			if(i < argc - 1 && strcmp(argv[i + 1], "all") == 0)
+				scrape_options.filter = ScraperCmdLineOptions::FILTER_ALL;
+			else if(i < argc - 1 && strcmp(argv[i + 1], "missing-image") == 0)
+				scrape_options.filter = ScraperCmdLineOptions::FILTER_MISSING_IMAGE;
+			else
+			{
+				std::cerr << "Invalid scrape filter supplied (all or missing-image).";
+				return false;
+			}
+			i++; // skip the filter
+		}else if(strcmp(argv[i], "--scrape-accept") == 0)
+		{
+			if(i < argc - 1 && strcmp(argv[i + 1], "first") == 0)
+				scrape_options.accept = ScraperCmdLineOptions::ACCEPT_FIRST;
+			else if(i < argc - 1 && strcmp(argv[i + 1], "hash") == 0)
+				scrape_options.accept = ScraperCmdLineOptions::ACCEPT_HASH_MATCH;
+			else
+			{
+				std::cerr << "Invalid scrape accept policy supplied (first or hash).";
+				return false;
+			}
+			i++; // skip the policy
+		}else if(strcmp(argv[i], "--scrape-concurrency") == 0)
+		{
+			if(i >= argc - 1 || atoi(argv[i + 1]) <= 0)
+			{
+				std::cerr << "Invalid scrape concurrency supplied.";
+				return false;
+			}
+
+			scrape_options.concurrency = atoi(argv[i + 1]);
+			i++; // skip the count
+		}else if(strcmp(argv[i], "--scrape-results") == 0)
+		{
+			if(i >= argc - 1)
+			{
+				std::cerr << "No scrape results file supplied.";
+				return false;
+			}
+
+			scrape_options.resultsPath = argv[i + 1];
+			i++; // skip the path
+		}else if(strcmp(argv[i], "--record-input") == 0 || strcmp(argv[i], "--replay-input") == 0)
+		{
+			if(i >= argc - 1)
+			{
+				std::cerr << "No input recording file supplied.";
+				return false;
+			}
+
+			if(strcmp(argv[i], "--record-input") == 0)
+				record_input_path = argv[i + 1];
+			else
+				replay_input_path = argv[i + 1];
+			i++; // skip the path
+		}else if(strcmp(argv[i], "--benchmark-ui") == 0)
+		{
+			benchmark_ui = true;
+			Settings::getInstance()->setBool("Headless", true);
+			Settings::getInstance()->setBool("Windowed", true);
+			Settings::getInstance()->setInt("ScreenSaverTime", 0);
 		}else if(strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0)
 		{
 #ifdef WIN32
@@ -90,9 +231,23 @@ bool parseArgs(int argc, char* argv[], unsigned int* width, unsigned int* height
 				"--gamelist-only			skip automatic game search, only read from gamelist.xml\n"
 				"--ignore-gamelist		ignore the gamelist (useful for troubleshooting)\n"
 				"--draw-framerate		display the framerate\n"
+				"--profile-frames		graph per-frame timings, written to frametimes.csv on exit\n"
+				"--trace [file]			write a Chrome trace (chrome://tracing) of startup and loading to file on exit\n"
 				"--no-exit			don't show the exit option in the menu\n"
 				"--debug				more logging, show console on Windows\n"
-				"--scrape			scrape using command line interface\n"
+				"--scrape			scrape without the UI, then quit (never asks anything, see below)\n"
+				"--scrape-systems [a,b,...]	systems to scrape (default: every system with a platform set)\n"
+				"--scrape-filter [all/missing-image]	games to scrape (default: missing-image)\n"
+				"--scrape-accept [first/hash]	take the first result, or only a single result found by the ROM's hash (default: first)\n"
+				"--scrape-concurrency [n]	games scraped at once (default: the ScraperConcurrency setting)\n"
+				"--scrape-results [file]		write one JSON object per game to file\n"
+				"				a run that's interrupted picks up where it stopped when started again with the same options\n"
+				"--sync-import [dir]		take the gamelist changes and media in dir that are newer than ours, then quit\n"
+				"--sync-export [dir]		add the gamelist changes and media since the last export to dir, then quit\n"
+				"				(with both, the import is done first)\n"
+				"--benchmark-ui			run a scripted UI benchmark in a hidden window, print frame timings and exit\n"
+				"--record-input [file]		write every input (as the action it's mapped to) to file\n"
+				"--replay-input [file]		play back a recorded session with a fixed timestep, ignoring real input, then exit\n"
 				"--windowed			not fullscreen, should be used with --resolution\n"
 				"--vsync [1/on or 0/off]		turn vsync on or off (default is on)\n"
 				"--help, -h			summon a sentient, angry tuba\n\n"
@@ -149,9 +304,47 @@ bool loadSystemConfigFile(const char** errorString)
 	return true;
 }
 
+// hands pending SDL events to the window, clears running on SDL_QUIT
+void processEvents(Window* window, bool& running)
+{
+	FrameProfiler* profiler = FrameProfiler::getInstance();
+	profiler->begin(FrameProfiler::PHASE_INPUT);
+
+	SDL_Event event;
+	while(SDL_PollEvent(&event))
+	{
+		switch(event.type)
+		{
+			case SDL_JOYHATMOTION:
+			case SDL_JOYBUTTONDOWN:
+			case SDL_JOYBUTTONUP:
+			case SDL_KEYDOWN:
+			case SDL_KEYUP:
+			case SDL_JOYAXISMOTION:
+			case SDL_TEXTINPUT:
+			case SDL_TEXTEDITING:
+			case SDL_JOYDEVICEADDED:
+			case SDL_JOYDEVICEREMOVED:
+				// a replay only gets the recorded input
+				if(!InputRecorder::getInstance()->isReplaying() || event.type == SDL_JOYDEVICEADDED || event.type == SDL_JOYDEVICEREMOVED)
+					InputManager::getInstance()->parseEvent(event, window);
+				break;
+			case SDL_QUIT:
+				running = false;
+				break;
+		}
+	}
+
+	InputManager::getInstance()->flushAxisEvents(window);
+
+	profiler->end(FrameProfiler::PHASE_INPUT);
+}
+
 //called on exit, assuming we get far enough to have the log initialized
 void onExit()
 {
+	Settings::getInstance()->waitForSave();
+	Trace::finish();
 	Log::close();
 }
 
@@ -166,6 +359,13 @@ int main(int argc, char* argv[])
 	if(!parseArgs(argc, argv, &width, &height))
 		return 0;
 
+	// same size everywhere unless asked otherwise, so results can be compared
+	if(benchmark_ui && width == 0 && height == 0)
+	{
+		width = 1280;
+		height = 720;
+	}
+
 	// only show the console on Windows if HideConsole is false
 #ifdef WIN32
 	// MSVC has a "SubSystem" option, with two primary options: "WINDOWS" and "CONSOLE".
@@ -210,12 +410,15 @@ int main(int argc, char* argv[])
 	//always close the log on exit
 	atexit(&onExit);
 
+	ThumbnailCache::init();
+
 	Window window;
 	ViewController::init(&window);
 	window.pushGui(ViewController::get());
 
-	if(!scrape_cmdline)
+	if(!runsWithoutWindow())
 	{
+		TRACE_SCOPE("Window::init");
 		if(!window.init(width, height))
 		{
 			LOG(LogError) << "Window failed to initialize!";
@@ -230,13 +433,19 @@ int main(int argc, char* argv[])
 	}
 
 	const char* errorMsg = NULL;
-	if(!loadSystemConfigFile(&errorMsg))
+	bool loadedConfig;
+	{
+		TRACE_SCOPE("loadSystemConfigFile");
+		loadedConfig = loadSystemConfigFile(&errorMsg);
+	}
+
+	if(!loadedConfig)
 	{
 		// something went terribly wrong
 		if(errorMsg == NULL)
 		{
 			LOG(LogError) << "Unknown error occured while parsing system config file.";
-			if(!scrape_cmdline)
+			if(!runsWithoutWindow())
 				Renderer::deinit();
 			return 1;
 		}
@@ -251,23 +460,49 @@ int main(int argc, char* argv[])
 			}));
 	}
 
+	//sync the gamelists then quit (or go on to scrape)
+	if(!sync_import_dir.empty() || !sync_export_dir.empty())
+	{
+		bool synced = true;
+		if(!sync_import_dir.empty())
+			synced = importGamelistChanges(sync_import_dir);
+		if(synced && !sync_export_dir.empty())
+			synced = exportGamelistChanges(sync_export_dir);
+
+		if(!scrape_cmdline)
+		{
+			RomHasher::getInstance()->stop();
+			SystemData::shutdownSystems();
+			return synced ? 0 : 1;
+		}
+	}
+
 	//run the command line scraper then quit
 	if(scrape_cmdline)
 	{
-		return run_scraper_cmdline();
+		const int scrapeResult = run_scraper_cmdline(scrape_options);
+		RomHasher::getInstance()->stop();
+		SystemData::shutdownSystems();
+		return scrapeResult;
 	}
 
 	//dont generate joystick events while we're loading (hopefully fixes "automatically started emulator" bug)
 	SDL_JoystickEventState(SDL_DISABLE);
 
-	// preload what we can right away instead of waiting for the user to select it
-	// this makes for no delays when accessing content, but a longer startup time
+	// gamelist views are built on demand (and while idle for the neighbouring systems), so startup doesn't scale with system count
 	ViewController::get()->preload();
 
+	// anything that's loaded lazily gets loaded in the background from here on
+	SystemData::loadRemainingInBackground();
+
+	// pick up ROMs being added or removed while we're running
+	RomWatcher::getInstance()->start();
+
 	//choose which GUI to open depending on if an input configuration already exists
 	if(errorMsg == NULL)
 	{
-		if(fs::exists(InputManager::getConfigPath()) && InputManager::getInstance()->getNumConfiguredDevices() > 0)
+		// the benchmark and replays bring their own input config
+		if(benchmark_ui || !replay_input_path.empty() || (InputManager::getInstance()->hasConfigFile() && InputManager::getInstance()->getNumConfiguredDevices() > 0))
 		{
 			ViewController::get()->goToStart();
 		}else{
@@ -278,63 +513,171 @@ int main(int argc, char* argv[])
 	//generate joystick events since we're done loading
 	SDL_JoystickEventState(SDL_ENABLE);
 
-	int lastTime = SDL_GetTicks();
-	bool running = true;
+	SlideshowScreenSaver screenSaver(&window);
+	window.setScreenSaver(&screenSaver);
+
+	int exitCode = 0;
+	if(benchmark_ui && errorMsg == NULL)
+		exitCode = runUIBenchmark(&window);
+
+	FramePacer* pacer = FramePacer::getInstance();
+	pacer->init();
+	bool running = !benchmark_ui;
+
+	// both count time from the first frame on, so startup taking longer or shorter doesn't shift the inputs
+	InputRecorder* recorder = InputRecorder::getInstance();
+	if(running && !replay_input_path.empty())
+	{
+		if(!recorder->startReplay(replay_input_path))
+		{
+			running = false;
+			exitCode = 1;
+		}
+	}else if(running && !record_input_path.empty())
+	{
+		recorder->startRecording(record_input_path);
+	}
+	const bool replaying = recorder->isReplaying();
+
+	FrameProfiler* profiler = FrameProfiler::getInstance();
+	ThermalGovernor* thermal = ThermalGovernor::getInstance();
+	const Trace::Clock::time_point loopStart = Trace::Clock::now();
+	bool firstFrame = true;
+
+	Metrics::Histogram* frameTime = Metrics::getHistogram("es_frame_time_ms", "Time from the start of a main loop iteration to the end of its swap, for frames that were drawn");
+	const double msPerTick = 1000.0 / (double)SDL_GetPerformanceFrequency();
 
+	// the next frame's update can run between flushing a frame and swapping it, while the GPU is still drawing it;
+	// it can't hide the vsync wait (that happens inside the swap), and an update longer than the GPU's work pushes
+	// the swap past its vblank, so it's off unless asked for
+	const bool overlapUpdate = Settings::getInstance()->getBool("OverlapUpdateWithSwap");
+	bool updatedAhead = false;
+
+	// false once a replay has run out
+	auto updateWindow = [&]() -> bool
+	{
+		int deltaTime = pacer->beginFrame();
+		if(replaying)
+		{
+			if(recorder->isReplayDone())
+			{
+				LOG(LogInfo) << "Input replay finished";
+				return false;
+			}
+			deltaTime = INPUT_REPLAY_FRAME_MS;
+		}
+		recorder->update(&window, deltaTime);
+
+		profiler->begin(FrameProfiler::PHASE_UPDATE);
+		window.update(deltaTime);
+		profiler->end(FrameProfiler::PHASE_UPDATE);
+		return true;
+	};
+
+	std::vector<FileData*> lateAdded;
 	while(running)
 	{
-		SDL_Event event;
-		while(SDL_PollEvent(&event))
+		const Uint64 frameStart = SDL_GetPerformanceCounter();
+		processEvents(&window, running);
+
+		lateAdded.clear();
+		SystemData::updateLateScans(lateAdded);
+		for(auto it = lateAdded.begin(); it != lateAdded.end(); it++)
+			ViewController::get()->onFileChanged(*it, FILE_ADDED);
+
+		if(SystemData::updatePendingSystems())
+			ViewController::get()->onSystemsChanged();
+
+		RomWatcher::getInstance()->update();
+		Metrics::update();
+		thermal->update();
+
+		if(window.isSleeping())
 		{
-			switch(event.type)
+			if(replaying)
 			{
-				case SDL_JOYHATMOTION:
-				case SDL_JOYBUTTONDOWN:
-				case SDL_JOYBUTTONUP:
-				case SDL_KEYDOWN:
-				case SDL_KEYUP:
-				case SDL_JOYAXISMOTION:
-				case SDL_TEXTINPUT:
-				case SDL_TEXTEDITING:
-				case SDL_JOYDEVICEADDED:
-				case SDL_JOYDEVICEREMOVED:
-					InputManager::getInstance()->parseEvent(event, &window);
-					break;
-				case SDL_QUIT:
+				// nothing real is going to wake us up, the next replayed input will (without spinning until it's due)
+				if(recorder->isReplayDone())
+				{
+					LOG(LogInfo) << "Input replay finished";
 					running = false;
 					break;
+				}
+				recorder->skipToNextEvent(&window);
+				continue;
 			}
+
+			// give up our CPU time until an event wakes us up, but still check for ROM changes now and then
+			window.waitWhileSleeping();
+			pacer->reset();
+			updatedAhead = false;
+			continue;
 		}
 
-		if(window.isSleeping())
+		// already done while the last frame was being swapped
+		if(!updatedAhead && !updateWindow())
 		{
-			lastTime = SDL_GetTicks();
-			SDL_Delay(1); // this doesn't need to be accurate, we're just giving up our CPU time until something wakes us up
-			continue;
+			running = false;
+			break;
 		}
+		updatedAhead = false;
 
-		int curTime = SDL_GetTicks();
-		int deltaTime = curTime - lastTime;
-		lastTime = curTime;
+		// latch anything that came in while updating, so it makes this frame instead of the next one
+		processEvents(&window, running);
 
-		// cap deltaTime at 1000
-		if(deltaTime > 1000 || deltaTime < 0)
-			deltaTime = 1000;
+		if(window.needsRedraw())
+		{
+			profiler->begin(FrameProfiler::PHASE_RENDER);
+			GpuProfiler::getInstance()->beginFrame();
+			window.render();
+			GpuProfiler::getInstance()->endFrame();
+			profiler->end(FrameProfiler::PHASE_RENDER);
+
+			// this frame's commands are with the GPU already, what the update uploads only shows up in the next one
+			if(overlapUpdate && !window.isSleeping())
+			{
+				Renderer::flush();
+				if(!updateWindow())
+					running = false;
+				updatedAhead = running;
+			}
 
-		window.update(deltaTime);
-		window.render();
-		Renderer::swapBuffers();
+			profiler->begin(FrameProfiler::PHASE_SWAP);
+			Renderer::swapBuffers();
+			profiler->end(FrameProfiler::PHASE_SWAP);
+			const float frameMs = (float)((SDL_GetPerformanceCounter() - frameStart) * msPerTick);
+			frameTime->record(frameMs);
+			thermal->addFrame(frameMs);
+			pacer->endFrame();
+
+			if(firstFrame && Trace::isEnabled())
+				Trace::addSpan("first frame", "", loopStart, Trace::Clock::now());
+			firstFrame = false;
+		}else{
+			// nothing on screen changed, so don't draw the same frame again;
+			// block until input (or a finished background load) arrives or the next redraw is due
+			// (a replay's time only moves on with its frames, so waiting for it would be forever)
+			const int timeout = window.getIdleTimeout();
+			if(timeout > 0 && !replaying)
+				SDL_WaitEventTimeout(NULL, timeout);
+		}
 
-		Log::flush();
+		profiler->endFrame();
 	}
 
+	if(profiler->isEnabled())
+		profiler->dumpCSV(getHomePath() + "/.emulationstation/frametimes.csv");
+	recorder->stop();
+
 	while(window.peekGui() != ViewController::get())
 		delete window.peekGui();
 	window.deinit();
 
-	SystemData::deleteSystems();
+	RomWatcher::getInstance()->stop();
+	RomHasher::getInstance()->stop();
+	SystemData::shutdownSystems();
 
 	LOG(LogInfo) << "EmulationStation cleanly shutting down.";
 
-	return 0;
+	return exitCode;
 }
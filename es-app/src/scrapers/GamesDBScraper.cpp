@@ -5,6 +5,7 @@
 #include "Settings.h"
 #include "Util.h"
 #include <boost/assign.hpp>
+#include <unordered_map>
 
 using namespace PlatformIds;
 const std::map<PlatformId, const char*> gamesdb_platformid_map = boost::assign::map_list_of
@@ -64,6 +65,142 @@ const std::map<PlatformId, const char*> gamesdb_platformid_map = boost::assign::
 	(ZX_SPECTRUM, "Sinclair ZX Spectrum");
 
 
+// The game list of one platform, keyed by normalized title. Fetched in two steps: the platform list for its id,
+// then the platform's games.
+struct GamesDBPlatformGames
+{
+	enum State
+	{
+		LOADING_PLATFORMS,
+		LOADING_GAMES,
+		READY,
+		FAILED
+	};
+
+	GamesDBPlatformGames(const std::string& platform, bool bulk);
+	void update();
+
+	std::string platform;
+	bool bulk;
+	State state;
+	std::unique_ptr<HttpReq> req;
+	std::unordered_map< std::string, std::vector<std::string> > ids;
+};
+
+GamesDBPlatformGames::GamesDBPlatformGames(const std::string& platform_, bool bulk_) : platform(platform_), bulk(bulk_), 
+	state(LOADING_PLATFORMS), req(new HttpReq("thegamesdb.net/api/GetPlatformsList.php", HttpReq::CACHE_RESPONSE | (bulk_ ? HttpReq::BULK : 0)))
+{
+}
+
+void GamesDBPlatformGames::update()
+{
+	if(state == READY || state == FAILED)
+		return;
+
+	HttpReq::Status status = req->status();
+	if(status == HttpReq::REQ_IN_PROGRESS)
+		return;
+
+	if(status != HttpReq::REQ_SUCCESS)
+	{
+		LOG(LogWarning) << "TheGamesDB - could not get the game list for " << platform << ", searching by name instead: " << req->getErrorMsg();
+		state = FAILED;
+		req.reset();
+		return;
+	}
+
+	pugi::xml_document doc;
+	pugi::xml_parse_result parseResult = doc.load(req->getContent().c_str());
+	req.reset();
+	if(!parseResult)
+	{
+		LOG(LogWarning) << "TheGamesDB - error parsing the game list for " << platform << ": " << parseResult.description();
+		state = FAILED;
+		return;
+	}
+
+	if(state == LOADING_PLATFORMS)
+	{
+		pugi::xml_node found;
+		for(pugi::xml_node p = doc.child("Data").child("Platforms").child("Platform"); p && !found; p = p.next_sibling("Platform"))
+		{
+			if(platform == p.child("name").text().get())
+				found = p;
+		}
+
+		if(!found)
+		{
+			LOG(LogWarning) << "TheGamesDB - no platform named \"" << platform << "\", searching by name instead";
+			state = FAILED;
+			return;
+		}
+
+		state = LOADING_GAMES;
+		req.reset(new HttpReq("thegamesdb.net/api/GetPlatformGames.php?platform=" + HttpReq::urlEncode(found.child("id").text().get()), 
+			HttpReq::CACHE_RESPONSE | (bulk ? HttpReq::BULK : 0)));
+		return;
+	}
+
+	for(pugi::xml_node game = doc.child("Data").child("Game"); game; game = game.next_sibling("Game"))
+	{
+		const std::string key = normalizeGameName(game.child("GameTitle").text().get());
+		if(!key.empty())
+			ids[key].push_back(game.child("id").text().get());
+	}
+
+	LOG(LogInfo) << "TheGamesDB - got " << ids.size() << " titles for " << platform;
+	state = READY;
+}
+
+// kept for the whole run, the lists hardly ever change (and the HTTP cache has them for next time)
+static std::shared_ptr<GamesDBPlatformGames> getPlatformGames(const std::string& platform, bool bulk)
+{
+	static std::map< std::string, std::shared_ptr<GamesDBPlatformGames> > platforms;
+
+	std::shared_ptr<GamesDBPlatformGames>& games = platforms[platform];
+	if(!games)
+		games = std::make_shared<GamesDBPlatformGames>(platform, bulk);
+	return games;
+}
+
+TheGamesDBPlatformRequest::TheGamesDBPlatformRequest(std::vector<ScraperSearchResult>& resultsWrite, const std::string& platform, 
+	const std::string& name, const std::string& normalizedName, bool bulk) : ScraperRequest(resultsWrite), mGames(getPlatformGames(platform, bulk)), 
+	mPlatform(platform), mName(name), mNormalizedName(normalizedName), mBulk(bulk)
+{
+	setStatus(ASYNC_IN_PROGRESS);
+}
+
+void TheGamesDBPlatformRequest::update()
+{
+	if(mStatus != ASYNC_IN_PROGRESS)
+		return;
+
+	if(!mRequest)
+	{
+		mGames->update();
+		if(mGames->state != GamesDBPlatformGames::READY && mGames->state != GamesDBPlatformGames::FAILED)
+			return;
+
+		std::string path = "thegamesdb.net/api/GetGame.php?";
+		auto it = mGames->ids.find(mNormalizedName);
+		if(it != mGames->ids.end())
+		{
+			// only the first one, a batch scrape takes the first result anyway
+			path += "id=" + HttpReq::urlEncode(it->second.front());
+		}else{
+			path += "name=" + HttpReq::urlEncode(mName) + "&platform=" + HttpReq::urlEncode(mPlatform);
+		}
+
+		mRequest.reset(new TheGamesDBRequest(mResults, path, mBulk));
+	}
+
+	AsyncHandleStatus status = mRequest->status();
+	if(status == ASYNC_DONE)
+		setStatus(ASYNC_DONE);
+	else if(status == ASYNC_ERROR)
+		setError(mRequest->getStatusString());
+}
+
 void thegamesdb_generate_scraper_requests(const ScraperSearchParams& params, std::queue< std::unique_ptr<ScraperRequest> >& requests, 
 	std::vector<ScraperSearchResult>& results)
 {
@@ -73,12 +210,31 @@ void thegamesdb_generate_scraper_requests(const ScraperSearchParams& params, std
 	if(cleanName.empty())
 		cleanName = params.game->getCleanName();
 
+	// batch scrapes of a known platform match against the platform's game list
+	if(params.bulk && params.nameOverride.empty() && !params.system->getPlatformIds().empty())
+	{
+		auto& platforms = params.system->getPlatformIds();
+		bool mapped = true;
+		for(auto platformIt = platforms.begin(); platformIt != platforms.end() && mapped; platformIt++)
+			mapped = gamesdb_platformid_map.find(*platformIt) != gamesdb_platformid_map.end();
+
+		if(mapped)
+		{
+			for(auto platformIt = platforms.begin(); platformIt != platforms.end(); platformIt++)
+			{
+				requests.push(std::unique_ptr<ScraperRequest>(
+					new TheGamesDBPlatformRequest(results, gamesdb_platformid_map.at(*platformIt), cleanName, params.game->getNormalizedName(), true)));
+			}
+			return;
+		}
+	}
+
 	path += "name=" + HttpReq::urlEncode(cleanName);
 
 	if(params.system->getPlatformIds().empty())
 	{
 		// no platform specified, we're done
-		requests.push(std::unique_ptr<ScraperRequest>(new TheGamesDBRequest(results, path)));
+		requests.push(std::unique_ptr<ScraperRequest>(new TheGamesDBRequest(results, path, params.bulk)));
 	}else{
 		// go through the list, we need to split this into multiple requests 
 		// because TheGamesDB API either sucks or I don't know how to use it properly...
@@ -96,7 +252,7 @@ void thegamesdb_generate_scraper_requests(const ScraperSearchParams& params, std
 				LOG(LogWarning) << "TheGamesDB scraper warning - no support for platform " << getPlatformName(*platformIt);
 			}
 
-			requests.push(std::unique_ptr<ScraperRequest>(new TheGamesDBRequest(results, path)));
+			requests.push(std::unique_ptr<ScraperRequest>(new TheGamesDBRequest(results, path, params.bulk)));
 		}
 	}
 }
@@ -8,7 +8,30 @@ void thegamesdb_generate_scraper_requests(const ScraperSearchParams& params, std
 class TheGamesDBRequest : public ScraperHttpRequest
 {
 public:
-	TheGamesDBRequest(std::vector<ScraperSearchResult>& resultsWrite, const std::string& url) : ScraperHttpRequest(resultsWrite, url) {}
+	TheGamesDBRequest(std::vector<ScraperSearchResult>& resultsWrite, const std::string& url, bool bulk = false) 
+		: ScraperHttpRequest(resultsWrite, url, bulk) {}
 protected:
 	void process(const std::unique_ptr<HttpReq>& req, std::vector<ScraperSearchResult>& results) override;
 };
+
+struct GamesDBPlatformGames;
+
+// Batch scrapes look games up in the platform's whole game list (downloaded once per run and shared by every
+// search for that platform) instead of searching by name, then only fetch the details of the match.
+// Falls back to a normal name search if the list can't be had or doesn't have the game.
+class TheGamesDBPlatformRequest : public ScraperRequest
+{
+public:
+	TheGamesDBPlatformRequest(std::vector<ScraperSearchResult>& resultsWrite, const std::string& platform, 
+		const std::string& name, const std::string& normalizedName, bool bulk);
+
+	void update() override;
+
+private:
+	std::shared_ptr<GamesDBPlatformGames> mGames;
+	std::string mPlatform;
+	std::string mName;
+	std::string mNormalizedName; // normalizeGameName(mName), what the list is keyed on
+	bool mBulk;
+	std::unique_ptr<TheGamesDBRequest> mRequest; // details of the match, or the fallback search
+};
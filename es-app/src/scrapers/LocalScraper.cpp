@@ -0,0 +1,277 @@
+#include "scrapers/LocalScraper.h"
+#include "Log.h"
+#include "Util.h"
+#include "platform.h"
+#include "Hash.h"
+#include "pugixml/pugixml.hpp"
+#include <boost/filesystem.hpp>
+#include <unordered_map>
+#include <mutex>
+#include <string.h>
+#include <stdio.h>
+#include <algorithm>
+
+namespace fs = boost::filesystem;
+
+// Everything from one dump, with every game reachable by its normalized ROM and title names.
+struct LocalScraperDB
+{
+	LocalScraperDB() : pool(std::make_shared<MetaDataStringPool>()) {}
+
+	std::time_t modified;
+	std::shared_ptr<MetaDataStringPool> pool; // keeps the dump's strings out of the default pool
+	std::vector<ScraperSearchResult> games;
+	std::vector<std::string> titles; // normalized, same order as games, for the substring fallback
+	std::unordered_map< std::string, std::vector<unsigned int> > index;
+	std::unordered_map< std::string, unsigned int > hashIndex; // "crc:", "md5:" or "sha1:" + lower case hex, from DATs
+};
+
+static void addKey(LocalScraperDB& db, const std::string& name, unsigned int game)
+{
+	const std::string key = normalizeGameName(name);
+	if(key.empty())
+		return;
+
+	std::vector<unsigned int>& games = db.index[key];
+	if(games.empty() || games.back() != game)
+		games.push_back(game);
+}
+
+static void loadDat(LocalScraperDB& db, const pugi::xml_node& root)
+{
+	// older DATs use <game>, newer MAME ones <machine>
+	for(pugi::xml_node game = root.first_child(); game; game = game.next_sibling())
+	{
+		if(strcmp(game.name(), "game") != 0 && strcmp(game.name(), "machine") != 0)
+			continue;
+
+		ScraperSearchResult result;
+		result.mdl = MetaDataList(GAME_METADATA, db.pool);
+
+		const std::string name = game.attribute("name").as_string();
+		const std::string title = game.child("description") ? game.child("description").text().get() : name;
+		result.mdl.set(MetaDataIds::NAME, title);
+
+		if(game.child("year"))
+			result.mdl.setTime("releasedate", string_to_ptime(game.child("year").text().get(), "%Y"));
+		if(game.child("manufacturer"))
+			result.mdl.set(MetaDataIds::DEVELOPER, game.child("manufacturer").text().get());
+
+		const unsigned int i = db.games.size();
+		db.games.push_back(result);
+		db.titles.push_back(normalizeGameName(title));
+
+		addKey(db, name, i);
+		addKey(db, title, i);
+		for(pugi::xml_node rom = game.child("rom"); rom; rom = rom.next_sibling("rom"))
+		{
+			addKey(db, fs::path(rom.attribute("name").as_string()).stem().string(), i);
+
+			static const char* hashTypes[] = { "crc", "md5", "sha1" };
+			for(int h = 0; h < 3; h++)
+			{
+				std::string value = rom.attribute(hashTypes[h]).as_string();
+				if(value.empty())
+					continue;
+				std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+				db.hashIndex.insert(std::make_pair(std::string(hashTypes[h]) + ":" + value, i));
+			}
+		}
+	}
+}
+
+static void loadGameList(LocalScraperDB& db, const pugi::xml_node& root, const fs::path& relativeTo)
+{
+	for(pugi::xml_node game = root.child("game"); game; game = game.next_sibling("game"))
+	{
+		ScraperSearchResult result;
+		result.mdl = MetaDataList::createFromXML(GAME_METADATA, game, relativeTo, db.pool);
+
+		// images can be either files next to the dump or URLs that still have to be downloaded
+		const std::string image = game.child("image").text().get();
+		if(HttpReq::isUrl(image))
+		{
+			result.imageUrl = image;
+			result.mdl.set(MetaDataIds::IMAGE, "");
+		}
+		const std::string thumbnail = game.child("thumbnail").text().get();
+		if(HttpReq::isUrl(thumbnail))
+		{
+			result.thumbnailUrl = thumbnail;
+			result.mdl.set(MetaDataIds::THUMBNAIL, "");
+		}
+
+		const std::string& title = result.mdl.get(MetaDataIds::NAME);
+
+		const unsigned int i = db.games.size();
+		db.games.push_back(result);
+		db.titles.push_back(normalizeGameName(title));
+
+		addKey(db, fs::path(game.child("path").text().get()).stem().string(), i);
+		addKey(db, title, i);
+	}
+}
+
+// NULL if the system has no dump (or it couldn't be read)
+static std::shared_ptr<LocalScraperDB> getDB(const SystemData* system)
+{
+	static std::mutex mutex;
+	static std::map< std::string, std::shared_ptr<LocalScraperDB> > dbs;
+
+	const std::string base = getHomePath() + "/.emulationstation/scraperdb/" + system->getName();
+	fs::path path = base + ".xml";
+	if(!fs::exists(path))
+		path = base + ".dat";
+	if(!fs::exists(path))
+		return NULL;
+
+	boost::system::error_code ec;
+	const std::time_t modified = fs::last_write_time(path, ec);
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	std::shared_ptr<LocalScraperDB>& db = dbs[path.generic_string()];
+	if(db && db->modified == modified)
+		return db;
+
+	db.reset();
+
+	pugi::xml_document doc;
+	pugi::xml_parse_result result = doc.load_file(path.c_str());
+	if(!result)
+	{
+		LOG(LogError) << "Error parsing scraper database \"" << path.generic_string() << "\": " << result.description();
+		return NULL;
+	}
+
+	const unsigned int start = SDL_GetTicks();
+
+	std::shared_ptr<LocalScraperDB> loaded = std::make_shared<LocalScraperDB>();
+	loaded->modified = modified;
+	if(doc.child("datafile"))
+		loadDat(*loaded, doc.child("datafile"));
+	else if(doc.child("gameList"))
+		loadGameList(*loaded, doc.child("gameList"), path.parent_path());
+	else
+	{
+		LOG(LogError) << "Scraper database \"" << path.generic_string() << "\" is neither a DAT (<datafile>) nor a gamelist (<gameList>)";
+		return NULL;
+	}
+
+	LOG(LogInfo) << "Indexed " << loaded->games.size() << " games from \"" << path.generic_string() << "\" in " << (SDL_GetTicks() - start) << "ms";
+
+	db = loaded;
+	return db;
+}
+
+void local_generate_scraper_requests(const ScraperSearchParams& params, std::queue< std::unique_ptr<ScraperRequest> >& requests,
+	std::vector<ScraperSearchResult>& results)
+{
+	requests.push(std::unique_ptr<ScraperRequest>(new LocalScraperRequest(results, params)));
+}
+
+LocalScraperRequest::LocalScraperRequest(std::vector<ScraperSearchResult>& resultsWrite, const ScraperSearchParams& params) 
+	: ScraperRequest(resultsWrite), mParams(params)
+{
+}
+
+void LocalScraperRequest::update()
+{
+	if(mStatus != ASYNC_IN_PROGRESS)
+		return;
+
+	std::shared_ptr<LocalScraperDB> db = getDB(mParams.system);
+	if(!db)
+	{
+		setError("No scraper database for " + mParams.system->getName() + " in ~/.emulationstation/scraperdb/");
+		return;
+	}
+
+	// an exact match on the ROM's file name is as good as a CRC, try that first unless the user typed a name
+	std::vector<std::string> keys;
+	if(mParams.nameOverride.empty())
+	{
+		keys.push_back(normalizeGameName(mParams.game->getPath().stem().string()));
+		keys.push_back(mParams.game->getNormalizedName());
+	}else{
+		keys.push_back(normalizeGameName(mParams.nameOverride));
+	}
+
+	std::vector<unsigned int> found;
+	bool hashMatch = false;
+
+	// a hash match beats any name
+	if(mParams.hashes.valid && mParams.nameOverride.empty() && !db->hashIndex.empty())
+	{
+		char crc[9];
+		snprintf(crc, sizeof(crc), "%08x", mParams.hashes.crc32);
+		const std::string hashKeys[] = { "sha1:" + hashToHex(mParams.hashes.sha1, 20), "md5:" + hashToHex(mParams.hashes.md5, 16), std::string("crc:") + crc };
+		for(int i = 0; i < 3 && found.empty(); i++)
+		{
+			auto it = db->hashIndex.find(hashKeys[i]);
+			if(it != db->hashIndex.end())
+				found.push_back(it->second);
+		}
+		hashMatch = !found.empty();
+	}
+
+	// the entries of an archive come with their CRCs, the game sharing the most of them wins (arcade sets are many ROMs)
+	if(found.empty() && mParams.nameOverride.empty() && !db->hashIndex.empty())
+	{
+		std::shared_ptr<const ArchiveContents> contents = mParams.game->getArchiveContents();
+		if(contents)
+		{
+			std::unordered_map<unsigned int, unsigned int> votes;
+			unsigned int best = 0;
+			unsigned int bestVotes = 0;
+			char crc[16];
+			for(auto entry = contents->begin(); entry != contents->end(); entry++)
+			{
+				snprintf(crc, sizeof(crc), "crc:%08x", entry->crc32);
+				auto it = db->hashIndex.find(crc);
+				if(it == db->hashIndex.end())
+					continue;
+
+				const unsigned int count = ++votes[it->second];
+				if(count > bestVotes)
+				{
+					best = it->second;
+					bestVotes = count;
+				}
+			}
+
+			if(bestVotes > 0)
+			{
+				found.push_back(best);
+				hashMatch = true;
+			}
+		}
+	}
+
+	for(auto key = keys.begin(); key != keys.end() && found.empty(); key++)
+	{
+		auto it = db->index.find(*key);
+		if(it != db->index.end())
+			found = it->second;
+	}
+
+	// fall back to titles containing what we're looking for
+	const std::string& search = keys.back();
+	for(unsigned int i = 0; found.empty() && !search.empty() && i < db->titles.size(); i++)
+	{
+		if(db->titles[i].find(search) != std::string::npos)
+		{
+			found.push_back(i);
+			if(found.size() >= MAX_SCRAPER_RESULTS)
+				break;
+		}
+	}
+
+	for(unsigned int i = 0; i < found.size() && mResults.size() < MAX_SCRAPER_RESULTS; i++)
+	{
+		mResults.push_back(db->games.at(found[i]));
+		mResults.back().hashMatch = hashMatch;
+	}
+
+	setStatus(ASYNC_DONE);
+}
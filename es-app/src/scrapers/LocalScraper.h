@@ -0,0 +1,20 @@
+#pragma once
+
+#include "scrapers/Scraper.h"
+
+// Offline scraper. Looks games up in a metadata dump at ~/.emulationstation/scraperdb/[system name].xml (or .dat),
+// which can be either a Logiqx/MAME style DAT (<datafile>) or an exported gamelist (<gameList>, any gamelist.xml fields).
+// The dump is indexed once per run (again if the file changes), after that lookups need no I/O at all.
+void local_generate_scraper_requests(const ScraperSearchParams& params, std::queue< std::unique_ptr<ScraperRequest> >& requests,
+	std::vector<ScraperSearchResult>& results);
+
+class LocalScraperRequest : public ScraperRequest
+{
+public:
+	LocalScraperRequest(std::vector<ScraperSearchResult>& resultsWrite, const ScraperSearchParams& params);
+
+	void update() override;
+
+private:
+	ScraperSearchParams mParams;
+};
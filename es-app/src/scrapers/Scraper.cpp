@@ -1,23 +1,44 @@
 #include "scrapers/Scraper.h"
 #include "Log.h"
 #include "Settings.h"
+#include "TaskScheduler.h"
+#include "Future.h"
 #include <FreeImage.h>
 #include <boost/filesystem.hpp>
 #include <boost/assign.hpp>
+#include <deque>
+#include <mutex>
+#include <fstream>
+#include <sstream>
+#include <string.h>
+#include "ImageIO.h"
+#include "Util.h"
+#include "resources/TextureResource.h"
 
 #include "GamesDBScraper.h"
+#include "LocalScraper.h"
 #include "TheArchiveScraper.h"
+#include "SharedScraperCache.h"
 
 const std::map<std::string, generate_scraper_requests_func> scraper_request_funcs = boost::assign::map_list_of
 	("TheGamesDB", &thegamesdb_generate_scraper_requests)
-	("TheArchive", &thearchive_generate_scraper_requests);
+	("TheArchive", &thearchive_generate_scraper_requests)
+	("Local", &local_generate_scraper_requests);
 
 std::unique_ptr<ScraperSearchHandle> startScraperSearch(const ScraperSearchParams& params)
 {
 	const std::string& name = Settings::getInstance()->getString("Scraper");
 
+	// hashes are free if they've been done before, otherwise this queues the game so they are next time
+	ScraperSearchParams withHashes = params;
+	if(!withHashes.hashes.valid && withHashes.game)
+		RomHasher::getInstance()->getHashes(withHashes.game->getPath(), withHashes.hashes);
+
 	std::unique_ptr<ScraperSearchHandle> handle(new ScraperSearchHandle());
-	scraper_request_funcs.at(name)(params, handle->mRequestQueue, handle->mResults);
+	if(SharedScraperCache::isEnabled() && name != "Local") // the local one is offline already
+		SharedScraperCache::generateRequests(scraper_request_funcs.at(name), withHashes, handle->mRequestQueue, handle->mResults);
+	else
+		scraper_request_funcs.at(name)(withHashes, handle->mRequestQueue, handle->mResults);
 	return handle;
 }
 
@@ -87,11 +108,11 @@ ScraperRequest::ScraperRequest(std::vector<ScraperSearchResult>& resultsWrite) :
 
 
 // ScraperHttpRequest
-ScraperHttpRequest::ScraperHttpRequest(std::vector<ScraperSearchResult>& resultsWrite, const std::string& url) 
+ScraperHttpRequest::ScraperHttpRequest(std::vector<ScraperSearchResult>& resultsWrite, const std::string& url, bool bulk) 
 	: ScraperRequest(resultsWrite)
 {
 	setStatus(ASYNC_IN_PROGRESS);
-	mReq = std::unique_ptr<HttpReq>(new HttpReq(url));
+	mReq = std::unique_ptr<HttpReq>(new HttpReq(url, HttpReq::CACHE_RESPONSE | (bulk ? HttpReq::BULK : 0)));
 }
 
 void ScraperHttpRequest::update()
@@ -126,7 +147,7 @@ MDResolveHandle::MDResolveHandle(const ScraperSearchResult& result, const Scrape
 	if(!result.imageUrl.empty())
 	{
 		std::string imgPath = getSaveAsPath(search, "image", result.imageUrl);
-		mFuncs.push_back(ResolvePair(downloadImageAsync(result.imageUrl, imgPath), [this, imgPath]
+		mFuncs.push_back(ResolvePair(downloadImageAsync(result.imageUrl, imgPath, search.bulk), [this, imgPath]
 		{
 			mResult.mdl.set("image", imgPath);
 			mResult.imageUrl = "";
@@ -159,55 +180,211 @@ void MDResolveHandle::update()
 		setStatus(ASYNC_DONE);
 }
 
-std::unique_ptr<ImageDownloadHandle> downloadImageAsync(const std::string& url, const std::string& saveAs)
-{
-	return std::unique_ptr<ImageDownloadHandle>(new ImageDownloadHandle(url, saveAs, 
-		Settings::getInstance()->getInt("ScraperResizeWidth"), Settings::getInstance()->getInt("ScraperResizeHeight")));
-}
-
-ImageDownloadHandle::ImageDownloadHandle(const std::string& url, const std::string& path, int maxWidth, int maxHeight) : 
-	mSavePath(path), mMaxWidth(maxWidth), mMaxHeight(maxHeight), mReq(new HttpReq(url))
+// a downloaded image waiting to be (or being) resized by the ImageResizePool
+struct ImageResizeJob
 {
-}
-
-void ImageDownloadHandle::update()
+	ImageResizeJob(const std::string& d, const std::string& p, int w, int h) : data(d), path(p), maxWidth(w), maxHeight(h) {}
+
+	std::string data; // the downloaded file, it's only written to path once it's resized
+	std::string path;
+	int maxWidth;
+	int maxHeight;
+	Promise<bool> result;
+};
+
+// Decoding, scaling and re-encoding full-size box art takes hundreds of ms on ARM, so it doesn't happen on the main thread.
+// Only a few are on the TaskScheduler at a time, so a bulk scrape can't fill it up and hold up everything else.
+class ImageResizePool
 {
-	if(mReq->status() == HttpReq::REQ_IN_PROGRESS)
-		return;
-
-	if(mReq->status() != HttpReq::REQ_SUCCESS)
+public:
+	static ImageResizePool* getInstance()
 	{
-		std::stringstream ss;
-		ss << "Network error: " << mReq->getErrorMsg();
-		setError(ss.str());
-		return;
+		static ImageResizePool pool;
+		return &pool;
 	}
 
-	// download is done, save it to disk
-	std::ofstream stream(mSavePath, std::ios_base::out | std::ios_base::binary);
-	if(stream.bad())
+	// fails if the image couldn't be decoded or written
+	Future<bool> resize(const std::string& data, const std::string& path, int maxWidth, int maxHeight)
 	{
-		setError("Failed to open image path to write. Permission error? Disk full?");
-		return;
+		std::shared_ptr<ImageResizeJob> job = std::make_shared<ImageResizeJob>(data, path, maxWidth, maxHeight);
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if(mRunning >= MAX_RUNNING)
+			{
+				mWaiting.push_back(job);
+				return job->result.getFuture();
+			}
+			mRunning++;
+		}
+
+		start(job);
+		return job->result.getFuture();
 	}
 
-	const std::string& content = mReq->getContent();
-	stream.write(content.data(), content.length());
-	stream.close();
-	if(stream.bad())
+private:
+	static const unsigned int MAX_RUNNING = 4;
+
+	ImageResizePool() : mRunning(0) {}
+
+	void start(const std::shared_ptr<ImageResizeJob>& job)
 	{
-		setError("Failed to save image. Disk full?");
-		return;
+		TaskScheduler::getInstance()->submit([this, job] {
+			if(resizeImageData(job->data, job->path, job->maxWidth, job->maxHeight))
+				job->result.setValue(true);
+			else
+				job->result.setError("Error saving resized image. Out of memory? Disk full?");
+			job->data.clear();
+			job->data.shrink_to_fit();
+
+			// the next one takes our place
+			std::shared_ptr<ImageResizeJob> next;
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				if(mWaiting.empty())
+				{
+					mRunning--;
+				}else{
+					next = mWaiting.front();
+					mWaiting.pop_front();
+				}
+			}
+			if(next)
+				start(next);
+		}, TaskScheduler::PRIORITY_BACKGROUND);
 	}
 
-	// resize it
-	if(!resizeImage(mSavePath, mMaxWidth, mMaxHeight))
-	{
-		setError("Error saving resized image. Out of memory? Disk full?");
+	std::mutex mMutex;
+	std::deque< std::shared_ptr<ImageResizeJob> > mWaiting;
+	unsigned int mRunning;
+};
+
+// an image that gets resized is kept in memory until then, so only the resized one is ever written
+static Future< std::shared_ptr<HttpReq> > fetchImage(const std::string& url, const std::string& savePath, bool resize, bool bulk)
+{
+	const unsigned int flags = bulk ? HttpReq::BULK : 0;
+	if(resize)
+		return HttpReq::fetch(url, flags);
+	return HttpReq::fetch(url, savePath + ".part", flags);
+}
+
+// downloads url from its site, and puts it in the shared cache if there is one
+static Future<bool> downloadFromSite(const std::string& url, const std::string& savePath, int maxWidth, int maxHeight, bool bulk, 
+	const CancellationToken& token)
+{
+	const bool resize = (maxWidth != 0 || maxHeight != 0);
+
+	Promise<bool> result;
+	fetchImage(url, savePath, resize, bulk).onReady([url, savePath, maxWidth, maxHeight, resize, token, result](const Future< std::shared_ptr<HttpReq> >& req) {
+		// failed or given up on, both leave a partial file behind
+		if(req.failed() || token.isCancelled())
+		{
+			boost::system::error_code ec;
+			boost::filesystem::remove(savePath + ".part", ec);
+			result.setError("Network error: " + req.getError());
+			return;
+		}
+
+		const bool storeShared = SharedScraperCache::isEnabled() && HttpReq::isUrl(url);
+		if(!resize)
+		{
+			// the download went straight to disk, move it in place of the old image
+			boost::system::error_code ec;
+			boost::filesystem::rename(savePath + ".part", savePath, ec);
+			if(ec)
+			{
+				boost::filesystem::remove(savePath + ".part", ec);
+				result.setError("Failed to save image. Permission error? Disk full?");
+				return;
+			}
+
+			if(storeShared)
+				SharedScraperCache::storeImageFile(url, savePath);
+			result.setValue(true);
+			return;
+		}
+
+		if(storeShared)
+			SharedScraperCache::storeImage(url, req.get()->getContent());
+		result.setFrom(ImageResizePool::getInstance()->resize(req.get()->getContent(), savePath, maxWidth, maxHeight));
+	});
+	return result.getFuture();
+}
+
+// writes an image we already have the contents of, resized if asked to, off the main thread
+static Future<bool> saveImageData(const std::string& data, const std::string& savePath, int maxWidth, int maxHeight)
+{
+	if(maxWidth != 0 || maxHeight != 0)
+		return ImageResizePool::getInstance()->resize(data, savePath, maxWidth, maxHeight);
+
+	return runAsync([data, savePath] {
+		const std::string partPath = savePath + ".part";
+		bool ok;
+		{
+			std::ofstream file(partPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+			ok = file.is_open() && file.write(data.data(), data.size());
+		}
+
+		boost::system::error_code ec;
+		if(ok)
+			boost::filesystem::rename(partPath, savePath, ec);
+		if(!ok || ec)
+			boost::filesystem::remove(partPath, ec);
+		return ok && !ec;
+	}).then([](const bool& ok) {
+		return ok ? makeReadyFuture(true) : makeFailedFuture<bool>("Failed to save image. Permission error? Disk full?");
+	});
+}
+
+Future<bool> downloadImage(const std::string& url, const std::string& savePath, int maxWidth, int maxHeight, bool bulk, 
+	const CancellationToken& token)
+{
+	if(!SharedScraperCache::isEnabled() || !HttpReq::isUrl(url))
+		return downloadFromSite(url, savePath, maxWidth, maxHeight, bulk, token);
+
+	// the shared cache's copy is read on an AsyncIO thread (it may be on a mount that doesn't answer), not through curl
+	Promise<bool> result;
+	SharedScraperCache::loadImage(url).onReady([url, savePath, maxWidth, maxHeight, bulk, token, result](const Future<std::string>& cached) {
+		if(token.isCancelled())
+		{
+			result.setError("cancelled");
+			return;
+		}
+
+		// not in the shared cache yet, download it and put it there
+		if(cached.failed())
+			result.setFrom(downloadFromSite(url, savePath, maxWidth, maxHeight, bulk, token));
+		else
+			result.setFrom(saveImageData(cached.get(), savePath, maxWidth, maxHeight));
+	});
+	return result.getFuture();
+}
+
+std::unique_ptr<ImageDownloadHandle> downloadImageAsync(const std::string& url, const std::string& saveAs, bool bulk)
+{
+	return std::unique_ptr<ImageDownloadHandle>(new ImageDownloadHandle(url, saveAs, 
+		Settings::getInstance()->getInt("ScraperResizeWidth"), Settings::getInstance()->getInt("ScraperResizeHeight"), bulk));
+}
+
+ImageDownloadHandle::ImageDownloadHandle(const std::string& url, const std::string& path, int maxWidth, int maxHeight, bool bulk)
+{
+	mResult = downloadImage(url, path, maxWidth, maxHeight, bulk, mCancel);
+}
+
+ImageDownloadHandle::~ImageDownloadHandle()
+{
+	// the download finishes on its own, then only cleans up after itself
+	mCancel.cancel();
+}
+
+void ImageDownloadHandle::update()
+{
+	if(mStatus != ASYNC_IN_PROGRESS || !mResult.isReady())
 		return;
-	}
 
-	setStatus(ASYNC_DONE);
+	if(mResult.failed())
+		setError(mResult.getError());
+	else
+		setStatus(ASYNC_DONE);
 }
 
 //you can pass 0 for width or height to keep aspect ratio
@@ -217,27 +394,47 @@ bool resizeImage(const std::string& path, int maxWidth, int maxHeight)
 	if(maxWidth == 0 && maxHeight == 0)
 		return true;
 
-	FREE_IMAGE_FORMAT format = FIF_UNKNOWN;
-	FIBITMAP* image = NULL;
-	
+	std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+	std::stringstream data;
+	data << file.rdbuf();
+	if(!file.is_open() || data.str().empty())
+	{
+		LOG(LogError) << "Error - could not read image \"" << path << "\"!";
+		return false;
+	}
+
+	return resizeImageData(data.str(), path, maxWidth, maxHeight);
+}
+
+bool resizeImageData(const std::string& data, const std::string& path, int maxWidth, int maxHeight)
+{
+	FIMEMORY* memory = FreeImage_OpenMemory((BYTE*)data.data(), data.size());
+	if(!memory)
+		return false;
+
 	//detect the filetype
-	format = FreeImage_GetFileType(path.c_str(), 0);
+	FREE_IMAGE_FORMAT format = FreeImage_GetFileTypeFromMemory(memory, 0);
 	if(format == FIF_UNKNOWN)
 		format = FreeImage_GetFIFFromFilename(path.c_str());
 	if(format == FIF_UNKNOWN)
 	{
 		LOG(LogError) << "Error - could not detect filetype for image \"" << path << "\"!";
+		FreeImage_CloseMemory(memory);
 		return false;
 	}
 
 	//make sure we can read this filetype first, then load it
+	FIBITMAP* image = NULL;
 	if(FreeImage_FIFSupportsReading(format))
 	{
-		image = FreeImage_Load(format, path.c_str());
+		image = FreeImage_LoadFromMemory(format, memory);
 	}else{
 		LOG(LogError) << "Error - file format reading not supported for image \"" << path << "\"!";
-		return false;
 	}
+	FreeImage_CloseMemory(memory);
+
+	if(image == NULL)
+		return false;
 
 	float width = (float)FreeImage_GetWidth(image);
 	float height = (float)FreeImage_GetHeight(image);
@@ -259,13 +456,42 @@ bool resizeImage(const std::string& path, int maxWidth, int maxHeight)
 		return false;
 	}
 
-	bool saved = FreeImage_Save(format, imageRescaled, path.c_str());
-	FreeImage_Unload(imageRescaled);
+	// written next to it and renamed over it, so a game never points at half an image
+	const std::string tmpPath = path + ".part";
+	bool saved = FreeImage_Save(format, imageRescaled, tmpPath.c_str());
+	if(saved)
+	{
+		boost::system::error_code ec;
+		boost::filesystem::rename(tmpPath, path, ec);
+		saved = !ec;
+	}
 
 	if(!saved)
+	{
 		LOG(LogError) << "Failed to save resized image!";
+		boost::system::error_code ec;
+		boost::filesystem::remove(tmpPath, ec);
+		FreeImage_Unload(imageRescaled);
+		return false;
+	}
+
+	// the gamelist would otherwise read the file back just to make the preview it shows while the image loads
+	FIBITMAP* image32 = FreeImage_ConvertTo32Bits(imageRescaled);
+	FreeImage_Unload(imageRescaled);
+	if(image32)
+	{
+		const size_t previewWidth = FreeImage_GetWidth(image32);
+		const size_t previewHeight = FreeImage_GetHeight(image32);
+		std::vector<unsigned char> pixels(previewWidth * previewHeight * 4);
+		for(size_t y = 0; y < previewHeight; y++)
+			memcpy(pixels.data() + y * previewWidth * 4, FreeImage_GetScanLine(image32, y), previewWidth * 4);
+		FreeImage_Unload(image32);
+
+		ImageIO::swapRedBlue(pixels.data(), previewWidth * previewHeight);
+		TextureResource::savePreview(getCanonicalPath(path), pixels, previewWidth, previewHeight);
+	}
 
-	return saved;
+	return true;
 }
 
 std::string getSaveAsPath(const ScraperSearchParams& params, const std::string& suffix, const std::string& url)
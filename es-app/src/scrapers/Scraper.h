@@ -4,6 +4,8 @@
 #include "SystemData.h"
 #include "HttpReq.h"
 #include "AsyncHandle.h"
+#include "Future.h"
+#include "RomHasher.h"
 #include <vector>
 #include <functional>
 #include <queue>
@@ -12,17 +14,22 @@
 
 struct ScraperSearchParams
 {
+	ScraperSearchParams() : system(NULL), game(NULL), bulk(false) {};
+
 	SystemData* system;
 	FileData* game;
 
 	std::string nameOverride;
+	RomHashes hashes; // startScraperSearch() fills these in if RomHasher already knows them
+	bool bulk; // part of a batch scrape, its requests wait behind interactive ones (HttpReq::BULK)
 };
 
 struct ScraperSearchResult
 {
-	ScraperSearchResult() : mdl(GAME_METADATA) {};
+	ScraperSearchResult() : mdl(GAME_METADATA), hashMatch(false) {};
 
 	MetaDataList mdl;
+	bool hashMatch; // found by the ROM's hash, not its name
 	std::string imageUrl;
 	std::string thumbnailUrl;
 };
@@ -53,6 +60,9 @@ struct ScraperSearchResult
 // ScraperRequest - encapsulates some sort of asynchronous request that will ultimately return some results
 // ScraperHttpRequest - implementation of ScraperRequest that waits on an HttpReq, then processes it with some processing function.
 
+// Since then there's Future (Future.h), which chains steps without anything being polled (see downloadImage()).
+// New code should use that, the handles above stay for what still polls them.
+
 
 // a scraper search gathers results from (potentially multiple) ScraperRequests
 class ScraperRequest : public AsyncHandle
@@ -72,7 +82,7 @@ protected:
 class ScraperHttpRequest : public ScraperRequest
 {
 public:
-	ScraperHttpRequest(std::vector<ScraperSearchResult>& resultsWrite, const std::string& url);
+	ScraperHttpRequest(std::vector<ScraperSearchResult>& resultsWrite, const std::string& url, bool bulk = false);
 	virtual void update() override;
 
 protected:
@@ -126,18 +136,25 @@ private:
 	std::vector<ResolvePair> mFuncs;
 };
 
+// Downloads url to path, resized to fit maxWidth x maxHeight if either is set (0 keeps the aspect ratio), from the
+// SharedScraperCache if it's there. Fails with what went wrong. Cancelling token only stops it from being written.
+Future<bool> downloadImage(const std::string& url, const std::string& path, int maxWidth, int maxHeight, bool bulk = false,
+	const CancellationToken& token = CancellationToken());
+
+// downloadImage() for whoever polls AsyncHandles
 class ImageDownloadHandle : public AsyncHandle
 {
 public:
-	ImageDownloadHandle(const std::string& url, const std::string& path, int maxWidth, int maxHeight);
+	ImageDownloadHandle(const std::string& url, const std::string& path, int maxWidth, int maxHeight, bool bulk = false);
+	~ImageDownloadHandle();
 
-	void update() override;
+	void update() override; // only looks at the result, the work happens elsewhere
+
+	inline const Future<bool>& getFuture() const { return mResult; }
 
 private:
-	std::unique_ptr<HttpReq> mReq;
-	std::string mSavePath;
-	int mMaxWidth;
-	int mMaxHeight;
+	Future<bool> mResult;
+	CancellationToken mCancel;
 };
 
 //About the same as "~/.emulationstation/downloaded_images/[system_name]/[game_name].[url's extension]".
@@ -145,7 +162,7 @@ private:
 std::string getSaveAsPath(const ScraperSearchParams& params, const std::string& suffix, const std::string& url);
 
 //Will resize according to Settings::getInt("ScraperResizeWidth") and Settings::getInt("ScraperResizeHeight").
-std::unique_ptr<ImageDownloadHandle> downloadImageAsync(const std::string& url, const std::string& saveAs);
+std::unique_ptr<ImageDownloadHandle> downloadImageAsync(const std::string& url, const std::string& saveAs, bool bulk = false);
 
 // Resolves all metadata assets that need to be downloaded.
 std::unique_ptr<MDResolveHandle> resolveMetaDataAssets(const ScraperSearchResult& result, const ScraperSearchParams& search);
@@ -154,3 +171,7 @@ std::unique_ptr<MDResolveHandle> resolveMetaDataAssets(const ScraperSearchResult
 //Will overwrite the image at [path] with the new resized one.
 //Returns true if successful, false otherwise.
 bool resizeImage(const std::string& path, int maxWidth, int maxHeight);
+
+//As above, from the image file's contents in data (e.g. straight from the HttpReq), written to [path] only once it's resized.
+//Also leaves the preview the gamelist shows while it loads the image in the ThumbnailCache.
+bool resizeImageData(const std::string& data, const std::string& path, int maxWidth, int maxHeight);
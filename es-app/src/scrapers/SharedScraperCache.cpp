@@ -0,0 +1,286 @@
+#include "scrapers/SharedScraperCache.h"
+#include "Log.h"
+#include "Settings.h"
+#include "Util.h"
+#include "Hash.h"
+#include "AsyncIO.h"
+#include "PlatformId.h"
+#include "pugixml/pugixml.hpp"
+#include <boost/filesystem.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <fstream>
+#include <sstream>
+#include <SDL.h>
+
+namespace fs = boost::filesystem;
+
+#define LOOKUP_TIMEOUT 5000 // ms a lookup gets before the directory is taken to be unreachable and it's a miss
+
+// written next to the file under a name no other machine will pick, then renamed over it, so readers never see half of it
+static bool writeShared(const fs::path& path, const std::string* data, const fs::path* copyFrom)
+{
+	boost::system::error_code ec;
+	fs::create_directories(path.parent_path(), ec);
+
+	const fs::path tmpPath = path.parent_path() / fs::unique_path(path.filename().string() + ".%%%%-%%%%-%%%%.tmp", ec);
+	if(ec)
+		return false;
+
+	bool ok;
+	if(copyFrom)
+	{
+		fs::copy_file(*copyFrom, tmpPath, fs::copy_option::overwrite_if_exists, ec);
+		ok = !ec;
+	}else{
+		std::ofstream file(tmpPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		ok = file.is_open() && file.write(data->data(), data->size());
+	}
+
+	if(ok)
+	{
+		fs::rename(tmpPath, path, ec);
+		ok = !ec;
+	}
+
+	if(!ok)
+	{
+		LOG(LogWarning) << "Could not write \"" << path.generic_string() << "\" to the shared scraper cache";
+		fs::remove(tmpPath, ec);
+	}
+	return ok;
+}
+
+static std::string getCacheDir()
+{
+	return Settings::getInstance()->getString("ScraperSharedCache");
+}
+
+bool SharedScraperCache::isEnabled()
+{
+	return !getCacheDir().empty();
+}
+
+void SharedScraperCache::generateRequests(generate_scraper_requests_func generate, const ScraperSearchParams& params,
+	std::queue< std::unique_ptr<ScraperRequest> >& requests, std::vector<ScraperSearchResult>& results)
+{
+	requests.push(std::unique_ptr<ScraperRequest>(new SharedCacheRequest(results, generate, params)));
+}
+
+std::string SharedScraperCache::getImagePath(const std::string& url)
+{
+	// every machine has to come up with the same name, so not std::hash
+	uint8_t hash[20];
+	Sha1 sha1;
+	sha1.update(url.data(), url.size());
+	sha1.finish(hash);
+
+	const size_t slash = url.find_last_of('/');
+	const size_t dot = url.find_last_of('.');
+	std::string ext;
+	if(dot != std::string::npos && (slash == std::string::npos || dot > slash) && url.length() - dot <= 5)
+		ext = url.substr(dot);
+
+	return getCacheDir() + "/images/" + hashToHex(hash, 20) + ext;
+}
+
+Future<std::string> SharedScraperCache::loadImage(const std::string& url)
+{
+	const fs::path path = getImagePath(url);
+	const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(LOOKUP_TIMEOUT);
+	Promise<std::string> promise;
+
+	// AsyncIO::run() waits until the deadline at most, on a thread of its own so that's nobody else's time
+	std::thread([path, deadline, promise] {
+		std::shared_ptr<std::string> data = std::make_shared<std::string>();
+		const bool answered = AsyncIO::getInstance()->run([path, data] {
+			std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+			if(!file.is_open())
+				return;
+
+			std::stringstream ss;
+			ss << file.rdbuf();
+			*data = ss.str();
+		}, deadline);
+
+		if(!answered)
+		{
+			LOG(LogWarning) << "Shared scraper cache \"" << getCacheDir() << "\" isn't answering, downloading the image instead";
+			promise.setError("shared scraper cache timed out");
+		}else if(data->empty())
+		{
+			promise.setError("not in the shared scraper cache");
+		}else{
+			promise.setValue(*data);
+		}
+	}).detach();
+
+	return promise.getFuture();
+}
+
+void SharedScraperCache::storeImage(const std::string& url, const std::string& data)
+{
+	const fs::path path = getImagePath(url);
+	std::shared_ptr<std::string> copy = std::make_shared<std::string>(data);
+	AsyncIO::getInstance()->post([path, copy] { writeShared(path, copy.get(), NULL); });
+}
+
+void SharedScraperCache::storeImageFile(const std::string& url, const std::string& file)
+{
+	const fs::path path = getImagePath(url);
+	const fs::path from = file;
+	AsyncIO::getInstance()->post([path, from] { writeShared(path, NULL, &from); });
+}
+
+// SharedCacheRequest
+struct SharedCacheRequest::Lookup
+{
+	Lookup() : found(-1), done(false) {}
+
+	int found; // index of the key that was there, -1 for none (written before done)
+	std::string data;
+	std::atomic<bool> done;
+};
+
+SharedCacheRequest::SharedCacheRequest(std::vector<ScraperSearchResult>& resultsWrite, generate_scraper_requests_func generate,
+	const ScraperSearchParams& params) : ScraperRequest(resultsWrite), mGenerate(generate), mParams(params)
+{
+	std::string dir = getCacheDir() + "/" + Settings::getInstance()->getString("Scraper") + "/";
+	if(!mParams.system->getPlatformIds().empty())
+		dir += PlatformIds::getPlatformName(mParams.system->getPlatformIds().front());
+	else
+		dir += mParams.system->getName();
+
+	// a name typed in is looked up by that name only
+	if(mParams.hashes.valid && mParams.nameOverride.empty())
+		mKeys.push_back(dir + "/sha1-" + hashToHex(mParams.hashes.sha1, 20) + ".xml");
+
+	const std::string name = mParams.nameOverride.empty() ? mParams.game->getNormalizedName() : normalizeGameName(mParams.nameOverride);
+	if(!name.empty())
+		mKeys.push_back(dir + "/name-" + name + ".xml");
+
+	// the lookup may outlive us, so it keeps its own copies
+	mLookup = std::make_shared<Lookup>();
+	mLookupStart = SDL_GetTicks();
+
+	std::shared_ptr<Lookup> lookup = mLookup;
+	const std::vector<std::string> keys = mKeys;
+	AsyncIO::getInstance()->post([lookup, keys] {
+		for(unsigned int i = 0; i < keys.size(); i++)
+		{
+			std::ifstream file(keys[i].c_str(), std::ios::in | std::ios::binary);
+			if(!file.is_open())
+				continue;
+
+			std::stringstream data;
+			data << file.rdbuf();
+			if(data.str().empty())
+				continue;
+
+			lookup->data = data.str();
+			lookup->found = i;
+			break;
+		}
+
+		lookup->done = true;
+
+		// wake up the main loop in case it's waiting for events while idle
+		SDL_Event wake;
+		SDL_zero(wake);
+		wake.type = SDL_USEREVENT;
+		SDL_PushEvent(&wake);
+	});
+}
+
+void SharedCacheRequest::update()
+{
+	if(mStatus != ASYNC_IN_PROGRESS)
+		return;
+
+	if(mLookup)
+	{
+		if(!mLookup->done)
+		{
+			if(SDL_GetTicks() - mLookupStart < LOOKUP_TIMEOUT)
+				return;
+
+			LOG(LogWarning) << "Shared scraper cache \"" << getCacheDir() << "\" isn't answering, asking the scraper instead";
+		}else if(mLookup->found >= 0)
+		{
+			pugi::xml_document doc;
+			if(doc.load_buffer(mLookup->data.data(), mLookup->data.size()))
+			{
+				// a hash match for another machine's ROM of the same name isn't one for ours
+				const bool byHash = (mParams.hashes.valid && mParams.nameOverride.empty() && mLookup->found == 0);
+				for(pugi::xml_node node = doc.child("scraperCache").child("result"); node; node = node.next_sibling("result"))
+				{
+					ScraperSearchResult result;
+					result.mdl = MetaDataList::createFromXML(GAME_METADATA, node.child("game"), fs::path());
+					result.hashMatch = byHash && node.attribute("hashMatch").as_bool();
+					result.imageUrl = node.attribute("imageUrl").as_string();
+					result.thumbnailUrl = node.attribute("thumbnailUrl").as_string();
+					mResults.push_back(result);
+				}
+			}
+
+			if(!mResults.empty())
+			{
+				LOG(LogDebug) << "Shared scraper cache hit for \"" << mParams.game->getPath().string() << "\"";
+				mLookup.reset();
+				setStatus(ASYNC_DONE);
+				return;
+			}
+		}
+
+		mLookup.reset();
+		mGenerate(mParams, mMissRequests, mResults);
+	}
+
+	while(!mMissRequests.empty())
+	{
+		const AsyncHandleStatus status = mMissRequests.front()->status();
+		if(status == ASYNC_IN_PROGRESS)
+			return;
+
+		if(status == ASYNC_ERROR)
+		{
+			setError(mMissRequests.front()->getStatusString());
+			return;
+		}
+
+		mMissRequests.pop();
+	}
+
+	// nothing found could just as well be the site being down, so only real results are shared
+	if(!mResults.empty())
+		store();
+
+	setStatus(ASYNC_DONE);
+}
+
+void SharedCacheRequest::store()
+{
+	pugi::xml_document doc;
+	pugi::xml_node root = doc.append_child("scraperCache");
+	for(auto it = mResults.begin(); it != mResults.end(); it++)
+	{
+		pugi::xml_node node = root.append_child("result");
+		node.append_attribute("hashMatch").set_value(it->hashMatch);
+		if(!it->imageUrl.empty())
+			node.append_attribute("imageUrl").set_value(it->imageUrl.c_str());
+		if(!it->thumbnailUrl.empty())
+			node.append_attribute("thumbnailUrl").set_value(it->thumbnailUrl.c_str());
+		it->mdl.appendToXML(node.append_child("game"), true, fs::path());
+	}
+
+	std::stringstream ss;
+	doc.save(ss);
+	std::shared_ptr<std::string> data = std::make_shared<std::string>(ss.str());
+
+	const std::vector<std::string> keys = mKeys;
+	AsyncIO::getInstance()->post([keys, data] {
+		for(auto it = keys.begin(); it != keys.end(); it++)
+			writeShared(*it, data.get(), NULL);
+	});
+}
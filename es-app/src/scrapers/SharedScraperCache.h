@@ -0,0 +1,52 @@
+#pragma once
+
+#include "scrapers/Scraper.h"
+#include "Future.h"
+
+// Search results and images shared by every machine pointed at the same directory ("ScraperSharedCache", e.g. an NFS or
+// SMB mount), so a fleet of identical cabinets only asks the scraper's site about a game once. Results are kept by scraper,
+// platform and ROM hash or name, as [dir]/[scraper]/[platform]/sha1-[hex].xml and name-[normalized name].xml, images by
+// their URL in [dir]/images/. A miss goes to the scraper as usual and what it found is written back.
+// Everything that touches the directory runs on AsyncIO threads, so a hung mount holds up a search, never the UI.
+namespace SharedScraperCache
+{
+	bool isEnabled();
+
+	// Queues one request that looks in the cache, and only if nothing's there runs the requests generate would have queued
+	// (and writes their results back).
+	void generateRequests(generate_scraper_requests_func generate, const ScraperSearchParams& params,
+		std::queue< std::unique_ptr<ScraperRequest> >& requests, std::vector<ScraperSearchResult>& results);
+
+	// Where the image downloaded from url is kept, whether it's there yet or not.
+	std::string getImagePath(const std::string& url);
+
+	// The contents of the copy of the image downloaded from url, read on an AsyncIO thread. Fails if it isn't there,
+	// or if the directory doesn't answer in time; a read that's given up on can't touch anything of the caller's.
+	Future<std::string> loadImage(const std::string& url);
+
+	// Writes an image that had to be downloaded back, from its contents or from the (not resized) file it was saved to.
+	// Returns immediately.
+	void storeImage(const std::string& url, const std::string& data);
+	void storeImageFile(const std::string& url, const std::string& path);
+}
+
+class SharedCacheRequest : public ScraperRequest
+{
+public:
+	SharedCacheRequest(std::vector<ScraperSearchResult>& resultsWrite, generate_scraper_requests_func generate, const ScraperSearchParams& params);
+
+	void update() override;
+
+private:
+	struct Lookup;
+
+	void store();
+
+	generate_scraper_requests_func mGenerate;
+	ScraperSearchParams mParams;
+	std::vector<std::string> mKeys; // entry paths, the hash's (if known) first
+
+	std::shared_ptr<Lookup> mLookup; // NULL once it's done
+	unsigned int mLookupStart;
+	std::queue< std::unique_ptr<ScraperRequest> > mMissRequests; // the scraper's own, after a miss
+};
@@ -14,7 +14,7 @@ void thearchive_generate_scraper_requests(const ScraperSearchParams& params, std
 	path += HttpReq::urlEncode(cleanName);
 	//platform TODO, should use some params.system get method
 
-	requests.push(std::unique_ptr<ScraperRequest>(new TheArchiveRequest(results, path)));
+	requests.push(std::unique_ptr<ScraperRequest>(new TheArchiveRequest(results, path, params.bulk)));
 }
 
 void TheArchiveRequest::process(const std::unique_ptr<HttpReq>& req, std::vector<ScraperSearchResult>& results)
@@ -10,7 +10,8 @@ void thearchive_process_httpreq(const std::unique_ptr<HttpReq>& req, std::vector
 class TheArchiveRequest : public ScraperHttpRequest
 {
 public:
-	TheArchiveRequest(std::vector<ScraperSearchResult>& resultsWrite, const std::string& url) : ScraperHttpRequest(resultsWrite, url) {}
+	TheArchiveRequest(std::vector<ScraperSearchResult>& resultsWrite, const std::string& url, bool bulk = false) 
+		: ScraperHttpRequest(resultsWrite, url, bulk) {}
 protected:
 	void process(const std::unique_ptr<HttpReq>& req, std::vector<ScraperSearchResult>& results) override;
 };
\ No newline at end of file
@@ -8,23 +8,36 @@
 #include "SystemData.h"
 #include "Settings.h"
 #include "Util.h"
+#include "MusicStream.h"
 
 #define SELECTED_SCALE 1.5f
 #define LOGO_PADDING ((logoSize().x() * (SELECTED_SCALE - 1)/2) + (mSize.x() * 0.06f))
 #define BAND_HEIGHT (logoSize().y() * SELECTED_SCALE)
 
+// entries are kept this many positions past the ones that get built, so going back and forth doesn't rebuild them
+#define ENTRY_KEEP_MARGIN 3
+
+// the selected system's music only starts once the cursor stayed on it this long (ms), not while scrolling past
+#define MUSIC_DELAY 500
+
 SystemView::SystemView(Window* window) : IList<SystemViewData, SystemData*>(window, LIST_SCROLL_STYLE_SLOW, LIST_ALWAYS_LOOP),
-	mSystemInfo(window, "SYSTEM INFO", Font::get(FONT_SIZE_SMALL), 0x33333300, ALIGN_CENTER)
+	mSystemInfo(window, "SYSTEM INFO", Font::get(FONT_SIZE_SMALL), 0x33333300, ALIGN_CENTER),
+	mLoadingInfo(window, "", Font::get(FONT_SIZE_SMALL), 0x777777FF, ALIGN_RIGHT)
 {
+	setUpdating(true);
 	mCamOffset = 0;
 	mExtrasCamOffset = 0;
 	mExtrasFadeOpacity = 0.0f;
+	mMusicDelay = -1;
 
 	setSize((float)Renderer::getScreenWidth(), (float)Renderer::getScreenHeight());
 
 	mSystemInfo.setSize(mSize.x(), mSystemInfo.getSize().y() * 1.333f);
 	mSystemInfo.setPosition(0, (mSize.y() + BAND_HEIGHT) / 2);
 
+	mLoadingInfo.setSize(mSize.x() * 0.97f, 0);
+	mLoadingInfo.setPosition(0, mSize.y() * 0.02f);
+
 	populate();
 }
 
@@ -32,53 +45,151 @@ void SystemView::populate()
 {
 	mEntries.clear();
 
+	// the logos and backgrounds are only built once they get near the screen (see updateEntries)
 	for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end(); it++)
 	{
-		const std::shared_ptr<ThemeData>& theme = (*it)->getTheme();
+		Entry e;
+		e.name = (*it)->getName();
+		e.object = *it;
+		this->add(e);
+	}
 
+	updateEntries();
+}
+
+void SystemView::onSystemsChanged()
+{
+	if(isAnimationPlaying(0))
+		finishAnimation(0);
+
+	SystemData* selected = size() ? getSelected() : NULL;
+
+	std::vector<Entry> old;
+	old.swap(mEntries);
+	for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end(); it++)
+	{
 		Entry e;
 		e.name = (*it)->getName();
 		e.object = *it;
+		for(auto o = old.begin(); o != old.end(); o++)
+		{
+			if(o->object == *it)
+			{
+				e.data = o->data;
+				break;
+			}
+		}
+		this->add(e);
+	}
 
-		// make logo
-		if(theme->getElement("system", "logo", "image"))
+	// indices moved, move the camera along without scrolling (or restarting the music)
+	for(int i = 0; i < (int)mEntries.size(); i++)
+	{
+		if(mEntries.at(i).object == selected)
+			mCursor = i;
+	}
+	mCamOffset = (float)mCursor;
+	mExtrasCamOffset = (float)mCursor;
+
+	updateEntries();
+}
+
+void SystemView::onThemeChanged(SystemData* system, const ThemeData::ViewChanges& changes)
+{
+	// an entry only takes the logo's path and the extras from the theme (the help style is read each time the prompts
+	// are updated), and both are made from scratch here, so a removed logo or extra goes back to the default too
+	for(auto it = mEntries.begin(); it != mEntries.end(); it++)
+	{
+		// not built yet, it will be with the new theme
+		if(it->object != system || !it->data.logo)
+			continue;
+
+		if(changes.has("logo"))
 		{
-			ImageComponent* logo = new ImageComponent(mWindow);
-			logo->setMaxSize(Eigen::Vector2f(logoSize().x(), logoSize().y()));
-			logo->applyTheme((*it)->getTheme(), "system", "logo", ThemeFlags::PATH);
-			logo->setPosition((logoSize().x() - logo->getSize().x()) / 2, (logoSize().y() - logo->getSize().y()) / 2); // center
-			e.data.logo = std::shared_ptr<GuiComponent>(logo);
-
-			ImageComponent* logoSelected = new ImageComponent(mWindow);
-			logoSelected->setMaxSize(Eigen::Vector2f(logoSize().x() * SELECTED_SCALE, logoSize().y() * SELECTED_SCALE * 0.70f));
-			logoSelected->applyTheme((*it)->getTheme(), "system", "logo", ThemeFlags::PATH);
-			logoSelected->setPosition((logoSize().x() - logoSelected->getSize().x()) / 2, 
-				(logoSize().y() - logoSelected->getSize().y()) / 2); // center
-			e.data.logoSelected = std::shared_ptr<GuiComponent>(logoSelected);
-		}else{
-			// no logo in theme; use text
-			TextComponent* text = new TextComponent(mWindow, 
-				(*it)->getName(), 
-				Font::get(FONT_SIZE_LARGE), 
-				0x000000FF, 
-				ALIGN_CENTER);
-			text->setSize(logoSize());
-			e.data.logo = std::shared_ptr<GuiComponent>(text);
-
-			TextComponent* textSelected = new TextComponent(mWindow, 
-				(*it)->getName(), 
-				Font::get((int)(FONT_SIZE_LARGE * SELECTED_SCALE)), 
-				0x000000FF, 
-				ALIGN_CENTER);
-			textSelected->setSize(logoSize());
-			e.data.logoSelected = std::shared_ptr<GuiComponent>(textSelected);
+			// the rest comes back in the next getEntryData()
+			it->data = SystemViewData();
+		}else if(changes.extras)
+		{
+			it->data.backgroundExtras->setExtras(ThemeData::makeExtras(system->getTheme(), "system", mWindow));
 		}
+	}
+}
 
-		// make background extras
-		e.data.backgroundExtras = std::shared_ptr<ThemeExtras>(new ThemeExtras(mWindow));
-		e.data.backgroundExtras->setExtras(ThemeData::makeExtras((*it)->getTheme(), "system", mWindow));
+void SystemView::buildEntry(Entry& e)
+{
+	const std::shared_ptr<ThemeData>& theme = e.object->getTheme();
 
-		this->add(e);
+	// make logo
+	if(theme->getElement("system", "logo", "image"))
+	{
+		ImageComponent* logo = new ImageComponent(mWindow);
+		logo->setMaxSize(Eigen::Vector2f(logoSize().x(), logoSize().y()));
+		logo->applyTheme(theme, "system", "logo", ThemeFlags::PATH);
+		logo->setPosition((logoSize().x() - logo->getSize().x()) / 2, (logoSize().y() - logo->getSize().y()) / 2); // center
+		e.data.logo = std::shared_ptr<GuiComponent>(logo);
+
+		ImageComponent* logoSelected = new ImageComponent(mWindow);
+		logoSelected->setMaxSize(Eigen::Vector2f(logoSize().x() * SELECTED_SCALE, logoSize().y() * SELECTED_SCALE * 0.70f));
+		logoSelected->applyTheme(theme, "system", "logo", ThemeFlags::PATH);
+		logoSelected->setPosition((logoSize().x() - logoSelected->getSize().x()) / 2, 
+			(logoSize().y() - logoSelected->getSize().y()) / 2); // center
+		e.data.logoSelected = std::shared_ptr<GuiComponent>(logoSelected);
+	}else{
+		// no logo in theme; use text
+		TextComponent* text = new TextComponent(mWindow, 
+			e.object->getName(), 
+			Font::get(FONT_SIZE_LARGE), 
+			0x000000FF, 
+			ALIGN_CENTER);
+		text->setSize(logoSize());
+		e.data.logo = std::shared_ptr<GuiComponent>(text);
+
+		TextComponent* textSelected = new TextComponent(mWindow, 
+			e.object->getName(), 
+			Font::get((int)(FONT_SIZE_LARGE * SELECTED_SCALE)), 
+			0x000000FF, 
+			ALIGN_CENTER);
+		textSelected->setSize(logoSize());
+		e.data.logoSelected = std::shared_ptr<GuiComponent>(textSelected);
+	}
+
+	// make background extras
+	e.data.backgroundExtras = std::shared_ptr<ThemeExtras>(new ThemeExtras(mWindow));
+	e.data.backgroundExtras->setExtras(ThemeData::makeExtras(theme, "system", mWindow));
+}
+
+SystemViewData& SystemView::getEntryData(int index)
+{
+	Entry& e = mEntries.at(index);
+	if(!e.data.logo)
+		buildEntry(e);
+	return e.data;
+}
+
+float SystemView::getEntryDistance(int index, float offset) const
+{
+	// the list loops, so the way around the end might be shorter
+	float dist = fabs(index - offset);
+	return std::min(dist, mEntries.size() - dist);
+}
+
+void SystemView::updateEntries()
+{
+	if(mEntries.empty())
+		return;
+
+	// as far as render() ever looks, plus a little so scrolling doesn't have to wait on a logo
+	const int logoCount = (int)(mSize.x() / (logoSize().x() + LOGO_PADDING)) + 2;
+	const float buildDist = logoCount / 2 + 2.0f;
+	const float releaseDist = buildDist + ENTRY_KEEP_MARGIN;
+
+	for(int i = 0; i < (int)mEntries.size(); i++)
+	{
+		const float dist = std::min(getEntryDistance(i, mCamOffset), getEntryDistance(i, mExtrasCamOffset));
+		if(dist <= buildDist)
+			getEntryData(i);
+		else if(dist > releaseDist && mEntries.at(i).data.logo)
+			mEntries.at(i).data = SystemViewData(); // drops the textures too, unless something else uses them
 	}
 }
 
@@ -133,6 +244,23 @@ bool SystemView::input(InputConfig* config, Input input)
 void SystemView::update(int deltaTime)
 {
 	listUpdate(deltaTime);
+	updateEntries();
+
+	unsigned int loaded, total;
+	SystemData::getLoadProgress(loaded, total);
+	std::stringstream ss;
+	if(loaded < total)
+		ss << "LOADING GAMES " << loaded << "/" << total;
+	if(ss.str() != mLoadingInfo.getValue())
+		mLoadingInfo.setText(ss.str());
+
+	if(mMusicDelay >= 0)
+	{
+		mMusicDelay -= deltaTime;
+		if(mMusicDelay < 0 && mEntries.size())
+			MusicStream::playFromTheme(getSelected()->getTheme(), "system", "music");
+	}
+
 	GuiComponent::update(deltaTime);
 }
 
@@ -141,6 +269,8 @@ void SystemView::onCursorChanged(const CursorState& state)
 	// update help style
 	updateHelpPrompts();
 
+	mMusicDelay = MUSIC_DELAY;
+
 	float startPos = mCamOffset;
 
 	float posMax = (float)mEntries.size();
@@ -280,7 +410,7 @@ void SystemView::render(const Eigen::Affine3f& parentTrans)
 
 		Eigen::Vector2i clipRect = Eigen::Vector2i((int)((i - mExtrasCamOffset) * mSize.x()), 0);
 		Renderer::pushClipRect(clipRect, mSize.cast<int>());
-		mEntries.at(index).data.backgroundExtras->render(extrasTrans);
+		getEntryData(index).backgroundExtras->render(extrasTrans);
 		Renderer::popClipRect();
 	}
 
@@ -299,6 +429,8 @@ void SystemView::render(const Eigen::Affine3f& parentTrans)
 	Renderer::setMatrix(trans);
 	Renderer::drawRect(0.f, (mSize.y() - BAND_HEIGHT) / 2, mSize.x(), BAND_HEIGHT, 0xFFFFFFD8);
 
+	// image logos are drawn together afterwards, a draw per texture they share
+	ImageBatch logoBatch;
 	Eigen::Affine3f logoTrans = trans;
 	for(int i = center - logoCount/2; i < center + logoCount/2 + 1; i++)
 	{
@@ -313,20 +445,33 @@ void SystemView::render(const Eigen::Affine3f& parentTrans)
 		if(index == mCursor) //scale our selection up
 		{
 			// selected
-			const std::shared_ptr<GuiComponent>& comp = mEntries.at(index).data.logoSelected;
+			const std::shared_ptr<GuiComponent>& comp = getEntryData(index).logoSelected;
 			comp->setOpacity(0xFF);
-			comp->render(logoTrans);
+			renderLogo(logoBatch, comp, logoTrans);
 		}else{
 			// not selected
-			const std::shared_ptr<GuiComponent>& comp = mEntries.at(index).data.logo;
+			const std::shared_ptr<GuiComponent>& comp = getEntryData(index).logo;
 			comp->setOpacity(0x80);
-			comp->render(logoTrans);
+			renderLogo(logoBatch, comp, logoTrans);
 		}
 	}
+	logoBatch.draw();
 
 	Renderer::setMatrix(trans);
 	Renderer::drawRect(mSystemInfo.getPosition().x(), mSystemInfo.getPosition().y() - 1, mSize.x(), mSystemInfo.getSize().y(), 0xDDDDDD00 | (unsigned char)(mSystemInfo.getOpacity() / 255.f * 0xD8));
 	mSystemInfo.render(trans);
+
+	if(!mLoadingInfo.getValue().empty())
+		mLoadingInfo.render(trans);
+}
+
+void SystemView::renderLogo(ImageBatch& batch, const std::shared_ptr<GuiComponent>& logo, const Eigen::Affine3f& trans)
+{
+	ImageComponent* image = dynamic_cast<ImageComponent*>(logo.get());
+	if(image)
+		batch.add(*image, trans);
+	else
+		logo->render(trans);
 }
 
 std::vector<HelpPrompt> SystemView::getHelpPrompts()
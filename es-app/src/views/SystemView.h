@@ -24,6 +24,12 @@ public:
 
 	void goToSystem(SystemData* system, bool animate);
 
+	// Picks up systems added to SystemData::sSystemVector, the selection (and what's built) stays.
+	void onSystemsChanged();
+
+	// system's theme was loaded again, only what changed in its "system" view is rebuilt
+	void onThemeChanged(SystemData* system, const ThemeData::ViewChanges& changes);
+
 	bool input(InputConfig* config, Input input) override;
 	void update(int deltaTime) override;
 	void render(const Eigen::Affine3f& parentTrans) override;
@@ -36,13 +42,23 @@ protected:
 
 private:
 	inline Eigen::Vector2f logoSize() const { return Eigen::Vector2f(mSize.x() * 0.25f, mSize.y() * 0.155f); }
+	// image logos go into the batch, text ones are drawn right away
+	void renderLogo(ImageBatch& batch, const std::shared_ptr<GuiComponent>& logo, const Eigen::Affine3f& trans);
 
 	void populate();
 
+	// entries only have logos and backgrounds while they are near the camera
+	void buildEntry(Entry& e);
+	SystemViewData& getEntryData(int index); // builds the entry if needed
+	float getEntryDistance(int index, float offset) const;
+	void updateEntries();
+
 	TextComponent mSystemInfo;
+	TextComponent mLoadingInfo; // how far the background loader is, while it's busy
 
 	// unit is list index
 	float mCamOffset;
 	float mExtrasCamOffset;
 	float mExtrasFadeOpacity;
+	int mMusicDelay; // ms until the selected system's music starts, negative once it did
 };
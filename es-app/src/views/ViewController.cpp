@@ -2,6 +2,13 @@
 #include "Log.h"
 #include "SystemData.h"
 #include "Settings.h"
+#include "ResourceGovernor.h"
+#include "ThermalGovernor.h"
+#include "Trace.h"
+#include "GpuProfiler.h"
+#include "SearchIndex.h"
+#include "PlayedIndex.h"
+#include <set>
 
 #include "views/gamelist/BasicGameListView.h"
 #include "views/gamelist/DetailedGameListView.h"
@@ -12,6 +19,8 @@
 #include "animations/MoveCameraAnimation.h"
 #include "animations/LambdaAnimation.h"
 
+#define THEME_CHECK_INTERVAL 1000 // ms between looking for edited theme files, with "ThemeHotReload"
+
 ViewController* ViewController::sInstance = NULL;
 
 ViewController* ViewController::get()
@@ -27,9 +36,17 @@ void ViewController::init(Window* window)
 }
 
 ViewController::ViewController(Window* window)
-	: GuiComponent(window), mCurrentView(nullptr), mCamera(Eigen::Affine3f::Identity()), mFadeOpacity(0), mLockInput(false)
+	: GuiComponent(window), mMemoryPressure(false), mThemeCheckTime(0), mCurrentView(nullptr), mCamera(Eigen::Affine3f::Identity()), 
+	mFadeOpacity(0), mSnapshotView(NULL), mSnapshotPos(Eigen::Vector3f::Zero()), mLockInput(false)
 {
 	mState.viewing = NOTHING;
+
+	// the views that aren't showing hold most of the textures, the current one (held by mCurrentView) stays;
+	// this is called from whatever upload ran out, which can be in the middle of rendering or building a view
+	ResourceGovernor::getInstance()->addPressureHandler([] {
+		if(sInstance)
+			sInstance->mMemoryPressure = true;
+	});
 }
 
 ViewController::~ViewController()
@@ -85,6 +102,13 @@ void ViewController::goToPrevGameList()
 
 void ViewController::goToGameList(SystemData* system)
 {
+	// a lazily loaded system's summary can be out of date, it might not have any games after all
+	if(system->getRootFolder()->getChildren().empty())
+	{
+		LOG(LogWarning) << "System \"" << system->getName() << "\" has no games, not opening it";
+		return;
+	}
+
 	if(mState.viewing == SYSTEM_SELECT)
 	{
 		// move system list
@@ -113,6 +137,18 @@ void ViewController::playViewTransition()
 	if(target == -mCamera.translation() && !isAnimationPlaying(0))
 		return;
 
+	// while the board is too hot, just cut to the view
+	if(!ThermalGovernor::getInstance()->effectsEnabled())
+	{
+		cancelAnimation(0);
+		mFadeOpacity = 0;
+		mSnapshotView = NULL;
+		mSnapshot.release();
+		mCamera.translation() = -target;
+		updateHelpPrompts();
+		return;
+	}
+
 	if(Settings::getInstance()->getString("TransitionStyle") == "fade")
 	{
 		// fade
@@ -143,13 +179,32 @@ void ViewController::playViewTransition()
 		}
 	}else{
 		// slide
-		setAnimation(new MoveCameraAnimation(mCamera, target));
+		// halfway through another slide there isn't just one view on screen to take
+		const bool snapshot = !isAnimationPlaying(0) && Settings::getInstance()->getBool("SnapshotTransitions");
+		mSnapshotView = NULL;
+		if(snapshot)
+			takeSnapshot();
+
+		setAnimation(new MoveCameraAnimation(mCamera, target), 0, [this] {
+			mSnapshotView = NULL;
+			mSnapshot.release();
+		});
 		updateHelpPrompts(); // update help prompts immediately
 	}
 }
 
 void ViewController::onFileChanged(FileData* file, FileChangeType change)
 {
+	if(change == FILE_METADATA_CHANGED && !file->getThumbnailPath().empty())
+		file->getSystem()->setHasImages();
+
+	// it might belong somewhere else in the order now
+	if(change == FILE_METADATA_CHANGED && file->getParent())
+		file->getParent()->invalidateSort();
+
+	SearchIndex::getInstance()->onFileChanged(file, change);
+	PlayedIndex::getInstance()->onFileChanged(file, change);
+
 	auto it = mGameListViews.find(file->getSystem());
 	if(it != mGameListViews.end())
 		it->second->onFileChanged(file, change);
@@ -163,6 +218,9 @@ void ViewController::launch(FileData* game, Eigen::Vector3f center)
 		return;
 	}
 
+	// the animation below takes long enough to get a good part of the game off the disk
+	game->getSystem()->prefetchGame(game);
+
 	Eigen::Affine3f origCamera = mCamera;
 	origCamera.translation() = -mCurrentView->getPosition();
 
@@ -203,27 +261,22 @@ std::shared_ptr<IGameListView> ViewController::getGameListView(SystemData* syste
 	//if we already made one, return that one
 	auto exists = mGameListViews.find(system);
 	if(exists != mGameListViews.end())
+	{
+		touchGameListView(system);
 		return exists->second;
+	}
 
 	//if we didn't, make it, remember it, and return it
 	std::shared_ptr<IGameListView> view;
 
+	// loads a lazily loaded system, hasImages() only knows once its gamelist has been read
+	FileData* root = system->getRootFolder();
+
 	//decide type
-	bool detailed = false;
-	std::vector<FileData*> files = system->getRootFolder()->getFilesRecursive(GAME | FOLDER);
-	for(auto it = files.begin(); it != files.end(); it++)
-	{
-		if(!(*it)->getThumbnailPath().empty())
-		{
-			detailed = true;
-			break;
-		}
-	}
-		
-	if(detailed)
-		view = std::shared_ptr<IGameListView>(new DetailedGameListView(mWindow, system->getRootFolder()));
+	if(system->hasImages())
+		view = std::shared_ptr<IGameListView>(new DetailedGameListView(mWindow, root));
 	else
-		view = std::shared_ptr<IGameListView>(new BasicGameListView(mWindow, system->getRootFolder()));
+		view = std::shared_ptr<IGameListView>(new BasicGameListView(mWindow, root));
 		
 	// uncomment for experimental "image grid" view
 	//view = std::shared_ptr<IGameListView>(new GridGameListView(mWindow, system->getRootFolder()));
@@ -237,9 +290,88 @@ std::shared_ptr<IGameListView> ViewController::getGameListView(SystemData* syste
 	addChild(view.get());
 
 	mGameListViews[system] = view;
+	touchGameListView(system);
+
+	// put the cursor back where it was if this view was evicted before
+	auto cursor = mEvictedCursors.find(system);
+	if(cursor != mEvictedCursors.end())
+	{
+		const std::string path = cursor->second;
+		mEvictedCursors.erase(cursor);
+
+		system->getRootFolder()->visitRecursive(GAME | FOLDER, [&](FileData* file) {
+			if(file->getPath().generic_string() != path)
+				return true;
+
+			view->setCursor(file);
+			return false;
+		});
+	}
+
+	evictGameListViews();
 	return view;
 }
 
+void ViewController::touchGameListView(SystemData* system)
+{
+	mGameListViewLRU.remove(system);
+	mGameListViewLRU.push_back(system);
+}
+
+void ViewController::evictGameListViews()
+{
+	// keep at least the current view and both its neighbours
+	evictGameListViews((unsigned int)std::max(3, ResourceGovernor::getInstance()->getGameListViewCacheSize()));
+}
+
+void ViewController::evictGameListViews(unsigned int maxViews)
+{
+	auto it = mGameListViewLRU.begin();
+	while(mGameListViews.size() > maxViews && it != mGameListViewLRU.end())
+	{
+		auto view = mGameListViews.find(*it);
+
+		// still in use (e.g. it's the current view)
+		if(view->second.use_count() > 1)
+		{
+			it++;
+			continue;
+		}
+
+		FileData* cursor = view->second->getCursor();
+		if(cursor)
+			mEvictedCursors[*it] = cursor->getPath().generic_string();
+
+		if(view->second.get() == mSnapshotView)
+			mSnapshotView = NULL;
+		mGameListViews.erase(view);
+		it = mGameListViewLRU.erase(it);
+	}
+}
+
+void ViewController::prebuildGameListViews()
+{
+	std::vector<SystemData*> candidates;
+	if(mState.viewing == GAME_LIST)
+	{
+		candidates.push_back(mState.getSystem()->getNext());
+		candidates.push_back(mState.getSystem()->getPrev());
+	}else if(mState.viewing == SYSTEM_SELECT && mSystemListView && !mSystemListView->isScrolling() && mSystemListView->size())
+	{
+		candidates.push_back(mSystemListView->getSelected());
+	}
+
+	for(auto it = candidates.begin(); it != candidates.end(); it++)
+	{
+		SystemData* system = *it;
+		if(mGameListViews.find(system) != mGameListViews.end() || !system->isLoaded() || system->getRootFolder()->getChildren().empty())
+			continue;
+
+		getGameListView(system);
+		return;
+	}
+}
+
 std::shared_ptr<SystemView> ViewController::getSystemListView()
 {
 	//if we already made one, return that one
@@ -280,18 +412,144 @@ void ViewController::update(int deltaTime)
 	}
 
 	updateSelf(deltaTime);
+
+	if(mMemoryPressure)
+	{
+		mMemoryPressure = false;
+		evictGameListViews(1);
+	}
+
+	SearchIndex::getInstance()->update();
+	PlayedIndex::getInstance()->update();
+
+	static const SettingHandle<bool> themeHotReload = Settings::getInstance()->getBoolHandle("ThemeHotReload");
+	if(themeHotReload)
+	{
+		mThemeCheckTime += deltaTime;
+		if(mThemeCheckTime >= THEME_CHECK_INTERVAL)
+		{
+			mThemeCheckTime = 0;
+			reloadChangedThemes();
+		}
+	}
+
+	// build views while nothing is moving, so it doesn't stall a transition
+	// (not at all on small machines, they'd only push out the textures of the one that's showing)
+	if(!isAnimationPlaying(0) && ResourceGovernor::getInstance()->getProfile().prebuildViews)
+		prebuildGameListViews();
+}
+
+void ViewController::reloadChangedThemes()
+{
+	bool reloaded = false;
+	for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end(); it++)
+	{
+		SystemData* system = *it;
+		const std::shared_ptr<ThemeData> old = system->getTheme();
+		if(!old->isModified())
+			continue;
+
+		// an editor saving halfway through a change is likely, keep showing the old theme until it parses again
+		const bool wasBroken = mBrokenThemes.find(system) != mBrokenThemes.end();
+		if(!system->reloadTheme(!wasBroken))
+		{
+			mBrokenThemes.insert(system);
+			continue;
+		}
+		mBrokenThemes.erase(system);
+
+		const std::shared_ptr<ThemeData>& theme = system->getTheme();
+		reloaded = true;
+
+		auto view = mGameListViews.find(system);
+		if(view != mGameListViews.end())
+		{
+			ThemeData::ViewChanges changes;
+			ThemeData::getChanges(*old, *theme, view->second->getName(), changes);
+			if(changes.lostProperties)
+			{
+				// what was taken out has to go back to how the view starts out
+				LOG(LogInfo) << "Theme of " << system->getName() << " changed, rebuilding its gamelist view";
+				reloadGameListView(view->second.get());
+			}else{
+				LOG(LogInfo) << "Theme of " << system->getName() << " changed, applying " << changes.elements.size() << " elements";
+				view->second->setTheme(theme, changes);
+			}
+		}
+
+		if(mSystemListView)
+		{
+			ThemeData::ViewChanges changes;
+			ThemeData::getChanges(*old, *theme, "system", changes);
+			mSystemListView->onThemeChanged(system, changes);
+		}
+	}
+
+	if(reloaded)
+	{
+		ThemeData::saveCache();
+		updateHelpPrompts();
+	}
+}
+
+void ViewController::takeSnapshot()
+{
+	// whichever view the camera is on, the one we're leaving
+	const Eigen::Vector3f cameraPos = -mCamera.translation();
+	GuiComponent* view = NULL;
+	if(mSystemListView && mSystemListView != mCurrentView && mSystemListView->getPosition() == cameraPos)
+		view = mSystemListView.get();
+	for(auto it = mGameListViews.begin(); !view && it != mGameListViews.end(); it++)
+	{
+		if(it->second != mCurrentView && it->second->getPosition() == cameraPos)
+			view = it->second.get();
+	}
+
+	if(!view || !Renderer::renderTargetsSupported())
+		return;
+
+	if(!mSnapshot.begin((int)Renderer::getScreenWidth(), (int)Renderer::getScreenHeight()))
+		return;
+
+	Eigen::Affine3f trans = Eigen::Affine3f::Identity();
+	trans.translate(-cameraPos);
+	view->render(trans);
+	mSnapshot.end();
+
+	mSnapshotView = view;
+	mSnapshotPos = cameraPos;
+}
+
+void ViewController::renderSnapshot(const Eigen::Affine3f& trans)
+{
+	Eigen::Affine3f snapshotTrans = trans;
+	snapshotTrans.translate(mSnapshotPos);
+	Renderer::setMatrix(roundMatrix(snapshotTrans));
+
+	// the texture's rows are bottom to top, and it's premultiplied
+	Renderer::drawQuad(mSnapshot.getTexture(), 0, 0, (float)mSnapshot.getWidth(), (float)mSnapshot.getHeight(), 0, 1, 1, 0, 0xFFFFFFFF,
+		GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
 }
 
 void ViewController::render(const Eigen::Affine3f& parentTrans)
 {
 	Eigen::Affine3f trans = mCamera * parentTrans;
 
+	// gone if the context was recreated since (e.g. a game was launched)
+	GuiComponent* snapshotView = (mSnapshotView && mSnapshot.getTexture() != 0) ? mSnapshotView : NULL;
+	if(snapshotView)
+		renderSnapshot(trans);
+
 	// camera position, position + size
 	Eigen::Vector3f viewStart = trans.inverse().translation();
 	Eigen::Vector3f viewEnd = trans.inverse() * Eigen::Vector3f((float)Renderer::getScreenWidth(), (float)Renderer::getScreenHeight(), 0);
 
 	// draw systemview
-	getSystemListView()->render(trans);
+	if(getSystemListView().get() != snapshotView)
+	{
+		GpuProfiler::Scope gpuScope(GpuProfiler::SECTION_SYSTEMVIEW);
+		getSystemListView()->render(trans);
+	}
 	
 	// draw gamelists
 	for(auto it = mGameListViews.begin(); it != mGameListViews.end(); it++)
@@ -300,9 +558,12 @@ void ViewController::render(const Eigen::Affine3f& parentTrans)
 		Eigen::Vector3f guiStart = it->second->getPosition();
 		Eigen::Vector3f guiEnd = it->second->getPosition() + Eigen::Vector3f(it->second->getSize().x(), it->second->getSize().y(), 0);
 
-		if(guiEnd.x() >= viewStart.x() && guiEnd.y() >= viewStart.y() &&
+		if(it->second.get() != snapshotView && guiEnd.x() >= viewStart.x() && guiEnd.y() >= viewStart.y() &&
 			guiStart.x() <= viewEnd.x() && guiStart.y() <= viewEnd.y())
-				it->second->render(trans);
+		{
+			GpuProfiler::Scope gpuScope(GpuProfiler::SECTION_GAMELIST);
+			it->second->render(trans);
+		}
 	}
 
 	if(mWindow->peekGui() == this)
@@ -318,10 +579,9 @@ void ViewController::render(const Eigen::Affine3f& parentTrans)
 
 void ViewController::preload()
 {
-	for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end(); it++)
-	{
-		getGameListView(*it);
-	}
+	TRACE_SCOPE("ViewController::preload");
+
+	getSystemListView();
 }
 
 void ViewController::reloadGameListView(IGameListView* view, bool reloadTheme)
@@ -333,12 +593,19 @@ void ViewController::reloadGameListView(IGameListView* view, bool reloadTheme)
 			bool isCurrent = (mCurrentView == it->second);
 			SystemData* system = it->first;
 			FileData* cursor = view->getCursor();
+			FileData::FilterFunction* filter = view->getFilter();
+			const FileData::SortType* sort = view->getSort();
+			if(it->second.get() == mSnapshotView)
+				mSnapshotView = NULL;
 			mGameListViews.erase(it);
+			mGameListViewLRU.remove(system);
 
 			if(reloadTheme)
 				system->loadTheme();
 
 			std::shared_ptr<IGameListView> newView = getGameListView(system);
+			newView->setFilter(filter);
+			newView->setSort(sort);
 			newView->setCursor(cursor);
 
 			if(isCurrent)
@@ -349,24 +616,69 @@ void ViewController::reloadGameListView(IGameListView* view, bool reloadTheme)
 	}
 }
 
-void ViewController::reloadAll()
+void ViewController::onSystemsChanged()
 {
-	std::map<SystemData*, FileData*> cursorMap;
+	// views are laid out by system id, which moved for everything after a new system
+	const float oldX = mCurrentView ? mCurrentView->getPosition().x() : 0;
+
 	for(auto it = mGameListViews.begin(); it != mGameListViews.end(); it++)
+		it->second->setPosition(getSystemId(it->first) * (float)Renderer::getScreenWidth(), it->second->getPosition().y());
+
+	if(mSystemListView)
 	{
-		cursorMap[it->first] = it->second->getCursor();
+		mSystemListView->onSystemsChanged();
+		if(mState.viewing == SYSTEM_SELECT)
+			mSystemListView->setPosition(getSystemId(mState.getSystem()) * (float)Renderer::getScreenWidth(), mSystemListView->getPosition().y());
 	}
-	mGameListViews.clear();
 
-	for(auto it = cursorMap.begin(); it != cursorMap.end(); it++)
+	if(mCurrentView)
+		mCamera.translation().x() -= mCurrentView->getPosition().x() - oldX;
+}
+
+void ViewController::reloadAll()
+{
+	// only systems whose theme is now a different file need anything rebuilt, and their themes are only loaded
+	// once something asks for them (the system view just builds the logos near its cursor)
+	std::set<SystemData*> changed;
+	for(auto it = SystemData::sSystemVector.begin(); it != SystemData::sSystemVector.end(); it++)
+	{
+		if((*it)->invalidateTheme())
+			changed.insert(*it);
+	}
+
+	LOG(LogInfo) << "Theme changed for " << changed.size() << " of " << SystemData::sSystemVector.size() << " systems";
+	if(changed.empty())
+		return;
+
+	// the current view is rebuilt right away, the others when they're next needed (like evicted ones)
+	for(auto it = mGameListViews.begin(); it != mGameListViews.end(); )
 	{
-		it->first->loadTheme();
-		getGameListView(it->first)->setCursor(it->second);
+		if(changed.find(it->first) == changed.end() || it->second == mCurrentView)
+		{
+			it++;
+			continue;
+		}
+
+		FileData* cursor = it->second->getCursor();
+		if(cursor)
+			mEvictedCursors[it->first] = cursor->getPath().generic_string();
+
+		if(it->second.get() == mSnapshotView)
+			mSnapshotView = NULL;
+		mGameListViewLRU.remove(it->first);
+		it = mGameListViews.erase(it);
 	}
 
+	if(mState.viewing == GAME_LIST && changed.find(mState.getSystem()) != changed.end())
+		reloadGameListView(mState.getSystem());
+
+	if(mSystemListView.get() == mSnapshotView)
+		mSnapshotView = NULL;
 	mSystemListView.reset();
 	getSystemListView();
 
+	ThemeData::saveCache();
+
 	// update mCurrentView since the pointers changed
 	if(mState.viewing == GAME_LIST)
 	{
@@ -2,6 +2,9 @@
 
 #include "views/gamelist/IGameListView.h"
 #include "views/SystemView.h"
+#include "Renderer.h"
+#include <list>
+#include <set>
 
 class SystemData;
 
@@ -14,8 +17,8 @@ public:
 
 	virtual ~ViewController();
 
-	// Try to completely populate the GameListView map.
-	// Caches things so there's no pauses during transitions.
+	// Builds the system view. Gamelist views are built when they're first needed (or while idle, for the
+	// ones we're likely to go to next) and at most "GameListViewCacheSize" are kept around.
 	void preload();
 
 	// If a basic view detected a metadata change, it can request to recreate
@@ -23,6 +26,7 @@ public:
 	void reloadGameListView(IGameListView* gamelist, bool reloadTheme = false);
 	inline void reloadGameListView(SystemData* system, bool reloadTheme = false) { reloadGameListView(getGameListView(system).get(), reloadTheme); }
 	void reloadAll(); // Reload everything with a theme.  Used when the "ThemeSet" setting changes.
+	void onSystemsChanged(); // systems were added to SystemData::sSystemVector (see SystemData::updatePendingSystems)
 
 	// Navigation.
 	void goToNextGameList();
@@ -74,13 +78,34 @@ private:
 
 	void playViewTransition();
 	int getSystemId(SystemData* system);
+
+	// "SnapshotTransitions": draws the view the camera is leaving into mSnapshot, which is drawn instead of it until the slide ends
+	void takeSnapshot();
+	void renderSnapshot(const Eigen::Affine3f& trans);
+
+	void touchGameListView(SystemData* system); // mark as most recently used
+	void evictGameListViews(); // destroy least recently used views over the limit
+	void evictGameListViews(unsigned int maxViews); // as many as can go until maxViews are left
+	void prebuildGameListViews(); // build (at most) one view we're likely to go to next
+	bool mMemoryPressure; // the GPU ran out, evict views in the next update() (not while one might be rendering or being built)
+
+	// "ThemeHotReload": themes whose files changed are loaded again and only the elements that changed are applied
+	void reloadChangedThemes();
+	int mThemeCheckTime; // ms since themes were last checked
+	std::set<SystemData*> mBrokenThemes; // failed to load last time, so the error isn't logged every check
 	
 	std::shared_ptr<GuiComponent> mCurrentView;
 	std::map< SystemData*, std::shared_ptr<IGameListView> > mGameListViews;
+	std::list<SystemData*> mGameListViewLRU; // least recently used first
+	std::map<SystemData*, std::string> mEvictedCursors; // path of the game that was selected when a view got evicted
 	std::shared_ptr<SystemView> mSystemListView;
 	
 	Eigen::Affine3f mCamera;
 	float mFadeOpacity;
+
+	Renderer::RenderTarget mSnapshot;
+	GuiComponent* mSnapshotView; // what mSnapshot shows (not drawn itself while it's set), NULL if there's no snapshot
+	Eigen::Vector3f mSnapshotPos; // where that view was
 	bool mLockInput;
 
 	State mState;
@@ -5,6 +5,7 @@
 #include "ThemeData.h"
 #include "SystemData.h"
 #include "Settings.h"
+#include <cstring>
 
 BasicGameListView::BasicGameListView(Window* window, FileData* root)
 	: ISimpleGameListView(window, root), mList(window)
@@ -13,21 +14,27 @@ BasicGameListView::BasicGameListView(Window* window, FileData* root)
 	mList.setPosition(0, mSize.y() * 0.2f);
 	addChild(&mList);
 
-	populateList(root->getChildren());
+	populateList(getVisibleChildren(root));
 }
 
 void BasicGameListView::onThemeChanged(const std::shared_ptr<ThemeData>& theme)
 {
 	ISimpleGameListView::onThemeChanged(theme);
 	using namespace ThemeFlags;
+	if(!isThemeElementChanged("gamelist"))
+		return;
+
 	mList.applyTheme(theme, getName(), "gamelist", ALL);
+
+	// make the glyphs our names need now instead of the first time they scroll into view
+	mList.getFont()->preloadGlyphs(mRoot->getSystem()->getNameCodePoints());
 }
 
 void BasicGameListView::onFileChanged(FileData* file, FileChangeType change)
 {
-	if(change == FILE_METADATA_CHANGED)
+	// the first image switches us to a detailed view, anything else can be patched in place
+	if(change == FILE_METADATA_CHANGED && file->getSystem()->hasImages() && strcmp(getName(), "basic") == 0)
 	{
-		// might switch to a detailed view
 		ViewController::get()->reloadGameListView(this);
 		return;
 	}
@@ -47,6 +54,35 @@ void BasicGameListView::populateList(const std::vector<FileData*>& files)
 	}
 }
 
+int BasicGameListView::getEntryIndex(FileData* file)
+{
+	return mList.indexOf(file);
+}
+
+int BasicGameListView::getEntryCount()
+{
+	return mList.size();
+}
+
+bool BasicGameListView::insertEntry(int index, FileData* file)
+{
+	mList.insert(index, file->getName(), file, (file->getType() == FOLDER));
+	return true;
+}
+
+bool BasicGameListView::removeEntry(int index)
+{
+	mList.removeAt(index);
+	return true;
+}
+
+bool BasicGameListView::updateEntry(int index)
+{
+	FileData* file = mList.getObjectAt(index);
+	mList.setName(index, file->getName());
+	return true;
+}
+
 FileData* BasicGameListView::getCursor()
 {
 	return mList.getSelected();
@@ -56,7 +92,7 @@ void BasicGameListView::setCursor(FileData* cursor)
 {
 	if(!mList.setCursor(cursor))
 	{
-		populateList(cursor->getParent()->getChildren());
+		populateList(getVisibleChildren(cursor->getParent()));
 		mList.setCursor(cursor);
 
 		// update our cursor stack in case our cursor just got set to some folder we weren't in before
@@ -91,7 +127,7 @@ void BasicGameListView::remove(FileData *game)
 	boost::filesystem::remove(game->getPath());  // actually delete the file on the filesystem
 	if (getCursor() == game)                     // Select next element in list, or prev if none
 	{
-		std::vector<FileData*> siblings = game->getParent()->getChildren();
+		std::vector<FileData*> siblings = getVisibleChildren(game->getParent());
 		auto gameIter = std::find(siblings.begin(), siblings.end(), game);
 		auto gamePos = std::distance(siblings.begin(), gameIter);
 		if (gameIter != siblings.end())
@@ -104,8 +140,9 @@ void BasicGameListView::remove(FileData *game)
 			}
 		}
 	}
-	delete game;                                 // remove before repopulating (removes from parent)
+	game->getParent()->removeChild(game);        // remove before repopulating
 	onFileChanged(game, FILE_REMOVED);           // update the view, with game removed
+	game->getSystem()->deleteFileData(game);
 }
 
 std::vector<HelpPrompt> BasicGameListView::getHelpPrompts()
@@ -22,6 +22,11 @@ public:
 
 protected:
 	virtual void populateList(const std::vector<FileData*>& files) override;
+	virtual int getEntryIndex(FileData* file) override;
+	virtual int getEntryCount() override;
+	virtual bool insertEntry(int index, FileData* file) override;
+	virtual bool removeEntry(int index) override;
+	virtual bool updateEntry(int index) override;
 	virtual void launch(FileData* game) override;
 	virtual void remove(FileData* game) override;
 
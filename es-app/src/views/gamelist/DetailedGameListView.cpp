@@ -3,10 +3,13 @@
 #include "Window.h"
 #include "animations/LambdaAnimation.h"
 
+// entries ahead of the cursor (in the scroll direction) that get their box art loaded ahead of time
+#define PREFETCH_AHEAD 3
+
 DetailedGameListView::DetailedGameListView(Window* window, FileData* root) : 
 	BasicGameListView(window, root), 
 	mDescContainer(window), mDescription(window), 
-	mImage(window),
+	mImage(window), mVideo(window),
 
 	mLblRating(window), mLblReleaseDate(window), mLblDeveloper(window), mLblPublisher(window), 
 	mLblGenre(window), mLblPlayers(window), mLblLastPlayed(window), mLblPlayCount(window),
@@ -21,13 +24,16 @@ DetailedGameListView::DetailedGameListView(Window* window, FileData* root) :
 	mList.setPosition(mSize.x() * (0.50f + padding), mList.getPosition().y());
 	mList.setSize(mSize.x() * (0.50f - padding), mList.getSize().y());
 	mList.setAlignment(TextListComponent<FileData*>::ALIGN_LEFT);
-	mList.setCursorChangedCallback([&](const CursorState& state) { updateInfoPanel(); });
+	mList.setCursorChangedCallback([&](const CursorState& state) { updateInfoPanel(); prefetchImages(); });
 
 	// image
 	mImage.setOrigin(0.5f, 0.5f);
 	mImage.setPosition(mSize.x() * 0.25f, mList.getPosition().y() + mSize.y() * 0.2125f);
 	mImage.setMaxSize(mSize.x() * (0.50f - 2*padding), mSize.y() * 0.4f);
+	mImage.setLoadAsync(true); // box art is decoded in the background so scrolling doesn't stall
+	mImage.setDownscale(true);
 	addChild(&mImage);
+	addChild(&mVideo); // zero size until a theme places it
 
 	// metadata labels + values
 	mLblRating.setText("Rating: ");
@@ -76,9 +82,11 @@ void DetailedGameListView::onThemeChanged(const std::shared_ptr<ThemeData>& them
 	BasicGameListView::onThemeChanged(theme);
 
 	using namespace ThemeFlags;
-	mImage.applyTheme(theme, getName(), "md_image", POSITION | ThemeFlags::SIZE);
+	if(isThemeElementChanged("md_image"))
+		mImage.applyTheme(theme, getName(), "md_image", POSITION | ThemeFlags::SIZE);
+	if(isThemeElementChanged("md_video"))
+		mVideo.applyTheme(theme, getName(), "md_video", POSITION | ThemeFlags::SIZE);
 
-	initMDLabels();
 	std::vector<TextComponent*> labels = getMDLabels();
 	assert(labels.size() == 8);
 	const char* lblElements[8] = {
@@ -86,13 +94,20 @@ void DetailedGameListView::onThemeChanged(const std::shared_ptr<ThemeData>& them
 		"md_lbl_genre", "md_lbl_players", "md_lbl_lastplayed", "md_lbl_playcount"
 	};
 
+	// the labels (and values) are laid out as a group before the theme moves them, so they go together
+	bool labelsChanged = false;
 	for(unsigned int i = 0; i < labels.size(); i++)
+		labelsChanged |= isThemeElementChanged(lblElements[i]);
+
+	if(labelsChanged)
 	{
-		labels[i]->applyTheme(theme, getName(), lblElements[i], ALL);
+		initMDLabels();
+		for(unsigned int i = 0; i < labels.size(); i++)
+		{
+			labels[i]->applyTheme(theme, getName(), lblElements[i], ALL);
+		}
 	}
 
-
-	initMDValues();
 	std::vector<GuiComponent*> values = getMDValues();
 	assert(values.size() == 8);
 	const char* valElements[8] = {
@@ -100,14 +115,27 @@ void DetailedGameListView::onThemeChanged(const std::shared_ptr<ThemeData>& them
 		"md_genre", "md_players", "md_lastplayed", "md_playcount"
 	};
 
+	// values are placed next to the labels
+	bool valuesChanged = labelsChanged;
 	for(unsigned int i = 0; i < values.size(); i++)
+		valuesChanged |= isThemeElementChanged(valElements[i]);
+
+	if(valuesChanged)
 	{
-		values[i]->applyTheme(theme, getName(), valElements[i], ALL ^ ThemeFlags::TEXT);
+		initMDValues();
+		for(unsigned int i = 0; i < values.size(); i++)
+		{
+			values[i]->applyTheme(theme, getName(), valElements[i], ALL ^ ThemeFlags::TEXT);
+		}
 	}
 
-	mDescContainer.applyTheme(theme, getName(), "md_description", POSITION | ThemeFlags::SIZE);
-	mDescription.setSize(mDescContainer.getSize().x(), 0);
-	mDescription.applyTheme(theme, getName(), "md_description", ALL ^ (POSITION | ThemeFlags::SIZE | TEXT));
+	// initMDValues() puts the description under the values
+	if(valuesChanged || isThemeElementChanged("md_description"))
+	{
+		mDescContainer.applyTheme(theme, getName(), "md_description", POSITION | ThemeFlags::SIZE);
+		mDescription.setSize(mDescContainer.getSize().x(), 0);
+		mDescription.applyTheme(theme, getName(), "md_description", ALL ^ (POSITION | ThemeFlags::SIZE | TEXT));
+	}
 }
 
 void DetailedGameListView::initMDLabels()
@@ -177,6 +205,40 @@ void DetailedGameListView::initMDValues()
 	mDescContainer.setSize(mDescContainer.getSize().x(), mSize.y() - mDescContainer.getPosition().y());
 }
 
+void DetailedGameListView::prefetchImages()
+{
+	const int count = mList.size();
+	if(count == 0)
+		return;
+
+	// while scrolling: the current entry (nothing is shown while scrolling) and the next few in the scroll direction,
+	// once it stops: both neighbours
+	std::vector<int> offsets;
+	const int velocity = mList.getScrollVelocity();
+	if(velocity != 0)
+	{
+		// the loader does the most recently queued first, so queue the furthest one first
+		const int dir = velocity < 0 ? -1 : 1;
+		for(int i = PREFETCH_AHEAD; i >= 0; i--)
+			offsets.push_back(i * dir);
+	}else{
+		offsets.push_back(1);
+		offsets.push_back(-1);
+	}
+
+	// the old ones are replaced, so whatever the cursor has scrolled past gets cancelled (unless it was already done)
+	std::vector< std::shared_ptr<TextureResource> > prefetched;
+	prefetched.reserve(offsets.size());
+	for(auto it = offsets.begin(); it != offsets.end(); it++)
+	{
+		const int index = ((mList.getCursorIndex() + *it) % count + count) % count;
+		std::shared_ptr<TextureResource> tex = mImage.prefetch(mList.getObjectAt(index)->metadata.get("image"));
+		if(tex)
+			prefetched.push_back(tex);
+	}
+	mPrefetched.swap(prefetched);
+}
+
 void DetailedGameListView::updateInfoPanel()
 {
 	FileData* file = (mList.size() == 0 || mList.isScrolling()) ? NULL : mList.getSelected();
@@ -186,9 +248,11 @@ void DetailedGameListView::updateInfoPanel()
 	{
 		//mImage.setImage("");
 		//mDescription.setText("");
+		mVideo.setVideo("");
 		fadingOut = true;
 	}else{
 		mImage.setImage(file->metadata.get("image"));
+		mVideo.setVideo(file->getType() == GAME ? file->metadata.get(MetaDataIds::VIDEO) : "");
 		mDescription.setText(file->metadata.get("desc"));
 		mDescContainer.reset();
 
@@ -232,6 +296,14 @@ void DetailedGameListView::updateInfoPanel()
 	}
 }
 
+bool DetailedGameListView::updateEntry(int index)
+{
+	BasicGameListView::updateEntry(index);
+	if(index == mList.getCursorIndex())
+		updateInfoPanel();
+	return true;
+}
+
 void DetailedGameListView::launch(FileData* game)
 {
 	Eigen::Vector3f target(Renderer::getScreenWidth() / 2.0f, Renderer::getScreenHeight() / 2.0f, 0);
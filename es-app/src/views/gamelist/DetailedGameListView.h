@@ -4,6 +4,7 @@
 #include "components/ScrollableContainer.h"
 #include "components/RatingComponent.h"
 #include "components/DateTimeComponent.h"
+#include "components/VideoComponent.h"
 
 class DetailedGameListView : public BasicGameListView
 {
@@ -16,14 +17,18 @@ public:
 
 protected:
 	virtual void launch(FileData* game) override;
+	virtual bool updateEntry(int index) override;
 
 private:
 	void updateInfoPanel();
+	void prefetchImages(); // start loading box art for the entries the cursor is likely to stop on next
 
 	void initMDLabels();
 	void initMDValues();
 
 	ImageComponent mImage;
+	VideoComponent mVideo; // only themes that have an md_video get one, it plays over mImage
+	std::vector< std::shared_ptr<TextureResource> > mPrefetched; // dropping these cancels their loads
 
 	TextComponent mLblRating, mLblReleaseDate, mLblDeveloper, mLblPublisher, mLblGenre, mLblPlayers, mLblLastPlayed, mLblPlayCount;
 
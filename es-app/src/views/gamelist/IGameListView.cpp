@@ -35,6 +35,14 @@ void IGameListView::setTheme(const std::shared_ptr<ThemeData>& theme)
 	onThemeChanged(theme);
 }
 
+void IGameListView::setTheme(const std::shared_ptr<ThemeData>& theme, const ThemeData::ViewChanges& changes)
+{
+	mTheme = theme;
+	mThemeChanges = &changes;
+	onThemeChanged(theme);
+	mThemeChanges = NULL;
+}
+
 HelpStyle IGameListView::getHelpStyle()
 {
 	HelpStyle style;
@@ -2,6 +2,7 @@
 
 #include "FileData.h"
 #include "Renderer.h"
+#include "ThemeData.h"
 
 class Window;
 class GuiComponent;
@@ -12,7 +13,7 @@ class ThemeData;
 class IGameListView : public GuiComponent
 {
 public:
-	IGameListView(Window* window, FileData* root) : GuiComponent(window), mRoot(root)
+	IGameListView(Window* window, FileData* root) : GuiComponent(window), mRoot(root), mFilter(NULL), mSort(NULL), mThemeChanges(NULL)
 		{ setSize((float)Renderer::getScreenWidth(), (float)Renderer::getScreenHeight()); }
 
 	virtual ~IGameListView() {}
@@ -26,11 +27,21 @@ public:
 	virtual void onThemeChanged(const std::shared_ptr<ThemeData>& theme) = 0;
 
 	void setTheme(const std::shared_ptr<ThemeData>& theme);
+	// As above, but only the elements in changes are applied again (for a theme file edited while we're running).
+	void setTheme(const std::shared_ptr<ThemeData>& theme, const ThemeData::ViewChanges& changes);
 	inline const std::shared_ptr<ThemeData>& getTheme() const { return mTheme; }
 
 	virtual FileData* getCursor() = 0;
 	virtual void setCursor(FileData*) = 0;
 
+	// Only show games this lets through (folders are always shown), NULL shows everything.
+	virtual void setFilter(FileData::FilterFunction* filter) { mFilter = filter; }
+	inline FileData::FilterFunction* getFilter() const { return mFilter; }
+
+	// Show games in this order, just in this view. NULL keeps the folders' own order (by name, as they were loaded).
+	virtual void setSort(const FileData::SortType* sort) { mSort = sort; }
+	inline const FileData::SortType* getSort() const { return mSort; }
+
 	virtual bool input(InputConfig* config, Input input) override;
 	virtual void remove(FileData* game) = 0;
 
@@ -38,6 +49,15 @@ public:
 
 	virtual HelpStyle getHelpStyle() override;
 protected:
+	// for onThemeChanged(): false for elements that are the same as before, always true when the whole theme is new
+	inline bool isThemeElementChanged(const char* element) const { return !mThemeChanges || mThemeChanges->has(element); }
+	inline bool areThemeExtrasChanged() const { return !mThemeChanges || mThemeChanges->extras; }
+
 	FileData* mRoot;
+	FileData::FilterFunction* mFilter;
+	const FileData::SortType* mSort;
 	std::shared_ptr<ThemeData> mTheme;
+
+private:
+	const ThemeData::ViewChanges* mThemeChanges; // only set during setTheme(theme, changes)
 };
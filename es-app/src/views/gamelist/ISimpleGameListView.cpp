@@ -4,6 +4,7 @@
 #include "views/ViewController.h"
 #include "Sound.h"
 #include "Settings.h"
+#include <algorithm>
 
 ISimpleGameListView::ISimpleGameListView(Window* window, FileData* root) : IGameListView(window, root),
 	mHeaderText(window), mHeaderImage(window), mBackground(window), mThemeExtras(window)
@@ -19,6 +20,10 @@ ISimpleGameListView::ISimpleGameListView(Window* window, FileData* root) : IGame
 
 	mBackground.setResize(mSize.x(), mSize.y());
 
+	// extras never change once the theme's loaded
+	mThemeExtras.setSize(mSize);
+	mThemeExtras.setRenderCached(true);
+
 	addChild(&mHeaderText);
 	addChild(&mBackground);
 	addChild(&mThemeExtras);
@@ -27,10 +32,14 @@ ISimpleGameListView::ISimpleGameListView(Window* window, FileData* root) : IGame
 void ISimpleGameListView::onThemeChanged(const std::shared_ptr<ThemeData>& theme)
 {
 	using namespace ThemeFlags;
-	mBackground.applyTheme(theme, getName(), "background", ALL);
-	mHeaderImage.applyTheme(theme, getName(), "logo", ALL);
-	mHeaderText.applyTheme(theme, getName(), "logoText", ALL);
-	mThemeExtras.setExtras(ThemeData::makeExtras(theme, getName(), mWindow));
+	if(isThemeElementChanged("background"))
+		mBackground.applyTheme(theme, getName(), "background", ALL);
+	if(isThemeElementChanged("logo"))
+		mHeaderImage.applyTheme(theme, getName(), "logo", ALL);
+	if(isThemeElementChanged("logoText"))
+		mHeaderText.applyTheme(theme, getName(), "logoText", ALL);
+	if(areThemeExtrasChanged())
+		mThemeExtras.setExtras(ThemeData::makeExtras(theme, getName(), mWindow));
 
 	if(mHeaderImage.hasImage())
 	{
@@ -42,15 +51,121 @@ void ISimpleGameListView::onThemeChanged(const std::shared_ptr<ThemeData>& theme
 	}
 }
 
+bool ISimpleGameListView::applyChange(FileData* file, FileChangeType change)
+{
+	FileData* cursor = getCursor();
+	if(change == FILE_SORTED || getEntryCount() < 0 || !cursor || !isInTree(cursor))
+		return false;
+
+	// not shown and not going to be, it's in some other folder
+	FileData* folder = cursor->getParent();
+	const int oldIndex = getEntryIndex(file);
+	if(oldIndex < 0 && (change == FILE_REMOVED || file->getParent() != folder))
+		return true;
+
+	const std::vector<FileData*> files = change == FILE_REMOVED ? std::vector<FileData*>() : getVisibleChildren(folder);
+	const int newIndex = change == FILE_REMOVED ? -1 : (int)(std::find(files.begin(), files.end(), file) - files.begin());
+	const bool shown = newIndex >= 0 && newIndex < (int)files.size();
+
+	if(shown && newIndex == oldIndex)
+	{
+		if(!updateEntry(oldIndex))
+			return false;
+	}else{
+		if(oldIndex >= 0 && !removeEntry(oldIndex))
+			return false;
+		if(shown && !insertEntry(newIndex, file))
+			return false;
+	}
+
+	// the filter letting nothing through (so everything's shown) or a sort we didn't expect, start over
+	const int expected = change == FILE_REMOVED ? (int)getVisibleChildren(folder).size() : (int)files.size();
+	if(getEntryCount() != expected)
+		return false;
+
+	if(getCursor() != cursor)
+		setCursor(cursor);
+	return true;
+}
+
 void ISimpleGameListView::onFileChanged(FileData* file, FileChangeType change)
 {
-	// we could be tricky here to be efficient;
-	// but this shouldn't happen very often so we'll just always repopulate
+	// the filter and sort look at metadata, which the projection can't see change
+	if(change == FILE_METADATA_CHANGED)
+		mProjection.invalidate();
+
+	// most changes are a single entry, only redo the whole list when that doesn't work out
+	if(applyChange(file, change))
+		return;
+
+	FileData* cursor = getCursor();
+
+	if(change == FILE_REMOVED && !isInTree(cursor))
+	{
+		// the cursor (or a folder leading up to it) is gone, back out to the closest folder that still has something in it
+		while(!mCursorStack.empty() && (!isInTree(mCursorStack.top()) || mCursorStack.top()->getChildren().empty()))
+			mCursorStack.pop();
+
+		FileData* folder = mCursorStack.empty() ? mRoot : mCursorStack.top();
+		if(folder->getChildren().empty())
+			return;
+
+		cursor = folder->getChildren().front();
+	}
+
+	populateList(getVisibleChildren(cursor->getParent()));
+	setCursor(cursor);
+}
+
+void ISimpleGameListView::setFilter(FileData::FilterFunction* filter)
+{
+	if(filter == mFilter)
+		return;
+
+	IGameListView::setFilter(filter);
+
+	FileData* cursor = getCursor();
+	populateList(getVisibleChildren(cursor->getParent()));
+	setCursor(cursor);
+}
+
+void ISimpleGameListView::setSort(const FileData::SortType* sort)
+{
+	if(sort == mSort)
+		return;
+
+	IGameListView::setSort(sort);
+
 	FileData* cursor = getCursor();
-	populateList(cursor->getParent()->getChildren());
+	populateList(getVisibleChildren(cursor->getParent()));
 	setCursor(cursor);
 }
 
+std::vector<FileData*> ISimpleGameListView::getVisibleChildren(FileData* folder)
+{
+	mProjection.setFolder(folder);
+	mProjection.setFilter(mFilter);
+	mProjection.setSort(mSort ? mSort->comparisonFunction : NULL, mSort ? mSort->ascending : true);
+
+	// an empty list has no cursor, and nothing would get us out of it
+	if(mProjection.size() == 0)
+	{
+		mProjection.setFilter(NULL);
+		if(mProjection.size() == 0)
+			return folder->getChildren();
+	}
+
+	return mProjection.getFiles();
+}
+
+bool ISimpleGameListView::isInTree(FileData* file) const
+{
+	while(file && file != mRoot)
+		file = file->getParent();
+
+	return file == mRoot;
+}
+
 bool ISimpleGameListView::input(InputConfig* config, Input input)
 {
 	if(input.value != 0)
@@ -67,7 +182,7 @@ bool ISimpleGameListView::input(InputConfig* config, Input input)
 				if(cursor->getChildren().size() > 0)
 				{
 					mCursorStack.push(cursor);
-					populateList(cursor->getChildren());
+					populateList(getVisibleChildren(cursor));
 				}
 			}
 				
@@ -76,7 +191,7 @@ bool ISimpleGameListView::input(InputConfig* config, Input input)
 		{
 			if(mCursorStack.size())
 			{
-				populateList(mCursorStack.top()->getParent()->getChildren());
+				populateList(getVisibleChildren(mCursorStack.top()->getParent()));
 				setCursor(mCursorStack.top());
 				mCursorStack.pop();
 				Sound::getFromTheme(getTheme(), getName(), "back")->play();
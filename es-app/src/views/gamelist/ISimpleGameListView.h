@@ -1,6 +1,7 @@
 #pragma once
 
 #include "views/gamelist/IGameListView.h"
+#include "FileProjection.h"
 
 #include "components/TextComponent.h"
 #include "components/ImageComponent.h"
@@ -22,12 +23,31 @@ public:
 	virtual FileData* getCursor() = 0;
 	virtual void setCursor(FileData*) = 0;
 
+	virtual void setFilter(FileData::FilterFunction* filter) override;
+	virtual void setSort(const FileData::SortType* sort) override;
+
 	virtual bool input(InputConfig* config, Input input) override;
 
 protected:
 	virtual void populateList(const std::vector<FileData*>& files) = 0;
+
+	// Targeted versions of populateList() for onFileChanged(), a view that doesn't have them just gets repopulated.
+	virtual int getEntryIndex(FileData* file) { return -1; } // -1 if it isn't shown
+	virtual int getEntryCount() { return -1; }
+	virtual bool insertEntry(int index, FileData* file) { return false; }
+	virtual bool removeEntry(int index) { return false; }
+	virtual bool updateEntry(int index) { return false; } // its name or metadata changed
 	virtual void launch(FileData* game) = 0;
 
+	// false if file (or a folder leading up to it) has been removed from our root
+	bool isInTree(FileData* file) const;
+
+	// Applies a single change to the entries shown, false if it has to be repopulated instead.
+	bool applyChange(FileData* file, FileChangeType change);
+
+	// What we show of folder: its children through mFilter in mSort's order, or all of them if the filter doesn't leave any.
+	std::vector<FileData*> getVisibleChildren(FileData* folder);
+
 	TextComponent mHeaderText;
 	ImageComponent mHeaderImage;
 	ImageComponent mBackground;
@@ -35,4 +55,6 @@ protected:
 	ThemeExtras mThemeExtras;
 
 	std::stack<FileData*> mCursorStack;
+
+	FileProjection mProjection; // of the folder last shown
 };
@@ -0,0 +1,302 @@
+#include "LibraryGenerator.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <ctype.h>
+#include <boost/filesystem.hpp>
+
+namespace fs = boost::filesystem;
+
+static const char* WORDS[] = { "dragon", "quest", "super", "mega", "fighter", "street", "legend", "zelda", "mario", "sonic",
+	"final", "fantasy", "castle", "metal", "gear", "star", "ocean", "chrono", "trigger", "donkey", "kong", "world", "turbo", "racing" };
+static const unsigned int WORD_COUNT = sizeof(WORDS) / sizeof(WORDS[0]);
+
+// what scraped titles have besides words, and what has to be escaped in the gamelists
+static const char* TITLE_EXTRAS[] = { ": The Lost Levels", " & Knuckles", " II", " (USA)", " (Europe) (Rev 1)", " - Director's Cut" };
+static const unsigned int TITLE_EXTRA_COUNT = sizeof(TITLE_EXTRAS) / sizeof(TITLE_EXTRAS[0]);
+
+// real theme names, so a theme set draws the systems like the real ones
+static const char* THEMES[] = { "nes", "snes", "megadrive", "n64", "psx", "gba", "mame", "atari2600", "pcengine", "mastersystem" };
+static const unsigned int THEME_COUNT = sizeof(THEMES) / sizeof(THEMES[0]);
+
+// same sequence every run, so results are comparable
+static unsigned int sSeed = 12345;
+
+void LibraryGenerator::setSeed(unsigned int seed)
+{
+	sSeed = seed;
+}
+
+unsigned int LibraryGenerator::nextRandom()
+{
+	sSeed = sSeed * 1103515245 + 12345;
+	return (sSeed >> 16) & 0x7FFF;
+}
+
+LibraryGenerator::Options::Options() : systems(10), gamesPerSystem(1000), depth(0), foldersPerLevel(4), descriptionWords(80),
+	createRoms(true), imageWidth(0), imageHeight(0), imageEvery(1), imageFormat(FIF_PNG)
+{
+}
+
+bool LibraryGenerator::getPreset(const std::string& name, Options& options)
+{
+	if(name == "1k")
+	{
+		options.systems = 4;
+		options.gamesPerSystem = 250;
+	}else if(name == "10k")
+	{
+		options.systems = 10;
+		options.gamesPerSystem = 1000;
+	}else if(name == "100k")
+	{
+		// a few huge systems (arcade sets) are what people with this many have
+		options.systems = 20;
+		options.gamesPerSystem = 5000;
+	}else{
+		return false;
+	}
+
+	return true;
+}
+
+std::string LibraryGenerator::randomTitle(unsigned int index)
+{
+	std::string title;
+	const unsigned int words = 2 + nextRandom() % 3;
+	for(unsigned int w = 0; w < words; w++)
+	{
+		std::string word = WORDS[nextRandom() % WORD_COUNT];
+		word[0] = (char)toupper(word[0]);
+		title += (w ? " " : "") + word;
+	}
+	return title + " " + std::to_string(index);
+}
+
+std::string LibraryGenerator::randomDescription(unsigned int words)
+{
+	std::string desc;
+	for(unsigned int w = 0; w < words; w++)
+		desc += std::string(w ? " " : "") + WORDS[nextRandom() % WORD_COUNT] + ((w % 12 == 11) ? "." : "");
+	return desc;
+}
+
+static std::string escapeXml(const std::string& str)
+{
+	std::string out;
+	out.reserve(str.size());
+	for(unsigned int i = 0; i < str.size(); i++)
+	{
+		switch(str[i])
+		{
+		case '&': out += "&amp;"; break;
+		case '<': out += "&lt;"; break;
+		case '>': out += "&gt;"; break;
+		case '"': out += "&quot;"; break;
+		case '\'': out += "&apos;"; break;
+		default: out += str[i]; break;
+		}
+	}
+	return out;
+}
+
+void LibraryGenerator::writeGamelist(const std::string& path, unsigned int count)
+{
+	std::ofstream out(path.c_str(), std::ios::out | std::ios::trunc);
+	out << "<?xml version=\"1.0\"?>\n<gameList>\n";
+	for(unsigned int i = 0; i < count; i++)
+	{
+		const std::string title = randomTitle(i);
+		out << "\t<game>\n"
+			<< "\t\t<path>./" << title << ".zip</path>\n"
+			<< "\t\t<name>" << title << "</name>\n"
+			<< "\t\t<desc>" << randomDescription(40) << "</desc>\n"
+			<< "\t\t<image>./images/" << title << "-image.png</image>\n"
+			<< "\t\t<rating>0." << (nextRandom() % 10) << "</rating>\n"
+			<< "\t\t<releasedate>19" << (80 + nextRandom() % 20) << "0101T000000</releasedate>\n"
+			<< "\t\t<developer>" << WORDS[nextRandom() % WORD_COUNT] << " soft</developer>\n"
+			<< "\t\t<publisher>" << WORDS[nextRandom() % WORD_COUNT] << " games</publisher>\n"
+			<< "\t\t<genre>" << WORDS[nextRandom() % WORD_COUNT] << "</genre>\n"
+			<< "\t\t<players>" << (1 + nextRandom() % 4) << "</players>\n"
+			<< "\t\t<playcount>" << (nextRandom() % 50) << "</playcount>\n"
+			<< "\t\t<lastplayed>2016" << (10 + nextRandom() % 3) << "01T120000</lastplayed>\n"
+			<< "\t</game>\n";
+	}
+	out << "</gameList>\n";
+}
+
+std::vector<unsigned char> LibraryGenerator::encodeImage(FREE_IMAGE_FORMAT format, unsigned int width, unsigned int height)
+{
+	FIBITMAP* bitmap = FreeImage_Allocate(width, height, 24);
+	for(unsigned int y = 0; y < height; y++)
+	{
+		BYTE* line = FreeImage_GetScanLine(bitmap, y);
+		for(unsigned int x = 0; x < width; x++)
+		{
+			// gradients plus some noise, so it doesn't compress to nothing
+			line[x * 3 + 0] = (BYTE)(x * 255 / width);
+			line[x * 3 + 1] = (BYTE)(y * 255 / height);
+			line[x * 3 + 2] = (BYTE)(nextRandom() & 0x3F);
+		}
+	}
+
+	FIMEMORY* memory = FreeImage_OpenMemory();
+	FreeImage_SaveToMemory(format, bitmap, memory, format == FIF_JPEG ? JPEG_QUALITYGOOD : 0);
+
+	BYTE* data = NULL;
+	DWORD size = 0;
+	FreeImage_AcquireMemory(memory, &data, &size);
+	std::vector<unsigned char> encoded(data, data + size);
+
+	FreeImage_CloseMemory(memory);
+	FreeImage_Unload(bitmap);
+	return encoded;
+}
+
+// the folders games go in, relative to the start path ("" if depth is 0)
+static std::vector<std::string> getLeafFolders(unsigned int depth, unsigned int foldersPerLevel)
+{
+	std::vector<std::string> folders(1, "");
+	for(unsigned int level = 0; level < depth; level++)
+	{
+		std::vector<std::string> next;
+		for(auto it = folders.begin(); it != folders.end(); it++)
+		{
+			for(unsigned int i = 0; i < foldersPerLevel; i++)
+				next.push_back(*it + (it->empty() ? "" : "/") + "Folder " + std::to_string(level + 1) + "-" + std::to_string(i + 1));
+		}
+		folders.swap(next);
+	}
+	return folders;
+}
+
+static bool writeFile(const fs::path& path, const unsigned char* data, size_t size)
+{
+	std::ofstream out(path.string().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if(!out.is_open())
+	{
+		std::cerr << "Could not write " << path.string() << std::endl;
+		return false;
+	}
+	out.write((const char*)data, size);
+	return true;
+}
+
+static bool generateSystem(const fs::path& startPath, const LibraryGenerator::Options& options)
+{
+	typedef LibraryGenerator G;
+
+	boost::system::error_code ec;
+	fs::create_directories(startPath, ec);
+
+	const std::vector<std::string> leaves = getLeafFolders(options.depth, options.foldersPerLevel);
+	const bool images = options.imageWidth > 0 && options.imageHeight > 0;
+	const std::string imageExt = options.imageFormat == FIF_JPEG ? ".jpg" : ".png";
+	if(images)
+		fs::create_directories(startPath / "images", ec);
+
+	std::ofstream out((startPath / "gamelist.xml").string().c_str(), std::ios::out | std::ios::trunc);
+	if(!out.is_open())
+	{
+		std::cerr << "Could not write " << (startPath / "gamelist.xml").string() << std::endl;
+		return false;
+	}
+	out << "<?xml version=\"1.0\"?>\n<gameList>\n";
+
+	// every folder on the way to the leaves, scraped folders have metadata too
+	for(unsigned int level = 1; level <= options.depth; level++)
+	{
+		const std::vector<std::string> folders = getLeafFolders(level, options.foldersPerLevel);
+		for(auto it = folders.begin(); it != folders.end(); it++)
+		{
+			fs::create_directories(startPath / *it, ec);
+			out << "\t<folder>\n"
+				<< "\t\t<path>./" << escapeXml(*it) << "</path>\n"
+				<< "\t\t<name>" << escapeXml(fs::path(*it).filename().string()) << "</name>\n"
+				<< "\t\t<desc>" << G::randomDescription(10 + G::nextRandom() % 20) << "</desc>\n"
+				<< "\t</folder>\n";
+		}
+	}
+
+	for(unsigned int i = 0; i < options.gamesPerSystem; i++)
+	{
+		std::string title = G::randomTitle(i);
+		if(G::nextRandom() % 4 == 0)
+			title += TITLE_EXTRAS[G::nextRandom() % TITLE_EXTRA_COUNT];
+
+		const std::string& folder = leaves.at(i % leaves.size());
+		const std::string romPath = (folder.empty() ? "" : folder + "/") + title + ".zip";
+		if(options.createRoms && !writeFile(startPath / romPath, NULL, 0))
+			return false;
+
+		const unsigned int words = options.descriptionWords / 2 + (options.descriptionWords ? G::nextRandom() % (options.descriptionWords + 1) : 0);
+		out << "\t<game>\n"
+			<< "\t\t<path>./" << escapeXml(romPath) << "</path>\n"
+			<< "\t\t<name>" << escapeXml(title) << "</name>\n"
+			<< "\t\t<desc>" << G::randomDescription(words) << "</desc>\n";
+
+		if(images && i % std::max(1u, options.imageEvery) == 0)
+		{
+			const std::string imagePath = "images/" + std::to_string(i) + "-image" + imageExt;
+			const std::vector<unsigned char> image = G::encodeImage(options.imageFormat, options.imageWidth, options.imageHeight);
+			if(!writeFile(startPath / imagePath, image.data(), image.size()))
+				return false;
+			out << "\t\t<image>./" << imagePath << "</image>\n";
+		}
+
+		out << "\t\t<rating>0." << (G::nextRandom() % 10) << "</rating>\n"
+			<< "\t\t<releasedate>19" << (80 + G::nextRandom() % 20) << std::setw(2) << std::setfill('0') << (1 + G::nextRandom() % 12)
+				<< "01T000000</releasedate>\n"
+			<< "\t\t<developer>" << escapeXml(G::randomTitle(G::nextRandom() % 100)) << " Soft</developer>\n"
+			<< "\t\t<publisher>" << escapeXml(G::randomTitle(G::nextRandom() % 100)) << " Games</publisher>\n"
+			<< "\t\t<genre>" << WORDS[G::nextRandom() % WORD_COUNT] << "</genre>\n"
+			<< "\t\t<players>" << (1 + G::nextRandom() % 4) << "</players>\n";
+
+		// most games were never played
+		if(G::nextRandom() % 3 == 0)
+		{
+			out << "\t\t<playcount>" << (1 + G::nextRandom() % 50) << "</playcount>\n"
+				<< "\t\t<lastplayed>2016" << std::setw(2) << std::setfill('0') << (1 + G::nextRandom() % 12) << "01T120000</lastplayed>\n";
+		}
+		out << "\t</game>\n";
+	}
+
+	out << "</gameList>\n";
+	return out.good();
+}
+
+bool LibraryGenerator::generate(const std::string& root, const Options& options)
+{
+	const fs::path rootPath = fs::absolute(root);
+	boost::system::error_code ec;
+	fs::create_directories(rootPath / ".emulationstation", ec);
+
+	std::ofstream config((rootPath / ".emulationstation" / "es_systems.cfg").string().c_str(), std::ios::out | std::ios::trunc);
+	if(!config.is_open())
+	{
+		std::cerr << "Could not write " << (rootPath / ".emulationstation" / "es_systems.cfg").string() << std::endl;
+		return false;
+	}
+
+	config << "<?xml version=\"1.0\"?>\n<systemList>\n";
+	for(unsigned int s = 0; s < options.systems; s++)
+	{
+		const std::string name = "synth" + std::to_string(s + 1);
+		const fs::path startPath = rootPath / "roms" / name;
+		if(!generateSystem(startPath, options))
+			return false;
+
+		config << "\t<system>\n"
+			<< "\t\t<name>" << name << "</name>\n"
+			<< "\t\t<fullname>Synthetic System " << (s + 1) << "</fullname>\n"
+			<< "\t\t<path>" << escapeXml(startPath.generic_string()) << "</path>\n"
+			<< "\t\t<extension>.zip</extension>\n"
+			<< "\t\t<command>true %ROM%</command>\n"
+			<< "\t\t<theme>" << THEMES[s % THEME_COUNT] << "</theme>\n"
+			<< "\t</system>\n";
+	}
+	config << "</systemList>\n";
+
+	return config.good();
+}
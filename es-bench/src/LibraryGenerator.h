@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <FreeImage.h>
+
+// Fake game libraries, for benchmarks and for reproducing problems that only show up with a lot of games: an
+// es_systems.cfg, ROM trees and gamelist.xml files with metadata about as long as scraped ones, and optionally images.
+// Everything comes from one seeded generator, so the same options always give the same library.
+class LibraryGenerator
+{
+public:
+	struct Options
+	{
+		Options();
+
+		unsigned int systems;
+		unsigned int gamesPerSystem;
+		unsigned int depth; // folder levels below each system's start path, the games are spread over the deepest ones
+		unsigned int foldersPerLevel;
+		unsigned int descriptionWords; // on average, they vary between half and one and a half times this
+		bool createRoms; // empty ROM files next to the gamelist entries, only --gamelist-only works without them
+		unsigned int imageWidth; // 0 for no images
+		unsigned int imageHeight;
+		unsigned int imageEvery; // one game in this many gets an image
+		FREE_IMAGE_FORMAT imageFormat; // FIF_PNG or FIF_JPEG
+	};
+
+	// Fills in a scenario by name ("1k", "10k" or "100k" games in total), returns false for any other name.
+	static bool getPreset(const std::string& name, Options& options);
+
+	// Writes root/.emulationstation/es_systems.cfg (so root can be used as HOME) and a tree per system under root/roms.
+	// Returns false if something couldn't be written.
+	static bool generate(const std::string& root, const Options& options);
+
+	// building blocks of the above, for benchmarks that make their own data
+	static void setSeed(unsigned int seed);
+	static unsigned int nextRandom(); // 0 - 0x7FFF
+	static std::string randomTitle(unsigned int index);
+	static std::string randomDescription(unsigned int words);
+	static void writeGamelist(const std::string& path, unsigned int count); // count games in one folder
+	static std::vector<unsigned char> encodeImage(FREE_IMAGE_FORMAT format, unsigned int width, unsigned int height);
+};
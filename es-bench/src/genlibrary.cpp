@@ -0,0 +1,116 @@
+// es-genlibrary: writes a fake game library for performance testing.
+// Usage: es-genlibrary [options] <directory>, then run ES with HOME=<directory> (e.g. with --benchmark-ui).
+
+#include <iostream>
+#include <string>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <FreeImage.h>
+#include "LibraryGenerator.h"
+
+static void printUsage()
+{
+	std::cout << "Usage: es-genlibrary [options] <directory>\n"
+		"Writes <directory>/.emulationstation/es_systems.cfg and a ROM tree with a gamelist.xml per system under\n"
+		"<directory>/roms, then run emulationstation with HOME=<directory>.\n\n"
+		"--preset [1k/10k/100k]		games in total, spread over a typical number of systems (default: 10k)\n"
+		"--systems [n]			number of systems\n"
+		"--games [n]			games per system\n"
+		"--depth [n]			folder levels in each system, games go in the deepest ones (default: 0)\n"
+		"--folders [n]			folders per level (default: 4)\n"
+		"--desc-words [n]		average description length (default: 80)\n"
+		"--images [width] [height]	give games images of this size (default: none)\n"
+		"--image-every [n]		only give every nth game an image (default: 1)\n"
+		"--image-format [png/jpg]	(default: png)\n"
+		"--no-roms			don't create the ROM files, for --gamelist-only\n"
+		"--seed [n]			start the generator somewhere else\n";
+}
+
+int main(int argc, char* argv[])
+{
+	LibraryGenerator::Options options;
+	std::string root;
+
+	for(int i = 1; i < argc; i++)
+	{
+		const bool hasValue = i + 1 < argc;
+		if(strcmp(argv[i], "--preset") == 0 && hasValue)
+		{
+			if(!LibraryGenerator::getPreset(argv[++i], options))
+			{
+				std::cerr << "Unknown preset \"" << argv[i] << "\"\n";
+				return 1;
+			}
+		}else if(strcmp(argv[i], "--systems") == 0 && hasValue)
+		{
+			options.systems = atoi(argv[++i]);
+		}else if(strcmp(argv[i], "--games") == 0 && hasValue)
+		{
+			options.gamesPerSystem = atoi(argv[++i]);
+		}else if(strcmp(argv[i], "--depth") == 0 && hasValue)
+		{
+			options.depth = atoi(argv[++i]);
+		}else if(strcmp(argv[i], "--folders") == 0 && hasValue)
+		{
+			options.foldersPerLevel = atoi(argv[++i]);
+		}else if(strcmp(argv[i], "--desc-words") == 0 && hasValue)
+		{
+			options.descriptionWords = atoi(argv[++i]);
+		}else if(strcmp(argv[i], "--images") == 0 && i + 2 < argc)
+		{
+			options.imageWidth = atoi(argv[i + 1]);
+			options.imageHeight = atoi(argv[i + 2]);
+			i += 2;
+		}else if(strcmp(argv[i], "--image-every") == 0 && hasValue)
+		{
+			options.imageEvery = atoi(argv[++i]);
+		}else if(strcmp(argv[i], "--image-format") == 0 && hasValue)
+		{
+			const std::string format = argv[++i];
+			options.imageFormat = (format == "jpg" || format == "jpeg") ? FIF_JPEG : FIF_PNG;
+		}else if(strcmp(argv[i], "--no-roms") == 0)
+		{
+			options.createRoms = false;
+		}else if(strcmp(argv[i], "--seed") == 0 && hasValue)
+		{
+			LibraryGenerator::setSeed(atoi(argv[++i]));
+		}else if(strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0)
+		{
+			printUsage();
+			return 0;
+		}else if(argv[i][0] != '-' && root.empty())
+		{
+			root = argv[i];
+		}else{
+			std::cerr << "Unknown option " << argv[i] << "\n\n";
+			printUsage();
+			return 1;
+		}
+	}
+
+	if(root.empty())
+	{
+		printUsage();
+		return 1;
+	}
+
+	// 4 folders 8 levels deep is 65536 of them already, anything beyond that is a typo
+	if(options.depth > 8 || options.foldersPerLevel == 0)
+	{
+		std::cerr << "--depth can be 8 at most and --folders at least 1\n";
+		return 1;
+	}
+
+	std::cout << "Writing " << options.systems << " systems with " << options.gamesPerSystem << " games each to " << root << "..." << std::endl;
+
+	FreeImage_Initialise();
+	const bool ok = LibraryGenerator::generate(root, options);
+	FreeImage_DeInitialise();
+
+	if(!ok)
+		return 1;
+
+	std::cout << "Done, run it with HOME=" << root << " emulationstation" << std::endl;
+	return 0;
+}
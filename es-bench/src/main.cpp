@@ -0,0 +1,357 @@
+// es-bench: synthetic workloads for the hot data paths, reporting time and allocations per iteration.
+// Usage: es-bench [name filter]
+// Everything runs against a throwaway HOME, so the real ~/.emulationstation is never touched.
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#include <string.h>
+#include <boost/filesystem.hpp>
+#include <FreeImage.h>
+#include "SystemData.h"
+#include "FileData.h"
+#include "FileSorts.h"
+#include "Gamelist.h"
+#include "PlatformId.h"
+#include "ImageIO.h"
+#include "Renderer.h"
+#include "Settings.h"
+#include "Log.h"
+#include "platform.h"
+#include "resources/Font.h"
+#include "LibraryGenerator.h"
+
+namespace fs = boost::filesystem;
+
+extern const char* mameNameToRealName[];
+
+//-------------------------------------------------------------------------------
+// allocation counting, every operator new in the process goes through here
+
+static std::atomic<size_t> sAllocCount(0);
+static std::atomic<size_t> sAllocBytes(0);
+
+void* operator new(size_t size)
+{
+	sAllocCount++;
+	sAllocBytes += size;
+
+	void* ptr = malloc(size ? size : 1);
+	if(!ptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+	free(ptr);
+}
+
+//-------------------------------------------------------------------------------
+// runner
+
+static std::string sFilter;
+
+// Runs setup, run and teardown iterations times; only run is timed and counted.
+static void bench(const std::string& name, int iterations, const std::function<void()>& setup, const std::function<void()>& run,
+	const std::function<void()>& teardown = nullptr)
+{
+	if(!sFilter.empty() && name.find(sFilter) == std::string::npos)
+		return;
+
+	std::vector<double> times;
+	size_t allocs = 0;
+	size_t bytes = 0;
+
+	for(int i = 0; i < iterations; i++)
+	{
+		if(setup)
+			setup();
+
+		const size_t allocsBefore = sAllocCount;
+		const size_t bytesBefore = sAllocBytes;
+		const auto start = std::chrono::steady_clock::now();
+
+		run();
+
+		const auto end = std::chrono::steady_clock::now();
+		allocs += sAllocCount - allocsBefore;
+		bytes += sAllocBytes - bytesBefore;
+		times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+
+		if(teardown)
+			teardown();
+	}
+
+	std::sort(times.begin(), times.end());
+	const double median = times[times.size() / 2];
+
+	std::cout << std::left << std::setw(40) << name << std::right << std::fixed
+		<< std::setw(10) << std::setprecision(3) << median << " ms"
+		<< std::setw(10) << std::setprecision(3) << times.front() << " min"
+		<< std::setw(12) << (allocs / iterations) << " allocs"
+		<< std::setw(12) << std::setprecision(1) << (bytes / iterations / 1024.0) << " KB"
+		<< "  (" << iterations << "x)" << std::endl;
+}
+
+//-------------------------------------------------------------------------------
+// synthetic data
+
+// A system whose start path only holds a gamelist with count entries. Not loaded yet unless parse is set.
+static SystemData* createSystem(const fs::path& root, unsigned int count, bool parse)
+{
+	const std::string name = "bench" + std::to_string(count);
+	const fs::path startPath = root / name;
+	if(!fs::exists(startPath / "gamelist.xml"))
+	{
+		fs::create_directories(startPath);
+		LibraryGenerator::writeGamelist((startPath / "gamelist.xml").string(), count);
+	}
+
+	// build the system without its gamelist, so parsing can be timed on its own
+	Settings::getInstance()->setBool("IgnoreGamelist", true);
+	SystemData* system = new SystemData(name, name, startPath.string(), std::vector<std::string>(1, ".zip"), "true %ROM%",
+		std::vector<PlatformIds::PlatformId>(), name);
+	Settings::getInstance()->setBool("IgnoreGamelist", false);
+
+	if(parse)
+		parseGamelist(system);
+	return system;
+}
+
+//-------------------------------------------------------------------------------
+// workloads
+
+static void benchGamelists(const fs::path& root)
+{
+	const unsigned int sizes[] = { 10000, 50000 };
+	for(unsigned int s = 0; s < 2; s++)
+	{
+		const unsigned int count = sizes[s];
+		const std::string suffix = "/" + std::to_string(count / 1000) + "k";
+		SystemData* system = NULL;
+
+		bench("gamelist/parse" + suffix, 5,
+			[&] { system = createSystem(root, count, false); },
+			[&] { parseGamelist(system); },
+			[&] { delete system; });
+
+		// every entry changed, so the whole file gets written
+		bench("gamelist/save" + suffix, 5,
+			[&] {
+				system = createSystem(root, count, true);
+				system->getRootFolder()->visitRecursive(GAME, [](FileData* file) {
+					file->metadata.set("playcount", std::to_string(LibraryGenerator::nextRandom() % 50));
+					return true;
+				});
+			},
+			[&] {
+				updateGamelist(system);
+				flushGamelistWrites();
+			},
+			[&] { delete system; });
+	}
+}
+
+static void benchSorts(const fs::path& root)
+{
+	SystemData* system = createSystem(root, 10000, true);
+	FileData* rootFolder = system->getRootFolder();
+
+	const std::vector<FileData::SortType>& types = FileSorts::SortTypes;
+	for(unsigned int t = 0; t < types.size(); t++)
+	{
+		// start from a different order each time, sorting sorted input isn't interesting
+		const FileData::SortType& other = types.at((t + 1) % types.size());
+		bench("sort/" + types.at(t).description + "/10k", 10,
+			[&] { rootFolder->sort(other); },
+			[&] { rootFolder->sort(types.at(t)); });
+	}
+
+	delete system;
+}
+
+// whole libraries from es_systems.cfg, as on startup (the benchmark's HOME is root)
+static void benchLibraries(const fs::path& root)
+{
+	const char* presets[] = { "1k", "10k", "100k" };
+	for(unsigned int p = 0; p < 3; p++)
+	{
+		const std::string name = std::string("library/load/") + presets[p];
+		if(!sFilter.empty() && name.find(sFilter) == std::string::npos)
+			continue;
+
+		LibraryGenerator::Options options;
+		LibraryGenerator::getPreset(presets[p], options);
+		options.createRoms = false; // only the gamelists are read
+		LibraryGenerator::generate(root.string(), options);
+
+		bench(name, p < 2 ? 5 : 3, nullptr,
+			[&] { SystemData::loadConfig(); },
+			[&] { SystemData::deleteSystems(); });
+	}
+}
+
+static void benchMameNames()
+{
+	std::vector<std::string> keys;
+	for(unsigned int i = 0; mameNameToRealName[i] != NULL; i += 2)
+	{
+		if((i / 2) % 7 == 0)
+			keys.push_back(mameNameToRealName[i]);
+	}
+	// and some that aren't MAME names at all
+	for(unsigned int i = 0; i < keys.size() / 4; i++)
+		keys.push_back(LibraryGenerator::randomTitle(i));
+
+	size_t hits = 0;
+	bench("mame/getCleanMameName/" + std::to_string(keys.size()), 20, nullptr, [&] {
+		for(auto it = keys.begin(); it != keys.end(); it++)
+		{
+			if(PlatformIds::getCleanMameName(it->c_str()) != it->c_str())
+				hits++;
+		}
+	});
+}
+
+static void benchFonts()
+{
+	const std::shared_ptr<Font> font = Font::get(FONT_SIZE_SMALL);
+	const float width = Renderer::getScreenWidth() * 0.45f;
+	const std::string desc = LibraryGenerator::randomDescription(400);
+	int iteration = 0;
+
+	// a different string every time, or wrapText() would just hit its cache
+	bench("font/wrapText/400words", 20, [&] { iteration++; }, [&] {
+		font->wrapText(desc + " " + std::to_string(iteration), width);
+	});
+
+	const std::string wrapped = font->wrapText(desc, width);
+	TextCache* cache = NULL;
+	bench("font/buildTextCache/400words", 20, nullptr,
+		[&] { cache = font->buildTextCache(wrapped, 0, 0, 0xFFFFFFFF); },
+		[&] { delete cache; });
+}
+
+static void benchImages()
+{
+	const std::vector<unsigned char> png = LibraryGenerator::encodeImage(FIF_PNG, 640, 480);
+	const std::vector<unsigned char> jpeg = LibraryGenerator::encodeImage(FIF_JPEG, 1280, 960);
+	size_t width, height;
+
+	bench("imageio/png/640x480", 10, nullptr, [&] {
+		ImageIO::loadFromMemoryRGBA32(png.data(), png.size(), width, height);
+	});
+	bench("imageio/jpeg/1280x960", 10, nullptr, [&] {
+		ImageIO::loadFromMemoryRGBA32(jpeg.data(), jpeg.size(), width, height);
+	});
+	bench("imageio/jpeg/1280x960-to-320x240", 10, nullptr, [&] {
+		ImageIO::loadFromMemoryRGBA32(jpeg.data(), jpeg.size(), width, height, 320, 240);
+	});
+}
+
+// what ImageIO did before its kernels, kept here to measure them against
+static void swapRedBlueScalar(unsigned char* px, size_t pixelCount)
+{
+	for(size_t i = 0; i < pixelCount; i++)
+	{
+		unsigned char tmp = px[i * 4];
+		px[i * 4] = px[i * 4 + 2];
+		px[i * 4 + 2] = tmp;
+	}
+}
+
+static void flipPixelsVertScalar(unsigned char* px, size_t width, size_t height)
+{
+	unsigned int* arr = (unsigned int*)px;
+	for(size_t y = 0; y < height / 2; y++)
+	{
+		for(size_t x = 0; x < width; x++)
+		{
+			unsigned int temp = arr[x + (y * width)];
+			arr[x + (y * width)] = arr[x + (height * width) - ((y + 1) * width)];
+			arr[x + (height * width) - ((y + 1) * width)] = temp;
+		}
+	}
+}
+
+// ImageIO::swapRedBlue() and flipPixelsVert() against the per-pixel loops they replaced; false if they disagree
+static bool benchPixelKernels()
+{
+	const size_t width = 1920;
+	const size_t height = 1080;
+	const size_t pixels = width * height;
+	std::vector<unsigned char> source(pixels * 4);
+	for(size_t i = 0; i < source.size(); i++)
+		source[i] = (unsigned char)(i * 7 + (i >> 12));
+
+	std::vector<unsigned char> fast = source;
+	std::vector<unsigned char> scalar = source;
+	ImageIO::swapRedBlue(fast.data(), pixels);
+	swapRedBlueScalar(scalar.data(), pixels);
+	ImageIO::flipPixelsVert(fast.data(), width, height);
+	flipPixelsVertScalar(scalar.data(), width, height);
+	const bool same = (fast == scalar);
+	if(!same)
+		std::cout << "imageio kernels don't match the scalar loops!" << std::endl;
+
+	bench("imageio/swapRedBlue/1080p", 50, nullptr, [&] { ImageIO::swapRedBlue(fast.data(), pixels); });
+	bench("imageio/swapRedBlue-scalar/1080p", 50, nullptr, [&] { swapRedBlueScalar(scalar.data(), pixels); });
+	bench("imageio/flipPixelsVert/1080p", 50, nullptr, [&] { ImageIO::flipPixelsVert(fast.data(), width, height); });
+	bench("imageio/flipPixelsVert-scalar/1080p", 50, nullptr, [&] { flipPixelsVertScalar(scalar.data(), width, height); });
+	return same;
+}
+
+int main(int argc, char* argv[])
+{
+	if(argc > 1)
+		sFilter = argv[1];
+
+	// a private home, so settings, caches and the log don't end up in the real one
+	const fs::path root = fs::temp_directory_path() / fs::unique_path("es-bench-%%%%-%%%%");
+	fs::create_directories(root / ".emulationstation");
+#ifdef WIN32
+	_putenv_s("HOME", root.string().c_str());
+#else
+	setenv("HOME", root.string().c_str(), 1);
+#endif
+
+	Log::open();
+	Settings::getInstance()->setBool("LazyLoadSystems", false);
+	Settings::getInstance()->setBool("ParseGamelistOnly", true); // the games don't exist
+	Settings::getInstance()->setBool("RomCache", false);
+	FreeImage_Initialise();
+
+	benchGamelists(root);
+	benchSorts(root);
+	benchLibraries(root);
+	benchMameNames();
+	benchImages();
+	const bool kernelsMatch = benchPixelKernels();
+
+	// fonts need a GL context
+	Settings::getInstance()->setBool("Windowed", true);
+	if(Renderer::init(640, 480))
+	{
+		benchFonts();
+		Renderer::deinit();
+	}else{
+		std::cout << "(no video, skipping font benchmarks)" << std::endl;
+	}
+
+	flushGamelistWrites();
+	FreeImage_DeInitialise();
+	Log::close();
+
+	boost::system::error_code ec;
+	fs::remove_all(root, ec);
+	return kernelsMatch ? 0 : 1;
+}
@@ -0,0 +1,177 @@
+#include "AllocStats.h"
+#include "Trace.h"
+#include <stdlib.h>
+#include <new>
+#include <vector>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+#define ALLOC_SUMMARY_SCOPES 4 // busiest scopes on the overlay
+
+namespace
+{
+	// plain atomics and pointers only, all of this is used from inside operator new
+	std::atomic<uint64_t> sCount(0);
+	std::atomic<uint64_t> sBytes(0);
+	std::atomic<AllocStats::Tag*> sTags(nullptr);
+	thread_local AllocStats::Tag* sCurrentTag = nullptr;
+
+	// main thread only
+	AllocStats::Counts sLast = { 0, 0 };
+	AllocStats::Counts sWindow = { 0, 0 }; // since the last getSummary()
+	AllocStats::Counts sWorstFrame = { 0, 0 };
+	unsigned int sWindowFrames = 0;
+}
+
+AllocStats::Counts AllocStats::sLastFrame = { 0, 0 };
+
+AllocStats::Tag::Tag(const char* n) : name(n), count(0), bytes(0), next(nullptr), lastCount(0), lastBytes(0)
+{
+	frame.count = frame.bytes = 0;
+	window.count = window.bytes = 0;
+
+	Tag* head = sTags.load();
+	do
+	{
+		next = head;
+	}while(!sTags.compare_exchange_weak(head, this));
+}
+
+AllocStats::Scope::Scope(Tag* tag) : mPrevious(sCurrentTag)
+{
+	sCurrentTag = tag;
+}
+
+AllocStats::Scope::~Scope()
+{
+	sCurrentTag = mPrevious;
+}
+
+bool AllocStats::isAvailable()
+{
+#ifdef ES_ALLOC_TRACKING
+	return true;
+#else
+	return false;
+#endif
+}
+
+void AllocStats::record(size_t bytes)
+{
+	sCount.fetch_add(1, std::memory_order_relaxed);
+	sBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+	Tag* tag = sCurrentTag;
+	if(tag)
+	{
+		tag->count.fetch_add(1, std::memory_order_relaxed);
+		tag->bytes.fetch_add(bytes, std::memory_order_relaxed);
+	}
+}
+
+AllocStats::Counts AllocStats::getTotal()
+{
+	Counts total = { sCount.load(), sBytes.load() };
+	return total;
+}
+
+void AllocStats::endFrame()
+{
+	if(!isAvailable())
+		return;
+
+	const Counts total = getTotal();
+	sLastFrame.count = total.count - sLast.count;
+	sLastFrame.bytes = total.bytes - sLast.bytes;
+	sLast = total;
+
+	sWindow.count += sLastFrame.count;
+	sWindow.bytes += sLastFrame.bytes;
+	if(sLastFrame.count > sWorstFrame.count)
+		sWorstFrame = sLastFrame;
+	sWindowFrames++;
+
+	for(Tag* tag = sTags.load(); tag; tag = tag->next)
+	{
+		const uint64_t count = tag->count.load(std::memory_order_relaxed);
+		const uint64_t bytes = tag->bytes.load(std::memory_order_relaxed);
+		tag->frame.count = count - tag->lastCount;
+		tag->frame.bytes = bytes - tag->lastBytes;
+		tag->lastCount = count;
+		tag->lastBytes = bytes;
+		tag->window.count += tag->frame.count;
+		tag->window.bytes += tag->frame.bytes;
+	}
+
+	if(Trace::isEnabled())
+	{
+		Trace::addCounter("allocations", "count", (double)sLastFrame.count);
+		Trace::addCounter("allocated bytes", "bytes", (double)sLastFrame.bytes);
+		for(Tag* tag = sTags.load(); tag; tag = tag->next)
+		{
+			if(tag->frame.count)
+				Trace::addCounter("allocations by scope", tag->name, (double)tag->frame.count);
+		}
+	}
+}
+
+std::string AllocStats::getSummary()
+{
+	if(!isAvailable())
+		return "Allocations: not tracked (build with -DALLOC_TRACKING=ON)";
+
+	const unsigned int frames = std::max(1u, sWindowFrames);
+	std::stringstream ss;
+	ss << "Allocations: " << sWindow.count / frames << "/frame (" << std::fixed << std::setprecision(1)
+		<< (float)sWindow.bytes / frames / 1024.0f << "kb), worst " << sWorstFrame.count;
+
+	std::vector<Tag*> tags;
+	for(Tag* tag = sTags.load(); tag; tag = tag->next)
+	{
+		if(tag->window.count)
+			tags.push_back(tag);
+	}
+	std::sort(tags.begin(), tags.end(), [](const Tag* a, const Tag* b) { return a->window.count > b->window.count; });
+	for(unsigned int i = 0; i < tags.size() && i < ALLOC_SUMMARY_SCOPES; i++)
+		ss << (i ? ", " : "\n  ") << tags[i]->name << " " << tags[i]->window.count / frames;
+
+	// the next summary covers the frames from here
+	sWindow.count = sWindow.bytes = 0;
+	sWorstFrame.count = sWorstFrame.bytes = 0;
+	sWindowFrames = 0;
+	for(Tag* tag = sTags.load(); tag; tag = tag->next)
+		tag->window.count = tag->window.bytes = 0;
+
+	return ss.str();
+}
+
+#ifdef ES_ALLOC_TRACKING
+// malloc underneath, so counting can't recurse
+static void* trackedAlloc(size_t size)
+{
+	AllocStats::record(size);
+	void* ptr = malloc(size ? size : 1);
+	if(!ptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+
+static void* trackedAllocNothrow(size_t size)
+{
+	AllocStats::record(size);
+	return malloc(size ? size : 1);
+}
+
+void* operator new(size_t size) { return trackedAlloc(size); }
+void* operator new[](size_t size) { return trackedAlloc(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return trackedAllocNothrow(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return trackedAllocNothrow(size); }
+
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
+#endif
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <atomic>
+
+// Counts every operator new, for driving hot paths (scrolling, mixing) down to no allocations at all.
+// Only built in with -DALLOC_TRACKING=ON (which replaces the global operator new/delete), otherwise everything here
+// is a no-op and ALLOC_SCOPE compiles to nothing.
+// Allocations made inside an ALLOC_SCOPE are also counted for the innermost one on that thread. The counts show on the
+// "DrawFramerate" overlay and, while a trace is recorded, as counters in it.
+class AllocStats
+{
+public:
+	struct Counts
+	{
+		uint64_t count;
+		uint64_t bytes;
+	};
+
+	// one per ALLOC_SCOPE site, registered the first time it's reached and never freed
+	struct Tag
+	{
+		Tag(const char* name);
+
+		const char* const name;
+		std::atomic<uint64_t> count;
+		std::atomic<uint64_t> bytes;
+		Tag* next;
+
+		// main thread only, from endFrame()
+		uint64_t lastCount;
+		uint64_t lastBytes;
+		Counts frame; // allocations during the last frame
+		Counts window; // since the last getSummary()
+	};
+
+	// Makes tag the innermost scope of this thread until it goes out of scope.
+	class Scope
+	{
+	public:
+		Scope(Tag* tag);
+		~Scope();
+
+	private:
+		Tag* mPrevious;
+	};
+
+	static bool isAvailable(); // built with ALLOC_TRACKING
+
+	static void record(size_t bytes); // from operator new, thread-safe
+	static Counts getTotal(); // since startup, every thread
+
+	// Call once per frame from the main thread, takes the counts since the last call as that frame's.
+	static void endFrame();
+	static inline const Counts& getLastFrame() { return sLastFrame; }
+
+	// Per frame average and worst since the last call, with the busiest scopes, for the framerate overlay.
+	static std::string getSummary();
+
+private:
+	static Counts sLastFrame;
+};
+
+#ifdef ES_ALLOC_TRACKING
+#define ALLOC_CONCAT_(a, b) a##b
+#define ALLOC_CONCAT(a, b) ALLOC_CONCAT_(a, b)
+#define ALLOC_SCOPE(name) static AllocStats::Tag ALLOC_CONCAT(allocTag, __LINE__)(name); \
+	AllocStats::Scope ALLOC_CONCAT(allocScope, __LINE__)(&ALLOC_CONCAT(allocTag, __LINE__))
+#else
+#define ALLOC_SCOPE(name)
+#endif
@@ -0,0 +1,77 @@
+#include "AsyncIO.h"
+#include <thread>
+
+// threads stuck in a hung mount don't come back, past this many new jobs wait for one that does
+#define ASYNC_IO_MAX_THREADS 8
+
+AsyncIO* AsyncIO::getInstance()
+{
+	// never deleted, a thread stuck in a hung mount can outlive main()
+	static AsyncIO* instance = new AsyncIO();
+	return instance;
+}
+
+AsyncIO::AsyncIO() : mThreads(0), mIdle(0)
+{
+}
+
+void AsyncIO::queue(const std::shared_ptr<Task>& task)
+{
+	// called with mMutex held
+	mTasks.push_back(task);
+
+	if(mTasks.size() > mIdle && mThreads < ASYNC_IO_MAX_THREADS)
+	{
+		mThreads++;
+		mIdle++;
+		std::thread(&AsyncIO::runWorker, this).detach();
+	}
+
+	mCondition.notify_one();
+}
+
+bool AsyncIO::run(const std::function<void()>& job, std::chrono::steady_clock::time_point deadline)
+{
+	// already too late, don't leave another job behind
+	if(std::chrono::steady_clock::now() >= deadline)
+		return false;
+
+	std::shared_ptr<Task> task = std::make_shared<Task>();
+	task->job = job;
+	task->done = false;
+
+	std::unique_lock<std::mutex> lock(mMutex);
+	queue(task);
+	return task->finished.wait_until(lock, deadline, [&task] { return task->done; });
+}
+
+void AsyncIO::post(const std::function<void()>& job)
+{
+	std::shared_ptr<Task> task = std::make_shared<Task>();
+	task->job = job;
+	task->done = false;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	queue(task);
+}
+
+void AsyncIO::runWorker()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+	while(true)
+	{
+		mCondition.wait(lock, [this] { return !mTasks.empty(); });
+
+		std::shared_ptr<Task> task = mTasks.front();
+		mTasks.pop_front();
+		mIdle--;
+
+		lock.unlock();
+		task->job();
+		lock.lock();
+
+		task->done = true;
+		task->finished.notify_all();
+		mIdle++;
+	}
+}
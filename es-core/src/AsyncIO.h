@@ -0,0 +1,42 @@
+#pragma once
+
+#include <functional>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+
+// A few threads for filesystem calls that might not come back for a long time (a hung NFS/SMB mount), so whoever
+// wants the result can stop waiting for it. A job that was given up on still runs to the end on its own (if it ever
+// gets there), so it has to own everything it touches: capture by value or through a shared_ptr, never the caller's stack.
+class AsyncIO
+{
+public:
+	static AsyncIO* getInstance();
+
+	// Runs job on an I/O thread and waits for it until deadline, false if it isn't done by then.
+	bool run(const std::function<void()>& job, std::chrono::steady_clock::time_point deadline);
+
+	// Runs job on an I/O thread without waiting for it.
+	void post(const std::function<void()>& job);
+
+private:
+	AsyncIO();
+
+	struct Task
+	{
+		std::function<void()> job;
+		bool done; // guarded by mMutex
+		std::condition_variable finished;
+	};
+
+	void queue(const std::shared_ptr<Task>& task);
+	void runWorker();
+
+	std::mutex mMutex;
+	std::condition_variable mCondition;
+	std::deque< std::shared_ptr<Task> > mTasks;
+	unsigned int mThreads;
+	unsigned int mIdle;
+};
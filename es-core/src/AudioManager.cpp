@@ -2,53 +2,172 @@
 
 #include <SDL.h>
 #include "Log.h"
+#include "AllocStats.h"
+#include "MusicStream.h"
 
-std::vector<std::shared_ptr<Sound>> AudioManager::sSoundVector;
 SDL_AudioSpec AudioManager::sAudioFormat;
 std::shared_ptr<AudioManager> AudioManager::sInstance;
 
+AudioManager::Command AudioManager::sCommands[AUDIO_COMMAND_QUEUE_SIZE];
+std::atomic<unsigned int> AudioManager::sCommandRead(0);
+std::atomic<unsigned int> AudioManager::sCommandWrite(0);
+AudioManager::Voice AudioManager::sVoices[AUDIO_MAX_VOICES];
+Sint32 AudioManager::sMixBuffer[AUDIO_MIX_CHUNK_SAMPLES];
+MusicStream* AudioManager::sMusic = NULL;
+bool AudioManager::sPaused = true;
 
-void AudioManager::mixAudio(void *unused, Uint8 *stream, int len)
+
+void AudioManager::pushCommand(CommandType type, const Sound* sound, const Sint16* data, Uint32 length, int gain, MusicStream* music)
 {
-	bool stillPlaying = false;
+	const unsigned int write = sCommandWrite.load(std::memory_order_relaxed);
+	if(write - sCommandRead.load(std::memory_order_acquire) >= AUDIO_COMMAND_QUEUE_SIZE)
+	{
+		// the mixer isn't running (paused or closed), nothing would hear it anyway
+		LOG(LogWarning) << "AudioManager - command queue full, dropping command";
+		return;
+	}
 
-	//initialize the buffer to "silence"
-	SDL_memset(stream, 0, len);
+	Command& cmd = sCommands[write % AUDIO_COMMAND_QUEUE_SIZE];
+	cmd.type = type;
+	cmd.sound = sound;
+	cmd.music = music;
+	cmd.data = data;
+	cmd.length = length;
+	cmd.gain = gain;
+
+	// publishes the command
+	sCommandWrite.store(write + 1, std::memory_order_release);
+}
+
+void AudioManager::processCommands()
+{
+	const unsigned int write = sCommandWrite.load(std::memory_order_acquire);
+	unsigned int read = sCommandRead.load(std::memory_order_relaxed);
 
-	//iterate through all our samples
-	std::vector<std::shared_ptr<Sound>>::const_iterator soundIt = sSoundVector.cbegin();
-	while (soundIt != sSoundVector.cend())
+	for(; read != write; read++)
 	{
-		std::shared_ptr<Sound> sound = *soundIt;
-		if(sound->isPlaying())
+		const Command& cmd = sCommands[read % AUDIO_COMMAND_QUEUE_SIZE];
+		switch(cmd.type)
 		{
-			//calculate rest length of current sample
-			Uint32 restLength = (sound->getLength() - sound->getPosition());
-			if (restLength > (Uint32)len) {
-				//if stream length is smaller than smaple lenght, clip it
-				restLength = len;
+		case CMD_PLAY:
+			{
+				// playing a sound again rewinds it, otherwise take a free voice (or the one furthest along)
+				Voice* voice = NULL;
+				for(int i = 0; i < AUDIO_MAX_VOICES && voice == NULL; i++)
+				{
+					if(sVoices[i].sound == cmd.sound)
+						voice = &sVoices[i];
+				}
+				for(int i = 0; i < AUDIO_MAX_VOICES && voice == NULL; i++)
+				{
+					if(sVoices[i].sound == NULL)
+						voice = &sVoices[i];
+				}
+				if(voice == NULL)
+				{
+					voice = &sVoices[0];
+					for(int i = 1; i < AUDIO_MAX_VOICES; i++)
+					{
+						if(sVoices[i].position > voice->position)
+							voice = &sVoices[i];
+					}
+				}
+
+				voice->sound = cmd.sound;
+				voice->data = cmd.data;
+				voice->length = cmd.length;
+				voice->position = 0;
+				voice->gain = cmd.gain;
 			}
-			//mix sample into stream
-			SDL_MixAudio(stream, &(sound->getData()[sound->getPosition()]), restLength, SDL_MIX_MAXVOLUME);
-			if (sound->getPosition() + restLength < sound->getLength())
+			break;
+
+		case CMD_STOP:
+			for(int i = 0; i < AUDIO_MAX_VOICES; i++)
 			{
-				//sample hasn't ended yet
-				stillPlaying = true;
+				if(sVoices[i].sound == cmd.sound)
+					sVoices[i].sound = NULL;
 			}
-			//set new sound position. if this is at or beyond the end of the sample, it will stop automatically
-			sound->setPosition(sound->getPosition() + restLength);
+			break;
+
+		case CMD_STOP_ALL:
+			for(int i = 0; i < AUDIO_MAX_VOICES; i++)
+				sVoices[i].sound = NULL;
+			break;
+
+		case CMD_MUSIC:
+			sMusic = cmd.music;
+			break;
 		}
-		//advance to next sound
-		++soundIt;
 	}
 
-	//we have processed all samples. check if some will still be playing
-	if (!stillPlaying) {
-		//no. pause audio till a Sound::play() wakes us up
-		SDL_PauseAudio(1);
+	// frees the slots for the UI thread
+	sCommandRead.store(read, std::memory_order_release);
+}
+
+// Plain loops over restrict pointers with no branches inside, so the compiler vectorizes them
+// (SSE2 on x86, NEON on ARM with -O2/-O3 -ftree-vectorize) without us writing intrinsics for every target.
+void AudioManager::mixVoice(Sint32* __restrict out, const Sint16* __restrict in, int gain, Uint32 count)
+{
+	if(gain == AUDIO_GAIN_ONE)
+	{
+		for(Uint32 i = 0; i < count; i++)
+			out[i] += in[i];
+	}else{
+		for(Uint32 i = 0; i < count; i++)
+			out[i] += (in[i] * gain) >> 8;
 	}
 }
 
+void AudioManager::mixAudio(void *unused, Uint8 *stream, int len)
+{
+	ALLOC_SCOPE("mixAudio");
+
+	processCommands();
+
+	Sint16* out = (Sint16*)stream;
+	Uint32 samples = len / sizeof(Sint16);
+
+	while(samples > 0)
+	{
+		const Uint32 count = samples < AUDIO_MIX_CHUNK_SAMPLES ? samples : AUDIO_MIX_CHUNK_SAMPLES;
+		SDL_memset(sMixBuffer, 0, count * sizeof(Sint32));
+
+		//sum up all playing voices at full precision
+		for(int i = 0; i < AUDIO_MAX_VOICES; i++)
+		{
+			Voice& voice = sVoices[i];
+			if(voice.sound == NULL)
+				continue;
+
+			Uint32 rest = voice.length - voice.position;
+			if(rest > count)
+				rest = count;
+
+			mixVoice(sMixBuffer, voice.data + voice.position, voice.gain, rest);
+
+			voice.position += rest;
+			if(voice.position >= voice.length)
+				voice.sound = NULL;
+		}
+
+		if(sMusic)
+			sMusic->mix(sMixBuffer, count);
+
+		//clamp once at the end instead of saturating after every voice
+		for(Uint32 i = 0; i < count; i++)
+		{
+			const Sint32 s = sMixBuffer[i];
+			out[i] = (Sint16)(s > 32767 ? 32767 : (s < -32768 ? -32768 : s));
+		}
+
+		out += count;
+		samples -= count;
+	}
+
+	// the device keeps running while idle - pausing it from here could race with a command being queued,
+	// and unpausing takes the audio lock on the UI thread
+}
+
 AudioManager::AudioManager()
 {
 	init();
@@ -76,18 +195,14 @@ void AudioManager::init()
 		return;
 	}
 
-	//stop playing all Sounds
-	for(unsigned int i = 0; i < sSoundVector.size(); i++)
-	{
-		if(sSoundVector.at(i)->isPlaying())
-		{
-			sSoundVector[i]->stop();
-		}
-	}
+	//the device is closed, so the mixer isn't running - catch up on the queue (music), forget the sounds
+	processCommands();
+	for(int i = 0; i < AUDIO_MAX_VOICES; i++)
+		sVoices[i].sound = NULL;
 
 	//Set up format and callback. Play 16-bit stereo audio at 44.1Khz
 	sAudioFormat.freq = 44100;
-	sAudioFormat.format = AUDIO_S16;
+	sAudioFormat.format = AUDIO_S16SYS;
 	sAudioFormat.channels = 2;
 	sAudioFormat.samples = 1024;
 	sAudioFormat.callback = mixAudio;
@@ -97,6 +212,14 @@ void AudioManager::init()
 	if (SDL_OpenAudio(&sAudioFormat, NULL) < 0) {
 		LOG(LogError) << "AudioManager Error - Unable to open SDL audio: " << SDL_GetError() << std::endl;
 	}
+	sPaused = true;
+
+	//music picks up where it left off (e.g. after a game)
+	if(sMusic)
+	{
+		SDL_PauseAudio(0);
+		sPaused = false;
+	}
 }
 
 void AudioManager::deinit()
@@ -108,45 +231,68 @@ void AudioManager::deinit()
 	SDL_QuitSubSystem(SDL_INIT_AUDIO);
 }
 
-void AudioManager::registerSound(std::shared_ptr<Sound> & sound)
+void AudioManager::playSound(const Sound* sound, const Uint8* data, Uint32 length, float volume)
 {
-	getInstance();
-	sSoundVector.push_back(sound);
+	if(volume <= 0)
+		return;
+
+	const int gain = volume >= 1 ? AUDIO_GAIN_ONE : (int)(volume * AUDIO_GAIN_ONE);
+	pushCommand(CMD_PLAY, sound, (const Sint16*)data, length / sizeof(Sint16), gain);
+	play();
 }
 
-void AudioManager::unregisterSound(std::shared_ptr<Sound> & sound)
+void AudioManager::stopSound(const Sound* sound)
 {
-	getInstance();
-	for(unsigned int i = 0; i < sSoundVector.size(); i++)
+	pushCommand(CMD_STOP, sound);
+}
+
+void AudioManager::releaseSound(const Sound* sound)
+{
+	// rare (theme changes), so taking the lock is fine - the mixer isn't running while we hold it,
+	// which makes this thread the consumer for now
+	SDL_LockAudio();
+	processCommands();
+	for(int i = 0; i < AUDIO_MAX_VOICES; i++)
 	{
-		if(sSoundVector.at(i) == sound)
-		{
-			sSoundVector[i]->stop();
-			sSoundVector.erase(sSoundVector.begin() + i);
-			return;
-		}
+		if(sVoices[i].sound == sound)
+			sVoices[i].sound = NULL;
 	}
-	LOG(LogError) << "AudioManager Error - tried to unregister a sound that wasn't registered!";
+	SDL_UnlockAudio();
+}
+
+void AudioManager::playMusic(MusicStream* music)
+{
+	pushCommand(CMD_MUSIC, NULL, NULL, 0, AUDIO_GAIN_ONE, music);
+	play();
+}
+
+void AudioManager::releaseMusic(MusicStream* music)
+{
+	SDL_LockAudio();
+	processCommands();
+	if(sMusic == music)
+		sMusic = NULL;
+	SDL_UnlockAudio();
 }
 
 void AudioManager::play()
 {
 	getInstance();
 
-	//unpause audio, the mixer will figure out if samples need to be played...
-	SDL_PauseAudio(0);
+	//unpause audio once, after that the mixer just plays silence while nothing is queued
+	if(sPaused)
+	{
+		SDL_PauseAudio(0);
+		sPaused = false;
+	}
 }
 
 void AudioManager::stop()
 {
 	//stop playing all Sounds
-	for(unsigned int i = 0; i < sSoundVector.size(); i++)
-	{
-		if(sSoundVector.at(i)->isPlaying())
-		{
-			sSoundVector[i]->stop();
-		}
-	}
+	pushCommand(CMD_STOP_ALL, NULL);
+
 	//pause audio
 	SDL_PauseAudio(1);
+	sPaused = true;
 }
@@ -3,19 +3,73 @@
 
 #include <vector>
 #include <memory>
+#include <atomic>
 
 #include "SDL_audio.h"
 
 #include "Sound.h"
 
+class MusicStream;
 
+// how many sounds can play at the same time, the oldest one is cut off after that
+#define AUDIO_MAX_VOICES 16
+// commands that can wait for the mixer (a power of two)
+#define AUDIO_COMMAND_QUEUE_SIZE 64
+// samples (not frames) mixed in one pass, longer callbacks are mixed in several
+#define AUDIO_MIX_CHUNK_SAMPLES 4096
+// voice gain is fixed point, this is full volume
+#define AUDIO_GAIN_ONE 256
+
+// The UI thread never takes the audio lock to start or stop a sound, it queues a command that the mixer picks up
+// at the start of its next callback (single producer, single consumer). The mixer keeps its own voices, so the
+// callback neither locks nor allocates. Only freeing sample data (Sound::deinit) still waits for the mixer.
 class AudioManager
 {
+	enum CommandType
+	{
+		CMD_PLAY,
+		CMD_STOP,
+		CMD_STOP_ALL, // sound effects only
+		CMD_MUSIC
+	};
+
+	struct Command
+	{
+		CommandType type;
+		const Sound* sound;
+		MusicStream* music;
+		const Sint16* data;
+		Uint32 length;
+		int gain;
+	};
+
+	struct Voice
+	{
+		const Sound* sound; // NULL if free
+		const Sint16* data;
+		Uint32 length; // in samples
+		Uint32 position;
+		int gain; // AUDIO_GAIN_ONE is full volume
+	};
+
 	static SDL_AudioSpec sAudioFormat;
-	static std::vector<std::shared_ptr<Sound>> sSoundVector;
 	static std::shared_ptr<AudioManager> sInstance;
 
+	static Command sCommands[AUDIO_COMMAND_QUEUE_SIZE];
+	static std::atomic<unsigned int> sCommandRead; // only advanced by the mixer
+	static std::atomic<unsigned int> sCommandWrite; // only advanced by the UI thread
+	static Voice sVoices[AUDIO_MAX_VOICES]; // only touched by the mixer (or with the audio locked)
+	static Sint32 sMixBuffer[AUDIO_MIX_CHUNK_SAMPLES]; // all voices are summed up here before clamping once
+	static MusicStream* sMusic; // only touched by the mixer (or with the audio locked)
+	static bool sPaused;
+
+	friend class MusicStream;
+
 	static void mixAudio(void *unused, Uint8 *stream, int len);
+	static void processCommands();
+	static void mixVoice(Sint32* out, const Sint16* in, int gain, Uint32 count);
+	static void pushCommand(CommandType type, const Sound* sound, const Sint16* data = NULL, Uint32 length = 0, int gain = AUDIO_GAIN_ONE,
+		MusicStream* music = NULL);
 
 	AudioManager();
 
@@ -25,8 +79,17 @@ public:
 	void init();
 	void deinit();
 
-	void registerSound(std::shared_ptr<Sound> & sound);
-	void unregisterSound(std::shared_ptr<Sound> & sound);
+	// data is 16-bit stereo at 44.1kHz (native byte order), length in bytes, volume from 0 to 1
+	void playSound(const Sound* sound, const Uint8* data, Uint32 length, float volume = 1.0f);
+	void stopSound(const Sound* sound);
+
+	// Waits until the mixer can't be using the sound's data anymore, so it can be freed.
+	// Static since sounds can outlive the instance at exit.
+	static void releaseSound(const Sound* sound);
+
+	// Mixes the stream on top of the sounds (NULL for none) until it's released. Keeps playing across deinit()/init().
+	void playMusic(MusicStream* music);
+	static void releaseMusic(MusicStream* music);
 
 	void play();
 	void stop();
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Reading and writing the fields of the binary caches in ~/.emulationstation/cache (and the gamelist store and sync state).
+// Everything is in host byte order with no padding: these files are never shared between machines, a cache that doesn't
+// read back on another one is just rebuilt. Each file starts with its own magic and version, bump the version when its
+// layout changes.
+// The read functions return false instead of throwing, once the stream (or buffer) runs out or a length is implausible.
+
+inline void writeU32(std::ostream& out, uint32_t val) { out.write((const char*)&val, sizeof(val)); }
+inline void writeU64(std::ostream& out, uint64_t val) { out.write((const char*)&val, sizeof(val)); }
+inline void writeI64(std::ostream& out, int64_t val) { out.write((const char*)&val, sizeof(val)); }
+inline void writeFloat(std::ostream& out, float val) { out.write((const char*)&val, sizeof(val)); }
+
+// length, then the bytes
+inline void writeString(std::ostream& out, const std::string& str)
+{
+	writeU32(out, (uint32_t)str.length());
+	out.write(str.data(), str.length());
+}
+
+inline bool readU32(std::istream& in, uint32_t& val) { return (bool)in.read((char*)&val, sizeof(val)); }
+inline bool readU64(std::istream& in, uint64_t& val) { return (bool)in.read((char*)&val, sizeof(val)); }
+inline bool readI64(std::istream& in, int64_t& val) { return (bool)in.read((char*)&val, sizeof(val)); }
+inline bool readFloat(std::istream& in, float& val) { return (bool)in.read((char*)&val, sizeof(val)); }
+
+// anything longer than maxLength is taken as a damaged file, rather than allocated
+inline bool readString(std::istream& in, std::string& str, uint32_t maxLength = 64 * 1024)
+{
+	uint32_t len;
+	if(!readU32(in, len) || len > maxLength)
+		return false;
+
+	str.resize(len);
+	return len == 0 || (bool)in.read(&str[0], len);
+}
+
+// the same layout, appended to and parsed from memory
+inline void putU32(std::string& out, uint32_t val) { out.append((const char*)&val, sizeof(val)); }
+inline void putString(std::string& out, const std::string& str) { putU32(out, (uint32_t)str.size()); out.append(str); }
+
+// advance p, never past end
+inline bool getU32(const char*& p, const char* end, uint32_t& val)
+{
+	if(end - p < (ptrdiff_t)sizeof(val))
+		return false;
+	memcpy(&val, p, sizeof(val));
+	p += sizeof(val);
+	return true;
+}
+
+inline bool getString(const char*& p, const char* end, std::string& str)
+{
+	uint32_t len;
+	if(!getU32(p, end, len) || (uint32_t)(end - p) < len)
+		return false;
+	str.assign(p, len);
+	p += len;
+	return true;
+}
@@ -0,0 +1,94 @@
+#include "FramePacer.h"
+#include "Renderer.h"
+#include "Settings.h"
+#include "ThermalGovernor.h"
+#include "Log.h"
+#include <cmath>
+
+// how far (as a fraction of the refresh interval) a frame can be off and still snap to it
+#define SNAP_TOLERANCE 0.2
+// more than this many refresh intervals apart and we're not in step with vsync anyway
+#define SNAP_MAX_INTERVALS 4
+
+FramePacer* FramePacer::getInstance()
+{
+	static FramePacer instance;
+	return &instance;
+}
+
+FramePacer::FramePacer() : mLastTick(0), mFrameStart(0), mRefreshInterval(1000.0f / 60), mVSync(false), mCarry(0), mDrift(0)
+{
+	mMsPerTick = 1000.0 / (double)SDL_GetPerformanceFrequency();
+}
+
+void FramePacer::init()
+{
+	const int rate = Renderer::getRefreshRate();
+	mRefreshInterval = 1000.0f / (rate > 0 ? rate : 60);
+	mVSync = Renderer::getSwapInterval() != 0;
+
+	LOG(LogInfo) << "Frame pacing: " << (rate > 0 ? rate : 60) << "Hz" << (rate > 0 ? "" : " (assumed)")
+		<< ", swap interval " << Renderer::getSwapInterval() << ", MaxFPS " << Settings::getInstance()->getInt("MaxFPS");
+
+	reset();
+}
+
+void FramePacer::reset()
+{
+	mLastTick = SDL_GetPerformanceCounter();
+	mCarry = 0;
+	mDrift = 0;
+}
+
+int FramePacer::beginFrame()
+{
+	const Uint64 now = SDL_GetPerformanceCounter();
+	double elapsed = (now - mLastTick) * mMsPerTick;
+	mLastTick = now;
+	mFrameStart = now;
+
+	if(elapsed > 1000 || elapsed < 0)
+	{
+		mCarry = 0;
+		mDrift = 0;
+		return 1000;
+	}
+
+	double paced = elapsed;
+	if(mVSync)
+	{
+		const double intervals = std::floor(elapsed / mRefreshInterval + 0.5);
+		if(intervals >= 1 && intervals <= SNAP_MAX_INTERVALS && std::abs(elapsed - intervals * mRefreshInterval) < mRefreshInterval * SNAP_TOLERANCE)
+			paced = intervals * mRefreshInterval;
+
+		// snapping shouldn't make us lose time, give it back once it's a whole interval
+		mDrift += elapsed - paced;
+		if(std::abs(mDrift) >= mRefreshInterval)
+		{
+			paced += mDrift;
+			mDrift = 0;
+		}
+	}
+
+	mCarry += paced;
+	const int delta = (int)mCarry;
+	mCarry -= delta;
+	return delta;
+}
+
+void FramePacer::endFrame()
+{
+	static const SettingHandle<int> maxFPS = Settings::getInstance()->getIntHandle("MaxFPS");
+	const int cap = ThermalGovernor::getInstance()->getMaxFPS(maxFPS);
+	if(cap <= 0)
+		return;
+
+	const double target = 1000.0 / cap;
+	double elapsed = (SDL_GetPerformanceCounter() - mFrameStart) * mMsPerTick;
+
+	// sleep most of the way, then spin for the last ms since SDL_Delay is coarse
+	if(target - elapsed > 2)
+		SDL_Delay((Uint32)(target - elapsed - 1));
+	while((SDL_GetPerformanceCounter() - mFrameStart) * mMsPerTick < target)
+		;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <SDL.h>
+
+// Turns the time between main loop iterations into the deltaTime handed to Window::update.
+// With vsync on, frames that took about a whole number of refresh intervals count as exactly that many,
+// so animations step evenly instead of jittering with the timer; what's rounded off is carried over, so nothing drifts.
+// Also holds frames back to "MaxFPS" if that's set (0 = no cap), or to ThermalGovernor's lower cap while it's backing off.
+class FramePacer
+{
+public:
+	static FramePacer* getInstance();
+
+	// Picks up the refresh rate and vsync mode; call again after the window is recreated.
+	void init();
+
+	// Call at the start of an iteration, returns the ms to update by (at most 1000).
+	int beginFrame();
+
+	// Call after swapping; sleeps until the frame cap allows the next frame.
+	void endFrame();
+
+	// Forget about the time since the last frame (e.g. after sleeping), the next beginFrame() returns 0.
+	void reset();
+
+	inline float getRefreshInterval() const { return mRefreshInterval; }
+
+private:
+	FramePacer();
+
+	double mMsPerTick;
+	Uint64 mLastTick;
+	Uint64 mFrameStart;
+
+	float mRefreshInterval; // ms
+	bool mVSync;
+
+	double mCarry; // fraction of a ms not handed out yet
+	double mDrift; // real time minus paced time
+};
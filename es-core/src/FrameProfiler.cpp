@@ -0,0 +1,306 @@
+#include "FrameProfiler.h"
+#include "Renderer.h"
+#include "Settings.h"
+#include "Log.h"
+#include <algorithm>
+#include <vector>
+#include <sstream>
+#include <iomanip>
+#include <fstream>
+#include <cstring>
+#include <cstddef>
+
+#define BAR_WIDTH 2
+#define GRAPH_MS 50.0f // a bar this long fills the graph
+
+static const unsigned int PHASE_COLORS[FrameProfiler::PHASE_COUNT] = {
+	0x4080FFC0, // input
+	0x40FF40C0, // update
+	0xFFFF40C0, // texture upload
+	0xFF8040C0, // render
+	0xA0A0A0C0, // swap
+};
+
+FrameProfiler* FrameProfiler::getInstance()
+{
+	static FrameProfiler instance;
+	return &instance;
+}
+
+FrameProfiler::FrameProfiler() : mEnabled(false), mHistoryStart(0), mHistoryCount(0), mStackDepth(0), mLastTick(0), mInputPending(0)
+{
+	resetCurrent();
+	mMsPerTick = 1000.0 / (double)SDL_GetPerformanceFrequency();
+}
+
+const char* FrameProfiler::getPhaseName(Phase phase)
+{
+	switch(phase)
+	{
+	case PHASE_INPUT:
+		return "input";
+	case PHASE_UPDATE:
+		return "update";
+	case PHASE_TEXTURE_UPLOAD:
+		return "texture_upload";
+	case PHASE_RENDER:
+		return "render";
+	case PHASE_SWAP:
+		return "swap";
+	default:
+		return "total";
+	}
+}
+
+void FrameProfiler::resetCurrent()
+{
+	memset(&mCurrent, 0, sizeof(mCurrent));
+	mCurrent.inputLatency = -1;
+}
+
+void FrameProfiler::inputReceived(Uint32 timestamp)
+{
+	if(mEnabled && mInputPending == 0)
+		mInputPending = timestamp;
+}
+
+void FrameProfiler::accumulate(Uint64 now)
+{
+	if(mStackDepth > 0)
+		mCurrent.phases[mStack[mStackDepth - 1]] += (float)((now - mLastTick) * mMsPerTick);
+	mLastTick = now;
+}
+
+void FrameProfiler::begin(Phase phase)
+{
+	if(!mEnabled)
+		return;
+
+	if(mStackDepth >= PHASE_COUNT)
+	{
+		LOG(LogError) << "FrameProfiler: phases nested too deep!";
+		return;
+	}
+
+	accumulate(SDL_GetPerformanceCounter());
+	mStack[mStackDepth++] = phase;
+}
+
+void FrameProfiler::end(Phase phase)
+{
+	if(!mEnabled || mStackDepth == 0)
+		return;
+
+	if(mStack[mStackDepth - 1] != phase)
+		LOG(LogError) << "FrameProfiler: ended phase " << getPhaseName(phase) << " while in " << getPhaseName(mStack[mStackDepth - 1]);
+
+	accumulate(SDL_GetPerformanceCounter());
+	mStackDepth--;
+
+	// whatever input came in before this swap is on screen now
+	if(phase == PHASE_SWAP && mInputPending != 0)
+	{
+		mCurrent.inputLatency = (float)(SDL_GetTicks() - mInputPending);
+		mInputPending = 0;
+	}
+}
+
+void FrameProfiler::endFrame()
+{
+	if(mEnabled)
+	{
+		mCurrent.total = 0;
+		for(int i = 0; i < PHASE_COUNT; i++)
+			mCurrent.total += mCurrent.phases[i];
+
+		if(mHistoryCount < FRAME_PROFILER_HISTORY)
+		{
+			mHistory[(mHistoryStart + mHistoryCount) % FRAME_PROFILER_HISTORY] = mCurrent;
+			mHistoryCount++;
+		}else{
+			mHistory[mHistoryStart] = mCurrent;
+			mHistoryStart = (mHistoryStart + 1) % FRAME_PROFILER_HISTORY;
+		}
+	}
+
+	resetCurrent();
+	mStackDepth = 0;
+
+	// checked once per frame, so a frame is never half profiled
+	static const SettingHandle<bool> profileFrames = Settings::getInstance()->getBoolHandle("ProfileFrames");
+	mEnabled = profileFrames;
+	if(!mEnabled)
+		mInputPending = 0;
+}
+
+float FrameProfiler::getFrameValue(const Frame& frame, Phase phase) const
+{
+	return phase == PHASE_COUNT ? frame.total : frame.phases[phase];
+}
+
+float FrameProfiler::getPercentile(Phase phase, float fraction) const
+{
+	if(mHistoryCount == 0)
+		return 0;
+
+	std::vector<float> values(mHistoryCount);
+	for(unsigned int i = 0; i < mHistoryCount; i++)
+		values[i] = getFrameValue(mHistory[i], phase);
+
+	unsigned int n = (unsigned int)(fraction * (mHistoryCount - 1) + 0.5f);
+	if(n >= mHistoryCount)
+		n = mHistoryCount - 1;
+
+	std::nth_element(values.begin(), values.begin() + n, values.end());
+	return values[n];
+}
+
+float FrameProfiler::getLatencyPercentile(float fraction) const
+{
+	std::vector<float> values;
+	values.reserve(mHistoryCount);
+	for(unsigned int i = 0; i < mHistoryCount; i++)
+	{
+		if(mHistory[i].inputLatency >= 0)
+			values.push_back(mHistory[i].inputLatency);
+	}
+
+	if(values.empty())
+		return 0;
+
+	unsigned int n = (unsigned int)(fraction * (values.size() - 1) + 0.5f);
+	if(n >= values.size())
+		n = values.size() - 1;
+
+	std::nth_element(values.begin(), values.begin() + n, values.end());
+	return values[n];
+}
+
+unsigned int FrameProfiler::getSpikeCount() const
+{
+	const float limit = getPercentile(PHASE_COUNT, 0.5f) * 2;
+
+	unsigned int count = 0;
+	for(unsigned int i = 0; i < mHistoryCount; i++)
+	{
+		if(mHistory[i].total > limit)
+			count++;
+	}
+	return count;
+}
+
+std::string FrameProfiler::getSummary() const
+{
+	std::stringstream ss;
+	ss << std::fixed << std::setprecision(2);
+	ss << "frame p50 " << getPercentile(PHASE_COUNT, 0.5f) << " / p95 " << getPercentile(PHASE_COUNT, 0.95f)
+		<< " / p99 " << getPercentile(PHASE_COUNT, 0.99f) << " / max " << getPercentile(PHASE_COUNT, 1.0f) << "ms, "
+		<< getSpikeCount() << " spikes";
+
+	ss << "\ninput latency p50 " << getLatencyPercentile(0.5f) << " / p95 " << getLatencyPercentile(0.95f) << "ms";
+
+	ss << "\np95:";
+	for(int i = 0; i < PHASE_COUNT; i++)
+		ss << " " << getPhaseName((Phase)i) << " " << getPercentile((Phase)i, 0.95f);
+
+	return ss.str();
+}
+
+void FrameProfiler::render()
+{
+	if(mHistoryCount == 0)
+		return;
+
+	const float height = Renderer::getScreenHeight() * 0.25f;
+	const float scale = height / GRAPH_MS;
+	const float left = 16;
+	const float bottom = Renderer::getScreenHeight() * 0.85f;
+	const float spikeLimit = getPercentile(PHASE_COUNT, 0.5f) * 2;
+
+	Renderer::setMatrix(Eigen::Affine3f::Identity());
+	Renderer::drawRect(left, bottom - height, (float)(FRAME_PROFILER_HISTORY * BAR_WIDTH), height, 0x00000080);
+
+	// one quad per phase per frame, plus a marker on top of spikes
+	// (interleaved, so they're streamed in one piece)
+	struct Vertex
+	{
+		GLfloat pos[2];
+		GLubyte color[4];
+	};
+	std::vector<Vertex> vertices;
+	vertices.reserve(mHistoryCount * (PHASE_COUNT + 1) * 6);
+
+	auto addQuad = [&](float x, float y, float w, float h, unsigned int color) {
+		const float quad[12] = { x, y,  x, y + h,  x + w, y,  x + w, y,  x, y + h,  x + w, y + h };
+		GLubyte c[4];
+		Renderer::buildGLColorArray(c, color, 1);
+		for(int i = 0; i < 6; i++)
+		{
+			Vertex vertex = { { quad[i * 2], quad[i * 2 + 1] }, { c[0], c[1], c[2], c[3] } };
+			vertices.push_back(vertex);
+		}
+	};
+
+	for(unsigned int i = 0; i < mHistoryCount; i++)
+	{
+		const Frame& frame = mHistory[(mHistoryStart + i) % FRAME_PROFILER_HISTORY];
+		const float x = left + i * BAR_WIDTH;
+
+		float y = bottom;
+		for(int p = 0; p < PHASE_COUNT; p++)
+		{
+			const float h = std::min(frame.phases[p] * scale, y - (bottom - height));
+			y -= h;
+			addQuad(x, y, BAR_WIDTH, h, PHASE_COLORS[p]);
+		}
+
+		if(frame.total > spikeLimit)
+			addQuad(x, bottom - height - 4, BAR_WIDTH, 4, 0xFF0000FF);
+	}
+
+	// 60fps and 30fps lines
+	addQuad(left, bottom - 16.67f * scale, (float)(FRAME_PROFILER_HISTORY * BAR_WIDTH), 1, 0xFFFFFF80);
+	addQuad(left, bottom - 33.33f * scale, (float)(FRAME_PROFILER_HISTORY * BAR_WIDTH), 1, 0xFFFFFF80);
+
+	Renderer::setTextureEnabled(false);
+	Renderer::setBlendEnabled(true);
+	Renderer::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	Renderer::setClientArrays(true, false, true);
+
+	const char* base = Renderer::streamVertices(vertices.data(), vertices.size() * sizeof(Vertex));
+	Renderer::vertexPointer(2, GL_FLOAT, sizeof(Vertex), base + offsetof(Vertex, pos));
+	Renderer::colorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), base + offsetof(Vertex, color));
+
+	Renderer::drawArrays(GL_TRIANGLES, 0, (GLsizei)vertices.size());
+}
+
+bool FrameProfiler::dumpCSV(const std::string& path) const
+{
+	std::ofstream out(path.c_str(), std::ios::out | std::ios::trunc);
+	if(!out.is_open())
+	{
+		LOG(LogError) << "Could not write frame timings to " << path;
+		return false;
+	}
+
+	out << "frame";
+	for(int i = 0; i <= PHASE_COUNT; i++)
+		out << "," << getPhaseName((Phase)i);
+	out << ",input_latency\n";
+
+	out << std::fixed << std::setprecision(3);
+	for(unsigned int i = 0; i < mHistoryCount; i++)
+	{
+		const Frame& frame = mHistory[(mHistoryStart + i) % FRAME_PROFILER_HISTORY];
+		out << i;
+		for(int p = 0; p < PHASE_COUNT; p++)
+			out << "," << frame.phases[p];
+		out << "," << frame.total << ",";
+		if(frame.inputLatency >= 0)
+			out << frame.inputLatency;
+		out << "\n";
+	}
+
+	LOG(LogInfo) << "Wrote " << mHistoryCount << " frame timings to " << path;
+	return true;
+}
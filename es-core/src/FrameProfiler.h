@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>
+#include <SDL.h>
+
+// how many frames of timings are kept around
+#define FRAME_PROFILER_HISTORY 256
+
+// Times the phases of each main loop iteration and keeps the last FRAME_PROFILER_HISTORY frames.
+// Only does anything while the "ProfileFrames" setting is on; Window draws the overlay then.
+class FrameProfiler
+{
+public:
+	enum Phase
+	{
+		PHASE_INPUT,
+		PHASE_UPDATE, // not counting texture uploads
+		PHASE_TEXTURE_UPLOAD,
+		PHASE_RENDER,
+		PHASE_SWAP,
+		PHASE_COUNT // used for the whole frame in getPercentile()
+	};
+
+	static FrameProfiler* getInstance();
+	static const char* getPhaseName(Phase phase);
+
+	inline bool isEnabled() const { return mEnabled; }
+
+	// Phases can nest, time spent in the inner phase isn't counted for the outer one.
+	void begin(Phase phase);
+	void end(Phase phase);
+
+	// Remembers the oldest event (by SDL timestamp) that hasn't made it to the screen yet;
+	// the time from it to the end of the next swap is recorded as that frame's input latency.
+	void inputReceived(Uint32 timestamp);
+
+	// Moves the current frame into the history and starts a new one.
+	void endFrame();
+
+	// Time in ms that the given fraction (0-1) of the recorded frames stayed under.
+	float getPercentile(Phase phase, float fraction) const;
+	// Same for input latency, only counting frames that showed input. 0 if there were none.
+	float getLatencyPercentile(float fraction) const;
+	// Frames that took more than twice the median.
+	unsigned int getSpikeCount() const;
+	// Percentiles and spikes as text, for drawing under the graph.
+	std::string getSummary() const;
+
+	// Draws the history as stacked bars (one per frame, a colour per phase) in the bottom left corner.
+	void render();
+
+	// Writes the history as CSV (in ms, oldest frame first). Returns false if the file couldn't be written.
+	bool dumpCSV(const std::string& path) const;
+
+private:
+	FrameProfiler();
+
+	struct Frame
+	{
+		float phases[PHASE_COUNT];
+		float total;
+		float inputLatency; // < 0 if no input was shown this frame
+	};
+
+	float getFrameValue(const Frame& frame, Phase phase) const;
+	void accumulate(Uint64 now);
+	void resetCurrent();
+
+	bool mEnabled;
+
+	Frame mHistory[FRAME_PROFILER_HISTORY];
+	unsigned int mHistoryStart; // oldest frame
+	unsigned int mHistoryCount;
+
+	Frame mCurrent;
+	Phase mStack[PHASE_COUNT];
+	int mStackDepth;
+	Uint64 mLastTick; // when the phase on top of the stack (re)started
+	double mMsPerTick;
+	Uint32 mInputPending; // timestamp of the oldest input not swapped yet, 0 if none
+};
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "TaskScheduler.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <functional>
+#include <utility>
+
+// The result of something that finishes later (a download, a decode...), or the error it failed with.
+// Continuations run on the main thread from TaskScheduler::update(), so nothing is polled while waiting, and the steps
+// of a multi-step operation can be written one after the other and run next to as many others as there are:
+//
+//   HttpReq::fetch(url).then([](const std::shared_ptr<HttpReq>& req) {
+//       return runAsync([req] { return parse(req->getContent()); });
+//   }).onReady([](const Future<Result>& result) { ... });
+//
+// Dropping a Future doesn't stop the work behind it, cancelling the token passed to onReady()/then() skips what would
+// run after it (and so everything chained to that). T has to be default constructible and copyable.
+template<typename T> class Future;
+template<typename T> class Promise;
+
+namespace FutureDetail
+{
+	template<typename T>
+	struct State
+	{
+		State() : ready(false), failed(false) {}
+
+		std::mutex mutex;
+		bool ready;
+		bool failed;
+		T value;
+		std::string error;
+		std::vector< std::pair<std::function<void()>, CancellationToken> > continuations;
+
+		void resolve()
+		{
+			std::vector< std::pair<std::function<void()>, CancellationToken> > ready;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				ready.swap(continuations);
+			}
+
+			for(auto it = ready.begin(); it != ready.end(); it++)
+				TaskScheduler::getInstance()->runOnMainThread(it->first, it->second);
+		}
+	};
+}
+
+template<typename T>
+class Future
+{
+public:
+	typedef T ValueType;
+
+	// an empty future that never gets ready, for members that are set later
+	Future() : mState(std::make_shared< FutureDetail::State<T> >()) {}
+
+	bool isReady() const { std::unique_lock<std::mutex> lock(mState->mutex); return mState->ready; }
+	bool failed() const { std::unique_lock<std::mutex> lock(mState->mutex); return mState->ready && mState->failed; }
+
+	// only once it's ready (and didn't fail), they don't change after that
+	const T& get() const { return mState->value; }
+	const std::string& getError() const { return mState->error; }
+
+	// Runs done on the main thread once this is ready, right away (from the next update()) if it already is.
+	void onReady(const std::function<void(const Future<T>&)>& done, const CancellationToken& token = CancellationToken()) const
+	{
+		const Future<T> self = *this;
+		std::function<void()> run = [done, self] { done(self); };
+
+		{
+			std::unique_lock<std::mutex> lock(mState->mutex);
+			if(!mState->ready)
+			{
+				mState->continuations.push_back(std::make_pair(run, token));
+				return;
+			}
+		}
+
+		TaskScheduler::getInstance()->runOnMainThread(run, token);
+	}
+
+	// The next step: fn gets the value on the main thread and returns the Future of what comes after it.
+	// If this failed, fn is skipped and the result fails with the same error.
+	template<typename F>
+	auto then(F fn, const CancellationToken& token = CancellationToken()) const -> decltype(fn(std::declval<const T&>()))
+	{
+		typedef decltype(fn(std::declval<const T&>())) Next;
+		Promise<typename Next::ValueType> promise;
+		onReady([fn, promise](const Future<T>& result) {
+			if(result.failed())
+			{
+				promise.setError(result.getError());
+				return;
+			}
+			promise.setFrom(fn(result.get()));
+		}, token);
+		return promise.getFuture();
+	}
+
+	// The other way around: fn gets the error and returns the Future to use instead (e.g. another way of getting it).
+	template<typename F>
+	Future<T> orElse(F fn, const CancellationToken& token = CancellationToken()) const
+	{
+		Promise<T> promise;
+		onReady([fn, promise](const Future<T>& result) {
+			if(result.failed())
+				promise.setFrom(fn(result.getError()));
+			else
+				promise.setValue(result.get());
+		}, token);
+		return promise.getFuture();
+	}
+
+private:
+	friend class Promise<T>;
+	explicit Future(const std::shared_ptr< FutureDetail::State<T> >& state) : mState(state) {}
+
+	std::shared_ptr< FutureDetail::State<T> > mState;
+};
+
+// The side that sets a Future's result, from any thread. Copies share the result, only the first one set counts.
+template<typename T>
+class Promise
+{
+public:
+	Promise() : mState(std::make_shared< FutureDetail::State<T> >()) {}
+
+	Future<T> getFuture() const { return Future<T>(mState); }
+
+	void setValue(const T& value) const
+	{
+		{
+			std::unique_lock<std::mutex> lock(mState->mutex);
+			if(mState->ready)
+				return;
+			mState->value = value;
+			mState->ready = true;
+		}
+		mState->resolve();
+	}
+
+	void setError(const std::string& error) const
+	{
+		{
+			std::unique_lock<std::mutex> lock(mState->mutex);
+			if(mState->ready)
+				return;
+			mState->error = error;
+			mState->failed = true;
+			mState->ready = true;
+		}
+		mState->resolve();
+	}
+
+	// takes on whatever other ends up with
+	void setFrom(const Future<T>& other) const
+	{
+		const Promise<T> self = *this;
+		other.onReady([self](const Future<T>& result) {
+			if(result.failed())
+				self.setError(result.getError());
+			else
+				self.setValue(result.get());
+		});
+	}
+
+private:
+	std::shared_ptr< FutureDetail::State<T> > mState;
+};
+
+template<typename T>
+Future<T> makeReadyFuture(const T& value)
+{
+	Promise<T> promise;
+	promise.setValue(value);
+	return promise.getFuture();
+}
+
+template<typename T>
+Future<T> makeFailedFuture(const std::string& error)
+{
+	Promise<T> promise;
+	promise.setError(error);
+	return promise.getFuture();
+}
+
+// Runs fn on the TaskScheduler, the Future has what it returns.
+template<typename F>
+auto runAsync(F fn, TaskScheduler::Priority priority = TaskScheduler::PRIORITY_BACKGROUND,
+	const CancellationToken& token = CancellationToken()) -> Future<decltype(fn())>
+{
+	Promise<decltype(fn())> promise;
+	TaskScheduler::getInstance()->submit([fn, promise] { promise.setValue(fn()); }, priority, token);
+	return promise.getFuture();
+}
+
+// Ready once all of them are, with their values in the same order, or failed with the first error.
+template<typename T>
+Future< std::vector<T> > whenAll(const std::vector< Future<T> >& futures)
+{
+	if(futures.empty())
+		return makeReadyFuture(std::vector<T>());
+
+	Promise< std::vector<T> > promise;
+	std::shared_ptr<size_t> left = std::make_shared<size_t>(futures.size());
+	for(auto it = futures.begin(); it != futures.end(); it++)
+	{
+		// continuations all run on the main thread, so the count needs no lock
+		it->onReady([promise, futures, left](const Future<T>& result) {
+			if(result.failed())
+			{
+				promise.setError(result.getError());
+				return;
+			}
+
+			if(--*left > 0)
+				return;
+
+			std::vector<T> values;
+			for(auto f = futures.begin(); f != futures.end(); f++)
+				values.push_back(f->get());
+			promise.setValue(values);
+		});
+	}
+	return promise.getFuture();
+}
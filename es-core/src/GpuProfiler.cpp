@@ -0,0 +1,375 @@
+#include "GpuProfiler.h"
+#include "Renderer.h"
+#include "Settings.h"
+#include "Metrics.h"
+#include "Log.h"
+#include <SDL.h>
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+#include <sstream>
+#include <iomanip>
+
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED 0x88BF // GL_TIME_ELAPSED_EXT too
+#endif
+#ifndef GL_QUERY_RESULT
+#define GL_QUERY_RESULT 0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#endif
+#ifndef GL_GPU_DISJOINT_EXT
+#define GL_GPU_DISJOINT_EXT 0x8FBB
+#endif
+
+#ifdef USE_OPENGL_DESKTOP
+#define GPU_APIENTRY APIENTRY
+#else
+#define GPU_APIENTRY GL_APIENTRY
+#endif
+
+namespace
+{
+	// none of these are in GL 1.1 or GLES 1, so they're always looked up
+	typedef void (GPU_APIENTRY *GenQueriesProc)(GLsizei n, GLuint* ids);
+	typedef void (GPU_APIENTRY *DeleteQueriesProc)(GLsizei n, const GLuint* ids);
+	typedef void (GPU_APIENTRY *BeginQueryProc)(GLenum target, GLuint id);
+	typedef void (GPU_APIENTRY *EndQueryProc)(GLenum target);
+	typedef void (GPU_APIENTRY *GetQueryObjectivProc)(GLuint id, GLenum pname, GLint* params);
+	typedef void (GPU_APIENTRY *GetQueryObjectui64vProc)(GLuint id, GLenum pname, uint64_t* params);
+
+	GenQueriesProc genQueries = NULL;
+	DeleteQueriesProc deleteQueries = NULL;
+	BeginQueryProc beginQuery = NULL;
+	EndQueryProc endQuery = NULL;
+	GetQueryObjectivProc getQueryObjectiv = NULL;
+	GetQueryObjectui64vProc getQueryObjectui64v = NULL;
+
+	Metrics::Histogram* histograms[GpuProfiler::SECTION_COUNT + 1];
+}
+
+GpuProfiler* GpuProfiler::getInstance()
+{
+	static GpuProfiler instance;
+	return &instance;
+}
+
+GpuProfiler::GpuProfiler() : mSupported(-1), mContext(0), mActive(false), mQueryOpen(false), mFreeQueryCount(0), mQueryCount(0),
+	mPendingStart(0), mPendingCount(0), mStackDepth(0), mOverflowDepth(0), mHistoryStart(0), mHistoryCount(0)
+{
+	for(int i = 0; i <= SECTION_COUNT; i++)
+	{
+		const std::string name = getSectionName((Section)i);
+		histograms[i] = Metrics::getHistogram("es_gpu_" + name + "_ms", i == SECTION_COUNT ?
+			"GPU time spent drawing a frame, for frames that were timed" : "GPU time per timed frame spent drawing " + name);
+	}
+}
+
+const char* GpuProfiler::getSectionName(Section section)
+{
+	switch(section)
+	{
+	case SECTION_OTHER:
+		return "other";
+	case SECTION_SYSTEMVIEW:
+		return "systemview";
+	case SECTION_GAMELIST:
+		return "gamelist";
+	case SECTION_TEXT:
+		return "text";
+	case SECTION_IMAGES:
+		return "images";
+	case SECTION_OVERLAYS:
+		return "overlays";
+	default:
+		return "total";
+	}
+}
+
+bool GpuProfiler::checkSupport()
+{
+#ifdef USE_OPENGL_DESKTOP
+	// the ARB extension (core in 3.3) uses the core names, the older EXT one only adds the 64 bit getters to GL 1.5's queries
+	const bool arb = Renderer::isExtensionSupported("GL_ARB_timer_query");
+	if(!arb && !Renderer::isExtensionSupported("GL_EXT_timer_query"))
+		return false;
+	const std::string suffix = "";
+	const std::string getterSuffix = arb ? "" : "EXT";
+#else
+	if(!Renderer::isExtensionSupported("GL_EXT_disjoint_timer_query"))
+		return false;
+	const std::string suffix = "EXT";
+	const std::string getterSuffix = "EXT";
+#endif
+
+	genQueries = (GenQueriesProc)Renderer::getProcAddress(("glGenQueries" + suffix).c_str());
+	deleteQueries = (DeleteQueriesProc)Renderer::getProcAddress(("glDeleteQueries" + suffix).c_str());
+	beginQuery = (BeginQueryProc)Renderer::getProcAddress(("glBeginQuery" + suffix).c_str());
+	endQuery = (EndQueryProc)Renderer::getProcAddress(("glEndQuery" + suffix).c_str());
+	getQueryObjectiv = (GetQueryObjectivProc)Renderer::getProcAddress(("glGetQueryObjectiv" + suffix).c_str());
+	getQueryObjectui64v = (GetQueryObjectui64vProc)Renderer::getProcAddress(("glGetQueryObjectui64v" + getterSuffix).c_str());
+
+	return genQueries && deleteQueries && beginQuery && endQuery && getQueryObjectiv && getQueryObjectui64v;
+}
+
+void GpuProfiler::releaseQueries()
+{
+	// results that didn't come in yet are dropped with them
+	for(unsigned int i = 0; i < mPendingCount; i++)
+	{
+		PendingFrame& frame = mPending[(mPendingStart + i) % GPU_PROFILER_LATENCY];
+		for(unsigned int s = 0; s < frame.segmentCount; s++)
+			mFreeQueries[mFreeQueryCount++] = frame.segments[s].query;
+		frame.segmentCount = 0;
+	}
+	mPendingCount = 0;
+
+	if(mQueryCount > 0)
+		deleteQueries((GLsizei)mFreeQueryCount, mFreeQueries);
+	mFreeQueryCount = 0;
+	mQueryCount = 0;
+}
+
+void GpuProfiler::beginFrame()
+{
+	mActive = false;
+	mStackDepth = 0;
+	mOverflowDepth = 0;
+
+	// the queries (and what was looked up) went with the old context
+	const unsigned int context = Renderer::getContextSerial();
+	if(context != mContext)
+	{
+		mContext = context;
+		mSupported = -1;
+		mPendingCount = 0;
+		mFreeQueryCount = 0;
+		mQueryCount = 0;
+	}
+
+	// checked once per frame, so a frame is never half timed
+	static const SettingHandle<bool> profileFrames = Settings::getInstance()->getBoolHandle("ProfileFrames");
+	static const SettingHandle<bool> profileGPU = Settings::getInstance()->getBoolHandle("ProfileGPU");
+	if(!profileFrames && !profileGPU)
+	{
+		if(mQueryCount > 0)
+			releaseQueries();
+		return;
+	}
+
+	if(mSupported == -1)
+	{
+		mSupported = checkSupport() ? 1 : 0;
+		if(!mSupported)
+			LOG(LogWarning) << "GpuProfiler: the driver has no timer queries, GPU times won't be measured";
+	}
+	if(!mSupported)
+		return;
+
+	collect();
+
+	// the GPU is too far behind to take another frame's queries, wait for it instead of stalling on it
+	if(mPendingCount >= GPU_PROFILER_LATENCY)
+		return;
+
+	PendingFrame& frame = mPending[(mPendingStart + mPendingCount) % GPU_PROFILER_LATENCY];
+	frame.segmentCount = 0;
+	frame.overflowed = false;
+
+	mActive = true;
+	mStack[mStackDepth++] = SECTION_OTHER;
+	startSegment(SECTION_OTHER);
+}
+
+void GpuProfiler::endFrame()
+{
+	if(!mActive)
+		return;
+
+	stopSegment();
+	mPendingCount++;
+	mActive = false;
+	mStackDepth = 0;
+	mOverflowDepth = 0;
+}
+
+void GpuProfiler::startSegment(Section section)
+{
+	PendingFrame& frame = mPending[(mPendingStart + mPendingCount) % GPU_PROFILER_LATENCY];
+	if(frame.overflowed || frame.segmentCount >= GPU_PROFILER_MAX_QUERIES)
+	{
+		frame.overflowed = true;
+		return;
+	}
+
+	if(mFreeQueryCount == 0)
+	{
+		// in batches, there's no telling how many a frame will need
+		const unsigned int batch = std::min(64u, (unsigned int)(sizeof(mFreeQueries) / sizeof(mFreeQueries[0])) - mQueryCount);
+		if(batch == 0)
+		{
+			frame.overflowed = true;
+			return;
+		}
+		genQueries((GLsizei)batch, mFreeQueries);
+		mFreeQueryCount = batch;
+		mQueryCount += batch;
+	}
+
+	const GLuint query = mFreeQueries[--mFreeQueryCount];
+	beginQuery(GL_TIME_ELAPSED, query);
+	frame.segments[frame.segmentCount].query = query;
+	frame.segments[frame.segmentCount].section = section;
+	frame.segmentCount++;
+	mQueryOpen = true;
+}
+
+void GpuProfiler::stopSegment()
+{
+	if(!mQueryOpen)
+		return;
+
+	// quads the Renderer is still collecting were drawn in this segment
+	Renderer::flushQuads();
+
+	endQuery(GL_TIME_ELAPSED);
+	mQueryOpen = false;
+}
+
+void GpuProfiler::begin(Section section)
+{
+	if(!mActive)
+		return;
+
+	if(mStackDepth >= (int)(sizeof(mStack) / sizeof(mStack[0])))
+	{
+		// its time stays with the section it's nested in
+		if(mOverflowDepth++ == 0)
+			LOG(LogError) << "GpuProfiler: sections nested too deep!";
+		return;
+	}
+
+	// only one timer query can run at a time, so the outer section's stops here and picks up again in end()
+	stopSegment();
+	mStack[mStackDepth++] = section;
+	startSegment(section);
+}
+
+void GpuProfiler::end(Section section)
+{
+	// the frame's own section stays until endFrame()
+	if(!mActive || mStackDepth <= 1)
+		return;
+
+	// the begin() this belongs to was never pushed
+	if(mOverflowDepth > 0)
+	{
+		mOverflowDepth--;
+		return;
+	}
+
+	if(mStack[mStackDepth - 1] != section)
+		LOG(LogError) << "GpuProfiler: ended section " << getSectionName(section) << " while in " << getSectionName(mStack[mStackDepth - 1]);
+
+	stopSegment();
+	mStackDepth--;
+	startSegment(mStack[mStackDepth - 1]);
+}
+
+void GpuProfiler::collect()
+{
+	if(mPendingCount == 0)
+		return;
+
+#ifdef USE_OPENGL_ES
+	// something (a power state change...) made the timer jump, so whatever is in flight can't be trusted; reading it clears it
+	GLint disjoint = 0;
+	glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+#else
+	const GLint disjoint = 0;
+#endif
+
+	while(mPendingCount > 0)
+	{
+		PendingFrame& frame = mPending[mPendingStart];
+
+		// queries finish in order, so if the last one's in so are the others, and frames after it can't be done either
+		if(frame.segmentCount > 0)
+		{
+			GLint available = 0;
+			getQueryObjectiv(frame.segments[frame.segmentCount - 1].query, GL_QUERY_RESULT_AVAILABLE, &available);
+			if(!available)
+				break;
+		}
+
+		Frame result;
+		std::fill(result.sections, result.sections + SECTION_COUNT, 0.0f);
+		result.total = 0;
+		for(unsigned int i = 0; i < frame.segmentCount; i++)
+		{
+			uint64_t ns = 0;
+			getQueryObjectui64v(frame.segments[i].query, GL_QUERY_RESULT, &ns);
+			result.sections[frame.segments[i].section] += (float)(ns / 1000000.0);
+			mFreeQueries[mFreeQueryCount++] = frame.segments[i].query;
+		}
+		for(int i = 0; i < SECTION_COUNT; i++)
+			result.total += result.sections[i];
+
+		if(!frame.overflowed && !disjoint)
+			addFrame(result);
+
+		frame.segmentCount = 0;
+		mPendingStart = (mPendingStart + 1) % GPU_PROFILER_LATENCY;
+		mPendingCount--;
+	}
+}
+
+void GpuProfiler::addFrame(const Frame& frame)
+{
+	for(int i = 0; i < SECTION_COUNT; i++)
+		histograms[i]->record(frame.sections[i]);
+	histograms[SECTION_COUNT]->record(frame.total);
+
+	if(mHistoryCount < GPU_PROFILER_HISTORY)
+	{
+		mHistory[(mHistoryStart + mHistoryCount) % GPU_PROFILER_HISTORY] = frame;
+		mHistoryCount++;
+	}else{
+		mHistory[mHistoryStart] = frame;
+		mHistoryStart = (mHistoryStart + 1) % GPU_PROFILER_HISTORY;
+	}
+}
+
+float GpuProfiler::getPercentile(Section section, float fraction) const
+{
+	if(mHistoryCount == 0)
+		return 0;
+
+	std::vector<float> values(mHistoryCount);
+	for(unsigned int i = 0; i < mHistoryCount; i++)
+		values[i] = section == SECTION_COUNT ? mHistory[i].total : mHistory[i].sections[section];
+
+	unsigned int n = (unsigned int)(fraction * (mHistoryCount - 1) + 0.5f);
+	if(n >= mHistoryCount)
+		n = mHistoryCount - 1;
+
+	std::nth_element(values.begin(), values.begin() + n, values.end());
+	return values[n];
+}
+
+std::string GpuProfiler::getSummary() const
+{
+	if(mSupported == 0)
+		return "gpu: no timer queries";
+
+	std::stringstream ss;
+	ss << std::fixed << std::setprecision(2);
+	ss << "gpu p50 " << getPercentile(SECTION_COUNT, 0.5f) << " / p95 " << getPercentile(SECTION_COUNT, 0.95f) << "ms";
+
+	ss << "\ngpu p95:";
+	for(int i = 0; i < SECTION_COUNT; i++)
+		ss << " " << getSectionName((Section)i) << " " << getPercentile((Section)i, 0.95f);
+
+	return ss.str();
+}
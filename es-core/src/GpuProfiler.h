@@ -0,0 +1,110 @@
+#pragma once
+
+#include <string>
+
+// how many frames of GPU timings are kept around
+#define GPU_PROFILER_HISTORY 256
+// frames whose queries can be waiting for the GPU at once; a frame that would make one more isn't measured
+#define GPU_PROFILER_LATENCY 4
+// past this many section changes in one frame the frame is dropped, so a long list can't eat up query objects
+#define GPU_PROFILER_MAX_QUERIES 512
+
+// Times each frame's drawing on the GPU, split up by what was drawn, with timer queries (GL 3.3 / GL_ARB_timer_query,
+// GL_EXT_disjoint_timer_query on GLES). CPU timings can't tell a GPU that's behind from one that's idle.
+// Results are only read once the GPU says they're there (a few frames later), so measuring never stalls the pipeline.
+// Only does anything while "ProfileFrames" (which shows it under the frame graph) or "ProfileGPU" is on, and the
+// driver has timer queries. Every timed frame also goes into the es_gpu_*_ms metrics.
+class GpuProfiler
+{
+public:
+	enum Section
+	{
+		SECTION_OTHER, // whatever isn't in one of the others (backgrounds, rectangles...)
+		SECTION_SYSTEMVIEW,
+		SECTION_GAMELIST,
+		SECTION_TEXT,
+		SECTION_IMAGES,
+		SECTION_OVERLAYS, // menus, help prompts, debug overlays
+		SECTION_COUNT // used for the whole frame in getPercentile()
+	};
+
+	static GpuProfiler* getInstance();
+	static const char* getSectionName(Section section);
+
+	// Around everything drawn for one frame (not the swap), on the main thread.
+	void beginFrame();
+	void endFrame();
+
+	// Sections can nest, time spent in the inner section isn't counted for the outer one.
+	void begin(Section section);
+	void end(Section section);
+
+	// For a whole function or block.
+	class Scope
+	{
+	public:
+		Scope(Section section) : mSection(section) { GpuProfiler::getInstance()->begin(section); }
+		~Scope() { GpuProfiler::getInstance()->end(mSection); }
+
+	private:
+		Section mSection;
+	};
+
+	inline bool isSupported() const { return mSupported == 1; } // as far as known, false before the first frame
+
+	// GPU time in ms that the given fraction (0-1) of the timed frames stayed under.
+	float getPercentile(Section section, float fraction) const;
+	// p95 of every section as text, for drawing under the frame graph.
+	std::string getSummary() const;
+
+private:
+	GpuProfiler();
+
+	struct Segment
+	{
+		unsigned int query;
+		Section section;
+	};
+
+	// one frame's queries, waiting for their results
+	struct PendingFrame
+	{
+		Segment segments[GPU_PROFILER_MAX_QUERIES];
+		unsigned int segmentCount;
+		bool overflowed;
+	};
+
+	struct Frame
+	{
+		float sections[SECTION_COUNT];
+		float total;
+	};
+
+	bool checkSupport();
+	void releaseQueries();
+	void collect(); // reads back whatever frames the GPU is done with
+	void addFrame(const Frame& frame);
+	void startSegment(Section section);
+	void stopSegment();
+
+	int mSupported; // -1 = not checked for this context yet
+	unsigned int mContext; // Renderer::getContextSerial() the queries were made in
+	bool mActive; // timing the frame being drawn
+	bool mQueryOpen;
+
+	unsigned int mFreeQueries[GPU_PROFILER_MAX_QUERIES * GPU_PROFILER_LATENCY];
+	unsigned int mFreeQueryCount;
+	unsigned int mQueryCount; // made so far, never more than mFreeQueries can hold
+
+	PendingFrame mPending[GPU_PROFILER_LATENCY];
+	unsigned int mPendingStart; // oldest
+	unsigned int mPendingCount;
+
+	Section mStack[SECTION_COUNT * 2];
+	int mStackDepth;
+	int mOverflowDepth; // begin()s past the top of mStack, whose end()s have to be skipped too
+
+	Frame mHistory[GPU_PROFILER_HISTORY];
+	unsigned int mHistoryStart;
+	unsigned int mHistoryCount;
+};
@@ -4,9 +4,26 @@
 #include "Renderer.h"
 #include "animations/AnimationController.h"
 #include "ThemeData.h"
+#include "Util.h"
+
+// bounds are grown by this much (in pixels) before culling and caching, for the nine patches our GUIs put a little outside of themselves
+#define CULL_MARGIN 32
+#define RENDER_CACHE_MAX 4 // render caches that keep a texture at once, the least recently drawn one gives it up
+
+struct GuiComponent::RenderCache
+{
+	Renderer::RenderTarget target;
+	Eigen::Vector2f topLeft; // in our coordinates, where the texture's top left is
+	bool dirty;
+	unsigned int inputCount; // mWindow->getInputCount() when it was drawn
+};
+
+std::list<GuiComponent::RenderCache*> GuiComponent::sRenderCaches;
 
 GuiComponent::GuiComponent(Window* window) : mWindow(window), mParent(NULL), mOpacity(255), 
-	mPosition(Eigen::Vector3f::Zero()), mSize(Eigen::Vector2f::Zero()), mTransform(Eigen::Affine3f::Identity())
+	mPosition(Eigen::Vector3f::Zero()), mSize(Eigen::Vector2f::Zero()), mTransform(Eigen::Affine3f::Identity()), mTransformDirty(false),
+	mWorldTransform(Eigen::Affine3f::Identity()), mWorldParentTransform(Eigen::Affine3f::Identity()), mWorldDirty(true),
+	mRenderCache(NULL), mWantsUpdate(false), mUpdateActive(false), mActiveChildren(0)
 {
 	for(unsigned char i = 0; i < MAX_ANIMATIONS; i++)
 		mAnimationMap[i] = NULL;
@@ -23,6 +40,8 @@ GuiComponent::~GuiComponent()
 
 	for(unsigned int i = 0; i < getChildCount(); i++)
 		getChild(i)->setParent(NULL);
+
+	setRenderCached(false);
 }
 
 bool GuiComponent::input(InputConfig* config, Input input)
@@ -38,15 +57,51 @@ bool GuiComponent::input(InputConfig* config, Input input)
 
 void GuiComponent::updateSelf(int deltaTime)
 {
+	bool animating = false;
 	for(unsigned char i = 0; i < MAX_ANIMATIONS; i++)
-		advanceAnimation(i, deltaTime);
+		animating |= advanceAnimation(i, deltaTime);
+
+	if(animating)
+		mWindow->invalidate(); // whatever the animations change says so itself
 }
 
 void GuiComponent::updateChildren(int deltaTime)
 {
+	// most of a tree is static text and images, skip everything that has nothing to do
+	if(!mActiveChildren)
+		return;
+
 	for(unsigned int i = 0; i < getChildCount(); i++)
 	{
-		getChild(i)->update(deltaTime);
+		GuiComponent* child = getChild(i);
+		if(child->mUpdateActive)
+			child->update(deltaTime);
+	}
+}
+
+void GuiComponent::setUpdating(bool updating)
+{
+	mWantsUpdate = updating;
+	refreshUpdateActive();
+}
+
+void GuiComponent::refreshUpdateActive()
+{
+	bool active = mWantsUpdate || mActiveChildren > 0;
+	for(unsigned char i = 0; i < MAX_ANIMATIONS && !active; i++)
+		active = mAnimationMap[i] != NULL;
+
+	if(active == mUpdateActive)
+		return;
+
+	mUpdateActive = active;
+	if(mParent)
+	{
+		if(active)
+			mParent->mActiveChildren++;
+		else
+			mParent->mActiveChildren--;
+		mParent->refreshUpdateActive();
 	}
 }
 
@@ -58,18 +113,163 @@ void GuiComponent::update(int deltaTime)
 
 void GuiComponent::render(const Eigen::Affine3f& parentTrans)
 {
-	Eigen::Affine3f trans = parentTrans * getTransform();
+	Eigen::Affine3f trans = getWorldTransform(parentTrans);
 	renderChildren(trans);
 }
 
 void GuiComponent::renderChildren(const Eigen::Affine3f& transform) const
 {
 	for(unsigned int i = 0; i < getChildCount(); i++)
+		getChild(i)->draw(transform);
+}
+
+void GuiComponent::draw(const Eigen::Affine3f& parentTrans)
+{
+	if(!isVisible(parentTrans))
+		return;
+
+	if(mRenderCache != NULL)
+		renderCached(parentTrans);
+	else
+		render(parentTrans);
+}
+
+void GuiComponent::setRenderCached(bool cached)
+{
+	if(cached == (mRenderCache != NULL))
+		return;
+
+	if(cached)
+	{
+		mRenderCache = new RenderCache();
+		mRenderCache->dirty = true;
+		mRenderCache->inputCount = 0;
+	}else{
+		sRenderCaches.remove(mRenderCache);
+		delete mRenderCache;
+		mRenderCache = NULL;
+	}
+	mWindow->invalidate();
+}
+
+void GuiComponent::renderCached(const Eigen::Affine3f& parentTrans)
+{
+	RenderCache& cache = *mRenderCache;
+
+	Eigen::Vector2f topLeft, bottomRight;
+	if(!getBounds(topLeft, bottomRight))
+	{
+		render(parentTrans);
+		return;
+	}
+
+	topLeft -= Eigen::Vector2f(CULL_MARGIN, CULL_MARGIN);
+	bottomRight += Eigen::Vector2f(CULL_MARGIN, CULL_MARGIN);
+	const int width = (int)ceil(bottomRight.x() - topLeft.x());
+	const int height = (int)ceil(bottomRight.y() - topLeft.y());
+
+	if(cache.dirty || cache.inputCount != mWindow->getInputCount() || cache.target.getTexture() == 0 ||
+		cache.target.getWidth() != width || cache.target.getHeight() != height || topLeft != cache.topLeft)
+	{
+		// only so many textures at once
+		sRenderCaches.remove(&cache);
+		if(sRenderCaches.size() >= RENDER_CACHE_MAX)
+		{
+			sRenderCaches.back()->target.release();
+			sRenderCaches.pop_back();
+		}
+
+		if(!cache.target.begin(width, height))
+		{
+			render(parentTrans);
+			return;
+		}
+
+		// with our topLeft at the texture's (0, 0), drawn at full opacity (the quad gets faded instead)
+		Eigen::Affine3f trans = Eigen::Affine3f::Identity();
+		trans.translate(-Eigen::Vector3f(topLeft.x(), topLeft.y(), 0) - mPosition);
+
+		const unsigned char opacity = mOpacity;
+		mOpacity = 255;
+		render(trans);
+		mOpacity = opacity;
+
+		cache.target.end();
+		cache.topLeft = topLeft;
+		cache.dirty = false;
+		cache.inputCount = mWindow->getInputCount();
+	}else{
+		sRenderCaches.remove(&cache);
+	}
+	sRenderCaches.push_front(&cache);
+
+	if(mOpacity == 0)
+		return;
+
+	Eigen::Affine3f trans = roundMatrix(getWorldTransform(parentTrans));
+	trans.translate(Eigen::Vector3f(round(topLeft.x()), round(topLeft.y()), 0));
+	Renderer::setMatrix(trans);
+
+	// the texture's rows are bottom to top; premultiplied, so the opacity goes into every channel
+	Renderer::drawQuad(cache.target.getTexture(), 0, 0, (float)width, (float)height, 0, 1, 1, 0, mOpacity * 0x01010101,
+		GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+void GuiComponent::invalidate()
+{
+	mWindow->invalidate();
+	for(GuiComponent* cmp = this; cmp != NULL; cmp = cmp->mParent)
 	{
-		getChild(i)->render(transform);
+		if(cmp->mRenderCache != NULL)
+			cmp->mRenderCache->dirty = true;
 	}
 }
 
+void GuiComponent::invalidateFromParent()
+{
+	mWindow->invalidate();
+	if(mParent)
+		mParent->invalidate();
+}
+
+bool GuiComponent::getBounds(Eigen::Vector2f& topLeft, Eigen::Vector2f& bottomRight) const
+{
+	if(mSize.x() == 0 || mSize.y() == 0)
+		return false;
+
+	topLeft = Eigen::Vector2f::Zero();
+	bottomRight = mSize;
+	return true;
+}
+
+bool GuiComponent::isVisible(const Eigen::Affine3f& parentTrans)
+{
+	Eigen::Vector2f topLeft, bottomRight;
+	if(!getBounds(topLeft, bottomRight))
+		return true;
+
+	// screen space box around the corners
+	const Eigen::Affine3f& trans = getWorldTransform(parentTrans);
+	const Eigen::Vector3f corners[4] = {
+		trans * Eigen::Vector3f(topLeft.x(), topLeft.y(), 0),
+		trans * Eigen::Vector3f(bottomRight.x(), topLeft.y(), 0),
+		trans * Eigen::Vector3f(topLeft.x(), bottomRight.y(), 0),
+		trans * Eigen::Vector3f(bottomRight.x(), bottomRight.y(), 0)
+	};
+
+	Eigen::Vector2f min = corners[0].head<2>();
+	Eigen::Vector2f max = min;
+	for(int i = 1; i < 4; i++)
+	{
+		min = min.cwiseMin(corners[i].head<2>());
+		max = max.cwiseMax(corners[i].head<2>());
+	}
+
+	const Eigen::Vector4i clip = Renderer::getClipRect();
+	return max.x() + CULL_MARGIN > clip[0] && min.x() - CULL_MARGIN < clip[0] + clip[2] &&
+		max.y() + CULL_MARGIN > clip[1] && min.y() - CULL_MARGIN < clip[1] + clip[3];
+}
+
 Eigen::Vector3f GuiComponent::getPosition() const
 {
 	return mPosition;
@@ -78,13 +278,17 @@ Eigen::Vector3f GuiComponent::getPosition() const
 void GuiComponent::setPosition(const Eigen::Vector3f& offset)
 {
 	mPosition = offset;
+	mTransformDirty = true;
 	onPositionChanged();
+	invalidateFromParent();
 }
 
 void GuiComponent::setPosition(float x, float y, float z)
 {
 	mPosition << x, y, z;
+	mTransformDirty = true;
 	onPositionChanged();
+	invalidateFromParent();
 }
 
 Eigen::Vector2f GuiComponent::getSize() const
@@ -96,12 +300,14 @@ void GuiComponent::setSize(const Eigen::Vector2f& size)
 {
     mSize = size;
     onSizeChanged();
+	invalidate();
 }
 
 void GuiComponent::setSize(float w, float h)
 {
 	mSize << w, h;
     onSizeChanged();
+	invalidate();
 }
 
 //Children stuff.
@@ -113,6 +319,7 @@ void GuiComponent::addChild(GuiComponent* cmp)
 		cmp->getParent()->removeChild(cmp);
 
 	cmp->setParent(this);
+	invalidate();
 }
 
 void GuiComponent::removeChild(GuiComponent* cmp)
@@ -126,6 +333,7 @@ void GuiComponent::removeChild(GuiComponent* cmp)
 	}
 
 	cmp->setParent(NULL);
+	invalidate();
 
 	for(auto i = mChildren.begin(); i != mChildren.end(); i++)
 	{
@@ -139,7 +347,15 @@ void GuiComponent::removeChild(GuiComponent* cmp)
 
 void GuiComponent::clearChildren()
 {
+	// the children live on (they're not ours to delete), but shouldn't point back at us or count as active here
+	for(auto it = mChildren.begin(); it != mChildren.end(); it++)
+	{
+		if((*it)->getParent() == this)
+			(*it)->setParent(NULL);
+	}
+
 	mChildren.clear();
+	invalidate();
 }
 
 unsigned int GuiComponent::getChildCount() const
@@ -154,7 +370,20 @@ GuiComponent* GuiComponent::getChild(unsigned int i) const
 
 void GuiComponent::setParent(GuiComponent* parent)
 {
+	// an active child counts towards its parent's mActiveChildren
+	if(mUpdateActive && mParent)
+	{
+		mParent->mActiveChildren--;
+		mParent->refreshUpdateActive();
+	}
+
 	mParent = parent;
+
+	if(mUpdateActive && mParent)
+	{
+		mParent->mActiveChildren++;
+		mParent->refreshUpdateActive();
+	}
 }
 
 GuiComponent* GuiComponent::getParent() const
@@ -170,6 +399,15 @@ unsigned char GuiComponent::getOpacity() const
 void GuiComponent::setOpacity(unsigned char opacity)
 {
 	mOpacity = opacity;
+
+	// only the cached texture fades, nothing inside has to be drawn again
+	if(mRenderCache != NULL)
+	{
+		invalidateFromParent();
+		return;
+	}
+
+	invalidate();
 	for(auto it = mChildren.begin(); it != mChildren.end(); it++)
 	{
 		(*it)->setOpacity(opacity);
@@ -178,11 +416,30 @@ void GuiComponent::setOpacity(unsigned char opacity)
 
 const Eigen::Affine3f& GuiComponent::getTransform()
 {
-	mTransform.setIdentity();
-	mTransform.translate(mPosition);
+	if(mTransformDirty)
+	{
+		mTransform.setIdentity();
+		mTransform.translate(mPosition);
+		mTransformDirty = false;
+		mWorldDirty = true;
+	}
 	return mTransform;
 }
 
+const Eigen::Affine3f& GuiComponent::getWorldTransform(const Eigen::Affine3f& parentTrans)
+{
+	getTransform(); // flags mWorldDirty if we moved
+
+	// an exact compare is a lot cheaper than the multiply, and anything that moved higher up changes it
+	if(mWorldDirty || parentTrans.matrix() != mWorldParentTransform.matrix())
+	{
+		mWorldParentTransform = parentTrans;
+		mWorldTransform = parentTrans * mTransform;
+		mWorldDirty = false;
+	}
+	return mWorldTransform;
+}
+
 void GuiComponent::setValue(const std::string& value)
 {
 }
@@ -209,6 +466,9 @@ void GuiComponent::setAnimation(Animation* anim, int delay, std::function<void()
 
 	if(oldAnim)
 		delete oldAnim;
+
+	refreshUpdateActive();
+	mWindow->invalidate();
 }
 
 bool GuiComponent::stopAnimation(unsigned char slot)
@@ -218,6 +478,7 @@ bool GuiComponent::stopAnimation(unsigned char slot)
 	{
 		delete mAnimationMap[slot];
 		mAnimationMap[slot] = NULL;
+		refreshUpdateActive();
 		return true;
 	}else{
 		return false;
@@ -232,6 +493,7 @@ bool GuiComponent::cancelAnimation(unsigned char slot)
 		mAnimationMap[slot]->removeFinishedCallback();
 		delete mAnimationMap[slot];
 		mAnimationMap[slot] = NULL;
+		refreshUpdateActive();
 		return true;
 	}else{
 		return false;
@@ -249,6 +511,7 @@ bool GuiComponent::finishAnimation(unsigned char slot)
 
 		delete mAnimationMap[slot]; // will also call finishedCallback
 		mAnimationMap[slot] = NULL;
+		refreshUpdateActive();
 		return true;
 	}else{
 		return false;
@@ -266,6 +529,7 @@ bool GuiComponent::advanceAnimation(unsigned char slot, unsigned int time)
 		{
 			mAnimationMap[slot] = NULL;
 			delete anim;
+			refreshUpdateActive();
 		}
 		return true;
 	}else{
@@ -311,14 +575,14 @@ void GuiComponent::applyTheme(const std::shared_ptr<ThemeData>& theme, const std
 		return;
 
 	using namespace ThemeFlags;
-	if(properties & POSITION && elem->has("pos"))
+	if(properties & POSITION && elem->has(ThemeProperties::POS))
 	{
-		Eigen::Vector2f denormalized = elem->get<Eigen::Vector2f>("pos").cwiseProduct(scale);
+		Eigen::Vector2f denormalized = elem->get<Eigen::Vector2f>(ThemeProperties::POS).cwiseProduct(scale);
 		setPosition(Eigen::Vector3f(denormalized.x(), denormalized.y(), 0));
 	}
 
-	if(properties & ThemeFlags::SIZE && elem->has("size"))
-		setSize(elem->get<Eigen::Vector2f>("size").cwiseProduct(scale));
+	if(properties & ThemeFlags::SIZE && elem->has(ThemeProperties::SIZE))
+		setSize(elem->get<Eigen::Vector2f>(ThemeProperties::SIZE).cwiseProduct(scale));
 }
 
 void GuiComponent::updateHelpPrompts()
@@ -2,6 +2,7 @@
 
 #include "InputConfig.h"
 #include <memory>
+#include <list>
 #include <Eigen/Dense>
 #include "HelpStyle.h"
 
@@ -26,11 +27,17 @@ public:
 	virtual bool input(InputConfig* config, Input input);
 
 	//Called when time passes.  Default implementation calls updateSelf(deltaTime) and updateChildren(deltaTime) - so you should probably call GuiComponent::update(deltaTime) at some point (or at least updateSelf so animations work).
+	//Children are only updated while something in them is animating or asked for updates with setUpdating(true),
+	//so anything that overrides this to do work over time has to ask.
 	virtual void update(int deltaTime);
 
-	//Called when it's time to render.  By default, just calls renderChildren(parentTrans * getTransform()).
+	// Whether update() should be called every frame even without an animation playing (timers, scrolling, polling).
+	void setUpdating(bool updating);
+	inline bool isUpdateActive() const { return mUpdateActive; } // if we, or anything below us, needs update()
+
+	//Called when it's time to render.  By default, just calls renderChildren(getWorldTransform(parentTrans)).
 	//You probably want to override this like so:
-	//1. Calculate the new transform that your control will draw at with Eigen::Affine3f t = parentTrans * getTransform().
+	//1. Calculate the new transform that your control will draw at with Eigen::Affine3f t = getWorldTransform(parentTrans).
 	//2. Set the renderer to use that new transform as the model matrix - Renderer::setMatrix(t);
 	//3. Draw your component.
 	//4. Tell your children to render, based on your component's transform - renderChildren(t).
@@ -72,6 +79,30 @@ public:
 
 	const Eigen::Affine3f& getTransform();
 
+	// parentTrans * getTransform(), only recomputed when we moved or parentTrans isn't what it was last time
+	// (so when the parent or the camera moved); a still subtree does no matrix math from frame to frame.
+	const Eigen::Affine3f& getWorldTransform(const Eigen::Affine3f& parentTrans);
+
+	// The area, in our own coordinates, that we draw in. Returns false if that isn't known, and we're never culled.
+	// By default it's (0, 0) to getSize(), unknown if either side is 0.
+	virtual bool getBounds(Eigen::Vector2f& topLeft, Eigen::Vector2f& bottomRight) const;
+
+	// false if at parentTrans our bounds are entirely outside the current clip rect, so render() can be skipped
+	bool isVisible(const Eigen::Affine3f& parentTrans);
+
+	// What parents call to draw a child instead of render(): nothing if it isn't visible, the render cache's
+	// texture if it has an up to date one, otherwise render().
+	void draw(const Eigen::Affine3f& parentTrans);
+
+	// Opt-in, for big subtrees that rarely change (a menu, a theme's extras): render() is drawn into a texture
+	// (our bounds plus a margin) and after that only the texture is drawn, as one quad faded by our opacity,
+	// until something inside calls invalidate() or there's input. setOpacity() only fades the quad then.
+	// Without render targets it does nothing.
+	void setRenderCached(bool cached);
+
+	// Marks what we draw as changed: the window redraws, and render caches we're in redraw their texture.
+	void invalidate();
+
 	virtual std::string getValue() const;
 	virtual void setValue(const std::string& value);
 
@@ -109,5 +140,22 @@ public:
 
 private:
 	Eigen::Affine3f mTransform; //Don't access this directly! Use getTransform()!
+	bool mTransformDirty; // mPosition changed since mTransform was computed
+
+	Eigen::Affine3f mWorldTransform; // what getWorldTransform() last returned
+	Eigen::Affine3f mWorldParentTransform; // and the parentTrans it was made from
+	bool mWorldDirty;
+
+	struct RenderCache;
+	RenderCache* mRenderCache; // NULL unless setRenderCached(true)
+	static std::list<RenderCache*> sRenderCaches; // the ones with a texture, most recently drawn first
+	void renderCached(const Eigen::Affine3f& parentTrans);
+	void invalidateFromParent(); // invalidate(), for changes that leave our own render cache good (moving, fading it)
 	AnimationController* mAnimationMap[MAX_ANIMATIONS];
+
+	// mUpdateActive is mWantsUpdate, or an animation playing, or mActiveChildren > 0; parents are told when it flips
+	bool mWantsUpdate;
+	bool mUpdateActive;
+	unsigned int mActiveChildren;
+	void refreshUpdateActive();
 };
@@ -0,0 +1,273 @@
+#include "Hash.h"
+#include <string.h>
+#include <math.h>
+
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#else
+#include <zlib.h>
+#endif
+
+static inline uint32_t rol(uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+
+uint32_t crc32Update(uint32_t crc, const void* data, size_t len)
+{
+#if defined(__ARM_FEATURE_CRC32)
+	const uint8_t* p = (const uint8_t*)data;
+	crc = ~crc;
+	for(; len >= 8; len -= 8, p += 8)
+	{
+		uint64_t word;
+		memcpy(&word, p, 8);
+		crc = __crc32d(crc, word);
+	}
+	for(; len > 0; len--, p++)
+		crc = __crc32b(crc, *p);
+	return ~crc;
+#else
+	// zlib's implementation already works on several bytes at a time; it takes an unsigned int length
+	const uint8_t* p = (const uint8_t*)data;
+	while(len > 0)
+	{
+		const unsigned int chunk = len > 0x40000000 ? 0x40000000 : (unsigned int)len;
+		crc = (uint32_t)crc32(crc, p, chunk);
+		p += chunk;
+		len -= chunk;
+	}
+	return crc;
+#endif
+}
+
+// Md5
+
+static const int MD5_SHIFTS[64] = {
+	7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+	5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
+	4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+	6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+};
+
+// floor(abs(sin(i + 1)) * 2^32), exact in double precision
+struct Md5Constants
+{
+	uint32_t k[64];
+
+	Md5Constants()
+	{
+		for(int i = 0; i < 64; i++)
+			k[i] = (uint32_t)(fabs(sin(i + 1.0)) * 4294967296.0);
+	}
+};
+
+static const uint32_t* getMd5Constants()
+{
+	static const Md5Constants constants; // hashes run on several threads, this is initialized once
+	return constants.k;
+}
+
+Md5::Md5() : mLength(0), mBuffered(0)
+{
+	mState[0] = 0x67452301;
+	mState[1] = 0xEFCDAB89;
+	mState[2] = 0x98BADCFE;
+	mState[3] = 0x10325476;
+}
+
+void Md5::transform(const uint8_t* block)
+{
+	const uint32_t* k = getMd5Constants();
+
+	uint32_t m[16];
+	for(int i = 0; i < 16; i++)
+		m[i] = block[i * 4] | (block[i * 4 + 1] << 8) | (block[i * 4 + 2] << 16) | ((uint32_t)block[i * 4 + 3] << 24);
+
+	uint32_t a = mState[0], b = mState[1], c = mState[2], d = mState[3];
+	for(int i = 0; i < 64; i++)
+	{
+		uint32_t f;
+		int g;
+		if(i < 16)
+		{
+			f = (b & c) | (~b & d);
+			g = i;
+		}else if(i < 32)
+		{
+			f = (d & b) | (~d & c);
+			g = (5 * i + 1) % 16;
+		}else if(i < 48)
+		{
+			f = b ^ c ^ d;
+			g = (3 * i + 5) % 16;
+		}else{
+			f = c ^ (b | ~d);
+			g = (7 * i) % 16;
+		}
+
+		f += a + k[i] + m[g];
+		a = d;
+		d = c;
+		c = b;
+		b += rol(f, MD5_SHIFTS[i]);
+	}
+
+	mState[0] += a;
+	mState[1] += b;
+	mState[2] += c;
+	mState[3] += d;
+}
+
+void Md5::update(const void* data, size_t len)
+{
+	const uint8_t* p = (const uint8_t*)data;
+	mLength += len;
+
+	if(mBuffered > 0)
+	{
+		const size_t take = len < 64 - mBuffered ? len : 64 - mBuffered;
+		memcpy(mBuffer + mBuffered, p, take);
+		mBuffered += take;
+		p += take;
+		len -= take;
+		if(mBuffered < 64)
+			return;
+		transform(mBuffer);
+		mBuffered = 0;
+	}
+
+	for(; len >= 64; len -= 64, p += 64)
+		transform(p);
+
+	memcpy(mBuffer, p, len);
+	mBuffered = len;
+}
+
+void Md5::finish(uint8_t out[16])
+{
+	const uint64_t bits = mLength * 8;
+
+	const uint8_t pad = 0x80;
+	update(&pad, 1);
+	const uint8_t zero = 0;
+	while(mBuffered != 56)
+		update(&zero, 1);
+
+	uint8_t length[8];
+	for(int i = 0; i < 8; i++)
+		length[i] = (uint8_t)(bits >> (i * 8));
+	update(length, 8);
+
+	for(int i = 0; i < 16; i++)
+		out[i] = (uint8_t)(mState[i / 4] >> ((i % 4) * 8));
+}
+
+// Sha1
+
+Sha1::Sha1() : mLength(0), mBuffered(0)
+{
+	mState[0] = 0x67452301;
+	mState[1] = 0xEFCDAB89;
+	mState[2] = 0x98BADCFE;
+	mState[3] = 0x10325476;
+	mState[4] = 0xC3D2E1F0;
+}
+
+void Sha1::transform(const uint8_t* block)
+{
+	uint32_t w[80];
+	for(int i = 0; i < 16; i++)
+		w[i] = ((uint32_t)block[i * 4] << 24) | (block[i * 4 + 1] << 16) | (block[i * 4 + 2] << 8) | block[i * 4 + 3];
+	for(int i = 16; i < 80; i++)
+		w[i] = rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+	uint32_t a = mState[0], b = mState[1], c = mState[2], d = mState[3], e = mState[4];
+	for(int i = 0; i < 80; i++)
+	{
+		uint32_t f, k;
+		if(i < 20)
+		{
+			f = (b & c) | (~b & d);
+			k = 0x5A827999;
+		}else if(i < 40)
+		{
+			f = b ^ c ^ d;
+			k = 0x6ED9EBA1;
+		}else if(i < 60)
+		{
+			f = (b & c) | (b & d) | (c & d);
+			k = 0x8F1BBCDC;
+		}else{
+			f = b ^ c ^ d;
+			k = 0xCA62C1D6;
+		}
+
+		const uint32_t temp = rol(a, 5) + f + e + k + w[i];
+		e = d;
+		d = c;
+		c = rol(b, 30);
+		b = a;
+		a = temp;
+	}
+
+	mState[0] += a;
+	mState[1] += b;
+	mState[2] += c;
+	mState[3] += d;
+	mState[4] += e;
+}
+
+void Sha1::update(const void* data, size_t len)
+{
+	const uint8_t* p = (const uint8_t*)data;
+	mLength += len;
+
+	if(mBuffered > 0)
+	{
+		const size_t take = len < 64 - mBuffered ? len : 64 - mBuffered;
+		memcpy(mBuffer + mBuffered, p, take);
+		mBuffered += take;
+		p += take;
+		len -= take;
+		if(mBuffered < 64)
+			return;
+		transform(mBuffer);
+		mBuffered = 0;
+	}
+
+	for(; len >= 64; len -= 64, p += 64)
+		transform(p);
+
+	memcpy(mBuffer, p, len);
+	mBuffered = len;
+}
+
+void Sha1::finish(uint8_t out[20])
+{
+	const uint64_t bits = mLength * 8;
+
+	const uint8_t pad = 0x80;
+	update(&pad, 1);
+	const uint8_t zero = 0;
+	while(mBuffered != 56)
+		update(&zero, 1);
+
+	uint8_t length[8];
+	for(int i = 0; i < 8; i++)
+		length[i] = (uint8_t)(bits >> ((7 - i) * 8));
+	update(length, 8);
+
+	for(int i = 0; i < 20; i++)
+		out[i] = (uint8_t)(mState[i / 4] >> ((3 - i % 4) * 8));
+}
+
+std::string hashToHex(const uint8_t* hash, size_t len)
+{
+	static const char* digits = "0123456789abcdef";
+
+	std::string str(len * 2, '0');
+	for(size_t i = 0; i < len; i++)
+	{
+		str[i * 2] = digits[hash[i] >> 4];
+		str[i * 2 + 1] = digits[hash[i] & 0xF];
+	}
+	return str;
+}
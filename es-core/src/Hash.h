@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string>
+#include <stddef.h>
+#include <stdint.h>
+
+// The checksums ROM databases key games by, computed incrementally so a file can be hashed in chunks.
+
+// Same CRC-32 as zlib/zip (start with 0). Uses the ARMv8 CRC instructions when the compiler targets them.
+uint32_t crc32Update(uint32_t crc, const void* data, size_t len);
+
+class Md5
+{
+public:
+	Md5();
+	void update(const void* data, size_t len);
+	void finish(uint8_t out[16]);
+
+private:
+	void transform(const uint8_t* block);
+
+	uint32_t mState[4];
+	uint64_t mLength;
+	uint8_t mBuffer[64];
+	size_t mBuffered;
+};
+
+class Sha1
+{
+public:
+	Sha1();
+	void update(const void* data, size_t len);
+	void finish(uint8_t out[20]);
+
+private:
+	void transform(const uint8_t* block);
+
+	uint32_t mState[5];
+	uint64_t mLength;
+	uint8_t mBuffer[64];
+	size_t mBuffered;
+};
+
+// lower case hex, the way DATs write them
+std::string hashToHex(const uint8_t* hash, size_t len);
@@ -21,15 +21,15 @@ void HelpStyle::applyTheme(const std::shared_ptr<ThemeData>& theme, const std::s
 	if(!elem)
 		return;
 
-	if(elem->has("pos"))
-		position = elem->get<Eigen::Vector2f>("pos").cwiseProduct(Eigen::Vector2f((float)Renderer::getScreenWidth(), (float)Renderer::getScreenHeight()));
+	if(elem->has(ThemeProperties::POS))
+		position = elem->get<Eigen::Vector2f>(ThemeProperties::POS).cwiseProduct(Eigen::Vector2f((float)Renderer::getScreenWidth(), (float)Renderer::getScreenHeight()));
 
-	if(elem->has("textColor"))
-		textColor = elem->get<unsigned int>("textColor");
+	if(elem->has(ThemeProperties::TEXT_COLOR))
+		textColor = elem->get<unsigned int>(ThemeProperties::TEXT_COLOR);
 
-	if(elem->has("iconColor"))
-		iconColor = elem->get<unsigned int>("iconColor");
+	if(elem->has(ThemeProperties::ICON_COLOR))
+		iconColor = elem->get<unsigned int>(ThemeProperties::ICON_COLOR);
 
-	if(elem->has("fontPath") || elem->has("fontSize"))
+	if(elem->has(ThemeProperties::FONT_PATH) || elem->has(ThemeProperties::FONT_SIZE))
 		font = Font::getFromTheme(elem, ThemeFlags::ALL, font);
 }
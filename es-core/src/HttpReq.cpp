@@ -1,11 +1,293 @@
 #include <iostream>
 #include "HttpReq.h"
+#include "BinaryIO.h"
 #include "Log.h"
+#include "Settings.h"
+#include "platform.h"
+#include "Metrics.h"
 #include <boost/filesystem.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <SDL.h>
+#include <ctime>
+#include <functional>
+#include <stdint.h>
+#include <string.h>
 
-CURLM* HttpReq::s_multi_handle = curl_multi_init();
+// how many idle easy handles are kept around
+#define MAX_FREE_HANDLES 8
+
+// scrapers mostly talk to a single host, don't open more than this many connections to it at once
+#define MAX_HOST_CONNECTIONS 6
+
+// how long to leave a host alone after it answered 429 or 5xx, doubled for every such answer in a row
+#define FIRST_BACKOFF_MS 1000
+#define MAX_BACKOFF_MS 60000
+
+// how often a request is sent again after such an answer before giving up on it
+#define MAX_RETRIES 3
+
+// one per kind of shared data, std::mutex is constant initialized so these are ready before the share handle is made
+static std::mutex sShareMutexes[CURL_LOCK_DATA_LAST];
+
+CURLSH* HttpReq::s_share_handle = HttpReq::createShareHandle();
+CURLM* HttpReq::s_multi_handle = HttpReq::createMultiHandle();
 
 std::map<CURL*, HttpReq*> HttpReq::s_requests;
+std::vector<CURL*> HttpReq::s_free_handles;
+
+// guards s_requests, the pending lists and everything curl does on the network thread
+static std::mutex sMutex;
+static std::condition_variable sWorkCond;
+static std::condition_variable sRemovedCond;
+static std::vector<CURL*> sPendingAdd;
+static std::vector<CURL*> sPendingRemove;
+static std::thread sThread;
+static bool sRunning = false;
+static bool sWoken = false;
+
+typedef std::chrono::steady_clock Clock;
+
+// a token bucket per host, refilled with sRequestsPerSecond tokens a second (and holding as many)
+struct HostState
+{
+	HostState() : tokens(-1), backoffMs(0) {}
+
+	double tokens; // negative until the first request, then it starts out full
+	Clock::time_point lastRefill;
+	Clock::time_point blockedUntil; // backing off
+	int backoffMs;
+};
+
+static std::map<std::string, HostState> sHosts;
+static int sRequestsPerSecond = 0; // copied from the settings on the main thread, 0 is no limit
+
+// joins the network thread before the state above goes away
+static struct NetworkThreadStopper
+{
+	~NetworkThreadStopper() { HttpReq::stopNetworkThread(); }
+} sNetworkThreadStopper;
+
+// on-disk response cache for CACHE_RESPONSE requests, one file per URL
+// bump this if the layout below changes
+static const char HTTPCACHE_MAGIC[4] = { 'E', 'S', 'H', 'C' };
+static const uint32_t HTTPCACHE_VERSION = 1;
+
+static std::string getUrlHost(const std::string& url)
+{
+	size_t start = url.find("://");
+	start = (start == std::string::npos) ? 0 : start + 3;
+
+	const size_t end = url.find_first_of("/?#", start);
+	return url.substr(start, end == std::string::npos ? std::string::npos : end - start);
+}
+
+// Uses up a token and returns 0 if a request to host may start now, otherwise returns how many ms until one may.
+static int takeHostToken(const std::string& host, Clock::time_point now)
+{
+	HostState& state = sHosts[host];
+	if(now < state.blockedUntil)
+		return (int)std::chrono::duration_cast<std::chrono::milliseconds>(state.blockedUntil - now).count() + 1;
+
+	if(sRequestsPerSecond <= 0)
+		return 0;
+
+	const double burst = sRequestsPerSecond;
+	if(state.tokens < 0)
+		state.tokens = burst;
+	else
+		state.tokens = std::min(burst, state.tokens + std::chrono::duration<double>(now - state.lastRefill).count() * sRequestsPerSecond);
+	state.lastRefill = now;
+
+	if(state.tokens >= 1)
+	{
+		state.tokens -= 1;
+		return 0;
+	}
+
+	return (int)((1 - state.tokens) * 1000 / sRequestsPerSecond) + 1;
+}
+
+static void backOffHost(const std::string& host, int retryAfter, Clock::time_point now)
+{
+	HostState& state = sHosts[host];
+
+	// requests that were already out get the same answer, that's still one error in a row
+	if(now >= state.blockedUntil)
+		state.backoffMs = state.backoffMs ? std::min(state.backoffMs * 2, MAX_BACKOFF_MS) : FIRST_BACKOFF_MS;
+
+	const int delay = std::max(state.backoffMs, std::min(retryAfter * 1000, MAX_BACKOFF_MS));
+	state.blockedUntil = std::max(state.blockedUntil, now + std::chrono::milliseconds(delay));
+
+	// no burst right after waiting
+	state.tokens = 0;
+	state.lastRefill = state.blockedUntil;
+}
+
+static std::string getHttpCachePath(const std::string& url)
+{
+	std::stringstream ss;
+	ss << getHomePath() << "/.emulationstation/cache/http/" << std::hex << std::hash<std::string>()(url) << ".httpcache";
+	return ss.str();
+}
+
+static bool readHttpCacheEntry(const std::string& url, std::time_t& fetched, std::string& etag, std::string& lastModified, std::string& body)
+{
+	const std::string path = getHttpCachePath(url);
+	std::ifstream in(path.c_str(), std::ios::in | std::ios::binary);
+	if(!in.is_open())
+		return false;
+
+	char magic[4];
+	uint32_t version;
+	int64_t time;
+	std::string cachedUrl;
+	if(!in.read(magic, 4) || memcmp(magic, HTTPCACHE_MAGIC, 4) != 0 || !readU32(in, version) || version != HTTPCACHE_VERSION)
+		return false;
+
+	// a different URL with the same hash
+	if(!readString(in, cachedUrl) || cachedUrl != url)
+		return false;
+
+	if(!readI64(in, time) || !readString(in, etag) || !readString(in, lastModified) || !readString(in, body, 16 * 1024 * 1024))
+	{
+		LOG(LogWarning) << "HTTP cache entry \"" << path << "\" is truncated, ignoring it";
+		return false;
+	}
+
+	fetched = (std::time_t)time;
+	return true;
+}
+
+static bool writeHttpCacheEntry(const std::string& url, const std::string& etag, const std::string& lastModified, const std::string& body)
+{
+	const boost::filesystem::path path = getHttpCachePath(url);
+	const boost::filesystem::path tmpPath = path.generic_string() + ".tmp";
+
+	boost::system::error_code ec;
+	boost::filesystem::create_directories(path.parent_path(), ec);
+
+	{
+		std::ofstream out(tmpPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if(!out.is_open())
+		{
+			LOG(LogError) << "Could not write HTTP cache entry \"" << tmpPath.generic_string() << "\"";
+			return false;
+		}
+
+		out.write(HTTPCACHE_MAGIC, 4);
+		writeU32(out, HTTPCACHE_VERSION);
+		writeString(out, url);
+		writeI64(out, (int64_t)std::time(NULL));
+		writeString(out, etag);
+		writeString(out, lastModified);
+		writeString(out, body);
+
+		if(!out.good())
+		{
+			LOG(LogError) << "Error writing HTTP cache entry \"" << tmpPath.generic_string() << "\"";
+			return false;
+		}
+	}
+
+	// replace the old entry in one step so a crash never leaves a half-written file behind
+	boost::filesystem::rename(tmpPath, path, ec);
+	if(ec)
+	{
+		boost::filesystem::remove(tmpPath, ec);
+		return false;
+	}
+
+	return true;
+}
+
+static void lockShare(CURL* /*handle*/, curl_lock_data data, curl_lock_access /*access*/, void* /*userptr*/)
+{
+	sShareMutexes[data].lock();
+}
+
+static void unlockShare(CURL* /*handle*/, curl_lock_data data, void* /*userptr*/)
+{
+	sShareMutexes[data].unlock();
+}
+
+CURLSH* HttpReq::createShareHandle()
+{
+	// transfers use it on the network thread while acquireHandle()/releaseHandle() attach and detach handles on the
+	// main thread, so curl has to lock it
+	CURLSH* share = curl_share_init();
+	if(share == NULL)
+		return NULL;
+
+	curl_share_setopt(share, CURLSHOPT_LOCKFUNC, lockShare);
+	curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, unlockShare);
+	curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+	curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+	return share;
+}
+
+CURLM* HttpReq::createMultiHandle()
+{
+	CURLM* multi = curl_multi_init();
+	if(multi == NULL)
+		return NULL;
+
+#ifdef CURLPIPE_MULTIPLEX
+	// requests to the same HTTP/2 server share one connection
+	curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#endif
+#if LIBCURL_VERSION_NUM >= 0x071E00 // 7.30.0
+	curl_multi_setopt(multi, CURLMOPT_MAX_HOST_CONNECTIONS, (long)MAX_HOST_CONNECTIONS);
+#endif
+
+	return multi;
+}
+
+CURL* HttpReq::acquireHandle()
+{
+	CURL* handle;
+	if(!s_free_handles.empty())
+	{
+		handle = s_free_handles.back();
+		s_free_handles.pop_back();
+	}else{
+		handle = curl_easy_init();
+		if(handle == NULL)
+			return NULL;
+	}
+
+	// curl_easy_reset clears these, so they are set for every request
+	if(s_share_handle)
+		curl_easy_setopt(handle, CURLOPT_SHARE, s_share_handle);
+#if LIBCURL_VERSION_NUM >= 0x071900 // 7.25.0
+	curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L);
+#endif
+#if LIBCURL_VERSION_NUM >= 0x072F00 // 7.47.0
+	curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+#endif
+#if LIBCURL_VERSION_NUM >= 0x072B00 // 7.43.0
+	// rather wait for a connection that can multiplex than open another one
+	curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
+#endif
+
+	return handle;
+}
+
+void HttpReq::releaseHandle(CURL* handle)
+{
+	if(s_free_handles.size() >= MAX_FREE_HANDLES)
+	{
+		curl_easy_cleanup(handle);
+		return;
+	}
+
+	// open connections stay in the multi handle's cache, this only forgets our options
+	curl_easy_reset(handle);
+	s_free_handles.push_back(handle);
+}
 
 std::string HttpReq::urlEncode(const std::string &s)
 {
@@ -37,9 +319,39 @@ bool HttpReq::isUrl(const std::string& str)
 }
 
 HttpReq::HttpReq(const std::string& url)
-	: mStatus(REQ_IN_PROGRESS), mHandle(NULL)
+	: mStatus(REQ_IN_PROGRESS), mHandle(NULL), mFlags(0), mRetries(0), mRetryAfter(0), mUseCache(false), mHeaders(NULL)
+{
+	init(url);
+}
+
+HttpReq::HttpReq(const std::string& url, unsigned int flags)
+	: mStatus(REQ_IN_PROGRESS), mHandle(NULL), mFlags(flags), mRetries(0), mRetryAfter(0), 
+	mUseCache((flags & CACHE_RESPONSE) != 0), mUrl(url), mHeaders(NULL)
+{
+	if(mUseCache && useCacheEntry(url))
+		return;
+
+	init(url);
+}
+
+HttpReq::HttpReq(const std::string& url, const std::string& savePath, unsigned int flags)
+	: mStatus(REQ_IN_PROGRESS), mHandle(NULL), mFlags(flags & BULK), mRetries(0), mRetryAfter(0), 
+	mSavePath(savePath), mUseCache(false), mHeaders(NULL)
+{
+	mFile.open(savePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if(!mFile.is_open())
+	{
+		mStatus = REQ_IO_ERROR;
+		onError(("could not open \"" + savePath + "\" for writing").c_str());
+		return;
+	}
+
+	init(url);
+}
+
+void HttpReq::init(const std::string& url)
 {
-	mHandle = curl_easy_init();
+	mHandle = acquireHandle();
 
 	if(mHandle == NULL)
 	{
@@ -75,78 +387,406 @@ HttpReq::HttpReq(const std::string& url)
 		return;
 	}
 
-	//add the handle to our multi
-	CURLMcode merr = curl_multi_add_handle(s_multi_handle, mHandle);
-	if(merr != CURLM_OK)
+	// Retry-After, and the validators the server sends for CACHE_RESPONSE
+	curl_easy_setopt(mHandle, CURLOPT_HEADERFUNCTION, &HttpReq::write_header);
+	curl_easy_setopt(mHandle, CURLOPT_HEADERDATA, this);
+
+	if(mUseCache)
 	{
-		mStatus = REQ_IO_ERROR;
-		onError(curl_multi_strerror(merr));
-		return;
+		// send ours if we have an old copy
+		if(!mETag.empty())
+			mHeaders = curl_slist_append(mHeaders, ("If-None-Match: " + mETag).c_str());
+		if(!mLastModified.empty())
+			mHeaders = curl_slist_append(mHeaders, ("If-Modified-Since: " + mLastModified).c_str());
+		if(mHeaders)
+			curl_easy_setopt(mHandle, CURLOPT_HTTPHEADER, mHeaders);
 	}
 
+	mHost = getUrlHost(url);
+
+	//hand the handle to the network thread, which adds it to our multi once the host's rate limit allows it
+	std::lock_guard<std::mutex> lock(sMutex);
+	sRequestsPerSecond = Settings::getInstance()->getInt("HttpRequestsPerSecond");
+	startNetworkThread();
 	s_requests[mHandle] = this;
+	sPendingAdd.push_back(mHandle);
+	wakeNetworkThread();
 }
 
 HttpReq::~HttpReq()
 {
 	if(mHandle)
 	{
-		s_requests.erase(mHandle);
+		std::unique_lock<std::mutex> lock(sMutex);
 
-		CURLMcode merr = curl_multi_remove_handle(s_multi_handle, mHandle);
+		if(s_requests.erase(mHandle))
+		{
+			auto pending = std::find(sPendingAdd.begin(), sPendingAdd.end(), mHandle);
+			if(pending != sPendingAdd.end())
+			{
+				// the network thread never saw it
+				sPendingAdd.erase(pending);
+			}else{
+				// write_content might still be called until it's out of the multi handle
+				sPendingRemove.push_back(mHandle);
+				wakeNetworkThread();
+				sRemovedCond.wait(lock, [this] { return std::find(sPendingRemove.begin(), sPendingRemove.end(), mHandle) == sPendingRemove.end(); });
+			}
+		}
 
-		if(merr != CURLM_OK)
-			LOG(LogError) << "Error removing curl_easy handle from curl_multi: " << curl_multi_strerror(merr);
+		lock.unlock();
+		releaseHandle(mHandle);
+	}
 
-		curl_easy_cleanup(mHandle);
+	if(mHeaders)
+		curl_slist_free_all(mHeaders);
+}
+
+void HttpReq::startNetworkThread()
+{
+	if(sRunning)
+		return;
+
+	sRunning = true;
+	sThread = std::thread(&HttpReq::networkThread);
+}
+
+void HttpReq::stopNetworkThread()
+{
+	{
+		std::lock_guard<std::mutex> lock(sMutex);
+		if(!sRunning)
+			return;
+
+		sRunning = false;
+		wakeNetworkThread();
 	}
+
+	sThread.join();
 }
 
-HttpReq::Status HttpReq::status()
+void HttpReq::wakeNetworkThread()
 {
-	if(mStatus == REQ_IN_PROGRESS)
+	sWoken = true;
+	sWorkCond.notify_one();
+#if LIBCURL_VERSION_NUM >= 0x074400 // 7.68.0
+	if(s_multi_handle)
+		curl_multi_wakeup(s_multi_handle);
+#endif
+}
+
+int HttpReq::admitPending()
+{
+	const Clock::time_point now = Clock::now();
+	int wait = -1;
+
+	// interactive requests first, then BULK ones - each in the order they came in
+	for(int pass = 0; pass < 2; pass++)
 	{
-		int handle_count;
-		CURLMcode merr = curl_multi_perform(s_multi_handle, &handle_count);
-		if(merr != CURLM_OK && merr != CURLM_CALL_MULTI_PERFORM)
+		for(auto it = sPendingAdd.begin(); it != sPendingAdd.end(); )
 		{
-			mStatus = REQ_IO_ERROR;
-			onError(curl_multi_strerror(merr));
-			return mStatus;
+			HttpReq* req = s_requests[*it];
+			if(((req->mFlags & BULK) != 0) != (pass == 1))
+			{
+				it++;
+				continue;
+			}
+
+			const int delay = takeHostToken(req->mHost, now);
+			if(delay > 0)
+			{
+				if(wait < 0 || delay < wait)
+					wait = delay;
+				it++;
+				continue;
+			}
+
+			static Metrics::Counter* sent = Metrics::getCounter("es_http_requests_total", "HTTP requests sent, retries included");
+			sent->add();
+			req->mSentAt = now;
+
+			CURLMcode merr = curl_multi_add_handle(s_multi_handle, *it);
+			if(merr != CURLM_OK)
+			{
+				req->onError(curl_multi_strerror(merr));
+				req->mStatus = REQ_IO_ERROR;
+				req->runOnDone();
+			}
+			it = sPendingAdd.erase(it);
+		}
+	}
+
+	return wait;
+}
+
+void HttpReq::networkThread()
+{
+	std::unique_lock<std::mutex> lock(sMutex);
+	while(sRunning)
+	{
+		sWoken = false;
+
+		// handles only ever get added or removed here, curl_multi isn't thread safe
+		int admitWait = admitPending();
+
+		if(!sPendingRemove.empty())
+		{
+			for(auto it = sPendingRemove.begin(); it != sPendingRemove.end(); it++)
+			{
+				CURLMcode merr = curl_multi_remove_handle(s_multi_handle, *it);
+				if(merr != CURLM_OK)
+					LOG(LogError) << "Error removing curl_easy handle from curl_multi: " << curl_multi_strerror(merr);
+			}
+			sPendingRemove.clear();
+			sRemovedCond.notify_all();
 		}
 
+		int handle_count = 0;
+		CURLMcode merr = curl_multi_perform(s_multi_handle, &handle_count);
+		if(merr != CURLM_OK && merr != CURLM_CALL_MULTI_PERFORM)
+			LOG(LogError) << "curl_multi_perform failed: " << curl_multi_strerror(merr);
+
+		bool finished = false;
 		int msgs_left;
 		CURLMsg* msg;
-		while(msg = curl_multi_info_read(s_multi_handle, &msgs_left))
+		while((msg = curl_multi_info_read(s_multi_handle, &msgs_left)))
 		{
 			if(msg->msg == CURLMSG_DONE)
 			{
-				HttpReq* req = s_requests[msg->easy_handle];
-				
-				if(req == NULL)
+				auto reqIt = s_requests.find(msg->easy_handle);
+				if(reqIt == s_requests.end())
 				{
 					LOG(LogError) << "Cannot find easy handle!";
 					continue;
 				}
 
-				if(msg->data.result == CURLE_OK)
+				CURL* handle = msg->easy_handle;
+				if(reqIt->second->onFinished(msg->data.result))
 				{
-					req->mStatus = REQ_SUCCESS;
+					// it waits in line again until the host's backoff is over
+					curl_multi_remove_handle(s_multi_handle, handle);
+					sPendingAdd.push_back(handle);
+					admitWait = admitPending();
 				}else{
-					req->mStatus = REQ_IO_ERROR;
-					req->onError(curl_easy_strerror(msg->data.result));
+					finished = true;
+					reqIt->second->runOnDone();
 				}
 			}
 		}
+
+		if(finished)
+		{
+			// wake up the main loop in case it's waiting for events while idle
+			SDL_Event wake;
+			SDL_zero(wake);
+			wake.type = SDL_USEREVENT;
+			SDL_PushEvent(&wake);
+		}
+
+		if(handle_count == 0)
+		{
+			// nothing to do until a request comes in, or a waiting one may start
+			auto woken = [] { return !sRunning || sWoken; };
+			if(admitWait < 0)
+				sWorkCond.wait(lock, woken);
+			else
+				sWorkCond.wait_for(lock, std::chrono::milliseconds(admitWait), woken);
+			continue;
+		}
+
+		lock.unlock();
+		// poll needs curl_multi_wakeup() (7.68.0) to be woken early, so it shares wakeNetworkThread()'s gate
+#if LIBCURL_VERSION_NUM >= 0x074400 // 7.68.0
+		curl_multi_poll(s_multi_handle, NULL, 0, admitWait < 0 ? 1000 : std::min(admitWait, 1000), NULL);
+#else
+		// can't be woken up early, keep the wait short so new requests don't sit around
+		curl_multi_wait(s_multi_handle, NULL, 0, admitWait < 0 ? 50 : std::min(admitWait, 50), NULL);
+#endif
+		lock.lock();
 	}
+}
 
+bool HttpReq::onFinished(CURLcode result)
+{
+	static Metrics::Histogram* latency = Metrics::getHistogram("es_http_latency_ms", "Time from sending an HTTP request to its response");
+	static Metrics::Counter* retries = Metrics::getCounter("es_http_retries_total", "HTTP requests sent again after a 429/5xx");
+	static Metrics::Counter* failures = Metrics::getCounter("es_http_failures_total", "HTTP requests that ended in an error");
+
+	latency->record(std::chrono::duration<float, std::milli>(Clock::now() - mSentAt).count());
+
+	const bool retry = handleResponse(result);
+	if(retry)
+		retries->add();
+	else if(mStatus != REQ_SUCCESS)
+		failures->add();
+	return retry;
+}
+
+bool HttpReq::handleResponse(CURLcode result)
+{
+	long code = 0;
+	if(result == CURLE_OK)
+		curl_easy_getinfo(mHandle, CURLINFO_RESPONSE_CODE, &code);
+
+	// the server is overloaded or wants us to slow down
+	const bool busy = (code == 429 || code >= 500);
+	if(busy && mRetries < MAX_RETRIES)
+	{
+		backOffHost(mHost, mRetryAfter, Clock::now());
+		LOG(LogWarning) << "HTTP " << code << " from " << mHost << ", backing off before trying again";
+
+		mRetries++;
+		mRetryAfter = 0;
+		mContent.clear();
+		if(mFile.is_open())
+		{
+			mFile.close();
+			mFile.clear();
+			mFile.open(mSavePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+			if(!mFile.is_open())
+			{
+				onError(("could not open \"" + mSavePath + "\" for writing").c_str());
+				mStatus = REQ_IO_ERROR;
+				return false;
+			}
+		}
+		return true;
+	}
+
+	if(code != 0 && !busy)
+		sHosts[mHost].backoffMs = 0;
+
+	if(mFile.is_open())
+	{
+		// make sure everything is on disk before anyone looks at the file
+		mFile.close();
+		if(mFile.fail() && result == CURLE_OK)
+		{
+			onError(("error writing \"" + mSavePath + "\"").c_str());
+			mStatus = REQ_IO_ERROR;
+			return false;
+		}
+	}
+
+	if(result != CURLE_OK)
+	{
+		onError(curl_easy_strerror(result));
+		mStatus = REQ_IO_ERROR;
+		return false;
+	}
+
+	if(busy)
+	{
+		std::stringstream ss;
+		ss << "server busy (HTTP " << code << ")";
+		onError(ss.str().c_str());
+		mStatus = REQ_BAD_STATUS_CODE;
+		return false;
+	}
+
+	if(mUseCache)
+	{
+		if(code == 304 && mHeaders != NULL)
+		{
+			// our copy is still good
+			mContent.swap(mCachedBody);
+			writeHttpCacheEntry(mUrl, mETag, mLastModified, mContent);
+		}else if(code == 200)
+		{
+			writeHttpCacheEntry(mUrl, mETag, mLastModified, mContent);
+		}
+	}
+
+	mStatus = REQ_SUCCESS;
+	return false;
+}
+
+bool HttpReq::useCacheEntry(const std::string& url)
+{
+	static Metrics::Counter* cacheHits = Metrics::getCounter("es_http_cache_hits_total", "HTTP requests answered from the response cache without asking the server");
+
+	std::time_t fetched;
+	if(!readHttpCacheEntry(url, fetched, mETag, mLastModified, mCachedBody))
+		return false;
+
+	const int maxAge = Settings::getInstance()->getInt("HttpCacheMaxAge");
+	if(maxAge > 0 && std::time(NULL) - fetched < maxAge)
+	{
+		mContent.swap(mCachedBody);
+		mStatus = REQ_SUCCESS;
+		cacheHits->add();
+		return true;
+	}
+
+	// too old to trust without asking, but the server might say it hasn't changed
+	if(mETag.empty() && mLastModified.empty())
+		mCachedBody.clear();
+	return false;
+}
+
+Future< std::shared_ptr<HttpReq> > HttpReq::fetch(const std::string& url, unsigned int flags)
+{
+	return watch(std::make_shared<HttpReq>(url, flags));
+}
+
+Future< std::shared_ptr<HttpReq> > HttpReq::fetch(const std::string& url, const std::string& savePath, unsigned int flags)
+{
+	return watch(std::make_shared<HttpReq>(url, savePath, flags));
+}
+
+Future< std::shared_ptr<HttpReq> > HttpReq::watch(const std::shared_ptr<HttpReq>& req)
+{
+	// the request keeps itself alive through mOnDone until it's done, then it's handed to the main thread, which is
+	// where it's destroyed (the network thread would wait on itself)
+	Promise< std::shared_ptr<HttpReq> > promise;
+	req->onDone([promise, req] {
+		if(req->status() == REQ_SUCCESS)
+			promise.setValue(req);
+		else
+			promise.setError(req->getErrorMsg());
+	});
+	return promise.getFuture();
+}
+
+void HttpReq::onDone(const std::function<void()>& done)
+{
+	{
+		std::lock_guard<std::mutex> lock(sMutex);
+		if(mStatus == REQ_IN_PROGRESS)
+		{
+			mOnDone = done;
+			return;
+		}
+	}
+
+	TaskScheduler::getInstance()->runOnMainThread(done);
+}
+
+void HttpReq::runOnDone()
+{
+	if(!mOnDone)
+		return;
+
+	// mOnDone is what keeps us alive. It goes to the main thread whole, behind a pointer only that job deletes, so the
+	// last reference is always let go of there: on the network thread ~HttpReq would wait for the network thread.
+	std::function<void()>* done = new std::function<void()>();
+	done->swap(mOnDone);
+	TaskScheduler::getInstance()->runOnMainThread([done] {
+		(*done)();
+		delete done;
+	});
+}
+
+HttpReq::Status HttpReq::status()
+{
+	// the network thread does the actual work
 	return mStatus;
 }
 
-std::string HttpReq::getContent() const
+const std::string& HttpReq::getContent() const
 {
 	assert(mStatus == REQ_SUCCESS);
-	return mContent.str();
+	return mContent;
 }
 
 void HttpReq::onError(const char* msg)
@@ -161,13 +801,45 @@ std::string HttpReq::getErrorMsg()
 
 //used as a curl callback
 //size = size of an element, nmemb = number of elements
-//return value is number of elements successfully read
+//return value is number of bytes successfully written, anything else makes curl abort the transfer
 size_t HttpReq::write_content(void* buff, size_t size, size_t nmemb, void* req_ptr)
 {
-	std::stringstream& ss = ((HttpReq*)req_ptr)->mContent;
-	ss.write((char*)buff, size * nmemb);
+	HttpReq* req = (HttpReq*)req_ptr;
+	if(req->mFile.is_open())
+	{
+		req->mFile.write((char*)buff, size * nmemb);
+		return req->mFile.good() ? size * nmemb : 0;
+	}
+
+	req->mContent.append((char*)buff, size * nmemb);
+	return size * nmemb;
+}
+
+//used as a curl callback, called once per header line
+size_t HttpReq::write_header(char* buff, size_t size, size_t nitems, void* req_ptr)
+{
+	HttpReq* req = (HttpReq*)req_ptr;
+	const std::string line(buff, size * nitems);
+
+	const size_t colon = line.find(':');
+	if(colon != std::string::npos)
+	{
+		std::string name = line.substr(0, colon);
+		std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+
+		const size_t start = line.find_first_not_of(" \t", colon + 1);
+		const size_t end = line.find_last_not_of(" \t\r\n");
+		const std::string value = (start == std::string::npos || end < start) ? "" : line.substr(start, end - start + 1);
+
+		if(name == "etag")
+			req->mETag = value;
+		else if(name == "last-modified")
+			req->mLastModified = value;
+		else if(name == "retry-after")
+			req->mRetryAfter = atoi(value.c_str()); // we don't bother with the HTTP-date form
+	}
 
-	return nmemb;
+	return size * nitems;
 }
 
 //used as a curl callback
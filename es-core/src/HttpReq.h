@@ -2,7 +2,14 @@
 
 #include <curl/curl.h>
 #include <sstream>
+#include <fstream>
 #include <map>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <functional>
+#include "Future.h"
 
 /* Usage:
  * HttpReq myRequest("www.google.com", "/index.html");
@@ -26,6 +33,22 @@ class HttpReq
 public:
 	HttpReq(const std::string& url);
 
+	enum Flags
+	{
+		// Keep the response on disk (keyed by URL). Fresh copies are used without asking the server, as set by
+		// "HttpCacheMaxAge"; older ones are revalidated with If-None-Match/If-Modified-Since.
+		CACHE_RESPONSE = 1,
+
+		// Background work (batch scraping), only sent when no request without this flag is waiting for the host.
+		BULK = 2
+	};
+
+	HttpReq(const std::string& url, unsigned int flags);
+
+	// Streams the body straight into the file at savePath instead of keeping it in memory;
+	// getContent() stays empty. The file is complete once status() is REQ_SUCCESS. Only BULK applies to flags.
+	HttpReq(const std::string& url, const std::string& savePath, unsigned int flags = 0);
+
 	~HttpReq();
 
 	enum Status
@@ -34,7 +57,7 @@ public:
 		REQ_SUCCESS,			//request completed successfully, get it with getContent()
 
 		REQ_IO_ERROR,			//some boost::asio error happened, get it with getErrorMsg()
-		REQ_BAD_STATUS_CODE,	//some invalid HTTP response status code happened (non-200)
+		REQ_BAD_STATUS_CODE,	//the server stayed busy (429/5xx) after retrying
 		REQ_INVALID_RESPONSE	//the HTTP response was invalid
 	};
 
@@ -42,11 +65,21 @@ public:
 
 	std::string getErrorMsg();
 
-	std::string getContent() const; // mStatus must be REQ_SUCCESS
+	const std::string& getContent() const; // mStatus must be REQ_SUCCESS
+
+	// Starts the request and gets it back once it's done, without anyone polling status(): the Future fails with
+	// getErrorMsg() if the request does. Dropping the Future doesn't stop the request, it's let go of once it's done.
+	static Future< std::shared_ptr<HttpReq> > fetch(const std::string& url, unsigned int flags = 0);
+	static Future< std::shared_ptr<HttpReq> > fetch(const std::string& url, const std::string& savePath, unsigned int flags = 0);
 
 	static std::string urlEncode(const std::string &s);
 	static bool isUrl(const std::string& s);
 
+	// Requests are driven by a network thread that starts with the first one. Waits for it to exit.
+	// It only lets "HttpRequestsPerSecond" requests per host through, and backs off from a host that answers
+	// 429 or 5xx (doubling the wait every time, or as long as Retry-After says) before trying them again.
+	static void stopNetworkThread();
+
 private:
 	static size_t write_content(void* buff, size_t size, size_t nmemb, void* req_ptr);
 	//static int update_progress(void* req_ptr, double dlTotal, double dlNow, double ulTotal, double ulNow);
@@ -57,12 +90,55 @@ private:
 
 	static CURLM* s_multi_handle;
 
+	// DNS results and TLS sessions are shared by all requests, connections already are through the multi handle
+	static CURLSH* s_share_handle;
+
+	// finished easy handles are reset and kept for the next request instead of being cleaned up
+	static std::vector<CURL*> s_free_handles;
+
+	static CURLM* createMultiHandle();
+	static CURLSH* createShareHandle();
+	static CURL* acquireHandle();
+	static void releaseHandle(CURL* handle);
+
+	static void startNetworkThread();
+	static void wakeNetworkThread();
+	static void networkThread();
+	static int admitPending();
+
+	void init(const std::string& url);
+
+	// done runs on the main thread (from TaskScheduler::update()) once status() isn't REQ_IN_PROGRESS, and is
+	// destroyed there too, so it can hold the last reference to this request
+	void onDone(const std::function<void()>& done);
+	void runOnDone(); // from the network thread, once it's done with us; hands mOnDone to the main thread
+	static Future< std::shared_ptr<HttpReq> > watch(const std::shared_ptr<HttpReq>& req);
+	bool useCacheEntry(const std::string& url);
+	bool onFinished(CURLcode result); // on the network thread, returns true if the request has to be sent again
+	bool handleResponse(CURLcode result); // onFinished() minus the metrics
+	static size_t write_header(char* buff, size_t size, size_t nitems, void* req_ptr);
 	void onError(const char* msg);
 
 	CURL* mHandle;
-
-	Status mStatus;
-
-	std::stringstream mContent;
+	unsigned int mFlags;
+	std::string mHost;
+	int mRetries;
+	int mRetryAfter; // seconds, from the last response
+	std::chrono::steady_clock::time_point mSentAt; // when the current attempt was handed to curl
+
+	std::atomic<Status> mStatus; // set by the network thread
+	std::function<void()> mOnDone; // guarded by the network thread's lock
+
+	std::string mContent;
+	std::ofstream mFile; // only open when saving to a file
+	std::string mSavePath;
+
+	// CACHE_RESPONSE state
+	bool mUseCache;
+	std::string mUrl;
+	std::string mCachedBody; // what we send a conditional request for
+	std::string mETag;
+	std::string mLastModified;
+	curl_slist* mHeaders;
 	std::string mErrorMsg;
 };
@@ -1,27 +1,180 @@
 #include "ImageIO.h"
 
 #include <memory.h>
+#include <algorithm>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#ifdef USE_TURBOJPEG
+#include <turbojpeg.h>
+#endif
+#ifdef USE_SPNG
+#include <spng.h>
+#endif
 
 #include "Log.h"
 
+// anything bigger than this on a side is a broken (or hostile) file, not box art
+#define NATIVE_DECODE_MAX_SIZE 16384
+
+#ifdef USE_TURBOJPEG
+// Decodes straight into RGBA, bottom row first, at the smallest DCT scale that still leaves the longest side at least
+// max(maxWidth, maxHeight) (like FreeImage's JPEG size hint). False for anything it can't do (e.g. CMYK), for FreeImage to try.
+static bool decodeJPEG(const unsigned char* data, size_t size, size_t maxWidth, size_t maxHeight, 
+	std::vector<unsigned char>& rawData, size_t& width, size_t& height)
+{
+	tjhandle tj = tjInitDecompress();
+	if(!tj)
+		return false;
+
+	int w, h, subsamp, colorspace;
+	bool ok = tjDecompressHeader3(tj, data, (unsigned long)size, &w, &h, &subsamp, &colorspace) == 0 && 
+		w > 0 && h > 0 && w <= NATIVE_DECODE_MAX_SIZE && h <= NATIVE_DECODE_MAX_SIZE;
+
+	if(ok)
+	{
+		int scaledW = w, scaledH = h;
+		const int target = (int)std::max(maxWidth, maxHeight);
+		if(maxWidth && maxHeight)
+		{
+			int count = 0;
+			tjscalingfactor* factors = tjGetScalingFactors(&count);
+			for(int i = 0; factors && i < count; i++)
+			{
+				if(factors[i].num > factors[i].denom)
+					continue;
+
+				const int sw = TJSCALED(w, factors[i]);
+				const int sh = TJSCALED(h, factors[i]);
+				if(std::max(sw, sh) >= target && sw * sh < scaledW * scaledH)
+				{
+					scaledW = sw;
+					scaledH = sh;
+				}
+			}
+		}
+
+		rawData.resize((size_t)scaledW * scaledH * 4);
+		ok = tjDecompress2(tj, data, (unsigned long)size, rawData.data(), scaledW, 0, scaledH, TJPF_RGBA, TJFLAG_BOTTOMUP) == 0;
+		if(ok)
+		{
+			width = scaledW;
+			height = scaledH;
+		}else{
+			rawData.clear();
+		}
+	}
+
+	tjDestroy(tj);
+	return ok;
+}
+#endif
+
+#ifdef USE_SPNG
+// Decodes straight into RGBA, bottom row first (rows are decoded one at a time into their flipped place).
+// False for interlaced or broken files, for FreeImage to try.
+static bool decodePNG(const unsigned char* data, size_t size, std::vector<unsigned char>& rawData, size_t& width, size_t& height)
+{
+	spng_ctx* ctx = spng_ctx_new(0);
+	if(!ctx)
+		return false;
+
+	struct spng_ihdr ihdr;
+	size_t imageSize = 0;
+	bool ok = spng_set_image_limits(ctx, NATIVE_DECODE_MAX_SIZE, NATIVE_DECODE_MAX_SIZE) == 0 && 
+		spng_set_png_buffer(ctx, data, size) == 0 && spng_get_ihdr(ctx, &ihdr) == 0 && ihdr.interlace_method == 0 && 
+		spng_decoded_image_size(ctx, SPNG_FMT_RGBA8, &imageSize) == 0 && 
+		spng_decode_image(ctx, NULL, 0, SPNG_FMT_RGBA8, SPNG_DECODE_TRNS | SPNG_DECODE_PROGRESSIVE) == 0;
+
+	if(ok)
+	{
+		const size_t rowBytes = (size_t)ihdr.width * 4;
+		rawData.resize(imageSize);
+
+		int ret;
+		do
+		{
+			struct spng_row_info row;
+			ret = spng_get_row_info(ctx, &row);
+			if(ret)
+				break;
+
+			ret = spng_decode_row(ctx, rawData.data() + (ihdr.height - 1 - row.row_num) * rowBytes, rowBytes);
+		}while(ret == 0);
+
+		ok = ret == SPNG_EOI;
+		if(ok)
+		{
+			width = ihdr.width;
+			height = ihdr.height;
+		}else{
+			rawData.clear();
+		}
+	}
+
+	spng_ctx_free(ctx);
+	return ok;
+}
+#endif
+
+// PNGs and JPEGs skip FreeImage (and its conversion, copy and red/blue swap) if we were built with a decoder for them
+static bool decodeNative(const unsigned char* data, size_t size, size_t maxWidth, size_t maxHeight, 
+	std::vector<unsigned char>& rawData, size_t& width, size_t& height)
+{
+#ifdef USE_TURBOJPEG
+	if(size > 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF)
+		return decodeJPEG(data, size, maxWidth, maxHeight, rawData, width, height);
+#endif
+#ifdef USE_SPNG
+	static const unsigned char PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	if(size > sizeof(PNG_SIGNATURE) && memcmp(data, PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) == 0)
+		return decodePNG(data, size, rawData, width, height);
+#endif
+	return false;
+}
+
 
 std::vector<unsigned char> ImageIO::loadFromMemoryRGBA32(const unsigned char * data, const size_t size, size_t & width, size_t & height)
+{
+	return loadFromMemoryRGBA32(data, size, width, height, 0, 0);
+}
+
+std::vector<unsigned char> ImageIO::loadFromMemoryRGBA32(const unsigned char * data, const size_t size, size_t & width, size_t & height, 
+	size_t maxWidth, size_t maxHeight)
 {
 	std::vector<unsigned char> rawData;
 	width = 0;
 	height = 0;
+
+	if(decodeNative(data, size, maxWidth, maxHeight, rawData, width, height))
+	{
+		shrinkRGBA32ToFit(rawData, width, height, maxWidth, maxHeight);
+		return rawData;
+	}
+
 	FIMEMORY * fiMemory = FreeImage_OpenMemory((BYTE *)data, size);
 	if (fiMemory != nullptr) {
 		//detect the filetype from data
 		FREE_IMAGE_FORMAT format = FreeImage_GetFileTypeFromMemory(fiMemory);
 		if (format != FIF_UNKNOWN && FreeImage_FIFSupportsReading(format))
 		{
+			//JPEGs can be decoded at a fraction of their size (DCT scaling), which is a lot cheaper than decoding it all
+			//FreeImage takes the size in the upper 16 bits and guarantees the largest side ends up at least that big
+			int flags = 0;
+			if(format == FIF_JPEG && maxWidth && maxHeight)
+				flags = (int)(std::min<size_t>(std::max(maxWidth, maxHeight), 0xFFFF) << 16);
+
 			//file type is supported. load image
-			FIBITMAP * fiBitmap = FreeImage_LoadFromMemory(format, fiMemory);
+			FIBITMAP * fiBitmap = FreeImage_LoadFromMemory(format, fiMemory, flags);
 			if (fiBitmap != nullptr)
 			{
 				//loaded. convert to 32bit if necessary
-				FIBITMAP * fiConverted = nullptr;
 				if (FreeImage_GetBPP(fiBitmap) != 32)
 				{
 					FIBITMAP * fiConverted = FreeImage_ConvertTo32Bits(fiBitmap);
@@ -36,30 +189,22 @@ std::vector<unsigned char> ImageIO::loadFromMemoryRGBA32(const unsigned char * d
 				{
 					width = FreeImage_GetWidth(fiBitmap);
 					height = FreeImage_GetHeight(fiBitmap);
-					unsigned int pitch = FreeImage_GetPitch(fiBitmap);
 					//loop through scanlines and add all pixel data to the return vector
 					//this is necessary, because width*height*bpp might not be == pitch
-					unsigned char * tempData = new unsigned char[width * height * 4];
+					rawData.resize(width * height * 4);
 					for (size_t i = 0; i < height; i++)
 					{
 						const BYTE * scanLine = FreeImage_GetScanLine(fiBitmap, i);
-						memcpy(tempData + (i * width * 4), scanLine, width * 4);
+						memcpy(rawData.data() + (i * width * 4), scanLine, width * 4);
 					}
-					//convert from BGRA to RGBA
-					for(size_t i = 0; i < width*height; i++)
-					{
-						RGBQUAD bgra = ((RGBQUAD *)tempData)[i];
-						RGBQUAD rgba;
-						rgba.rgbBlue = bgra.rgbRed;
-						rgba.rgbGreen = bgra.rgbGreen;
-						rgba.rgbRed = bgra.rgbBlue;
-						rgba.rgbReserved = bgra.rgbReserved;
-						((RGBQUAD *)tempData)[i] = rgba;
-					}
-					rawData = std::vector<unsigned char>(tempData, tempData + width * height * 4);
 					//free bitmap data
 					FreeImage_Unload(fiBitmap);
-					delete[] tempData;
+
+					//scale down what's left before doing any more work per pixel
+					shrinkRGBA32ToFit(rawData, width, height, maxWidth, maxHeight);
+
+					//convert from BGRA to RGBA
+					swapRedBlue(rawData.data(), width * height);
 				}
 			}
 			else
@@ -79,15 +224,326 @@ std::vector<unsigned char> ImageIO::loadFromMemoryRGBA32(const unsigned char * d
 
 void ImageIO::flipPixelsVert(unsigned char* imagePx, const size_t& width, const size_t& height)
 {
-	unsigned int temp;
-	unsigned int* arr = (unsigned int*)imagePx;
+	// swap whole rows, memcpy is already as vectorized as it gets
+	const size_t rowSize = width * 4;
+	std::vector<unsigned char> temp(rowSize);
 	for(size_t y = 0; y < height / 2; y++)
 	{
-		for(size_t x = 0; x < width; x++)
+		unsigned char* top = imagePx + y * rowSize;
+		unsigned char* bottom = imagePx + (height - y - 1) * rowSize;
+		memcpy(temp.data(), top, rowSize);
+		memcpy(top, bottom, rowSize);
+		memcpy(bottom, temp.data(), rowSize);
+	}
+}
+
+void ImageIO::swapRedBlue(unsigned char* imagePx, size_t pixelCount)
+{
+	size_t i = 0;
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+	// 16 pixels at a time, deinterleaved into one register per channel
+	for(; i + 16 <= pixelCount; i += 16)
+	{
+		uint8x16x4_t px = vld4q_u8(imagePx + i * 4);
+		uint8x16_t tmp = px.val[0];
+		px.val[0] = px.val[2];
+		px.val[2] = tmp;
+		vst4q_u8(imagePx + i * 4, px);
+	}
+#elif defined(__SSE2__)
+	// 4 pixels at a time, moving bytes 0 and 2 of every 32 bit lane across (x86 is little endian)
+	const __m128i keepMask = _mm_set1_epi32(0xFF00FF00);
+	const __m128i lowMask = _mm_set1_epi32(0x000000FF);
+	for(; i + 4 <= pixelCount; i += 4)
+	{
+		__m128i px = _mm_loadu_si128((const __m128i*)(imagePx + i * 4));
+		__m128i swapped = _mm_or_si128(_mm_and_si128(px, keepMask), 
+			_mm_or_si128(_mm_and_si128(_mm_srli_epi32(px, 16), lowMask), _mm_slli_epi32(_mm_and_si128(px, lowMask), 16)));
+		_mm_storeu_si128((__m128i*)(imagePx + i * 4), swapped);
+	}
+#endif
+
+	// whatever's left (or everything, without SIMD)
+	for(; i < pixelCount; i++)
+	{
+		unsigned char* p = imagePx + i * 4;
+		unsigned char tmp = p[0];
+		p[0] = p[2];
+		p[2] = tmp;
+	}
+}
+
+void ImageIO::shrinkRGBA32ToFit(std::vector<unsigned char>& imageRGBA, size_t& width, size_t& height, size_t maxWidth, size_t maxHeight)
+{
+	if(width == 0 || height == 0 || (maxWidth == 0 && maxHeight == 0))
+		return;
+
+	double scale = 1.0;
+	if(maxWidth && width > maxWidth)
+		scale = (double)maxWidth / width;
+	if(maxHeight && height > maxHeight && (double)maxHeight / height < scale)
+		scale = (double)maxHeight / height;
+
+	if(scale >= 1.0)
+		return;
+
+	const size_t newWidth = std::max<size_t>(1, (size_t)(width * scale + 0.5));
+	const size_t newHeight = std::max<size_t>(1, (size_t)(height * scale + 0.5));
+
+	std::vector<unsigned char> out(newWidth * newHeight * 4);
+	for(size_t y = 0; y < newHeight; y++)
+	{
+		const size_t y0 = y * height / newHeight;
+		const size_t y1 = std::max(y0 + 1, (y + 1) * height / newHeight);
+		for(size_t x = 0; x < newWidth; x++)
+		{
+			const size_t x0 = x * width / newWidth;
+			const size_t x1 = std::max(x0 + 1, (x + 1) * width / newWidth);
+
+			// average every source pixel that falls in this one
+			unsigned int sum[4] = { 0, 0, 0, 0 };
+			for(size_t sy = y0; sy < y1; sy++)
+			{
+				const unsigned char* src = &imageRGBA[(sy * width + x0) * 4];
+				for(size_t sx = x0; sx < x1; sx++, src += 4)
+				{
+					sum[0] += src[0];
+					sum[1] += src[1];
+					sum[2] += src[2];
+					sum[3] += src[3];
+				}
+			}
+
+			const unsigned int count = (unsigned int)((y1 - y0) * (x1 - x0));
+			unsigned char* dst = &out[(y * newWidth + x) * 4];
+			for(int c = 0; c < 4; c++)
+				dst[c] = (unsigned char)(sum[c] / count);
+		}
+	}
+
+	imageRGBA.swap(out);
+	width = newWidth;
+	height = newHeight;
+}
+
+// GL enums for the formats we know, so this doesn't need a GL header
+#define FORMAT_S3TC_DXT1_RGBA 0x83F1
+#define FORMAT_S3TC_DXT3_RGBA 0x83F2
+#define FORMAT_S3TC_DXT5_RGBA 0x83F3
+
+// bigger than any GPU takes, and small enough that a level's size can't overflow whatever the header says
+#define COMPRESSED_MAX_SIZE 16384
+
+static inline uint32_t readLE32(const unsigned char* p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+bool ImageIO::isCompressedFile(const std::string& path)
+{
+	if(path.size() < 4)
+		return false;
+
+	std::string ext = path.substr(path.size() - 4);
+	std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+	return ext == ".ktx" || ext == ".dds";
+}
+
+static bool loadKTX(const unsigned char* data, const size_t size, ImageIO::CompressedImage& image)
+{
+	static const unsigned char KTX_MAGIC[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+	const size_t headerSize = 12 + 13 * 4;
+	if(size < headerSize + 4 || memcmp(data, KTX_MAGIC, 12) != 0)
+		return false;
+
+	const unsigned char* header = data + 12;
+	if(readLE32(header) != 0x04030201)
+	{
+		LOG(LogError) << "Big endian KTX files are not supported";
+		return false;
+	}
+
+	const uint32_t glType = readLE32(header + 4);
+	const uint32_t glInternalFormat = readLE32(header + 16);
+	const uint32_t width = readLE32(header + 24);
+	const uint32_t height = readLE32(header + 28);
+	const uint32_t depth = readLE32(header + 32);
+	const uint32_t arrayElements = readLE32(header + 36);
+	const uint32_t faces = readLE32(header + 40);
+	const uint32_t keyValueBytes = readLE32(header + 48);
+
+	// glType is 0 for compressed formats, uncompressed KTX files gain nothing over a png
+	if(glType != 0 || width == 0 || height == 0 || depth > 1 || arrayElements > 1 || faces != 1)
+	{
+		LOG(LogError) << "Unsupported KTX file (only compressed 2D textures are supported)";
+		return false;
+	}
+
+	if(width > COMPRESSED_MAX_SIZE || height > COMPRESSED_MAX_SIZE || keyValueBytes > size - headerSize)
+	{
+		LOG(LogError) << "Invalid KTX file (" << width << "x" << height << ")";
+		return false;
+	}
+
+	// ETC blocks can't be flipped like DXT ones, so the file has to already be stored bottom row first
+	// (KTXorientation "S=r,T=u", e.g. toktx --lower_left_maps_to_s0t0); the KTX default is top row first
+	const std::string orientationKey = "KTXorientation";
+	bool bottomUp = false;
+	for(size_t offset = headerSize; offset + 4 <= headerSize + keyValueBytes && offset + 4 <= size; )
+	{
+		const uint32_t pairSize = readLE32(data + offset);
+		const char* pair = (const char*)data + offset + 4;
+		if(pairSize > size - offset - 4)
+			break;
+
+		const std::string key(pair, strnlen(pair, pairSize));
+		if(key == orientationKey && pairSize > key.size() + 1)
 		{
-			temp = arr[x + (y * width)];
-			arr[x + (y * width)] = arr[x + (height * width) - ((y + 1) * width)];
-			arr[x + (height * width) - ((y + 1) * width)] = temp;
+			const std::string value(pair + key.size() + 1, strnlen(pair + key.size() + 1, pairSize - key.size() - 1));
+			bottomUp = value.find("T=u") != std::string::npos;
 		}
+
+		offset += 4 + ((pairSize + 3) & ~3u);
+	}
+
+	if(!bottomUp)
+		LOG(LogWarning) << "KTX file is not stored bottom-up (KTXorientation S=r,T=u), it will be drawn upside down";
+
+	const size_t levelOffset = headerSize + keyValueBytes;
+	if(levelOffset + 4 > size)
+		return false;
+
+	const uint32_t levelSize = readLE32(data + levelOffset);
+	if(levelSize == 0 || levelSize > size - levelOffset - 4)
+		return false;
+
+	image.glFormat = glInternalFormat;
+	image.width = width;
+	image.height = height;
+	image.data.assign(data + levelOffset + 4, data + levelOffset + 4 + levelSize);
+	return true;
+}
+
+// textures are uploaded bottom row first everywhere else (that's how FreeImage hands them to us),
+// DDS files are top row first - DXT blocks can be flipped without decoding them
+static void flipDXTBlockRows(unsigned char* block, size_t blockSize, unsigned int glFormat)
+{
+	// color part (last 8 bytes): two 565 colors, then one byte of 2 bit indices per row
+	unsigned char* color = block + blockSize - 8;
+	std::swap(color[4], color[7]);
+	std::swap(color[5], color[6]);
+
+	if(glFormat == FORMAT_S3TC_DXT3_RGBA)
+	{
+		// explicit alpha: 16 bits per row
+		std::swap(block[0], block[6]);
+		std::swap(block[1], block[7]);
+		std::swap(block[2], block[4]);
+		std::swap(block[3], block[5]);
+	}else if(glFormat == FORMAT_S3TC_DXT5_RGBA)
+	{
+		// interpolated alpha: two endpoints, then 48 bits of 3 bit indices (12 bits per row)
+		uint64_t bits = 0;
+		for(int i = 0; i < 6; i++)
+			bits |= (uint64_t)block[2 + i] << (8 * i);
+
+		uint64_t flipped = 0;
+		for(int row = 0; row < 4; row++)
+			flipped |= ((bits >> (12 * row)) & 0xFFF) << (12 * (3 - row));
+
+		for(int i = 0; i < 6; i++)
+			block[2 + i] = (unsigned char)(flipped >> (8 * i));
+	}
+}
+
+static bool flipDXTVert(std::vector<unsigned char>& data, size_t width, size_t height, size_t blockSize, unsigned int glFormat)
+{
+	// heights that aren't a multiple of 4 end up shifted by the padding rows, close enough for UI art
+	const size_t rowSize = std::max<size_t>(1, (width + 3) / 4) * blockSize;
+	const size_t rows = std::max<size_t>(1, (height + 3) / 4);
+	if(data.size() != rows * rowSize)
+		return false;
+
+	for(size_t i = 0; i + blockSize <= data.size(); i += blockSize)
+		flipDXTBlockRows(data.data() + i, blockSize, glFormat);
+
+	std::vector<unsigned char> temp(rowSize);
+	for(size_t y = 0; y < rows / 2; y++)
+	{
+		unsigned char* top = data.data() + y * rowSize;
+		unsigned char* bottom = data.data() + (rows - y - 1) * rowSize;
+		memcpy(temp.data(), top, rowSize);
+		memcpy(top, bottom, rowSize);
+		memcpy(bottom, temp.data(), rowSize);
+	}
+	return true;
+}
+
+static bool loadDDS(const unsigned char* data, const size_t size, ImageIO::CompressedImage& image)
+{
+	const size_t headerSize = 4 + 124;
+	if(size < headerSize || memcmp(data, "DDS ", 4) != 0 || readLE32(data + 4) != 124)
+		return false;
+
+	const uint32_t height = readLE32(data + 12);
+	const uint32_t width = readLE32(data + 16);
+	const uint32_t pixelFormatFlags = readLE32(data + 80);
+	const unsigned char* fourCC = data + 84;
+
+	const uint32_t DDPF_FOURCC = 0x4;
+	if(!(pixelFormatFlags & DDPF_FOURCC) || width == 0 || height == 0)
+	{
+		LOG(LogError) << "Unsupported DDS file (only DXT1/DXT3/DXT5 are supported)";
+		return false;
+	}
+
+	if(width > COMPRESSED_MAX_SIZE || height > COMPRESSED_MAX_SIZE)
+	{
+		LOG(LogError) << "Invalid DDS file (" << width << "x" << height << ")";
+		return false;
+	}
+
+	size_t blockSize;
+	if(memcmp(fourCC, "DXT1", 4) == 0)
+	{
+		image.glFormat = FORMAT_S3TC_DXT1_RGBA;
+		blockSize = 8;
+	}else if(memcmp(fourCC, "DXT3", 4) == 0)
+	{
+		image.glFormat = FORMAT_S3TC_DXT3_RGBA;
+		blockSize = 16;
+	}else if(memcmp(fourCC, "DXT5", 4) == 0)
+	{
+		image.glFormat = FORMAT_S3TC_DXT5_RGBA;
+		blockSize = 16;
+	}else{
+		LOG(LogError) << "Unsupported DDS file (only DXT1/DXT3/DXT5 are supported)";
+		return false;
 	}
+
+	// base level only, the data for smaller mip levels follows it and is never read
+	// (with the size capped this is at most 4096 * 4096 * 16 bytes, it can't overflow)
+	const size_t levelSize = std::max<size_t>(1, (width + 3) / 4) * std::max<size_t>(1, (height + 3) / 4) * blockSize;
+	if(levelSize > size - headerSize)
+	{
+		LOG(LogError) << "Invalid DDS file (truncated, " << width << "x" << height << ")";
+		return false;
+	}
+
+	image.width = width;
+	image.height = height;
+	image.data.assign(data + headerSize, data + headerSize + levelSize);
+	return flipDXTVert(image.data, width, height, blockSize, image.glFormat);
+}
+
+bool ImageIO::loadCompressedFromMemory(const unsigned char* data, const size_t size, CompressedImage& image)
+{
+	if(data == NULL || size < 4)
+		return false;
+
+	if(data[0] == 0xAB)
+		return loadKTX(data, size, image);
+
+	return loadDDS(data, size, image);
 }
@@ -1,11 +1,40 @@
 #pragma once
 
 #include <vector>
+#include <string>
 #include <FreeImage.h>
 
 class ImageIO
 {
 public:
+	// A pre-compressed image (the base level of a KTX or DDS file), ready to hand to glCompressedTexImage2D.
+	struct CompressedImage
+	{
+		unsigned int glFormat; // GL internal format, e.g. GL_ETC1_RGB8_OES or GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+		size_t width;
+		size_t height;
+		std::vector<unsigned char> data;
+	};
+
+	// True if path has a .ktx or .dds extension.
+	static bool isCompressedFile(const std::string& path);
+
+	// Parses a KTX (compressed formats only) or DDS (DXT1/3/5) file. Returns false if it's not one of those.
+	// The result is bottom row first like loadFromMemoryRGBA32(). DDS files are flipped to match, KTX files need to be stored that way.
+	static bool loadCompressedFromMemory(const unsigned char* data, const size_t size, CompressedImage& image);
+
 	static std::vector<unsigned char> loadFromMemoryRGBA32(const unsigned char * data, const size_t size, size_t & width, size_t & height);
+
+	// As above, but scaled down to fit in maxWidth x maxHeight (see shrinkRGBA32ToFit()) as part of decoding.
+	// JPEGs are decoded at reduced size when both are set, so big images never get decoded at full size.
+	static std::vector<unsigned char> loadFromMemoryRGBA32(const unsigned char * data, const size_t size, size_t & width, size_t & height, 
+		size_t maxWidth, size_t maxHeight);
 	static void flipPixelsVert(unsigned char* imagePx, const size_t& width, const size_t& height);
+
+	// Swaps the first and third byte of every 4 byte pixel (BGRA <-> RGBA), using NEON/SSE2 when available.
+	static void swapRedBlue(unsigned char* imagePx, size_t pixelCount);
+
+	// Scales an RGBA image down (box filter, keeps the aspect ratio) so it fits in maxWidth x maxHeight.
+	// A max of 0 means that axis is unconstrained. Images that already fit are left alone.
+	static void shrinkRGBA32ToFit(std::vector<unsigned char>& imageRGBA, size_t& width, size_t& height, size_t maxWidth, size_t maxHeight);
 };
\ No newline at end of file
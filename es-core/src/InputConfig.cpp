@@ -49,13 +49,17 @@ std::string toLower(std::string str)
 }
 //end util functions
 
-InputConfig::InputConfig(int deviceId, const std::string& deviceName, const std::string& deviceGUID) : mDeviceId(deviceId), mDeviceName(deviceName), mDeviceGUID(deviceGUID)
+#define MAX_ACTIONS 64
+
+InputConfig::InputConfig(int deviceId, const std::string& deviceName, const std::string& deviceGUID) : mDeviceId(deviceId), mDeviceName(deviceName), mDeviceGUID(deviceGUID),
+	mLastMask(0)
 {
 }
 
 void InputConfig::clear()
 {
 	mNameMap.clear();
+	buildActionTable();
 }
 
 bool InputConfig::isConfigured()
@@ -66,50 +70,132 @@ bool InputConfig::isConfigured()
 void InputConfig::mapInput(const std::string& name, Input input)
 {
 	mNameMap[toLower(name)] = input;
+	buildActionTable();
 }
 
 void InputConfig::unmapInput(const std::string& name)
 {
 	auto it = mNameMap.find(toLower(name));
 	if(it != mNameMap.end())
+	{
 		mNameMap.erase(it);
+		buildActionTable();
+	}
 }
 
-bool InputConfig::getInputByName(const std::string& name, Input* result)
+Uint64 InputConfig::getActionBit(const std::string& name)
 {
-	auto it = mNameMap.find(toLower(name));
-	if(it != mNameMap.end())
+	static std::unordered_map<std::string, Uint64> actions;
+
+	// callers almost always pass lowercase names already, so try that before making a lowercase copy
+	auto it = actions.find(name);
+	if(it != actions.end())
+		return it->second;
+
+	const std::string lower = toLower(name);
+	it = actions.find(lower);
+	if(it != actions.end())
+		return it->second;
+
+	if(actions.size() >= MAX_ACTIONS)
 	{
-		*result = it->second;
-		return true;
+		LOG(LogError) << "InputConfig - too many input names, can't track \"" << name << "\"!";
+		return 0;
 	}
 
-	return false;
+	const Uint64 bit = (Uint64)1 << actions.size();
+	actions[lower] = bit;
+	return bit;
 }
 
-bool InputConfig::isMappedTo(const std::string& name, Input input)
+void InputConfig::buildActionTable()
 {
-	Input comp;
-	if(!getInputByName(name, &comp))
-		return false;
-	
-	if(comp.configured && comp.type == input.type && comp.id == input.id)
+	for(int i = 0; i < TYPE_COUNT; i++)
+		mActionTable[i].clear();
+
+	for(auto it = mNameMap.begin(); it != mNameMap.end(); it++)
 	{
-		if(comp.type == TYPE_HAT)
+		const Input& input = it->second;
+		if(!input.configured || input.type == TYPE_COUNT)
+			continue;
+
+		const Uint64 bit = getActionBit(it->first);
+		ActionEntry& entry = mActionTable[input.type].insert(std::make_pair(input.id, ActionEntry())).first->second;
+
+		switch(input.type)
 		{
-			return (input.value == 0 || input.value & comp.value);
+		case TYPE_HAT:
+			for(int dir = 0; dir < 4; dir++)
+			{
+				if(input.value & (1 << dir))
+					entry.masks[dir] |= bit;
+			}
+			break;
+		case TYPE_AXIS:
+			entry.masks[input.value < 0 ? 0 : (input.value > 0 ? 1 : 2)] |= bit;
+			break;
+		default:
+			entry.masks[0] |= bit;
+			break;
 		}
+	}
+
+	mLastInput = Input();
+	mLastMask = 0;
+}
+
+Uint64 InputConfig::getActionMask(const Input& input)
+{
+	if(input.type == mLastInput.type && input.id == mLastInput.id && input.value == mLastInput.value)
+		return mLastMask;
 
-		if(comp.type == TYPE_AXIS)
+	Uint64 mask = 0;
+	if(input.type != TYPE_COUNT)
+	{
+		auto it = mActionTable[input.type].find(input.id);
+		if(it != mActionTable[input.type].end())
 		{
-			return input.value == 0 || comp.value == input.value;
-		}else{
-			return true;
+			const Uint64* masks = it->second.masks;
+			const Uint64 all = masks[0] | masks[1] | masks[2] | masks[3];
+
+			// a release (value 0) matches anything on this axis/hat, same as isMappedTo() always did
+			if(input.value == 0 || (input.type != TYPE_HAT && input.type != TYPE_AXIS))
+				mask = all;
+			else if(input.type == TYPE_AXIS)
+				mask = masks[input.value > 0 ? 1 : 0];
+			else
+			{
+				for(int dir = 0; dir < 4; dir++)
+				{
+					if(input.value & (1 << dir))
+						mask |= masks[dir];
+				}
+			}
 		}
 	}
+
+	mLastInput = input;
+	mLastMask = mask;
+	return mask;
+}
+
+bool InputConfig::getInputByName(const std::string& name, Input* result)
+{
+	auto it = mNameMap.find(toLower(name));
+	if(it != mNameMap.end())
+	{
+		*result = it->second;
+		return true;
+	}
+
 	return false;
 }
 
+bool InputConfig::isMappedTo(const std::string& name, Input input)
+{
+	return (getActionMask(input) & getActionBit(name)) != 0;
+}
+
 std::vector<std::string> InputConfig::getMappedTo(Input input)
 {
 	std::vector<std::string> maps;
@@ -170,6 +256,8 @@ void InputConfig::loadFromXML(pugi::xml_node node)
 
 		mNameMap[toLower(name)] = Input(mDeviceId, typeEnum, id, value, true);
 	}
+
+	buildActionTable();
 }
 
 void InputConfig::writeToXML(pugi::xml_node parent)
@@ -2,6 +2,7 @@
 #define _INPUTCONFIG_H_
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include <SDL.h>
@@ -27,6 +28,7 @@ public:
 	int id;
 	int value;
 	bool configured;
+	Uint32 timestamp; // SDL_GetTicks() time of the event this came from, 0 if it wasn't a real event
 
 	Input()
 	{
@@ -35,9 +37,10 @@ public:
 		id = -1;
 		value = -999;
 		type = TYPE_COUNT;
+		timestamp = 0;
 	}
 
-	Input(int dev, InputType t, int i, int val, bool conf) : device(dev), type(t), id(i), value(val), configured(conf)
+	Input(int dev, InputType t, int i, int val, bool conf, Uint32 time = 0) : device(dev), type(t), id(i), value(val), configured(conf), timestamp(time)
 	{
 	}
 
@@ -96,6 +99,11 @@ public:
 	//Returns true if Input is mapped to this name, false otherwise.
 	bool isMappedTo(const std::string& name, Input input);
 
+	// Every name (action) gets a bit the first time it's seen, shared by all configs. Returns 0 if there are too many.
+	static Uint64 getActionBit(const std::string& name);
+	// The actions this input is mapped to, one bit each. Constant time once the table is built.
+	Uint64 getActionMask(const Input& input);
+
 	//Returns a list of names this input is mapped to.
 	std::vector<std::string> getMappedTo(Input input);
 
@@ -109,7 +117,22 @@ private:
 	// Writes Input mapped to this name to result if true.
 	bool getInputByName(const std::string& name, Input* result);
 
+	// rebuilds mActionTable from mNameMap, called whenever a mapping changes
+	void buildActionTable();
+
+	// buttons and keys only use masks[0]; axes use [0] for negative, [1] for positive and [2] for value 0;
+	// hats have one per direction bit
+	struct ActionEntry
+	{
+		Uint64 masks[4];
+	};
+
 	std::map<std::string, Input> mNameMap;
+	std::unordered_map<int, ActionEntry> mActionTable[TYPE_COUNT]; // by input id
+
+	// the last lookup, since every component in the stack asks about the same input
+	Input mLastInput;
+	Uint64 mLastMask;
 	const int mDeviceId;
 	const std::string mDeviceName;
 	const std::string mDeviceGUID;
@@ -3,8 +3,11 @@
 #include "Settings.h"
 #include "Window.h"
 #include "Log.h"
+#include "InputRecorder.h"
 #include "pugixml/pugixml.hpp"
 #include <boost/filesystem.hpp>
+#include <sstream>
+#include <fstream>
 #include "platform.h"
 
 #define KEYBOARD_GUID_STRING "-1"
@@ -24,7 +27,7 @@ namespace fs = boost::filesystem;
 
 InputManager* InputManager::mInstance = NULL;
 
-InputManager::InputManager() : mKeyboardInputConfig(NULL)
+InputManager::InputManager() : mKeyboardInputConfig(NULL), mConfigLoaded(false), mConfigExists(false)
 {
 }
 
@@ -86,20 +89,25 @@ void InputManager::addJoystickByDeviceIndex(int id)
 		LOG(LogInfo) << "Added known joystick " << SDL_JoystickName(joy) << " (instance ID: " << joyId << ", device index: " << id << ")";
 	}
 
-	// set up the prevAxisValues
-	int numAxes = SDL_JoystickNumAxes(joy);
-	mPrevAxisValues[joyId] = new int[numAxes];
-	std::fill(mPrevAxisValues[joyId], mPrevAxisValues[joyId] + numAxes, 0); //initialize array to 0
+	// set up the axis states
+	const int numAxes = SDL_JoystickNumAxes(joy);
+	AxisState centered = { 0, 0, 0, 0, false };
+	mAxisStates[joyId].assign(numAxes > 0 ? numAxes : 0, centered);
 }
 
 void InputManager::removeJoystickByJoystickID(SDL_JoystickID joyId)
 {
 	assert(joyId != -1);
 
-	// delete old prevAxisValues
-	auto axisIt = mPrevAxisValues.find(joyId);
-	delete[] axisIt->second;
-	mPrevAxisValues.erase(axisIt);
+	// forget its axes, including anything still waiting to be flushed
+	mAxisStates.erase(joyId);
+	for(auto it = mDirtyAxes.begin(); it != mDirtyAxes.end(); )
+	{
+		if(it->first == joyId)
+			it = mDirtyAxes.erase(it);
+		else
+			it++;
+	}
 
 	// delete old InputConfig
 	auto it = mInputConfigs.find(joyId);
@@ -119,6 +127,9 @@ void InputManager::removeJoystickByJoystickID(SDL_JoystickID joyId)
 
 void InputManager::deinit()
 {
+	// a controller was just configured, before launching a game or exiting
+	waitForSave();
+
 	if(!initialized())
 		return;
 
@@ -134,11 +145,8 @@ void InputManager::deinit()
 	}
 	mInputConfigs.clear();
 
-	for(auto iter = mPrevAxisValues.begin(); iter != mPrevAxisValues.end(); iter++)
-	{
-		delete[] iter->second;
-	}
-	mPrevAxisValues.clear();
+	mAxisStates.clear();
+	mDirtyAxes.clear();
 
 	if(mKeyboardInputConfig != NULL)
 	{
@@ -167,44 +175,88 @@ InputConfig* InputManager::getInputConfigByDevice(int device)
 		return mInputConfigs[device];
 }
 
-bool InputManager::parseEvent(const SDL_Event& ev, Window* window)
+void InputManager::sendInput(Window* window, InputConfig* config, const Input& input)
+{
+	InputRecorder::getInstance()->recordInput(config, input);
+	window->input(config, input);
+}
+
+void InputManager::sendText(Window* window, const char* text)
+{
+	InputRecorder::getInstance()->recordText(text);
+	window->textInput(text);
+}
+
+bool InputManager::flushAxisEvents(Window* window)
 {
 	bool causedEvent = false;
-	switch(ev.type)
+	for(auto it = mDirtyAxes.begin(); it != mDirtyAxes.end(); it++)
 	{
-	case SDL_JOYAXISMOTION:
-		//if it switched boundaries
-		if((abs(ev.jaxis.value) > DEADZONE) != (abs(mPrevAxisValues[ev.jaxis.which][ev.jaxis.axis]) > DEADZONE))
+		AxisState& state = mAxisStates[it->first][it->second];
+		state.dirty = false;
+
+		InputConfig* config = getInputConfigByDevice(it->first);
+		if(state.peak != 0 && state.pending == state.zone)
 		{
-			int normValue;
-			if(abs(ev.jaxis.value) <= DEADZONE)
-				normValue = 0;
-			else
-				if(ev.jaxis.value > 0)
-					normValue = 1;
-				else
-					normValue = -1;
-
-			window->input(getInputConfigByDevice(ev.jaxis.which), Input(ev.jaxis.which, TYPE_AXIS, ev.jaxis.axis, normValue, false));
+			// pushed and let go within the frame
+			sendInput(window, config, Input(it->first, TYPE_AXIS, it->second, state.peak, false, state.timestamp));
+			sendInput(window, config, Input(it->first, TYPE_AXIS, it->second, state.zone, false, state.timestamp));
+			causedEvent = true;
+		}else if(state.pending != state.zone)
+		{
+			sendInput(window, config, Input(it->first, TYPE_AXIS, it->second, state.pending, false, state.timestamp));
+			state.zone = state.pending;
 			causedEvent = true;
 		}
+		state.peak = 0;
+	}
 
-		mPrevAxisValues[ev.jaxis.which][ev.jaxis.axis] = ev.jaxis.value;
-		return causedEvent;
+	mDirtyAxes.clear();
+	return causedEvent;
+}
+
+bool InputManager::parseEvent(const SDL_Event& ev, Window* window)
+{
+	// keep the order axes and everything else happened in
+	if(ev.type != SDL_JOYAXISMOTION && !mDirtyAxes.empty())
+		flushAxisEvents(window);
+
+	switch(ev.type)
+	{
+	case SDL_JOYAXISMOTION:
+		{
+			// noisy sticks and triggers send hundreds of these a frame, just note where the axis is now
+			auto it = mAxisStates.find(ev.jaxis.which);
+			if(it == mAxisStates.end() || ev.jaxis.axis >= it->second.size())
+				return false;
+
+			AxisState& state = it->second[ev.jaxis.axis];
+			state.pending = (abs(ev.jaxis.value) <= DEADZONE) ? 0 : (ev.jaxis.value > 0 ? 1 : -1);
+			state.timestamp = ev.jaxis.timestamp;
+			if(state.zone == 0 && state.peak == 0)
+				state.peak = state.pending;
+
+			if(!state.dirty && state.pending != state.zone)
+			{
+				state.dirty = true;
+				mDirtyAxes.push_back(std::make_pair(ev.jaxis.which, (int)ev.jaxis.axis));
+			}
+			return false;
+		}
 
 	case SDL_JOYBUTTONDOWN:
 	case SDL_JOYBUTTONUP:
-		window->input(getInputConfigByDevice(ev.jbutton.which), Input(ev.jbutton.which, TYPE_BUTTON, ev.jbutton.button, ev.jbutton.state == SDL_PRESSED, false));
+		sendInput(window, getInputConfigByDevice(ev.jbutton.which), Input(ev.jbutton.which, TYPE_BUTTON, ev.jbutton.button, ev.jbutton.state == SDL_PRESSED, false, ev.jbutton.timestamp));
 		return true;
 
 	case SDL_JOYHATMOTION:
-		window->input(getInputConfigByDevice(ev.jhat.which), Input(ev.jhat.which, TYPE_HAT, ev.jhat.hat, ev.jhat.value, false));
+		sendInput(window, getInputConfigByDevice(ev.jhat.which), Input(ev.jhat.which, TYPE_HAT, ev.jhat.hat, ev.jhat.value, false, ev.jhat.timestamp));
 		return true;
 
 	case SDL_KEYDOWN:
 		if(ev.key.keysym.sym == SDLK_BACKSPACE && SDL_IsTextInputActive())
 		{
-			window->textInput("\b");
+			sendText(window, "\b");
 		}
 
 		if(ev.key.repeat)
@@ -218,15 +270,15 @@ bool InputManager::parseEvent(const SDL_Event& ev, Window* window)
 			return false;
 		}
 
-		window->input(getInputConfigByDevice(DEVICE_KEYBOARD), Input(DEVICE_KEYBOARD, TYPE_KEY, ev.key.keysym.sym, 1, false));
+		sendInput(window, getInputConfigByDevice(DEVICE_KEYBOARD), Input(DEVICE_KEYBOARD, TYPE_KEY, ev.key.keysym.sym, 1, false, ev.key.timestamp));
 		return true;
 
 	case SDL_KEYUP:
-		window->input(getInputConfigByDevice(DEVICE_KEYBOARD), Input(DEVICE_KEYBOARD, TYPE_KEY, ev.key.keysym.sym, 0, false));
+		sendInput(window, getInputConfigByDevice(DEVICE_KEYBOARD), Input(DEVICE_KEYBOARD, TYPE_KEY, ev.key.keysym.sym, 0, false, ev.key.timestamp));
 		return true;
 
 	case SDL_TEXTINPUT:
-		window->textInput(ev.text.text);
+		sendText(window, ev.text.text);
 		break;
 
 	case SDL_JOYDEVICEADDED:
@@ -241,28 +293,103 @@ bool InputManager::parseEvent(const SDL_Event& ev, Window* window)
 	return false;
 }
 
-bool InputManager::loadInputConfig(InputConfig* config)
+void InputManager::loadConfigFile()
 {
+	if(mConfigLoaded)
+		return;
+	mConfigLoaded = true;
+
+	mConfigDoc.reset();
+	mConfigsByGUID.clear();
+
 	std::string path = getConfigPath();
-	if(!fs::exists(path))
-		return false;
-	
-	pugi::xml_document doc;
-	pugi::xml_parse_result res = doc.load_file(path.c_str());
+	mConfigExists = fs::exists(path);
+	if(!mConfigExists)
+		return;
 
+	pugi::xml_parse_result res = mConfigDoc.load_file(path.c_str());
 	if(!res)
 	{
 		LOG(LogError) << "Error parsing input config: " << res.description();
-		return false;
+		mConfigDoc.reset();
+		return;
 	}
 
-	pugi::xml_node root = doc.child("inputList");
-	if(!root)
-		return false;
+	pugi::xml_node root = mConfigDoc.child("inputList");
+	for(pugi::xml_node node = root.child("inputConfig"); node; node = node.next_sibling("inputConfig"))
+		indexConfigNode(node);
+}
 
-	pugi::xml_node configNode = root.find_child_by_attribute("inputConfig", "deviceGUID", config->getDeviceGUIDString().c_str());
-	if(!configNode)
-		configNode = root.find_child_by_attribute("inputConfig", "deviceName", config->getDeviceName().c_str());
+void InputManager::indexConfigNode(pugi::xml_node node)
+{
+	// the first one wins, like find_child_by_attribute
+	mConfigsByGUID.insert(std::make_pair(std::string(node.attribute("deviceGUID").as_string()), node));
+}
+
+void InputManager::removeConfigNode(pugi::xml_node node)
+{
+	const std::string guid = node.attribute("deviceGUID").as_string();
+	pugi::xml_node root = node.parent();
+	root.remove_child(node);
+
+	auto it = mConfigsByGUID.find(guid);
+	if(it != mConfigsByGUID.end() && it->second == node)
+	{
+		mConfigsByGUID.erase(it);
+		pugi::xml_node next = root.find_child_by_attribute("inputConfig", "deviceGUID", guid.c_str());
+		if(next)
+			indexConfigNode(next);
+	}
+}
+
+void InputManager::waitForSave()
+{
+	if(mSaveThread.joinable())
+		mSaveThread.join();
+}
+
+void InputManager::saveConfigFile()
+{
+	std::stringstream ss;
+	mConfigDoc.save(ss);
+	mConfigExists = true;
+
+	// written next to it and renamed over it, like es_settings.cfg
+	waitForSave();
+	mSaveThread = std::thread([](std::string path, std::string text) {
+		const std::string tmpPath = path + ".tmp";
+		{
+			std::ofstream out(tmpPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+			if(!out.is_open() || !out.write(text.data(), text.size()))
+			{
+				LOG(LogError) << "Could not write input config to " << tmpPath;
+				return;
+			}
+		}
+
+		boost::system::error_code ec;
+		fs::rename(tmpPath, path, ec);
+		if(ec)
+			LOG(LogError) << "Could not replace " << path << ": " << ec.message();
+	}, getConfigPath(), ss.str());
+}
+
+bool InputManager::hasConfigFile()
+{
+	loadConfigFile();
+	return mConfigExists;
+}
+
+bool InputManager::loadInputConfig(InputConfig* config)
+{
+	loadConfigFile();
+
+	pugi::xml_node configNode;
+	auto it = mConfigsByGUID.find(config->getDeviceGUIDString());
+	if(it != mConfigsByGUID.end())
+		configNode = it->second;
+	else
+		configNode = mConfigDoc.child("inputList").find_child_by_attribute("inputConfig", "deviceName", config->getDeviceName().c_str());
 	if(!configNode)
 		return false;
 
@@ -295,103 +422,70 @@ void InputManager::writeDeviceConfig(InputConfig* config)
 {
 	assert(initialized());
 
-	std::string path = getConfigPath();
+	loadConfigFile();
 
-	pugi::xml_document doc;
+	pugi::xml_node root = mConfigDoc.child("inputList");
+	if(!root)
+		root = mConfigDoc.append_child("inputList");
 
-	if(fs::exists(path))
+	// if inputAction @type=onfinish is set, let onfinish command take care for creating input configuration.
+	// we just put the input configuration into a temporary input config file.
+	pugi::xml_node actionnode = root.find_child_by_attribute("inputAction", "type", "onfinish");
+	if(actionnode)
 	{
-		// merge files
-		pugi::xml_parse_result result = doc.load_file(path.c_str());
-		if(!result)
-		{
-			LOG(LogError) << "Error parsing input config: " << result.description();
-		}
-		else
-		{
-			// successfully loaded, delete the old entry if it exists
-			pugi::xml_node root = doc.child("inputList");
-			if(root)
-			{
-				// if inputAction @type=onfinish is set, let onfinish command take care for creating input configuration.
-				// we just put the input configuration into a temporary input config file.
-				pugi::xml_node actionnode = root.find_child_by_attribute("inputAction", "type", "onfinish");
-				if(actionnode)
-				{
-					path = getTemporaryConfigPath();
-					doc.reset();
-					root = doc.append_child("inputList");
-					root.append_copy(actionnode);
-				}
-				else
-				{
-					pugi::xml_node oldEntry = root.find_child_by_attribute("inputConfig", "deviceGUID",
-											  config->getDeviceGUIDString().c_str());
-					if(oldEntry)
-					{
-						root.remove_child(oldEntry);
-					}
-					oldEntry = root.find_child_by_attribute("inputConfig", "deviceName",
-															config->getDeviceName().c_str());
-					if(oldEntry)
-					{
-						root.remove_child(oldEntry);
-					}
-				}
-			}
-		}
+		pugi::xml_document doc;
+		pugi::xml_node tmpRoot = doc.append_child("inputList");
+		tmpRoot.append_copy(actionnode);
+		config->writeToXML(tmpRoot);
+		doc.save_file(getTemporaryConfigPath().c_str());
+
+		// the commands may well rewrite es_input.cfg, so it's read again afterwards
+		doOnFinish();
+		mConfigLoaded = false;
+		loadInputConfig(config);
+		return;
 	}
 
-	pugi::xml_node root = doc.child("inputList");
-	if(!root)
-		root = doc.append_child("inputList");
+	// update the entry in place (and drop one that only matched by name)
+	pugi::xml_node oldEntry = root.find_child_by_attribute("inputConfig", "deviceGUID", config->getDeviceGUIDString().c_str());
+	if(oldEntry)
+		removeConfigNode(oldEntry);
+	oldEntry = root.find_child_by_attribute("inputConfig", "deviceName", config->getDeviceName().c_str());
+	if(oldEntry)
+		removeConfigNode(oldEntry);
 
 	config->writeToXML(root);
-	doc.save_file(path.c_str());
-	
-	// execute any onFinish commands and re-load the config for changes
-	doOnFinish();
+	indexConfigNode(root.last_child());
+	saveConfigFile();
+
+	// re-load the config for changes
 	loadInputConfig(config);
 }
 
 void InputManager::doOnFinish()
 {
 	assert(initialized());
-	std::string path = getConfigPath();
-	pugi::xml_document doc;
 
-	if(fs::exists(path))
+	// the commands get to see what was saved
+	waitForSave();
+	loadConfigFile();
+
+	pugi::xml_node root = mConfigDoc.child("inputList").find_child_by_attribute("inputAction", "type", "onfinish");
+	if(!root)
+		return;
+
+	for(pugi::xml_node command = root.child("command"); command; command = command.next_sibling("command"))
 	{
-		pugi::xml_parse_result result = doc.load_file(path.c_str());
-		if(!result)
-		{
-			LOG(LogError) << "Error parsing input config: " << result.description();
-		}
-		else
+		std::string tocall = command.text().get();
+
+		LOG(LogInfo) << "	" << tocall;
+		std::cout << "==============================================\ninput config finish command:\n";
+		int exitCode = runSystemCommand(tocall);
+		std::cout << "==============================================\n";
+
+		if(exitCode != 0)
 		{
-			pugi::xml_node root = doc.child("inputList");
-			if(root)
-			{
-				root = root.find_child_by_attribute("inputAction", "type", "onfinish");
-				if(root)
-				{
-					for(pugi::xml_node command = root.child("command"); command;
-							command = command.next_sibling("command"))
-					{
-						std::string tocall = command.text().get();
-
-						LOG(LogInfo) << "	" << tocall;
-						std::cout << "==============================================\ninput config finish command:\n";
-						int exitCode = runSystemCommand(tocall);
-						std::cout << "==============================================\n";
-
-						if(exitCode != 0)
-						{
-							LOG(LogWarning) << "...launch terminated with nonzero exit code " << exitCode << "!";
-						}
-					}
-				}
-			}
+			LOG(LogWarning) << "...launch terminated with nonzero exit code " << exitCode << "!";
 		}
 	}
 }
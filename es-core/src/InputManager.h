@@ -5,8 +5,11 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <thread>
+#include "pugixml/pugixml.hpp"
 
 class InputConfig;
+struct Input;
 class Window;
 
 //you should only ever instantiate one of these, by the way
@@ -25,14 +28,42 @@ private:
 	std::map<SDL_JoystickID, InputConfig*> mInputConfigs;
 	InputConfig* mKeyboardInputConfig;
 
-	std::map<SDL_JoystickID, int*> mPrevAxisValues;
+	// axis motion is coalesced and only turned into input once per frame (see flushAxisEvents)
+	struct AxisState
+	{
+		int zone; // -1, 0 or 1, what the last input sent said
+		int pending; // where the latest motion this frame left it
+		int peak; // the first non-zero zone reached this frame while zone was 0, so a quick tap isn't lost
+		Uint32 timestamp;
+		bool dirty;
+	};
+
+	std::map<SDL_JoystickID, std::vector<AxisState> > mAxisStates;
+	std::vector< std::pair<SDL_JoystickID, int> > mDirtyAxes;
 
 	bool initialized() const;
 
+	// everything the window gets goes through these, so it can be recorded
+	void sendInput(Window* window, InputConfig* config, const Input& input);
+	void sendText(Window* window, const char* text);
+
 	void addJoystickByDeviceIndex(int id);
 	void removeJoystickByJoystickID(SDL_JoystickID id);
 	bool loadInputConfig(InputConfig* config); // returns true if successfully loaded, false if not (or didn't exist)
 
+	// es_input.cfg is parsed once and then kept up to date in memory, hotplugging a controller doesn't read it again
+	void loadConfigFile();
+	void indexConfigNode(pugi::xml_node node);
+	void removeConfigNode(pugi::xml_node node);
+	void saveConfigFile(); // on a background thread
+	void waitForSave();
+
+	pugi::xml_document mConfigDoc;
+	bool mConfigLoaded;
+	bool mConfigExists; // on disk, or being written there
+	std::map<std::string, pugi::xml_node> mConfigsByGUID;
+	std::thread mSaveThread;
+
 public:
 	virtual ~InputManager();
 
@@ -42,6 +73,7 @@ public:
 	void doOnFinish();
 	static std::string getConfigPath();
 	static std::string getTemporaryConfigPath();
+	bool hasConfigFile(); // without touching the disk once it's been loaded
 
 	void init();
 	void deinit();
@@ -55,6 +87,10 @@ public:
 	InputConfig* getInputConfigByDevice(int deviceId);
 
 	bool parseEvent(const SDL_Event& ev, Window* window);
+
+	// Sends the threshold crossings of the axis motion parsed since the last call, at most a press and a release per axis.
+	// Call it once the frame's events are all parsed. Any other input event flushes first, so the order is kept.
+	bool flushAxisEvents(Window* window);
 };
 
 #endif
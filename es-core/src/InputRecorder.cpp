@@ -0,0 +1,237 @@
+#include "InputRecorder.h"
+#include "Window.h"
+#include "Log.h"
+#include <sstream>
+#include <stdlib.h>
+
+#define RECORDING_HEADER "# EmulationStation input recording v1"
+#define REPLAY_KEY_BASE 0x10000000 // made-up key codes for the replay's actions, far from any real one
+
+InputRecorder* InputRecorder::getInstance()
+{
+	static InputRecorder instance;
+	return &instance;
+}
+
+InputRecorder::InputRecorder() : mRecording(false), mReplaying(false), mClock(0), mNext(0), mEndTime(0),
+	mReplayConfig(DEVICE_KEYBOARD, "Input replay", "")
+{
+}
+
+static std::string escapeText(const char* text)
+{
+	std::string out;
+	for(const char* c = text; *c; c++)
+	{
+		if(*c == '\\')
+			out += "\\\\";
+		else if(*c == '\b')
+			out += "\\b";
+		else if(*c == '\n')
+			out += "\\n";
+		else
+			out += *c;
+	}
+	return out;
+}
+
+static std::string unescapeText(const std::string& text)
+{
+	std::string out;
+	for(unsigned int i = 0; i < text.size(); i++)
+	{
+		if(text[i] == '\\' && i + 1 < text.size())
+		{
+			i++;
+			out += text[i] == 'b' ? '\b' : (text[i] == 'n' ? '\n' : text[i]);
+		}else{
+			out += text[i];
+		}
+	}
+	return out;
+}
+
+bool InputRecorder::startRecording(const std::string& path)
+{
+	stop();
+
+	mOut.open(path.c_str(), std::ios::out | std::ios::trunc);
+	if(!mOut.is_open())
+	{
+		LOG(LogError) << "Could not write input recording " << path;
+		return false;
+	}
+
+	mOut << RECORDING_HEADER << "\n";
+	mRecording = true;
+	mClock = 0;
+	mHatValues.clear();
+	LOG(LogInfo) << "Recording input to " << path;
+	return true;
+}
+
+bool InputRecorder::startReplay(const std::string& path)
+{
+	stop();
+
+	std::ifstream in(path.c_str());
+	if(!in.is_open())
+	{
+		LOG(LogError) << "Could not read input recording " << path;
+		return false;
+	}
+
+	mEvents.clear();
+	mReplayConfig.clear();
+	mReplayKeys.clear();
+
+	std::string line;
+	unsigned int lineNumber = 0;
+	while(std::getline(in, line))
+	{
+		lineNumber++;
+		if(line.empty() || line[0] == '#')
+			continue;
+
+		// <time> press|release <action>[,<action>...] or <time> text <text>
+		std::istringstream ss(line);
+		Event event;
+		std::string type;
+		if(!(ss >> event.time >> type))
+		{
+			LOG(LogWarning) << path << ":" << lineNumber << ": not an input, skipped";
+			continue;
+		}
+
+		std::string rest;
+		ss.get(); // the space
+		std::getline(ss, rest);
+
+		if(type == "text")
+		{
+			event.type = EVENT_TEXT;
+			event.names.push_back(unescapeText(rest));
+		}else if(type == "press" || type == "release")
+		{
+			event.type = type == "press" ? EVENT_PRESS : EVENT_RELEASE;
+			std::istringstream names(rest);
+			std::string name;
+			while(std::getline(names, name, ','))
+			{
+				if(name.empty())
+					continue;
+				event.names.push_back(name);
+
+				if(mReplayKeys.find(name) == mReplayKeys.end())
+				{
+					const int key = REPLAY_KEY_BASE + (int)mReplayKeys.size();
+					mReplayConfig.mapInput(name, Input(DEVICE_KEYBOARD, TYPE_KEY, key, 1, true));
+					mReplayKeys[name] = key;
+				}
+			}
+		}else{
+			LOG(LogWarning) << path << ":" << lineNumber << ": unknown input \"" << type << "\", skipped";
+			continue;
+		}
+
+		mEvents.push_back(event);
+	}
+
+	mReplaying = true;
+	mClock = 0;
+	mNext = 0;
+	mEndTime = (mEvents.empty() ? 0 : mEvents.back().time) + INPUT_REPLAY_SETTLE_MS;
+	LOG(LogInfo) << "Replaying " << mEvents.size() << " inputs (" << mEndTime / 1000 << "s) from " << path;
+	return true;
+}
+
+void InputRecorder::stop()
+{
+	if(mRecording)
+	{
+		mOut.close();
+		mRecording = false;
+	}
+
+	mReplaying = false;
+	mEvents.clear();
+}
+
+static void writeInput(std::ostream& out, unsigned int time, const char* type, const std::vector<std::string>& names)
+{
+	out << time << type;
+	for(auto it = names.begin(); it != names.end(); it++)
+		out << (it == names.begin() ? "" : ",") << *it;
+	out << std::endl; // a crash is what a recording is most likely to be wanted for
+}
+
+void InputRecorder::recordInput(InputConfig* config, const Input& input)
+{
+	if(!mRecording || config == NULL)
+		return;
+
+	// a hat going from a diagonal to one direction only reports what's still held, the other direction's release
+	// has to be worked out from what it was before
+	if(input.type == TYPE_HAT)
+	{
+		int& last = mHatValues[std::make_pair(input.device, input.id)];
+		const int released = last & ~input.value;
+		last = input.value;
+
+		if(released != 0 && input.value != 0)
+		{
+			const std::vector<std::string> releasedNames = config->getMappedTo(Input(input.device, TYPE_HAT, input.id, released, true));
+			if(!releasedNames.empty())
+				writeInput(mOut, mClock, " release ", releasedNames);
+		}
+	}
+
+	// unmapped input doesn't do anything anywhere but in the input config screen, which a replay has no use for
+	const std::vector<std::string> names = config->getMappedTo(input);
+	if(names.empty())
+		return;
+
+	writeInput(mOut, mClock, input.value != 0 ? " press " : " release ", names);
+}
+
+void InputRecorder::recordText(const char* text)
+{
+	if(mRecording)
+		mOut << mClock << " text " << escapeText(text) << std::endl;
+}
+
+void InputRecorder::update(Window* window, int deltaTime)
+{
+	if(mReplaying)
+	{
+		while(mNext < mEvents.size() && mEvents[mNext].time <= mClock)
+		{
+			const Event& event = mEvents[mNext++];
+			if(event.type == EVENT_TEXT)
+			{
+				window->textInput(event.names.front().c_str());
+				continue;
+			}
+
+			for(auto it = event.names.begin(); it != event.names.end(); it++)
+			{
+				const Input input(DEVICE_KEYBOARD, TYPE_KEY, mReplayKeys[*it], event.type == EVENT_PRESS ? 1 : 0, false, SDL_GetTicks());
+				window->input(&mReplayConfig, input);
+			}
+		}
+	}
+
+	if(mRecording || mReplaying)
+		mClock += deltaTime;
+}
+
+void InputRecorder::skipToNextEvent(Window* window)
+{
+	if(!mReplaying)
+		return;
+
+	const unsigned int next = mNext < mEvents.size() ? mEvents[mNext].time : mEndTime;
+	if(next > mClock)
+		mClock = next;
+	update(window, 0);
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "InputConfig.h"
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+
+class Window;
+
+// every replayed frame advances the UI by this much, however long it really took
+#define INPUT_REPLAY_FRAME_MS 16
+// frames run after the last replayed input, so whatever it started gets to finish
+#define INPUT_REPLAY_SETTLE_MS 2000
+
+// Records the input a session got to a file, and plays such a file back so the same session can be repeated
+// (e.g. with --profile-frames, to compare builds on the scrolling that janked).
+// Inputs are stored as the actions they were mapped to ("up", "a"...) rather than raw buttons, so a recording from a
+// cabinet's controllers plays back anywhere. Times are UI time (the deltaTimes Window::update got), and a replay
+// advances it by INPUT_REPLAY_FRAME_MS a frame, so two replays see the same input on the same frames.
+class InputRecorder
+{
+public:
+	static InputRecorder* getInstance();
+
+	// Returns false if the file couldn't be opened.
+	bool startRecording(const std::string& path);
+	bool startReplay(const std::string& path);
+	void stop();
+
+	inline bool isRecording() const { return mRecording; }
+	inline bool isReplaying() const { return mReplaying; }
+	// once everything was replayed and INPUT_REPLAY_SETTLE_MS has passed
+	inline bool isReplayDone() const { return mReplaying && mNext >= mEvents.size() && mClock >= mEndTime; }
+
+	// From InputManager, for everything it hands to the window.
+	void recordInput(InputConfig* config, const Input& input);
+	void recordText(const char* text);
+
+	// Once a frame, before Window::update(deltaTime). While replaying this hands the window what's due first.
+	void update(Window* window, int deltaTime);
+
+	// While replaying to a sleeping window: UI time doesn't pass while it sleeps (it didn't while recording either),
+	// so the clock jumps straight to the next input (or the end) and hands that over, which wakes it up.
+	void skipToNextEvent(Window* window);
+
+private:
+	InputRecorder();
+
+	enum EventType
+	{
+		EVENT_PRESS,
+		EVENT_RELEASE,
+		EVENT_TEXT
+	};
+
+	struct Event
+	{
+		unsigned int time;
+		EventType type;
+		std::vector<std::string> names; // the text for EVENT_TEXT
+	};
+
+	bool mRecording;
+	bool mReplaying;
+	unsigned int mClock; // UI time since recording/replaying started, ms
+	std::ofstream mOut;
+	std::map<std::pair<int, int>, int> mHatValues; // last value recorded per device and hat, for releases
+
+	std::vector<Event> mEvents;
+	unsigned int mNext;
+	unsigned int mEndTime;
+	InputConfig mReplayConfig; // one made-up key per action
+	std::map<std::string, int> mReplayKeys;
+};
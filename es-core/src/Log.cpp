@@ -1,12 +1,152 @@
 #include "Log.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <iostream>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 #include "platform.h"
 
+#define LOG_QUEUE_SIZE 4096 // must be a power of two
+#define LOG_FLUSH_INTERVAL 1000 // ms, how long a message can wait before it's written and flushed
+
 LogLevel Log::reportingLevel = LogInfo;
 FILE* Log::file = NULL; //fopen(getLogPath().c_str(), "w");
 
+// Messages go through a bounded lock-free queue (any number of writers, one reader) to a thread that
+// writes them to the file in batches, so logging never waits on the disk.
+namespace
+{
+	struct LogSlot
+	{
+		std::atomic<size_t> sequence;
+		std::string text;
+		bool console; // also goes to stderr
+	};
+
+	LogSlot sQueue[LOG_QUEUE_SIZE];
+	std::atomic<size_t> sEnqueuePos(0);
+	size_t sDequeuePos = 0; // writer thread only
+	std::atomic<size_t> sWrittenPos(0); // everything before this has been written and flushed
+
+	std::thread sWriter;
+	std::atomic<bool> sRunning(false);
+	std::atomic<bool> sFlushNow(false);
+	std::mutex sWakeMutex;
+	std::condition_variable sWake;
+
+	// notified without holding sWakeMutex so logging never blocks; a missed wakeup only costs one LOG_FLUSH_INTERVAL
+	void wakeWriter(bool flush)
+	{
+		if(flush)
+			sFlushNow = true;
+		sWake.notify_one();
+	}
+
+	void enqueue(std::string& text, bool console, bool urgent)
+	{
+		size_t pos = sEnqueuePos.load(std::memory_order_relaxed);
+		LogSlot* slot;
+		for(;;)
+		{
+			slot = &sQueue[pos & (LOG_QUEUE_SIZE - 1)];
+			const size_t seq = slot->sequence.load(std::memory_order_acquire);
+			const ptrdiff_t diff = (ptrdiff_t)seq - (ptrdiff_t)pos;
+			if(diff == 0)
+			{
+				if(sEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}else if(diff < 0)
+			{
+				// full, let the writer catch up
+				wakeWriter(false);
+				std::this_thread::yield();
+				pos = sEnqueuePos.load(std::memory_order_relaxed);
+			}else{
+				pos = sEnqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		slot->text.swap(text);
+		slot->console = console;
+		slot->sequence.store(pos + 1, std::memory_order_release);
+
+		// errors shouldn't sit in memory in case we're about to crash; otherwise only wake up when half full
+		if(urgent)
+			wakeWriter(true);
+		else if((pos & (LOG_QUEUE_SIZE / 2 - 1)) == 0)
+			wakeWriter(false);
+	}
+
+	// moves everything queued into fileBatch/consoleBatch, returns how many messages there were
+	size_t drain(std::string& fileBatch, std::string& consoleBatch)
+	{
+		size_t count = 0;
+		for(;;)
+		{
+			LogSlot& slot = sQueue[sDequeuePos & (LOG_QUEUE_SIZE - 1)];
+			if(slot.sequence.load(std::memory_order_acquire) != sDequeuePos + 1)
+				break;
+
+			fileBatch += slot.text;
+			if(slot.console)
+				consoleBatch += slot.text;
+			slot.text.clear();
+
+			slot.sequence.store(sDequeuePos + LOG_QUEUE_SIZE, std::memory_order_release);
+			sDequeuePos++;
+			count++;
+		}
+		return count;
+	}
+
+	void writerThread(FILE* file)
+	{
+		std::string fileBatch;
+		std::string consoleBatch;
+		auto lastFlush = std::chrono::steady_clock::now();
+		bool dirty = false;
+
+		for(;;)
+		{
+			// read before draining, so nothing queued before close() is missed
+			const bool stopping = !sRunning;
+
+			drain(fileBatch, consoleBatch);
+			if(!fileBatch.empty())
+			{
+				fwrite(fileBatch.data(), 1, fileBatch.size(), file);
+				fileBatch.clear();
+				dirty = true;
+			}
+			if(!consoleBatch.empty())
+			{
+				fwrite(consoleBatch.data(), 1, consoleBatch.size(), stderr);
+				consoleBatch.clear();
+			}
+
+			const auto now = std::chrono::steady_clock::now();
+			if(sFlushNow.exchange(false) || stopping || (dirty && now - lastFlush >= std::chrono::milliseconds(LOG_FLUSH_INTERVAL)))
+			{
+				if(dirty)
+					fflush(file);
+				dirty = false;
+				lastFlush = now;
+				sWrittenPos = sDequeuePos;
+			}
+
+			if(stopping)
+				break;
+
+			std::unique_lock<std::mutex> lock(sWakeMutex);
+			sWake.wait_for(lock, std::chrono::milliseconds(LOG_FLUSH_INTERVAL));
+		}
+	}
+}
+
 LogLevel Log::getReportingLevel()
 {
 	return reportingLevel;
@@ -26,6 +166,17 @@ void Log::setReportingLevel(LogLevel level)
 void Log::open()
 {
 	file = fopen(getLogPath().c_str(), "w");
+	if(file == NULL)
+		return;
+
+	for(size_t i = 0; i < LOG_QUEUE_SIZE; i++)
+		sQueue[i].sequence.store(i, std::memory_order_relaxed);
+	sEnqueuePos = 0;
+	sDequeuePos = 0;
+	sWrittenPos = 0;
+
+	sRunning = true;
+	sWriter = std::thread(&writerThread, file);
 }
 
 std::ostringstream& Log::get(LogLevel level)
@@ -38,13 +189,36 @@ std::ostringstream& Log::get(LogLevel level)
 
 void Log::flush()
 {
-	fflush(getOutput());
+	if(!sRunning)
+	{
+		if(getOutput())
+			fflush(getOutput());
+		return;
+	}
+
+	// wait until the writer has flushed everything logged so far
+	const size_t target = sEnqueuePos;
+	while(sWrittenPos < target)
+	{
+		wakeWriter(true);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
 }
 
 void Log::close()
 {
-	fclose(file);
-	file = NULL;
+	if(sRunning)
+	{
+		sRunning = false;
+		wakeWriter(true);
+		sWriter.join();
+	}
+
+	if(file != NULL)
+	{
+		fclose(file);
+		file = NULL;
+	}
 }
 
 FILE* Log::getOutput()
@@ -54,7 +228,7 @@ FILE* Log::getOutput()
 
 Log::~Log()
 {
-	os << std::endl;
+	os << '\n';
 
 	if(getOutput() == NULL)
 	{
@@ -64,10 +238,18 @@ Log::~Log()
 		return;
 	}
 
-	fprintf(getOutput(), "%s", os.str().c_str());
-
 	//if it's an error, also print to console
 	//print all messages if using --debug
-	if(messageLevel == LogError || reportingLevel >= LogDebug)
-		fprintf(stderr, "%s", os.str().c_str());
+	const bool console = (messageLevel == LogError || reportingLevel >= LogDebug);
+
+	std::string text = os.str();
+	if(sRunning)
+	{
+		enqueue(text, console, messageLevel == LogError);
+		return;
+	}
+
+	fprintf(getOutput(), "%s", text.c_str());
+	if(console)
+		fprintf(stderr, "%s", text.c_str());
 }
@@ -23,6 +23,8 @@ public:
 
 	static std::string getLogPath();
 
+	// Messages are written and flushed by a background thread (at least every second, right away for errors).
+	// flush() waits until everything logged so far is on disk.
 	static void flush();
 	static void open();
 	static void close();
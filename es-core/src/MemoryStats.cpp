@@ -0,0 +1,54 @@
+#include "MemoryStats.h"
+#include <atomic>
+#include <sstream>
+#include <iomanip>
+
+static std::atomic<ptrdiff_t> sBytes[MemoryStats::TAG_COUNT];
+
+static const char* TAG_NAMES[MemoryStats::TAG_COUNT] = {
+	"file_data",
+	"metadata",
+	"theme",
+	"text_cache",
+	"resources",
+	"sound"
+};
+
+void MemoryStats::add(Tag tag, ptrdiff_t bytes)
+{
+	sBytes[tag].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+size_t MemoryStats::get(Tag tag)
+{
+	const ptrdiff_t bytes = sBytes[tag].load(std::memory_order_relaxed);
+	return bytes > 0 ? (size_t)bytes : 0; // estimates can drift slightly below zero
+}
+
+size_t MemoryStats::getTotal()
+{
+	size_t total = 0;
+	for(int i = 0; i < TAG_COUNT; i++)
+		total += get((Tag)i);
+	return total;
+}
+
+const char* MemoryStats::getName(Tag tag)
+{
+	return TAG_NAMES[tag];
+}
+
+std::string MemoryStats::getSummary()
+{
+	std::stringstream ss;
+	ss << std::fixed << std::setprecision(2);
+	ss << "RAM: " << getTotal() / 1000.0f / 1000.0f << "mb (";
+	for(int i = 0; i < TAG_COUNT; i++)
+	{
+		if(i > 0)
+			ss << ", ";
+		ss << TAG_NAMES[i] << ": " << get((Tag)i) / 1000.0f / 1000.0f << "mb";
+	}
+	ss << ")";
+	return ss.str();
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stddef.h>
+#include <string>
+
+// Rough CPU-side memory use per subsystem, kept up to date by the subsystems as they allocate and free.
+// Heap sizes are estimated from object sizes and container capacities; allocator overhead isn't counted.
+class MemoryStats
+{
+public:
+	enum Tag
+	{
+		FILE_DATA, // FileData nodes, their paths and children
+		METADATA, // interned metadata strings
+		THEME, // parsed and merged theme files
+		TEXT_CACHE, // TextCache vertices and colours
+		RESOURCES, // file and embedded resource buffers on the heap (not mapped files)
+		SOUND, // sample data of loaded sounds
+		TAG_COUNT
+	};
+
+	// bytes is negative when memory is freed. Thread-safe.
+	static void add(Tag tag, ptrdiff_t bytes);
+	static size_t get(Tag tag);
+	static size_t getTotal();
+
+	// short lower case name, e.g. "file_data"
+	static const char* getName(Tag tag);
+
+	// one line with every tag in MB, for the framerate overlay
+	static std::string getSummary();
+
+	// What a string has allocated on the heap, 0 if it fits in the small string buffer inside the object.
+	template<typename String>
+	static size_t getHeapSize(const String& str)
+	{
+		const char* data = (const char*)str.data();
+		if(data >= (const char*)&str && data < (const char*)(&str + 1))
+			return 0;
+		return (str.capacity() + 1) * sizeof(typename String::value_type);
+	}
+};
@@ -0,0 +1,218 @@
+#include "Metrics.h"
+#include "Settings.h"
+#include "Log.h"
+#include <SDL.h>
+#include <stdio.h>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+const float Metrics::Histogram::BOUNDS[METRICS_HISTOGRAM_BUCKETS - 1] = { 1, 2, 4, 8, 12, 16.7f, 25, 33.3f, 50, 100, 250, 500, 1000, 2500, 10000 };
+
+namespace
+{
+	enum MetricType
+	{
+		METRIC_COUNTER,
+		METRIC_HISTOGRAM,
+		METRIC_GAUGE
+	};
+
+	struct Entry
+	{
+		MetricType type;
+		std::string help;
+		std::unique_ptr<Metrics::Counter> counter;
+		std::unique_ptr<Metrics::Histogram> histogram;
+		Metrics::GaugeFunc gauge;
+	};
+
+	// only taken to register and to write, never to update
+	std::mutex sMutex;
+	std::map<std::string, Entry>& getEntries()
+	{
+		static std::map<std::string, Entry> entries;
+		return entries;
+	}
+
+	Uint32 sLastWrite = 0;
+}
+
+Metrics::Histogram::Histogram() : mSumMicros(0)
+{
+	for(int i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++)
+		mBuckets[i] = 0;
+}
+
+void Metrics::Histogram::record(float value)
+{
+	int bucket = 0;
+	while(bucket < METRICS_HISTOGRAM_BUCKETS - 1 && value > BOUNDS[bucket])
+		bucket++;
+
+	mBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+	mSumMicros.fetch_add((unsigned long long)(value * 1000), std::memory_order_relaxed);
+}
+
+unsigned long long Metrics::Histogram::getCount() const
+{
+	unsigned long long count = 0;
+	for(int i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++)
+		count += mBuckets[i].load(std::memory_order_relaxed);
+	return count;
+}
+
+double Metrics::Histogram::getSum() const
+{
+	return mSumMicros.load(std::memory_order_relaxed) / 1000.0;
+}
+
+float Metrics::Histogram::getPercentile(float fraction) const
+{
+	const unsigned long long count = getCount();
+	if(count == 0)
+		return 0;
+
+	// interpolate inside the bucket the target falls into
+	const double target = fraction * count;
+	unsigned long long seen = 0;
+	for(int i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++)
+	{
+		const unsigned long long inBucket = mBuckets[i].load(std::memory_order_relaxed);
+		if(inBucket > 0 && seen + inBucket >= target)
+		{
+			const float low = i > 0 ? BOUNDS[i - 1] : 0;
+			if(i == METRICS_HISTOGRAM_BUCKETS - 1)
+				return low;
+
+			return low + (BOUNDS[i] - low) * (float)((target - seen) / inBucket);
+		}
+		seen += inBucket;
+	}
+
+	return BOUNDS[METRICS_HISTOGRAM_BUCKETS - 2];
+}
+
+Metrics::Counter* Metrics::getCounter(const std::string& name, const std::string& help)
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+	Entry& entry = getEntries()[name];
+	if(!entry.counter)
+	{
+		entry.type = METRIC_COUNTER;
+		entry.help = help;
+		entry.counter.reset(new Counter());
+	}
+	return entry.counter.get();
+}
+
+Metrics::Histogram* Metrics::getHistogram(const std::string& name, const std::string& help)
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+	Entry& entry = getEntries()[name];
+	if(!entry.histogram)
+	{
+		entry.type = METRIC_HISTOGRAM;
+		entry.help = help;
+		entry.histogram.reset(new Histogram());
+	}
+	return entry.histogram.get();
+}
+
+void Metrics::addGauge(const std::string& name, const std::string& help, const GaugeFunc& func)
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+	Entry& entry = getEntries()[name];
+	entry.type = METRIC_GAUGE;
+	entry.help = help;
+	entry.gauge = func;
+}
+
+std::string Metrics::format()
+{
+	std::stringstream ss;
+	ss << std::setprecision(10);
+
+	std::lock_guard<std::mutex> lock(sMutex);
+	const std::map<std::string, Entry>& entries = getEntries();
+	for(auto it = entries.begin(); it != entries.end(); it++)
+	{
+		const std::string& name = it->first;
+		const Entry& entry = it->second;
+
+		ss << "# HELP " << name << " " << entry.help << "\n";
+		switch(entry.type)
+		{
+		case METRIC_COUNTER:
+			ss << "# TYPE " << name << " counter\n";
+			ss << name << " " << entry.counter->get() << "\n";
+			break;
+		case METRIC_GAUGE:
+			ss << "# TYPE " << name << " gauge\n";
+			ss << name << " " << entry.gauge() << "\n";
+			break;
+		case METRIC_HISTOGRAM:
+		{
+			const Histogram& hist = *entry.histogram;
+			ss << "# TYPE " << name << " histogram\n";
+
+			unsigned long long cumulative = 0;
+			for(int i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++)
+			{
+				cumulative += hist.mBuckets[i].load(std::memory_order_relaxed);
+				ss << name << "_bucket{le=\"";
+				if(i < METRICS_HISTOGRAM_BUCKETS - 1)
+					ss << Histogram::BOUNDS[i];
+				else
+					ss << "+Inf";
+				ss << "\"} " << cumulative << "\n";
+			}
+			ss << name << "_sum " << hist.getSum() << "\n";
+			ss << name << "_count " << cumulative << "\n";
+
+			// estimated here too, so a plain text dump is readable without a Prometheus server
+			const float quantiles[3] = { 0.5f, 0.95f, 0.99f };
+			for(int q = 0; q < 3; q++)
+				ss << name << "_estimate{quantile=\"" << quantiles[q] << "\"} " << hist.getPercentile(quantiles[q]) << "\n";
+			break;
+		}
+		}
+	}
+
+	return ss.str();
+}
+
+void Metrics::update()
+{
+	const std::string path = Settings::getInstance()->getString("MetricsFile");
+	if(path.empty())
+		return;
+
+	const Uint32 now = SDL_GetTicks();
+	const int interval = Settings::getInstance()->getInt("MetricsInterval");
+	if(sLastWrite != 0 && now - sLastWrite < (Uint32)(interval > 0 ? interval : 1) * 1000)
+		return;
+	sLastWrite = now;
+
+	// whatever's watching the file only ever sees a complete one
+	const std::string tmpPath = path + ".tmp";
+	{
+		std::ofstream out(tmpPath.c_str(), std::ios::out | std::ios::trunc);
+		if(!out.is_open())
+		{
+			LOG(LogError) << "Could not write metrics to " << tmpPath;
+			return;
+		}
+		out << format();
+	}
+
+#ifdef WIN32
+	remove(path.c_str()); // rename doesn't replace on Windows
+#endif
+	if(rename(tmpPath.c_str(), path.c_str()) != 0)
+		LOG(LogError) << "Could not move metrics file into place at " << path;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <string>
+
+#define METRICS_HISTOGRAM_BUCKETS 16
+
+// A registry of counters, histograms and gauges any subsystem can feed, and a periodic dump of them
+// (Prometheus text format) to the "MetricsFile" setting's path every "MetricsInterval" seconds.
+// Look metrics up once (e.g. into a function-local static) - updating one is a relaxed atomic add.
+class Metrics
+{
+public:
+	class Counter
+	{
+	public:
+		Counter() : mValue(0) {}
+		inline void add(unsigned long long amount = 1) { mValue.fetch_add(amount, std::memory_order_relaxed); }
+		inline unsigned long long get() const { return mValue.load(std::memory_order_relaxed); }
+
+	private:
+		std::atomic<unsigned long long> mValue;
+	};
+
+	// Counts values into fixed buckets (ms-ish scale, 1 to 10000 and above) and keeps their sum.
+	class Histogram
+	{
+	public:
+		Histogram();
+		void record(float value);
+
+		unsigned long long getCount() const;
+		double getSum() const;
+		// Estimated from the buckets, fraction is 0-1.
+		float getPercentile(float fraction) const;
+
+		static const float BOUNDS[METRICS_HISTOGRAM_BUCKETS - 1]; // upper bounds, the last bucket has none
+
+	private:
+		friend class Metrics;
+		std::atomic<unsigned long long> mBuckets[METRICS_HISTOGRAM_BUCKETS];
+		std::atomic<unsigned long long> mSumMicros; // sum * 1000, atomics don't do doubles
+	};
+
+	typedef std::function<double()> GaugeFunc;
+
+	// Returns the metric with this name, creating it the first time. The pointer stays valid forever.
+	static Counter* getCounter(const std::string& name, const std::string& help);
+	static Histogram* getHistogram(const std::string& name, const std::string& help);
+	// func is called from update() (so on the main thread) whenever the metrics are written, and mustn't register metrics itself.
+	static void addGauge(const std::string& name, const std::string& help, const GaugeFunc& func);
+
+	// Main thread, once a frame. Writes the file when it's due.
+	static void update();
+
+	// Everything in Prometheus text format.
+	static std::string format();
+};
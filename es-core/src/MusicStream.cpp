@@ -0,0 +1,285 @@
+#include "MusicStream.h"
+#include "AudioManager.h"
+#include "Log.h"
+#include "Settings.h"
+#include "Metrics.h"
+#include "ThemeData.h"
+#include <algorithm>
+#include <chrono>
+#include <string.h>
+
+// raw file data read at a time
+#define MUSIC_CHUNK_BYTES 16384
+// the decoder waits until this many samples fit into the ring
+#define MUSIC_CHUNK_SAMPLES 4096
+
+std::unique_ptr<MusicStream> MusicStream::sCurrent;
+
+void MusicStream::play(const std::string& path, float volume)
+{
+	if(path.empty() || !Settings::getInstance()->getBool("EnableMusic"))
+	{
+		stop();
+		return;
+	}
+
+	if(sCurrent && sCurrent->mPath == path)
+		return;
+
+	stop();
+
+	std::unique_ptr<MusicStream> stream(new MusicStream(path, volume));
+	if(!stream->open())
+		return;
+
+	stream->mRunning = true;
+	stream->mThread = std::thread(&MusicStream::decodeThread, stream.get());
+
+	sCurrent = std::move(stream);
+	AudioManager::getInstance()->playMusic(sCurrent.get());
+}
+
+void MusicStream::playFromTheme(const std::shared_ptr<ThemeData>& theme, const std::string& view, const std::string& element)
+{
+	const ThemeData::ThemeElement* elem = theme->getElement(view, element, "sound");
+	if(!elem || !elem->has(ThemeProperties::PATH))
+	{
+		stop();
+		return;
+	}
+
+	play(elem->get<std::string>(ThemeProperties::PATH), elem->has(ThemeProperties::VOLUME) ? elem->get<float>(ThemeProperties::VOLUME) : 1.0f);
+}
+
+void MusicStream::stop()
+{
+	sCurrent.reset();
+}
+
+MusicStream::MusicStream(const std::string& path, float volume) : mPath(path), 
+	mGain((int)(std::max(0.0f, std::min(volume, 1.0f)) * AUDIO_GAIN_ONE)), mFile(NULL), mDataStart(0), mDataLength(0), mDataPos(0), 
+#if SDL_VERSION_ATLEAST(2, 0, 7)
+	mConverter(NULL), 
+#endif
+	mMono(false), mRing(MUSIC_RING_SAMPLES), mRead(0), mWrite(0), mRunning(false)
+{
+}
+
+MusicStream::~MusicStream()
+{
+	// the mixer lets go of us first, then nothing reads the ring anymore
+	AudioManager::releaseMusic(this);
+
+	mRunning = false;
+	if(mThread.joinable())
+		mThread.join();
+
+	close();
+}
+
+bool MusicStream::open()
+{
+	mFile = SDL_RWFromFile(mPath.c_str(), "rb");
+	if(mFile == NULL)
+	{
+		LOG(LogError) << "Could not open music \"" << mPath << "\": " << SDL_GetError();
+		return false;
+	}
+
+	char id[4];
+	bool riff = SDL_RWread(mFile, id, 1, 4) == 4 && memcmp(id, "RIFF", 4) == 0;
+	SDL_ReadLE32(mFile); // file size
+	riff = riff && SDL_RWread(mFile, id, 1, 4) == 4 && memcmp(id, "WAVE", 4) == 0;
+
+	// walk the chunks up to the data, we only need the format
+	Uint16 format = 0, channels = 0, bits = 0;
+	Uint32 rate = 0;
+	while(riff && SDL_RWread(mFile, id, 1, 4) == 4)
+	{
+		const Uint32 size = SDL_ReadLE32(mFile);
+		if(memcmp(id, "data", 4) == 0)
+		{
+			mDataStart = SDL_RWtell(mFile);
+			mDataLength = size;
+			break;
+		}
+
+		const Sint64 next = SDL_RWtell(mFile) + size + (size & 1);
+		if(memcmp(id, "fmt ", 4) == 0)
+		{
+			format = SDL_ReadLE16(mFile);
+			channels = SDL_ReadLE16(mFile);
+			rate = SDL_ReadLE32(mFile);
+			SDL_ReadLE32(mFile); // bytes per second
+			SDL_ReadLE16(mFile); // block align
+			bits = SDL_ReadLE16(mFile);
+		}
+		SDL_RWseek(mFile, next, RW_SEEK_SET);
+	}
+
+	SDL_AudioFormat src = 0;
+	if(format == 1 && bits == 8)
+		src = AUDIO_U8;
+	else if(format == 1 && bits == 16)
+		src = AUDIO_S16LSB;
+	else if(format == 3 && bits == 32)
+		src = AUDIO_F32LSB;
+
+	if(mDataStart == 0 || mDataLength == 0 || src == 0 || channels == 0 || rate == 0)
+	{
+		LOG(LogError) << "Music \"" << mPath << "\" is not a PCM WAV file (8/16-bit integer or 32-bit float)";
+		close();
+		return false;
+	}
+
+	if(src == AUDIO_S16SYS && rate == 44100 && channels <= 2)
+	{
+		// already what the mixer wants
+		mMono = (channels == 1);
+		return true;
+	}
+
+#if SDL_VERSION_ATLEAST(2, 0, 7)
+	mConverter = SDL_NewAudioStream(src, (Uint8)channels, rate, AUDIO_S16SYS, 2, 44100);
+	if(mConverter == NULL)
+	{
+		LOG(LogError) << "Can't convert music \"" << mPath << "\": " << SDL_GetError();
+		close();
+		return false;
+	}
+	return true;
+#else
+	LOG(LogError) << "Music \"" << mPath << "\" has to be 16-bit 44.1kHz mono or stereo with this SDL version";
+	close();
+	return false;
+#endif
+}
+
+void MusicStream::close()
+{
+#if SDL_VERSION_ATLEAST(2, 0, 7)
+	if(mConverter)
+	{
+		SDL_FreeAudioStream(mConverter);
+		mConverter = NULL;
+	}
+#endif
+
+	if(mFile)
+	{
+		SDL_RWclose(mFile);
+		mFile = NULL;
+	}
+}
+
+int MusicStream::readChunk(Uint8* buffer, int size)
+{
+	// loop - the converter keeps its state, so there's no gap or click at the seam
+	if(mDataPos >= mDataLength)
+	{
+		SDL_RWseek(mFile, mDataStart, RW_SEEK_SET);
+		mDataPos = 0;
+	}
+
+	const Uint32 wanted = std::min((Uint32)size, mDataLength - mDataPos);
+	const Uint32 got = (Uint32)SDL_RWread(mFile, buffer, 1, wanted);
+
+	// a file shorter than its header says loops from where it ends
+	mDataPos = got == 0 ? mDataLength : mDataPos + got;
+	return (int)got;
+}
+
+void MusicStream::decodeThread()
+{
+	std::vector<Uint8> raw(MUSIC_CHUNK_BYTES);
+	std::vector<Sint16> pcm(MUSIC_CHUNK_BYTES);
+
+	while(mRunning)
+	{
+		const Uint32 write = mWrite.load(std::memory_order_relaxed);
+		const Uint32 space = std::min<Uint32>(MUSIC_RING_SAMPLES - (write - mRead.load(std::memory_order_acquire)), pcm.size()) & ~1u;
+		if(space < MUSIC_CHUNK_SAMPLES)
+		{
+			// about a tenth of the ring, so there's always plenty left for the mixer
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			continue;
+		}
+
+		Uint32 count = 0; // samples in pcm
+#if SDL_VERSION_ATLEAST(2, 0, 7)
+		if(mConverter)
+		{
+			const int got = SDL_AudioStreamGet(mConverter, &pcm[0], space * sizeof(Sint16));
+			if(got <= 0)
+			{
+				const int n = readChunk(&raw[0], raw.size());
+				if(n > 0)
+					SDL_AudioStreamPut(mConverter, &raw[0], n);
+				else
+					std::this_thread::sleep_for(std::chrono::milliseconds(20));
+				continue;
+			}
+			count = got / sizeof(Sint16);
+		}else
+#endif
+		{
+			// only whole frames, so the channels never swap
+			const int frameBytes = mMono ? 2 : 4;
+			const int wanted = std::min<int>((mMono ? space / 2 : space) * sizeof(Sint16), raw.size()) / frameBytes * frameBytes;
+			const int n = readChunk(&raw[0], wanted) / frameBytes * frameBytes;
+			if(n <= 0)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(20));
+				continue;
+			}
+
+			const Sint16* in = (const Sint16*)&raw[0];
+			if(mMono)
+			{
+				for(int i = 0; i < n / 2; i++)
+					pcm[i * 2] = pcm[i * 2 + 1] = in[i];
+				count = n;
+			}else{
+				memcpy(&pcm[0], in, n);
+				count = n / 2;
+			}
+		}
+
+		for(Uint32 i = 0; i < count; i++)
+			mRing[(write + i) & (MUSIC_RING_SAMPLES - 1)] = pcm[i];
+
+		// publishes the samples
+		mWrite.store(write + count, std::memory_order_release);
+	}
+}
+
+// looked up here rather than in mix(), the audio thread shouldn't take the registry's lock
+static Metrics::Counter* sUnderruns = Metrics::getCounter("es_audio_underruns_total", "Audio callbacks the music decoder couldn't keep up with");
+
+void MusicStream::mix(Sint32* out, Uint32 count)
+{
+	Uint32 read = mRead.load(std::memory_order_relaxed);
+	const Uint32 written = mWrite.load(std::memory_order_acquire);
+	Uint32 available = written - read;
+	if(available > count)
+		available = count;
+
+	// music loops, so once it got going, running short means the decoder fell behind
+	if(available < count && written != 0 && mRunning)
+		sUnderruns->add();
+
+	// at most two runs, the ring might wrap around
+	while(available > 0)
+	{
+		const Uint32 start = read & (MUSIC_RING_SAMPLES - 1);
+		const Uint32 run = std::min(available, MUSIC_RING_SAMPLES - start);
+		AudioManager::mixVoice(out, &mRing[start], mGain, run);
+
+		out += run;
+		read += run;
+		available -= run;
+	}
+
+	// frees the space for the decoder
+	mRead.store(read, std::memory_order_release);
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include "SDL_audio.h"
+
+class ThemeData;
+
+// ring buffer size in samples (a power of two), about 1.5 seconds of 44.1kHz stereo
+#define MUSIC_RING_SAMPLES (1 << 17)
+
+// Background music, decoded a chunk at a time on its own thread into a fixed ring buffer the mixer reads from,
+// so memory use doesn't depend on the track's length. Tracks loop without a gap (the decoder just seeks back
+// to the start of the data). Only PCM WAV files for now, other formats need a decoder behind readChunk().
+class MusicStream
+{
+public:
+	// Loops the track at path (volume 0 to 1) instead of whatever was playing. Does nothing if it's already playing.
+	// An empty path stops the music.
+	static void play(const std::string& path, float volume = 1.0f);
+	// Uses the "path" and "volume" of a sound element, e.g. <sound name="music"> in the system view.
+	static void playFromTheme(const std::shared_ptr<ThemeData>& theme, const std::string& view, const std::string& element);
+	static void stop();
+
+	~MusicStream();
+
+	// Called by the mixer, adds up to count samples to out. Never blocks, an empty ring is silence.
+	void mix(Sint32* out, Uint32 count);
+
+private:
+	MusicStream(const std::string& path, float volume);
+
+	bool open();
+	void close();
+	int readChunk(Uint8* buffer, int size); // raw data from the file, wraps around at the end
+	void decodeThread();
+
+	static std::unique_ptr<MusicStream> sCurrent;
+
+	std::string mPath;
+	int mGain;
+
+	SDL_RWops* mFile;
+	Sint64 mDataStart;
+	Uint32 mDataLength;
+	Uint32 mDataPos;
+#if SDL_VERSION_ATLEAST(2, 0, 7)
+	SDL_AudioStream* mConverter; // NULL if the file is already in the output format
+#endif
+	bool mMono; // without a converter, mono is just duplicated
+
+	std::vector<Sint16> mRing;
+	std::atomic<Uint32> mRead; // only advanced by the mixer
+	std::atomic<Uint32> mWrite; // only advanced by the decoder
+
+	std::atomic<bool> mRunning;
+	std::thread mThread;
+};
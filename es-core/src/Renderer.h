@@ -2,6 +2,7 @@
 #define _RENDERER_H_
 
 #include <vector>
+#include <cstddef>
 #include <string>
 #include "platform.h"
 #include <Eigen/Dense>
@@ -18,22 +19,161 @@ namespace Renderer
 	bool init(int w, int h);
 	void deinit();
 
+	// Hides the window but keeps it and the GL context (and so every texture) alive, for "KeepVideoOnLaunch".
+	void suspend();
+	void resume();
+
 	unsigned int getScreenWidth();
 	unsigned int getScreenHeight();
 
+	// GL entry points and extensions of the current context, from whichever backend made it (SDL or KMS/EGL)
+	void* getProcAddress(const char* name);
+	bool isExtensionSupported(const char* name);
+	bool hasContext();
+
+	// refresh rate of the display the window is on, 0 if unknown
+	int getRefreshRate();
+	// 0 = no vsync, 1 = vsync, -1 = adaptive vsync (late swaps tear instead of waiting a whole refresh)
+	int getSwapInterval();
+
 	void buildGLColorArray(GLubyte* ptr, unsigned int color, unsigned int vertCount);
 
 	//graphics commands
 	void swapBuffers();
+	void flush(); // hands the GPU what's been drawn so far, without waiting for it
 
 	void pushClipRect(Eigen::Vector2i pos, Eigen::Vector2i dim);
 	void popClipRect();
+	Eigen::Vector4i getClipRect(); // x, y, w, h of what can be drawn to right now (y down), the whole screen (or render target) if nothing's pushed
 
 	void setMatrix(float* mat);
 	void setMatrix(const Eigen::Affine3f& transform);
 
+	//quads
+	//drawRect and drawQuad don't draw right away: the corners go through the current matrix on the CPU and are collected,
+	//and quads in a row with the same texture and blending are drawn together. Everything else here that draws or changes
+	//state (binding a texture, clip rects, render targets, swapping...) draws what's collected first, so nothing ends up
+	//in a different order on screen; only quads drawn one after another share a draw, none are moved past anything.
 	void drawRect(int x, int y, int w, int h, unsigned int color, GLenum blend_sfactor = GL_SRC_ALPHA, GLenum blend_dfactor = GL_ONE_MINUS_SRC_ALPHA);
 	void drawRect(float x, float y, float w, float h, unsigned int color, GLenum blend_sfactor = GL_SRC_ALPHA, GLenum blend_dfactor = GL_ONE_MINUS_SRC_ALPHA);
+	// texture is RGBA (0 for none, like drawRect), (u1, v1) goes at (x, y) and (u2, v2) at (x + w, y + h)
+	void drawQuad(GLuint texture, float x, float y, float w, float h, float u1, float v1, float u2, float v2, unsigned int color,
+		GLenum blend_sfactor = GL_SRC_ALPHA, GLenum blend_dfactor = GL_ONE_MINUS_SRC_ALPHA);
+	void flushQuads(); // draws what's collected now, for GL calls made around the Renderer (e.g. GPU timer queries)
+
+	//draw state
+	//these remember what GL was last told and skip calls that wouldn't change anything, so draws set everything
+	//they depend on up front and don't undo it afterwards. Change this state through here only (or call resetState()).
+	void setTextureEnabled(bool enabled, bool alphaOnly = false, bool distanceField = false); // alphaOnly for GL_ALPHA textures (font glyphs), distanceField if they hold signed distances
+	void setBlendEnabled(bool enabled);
+	void setBlendFunc(GLenum sfactor, GLenum dfactor);
+	void setClientArrays(bool vertices, bool texCoords, bool colors);
+	void bindTexture(GLuint textureID);
+	void deleteTexture(GLuint textureID); // use instead of glDeleteTextures so a deleted texture isn't considered bound
+	void resetState(); // forget everything, e.g. after the context was recreated
+	unsigned int getElidedStateChanges(); // how many calls were skipped so far
+	unsigned int getContextSerial(); // changes with every resetState(), GL objects made before that are gone
+
+	//counted since the last resetFrameStats(), for benchmarking
+	struct FrameStats
+	{
+		unsigned int drawCalls;
+		unsigned int textureUploads;
+	};
+	const FrameStats& getFrameStats();
+	void resetFrameStats();
+	void countTextureUpload(); // call next to every glTexImage2D/glTexSubImage2D/glCompressedTexImage2D
+
+	//texture uploads
+	//glTexImage2D/glTexSubImage2D of level 0 of the bound texture, GL_RGBA or GL_ALPHA bytes (with GL_UNPACK_ALIGNMENT 1 for
+	//GL_ALPHA). Big ones go through a pixel buffer object on desktop GL: the call only copies the pixels into the buffer and the
+	//driver moves them to the texture on its own time instead of stalling us. The buffers are reused once a fence says
+	//the GPU is done with them. Everything else (GLES, small uploads, all buffers busy) is a plain upload. Both count as one.
+	void texImage2D(GLsizei width, GLsizei height, GLenum format, const void* pixels);
+	void texSubImage2D(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, const void* pixels);
+
+	//drawing
+	//with "ShaderRenderer" on and GL 2.0 available these go to a small set of shader programs (picked by the texture state
+	//above), otherwise to the fixed-function pipeline. Use them instead of the gl* equivalents.
+	void setConstantColor(unsigned int color); // the colour used while the colour array is off (glColor)
+	void vertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
+	void texCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
+	void colorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
+	void drawArrays(GLenum mode, GLint first, GLsizei count);
+
+	//vertex buffers
+	//gl*Pointer calls take "base + offset", where base comes from one of these. If buffer objects aren't
+	//available base is just the client-side address, so the same code works either way.
+
+	//A buffer object for vertex data that doesn't change every frame. The owner keeps its own copy of the data and
+	//calls markDirty() when it changes; use() uploads it again when needed (also after the context was recreated).
+	//Copies start out empty.
+	class VertexBuffer
+	{
+	public:
+		VertexBuffer();
+		VertexBuffer(const VertexBuffer& other);
+		VertexBuffer& operator=(const VertexBuffer& other);
+		~VertexBuffer();
+
+		inline void markDirty() { mDirty = true; }
+		const char* use(const void* data, size_t size); // binds it (uploading data if dirty), returns base
+
+	private:
+		void release();
+
+		GLuint mId;
+		unsigned int mContext;
+		size_t mSize; // of its storage
+		bool mDirty;
+	};
+
+	const char* streamVertices(const void* data, size_t size); // for data that changes every frame, copies it into a ring buffer and returns base
+	void useClientArrays(); // for gl*Pointer calls with plain client-side addresses
+
+	//render targets
+	//A texture to draw into instead of the screen (a framebuffer object). Everything drawn into it ends up premultiplied
+	//by alpha (setBlendFunc() keeps the alpha channel right while one is bound), so draw its texture with
+	//GL_ONE, GL_ONE_MINUS_SRC_ALPHA. Targets can be nested.
+	bool renderTargetsSupported();
+
+	class RenderTarget
+	{
+	public:
+		RenderTarget();
+		~RenderTarget();
+
+		// Binds it (remaking it at width x height if it isn't that size) and clears it to transparent. Until end(),
+		// everything is drawn into it with (0, 0) at its top left, clip rects are relative to it and the ones pushed
+		// before are suspended. Returns false (and binds nothing) if it couldn't be made.
+		// With a scale, coordinates still go up to width x height but the texture only has scale times the pixels
+		// (and is sampled linearly); 0 is whatever the target or screen it's drawn into uses.
+		bool begin(int width, int height, float scale = 0);
+		void end();
+
+		// 0 if it hasn't been drawn into in the current context; rows are bottom to top, like any framebuffer
+		GLuint getTexture() const;
+		inline int getWidth() const { return mWidth; }
+		inline int getHeight() const { return mHeight; }
+		inline float getScale() const { return mScale; }
+		inline int getPixelWidth() const { return mPixelWidth; }
+		inline int getPixelHeight() const { return mPixelHeight; }
+
+		void release(); // frees the texture and framebuffer, begin() makes new ones
+
+	private:
+		RenderTarget(const RenderTarget&);
+		RenderTarget& operator=(const RenderTarget&);
+
+		GLuint mFramebuffer;
+		GLuint mTexture;
+		int mWidth;
+		int mHeight;
+		float mScale;
+		int mPixelWidth;
+		int mPixelHeight;
+		unsigned int mContext;
+	};
 }
 
 #endif
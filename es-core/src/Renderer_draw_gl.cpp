@@ -6,11 +6,1057 @@
 #include <boost/filesystem.hpp>
 #include "Log.h"
 #include <stack>
+#include <cstring>
+#include <cstddef>
 #include "Util.h"
+#include "Settings.h"
+#include <SDL.h>
+
+#define STREAM_BUFFER_SIZE (256 * 1024) // bytes of per-frame vertex data before the ring buffer starts over
+#define UPLOAD_BUFFER_COUNT 4 // pixel buffer objects in flight at once
+#define UPLOAD_BUFFER_MIN_SIZE (64 * 1024) // bytes, smaller uploads aren't worth a buffer
+#define QUAD_BATCH_MAX 512 // quads collected before they're drawn anyway
+
+#ifdef USE_OPENGL_ES
+	#define glOrtho glOrthof
+#endif
 
 namespace Renderer {
 	std::stack<Eigen::Vector4i> clipStack;
 
+	// what GL was last told, -1 = unknown
+	int stateTexture2D = -1;
+	int stateBlend = -1;
+	int stateAlphaTest = -1; // fixed-function only, how distance fields are drawn without shaders
+	int stateVertexArray = -1;
+	int stateTexCoordArray = -1;
+	int stateColorArray = -1;
+	bool stateBlendFuncKnown = false;
+	GLenum stateBlendSrc = GL_ONE;
+	GLenum stateBlendDst = GL_ZERO;
+	bool stateTextureKnown = false;
+	GLuint stateTexture = 0;
+	bool stateArrayBufferKnown = false;
+
+	FrameStats frameStats = { 0, 0 };
+	GLuint stateArrayBuffer = 0;
+	unsigned int elidedStateChanges = 0;
+
+	unsigned int contextSerial = 1; // bumped by resetState(), buffers made before that are gone
+
+	// quads from drawRect() and drawQuad() that aren't drawn yet, all with the same texture and blending,
+	// their corners already put through the matrix they were drawn with
+	struct QuadVertex
+	{
+		GLfloat position[2];
+		GLfloat texCoord[2];
+		GLubyte color[4];
+	};
+
+	std::vector<QuadVertex> quadVertices;
+	GLuint quadTexture = 0; // 0 = untextured
+	GLenum quadBlendSrc = GL_SRC_ALPHA;
+	GLenum quadBlendDst = GL_ONE_MINUS_SRC_ALPHA;
+	bool flushingQuads = false;
+
+	// everything that draws or changes what a draw sees calls this first, so collected quads still end up under
+	// whatever's drawn after them
+	inline void flushPendingQuads()
+	{
+		if(!quadVertices.empty() && !flushingQuads)
+			flushQuads();
+	}
+
+	// render targets currently bound, innermost last, and the clip stacks they suspended
+	std::vector<RenderTarget*> targetStack;
+	std::vector< std::stack<Eigen::Vector4i> > suspendedClipStacks;
+
+	// size of what's being drawn to, the screen or the innermost render target
+	int getViewWidth()
+	{
+		return targetStack.empty() ? (int)getScreenWidth() : targetStack.back()->getWidth();
+	}
+
+	int getViewHeight()
+	{
+		return targetStack.empty() ? (int)getScreenHeight() : targetStack.back()->getHeight();
+	}
+
+	// pixels per unit of the above
+	float getViewScale()
+	{
+		return targetStack.empty() ? 1.0f : targetStack.back()->getScale();
+	}
+
+	// glScissor for a box in view units (already flipped to y+ = up)
+	void applyScissor(const Eigen::Vector4i& box)
+	{
+		const float scale = getViewScale();
+		if(scale == 1.0f)
+		{
+			glScissor(box[0], box[1], box[2], box[3]);
+		}else{
+			// a little generous rather than cutting into edge pixels
+			const int x1 = (int)floor(box[0] * scale), y1 = (int)floor(box[1] * scale);
+			const int x2 = (int)ceil((box[0] + box[2]) * scale), y2 = (int)ceil((box[1] + box[3]) * scale);
+			glScissor(x1, y1, x2 - x1, y2 - y1);
+		}
+	}
+
+	// framebuffer objects: core in GL 3.0, otherwise ARB/EXT_framebuffer_object or OES_framebuffer_object (same values)
+#ifndef GL_FRAMEBUFFER
+	#define GL_FRAMEBUFFER 0x8D40
+#endif
+#ifndef GL_COLOR_ATTACHMENT0
+	#define GL_COLOR_ATTACHMENT0 0x8CE0
+#endif
+#ifndef GL_FRAMEBUFFER_COMPLETE
+	#define GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#endif
+#ifndef APIENTRY
+	#define APIENTRY
+#endif
+
+	typedef void (APIENTRY *GenFramebuffersProc)(GLsizei n, GLuint* framebuffers);
+	typedef void (APIENTRY *DeleteFramebuffersProc)(GLsizei n, const GLuint* framebuffers);
+	typedef void (APIENTRY *BindFramebufferProc)(GLenum target, GLuint framebuffer);
+	typedef void (APIENTRY *FramebufferTexture2DProc)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+	typedef GLenum (APIENTRY *CheckFramebufferStatusProc)(GLenum target);
+	typedef void (APIENTRY *BlendFuncSeparateProc)(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);
+
+	GenFramebuffersProc genFramebuffers = NULL;
+	DeleteFramebuffersProc deleteFramebuffers = NULL;
+	BindFramebufferProc bindFramebuffer = NULL;
+	FramebufferTexture2DProc framebufferTexture2D = NULL;
+	CheckFramebufferStatusProc checkFramebufferStatus = NULL;
+	BlendFuncSeparateProc blendFuncSeparate = NULL;
+
+	// the core name, or failing that the extension's
+	void* getExtensionProc(const std::string& name)
+	{
+		const char* suffixes[] = { "", "EXT", "OES" };
+		for(unsigned int i = 0; i < sizeof(suffixes) / sizeof(suffixes[0]); i++)
+		{
+			void* proc = Renderer::getProcAddress((name + suffixes[i]).c_str());
+			if(proc)
+				return proc;
+		}
+		return NULL;
+	}
+
+#ifdef USE_OPENGL_DESKTOP
+	// GL 1.5, not necessarily exported by the GL library itself (e.g. on Windows)
+	typedef void (APIENTRY *GenBuffersProc)(GLsizei n, GLuint* buffers);
+	typedef void (APIENTRY *DeleteBuffersProc)(GLsizei n, const GLuint* buffers);
+	typedef void (APIENTRY *BindBufferProc)(GLenum target, GLuint buffer);
+	typedef void (APIENTRY *BufferDataProc)(GLenum target, GLsizeiptr size, const GLvoid* data, GLenum usage);
+	typedef void (APIENTRY *BufferSubDataProc)(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid* data);
+
+	GenBuffersProc genBuffers = NULL;
+	DeleteBuffersProc deleteBuffers = NULL;
+	BindBufferProc bindBuffer = NULL;
+	BufferDataProc bufferData = NULL;
+	BufferSubDataProc bufferSubData = NULL;
+
+	#define STREAM_BUFFER_USAGE GL_STREAM_DRAW
+
+	bool buffersSupported()
+	{
+		static int supported = -1;
+		if(supported == -1)
+		{
+			genBuffers = (GenBuffersProc)Renderer::getProcAddress("glGenBuffers");
+			deleteBuffers = (DeleteBuffersProc)Renderer::getProcAddress("glDeleteBuffers");
+			bindBuffer = (BindBufferProc)Renderer::getProcAddress("glBindBuffer");
+			bufferData = (BufferDataProc)Renderer::getProcAddress("glBufferData");
+			bufferSubData = (BufferSubDataProc)Renderer::getProcAddress("glBufferSubData");
+
+			supported = (genBuffers && deleteBuffers && bindBuffer && bufferData && bufferSubData) ? 1 : 0;
+			if(!supported)
+				LOG(LogWarning) << "Vertex buffer objects aren't available, using client-side arrays";
+		}
+
+		return supported == 1;
+	}
+#else
+	// core in GLES 1.1 (which has no GL_STREAM_DRAW)
+	#define genBuffers glGenBuffers
+	#define deleteBuffers glDeleteBuffers
+	#define bindBuffer glBindBuffer
+	#define bufferData glBufferData
+	#define bufferSubData glBufferSubData
+
+	#define STREAM_BUFFER_USAGE GL_DYNAMIC_DRAW
+
+	bool buffersSupported()
+	{
+		return true;
+	}
+#endif
+
+	GLuint streamBuffer = 0;
+	unsigned int streamContext = 0;
+	size_t streamOffset = 0;
+
+	// programmable pipeline, used instead of fixed-function when the driver has it (desktop GL 2.0+)
+	// vertex attributes stand in for the client arrays, with the same indices everywhere
+	enum Attrib
+	{
+		ATTRIB_POSITION = 0,
+		ATTRIB_TEXCOORD = 1,
+		ATTRIB_COLOR = 2
+	};
+
+	struct Program
+	{
+		GLuint id;
+		GLint matrixLocation;
+		unsigned int matrixSerial; // of the matrix it was last given
+	};
+
+	Program colorProgram; // vertex colours only
+	Program textureProgram; // RGBA texture * vertex colour
+	Program alphaTextureProgram; // GL_ALPHA texture (font glyphs), its alpha * vertex colour
+	Program distanceFieldProgram; // GL_ALPHA texture holding signed distances (0.5 on the edge), anti-aliased edge * vertex colour
+	GLuint currentProgram = 0;
+	int shaderState = -1; // -1 = not decided for this context yet
+
+	bool stateAlphaTexture = false;
+	bool stateDistanceField = false;
+	float modelView[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+	unsigned int matrixSerial = 1;
+
+	const char* vertexShaderSource =
+		"uniform mat4 uMatrix;\n"
+		"attribute vec2 aPosition;\n"
+		"attribute vec2 aTexCoord;\n"
+		"attribute vec4 aColor;\n"
+		"varying vec2 vTexCoord;\n"
+		"varying vec4 vColor;\n"
+		"void main()\n"
+		"{\n"
+		"	gl_Position = uMatrix * vec4(aPosition, 0.0, 1.0);\n"
+		"	vTexCoord = aTexCoord;\n"
+		"	vColor = aColor;\n"
+		"}\n";
+
+	const char* colorFragmentSource =
+		"#ifdef GL_ES\n"
+		"precision mediump float;\n"
+		"#endif\n"
+		"varying vec4 vColor;\n"
+		"void main()\n"
+		"{\n"
+		"	gl_FragColor = vColor;\n"
+		"}\n";
+
+	const char* textureFragmentSource =
+		"#ifdef GL_ES\n"
+		"precision mediump float;\n"
+		"#endif\n"
+		"uniform sampler2D uTexture;\n"
+		"varying vec2 vTexCoord;\n"
+		"varying vec4 vColor;\n"
+		"void main()\n"
+		"{\n"
+		"	gl_FragColor = texture2D(uTexture, vTexCoord) * vColor;\n"
+		"}\n";
+
+	const char* alphaTextureFragmentSource =
+		"#ifdef GL_ES\n"
+		"precision mediump float;\n"
+		"#endif\n"
+		"uniform sampler2D uTexture;\n"
+		"varying vec2 vTexCoord;\n"
+		"varying vec4 vColor;\n"
+		"void main()\n"
+		"{\n"
+		"	gl_FragColor = vec4(vColor.rgb, vColor.a * texture2D(uTexture, vTexCoord).a);\n"
+		"}\n";
+
+	// the edge is smoothed over about a pixel on screen, whatever the scale
+	const char* distanceFieldFragmentSource =
+		"#ifdef GL_ES\n"
+		"precision mediump float;\n"
+		"#endif\n"
+		"uniform sampler2D uTexture;\n"
+		"varying vec2 vTexCoord;\n"
+		"varying vec4 vColor;\n"
+		"void main()\n"
+		"{\n"
+		"	float distance = texture2D(uTexture, vTexCoord).a;\n"
+		"	float width = fwidth(distance) * 0.7;\n"
+		"	gl_FragColor = vec4(vColor.rgb, vColor.a * smoothstep(0.5 - width, 0.5 + width, distance));\n"
+		"}\n";
+
+#ifdef USE_OPENGL_DESKTOP
+	// GL 2.0
+	typedef GLuint (APIENTRY *CreateShaderProc)(GLenum type);
+	typedef void (APIENTRY *ShaderSourceProc)(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length);
+	typedef void (APIENTRY *CompileShaderProc)(GLuint shader);
+	typedef void (APIENTRY *GetShaderivProc)(GLuint shader, GLenum pname, GLint* params);
+	typedef void (APIENTRY *GetInfoLogProc)(GLuint object, GLsizei bufSize, GLsizei* length, GLchar* infoLog);
+	typedef void (APIENTRY *DeleteShaderProc)(GLuint shader);
+	typedef GLuint (APIENTRY *CreateProgramProc)();
+	typedef void (APIENTRY *AttachShaderProc)(GLuint program, GLuint shader);
+	typedef void (APIENTRY *BindAttribLocationProc)(GLuint program, GLuint index, const GLchar* name);
+	typedef void (APIENTRY *LinkProgramProc)(GLuint program);
+	typedef void (APIENTRY *GetProgramivProc)(GLuint program, GLenum pname, GLint* params);
+	typedef void (APIENTRY *DeleteProgramProc)(GLuint program);
+	typedef void (APIENTRY *UseProgramProc)(GLuint program);
+	typedef GLint (APIENTRY *GetUniformLocationProc)(GLuint program, const GLchar* name);
+	typedef void (APIENTRY *Uniform1iProc)(GLint location, GLint v0);
+	typedef void (APIENTRY *UniformMatrix4fvProc)(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value);
+	typedef void (APIENTRY *VertexAttribArrayProc)(GLuint index);
+	typedef void (APIENTRY *VertexAttribPointerProc)(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid* pointer);
+	typedef void (APIENTRY *VertexAttrib4fProc)(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+
+	CreateShaderProc createShader = NULL;
+	ShaderSourceProc shaderSource = NULL;
+	CompileShaderProc compileShader = NULL;
+	GetShaderivProc getShaderiv = NULL;
+	GetInfoLogProc getShaderInfoLog = NULL;
+	DeleteShaderProc deleteShader = NULL;
+	CreateProgramProc createProgram = NULL;
+	AttachShaderProc attachShader = NULL;
+	BindAttribLocationProc bindAttribLocation = NULL;
+	LinkProgramProc linkProgram = NULL;
+	GetProgramivProc getProgramiv = NULL;
+	GetInfoLogProc getProgramInfoLog = NULL;
+	DeleteProgramProc deleteProgram = NULL;
+	UseProgramProc useProgram = NULL;
+	GetUniformLocationProc getUniformLocation = NULL;
+	Uniform1iProc uniform1i = NULL;
+	UniformMatrix4fvProc uniformMatrix4fv = NULL;
+	VertexAttribArrayProc enableVertexAttribArray = NULL;
+	VertexAttribArrayProc disableVertexAttribArray = NULL;
+	VertexAttribPointerProc vertexAttribPointer = NULL;
+	VertexAttrib4fProc vertexAttrib4f = NULL;
+
+	bool loadShaderProcs()
+	{
+		createShader = (CreateShaderProc)Renderer::getProcAddress("glCreateShader");
+		shaderSource = (ShaderSourceProc)Renderer::getProcAddress("glShaderSource");
+		compileShader = (CompileShaderProc)Renderer::getProcAddress("glCompileShader");
+		getShaderiv = (GetShaderivProc)Renderer::getProcAddress("glGetShaderiv");
+		getShaderInfoLog = (GetInfoLogProc)Renderer::getProcAddress("glGetShaderInfoLog");
+		deleteShader = (DeleteShaderProc)Renderer::getProcAddress("glDeleteShader");
+		createProgram = (CreateProgramProc)Renderer::getProcAddress("glCreateProgram");
+		attachShader = (AttachShaderProc)Renderer::getProcAddress("glAttachShader");
+		bindAttribLocation = (BindAttribLocationProc)Renderer::getProcAddress("glBindAttribLocation");
+		linkProgram = (LinkProgramProc)Renderer::getProcAddress("glLinkProgram");
+		getProgramiv = (GetProgramivProc)Renderer::getProcAddress("glGetProgramiv");
+		getProgramInfoLog = (GetInfoLogProc)Renderer::getProcAddress("glGetProgramInfoLog");
+		deleteProgram = (DeleteProgramProc)Renderer::getProcAddress("glDeleteProgram");
+		useProgram = (UseProgramProc)Renderer::getProcAddress("glUseProgram");
+		getUniformLocation = (GetUniformLocationProc)Renderer::getProcAddress("glGetUniformLocation");
+		uniform1i = (Uniform1iProc)Renderer::getProcAddress("glUniform1i");
+		uniformMatrix4fv = (UniformMatrix4fvProc)Renderer::getProcAddress("glUniformMatrix4fv");
+		enableVertexAttribArray = (VertexAttribArrayProc)Renderer::getProcAddress("glEnableVertexAttribArray");
+		disableVertexAttribArray = (VertexAttribArrayProc)Renderer::getProcAddress("glDisableVertexAttribArray");
+		vertexAttribPointer = (VertexAttribPointerProc)Renderer::getProcAddress("glVertexAttribPointer");
+		vertexAttrib4f = (VertexAttrib4fProc)Renderer::getProcAddress("glVertexAttrib4f");
+
+		return createShader && shaderSource && compileShader && getShaderiv && getShaderInfoLog && deleteShader &&
+			createProgram && attachShader && bindAttribLocation && linkProgram && getProgramiv && getProgramInfoLog &&
+			deleteProgram && useProgram && getUniformLocation && uniform1i && uniformMatrix4fv &&
+			enableVertexAttribArray && disableVertexAttribArray && vertexAttribPointer && vertexAttrib4f;
+	}
+
+	GLuint compileShaderSource(GLenum type, const char* source)
+	{
+		GLuint shader = createShader(type);
+		shaderSource(shader, 1, &source, NULL);
+		compileShader(shader);
+
+		GLint ok = GL_FALSE;
+		getShaderiv(shader, GL_COMPILE_STATUS, &ok);
+		if(!ok)
+		{
+			char log[1024] = { 0 };
+			getShaderInfoLog(shader, sizeof(log) - 1, NULL, log);
+			LOG(LogError) << "Couldn't compile shader: " << log;
+			deleteShader(shader);
+			return 0;
+		}
+
+		return shader;
+	}
+
+	bool linkShaderProgram(Program& program, GLuint vertexShader, const char* fragmentSource)
+	{
+		GLuint fragmentShader = compileShaderSource(GL_FRAGMENT_SHADER, fragmentSource);
+		if(!fragmentShader)
+			return false;
+
+		program.id = createProgram();
+		attachShader(program.id, vertexShader);
+		attachShader(program.id, fragmentShader);
+		bindAttribLocation(program.id, ATTRIB_POSITION, "aPosition");
+		bindAttribLocation(program.id, ATTRIB_TEXCOORD, "aTexCoord");
+		bindAttribLocation(program.id, ATTRIB_COLOR, "aColor");
+		linkProgram(program.id);
+
+		// the program keeps what it needs
+		deleteShader(fragmentShader);
+
+		GLint ok = GL_FALSE;
+		getProgramiv(program.id, GL_LINK_STATUS, &ok);
+		if(!ok)
+		{
+			char log[1024] = { 0 };
+			getProgramInfoLog(program.id, sizeof(log) - 1, NULL, log);
+			LOG(LogError) << "Couldn't link shader program: " << log;
+			deleteProgram(program.id);
+			program.id = 0;
+			return false;
+		}
+
+		program.matrixLocation = getUniformLocation(program.id, "uMatrix");
+		program.matrixSerial = 0;
+
+		GLint textureLocation = getUniformLocation(program.id, "uTexture");
+		if(textureLocation != -1)
+		{
+			useProgram(program.id);
+			uniform1i(textureLocation, 0);
+			useProgram(0);
+		}
+
+		return true;
+	}
+
+	bool initShaders()
+	{
+		if(!Settings::getInstance()->getBool("ShaderRenderer"))
+			return false;
+
+		if(!loadShaderProcs())
+		{
+			LOG(LogInfo) << "No GL 2.0 shader support, using the fixed-function renderer";
+			return false;
+		}
+
+		GLuint vertexShader = compileShaderSource(GL_VERTEX_SHADER, vertexShaderSource);
+		if(!vertexShader)
+			return false;
+
+		colorProgram.id = textureProgram.id = alphaTextureProgram.id = distanceFieldProgram.id = 0;
+		const bool ok = linkShaderProgram(colorProgram, vertexShader, colorFragmentSource) &&
+			linkShaderProgram(textureProgram, vertexShader, textureFragmentSource) &&
+			linkShaderProgram(alphaTextureProgram, vertexShader, alphaTextureFragmentSource) &&
+			linkShaderProgram(distanceFieldProgram, vertexShader, distanceFieldFragmentSource);
+		deleteShader(vertexShader);
+
+		if(!ok)
+		{
+			Program* programs[4] = { &colorProgram, &textureProgram, &alphaTextureProgram, &distanceFieldProgram };
+			for(int i = 0; i < 4; i++)
+			{
+				if(programs[i]->id)
+					deleteProgram(programs[i]->id);
+				programs[i]->id = 0;
+			}
+
+			LOG(LogWarning) << "Falling back to the fixed-function renderer";
+			return false;
+		}
+
+		currentProgram = 0;
+		LOG(LogInfo) << "Using the shader renderer";
+		return true;
+	}
+#else
+	// GLES 1 is fixed-function only
+	#define enableVertexAttribArray(index)
+	#define disableVertexAttribArray(index)
+	#define vertexAttribPointer(index, size, type, normalized, stride, pointer)
+	#define vertexAttrib4f(index, x, y, z, w)
+
+	bool initShaders()
+	{
+		return false;
+	}
+#endif
+
+	bool usingShaders()
+	{
+		if(shaderState == -1)
+			shaderState = initShaders() ? 1 : 0;
+		return shaderState == 1;
+	}
+
+#ifdef USE_OPENGL_DESKTOP
+	void useShaderProgram()
+	{
+		Program& program = stateTexture2D != 1 ? colorProgram :
+			(stateDistanceField ? distanceFieldProgram : (stateAlphaTexture ? alphaTextureProgram : textureProgram));
+
+		if(currentProgram != program.id)
+		{
+			useProgram(program.id);
+			currentProgram = program.id;
+		}else{
+			elidedStateChanges++;
+		}
+
+		if(program.matrixSerial != matrixSerial)
+		{
+			// same as glOrtho(0, w, h, 0, -1, 1) in init()
+			Eigen::Matrix4f projection = Eigen::Matrix4f::Identity();
+			projection(0, 0) = 2.0f / getViewWidth();
+			projection(1, 1) = -2.0f / getViewHeight();
+			projection(2, 2) = -1.0f;
+			projection(0, 3) = -1.0f;
+			projection(1, 3) = 1.0f;
+
+			const Eigen::Matrix4f matrix = projection * Eigen::Map<Eigen::Matrix4f>(modelView);
+			uniformMatrix4fv(program.matrixLocation, 1, GL_FALSE, matrix.data());
+			program.matrixSerial = matrixSerial;
+		}
+	}
+#endif
+
+	void setCapability(GLenum cap, int& state, bool enabled)
+	{
+		if(state == (int)enabled)
+		{
+			elidedStateChanges++;
+			return;
+		}
+
+		if(enabled)
+			glEnable(cap);
+		else
+			glDisable(cap);
+		state = enabled;
+	}
+
+	void setClientArray(GLenum array, GLuint attrib, int& state, bool enabled)
+	{
+		if(state == (int)enabled)
+		{
+			elidedStateChanges++;
+			return;
+		}
+
+		if(usingShaders())
+		{
+			if(enabled)
+				enableVertexAttribArray(attrib);
+			else
+				disableVertexAttribArray(attrib);
+		}else{
+			if(enabled)
+				glEnableClientState(array);
+			else
+				glDisableClientState(array);
+		}
+		state = enabled;
+	}
+
+	void setTextureEnabled(bool enabled, bool alphaOnly, bool distanceField)
+	{
+		flushPendingQuads();
+
+		stateAlphaTexture = alphaOnly;
+		stateDistanceField = alphaOnly && distanceField;
+
+		// shaders pick a program instead
+		if(usingShaders())
+		{
+			stateTexture2D = enabled;
+			return;
+		}
+
+		setCapability(GL_TEXTURE_2D, stateTexture2D, enabled);
+
+		// no smoothing without shaders, just a hard edge where the distance crosses 0.5
+		const bool alphaTest = enabled && stateDistanceField;
+		if(alphaTest && stateAlphaTest != 1)
+			glAlphaFunc(GL_GEQUAL, 0.5f);
+		setCapability(GL_ALPHA_TEST, stateAlphaTest, alphaTest);
+	}
+
+	void setBlendEnabled(bool enabled)
+	{
+		flushPendingQuads();
+
+		setCapability(GL_BLEND, stateBlend, enabled);
+	}
+
+	void setBlendFunc(GLenum sfactor, GLenum dfactor)
+	{
+		flushPendingQuads();
+
+		if(stateBlendFuncKnown && stateBlendSrc == sfactor && stateBlendDst == dfactor)
+		{
+			elidedStateChanges++;
+			return;
+		}
+
+		// in a render target the alpha channel is what the result gets blended onto the screen with later,
+		// it has to build up as "over" whatever the colours do
+		if(!targetStack.empty())
+			blendFuncSeparate(sfactor, dfactor, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+		else
+			glBlendFunc(sfactor, dfactor);
+		stateBlendFuncKnown = true;
+		stateBlendSrc = sfactor;
+		stateBlendDst = dfactor;
+	}
+
+	void setClientArrays(bool vertices, bool texCoords, bool colors)
+	{
+		flushPendingQuads();
+
+		setClientArray(GL_VERTEX_ARRAY, ATTRIB_POSITION, stateVertexArray, vertices);
+		setClientArray(GL_TEXTURE_COORD_ARRAY, ATTRIB_TEXCOORD, stateTexCoordArray, texCoords);
+		setClientArray(GL_COLOR_ARRAY, ATTRIB_COLOR, stateColorArray, colors);
+	}
+
+	void setConstantColor(unsigned int color)
+	{
+		flushPendingQuads();
+
+		const GLubyte r = (color >> 24) & 0xFF, g = (color >> 16) & 0xFF, b = (color >> 8) & 0xFF, a = color & 0xFF;
+		if(usingShaders())
+			vertexAttrib4f(ATTRIB_COLOR, r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f);
+		else
+			glColor4ub(r, g, b, a);
+	}
+
+	void vertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+	{
+		flushPendingQuads();
+
+		if(usingShaders())
+			vertexAttribPointer(ATTRIB_POSITION, size, type, GL_FALSE, stride, pointer);
+		else
+			glVertexPointer(size, type, stride, pointer);
+	}
+
+	void texCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+	{
+		flushPendingQuads();
+
+		if(usingShaders())
+			vertexAttribPointer(ATTRIB_TEXCOORD, size, type, GL_FALSE, stride, pointer);
+		else
+			glTexCoordPointer(size, type, stride, pointer);
+	}
+
+	void colorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+	{
+		flushPendingQuads();
+
+		if(usingShaders())
+			vertexAttribPointer(ATTRIB_COLOR, size, type, GL_TRUE, stride, pointer);
+		else
+			glColorPointer(size, type, stride, pointer);
+	}
+
+	void drawArrays(GLenum mode, GLint first, GLsizei count)
+	{
+		flushPendingQuads();
+
+#ifdef USE_OPENGL_DESKTOP
+		if(usingShaders())
+			useShaderProgram();
+#endif
+		glDrawArrays(mode, first, count);
+		frameStats.drawCalls++;
+	}
+
+	void flush()
+	{
+		flushPendingQuads();
+
+		glFlush();
+	}
+
+	const FrameStats& getFrameStats()
+	{
+		return frameStats;
+	}
+
+	void resetFrameStats()
+	{
+		frameStats.drawCalls = 0;
+		frameStats.textureUploads = 0;
+	}
+
+	void countTextureUpload()
+	{
+		frameStats.textureUploads++;
+	}
+
+	void bindTexture(GLuint textureID)
+	{
+		flushPendingQuads();
+
+		if(stateTextureKnown && stateTexture == textureID)
+		{
+			elidedStateChanges++;
+			return;
+		}
+
+		glBindTexture(GL_TEXTURE_2D, textureID);
+		stateTextureKnown = true;
+		stateTexture = textureID;
+	}
+
+	void deleteTexture(GLuint textureID)
+	{
+		flushPendingQuads();
+
+		// GL falls back to texture 0 when the bound texture is deleted
+		if(stateTextureKnown && stateTexture == textureID)
+			stateTexture = 0;
+
+		glDeleteTextures(1, &textureID);
+	}
+
+#ifdef USE_OPENGL_DESKTOP
+	// GL 2.1 / ARB_pixel_buffer_object, and GL 3.2 / ARB_sync for the fences (without those, orphaning the buffer is enough to be safe)
+	#define UPLOAD_PIXEL_UNPACK_BUFFER 0x88EC
+	#define UPLOAD_WRITE_ONLY 0x88B9
+	#define UPLOAD_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+	#define UPLOAD_TIMEOUT_EXPIRED 0x911B
+	#define UPLOAD_WAIT_FAILED 0x911D
+
+	typedef void* (APIENTRY *MapBufferProc)(GLenum target, GLenum access);
+	typedef GLboolean (APIENTRY *UnmapBufferProc)(GLenum target);
+	typedef void* (APIENTRY *FenceSyncProc)(GLenum condition, GLbitfield flags);
+	typedef GLenum (APIENTRY *ClientWaitSyncProc)(void* sync, GLbitfield flags, unsigned long long timeout);
+	typedef void (APIENTRY *DeleteSyncProc)(void* sync);
+
+	MapBufferProc mapBuffer = NULL;
+	UnmapBufferProc unmapBuffer = NULL;
+	FenceSyncProc fenceSync = NULL;
+	ClientWaitSyncProc clientWaitSync = NULL;
+	DeleteSyncProc deleteSync = NULL;
+
+	struct UploadBuffer
+	{
+		GLuint id;
+		unsigned int context;
+		void* fence; // the last upload from it, NULL once it's done (or without fences)
+	};
+	UploadBuffer uploadBuffers[UPLOAD_BUFFER_COUNT];
+	int pixelBufferSupport = -1; // -1 until checked, resetState() makes the next context check again
+
+	bool pixelBuffersSupported()
+	{
+		int& supported = pixelBufferSupport;
+		if(supported == -1)
+		{
+			supported = 0;
+
+			int major = 0, minor = 0;
+			const char* version = (const char*)glGetString(GL_VERSION);
+			const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+			if(version)
+				sscanf(version, "%d.%d", &major, &minor);
+			const bool hasPBO = major > 2 || (major == 2 && minor >= 1) || 
+				(extensions && (strstr(extensions, "GL_ARB_pixel_buffer_object") || strstr(extensions, "GL_EXT_pixel_buffer_object")));
+
+			mapBuffer = (MapBufferProc)Renderer::getProcAddress("glMapBuffer");
+			unmapBuffer = (UnmapBufferProc)Renderer::getProcAddress("glUnmapBuffer");
+			if(hasPBO && buffersSupported() && mapBuffer && unmapBuffer)
+			{
+				supported = 1;
+				memset(uploadBuffers, 0, sizeof(uploadBuffers));
+
+				// the loader hands out entry points the driver can't back, so the version or extension has to say so too
+				const bool hasSync = major > 3 || (major == 3 && minor >= 2) || (extensions && strstr(extensions, "GL_ARB_sync"));
+				fenceSync = hasSync ? (FenceSyncProc)Renderer::getProcAddress("glFenceSync") : NULL;
+				clientWaitSync = hasSync ? (ClientWaitSyncProc)Renderer::getProcAddress("glClientWaitSync") : NULL;
+				deleteSync = hasSync ? (DeleteSyncProc)Renderer::getProcAddress("glDeleteSync") : NULL;
+				if(!fenceSync || !clientWaitSync || !deleteSync)
+					fenceSync = NULL;
+			}
+		}
+
+		return supported == 1;
+	}
+
+	// a buffer nothing is reading from any more, NULL if they're all busy
+	UploadBuffer* getUploadBuffer()
+	{
+		for(int i = 0; i < UPLOAD_BUFFER_COUNT; i++)
+		{
+			UploadBuffer& buffer = uploadBuffers[i];
+
+			// went with the old context
+			if(buffer.id != 0 && buffer.context != contextSerial)
+			{
+				buffer.id = 0;
+				buffer.fence = NULL;
+			}
+
+			if(buffer.fence != NULL)
+			{
+				const GLenum status = clientWaitSync(buffer.fence, 0, 0);
+				if(status == UPLOAD_TIMEOUT_EXPIRED)
+					continue;
+				deleteSync(buffer.fence);
+				buffer.fence = NULL;
+			}
+
+			if(buffer.id == 0)
+			{
+				genBuffers(1, &buffer.id);
+				buffer.context = contextSerial;
+			}
+			return &buffer;
+		}
+		return NULL;
+	}
+
+	// copies pixels into a pixel buffer and binds it, false (with nothing bound) if that's not possible or not worth it
+	bool beginBufferedUpload(GLsizei width, GLsizei height, GLenum format, const void* pixels, UploadBuffer*& buffer)
+	{
+		const size_t size = (size_t)width * height * (format == GL_ALPHA ? 1 : 4);
+		if(pixels == NULL || size < UPLOAD_BUFFER_MIN_SIZE || !pixelBuffersSupported())
+			return false;
+
+		buffer = getUploadBuffer();
+		if(buffer == NULL)
+			return false;
+
+		bindBuffer(UPLOAD_PIXEL_UNPACK_BUFFER, buffer->id);
+		bufferData(UPLOAD_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW); // orphan whatever was there
+		void* dest = mapBuffer(UPLOAD_PIXEL_UNPACK_BUFFER, UPLOAD_WRITE_ONLY);
+		if(dest == NULL)
+		{
+			bindBuffer(UPLOAD_PIXEL_UNPACK_BUFFER, 0);
+			return false;
+		}
+
+		memcpy(dest, pixels, size);
+		if(!unmapBuffer(UPLOAD_PIXEL_UNPACK_BUFFER))
+		{
+			// the contents were lost (e.g. a mode switch), upload the normal way
+			bindBuffer(UPLOAD_PIXEL_UNPACK_BUFFER, 0);
+			return false;
+		}
+		return true;
+	}
+
+	void endBufferedUpload(UploadBuffer* buffer)
+	{
+		if(fenceSync)
+			buffer->fence = fenceSync(UPLOAD_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		bindBuffer(UPLOAD_PIXEL_UNPACK_BUFFER, 0);
+	}
+
+	void texImage2D(GLsizei width, GLsizei height, GLenum format, const void* pixels)
+	{
+		UploadBuffer* buffer = NULL;
+		if(beginBufferedUpload(width, height, format, pixels, buffer))
+		{
+			glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, NULL);
+			endBufferedUpload(buffer);
+		}else{
+			glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, pixels);
+		}
+		countTextureUpload();
+	}
+
+	void texSubImage2D(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, const void* pixels)
+	{
+		UploadBuffer* buffer = NULL;
+		if(beginBufferedUpload(width, height, format, pixels, buffer))
+		{
+			glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, format, GL_UNSIGNED_BYTE, NULL);
+			endBufferedUpload(buffer);
+		}else{
+			glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, format, GL_UNSIGNED_BYTE, pixels);
+		}
+		countTextureUpload();
+	}
+#else
+	// no pixel buffer objects before GLES 3
+	void texImage2D(GLsizei width, GLsizei height, GLenum format, const void* pixels)
+	{
+		glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, pixels);
+		countTextureUpload();
+	}
+
+	void texSubImage2D(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, const void* pixels)
+	{
+		glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, format, GL_UNSIGNED_BYTE, pixels);
+		countTextureUpload();
+	}
+#endif
+
+	void bindArrayBuffer(GLuint buffer)
+	{
+		if(stateArrayBufferKnown && stateArrayBuffer == buffer)
+		{
+			elidedStateChanges++;
+			return;
+		}
+
+		bindBuffer(GL_ARRAY_BUFFER, buffer);
+		stateArrayBufferKnown = true;
+		stateArrayBuffer = buffer;
+	}
+
+	void useClientArrays()
+	{
+		flushPendingQuads();
+
+		if(buffersSupported())
+			bindArrayBuffer(0);
+	}
+
+	VertexBuffer::VertexBuffer() : mId(0), mContext(0), mSize(0), mDirty(true)
+	{
+	}
+
+	VertexBuffer::VertexBuffer(const VertexBuffer& other) : mId(0), mContext(0), mSize(0), mDirty(true)
+	{
+	}
+
+	VertexBuffer& VertexBuffer::operator=(const VertexBuffer& other)
+	{
+		if(this != &other)
+		{
+			release();
+			mDirty = true;
+		}
+		return *this;
+	}
+
+	VertexBuffer::~VertexBuffer()
+	{
+		release();
+	}
+
+	void VertexBuffer::release()
+	{
+		// if the context it was made in is gone, so is the buffer
+		if(mId != 0 && mContext == contextSerial)
+		{
+			if(stateArrayBufferKnown && stateArrayBuffer == mId)
+				stateArrayBuffer = 0;
+			deleteBuffers(1, &mId);
+		}
+		mId = 0;
+		mSize = 0;
+	}
+
+	const char* VertexBuffer::use(const void* data, size_t size)
+	{
+		flushPendingQuads();
+
+		if(!buffersSupported())
+			return (const char*)data;
+
+		if(mId != 0 && mContext != contextSerial)
+		{
+			mId = 0;
+			mSize = 0;
+		}
+
+		if(mId == 0)
+		{
+			genBuffers(1, &mId);
+			mContext = contextSerial;
+			mDirty = true;
+		}
+
+		bindArrayBuffer(mId);
+		if(mDirty)
+		{
+			// same size, update the storage it has in place
+			if(size == mSize)
+				bufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+			else
+				bufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+			mSize = size;
+			mDirty = false;
+		}
+
+		return NULL;
+	}
+
+	const char* streamVertices(const void* data, size_t size)
+	{
+		flushPendingQuads();
+
+		if(!buffersSupported() || size > STREAM_BUFFER_SIZE)
+		{
+			useClientArrays();
+			return (const char*)data;
+		}
+
+		if(streamBuffer != 0 && streamContext != contextSerial)
+			streamBuffer = 0;
+
+		if(streamBuffer == 0)
+		{
+			genBuffers(1, &streamBuffer);
+			streamContext = contextSerial;
+			bindArrayBuffer(streamBuffer);
+			bufferData(GL_ARRAY_BUFFER, STREAM_BUFFER_SIZE, NULL, STREAM_BUFFER_USAGE);
+			streamOffset = 0;
+		}else{
+			bindArrayBuffer(streamBuffer);
+		}
+
+		if(streamOffset + size > STREAM_BUFFER_SIZE)
+		{
+			// start over in fresh storage, the driver keeps the old one around until the draws using it are done
+			bufferData(GL_ARRAY_BUFFER, STREAM_BUFFER_SIZE, NULL, STREAM_BUFFER_USAGE);
+			streamOffset = 0;
+		}
+
+		bufferSubData(GL_ARRAY_BUFFER, streamOffset, size, data);
+
+		const char* base = (const char*)NULL + streamOffset;
+		streamOffset += (size + 15) & ~15;
+		return base;
+	}
+
+	void resetState()
+	{
+		stateTexture2D = -1;
+		stateBlend = -1;
+		stateAlphaTest = -1;
+		stateVertexArray = -1;
+		stateTexCoordArray = -1;
+		stateColorArray = -1;
+		stateBlendFuncKnown = false;
+		stateTextureKnown = false;
+		stateArrayBufferKnown = false;
+		contextSerial++;
+
+		// whatever they were going to be drawn to is gone
+		quadVertices.clear();
+
+		// programs went with the old context
+		shaderState = -1;
+		currentProgram = 0;
+
+#ifdef USE_OPENGL_DESKTOP
+		// the next context may be a different driver or version, and the fences went with this one
+		pixelBufferSupport = -1;
+#endif
+	}
+
+	unsigned int getElidedStateChanges()
+	{
+		return elidedStateChanges;
+	}
+
+	unsigned int getContextSerial()
+	{
+		return contextSerial;
+	}
+
 	void setColor4bArray(GLubyte* array, unsigned int color)
 	{
 		array[0] = (color & 0xff000000) >> 24;
@@ -31,17 +1077,19 @@ namespace Renderer {
 
 	void pushClipRect(Eigen::Vector2i pos, Eigen::Vector2i dim)
 	{
+		flushPendingQuads();
+
 		Eigen::Vector4i box(pos.x(), pos.y(), dim.x(), dim.y());
 		if(box[2] == 0)
-			box[2] = Renderer::getScreenWidth() - box.x();
+			box[2] = getViewWidth() - box.x();
 		if(box[3] == 0)
-			box[3] = Renderer::getScreenHeight() - box.y();
+			box[3] = getViewHeight() - box.y();
 
 		//glScissor starts at the bottom left of the window
 		//so (0, 0, 1, 1) is the bottom left pixel
 		//everything else uses y+ = down, so flip it to be consistent
-		//rect.pos.y = Renderer::getScreenHeight() - rect.pos.y - rect.size.y;
-		box[1] = Renderer::getScreenHeight() - box.y() - box[3];
+		//rect.pos.y = getViewHeight() - rect.pos.y - rect.size.y;
+		box[1] = getViewHeight() - box.y() - box[3];
 
 		//make sure the box fits within clipStack.top(), and clip further accordingly
 		if(clipStack.size())
@@ -63,12 +1111,14 @@ namespace Renderer {
 			box[3] = 0;
 
 		clipStack.push(box);
-		glScissor(box[0], box[1], box[2], box[3]);
+		applyScissor(box);
 		glEnable(GL_SCISSOR_TEST);
 	}
 
 	void popClipRect()
 	{
+		flushPendingQuads();
+
 		if(clipStack.empty())
 		{
 			LOG(LogError) << "Tried to popClipRect while the stack was empty!";
@@ -80,8 +1130,183 @@ namespace Renderer {
 		{
 			glDisable(GL_SCISSOR_TEST);
 		}else{
-			Eigen::Vector4i top = clipStack.top();
-			glScissor(top[0], top[1], top[2], top[3]);
+			applyScissor(clipStack.top());
+		}
+	}
+
+	Eigen::Vector4i getClipRect()
+	{
+		if(clipStack.empty())
+			return Eigen::Vector4i(0, 0, getViewWidth(), getViewHeight());
+
+		// the stack is in glScissor's coordinates, flip it back
+		const Eigen::Vector4i& top = clipStack.top();
+		return Eigen::Vector4i(top[0], getViewHeight() - top[1] - top[3], top[2], top[3]);
+	}
+
+	bool renderTargetsSupported()
+	{
+		static int supported = -1;
+		if(supported == -1)
+		{
+			genFramebuffers = (GenFramebuffersProc)getExtensionProc("glGenFramebuffers");
+			deleteFramebuffers = (DeleteFramebuffersProc)getExtensionProc("glDeleteFramebuffers");
+			bindFramebuffer = (BindFramebufferProc)getExtensionProc("glBindFramebuffer");
+			framebufferTexture2D = (FramebufferTexture2DProc)getExtensionProc("glFramebufferTexture2D");
+			checkFramebufferStatus = (CheckFramebufferStatusProc)getExtensionProc("glCheckFramebufferStatus");
+			blendFuncSeparate = (BlendFuncSeparateProc)getExtensionProc("glBlendFuncSeparate");
+
+			supported = (genFramebuffers && deleteFramebuffers && bindFramebuffer && framebufferTexture2D &&
+				checkFramebufferStatus && blendFuncSeparate) ? 1 : 0;
+			if(!supported)
+				LOG(LogWarning) << "Framebuffer objects aren't available, cached components are drawn directly";
+		}
+
+		return supported == 1;
+	}
+
+	// points viewport and projection at the innermost target (or the screen) after one was bound or unbound
+	void applyView()
+	{
+		const int width = getViewWidth();
+		const int height = getViewHeight();
+		if(targetStack.empty())
+			glViewport(0, 0, width, height);
+		else
+			glViewport(0, 0, targetStack.back()->getPixelWidth(), targetStack.back()->getPixelHeight());
+
+		glMatrixMode(GL_PROJECTION);
+		glLoadIdentity();
+		glOrtho(0, width, height, 0, -1.0, 1.0);
+		glMatrixMode(GL_MODELVIEW);
+
+		// the shaders build their projection from the view size along with the matrix
+		matrixSerial++;
+
+		// blending is set up differently in targets
+		stateBlendFuncKnown = false;
+	}
+
+	RenderTarget::RenderTarget() : mFramebuffer(0), mTexture(0), mWidth(0), mHeight(0), mScale(1), mPixelWidth(0), mPixelHeight(0), mContext(0)
+	{
+	}
+
+	RenderTarget::~RenderTarget()
+	{
+		release();
+	}
+
+	void RenderTarget::release()
+	{
+		// if the context they were made in is gone, so are they
+		if(mContext == contextSerial)
+		{
+			if(mFramebuffer != 0)
+				deleteFramebuffers(1, &mFramebuffer);
+			if(mTexture != 0)
+				deleteTexture(mTexture);
+		}
+		mFramebuffer = 0;
+		mTexture = 0;
+		mWidth = 0;
+		mHeight = 0;
+		mPixelWidth = 0;
+		mPixelHeight = 0;
+	}
+
+	GLuint RenderTarget::getTexture() const
+	{
+		return mContext == contextSerial ? mTexture : 0;
+	}
+
+	bool RenderTarget::begin(int width, int height, float scale)
+	{
+		flushPendingQuads();
+
+		if(!renderTargetsSupported() || width <= 0 || height <= 0)
+			return false;
+
+		if(scale <= 0)
+			scale = getViewScale();
+		const int pixelWidth = std::max(1, (int)ceil(width * scale));
+		const int pixelHeight = std::max(1, (int)ceil(height * scale));
+
+		if(mContext != contextSerial || mWidth != width || mHeight != height || mPixelWidth != pixelWidth || mPixelHeight != pixelHeight)
+		{
+			release();
+
+			// pixel for pixel unless it's scaled
+			const GLint filter = (pixelWidth == width && pixelHeight == height) ? GL_NEAREST : GL_LINEAR;
+			glGenTextures(1, &mTexture);
+			bindTexture(mTexture);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, pixelWidth, pixelHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+
+			genFramebuffers(1, &mFramebuffer);
+			bindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+			framebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexture, 0);
+
+			mContext = contextSerial;
+			mWidth = width;
+			mHeight = height;
+			mPixelWidth = pixelWidth;
+			mPixelHeight = pixelHeight;
+
+			if(checkFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+			{
+				LOG(LogWarning) << "Couldn't make a " << pixelWidth << "x" << pixelHeight << " render target";
+				release();
+				bindFramebuffer(GL_FRAMEBUFFER, targetStack.empty() ? 0 : targetStack.back()->mFramebuffer);
+				return false;
+			}
+		}else{
+			bindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+		}
+
+		mScale = scale;
+		targetStack.push_back(this);
+		applyView();
+
+		// clip rects pushed outside are in the wrong coordinates in here
+		suspendedClipStacks.push_back(std::stack<Eigen::Vector4i>());
+		suspendedClipStacks.back().swap(clipStack);
+		glDisable(GL_SCISSOR_TEST);
+
+		GLfloat clearColor[4];
+		glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+		glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+		glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+
+		return true;
+	}
+
+	void RenderTarget::end()
+	{
+		flushPendingQuads();
+
+		if(targetStack.empty() || targetStack.back() != this)
+		{
+			LOG(LogError) << "Tried to end a render target that isn't the innermost one!";
+			return;
+		}
+
+		if(!clipStack.empty())
+			LOG(LogError) << "Render target ended with clip rects still pushed!";
+
+		targetStack.pop_back();
+		bindFramebuffer(GL_FRAMEBUFFER, targetStack.empty() ? 0 : targetStack.back()->mFramebuffer);
+		applyView();
+
+		clipStack.swap(suspendedClipStacks.back());
+		suspendedClipStacks.pop_back();
+		if(!clipStack.empty())
+		{
+			applyScissor(clipStack.top());
+			glEnable(GL_SCISSOR_TEST);
 		}
 	}
 
@@ -92,45 +1317,89 @@ namespace Renderer {
 
 	void drawRect(int x, int y, int w, int h, unsigned int color, GLenum blend_sfactor, GLenum blend_dfactor)
 	{
-#ifdef USE_OPENGL_ES
-		GLshort points[12];
-#else
-		GLint points[12];
-#endif
+		drawQuad(0, (float)x, (float)y, (float)w, (float)h, 0, 0, 0, 0, color, blend_sfactor, blend_dfactor);
+	}
+
+	void drawQuad(GLuint texture, float x, float y, float w, float h, float u1, float v1, float u2, float v2, unsigned int color,
+		GLenum blend_sfactor, GLenum blend_dfactor)
+	{
+		if(texture != quadTexture || blend_sfactor != quadBlendSrc || blend_dfactor != quadBlendDst || quadVertices.size() >= QUAD_BATCH_MAX * 6)
+		{
+			flushQuads();
+			quadTexture = texture;
+			quadBlendSrc = blend_sfactor;
+			quadBlendDst = blend_dfactor;
+		}
 
-		points[0] = x; points [1] = y;
-		points[2] = x; points[3] = y + h;
-		points[4] = x + w; points[5] = y;
+		// x' = m0 x + m4 y + m12, y' = m1 x + m5 y + m13 (column major, z is always 0)
+		const float* m = modelView;
+		const float corners[4][4] = {
+			{ x, y, u1, v1 },
+			{ x, y + h, u1, v2 },
+			{ x + w, y, u2, v1 },
+			{ x + w, y + h, u2, v2 }
+		};
+		static const int order[6] = { 0, 1, 2, 2, 1, 3 };
 
-		points[6] = x + w; points[7] = y;
-		points[8] = x; points[9] = y + h;
-		points[10] = x + w; points[11] = y + h;
+		GLubyte rgba[4];
+		setColor4bArray(rgba, color);
 
-		GLubyte colors[6*4];
-		buildGLColorArray(colors, color, 6);
+		for(int i = 0; i < 6; i++)
+		{
+			const float* c = corners[order[i]];
+			QuadVertex vertex;
+			vertex.position[0] = m[0] * c[0] + m[4] * c[1] + m[12];
+			vertex.position[1] = m[1] * c[0] + m[5] * c[1] + m[13];
+			vertex.texCoord[0] = c[2];
+			vertex.texCoord[1] = c[3];
+			memcpy(vertex.color, rgba, sizeof(rgba));
+			quadVertices.push_back(vertex);
+		}
+	}
 
-		glEnable(GL_BLEND);
-		glBlendFunc(blend_sfactor, blend_dfactor);
-		glEnableClientState(GL_VERTEX_ARRAY);
-		glEnableClientState(GL_COLOR_ARRAY);
+	void flushQuads()
+	{
+		if(quadVertices.empty() || flushingQuads)
+			return;
 
-#ifdef USE_OPENGL_ES
-		glVertexPointer(2, GL_SHORT, 0, points);
-#else
-		glVertexPointer(2, GL_INT, 0, points);
-#endif
-		glColorPointer(4, GL_UNSIGNED_BYTE, 0, colors);
+		flushingQuads = true;
+
+		// the corners went through the matrix already
+		float matrix[16];
+		memcpy(matrix, modelView, sizeof(matrix));
+		static float identity[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+		setMatrix(identity);
+
+		const bool textured = quadTexture != 0;
+		setTextureEnabled(textured);
+		if(textured)
+			bindTexture(quadTexture);
+		setBlendEnabled(true);
+		setBlendFunc(quadBlendSrc, quadBlendDst);
+		setClientArrays(true, textured, true);
+
+		// one stream for everything, a second one could start the ring buffer over under the first
+		const char* base = streamVertices(quadVertices.data(), quadVertices.size() * sizeof(QuadVertex));
+		vertexPointer(2, GL_FLOAT, sizeof(QuadVertex), base + offsetof(QuadVertex, position));
+		if(textured)
+			texCoordPointer(2, GL_FLOAT, sizeof(QuadVertex), base + offsetof(QuadVertex, texCoord));
+		colorPointer(4, GL_UNSIGNED_BYTE, sizeof(QuadVertex), base + offsetof(QuadVertex, color));
 
-		glDrawArrays(GL_TRIANGLES, 0, 6);
+		drawArrays(GL_TRIANGLES, 0, (GLsizei)quadVertices.size());
 
-		glDisable(GL_BLEND);
-		glDisableClientState(GL_VERTEX_ARRAY);
-		glDisableClientState(GL_COLOR_ARRAY);
+		setMatrix(matrix);
+		quadVertices.clear(); // keeps the capacity for the next frame
+		flushingQuads = false;
 	}
 
 	void setMatrix(float* matrix)
 	{
-		glLoadMatrixf(matrix);
+		// kept either way, drawQuad() transforms with it
+		memcpy(modelView, matrix, sizeof(modelView));
+		if(usingShaders())
+			matrixSerial++;
+		else
+			glLoadMatrixf(matrix);
 	}
 
 	void setMatrix(const Eigen::Affine3f& matrix)
@@ -0,0 +1,668 @@
+// As Renderer_init_sdlgl.cpp, but without a windowing system: the context is made with EGL on a GBM surface and every
+// frame is put on the display with a KMS page flip, so ES can run straight from a console on boards that have no X or
+// Wayland (and no SDL video driver that works). Built instead of Renderer_init_sdlgl.cpp with -DKMSDRM=ON.
+// SDL is still used for events, joysticks and audio; keyboards are read from evdev here, since that needs SDL's video.
+
+#include "Renderer.h"
+#include "platform.h"
+#include GLHEADER
+#include <SDL.h>
+#include "Log.h"
+#include "Settings.h"
+
+#include <xf86drm.h>
+#include <xf86drmMode.h>
+#include <gbm.h>
+#include <EGL/egl.h>
+#include <linux/input.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <dlfcn.h>
+#include <dirent.h>
+#include <string.h>
+#include <errno.h>
+#include <string>
+#include <vector>
+#include <thread>
+
+#ifdef USE_OPENGL_ES
+	#define glOrtho glOrthof
+#endif
+
+#define KMSDRM_MAX_CARDS 4
+
+namespace Renderer
+{
+	unsigned int display_width = 0;
+	unsigned int display_height = 0;
+
+	unsigned int getScreenWidth() { return display_width; }
+	unsigned int getScreenHeight() { return display_height; }
+
+	static int drmFd = -1;
+	static uint32_t connectorId = 0;
+	static uint32_t crtcId = 0;
+	static drmModeModeInfo mode;
+	static drmModeCrtc* savedCrtc = NULL; // put back on exit, so the console comes back
+
+	static gbm_device* gbmDevice = NULL;
+	static gbm_surface* gbmSurface = NULL;
+	static gbm_bo* shownBo = NULL; // on the display right now, can't be drawn to until the next flip
+	static bool needsModeset = true;
+
+	static EGLDisplay eglDisplay = EGL_NO_DISPLAY;
+	static EGLContext eglContext = EGL_NO_CONTEXT;
+	static EGLSurface eglSurface = EGL_NO_SURFACE;
+
+	static std::string glExtensions; // " "-padded, for isExtensionSupported()
+
+	// keyboards
+	static std::thread* keyboardThread = NULL;
+	static int keyboardQuitPipe[2] = { -1, -1 };
+
+	static bool openCard()
+	{
+		for(int i = 0; i < KMSDRM_MAX_CARDS; i++)
+		{
+			const std::string path = "/dev/dri/card" + std::to_string(i);
+			const int fd = open(path.c_str(), O_RDWR | O_CLOEXEC);
+			if(fd < 0)
+				continue;
+
+			drmModeRes* resources = drmModeGetResources(fd);
+			if(resources == NULL)
+			{
+				close(fd);
+				continue;
+			}
+
+			// the first connected connector, with the mode asked for or the one it prefers
+			drmModeConnector* connector = NULL;
+			for(int c = 0; c < resources->count_connectors && connector == NULL; c++)
+			{
+				connector = drmModeGetConnector(fd, resources->connectors[c]);
+				if(connector != NULL && (connector->connection != DRM_MODE_CONNECTED || connector->count_modes == 0))
+				{
+					drmModeFreeConnector(connector);
+					connector = NULL;
+				}
+			}
+
+			if(connector == NULL)
+			{
+				drmModeFreeResources(resources);
+				close(fd);
+				continue;
+			}
+
+			int chosen = 0;
+			for(int m = 0; m < connector->count_modes; m++)
+			{
+				const drmModeModeInfo& info = connector->modes[m];
+				if(display_width != 0 && display_height != 0)
+				{
+					if(info.hdisplay == display_width && info.vdisplay == display_height)
+					{
+						chosen = m;
+						break;
+					}
+				}else if(info.type & DRM_MODE_TYPE_PREFERRED)
+				{
+					chosen = m;
+					break;
+				}
+			}
+			mode = connector->modes[chosen];
+
+			// the CRTC the encoder drives already, else the first one it can
+			drmModeEncoder* encoder = connector->encoder_id ? drmModeGetEncoder(fd, connector->encoder_id) : NULL;
+			if(encoder != NULL && encoder->crtc_id)
+			{
+				crtcId = encoder->crtc_id;
+			}else{
+				crtcId = 0;
+				for(int e = 0; e < connector->count_encoders && crtcId == 0; e++)
+				{
+					drmModeEncoder* candidate = drmModeGetEncoder(fd, connector->encoders[e]);
+					if(candidate == NULL)
+						continue;
+					for(int c = 0; c < resources->count_crtcs; c++)
+					{
+						if(candidate->possible_crtcs & (1 << c))
+						{
+							crtcId = resources->crtcs[c];
+							break;
+						}
+					}
+					drmModeFreeEncoder(candidate);
+				}
+			}
+			if(encoder != NULL)
+				drmModeFreeEncoder(encoder);
+
+			connectorId = connector->connector_id;
+			drmModeFreeConnector(connector);
+			drmModeFreeResources(resources);
+
+			if(crtcId == 0)
+			{
+				LOG(LogWarning) << path << " has a display but no CRTC to drive it";
+				close(fd);
+				continue;
+			}
+
+			drmFd = fd;
+			savedCrtc = drmModeGetCrtc(drmFd, crtcId);
+			LOG(LogInfo) << "Using " << path << ", " << mode.hdisplay << "x" << mode.vdisplay << " @ " << mode.vrefresh << "Hz";
+			return true;
+		}
+
+		LOG(LogError) << "No DRM device with a connected display (is another program holding it?)";
+		return false;
+	}
+
+	static bool createContext()
+	{
+		eglDisplay = eglGetDisplay((EGLNativeDisplayType)gbmDevice);
+		if(eglDisplay == EGL_NO_DISPLAY || !eglInitialize(eglDisplay, NULL, NULL))
+		{
+			LOG(LogError) << "Error initializing EGL on GBM (" << std::hex << eglGetError() << std::dec << ")";
+			return false;
+		}
+
+#ifdef USE_OPENGL_ES
+		const EGLint renderableType = EGL_OPENGL_ES_BIT;
+		eglBindAPI(EGL_OPENGL_ES_API);
+#else
+		const EGLint renderableType = EGL_OPENGL_BIT;
+		eglBindAPI(EGL_OPENGL_API);
+#endif
+
+		const EGLint configAttribs[] = {
+			EGL_SURFACE_TYPE, EGL_WINDOW_BIT,
+			EGL_RED_SIZE, 8,
+			EGL_GREEN_SIZE, 8,
+			EGL_BLUE_SIZE, 8,
+			EGL_DEPTH_SIZE, 16,
+			EGL_RENDERABLE_TYPE, renderableType,
+			EGL_NONE
+		};
+
+		// the config has to be the surface's format, EGL is free to put others first
+		EGLint count = 0;
+		eglChooseConfig(eglDisplay, configAttribs, NULL, 0, &count);
+		std::vector<EGLConfig> configs(count);
+		if(count == 0 || !eglChooseConfig(eglDisplay, configAttribs, configs.data(), count, &count))
+		{
+			LOG(LogError) << "No EGL config fits";
+			return false;
+		}
+
+		EGLConfig config = NULL;
+		for(int i = 0; i < count && config == NULL; i++)
+		{
+			EGLint visual = 0;
+			if(eglGetConfigAttrib(eglDisplay, configs[i], EGL_NATIVE_VISUAL_ID, &visual) && visual == GBM_FORMAT_XRGB8888)
+				config = configs[i];
+		}
+		if(config == NULL)
+		{
+			LOG(LogError) << "No EGL config is XRGB8888";
+			return false;
+		}
+
+#ifdef USE_OPENGL_ES
+		const EGLint contextAttribs[] = { EGL_CONTEXT_CLIENT_VERSION, 1, EGL_NONE };
+#else
+		const EGLint contextAttribs[] = { EGL_NONE };
+#endif
+		eglContext = eglCreateContext(eglDisplay, config, EGL_NO_CONTEXT, contextAttribs);
+		eglSurface = eglCreateWindowSurface(eglDisplay, config, (EGLNativeWindowType)gbmSurface, NULL);
+		if(eglContext == EGL_NO_CONTEXT || eglSurface == EGL_NO_SURFACE || !eglMakeCurrent(eglDisplay, eglSurface, eglSurface, eglContext))
+		{
+			LOG(LogError) << "Error creating the EGL context (" << std::hex << eglGetError() << std::dec << ")";
+			return false;
+		}
+
+		const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+		glExtensions = " " + std::string(extensions ? extensions : "") + " ";
+		return true;
+	}
+
+	static void destroyFramebuffer(gbm_bo* bo, void* data)
+	{
+		const uint32_t fb = (uint32_t)(uintptr_t)data;
+		if(fb)
+			drmModeRmFB(drmFd, fb);
+	}
+
+	// the framebuffer scanning out bo, made the first time GBM hands it to us and kept with it
+	static uint32_t getFramebuffer(gbm_bo* bo)
+	{
+		const uint32_t existing = (uint32_t)(uintptr_t)gbm_bo_get_user_data(bo);
+		if(existing)
+			return existing;
+
+		uint32_t fb = 0;
+		if(drmModeAddFB(drmFd, gbm_bo_get_width(bo), gbm_bo_get_height(bo), 24, 32, gbm_bo_get_stride(bo), gbm_bo_get_handle(bo).u32, &fb) != 0)
+		{
+			LOG(LogError) << "drmModeAddFB failed: " << strerror(errno);
+			return 0;
+		}
+		gbm_bo_set_user_data(bo, (void*)(uintptr_t)fb, destroyFramebuffer);
+		return fb;
+	}
+
+	static void onPageFlip(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void* data)
+	{
+		*(bool*)data = false;
+	}
+
+	// keyboards ---------------------------------------------------------------------------------------------------------
+
+	static SDL_Keycode toKeycode(int code)
+	{
+		if(code >= KEY_1 && code <= KEY_9)
+			return SDLK_1 + (code - KEY_1);
+
+		switch(code)
+		{
+		case KEY_0: return SDLK_0;
+		case KEY_Q: return SDLK_q; case KEY_W: return SDLK_w; case KEY_E: return SDLK_e; case KEY_R: return SDLK_r;
+		case KEY_T: return SDLK_t; case KEY_Y: return SDLK_y; case KEY_U: return SDLK_u; case KEY_I: return SDLK_i;
+		case KEY_O: return SDLK_o; case KEY_P: return SDLK_p; case KEY_A: return SDLK_a; case KEY_S: return SDLK_s;
+		case KEY_D: return SDLK_d; case KEY_F: return SDLK_f; case KEY_G: return SDLK_g; case KEY_H: return SDLK_h;
+		case KEY_J: return SDLK_j; case KEY_K: return SDLK_k; case KEY_L: return SDLK_l; case KEY_Z: return SDLK_z;
+		case KEY_X: return SDLK_x; case KEY_C: return SDLK_c; case KEY_V: return SDLK_v; case KEY_B: return SDLK_b;
+		case KEY_N: return SDLK_n; case KEY_M: return SDLK_m;
+		case KEY_SPACE: return SDLK_SPACE;
+		case KEY_MINUS: return SDLK_MINUS;
+		case KEY_EQUAL: return SDLK_EQUALS;
+		case KEY_LEFTBRACE: return SDLK_LEFTBRACKET;
+		case KEY_RIGHTBRACE: return SDLK_RIGHTBRACKET;
+		case KEY_SEMICOLON: return SDLK_SEMICOLON;
+		case KEY_APOSTROPHE: return SDLK_QUOTE;
+		case KEY_GRAVE: return SDLK_BACKQUOTE;
+		case KEY_BACKSLASH: return SDLK_BACKSLASH;
+		case KEY_COMMA: return SDLK_COMMA;
+		case KEY_DOT: return SDLK_PERIOD;
+		case KEY_SLASH: return SDLK_SLASH;
+		case KEY_ENTER: return SDLK_RETURN;
+		case KEY_KPENTER: return SDLK_KP_ENTER;
+		case KEY_ESC: return SDLK_ESCAPE;
+		case KEY_BACKSPACE: return SDLK_BACKSPACE;
+		case KEY_TAB: return SDLK_TAB;
+		case KEY_UP: return SDLK_UP;
+		case KEY_DOWN: return SDLK_DOWN;
+		case KEY_LEFT: return SDLK_LEFT;
+		case KEY_RIGHT: return SDLK_RIGHT;
+		case KEY_PAGEUP: return SDLK_PAGEUP;
+		case KEY_PAGEDOWN: return SDLK_PAGEDOWN;
+		case KEY_HOME: return SDLK_HOME;
+		case KEY_END: return SDLK_END;
+		case KEY_INSERT: return SDLK_INSERT;
+		case KEY_DELETE: return SDLK_DELETE;
+		case KEY_LEFTSHIFT: return SDLK_LSHIFT;
+		case KEY_RIGHTSHIFT: return SDLK_RSHIFT;
+		case KEY_LEFTCTRL: return SDLK_LCTRL;
+		case KEY_RIGHTCTRL: return SDLK_RCTRL;
+		case KEY_LEFTALT: return SDLK_LALT;
+		case KEY_RIGHTALT: return SDLK_RALT;
+		case KEY_F1: return SDLK_F1; case KEY_F2: return SDLK_F2; case KEY_F3: return SDLK_F3; case KEY_F4: return SDLK_F4;
+		case KEY_F5: return SDLK_F5; case KEY_F6: return SDLK_F6; case KEY_F7: return SDLK_F7; case KEY_F8: return SDLK_F8;
+		case KEY_F9: return SDLK_F9; case KEY_F10: return SDLK_F10; case KEY_F11: return SDLK_F11; case KEY_F12: return SDLK_F12;
+		default: return SDLK_UNKNOWN;
+		}
+	}
+
+	// what a key types, 0 for nothing; US layout, there's no keymap to ask without a windowing system
+	static char toText(SDL_Keycode key, bool shift)
+	{
+		if(key >= SDLK_a && key <= SDLK_z)
+			return shift ? (char)(key - SDLK_a + 'A') : (char)key;
+
+		static const char* plain = "1234567890-=[];'`\\,./ ";
+		static const char* shifted = "!@#$%^&*()_+{}:\"~|<>? ";
+		const char* found = (key > 0 && key < 128) ? strchr(plain, (int)key) : NULL;
+		if(found == NULL)
+			return 0;
+		return shift ? shifted[found - plain] : (char)key;
+	}
+
+	static void readKeyboards(std::vector<int> fds)
+	{
+		std::vector<pollfd> polls;
+		pollfd quit = { keyboardQuitPipe[0], POLLIN, 0 };
+		polls.push_back(quit);
+		for(auto it = fds.begin(); it != fds.end(); it++)
+		{
+			pollfd p = { *it, POLLIN, 0 };
+			polls.push_back(p);
+		}
+
+		bool shift[2] = { false, false };
+		while(poll(polls.data(), polls.size(), -1) >= 0 && !(polls[0].revents & POLLIN))
+		{
+			for(unsigned int i = 1; i < polls.size(); i++)
+			{
+				if(!(polls[i].revents & POLLIN))
+					continue;
+
+				input_event events[32];
+				const ssize_t bytes = read(polls[i].fd, events, sizeof(events));
+				for(int e = 0; e < (int)(bytes / (ssize_t)sizeof(input_event)); e++)
+				{
+					if(events[e].type != EV_KEY)
+						continue;
+
+					if(events[e].code == KEY_LEFTSHIFT || events[e].code == KEY_RIGHTSHIFT)
+						shift[events[e].code == KEY_RIGHTSHIFT] = events[e].value != 0;
+
+					const SDL_Keycode key = toKeycode(events[e].code);
+					if(key == SDLK_UNKNOWN)
+						continue;
+
+					// 0 up, 1 down, 2 held down
+					SDL_Event event;
+					memset(&event, 0, sizeof(event));
+					event.type = events[e].value ? SDL_KEYDOWN : SDL_KEYUP;
+					event.key.timestamp = SDL_GetTicks();
+					event.key.state = events[e].value ? SDL_PRESSED : SDL_RELEASED;
+					event.key.repeat = events[e].value == 2;
+					event.key.keysym.sym = key;
+					SDL_PushEvent(&event);
+
+					const char text = events[e].value ? toText(key, shift[0] || shift[1]) : 0;
+					if(text && SDL_IsTextInputActive())
+					{
+						SDL_Event textEvent;
+						memset(&textEvent, 0, sizeof(textEvent));
+						textEvent.type = SDL_TEXTINPUT;
+						textEvent.text.timestamp = event.key.timestamp;
+						textEvent.text.text[0] = text;
+						SDL_PushEvent(&textEvent);
+					}
+				}
+			}
+		}
+
+		for(auto it = fds.begin(); it != fds.end(); it++)
+			close(*it);
+	}
+
+	static void startKeyboards()
+	{
+		std::vector<int> fds;
+		DIR* dir = opendir("/dev/input");
+		if(dir != NULL)
+		{
+			for(dirent* entry = readdir(dir); entry != NULL; entry = readdir(dir))
+			{
+				if(strncmp(entry->d_name, "event", 5) != 0)
+					continue;
+
+				const std::string path = std::string("/dev/input/") + entry->d_name;
+				const int fd = open(path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+				if(fd < 0)
+					continue;
+
+				// keyboards are what has an enter key, which leaves out power buttons (and, being read by SDL, joysticks)
+				unsigned long keys[KEY_MAX / (8 * sizeof(unsigned long)) + 1];
+				memset(keys, 0, sizeof(keys));
+				const bool hasEnter = ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(keys)), keys) >= 0 &&
+					(keys[KEY_ENTER / (8 * sizeof(unsigned long))] & (1UL << (KEY_ENTER % (8 * sizeof(unsigned long)))));
+				if(hasEnter)
+					fds.push_back(fd);
+				else
+					close(fd);
+			}
+			closedir(dir);
+		}
+
+		if(fds.empty())
+		{
+			LOG(LogWarning) << "No keyboards could be opened in /dev/input (is the user in the input group?)";
+			return;
+		}
+
+		if(pipe(keyboardQuitPipe) != 0)
+		{
+			for(auto it = fds.begin(); it != fds.end(); it++)
+				close(*it);
+			return;
+		}
+
+		LOG(LogInfo) << "Reading " << fds.size() << " keyboard(s) from evdev";
+		keyboardThread = new std::thread(readKeyboards, fds);
+	}
+
+	static void stopKeyboards()
+	{
+		if(keyboardThread == NULL)
+			return;
+
+		const char quit = 0;
+		if(write(keyboardQuitPipe[1], &quit, 1) != 1)
+			LOG(LogWarning) << "Could not stop the keyboard thread";
+		keyboardThread->join();
+		delete keyboardThread;
+		keyboardThread = NULL;
+
+		close(keyboardQuitPipe[0]);
+		close(keyboardQuitPipe[1]);
+		keyboardQuitPipe[0] = keyboardQuitPipe[1] = -1;
+	}
+
+	// --------------------------------------------------------------------------------------------------------------------
+
+	bool createSurface()
+	{
+		LOG(LogInfo) << "Creating surface (KMS/DRM)...";
+
+		if(Settings::getInstance()->getBool("Headless"))
+			LOG(LogWarning) << "Headless isn't supported by the KMS/DRM renderer, drawing to the display";
+		if(!Settings::getInstance()->getBool("VSync"))
+			LOG(LogWarning) << "The KMS/DRM renderer always waits for vblank, VSync off is ignored";
+
+		if(SDL_Init(SDL_INIT_EVENTS) != 0)
+		{
+			LOG(LogError) << "Error initializing SDL!\n	" << SDL_GetError();
+			return false;
+		}
+
+		if(!openCard())
+			return false;
+
+		display_width = mode.hdisplay;
+		display_height = mode.vdisplay;
+
+		gbmDevice = gbm_create_device(drmFd);
+		gbmSurface = gbmDevice ? gbm_surface_create(gbmDevice, display_width, display_height, GBM_FORMAT_XRGB8888,
+			GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING) : NULL;
+		if(gbmSurface == NULL)
+		{
+			LOG(LogError) << "Error creating the GBM surface";
+			return false;
+		}
+
+		if(!createContext())
+			return false;
+
+		needsModeset = true;
+		startKeyboards();
+
+		LOG(LogInfo) << "Created surface successfully.";
+		return true;
+	}
+
+	int getRefreshRate()
+	{
+		return drmFd >= 0 ? mode.vrefresh : 0;
+	}
+
+	int getSwapInterval()
+	{
+		// every frame waits for its page flip
+		return 1;
+	}
+
+	void* getProcAddress(const char* name)
+	{
+		// EGL before 1.5 only has to know extension functions, the core ones are in the library itself
+		void* proc = (void*)eglGetProcAddress(name);
+		return proc ? proc : dlsym(RTLD_DEFAULT, name);
+	}
+
+	bool isExtensionSupported(const char* name)
+	{
+		return glExtensions.find(" " + std::string(name) + " ") != std::string::npos;
+	}
+
+	bool hasContext()
+	{
+		return eglContext != EGL_NO_CONTEXT && eglGetCurrentContext() == eglContext;
+	}
+
+	void swapBuffers()
+	{
+		flushQuads();
+		eglSwapBuffers(eglDisplay, eglSurface);
+
+		gbm_bo* bo = gbm_surface_lock_front_buffer(gbmSurface);
+		const uint32_t fb = bo ? getFramebuffer(bo) : 0;
+		if(fb == 0)
+		{
+			if(bo)
+				gbm_surface_release_buffer(gbmSurface, bo);
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			return;
+		}
+
+		if(needsModeset)
+		{
+			if(drmModeSetCrtc(drmFd, crtcId, fb, 0, 0, &connectorId, 1, &mode) != 0)
+				LOG(LogError) << "drmModeSetCrtc failed: " << strerror(errno);
+			needsModeset = false;
+		}else{
+			// the flip happens on the next vblank, the old buffer can only be reused once it has
+			bool waiting = true;
+			if(drmModePageFlip(drmFd, crtcId, fb, DRM_MODE_PAGE_FLIP_EVENT, &waiting) == 0)
+			{
+				drmEventContext events;
+				memset(&events, 0, sizeof(events));
+				events.version = 2;
+				events.page_flip_handler = onPageFlip;
+
+				pollfd p = { drmFd, POLLIN, 0 };
+				while(waiting && poll(&p, 1, 100) > 0)
+					drmHandleEvent(drmFd, &events);
+			}else{
+				LOG(LogWarning) << "drmModePageFlip failed: " << strerror(errno);
+			}
+		}
+
+		if(shownBo)
+			gbm_surface_release_buffer(gbmSurface, shownBo);
+		shownBo = bo;
+
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	}
+
+	void destroySurface()
+	{
+		stopKeyboards();
+
+		if(eglDisplay != EGL_NO_DISPLAY)
+		{
+			eglMakeCurrent(eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+			if(eglSurface != EGL_NO_SURFACE)
+				eglDestroySurface(eglDisplay, eglSurface);
+			if(eglContext != EGL_NO_CONTEXT)
+				eglDestroyContext(eglDisplay, eglContext);
+			eglTerminate(eglDisplay);
+		}
+		eglSurface = EGL_NO_SURFACE;
+		eglContext = EGL_NO_CONTEXT;
+		eglDisplay = EGL_NO_DISPLAY;
+		glExtensions.clear();
+
+		// the console's framebuffer back before ours go away
+		if(savedCrtc != NULL)
+		{
+			drmModeSetCrtc(drmFd, savedCrtc->crtc_id, savedCrtc->buffer_id, savedCrtc->x, savedCrtc->y, &connectorId, 1, &savedCrtc->mode);
+			drmModeFreeCrtc(savedCrtc);
+			savedCrtc = NULL;
+		}
+
+		if(shownBo)
+			gbm_surface_release_buffer(gbmSurface, shownBo);
+		shownBo = NULL;
+		if(gbmSurface)
+			gbm_surface_destroy(gbmSurface);
+		gbmSurface = NULL;
+		if(gbmDevice)
+			gbm_device_destroy(gbmDevice);
+		gbmDevice = NULL;
+
+		if(drmFd >= 0)
+			close(drmFd);
+		drmFd = -1;
+
+		SDL_Quit();
+	}
+
+	bool init(int w, int h)
+	{
+		if(w)
+			display_width = w;
+		if(h)
+			display_height = h;
+
+		bool createdSurface = createSurface();
+
+		if(!createdSurface)
+		{
+			destroySurface();
+			return false;
+		}
+
+		glViewport(0, 0, display_width, display_height);
+
+		glMatrixMode(GL_PROJECTION);
+		glOrtho(0, display_width, display_height, 0, -1.0, 1.0);
+		glMatrixMode(GL_MODELVIEW);
+		glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+
+		// new context, nothing we remember about it holds
+		resetState();
+
+		return true;
+	}
+
+	void deinit()
+	{
+		// the context goes away with the surface
+		resetState();
+		destroySurface();
+	}
+
+	void suspend()
+	{
+		// hand the display to whatever is launched, the context (and every texture) stays
+		stopKeyboards();
+		if(savedCrtc != NULL)
+			drmModeSetCrtc(drmFd, savedCrtc->crtc_id, savedCrtc->buffer_id, savedCrtc->x, savedCrtc->y, &connectorId, 1, &savedCrtc->mode);
+		drmDropMaster(drmFd);
+	}
+
+	void resume()
+	{
+		if(drmSetMaster(drmFd) != 0)
+			LOG(LogWarning) << "Could not get the display back: " << strerror(errno);
+		needsModeset = true;
+		startKeyboards();
+		eglMakeCurrent(eglDisplay, eglSurface, eglSurface, eglContext);
+	}
+};
@@ -60,10 +60,17 @@ namespace Renderer
 		if(display_height == 0)
 			display_height = dispMode.h;
 
+		// headless (benchmarks) draws into a window nobody sees; without a display, run with SDL_VIDEODRIVER=offscreen
+		const bool headless = Settings::getInstance()->getBool("Headless");
+		Uint32 windowFlags = SDL_WINDOW_OPENGL;
+		if(headless)
+			windowFlags |= SDL_WINDOW_HIDDEN;
+		else if(!Settings::getInstance()->getBool("Windowed"))
+			windowFlags |= SDL_WINDOW_FULLSCREEN;
+
 		sdlWindow = SDL_CreateWindow("EmulationStation", 
 			SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 
-			display_width, display_height, 
-			SDL_WINDOW_OPENGL | (Settings::getInstance()->getBool("Windowed") ? 0 : SDL_WINDOW_FULLSCREEN));
+			display_width, display_height, windowFlags);
 
 		if(sdlWindow == NULL)
 		{
@@ -98,8 +105,10 @@ namespace Renderer
 
 		sdlContext = SDL_GL_CreateContext(sdlWindow);
 
-		// vsync
-		if(Settings::getInstance()->getBool("VSync"))
+		// vsync, never when headless so frame times aren't capped at the refresh rate
+		if(headless)
+			SDL_GL_SetSwapInterval(0);
+		else if(Settings::getInstance()->getBool("VSync"))
 		{
 			// SDL_GL_SetSwapInterval(0) for immediate updates (no vsync, default), 
 			// 1 for updates synchronized with the vertical retrace, 
@@ -109,13 +118,52 @@ namespace Renderer
 			// if that doesn't work, report an error
 			if(SDL_GL_SetSwapInterval(-1) != 0 && SDL_GL_SetSwapInterval(1) != 0)
 				LOG(LogWarning) << "Tried to enable vsync, but failed! (" << SDL_GetError() << ")";
+		}else{
+			SDL_GL_SetSwapInterval(0);
 		}
 
+		const int interval = SDL_GL_GetSwapInterval();
+		LOG(LogInfo) << "Swap interval: " << interval << (interval < 0 ? " (adaptive vsync)" : "");
+
 		return true;
 	}
 
+	int getRefreshRate()
+	{
+		SDL_DisplayMode mode;
+		if(sdlWindow == NULL || SDL_GetWindowDisplayMode(sdlWindow, &mode) != 0 || mode.refresh_rate <= 0)
+		{
+			// windowed, ask the desktop instead
+			const int display = sdlWindow != NULL ? SDL_GetWindowDisplayIndex(sdlWindow) : 0;
+			if(SDL_GetDesktopDisplayMode(display < 0 ? 0 : display, &mode) != 0)
+				return 0;
+		}
+		return mode.refresh_rate;
+	}
+
+	int getSwapInterval()
+	{
+		return SDL_GL_GetSwapInterval();
+	}
+
+	void* getProcAddress(const char* name)
+	{
+		return SDL_GL_GetProcAddress(name);
+	}
+
+	bool isExtensionSupported(const char* name)
+	{
+		return SDL_GL_ExtensionSupported(name) == SDL_TRUE;
+	}
+
+	bool hasContext()
+	{
+		return sdlContext != NULL;
+	}
+
 	void swapBuffers()
 	{
+		flushQuads();
 		SDL_GL_SwapWindow(sdlWindow);
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 	}
@@ -153,11 +201,35 @@ namespace Renderer
 		glMatrixMode(GL_MODELVIEW);
 		glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
 
+		// new context, nothing we remember about it holds
+		resetState();
+
 		return true;
 	}
 
 	void deinit()
 	{
+		// the context goes away with the surface
+		resetState();
 		destroySurface();
 	}
+
+	void suspend()
+	{
+		// fullscreen windows would keep the display mode if only hidden
+		if(!Settings::getInstance()->getBool("Windowed"))
+			SDL_SetWindowFullscreen(sdlWindow, 0);
+		SDL_HideWindow(sdlWindow);
+		SDL_ShowCursor(initialCursorState);
+	}
+
+	void resume()
+	{
+		SDL_ShowCursor(0);
+		SDL_ShowWindow(sdlWindow);
+		if(!Settings::getInstance()->getBool("Windowed"))
+			SDL_SetWindowFullscreen(sdlWindow, SDL_WINDOW_FULLSCREEN);
+		SDL_RaiseWindow(sdlWindow);
+		SDL_GL_MakeCurrent(sdlWindow, sdlContext);
+	}
 };
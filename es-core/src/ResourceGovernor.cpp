@@ -0,0 +1,145 @@
+#include "ResourceGovernor.h"
+#include "Settings.h"
+#include "Sound.h"
+#include "Log.h"
+#include "platform.h"
+#include "Renderer.h"
+#include GLHEADER
+#include <SDL.h>
+#include <algorithm>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+// GL_NVX_gpu_memory_info and GL_ATI_meminfo, both in KB
+#define GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX 0x9048
+#define TEXTURE_FREE_MEMORY_ATI 0x87FC
+
+#define PRESSURE_MIN_VRAM 16 // MB the budget never drops below, any less and the current view alone wouldn't fit
+
+//                                  name      VRAM  prebuild  views  font pages  image  sounds  thumb page  thumb pages
+static const ResourceGovernor::Profile PROFILE_LOW    = { "low",    48,  false,    3,     2,          512,   8,      1024,       2 };
+static const ResourceGovernor::Profile PROFILE_MEDIUM = { "medium", 80,  true,     5,     3,          1024,  16,     1024,       4 };
+static const ResourceGovernor::Profile PROFILE_HIGH   = { "high",   0,   true,     0,     0,          0,     0,      2048,       0 };
+
+ResourceGovernor* ResourceGovernor::getInstance()
+{
+	static ResourceGovernor instance;
+	return &instance;
+}
+
+ResourceGovernor::ResourceGovernor() : mProfile(PROFILE_HIGH), mPressureVRAM(0)
+{
+	const std::string& setting = Settings::getInstance()->getString("MemoryProfile");
+	if(setting == "low")
+	{
+		mProfile = PROFILE_LOW;
+	}else if(setting == "medium")
+	{
+		mProfile = PROFILE_MEDIUM;
+	}else if(setting == "high")
+	{
+		mProfile = PROFILE_HIGH;
+	}else{
+		if(setting != "auto")
+			LOG(LogWarning) << "Unknown MemoryProfile \"" << setting << "\", picking one by the hardware";
+
+		size_t ram, vram;
+		detect(ram, vram);
+
+		// a Pi Zero or 1 has 512MB, a Pi 2 or 3 1GB (with the GPU's share taken out of both)
+		const size_t MB = 1024 * 1024;
+		if((ram && ram <= 640 * MB) || (vram && vram < 128 * MB))
+			mProfile = PROFILE_LOW;
+		else if((ram && ram <= 1536 * MB) || (vram && vram < 512 * MB))
+			mProfile = PROFILE_MEDIUM;
+
+		LOG(LogInfo) << "Memory profile \"" << mProfile.name << "\" (" << ram / MB << "MB RAM, "
+			<< (vram ? std::to_string(vram / MB) + "MB" : std::string("unknown")) << " VRAM)";
+		return;
+	}
+
+	LOG(LogInfo) << "Memory profile \"" << mProfile.name << "\"";
+}
+
+void ResourceGovernor::detect(size_t& ram, size_t& vram) const
+{
+	ram = 0;
+	vram = 0;
+
+#ifdef WIN32
+	MEMORYSTATUSEX status;
+	status.dwLength = sizeof(status);
+	if(GlobalMemoryStatusEx(&status))
+		ram = (size_t)status.ullTotalPhys;
+#else
+	const long pages = sysconf(_SC_PHYS_PAGES);
+	const long pageSize = sysconf(_SC_PAGE_SIZE);
+	if(pages > 0 && pageSize > 0)
+		ram = (size_t)pages * (size_t)pageSize;
+#endif
+
+#ifdef USE_OPENGL_DESKTOP
+	// only the desktop vendors say, and only with a context (the first texture or font is always made after there is one)
+	if(!Renderer::hasContext())
+		return;
+
+	GLint kb[4] = { 0, 0, 0, 0 };
+	if(Renderer::isExtensionSupported("GL_NVX_gpu_memory_info"))
+		glGetIntegerv(GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX, kb);
+	else if(Renderer::isExtensionSupported("GL_ATI_meminfo"))
+		glGetIntegerv(TEXTURE_FREE_MEMORY_ATI, kb); // what's free, which is as close as it gets
+	vram = (size_t)std::max(0, kb[0]) * 1024;
+#endif
+}
+
+int ResourceGovernor::getMaxVRAM() const
+{
+	int maxVRAM = Settings::getInstance()->getInt("MaxVRAM");
+	const int caps[] = { mProfile.maxVRAM, mPressureVRAM };
+	for(unsigned int i = 0; i < sizeof(caps) / sizeof(caps[0]); i++)
+	{
+		if(caps[i] > 0 && (maxVRAM <= 0 || caps[i] < maxVRAM))
+			maxVRAM = caps[i];
+	}
+	return maxVRAM;
+}
+
+int ResourceGovernor::getGameListViewCacheSize() const
+{
+	const int size = Settings::getInstance()->getInt("GameListViewCacheSize");
+	if(mProfile.gameListViewCacheSize > 0 && (size <= 0 || mProfile.gameListViewCacheSize < size))
+		return mProfile.gameListViewCacheSize;
+	return size;
+}
+
+int ResourceGovernor::getThumbnailAtlasPages() const
+{
+	const int pages = Settings::getInstance()->getInt("ThumbnailAtlasPages");
+	if(pages > 0 && mProfile.thumbnailAtlasPages > 0 && mProfile.thumbnailAtlasPages < pages)
+		return mProfile.thumbnailAtlasPages;
+	return pages;
+}
+
+void ResourceGovernor::onMemoryPressure(size_t vramInUse)
+{
+	// whatever the driver managed to give us is all there is, leave some room below it
+	const int budget = std::max(PRESSURE_MIN_VRAM, (int)(vramInUse / (1024 * 1024) * 3 / 4));
+	if(mPressureVRAM == 0 || budget < mPressureVRAM)
+		mPressureVRAM = budget;
+
+	LOG(LogWarning) << "Out of video memory with " << vramInUse / 1024 << "kb in textures, lowering the budget to "
+		<< mPressureVRAM << "MB and emptying caches";
+
+	Sound::trimCache(0);
+	for(auto it = mPressureHandlers.begin(); it != mPressureHandlers.end(); it++)
+		(*it)();
+}
+
+void ResourceGovernor::addPressureHandler(const std::function<void()>& handler)
+{
+	mPressureHandlers.push_back(handler);
+}
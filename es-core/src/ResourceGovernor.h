@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stddef.h>
+#include <functional>
+#include <vector>
+
+// Decides how much memory ES lets itself use, from "MemoryProfile" (low, medium, high, or auto to go by the RAM and VRAM
+// it finds), and caps the caches with it. The caps only ever lower what the settings ask for and are never written back,
+// so a setting that was raised by hand still works on a big machine.
+// When the GPU runs out of memory anyway, onMemoryPressure() has the caches give up what they can instead of crashing.
+class ResourceGovernor
+{
+public:
+	struct Profile
+	{
+		const char* name;
+		int maxVRAM; // MB of textures, 0 for no cap
+		bool prebuildViews; // build the gamelist views next to the current one while idle
+		int gameListViewCacheSize; // 0 for no cap
+		unsigned int fontMaxTextures; // glyph pages per font, 0 for no cap
+		int maxImageSize; // most pixels along either side of a downscaled image (thumbnails), 0 for no cap
+		unsigned int soundCacheSize; // sounds kept loaded while nothing is using them, 0 for no cap
+		int thumbnailPageSize; // px along each side of a thumbnail atlas page
+		int thumbnailAtlasPages; // 0 for no cap
+	};
+
+	static ResourceGovernor* getInstance();
+
+	inline const Profile& getProfile() const { return mProfile; }
+
+	// The setting and the profile's cap, whichever is lower (0 is unlimited for both).
+	int getMaxVRAM() const; // "MaxVRAM", also lowered by onMemoryPressure()
+	int getGameListViewCacheSize() const; // "GameListViewCacheSize"
+	int getThumbnailAtlasPages() const; // "ThumbnailAtlasPages" (where 0 turns them off)
+
+	// Called for every failed GL allocation, with what textures were using when it happened. Lowers the VRAM budget below
+	// that for the rest of this run and asks the caches to drop everything that isn't in use; the allocation can then be
+	// tried again. The textures themselves are evicted by the TextureResource that failed.
+	void onMemoryPressure(size_t vramInUse);
+
+	// handler frees what it can spare, called from onMemoryPressure() on the main thread
+	void addPressureHandler(const std::function<void()>& handler);
+
+private:
+	ResourceGovernor();
+
+	void detect(size_t& ram, size_t& vram) const; // bytes, 0 if unknown
+
+	Profile mProfile;
+	int mPressureVRAM; // MB, 0 until the GPU ran out
+	std::vector< std::function<void()> > mPressureHandlers;
+};
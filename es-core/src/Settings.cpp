@@ -1,9 +1,12 @@
 #include "Settings.h"
 #include "Log.h"
 #include "pugixml/pugixml.hpp"
+#include "XmlFile.h"
 #include "platform.h"
 #include <boost/filesystem.hpp>
 #include <boost/assign.hpp>
+#include <sstream>
+#include <fstream>
 
 Settings* Settings::sInstance = NULL;
 
@@ -19,10 +22,11 @@ std::vector<const char*> settings_dont_save = boost::assign::list_of
 	("HideConsole")
 	("IgnoreGamelist");
 
-Settings::Settings()
+Settings::Settings() : mGeneration(0), mDirty(false)
 {
 	setDefaults();
 	loadFile();
+	mDirty = false;
 }
 
 Settings* Settings::getInstance()
@@ -35,11 +39,12 @@ Settings* Settings::getInstance()
 
 void Settings::setDefaults()
 {
-	mBoolMap.clear();
-	mIntMap.clear();
-
 	mBoolMap["BackgroundJoystickInput"] = false;
 	mBoolMap["ParseGamelistOnly"] = false;
+	mBoolMap["WatchRomFolders"] = true;
+	mBoolMap["LazyLoadSystems"] = false; // only load a system's games when it's opened (or in the background)
+	mBoolMap["ProgressiveStartup"] = true; // load systems in the background, they show up in the system view as they're ready
+	mBoolMap["GamelistCheckTree"] = true; // match gamelist entries against the scanned folders instead of stat()ing each one
 	mBoolMap["DrawFramerate"] = false;
 	mBoolMap["ShowExit"] = true;
 	mBoolMap["Windowed"] = false;
@@ -49,17 +54,35 @@ void Settings::setDefaults()
 	// don't enable VSync by default on the Pi, since it already 
 	// has trouble trying to render things at 60fps in certain menus
 	mBoolMap["VSync"] = false;
+
+	// textures over this many MB get unloaded, least recently used first (the default GPU split is tiny)
+	mIntMap["MaxVRAM"] = 80;
 #else
 	mBoolMap["VSync"] = true;
+	mIntMap["MaxVRAM"] = 0; // no limit
 #endif
 
 	mBoolMap["EnableSounds"] = true;
+	mBoolMap["EnableMusic"] = true; // theme background music (<sound name="music"> in the system view)
 	mBoolMap["ShowHelpPrompts"] = true;
 	mBoolMap["ScrapeRatings"] = true;
 	mBoolMap["IgnoreGamelist"] = false;
 	mBoolMap["HideConsole"] = true;
 	mBoolMap["QuickSystemSelect"] = true;
 	mBoolMap["SaveGamelistsOnExit"] = true;
+	mBoolMap["FastExit"] = true; // save gamelists in parallel on exit and don't bother freeing the game trees
+	mBoolMap["ParallelSystemLoad"] = true;
+	mBoolMap["RomCache"] = true;
+	mBoolMap["ThemeCache"] = true;
+	mBoolMap["SoundCache"] = true; // converted theme sounds in ~/.emulationstation/cache/sounds
+	mBoolMap["SearchDescriptions"] = false; // also index game descriptions for search (uses more memory)
+	mBoolMap["CompressDescriptions"] = true; // keep long game descriptions deflated in memory, inflated when one is shown
+	mBoolMap["HashRomsInBackground"] = false; // hash every game once it's loaded, for scraping by hash (cached, so only the first time)
+	mIntMap["HashThreads"] = 2;
+	mIntMap["HashReadLimit"] = 32; // MB/s for all hashing threads together, 0 = no limit
+	mIntMap["LaunchReadahead"] = 256; // MB of the ROM (and emulator) to start reading while the launch animation plays, 0 = off
+	mIntMap["ScanTimeout"] = 10000; // ms a system's ROM folders get to list before it's shown as is and finished in the background, 0 = wait forever
+	mBoolMap["KeepVideoOnLaunch"] = false; // only hide the window while a game runs, doesn't work with every emulator/display setup
 
 	mBoolMap["Debug"] = false;
 	mBoolMap["DebugGrid"] = false;
@@ -68,11 +91,58 @@ void Settings::setDefaults()
 	mIntMap["ScreenSaverTime"] = 5*60*1000; // 5 minutes
 	mIntMap["ScraperResizeWidth"] = 400;
 	mIntMap["ScraperResizeHeight"] = 0;
+	mIntMap["HttpCacheMaxAge"] = 7 * 24 * 60 * 60; // seconds a cached scraper response is used without asking the server
+	mIntMap["ScraperConcurrency"] = 4; // games scraped at once when results are accepted automatically
+	mIntMap["HttpRequestsPerSecond"] = 5; // per host, 0 for no limit
+	mBoolMap["OverlapUpdateWithSwap"] = false; // run the next frame's update before swapping, while the GPU draws this one (can miss vblank)
+	mBoolMap["ThemeHotReload"] = false; // for theme authors: apply changes to loaded theme files as they're saved
+	mBoolMap["UseTextureAtlas"] = true; // pack small images into shared textures
+	mIntMap["ThumbnailCacheSize"] = 512; // MB of scaled-down images kept on disk, least recently used ones are deleted past it, 0 = no limit
+	mIntMap["ThumbnailAtlasPages"] = 2; // pages shared by scaled-down box art, 32MB at most (their size and a lower cap come from the MemoryProfile)
+	mBoolMap["AutoMipmap"] = true; // mipmap images drawn at less than half their size
+	mBoolMap["DedupeTextures"] = false; // hash the pixels of every loaded image so identical ones share one texture
+	mBoolMap["ShaderRenderer"] = true; // draw with shaders instead of fixed-function where GL 2.0 is available
+	mBoolMap["SnapshotTransitions"] = true; // slide transitions draw the view being left from a texture, rendered once
+	mBoolMap["FontDistanceField"] = false; // one set of distance field glyphs per font file for every size (needs a restart)
+	mBoolMap["SkipIdleFrames"] = true; // don't redraw the screen when nothing on it changed
+	mIntMap["MaxFPS"] = 0; // frame cap, 0 = none (vsync still applies)
+	mBoolMap["ThermalGovernor"] = true; // halve the frame cap and turn off effects while the board is hot or throttled (see ThermalGovernor)
+	mIntMap["ThermalReduceTemp"] = 70; // C
+	mIntMap["ThermalMinimalTemp"] = 80; // C, and when it's throttled and still dropping frames
+	mFloatMap["ThermalRenderScale"] = 0.75f; // render scale at the minimal level
+	mBoolMap["Headless"] = false; // hidden window and no vsync, for --benchmark-ui
+	mBoolMap["ProfileFrames"] = false; // time each frame's phases and draw them as a graph
+	mBoolMap["ProfileGPU"] = false; // time drawing on the GPU for the metrics, also without ProfileFrames
+	mIntMap["GameListViewCacheSize"] = 8; // gamelist views kept alive, least recently used ones are rebuilt when needed
+	mStringMap["MemoryProfile"] = "auto"; // low, medium or high caps on caches and VRAM (see ResourceGovernor), auto picks by RAM (and VRAM if known)
+	mIntMap["TextureUploadBudget"] = 4; // ms per frame spent on main thread jobs from the background (mostly uploading decoded textures)
+	mIntMap["MetricsInterval"] = 10; // seconds between writes of MetricsFile
+
+	mFloatMap["RenderScale"] = 1.0f; // below 1, everything but the help prompts and overlays is drawn at this fraction of the resolution and scaled up
 
 	mStringMap["TransitionStyle"] = "fade";
 	mStringMap["ThemeSet"] = "";
-	mStringMap["ScreenSaverBehavior"] = "dim";
+#ifdef _RPI_
+	// plays VideoComponents (game snaps) in hardware, on a layer above ours; %VIDEO% is the (quoted) file, %X1%..%Y2% where
+	mStringMap["VideoPlayerCommand"] = "omxplayer --no-osd --loop --layer 10010 --aspect-mode letterbox --win %X1%,%Y1%,%X2%,%Y2% %VIDEO%";
+#else
+	mStringMap["VideoPlayerCommand"] = ""; // no video playback
+#endif
+	mStringMap["ScreenSaverBehavior"] = "dim"; // dim, black, off (black, stops drawing entirely and turns the display off) or slideshow (of game images)
+#if defined(_RPI_)
+	mStringMap["DisplayOffCommand"] = "vcgencmd display_power 0"; // run when the "off" screensaver starts, nothing if empty
+	mStringMap["DisplayOnCommand"] = "vcgencmd display_power 1";
+#elif defined(__linux__)
+	mStringMap["DisplayOffCommand"] = "xset dpms force off";
+	mStringMap["DisplayOnCommand"] = "xset dpms force on";
+#else
+	mStringMap["DisplayOffCommand"] = "";
+	mStringMap["DisplayOnCommand"] = "";
+#endif
 	mStringMap["Scraper"] = "TheGamesDB";
+	mStringMap["ScraperSharedCache"] = ""; // directory (e.g. a network share) of search results and images shared with other machines, "" = off
+	mStringMap["GamelistBackend"] = "xml"; // xml, or store (an append-only log next to the home gamelist.xml, imported from the xml the first time)
+	mStringMap["MetricsFile"] = ""; // where to write Prometheus-style metrics, nothing is written if empty
 }
 
 template <typename K, typename V>
@@ -92,6 +162,10 @@ void saveMap(pugi::xml_document& doc, std::map<K, V>& map, const char* type)
 
 void Settings::saveFile()
 {
+	if(!mDirty)
+		return;
+	mDirty = false;
+
 	const std::string path = getHomePath() + "/.emulationstation/es_settings.cfg";
 
 	pugi::xml_document doc;
@@ -108,7 +182,33 @@ void Settings::saveFile()
 		node.append_attribute("value").set_value(iter->second.c_str());
 	}
 
-	doc.save_file(path.c_str());
+	std::stringstream ss;
+	doc.save(ss);
+
+	// written next to it and renamed over it, so a crash mid-write can't leave a broken file
+	waitForSave();
+	mSaveThread = std::thread([path](std::string text) {
+		const std::string tmpPath = path + ".tmp";
+		{
+			std::ofstream out(tmpPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+			if(!out.is_open() || !out.write(text.data(), text.size()))
+			{
+				LOG(LogError) << "Could not write settings to " << tmpPath;
+				return;
+			}
+		}
+
+		boost::system::error_code ec;
+		boost::filesystem::rename(tmpPath, path, ec);
+		if(ec)
+			LOG(LogError) << "Could not replace " << path << ": " << ec.message();
+	}, ss.str());
+}
+
+void Settings::waitForSave()
+{
+	if(mSaveThread.joinable())
+		mSaveThread.join();
 }
 
 void Settings::loadFile()
@@ -118,8 +218,8 @@ void Settings::loadFile()
 	if(!boost::filesystem::exists(path))
 		return;
 
-	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(path.c_str());
+	XmlFile doc;
+	pugi::xml_parse_result result = doc.load(path);
 	if(!result)
 	{
 		LOG(LogError) << "Could not parse Settings file!\n   " << result.description();
@@ -147,10 +247,29 @@ void Settings::loadFile()
 } \
 void Settings::setMethodName(const std::string& name, type value) \
 { \
+	auto it = mapName.find(name); \
+	if(it != mapName.end() && it->second == value) \
+		return; \
 	mapName[name] = value; \
+	mDirty = true; \
+	mGeneration++; \
 }
 
 SETTINGS_GETSET(bool, mBoolMap, getBool, setBool);
 SETTINGS_GETSET(int, mIntMap, getInt, setInt);
 SETTINGS_GETSET(float, mFloatMap, getFloat, setFloat);
-SETTINGS_GETSET(const std::string&, mStringMap, getString, setString);
\ No newline at end of file
+SETTINGS_GETSET(const std::string&, mStringMap, getString, setString);
+
+#define SETTINGS_HANDLE(type, mapName, handleMethodName) SettingHandle<type> Settings::handleMethodName(const std::string& name) \
+{ \
+	if(mapName.find(name) == mapName.end()) \
+	{ \
+		LOG(LogError) << "Tried to use unset setting " << name << "!"; \
+	} \
+	return SettingHandle<type>(&mapName[name]); \
+}
+
+SETTINGS_HANDLE(bool, mBoolMap, getBoolHandle);
+SETTINGS_HANDLE(int, mIntMap, getIntHandle);
+SETTINGS_HANDLE(float, mFloatMap, getFloatHandle);
+SETTINGS_HANDLE(std::string, mStringMap, getStringHandle);
\ No newline at end of file
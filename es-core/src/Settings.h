@@ -1,6 +1,24 @@
 #pragma once
 #include <string>
 #include <map>
+#include <thread>
+#include <stddef.h>
+
+// One setting, looked up once. Reading it is a pointer dereference and always gives the current value,
+// so it's what per-frame code should keep around instead of calling Settings::getBool every time.
+template<typename T>
+class SettingHandle
+{
+public:
+	SettingHandle() : mValue(NULL) {}
+	explicit SettingHandle(const T* value) : mValue(value) {}
+
+	inline const T& get() const { return *mValue; }
+	inline operator const T&() const { return *mValue; }
+
+private:
+	const T* mValue;
+};
 
 //This is a singleton for storing settings.
 class Settings
@@ -9,7 +27,20 @@ public:
 	static Settings* getInstance();
 
 	void loadFile();
+
+	// Writes es_settings.cfg on a background thread, if anything changed since it was loaded or last saved.
 	void saveFile();
+	// Waits for a save that's still being written, for before exiting.
+	void waitForSave();
+
+	// Valid for as long as the program runs. Same warning as the getters below if the setting doesn't exist.
+	SettingHandle<bool> getBoolHandle(const std::string& name);
+	SettingHandle<int> getIntHandle(const std::string& name);
+	SettingHandle<float> getFloatHandle(const std::string& name);
+	SettingHandle<std::string> getStringHandle(const std::string& name);
+
+	// Changes whenever a setting is set to a different value.
+	inline unsigned int getGeneration() const { return mGeneration; }
 
 	//You will get a warning if you try a get on a key that is not already present.
 	bool getBool(const std::string& name);
@@ -27,11 +58,15 @@ private:
 
 	Settings();
 
-	//Clear everything and load default values.
+	//Load default values. Nothing is ever removed from the maps, handles point into them.
 	void setDefaults();
 
 	std::map<std::string, bool> mBoolMap;
 	std::map<std::string, int> mIntMap;
 	std::map<std::string, float> mFloatMap;
 	std::map<std::string, std::string> mStringMap;
+
+	unsigned int mGeneration;
+	bool mDirty; // changed since loaded or saved
+	std::thread mSaveThread;
 };
@@ -1,8 +1,46 @@
 #include "Sound.h"
 #include "AudioManager.h"
 #include "Log.h"
+#include "MemoryStats.h"
 #include "Settings.h"
+#include "ResourceGovernor.h"
 #include "ThemeData.h"
+#include "platform.h"
+#include "resources/ResourceManager.h"
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <sstream>
+#include <functional>
+#include <stdint.h>
+#include <string.h>
+
+namespace fs = boost::filesystem;
+
+// converted sample cache, one file per sound:
+// magic, version, source mtime, source size, sample bytes, path length, then the samples (at SOUNDCACHE_HEADER_SIZE,
+// so they stay aligned when mapped) and the source path last
+// bump this if the layout below changes
+static const char SOUNDCACHE_MAGIC[4] = { 'E', 'S', 'P', 'C' };
+static const uint32_t SOUNDCACHE_VERSION = 1;
+static const size_t SOUNDCACHE_HEADER_SIZE = 32;
+
+// host byte order, see BinaryIO.h
+struct SoundCacheHeader
+{
+	char magic[4];
+	uint32_t version;
+	int64_t modified;
+	int64_t size;
+	uint32_t sampleBytes;
+	uint32_t pathLength;
+};
+
+static std::string getSoundCachePath(const std::string& path)
+{
+	std::stringstream ss;
+	ss << getHomePath() << "/.emulationstation/cache/sounds/" << std::hex << std::hash<std::string>()(path) << ".pcm";
+	return ss.str();
+}
 
 std::map< std::string, std::shared_ptr<Sound> > Sound::sMap;
 
@@ -12,27 +50,48 @@ std::shared_ptr<Sound> Sound::get(const std::string& path)
 	if(it != sMap.end())
 		return it->second;
 
+	AudioManager::getInstance();
+
 	std::shared_ptr<Sound> sound = std::shared_ptr<Sound>(new Sound(path));
-	AudioManager::getInstance()->registerSound(sound);
 	sMap[path] = sound;
+
+	const unsigned int cacheSize = ResourceGovernor::getInstance()->getProfile().soundCacheSize;
+	if(cacheSize > 0 && sMap.size() > cacheSize)
+		trimCache(cacheSize);
+
 	return sound;
 }
 
+void Sound::trimCache(unsigned int keep)
+{
+	for(auto it = sMap.begin(); it != sMap.end() && sMap.size() > keep; )
+	{
+		// the map's is the only reference, anyone else's would keep it alive anyway
+		if(it->second.use_count() == 1)
+			it = sMap.erase(it);
+		else
+			it++;
+	}
+}
+
 std::shared_ptr<Sound> Sound::getFromTheme(const std::shared_ptr<ThemeData>& theme, const std::string& view, const std::string& element)
 {
 	LOG(LogInfo) << " req sound [" << view << "." << element << "]";
 
 	const ThemeData::ThemeElement* elem = theme->getElement(view, element, "sound");
-	if(!elem || !elem->has("path"))
+	if(!elem || !elem->has(ThemeProperties::PATH))
 	{
 		LOG(LogInfo) << "   (missing)";
 		return get("");
 	}
 
-	return get(elem->get<std::string>("path"));
+	std::shared_ptr<Sound> sound = get(elem->get<std::string>(ThemeProperties::PATH));
+	if(elem->has(ThemeProperties::VOLUME))
+		sound->setVolume(elem->get<float>(ThemeProperties::VOLUME));
+	return sound;
 }
 
-Sound::Sound(const std::string & path) : mSampleData(NULL), mSamplePos(0), mSampleLength(0), playing(false)
+Sound::Sound(const std::string & path) : mSampleData(NULL), mSampleLength(0), mVolume(1.0f)
 {
 	loadFile(path);
 }
@@ -56,6 +115,13 @@ void Sound::init()
 	if(mPath.empty())
 		return;
 
+	// counted whether it's on the heap or mapped from the cache, a small cache file is also counted as a resource
+	if(loadCache())
+	{
+		MemoryStats::add(MemoryStats::SOUND, mSampleLength);
+		return;
+	}
+
 	//load wav file via SDL
 	SDL_AudioSpec wave;
 	Uint8 * data = NULL;
@@ -66,7 +132,7 @@ void Sound::init()
 	}
 	//build conversion buffer
 	SDL_AudioCVT cvt;
-    SDL_BuildAudioCVT(&cvt, wave.format, wave.channels, wave.freq, AUDIO_S16, 2, 44100);
+    SDL_BuildAudioCVT(&cvt, wave.format, wave.channels, wave.freq, AUDIO_S16SYS, 2, 44100);
 	//copy data to conversion buffer
 	cvt.len = dlen;
     cvt.buf = new Uint8[cvt.len * cvt.len_mult];
@@ -77,32 +143,124 @@ void Sound::init()
 		delete[] cvt.buf;
 	}
 	else {
-		//worked. set up member data
-		SDL_LockAudio();
+		//worked. set up member data, the mixer only sees it once we play
+		mSampleBuffer = std::shared_ptr<unsigned char>(cvt.buf, [](unsigned char* p) { delete[] p; });
 		mSampleData = cvt.buf;
 		mSampleLength = cvt.len_cvt;
-		mSamplePos = 0;
 		mSampleFormat.channels = 2;
 		mSampleFormat.freq = 44100;
-		mSampleFormat.format = AUDIO_S16;
-		SDL_UnlockAudio();
+		mSampleFormat.format = AUDIO_S16SYS;
+		MemoryStats::add(MemoryStats::SOUND, mSampleLength);
+		saveCache();
 	}
 	//free wav data now
     SDL_FreeWAV(data);
 }
 
-void Sound::deinit()
+bool Sound::loadCache()
 {
-	playing = false;
+	if(!Settings::getInstance()->getBool("SoundCache"))
+		return false;
+
+	boost::system::error_code ec;
+	const std::time_t modified = fs::last_write_time(mPath, ec);
+	const boost::uintmax_t size = fs::file_size(mPath, ec);
+	if(ec)
+		return false;
+
+	const std::string cachePath = getSoundCachePath(mPath);
+	if(!fs::exists(cachePath))
+		return false;
+
+	// big ones are mapped, so only the pages that get played are ever read
+	const ResourceData data = ResourceManager::getInstance()->getFileData(cachePath);
+	if(data.ptr == NULL || data.length < SOUNDCACHE_HEADER_SIZE)
+		return false;
+
+	SoundCacheHeader header;
+	memcpy(&header, data.ptr.get(), sizeof(header));
+	if(memcmp(header.magic, SOUNDCACHE_MAGIC, 4) != 0 || header.version != SOUNDCACHE_VERSION)
+		return false;
+
+	if(data.length != SOUNDCACHE_HEADER_SIZE + (size_t)header.sampleBytes + header.pathLength)
+	{
+		LOG(LogWarning) << "Sound cache \"" << cachePath << "\" is truncated, ignoring it";
+		return false;
+	}
+
+	// a different file with the same hash, or the WAV changed
+	const char* cachedPath = (const char*)data.ptr.get() + SOUNDCACHE_HEADER_SIZE + header.sampleBytes;
+	if(mPath.compare(0, std::string::npos, cachedPath, header.pathLength) != 0 || 
+		header.modified != (int64_t)modified || header.size != (int64_t)size)
+		return false;
 
+	mSampleBuffer = data.ptr;
+	mSampleData = data.ptr.get() + SOUNDCACHE_HEADER_SIZE;
+	mSampleLength = header.sampleBytes;
+	mSampleFormat.channels = 2;
+	mSampleFormat.freq = 44100;
+	mSampleFormat.format = AUDIO_S16SYS;
+	return true;
+}
+
+void Sound::saveCache() const
+{
+	if(!Settings::getInstance()->getBool("SoundCache"))
+		return;
+
+	boost::system::error_code ec;
+	SoundCacheHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, SOUNDCACHE_MAGIC, 4);
+	header.version = SOUNDCACHE_VERSION;
+	header.modified = (int64_t)fs::last_write_time(mPath, ec);
+	header.size = (int64_t)fs::file_size(mPath, ec);
+	header.sampleBytes = mSampleLength;
+	header.pathLength = mPath.length();
+	if(ec)
+		return;
+
+	const fs::path path = getSoundCachePath(mPath);
+	const fs::path tmpPath = path.generic_string() + ".tmp";
+	fs::create_directories(path.parent_path(), ec);
+
+	{
+		std::ofstream out(tmpPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if(!out.is_open())
+		{
+			LOG(LogError) << "Could not write sound cache \"" << tmpPath.generic_string() << "\"";
+			return;
+		}
+
+		char padded[SOUNDCACHE_HEADER_SIZE];
+		memset(padded, 0, sizeof(padded));
+		memcpy(padded, &header, sizeof(header));
+		out.write(padded, sizeof(padded));
+		out.write((const char*)mSampleData, mSampleLength);
+		out.write(mPath.data(), mPath.length());
+
+		if(!out.good())
+		{
+			LOG(LogError) << "Error writing sound cache \"" << tmpPath.generic_string() << "\"";
+			return;
+		}
+	}
+
+	// replace the old entry in one step so a crash never leaves a half-written file behind
+	fs::rename(tmpPath, path, ec);
+	if(ec)
+		fs::remove(tmpPath, ec);
+}
+
+void Sound::deinit()
+{
 	if(mSampleData != NULL)
 	{
-		SDL_LockAudio();
-		delete[] mSampleData;
+		AudioManager::releaseSound(this);
+		MemoryStats::add(MemoryStats::SOUND, -(ptrdiff_t)mSampleLength);
+		mSampleBuffer.reset();
 		mSampleData = NULL;
 		mSampleLength = 0;
-		mSamplePos = 0;
-		SDL_UnlockAudio();
 	}
 }
 
@@ -114,35 +272,18 @@ void Sound::play()
 	if(!Settings::getInstance()->getBool("EnableSounds"))
 		return;
 
-	SDL_LockAudio();
-	if (playing)
-	{
-		//replay from start. rewind the sample to the beginning
-		mSamplePos = 0;
-		
-	}
-	else
-	{
-		//flag our sample as playing
-		playing = true;
-	}
-	SDL_UnlockAudio();
-	//tell the AudioManager to start playing samples
-	AudioManager::getInstance()->play();
+	//starts it from the beginning, even if it's already playing
+	AudioManager::getInstance()->playSound(this, mSampleData, mSampleLength, mVolume);
 }
 
-bool Sound::isPlaying() const
+void Sound::setVolume(float volume)
 {
-	return playing;
+	mVolume = volume < 0 ? 0 : (volume > 1 ? 1 : volume);
 }
 
 void Sound::stop()
 {
-	//flag our sample as playing and rewind its position
-	SDL_LockAudio();
-	playing = false;
-	mSamplePos = 0;
-	SDL_UnlockAudio();
+	AudioManager::getInstance()->stopSound(this);
 }
 
 const Uint8 * Sound::getData() const
@@ -150,21 +291,6 @@ const Uint8 * Sound::getData() const
 	return mSampleData;
 }
 
-Uint32 Sound::getPosition() const
-{
-	return mSamplePos;
-}
-
-void Sound::setPosition(Uint32 newPosition)
-{
-	mSamplePos = newPosition;
-	if (mSamplePos >= mSampleLength) {
-		//got to or beyond the end of the sample. stop playing
-		playing = false;
-		mSamplePos = 0;
-	}
-}
-
 Uint32 Sound::getLength() const
 {
 	return mSampleLength;
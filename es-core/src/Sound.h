@@ -12,15 +12,18 @@ class Sound
 {
 	std::string mPath;
     SDL_AudioSpec mSampleFormat;
-	Uint8 * mSampleData;
-    Uint32 mSamplePos;
+	const Uint8 * mSampleData;
     Uint32 mSampleLength;
-	bool playing;
+	std::shared_ptr<unsigned char> mSampleBuffer; // owns mSampleData, heap or a mapped cache file
+	float mVolume;
 
 public:
 	static std::shared_ptr<Sound> get(const std::string& path);
 	static std::shared_ptr<Sound> getFromTheme(const std::shared_ptr<ThemeData>& theme, const std::string& view, const std::string& elem);
 
+	// Unloads sounds nothing holds on to any more (e.g. their theme's views are gone) until at most keep are left.
+	static void trimCache(unsigned int keep);
+
 	~Sound();
 
 	void init();
@@ -28,18 +31,25 @@ public:
 
 	void loadFile(const std::string & path);
 
+	// only queue a command for the mixer (see AudioManager), they never wait for it
 	void play();
-	bool isPlaying() const;
 	void stop();
 
+	// 0 to 1, applies from the next play()
+	void setVolume(float volume);
+	inline float getVolume() const { return mVolume; }
+
 	const Uint8 * getData() const;
-	Uint32 getPosition() const;
-	void setPosition(Uint32 newPosition);
 	Uint32 getLength() const;
 	Uint32 getLengthMS() const;
 
 private:
 	Sound(const std::string & path = "");
+
+	// The converted samples are cached in ~/.emulationstation/cache/sounds/ (if "SoundCache" is on),
+	// so SDL_LoadWAV and the conversion only run again when the WAV file changes.
+	bool loadCache();
+	void saveCache() const;
 	static std::map< std::string, std::shared_ptr<Sound> > sMap;
 };
 
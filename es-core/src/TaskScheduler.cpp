@@ -0,0 +1,183 @@
+#include "TaskScheduler.h"
+#include "Log.h"
+#include <SDL.h>
+
+// which worker this thread is, -1 for threads that aren't one
+static thread_local int sWorkerIndex = -1;
+
+static unsigned int getDefaultWorkerCount()
+{
+	// the main thread has a core of its own
+	const unsigned int cores = std::thread::hardware_concurrency();
+	return cores > 1 ? cores - 1 : 1;
+}
+
+TaskScheduler* TaskScheduler::getInstance()
+{
+	static TaskScheduler instance;
+	return &instance;
+}
+
+TaskScheduler::TaskScheduler() : mWorkerCount(getDefaultWorkerCount()), mNextQueue(0), mPending(0), mQuit(false)
+{
+	for(unsigned int i = 0; i < mWorkerCount; i++)
+		mQueues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+}
+
+TaskScheduler::~TaskScheduler()
+{
+	// workers only look at mQuit once they're out of work, so everything already queued still runs (unless cancelled)
+	// before they're joined; only what's waiting for the main thread's update() is dropped
+	{
+		std::unique_lock<std::mutex> lock(mSleepMutex);
+		mQuit = true;
+	}
+	mWake.notify_all();
+
+	for(auto it = mThreads.begin(); it != mThreads.end(); it++)
+		it->join();
+}
+
+void TaskScheduler::submit(const Task& task, Priority priority, const CancellationToken& token)
+{
+	std::call_once(mStarted, [this] {
+		LOG(LogDebug) << "TaskScheduler - starting " << mWorkerCount << " workers";
+		for(unsigned int i = 0; i < mWorkerCount; i++)
+			mThreads.push_back(std::thread(&TaskScheduler::runWorker, this, i));
+	});
+
+	// a worker's own tasks stay with it, it's likely to still have their data in cache
+	const unsigned int index = sWorkerIndex >= 0 ? (unsigned int)sWorkerIndex : mNextQueue++ % mWorkerCount;
+	{
+		WorkerQueue& queue = *mQueues[index];
+		std::unique_lock<std::mutex> lock(queue.mutex);
+		Entry entry = { task, token };
+		queue.tasks[priority].push_back(entry);
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(mSleepMutex);
+		mPending++;
+	}
+	mWake.notify_one();
+}
+
+void TaskScheduler::submit(const Task& task, const Task& then, Priority priority, const CancellationToken& token)
+{
+	submit([this, task, then, token] {
+		task();
+		runOnMainThread(then, token);
+	}, priority, token);
+}
+
+void TaskScheduler::runOnMainThread(const Task& then, const CancellationToken& token)
+{
+	{
+		std::unique_lock<std::mutex> lock(mMainMutex);
+		Entry entry = { then, token };
+		mMainThread.push_back(entry);
+	}
+
+	// wake up the main loop in case it's waiting for events while idle
+	SDL_Event wake;
+	SDL_zero(wake);
+	wake.type = SDL_USEREVENT;
+	SDL_PushEvent(&wake);
+}
+
+bool TaskScheduler::update(int budgetMs)
+{
+	const unsigned int start = SDL_GetTicks();
+	bool ran = false;
+	while(true)
+	{
+		Entry entry;
+		{
+			std::unique_lock<std::mutex> lock(mMainMutex);
+			if(mMainThread.empty())
+				return ran;
+
+			entry = std::move(mMainThread.front());
+			mMainThread.pop_front();
+		}
+
+		// cancelled ones don't count against the budget
+		if(entry.token.isCancelled())
+			continue;
+
+		entry.task();
+		ran = true;
+
+		if((int)(SDL_GetTicks() - start) >= budgetMs)
+		{
+			// nothing may happen to wake up the main loop before the rest is done
+			if(getMainThreadBacklog())
+			{
+				SDL_Event wake;
+				SDL_zero(wake);
+				wake.type = SDL_USEREVENT;
+				SDL_PushEvent(&wake);
+			}
+			return ran;
+		}
+	}
+}
+
+size_t TaskScheduler::getMainThreadBacklog()
+{
+	std::unique_lock<std::mutex> lock(mMainMutex);
+	return mMainThread.size();
+}
+
+bool TaskScheduler::take(unsigned int index, Entry& entry)
+{
+	for(int priority = 0; priority < PRIORITY_COUNT; priority++)
+	{
+		for(unsigned int i = 0; i < mWorkerCount; i++)
+		{
+			const bool own = (i == 0);
+			WorkerQueue& queue = *mQueues[(index + i) % mWorkerCount];
+			std::unique_lock<std::mutex> lock(queue.mutex);
+			std::deque<Entry>& tasks = queue.tasks[priority];
+			if(tasks.empty())
+				continue;
+
+			if(own)
+			{
+				entry = std::move(tasks.back());
+				tasks.pop_back();
+			}else{
+				entry = std::move(tasks.front());
+				tasks.pop_front();
+			}
+			lock.unlock();
+
+			std::unique_lock<std::mutex> sleepLock(mSleepMutex);
+			mPending--;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void TaskScheduler::runWorker(unsigned int index)
+{
+	sWorkerIndex = (int)index;
+
+	while(true)
+	{
+		Entry entry;
+		if(take(index, entry))
+		{
+			if(!entry.token.isCancelled())
+				entry.task();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(mSleepMutex);
+		mWake.wait(lock, [this] { return mQuit || mPending > 0; });
+		if(mQuit)
+			return;
+	}
+}
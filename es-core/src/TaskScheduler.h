@@ -0,0 +1,97 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Copies share one flag. Whoever queued a task cancels it through its token, the task checks it between steps if it's
+// long, and a task (or continuation) that hasn't started yet when it's cancelled never does.
+class CancellationToken
+{
+public:
+	CancellationToken() : mFlag(std::make_shared< std::atomic<bool> >(false)) {}
+
+	inline void cancel() { *mFlag = true; }
+	inline bool isCancelled() const { return *mFlag; }
+
+private:
+	std::shared_ptr< std::atomic<bool> > mFlag;
+};
+
+// One thread pool for all the CPU work done off the main thread (decoding, resizing, hashing...), one worker per core
+// besides the main thread's. Each worker has its own queue: what it queues itself it runs next (newest first, while the
+// data is still in cache), and a worker with nothing left takes the oldest task of another. Interactive tasks (whatever
+// is about to be on screen) are all taken before any background one.
+// Not for calls that can hang (files on a network mount), those belong on AsyncIO: a stuck task holds on to its worker.
+class TaskScheduler
+{
+public:
+	enum Priority
+	{
+		PRIORITY_INTERACTIVE,
+		PRIORITY_BACKGROUND,
+		PRIORITY_COUNT
+	};
+
+	typedef std::function<void()> Task;
+
+	static TaskScheduler* getInstance();
+
+	// Runs task on a worker, unless token was cancelled before it got there. Thread-safe.
+	void submit(const Task& task, Priority priority = PRIORITY_BACKGROUND, const CancellationToken& token = CancellationToken());
+
+	// As above, then runs then on the main thread (from update()) once task is done, also unless token is cancelled by then.
+	void submit(const Task& task, const Task& then, Priority priority = PRIORITY_BACKGROUND, const CancellationToken& token = CancellationToken());
+
+	// Runs then on the main thread from update(), in the order they were queued. Thread-safe.
+	// This is where work that was done in the background gets onto the GPU (e.g. decoded textures), so it's spread over frames.
+	void runOnMainThread(const Task& then, const CancellationToken& token = CancellationToken());
+
+	// Runs main thread jobs until budgetMs has passed (always at least one), the rest wait for the next frame.
+	// Call once per frame from the main thread, returns true if it ran any.
+	bool update(int budgetMs);
+
+	// main thread jobs waiting for update()
+	size_t getMainThreadBacklog();
+
+	inline unsigned int getWorkerCount() const { return mWorkerCount; }
+
+private:
+	TaskScheduler();
+	~TaskScheduler();
+
+	struct Entry
+	{
+		Task task;
+		CancellationToken token;
+	};
+
+	// one per worker, guarded by its own mutex so workers only ever wait on each other while stealing
+	struct WorkerQueue
+	{
+		std::mutex mutex;
+		std::deque<Entry> tasks[PRIORITY_COUNT];
+	};
+
+	void runWorker(unsigned int index);
+	bool take(unsigned int index, Entry& entry); // own queue's newest first, then the others' oldest
+
+	const unsigned int mWorkerCount;
+	std::vector< std::unique_ptr<WorkerQueue> > mQueues;
+	std::vector<std::thread> mThreads; // started on the first submit(), so nothing runs that isn't needed
+	std::once_flag mStarted;
+	std::atomic<unsigned int> mNextQueue; // where tasks from outside the pool go, round robin
+
+	std::mutex mSleepMutex;
+	std::condition_variable mWake;
+	unsigned int mPending; // tasks queued and not taken yet, guarded by mSleepMutex
+	bool mQuit;
+
+	std::mutex mMainMutex;
+	std::deque<Entry> mMainThread; // jobs for update()
+};
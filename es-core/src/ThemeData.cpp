@@ -3,10 +3,18 @@
 #include "resources/Font.h"
 #include "Sound.h"
 #include "resources/TextureResource.h"
+#include "BinaryIO.h"
 #include "Log.h"
 #include "Settings.h"
+#include "MemoryStats.h"
 #include "pugixml/pugixml.hpp"
+#include "XmlFile.h"
 #include <boost/assign.hpp>
+#include <mutex>
+#include <fstream>
+#include <algorithm>
+#include <stdint.h>
+#include <string.h>
 
 #include "components/ImageComponent.h"
 #include "components/TextComponent.h"
@@ -23,6 +31,83 @@ ElementMapType makeMap(const T& mapInit)
 	return m;
 }
 
+static const char* PROPERTY_NAMES[ThemeProperties::PROPERTY_COUNT] = {
+	"pos",
+	"size",
+	"maxSize",
+	"origin",
+	"path",
+	"tile",
+	"mipmap",
+	"color",
+	"text",
+	"fontPath",
+	"fontSize",
+	"alignment",
+	"forceUppercase",
+	"lineSpacing",
+	"selectorColor",
+	"selectedColor",
+	"primaryColor",
+	"secondaryColor",
+	"scrollSound",
+	"horizontalMargin",
+	"filledPath",
+	"unfilledPath",
+	"textColor",
+	"iconColor",
+	"volume",
+	"delay",
+	"frames",
+	"frameCount",
+	"frameTime",
+	"loop"
+};
+
+const char* ThemeProperties::getName(PropertyId id)
+{
+	return id < PROPERTY_COUNT ? PROPERTY_NAMES[id] : "";
+}
+
+ThemeProperties::PropertyId ThemeProperties::getId(const char* name)
+{
+	// only used while parsing, not worth more than a linear search
+	for(int i = 0; i < PROPERTY_COUNT; i++)
+	{
+		if(strcmp(PROPERTY_NAMES[i], name) == 0)
+			return (PropertyId)i;
+	}
+	return PROPERTY_COUNT;
+}
+
+void ThemeData::ThemeElement::set(ThemeProperties::PropertyId prop, const Property& value)
+{
+	for(auto it = properties.begin(); it != properties.end(); it++)
+	{
+		if(it->first == prop)
+		{
+			it->second = value;
+			return;
+		}
+	}
+	properties.push_back(std::pair<ThemeProperties::PropertyId, Property>(prop, value));
+}
+
+bool ThemeData::ThemeElement::operator==(const ThemeElement& other) const
+{
+	if(type != other.type || extra != other.extra || properties.size() != other.properties.size())
+		return false;
+
+	// set() never adds a property twice, so the same size and every one found is the same set
+	for(auto it = properties.begin(); it != properties.end(); it++)
+	{
+		const Property* value = other.find(it->first);
+		if(value == NULL || !(*value == it->second))
+			return false;
+	}
+	return true;
+}
+
 std::map< std::string, ElementMapType > ThemeData::sElementMap = boost::assign::map_list_of
 	("image", makeMap(boost::assign::map_list_of
 		("pos", NORMALIZED_PAIR)
@@ -31,7 +116,12 @@ std::map< std::string, ElementMapType > ThemeData::sElementMap = boost::assign::
 		("origin", NORMALIZED_PAIR)
 		("path", PATH)
 		("tile", BOOLEAN)
-		("color", COLOR)))
+		("mipmap", BOOLEAN)
+		("color", COLOR)
+		("frames", NORMALIZED_PAIR)
+		("frameCount", FLOAT)
+		("frameTime", FLOAT)
+		("loop", BOOLEAN)))
 	("text", makeMap(boost::assign::map_list_of
 		("pos", NORMALIZED_PAIR)
 		("size", NORMALIZED_PAIR)
@@ -76,7 +166,13 @@ std::map< std::string, ElementMapType > ThemeData::sElementMap = boost::assign::
 		("filledPath", PATH)
 		("unfilledPath", PATH)))
 	("sound", makeMap(boost::assign::map_list_of
-		("path", PATH)))
+		("path", PATH)
+		("volume", FLOAT)))
+	("video", makeMap(boost::assign::map_list_of
+		("pos", NORMALIZED_PAIR)
+		("size", NORMALIZED_PAIR)
+		("origin", NORMALIZED_PAIR)
+		("delay", FLOAT)))
 	("helpsystem", makeMap(boost::assign::map_list_of
 		("pos", NORMALIZED_PAIR)
 		("textColor", COLOR)
@@ -136,7 +232,23 @@ std::string resolvePath(const char* in, const fs::path& relative)
 
 
 
-ThemeData::ThemeData()
+std::map< std::string, std::shared_ptr<const ThemeData::ParsedFile> > ThemeData::sParsedFiles;
+
+// systems can load their themes on several threads at once (see SystemData::loadConfig)
+static std::mutex sParsedFilesMutex;
+
+static bool sParsedFilesDirty = false; // parsed something that isn't in the binary cache yet
+static std::string sCacheSet; // theme set whose binary cache was read
+static bool sCacheLoaded = false;
+
+static std::time_t getModifiedTime(const std::string& path)
+{
+	boost::system::error_code ec;
+	std::time_t time = fs::last_write_time(path, ec);
+	return ec ? 0 : time;
+}
+
+ThemeData::ThemeData() : mViews(std::make_shared<ViewMap>())
 {
 	mVersion = 0;
 }
@@ -152,10 +264,130 @@ void ThemeData::loadFile(const std::string& path)
 		throw error << "File does not exist!";
 
 	mVersion = 0;
-	mViews.clear();
+	mViews = std::make_shared<ViewMap>();
+
+	std::lock_guard<std::mutex> lock(sParsedFilesMutex);
+	loadCache();
+	std::shared_ptr<const ParsedFile> file = getParsedFile(path, error);
+
+	// parse version
+	mVersion = file->version;
+	if(mVersion == -404)
+		throw error << "<formatVersion> tag missing!\n   It's either out of date or you need to add <formatVersion>" << CURRENT_THEME_FORMAT_VERSION << "</formatVersion> inside your <theme> tag.";
+
+	if(mVersion < MINIMUM_THEME_FORMAT_VERSION)
+		throw error << "Theme uses format version " << mVersion << ". Minimum supported version is " << MINIMUM_THEME_FORMAT_VERSION << ".";
+
+	// another system (or the last reload) already merged this exact file
+	if(!file->merged)
+	{
+		std::shared_ptr<ViewMap> views = std::make_shared<ViewMap>();
+		mergeFile(*file, *views);
+		file->merged = views;
+		file->updateMemoryUsage();
+	}
+
+	mViews = file->merged;
+	mFile = file;
+}
+
+bool ThemeData::isModified() const
+{
+	return mFile && !isUpToDate(*mFile);
+}
+
+void ThemeData::getChanges(const ThemeData& from, const ThemeData& to, const std::string& view, ViewChanges& out)
+{
+	static const ThemeView empty;
+	auto fromIt = from.mViews->find(view);
+	auto toIt = to.mViews->find(view);
+	const ThemeView& fromView = fromIt != from.mViews->end() ? fromIt->second : empty;
+	const ThemeView& toView = toIt != to.mViews->end() ? toIt->second : empty;
+
+	for(auto it = toView.elements.begin(); it != toView.elements.end(); it++)
+	{
+		auto old = fromView.elements.find(it->first);
+		if(old == fromView.elements.end() || old->second != it->second)
+		{
+			out.elements.insert(it->first);
+			if(it->second.extra || (old != fromView.elements.end() && old->second.extra))
+				out.extras = true;
 
-	pugi::xml_document doc;
-	pugi::xml_parse_result res = doc.load_file(path.c_str());
+			if(old != fromView.elements.end() && !old->second.extra)
+			{
+				for(auto prop = old->second.properties.begin(); prop != old->second.properties.end(); prop++)
+				{
+					if(!it->second.has(prop->first))
+						out.lostProperties = true;
+				}
+			}
+		}
+	}
+
+	// removed ones
+	for(auto it = fromView.elements.begin(); it != fromView.elements.end(); it++)
+	{
+		if(toView.elements.find(it->first) == toView.elements.end())
+		{
+			out.elements.insert(it->first);
+			if(it->second.extra)
+				out.extras = true;
+			else
+				out.lostProperties = true;
+		}
+	}
+
+	// extras are made in file order, moving one around changes what's drawn on top
+	if(!out.extras)
+		out.extras = getExtraKeys(fromView) != getExtraKeys(toView);
+}
+
+std::vector<std::string> ThemeData::getExtraKeys(const ThemeView& view)
+{
+	std::vector<std::string> keys;
+	for(auto it = view.orderedKeys.begin(); it != view.orderedKeys.end(); it++)
+	{
+		if(view.elements.at(*it).extra)
+			keys.push_back(*it);
+	}
+	return keys;
+}
+
+std::shared_ptr<const ThemeData::ParsedFile> ThemeData::getParsedFile(const std::string& path, ThemeException& error)
+{
+	auto it = sParsedFiles.find(path);
+	if(it != sParsedFiles.end() && isUpToDate(*it->second))
+		return it->second;
+
+	// only something it includes changed: keep what was parsed from this file and just pick up its includes again
+	if(it != sParsedFiles.end() && getModifiedTime(path) == it->second->modified)
+	{
+		const std::shared_ptr<const ParsedFile> old = it->second;
+		std::shared_ptr<ParsedFile> file = std::make_shared<ParsedFile>();
+		file->path = path;
+		file->modified = old->modified;
+		file->version = old->version;
+		file->views = old->views;
+
+		for(auto inc = old->includes.begin(); inc != old->includes.end(); inc++)
+		{
+			mPaths.push_back((*inc)->path);
+			file->includes.push_back(getParsedFile((*inc)->path, error));
+			mPaths.pop_back();
+		}
+		file->updateMemoryUsage();
+
+		sParsedFiles[path] = file;
+		sParsedFilesDirty = true;
+		return file;
+	}
+
+	std::shared_ptr<ParsedFile> file = std::make_shared<ParsedFile>();
+	file->path = path;
+	file->modified = getModifiedTime(path);
+
+	XmlFile doc;
+	pugi::xml_parse_result res = doc.load(path);
 	if(!res)
 		throw error << "XML parsing error: \n    " << res.description();
 
@@ -163,20 +395,405 @@ void ThemeData::loadFile(const std::string& path)
 	if(!root)
 		throw error << "Missing <theme> tag!";
 
-	// parse version
-	mVersion = root.child("formatVersion").text().as_float(-404);
-	if(mVersion == -404)
-		throw error << "<formatVersion> tag missing!\n   It's either out of date or you need to add <formatVersion>" << CURRENT_THEME_FORMAT_VERSION << "</formatVersion> inside your <theme> tag.";
+	// only checked for the root file of a theme
+	file->version = root.child("formatVersion").text().as_float(-404);
 
-	if(mVersion < MINIMUM_THEME_FORMAT_VERSION)
-		throw error << "Theme uses format version " << mVersion << ". Minimum supported version is " << MINIMUM_THEME_FORMAT_VERSION << ".";
+	parseIncludes(root, *file);
+	parseViews(root, *file);
+	file->updateMemoryUsage();
 
-	parseIncludes(root);
-	parseViews(root);
+	sParsedFiles[path] = file;
+	sParsedFilesDirty = true;
+	return file;
+}
+
+ThemeData::ParsedFile::~ParsedFile()
+{
+	MemoryStats::add(MemoryStats::THEME, -(ptrdiff_t)memoryUsage);
 }
 
+void ThemeData::ParsedFile::updateMemoryUsage() const
+{
+	size_t bytes = sizeof(ParsedFile) + MemoryStats::getHeapSize(path) + includes.capacity() * sizeof(includes[0]) + 
+		views.capacity() * sizeof(views[0]);
+	for(auto it = views.begin(); it != views.end(); it++)
+		bytes += MemoryStats::getHeapSize(it->first) + getMemoryUsage(it->second);
+
+	if(merged)
+	{
+		for(auto it = merged->begin(); it != merged->end(); it++)
+			bytes += sizeof(*it) + 2 * sizeof(void*) + MemoryStats::getHeapSize(it->first) + getMemoryUsage(it->second);
+	}
 
-void ThemeData::parseIncludes(const pugi::xml_node& root)
+	MemoryStats::add(MemoryStats::THEME, (ptrdiff_t)bytes - (ptrdiff_t)memoryUsage);
+	memoryUsage = bytes;
+}
+
+size_t ThemeData::getMemoryUsage(const ThemeView& view)
+{
+	size_t bytes = view.orderedKeys.capacity() * sizeof(std::string);
+	for(auto it = view.orderedKeys.begin(); it != view.orderedKeys.end(); it++)
+		bytes += MemoryStats::getHeapSize(*it);
+
+	for(auto it = view.elements.begin(); it != view.elements.end(); it++)
+	{
+		const ThemeElement& elem = it->second;
+		bytes += sizeof(*it) + 2 * sizeof(void*) + MemoryStats::getHeapSize(it->first) + MemoryStats::getHeapSize(elem.type) + 
+			elem.properties.capacity() * sizeof(elem.properties[0]);
+
+		for(auto prop = elem.properties.begin(); prop != elem.properties.end(); prop++)
+		{
+			const std::string* str = boost::get<std::string>(&prop->second);
+			if(str != NULL)
+				bytes += MemoryStats::getHeapSize(*str);
+		}
+	}
+
+	return bytes;
+}
+
+bool ThemeData::isUpToDate(const ParsedFile& file)
+{
+	if(getModifiedTime(file.path) != file.modified)
+		return false;
+
+	for(auto it = file.includes.begin(); it != file.includes.end(); it++)
+	{
+		if(!isUpToDate(**it))
+			return false;
+	}
+
+	return true;
+}
+
+void ThemeData::mergeFile(const ParsedFile& file, ViewMap& views)
+{
+	// includes come first, so the including file overrides them
+	for(auto it = file.includes.begin(); it != file.includes.end(); it++)
+		mergeFile(**it, views);
+
+	for(auto it = file.views.begin(); it != file.views.end(); it++)
+		mergeView(it->second, views[it->first]);
+}
+
+void ThemeData::mergeView(const ThemeView& from, ThemeView& to)
+{
+	for(auto keyIt = from.orderedKeys.begin(); keyIt != from.orderedKeys.end(); keyIt++)
+	{
+		const ThemeElement& src = from.elements.at(*keyIt);
+
+		auto elemIt = to.elements.find(*keyIt);
+		if(elemIt == to.elements.end())
+		{
+			to.elements.insert(std::pair<std::string, ThemeElement>(*keyIt, src));
+			to.orderedKeys.push_back(*keyIt);
+			continue;
+		}
+
+		// same as parsing the element again on top of the old one
+		ThemeElement& dest = elemIt->second;
+		dest.type = src.type;
+		dest.extra = src.extra;
+		for(auto propIt = src.properties.begin(); propIt != src.properties.end(); propIt++)
+			dest.set(propIt->first, propIt->second);
+	}
+}
+
+
+// binary theme cache, one per theme set (~/.emulationstation/cache/[set].themecache)
+// bump this if the layout below changes
+static const char THEMECACHE_MAGIC[4] = { 'E', 'S', 'T', 'C' };
+static const uint32_t THEMECACHE_VERSION = 2; // 2: video elements
+
+// the order of ThemeElement::properties' variant types
+enum ThemeCacheValueType
+{
+	VALUE_PAIR,
+	VALUE_STRING,
+	VALUE_UINT,
+	VALUE_FLOAT,
+	VALUE_BOOL
+};
+
+static std::string getThemeCachePath(const std::string& set)
+{
+	return getHomePath() + "/.emulationstation/cache/" + set + ".themecache";
+}
+
+void ThemeData::loadCache()
+{
+	if(!Settings::getInstance()->getBool("ThemeCache"))
+		return;
+
+	const std::string set = Settings::getInstance()->getString("ThemeSet");
+	if(sCacheLoaded && sCacheSet == set)
+		return;
+
+	sCacheLoaded = true;
+	sCacheSet = set;
+
+	const std::string path = getThemeCachePath(set);
+	std::ifstream in(path.c_str(), std::ios::in | std::ios::binary);
+	if(!in.is_open())
+		return;
+
+	// every record takes at least 4 bytes, so a count that wouldn't fit in the file is damage, and nothing that big
+	// gets allocated for it; the themes are parsed as if there was no cache
+	in.seekg(0, in.end);
+	const uint64_t maxCount = (uint64_t)std::max<std::streamoff>(in.tellg(), 0) / 4;
+	in.seekg(0, in.beg);
+
+	char magic[4];
+	uint32_t version, fileCount;
+	if(!in.read(magic, 4) || memcmp(magic, THEMECACHE_MAGIC, 4) != 0 || !readU32(in, version) || version != THEMECACHE_VERSION)
+	{
+		LOG(LogWarning) << "Theme cache \"" << path << "\" is from an incompatible version, ignoring it";
+		return;
+	}
+
+	if(!readU32(in, fileCount) || fileCount > maxCount)
+	{
+		LOG(LogWarning) << "Theme cache \"" << path << "\" is corrupt, ignoring it";
+		return;
+	}
+
+	// includes are stored by path and linked up once everything is read
+	std::map< std::string, std::shared_ptr<ParsedFile> > files;
+	std::vector< std::pair<ParsedFile*, std::string> > includes;
+
+	for(uint32_t i = 0; i < fileCount; i++)
+	{
+		std::shared_ptr<ParsedFile> file = std::make_shared<ParsedFile>();
+		int64_t modified;
+		uint32_t includeCount, viewCount;
+		if(!readString(in, file->path) || !readI64(in, modified) || !readFloat(in, file->version) || !readU32(in, includeCount)
+			|| includeCount > maxCount)
+		{
+			LOG(LogWarning) << "Theme cache \"" << path << "\" is truncated, ignoring it";
+			return;
+		}
+		file->modified = (std::time_t)modified;
+
+		for(uint32_t j = 0; j < includeCount; j++)
+		{
+			std::string include;
+			if(!readString(in, include))
+			{
+				LOG(LogWarning) << "Theme cache \"" << path << "\" is truncated, ignoring it";
+				return;
+			}
+			includes.push_back(std::pair<ParsedFile*, std::string>(file.get(), include));
+		}
+
+		if(!readU32(in, viewCount) || viewCount > maxCount)
+		{
+			LOG(LogWarning) << "Theme cache \"" << path << "\" is truncated, ignoring it";
+			return;
+		}
+
+		file->views.resize(viewCount);
+		for(uint32_t j = 0; j < viewCount; j++)
+		{
+			ThemeView& view = file->views[j].second;
+			uint32_t elemCount;
+			if(!readString(in, file->views[j].first) || !readU32(in, elemCount) || elemCount > maxCount)
+			{
+				LOG(LogWarning) << "Theme cache \"" << path << "\" is truncated, ignoring it";
+				return;
+			}
+
+			for(uint32_t k = 0; k < elemCount; k++)
+			{
+				std::string elemKey;
+				ThemeElement elem;
+				uint32_t extra, propCount;
+				if(!readString(in, elemKey) || !readString(in, elem.type) || !readU32(in, extra) || !readU32(in, propCount)
+					|| propCount > ThemeProperties::PROPERTY_COUNT)
+				{
+					LOG(LogWarning) << "Theme cache \"" << path << "\" is truncated, ignoring it";
+					return;
+				}
+				elem.extra = (extra != 0);
+
+				for(uint32_t p = 0; p < propCount; p++)
+				{
+					std::string name, str;
+					uint32_t type, u;
+					float x, y;
+					bool ok = readString(in, name) && readU32(in, type);
+					ThemeProperties::PropertyId id = ThemeProperties::getId(name.c_str());
+					if(id == ThemeProperties::PROPERTY_COUNT)
+						ok = false;
+					if(ok)
+					{
+						switch(type)
+						{
+						case VALUE_PAIR:
+							ok = readFloat(in, x) && readFloat(in, y);
+							elem.set(id, Eigen::Vector2f(x, y));
+							break;
+						case VALUE_STRING:
+							ok = readString(in, str);
+							elem.set(id, str);
+							break;
+						case VALUE_UINT:
+							ok = readU32(in, u);
+							elem.set(id, (unsigned int)u);
+							break;
+						case VALUE_FLOAT:
+							ok = readFloat(in, x);
+							elem.set(id, x);
+							break;
+						case VALUE_BOOL:
+							ok = readU32(in, u);
+							elem.set(id, (u != 0));
+							break;
+						default:
+							ok = false;
+						}
+					}
+
+					if(!ok)
+					{
+						LOG(LogWarning) << "Theme cache \"" << path << "\" is corrupt, ignoring it";
+						return;
+					}
+				}
+
+				view.elements[elemKey] = elem;
+				view.orderedKeys.push_back(elemKey);
+			}
+		}
+
+		file->updateMemoryUsage();
+		files[file->path] = file;
+	}
+
+	for(auto it = includes.begin(); it != includes.end(); it++)
+	{
+		auto inc = files.find(it->second);
+		if(inc == files.end())
+		{
+			LOG(LogWarning) << "Theme cache \"" << path << "\" is corrupt, ignoring it";
+			return;
+		}
+		it->first->includes.push_back(inc->second);
+	}
+
+	// whatever is already parsed is at least as new, stale entries get replaced by getParsedFile()
+	for(auto it = files.begin(); it != files.end(); it++)
+		sParsedFiles.insert(std::pair< std::string, std::shared_ptr<const ParsedFile> >(it->first, it->second));
+
+	LOG(LogInfo) << "Read " << files.size() << " parsed theme files from " << path;
+}
+
+void ThemeData::saveCache()
+{
+	std::lock_guard<std::mutex> lock(sParsedFilesMutex);
+
+	if(!sParsedFilesDirty || !sCacheLoaded || !Settings::getInstance()->getBool("ThemeCache"))
+		return;
+
+	// an up to date file's includes are up to date too, so they get written as well
+	std::vector<const ParsedFile*> files;
+	for(auto it = sParsedFiles.begin(); it != sParsedFiles.end(); it++)
+	{
+		if(isUpToDate(*it->second))
+			files.push_back(it->second.get());
+	}
+
+	const fs::path path = getThemeCachePath(sCacheSet);
+	const fs::path tmpPath = path.generic_string() + ".tmp";
+
+	boost::system::error_code ec;
+	fs::create_directories(path.parent_path(), ec);
+
+	{
+		std::ofstream out(tmpPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if(!out.is_open())
+		{
+			LOG(LogError) << "Could not write theme cache \"" << tmpPath.generic_string() << "\"";
+			return;
+		}
+
+		out.write(THEMECACHE_MAGIC, 4);
+		writeU32(out, THEMECACHE_VERSION);
+		writeU32(out, files.size());
+
+		for(auto it = files.begin(); it != files.end(); it++)
+		{
+			const ParsedFile& file = **it;
+			writeString(out, file.path);
+			writeI64(out, (int64_t)file.modified);
+			writeFloat(out, file.version);
+
+			writeU32(out, file.includes.size());
+			for(auto inc = file.includes.begin(); inc != file.includes.end(); inc++)
+				writeString(out, (*inc)->path);
+
+			writeU32(out, file.views.size());
+			for(auto view = file.views.begin(); view != file.views.end(); view++)
+			{
+				writeString(out, view->first);
+				writeU32(out, view->second.orderedKeys.size());
+				for(auto key = view->second.orderedKeys.begin(); key != view->second.orderedKeys.end(); key++)
+				{
+					const ThemeElement& elem = view->second.elements.at(*key);
+					writeString(out, *key);
+					writeString(out, elem.type);
+					writeU32(out, elem.extra);
+					writeU32(out, elem.properties.size());
+					for(auto prop = elem.properties.begin(); prop != elem.properties.end(); prop++)
+					{
+						writeString(out, ThemeProperties::getName(prop->first));
+						writeU32(out, prop->second.which());
+						switch(prop->second.which())
+						{
+						case VALUE_PAIR:
+						{
+							const Eigen::Vector2f& pair = boost::get<Eigen::Vector2f>(prop->second);
+							writeFloat(out, pair.x());
+							writeFloat(out, pair.y());
+							break;
+						}
+						case VALUE_STRING:
+							writeString(out, boost::get<std::string>(prop->second));
+							break;
+						case VALUE_UINT:
+							writeU32(out, boost::get<unsigned int>(prop->second));
+							break;
+						case VALUE_FLOAT:
+							writeFloat(out, boost::get<float>(prop->second));
+							break;
+						case VALUE_BOOL:
+							writeU32(out, boost::get<bool>(prop->second));
+							break;
+						}
+					}
+				}
+			}
+		}
+
+		if(!out.good())
+		{
+			LOG(LogError) << "Error writing theme cache \"" << tmpPath.generic_string() << "\"";
+			return;
+		}
+	}
+
+	// replace the old cache in one step so a crash never leaves a half-written file behind
+	fs::rename(tmpPath, path, ec);
+	if(ec)
+	{
+		LOG(LogError) << "Could not replace theme cache \"" << path.generic_string() << "\": " << ec.message();
+		fs::remove(tmpPath, ec);
+		return;
+	}
+
+	sParsedFilesDirty = false;
+}
+
+void ThemeData::parseIncludes(const pugi::xml_node& root, ParsedFile& file)
 {
 	ThemeException error;
 	error.setFiles(mPaths);
@@ -191,24 +808,12 @@ void ThemeData::parseIncludes(const pugi::xml_node& root)
 		error << "    from included file \"" << relPath << "\":\n    ";
 
 		mPaths.push_back(path);
-
-		pugi::xml_document includeDoc;
-		pugi::xml_parse_result result = includeDoc.load_file(path.c_str());
-		if(!result)
-			throw error << "Error parsing file: \n    " << result.description();
-
-		pugi::xml_node root = includeDoc.child("theme");
-		if(!root)
-			throw error << "Missing <theme> tag!";
-
-		parseIncludes(root);
-		parseViews(root);
-
+		file.includes.push_back(getParsedFile(path, error));
 		mPaths.pop_back();
 	}
 }
 
-void ThemeData::parseViews(const pugi::xml_node& root)
+void ThemeData::parseViews(const pugi::xml_node& root, ParsedFile& file)
 {
 	ThemeException error;
 	error.setFiles(mPaths);
@@ -219,6 +824,9 @@ void ThemeData::parseViews(const pugi::xml_node& root)
 		if(!node.attribute("name"))
 			throw error << "View missing \"name\" attribute!";
 
+		ThemeView view;
+		parseView(node, view);
+
 		const char* delim = " \t\r\n,";
 		const std::string nameAttr = node.attribute("name").as_string();
 		size_t prevOff = nameAttr.find_first_not_of(delim, 0);
@@ -230,8 +838,7 @@ void ThemeData::parseViews(const pugi::xml_node& root)
 			prevOff = nameAttr.find_first_not_of(delim, off);
 			off = nameAttr.find_first_of(delim, prevOff);
 			
-			ThemeView& view = mViews.insert(std::pair<std::string, ThemeView>(viewKey, ThemeView())).first->second;
-			parseView(node, view);
+			file.views.push_back(std::pair<std::string, ThemeView>(viewKey, view));
 		}
 	}
 }
@@ -284,6 +891,10 @@ void ThemeData::parseElement(const pugi::xml_node& root, const std::map<std::str
 		if(typeIt == typeMap.end())
 			throw error << "Unknown property type \"" << node.name() << "\" (for element of type " << root.name() << ").";
 
+		const ThemeProperties::PropertyId id = ThemeProperties::getId(node.name());
+		if(id == ThemeProperties::PROPERTY_COUNT)
+			throw error << "Unknown property \"" << node.name() << "\" (for element of type " << root.name() << ").";
+
 		switch(typeIt->second)
 		{
 		case NORMALIZED_PAIR:
@@ -299,11 +910,11 @@ void ThemeData::parseElement(const pugi::xml_node& root, const std::map<std::str
 
 			Eigen::Vector2f val(atof(first.c_str()), atof(second.c_str()));
 
-			element.properties[node.name()] = val;
+			element.set(id, val);
 			break;
 		}
 		case STRING:
-			element.properties[node.name()] = std::string(node.text().as_string());
+			element.set(id, std::string(node.text().as_string()));
 			break;
 		case PATH:
 		{
@@ -317,17 +928,17 @@ void ThemeData::parseElement(const pugi::xml_node& root, const std::map<std::str
 					ss << "(which resolved to \"" << path << "\") ";
 				LOG(LogWarning) << ss.str();
 			}
-			element.properties[node.name()] = path;
+			element.set(id, path);
 			break;
 		}
 		case COLOR:
-			element.properties[node.name()] = getHexColor(node.text().as_string());
+			element.set(id, getHexColor(node.text().as_string()));
 			break;
 		case FLOAT:
-			element.properties[node.name()] = node.text().as_float();
+			element.set(id, node.text().as_float());
 			break;
 		case BOOLEAN:
-			element.properties[node.name()] = node.text().as_bool();
+			element.set(id, node.text().as_bool());
 			break;
 		default:
 			throw error << "Unknown ElementPropertyType for \"" << root.attribute("name").as_string() << "\", property " << node.name();
@@ -338,8 +949,8 @@ void ThemeData::parseElement(const pugi::xml_node& root, const std::map<std::str
 
 const ThemeData::ThemeElement* ThemeData::getElement(const std::string& view, const std::string& element, const std::string& expectedType) const
 {
-	auto viewIt = mViews.find(view);
-	if(viewIt == mViews.end())
+	auto viewIt = mViews->find(view);
+	if(viewIt == mViews->end())
 		return NULL; // not found
 
 	auto elemIt = viewIt->second.elements.find(element);
@@ -383,13 +994,13 @@ std::vector<GuiComponent*> ThemeData::makeExtras(const std::shared_ptr<ThemeData
 {
 	std::vector<GuiComponent*> comps;
 
-	auto viewIt = theme->mViews.find(view);
-	if(viewIt == theme->mViews.end())
+	auto viewIt = theme->mViews->find(view);
+	if(viewIt == theme->mViews->end())
 		return comps;
 	
 	for(auto it = viewIt->second.orderedKeys.begin(); it != viewIt->second.orderedKeys.end(); it++)
 	{
-		ThemeElement& elem = viewIt->second.elements.at(*it);
+		const ThemeElement& elem = viewIt->second.elements.at(*it);
 		if(elem.extra)
 		{
 			GuiComponent* comp = NULL;
@@ -425,19 +1036,36 @@ ThemeExtras::~ThemeExtras()
 }
 
 
-std::map<std::string, ThemeSet> ThemeData::getThemeSets()
-{
-	std::map<std::string, ThemeSet> sets;
+// the theme sets found by the last scan, only scanned again when one of the theme folders' mtime changes
+// (which it does when a set is added, removed or renamed)
+#define THEME_SET_FOLDER_COUNT 2
+static std::mutex sThemeSetsMutex;
+static std::map<std::string, ThemeSet> sThemeSets;
+static std::time_t sThemeSetFolderTimes[THEME_SET_FOLDER_COUNT];
+static bool sThemeSetsScanned = false;
 
-	static const size_t pathCount = 2;
-	fs::path paths[pathCount] = { 
+// call with sThemeSetsMutex held
+static const std::map<std::string, ThemeSet>& getCachedThemeSets()
+{
+	const fs::path paths[THEME_SET_FOLDER_COUNT] = { 
 		"/etc/emulationstation/themes", 
 		getHomePath() + "/.emulationstation/themes" 
 	};
 
+	std::time_t times[THEME_SET_FOLDER_COUNT];
+	for(size_t i = 0; i < THEME_SET_FOLDER_COUNT; i++)
+		times[i] = getModifiedTime(paths[i].string());
+
+	if(sThemeSetsScanned && memcmp(times, sThemeSetFolderTimes, sizeof(times)) == 0)
+		return sThemeSets;
+
+	sThemeSets.clear();
+	memcpy(sThemeSetFolderTimes, times, sizeof(times));
+	sThemeSetsScanned = true;
+
 	fs::directory_iterator end;
 
-	for(size_t i = 0; i < pathCount; i++)
+	for(size_t i = 0; i < THEME_SET_FOLDER_COUNT; i++)
 	{
 		if(!fs::is_directory(paths[i]))
 			continue;
@@ -447,17 +1075,25 @@ std::map<std::string, ThemeSet> ThemeData::getThemeSets()
 			if(fs::is_directory(*it))
 			{
 				ThemeSet set = {*it};
-				sets[set.getName()] = set;
+				sThemeSets[set.getName()] = set;
 			}
 		}
 	}
 
-	return sets;
+	LOG(LogDebug) << "Found " << sThemeSets.size() << " theme sets";
+	return sThemeSets;
+}
+
+std::map<std::string, ThemeSet> ThemeData::getThemeSets()
+{
+	std::lock_guard<std::mutex> lock(sThemeSetsMutex);
+	return getCachedThemeSets();
 }
 
 fs::path ThemeData::getThemeFromCurrentSet(const std::string& system)
 {
-	auto themeSets = ThemeData::getThemeSets();
+	std::lock_guard<std::mutex> lock(sThemeSetsMutex);
+	const std::map<std::string, ThemeSet>& themeSets = getCachedThemeSets();
 	if(themeSets.empty())
 	{
 		// no theme sets available
@@ -4,7 +4,12 @@
 #include <sstream>
 #include <memory>
 #include <map>
+#include <set>
+#include <unordered_map>
+#include <stdexcept>
 #include <deque>
+#include <vector>
+#include <ctime>
 #include <string>
 #include <boost/filesystem.hpp>
 #include <boost/variant.hpp>
@@ -42,6 +47,51 @@ namespace ThemeFlags
 	};
 }
 
+// Every property a theme element can have (see ThemeData::sElementMap), so components don't look them up by name.
+namespace ThemeProperties
+{
+	enum PropertyId : unsigned char
+	{
+		POS,
+		SIZE,
+		MAX_SIZE,
+		ORIGIN,
+		PATH,
+		TILE,
+		MIPMAP,
+		COLOR,
+		TEXT,
+		FONT_PATH,
+		FONT_SIZE,
+		ALIGNMENT,
+		FORCE_UPPERCASE,
+		LINE_SPACING,
+		SELECTOR_COLOR,
+		SELECTED_COLOR,
+		PRIMARY_COLOR,
+		SECONDARY_COLOR,
+		SCROLL_SOUND,
+		HORIZONTAL_MARGIN,
+		FILLED_PATH,
+		UNFILLED_PATH,
+		TEXT_COLOR,
+		ICON_COLOR,
+		VOLUME,
+		DELAY,
+		FRAMES,
+		FRAME_COUNT,
+		FRAME_TIME,
+		LOOP,
+
+		PROPERTY_COUNT
+	};
+
+	// the name used in theme files
+	const char* getName(PropertyId id);
+	// PROPERTY_COUNT if there is no such property
+	PropertyId getId(const char* name);
+}
+
 class ThemeException : public std::exception
 {
 public:
@@ -101,22 +151,89 @@ public:
 		bool extra;
 		std::string type;
 
-		std::map< std::string, boost::variant<Eigen::Vector2f, std::string, unsigned int, float, bool> > properties;
+		typedef boost::variant<Eigen::Vector2f, std::string, unsigned int, float, bool> Property;
+
+		// elements only have a handful of properties, a flat list is quicker to search than a map
+		std::vector< std::pair<ThemeProperties::PropertyId, Property> > properties;
+
+		// NULL if the element doesn't have it
+		inline const Property* find(ThemeProperties::PropertyId prop) const
+		{
+			for(auto it = properties.begin(); it != properties.end(); it++)
+			{
+				if(it->first == prop)
+					return &it->second;
+			}
+			return NULL;
+		}
 
 		template<typename T>
-		T get(const std::string& prop) const { return boost::get<T>(properties.at(prop)); }
+		T get(ThemeProperties::PropertyId prop) const
+		{
+			const Property* value = find(prop);
+			if(value == NULL)
+				throw std::out_of_range(std::string("theme element has no property ") + ThemeProperties::getName(prop));
+			return boost::get<T>(*value);
+		}
+
+		inline bool has(ThemeProperties::PropertyId prop) const { return find(prop) != NULL; }
+
+		// replaces the old value if there is one
+		void set(ThemeProperties::PropertyId prop, const Property& value);
+
+		// same type and the same properties, in any order
+		bool operator==(const ThemeElement& other) const;
+		inline bool operator!=(const ThemeElement& other) const { return !(*this == other); }
+	};
+
+	// What differs in one view between two themes, see getChanges().
+	struct ViewChanges
+	{
+		ViewChanges() : extras(false), lostProperties(false) {}
+
+		std::set<std::string> elements; // names of elements that were added, removed or changed
+		bool extras; // some of them are (or were) extras
+		// an element that isn't an extra, or a property of one, was taken out; components only apply what a theme has,
+		// so they can't go back to their defaults without being made again
+		bool lostProperties;
 
-		inline bool has(const std::string& prop) const { return (properties.find(prop) != properties.end()); }
+		inline bool empty() const { return elements.empty(); }
+		inline bool has(const std::string& element) const { return elements.find(element) != elements.end(); }
 	};
 
 private:
 	class ThemeView
 	{
 	public:
-		std::map<std::string, ThemeElement> elements;
+		std::unordered_map<std::string, ThemeElement> elements;
 		std::vector<std::string> orderedKeys;
 	};
 
+	typedef std::unordered_map<std::string, ThemeView> ViewMap;
+
+	// A theme file after parsing, before being merged into a ViewMap.
+	// Kept around (see sParsedFiles) so files included by many systems' themes are only read once.
+	struct ParsedFile
+	{
+		std::string path;
+		std::time_t modified;
+		float version;
+		std::vector< std::shared_ptr<const ParsedFile> > includes;
+		std::vector< std::pair<std::string, ThemeView> > views; // in file order, views with several names are listed once per name
+
+		// the views with this file as the root theme, shared by every ThemeData that loads it
+		mutable std::shared_ptr<const ViewMap> merged;
+
+		// what this file and merged were reported as to MemoryStats
+		mutable size_t memoryUsage;
+
+		ParsedFile() : memoryUsage(0) {}
+		~ParsedFile();
+
+		// counts the views (and merged, if there is one) that aren't counted yet
+		void updateMemoryUsage() const;
+	};
+
 public:
 
 	ThemeData();
@@ -124,6 +241,13 @@ public:
 	// throws ThemeException
 	void loadFile(const std::string& path);
 
+	// True if the file this was loaded from, or one it includes, changed on disk since. Loading it again
+	// only parses the files that changed.
+	bool isModified() const;
+
+	// Fills out with the elements of view that aren't the same in to as in from.
+	static void getChanges(const ThemeData& from, const ThemeData& to, const std::string& view, ViewChanges& out);
+
 	enum ElementPropertyType
 	{
 		NORMALIZED_PAIR,
@@ -141,19 +265,34 @@ public:
 
 	static const std::shared_ptr<ThemeData>& getDefault();
 
+	// Writes the parsed theme files to the binary cache of the current theme set, if any changed since it was read.
+	static void saveCache();
+
 	static std::map<std::string, ThemeSet> getThemeSets();
 	static boost::filesystem::path getThemeFromCurrentSet(const std::string& system);
 
 private:
 	static std::map< std::string, std::map<std::string, ElementPropertyType> > sElementMap;
 
+	// parsed files by path, reused as long as neither the file nor its includes were modified
+	static std::map< std::string, std::shared_ptr<const ParsedFile> > sParsedFiles;
+
 	std::deque<boost::filesystem::path> mPaths;
 	float mVersion;
 
-	void parseIncludes(const pugi::xml_node& themeRoot);
-	void parseViews(const pugi::xml_node& themeRoot);
+	std::shared_ptr<const ParsedFile> getParsedFile(const std::string& path, ThemeException& error);
+	static bool isUpToDate(const ParsedFile& file);
+	static void loadCache();
+	static void mergeFile(const ParsedFile& file, ViewMap& views);
+	static void mergeView(const ThemeView& from, ThemeView& to);
+	static std::vector<std::string> getExtraKeys(const ThemeView& view); // in file order
+	static size_t getMemoryUsage(const ThemeView& view);
+
+	void parseIncludes(const pugi::xml_node& themeRoot, ParsedFile& file);
+	void parseViews(const pugi::xml_node& themeRoot, ParsedFile& file);
 	void parseView(const pugi::xml_node& viewNode, ThemeView& view);
 	void parseElement(const pugi::xml_node& elementNode, const std::map<std::string, ElementPropertyType>& typeMap, ThemeElement& element);
 
-	std::map<std::string, ThemeView> mViews;
+	std::shared_ptr<const ViewMap> mViews; // never modified once loaded, so it can be shared
+	std::shared_ptr<const ParsedFile> mFile; // what mViews was merged from, NULL if nothing was loaded
 };
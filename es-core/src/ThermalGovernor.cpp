@@ -0,0 +1,222 @@
+#include "ThermalGovernor.h"
+#include "FramePacer.h"
+#include "AsyncIO.h"
+#include "Settings.h"
+#include "Metrics.h"
+#include "Log.h"
+#include <SDL.h>
+#include <algorithm>
+#include <fstream>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define THERMAL_CHECK_INTERVAL 1000 // ms
+#define THERMAL_RAISE_CHECKS 3 // checks in a row that have to want a higher level before it's taken
+#define THERMAL_LOWER_CHECKS 15 // and a lower one, coming back too early would only heat it up again
+#define THERMAL_HYSTERESIS 5000 // millidegrees the temperatures are lowered by on the way down
+#define THERMAL_SLOW_FRAME 1.5f // a frame that took this many frame intervals or more missed its interval
+#define THERMAL_MIN_FPS 20 // the frame cap is never halved below this
+#define THERMAL_ZONES 8 // thermal_zone0 to 7 are looked for
+
+// the Pi firmware's throttle flags, for what's happening right now (the upper bits are what happened since boot)
+#define THROTTLED_UNDERVOLTAGE 0x1
+#define THROTTLED_FREQ_CAPPED 0x2
+#define THROTTLED_THROTTLED 0x4
+#define THROTTLED_SOFT_TEMP_LIMIT 0x8
+#define THROTTLED_NOW (THROTTLED_UNDERVOLTAGE | THROTTLED_FREQ_CAPPED | THROTTLED_THROTTLED | THROTTLED_SOFT_TEMP_LIMIT)
+
+#define THROTTLE_FILE "/sys/devices/platform/soc/soc:firmware/get_throttled"
+#define THROTTLE_UNKNOWN -1
+#define THROTTLE_UNAVAILABLE -2 // no vcgencmd either, don't try again
+
+static const char* LEVEL_NAMES[] = { "normal", "reduced", "minimal" };
+
+ThermalGovernor* ThermalGovernor::getInstance()
+{
+	static ThermalGovernor instance;
+	return &instance;
+}
+
+ThermalGovernor::ThermalGovernor() : mEnabled(false), mLevel(LEVEL_NORMAL), mLastCheck(0), mFrames(0), mSlowFrames(0),
+	mRaiseChecks(0), mLowerChecks(0), mHasThrottleFile(false), mQueriedThrottled(THROTTLE_UNKNOWN), mQueryRunning(false)
+{
+#ifndef WIN32
+	for(int i = 0; i < THERMAL_ZONES; i++)
+	{
+		const std::string path = "/sys/class/thermal/thermal_zone" + std::to_string(i) + "/temp";
+		if(std::ifstream(path.c_str()).good())
+			mTemperatureFiles.push_back(path);
+	}
+
+	mHasThrottleFile = std::ifstream(THROTTLE_FILE).good();
+#endif
+
+	Metrics::addGauge("es_thermal_level", "ThermalGovernor's level, 0 = normal, 1 = reduced, 2 = minimal", [this] { return (double)mLevel; });
+}
+
+void ThermalGovernor::update()
+{
+	static const SettingHandle<bool> enabled = Settings::getInstance()->getBoolHandle("ThermalGovernor");
+	if(!enabled)
+	{
+		if(mLevel != LEVEL_NORMAL)
+		{
+			LOG(LogInfo) << "Thermal governor off, back to normal";
+			mLevel = LEVEL_NORMAL;
+		}
+		mEnabled = false;
+		return;
+	}
+
+	const unsigned int now = SDL_GetTicks();
+	if(!mEnabled)
+	{
+		mEnabled = true;
+		mLastCheck = now;
+		mFrames = 0;
+		mSlowFrames = 0;
+		LOG(LogInfo) << "Thermal governor watching " << mTemperatureFiles.size() << " thermal zone(s)"
+			<< (mHasThrottleFile ? " and get_throttled" : "");
+		return;
+	}
+
+	if(now - mLastCheck < THERMAL_CHECK_INTERVAL)
+		return;
+
+	check();
+	mLastCheck = now;
+	mFrames = 0;
+	mSlowFrames = 0;
+}
+
+void ThermalGovernor::addFrame(float frameTime)
+{
+	if(!mEnabled)
+		return;
+
+	static const SettingHandle<int> maxFPS = Settings::getInstance()->getIntHandle("MaxFPS");
+	const int cap = getMaxFPS(maxFPS);
+	const float interval = cap > 0 ? 1000.0f / cap : FramePacer::getInstance()->getRefreshInterval();
+
+	mFrames++;
+	if(frameTime >= interval * THERMAL_SLOW_FRAME)
+		mSlowFrames++;
+}
+
+void ThermalGovernor::check()
+{
+	const int temperature = readTemperature();
+	const int throttled = readThrottled();
+	const bool struggling = mFrames >= 10 && mSlowFrames * 4 > mFrames; // a quarter of the frames were late
+
+	// on the way down the board has to get somewhat cooler than what sent us up, but only below a level we're at:
+	// the way up to the next one is still at its own temperature
+	Settings* settings = Settings::getInstance();
+	const int reduceTemp = settings->getInt("ThermalReduceTemp") * 1000 - (mLevel >= LEVEL_REDUCED ? THERMAL_HYSTERESIS : 0);
+	const int minimalTemp = settings->getInt("ThermalMinimalTemp") * 1000 - (mLevel >= LEVEL_MINIMAL ? THERMAL_HYSTERESIS : 0);
+
+	// late frames alone are just a heavy theme, backing off only helps when the board is slowing itself down
+	Level target = LEVEL_NORMAL;
+	if(temperature >= reduceTemp || (throttled > 0 && (throttled & THROTTLED_NOW)))
+		target = LEVEL_REDUCED;
+	if(temperature >= minimalTemp || (target == LEVEL_REDUCED && struggling))
+		target = LEVEL_MINIMAL;
+
+	if(target > mLevel)
+	{
+		mLowerChecks = 0;
+		if(++mRaiseChecks < THERMAL_RAISE_CHECKS)
+			return;
+	}else if(target < mLevel)
+	{
+		mRaiseChecks = 0;
+		if(++mLowerChecks < THERMAL_LOWER_CHECKS)
+			return;
+	}else{
+		mRaiseChecks = 0;
+		mLowerChecks = 0;
+		return;
+	}
+
+	// one level at a time, so the one that's enough gets found
+	mLevel = (Level)(target > mLevel ? mLevel + 1 : mLevel - 1);
+	mRaiseChecks = 0;
+	mLowerChecks = 0;
+
+	LOG(LogInfo) << "Thermal governor: " << LEVEL_NAMES[mLevel] << " (" << (temperature >= 0 ? std::to_string(temperature / 1000) + "C" : "temperature unknown")
+		<< ", throttled " << (throttled >= 0 ? std::to_string(throttled & THROTTLED_NOW) : "unknown") << ", " << mSlowFrames << "/" << mFrames << " frames late)";
+}
+
+int ThermalGovernor::readTemperature() const
+{
+	int hottest = -1;
+	for(auto it = mTemperatureFiles.begin(); it != mTemperatureFiles.end(); it++)
+	{
+		std::ifstream file(it->c_str());
+		int temperature;
+		if(file >> temperature)
+			hottest = std::max(hottest, temperature);
+	}
+	return hottest;
+}
+
+int ThermalGovernor::readThrottled()
+{
+#ifdef WIN32
+	return THROTTLE_UNKNOWN;
+#else
+	if(mHasThrottleFile)
+	{
+		std::ifstream file(THROTTLE_FILE);
+		std::string value;
+		if(file >> value)
+			return (int)strtol(value.c_str(), NULL, 16);
+		return THROTTLE_UNKNOWN;
+	}
+
+	// older firmware only tells vcgencmd, which takes long enough to start that it can't be waited for on the main thread;
+	// this check gets what the last one asked for
+	const int last = mQueriedThrottled;
+	if(last == THROTTLE_UNAVAILABLE || mQueryRunning)
+		return last < 0 ? THROTTLE_UNKNOWN : last;
+
+	mQueryRunning = true;
+	AsyncIO::getInstance()->post([this] {
+		int result = THROTTLE_UNAVAILABLE;
+		FILE* pipe = popen("vcgencmd get_throttled 2>/dev/null", "r");
+		if(pipe)
+		{
+			unsigned int flags;
+			if(fscanf(pipe, "throttled=%x", &flags) == 1)
+				result = (int)flags;
+			pclose(pipe);
+		}
+
+		if(result == THROTTLE_UNAVAILABLE)
+			LOG(LogInfo) << "Thermal governor: no get_throttled, going by temperature only";
+
+		mQueriedThrottled = result;
+		mQueryRunning = false;
+	});
+
+	return last < 0 ? THROTTLE_UNKNOWN : last;
+#endif
+}
+
+int ThermalGovernor::getMaxFPS(int maxFPS) const
+{
+	if(mLevel == LEVEL_NORMAL)
+		return maxFPS;
+
+	const int rate = maxFPS > 0 ? maxFPS : (int)(1000.0f / FramePacer::getInstance()->getRefreshInterval() + 0.5f);
+	return rate / 2 < THERMAL_MIN_FPS ? std::min(rate, THERMAL_MIN_FPS) : rate / 2;
+}
+
+float ThermalGovernor::getRenderScale(float scale) const
+{
+	static const SettingHandle<float> thermalScale = Settings::getInstance()->getFloatHandle("ThermalRenderScale");
+	if(mLevel < LEVEL_MINIMAL || thermalScale <= 0 || thermalScale >= 1)
+		return scale;
+
+	return (scale > 0 && scale < thermalScale) ? scale : thermalScale;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+// Backs off when the board is too hot or being throttled: a Pi slows its clocks down when it's hot (or short on power),
+// and trying to render at full rate on top of that only makes frame times more uneven.
+// About once a second it looks at the SoC temperature (/sys/class/thermal), the firmware's throttle flags (get_throttled,
+// from sysfs or vcgencmd) and how many frames missed their interval since the last look, and moves one level at a time:
+//   LEVEL_REDUCED - half the frame cap (of the refresh rate if "MaxFPS" is 0), no IList title overlay gradient,
+//                   view transitions are instant
+//   LEVEL_MINIMAL - on top of that everything is drawn at "ThermalRenderScale" (see "RenderScale")
+// It climbs after a few bad looks in a row and only comes back down after many good ones, with the temperatures lowered
+// by THERMAL_HYSTERESIS on the way down, so it doesn't flap. Like ResourceGovernor, nothing is written to the settings.
+class ThermalGovernor
+{
+public:
+	enum Level
+	{
+		LEVEL_NORMAL,
+		LEVEL_REDUCED,
+		LEVEL_MINIMAL
+	};
+
+	static ThermalGovernor* getInstance();
+
+	// Once a main loop iteration.
+	void update();
+	// Once a drawn frame, with the ms from the start of its iteration to the end of its swap.
+	void addFrame(float frameTime);
+
+	inline Level getLevel() const { return mLevel; }
+	inline bool effectsEnabled() const { return mLevel == LEVEL_NORMAL; }
+
+	// What's set, lowered for the current level.
+	int getMaxFPS(int maxFPS) const; // 0 = no cap
+	float getRenderScale(float scale) const;
+
+private:
+	ThermalGovernor();
+
+	void check();
+	int readTemperature() const; // hottest zone in millidegrees C, -1 if there's none
+	int readThrottled(); // get_throttled's flags, -1 if unknown
+
+	bool mEnabled;
+	Level mLevel;
+	unsigned int mLastCheck; // SDL_GetTicks()
+	unsigned int mFrames; // since the last check
+	unsigned int mSlowFrames;
+	int mRaiseChecks; // checks in a row that wanted a higher/lower level
+	int mLowerChecks;
+
+	std::vector<std::string> mTemperatureFiles;
+	bool mHasThrottleFile;
+	std::atomic<int> mQueriedThrottled; // last "vcgencmd get_throttled", -1 until there is one
+	std::atomic<bool> mQueryRunning;
+};
@@ -0,0 +1,137 @@
+#include "Trace.h"
+#include "Log.h"
+#include "Util.h"
+#include <vector>
+#include <mutex>
+#include <fstream>
+#include <stdio.h>
+
+// keeps a forgotten --trace from eating all our memory
+#define TRACE_MAX_SPANS (1 << 20)
+
+std::atomic<bool> Trace::sEnabled(false);
+
+namespace
+{
+	struct Span
+	{
+		const char* name;
+		std::string detail;
+		int thread;
+		long long begin; // us since start()
+		long long duration; // us
+	};
+
+	struct Counter
+	{
+		const char* name;
+		const char* series;
+		long long time; // us since start()
+		double value;
+	};
+
+	std::mutex sMutex;
+	std::vector<Span> sSpans;
+	std::vector<Counter> sCounters;
+	std::string sPath;
+	Trace::Clock::time_point sStart;
+	std::atomic<int> sNextThread(1);
+
+	// small, stable ids read better in the viewer than std::thread::id hashes
+	int getThreadId()
+	{
+		static thread_local int id = 0;
+		if(id == 0)
+			id = sNextThread++;
+		return id;
+	}
+}
+
+void Trace::start(const std::string& path)
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+	sPath = path;
+	sSpans.clear();
+	sCounters.clear();
+	sStart = Clock::now();
+	getThreadId(); // whoever starts the trace is thread 1
+	sEnabled = true;
+}
+
+void Trace::addSpan(const char* name, const std::string& detail, Clock::time_point begin, Clock::time_point end)
+{
+	const int thread = getThreadId();
+
+	std::lock_guard<std::mutex> lock(sMutex);
+	if(!sEnabled || sSpans.size() >= TRACE_MAX_SPANS)
+		return;
+
+	Span span;
+	span.name = name;
+	span.detail = detail;
+	span.thread = thread;
+	span.begin = std::chrono::duration_cast<std::chrono::microseconds>(begin - sStart).count();
+	span.duration = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+	sSpans.push_back(std::move(span));
+}
+
+void Trace::addCounter(const char* name, const char* series, double value)
+{
+	const Clock::time_point now = Clock::now();
+
+	std::lock_guard<std::mutex> lock(sMutex);
+	if(!sEnabled || sCounters.size() >= TRACE_MAX_SPANS)
+		return;
+
+	Counter counter = { name, series, std::chrono::duration_cast<std::chrono::microseconds>(now - sStart).count(), value };
+	sCounters.push_back(counter);
+}
+
+bool Trace::finish()
+{
+	std::lock_guard<std::mutex> lock(sMutex);
+	if(!sEnabled)
+		return false;
+
+	sEnabled = false;
+
+	std::ofstream out(sPath.c_str(), std::ios::out | std::ios::trunc);
+	if(!out.is_open())
+	{
+		LOG(LogError) << "Could not write trace to " << sPath;
+		return false;
+	}
+
+	out << "{\"traceEvents\":[\n";
+	for(unsigned int i = 0; i < sSpans.size(); i++)
+	{
+		const Span& span = sSpans[i];
+		out << (i ? ",\n" : "") << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << span.thread << ",\"ts\":" << span.begin << ",\"dur\":" << span.duration << ",\"name\":";
+		writeJSONString(out, span.name);
+		if(!span.detail.empty())
+		{
+			out << ",\"args\":{\"detail\":";
+			writeJSONString(out, span.detail);
+			out << "}";
+		}
+		out << "}";
+	}
+	for(unsigned int i = 0; i < sCounters.size(); i++)
+	{
+		const Counter& counter = sCounters[i];
+		out << (i || !sSpans.empty() ? ",\n" : "") << "{\"ph\":\"C\",\"pid\":1,\"ts\":" << counter.time << ",\"name\":";
+		writeJSONString(out, counter.name);
+		out << ",\"args\":{";
+		writeJSONString(out, counter.series);
+		out << ":" << counter.value << "}}";
+	}
+	out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+	LOG(LogInfo) << "Wrote " << sSpans.size() << " trace spans and " << sCounters.size() << " counter values to " << sPath;
+
+	sSpans.clear();
+	sSpans.shrink_to_fit();
+	sCounters.clear();
+	sCounters.shrink_to_fit();
+	return true;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <string>
+#include <chrono>
+#include <atomic>
+
+// Records named, nested spans from any thread and writes them as a Chrome trace
+// (open it in chrome://tracing or ui.perfetto.dev). Recording only happens between start() and finish().
+class Trace
+{
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	static void start(const std::string& path);
+	// Stops recording and writes everything recorded to the path given to start(). Returns false if that failed.
+	static bool finish();
+
+	static inline bool isEnabled() { return sEnabled; }
+
+	static void addSpan(const char* name, const std::string& detail, Clock::time_point begin, Clock::time_point end);
+
+	// A value that's graphed over time (e.g. allocations per frame), recorded as of now. name and series must be literals.
+	static void addCounter(const char* name, const char* series, double value);
+
+private:
+	static std::atomic<bool> sEnabled;
+};
+
+// Times its own lifetime as one span. name must outlive the trace (use a literal); detail shows up as an argument.
+class TraceScope
+{
+public:
+	TraceScope(const char* name) : mName(name), mActive(Trace::isEnabled())
+	{
+		if(mActive)
+			mBegin = Trace::Clock::now();
+	}
+
+	TraceScope(const char* name, const std::string& detail) : mName(name), mActive(Trace::isEnabled())
+	{
+		if(mActive)
+		{
+			mDetail = detail;
+			mBegin = Trace::Clock::now();
+		}
+	}
+
+	~TraceScope()
+	{
+		if(mActive)
+			Trace::addSpan(mName, mDetail, mBegin, Trace::Clock::now());
+	}
+
+private:
+	const char* mName;
+	std::string mDetail;
+	bool mActive;
+	Trace::Clock::time_point mBegin;
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(...) TraceScope TRACE_CONCAT(traceScope, __LINE__)(__VA_ARGS__)
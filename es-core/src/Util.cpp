@@ -1,6 +1,9 @@
 #include "Util.h"
 #include "resources/ResourceManager.h"
 #include "platform.h"
+#include <stdio.h>
+#include <mutex>
+#include <unordered_map>
 
 namespace fs = boost::filesystem;
 
@@ -64,13 +67,84 @@ Eigen::Vector2f roundVector(const Eigen::Vector2f& vec)
 	return ret;
 }
 
+// canonical directories by the (absolute) path they were asked for with; every file in a folder shares its folder's,
+// so resolving a file is one lstat() instead of a realpath() walk. Symlinks changing while we run aren't noticed.
+#define CANONICAL_CACHE_MAX 4096
+
+static std::mutex sCanonicalMutex;
+static std::unordered_map<std::string, fs::path> sCanonicalDirs; // only directories that resolved, a missing one may appear later
+
+static bool getCanonicalDirectory(const fs::path& dir, fs::path& out)
+{
+	boost::system::error_code ec;
+	if(!dir.is_absolute())
+	{
+		out = fs::canonical(dir.empty() ? fs::path(".") : dir, ec);
+		return !ec;
+	}
+
+	const std::string key = dir.generic_string();
+	{
+		std::lock_guard<std::mutex> lock(sCanonicalMutex);
+		auto it = sCanonicalDirs.find(key);
+		if(it != sCanonicalDirs.end())
+		{
+			out = it->second;
+			return true;
+		}
+	}
+
+	out = fs::canonical(dir, ec);
+	if(ec)
+	{
+		out.clear();
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(sCanonicalMutex);
+	if(sCanonicalDirs.size() >= CANONICAL_CACHE_MAX)
+		sCanonicalDirs.clear();
+	sCanonicalDirs[key] = out;
+	return true;
+}
+
+// What fs::canonical(path) would return, but through the directory cache. If keepLink is set and path is a symlink,
+// the link itself is kept (only its folder is resolved). False if path doesn't exist.
+static bool getCanonicalFile(const fs::path& path, bool keepLink, fs::path& out)
+{
+	boost::system::error_code ec;
+	const fs::file_status status = fs::symlink_status(path, ec);
+	if(ec || !fs::exists(status))
+		return false;
+
+	const fs::path filename = path.filename();
+	const bool link = fs::is_symlink(status);
+	if(filename.empty() || filename == "." || filename == ".." || (link && !keepLink))
+	{
+		// nothing to split off, or it has to be followed
+		out = fs::canonical(path, ec);
+		return !ec;
+	}
+
+	// a dangling link doesn't count as existing
+	if(link && !fs::exists(path, ec))
+		return false;
+
+	if(!getCanonicalDirectory(path.parent_path(), out))
+		return false;
+
+	out /= filename;
+	return true;
+}
+
 // embedded resources, e.g. ":/font.ttf", need to be properly handled too
 std::string getCanonicalPath(const std::string& path)
 {
-	if(path.empty() || !boost::filesystem::exists(path))
+	fs::path canonical;
+	if(path.empty() || !getCanonicalFile(path, false, canonical))
 		return path;
 
-	return boost::filesystem::canonical(path).generic_string();
+	return canonical.generic_string();
 }
 
 // expands "./my/path.sfc" to "[relativeTo]/my/path.sfc"
@@ -117,17 +191,14 @@ fs::path removeCommonPathUsingStrings(const fs::path& path, const fs::path& rela
 // example: removeCommonPath("/home/pi/roms/nes/foo/bar.nes", "/home/pi/roms/nes/") returns "foo/bar.nes"
 fs::path removeCommonPath(const fs::path& path, const fs::path& relativeTo, bool& contains)
 {
-	// if either of these doesn't exist, fs::canonical() is going to throw an error
-	if(!fs::exists(path) || !fs::exists(relativeTo))
+	// if it's a symlink we don't want to apply fs::canonical on it, otherwise we'll lose the current parent_path
+	fs::path p, r;
+	if(!getCanonicalFile(path, true, p) || !getCanonicalDirectory(relativeTo, r))
 	{
 		contains = false;
 		return path;
 	}
 
-	// if it's a symlink we don't want to apply fs::canonical on it, otherwise we'll lose the current parent_path
-	fs::path p = (fs::is_symlink(path) ? fs::canonical(path.parent_path()) / path.filename() : fs::canonical(path));
-	fs::path r = fs::canonical(relativeTo);
-
 	if(p.root_path() != r.root_path())
 	{
 		contains = false;
@@ -194,6 +265,26 @@ fs::path makeRelativePath(const fs::path& path, const fs::path& relativeTo, bool
 	return path;
 }
 
+void writeJSONString(std::ostream& out, const std::string& str)
+{
+	out << '"';
+	for(unsigned int i = 0; i < str.size(); i++)
+	{
+		const unsigned char c = (unsigned char)str[i];
+		if(c == '"' || c == '\\')
+			out << '\\' << (char)c;
+		else if(c < 0x20)
+		{
+			char buf[8];
+			snprintf(buf, sizeof(buf), "\\u%04x", c);
+			out << buf;
+		}else{
+			out << (char)c;
+		}
+	}
+	out << '"';
+}
+
 boost::posix_time::ptime string_to_ptime(const std::string& str, const std::string& fmt)
 {
 	std::istringstream ss(str);
@@ -203,3 +294,92 @@ boost::posix_time::ptime string_to_ptime(const std::string& str, const std::stri
 
 	return time;
 }
+
+// reads exactly count digits
+static bool readDigits(const char*& p, const char* end, int count, int& out)
+{
+	if(end - p < count)
+		return false;
+
+	out = 0;
+	for(int i = 0; i < count; i++, p++)
+	{
+		if(*p < '0' || *p > '9')
+			return false;
+		out = out * 10 + (*p - '0');
+	}
+	return true;
+}
+
+boost::posix_time::ptime parseIsoTime(const std::string& str)
+{
+	using namespace boost::posix_time;
+
+	// unset
+	if(str.empty() || str == "0" || str == "not-a-date-time")
+		return ptime(not_a_date_time);
+
+	const char* p = str.c_str();
+	const char* end = p + str.size();
+	int year, month, day, hour, minute, second;
+	if(!readDigits(p, end, 4, year) || !readDigits(p, end, 2, month) || !readDigits(p, end, 2, day) || p == end || *p++ != 'T' || 
+		!readDigits(p, end, 2, hour) || !readDigits(p, end, 2, minute) || !readDigits(p, end, 2, second))
+		return string_to_ptime(str);
+
+	long fraction = 0;
+	if(p != end && *p == '.')
+	{
+		// microseconds; any digits past those are dropped
+		p++;
+		long scale = 100000;
+		for(; p != end && *p >= '0' && *p <= '9'; p++, scale /= 10)
+			fraction += (*p - '0') * scale;
+	}
+
+	// a time zone or something else we don't handle, or a value boost would throw on
+	if(p != end || year < 1400 || year > 9999 || month < 1 || month > 12 || day < 1 || 
+		day > boost::gregorian::gregorian_calendar::end_of_month_day(year, month) || hour > 23 || minute > 59 || second > 59)
+		return string_to_ptime(str);
+
+	return ptime(boost::gregorian::date(year, month, day), hours(hour) + minutes(minute) + seconds(second) + microseconds(fraction));
+}
+
+std::string formatIsoTime(const boost::posix_time::ptime& time)
+{
+	if(time.is_special())
+		return boost::posix_time::to_iso_string(time);
+
+	const boost::gregorian::date::ymd_type ymd = time.date().year_month_day();
+	const boost::posix_time::time_duration tod = time.time_of_day();
+
+	char buf[32];
+	int len = snprintf(buf, sizeof(buf), "%04d%02d%02dT%02d%02d%02d", (int)ymd.year, (int)ymd.month, (int)ymd.day, 
+		(int)tod.hours(), (int)tod.minutes(), (int)tod.seconds());
+
+	// like boost, the fraction is only written if there is one
+	const long micros = (long)(tod.fractional_seconds() * 1000000 / boost::posix_time::time_duration::ticks_per_second());
+	if(micros)
+		snprintf(buf + len, sizeof(buf) - len, ".%06ld", micros);
+
+	return buf;
+}
+
+std::string normalizeGameName(const std::string& name)
+{
+	std::string out;
+	out.reserve(name.length());
+
+	int depth = 0;
+	for(unsigned int i = 0; i < name.length(); i++)
+	{
+		const unsigned char c = name[i];
+		if(c == '(' || c == '[')
+			depth++;
+		else if((c == ')' || c == ']') && depth > 0)
+			depth--;
+		else if(depth == 0 && isalnum(c))
+			out += (char)tolower(c);
+	}
+
+	return out;
+}
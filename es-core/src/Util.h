@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <ostream>
 #include <Eigen/Dense>
 #include <boost/filesystem.hpp>
 #include <boost/date_time.hpp>
@@ -33,4 +34,16 @@ boost::filesystem::path makeRelativePath(const boost::filesystem::path& path, co
 // if allowHome is true, also expands "~/my/path.sfc" to "/home/pi/my/path.sfc"
 boost::filesystem::path resolvePath(const boost::filesystem::path& path, const boost::filesystem::path& relativeTo, bool allowHome);
 
+// lower case letters and digits only, anything in () or [] is dropped, for matching game names from different sources
+// ("Super Mario Bros. (USA) [!]" -> "supermariobros")
+std::string normalizeGameName(const std::string& name);
+
+// writes str as a quoted JSON string (UTF-8 is passed through, control characters are escaped)
+void writeJSONString(std::ostream& out, const std::string& str);
+
 boost::posix_time::ptime string_to_ptime(const std::string& str, const std::string& fmt = "%Y%m%dT%H%M%S%F%q");
+
+// Same as string_to_ptime(str) and to_iso_string(time), but what to_iso_string() writes ("20150131T235959[.ffffff]")
+// is read and written by hand, without streams or allocating; anything else goes through boost.
+boost::posix_time::ptime parseIsoTime(const std::string& str);
+std::string formatIsoTime(const boost::posix_time::ptime& time);
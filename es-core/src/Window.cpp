@@ -7,12 +7,53 @@
 #include <iomanip>
 #include "components/HelpComponent.h"
 #include "components/ImageComponent.h"
+#include "components/VideoComponent.h"
+#include "TaskScheduler.h"
+#include "FrameProfiler.h"
+#include "GpuProfiler.h"
+#include "ThermalGovernor.h"
+#include "Metrics.h"
+#include "MemoryStats.h"
+#include "AllocStats.h"
+#include "resources/TextureResource.h"
+#include "platform.h"
+
+// even when nothing was invalidated, redraw this often so anything that forgot to call invalidate() still shows up
+#define IDLE_REDRAW_INTERVAL 1000
 
 Window::Window() : mNormalizeNextUpdate(false), mFrameTimeElapsed(0), mFrameCountElapsed(0), mAverageDeltaTime(10), 
-	mAllowSleep(true), mSleeping(false), mTimeSinceLastInput(0)
+	mLastElidedStateChanges(0), mAllowSleep(true), mSleeping(false), mDisplayOff(false), 
+	mScreenSaver(NULL), mScreenSaverActive(false), mTimeSinceLastInput(0),
+	mInvalidated(true), mInputCount(0), mHelpPromptsHash(0), mTimeSinceRedraw(0)
 {
+	Settings* settings = Settings::getInstance();
+	mDrawFramerate = settings->getBoolHandle("DrawFramerate");
+	mSkipIdleFrames = settings->getBoolHandle("SkipIdleFrames");
+	mShowHelpPrompts = settings->getBoolHandle("ShowHelpPrompts");
+	mScreenSaverTime = settings->getIntHandle("ScreenSaverTime");
+	mTextureUploadBudget = settings->getIntHandle("TextureUploadBudget");
+	mScreenSaverBehavior = settings->getStringHandle("ScreenSaverBehavior");
+	mRenderScale = settings->getFloatHandle("RenderScale");
+
 	mHelp = new HelpComponent(this);
 	mBackgroundOverlay = new ImageComponent(this);
+
+	Metrics::addGauge("es_texture_vram_bytes", "Approximate VRAM used by textures", [] { return (double)TextureResource::getTotalMemUsage(); });
+	Metrics::addGauge("es_font_vram_bytes", "Approximate VRAM used by font textures", [] { return (double)Font::getTotalMemUsage(); });
+
+	Metrics::Counter* hits = Metrics::getCounter("es_texture_cache_hits_total", "TextureResource::get() calls that found a live texture");
+	Metrics::Counter* misses = Metrics::getCounter("es_texture_cache_misses_total", "TextureResource::get() calls that had to create a texture");
+	Metrics::addGauge("es_texture_cache_hit_ratio", "Texture cache hits / lookups since startup", [hits, misses] {
+		const unsigned long long total = hits->get() + misses->get();
+		return total ? (double)hits->get() / total : 0.0;
+	});
+
+	for(int i = 0; i < MemoryStats::TAG_COUNT; i++)
+	{
+		const MemoryStats::Tag tag = (MemoryStats::Tag)i;
+		Metrics::addGauge(std::string("es_memory_") + MemoryStats::getName(tag) + "_bytes", std::string("Estimated RAM used by ") + MemoryStats::getName(tag), 
+			[tag] { return (double)MemoryStats::get(tag); });
+	}
 }
 
 Window::~Window()
@@ -30,6 +71,7 @@ void Window::pushGui(GuiComponent* gui)
 {
 	mGuiStack.push_back(gui);
 	gui->updateHelpPrompts();
+	invalidate();
 }
 
 void Window::removeGui(GuiComponent* gui)
@@ -39,6 +81,7 @@ void Window::removeGui(GuiComponent* gui)
 		if(*i == gui)
 		{
 			i = mGuiStack.erase(i);
+			invalidate();
 
 			if(i == mGuiStack.end() && mGuiStack.size()) // we just popped the stack and the stack is not empty
 				mGuiStack.back()->updateHelpPrompts();
@@ -68,7 +111,11 @@ bool Window::init(unsigned int width, unsigned int height)
 	
 	InputManager::getInstance()->init();
 
+	// coming back from a game: only what's drawn first is loaded right away, the rest over the next frames
+	const bool reinit = !mDefaultFonts.empty();
+	TextureResource::setDeferReloads(reinit);
 	ResourceManager::getInstance()->reloadAll();
+	TextureResource::setDeferReloads(false);
 
 	//keep a reference to the default fonts, so they don't keep getting destroyed/recreated
 	if(mDefaultFonts.empty())
@@ -84,24 +131,63 @@ bool Window::init(unsigned int width, unsigned int height)
 	if(peekGui())
 		peekGui()->updateHelpPrompts();
 
+	invalidate();
 	return true;
 }
 
 void Window::deinit()
 {
+	setScreenSaver(NULL);
+	VideoComponent::stopAll();
 	InputManager::getInstance()->deinit();
 	ResourceManager::getInstance()->unloadAll();
 	Renderer::deinit();
 }
 
+void Window::suspend()
+{
+	VideoComponent::stopAll();
+
+	// let go of the joysticks all the same, the emulator wants them
+	InputManager::getInstance()->deinit();
+	Renderer::suspend();
+}
+
+void Window::resume()
+{
+	Renderer::resume();
+	InputManager::getInstance()->init();
+
+	// same size, but help prompts may need redoing with the reopened input devices
+	if(peekGui())
+		peekGui()->updateHelpPrompts();
+
+	invalidate();
+}
+
 void Window::textInput(const char* text)
 {
+	invalidate();
+	mInputCount++;
 	if(peekGui())
 		peekGui()->textInput(text);
 }
 
 void Window::input(InputConfig* config, Input input)
 {
+	invalidate();
+	mInputCount++;
+	FrameProfiler::getInstance()->inputReceived(input.timestamp);
+
+	if(mScreenSaverActive)
+	{
+		// same as waking up
+		mTimeSinceLastInput = 0;
+		mScreenSaverActive = false;
+		mScreenSaver->stop();
+		return;
+	}
+
 	if(mSleeping)
 	{
 		// wake up
@@ -123,6 +209,20 @@ void Window::input(InputConfig* config, Input input)
 		// toggle TextComponent debug view with Ctrl-T
 		Settings::getInstance()->setBool("DebugText", !Settings::getInstance()->getBool("DebugText"));
 	}
+	else if(config->getDeviceId() == DEVICE_KEYBOARD && input.value && input.id == SDLK_p && SDL_GetModState() & KMOD_LCTRL && Settings::getInstance()->getBool("Debug"))
+	{
+		// dump frame timings with Ctrl-P, or start profiling if it wasn't on
+		if(FrameProfiler::getInstance()->isEnabled())
+			FrameProfiler::getInstance()->dumpCSV(getHomePath() + "/.emulationstation/frametimes.csv");
+		else
+			Settings::getInstance()->setBool("ProfileFrames", true);
+	}
+	else if(config->getDeviceId() == DEVICE_KEYBOARD && input.value && input.id == SDLK_m && SDL_GetModState() & KMOD_LCTRL && Settings::getInstance()->getBool("Debug"))
+	{
+		// log what's using VRAM with Ctrl-M
+		TextureResource::logLiveTextures();
+		Font::logLiveFonts();
+	}
 	else
 	{
 		if(peekGui())
@@ -132,6 +232,10 @@ void Window::input(InputConfig* config, Input input)
 
 void Window::update(int deltaTime)
 {
+	// one update and one render per frame, so the previous frame ends here
+	AllocStats::endFrame();
+	ALLOC_SCOPE("update");
+
 	if(mNormalizeNextUpdate)
 	{
 		mNormalizeNextUpdate = false;
@@ -145,7 +249,7 @@ void Window::update(int deltaTime)
 	{
 		mAverageDeltaTime = mFrameTimeElapsed / mFrameCountElapsed;
 		
-		if(Settings::getInstance()->getBool("DrawFramerate"))
+		if(mDrawFramerate)
 		{
 			std::stringstream ss;
 			
@@ -158,8 +262,26 @@ void Window::update(int deltaTime)
 			float fontVramUsageMb = Font::getTotalMemUsage() / 1000.0f / 1000.0f;;
 			float totalVramUsageMb = textureVramUsageMb + fontVramUsageMb;
 			ss << "\nVRAM: " << totalVramUsageMb << "mb (texs: " << textureVramUsageMb << "mb, fonts: " << fontVramUsageMb << "mb)";
+			ss << "\n" << MemoryStats::getSummary();
+			if(AllocStats::isAvailable())
+				ss << "\n" << AllocStats::getSummary();
+
+			// redundant GL state changes the renderer skipped
+			const unsigned int elided = Renderer::getElidedStateChanges();
+			ss << "\nGL state changes skipped: " << (elided - mLastElidedStateChanges) / mFrameCountElapsed << "/frame";
+			mLastElidedStateChanges = elided;
 
 			mFrameDataText = std::unique_ptr<TextCache>(mDefaultFonts.at(1)->buildTextCache(ss.str(), 50.f, 50.f, 0xFF00FFFF));
+			invalidate();
+		}
+
+		if(FrameProfiler::getInstance()->isEnabled())
+		{
+			std::string summary = FrameProfiler::getInstance()->getSummary();
+			summary += "\n" + GpuProfiler::getInstance()->getSummary();
+			mProfilerText = std::unique_ptr<TextCache>(mDefaultFonts.at(0)->buildTextCache(summary, 
+				16.f, Renderer::getScreenHeight() * 0.85f + 4.f, 0xFFFFFFFF));
+			invalidate();
 		}
 
 		mFrameTimeElapsed = 0;
@@ -167,17 +289,87 @@ void Window::update(int deltaTime)
 	}
 
 	mTimeSinceLastInput += deltaTime;
-
-	if(peekGui())
+	mTimeSinceRedraw += deltaTime;
+
+	// time to go to sleep, render() takes care of it
+	unsigned int screensaverTime = (unsigned int)mScreenSaverTime.get();
+	if(mTimeSinceLastInput >= screensaverTime && screensaverTime != 0 && mAllowSleep && !mScreenSaverActive)
+		invalidate();
+
+	// upload what finished in the background (decoded textures, rasterized SVGs...), all of it within one budget so a burst
+	// of it is spread over a few frames instead of taking one long one
+	FrameProfiler::getInstance()->begin(FrameProfiler::PHASE_TEXTURE_UPLOAD);
+	const unsigned int uploadStart = SDL_GetTicks();
+	if(TaskScheduler::getInstance()->update(mTextureUploadBudget))
+		invalidate();
+	const int uploadLeft = mTextureUploadBudget - (int)(SDL_GetTicks() - uploadStart);
+	if(uploadLeft > 0 && TextureResource::restoreDeferred(uploadLeft))
+		invalidate();
+	FrameProfiler::getInstance()->end(FrameProfiler::PHASE_TEXTURE_UPLOAD);
+	TextureResource::enforceVRAMBudget();
+
+	// nothing under it is on screen
+	if(mScreenSaverActive)
+		mScreenSaver->update(deltaTime);
+	else if(peekGui())
 		peekGui()->update(deltaTime);
+
+	// videos under a menu (or the screensaver) weren't updated, the player would draw over it
+	VideoComponent::stopStale();
+}
+
+bool Window::needsRedraw() const
+{
+	// the profiler graph changes every frame
+	return mInvalidated || mTimeSinceRedraw >= IDLE_REDRAW_INTERVAL || !mSkipIdleFrames || 
+		FrameProfiler::getInstance()->isEnabled();
+}
+
+int Window::getIdleTimeout() const
+{
+	if(needsRedraw())
+		return 0;
+
+	int timeout = IDLE_REDRAW_INTERVAL - mTimeSinceRedraw;
+
+	unsigned int screensaverTime = (unsigned int)mScreenSaverTime.get();
+	if(screensaverTime != 0 && mAllowSleep && !mScreenSaverActive && (int)(screensaverTime - mTimeSinceLastInput) < timeout)
+		timeout = screensaverTime - mTimeSinceLastInput;
+
+	return timeout > 0 ? timeout : 0;
 }
 
 void Window::render()
 {
+	ALLOC_SCOPE("render");
+
 	Eigen::Affine3f transform = Eigen::Affine3f::Identity();
 
 	mRenderedHelpPrompts = false;
 
+	unsigned int screensaverTime = (unsigned int)mScreenSaverTime.get();
+	const bool screensaverDue = mTimeSinceLastInput >= screensaverTime && screensaverTime != 0 && mAllowSleep;
+	if(screensaverDue && mScreenSaver && mScreenSaverBehavior.get() == "slideshow")
+	{
+		if(!mScreenSaverActive)
+		{
+			mScreenSaverActive = true;
+			mScreenSaver->start();
+		}
+
+		mScreenSaver->render(transform);
+		mInvalidated = false;
+		mTimeSinceRedraw = 0;
+		return;
+	}
+
+	// fill rate is what runs out first on big screens with small GPUs
+	const float scale = ThermalGovernor::getInstance()->getRenderScale(mRenderScale);
+	const bool scaled = scale > 0 && scale < 1 && Renderer::renderTargetsSupported() &&
+		mSceneTarget.begin(Renderer::getScreenWidth(), Renderer::getScreenHeight(), scale);
+	if(!scaled && mSceneTarget.getTexture() != 0)
+		mSceneTarget.release();
+
 	// draw only bottom and top of GuiStack (if they are different)
 	if(mGuiStack.size())
 	{
@@ -187,27 +379,72 @@ void Window::render()
 		bottom->render(transform);
 		if(bottom != top)
 		{
+			GpuProfiler::Scope gpuScope(GpuProfiler::SECTION_OVERLAYS);
 			mBackgroundOverlay->render(transform);
 			top->render(transform);
 		}
 	}
 
+	if(scaled)
+	{
+		mSceneTarget.end();
+		renderSceneTarget();
+	}
+
+	// (unless they had to go under a fade) text this small is what suffers most from scaling
+	GpuProfiler::getInstance()->begin(GpuProfiler::SECTION_OVERLAYS);
 	if(!mRenderedHelpPrompts)
 		mHelp->render(transform);
 
-	if(Settings::getInstance()->getBool("DrawFramerate") && mFrameDataText)
+	if(mDrawFramerate && mFrameDataText)
 	{
 		Renderer::setMatrix(Eigen::Affine3f::Identity());
 		mDefaultFonts.at(1)->renderTextCache(mFrameDataText.get());
 	}
 
-	unsigned int screensaverTime = (unsigned int)Settings::getInstance()->getInt("ScreenSaverTime");
-	if(mTimeSinceLastInput >= screensaverTime && screensaverTime != 0 && mAllowSleep)
+	if(FrameProfiler::getInstance()->isEnabled())
+	{
+		FrameProfiler::getInstance()->render();
+		if(mProfilerText)
+		{
+			Renderer::setMatrix(Eigen::Affine3f::Identity());
+			mDefaultFonts.at(0)->renderTextCache(mProfilerText.get());
+		}
+	}
+	GpuProfiler::getInstance()->end(GpuProfiler::SECTION_OVERLAYS);
+
+	if(screensaverDue)
 	{
 		// go to sleep
 		mSleeping = true;
 		onSleep();
 	}
+
+	// anything components changed while drawing is already on screen
+	mInvalidated = false;
+	mTimeSinceRedraw = 0;
+}
+
+void Window::renderSceneTarget()
+{
+	Renderer::setMatrix(Eigen::Affine3f::Identity());
+
+	// the texture's rows are bottom to top; it covers the whole screen, so there's nothing to blend with
+	// x, y, u, v interleaved, so both arrays are streamed in one piece
+	const float w = (float)Renderer::getScreenWidth(), h = (float)Renderer::getScreenHeight();
+	const GLfloat vertices[24] = { 0, 0, 0, 1,  0, h, 0, 0,  w, 0, 1, 1,  w, 0, 1, 1,  0, h, 0, 0,  w, h, 1, 0 };
+
+	Renderer::setTextureEnabled(true);
+	Renderer::bindTexture(mSceneTarget.getTexture());
+	Renderer::setBlendEnabled(false);
+	Renderer::setClientArrays(true, true, false);
+	Renderer::setConstantColor(0xFFFFFFFF);
+
+	const char* base = Renderer::streamVertices(vertices, sizeof(vertices));
+	Renderer::vertexPointer(2, GL_FLOAT, 4 * sizeof(GLfloat), base);
+	Renderer::texCoordPointer(2, GL_FLOAT, 4 * sizeof(GLfloat), base + 2 * sizeof(GLfloat));
+
+	Renderer::drawArrays(GL_TRIANGLES, 0, 6);
 }
 
 void Window::normalizeNextUpdate()
@@ -250,14 +487,34 @@ void Window::renderLoadingScreen()
 
 void Window::renderHelpPromptsEarly()
 {
+	GpuProfiler::Scope gpuScope(GpuProfiler::SECTION_OVERLAYS);
 	mHelp->render(Eigen::Affine3f::Identity());
 	mRenderedHelpPrompts = true;
 }
 
 void Window::setHelpPrompts(const std::vector<HelpPrompt>& prompts, const HelpStyle& style)
 {
-	mHelp->clearPrompts();
-	mHelp->setStyle(style);
+	// most calls (e.g. every cursor move) ask for what's already shown
+	std::string key;
+	for(auto it = prompts.begin(); it != prompts.end(); it++)
+	{
+		key += it->first;
+		key += '\0';
+		key += it->second;
+		key += '\0';
+	}
+	const Font* font = style.font.get();
+	key.append((const char*)style.position.data(), sizeof(float) * 2);
+	key.append((const char*)&style.iconColor, sizeof(style.iconColor));
+	key.append((const char*)&style.textColor, sizeof(style.textColor));
+	key.append((const char*)&font, sizeof(font));
+	key += mShowHelpPrompts ? '1' : '0';
+
+	const size_t hash = std::hash<std::string>()(key);
+	if(hash == mHelpPromptsHash && key == mHelpPromptsKey)
+		return;
+	mHelpPromptsHash = hash;
+	mHelpPromptsKey.swap(key);
 
 	std::vector<HelpPrompt> addPrompts;
 
@@ -320,18 +577,58 @@ void Window::setHelpPrompts(const std::vector<HelpPrompt>& prompts, const HelpSt
 		return aVal > bVal;
 	});
 
-	mHelp->setPrompts(addPrompts);
+	mHelp->setPrompts(addPrompts, style);
+	invalidate();
 }
 
 
 void Window::onSleep()
 {
+	VideoComponent::stopAll();
+
 	Renderer::setMatrix(Eigen::Affine3f::Identity());
-	unsigned char opacity = Settings::getInstance()->getString("ScreenSaverBehavior") == "dim" ? 0xA0 : 0xFF;
+	unsigned char opacity = mScreenSaverBehavior.get() == "dim" ? 0xA0 : 0xFF;
 	Renderer::drawRect(0, 0, Renderer::getScreenWidth(), Renderer::getScreenHeight(), 0x00000000 | opacity);
 }
 
-void Window::onWake()
+void Window::setScreenSaver(IScreenSaver* screenSaver)
+{
+	if(mScreenSaverActive)
+	{
+		mScreenSaverActive = false;
+		mScreenSaver->stop();
+	}
+	mScreenSaver = screenSaver;
+}
+
+void Window::waitWhileSleeping()
 {
+	if(mScreenSaverBehavior.get() != "off")
+	{
+		SDL_WaitEventTimeout(NULL, 500);
+		return;
+	}
+
+	// the black frame onSleep() drew has been swapped by now
+	if(!mDisplayOff)
+	{
+		const std::string& cmd = Settings::getInstance()->getString("DisplayOffCommand");
+		if(!cmd.empty() && runSystemCommand(cmd) != 0)
+			LOG(LogWarning) << "Screensaver: \"" << cmd << "\" failed";
+		mDisplayOff = true;
+	}
 
+	// nothing is drawn or polled until something happens (ROM folder changes queue up until then)
+	SDL_WaitEvent(NULL);
+}
+
+void Window::onWake()
+{
+	if(mDisplayOff)
+	{
+		const std::string& cmd = Settings::getInstance()->getString("DisplayOnCommand");
+		if(!cmd.empty() && runSystemCommand(cmd) != 0)
+			LOG(LogWarning) << "Screensaver: \"" << cmd << "\" failed";
+		mDisplayOff = false;
+	}
 }
@@ -4,10 +4,24 @@
 #include <vector>
 #include "resources/Font.h"
 #include "InputManager.h"
+#include "Settings.h"
 
 class HelpComponent;
 class ImageComponent;
 
+// Drawn instead of everything else while the screensaver runs, when ScreenSaverBehavior is "slideshow".
+// Only holds on to what it loaded between start() and stop().
+class IScreenSaver
+{
+public:
+	virtual ~IScreenSaver() {}
+
+	virtual void start() = 0;
+	virtual void stop() = 0;
+	virtual void update(int deltaTime) = 0;
+	virtual void render(const Eigen::Affine3f& parentTrans) = 0;
+};
+
 class Window
 {
 public:
@@ -26,9 +40,28 @@ public:
 	bool init(unsigned int width = 0, unsigned int height = 0);
 	void deinit();
 
+	// Lighter than deinit()/init() around running something else: the window is only hidden,
+	// textures and fonts stay loaded.
+	void suspend();
+	void resume();
+
 	void normalizeNextUpdate();
 
+	// Marks the screen as changed, so the next frame has to be drawn. Anything that changes what is
+	// on screen outside of input (animations, scrolling, finished texture loads) should call this.
+	inline void invalidate() { mInvalidated = true; }
+	// Bumped by every input, for render caches: what input changes inside them doesn't always call invalidate().
+	inline unsigned int getInputCount() const { return mInputCount; }
+	// False if nothing changed since the last render(), so the frame can be skipped entirely.
+	bool needsRedraw() const;
+	// How long (in ms) the main loop may wait for events before something time-based is due (0 if a frame is due now).
+	int getIdleTimeout() const;
+
 	inline bool isSleeping() const { return mSleeping; }
+	// Not owned. Without one, "slideshow" falls back to "black".
+	void setScreenSaver(IScreenSaver* screenSaver);
+	// Blocks the main loop while sleeping, until an event comes in (or, unless the screensaver is "off", for a little while).
+	void waitWhileSleeping();
 	bool getAllowSleep();
 	void setAllowSleep(bool sleep);
 	
@@ -40,6 +73,7 @@ public:
 private:
 	void onSleep();
 	void onWake();
+	void renderSceneTarget(); // scales mSceneTarget up to the screen
 
 	HelpComponent* mHelp;
 	ImageComponent* mBackgroundOverlay;
@@ -51,14 +85,38 @@ private:
 	int mFrameTimeElapsed;
 	int mFrameCountElapsed;
 	int mAverageDeltaTime;
+	unsigned int mLastElidedStateChanges; // Renderer::getElidedStateChanges() at the last framerate update
 
 	std::unique_ptr<TextCache> mFrameDataText;
+	std::unique_ptr<TextCache> mProfilerText;
 
 	bool mNormalizeNextUpdate;
 
 	bool mAllowSleep;
 	bool mSleeping;
+	bool mDisplayOff; // DisplayOffCommand was run
+	IScreenSaver* mScreenSaver;
+	bool mScreenSaverActive; // started, instead of sleeping
 	unsigned int mTimeSinceLastInput;
 
 	bool mRenderedHelpPrompts;
+
+	bool mInvalidated;
+	unsigned int mInputCount;
+
+	// what setHelpPrompts() was last given
+	std::string mHelpPromptsKey;
+	size_t mHelpPromptsHash;
+	int mTimeSinceRedraw;
+
+	// read every frame
+	SettingHandle<bool> mDrawFramerate;
+	SettingHandle<bool> mSkipIdleFrames;
+	SettingHandle<bool> mShowHelpPrompts;
+	SettingHandle<int> mScreenSaverTime;
+	SettingHandle<int> mTextureUploadBudget;
+	SettingHandle<std::string> mScreenSaverBehavior;
+	SettingHandle<float> mRenderScale;
+
+	Renderer::RenderTarget mSceneTarget; // what's drawn at "RenderScale"
 };
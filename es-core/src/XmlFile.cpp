@@ -0,0 +1,63 @@
+#include "XmlFile.h"
+#include "Log.h"
+
+#ifndef WIN32
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+XmlFile::XmlFile()
+{
+}
+
+pugi::xml_parse_result XmlFile::load(const std::string& path, unsigned int options)
+{
+	mDocument.reset();
+
+#ifndef WIN32
+	int fd = open(path.c_str(), O_RDONLY);
+	if(fd >= 0)
+	{
+		struct stat st;
+		if(fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+		{
+			// allocated the way pugixml frees it, the document owns it from here on
+			const size_t size = (size_t)st.st_size;
+			char* buffer = (char*)pugi::get_memory_allocation_function()(size);
+
+			size_t done = 0;
+			while(buffer && done < size)
+			{
+				const ssize_t got = read(fd, buffer + done, size - done);
+				if(got < 0 && errno == EINTR)
+					continue;
+				if(got <= 0)
+					break;
+				done += (size_t)got;
+			}
+			close(fd);
+
+			if(buffer && done > 0)
+			{
+				if(done < size)
+					LOG(LogWarning) << path << " got shorter while it was read, parsing what was there";
+
+				pugi::xml_parse_result result = mDocument.load_buffer_inplace_own(buffer, done, options);
+				if(!result)
+					mDocument.reset();
+				return result;
+			}
+
+			if(buffer)
+				pugi::get_memory_deallocation_function()(buffer);
+			LOG(LogDebug) << "Could not read " << path << " directly, leaving it to pugixml";
+		}else{
+			close(fd);
+		}
+	}
+#endif
+
+	return mDocument.load_file(path.c_str(), options);
+}
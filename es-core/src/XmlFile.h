@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+#include "pugixml/pugixml.hpp"
+
+// parse flags for documents that are only read: everything pugixml does by default except converting whitespace in attributes
+#define XML_PARSE_READONLY (pugi::parse_default & ~pugi::parse_wconv_attribute)
+
+// An XML document parsed in place from a single heap copy of its file. The file is read once with plain read() calls
+// into a buffer the document takes ownership of, so there's no stdio buffering in between and no second copy.
+// It isn't mapped: a theme or es_systems.cfg that's rewritten while we parse it would have the mapping truncated
+// under us (SIGBUS), a read just comes back short.
+// Meant for files that are read and dropped (es_systems.cfg, themes, es_settings.cfg).
+// Falls back to pugixml's load_file() where this isn't possible (Windows, empty or special files).
+class XmlFile
+{
+public:
+	XmlFile();
+
+	pugi::xml_parse_result load(const std::string& path, unsigned int options = XML_PARSE_READONLY);
+
+	inline pugi::xml_document& document() { return mDocument; }
+	inline pugi::xml_node child(const char* name) const { return mDocument.child(name); }
+
+private:
+	XmlFile(const XmlFile&);
+	XmlFile& operator=(const XmlFile&);
+
+	pugi::xml_document mDocument;
+};
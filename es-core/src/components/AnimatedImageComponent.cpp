@@ -1,17 +1,36 @@
 #include "components/AnimatedImageComponent.h"
 #include "Log.h"
+#include "Window.h"
 
 AnimatedImageComponent::AnimatedImageComponent(Window* window) : GuiComponent(window), mEnabled(false)
 {
+	setUpdating(true);
 }
 
 void AnimatedImageComponent::load(const AnimationDef* def)
 {
 	mFrames.clear();
+	mSheet.reset();
 
 	assert(def->frameCount >= 1);
 
-	for(size_t i = 0; i < def->frameCount; i++)
+	if(def->sheet != NULL)
+	{
+		if(ResourceManager::getInstance()->fileExists(def->sheet))
+		{
+			mSheet = std::unique_ptr<ImageComponent>(new ImageComponent(mWindow));
+			mSheet->setSpriteSheet(def->sheetColumns, def->sheetRows);
+			mSheet->setResize(mSize.x(), mSize.y());
+			mSheet->setImage(std::string(def->sheet), false);
+
+			for(size_t i = 0; i < def->frameCount; i++)
+				mFrames.push_back(ImageFrame(std::unique_ptr<ImageComponent>(), def->frames[i].time));
+		}else{
+			LOG(LogError) << "Missing animation sprite sheet \"" << def->sheet << "\"";
+		}
+	}
+
+	for(size_t i = 0; def->sheet == NULL && i < def->frameCount; i++)
 	{
 		if(def->frames[i].path != NULL && !ResourceManager::getInstance()->fileExists(def->frames[i].path))
 		{
@@ -37,13 +56,19 @@ void AnimatedImageComponent::reset()
 {
 	mCurrentFrame = 0;
 	mFrameAccumulator = 0;
+	if(mSheet)
+		mSheet->setSpriteFrame(0);
 }
 
 void AnimatedImageComponent::onSizeChanged()
 {
+	if(mSheet)
+		mSheet->setResize(mSize.x(), mSize.y());
+
 	for(auto it = mFrames.begin(); it != mFrames.end(); it++)
 	{
-		it->first->setResize(mSize.x(), mSize.y());
+		if(it->first)
+			it->first->setResize(mSize.x(), mSize.y());
 	}
 }
 
@@ -54,6 +79,7 @@ void AnimatedImageComponent::update(int deltaTime)
 
 	mFrameAccumulator += deltaTime;
 
+	const int oldFrame = mCurrentFrame;
 	while(mFrames.at(mCurrentFrame).second <= mFrameAccumulator)
 	{
 		mCurrentFrame++;
@@ -74,10 +100,19 @@ void AnimatedImageComponent::update(int deltaTime)
 
 		mFrameAccumulator -= mFrames.at(mCurrentFrame).second;
 	}
+
+	if(mCurrentFrame != oldFrame)
+	{
+		if(mSheet)
+			mSheet->setSpriteFrame(mCurrentFrame);
+		invalidate();
+	}
 }
 
 void AnimatedImageComponent::render(const Eigen::Affine3f& trans)
 {
-	if(mFrames.size())
+	if(mSheet)
+		mSheet->render(getTransform() * trans);
+	else if(mFrames.size())
 		mFrames.at(mCurrentFrame).first->render(getTransform() * trans);
 }
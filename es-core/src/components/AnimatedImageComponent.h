@@ -12,6 +12,12 @@ struct AnimationDef
 	AnimationFrame* frames;
 	size_t frameCount;
 	bool loop;
+
+	// If set, every frame is a cell of this one image (a sprite sheet, see ImageComponent::setSpriteSheet()) and
+	// frames[i].path is ignored - one texture instead of one per frame.
+	const char* sheet;
+	unsigned int sheetColumns;
+	unsigned int sheetRows;
 };
 
 class AnimatedImageComponent : public GuiComponent
@@ -31,7 +37,8 @@ public:
 private:
 	typedef std::pair<std::unique_ptr<ImageComponent>, int> ImageFrame;
 
-	std::vector<ImageFrame> mFrames;
+	std::vector<ImageFrame> mFrames; // the images are NULL with a sheet
+	std::unique_ptr<ImageComponent> mSheet;
 
 	bool mLoop;
 	bool mEnabled;
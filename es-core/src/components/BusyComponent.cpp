@@ -4,14 +4,14 @@
 #include "components/TextComponent.h"
 #include "Renderer.h"
 
-// animation definition
+// animation definition, all four frames are side by side in busy.svg
 AnimationFrame BUSY_ANIMATION_FRAMES[] = {
-	{":/busy_0.svg", 300},
-	{":/busy_1.svg", 300},
-	{":/busy_2.svg", 300},
-	{":/busy_3.svg", 300},
+	{NULL, 300},
+	{NULL, 300},
+	{NULL, 300},
+	{NULL, 300},
 };
-const AnimationDef BUSY_ANIMATION_DEF = { BUSY_ANIMATION_FRAMES, 4, true };
+const AnimationDef BUSY_ANIMATION_DEF = { BUSY_ANIMATION_FRAMES, 4, true, ":/busy.svg", 4, 1 };
 
 using namespace Eigen;
 
@@ -6,8 +6,9 @@
 using namespace GridFlags;
 
 ComponentGrid::ComponentGrid(Window* window, const Eigen::Vector2i& gridDimensions) : GuiComponent(window), 
-	mGridSize(gridDimensions), mCursor(0, 0)
+	mLayoutDirty(false), mGridSize(gridDimensions), mCursor(0, 0)
 {
+	setUpdating(true);
 	assert(gridDimensions.x() > 0 && gridDimensions.y() > 0);
 
 	mCells.reserve(gridDimensions.x() * gridDimensions.y());
@@ -101,8 +102,7 @@ void ComponentGrid::setEntry(const std::shared_ptr<GuiComponent>& comp, const Ei
 		onCursorMoved(origCursor, mCursor);
 	}
 
-	updateCellComponent(mCells.back());
-	updateSeparators();
+	onSizeChanged();
 }
 
 bool ComponentGrid::removeEntry(const std::shared_ptr<GuiComponent>& comp)
@@ -113,6 +113,7 @@ bool ComponentGrid::removeEntry(const std::shared_ptr<GuiComponent>& comp)
 		{
 			removeChild(comp.get());
 			mCells.erase(it);
+			onSizeChanged();
 			return true;
 		}
 	}
@@ -123,22 +124,15 @@ bool ComponentGrid::removeEntry(const std::shared_ptr<GuiComponent>& comp)
 void ComponentGrid::updateCellComponent(const GridEntry& cell)
 {
 	// size
-	Eigen::Vector2f size(0, 0);
-	for(int x = cell.pos.x(); x < cell.pos.x() + cell.dim.x(); x++)
-		size[0] += getColWidth(x);
-	for(int y = cell.pos.y(); y < cell.pos.y() + cell.dim.y(); y++)
-		size[1] += getRowHeight(y);
+	const Eigen::Vector2f size(mColEdges[cell.pos.x() + cell.dim.x()] - mColEdges[cell.pos.x()],
+		mRowEdges[cell.pos.y() + cell.dim.y()] - mRowEdges[cell.pos.y()]);
 
 	if(cell.resize)
 		cell.component->setSize(size);
 
 	// position
 	// find top left corner
-	Eigen::Vector3f pos(0, 0, 0);
-	for(int x = 0; x < cell.pos.x(); x++)
-		pos[0] += getColWidth(x);
-	for(int y = 0; y < cell.pos.y(); y++)
-		pos[1] += getRowHeight(y);
+	Eigen::Vector3f pos(mColEdges[cell.pos.x()], mRowEdges[cell.pos.y()], 0);
 
 	// center component
 	pos[0] = pos.x() + (size.x() - cell.component->getSize().x()) / 2;
@@ -161,16 +155,8 @@ void ComponentGrid::updateSeparators()
 			continue;
 
 		// find component position + size
-		pos << 0, 0;
-		size << 0, 0;
-		for(int x = 0; x < it->pos.x(); x++)
-			pos[0] += getColWidth(x);
-		for(int y = 0; y < it->pos.y(); y++)
-			pos[1] += getRowHeight(y);
-		for(int x = it->pos.x(); x < it->pos.x() + it->dim.x(); x++)
-			size[0] += getColWidth(x);
-		for(int y = it->pos.y(); y < it->pos.y() + it->dim.y(); y++)
-			size[1] += getRowHeight(y);
+		pos << mColEdges[it->pos.x()], mRowEdges[it->pos.y()];
+		size << mColEdges[it->pos.x() + it->dim.x()] - pos.x(), mRowEdges[it->pos.y() + it->dim.y()] - pos.y();
 
 		if(it->border & BORDER_TOP || drawAll)
 		{
@@ -194,12 +180,32 @@ void ComponentGrid::updateSeparators()
 		}
 	}
 
-	mLineColors.reserve(mLines.size());
+	mLineColors.resize(mLines.size());
 	Renderer::buildGLColorArray((GLubyte*)mLineColors.data(), 0xC6C7C6FF, mLines.size());
 }
 
 void ComponentGrid::onSizeChanged()
 {
+	mLayoutDirty = true;
+	invalidate();
+}
+
+void ComponentGrid::updateLayout()
+{
+	if(!mLayoutDirty)
+		return;
+	mLayoutDirty = false;
+
+	// every column and row once, then each cell is a lookup
+	mColEdges.resize(mGridSize.x() + 1);
+	mRowEdges.resize(mGridSize.y() + 1);
+	mColEdges[0] = 0;
+	mRowEdges[0] = 0;
+	for(int x = 0; x < mGridSize.x(); x++)
+		mColEdges[x + 1] = mColEdges[x] + getColWidth(x);
+	for(int y = 0; y < mGridSize.y(); y++)
+		mRowEdges[y + 1] = mRowEdges[y] + getRowHeight(y);
+
 	for(auto it = mCells.begin(); it != mCells.end(); it++)
 		updateCellComponent(*it);
 
@@ -346,6 +352,8 @@ bool ComponentGrid::cursorValid()
 
 void ComponentGrid::update(int deltaTime)
 {
+	updateLayout();
+
 	// update ALL THE THINGS
 	GridEntry* cursorEntry = getCellAt(mCursor);
 	for(auto it = mCells.begin(); it != mCells.end(); it++)
@@ -357,7 +365,9 @@ void ComponentGrid::update(int deltaTime)
 
 void ComponentGrid::render(const Eigen::Affine3f& parentTrans)
 {
-	Eigen::Affine3f trans = parentTrans * getTransform();
+	updateLayout();
+
+	Eigen::Affine3f trans = getWorldTransform(parentTrans);
 
 	renderChildren(trans);
 	
@@ -366,19 +376,16 @@ void ComponentGrid::render(const Eigen::Affine3f& parentTrans)
 	{
 		Renderer::setMatrix(trans);
 
-		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-		glEnableClientState(GL_VERTEX_ARRAY);
-		glEnableClientState(GL_COLOR_ARRAY);
-
-		glVertexPointer(2, GL_FLOAT, 0, &mLines[0].x);
-		glColorPointer(4, GL_UNSIGNED_BYTE, 0, mLineColors.data());
+		Renderer::setTextureEnabled(false);
+		Renderer::setBlendEnabled(true);
+		Renderer::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		Renderer::setClientArrays(true, false, true);
 
-		glDrawArrays(GL_LINES, 0, mLines.size());
+		Renderer::useClientArrays();
+		Renderer::vertexPointer(2, GL_FLOAT, 0, &mLines[0].x);
+		Renderer::colorPointer(4, GL_UNSIGNED_BYTE, 0, mLineColors.data());
 
-		glDisable(GL_BLEND);
-		glDisableClientState(GL_VERTEX_ARRAY);
-		glDisableClientState(GL_COLOR_ARRAY);
+		Renderer::drawArrays(GL_LINES, 0, mLines.size());
 	}
 }
 
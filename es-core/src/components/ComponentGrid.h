@@ -38,7 +38,12 @@ public:
 	bool input(InputConfig* config, Input input) override;
 	void update(int deltaTime) override;
 	void render(const Eigen::Affine3f& parentTrans) override;
-	void onSizeChanged() override;
+	void onSizeChanged() override; // only flags the layout, see updateLayout()
+
+	// Positions and sizes every cell's component, if anything changed since the last time. Changes (sizes, new entries,
+	// column widths...) only flag the layout, and this runs before the next update() or render(), so building a grid
+	// lays it out once. Call it directly if something needs the cells in place before that.
+	void updateLayout();
 
 	void resetCursor();
 	bool cursorValid();
@@ -46,8 +51,8 @@ public:
 	float getColWidth(int col);
 	float getRowHeight(int row);
 
-	void setColWidthPerc(int col, float width, bool update = true); // if update is false, will not call an onSizeChanged() which triggers a (potentially costly) repositioning + resizing of every element
-	void setRowHeightPerc(int row, float height, bool update = true); // if update is false, will not call an onSizeChanged() which triggers a (potentially costly) repositioning + resizing of every element
+	void setColWidthPerc(int col, float width, bool update = true); // if update is false, the layout isn't flagged (the next change that does flag it picks this up)
+	void setRowHeightPerc(int row, float height, bool update = true); // if update is false, the layout isn't flagged (the next change that does flag it picks this up)
 
 	bool moveCursor(Eigen::Vector2i dir);
 	void setCursorTo(const std::shared_ptr<GuiComponent>& comp);
@@ -103,10 +108,14 @@ private:
 	std::vector<Vert> mLines;
 	std::vector<unsigned int> mLineColors;
 
-	// Update position & size
+	// Update position & size, from the edges updateLayout() found
 	void updateCellComponent(const GridEntry& cell);
 	void updateSeparators();
 
+	bool mLayoutDirty;
+	std::vector<float> mColEdges; // x of each column's left edge, then the right edge of the last one
+	std::vector<float> mRowEdges; // same for rows
+
 	GridEntry* getCellAt(int x, int y);
 	inline GridEntry* getCellAt(const Eigen::Vector2i& pos) { return getCellAt(pos.x(), pos.y()); }
 	
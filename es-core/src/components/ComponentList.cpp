@@ -6,6 +6,7 @@
 
 ComponentList::ComponentList(Window* window) : IList<ComponentListRow, void*>(window, LIST_SCROLL_STYLE_SLOW, LIST_NEVER_LOOP)
 {
+	setUpdating(true);
 	mSelectorBarOffset = 0;
 	mCameraOffset = 0;
 	mFocused = false;
@@ -161,7 +162,7 @@ void ComponentList::render(const Eigen::Affine3f& parentTrans)
 	if(!size())
 		return;
 
-	Eigen::Affine3f trans = roundMatrix(parentTrans * getTransform());
+	Eigen::Affine3f trans = roundMatrix(getWorldTransform(parentTrans));
 
 	// clip everything to be inside our bounds
 	Eigen::Vector3f dim(mSize.x(), mSize.y(), 0);
@@ -183,7 +184,7 @@ void ComponentList::render(const Eigen::Affine3f& parentTrans)
 		{
 			if(drawAll || it->invert_when_selected)
 			{
-				it->component->render(trans);
+				it->component->draw(trans);
 			}else{
 				drawAfterCursor.push_back(it->component.get());
 			}
@@ -3,17 +3,20 @@
 #include "Window.h"
 #include "Log.h"
 #include "Util.h"
+#include <stdio.h>
 
 DateTimeComponent::DateTimeComponent(Window* window, DisplayMode dispMode) : GuiComponent(window), 
 	mEditing(false), mEditIndex(0), mDisplayMode(dispMode), mRelativeUpdateAccumulator(0), 
 	mColor(0x777777FF), mFont(Font::get(FONT_SIZE_SMALL, FONT_PATH_LIGHT)), mUppercase(false), mAutoSize(true)
 {
+	setUpdating(mDisplayMode == DISP_RELATIVE_TO_NOW);
 	updateTextCache();
 }
 
 void DateTimeComponent::setDisplayMode(DisplayMode mode)
 {
 	mDisplayMode = mode;
+	setUpdating(mDisplayMode == DISP_RELATIVE_TO_NOW);
 	updateTextCache();
 }
 
@@ -127,7 +130,13 @@ void DateTimeComponent::update(int deltaTime)
 		if(mRelativeUpdateAccumulator > 1000)
 		{
 			mRelativeUpdateAccumulator = 0;
-			updateTextCache();
+
+			// "3 days ago" stays the same for a long time, only lay it out again when it changes
+			if(getDisplayText() != mDisplayText)
+			{
+				updateTextCache();
+				invalidate();
+			}
 		}
 	}
 
@@ -136,7 +145,7 @@ void DateTimeComponent::update(int deltaTime)
 
 void DateTimeComponent::render(const Eigen::Affine3f& parentTrans)
 {
-	Eigen::Affine3f trans = parentTrans * getTransform();
+	Eigen::Affine3f trans = getWorldTransform(parentTrans);
 
 	if(mTextCache)
 	{
@@ -165,13 +174,17 @@ void DateTimeComponent::render(const Eigen::Affine3f& parentTrans)
 
 void DateTimeComponent::setValue(const std::string& val)
 {
-	mTime = string_to_ptime(val);
+	const boost::posix_time::ptime time = parseIsoTime(val);
+	if(time == mTime && mTextCache && !mEditing)
+		return;
+
+	mTime = time;
 	updateTextCache();
 }
 
 std::string DateTimeComponent::getValue() const
 {
-	return boost::posix_time::to_iso_string(mTime);
+	return formatIsoTime(mTime);
 }
 
 DateTimeComponent::DisplayMode DateTimeComponent::getCurrentDisplayMode() const
@@ -190,14 +203,10 @@ DateTimeComponent::DisplayMode DateTimeComponent::getCurrentDisplayMode() const
 
 std::string DateTimeComponent::getDisplayString(DisplayMode mode) const
 {
-	std::string fmt;
 	switch(mode)
 	{
 	case DISP_DATE:
-		fmt = "%m/%d/%Y";
-		break;
 	case DISP_DATE_TIME:
-		fmt = "%m/%d/%Y %H:%M:%S";
 		break;
 	case DISP_RELATIVE_TO_NOW:
 		{
@@ -225,17 +234,27 @@ std::string DateTimeComponent::getDisplayString(DisplayMode mode) const
 		break;
 	}
 	
-	if(mTime == boost::posix_time::not_a_date_time)
+	if(mTime.is_special())
 		return "unknown";
 
-	boost::posix_time::time_facet* facet = new boost::posix_time::time_facet();
-	facet->format(fmt.c_str());
-	std::locale loc(std::locale::classic(), facet);
+	// "%m/%d/%Y" or "%m/%d/%Y %H:%M:%S", without going through a time_facet
+	const boost::gregorian::date::ymd_type ymd = mTime.date().year_month_day();
+	char buf[32];
+	if(mode == DISP_DATE)
+	{
+		snprintf(buf, sizeof(buf), "%02d/%02d/%04d", (int)ymd.month, (int)ymd.day, (int)ymd.year);
+	}else{
+		const boost::posix_time::time_duration tod = mTime.time_of_day();
+		snprintf(buf, sizeof(buf), "%02d/%02d/%04d %02d:%02d:%02d", (int)ymd.month, (int)ymd.day, (int)ymd.year, 
+			(int)tod.hours(), (int)tod.minutes(), (int)tod.seconds());
+	}
+	return buf;
+}
 
-	std::stringstream ss;
-	ss.imbue(loc);
-	ss << mTime;
-	return ss.str();
+std::string DateTimeComponent::getDisplayText() const
+{
+	std::string text = getDisplayString(getCurrentDisplayMode());
+	return mUppercase ? strToUpper(text) : text;
 }
 
 std::shared_ptr<Font> DateTimeComponent::getFont() const
@@ -249,7 +268,8 @@ std::shared_ptr<Font> DateTimeComponent::getFont() const
 void DateTimeComponent::updateTextCache()
 {
 	DisplayMode mode = getCurrentDisplayMode();
-	const std::string dispString = mUppercase ? strToUpper(getDisplayString(mode)) : getDisplayString(mode);
+	mDisplayText = getDisplayText();
+	const std::string& dispString = mDisplayText;
 	std::shared_ptr<Font> font = getFont();
 	mTextCache = std::unique_ptr<TextCache>(font->buildTextCache(dispString, 0, 0, mColor));
 
@@ -268,21 +288,24 @@ void DateTimeComponent::updateTextCache()
 	if(dispString.empty() || mode == DISP_RELATIVE_TO_NOW)
 		return;
 
+	// the first n characters, measured where they are
+	auto sizeStart = [&](size_t n) { return font->sizeText(dispString.data(), std::min(n, dispString.length())); };
+
 	//month
 	Eigen::Vector2f start(0, 0);
-	Eigen::Vector2f end = font->sizeText(dispString.substr(0, 2));
+	Eigen::Vector2f end = sizeStart(2);
 	Eigen::Vector2f diff = end - start;
 	mCursorBoxes.push_back(Eigen::Vector4f(start[0], start[1], diff[0], diff[1]));
 
 	//day
-	start[0] = font->sizeText(dispString.substr(0, 3)).x();
-	end = font->sizeText(dispString.substr(0, 5));
+	start[0] = sizeStart(3).x();
+	end = sizeStart(5);
 	diff = end - start;
 	mCursorBoxes.push_back(Eigen::Vector4f(start[0], start[1], diff[0], diff[1]));
 
 	//year
-	start[0] = font->sizeText(dispString.substr(0, 6)).x();
-	end = font->sizeText(dispString.substr(0, 10));
+	start[0] = sizeStart(6).x();
+	end = sizeStart(10);
 	diff = end - start;
 	mCursorBoxes.push_back(Eigen::Vector4f(start[0], start[1], diff[0], diff[1]));
 
@@ -324,17 +347,17 @@ void DateTimeComponent::applyTheme(const std::shared_ptr<ThemeData>& theme, cons
 	// setSize(), which will call updateTextCache(), which will reset mSize if 
 	// mAutoSize == true, ignoring the theme's value.
 	if(properties & ThemeFlags::SIZE)
-		mAutoSize = !elem->has("size");
+		mAutoSize = !elem->has(ThemeProperties::SIZE);
 
 	GuiComponent::applyTheme(theme, view, element, properties);
 
 	using namespace ThemeFlags;
 
-	if(properties & COLOR && elem->has("color"))
-		setColor(elem->get<unsigned int>("color"));
+	if(properties & COLOR && elem->has(ThemeProperties::COLOR))
+		setColor(elem->get<unsigned int>(ThemeProperties::COLOR));
 
-	if(properties & FORCE_UPPERCASE && elem->has("forceUppercase"))
-		setUppercase(elem->get<bool>("forceUppercase"));
+	if(properties & FORCE_UPPERCASE && elem->has(ThemeProperties::FORCE_UPPERCASE))
+		setUppercase(elem->get<bool>(ThemeProperties::FORCE_UPPERCASE));
 
 	setFont(Font::getFromTheme(elem, properties, mFont));
 }
@@ -42,6 +42,7 @@ private:
 	std::shared_ptr<Font> getFont() const;
 
 	std::string getDisplayString(DisplayMode mode) const;
+	std::string getDisplayText() const; // the display string, uppercased if needed
 	DisplayMode getCurrentDisplayMode() const;
 	
 	void updateTextCache();
@@ -56,6 +57,7 @@ private:
 	int mRelativeUpdateAccumulator;
 
 	std::unique_ptr<TextCache> mTextCache;
+	std::string mDisplayText; // what mTextCache was built from
 	std::vector<Eigen::Vector4f> mCursorBoxes;
 
 	unsigned int mColor;
@@ -7,12 +7,14 @@
 #include "components/TextComponent.h"
 #include "components/ComponentGrid.h"
 #include <boost/assign.hpp>
+#include <tuple>
 
 #define OFFSET_X 12 // move the entire thing right by this amount (px)
 #define OFFSET_Y 12 // move the entire thing up by this amount (px)
 
 #define ICON_TEXT_SPACING 8 // space between [icon] and [text] (px)
 #define ENTRY_SPACING 16 // space between [text] and next [icon] (px)
+#define PROMPT_CACHE_SIZE 64 // icon/label pairs kept, the cache starts over past this
 
 using namespace Eigen;
 
@@ -51,15 +53,30 @@ void HelpComponent::setStyle(const HelpStyle& style)
 	updateGrid();
 }
 
+void HelpComponent::setPrompts(const std::vector<HelpPrompt>& prompts, const HelpStyle& style)
+{
+	mPrompts = prompts;
+	mStyle = style;
+	updateGrid();
+}
+
+bool HelpComponent::PromptKey::operator<(const PromptKey& other) const
+{
+	return std::tie(icon, label, iconColor, textColor, font) < std::tie(other.icon, other.label, other.iconColor, other.textColor, other.font);
+}
+
 void HelpComponent::updateGrid()
 {
+	// let go of the old grid first, so the components it had can go in the new one
+	mGrid.reset();
+	invalidate();
+
 	if(!Settings::getInstance()->getBool("ShowHelpPrompts") || mPrompts.empty())
-	{
-		mGrid.reset();
 		return;
-	}
 
 	std::shared_ptr<Font>& font = mStyle.font;
+	if(mPromptCache.size() > PROMPT_CACHE_SIZE)
+		mPromptCache.clear();
 
 	mGrid = std::make_shared<ComponentGrid>(mWindow, Vector2i(mPrompts.size() * 4, 1));
 	// [icon] [spacer1] [text] [spacer2]
@@ -71,13 +88,25 @@ void HelpComponent::updateGrid()
 	const float height = round(font->getLetterHeight() * 1.25f);
 	for(auto it = mPrompts.begin(); it != mPrompts.end(); it++)
 	{
-		auto icon = std::make_shared<ImageComponent>(mWindow);
-		icon->setImage(getIconTexture(it->first));
-		icon->setColorShift(mStyle.iconColor);
-		icon->setResize(0, height);
+		const PromptKey key = { it->first, it->second, mStyle.iconColor, mStyle.textColor, font.get() };
+		PromptEntry& entry = mPromptCache[key];
+		if(!entry.icon)
+		{
+			entry.icon = std::make_shared<ImageComponent>(mWindow);
+			entry.icon->setImage(getIconTexture(it->first));
+			entry.icon->setColorShift(mStyle.iconColor);
+			entry.icon->setResize(0, height);
+
+			entry.label = std::make_shared<TextComponent>(mWindow, strToUpper(it->second), font, mStyle.textColor);
+		}else{
+			// as if they were new
+			entry.icon->setOpacity(255);
+			entry.label->setOpacity(255);
+		}
+
+		auto& icon = entry.icon;
+		auto& lbl = entry.label;
 		icons.push_back(icon);
-
-		auto lbl = std::make_shared<TextComponent>(mWindow, strToUpper(it->second), font, mStyle.textColor);
 		labels.push_back(lbl);
 
 		width += icon->getSize().x() + lbl->getSize().x() + ICON_TEXT_SPACING + ENTRY_SPACING;
@@ -134,7 +163,7 @@ void HelpComponent::setOpacity(unsigned char opacity)
 
 void HelpComponent::render(const Eigen::Affine3f& parentTrans)
 {
-	Eigen::Affine3f trans = parentTrans * getTransform();
+	Eigen::Affine3f trans = getWorldTransform(parentTrans);
 	
 	if(mGrid)
 		mGrid->render(trans);
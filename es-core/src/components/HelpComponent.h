@@ -4,6 +4,7 @@
 #include "HelpStyle.h"
 
 class ImageComponent;
+class TextComponent;
 class TextureResource;
 class ComponentGrid;
 
@@ -19,6 +20,7 @@ public:
 	void setOpacity(unsigned char opacity) override;
 
 	void setStyle(const HelpStyle& style);
+	void setPrompts(const std::vector<HelpPrompt>& prompts, const HelpStyle& style); // both, rebuilding only once
 
 private:
 	std::shared_ptr<TextureResource> getIconTexture(const char* name);
@@ -27,6 +29,24 @@ private:
 	std::shared_ptr<ComponentGrid> mGrid;
 	void updateGrid();
 
+	// the icon and label made for a prompt, used again whenever it's shown in the same style
+	struct PromptKey
+	{
+		std::string icon;
+		std::string label;
+		unsigned int iconColor;
+		unsigned int textColor;
+		Font* font;
+
+		bool operator<(const PromptKey& other) const;
+	};
+	struct PromptEntry
+	{
+		std::shared_ptr<ImageComponent> icon;
+		std::shared_ptr<TextComponent> label;
+	};
+	std::map<PromptKey, PromptEntry> mPromptCache;
+
 	std::vector<HelpPrompt> mPrompts;
 	HelpStyle mStyle;
 };
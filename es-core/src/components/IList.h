@@ -7,6 +7,8 @@
 #include "components/ImageComponent.h"
 #include "resources/Font.h"
 #include "Renderer.h"
+#include "Window.h"
+#include "ThermalGovernor.h"
 
 enum CursorState
 {
@@ -113,6 +115,10 @@ public:
 		onCursorChanged(CURSOR_STOPPED);
 	}
 
+	inline int getCursorIndex() const { return mCursor; }
+	inline const UserData& getObjectAt(int index) const { return mEntries.at((unsigned int)index).object; }
+	inline int getScrollVelocity() const { return mScrollVelocity; } // 0 when not scrolling, sign is the direction
+
 	inline const std::string& getSelectedName()
 	{
 		assert(size() > 0);
@@ -154,6 +160,34 @@ public:
 		mEntries.push_back(e);
 	}
 
+	// inserts e before index (size() appends), the cursor stays on the entry it was on
+	void insert(int index, const Entry& e)
+	{
+		assert(index >= 0 && index <= size());
+		mEntries.insert(mEntries.begin() + index, e);
+		if(index <= mCursor && mEntries.size() > 1)
+			mCursor++;
+	}
+
+	void removeAt(int index)
+	{
+		auto it = mEntries.begin() + index;
+		remove(it);
+	}
+
+	// -1 if obj isn't in the list
+	int indexOf(const UserData& obj) const
+	{
+		for(unsigned int i = 0; i < mEntries.size(); i++)
+		{
+			if(mEntries[i].object == obj)
+				return (int)i;
+		}
+		return -1;
+	}
+
+	inline void setName(int index, const std::string& name) { mEntries.at(index).name = name; }
+
 	bool remove(const UserData& obj)
 	{
 		for(auto it = mEntries.begin(); it != mEntries.end(); it++)
@@ -203,6 +237,7 @@ protected:
 	{
 		// update the title overlay opacity
 		const int dir = (mScrollTier >= mTierList.count - 1) ? 1 : -1; // fade in if scroll tier is >= 1, otherwise fade out
+		const unsigned char oldOpacity = mTitleOverlayOpacity;
 		int op = mTitleOverlayOpacity + deltaTime*dir; // we just do a 1-to-1 time -> opacity, no scaling
 		if(op >= 255)
 			mTitleOverlayOpacity = 255;
@@ -211,6 +246,9 @@ protected:
 		else
 			mTitleOverlayOpacity = (unsigned char)op;
 
+		if(mTitleOverlayOpacity != oldOpacity)
+			invalidate();
+
 		if(mScrollVelocity == 0 || size() < 2)
 			return;
 
@@ -252,11 +290,16 @@ protected:
 		
 		Eigen::Affine3f identTrans = Eigen::Affine3f::Identity();
 
-		mGradient.setOpacity(mTitleOverlayOpacity);
-		mGradient.render(identTrans);
+		// a full screen of blending, the first thing to go when the board is hot
+		if(ThermalGovernor::getInstance()->effectsEnabled())
+		{
+			mGradient.setOpacity(mTitleOverlayOpacity);
+			mGradient.render(identTrans);
+		}
+		Renderer::setMatrix(identTrans);
 
 		TextCache* cache = mTitleOverlayFont->buildTextCache(text, off.x(), off.y(), 0xFFFFFF00 | mTitleOverlayOpacity);
-		mTitleOverlayFont->renderTextCache(cache); // relies on mGradient's render for Renderer::setMatrix()
+		mTitleOverlayFont->renderTextCache(cache);
 		delete cache;
 	}
 
@@ -293,7 +336,10 @@ protected:
 		}
 
 		if(cursor != mCursor)
+		{
 			onScroll(absAmt);
+			invalidate();
+		}
 
 		mCursor = cursor;
 		onCursorChanged((mScrollTier > 0) ? CURSOR_SCROLLING : CURSOR_STOPPED);
@@ -2,11 +2,17 @@
 #include <iostream>
 #include <boost/filesystem.hpp>
 #include <math.h>
+#include <algorithm>
+#include <string.h>
 #include "Log.h"
 #include "Renderer.h"
 #include "ThemeData.h"
 #include "Util.h"
+#include "Settings.h"
+#include "ResourceGovernor.h"
+#include "GpuProfiler.h"
 #include "resources/SVGResource.h"
+#include "Window.h"
 
 Eigen::Vector2i ImageComponent::getTextureSize() const
 {
@@ -23,7 +29,8 @@ Eigen::Vector2f ImageComponent::getCenter() const
 }
 
 ImageComponent::ImageComponent(Window* window) : GuiComponent(window), 
-	mTargetIsMax(false), mFlipX(false), mFlipY(false), mOrigin(0.0, 0.0), mTargetSize(0, 0), mColorShift(0xFFFFFFFF)
+	mTargetIsMax(false), mFlipX(false), mFlipY(false), mLoadAsync(false), mDownscale(false), mMipmap(false), mWaitingForTexture(false), mDrawnLoading(false), mTextureGeneration(0), mOrigin(0.0, 0.0), mTargetSize(0, 0), mColorShift(0xFFFFFFFF), 
+	mSpriteGrid(1, 1), mSpriteFrame(0), mSpriteFrameCount(1), mSpriteFrameTime(0), mSpriteTime(0), mSpriteLoop(false)
 {
 	updateColors();
 }
@@ -34,12 +41,19 @@ ImageComponent::~ImageComponent()
 
 void ImageComponent::resize()
 {
-	if(!mTexture)
+	// a preview has the right aspect ratio, it's laid out like the real thing and then again once that's in
+	mWaitingForTexture = mTexture && mTexture->isLoading();
+	if(!mTexture || (mWaitingForTexture && !mTexture->isPreview()))
 		return;
 
 	SVGResource* svg = dynamic_cast<SVGResource*>(mTexture.get());
 
-	const Eigen::Vector2f textureSize = svg ? svg->getSourceImageSize() : Eigen::Vector2f((float)mTexture->getSize().x(), (float)mTexture->getSize().y());
+	Eigen::Vector2f textureSize = svg ? svg->getSourceImageSize() : Eigen::Vector2f((float)mTexture->getSize().x(), (float)mTexture->getSize().y());
+
+	// a sprite sheet is laid out by one frame
+	if(!mTexture->isTiled())
+		textureSize = textureSize.cwiseQuotient(mSpriteGrid.cast<float>());
+
 	if(textureSize.isZero())
 		return;
 
@@ -94,7 +108,12 @@ void ImageComponent::resize()
 	if(svg)
 	{
 		// mSize.y() should already be rounded
-		svg->rasterizeAt((int)round(mSize.x()), (int)round(mSize.y()));
+		svg->rasterizeAt((int)round(mSize.x() * mSpriteGrid.x()), (int)round(mSize.y() * mSpriteGrid.y()));
+	}else if(mMipmap || (mSize.x() > 0 && mSize.y() > 0 && Settings::getInstance()->getBool("AutoMipmap") && 
+		(textureSize.x() >= mSize.x() * 2 || textureSize.y() >= mSize.y() * 2)))
+	{
+		// minified a lot, plain linear filtering would alias
+		mTexture->setMipmapped(true);
 	}
 
 	onSizeChanged();
@@ -108,11 +127,42 @@ void ImageComponent::onSizeChanged()
 void ImageComponent::setImage(std::string path, bool tile)
 {
 	if(path.empty() || !ResourceManager::getInstance()->fileExists(path))
+	{
 		mTexture.reset();
-	else
-		mTexture = TextureResource::get(path, tile);
+	}else{
+		mTexture = TextureResource::get(path, tile, mLoadAsync, getLoadMaxSize(tile));
+	}
 
 	resize();
+	invalidate();
+}
+
+Eigen::Vector2i ImageComponent::getLoadMaxSize(bool tile) const
+{
+	// only when both axes are known, with just one set the image could end up any size along the other
+	Eigen::Vector2i maxSize(Eigen::Vector2i::Zero());
+	if(mDownscale && !tile && mTargetSize.x() > 0 && mTargetSize.y() > 0)
+	{
+		maxSize << (int)ceil(mTargetSize.x()), (int)ceil(mTargetSize.y());
+
+		// the profile's cap keeps the aspect ratio of the box it fits in
+		const int cap = ResourceGovernor::getInstance()->getProfile().maxImageSize;
+		if(cap > 0 && std::max(maxSize.x(), maxSize.y()) > cap)
+		{
+			const float scale = (float)cap / std::max(maxSize.x(), maxSize.y());
+			maxSize << std::max(1, (int)(maxSize.x() * scale)), std::max(1, (int)(maxSize.y() * scale));
+		}
+	}
+	return maxSize;
+}
+
+std::shared_ptr<TextureResource> ImageComponent::prefetch(const std::string& path) const
+{
+	if(path.empty() || !ResourceManager::getInstance()->fileExists(path))
+		return nullptr;
+
+	// same arguments as setImage, so it's the same texture
+	return TextureResource::get(path, false, mLoadAsync, getLoadMaxSize(false));
 }
 
 void ImageComponent::setImage(const char* path, size_t length, bool tile)
@@ -123,12 +173,21 @@ void ImageComponent::setImage(const char* path, size_t length, bool tile)
 	mTexture->initFromMemory(path, length);
 	
 	resize();
+	invalidate();
 }
 
 void ImageComponent::setImage(const std::shared_ptr<TextureResource>& texture)
 {
 	mTexture = texture;
 	resize();
+	invalidate();
+}
+
+void ImageComponent::setMipmap(bool mipmap)
+{
+	mMipmap = mipmap;
+	if(mMipmap && mTexture)
+		mTexture->setMipmapped(true);
 }
 
 void ImageComponent::setOrigin(float originX, float originY)
@@ -163,6 +222,38 @@ void ImageComponent::setFlipY(bool flip)
 	updateVertices();
 }
 
+void ImageComponent::setSpriteSheet(unsigned int columns, unsigned int rows)
+{
+	mSpriteGrid << std::max(1u, columns), std::max(1u, rows);
+	mSpriteFrameCount = mSpriteGrid.x() * mSpriteGrid.y();
+	mSpriteFrame = 0;
+	mSpriteTime = 0;
+	resize();
+}
+
+void ImageComponent::setSpriteFrame(unsigned int frame)
+{
+	frame %= mSpriteGrid.x() * mSpriteGrid.y();
+	if(frame == mSpriteFrame)
+		return;
+
+	mSpriteFrame = frame;
+	updateVertices();
+}
+
+void ImageComponent::setSpriteAnimation(unsigned int frameCount, int frameTime, bool loop)
+{
+	const unsigned int frames = mSpriteGrid.x() * mSpriteGrid.y();
+	mSpriteFrameCount = (frameCount == 0 || frameCount > frames) ? frames : frameCount;
+	mSpriteFrameTime = std::max(0, frameTime);
+	mSpriteLoop = loop;
+	mSpriteTime = 0;
+	setSpriteFrame(0);
+
+	if(mSpriteFrameTime > 0)
+		setUpdating(true);
+}
+
 void ImageComponent::setColorShift(unsigned int color)
 {
 	mColorShift = color;
@@ -178,6 +269,8 @@ void ImageComponent::setOpacity(unsigned char opacity)
 
 void ImageComponent::updateVertices()
 {
+	invalidate();
+
 	if(!mTexture || !mTexture->isInitialized())
 		return;
 
@@ -230,45 +323,194 @@ void ImageComponent::updateVertices()
 		for(int i = 1; i < 6; i++)
 			mVertices[i].tex[1] = mVertices[i].tex[1] == py ? 0 : py;
 	}
+
+	// just the current frame of a sprite sheet (v counts up from the bottom row)
+	if(!mTexture->isTiled() && mSpriteGrid != Eigen::Vector2i(1, 1))
+	{
+		const unsigned int column = mSpriteFrame % mSpriteGrid.x();
+		const unsigned int row = mSpriteFrame / mSpriteGrid.x();
+		for(int i = 0; i < 6; i++)
+		{
+			mVertices[i].tex << (column + mVertices[i].tex.x()) / mSpriteGrid.x(), 
+				(mSpriteGrid.y() - 1 - row + mVertices[i].tex.y()) / mSpriteGrid.y();
+		}
+	}
+
+	// the texture might only be part of an atlas page
+	for(int i = 0; i < 6; i++)
+		mVertices[i].tex = mTexture->getTexCoord(mVertices[i].tex.x(), mVertices[i].tex.y());
+
+	mVertexBuffer.markDirty();
+	mTextureGeneration = mTexture->getGeneration();
 }
 
 void ImageComponent::updateColors()
 {
 	Renderer::buildGLColorArray(mColors, mColorShift, 6);
+	invalidate();
+}
+
+void ImageBatch::add(ImageComponent& image, const Eigen::Affine3f& parentTrans)
+{
+	const std::shared_ptr<TextureResource>& texture = image.mTexture;
+	if(image.getChildCount() > 0 || (texture && (texture->isLoading() || !texture->isInitialized())))
+	{
+		image.render(parentTrans);
+		return;
+	}
+
+	if(image.mWaitingForTexture)
+		image.resize();
+
+	image.mDrawnLoading = false;
+	if(!texture || image.mOpacity == 0)
+		return;
+
+	// counts as drawn for eviction, and brings it back if it was evicted
+	texture->bind();
+	if(texture->getGeneration() != image.mTextureGeneration)
+		image.updateVertices();
+
+	Group* group = NULL;
+	for(auto it = mGroups.begin(); it != mGroups.end(); it++)
+	{
+		if(it->texture == texture || it->texture->sharesTextureWith(*texture))
+		{
+			group = &(*it);
+			break;
+		}
+	}
+
+	if(!group)
+	{
+		mGroups.push_back(Group());
+		group = &mGroups.back();
+		group->texture = texture;
+	}
+
+	const Eigen::Affine3f trans = roundMatrix(image.getWorldTransform(parentTrans));
+	for(int i = 0; i < 6; i++)
+	{
+		Vertex v;
+		const Eigen::Vector3f pos = trans * Eigen::Vector3f(image.mVertices[i].pos.x(), image.mVertices[i].pos.y(), 0);
+		v.pos << pos.x(), pos.y();
+		v.tex = image.mVertices[i].tex;
+		memcpy(v.color, image.mColors + i * 4, 4);
+		group->vertices.push_back(v);
+	}
+}
+
+void ImageBatch::draw()
+{
+	if(mGroups.empty())
+		return;
+
+	GpuProfiler::Scope gpuScope(GpuProfiler::SECTION_IMAGES);
+	Renderer::setMatrix(Eigen::Affine3f::Identity());
+	Renderer::setTextureEnabled(true);
+	Renderer::setBlendEnabled(true);
+	Renderer::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	Renderer::setClientArrays(true, true, true);
+
+	for(auto it = mGroups.begin(); it != mGroups.end(); it++)
+	{
+		it->texture->bind();
+
+		const char* base = Renderer::streamVertices(it->vertices.data(), it->vertices.size() * sizeof(Vertex));
+		Renderer::vertexPointer(2, GL_FLOAT, sizeof(Vertex), base + offsetof(Vertex, pos));
+		Renderer::texCoordPointer(2, GL_FLOAT, sizeof(Vertex), base + offsetof(Vertex, tex));
+		Renderer::colorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), base + offsetof(Vertex, color));
+		Renderer::drawArrays(GL_TRIANGLES, 0, (GLsizei)it->vertices.size());
+	}
+
+	mGroups.clear();
+}
+
+bool ImageComponent::getBounds(Eigen::Vector2f& topLeft, Eigen::Vector2f& bottomRight) const
+{
+	// the size isn't final until the texture's loaded
+	if(mWaitingForTexture || mSize.x() == 0 || mSize.y() == 0)
+		return false;
+
+	// drawn around mOrigin
+	topLeft << -mSize.x() * mOrigin.x(), -mSize.y() * mOrigin.y();
+	bottomRight = topLeft + mSize;
+	return true;
+}
+
+void ImageComponent::update(int deltaTime)
+{
+	if(mDrawnLoading && (!mTexture || !mTexture->isLoading()))
+	{
+		mDrawnLoading = false;
+		setUpdating(mSpriteFrameTime > 0);
+		invalidate();
+	}
+
+	if(mSpriteFrameTime > 0)
+	{
+		mSpriteTime += deltaTime;
+		unsigned int frame = mSpriteFrame;
+		while(mSpriteTime >= mSpriteFrameTime)
+		{
+			mSpriteTime -= mSpriteFrameTime;
+			if(frame + 1 < mSpriteFrameCount)
+			{
+				frame++;
+			}else if(mSpriteLoop)
+			{
+				frame = 0;
+			}else{
+				// done, stays on the last frame
+				mSpriteFrameTime = 0;
+				setUpdating(mDrawnLoading);
+				break;
+			}
+		}
+		setSpriteFrame(frame);
+	}
+
+	GuiComponent::update(deltaTime);
 }
 
 void ImageComponent::render(const Eigen::Affine3f& parentTrans)
 {
-	Eigen::Affine3f trans = roundMatrix(parentTrans * getTransform());
+	// our size depends on the texture's, so it has to wait for the texture to finish loading
+	if(mWaitingForTexture && !mTexture->isLoading())
+		resize();
+
+	Eigen::Affine3f trans = roundMatrix(getWorldTransform(parentTrans));
 	Renderer::setMatrix(trans);
-	
-	if(mTexture && mOpacity > 0)
+
+	mDrawnLoading = mTexture && mTexture->isLoading();
+	if(mDrawnLoading)
+		setUpdating(true); // to notice when it's done
+	// a preview is drawn while the real image loads
+	if(mTexture && mOpacity > 0 && (!mTexture->isLoading() || mTexture->isPreview()))
 	{
 		if(mTexture->isInitialized())
 		{
 			// actually draw the image
+			GpuProfiler::Scope gpuScope(GpuProfiler::SECTION_IMAGES);
 			mTexture->bind();
 
-			glEnable(GL_TEXTURE_2D);
-			glEnable(GL_BLEND);
-			glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+			// it was reuploaded (and maybe moved around in the atlas) since we last looked
+			if(mTexture->getGeneration() != mTextureGeneration)
+				updateVertices();
 
-			glEnableClientState(GL_VERTEX_ARRAY);
-			glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-			glEnableClientState(GL_COLOR_ARRAY);
+			Renderer::setTextureEnabled(true);
+			Renderer::setBlendEnabled(true);
+			Renderer::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+			Renderer::setClientArrays(true, true, true);
 
-			glVertexPointer(2, GL_FLOAT, sizeof(Vertex), &mVertices[0].pos);
-			glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), &mVertices[0].tex);
-			glColorPointer(4, GL_UNSIGNED_BYTE, 0, mColors);
+			const char* base = mVertexBuffer.use(mVertices, sizeof(mVertices));
+			Renderer::vertexPointer(2, GL_FLOAT, sizeof(Vertex), base + offsetof(Vertex, pos));
+			Renderer::texCoordPointer(2, GL_FLOAT, sizeof(Vertex), base + offsetof(Vertex, tex));
 
-			glDrawArrays(GL_TRIANGLES, 0, 6);
+			Renderer::useClientArrays();
+			Renderer::colorPointer(4, GL_UNSIGNED_BYTE, 0, mColors);
 
-			glDisableClientState(GL_VERTEX_ARRAY);
-			glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-			glDisableClientState(GL_COLOR_ARRAY);
-
-			glDisable(GL_TEXTURE_2D);
-			glDisable(GL_BLEND);
+			Renderer::drawArrays(GL_TRIANGLES, 0, 6);
 		}else{
 			LOG(LogError) << "Image texture is not initialized!";
 			mTexture.reset();
@@ -295,32 +537,46 @@ void ImageComponent::applyTheme(const std::shared_ptr<ThemeData>& theme, const s
 
 	Eigen::Vector2f scale = getParent() ? getParent()->getSize() : Eigen::Vector2f((float)Renderer::getScreenWidth(), (float)Renderer::getScreenHeight());
 	
-	if(properties & POSITION && elem->has("pos"))
+	if(properties & POSITION && elem->has(ThemeProperties::POS))
 	{
-		Eigen::Vector2f denormalized = elem->get<Eigen::Vector2f>("pos").cwiseProduct(scale);
+		Eigen::Vector2f denormalized = elem->get<Eigen::Vector2f>(ThemeProperties::POS).cwiseProduct(scale);
 		setPosition(Eigen::Vector3f(denormalized.x(), denormalized.y(), 0));
 	}
 
 	if(properties & ThemeFlags::SIZE)
 	{
-		if(elem->has("size"))
-			setResize(elem->get<Eigen::Vector2f>("size").cwiseProduct(scale));
-		else if(elem->has("maxSize"))
-			setMaxSize(elem->get<Eigen::Vector2f>("maxSize").cwiseProduct(scale));
+		if(elem->has(ThemeProperties::SIZE))
+			setResize(elem->get<Eigen::Vector2f>(ThemeProperties::SIZE).cwiseProduct(scale));
+		else if(elem->has(ThemeProperties::MAX_SIZE))
+			setMaxSize(elem->get<Eigen::Vector2f>(ThemeProperties::MAX_SIZE).cwiseProduct(scale));
 	}
 
 	// position + size also implies origin
-	if((properties & ORIGIN || (properties & POSITION && properties & ThemeFlags::SIZE)) && elem->has("origin"))
-		setOrigin(elem->get<Eigen::Vector2f>("origin"));
+	if((properties & ORIGIN || (properties & POSITION && properties & ThemeFlags::SIZE)) && elem->has(ThemeProperties::ORIGIN))
+		setOrigin(elem->get<Eigen::Vector2f>(ThemeProperties::ORIGIN));
+
+	if(properties & PATH && elem->has(ThemeProperties::MIPMAP))
+		setMipmap(elem->get<bool>(ThemeProperties::MIPMAP));
 
-	if(properties & PATH && elem->has("path"))
+	if(properties & PATH && elem->has(ThemeProperties::PATH))
 	{
-		bool tile = (elem->has("tile") && elem->get<bool>("tile"));
-		setImage(elem->get<std::string>("path"), tile);
+		bool tile = (elem->has(ThemeProperties::TILE) && elem->get<bool>(ThemeProperties::TILE));
+		setImage(elem->get<std::string>(ThemeProperties::PATH), tile);
 	}
 
-	if(properties & COLOR && elem->has("color"))
-		setColorShift(elem->get<unsigned int>("color"));
+	if(properties & COLOR && elem->has(ThemeProperties::COLOR))
+		setColorShift(elem->get<unsigned int>(ThemeProperties::COLOR));
+
+	if(properties & PATH && elem->has(ThemeProperties::FRAMES))
+	{
+		const Eigen::Vector2f frames = elem->get<Eigen::Vector2f>(ThemeProperties::FRAMES);
+		setSpriteSheet((unsigned int)std::max(1.0f, round(frames.x())), (unsigned int)std::max(1.0f, round(frames.y())));
+
+		unsigned int frameCount = elem->has(ThemeProperties::FRAME_COUNT) ? (unsigned int)std::max(0.0f, elem->get<float>(ThemeProperties::FRAME_COUNT)) : 0;
+		int frameTime = elem->has(ThemeProperties::FRAME_TIME) ? (int)(elem->get<float>(ThemeProperties::FRAME_TIME) * 1000) : 0;
+		bool loop = !elem->has(ThemeProperties::LOOP) || elem->get<bool>(ThemeProperties::LOOP);
+		setSpriteAnimation(frameCount, frameTime, loop);
+	}
 }
 
 std::vector<HelpPrompt> ImageComponent::getHelpPrompts()
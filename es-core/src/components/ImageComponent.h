@@ -8,6 +8,7 @@
 #include <string>
 #include <memory>
 #include "resources/TextureResource.h"
+#include "Renderer.h"
 
 class ImageComponent : public GuiComponent
 {
@@ -22,6 +23,21 @@ public:
 	//Use an already existing texture.
 	void setImage(const std::shared_ptr<TextureResource>& texture);
 
+	// Starts loading the texture setImage(path) would end up using, without showing it (e.g. for entries the cursor
+	// is heading towards). It loads for as long as the returned pointer is kept, dropping it cancels the load.
+	std::shared_ptr<TextureResource> prefetch(const std::string& path) const;
+
+	// If set, images loaded from a path are decoded in the background. Nothing is drawn until they're ready.
+	inline void setLoadAsync(bool async) { mLoadAsync = async; }
+
+	// If set, images loaded from a path are scaled down to the size set by setMaxSize()/setResize() (when it's set
+	// before the image) instead of being uploaded at full resolution. The scaled versions are cached on disk.
+	inline void setDownscale(bool downscale) { mDownscale = downscale; }
+
+	// If set, the texture is mipmapped (see TextureResource::setMipmapped()). With the "AutoMipmap" setting this
+	// happens anyway for images drawn at less than half their size.
+	void setMipmap(bool mipmap);
+
 	void onSizeChanged() override;
 	void setOpacity(unsigned char opacity) override;
 
@@ -48,6 +64,15 @@ public:
 	void setFlipX(bool flip); // Mirror on the X axis.
 	void setFlipY(bool flip); // Mirror on the Y axis.
 
+	// Treats the image as a sprite sheet: columns x rows frames of the same size, numbered left to right, then top to bottom.
+	// Only the current frame is drawn, laid out as if it were the whole image. Changing frames only changes texture
+	// coordinates, so an animation is one texture (and one upload). Ignored for tiled images.
+	void setSpriteSheet(unsigned int columns, unsigned int rows);
+	void setSpriteFrame(unsigned int frame);
+	inline unsigned int getSpriteFrame() const { return mSpriteFrame; }
+	// Plays the sheet's first frameCount frames (all of them if 0), frameTime ms each. A frameTime of 0 stops it.
+	void setSpriteAnimation(unsigned int frameCount, int frameTime, bool loop);
+
 	// Returns the size of the current texture, or (0, 0) if none is loaded.  May be different than drawn size (use getSize() for that).
 	Eigen::Vector2i getTextureSize() const;
 
@@ -56,26 +81,46 @@ public:
 
 	bool hasImage();
 
+	void update(int deltaTime) override;
 	void render(const Eigen::Affine3f& parentTrans) override;
+	bool getBounds(Eigen::Vector2f& topLeft, Eigen::Vector2f& bottomRight) const override;
 
 	virtual void applyTheme(const std::shared_ptr<ThemeData>& theme, const std::string& view, const std::string& element, unsigned int properties) override;
 
 	virtual std::vector<HelpPrompt> getHelpPrompts() override;
 private:
+	friend class ImageBatch;
+
 	Eigen::Vector2f mTargetSize;
 	Eigen::Vector2f mOrigin;
 
 	bool mFlipX, mFlipY, mTargetIsMax;
+	bool mLoadAsync;
+	bool mDownscale;
+	bool mMipmap;
+	bool mWaitingForTexture; // texture was still loading last time we sized ourselves
+	bool mDrawnLoading; // rendered while the texture was still loading, a render cache we're in has to know when it's done
+	unsigned int mTextureGeneration; // mTexture->getGeneration() when the vertices were built
+
+	Eigen::Vector2i mSpriteGrid; // columns, rows - (1, 1) if it's not a sprite sheet
+	unsigned int mSpriteFrame;
+	unsigned int mSpriteFrameCount;
+	int mSpriteFrameTime; // ms, 0 if it's not playing
+	int mSpriteTime; // ms into the current frame
+	bool mSpriteLoop;
 
 	// Calculates the correct mSize from our resizing information (set by setResize/setMaxSize).
 	// Used internally whenever the resizing parameters or texture change.
 	void resize();
 
+	Eigen::Vector2i getLoadMaxSize(bool tile) const; // what a texture loaded from a path gets scaled down to
+
 	struct Vertex
 	{
 		Eigen::Vector2f pos;
 		Eigen::Vector2f tex;
 	} mVertices[6];
+	Renderer::VertexBuffer mVertexBuffer;
 
 	GLubyte mColors[6*4];
 
@@ -87,4 +132,31 @@ private:
 	std::shared_ptr<TextureResource> mTexture;
 };
 
+// Draws many images with one drawArrays per GL texture instead of one each - with the thumbnail atlas pages,
+// a whole grid of box art is a draw or two. Images are drawn in the order they were added, but only per texture,
+// so it's for images that don't overlap (grid tiles, carousel logos...).
+// Anything it can't batch (still loading, has children) is rendered right away by add().
+class ImageBatch
+{
+public:
+	void add(ImageComponent& image, const Eigen::Affine3f& parentTrans);
+	void draw(); // and clear
+
+private:
+	struct Vertex
+	{
+		Eigen::Vector2f pos;
+		Eigen::Vector2f tex;
+		GLubyte color[4];
+	};
+
+	struct Group
+	{
+		std::shared_ptr<TextureResource> texture;
+		std::vector<Vertex> vertices;
+	};
+
+	std::vector<Group> mGroups;
+};
+
 #endif
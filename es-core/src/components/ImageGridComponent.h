@@ -4,12 +4,17 @@
 #include "components/IList.h"
 #include "components/ImageComponent.h"
 #include "Log.h"
+#include <algorithm>
 
 struct ImageGridData
 {
-	std::shared_ptr<TextureResource> texture;
+	std::string imagePath;
+	std::shared_ptr<TextureResource> texture; // only loaded while the tile is on (or close to) the screen
 };
 
+// An IList laid out as a grid of equally sized tiles. Tile textures are loaded asynchronously, and only for the
+// visible rows plus a couple either side, so it works with big systems too.
+
 template<typename T>
 class ImageGridComponent : public IList<ImageGridData, T>
 {
@@ -40,43 +45,15 @@ public:
 	void render(const Eigen::Affine3f& parentTrans) override;
 
 private:
-	Eigen::Vector2f getSquareSize(std::shared_ptr<TextureResource> tex = nullptr) const
-	{
-		Eigen::Vector2f aspect(1, 1);
-
-		if(tex)
-		{
-			const Eigen::Vector2i& texSize = tex->getSize();
+	// rows either side of the visible ones that get their textures loaded ahead of time
+	static const int LOAD_MARGIN_ROWS = 2;
 
-			if(texSize.x() > texSize.y())
-				aspect[0] = (float)texSize.x() / texSize.y();
-			else
-				aspect[1] = (float)texSize.y() / texSize.x();
-		}
-
-		return Eigen::Vector2f(156 * aspect.x(), 156 * aspect.y());
-	};
-
-	Eigen::Vector2f getMaxSquareSize() const
-	{
-		Eigen::Vector2f squareSize(32, 32);
-
-		// calc biggest square size
-		for(auto it = mEntries.begin(); it != mEntries.end(); it++)
-		{
-			Eigen::Vector2f chkSize = getSquareSize(it->data.texture);
-			if(chkSize.x() > squareSize.x())
-				squareSize[0] = chkSize[0];
-			if(chkSize.y() > squareSize.y())
-				squareSize[1] = chkSize[1];
-		}
-
-		return squareSize;
-	};
+	// every tile is the same size whatever its image is, so the layout doesn't depend on loaded textures
+	Eigen::Vector2f getSquareSize() const { return Eigen::Vector2f(156, 156); }
 
 	Eigen::Vector2i getGridSize() const
 	{
-		Eigen::Vector2f squareSize = getMaxSquareSize();
+		Eigen::Vector2f squareSize = getSquareSize();
 		Eigen::Vector2i gridSize(mSize.x() / (squareSize.x() + getPadding().x()), mSize.y() / (squareSize.y() + getPadding().y()));
 		return gridSize;
 	};
@@ -85,10 +62,13 @@ private:
 	
 	void buildImages();
 	void updateImages();
+	void loadTextures(int start, int end); // load textures for entries [start, end), release the ones that were loaded before
 
 	virtual void onCursorChanged(const CursorState& state);
 
 	bool mEntriesDirty;
+	int mLoadedStart;
+	int mLoadedEnd;
 
 	std::vector<ImageComponent> mImages;
 };
@@ -96,7 +76,10 @@ private:
 template<typename T>
 ImageGridComponent<T>::ImageGridComponent(Window* window) : IList<ImageGridData, T>(window)
 {
+	this->setUpdating(true);
 	mEntriesDirty = true;
+	mLoadedStart = 0;
+	mLoadedEnd = 0;
 }
 
 template<typename T>
@@ -105,7 +88,7 @@ void ImageGridComponent<T>::add(const std::string& name, const std::string& imag
 	typename IList<ImageGridData, T>::Entry entry;
 	entry.name = name;
 	entry.object = obj;
-	entry.data.texture = ResourceManager::getInstance()->fileExists(imagePath) ? TextureResource::get(imagePath) : TextureResource::get(":/button.png");
+	entry.data.imagePath = imagePath; // loaded once it's close to being on screen, see loadTextures()
 	static_cast<IList< ImageGridData, T >*>(this)->add(entry);
 	mEntriesDirty = true;
 }
@@ -158,10 +141,11 @@ void ImageGridComponent<T>::render(const Eigen::Affine3f& parentTrans)
 		mEntriesDirty = false;
 	}
 
+	// the tiles' thumbnails are mostly on the same atlas page or two
+	ImageBatch batch;
 	for(auto it = mImages.begin(); it != mImages.end(); it++)
-	{
-		it->render(trans);
-	}
+		batch.add(*it, trans);
+	batch.draw();
 
 	GuiComponent::renderChildren(trans);
 }
@@ -186,7 +170,7 @@ void ImageGridComponent<T>::buildImages()
 	mImages.clear();
 
 	Eigen::Vector2i gridSize = getGridSize();
-	Eigen::Vector2f squareSize = getMaxSquareSize();
+	Eigen::Vector2f squareSize = getSquareSize();
 	Eigen::Vector2f padding = getPadding();
 
 	// attempt to center within our size
@@ -203,12 +187,42 @@ void ImageGridComponent<T>::buildImages()
 
 			image.setPosition((squareSize.x() + padding.x()) * (x + 0.5f) + offset.x(), (squareSize.y() + padding.y()) * (y + 0.5f) + offset.y());
 			image.setOrigin(0.5f, 0.5f);
-			image.setResize(squareSize.x(), squareSize.y());
+			image.setMaxSize(squareSize.x(), squareSize.y());
 			image.setImage("");
 		}
 	}
 }
 
+template<typename T>
+void ImageGridComponent<T>::loadTextures(int start, int end)
+{
+	start = std::max(start, 0);
+	end = std::min(end, (int)mEntries.size());
+
+	for(int i = mLoadedStart; i < mLoadedEnd && i < (int)mEntries.size(); i++)
+	{
+		if(i < start || i >= end)
+			mEntries.at(i).data.texture.reset();
+	}
+
+	// decode straight to the size of a selected tile, full size box art would be a waste here
+	const Eigen::Vector2f maxSize = getSquareSize() + getPadding();
+	for(int i = start; i < end; i++)
+	{
+		ImageGridData& data = mEntries.at(i).data;
+		if(data.texture)
+			continue;
+
+		if(!data.imagePath.empty() && ResourceManager::getInstance()->fileExists(data.imagePath))
+			data.texture = TextureResource::get(data.imagePath, false, true, Eigen::Vector2i((int)maxSize.x(), (int)maxSize.y()));
+		else
+			data.texture = TextureResource::get(":/button.png");
+	}
+
+	mLoadedStart = start;
+	mLoadedEnd = end;
+}
+
 template<typename T>
 void ImageGridComponent<T>::updateImages()
 {
@@ -229,6 +243,9 @@ void ImageGridComponent<T>::updateImages()
 	if(start < 0)
 		start = 0;
 
+	const int margin = gridSize.x() * LOAD_MARGIN_ROWS;
+	loadTextures(start - margin, start + gridSize.x() * gridSize.y() + margin);
+
 	unsigned int i = (unsigned int)start;
 	for(unsigned int img = 0; img < mImages.size(); img++)
 	{
@@ -239,14 +256,14 @@ void ImageGridComponent<T>::updateImages()
 			continue;
 		}
 
-		Eigen::Vector2f squareSize = getSquareSize(mEntries.at(i).data.texture);
+		Eigen::Vector2f squareSize = getSquareSize();
 		if(i == mCursor)
 		{
 			image.setColorShift(0xFFFFFFFF);
-			image.setResize(squareSize.x() + getPadding().x() * 0.95f, squareSize.y() + getPadding().y() * 0.95f);
+			image.setMaxSize(squareSize.x() + getPadding().x() * 0.95f, squareSize.y() + getPadding().y() * 0.95f);
 		}else{
 			image.setColorShift(0xAAAAAABB);
-			image.setResize(squareSize.x(), squareSize.y());
+			image.setMaxSize(squareSize.x(), squareSize.y());
 		}
 
 		image.setImage(mEntries.at(i).data.texture);
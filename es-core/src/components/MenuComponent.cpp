@@ -31,6 +31,9 @@ MenuComponent::MenuComponent(Window* window, const char* title, const std::share
 	updateSize();
 
 	mGrid.resetCursor();
+
+	// mostly still, and a lot of pieces
+	setRenderCached(true);
 }
 
 void MenuComponent::setTitle(const char* title, const std::shared_ptr<Font>& font)
@@ -8,177 +8,149 @@
 NinePatchComponent::NinePatchComponent(Window* window, const std::string& path, unsigned int edgeColor, unsigned int centerColor) : GuiComponent(window),
 	mEdgeColor(edgeColor), mCenterColor(centerColor), 
 	mPath(path),
-	mVertices(NULL), mColors(NULL)
+	mHasVertices(false), mVertexSize(-1, -1), mTextureGeneration(0)
 {
+	updateColors();
 	if(!mPath.empty())
-		buildVertices();
+		setImagePath(mPath);
 }
 
 NinePatchComponent::~NinePatchComponent()
 {
-	if (mVertices != NULL)
-		delete[] mVertices;
-
-	if (mColors != NULL)
-		delete[] mColors;
 }
 
 void NinePatchComponent::updateColors()
 {
 	Renderer::buildGLColorArray(mColors, mEdgeColor, 6 * 9);
 	Renderer::buildGLColorArray(&mColors[4 * 6 * 4], mCenterColor, 6);
+	invalidate();
 }
 
-void NinePatchComponent::buildVertices()
+//coordinates on the image in pixels, top left origin
+static const Eigen::Vector2f PIECE_COORDS[9] = {
+	Eigen::Vector2f(0,  0),
+	Eigen::Vector2f(16, 0),
+	Eigen::Vector2f(32, 0),
+	Eigen::Vector2f(0,  16),
+	Eigen::Vector2f(16, 16),
+	Eigen::Vector2f(32, 16),
+	Eigen::Vector2f(0,  32),
+	Eigen::Vector2f(16, 32),
+	Eigen::Vector2f(32, 32),
+};
+
+void NinePatchComponent::updateTexCoords()
 {
-	if(mVertices != NULL)
-		delete[] mVertices;
-
-	if(mColors != NULL)
-		delete[] mColors;
-
-	mTexture = TextureResource::get(mPath);
-
-	if(mTexture->getSize() == Eigen::Vector2i::Zero())
+	mHasVertices = mTexture && mTexture->getSize() != Eigen::Vector2i::Zero();
+	if(!mHasVertices)
 	{
-		mVertices = NULL;
-		mColors = NULL;
 		LOG(LogWarning) << "NinePatchComponent missing texture!";
 		return;
 	}
 
-	mVertices = new Vertex[6 * 9];
-	mColors = new GLubyte[6 * 9 * 4];
-	updateColors();
-
 	const Eigen::Vector2f ts = mTexture->getSize().cast<float>();
-
-	//coordinates on the image in pixels, top left origin
-	const Eigen::Vector2f pieceCoords[9] = {
-		Eigen::Vector2f(0,  0),
-		Eigen::Vector2f(16, 0),
-		Eigen::Vector2f(32, 0),
-		Eigen::Vector2f(0,  16),
-		Eigen::Vector2f(16, 16),
-		Eigen::Vector2f(32, 16),
-		Eigen::Vector2f(0,  32),
-		Eigen::Vector2f(16, 32),
-		Eigen::Vector2f(32, 32),
-	};
-
 	const Eigen::Vector2f pieceSizes = getCornerSize();
 
-	//corners never stretch, so we calculate a width and height for slices 1, 3, 5, and 7
-	float borderWidth = mSize.x() - (pieceSizes.x() * 2); //should be pieceSizes[0] and pieceSizes[2]
-	//if(borderWidth < pieceSizes.x())
-	//	borderWidth = pieceSizes.x();
-
-	float borderHeight = mSize.y() - (pieceSizes.y() * 2); //should be pieceSizes[0] and pieceSizes[6]
-	//if(borderHeight < pieceSizes.y())
-	//	borderHeight = pieceSizes.y();
-
-	mVertices[0 * 6].pos = pieceCoords[0]; //top left
-	mVertices[1 * 6].pos = pieceCoords[1]; //top middle
-	mVertices[2 * 6].pos = pieceCoords[1] + Eigen::Vector2f(borderWidth, 0); //top right
-
-	mVertices[3 * 6].pos = mVertices[0 * 6].pos + Eigen::Vector2f(0, pieceSizes.y()); //mid left
-	mVertices[4 * 6].pos = mVertices[3 * 6].pos + Eigen::Vector2f(pieceSizes.x(), 0); //mid middle
-	mVertices[5 * 6].pos = mVertices[4 * 6].pos + Eigen::Vector2f(borderWidth, 0); //mid right
-
-	mVertices[6 * 6].pos = mVertices[3 * 6].pos + Eigen::Vector2f(0, borderHeight); //bot left
-	mVertices[7 * 6].pos = mVertices[6 * 6].pos + Eigen::Vector2f(pieceSizes.x(), 0); //bot middle
-	mVertices[8 * 6].pos = mVertices[7 * 6].pos + Eigen::Vector2f(borderWidth, 0); //bot right
-
-	int v = 0;
 	for(int slice = 0; slice < 9; slice++)
 	{
-		Eigen::Vector2f size;
+		Vertex* v = &mVertices[slice * 6];
 
-		//corners
-		if(slice == 0 || slice == 2 || slice == 6 || slice == 8)
-			size = pieceSizes;
-
-		//vertical borders
-		if(slice == 1 || slice == 7)
-			size << borderWidth, pieceSizes.y();
+		//the y = (1 - y) is to deal with texture coordinates having a bottom left corner origin vs. verticies having a top left origin
+		v[0].tex << PIECE_COORDS[slice].x() / ts.x(), 1 - (PIECE_COORDS[slice].y() / ts.y());
+		v[1].tex << (PIECE_COORDS[slice].x() + pieceSizes.x()) / ts.x(), 1 - ((PIECE_COORDS[slice].y() + pieceSizes.y()) / ts.y());
+		v[2].tex << v[0].tex.x(), v[1].tex.y();
 
-		//horizontal borders
-		if(slice == 3 || slice == 5)
-			size << pieceSizes.x(), borderHeight;
+		v[3].tex << v[1].tex.x(), v[0].tex.y();
+		v[4].tex = v[1].tex;
+		v[5].tex = v[0].tex;
 
-		//center
-		if(slice == 4)
-			size << borderWidth, borderHeight;
+		// the texture might only be part of an atlas page
+		for(int i = 0; i < 6; i++)
+			v[i].tex = mTexture->getTexCoord(v[i].tex.x(), v[i].tex.y());
+	}
 
-		//no resizing will be necessary
-		//mVertices[v + 0] is already correct
-		mVertices[v + 1].pos = mVertices[v + 0].pos + size;
-		mVertices[v + 2].pos << mVertices[v + 0].pos.x(), mVertices[v + 1].pos.y();
+	mTextureGeneration = mTexture->getGeneration();
+	mVertexBuffer.markDirty();
+	invalidate();
+}
 
-		mVertices[v + 3].pos << mVertices[v + 1].pos.x(), mVertices[v + 0].pos.y();
-		mVertices[v + 4].pos = mVertices[v + 1].pos;
-		mVertices[v + 5].pos = mVertices[v + 0].pos;
+void NinePatchComponent::updatePositions()
+{
+	mVertexSize = mSize;
 
-		//texture coordinates
-		//the y = (1 - y) is to deal with texture coordinates having a bottom left corner origin vs. verticies having a top left origin
-		mVertices[v + 0].tex << pieceCoords[slice].x() / ts.x(), 1 - (pieceCoords[slice].y() / ts.y());
-		mVertices[v + 1].tex << (pieceCoords[slice].x() + pieceSizes.x()) / ts.x(), 1 - ((pieceCoords[slice].y() + pieceSizes.y()) / ts.y());
-		mVertices[v + 2].tex << mVertices[v + 0].tex.x(), mVertices[v + 1].tex.y();
+	const Eigen::Vector2f pieceSizes = getCornerSize();
 
-		mVertices[v + 3].tex << mVertices[v + 1].tex.x(), mVertices[v + 0].tex.y();
-		mVertices[v + 4].tex = mVertices[v + 1].tex;
-		mVertices[v + 5].tex = mVertices[v + 0].tex;
+	//corners never stretch, so we calculate a width and height for slices 1, 3, 5, and 7
+	const float borderWidth = mSize.x() - (pieceSizes.x() * 2);
+	const float borderHeight = mSize.y() - (pieceSizes.y() * 2);
 
-		v += 6;
-	}
+	// top left corner of each slice
+	const float xs[3] = { 0, pieceSizes.x(), pieceSizes.x() + borderWidth };
+	const float ys[3] = { 0, pieceSizes.y(), pieceSizes.y() + borderHeight };
+	const float ws[3] = { pieceSizes.x(), borderWidth, pieceSizes.x() };
+	const float hs[3] = { pieceSizes.y(), borderHeight, pieceSizes.y() };
 
-	// round vertices
-	for(int i = 0; i < 6*9; i++)
+	for(int slice = 0; slice < 9; slice++)
 	{
-		mVertices[i].pos = roundVector(mVertices[i].pos);
+		Vertex* v = &mVertices[slice * 6];
+		const int col = slice % 3;
+		const int row = slice / 3;
+
+		// rounded, like the rest of our geometry
+		v[0].pos = roundVector(Eigen::Vector2f(xs[col], ys[row]));
+		v[1].pos = roundVector(Eigen::Vector2f(xs[col] + ws[col], ys[row] + hs[row]));
+		v[2].pos << v[0].pos.x(), v[1].pos.y();
+
+		v[3].pos << v[1].pos.x(), v[0].pos.y();
+		v[4].pos = v[1].pos;
+		v[5].pos = v[0].pos;
 	}
+
+	mVertexBuffer.markDirty();
 }
 
 void NinePatchComponent::render(const Eigen::Affine3f& parentTrans)
 {
-	Eigen::Affine3f trans = roundMatrix(parentTrans * getTransform());
+	Eigen::Affine3f trans = roundMatrix(getWorldTransform(parentTrans));
 	
-	if(mTexture && mVertices != NULL)
+	if(mHasVertices)
 	{
 		Renderer::setMatrix(trans);
 
 		mTexture->bind();
 
-		glEnable(GL_TEXTURE_2D);
-		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-		glEnableClientState(GL_VERTEX_ARRAY);
-		glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-		glEnableClientState(GL_COLOR_ARRAY);
-
-		glVertexPointer(2, GL_FLOAT, sizeof(Vertex), &mVertices[0].pos);
-		glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), &mVertices[0].tex);
-		glColorPointer(4, GL_UNSIGNED_BYTE, 0, mColors);
-
-		glDrawArrays(GL_TRIANGLES, 0, 6 * 9);
-
-		glDisableClientState(GL_VERTEX_ARRAY);
-		glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-		glDisableClientState(GL_COLOR_ARRAY);
-
-		glDisable(GL_TEXTURE_2D);
-		glDisable(GL_BLEND);
+		// it was reuploaded (and maybe moved around in the atlas) since we last looked
+		if(mTexture->getGeneration() != mTextureGeneration)
+		{
+			updateTexCoords();
+			if(!mHasVertices)
+			{
+				renderChildren(trans);
+				return;
+			}
+		}
+
+		if(mVertexSize != mSize)
+			updatePositions();
+
+		Renderer::setTextureEnabled(true);
+		Renderer::setBlendEnabled(true);
+		Renderer::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		Renderer::setClientArrays(true, true, true);
+
+		const char* base = mVertexBuffer.use(mVertices, sizeof(Vertex) * 6 * 9);
+		Renderer::vertexPointer(2, GL_FLOAT, sizeof(Vertex), base + offsetof(Vertex, pos));
+		Renderer::texCoordPointer(2, GL_FLOAT, sizeof(Vertex), base + offsetof(Vertex, tex));
+
+		Renderer::useClientArrays();
+		Renderer::colorPointer(4, GL_UNSIGNED_BYTE, 0, mColors);
+
+		Renderer::drawArrays(GL_TRIANGLES, 0, 6 * 9);
 	}
 
 	renderChildren(trans);
 }
 
-void NinePatchComponent::onSizeChanged()
-{
-	buildVertices();
-}
-
 Eigen::Vector2f NinePatchComponent::getCornerSize() const
 {
 	return Eigen::Vector2f(16, 16);
@@ -197,7 +169,8 @@ void NinePatchComponent::fitTo(Eigen::Vector2f size, Eigen::Vector3f position, E
 void NinePatchComponent::setImagePath(const std::string& path)
 {
 	mPath = path;
-	buildVertices();
+	mTexture = TextureResource::get(mPath);
+	updateTexCoords();
 }
 
 void NinePatchComponent::setEdgeColor(unsigned int edgeColor)
@@ -222,6 +195,6 @@ void NinePatchComponent::applyTheme(const std::shared_ptr<ThemeData>& theme, con
 	if(!elem)
 		return;
 
-	if(properties & PATH && elem->has("path"))
-		setImagePath(elem->get<std::string>("path"));
+	if(properties & PATH && elem->has(ThemeProperties::PATH))
+		setImagePath(elem->get<std::string>(ThemeProperties::PATH));
 }
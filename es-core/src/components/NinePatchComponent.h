@@ -2,6 +2,7 @@
 
 #include "GuiComponent.h"
 #include "resources/TextureResource.h"
+#include "Renderer.h"
 
 // Display an image in a way so that edges don't get too distorted no matter the final size. Useful for UI elements like backgrounds, buttons, etc.
 // This is accomplished by splitting an image into 9 pieces:
@@ -22,8 +23,6 @@ public:
 
 	void render(const Eigen::Affine3f& parentTrans) override;
 
-	void onSizeChanged() override;
-
 	void fitTo(Eigen::Vector2f size, Eigen::Vector3f position = Eigen::Vector3f::Zero(), Eigen::Vector2f padding = Eigen::Vector2f::Zero());
 
 	void setImagePath(const std::string& path);
@@ -35,7 +34,9 @@ public:
 private:
 	Eigen::Vector2f getCornerSize() const;
 
-	void buildVertices();
+	// the texture coordinates only change with the texture, positions only with the size; both update in place
+	void updateTexCoords();
+	void updatePositions();
 	void updateColors();
 
 	struct Vertex
@@ -44,11 +45,15 @@ private:
 		Eigen::Vector2f tex;
 	};
 
-	Vertex* mVertices;
-	GLubyte* mColors;
+	Vertex mVertices[6 * 9];
+	GLubyte mColors[6 * 9 * 4];
+	Renderer::VertexBuffer mVertexBuffer;
+	bool mHasVertices; // false without a (usable) texture
+	Eigen::Vector2f mVertexSize; // mSize when the positions were made, render() makes them again if it changed since
 
 	std::string mPath;
 	unsigned int mEdgeColor;
 	unsigned int mCenterColor;
 	std::shared_ptr<TextureResource> mTexture;
+	unsigned int mTextureGeneration; // mTexture->getGeneration() when the vertices were built
 };
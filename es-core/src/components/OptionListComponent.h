@@ -240,6 +240,11 @@ public:
 		return selected.at(0);
 	}
 
+	std::string getSelectedName()
+	{
+		return mEntries.at(getSelectedId()).name;
+	}
+
 	void add(const std::string& name, const T& obj, bool selected)
 	{
 		OptionListData e;
@@ -1,6 +1,7 @@
 #include "components/ScrollableContainer.h"
 #include "Renderer.h"
 #include "Log.h"
+#include "Window.h"
 
 #define AUTO_SCROLL_RESET_DELAY 10000 // ms to reset to top after we reach the bottom
 #define AUTO_SCROLL_DELAY 8000 // ms to wait before we start to scroll
@@ -9,11 +10,12 @@
 ScrollableContainer::ScrollableContainer(Window* window) : GuiComponent(window), 
 	mAutoScrollDelay(0), mAutoScrollSpeed(0), mAutoScrollAccumulator(0), mScrollPos(0, 0), mScrollDir(0, 0), mAutoScrollResetAccumulator(0)
 {
+	setUpdating(true);
 }
 
 void ScrollableContainer::render(const Eigen::Affine3f& parentTrans)
 {
-	Eigen::Affine3f trans = parentTrans * getTransform();
+	Eigen::Affine3f trans = getWorldTransform(parentTrans);
 
 	Eigen::Vector2i clipPos((int)trans.translation().x(), (int)trans.translation().y());
 
@@ -58,6 +60,8 @@ void ScrollableContainer::setScrollPos(const Eigen::Vector2f& pos)
 
 void ScrollableContainer::update(int deltaTime)
 {
+	const Eigen::Vector2f oldScrollPos = mScrollPos;
+
 	if(mAutoScrollSpeed != 0)
 	{
 		mAutoScrollAccumulator += deltaTime;
@@ -100,6 +104,9 @@ void ScrollableContainer::update(int deltaTime)
 			reset();
 	}
 
+	if(mScrollPos != oldScrollPos)
+		invalidate();
+
 	GuiComponent::update(deltaTime);
 }
 
@@ -4,6 +4,7 @@
 #include "resources/Font.h"
 #include "Log.h"
 #include "Util.h"
+#include "Window.h"
 
 #define MOVE_REPEAT_DELAY 500
 #define MOVE_REPEAT_RATE 40
@@ -11,6 +12,7 @@
 SliderComponent::SliderComponent(Window* window, float min, float max, float increment, const std::string& suffix) : GuiComponent(window),
 	mMin(min), mMax(max), mSingleIncrement(increment), mMoveRate(0), mKnob(window), mSuffix(suffix)
 {
+	setUpdating(true);
 	assert((min - max) != 0);
 
 	// some sane default value
@@ -55,6 +57,7 @@ void SliderComponent::update(int deltaTime)
 		{
 			setValue(mValue + mMoveRate);
 			mMoveAccumulator -= MOVE_REPEAT_RATE;
+			invalidate();
 		}
 	}
 	
@@ -63,7 +66,7 @@ void SliderComponent::update(int deltaTime)
 
 void SliderComponent::render(const Eigen::Affine3f& parentTrans)
 {
-	Eigen::Affine3f trans = roundMatrix(parentTrans * getTransform());
+	Eigen::Affine3f trans = roundMatrix(getWorldTransform(parentTrans));
 	Renderer::setMatrix(trans);
 
 	// render suffix
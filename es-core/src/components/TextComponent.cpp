@@ -60,18 +60,20 @@ unsigned char TextComponent::getOpacity() const
 void TextComponent::setText(const std::string& text)
 {
 	mText = text;
+	mDisplayText = mUppercase ? strToUpper(mText) : mText;
 	onTextChanged();
 }
 
 void TextComponent::setUppercase(bool uppercase)
 {
 	mUppercase = uppercase;
+	mDisplayText = mUppercase ? strToUpper(mText) : mText;
 	onTextChanged();
 }
 
 void TextComponent::render(const Eigen::Affine3f& parentTrans)
 {
-	Eigen::Affine3f trans = parentTrans * getTransform();
+	Eigen::Affine3f trans = getWorldTransform(parentTrans);
 
 	/*Eigen::Vector3f dim(mSize.x(), mSize.y(), 0);
 	dim = trans * dim - trans.translation();
@@ -81,10 +83,12 @@ void TextComponent::render(const Eigen::Affine3f& parentTrans)
 
 	if(mTextCache)
 	{
+		static const SettingHandle<bool> debugText = Settings::getInstance()->getBoolHandle("DebugText");
+
 		const Eigen::Vector2f& textSize = mTextCache->metrics.size;
 		Eigen::Vector3f off(0, (getSize().y() - textSize.y()) / 2.0f, 0);
 
-		if(Settings::getInstance()->getBool("DebugText"))
+		if(debugText)
 		{
 			// draw the "textbox" area, what we are aligned within
 			Renderer::setMatrix(trans);
@@ -96,7 +100,7 @@ void TextComponent::render(const Eigen::Affine3f& parentTrans)
 		Renderer::setMatrix(trans);
 
 		// draw the text area, where the text actually is going
-		if(Settings::getInstance()->getBool("DebugText"))
+		if(debugText)
 		{
 			switch(mAlignment)
 			{
@@ -112,7 +116,8 @@ void TextComponent::render(const Eigen::Affine3f& parentTrans)
 			}
 		}
 
-		mFont->renderTextCache(mTextCache.get());
+		// a long description in a ScrollableContainer only shows a few lines
+		mFont->renderTextCache(mTextCache.get(), trans);
 	}
 
 	//Renderer::popClipRect();
@@ -122,17 +127,18 @@ void TextComponent::calculateExtent()
 {
 	if(mAutoCalcExtent.x())
 	{
-		mSize = mFont->sizeText(mUppercase ? strToUpper(mText) : mText, mLineSpacing);
+		mSize = mFont->sizeText(mDisplayText, mLineSpacing);
 	}else{
 		if(mAutoCalcExtent.y())
 		{
-			mSize[1] = mFont->sizeWrappedText(mUppercase ? strToUpper(mText) : mText, getSize().x(), mLineSpacing).y();
+			mSize[1] = mFont->sizeWrappedText(mDisplayText, getSize().x(), mLineSpacing).y();
 		}
 	}
 }
 
 void TextComponent::onTextChanged()
 {
+	invalidate();
 	calculateExtent();
 
 	if(!mFont || mText.empty())
@@ -141,43 +147,56 @@ void TextComponent::onTextChanged()
 		return;
 	}
 
-	std::string text = mUppercase ? strToUpper(mText) : mText;
+	const std::string& text = mDisplayText;
 
 	std::shared_ptr<Font> f = mFont;
 	const bool isMultiline = (mSize.y() == 0 || mSize.y() > f->getHeight()*1.2f);
 
+	// only text[0, length) is shown
+	size_t length = text.length();
 	bool addAbbrev = false;
 	if(!isMultiline)
 	{
 		size_t newline = text.find('\n');
-		text = text.substr(0, newline); // single line of text - stop at the first newline since it'll mess everything up
-		addAbbrev = newline != std::string::npos;
+		if(newline != std::string::npos)
+		{
+			length = newline; // single line of text - stop at the first newline since it'll mess everything up
+			addAbbrev = true;
+		}
 	}
 
-	Eigen::Vector2f size = f->sizeText(text);
-	if(!isMultiline && mSize.x() && text.size() && (size.x() > mSize.x() || addAbbrev))
+	Eigen::Vector2f size = f->sizeText(text.data(), length);
+	if(!isMultiline && mSize.x() && length && (size.x() > mSize.x() || addAbbrev))
 	{
-		// abbreviate text
+		// abbreviate text, measuring ever shorter starts of it where they are and only copying out the one that fits
 		const std::string abbrev = "...";
 		Eigen::Vector2f abbrevSize = f->sizeText(abbrev);
 
-		while(text.size() && size.x() + abbrevSize.x() > mSize.x())
+		while(length && size.x() + abbrevSize.x() > mSize.x())
 		{
-			size_t newSize = Font::getPrevCursor(text, text.size());
-			text.erase(newSize, text.size() - newSize);
-			size = f->sizeText(text);
+			length = Font::getPrevCursor(text, length);
+			size = f->sizeText(text.data(), length);
 		}
 
-		text.append(abbrev);
+		std::string abbreviated(text, 0, length);
+		abbreviated.append(abbrev);
 
-		mTextCache = std::shared_ptr<TextCache>(f->buildTextCache(text, Eigen::Vector2f(0, 0), (mColor >> 8 << 8) | mOpacity, mSize.x(), mAlignment, mLineSpacing));
+		mTextCache = std::shared_ptr<TextCache>(f->buildTextCache(abbreviated, Eigen::Vector2f(0, 0), (mColor >> 8 << 8) | mOpacity, mSize.x(), mAlignment, mLineSpacing));
 	}else{
-		mTextCache = std::shared_ptr<TextCache>(f->buildTextCache(f->wrapText(text, mSize.x()), Eigen::Vector2f(0, 0), (mColor >> 8 << 8) | mOpacity, mSize.x(), mAlignment, mLineSpacing));
+		// keeps its memory from one text to the next (text components only change on the main thread)
+		static std::string wrapped;
+		if(length < text.length())
+			f->wrapText(text.substr(0, length), mSize.x(), wrapped);
+		else
+			f->wrapText(text, mSize.x(), wrapped);
+
+		mTextCache = std::shared_ptr<TextCache>(f->buildTextCache(wrapped, Eigen::Vector2f(0, 0), (mColor >> 8 << 8) | mOpacity, mSize.x(), mAlignment, mLineSpacing));
 	}
 }
 
 void TextComponent::onColorChanged()
 {
+	invalidate();
 	if(mTextCache)
 	{
 		mTextCache->setColor(mColor);
@@ -216,12 +235,12 @@ void TextComponent::applyTheme(const std::shared_ptr<ThemeData>& theme, const st
 	if(!elem)
 		return;
 
-	if(properties & COLOR && elem->has("color"))
-		setColor(elem->get<unsigned int>("color"));
+	if(properties & COLOR && elem->has(ThemeProperties::COLOR))
+		setColor(elem->get<unsigned int>(ThemeProperties::COLOR));
 
-	if(properties & ALIGNMENT && elem->has("alignment"))
+	if(properties & ALIGNMENT && elem->has(ThemeProperties::ALIGNMENT))
 	{
-		std::string str = elem->get<std::string>("alignment");
+		std::string str = elem->get<std::string>(ThemeProperties::ALIGNMENT);
 		if(str == "left")
 			setAlignment(ALIGN_LEFT);
 		else if(str == "center")
@@ -232,14 +251,14 @@ void TextComponent::applyTheme(const std::shared_ptr<ThemeData>& theme, const st
 			LOG(LogError) << "Unknown text alignment string: " << str;
 	}
 
-	if(properties & TEXT && elem->has("text"))
-		setText(elem->get<std::string>("text"));
+	if(properties & TEXT && elem->has(ThemeProperties::TEXT))
+		setText(elem->get<std::string>(ThemeProperties::TEXT));
 
-	if(properties & FORCE_UPPERCASE && elem->has("forceUppercase"))
-		setUppercase(elem->get<bool>("forceUppercase"));
+	if(properties & FORCE_UPPERCASE && elem->has(ThemeProperties::FORCE_UPPERCASE))
+		setUppercase(elem->get<bool>(ThemeProperties::FORCE_UPPERCASE));
 
-	if(properties & LINE_SPACING && elem->has("lineSpacing"))
-		setLineSpacing(elem->get<float>("lineSpacing"));
+	if(properties & LINE_SPACING && elem->has(ThemeProperties::LINE_SPACING))
+		setLineSpacing(elem->get<float>(ThemeProperties::LINE_SPACING));
 
 	setFont(Font::getFromTheme(elem, properties, mFont));
 }
@@ -49,6 +49,7 @@ private:
 	bool mUppercase;
 	Eigen::Matrix<bool, 1, 2> mAutoCalcExtent;
 	std::string mText;
+	std::string mDisplayText; // mText uppercased if mUppercase, so measuring it doesn't have to make a copy every time
 	std::shared_ptr<TextCache> mTextCache;
 	Alignment mAlignment;
 	float mLineSpacing;
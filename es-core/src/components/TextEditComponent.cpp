@@ -4,6 +4,7 @@
 #include "Window.h"
 #include "Renderer.h"
 #include "Util.h"
+#include <algorithm>
 
 #define TEXT_PADDING_HORIZ 10
 #define TEXT_PADDING_VERT 2
@@ -14,8 +15,9 @@
 TextEditComponent::TextEditComponent(Window* window) : GuiComponent(window),
 	mBox(window, ":/textinput_ninepatch.png"), mFocused(false), 
 	mScrollOffset(0.0f, 0.0f), mCursor(0), mEditing(false), mFont(Font::get(FONT_SIZE_MEDIUM, FONT_PATH_LIGHT)), 
-	mCursorRepeatDir(0)
+	mCursorRepeatDir(0), mLayoutWidth(0), mLayoutColor(0), mCursorPos(0, 0)
 {
+	setUpdating(true);
 	addChild(&mBox);
 	
 	onFocusLost();
@@ -168,6 +170,7 @@ void TextEditComponent::moveCursor(int amt)
 {
 	mCursor = Font::moveCursor(mText, mCursor, amt);
 	onCursorChanged();
+	invalidate();
 }
 
 void TextEditComponent::setCursor(size_t pos)
@@ -182,18 +185,103 @@ void TextEditComponent::setCursor(size_t pos)
 
 void TextEditComponent::onTextChanged()
 {
-	std::string wrappedText = (isMultiline() ? mFont->wrapText(mText, getTextAreaSize().x()) : mText);
-	mTextCache = std::unique_ptr<TextCache>(mFont->buildTextCache(wrappedText, 0, 0, 0x77777700 | getOpacity()));
+	if(isMultiline())
+	{
+		mTextCache.reset();
+		layoutParagraphs();
+	}else{
+		mParagraphs.clear();
+		mTextCache = std::unique_ptr<TextCache>(mFont->buildTextCache(mText, 0, 0, 0x77777700 | getOpacity()));
+	}
 
 	if(mCursor > (int)mText.length())
 		mCursor = mText.length();
+
+	mCursorPos = getCursorOffset();
+}
+
+void TextEditComponent::layoutParagraphs()
+{
+	const float width = getTextAreaSize().x();
+	const unsigned int color = 0x77777700 | getOpacity();
+	if(width != mLayoutWidth || color != mLayoutColor)
+	{
+		mParagraphs.clear();
+		mLayoutWidth = width;
+		mLayoutColor = color;
+	}
+
+	std::vector<std::string> texts;
+	for(size_t pos = 0; ; )
+	{
+		const size_t newline = mText.find('\n', pos);
+		texts.push_back(mText.substr(pos, newline == std::string::npos ? std::string::npos : newline - pos));
+		if(newline == std::string::npos)
+			break;
+		pos = newline + 1;
+	}
+
+	// an edit changes a run of paragraphs somewhere in the middle, the ones before and after it are kept as they are
+	size_t head = 0;
+	while(head < texts.size() && head < mParagraphs.size() && mParagraphs[head].text == texts[head])
+		head++;
+
+	size_t tail = 0;
+	while(tail < texts.size() - head && tail < mParagraphs.size() - head && 
+		mParagraphs[mParagraphs.size() - 1 - tail].text == texts[texts.size() - 1 - tail])
+		tail++;
+
+	std::vector<Paragraph> changed(texts.size() - head - tail);
+	std::string wrapped; // reused by every changed paragraph
+	for(size_t i = 0; i < changed.size(); i++)
+	{
+		Paragraph& paragraph = changed[i];
+		paragraph.text = texts[head + i];
+
+		mFont->wrapText(paragraph.text, width, wrapped);
+		paragraph.lines = std::count(wrapped.begin(), wrapped.end(), '\n') + 1;
+		paragraph.cache = std::unique_ptr<TextCache>(mFont->buildTextCache(wrapped, 0, 0, color));
+	}
+
+	mParagraphs.erase(mParagraphs.begin() + head, mParagraphs.end() - tail);
+	mParagraphs.insert(mParagraphs.begin() + head, std::make_move_iterator(changed.begin()), std::make_move_iterator(changed.end()));
+
+	size_t start = 0;
+	float y = 0;
+	for(auto it = mParagraphs.begin(); it != mParagraphs.end(); it++)
+	{
+		it->start = start;
+		it->y = y;
+		start += it->text.length() + 1;
+		y += it->lines * mFont->getHeight();
+	}
+}
+
+Eigen::Vector2f TextEditComponent::getCursorOffset()
+{
+	if(mParagraphs.empty())
+	{
+		Eigen::Vector2f cursorPos = mFont->sizeText(mText.data(), mCursor);
+		cursorPos[1] = 0;
+		return cursorPos;
+	}
+
+	// only the cursor's own paragraph has to be walked
+	auto paragraph = std::upper_bound(mParagraphs.begin(), mParagraphs.end(), (size_t)mCursor, 
+		[](size_t cursor, const Paragraph& p) { return cursor < p.start; }) - 1;
+
+	Eigen::Vector2f offset = mFont->getWrappedTextCursorOffset(paragraph->text, mLayoutWidth, mCursor - paragraph->start);
+	offset[1] += paragraph->y;
+	return offset;
 }
 
 void TextEditComponent::onCursorChanged()
 {
+	mCursorPos = getCursorOffset();
+
 	if(isMultiline())
 	{
-		Eigen::Vector2f textSize = mFont->getWrappedTextCursorOffset(mText, getTextAreaSize().x(), mCursor); 
+		const Eigen::Vector2f& textSize = mCursorPos;
 
 		if(mScrollOffset.y() + getTextAreaSize().y() < textSize.y() + mFont->getHeight()) //need to scroll down?
 		{
@@ -203,7 +291,7 @@ void TextEditComponent::onCursorChanged()
 			mScrollOffset[1] = textSize.y();
 		}
 	}else{
-		Eigen::Vector2f cursorPos = mFont->sizeText(mText.substr(0, mCursor));
+		const Eigen::Vector2f& cursorPos = mCursorPos;
 
 		if(mScrollOffset.x() + getTextAreaSize().x() < cursorPos.x())
 		{
@@ -230,30 +318,37 @@ void TextEditComponent::render(const Eigen::Affine3f& parentTrans)
 	Renderer::pushClipRect(clipPos, clipDim);
 
 	trans.translate(Eigen::Vector3f(-mScrollOffset.x(), -mScrollOffset.y(), 0));
-	trans = roundMatrix(trans);
-
-	Renderer::setMatrix(trans);
 
 	if(mTextCache)
 	{
+		Renderer::setMatrix(roundMatrix(trans));
 		mFont->renderTextCache(mTextCache.get());
 	}
 
+	// only the paragraphs that are scrolled into view
+	for(auto it = mParagraphs.begin(); it != mParagraphs.end(); it++)
+	{
+		if(it->y + it->lines * mFont->getHeight() < mScrollOffset.y())
+			continue;
+		if(it->y > mScrollOffset.y() + getTextAreaSize().y())
+			break;
+
+		Eigen::Affine3f paragraphTrans = trans;
+		paragraphTrans.translate(Eigen::Vector3f(0, it->y, 0));
+		Renderer::setMatrix(roundMatrix(paragraphTrans));
+		mFont->renderTextCache(it->cache.get());
+	}
+
+	trans = roundMatrix(trans);
+	Renderer::setMatrix(trans);
+
 	// pop the clip early to allow the cursor to be drawn outside of the "text area"
 	Renderer::popClipRect();
 
 	// draw cursor
 	if(mEditing)
 	{
-		Eigen::Vector2f cursorPos;
-		if(isMultiline())
-		{
-			cursorPos = mFont->getWrappedTextCursorOffset(mText, getTextAreaSize().x(), mCursor);
-		}else{
-			cursorPos = mFont->sizeText(mText.substr(0, mCursor));
-			cursorPos[1] = 0;
-		}
-
+		const Eigen::Vector2f& cursorPos = mCursorPos;
 		float cursorHeight = mFont->getHeight() * 0.8f;
 		Renderer::drawRect(cursorPos.x(), cursorPos.y() + (mFont->getHeight() - cursorHeight) / 2, 2.0f, cursorHeight, 0x000000FF);
 	}
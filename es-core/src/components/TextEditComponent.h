@@ -40,6 +40,9 @@ private:
 	void onTextChanged();
 	void onCursorChanged();
 
+	void layoutParagraphs();
+	Eigen::Vector2f getCursorOffset(); // where the cursor goes, relative to the top left of the text
+
 	void updateCursorRepeat(int deltaTime);
 	void moveCursor(int amt);
 
@@ -60,5 +63,21 @@ private:
 	NinePatchComponent mBox;
 
 	std::shared_ptr<Font> mFont;
-	std::unique_ptr<TextCache> mTextCache;
+	std::unique_ptr<TextCache> mTextCache; // single line
+
+	// Multiline text is laid out a paragraph (hard line) at a time, so an edit only rewraps the paragraphs it touched
+	// and the rest keep their caches - they just move up or down.
+	struct Paragraph
+	{
+		std::string text; // without its '\n'
+		size_t start; // where it starts in mText
+		float y;
+		unsigned int lines; // once wrapped
+		std::unique_ptr<TextCache> cache; // built at (0, 0)
+	};
+	std::vector<Paragraph> mParagraphs;
+	float mLayoutWidth; // what mParagraphs are wrapped to
+	unsigned int mLayoutColor;
+
+	Eigen::Vector2f mCursorPos; // getCursorOffset(), kept by onCursorChanged()
 };
@@ -0,0 +1,213 @@
+#include "components/VideoComponent.h"
+#include "ThemeData.h"
+#include "Settings.h"
+#include "Renderer.h"
+#include "Log.h"
+#include "Window.h"
+#include "resources/ResourceManager.h"
+#include <SDL.h>
+#include <string.h>
+#include <cmath>
+
+#define VIDEO_DEFAULT_DELAY 1500 // ms
+#define VIDEO_KILL_TIMEOUT 2000 // ms a player gets to exit on its own before its whole group is SIGKILLed
+
+std::set<VideoComponent*> VideoComponent::sInstances;
+std::vector<VideoComponent::Stopping> VideoComponent::sStopping;
+unsigned int VideoComponent::sUpdateCount = 0;
+
+VideoComponent::VideoComponent(Window* window) : GuiComponent(window), mOrigin(0, 0), mStartDelay(VIDEO_DEFAULT_DELAY), 
+	mTimeSinceChange(0), mScreenRect(0, 0, 0, 0), mPlayingRect(0, 0, 0, 0), mRendered(false), mPlaying(false), mLastUpdate(0)
+{
+	sInstances.insert(this);
+	setUpdating(true);
+}
+
+VideoComponent::~VideoComponent()
+{
+	stopPlayback();
+	sInstances.erase(this);
+}
+
+void VideoComponent::setVideo(const std::string& path)
+{
+	if(path == mVideo)
+		return;
+
+	stopPlayback();
+	mVideo = path;
+	mTimeSinceChange = 0;
+}
+
+// the command with %VIDEO% and the rectangle filled in, video is quoted for startProcess()
+static std::string buildCommand(const std::string& format, const std::string& video, const Eigen::Vector4i& rect)
+{
+	std::string quoted = "\"";
+	for(auto it = video.begin(); it != video.end(); it++)
+	{
+		if(strchr("\"\\$`", *it))
+			quoted += '\\';
+		quoted += *it;
+	}
+	quoted += '"';
+
+	std::string cmd = format;
+	const char* keys[5] = { "%VIDEO%", "%X1%", "%Y1%", "%X2%", "%Y2%" };
+	const std::string values[5] = { quoted, std::to_string(rect[0]), std::to_string(rect[1]), std::to_string(rect[2]), std::to_string(rect[3]) };
+	for(int i = 0; i < 5; i++)
+	{
+		for(size_t pos = cmd.find(keys[i]); pos != std::string::npos; pos = cmd.find(keys[i], pos + values[i].size()))
+			cmd.replace(pos, strlen(keys[i]), values[i]);
+	}
+	return cmd;
+}
+
+void VideoComponent::startPlayback()
+{
+	const std::string& format = Settings::getInstance()->getString("VideoPlayerCommand");
+	if(format.empty() || !ResourceManager::getInstance()->fileExists(mVideo))
+		return;
+
+	const std::string cmd = buildCommand(format, mVideo, mScreenRect);
+	if(!startProcess(cmd, mPlayer, true))
+	{
+		LOG(LogWarning) << "Could not start video player: " << cmd;
+		return;
+	}
+
+	mPlaying = true;
+	mPlayingRect = mScreenRect;
+}
+
+void VideoComponent::stopPlayback()
+{
+	if(!mPlaying)
+		return;
+
+	mPlaying = false;
+	killProcess(mPlayer);
+	Stopping stopping = { mPlayer, SDL_GetTicks() };
+	sStopping.push_back(stopping);
+}
+
+void VideoComponent::update(int deltaTime)
+{
+	mLastUpdate = sUpdateCount;
+	GuiComponent::update(deltaTime);
+
+	// nothing to play, or nowhere to play it (no theme placed us)
+	if(mVideo.empty() || !mRendered || mSize.x() <= 0 || mSize.y() <= 0)
+		return;
+
+	// moved (e.g. a view transition), wait until it has settled again
+	if(mPlaying && mScreenRect != mPlayingRect)
+	{
+		stopPlayback();
+		mTimeSinceChange = 0;
+	}
+
+	if(!mPlaying)
+	{
+		mTimeSinceChange += deltaTime;
+		if(mTimeSinceChange >= mStartDelay)
+			startPlayback();
+		else
+			mWindow->invalidate(); // keep frames (and so updates) coming until then, it's only a moment
+	}
+}
+
+void VideoComponent::render(const Eigen::Affine3f& parentTrans)
+{
+	Eigen::Affine3f trans = getWorldTransform(parentTrans);
+
+	// the player draws it, all we need is where
+	const Eigen::Vector3f topLeft = trans * Eigen::Vector3f(-mOrigin.x() * mSize.x(), -mOrigin.y() * mSize.y(), 0);
+	const Eigen::Vector3f bottomRight = trans * Eigen::Vector3f((1 - mOrigin.x()) * mSize.x(), (1 - mOrigin.y()) * mSize.y(), 0);
+	const Eigen::Vector4i rect((int)round(topLeft.x()), (int)round(topLeft.y()), (int)round(bottomRight.x()), (int)round(bottomRight.y()));
+	if(!mRendered || rect != mScreenRect)
+	{
+		mScreenRect = rect;
+		mRendered = true;
+		mTimeSinceChange = 0;
+	}
+
+	GuiComponent::renderChildren(trans);
+}
+
+void VideoComponent::applyTheme(const std::shared_ptr<ThemeData>& theme, const std::string& view, const std::string& element, unsigned int properties)
+{
+	using namespace ThemeFlags;
+
+	const ThemeData::ThemeElement* elem = theme->getElement(view, element, "video");
+	if(!elem)
+		return;
+
+	Eigen::Vector2f scale = getParent() ? getParent()->getSize() : Eigen::Vector2f((float)Renderer::getScreenWidth(), (float)Renderer::getScreenHeight());
+
+	if(properties & POSITION && elem->has(ThemeProperties::POS))
+	{
+		Eigen::Vector2f denormalized = elem->get<Eigen::Vector2f>(ThemeProperties::POS).cwiseProduct(scale);
+		setPosition(Eigen::Vector3f(denormalized.x(), denormalized.y(), 0));
+	}
+
+	if(properties & ThemeFlags::SIZE && elem->has(ThemeProperties::SIZE))
+		setSize(elem->get<Eigen::Vector2f>(ThemeProperties::SIZE).cwiseProduct(scale));
+
+	if(properties & (POSITION | ThemeFlags::SIZE) && elem->has(ThemeProperties::ORIGIN))
+		mOrigin = elem->get<Eigen::Vector2f>(ThemeProperties::ORIGIN);
+
+	if(elem->has(ThemeProperties::DELAY))
+		mStartDelay = (int)(elem->get<float>(ThemeProperties::DELAY) * 1000);
+}
+
+void VideoComponent::stopStale()
+{
+	for(auto it = sInstances.begin(); it != sInstances.end(); it++)
+	{
+		if((*it)->mLastUpdate != sUpdateCount)
+		{
+			(*it)->stopPlayback();
+			(*it)->mTimeSinceChange = 0;
+		}
+	}
+	sUpdateCount++;
+
+	// reap players that were told to stop, and stop asking nicely once they've had long enough
+	for(auto it = sStopping.begin(); it != sStopping.end(); )
+	{
+		int exitCode;
+		if(pollProcess(it->process, exitCode))
+		{
+			it = sStopping.erase(it);
+		}else{
+			if(SDL_GetTicks() - it->killTime > VIDEO_KILL_TIMEOUT)
+				killProcess(it->process, true);
+			it++;
+		}
+	}
+}
+
+void VideoComponent::stopAll()
+{
+	for(auto it = sInstances.begin(); it != sInstances.end(); it++)
+	{
+		(*it)->stopPlayback();
+		(*it)->mTimeSinceChange = 0;
+	}
+
+	// the next thing on screen might be an emulator, so don't leave until they're gone
+	for(auto it = sStopping.begin(); it != sStopping.end(); it++)
+	{
+		int exitCode;
+		bool exited;
+		while(!(exited = pollProcess(it->process, exitCode)) && SDL_GetTicks() - it->killTime <= VIDEO_KILL_TIMEOUT)
+			SDL_Delay(10);
+
+		if(!exited)
+		{
+			killProcess(it->process, true);
+			waitProcess(it->process);
+		}
+	}
+	sStopping.clear();
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "GuiComponent.h"
+#include "platform.h"
+#include <set>
+
+// Plays a video (e.g. a game's snap) in its rectangle, once it has been left alone for a moment: setVideo() and
+// moving the component restart the delay, so nothing is decoded while a list is scrolled through.
+// Playback is handed to the "VideoPlayerCommand" setting (omxplayer on the Pi), which decodes in hardware and draws
+// on a display layer above ours; without one nothing is played and whatever is under the component shows through.
+// Since the player draws over everything, playback stops as soon as the component isn't updated every frame
+// (another view or a menu is on top) and whenever the window sleeps or is suspended.
+class VideoComponent : public GuiComponent
+{
+public:
+	VideoComponent(Window* window);
+	virtual ~VideoComponent();
+
+	void setVideo(const std::string& path); // empty for none
+	inline void setStartDelay(int ms) { mStartDelay = ms; }
+
+	void update(int deltaTime) override;
+	void render(const Eigen::Affine3f& parentTrans) override;
+
+	virtual void applyTheme(const std::shared_ptr<ThemeData>& theme, const std::string& view, const std::string& element, unsigned int properties) override;
+
+	// Called by Window at the end of every update(): stops anything that wasn't updated since the last call.
+	static void stopStale();
+	// Stops everything, e.g. before the window goes to sleep or a game is launched.
+	static void stopAll();
+
+private:
+	void startPlayback();
+	void stopPlayback();
+
+	std::string mVideo;
+	Eigen::Vector2f mOrigin;
+	int mStartDelay;
+	int mTimeSinceChange;
+
+	Eigen::Vector4i mScreenRect; // x1, y1, x2, y2 in pixels, where the last render() put us
+	Eigen::Vector4i mPlayingRect;
+	bool mRendered; // mScreenRect is valid
+
+	bool mPlaying;
+	ProcessHandle mPlayer;
+	unsigned int mLastUpdate; // sUpdateCount at the last update()
+
+	static std::set<VideoComponent*> sInstances;
+	struct Stopping
+	{
+		ProcessHandle process;
+		unsigned int killTime; // SDL_GetTicks() when it was sent SIGTERM
+	};
+	static std::vector<Stopping> sStopping; // killed, not reaped yet
+	static unsigned int sUpdateCount;
+};
@@ -17,6 +17,7 @@ GuiTextEditPopupKeyboard::GuiTextEditPopupKeyboard(Window* window, const std::st
 
 	mText = std::make_shared<TextEditComponent>(mWindow);
 	mText->setValue(initValue);
+	mLastValue = initValue;
 
 	if (!multiLine)
 		mText->setCursor(initValue.size());
@@ -218,7 +219,11 @@ bool GuiTextEditPopupKeyboard::input(InputConfig* config, Input input)
 }
 
 void GuiTextEditPopupKeyboard::update(int deltatime) {
-
+	// the text changes from buttons, shoulder buttons and a real keyboard alike, so just watch it
+	if (mChangedCallback && mText->getValue() != mLastValue) {
+		mLastValue = mText->getValue();
+		mChangedCallback(mLastValue);
+	}
 }
 
 // Shifts the keys when user hits the shift button.
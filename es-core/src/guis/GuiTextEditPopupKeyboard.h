@@ -12,6 +12,9 @@ public:
 	GuiTextEditPopupKeyboard(Window* window, const std::string& title, const std::string& initValue,
 		const std::function<void(const std::string&)>& okCallback, bool multiLine, const char* acceptBtnText = "OK");
 
+	// Called with the new text after every edit, e.g. for searching as the user types.
+	inline void setChangedCallback(const std::function<void(const std::string&)>& callback) { mChangedCallback = callback; }
+
 	bool input(InputConfig* config, Input input);
 	void update(int deltatime) override;
 	void onSizeChanged();
@@ -48,6 +51,9 @@ private:
 
 	int mxIndex = 0;		// Stores the X index and makes every grid the same.
 
+	std::function<void(const std::string&)> mChangedCallback;
+	std::string mLastValue; // what mChangedCallback was last told about
+
 	bool mMultiLine;
 	bool mShift = false;
 	bool mShiftChange = false;
@@ -1,12 +1,24 @@
 #include "platform.h"
 #include <stdlib.h>
 #include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
 #include <SDL.h>
 #include <iostream>
 #include <fcntl.h>
+#include <vector>
+#include <string.h>
 
 #ifdef WIN32
 #include <codecvt>
+#include <windows.h>
+#else
+#include <errno.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
 #endif
 
 std::string getHomePath()
@@ -61,15 +73,256 @@ int runRestartCommand()
 
 int runSystemCommand(const std::string& cmd_utf8)
 {
+	ProcessHandle process;
+	if(!startProcess(cmd_utf8, process))
+		return -1;
+
+	return waitProcess(process);
+}
+
 #ifdef WIN32
-	// on Windows we use _wsystem to support non-ASCII paths
-	// which requires converting from utf8 to a wstring
+bool startProcess(const std::string& cmd_utf8, ProcessHandle& process, bool /*ownGroup*/)
+{
+	// CreateProcess wants wide strings to support non-ASCII paths
 	typedef std::codecvt_utf8<wchar_t> convert_type;
 	std::wstring_convert<convert_type, wchar_t> converter;
-	std::wstring wchar_str = converter.from_bytes(cmd_utf8);
-	return _wsystem(wchar_str.c_str());
+	std::wstring cmd = converter.from_bytes(cmd_utf8);
+
+	// the program parses its own command line on Windows, we only need cmd.exe for its syntax
+	if(cmd.find_first_of(L"|&<>^%") != std::wstring::npos)
+		cmd = L"cmd.exe /C \"" + cmd + L"\"";
+
+	STARTUPINFOW si;
+	PROCESS_INFORMATION pi;
+	ZeroMemory(&si, sizeof(si));
+	si.cb = sizeof(si);
+	ZeroMemory(&pi, sizeof(pi));
+
+	// CreateProcessW may modify the command line
+	std::vector<wchar_t> buffer(cmd.begin(), cmd.end());
+	buffer.push_back(L'\0');
+
+	if(!CreateProcessW(NULL, &buffer[0], NULL, NULL, FALSE, 0, NULL, NULL, &si, &pi))
+	{
+		process.process = NULL;
+		return false;
+	}
+
+	CloseHandle(pi.hThread);
+	process.process = pi.hProcess;
+	return true;
+}
+
+bool pollProcess(ProcessHandle& process, int& exitCode)
+{
+	if(process.process == NULL)
+	{
+		exitCode = -1;
+		return true;
+	}
+
+	if(WaitForSingleObject(process.process, 0) != WAIT_OBJECT_0)
+		return false;
+
+	DWORD code = (DWORD)-1;
+	GetExitCodeProcess(process.process, &code);
+	CloseHandle(process.process);
+	process.process = NULL;
+
+	exitCode = (int)code;
+	return true;
+}
+
+int waitProcess(ProcessHandle& process)
+{
+	if(process.process != NULL)
+		WaitForSingleObject(process.process, INFINITE);
+
+	int exitCode;
+	pollProcess(process, exitCode);
+	return exitCode;
+}
+
+void killProcess(ProcessHandle& process, bool /*force*/)
+{
+	if(process.process != NULL)
+		TerminateProcess(process.process, 1);
+}
 #else
-	return system(cmd_utf8.c_str());
+// Splits cmd into arguments the way sh would, as long as it only uses quotes and backslash escapes
+// (which is all %ROM%'s escaping, appendEscapedPath() in SystemData.cpp, produces). Returns false if it needs a real shell (pipes, variables, globs...).
+static bool splitCommand(const std::string& cmd, std::vector<std::string>& args)
+{
+	std::string arg;
+	bool inArg = false;
+	char quote = 0;
+
+	for(unsigned int i = 0; i < cmd.length(); i++)
+	{
+		const char c = cmd[i];
+
+		if(quote == '\'')
+		{
+			if(c == '\'')
+				quote = 0;
+			else
+				arg += c;
+			continue;
+		}
+
+		if(quote == '"')
+		{
+			if(c == '"')
+				quote = 0;
+			else if(c == '$' || c == '`')
+				return false;
+			else if(c == '\\' && i + 1 < cmd.length() && strchr("\"\\$`", cmd[i + 1]))
+				arg += cmd[++i];
+			else
+				arg += c;
+			continue;
+		}
+
+		if(c == ' ' || c == '\t')
+		{
+			if(inArg)
+				args.push_back(arg);
+			arg.clear();
+			inArg = false;
+			continue;
+		}
+
+		// "VAR=value program", "~/path" and "# comment" are all shell features too
+		if(strchr("|&;<>()$`*?[]{}!\n", c) || (!inArg && (c == '~' || c == '#')) || (c == '=' && args.empty()))
+			return false;
+
+		inArg = true;
+		if(c == '\\')
+		{
+			if(i + 1 >= cmd.length())
+				return false;
+			arg += cmd[++i];
+		}else if(c == '\'' || c == '"')
+		{
+			quote = c;
+		}else{
+			arg += c;
+		}
+	}
+
+	if(quote != 0)
+		return false;
+
+	if(inArg)
+		args.push_back(arg);
+
+	return !args.empty();
+}
+
+bool startProcess(const std::string& cmd_utf8, ProcessHandle& process, bool ownGroup)
+{
+	std::vector<std::string> args;
+	if(!splitCommand(cmd_utf8, args))
+	{
+		args.clear();
+		args.push_back("/bin/sh");
+		args.push_back("-c");
+		args.push_back(cmd_utf8);
+	}
+
+	std::vector<char*> argv;
+	for(auto it = args.begin(); it != args.end(); it++)
+		argv.push_back(&(*it)[0]);
+	argv.push_back(NULL);
+
+	posix_spawnattr_t attr;
+	posix_spawnattr_init(&attr);
+	if(ownGroup)
+	{
+		posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETPGROUP);
+		posix_spawnattr_setpgroup(&attr, 0);
+	}
+
+	pid_t pid;
+	const int err = posix_spawnp(&pid, argv[0], NULL, &attr, &argv[0], environ);
+	posix_spawnattr_destroy(&attr);
+	if(err != 0)
+	{
+		process.pid = -1;
+		process.group = false;
+		return false;
+	}
+
+	process.pid = pid;
+	process.group = ownGroup;
+	return true;
+}
+
+// the program's exit code rather than the raw wait status system() gave, 0 still means success
+static int toExitCode(int status)
+{
+	if(WIFEXITED(status))
+		return WEXITSTATUS(status);
+	return -1;
+}
+
+bool pollProcess(ProcessHandle& process, int& exitCode)
+{
+	if(process.pid <= 0)
+	{
+		exitCode = -1;
+		return true;
+	}
+
+	int status;
+	const pid_t ret = waitpid(process.pid, &status, WNOHANG);
+	if(ret == 0)
+		return false;
+
+	exitCode = ret == process.pid ? toExitCode(status) : -1;
+	process.pid = -1;
+	return true;
+}
+
+int waitProcess(ProcessHandle& process)
+{
+	if(process.pid <= 0)
+		return -1;
+
+	int status;
+	pid_t ret;
+	do {
+		ret = waitpid(process.pid, &status, 0);
+	} while(ret < 0 && errno == EINTR);
+
+	process.pid = -1;
+	return ret > 0 ? toExitCode(status) : -1;
+}
+
+void killProcess(ProcessHandle& process, bool force)
+{
+	if(process.pid > 0)
+		kill(process.group ? -process.pid : process.pid, force ? SIGKILL : SIGTERM);
+}
+#endif
+
+void prefetchFile(const std::string& path, size_t maxBytes)
+{
+#ifdef __linux__
+	int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if(fd < 0)
+		return;
+	posix_fadvise(fd, 0, (off_t)maxBytes, POSIX_FADV_WILLNEED);
+	close(fd);
+#else
+	boost::filesystem::ifstream file(boost::filesystem::path(path), std::ios::in | std::ios::binary);
+	std::vector<char> buffer(1024 * 1024);
+	size_t total = 0;
+	while(file && total < maxBytes)
+	{
+		file.read(buffer.data(), buffer.size());
+		total += (size_t)file.gcount();
+	}
 #endif
 }
 
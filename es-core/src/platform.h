@@ -1,3 +1,5 @@
+#pragma once
+
 //the Makefile defines one of these:
 //#define USE_OPENGL_ES
 //#define USE_OPENGL_DESKTOP
@@ -22,5 +24,28 @@ std::string getHomePath();
 int runShutdownCommand(); // shut down the system (returns 0 if successful)
 int runRestartCommand(); // restart the system (returns 0 if successful)
 int runSystemCommand(const std::string& cmd_utf8); // run a utf-8 encoded in the shell (requires wstring conversion on Windows)
+
+// A process started by startProcess(). Commands that only use quotes and backslash escapes are started directly
+// (posix_spawnp / CreateProcess) instead of going through a shell, anything else runs in the shell like system().
+struct ProcessHandle
+{
+#ifdef WIN32
+	void* process;
+#else
+	int pid;
+	bool group; // pid is also the id of its own process group
+#endif
+};
+
+// false if it couldn't be started. ownGroup puts it in a process group of its own, so killProcess() also reaches
+// whatever it starts itself (a shell's children, a player's decoder...).
+bool startProcess(const std::string& cmd_utf8, ProcessHandle& process, bool ownGroup = false);
+bool pollProcess(ProcessHandle& process, int& exitCode); // true (with exitCode) once it has exited, never blocks
+int waitProcess(ProcessHandle& process); // returns the exit code, or -1 if that isn't known
+// Asks it to exit (SIGTERM, or SIGKILL if force / TerminateProcess), it still has to be polled or waited for.
+void killProcess(ProcessHandle& process, bool force = false);
+// Asks the OS to start reading (the first maxBytes of) a file into its cache, so opening it later doesn't wait on
+// the disk. On Linux this is posix_fadvise and returns quickly, elsewhere it reads the file, so call it off the main thread.
+void prefetchFile(const std::string& path, size_t maxBytes);
 int quitES(const std::string& filename);
 void touch(const std::string& filename);
@@ -2,16 +2,43 @@
 #include <iostream>
 #include <algorithm>
 #include <vector>
+#include <cstring>
+#include <cstddef>
+#include <cmath>
+#include <cfloat>
+#include <functional>
+#include <stdint.h>
 #include <boost/filesystem.hpp>
 #include "Renderer.h"
 #include "Log.h"
 #include "Util.h"
+#include "MemoryStats.h"
+#include "AllocStats.h"
+#include "GpuProfiler.h"
+#include FT_SIZES_H
+#include FT_MODULE_H
+#include "Settings.h"
+#include "ResourceGovernor.h"
+
+// distance fields are in FreeType from 2.11
+#if FREETYPE_MAJOR > 2 || (FREETYPE_MAJOR == 2 && FREETYPE_MINOR >= 11)
+#define FONT_HAS_SDF
+#endif
 
 FT_Library Font::sLibrary = NULL;
+unsigned int Font::sUseCounter = 0;
+
+#define FONT_MAX_TEXTURES 4 // per font, 2048x512 alpha each
+#define FONT_WRAP_CACHE_SIZE 32 // wrapped strings remembered per font
+#define FONT_SDF_SIZE 48 // the size distance field glyphs are made at, whatever size they're drawn at
+#define FONT_SDF_SPREAD 8 // how far out from the outline a distance field goes, in pixels at FONT_SDF_SIZE
 
 int Font::getSize() const { return mSize; }
 
 std::map< std::pair<std::string, int>, std::weak_ptr<Font> > Font::sFontMap;
+std::map< std::string, std::weak_ptr<Font::FontFile> > Font::sFontFiles;
+size_t Font::sTextureMemUsage = 0;
+size_t Font::sFileMemUsage = 0;
 
 
 // utf8 stuff
@@ -68,12 +95,45 @@ size_t Font::getPrevCursor(const std::string& str, size_t cursor)
 	return cursor;
 }
 
+size_t Font::getAsciiRunLength(const char* str, size_t length)
+{
+	// 16 bytes at a time while no byte has its high bit set, then byte by byte up to the first one that does
+	size_t i = 0;
+	while(i + 16 <= length)
+	{
+		uint64_t a, b;
+		memcpy(&a, str + i, 8);
+		memcpy(&b, str + i + 8, 8);
+		if((a | b) & 0x8080808080808080ULL)
+			break;
+		i += 16;
+	}
+
+	while(i < length && (str[i] & 0x80) == 0)
+		i++;
+
+	return i;
+}
+
 size_t Font::moveCursor(const std::string& str, size_t cursor, int amt)
 {
 	if(amt > 0)
 	{
-		for(int i = 0; i < amt; i++)
+		int i = 0;
+		while(i < amt && cursor < str.length())
+		{
+			// skip over ASCII without decoding it
+			const size_t run = std::min(getAsciiRunLength(str.data() + cursor, str.length() - cursor), (size_t)(amt - i));
+			if(run > 0)
+			{
+				cursor += run;
+				i += (int)run;
+				continue;
+			}
+
 			cursor = Font::getNextCursor(str, cursor);
+			i++;
+		}
 	}
 	else if(amt < 0)
 	{
@@ -85,6 +145,11 @@ size_t Font::moveCursor(const std::string& str, size_t cursor, int amt)
 }
 
 UnicodeChar Font::readUnicodeChar(const std::string& str, size_t& cursor)
+{
+	return readUnicodeChar(str.data(), cursor);
+}
+
+UnicodeChar Font::readUnicodeChar(const char* str, size_t& cursor)
 {
 	const char& c = str[cursor];
 
@@ -137,18 +202,64 @@ UnicodeChar Font::readUnicodeChar(const std::string& str, size_t& cursor)
 }
 
 
-Font::FontFace::FontFace(ResourceData&& d, int size) : data(d)
+Font::FontFile::FontFile(const ResourceData& d, const std::string& p) : data(d), path(p), face(NULL)
 {
-	int err = FT_New_Memory_Face(sLibrary, data.ptr.get(), data.length, 0, &face);
-	assert(!err);
-	
-	FT_Set_Pixel_Sizes(face, 0, size);
+	sFileMemUsage += data.length;
+
+	if(data.length == 0 || FT_New_Memory_Face(sLibrary, data.ptr.get(), data.length, 0, &face))
+	{
+		LOG(LogError) << "Could not open font " << path;
+		face = NULL;
+	}
 }
 
-Font::FontFace::~FontFace()
+Font::FontFile::~FontFile()
 {
 	if(face)
 		FT_Done_Face(face);
+
+	sFileMemUsage -= data.length;
+
+	auto it = sFontFiles.find(path);
+	if(it != sFontFiles.end() && it->second.expired())
+		sFontFiles.erase(it);
+}
+
+std::shared_ptr<Font::FontFile> Font::getFontFile(const std::string& path)
+{
+	auto it = sFontFiles.find(path);
+	if(it != sFontFiles.end())
+	{
+		std::shared_ptr<FontFile> file = it->second.lock();
+		if(file)
+			return file;
+	}
+
+	std::shared_ptr<FontFile> file = std::make_shared<FontFile>(ResourceManager::getInstance()->getFileData(path), path);
+	sFontFiles[path] = file;
+	return file;
+}
+
+Font::FontFace::FontFace(const std::shared_ptr<FontFile>& f, int pixelSize) : file(f), size(NULL)
+{
+	if(file->face == NULL)
+		return;
+
+	// the face's own size stays unused, every Font makes one
+	if(FT_New_Size(file->face, &size))
+	{
+		size = NULL;
+		return;
+	}
+
+	FT_Activate_Size(size);
+	FT_Set_Pixel_Sizes(file->face, 0, pixelSize);
+}
+
+Font::FontFace::~FontFace()
+{
+	if(size)
+		FT_Done_Size(size);
 }
 
 void Font::initLibrary()
@@ -158,60 +269,86 @@ void Font::initLibrary()
 	{
 		sLibrary = NULL;
 		LOG(LogError) << "Error initializing FreeType!";
+		return;
 	}
+
+#ifdef FONT_HAS_SDF
+	FT_Int spread = FONT_SDF_SPREAD;
+	FT_Property_Set(sLibrary, "sdf", "spread", &spread);
+	FT_Property_Set(sLibrary, "bsdf", "spread", &spread);
+#endif
+}
+
+bool Font::useDistanceFields()
+{
+#ifdef FONT_HAS_SDF
+	// decided once, Fonts of both kinds can't be mixed
+	static const bool enabled = Settings::getInstance()->getBool("FontDistanceField");
+	return enabled;
+#else
+	return false;
+#endif
 }
 
 size_t Font::getMemUsage() const
 {
 	size_t memUsage = 0;
 	for(auto it = mTextures.begin(); it != mTextures.end(); it++)
-		memUsage += it->textureSize.x() * it->textureSize.y() * 4;
-
-	for(auto it = mFaceCache.begin(); it != mFaceCache.end(); it++)
-		memUsage += it->second->data.length;
+		memUsage += (*it)->textureSize.x() * (*it)->textureSize.y() * 4;
 
 	return memUsage;
 }
 
 size_t Font::getTotalMemUsage()
 {
-	size_t total = 0;
+	// font files are shared between sizes, so they're counted once each
+	return sTextureMemUsage + sFileMemUsage;
+}
 
-	auto it = sFontMap.begin();
-	while(it != sFontMap.end())
+void Font::logLiveFonts()
+{
+	LOG(LogInfo) << sFontMap.size() << " live fonts, " << sTextureMemUsage / 1024 << "kb of glyph textures and " << sFileMemUsage / 1024 << "kb of font files";
+	for(auto it = sFontMap.begin(); it != sFontMap.end(); it++)
 	{
-		if(it->second.expired())
-		{
-			it = sFontMap.erase(it);
-			continue;
-		}
-
-		total += it->second.lock()->getMemUsage();
-		it++;
+		std::shared_ptr<Font> font = it->second.lock();
+		if(font)
+			LOG(LogInfo) << "  " << font->mPath << " " << font->mSize << "px " << font->mTextures.size() << " textures " << font->getMemUsage() / 1024 << "kb";
 	}
-
-	return total;
 }
 
-Font::Font(int size, const std::string& path) : mSize(size), mPath(path)
+Font::Font(int size, const std::string& path) : mSize(size), mPath(path), mDistanceField(useDistanceFields()), mAtlasScale(1), mGlyphPadding(0)
 {
 	assert(mSize > 0);
 	
 	mMaxGlyphHeight = 0;
+	memset(mGlyphTable, 0, sizeof(mGlyphTable));
 
 	if(!sLibrary)
 		initLibrary();
 
+	if(mDistanceField)
+	{
+		if(mSize != FONT_SDF_SIZE)
+		{
+			mAtlas = Font::get(FONT_SDF_SIZE, mPath);
+			mAtlasScale = (float)mSize / FONT_SDF_SIZE;
+		}
+		mGlyphPadding = FONT_SDF_SPREAD * mAtlasScale;
+	}
+
 	// always initialize ASCII characters
 	for(UnicodeChar i = 32; i < 128; i++)
 		getGlyph(i);
-
-	clearFaceCache();
 }
 
 Font::~Font()
 {
 	unload(ResourceManager::getInstance());
+	clearFaceCache();
+
+	auto it = sFontMap.find(std::make_pair(mPath, mSize));
+	if(it != sFontMap.end() && it->second.expired())
+		sFontMap.erase(it);
 }
 
 void Font::reload(std::shared_ptr<ResourceManager>& rm)
@@ -246,7 +383,7 @@ void Font::unloadTextures()
 {
 	for(auto it = mTextures.begin(); it != mTextures.end(); it++)
 	{
-		it->deinitTexture();
+		(*it)->deinitTexture();
 	}
 }
 
@@ -254,13 +391,19 @@ Font::FontTexture::FontTexture()
 {
 	textureId = 0;
 	textureSize << 2048, 512;
-	writePos = Eigen::Vector2i::Zero();
-	rowHeight = 0;
+	shelvesHeight = 0;
+	generation = 0;
+	lastUsed = 0;
+	smooth = false;
+
+	sTextureMemUsage += textureSize.x() * textureSize.y() * 4;
 }
 
 Font::FontTexture::~FontTexture()
 {
 	deinitTexture();
+
+	sTextureMemUsage -= textureSize.x() * textureSize.y() * 4;
 }
 
 bool Font::FontTexture::findEmpty(const Eigen::Vector2i& size, Eigen::Vector2i& cursor_out)
@@ -268,43 +411,54 @@ bool Font::FontTexture::findEmpty(const Eigen::Vector2i& size, Eigen::Vector2i&
 	if(size.x() >= textureSize.x() || size.y() >= textureSize.y())
 		return false;
 
-	if(writePos.x() + size.x() >= textureSize.x() &&
-		writePos.y() + rowHeight + size.y() + 1 < textureSize.y())
+	// the shelf with the least wasted height, and whether that waste is small enough to not bother with a new shelf
+	Shelf* best = NULL;
+	for(auto it = shelves.begin(); it != shelves.end(); it++)
 	{
-		// row full, but it should fit on the next row
-		// move cursor to next row
-		writePos << 0, writePos.y() + rowHeight + 1; // leave 1px of space between glyphs
-		rowHeight = 0;
+		if(it->height >= size.y() && it->writeX + size.x() < textureSize.x() && (!best || it->height < best->height))
+			best = &(*it);
 	}
 
-	if(writePos.x() + size.x() >= textureSize.x() ||
-		writePos.y() + size.y() >= textureSize.y())
+	const bool goodFit = best && best->height - size.y() <= std::max(2, best->height / 4);
+	if(!goodFit && shelvesHeight + size.y() < textureSize.y())
 	{
-		// nope, still won't fit
-		return false;
+		// start a new shelf (with a little headroom, glyphs of a font are all about the same height)
+		Shelf shelf;
+		shelf.y = shelvesHeight;
+		shelf.height = std::min(size.y() + 2, textureSize.y() - shelvesHeight - 1);
+		shelf.writeX = 0;
+		shelvesHeight += shelf.height + 1; // leave 1px of space between shelves
+		shelves.push_back(shelf);
+		best = &shelves.back();
 	}
 
-	cursor_out = writePos;
-	writePos[0] += size.x() + 1; // leave 1px of space between glyphs
-
-	if(size.y() > rowHeight)
-		rowHeight = size.y();
+	if(!best)
+		return false; // full
 
+	cursor_out << best->writeX, best->y;
+	best->writeX += size.x() + 1; // leave 1px of space between glyphs
 	return true;
 }
 
+void Font::FontTexture::clear()
+{
+	shelves.clear();
+	shelvesHeight = 0;
+	generation++;
+}
+
 void Font::FontTexture::initTexture()
 {
 	assert(textureId == 0);
 
 	glGenTextures(1, &textureId);
-	glBindTexture(GL_TEXTURE_2D, textureId);
+	Renderer::bindTexture(textureId);
 
 	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST);
+	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, smooth ? GL_LINEAR : GL_NEAREST);
 
 	glPixelStorei(GL_PACK_ALIGNMENT, 1);
 	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
@@ -316,28 +470,46 @@ void Font::FontTexture::deinitTexture()
 {
 	if(textureId != 0)
 	{
-		glDeleteTextures(1, &textureId);
+		Renderer::deleteTexture(textureId);
 		textureId = 0;
 	}
 }
 
 void Font::getTextureForNewGlyph(const Eigen::Vector2i& glyphSize, FontTexture*& tex_out, Eigen::Vector2i& cursor_out)
 {
-	if(mTextures.size())
+	// newest first, older ones are probably full
+	for(auto it = mTextures.rbegin(); it != mTextures.rend(); it++)
 	{
-		// check if the most recent texture has space
-		tex_out = &mTextures.back();
-
-		// will this one work?
+		tex_out = it->get();
 		if(tex_out->findEmpty(glyphSize, cursor_out))
-			return; // yes
+			return;
 	}
 
-	// current textures are full,
-	// make a new one
-	mTextures.push_back(FontTexture());
-	tex_out = &mTextures.back();
-	tex_out->initTexture();
+	// fewer on a small machine, glyphs get rasterized again more often instead
+	unsigned int maxTextures = FONT_MAX_TEXTURES;
+	const unsigned int cap = ResourceGovernor::getInstance()->getProfile().fontMaxTextures;
+	if(cap > 0 && cap < maxTextures)
+		maxTextures = cap;
+
+	if(mTextures.size() < maxTextures)
+	{
+		// current textures are full,
+		// make a new one
+		mTextures.push_back(std::unique_ptr<FontTexture>(new FontTexture()));
+		tex_out = mTextures.back().get();
+		tex_out->smooth = mDistanceField;
+		tex_out->initTexture();
+	}else{
+		// at the limit, reuse whichever texture has gone unused the longest
+		tex_out = mTextures.front().get();
+		for(auto it = mTextures.begin(); it != mTextures.end(); it++)
+		{
+			if((*it)->lastUsed < tex_out->lastUsed)
+				tex_out = it->get();
+		}
+
+		evictTexture(tex_out);
+	}
 	
 	bool ok = tex_out->findEmpty(glyphSize, cursor_out);
 	if(!ok)
@@ -347,7 +519,25 @@ void Font::getTextureForNewGlyph(const Eigen::Vector2i& glyphSize, FontTexture*&
 	}
 }
 
-std::vector<std::string> getFallbackFontPaths()
+void Font::evictTexture(FontTexture* tex)
+{
+	auto it = mGlyphMap.begin();
+	while(it != mGlyphMap.end())
+	{
+		if(it->second.texture == tex)
+		{
+			if(it->first < GLYPH_TABLE_SIZE)
+				mGlyphTable[it->first] = NULL;
+			it = mGlyphMap.erase(it);
+		}
+		else
+			it++;
+	}
+
+	tex->clear();
+}
+
+static std::vector<std::string> getFallbackFontPaths()
 {
 #ifdef WIN32
 	// Windows
@@ -400,31 +590,94 @@ std::vector<std::string> getFallbackFontPaths()
 #endif
 }
 
-FT_Face Font::getFaceForChar(UnicodeChar id)
+const std::vector<std::string>& Font::getFallbackFonts()
 {
 	static const std::vector<std::string> fallbackFonts = getFallbackFontPaths();
+	return fallbackFonts;
+}
+
+bool Font::Coverage::has(UnicodeChar id) const
+{
+	auto page = pages.find(id >> 8);
+	return page != pages.end() && page->second.test(id & 0xFF);
+}
+
+const std::vector<Font::Coverage>& Font::getFallbackCoverage()
+{
+	static std::vector<Coverage> coverage;
+	static bool built = false;
+	if(built)
+		return coverage;
+
+	// every fallback is opened once here, and only opened again by a Font that ends up needing it
+	const std::vector<std::string>& paths = getFallbackFonts();
+	coverage.resize(paths.size());
+	for(unsigned int i = 0; i < paths.size(); i++)
+	{
+		std::shared_ptr<FontFile> file = getFontFile(paths[i]);
+		if(file->face == NULL)
+			continue;
+
+		FT_UInt glyph;
+		for(FT_ULong c = FT_Get_First_Char(file->face, &glyph); glyph != 0; c = FT_Get_Next_Char(file->face, c, &glyph))
+			coverage[i].pages[c >> 8].set(c & 0xFF);
+	}
+
+	built = true;
+	return coverage;
+}
+
+int Font::getFallbackForChar(UnicodeChar id)
+{
+	// the same for every Font, a codepoint goes to the first fallback that has it
+	static std::unordered_map<UnicodeChar, int> fallbackForChar;
 
-	// look through our current font + fallback fonts to see if any have the glyph we're looking for
-	for(unsigned int i = 0; i < fallbackFonts.size() + 1; i++)
+	auto it = fallbackForChar.find(id);
+	if(it != fallbackForChar.end())
+		return it->second;
+
+	const std::vector<Coverage>& coverage = getFallbackCoverage();
+	int fallback = -1;
+	for(unsigned int i = 0; i < coverage.size() && fallback < 0; i++)
 	{
-		auto fit = mFaceCache.find(i);
+		if(coverage[i].has(id))
+			fallback = i;
+	}
 
-		if(fit == mFaceCache.end()) // doesn't exist yet
-		{
-			// i == 0 -> mPath
-			// otherwise, take from fallbackFonts
-			const std::string& path = (i == 0 ? mPath : fallbackFonts.at(i - 1));
-			ResourceData data = ResourceManager::getInstance()->getFileData(path);
-			mFaceCache[i] = std::unique_ptr<FontFace>(new FontFace(std::move(data), mSize));
-			fit = mFaceCache.find(i);
-		}
+	fallbackForChar[id] = fallback;
+	return fallback;
+}
+
+Font::FontFace* Font::getFace(unsigned int i)
+{
+	auto fit = mFaceCache.find(i);
+	if(fit == mFaceCache.end())
+	{
+		// i == 0 -> mPath, otherwise a fallback
+		const std::string& path = (i == 0 ? mPath : getFallbackFonts().at(i - 1));
+		fit = mFaceCache.insert(std::make_pair(i, std::unique_ptr<FontFace>(new FontFace(getFontFile(path), mSize)))).first;
+	}
+
+	return fit->second.get();
+}
 
-		if(FT_Get_Char_Index(fit->second->face, id) != 0)
-			return fit->second->face;
+FT_Face Font::getFaceForChar(UnicodeChar id)
+{
+	// our own font, then whichever fallback has it - without opening the ones that don't
+	FontFace* face = getFace(0);
+	if(face->size == NULL || FT_Get_Char_Index(face->file->face, id) == 0)
+	{
+		const int fallback = getFallbackForChar(id);
+		if(fallback >= 0 && getFace(fallback + 1)->size != NULL)
+			face = getFace(fallback + 1);
 	}
 
-	// nothing has a valid glyph - return the "real" face so we get a "missing" character
-	return mFaceCache.begin()->second->face;
+	// if nothing has it, this is our own font's "missing" character
+	if(face->size == NULL)
+		return NULL;
+
+	FT_Activate_Size(face->size);
+	return face->file->face;
 }
 
 void Font::clearFaceCache()
@@ -434,12 +687,63 @@ void Font::clearFaceCache()
 
 Font::Glyph* Font::getGlyph(UnicodeChar id)
 {
-	// is it already loaded?
+	// is it already loaded? (copies of an atlas's glyphs have to be copied again if it was cleared since)
+	if(id < GLYPH_TABLE_SIZE && mGlyphTable[id] != NULL && mGlyphTable[id]->generation == mGlyphTable[id]->texture->generation)
+	{
+		mGlyphTable[id]->texture->lastUsed = ++sUseCounter;
+		return mGlyphTable[id];
+	}
+
 	auto it = mGlyphMap.find(id);
-	if(it != mGlyphMap.end())
+	if(it != mGlyphMap.end() && it->second.generation == it->second.texture->generation)
+	{
+		it->second.texture->lastUsed = ++sUseCounter;
 		return &it->second;
+	}
 
 	// nope, need to make a glyph
+	return createGlyph(id, NULL);
+}
+
+bool Font::loadGlyphBitmap(FT_Face face, UnicodeChar id)
+{
+	if(!mDistanceField)
+		return FT_Load_Char(face, id, FT_LOAD_RENDER) == 0;
+
+	if(FT_Load_Char(face, id, FT_LOAD_DEFAULT))
+		return false;
+
+#ifdef FONT_HAS_SDF
+	// nothing to render for blank glyphs like space, their bitmap stays empty
+	FT_GlyphSlot g = face->glyph;
+	if(g->format == FT_GLYPH_FORMAT_OUTLINE && g->outline.n_points > 0)
+		FT_Render_Glyph(g, FT_RENDER_MODE_SDF);
+#endif
+	return true;
+}
+
+Font::Glyph* Font::createGlyph(UnicodeChar id, std::map<FontTexture*, GlyphStaging>* staging)
+{
+	if(mAtlas)
+	{
+		Glyph* source = mAtlas->getGlyph(id);
+		if(source == NULL)
+			return NULL;
+
+		Glyph& glyph = mGlyphMap[id];
+		glyph = *source;
+		glyph.size = source->size * mAtlasScale;
+		glyph.advance = source->advance * mAtlasScale;
+		glyph.bearing = source->bearing * mAtlasScale;
+
+		mMaxGlyphHeight = std::max(mMaxGlyphHeight, (int)(mAtlas->mMaxGlyphHeight * mAtlasScale + 0.5f));
+
+		if(id < GLYPH_TABLE_SIZE)
+			mGlyphTable[id] = &glyph;
+
+		return &glyph;
+	}
+
 	FT_Face face = getFaceForChar(id);
 	if(!face)
 	{
@@ -449,7 +753,7 @@ Font::Glyph* Font::getGlyph(UnicodeChar id)
 
 	FT_GlyphSlot g = face->glyph;
 
-	if(FT_Load_Char(face, id, FT_LOAD_RENDER))
+	if(!loadGlyphBitmap(face, id))
 	{
 		LOG(LogError) << "Could not find glyph for character " << id << " for font " << mPath << ", size " << mSize << "!";
 		return NULL;
@@ -472,42 +776,139 @@ Font::Glyph* Font::getGlyph(UnicodeChar id)
 	Glyph& glyph = mGlyphMap[id];
 	
 	glyph.texture = tex;
+	glyph.generation = tex->generation;
+	tex->lastUsed = ++sUseCounter;
 	glyph.texPos << cursor.x() / (float)tex->textureSize.x(), cursor.y() / (float)tex->textureSize.y();
 	glyph.texSize << glyphSize.x() / (float)tex->textureSize.x(), glyphSize.y() / (float)tex->textureSize.y();
+	glyph.size << (float)glyphSize.x(), (float)glyphSize.y();
 
 	glyph.advance << (float)g->metrics.horiAdvance / 64.0f, (float)g->metrics.vertAdvance / 64.0f;
-	glyph.bearing << (float)g->metrics.horiBearingX / 64.0f, (float)g->metrics.horiBearingY / 64.0f;
+	if(mDistanceField)
+		glyph.bearing << (float)g->bitmap_left, (float)g->bitmap_top; // where the padded bitmap starts
+	else
+		glyph.bearing << (float)g->metrics.horiBearingX / 64.0f, (float)g->metrics.horiBearingY / 64.0f;
+
+	GlyphStaging* stage = NULL;
+	if(staging != NULL)
+	{
+		auto found = staging->find(tex);
+		if(found == staging->end() || found->second.generation != tex->generation)
+		{
+			// created or cleared during this batch, so all of it is ours
+			GlyphStaging& fresh = (*staging)[tex];
+			fresh.generation = tex->generation;
+			fresh.startY = 0;
+			fresh.endY = 0;
+			fresh.pixels.clear();
+			stage = &fresh;
+		}else if(cursor.y() >= found->second.startY)
+		{
+			stage = &found->second;
+		}
+	}
+
+	if(stage != NULL)
+	{
+		// copy into the staging rows, preloadGlyphs uploads them when the batch is done
+		const int width = tex->textureSize.x();
+		const size_t needed = (cursor.y() + glyphSize.y() - stage->startY) * width;
+		if(stage->pixels.size() < needed)
+			stage->pixels.resize(needed, 0);
+
+		for(int row = 0; row < glyphSize.y(); row++)
+			memcpy(&stage->pixels[(cursor.y() - stage->startY + row) * width + cursor.x()], g->bitmap.buffer + row * g->bitmap.pitch, glyphSize.x());
+
+		stage->endY = std::max(stage->endY, cursor.y() + glyphSize.y());
+	}else{
+		// upload glyph bitmap to texture
+		Renderer::bindTexture(tex->textureId);
+		Renderer::texSubImage2D(cursor.x(), cursor.y(), glyphSize.x(), glyphSize.y(), GL_ALPHA, g->bitmap.buffer);
+		Renderer::bindTexture(0);
+	}
 
-	// upload glyph bitmap to texture
-	glBindTexture(GL_TEXTURE_2D, tex->textureId);
-	glTexSubImage2D(GL_TEXTURE_2D, 0, cursor.x(), cursor.y(), glyphSize.x(), glyphSize.y(), GL_ALPHA, GL_UNSIGNED_BYTE, g->bitmap.buffer);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	// update max glyph height (not counting a distance field's padding)
+	const int height = mDistanceField ? (int)((g->metrics.height + 63) / 64) : glyphSize.y();
+	if(height > mMaxGlyphHeight)
+		mMaxGlyphHeight = height;
 
-	// update max glyph height
-	if(glyphSize.y() > mMaxGlyphHeight)
-		mMaxGlyphHeight = glyphSize.y();
+	if(id < GLYPH_TABLE_SIZE)
+		mGlyphTable[id] = &glyph;
 
 	// done
 	return &glyph;
 }
 
+void Font::preloadGlyphs(const std::vector<UnicodeChar>& chars)
+{
+	// the atlas makes (and batches) them, we just copy
+	if(mAtlas)
+		mAtlas->preloadGlyphs(chars);
+
+	// anything below each texture's current shelves is untouched, so glyphs put there can be staged
+	std::map<FontTexture*, GlyphStaging> staging;
+	for(auto it = mTextures.begin(); it != mTextures.end(); it++)
+	{
+		GlyphStaging& stage = staging[it->get()];
+		stage.generation = (*it)->generation;
+		stage.startY = (*it)->shelvesHeight;
+		stage.endY = stage.startY;
+	}
+
+	unsigned int created = 0;
+	for(auto it = chars.begin(); it != chars.end(); it++)
+	{
+		const UnicodeChar id = *it;
+		if(id == 0 || id == (UnicodeChar)'\n')
+			continue;
+
+		auto found = mGlyphMap.find(id);
+		if(found != mGlyphMap.end() && found->second.generation == found->second.texture->generation)
+			continue;
+
+		if(createGlyph(id, &staging) != NULL)
+			created++;
+	}
+
+	for(auto it = staging.begin(); it != staging.end(); it++)
+	{
+		const GlyphStaging& stage = it->second;
+		if(stage.endY <= stage.startY || stage.generation != it->first->generation)
+			continue;
+
+		Renderer::bindTexture(it->first->textureId);
+		Renderer::texSubImage2D(0, stage.startY, it->first->textureSize.x(), stage.endY - stage.startY, GL_ALPHA, stage.pixels.data());
+	}
+	Renderer::bindTexture(0);
+
+	if(created)
+		LOG(LogDebug) << "Preloaded " << created << " glyphs for font " << mPath << ", size " << mSize;
+}
+
 // completely recreate the texture data for all textures based on mGlyphs information
 void Font::rebuildTextures()
 {
+	// our glyphs are on the atlas's textures, it rebuilds those itself
+	if(mAtlas)
+		return;
+
 	// recreate OpenGL textures
 	for(auto it = mTextures.begin(); it != mTextures.end(); it++)
 	{
-		it->initTexture();
+		(*it)->initTexture();
 	}
 
 	// reupload the texture data
 	for(auto it = mGlyphMap.begin(); it != mGlyphMap.end(); it++)
 	{
 		FT_Face face = getFaceForChar(it->first);
+		if(!face)
+			continue;
+
 		FT_GlyphSlot glyphSlot = face->glyph;
 
 		// load the glyph bitmap through FT
-		FT_Load_Char(face, it->first, FT_LOAD_RENDER);
+		if(!loadGlyphBitmap(face, it->first))
+			continue;
 
 		FontTexture* tex = it->second.texture;
 		
@@ -516,11 +917,24 @@ void Font::rebuildTextures()
 		Eigen::Vector2i glyphSize(it->second.texSize.x() * tex->textureSize.x(), it->second.texSize.y() * tex->textureSize.y());
 		
 		// upload to texture
-		glBindTexture(GL_TEXTURE_2D, tex->textureId);
-		glTexSubImage2D(GL_TEXTURE_2D, 0, cursor.x(), cursor.y(), glyphSize.x(), glyphSize.y(), GL_ALPHA, GL_UNSIGNED_BYTE, glyphSlot->bitmap.buffer);
+		Renderer::bindTexture(tex->textureId);
+		Renderer::texSubImage2D(cursor.x(), cursor.y(), glyphSize.x(), glyphSize.y(), GL_ALPHA, glyphSlot->bitmap.buffer);
 	}
 
-	glBindTexture(GL_TEXTURE_2D, 0);
+	Renderer::bindTexture(0);
+}
+
+void Font::refreshTextCache(TextCache* cache)
+{
+	// some of its glyphs were evicted since it was built
+	for(auto it = cache->vertexLists.begin(); it != cache->vertexLists.end(); it++)
+	{
+		if(it->texture->generation != it->generation)
+		{
+			buildTextCacheVertices(cache);
+			return;
+		}
+	}
 }
 
 void Font::renderTextCache(TextCache* cache)
@@ -531,38 +945,168 @@ void Font::renderTextCache(TextCache* cache)
 		return;
 	}
 
+	refreshTextCache(cache);
+	drawTextCacheLines(cache, 0, cache->lineCount);
+}
+
+void Font::renderTextCache(TextCache* cache, const Eigen::Affine3f& trans)
+{
+	if(cache == NULL)
+	{
+		LOG(LogError) << "Attempted to draw NULL TextCache!";
+		return;
+	}
+
+	Renderer::setMatrix(trans);
+	refreshTextCache(cache);
+
+	// the clip rect's corners in the cache's coordinates, which lines they span (one extra on each side for glyphs that
+	// reach outside their line)
+	const Eigen::Vector4i clip = Renderer::getClipRect();
+	const Eigen::Affine3f inverse = trans.inverse();
+	float top = FLT_MAX;
+	float bottom = -FLT_MAX;
+	for(int corner = 0; corner < 4; corner++)
+	{
+		const Eigen::Vector3f pos = inverse * Eigen::Vector3f((float)(clip[0] + (corner & 1 ? clip[2] : 0)), (float)(clip[1] + (corner & 2 ? clip[3] : 0)), 0);
+		top = std::min(top, pos.y());
+		bottom = std::max(bottom, pos.y());
+	}
+
+	if(cache->lineHeight <= 0)
+	{
+		drawTextCacheLines(cache, 0, cache->lineCount);
+		return;
+	}
+
+	const float first = std::floor((top - cache->offset.y()) / cache->lineHeight) - 1;
+	const float last = std::ceil((bottom - cache->offset.y()) / cache->lineHeight) + 1;
+	if(last < 0 || first >= (float)cache->lineCount)
+		return;
+
+	const unsigned int start = first < 0 ? 0 : (unsigned int)first;
+	const unsigned int end = last > (float)cache->lineCount ? cache->lineCount : (unsigned int)last;
+	drawTextCacheLines(cache, start, end);
+}
+
+void Font::drawTextCacheLines(TextCache* cache, unsigned int firstLine, unsigned int endLine)
+{
+	GpuProfiler::Scope gpuScope(GpuProfiler::SECTION_TEXT);
+
 	for(auto it = cache->vertexLists.begin(); it != cache->vertexLists.end(); it++)
 	{
-		assert(*it->textureIdPtr != 0);
+		assert(it->texture->textureId != 0);
+
+		const unsigned int first = it->lineStarts[firstLine];
+		const unsigned int count = it->lineStarts[endLine] - first;
+		if(count == 0)
+			continue;
 
-		auto vertexList = *it;
+		it->texture->lastUsed = ++sUseCounter;
 
-		glBindTexture(GL_TEXTURE_2D, *it->textureIdPtr);
-		glEnable(GL_TEXTURE_2D);
-		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		Renderer::bindTexture(it->texture->textureId);
+		Renderer::setTextureEnabled(true, true, mDistanceField);
+		Renderer::setBlendEnabled(true);
+		Renderer::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		Renderer::setClientArrays(true, true, true);
 
-		glEnableClientState(GL_VERTEX_ARRAY);
-		glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-		glEnableClientState(GL_COLOR_ARRAY);
+		const char* base = it->vertexBuffer.use(it->verts.data(), it->verts.size() * sizeof(TextCache::Vertex));
+		Renderer::vertexPointer(2, GL_FLOAT, sizeof(TextCache::Vertex), base + offsetof(TextCache::Vertex, pos));
+		Renderer::texCoordPointer(2, GL_FLOAT, sizeof(TextCache::Vertex), base + offsetof(TextCache::Vertex, tex));
 
-		glVertexPointer(2, GL_FLOAT, sizeof(TextCache::Vertex), it->verts[0].pos.data());
-		glTexCoordPointer(2, GL_FLOAT, sizeof(TextCache::Vertex), it->verts[0].tex.data());
-		glColorPointer(4, GL_UNSIGNED_BYTE, 0, it->colors.data());
+		Renderer::useClientArrays();
+		Renderer::colorPointer(4, GL_UNSIGNED_BYTE, 0, it->colors.data());
 
-		glDrawArrays(GL_TRIANGLES, 0, it->verts.size());
+		Renderer::drawArrays(GL_TRIANGLES, first, count);
+	}
+}
+
+void Font::queueTextCache(TextCache* cache, const Eigen::Affine3f& trans)
+{
+	if(cache == NULL)
+	{
+		LOG(LogError) << "Attempted to queue NULL TextCache!";
+		return;
+	}
 
-		glDisableClientState(GL_VERTEX_ARRAY);
-		glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-		glDisableClientState(GL_COLOR_ARRAY);
+	refreshTextCache(cache);
 
-		glDisable(GL_TEXTURE_2D);
-		glDisable(GL_BLEND);
+	for(auto it = cache->vertexLists.begin(); it != cache->vertexLists.end(); it++)
+	{
+		it->texture->lastUsed = ++sUseCounter;
+
+		TextBatch& batch = mTextBatches[it->texture];
+
+		// the texture was cleared for newer glyphs since these were queued, they'd come out as garbage
+		if(batch.generation != it->texture->generation)
+		{
+			batch.generation = it->texture->generation;
+			batch.vertices.clear();
+		}
+
+		const size_t start = batch.vertices.size();
+		batch.vertices.resize(start + it->verts.size());
+		for(size_t i = 0; i < it->verts.size(); i++)
+		{
+			TextBatch::Vertex& vertex = batch.vertices[start + i];
+			const Eigen::Vector3f pos = trans * Eigen::Vector3f(it->verts[i].pos.x(), it->verts[i].pos.y(), 0);
+			vertex.pos << pos.x(), pos.y();
+			vertex.tex = it->verts[i].tex;
+			memcpy(vertex.color, &it->colors[i * 4], 4);
+		}
 	}
 }
 
-Eigen::Vector2f Font::sizeText(std::string text, float lineSpacing)
+void Font::flushTextBatch()
 {
+	bool begun = false;
+	for(auto it = mTextBatches.begin(); it != mTextBatches.end(); it++)
+	{
+		TextBatch& batch = it->second;
+		if(batch.vertices.empty())
+			continue;
+
+		if(it->first->textureId != 0)
+		{
+			if(!begun)
+			{
+				// vertices are already transformed
+				Eigen::Affine3f identity = Eigen::Affine3f::Identity();
+				Renderer::setMatrix(identity);
+
+				Renderer::setTextureEnabled(true, true, mDistanceField);
+				Renderer::setBlendEnabled(true);
+				Renderer::setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+				Renderer::setClientArrays(true, true, true);
+				begun = true;
+			}
+
+			Renderer::bindTexture(it->first->textureId);
+
+			// different every frame
+			const GLsizei stride = sizeof(TextBatch::Vertex);
+			const char* base = Renderer::streamVertices(batch.vertices.data(), batch.vertices.size() * stride);
+			Renderer::vertexPointer(2, GL_FLOAT, stride, base + offsetof(TextBatch::Vertex, pos));
+			Renderer::texCoordPointer(2, GL_FLOAT, stride, base + offsetof(TextBatch::Vertex, tex));
+			Renderer::colorPointer(4, GL_UNSIGNED_BYTE, stride, base + offsetof(TextBatch::Vertex, color));
+
+			Renderer::drawArrays(GL_TRIANGLES, 0, (GLsizei)batch.vertices.size());
+		}
+
+		// keeps the capacity for the next frame
+		batch.vertices.clear();
+	}
+}
+
+Eigen::Vector2f Font::sizeText(const std::string& text, float lineSpacing)
+{
+	return sizeText(text.data(), text.length(), lineSpacing);
+}
+
+Eigen::Vector2f Font::sizeText(const char* str, size_t length, float lineSpacing)
+{
+	ALLOC_SCOPE("sizeText");
+
 	float lineWidth = 0.0f;
 	float highestWidth = 0.0f;
 
@@ -571,20 +1115,30 @@ Eigen::Vector2f Font::sizeText(std::string text, float lineSpacing)
 	float y = lineHeight;
 
 	size_t i = 0;
-	while(i < text.length())
+	while(i < length)
 	{
-		UnicodeChar character = readUnicodeChar(text, i); // advances i
-
-		if(character == (UnicodeChar)'\n')
+		// a run of ASCII goes straight to the glyph table, only what's after it gets decoded
+		const size_t runEnd = i + getAsciiRunLength(str + i, length - i);
+		for(; i < runEnd; i++)
 		{
-			if(lineWidth > highestWidth)
-				highestWidth = lineWidth;
-
-			lineWidth = 0.0f;
-			y += lineHeight;
+			if(str[i] == '\n')
+			{
+				if(lineWidth > highestWidth)
+					highestWidth = lineWidth;
+
+				lineWidth = 0.0f;
+				y += lineHeight;
+			}
+
+			Glyph* glyph = getAsciiGlyph(str[i]);
+			if(glyph)
+				lineWidth += glyph->advance.x();
 		}
 
-		Glyph* glyph = getGlyph(character);
+		if(i >= length)
+			break;
+
+		Glyph* glyph = getGlyph(readUnicodeChar(str, i)); // advances i
 		if(glyph)
 			lineWidth += glyph->advance.x();
 	}
@@ -604,60 +1158,95 @@ float Font::getLetterHeight()
 {
 	Glyph* glyph = getGlyph((UnicodeChar)'S');
 	assert(glyph);
-	return glyph->texSize.y() * glyph->texture->textureSize.y();
+	return glyph->size.y() - mGlyphPadding * 2;
 }
 
 //the worst algorithm ever written
 //breaks up a normal string with newlines to make it fit xLen
-std::string Font::wrapText(std::string text, float xLen)
+std::string Font::wrapText(const std::string& text, float xLen)
 {
-	std::string out;
-
-	std::string line, word, temp;
-	size_t space;
+	return getWrappedText(text, xLen).wrapped;
+}
 
-	Eigen::Vector2f textSize;
+void Font::wrapText(const std::string& text, float xLen, std::string& out)
+{
+	out.assign(getWrappedText(text, xLen).wrapped);
+}
 
-	while(text.length() > 0) //while there's text or we still have text to render
+Font::WrappedText& Font::getWrappedText(const std::string& text, float xLen)
+{
+	// glyph metrics never change for a font, so neither does where its lines break
+	const size_t hash = std::hash<std::string>()(text);
+	for(auto it = mWrapCache.begin(); it != mWrapCache.end(); it++)
 	{
-		space = text.find_first_of(" \t\n");
-		if(space == std::string::npos)
-			space = text.length() - 1;
+		if(it->hash == hash && it->xLen == xLen && it->text == text)
+		{
+			mWrapCache.splice(mWrapCache.begin(), mWrapCache, it);
+			return mWrapCache.front();
+		}
+	}
 
-		word = text.substr(0, space + 1);
-		text.erase(0, space + 1);
+	// once the cache is full a miss takes over the least recently used entry, strings and all, so their memory is reused
+	if(mWrapCache.size() >= FONT_WRAP_CACHE_SIZE)
+		mWrapCache.splice(mWrapCache.begin(), mWrapCache, --mWrapCache.end());
+	else
+		mWrapCache.push_front(WrappedText());
 
-		temp = line + word;
+	WrappedText& entry = mWrapCache.front();
+	entry.hash = hash;
+	entry.text.assign(text);
+	entry.xLen = xLen;
+	wrapTextUncached(text, xLen, entry.wrapped);
+	entry.lineSpacing = -1.0f;
+	entry.size = Eigen::Vector2f::Zero();
 
-		textSize = sizeText(temp);
+	return entry;
+}
 
-		// if the word will fit on the line, add it to our line, and continue
-		if(textSize.x() <= xLen)
+void Font::wrapTextUncached(const std::string& text, float xLen, std::string& out)
+{
+	out.clear();
+
+	// the line so far is always text[lineStart, wordStart), so it's measured where it is instead of being copied out word by word
+	const char* str = text.data();
+	size_t lineStart = 0;
+	size_t wordStart = 0;
+	while(wordStart < text.length())
+	{
+		// a word keeps the delimiter after it, the last one is whatever's left
+		size_t wordEnd = text.find_first_of(" \t\n", wordStart);
+		wordEnd = (wordEnd == std::string::npos) ? text.length() : wordEnd + 1;
+
+		// if the word won't fit on the line, break before it
+		if(sizeText(str + lineStart, wordEnd - lineStart).x() > xLen)
 		{
-			line = temp;
-			continue;
-		}else{
-			// the next word won't fit, so break here
-			out += line + '\n';
-			line = word;
+			out.append(str + lineStart, wordStart - lineStart);
+			out += '\n';
+			lineStart = wordStart;
 		}
+
+		wordStart = wordEnd;
 	}
 
 	// whatever's left should fit
-	out += line;
-
-	return out;
+	out.append(str + lineStart, text.length() - lineStart);
 }
 
-Eigen::Vector2f Font::sizeWrappedText(std::string text, float xLen, float lineSpacing)
+Eigen::Vector2f Font::sizeWrappedText(const std::string& text, float xLen, float lineSpacing)
 {
-	text = wrapText(text, xLen);
-	return sizeText(text, lineSpacing);
+	WrappedText& entry = getWrappedText(text, xLen);
+	if(entry.lineSpacing != lineSpacing)
+	{
+		entry.size = sizeText(entry.wrapped, lineSpacing);
+		entry.lineSpacing = lineSpacing;
+	}
+
+	return entry.size;
 }
 
-Eigen::Vector2f Font::getWrappedTextCursorOffset(std::string text, float xLen, size_t stop, float lineSpacing)
+Eigen::Vector2f Font::getWrappedTextCursorOffset(const std::string& text, float xLen, size_t stop, float lineSpacing)
 {
-	std::string wrappedText = wrapText(text, xLen);
+	const std::string& wrappedText = getWrappedText(text, xLen).wrapped;
 
 	float lineWidth = 0.0f;
 	float y = 0.0f;
@@ -706,14 +1295,15 @@ float Font::getNewlineStartOffset(const std::string& text, const unsigned int& c
 	case ALIGN_LEFT:
 		return 0;
 	case ALIGN_CENTER:
-		{
-			unsigned int endChar = text.find('\n', charStart);
-			return (xLen - sizeText(text.substr(charStart, endChar != std::string::npos ? endChar - charStart : endChar)).x()) / 2.0f;
-		}
 	case ALIGN_RIGHT:
 		{
-			unsigned int endChar = text.find('\n', charStart);
-			return xLen - (sizeText(text.substr(charStart, endChar != std::string::npos ? endChar - charStart : endChar)).x());
+			// measured in place, this runs for every line of every text cache built
+			size_t endChar = text.find('\n', charStart);
+			if(endChar == std::string::npos)
+				endChar = text.length();
+
+			const float lineWidth = sizeText(text.data() + charStart, endChar - charStart).x();
+			return alignment == ALIGN_CENTER ? (xLen - lineWidth) / 2.0f : xLen - lineWidth;
 		}
 	default:
 		return 0;
@@ -727,21 +1317,70 @@ inline float font_round(float v)
 
 TextCache* Font::buildTextCache(const std::string& text, Eigen::Vector2f offset, unsigned int color, float xLen, Alignment alignment, float lineSpacing)
 {
+	ALLOC_SCOPE("buildTextCache");
+
+	TextCache* cache = new TextCache();
+	cache->text = text;
+	cache->offset = offset;
+	cache->color = color;
+	cache->xLen = xLen;
+	cache->alignment = alignment;
+	cache->lineSpacing = lineSpacing;
+
+	buildTextCacheVertices(cache);
+	return cache;
+}
+
+void Font::rebuildTextCache(TextCache* cache, const std::string& text, float offsetX, float offsetY, unsigned int color)
+{
+	ALLOC_SCOPE("rebuildTextCache");
+
+	cache->text = text; // keeps the string's buffer if it's big enough
+	cache->offset << offsetX, offsetY;
+	cache->color = color;
+	cache->xLen = 0.0f;
+	cache->alignment = ALIGN_LEFT;
+	cache->lineSpacing = 1.5f;
+
+	buildTextCacheVertices(cache);
+}
+
+void Font::buildTextCacheVertices(TextCache* cache)
+{
+	const std::string& text = cache->text;
+	const Eigen::Vector2f& offset = cache->offset;
+	const float xLen = cache->xLen;
+	const Alignment alignment = cache->alignment;
+	const float lineSpacing = cache->lineSpacing;
+
 	float x = offset[0] + (xLen != 0 ? getNewlineStartOffset(text, 0, xLen, alignment) : 0);
 	
 	float yTop = getGlyph((UnicodeChar)'S')->bearing.y();
 	float yBot = getHeight(lineSpacing);
 	float y = offset[1] + (yBot + yTop)/2.0f;
 
-	// vertices by texture
-	std::map< FontTexture*, std::vector<TextCache::Vertex> > vertMap;
+	// vertices go straight into the cache's lists (one per texture), which keep their capacity from the last build
+	// each list has the texture's generation from when its first vertex was added
+	// (if it's cleared for more glyphs halfway through, the cache gets rebuilt the next time it's drawn)
+	std::vector<TextCache::VertexList>& lists = cache->vertexLists;
+	size_t listCount = 0;
+	unsigned int line = 0;
 
+	const char* str = text.data();
+	const size_t length = text.length();
+	size_t asciiEnd = 0; // everything from cursor up to here is one byte characters
 	size_t cursor = 0;
 	UnicodeChar character;
 	Glyph* glyph;
-	while(cursor < text.length())
+	while(cursor < length)
 	{
-		character = readUnicodeChar(text, cursor); // also advances cursor
+		if(cursor >= asciiEnd)
+			asciiEnd = cursor + getAsciiRunLength(str + cursor, length - cursor);
+
+		if(cursor < asciiEnd)
+			character = (UnicodeChar)str[cursor++];
+		else
+			character = readUnicodeChar(text, cursor); // also advances cursor
 
 		// invalid character
 		if(character == 0)
@@ -751,26 +1390,48 @@ TextCache* Font::buildTextCache(const std::string& text, Eigen::Vector2f offset,
 		{
 			y += getHeight(lineSpacing);
 			x = offset[0] + (xLen != 0 ? getNewlineStartOffset(text, cursor /* cursor is already advanced */, xLen, alignment) : 0);
+			line++;
 			continue;
 		}
 
-		glyph = getGlyph(character);
+		glyph = character < 0x80 ? getAsciiGlyph((char)character) : getGlyph(character);
 		if(glyph == NULL)
 			continue;
 
-		std::vector<TextCache::Vertex>& verts = vertMap[glyph->texture];
+		// there's only a handful of textures, a linear search is fine
+		size_t list = 0;
+		while(list < listCount && lists[list].texture != glyph->texture)
+			list++;
+
+		if(list == listCount)
+		{
+			if(listCount == lists.size())
+				lists.push_back(TextCache::VertexList());
+
+			lists[list].texture = glyph->texture;
+			lists[list].generation = glyph->texture->generation;
+			lists[list].verts.clear();
+			lists[list].lineStarts.clear();
+			listCount++;
+		}
+
+		std::vector<TextCache::Vertex>& verts = lists[list].verts;
 		size_t oldVertSize = verts.size();
+
+		// lines since this list's last glyph start (and, if they had none of its glyphs, end) here
+		std::vector<unsigned int>& lineStarts = lists[list].lineStarts;
+		while(lineStarts.size() <= line)
+			lineStarts.push_back(oldVertSize);
+
 		verts.resize(oldVertSize + 6);
 		TextCache::Vertex* tri = verts.data() + oldVertSize;
 
 		const float glyphStartX = x + glyph->bearing.x();
 
-		const Eigen::Vector2i& textureSize = glyph->texture->textureSize;
-
 		// triangle 1
 		// round to fix some weird "cut off" text bugs
-		tri[0].pos << font_round(glyphStartX), font_round(y + (glyph->texSize.y() * textureSize.y() - glyph->bearing.y()));
-		tri[1].pos << font_round(glyphStartX + glyph->texSize.x() * textureSize.x()), font_round(y - glyph->bearing.y());
+		tri[0].pos << font_round(glyphStartX), font_round(y + (glyph->size.y() - glyph->bearing.y()));
+		tri[1].pos << font_round(glyphStartX + glyph->size.x()), font_round(y - glyph->bearing.y());
 		tri[2].pos << tri[0].pos.x(), tri[1].pos.y();
 
 		//tri[0].tex << 0, 0;
@@ -796,25 +1457,28 @@ TextCache* Font::buildTextCache(const std::string& text, Eigen::Vector2f offset,
 
 	//TextCache::CacheMetrics metrics = { sizeText(text, lineSpacing) };
 
-	TextCache* cache = new TextCache();
-	cache->vertexLists.resize(vertMap.size());
+	// textures the last build used but this one doesn't
+	if(lists.size() > listCount)
+		lists.erase(lists.begin() + listCount, lists.end());
+
 	cache->metrics = { sizeText(text, lineSpacing) };
+	cache->lineCount = line + 1;
+	cache->lineHeight = getHeight(lineSpacing);
 
-	unsigned int i = 0;
-	for(auto it = vertMap.begin(); it != vertMap.end(); it++)
+	size_t bytes = lists.capacity() * sizeof(TextCache::VertexList) + MemoryStats::getHeapSize(text);
+	for(auto it = lists.begin(); it != lists.end(); it++)
 	{
-		TextCache::VertexList& vertList = cache->vertexLists.at(i);
-
-		vertList.textureIdPtr = &it->first->textureId;
-		vertList.verts = it->second;
-
-		vertList.colors.resize(4 * it->second.size());
-		Renderer::buildGLColorArray(vertList.colors.data(), color, it->second.size());
+		while(it->lineStarts.size() <= cache->lineCount)
+			it->lineStarts.push_back(it->verts.size());
+		bytes += it->lineStarts.capacity() * sizeof(unsigned int);
+
+		it->vertexBuffer.markDirty();
+		it->colors.resize(4 * it->verts.size());
+		Renderer::buildGLColorArray(it->colors.data(), cache->color, it->verts.size());
+		bytes += it->verts.capacity() * sizeof(TextCache::Vertex) + it->colors.capacity();
 	}
-
-	clearFaceCache();
-
-	return cache;
+	MemoryStats::add(MemoryStats::TEXT_CACHE, (ptrdiff_t)bytes - (ptrdiff_t)cache->memoryUsage);
+	cache->memoryUsage = bytes;
 }
 
 TextCache* Font::buildTextCache(const std::string& text, float offsetX, float offsetY, unsigned int color)
@@ -822,8 +1486,18 @@ TextCache* Font::buildTextCache(const std::string& text, float offsetX, float of
 	return buildTextCache(text, Eigen::Vector2f(offsetX, offsetY), color, 0.0f);
 }
 
+TextCache::TextCache() : lineCount(0), lineHeight(0), memoryUsage(0)
+{
+}
+
+TextCache::~TextCache()
+{
+	MemoryStats::add(MemoryStats::TEXT_CACHE, -(ptrdiff_t)memoryUsage);
+}
+
 void TextCache::setColor(unsigned int color)
 {
+	this->color = color;
 	for(auto it = vertexLists.begin(); it != vertexLists.end(); it++)
 		Renderer::buildGLColorArray(it->colors.data(), color, it->verts.size());
 }
@@ -839,10 +1513,10 @@ std::shared_ptr<Font> Font::getFromTheme(const ThemeData::ThemeElement* elem, un
 	std::string path = (orig ? orig->mPath : getDefaultPath());
 
 	float sh = (float)Renderer::getScreenHeight();
-	if(properties & FONT_SIZE && elem->has("fontSize")) 
-		size = (int)(sh * elem->get<float>("fontSize"));
-	if(properties & FONT_PATH && elem->has("fontPath"))
-		path = elem->get<std::string>("fontPath");
+	if(properties & FONT_SIZE && elem->has(ThemeProperties::FONT_SIZE)) 
+		size = (int)(sh * elem->get<float>(ThemeProperties::FONT_SIZE));
+	if(properties & FONT_PATH && elem->has(ThemeProperties::FONT_PATH))
+		path = elem->get<std::string>(ThemeProperties::FONT_PATH);
 
 	return get(size, path);
 }
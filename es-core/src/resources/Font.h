@@ -1,12 +1,16 @@
 #pragma once
 
 #include <string>
+#include <list>
+#include <bitset>
+#include <unordered_map>
 #include "platform.h"
 #include GLHEADER
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #include <Eigen/Dense>
 #include "resources/ResourceManager.h"
+#include "Renderer.h"
 #include "ThemeData.h"
 
 class TextCache;
@@ -38,14 +42,30 @@ public:
 
 	virtual ~Font();
 
-	Eigen::Vector2f sizeText(std::string text, float lineSpacing = 1.5f); // Returns the expected size of a string when rendered.  Extra spacing is applied to the Y axis.
+	Eigen::Vector2f sizeText(const std::string& text, float lineSpacing = 1.5f); // Returns the expected size of a string when rendered.  Extra spacing is applied to the Y axis.
+	Eigen::Vector2f sizeText(const char* text, size_t length, float lineSpacing = 1.5f); // The same for the length bytes at text (e.g. the start of a longer string), without copying them out.
 	TextCache* buildTextCache(const std::string& text, float offsetX, float offsetY, unsigned int color);
 	TextCache* buildTextCache(const std::string& text, Eigen::Vector2f offset, unsigned int color, float xLen, Alignment alignment = ALIGN_LEFT, float lineSpacing = 1.5f);
+	// As buildTextCache, but into an existing cache (built by this font), reusing its memory - no allocations once it's big enough.
+	void rebuildTextCache(TextCache* cache, const std::string& text, float offsetX, float offsetY, unsigned int color);
 	void renderTextCache(TextCache* cache);
+	// Sets the matrix to trans and only draws the lines that are inside the clip rect, so a long text scrolled
+	// behind a small clip costs about as much as the lines that show.
+	void renderTextCache(TextCache* cache, const Eigen::Affine3f& trans);
+
+	// For drawing many TextCaches at once (e.g. the rows of a list): queueTextCache transforms cache's vertices by trans
+	// on the CPU and holds on to them, flushTextBatch then draws everything queued with one call per glyph texture.
+	void queueTextCache(TextCache* cache, const Eigen::Affine3f& trans);
+	void flushTextBatch();
+
+	// Rasterizes whichever of chars aren't loaded yet, so they don't have to be made mid-scroll.
+	// Glyphs that land on new shelves are uploaded together, one glTexSubImage2D per texture.
+	void preloadGlyphs(const std::vector<UnicodeChar>& chars);
 	
-	std::string wrapText(std::string text, float xLen); // Inserts newlines into text to make it wrap properly.
-	Eigen::Vector2f sizeWrappedText(std::string text, float xLen, float lineSpacing = 1.5f); // Returns the expected size of a string after wrapping is applied.
-	Eigen::Vector2f getWrappedTextCursorOffset(std::string text, float xLen, size_t cursor, float lineSpacing = 1.5f); // Returns the position of of the cursor after moving "cursor" characters.
+	std::string wrapText(const std::string& text, float xLen); // Inserts newlines into text to make it wrap properly.
+	void wrapText(const std::string& text, float xLen, std::string& out); // The same into out, reusing its memory - no allocations once it's big enough.
+	Eigen::Vector2f sizeWrappedText(const std::string& text, float xLen, float lineSpacing = 1.5f); // Returns the expected size of a string after wrapping is applied.
+	Eigen::Vector2f getWrappedTextCursorOffset(const std::string& text, float xLen, size_t cursor, float lineSpacing = 1.5f); // Returns the position of of the cursor after moving "cursor" characters.
 
 	float getHeight(float lineSpacing = 1.5f) const;
 	float getLetterHeight();
@@ -62,17 +82,24 @@ public:
 
 	size_t getMemUsage() const; // returns an approximation of VRAM used by this font's texture (in bytes)
 	static size_t getTotalMemUsage(); // returns an approximation of total VRAM used by font textures (in bytes)
+	static void logLiveFonts(); // every live font and what it uses, see TextureResource::logLiveTextures()
 
 	// utf8 stuff
 	static size_t getNextCursor(const std::string& str, size_t cursor);
 	static size_t getPrevCursor(const std::string& str, size_t cursor);
 	static size_t moveCursor(const std::string& str, size_t cursor, int moveAmt); // negative moveAmt = move backwards, positive = move forwards
 	static UnicodeChar readUnicodeChar(const std::string& str, size_t& cursor); // reads unicode character at cursor AND moves cursor to the next valid unicode char
+	static UnicodeChar readUnicodeChar(const char* str, size_t& cursor);
+	static size_t getAsciiRunLength(const char* str, size_t length); // how many bytes from str on are one byte characters
 
 private:
 	static FT_Library sLibrary;
 	static std::map< std::pair<std::string, int>, std::weak_ptr<Font> > sFontMap;
 
+	// running totals for getTotalMemUsage(), kept by the FontTexture and FontFile constructors and destructors
+	static size_t sTextureMemUsage;
+	static size_t sFileMemUsage;
+
 	Font(int size, const std::string& path);
 
 	struct FontTexture
@@ -80,36 +107,81 @@ private:
 		GLuint textureId;
 		Eigen::Vector2i textureSize;
 
-		Eigen::Vector2i writePos;
-		int rowHeight;
+		// glyphs are packed left to right on shelves, each about as tall as the glyphs on it
+		struct Shelf
+		{
+			int y;
+			int height;
+			int writeX;
+		};
+		std::vector<Shelf> shelves;
+		int shelvesHeight; // where the next shelf goes
+
+		unsigned int generation; // bumped when the texture is cleared for new glyphs, TextCaches using it are rebuilt
+		unsigned int lastUsed; // sUseCounter when a glyph on it was last used
+		bool smooth; // linear filtering, for distance fields
 
 		FontTexture();
 		~FontTexture();
 		bool findEmpty(const Eigen::Vector2i& size, Eigen::Vector2i& cursor_out);
+		void clear(); // forgets where glyphs are, everything is free space again
 
 		// you must call initTexture() after creating a FontTexture to get a textureId
 		void initTexture(); // initializes the OpenGL texture according to this FontTexture's settings, updating textureId
 		void deinitTexture(); // deinitializes the OpenGL texture if any exists, is automatically called in the destructor
 	};
 
-	struct FontFace
+	// Each font file is read and opened once for the whole process, every Font using it shares the face
+	// (and the file's data, which FreeType reads from) and only adds an FT_Size of its own.
+	struct FontFile
 	{
 		const ResourceData data;
-		FT_Face face;
+		const std::string path;
+		FT_Face face; // NULL if the file couldn't be opened
+
+		FontFile(const ResourceData& d, const std::string& path);
+		~FontFile();
+	};
+
+	static std::map< std::string, std::weak_ptr<FontFile> > sFontFiles;
+	static std::shared_ptr<FontFile> getFontFile(const std::string& path);
+
+	// a font file at our size
+	struct FontFace
+	{
+		const std::shared_ptr<FontFile> file;
+		FT_Size size;
 
-		FontFace(ResourceData&& d, int size);
-		virtual ~FontFace();
+		FontFace(const std::shared_ptr<FontFile>& f, int pixelSize);
+		~FontFace();
 	};
 
 	void rebuildTextures();
 	void unloadTextures();
 
-	std::vector<FontTexture> mTextures;
+	// owned through pointers so glyphs and TextCaches can hold on to them
+	std::vector< std::unique_ptr<FontTexture> > mTextures;
 
+	// once a font has FONT_MAX_TEXTURES textures, the least recently used one is cleared to make room
 	void getTextureForNewGlyph(const Eigen::Vector2i& glyphSize, FontTexture*& tex_out, Eigen::Vector2i& cursor_out);
+	void evictTexture(FontTexture* tex);
 
-	std::map< unsigned int, std::unique_ptr<FontFace> > mFaceCache;
-	FT_Face getFaceForChar(UnicodeChar id);
+	static unsigned int sUseCounter; // for FontTexture::lastUsed
+
+	std::map< unsigned int, std::unique_ptr<FontFace> > mFaceCache; // 0 is mPath, then the fallbacks
+	FontFace* getFace(unsigned int i);
+	FT_Face getFaceForChar(UnicodeChar id); // with our size made the active one, load from it right away
+
+	// which codepoints a font file has glyphs for, in pages of 256
+	struct Coverage
+	{
+		std::unordered_map< UnicodeChar, std::bitset<256> > pages;
+		bool has(UnicodeChar id) const;
+	};
+
+	static const std::vector<std::string>& getFallbackFonts();
+	static const std::vector<Coverage>& getFallbackCoverage(); // same order as getFallbackFonts()
+	static int getFallbackForChar(UnicodeChar id); // index into getFallbackFonts(), -1 if none have it
 	void clearFaceCache();
 
 	struct Glyph
@@ -119,21 +191,95 @@ private:
 		Eigen::Vector2f texPos;
 		Eigen::Vector2f texSize; // in texels!
 
+		Eigen::Vector2f size; // on screen, in pixels
 		Eigen::Vector2f advance;
 		Eigen::Vector2f bearing;
+
+		unsigned int generation; // texture->generation it was put there in; copies of an atlas's glyphs go stale when it's cleared
 	};
 
 	std::map<UnicodeChar, Glyph> mGlyphMap;
 
+	// direct lookup for Basic Latin through Latin Extended-B, points into mGlyphMap (map nodes don't move)
+	static const UnicodeChar GLYPH_TABLE_SIZE = 0x250;
+	Glyph* mGlyphTable[GLYPH_TABLE_SIZE];
+
 	Glyph* getGlyph(UnicodeChar id);
 
+	// for the ASCII runs in layout loops: straight from the table if it's there and current, otherwise getGlyph()
+	inline Glyph* getAsciiGlyph(char c)
+	{
+		Glyph* glyph = mGlyphTable[(unsigned char)c];
+		if(glyph != NULL && glyph->generation == glyph->texture->generation)
+		{
+			glyph->texture->lastUsed = sUseCounter; // not bumped, still counts as the most recent use
+			return glyph;
+		}
+		return getGlyph((UnicodeChar)c);
+	}
+
+	// rows of a texture that only glyphs from the current preloadGlyphs() batch have been put on
+	struct GlyphStaging
+	{
+		unsigned int generation; // texture->generation when startY was picked
+		int startY;
+		int endY;
+		std::vector<unsigned char> pixels; // textureSize.x() wide, starting at row startY
+	};
+
+	// if staging is NULL the glyph is uploaded right away
+	Glyph* createGlyph(UnicodeChar id, std::map<FontTexture*, GlyphStaging>* staging);
+	bool loadGlyphBitmap(FT_Face face, UnicodeChar id); // into face->glyph, as a distance field if we make those
+
 	int mMaxGlyphHeight;
 	
 	const int mSize;
 	const std::string mPath;
 
+	// With "FontDistanceField" on (and a FreeType that can make them), glyphs are signed distance fields. Only the Font of
+	// FONT_SDF_SIZE for each file makes them, every other size copies its glyphs with the metrics scaled and draws them scaled.
+	static bool useDistanceFields();
+	const bool mDistanceField;
+	std::shared_ptr<Font> mAtlas; // where our glyphs really are, NULL if that's us
+	float mAtlasScale; // mSize / the atlas's size
+	float mGlyphPadding; // empty space on each side of a glyph's bitmap, in pixels at our size (distance fields spread outside the outline)
+
+	// recently wrapped strings, most recently used first (wrapping re-measures the line for every word)
+	struct WrappedText
+	{
+		size_t hash;
+		std::string text;
+		float xLen;
+		std::string wrapped;
+		float lineSpacing; // that size was measured with, negative if it hasn't been yet
+		Eigen::Vector2f size;
+	};
+	std::list<WrappedText> mWrapCache;
+	WrappedText& getWrappedText(const std::string& text, float xLen);
+	void wrapTextUncached(const std::string& text, float xLen, std::string& out);
+
 	float getNewlineStartOffset(const std::string& text, const unsigned int& charStart, const float& xLen, const Alignment& alignment);
 
+	void buildTextCacheVertices(TextCache* cache); // (re)builds the vertices for cache's text
+	void drawTextCacheLines(TextCache* cache, unsigned int firstLine, unsigned int endLine); // [firstLine, endLine) with the current matrix
+	void refreshTextCache(TextCache* cache); // rebuilds cache if any of its glyphs were evicted
+
+	// vertices queued by queueTextCache() for one texture, already transformed
+	// (interleaved, so a draw streams them once and can't have the ring buffer start over between its arrays)
+	struct TextBatch
+	{
+		struct Vertex
+		{
+			Eigen::Vector2f pos;
+			Eigen::Vector2f tex;
+			GLubyte color[4];
+		};
+
+		unsigned int generation; // texture->generation when they were queued
+		std::vector<Vertex> vertices;
+	};
+	std::map<FontTexture*, TextBatch> mTextBatches;
+
 	friend TextCache;
 };
 
@@ -152,14 +298,33 @@ protected:
 
 	struct VertexList
 	{
-		GLuint* textureIdPtr; // this is a pointer because the texture ID can change during deinit/reinit (when launching a game)
+		Font::FontTexture* texture; // its textureId can change during deinit/reinit (when launching a game)
+		unsigned int generation; // texture->generation the vertices were built for
 		std::vector<Vertex> verts;
 		std::vector<GLubyte> colors;
+		Renderer::VertexBuffer vertexBuffer; // verts, they only change when the list is rebuilt
+		std::vector<unsigned int> lineStarts; // index in verts where each line's glyphs start, and verts.size() at the end
 	};
 
 	std::vector<VertexList> vertexLists;
 
+	// what it was built from, so it can be rebuilt if glyphs it uses are evicted
+	std::string text;
+	Eigen::Vector2f offset;
+	unsigned int color;
+	float xLen;
+	Alignment alignment;
+	float lineSpacing;
+
+	unsigned int lineCount; // as laid out, each line is Font::getHeight(lineSpacing) tall starting at offset.y()
+	float lineHeight;
+
+	size_t memoryUsage; // what it was reported as to MemoryStats
+
 public:
+	TextCache();
+	~TextCache();
+
 	struct CacheMetrics
 	{
 		Eigen::Vector2f size;
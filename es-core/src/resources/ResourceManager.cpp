@@ -1,16 +1,83 @@
 #include "ResourceManager.h"
 #include "Log.h"
+#include "MemoryStats.h"
 #include "../data/Resources.h"
 #include <fstream>
+#include <mutex>
+#include <string.h>
+#include <zlib.h>
 #include <boost/filesystem.hpp>
 
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// smaller files are cheaper to just read than to map
+#define MMAP_MIN_SIZE (64 * 1024)
+
 namespace fs = boost::filesystem;
 
-auto array_deleter = [](unsigned char* p) { delete[] p; };
 auto nop_deleter = [](unsigned char* p) { };
 
+// heap buffers count towards MemoryStats::RESOURCES for as long as someone holds on to them
+static std::shared_ptr<unsigned char> allocateBuffer(size_t size)
+{
+	MemoryStats::add(MemoryStats::RESOURCES, size);
+	return std::shared_ptr<unsigned char>(new unsigned char[size], [size](unsigned char* p) {
+		MemoryStats::add(MemoryStats::RESOURCES, -(ptrdiff_t)size);
+		delete[] p;
+	});
+}
+
 std::shared_ptr<ResourceManager> ResourceManager::sInstance = nullptr;
 
+// embedded resources compressed by data/compress_resources.py start with this, then the uncompressed size (32 bit LE)
+static const unsigned char EMBEDDED_COMPRESSED_MAGIC[4] = { 'E', 'S', 'Z', '1' };
+static const size_t EMBEDDED_COMPRESSED_HEADER_SIZE = 8;
+
+// inflated once on first use and kept, like the embedded data itself
+static std::mutex sInflatedMutex;
+static std::map< std::string, std::pair< std::shared_ptr<unsigned char>, size_t > > sInflated;
+
+static bool getEmbeddedData(const std::string& path, const Res2hEntry& entry, std::shared_ptr<unsigned char>& data, size_t& size)
+{
+	if(entry.size < EMBEDDED_COMPRESSED_HEADER_SIZE || memcmp(entry.data, EMBEDDED_COMPRESSED_MAGIC, 4) != 0)
+	{
+		data = std::shared_ptr<unsigned char>(const_cast<unsigned char*>(entry.data), nop_deleter);
+		size = entry.size;
+		return true;
+	}
+
+	std::unique_lock<std::mutex> lock(sInflatedMutex);
+
+	auto it = sInflated.find(path);
+	if(it != sInflated.end())
+	{
+		data = it->second.first;
+		size = it->second.second;
+		return true;
+	}
+
+	const size_t inflatedSize = (size_t)entry.data[4] | ((size_t)entry.data[5] << 8) | ((size_t)entry.data[6] << 16) | ((size_t)entry.data[7] << 24);
+	std::shared_ptr<unsigned char> inflated = allocateBuffer(inflatedSize);
+
+	uLongf destLength = (uLongf)inflatedSize;
+	if(uncompress(inflated.get(), &destLength, entry.data + EMBEDDED_COMPRESSED_HEADER_SIZE, (uLong)(entry.size - EMBEDDED_COMPRESSED_HEADER_SIZE)) != Z_OK 
+		|| destLength != inflatedSize)
+	{
+		LOG(LogError) << "Could not decompress embedded resource \"" << path << "\"!";
+		return false;
+	}
+
+	sInflated[path] = std::make_pair(inflated, inflatedSize);
+	data = inflated;
+	size = inflatedSize;
+	return true;
+}
+
 ResourceManager::ResourceManager()
 {
 }
@@ -29,12 +96,16 @@ const ResourceData ResourceManager::getFileData(const std::string& path) const
 	
 	if(res2hMap.find(path) != res2hMap.end())
 	{
-		//it is
-		Res2hEntry embeddedEntry = res2hMap.find(path)->second;
-		ResourceData data = { 
-			std::shared_ptr<unsigned char>(const_cast<unsigned char*>(embeddedEntry.data), nop_deleter), 
-			embeddedEntry.size
-		};
+		//it is (and might need inflating first)
+		std::shared_ptr<unsigned char> embeddedData;
+		size_t embeddedSize = 0;
+		if(!getEmbeddedData(path, res2hMap.find(path)->second, embeddedData, embeddedSize))
+		{
+			ResourceData data = {NULL, 0};
+			return data;
+		}
+
+		ResourceData data = { embeddedData, embeddedSize };
 		return data;
 	}
 
@@ -52,14 +123,38 @@ const ResourceData ResourceManager::getFileData(const std::string& path) const
 
 ResourceData ResourceManager::loadFile(const std::string& path) const
 {
+#ifndef WIN32
+	// big files (fonts, sounds, images) are mapped instead of copied to the heap, so they're paged in as they're used
+	// and share the page cache with anything else reading them
+	int fd = open(path.c_str(), O_RDONLY);
+	if(fd >= 0)
+	{
+		struct stat st;
+		if(fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size >= MMAP_MIN_SIZE)
+		{
+			const size_t size = (size_t)st.st_size;
+			void* mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+			close(fd);
+
+			if(mapped != MAP_FAILED)
+			{
+				std::shared_ptr<unsigned char> data((unsigned char*)mapped, [size](unsigned char* p) { munmap(p, size); });
+				ResourceData ret = {data, size};
+				return ret;
+			}
+		}else{
+			close(fd);
+		}
+	}
+#endif
+
 	std::ifstream stream(path, std::ios::binary);
 
 	stream.seekg(0, stream.end);
 	size_t size = (size_t)stream.tellg();
 	stream.seekg(0, stream.beg);
 
-	//supply custom deleter to properly free array
-	std::shared_ptr<unsigned char> data(new unsigned char[size], array_deleter);
+	std::shared_ptr<unsigned char> data = allocateBuffer(size);
 	stream.read((char*)data.get(), size);
 	stream.close();
 
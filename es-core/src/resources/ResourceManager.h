@@ -9,6 +9,7 @@
 //Allow loading resources embedded into the executable like an actual file.
 //Allow embedded resources to be optionally remapped to actual files for further customization.
 
+// ptr is read-only: files on disk may be memory mapped (see loadFile()).
 struct ResourceData
 {
 	const std::shared_ptr<unsigned char> ptr;
@@ -4,10 +4,61 @@
 #include "Log.h"
 #include "Util.h"
 #include "ImageIO.h"
+#include "resources/TextureLoader.h"
+#include "resources/ThumbnailCache.h"
+#include <list>
+#include <sstream>
 
 #define DPI 96
+#define RASTER_MEMORY_CACHE_SIZE (4 * 1024 * 1024) // bytes of recently rasterized pixels kept around
 
-SVGResource::SVGResource(const std::string& path, bool tile) : TextureResource(path, tile), mSVGImage(NULL)
+namespace
+{
+	struct CachedRaster
+	{
+		std::string key;
+		std::vector<unsigned char> pixels;
+		size_t width;
+		size_t height;
+	};
+
+	// most recently used first, only touched from the render thread
+	std::list<CachedRaster> sRasterCache;
+	size_t sRasterCacheSize = 0;
+
+	const CachedRaster* findCachedRaster(const std::string& key)
+	{
+		for(auto it = sRasterCache.begin(); it != sRasterCache.end(); it++)
+		{
+			if(it->key == key)
+			{
+				sRasterCache.splice(sRasterCache.begin(), sRasterCache, it);
+				return &sRasterCache.front();
+			}
+		}
+
+		return NULL;
+	}
+
+	void addCachedRaster(const std::string& key, const std::vector<unsigned char>& pixels, size_t width, size_t height)
+	{
+		if(pixels.size() > RASTER_MEMORY_CACHE_SIZE || findCachedRaster(key))
+			return;
+
+		CachedRaster raster = { key, pixels, width, height };
+		sRasterCache.push_front(raster);
+		sRasterCacheSize += pixels.size();
+
+		while(sRasterCacheSize > RASTER_MEMORY_CACHE_SIZE)
+		{
+			sRasterCacheSize -= sRasterCache.back().pixels.size();
+			sRasterCache.pop_back();
+		}
+	}
+}
+
+SVGResource::SVGResource(const std::string& path, bool tile) : TextureResource(path, tile), mContentHash(0), mRasterSerial(0),
+	mPendingSize(Eigen::Vector2i::Zero())
 {
 	mLastWidth = 0;
 	mLastHeight = 0;
@@ -30,20 +81,18 @@ void SVGResource::initFromMemory(const char* file, size_t length)
 	deinitSVG();
 
 	// nsvgParse excepts a modifiable, null-terminated string
-	char* copy = (char*)malloc(length + 1);
-	assert(copy != NULL);
-	memcpy(copy, file, length);
-	copy[length] = '\0';
-
-	mSVGImage = nsvgParse(copy, "px", DPI);
-	free(copy);
+	std::string copy(file, length);
+	mContentHash = std::hash<std::string>()(copy);
 
-	if(!mSVGImage)
+	NSVGimage* image = nsvgParse(&copy[0], "px", DPI);
+	if(!image)
 	{
 		LOG(LogError) << "Error parsing SVG image.";
 		return;
 	}
 
+	mSVGImage = std::shared_ptr<NSVGimage>(image, nsvgDelete);
+
 	if(mLastWidth && mLastHeight)
 		rasterizeAt(mLastWidth, mLastHeight);
 	else
@@ -71,17 +120,77 @@ void SVGResource::rasterizeAt(size_t width, size_t height)
 		mLastHeight = height;
 	}
 
-	unsigned char* imagePx = (unsigned char*)malloc(width * height * 4);
-	assert(imagePx != NULL);
+	const Eigen::Vector2i size((int)width, (int)height);
+
+	// already there or on its way
+	if(size == mPendingSize || (mPendingSize.isZero() && isInitialized() && getSize() == size))
+		return;
+
+	std::stringstream ss;
+	ss << "svg|" << mPath << "|" << mContentHash << "|" << width << "x" << height;
+	const std::string key = ss.str();
+
+	// anything still being rasterized is out of date now
+	mRasterSerial++;
+	mPendingSize = Eigen::Vector2i::Zero();
+
+	const CachedRaster* cached = findCachedRaster(key);
+	if(cached)
+	{
+		initFromPixels(cached->pixels.data(), cached->width, cached->height);
+		return;
+	}
+
+	mPendingSize = size;
+
+	// with nothing to show meanwhile, look like any other texture that's still loading
+	if(!isInitialized())
+		mLoadPending = true;
+
+	std::shared_ptr<NSVGimage> svgImage = mSVGImage;
+	const unsigned int serial = mRasterSerial;
 
-	NSVGrasterizer* rast = nsvgCreateRasterizer();
-	nsvgRasterize(rast, mSVGImage, 0, 0, height / mSVGImage->height, imagePx, width, height, width * 4);
-	nsvgDeleteRasterizer(rast);
+	TextureLoader::getInstance()->queue(shared_from_this(), 
+		[svgImage, key, width, height](std::vector<unsigned char>& pixels, size_t& outWidth, size_t& outHeight) {
+			if(ThumbnailCache::loadByKey(key, pixels, outWidth, outHeight) && outWidth == width && outHeight == height)
+				return true;
 
-	ImageIO::flipPixelsVert(imagePx, width, height);
+			pixels.resize(width * height * 4);
 
-	initFromPixels(imagePx, width, height);
-	free(imagePx);
+			// a rasterizer of its own, nanosvg keeps no global state so this is safe off the render thread
+			NSVGrasterizer* rast = nsvgCreateRasterizer();
+			nsvgRasterize(rast, svgImage.get(), 0, 0, height / svgImage->height, pixels.data(), width, height, width * 4);
+			nsvgDeleteRasterizer(rast);
+
+			ImageIO::flipPixelsVert(pixels.data(), width, height);
+
+			outWidth = width;
+			outHeight = height;
+			ThumbnailCache::saveByKey(key, pixels, width, height);
+			return true;
+		}, 
+		[serial, key](const std::shared_ptr<TextureResource>& tex, const std::vector<unsigned char>& pixels, size_t w, size_t h) {
+			std::static_pointer_cast<SVGResource>(tex)->onRasterized(serial, key, pixels, w, h);
+		});
+}
+
+void SVGResource::onRasterized(unsigned int serial, const std::string& cacheKey, const std::vector<unsigned char>& imageRGBA, size_t width, size_t height)
+{
+	// unloaded or asked for a different size since
+	if(serial != mRasterSerial)
+		return;
+
+	mPendingSize = Eigen::Vector2i::Zero();
+	mLoadPending = false;
+
+	if(imageRGBA.empty())
+	{
+		LOG(LogError) << "Error rasterizing SVG image \"" << mPath << "\"";
+		return;
+	}
+
+	addCachedRaster(cacheKey, imageRGBA, width, height);
+	initFromPixels(imageRGBA.data(), width, height);
 }
 
 Eigen::Vector2f SVGResource::getSourceImageSize() const
@@ -94,8 +203,7 @@ Eigen::Vector2f SVGResource::getSourceImageSize() const
 
 void SVGResource::deinitSVG()
 {
-	if(mSVGImage)
-		nsvgDelete(mSVGImage);
-
-	mSVGImage = NULL;
+	mSVGImage.reset();
+	mRasterSerial++;
+	mPendingSize = Eigen::Vector2i::Zero();
 }
@@ -4,6 +4,9 @@
 
 struct NSVGimage;
 
+// Rasterizing happens in the background, through the TextureLoader. Results are cached by (SVG, width, height),
+// in memory and in the ThumbnailCache on disk, so loading the same theme again doesn't rasterize anything.
+// While a new size is being rasterized the old one stays in the texture.
 class SVGResource : public TextureResource
 {
 public:
@@ -21,7 +24,13 @@ protected:
 	SVGResource(const std::string& path, bool tile);
 	void deinitSVG();
 
-	NSVGimage* mSVGImage;
+	void onRasterized(unsigned int serial, const std::string& cacheKey, const std::vector<unsigned char>& imageRGBA, size_t width, size_t height);
+
+	std::shared_ptr<NSVGimage> mSVGImage; // shared with rasterize jobs still running
+	size_t mContentHash; // part of the cache key, so edited files (or embedded ones in a new build) aren't mixed up
 	size_t mLastWidth;
 	size_t mLastHeight;
+
+	unsigned int mRasterSerial; // bumped on every request, so stale rasterize results are ignored
+	Eigen::Vector2i mPendingSize; // size being rasterized, zero if nothing is
 };
@@ -0,0 +1,220 @@
+#include "resources/TextureAtlas.h"
+#include "Log.h"
+#include "Settings.h"
+#include "Renderer.h"
+#include "ResourceGovernor.h"
+#include <algorithm>
+#include <string.h>
+
+#define ATLAS_PAGE_SIZE 1024
+#define ATLAS_MAX_IMAGE_SIZE 128 // anything bigger gets its own texture
+#define ATLAS_BORDER 1 // px of each image's edge repeated around it, so linear filtering doesn't pick up its neighbours
+#define ATLAS_THUMBNAIL_MIN_CELL 64
+#define ATLAS_THUMBNAIL_MAX_CELL 256 // a grid tile, selected, with its border
+
+std::vector<TextureAtlas::Page*> TextureAtlas::sPages;
+std::vector<TextureAtlas::Page*> TextureAtlas::sThumbnailPages;
+
+struct TextureAtlas::Page
+{
+	GLuint textureID;
+	int size;
+	int cellSize; // thumbnail pages are cut into cells this big, 0 on the others
+	Eigen::Vector2i writePos;
+	int rowHeight;
+	unsigned int regionCount;
+
+	// slots given back, reused for images that fit in them
+	std::vector< std::pair<Eigen::Vector2i, Eigen::Vector2i> > freeSlots;
+
+	Page(int pageSize, int cell) : textureID(0), size(pageSize), cellSize(cell), writePos(0, 0), rowHeight(0), regionCount(0)
+	{
+		glGenTextures(1, &textureID);
+		Renderer::bindTexture(textureID);
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	}
+
+	~Page()
+	{
+		Renderer::deleteTexture(textureID);
+	}
+
+	bool findEmpty(const Eigen::Vector2i& slot, Eigen::Vector2i& cursorOut, Eigen::Vector2i& slotSizeOut)
+	{
+		for(auto it = freeSlots.begin(); it != freeSlots.end(); it++)
+		{
+			if(slot.x() <= it->second.x() && slot.y() <= it->second.y())
+			{
+				cursorOut = it->first;
+				slotSizeOut = it->second;
+				freeSlots.erase(it);
+				return true;
+			}
+		}
+
+		if(writePos.x() + slot.x() > size && writePos.y() + rowHeight + slot.y() <= size)
+		{
+			// row full, but it should fit on the next row
+			writePos << 0, writePos.y() + rowHeight;
+			rowHeight = 0;
+		}
+
+		if(writePos.x() + slot.x() > size || writePos.y() + slot.y() > size)
+			return false;
+
+		cursorOut = writePos;
+		slotSizeOut = slot;
+		writePos[0] += slot.x();
+
+		if(slot.y() > rowHeight)
+			rowHeight = slot.y();
+
+		return true;
+	}
+};
+
+bool TextureAtlas::isEligible(size_t width, size_t height)
+{
+	return width > 0 && height > 0 && width <= ATLAS_MAX_IMAGE_SIZE && height <= ATLAS_MAX_IMAGE_SIZE;
+}
+
+bool TextureAtlas::isThumbnailEligible(size_t width, size_t height)
+{
+	return width > 0 && height > 0 && width + ATLAS_BORDER * 2 <= ATLAS_THUMBNAIL_MAX_CELL && height + ATLAS_BORDER * 2 <= ATLAS_THUMBNAIL_MAX_CELL;
+}
+
+int TextureAtlas::getThumbnailCellSize(size_t width, size_t height)
+{
+	const size_t needed = std::max(width, height) + ATLAS_BORDER * 2;
+	int cell = ATLAS_THUMBNAIL_MIN_CELL;
+	while((size_t)cell < needed)
+		cell *= 2;
+	return cell;
+}
+
+bool TextureAtlas::add(const unsigned char* dataRGBA, size_t width, size_t height, Region& region)
+{
+	if(!isEligible(width, height) || !Settings::getInstance()->getBool("UseTextureAtlas"))
+		return false;
+
+	return addTo(sPages, 0, ATLAS_PAGE_SIZE, 0, dataRGBA, width, height, region);
+}
+
+bool TextureAtlas::addThumbnail(const unsigned char* dataRGBA, size_t width, size_t height, Region& region)
+{
+	const ResourceGovernor* governor = ResourceGovernor::getInstance();
+	const int maxPages = governor->getThumbnailAtlasPages();
+	if(!isThumbnailEligible(width, height) || maxPages <= 0 || !Settings::getInstance()->getBool("UseTextureAtlas"))
+		return false;
+
+	return addTo(sThumbnailPages, (size_t)maxPages, governor->getProfile().thumbnailPageSize, getThumbnailCellSize(width, height), 
+		dataRGBA, width, height, region);
+}
+
+bool TextureAtlas::isThumbnail(const Region& region)
+{
+	return region.page != NULL && region.page->cellSize != 0;
+}
+
+bool TextureAtlas::wouldMakeRoom(const Region& region, size_t width, size_t height)
+{
+	return isThumbnail(region) && (region.page->cellSize == getThumbnailCellSize(width, height) || region.page->regionCount == 1);
+}
+
+bool TextureAtlas::addTo(std::vector<Page*>& pages, size_t maxPages, int newPageSize, int cellSize, const unsigned char* dataRGBA, size_t width, size_t height, Region& region)
+{
+	remove(region);
+
+	// a thumbnail takes a whole cell of its size class, so any freed one fits the next of that class and the pages never fragment
+	const Eigen::Vector2i slotSize = cellSize != 0 ? Eigen::Vector2i(cellSize, cellSize) :
+		Eigen::Vector2i((int)width + ATLAS_BORDER * 2, (int)height + ATLAS_BORDER * 2);
+
+	Page* page = NULL;
+	Eigen::Vector2i pos, foundSize;
+	for(auto it = pages.begin(); it != pages.end(); it++)
+	{
+		if((*it)->cellSize == cellSize && (*it)->findEmpty(slotSize, pos, foundSize))
+		{
+			page = *it;
+			break;
+		}
+	}
+
+	if(!page)
+	{
+		if(maxPages != 0 && pages.size() >= maxPages)
+			return false;
+
+		page = new Page(newPageSize, cellSize);
+		pages.push_back(page);
+		if(!page->findEmpty(slotSize, pos, foundSize))
+		{
+			LOG(LogError) << "Image too big to fit on a new atlas page (" << width << "x" << height << ")!";
+			return false;
+		}
+	}
+
+	// the image with its edge pixels repeated around it
+	const size_t paddedWidth = width + ATLAS_BORDER * 2;
+	const size_t paddedHeight = height + ATLAS_BORDER * 2;
+	std::vector<unsigned char> padded(paddedWidth * paddedHeight * 4);
+	for(size_t y = 0; y < paddedHeight; y++)
+	{
+		const size_t srcY = (size_t)std::min(std::max((int)y - ATLAS_BORDER, 0), (int)height - 1);
+		const unsigned char* srcRow = dataRGBA + srcY * width * 4;
+		unsigned char* dstRow = padded.data() + y * paddedWidth * 4;
+
+		memcpy(dstRow + ATLAS_BORDER * 4, srcRow, width * 4);
+		for(int b = 0; b < ATLAS_BORDER; b++)
+		{
+			memcpy(dstRow + b * 4, srcRow, 4);
+			memcpy(dstRow + (paddedWidth - 1 - b) * 4, srcRow + (width - 1) * 4, 4);
+		}
+	}
+
+	Renderer::bindTexture(page->textureID);
+	Renderer::texSubImage2D(pos.x(), pos.y(), paddedWidth, paddedHeight, GL_RGBA, padded.data());
+
+	page->regionCount++;
+
+	const float pageSize = (float)page->size;
+	region.page = page;
+	region.slotPos = pos;
+	region.slotSize = foundSize;
+	region.textureID = page->textureID;
+	region.texCoordOffset << (pos.x() + ATLAS_BORDER) / pageSize, (pos.y() + ATLAS_BORDER) / pageSize;
+	region.texCoordScale << width / pageSize, height / pageSize;
+	return true;
+}
+
+void TextureAtlas::remove(Region& region)
+{
+	Page* page = region.page;
+	if(!page)
+		return;
+
+	page->freeSlots.push_back(std::make_pair(region.slotPos, region.slotSize));
+	region = Region();
+	page->regionCount--;
+
+	if(page->regionCount == 0)
+	{
+		std::vector<Page*>& pages = page->cellSize != 0 ? sThumbnailPages : sPages;
+		pages.erase(std::find(pages.begin(), pages.end(), page));
+		delete page;
+	}
+}
+
+size_t TextureAtlas::getMemUsage()
+{
+	size_t total = sPages.size() * ATLAS_PAGE_SIZE * ATLAS_PAGE_SIZE * 4;
+	for(auto it = sThumbnailPages.begin(); it != sThumbnailPages.end(); it++)
+		total += (size_t)(*it)->size * (*it)->size * 4;
+	return total;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include <Eigen/Dense>
+#include "platform.h"
+#include GLHEADER
+
+// Packs small, non-tiled textures (help icons, rating stars, ninepatch frames...) into shared pages,
+// so everything drawn with them uses the same few GL textures instead of one each.
+// Thumbnails (box art scaled down for a grid...) get pages of their own, each cut into equal cells of one size class
+// (64, 128 or 256px, the smallest that fits). There are only ever ResourceGovernor::getThumbnailAtlasPages() of those,
+// as big as the MemoryProfile says, so VRAM for them stays the same however big the library: once they're full,
+// addThumbnail() fails and the owner has to make room (TextureResource evicts the least recently drawn one).
+// Pages are freed once the last image on them is removed. Must only be used from the render thread.
+class TextureAtlas
+{
+public:
+	struct Page;
+
+	// Where an image ended up. Maps texture coordinates in [0..1] for the image into the page.
+	struct Region
+	{
+		Region() : textureID(0), texCoordOffset(0, 0), texCoordScale(1, 1), page(NULL) {}
+
+		GLuint textureID; // the page's texture, 0 if the image isn't in the atlas
+		Eigen::Vector2f texCoordOffset;
+		Eigen::Vector2f texCoordScale;
+
+		Page* page;
+		Eigen::Vector2i slotPos;
+		Eigen::Vector2i slotSize; // size of the slot, including the border
+	};
+
+	// True if an image this size would be put in the atlas (if the "UseTextureAtlas" setting is on).
+	static bool isEligible(size_t width, size_t height);
+
+	// Copies an RGBA image (bottom row first, like every other texture) into a page. Returns false if it isn't eligible.
+	static bool add(const unsigned char* dataRGBA, size_t width, size_t height, Region& region);
+
+	// True if an image this size fits in a thumbnail cell.
+	static bool isThumbnailEligible(size_t width, size_t height);
+
+	// As add(), onto the thumbnail pages. Returns false if it isn't eligible or every cell is taken.
+	static bool addThumbnail(const unsigned char* dataRGBA, size_t width, size_t height, Region& region);
+
+	// True if region is on a thumbnail page.
+	static bool isThumbnail(const Region& region);
+
+	// True if removing region would let addThumbnail() take an image this size (same size class, or its page empties).
+	static bool wouldMakeRoom(const Region& region, size_t width, size_t height);
+
+	// Gives the region's space back, resetting it.
+	static void remove(Region& region);
+
+	static size_t getMemUsage(); // VRAM used by all pages (in bytes)
+
+private:
+	static int getThumbnailCellSize(size_t width, size_t height);
+
+	// maxPages 0 is unlimited, newPageSize is for pages it has to make, cellSize 0 packs images as they come instead of into cells
+	static bool addTo(std::vector<Page*>& pages, size_t maxPages, int newPageSize, int cellSize, const unsigned char* dataRGBA, size_t width, size_t height, Region& region);
+
+	static std::vector<Page*> sPages;
+	static std::vector<Page*> sThumbnailPages;
+};
@@ -0,0 +1,99 @@
+#include "resources/TextureLoader.h"
+#include "resources/TextureResource.h"
+#include "Log.h"
+#include "Trace.h"
+#include "TaskScheduler.h"
+
+// decoding is mostly waiting on the SD card/disk, a couple at a time is plenty
+static const unsigned int WORKER_COUNT = 2;
+
+TextureLoader* TextureLoader::getInstance()
+{
+	static TextureLoader instance;
+	return &instance;
+}
+
+TextureLoader::TextureLoader() : mRunning(0)
+{
+}
+
+TextureLoader::~TextureLoader()
+{
+	// the scheduler is made after us (on the first queue()), so its workers are already gone
+	std::unique_lock<std::mutex> lock(mMutex);
+	mJobs.clear();
+}
+
+void TextureLoader::load(const std::shared_ptr<TextureResource>& tex, const std::string& path, const Eigen::Vector2i& maxSize, bool makePreview)
+{
+	queue(tex, 
+		[path, maxSize, makePreview](std::vector<unsigned char>& pixels, size_t& width, size_t& height) { return TextureResource::loadPixels(path, maxSize, pixels, width, height, makePreview); }, 
+		[](const std::shared_ptr<TextureResource>& tex, const std::vector<unsigned char>& pixels, size_t width, size_t height) { tex->onAsyncLoaded(pixels, width, height); });
+}
+
+void TextureLoader::queue(const std::shared_ptr<TextureResource>& tex, const WorkFunc& work, const DoneFunc& done)
+{
+	bool start = false;
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+
+		Job job = { tex, work, done };
+		mJobs.push_back(job);
+
+		if(mRunning < WORKER_COUNT)
+		{
+			mRunning++;
+			start = true;
+		}
+	}
+
+	if(start)
+		submitNext();
+}
+
+void TextureLoader::submitNext()
+{
+	TaskScheduler::getInstance()->submit([this] { runNext(); }, TaskScheduler::PRIORITY_INTERACTIVE);
+}
+
+void TextureLoader::runNext()
+{
+	// skips the ones nobody wants anymore
+	Job job;
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		while(!mJobs.empty() && mJobs.back().texture.expired())
+			mJobs.pop_back();
+
+		if(mJobs.empty())
+		{
+			mRunning--;
+			return;
+		}
+
+		job = mJobs.back();
+		mJobs.pop_back();
+	}
+
+	// shared, the pixels are too big to be copied along with the job
+	std::shared_ptr<Result> result = std::make_shared<Result>();
+	result->texture = job.texture;
+	result->done = job.done;
+	result->width = 0;
+	result->height = 0;
+
+	{
+		TRACE_SCOPE("texture decode");
+		if(!job.work(result->pixels, result->width, result->height))
+			result->pixels.clear();
+	}
+
+	TaskScheduler::getInstance()->runOnMainThread([result] {
+		std::shared_ptr<TextureResource> tex = result->texture.lock();
+		if(tex)
+			result->done(tex, result->pixels, result->width, result->height);
+	});
+
+	// the newest job by then, not the one after this, is what's on screen
+	submitNext();
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <functional>
+#include <Eigen/Dense>
+
+class TextureResource;
+
+// Reads and decodes textures on the TaskScheduler (as interactive tasks). The decoded pixels are handed back to
+// the render thread as main thread jobs, which TaskScheduler::update() uploads a few per frame, within a time budget.
+class TextureLoader
+{
+public:
+	static TextureLoader* getInstance();
+
+	// Queue tex (loaded from path) for decoding. The most recently queued textures are decoded first,
+	// since when scrolling through a list those are the ones actually on screen.
+	// makePreview is passed on to TextureResource::loadPixels().
+	void load(const std::shared_ptr<TextureResource>& tex, const std::string& path, const Eigen::Vector2i& maxSize, bool makePreview = false);
+
+	// Function run on a worker thread to produce RGBA pixels. Returns false if it failed.
+	typedef std::function<bool(std::vector<unsigned char>& pixels, size_t& width, size_t& height)> WorkFunc;
+	// Called on the render thread with the result (pixels are empty if work failed), if tex is still around by then.
+	typedef std::function<void(const std::shared_ptr<TextureResource>& tex, const std::vector<unsigned char>& pixels, size_t width, size_t height)> DoneFunc;
+
+	// As load(), but for anything else that produces pixels for tex (e.g. rasterizing an SVG).
+	void queue(const std::shared_ptr<TextureResource>& tex, const WorkFunc& work, const DoneFunc& done);
+
+private:
+	TextureLoader();
+	~TextureLoader();
+
+	struct Job
+	{
+		std::weak_ptr<TextureResource> texture;
+		WorkFunc work;
+		DoneFunc done;
+	};
+
+	struct Result
+	{
+		std::weak_ptr<TextureResource> texture;
+		DoneFunc done;
+		std::vector<unsigned char> pixels; // RGBA, empty if decoding failed
+		size_t width;
+		size_t height;
+	};
+
+	// each running task decodes the newest job, then queues itself again for the next one (or gives up its slot)
+	void submitNext();
+	void runNext();
+
+	std::mutex mMutex;
+	std::deque<Job> mJobs;
+	unsigned int mRunning; // tasks on the scheduler, at most WORKER_COUNT
+};
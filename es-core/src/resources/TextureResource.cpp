@@ -1,52 +1,369 @@
 #include "resources/TextureResource.h"
 #include "Log.h"
+#include "Trace.h"
+#include "Metrics.h"
 #include "platform.h"
 #include GLHEADER
 #include "ImageIO.h"
 #include "Renderer.h"
 #include "Util.h"
 #include "resources/SVGResource.h"
+#include "resources/TextureLoader.h"
+#include "resources/ThumbnailCache.h"
+#include "Settings.h"
+#include "ResourceGovernor.h"
+#include "Hash.h"
+#include <algorithm>
+#include <string.h>
+#include <SDL.h>
+
+#ifdef USE_OPENGL_DESKTOP
+// not part of GL 1.1, so it's not necessarily exported by the GL library itself (e.g. on Windows)
+typedef void (APIENTRY *CompressedTexImage2DProc)(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, 
+	GLint border, GLsizei imageSize, const GLvoid* data);
+
+static void compressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, 
+	GLsizei imageSize, const GLvoid* data)
+{
+	static CompressedTexImage2DProc proc = (CompressedTexImage2DProc)Renderer::getProcAddress("glCompressedTexImage2D");
+	if(proc)
+		proc(target, level, internalformat, width, height, 0, imageSize, data);
+}
+#else
+static void compressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, 
+	GLsizei imageSize, const GLvoid* data)
+{
+	glCompressedTexImage2D(target, level, internalformat, width, height, 0, imageSize, data);
+}
+#endif
+
+#ifdef USE_OPENGL_DESKTOP
+// GL 3.0 or GL_EXT_framebuffer_object
+typedef void (APIENTRY *GenerateMipmapProc)(GLenum target);
+
+static GenerateMipmapProc getGenerateMipmap()
+{
+	static GenerateMipmapProc proc = Renderer::getProcAddress("glGenerateMipmap") ? 
+		(GenerateMipmapProc)Renderer::getProcAddress("glGenerateMipmap") : (GenerateMipmapProc)Renderer::getProcAddress("glGenerateMipmapEXT");
+	return proc;
+}
+#else
+// GLES 1 only has GL_GENERATE_MIPMAP, which builds them when level 0 is uploaded
+typedef void (*GenerateMipmapProc)(GLenum target);
+
+static GenerateMipmapProc getGenerateMipmap()
+{
+	return NULL;
+}
+#endif
+
+// previews are scaled to fit this, so they're only a few KB to read
+#define PREVIEW_SIZE 32
+
+static bool canMipmap(size_t width, size_t height)
+{
+#ifdef USE_OPENGL_ES
+	// GLES 1 can't mipmap non power of two textures
+	if((width & (width - 1)) != 0 || (height & (height - 1)) != 0)
+		return false;
+#endif
+	return width > 0 && height > 0;
+}
 
 std::map< TextureResource::TextureKeyType, std::weak_ptr<TextureResource> > TextureResource::sTextureMap;
-std::list< std::weak_ptr<TextureResource> > TextureResource::sTextureList;
+std::map< TextureResource::ContentKeyType, std::weak_ptr<TextureResource> > TextureResource::sContentMap;
+std::unordered_set<TextureResource*> TextureResource::sTextures;
+std::unordered_set<TextureResource*> TextureResource::sDeferred;
+bool TextureResource::sDeferReloads = false;
+unsigned int TextureResource::sDeferFrame = 0;
+size_t TextureResource::sLoadedMemUsage = 0;
+unsigned int TextureResource::sCurrentFrame = 0;
 
 TextureResource::TextureResource(const std::string& path, bool tile) : 
-	mTextureID(0), mPath(path), mTextureSize(Eigen::Vector2i::Zero()), mTile(tile)
+	mTextureID(0), mPath(path), mTextureSize(Eigen::Vector2i::Zero()), mTile(tile), mMaxSize(Eigen::Vector2i::Zero()), mAsync(false), mMipmapped(false), mHasMipmaps(false), mLoadPending(false), mEvicted(false), mPreview(false), mLastUsedFrame(0), mGeneration(0), mMemUsage(0), mCreatedTime(SDL_GetTicks()), mHasContentKey(false)
 {
+	sTextures.insert(this);
 }
 
 TextureResource::~TextureResource()
 {
 	deinit();
+	sTextures.erase(this);
+	sDeferred.erase(this);
+
+	// drop the map entries that pointed here (already expired), or they'd pile up over a long uptime
+	auto found = sTextureMap.find(TextureKeyType(mPath, mTile, mMaxSize.x(), mMaxSize.y()));
+	if(found != sTextureMap.end() && found->second.expired())
+		sTextureMap.erase(found);
+
+	if(mHasContentKey)
+	{
+		auto content = sContentMap.find(mContentKey);
+		if(content != sContentMap.end() && content->second.expired())
+			sContentMap.erase(content);
+	}
 }
 
 void TextureResource::unload(std::shared_ptr<ResourceManager>& rm)
 {
 	deinit();
+	mLoadPending = false;
 }
 
 void TextureResource::reload(std::shared_ptr<ResourceManager>& rm)
 {
-	if(!mPath.empty())
+	// evicted textures wait for their next bind()
+	if(mPath.empty() || mEvicted)
+		return;
+
+	if(mAsync)
+	{
+		if(!mLoadPending)
+		{
+			mLoadPending = true;
+
+			// the first time this image is decoded there's no preview yet, the loader leaves one for next time
+			const bool makePreview = !mMaxSize.isZero() && !isInitialized() && !loadPreview();
+			TextureLoader::getInstance()->load(shared_from_this(), mPath, mMaxSize, makePreview);
+		}
+	}else if(sDeferReloads)
+	{
+		// bind() loads it if it's drawn before restoreDeferred() gets to it
+		mEvicted = true;
+		sDeferred.insert(this);
+		sDeferFrame = sCurrentFrame;
+	}else{
+		loadNow(rm);
+	}
+}
+
+void TextureResource::loadNow(const std::shared_ptr<ResourceManager>& rm)
+{
+	// anything still coming from the loader will be ignored
+	mLoadPending = false;
+
+	if(ImageIO::isCompressedFile(mPath))
 	{
 		const ResourceData& data = rm->getFileData(mPath);
-		initFromMemory((const char*)data.ptr.get(), data.length);
+		ImageIO::CompressedImage image;
+		if(!ImageIO::loadCompressedFromMemory(data.ptr.get(), data.length, image))
+		{
+			LOG(LogError) << "Could not initialize texture, invalid compressed data!  (file path: " << mPath << ")";
+			return;
+		}
+
+		initFromCompressed(image);
+		return;
+	}
+
+	if(!mMaxSize.isZero())
+	{
+		std::vector<unsigned char> imageRGBA;
+		size_t width, height;
+		if(!loadPixels(mPath, mMaxSize, imageRGBA, width, height))
+		{
+			LOG(LogError) << "Could not initialize texture, invalid data!  (file path: " << mPath << ")";
+			return;
+		}
+
+		initDeduplicated(imageRGBA.data(), width, height);
+		return;
 	}
+
+	const ResourceData& data = rm->getFileData(mPath);
+	initFromMemory((const char*)data.ptr.get(), data.length);
+}
+
+bool TextureResource::loadPixels(const std::string& path, const Eigen::Vector2i& maxSize, std::vector<unsigned char>& imageRGBA, size_t& width, size_t& height, 
+	bool makePreview)
+{
+	// embedded resources are small and have no mtime to key on
+	const bool useCache = !maxSize.isZero() && path.substr(0, 2) != ":/";
+	if(!useCache || !ThumbnailCache::load(path, maxSize, imageRGBA, width, height))
+	{
+		const ResourceData data = ResourceManager::getInstance()->getFileData(path);
+		if(!data.ptr)
+			return false;
+
+		imageRGBA = ImageIO::loadFromMemoryRGBA32(data.ptr.get(), data.length, width, height, maxSize.x(), maxSize.y());
+		if(imageRGBA.empty())
+			return false;
+
+		if(useCache)
+			ThumbnailCache::save(path, maxSize, imageRGBA, width, height);
+	}
+
+	// shrunk from the thumbnail, which costs next to nothing compared to decoding it
+	if(useCache && makePreview)
+		savePreview(path, imageRGBA, width, height);
+
+	return true;
+}
+
+void TextureResource::savePreview(const std::string& path, const std::vector<unsigned char>& imageRGBA, size_t width, size_t height)
+{
+	std::vector<unsigned char> preview = imageRGBA;
+	size_t previewWidth = width, previewHeight = height;
+	ImageIO::shrinkRGBA32ToFit(preview, previewWidth, previewHeight, PREVIEW_SIZE, PREVIEW_SIZE);
+	ThumbnailCache::save(path, Eigen::Vector2i(PREVIEW_SIZE, PREVIEW_SIZE), preview, previewWidth, previewHeight);
+}
+
+bool TextureResource::loadPreview()
+{
+	if(mPath.substr(0, 2) == ":/")
+		return false;
+
+	std::vector<unsigned char> imageRGBA;
+	size_t width, height;
+	if(!ThumbnailCache::load(mPath, Eigen::Vector2i(PREVIEW_SIZE, PREVIEW_SIZE), imageRGBA, width, height))
+		return false;
+
+	deinit();
+	mGeneration++;
+
+	// a texture of its own, an atlas page's nearest neighbour magnification would make it blocky instead of blurred
+	glGenTextures(1, &mTextureID);
+	Renderer::bindTexture(mTextureID);
+	Renderer::texImage2D(width, height, GL_RGBA, imageRGBA.data());
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	mTextureSize << width, height;
+	mMemUsage = width * height * 4;
+	mHasMipmaps = false;
+	mPreview = true;
+
+	sLoadedMemUsage += mMemUsage;
+	mLastUsedFrame = sCurrentFrame;
+	return true;
+}
+
+void TextureResource::onAsyncLoaded(const std::vector<unsigned char>& dataRGBA, size_t width, size_t height)
+{
+	// unloaded (or loaded synchronously) since this was queued
+	if(!mLoadPending)
+		return;
+
+	mLoadPending = false;
+
+	if(dataRGBA.empty())
+	{
+		LOG(LogError) << "Could not initialize texture, invalid data!  (file path: " << mPath << ")";
+		deinit(); // no preview of a picture that isn't there
+		return;
+	}
+
+	initDeduplicated(dataRGBA.data(), width, height);
+}
+
+void TextureResource::initDeduplicated(const unsigned char* dataRGBA, size_t width, size_t height)
+{
+	// textures without a path can't come back after an unload, they'd better not be anyone's original
+	if(mPath.empty() || !Settings::getInstance()->getBool("DedupeTextures"))
+	{
+		initFromPixels(dataRGBA, width, height);
+		return;
+	}
+
+	// the CRC alone would collide somewhere in a library of thousands of images, and showing the wrong box art is worse than
+	// not sharing, so there's a second, unrelated hash too
+	const size_t length = width * height * 4;
+	const uint32_t crc = crc32Update(0, dataRGBA, length);
+	uint64_t hash = 0xcbf29ce484222325ULL ^ length;
+	size_t i = 0;
+	for(; i + 8 <= length; i += 8)
+	{
+		uint64_t word;
+		memcpy(&word, dataRGBA + i, 8);
+		hash = (hash ^ word) * 0x100000001b3ULL;
+		hash ^= hash >> 29;
+	}
+	for(; i < length; i++)
+		hash = (hash ^ dataRGBA[i]) * 0x100000001b3ULL;
+
+	const ContentKeyType key(crc, hash, width, height, mTile);
+	auto found = sContentMap.find(key);
+	std::shared_ptr<TextureResource> original = (found != sContentMap.end()) ? found->second.lock() : nullptr;
+	if(original && original.get() != this && !original->mAlias && !original->mPreview && original->isInitialized())
+	{
+		deinit();
+		mAlias = original;
+		mGeneration++;
+		mTextureSize << width, height;
+		if(mMipmapped)
+			mAlias->setMipmapped(true);
+		return;
+	}
+
+	initFromPixels(dataRGBA, width, height);
+	sContentMap[key] = shared_from_this();
+	mContentKey = key;
+	mHasContentKey = true;
 }
 
 void TextureResource::initFromPixels(const unsigned char* dataRGBA, size_t width, size_t height)
 {
+	TRACE_SCOPE("texture upload", mPath);
+
 	deinit();
 
 	assert(width > 0 && height > 0);
 
+	mGeneration++;
+
+	// repeating needs a texture of its own, and mipmaps would bleed into the neighbours
+	if(!mTile && !mMipmapped && TextureAtlas::add(dataRGBA, width, height, mAtlasRegion))
+	{
+		mTextureSize << width, height;
+		return;
+	}
+
+	// scaled down (so a grid tile or some such), it can share a thumbnail page with the rest
+	if(!mTile && !mMipmapped && !mMaxSize.isZero() && TextureAtlas::isThumbnailEligible(width, height) && 
+		(TextureAtlas::addThumbnail(dataRGBA, width, height, mAtlasRegion) || 
+		(evictThumbnail(width, height) && TextureAtlas::addThumbnail(dataRGBA, width, height, mAtlasRegion))))
+	{
+		mTextureSize << width, height;
+		mLastUsedFrame = sCurrentFrame;
+		return;
+	}
+
+	const bool mipmap = mMipmapped && canMipmap(width, height);
+	GenerateMipmapProc generateMipmap = getGenerateMipmap();
+
 	//now for the openGL texture stuff
 	glGenTextures(1, &mTextureID);
-	glBindTexture(GL_TEXTURE_2D, mTextureID);
+	Renderer::bindTexture(mTextureID);
 
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, dataRGBA);
+	if(mipmap && !generateMipmap)
+		glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE);
 
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	while(glGetError() != GL_NO_ERROR);
+	Renderer::texImage2D(width, height, GL_RGBA, dataRGBA);
+	if(glGetError() == GL_OUT_OF_MEMORY)
+	{
+		// a missing image beats whatever the driver does once it's out, make room and try once more
+		relieveMemoryPressure(this);
+		Renderer::bindTexture(mTextureID);
+		Renderer::texImage2D(width, height, GL_RGBA, dataRGBA);
+		if(glGetError() == GL_OUT_OF_MEMORY)
+		{
+			LOG(LogError) << "Could not upload texture, out of video memory  (file path: " << mPath << ")";
+			Renderer::deleteTexture(mTextureID);
+			mTextureID = 0;
+			return;
+		}
+	}
+
+	if(mipmap && generateMipmap)
+		generateMipmap(GL_TEXTURE_2D);
+
+	mHasMipmaps = mipmap;
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, mipmap ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
 	const GLint wrapMode = mTile ? GL_REPEAT : GL_CLAMP_TO_EDGE;
@@ -54,6 +371,118 @@ void TextureResource::initFromPixels(const unsigned char* dataRGBA, size_t width
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapMode);
 
 	mTextureSize << width, height;
+	mMemUsage = width * height * 4;
+	if(mipmap)
+		mMemUsage += mMemUsage / 3; // the whole chain adds about a third
+
+	sLoadedMemUsage += mMemUsage;
+	mLastUsedFrame = sCurrentFrame; // don't evict it before it's had a chance to be drawn
+}
+
+bool TextureResource::initFromCompressed(const ImageIO::CompressedImage& image)
+{
+	deinit();
+
+	if(!isCompressedFormatSupported(image.glFormat))
+	{
+		LOG(LogError) << "Compressed texture format 0x" << std::hex << image.glFormat << std::dec << " is not supported by this GPU  (file path: " << mPath << ")";
+		return false;
+	}
+
+	mGeneration++;
+
+	glGenTextures(1, &mTextureID);
+	Renderer::bindTexture(mTextureID);
+
+	while(glGetError() != GL_NO_ERROR);
+	compressedTexImage2D(GL_TEXTURE_2D, 0, image.glFormat, image.width, image.height, image.data.size(), image.data.data());
+	Renderer::countTextureUpload();
+	GLenum error = glGetError();
+	if(error == GL_OUT_OF_MEMORY)
+	{
+		relieveMemoryPressure(this);
+		Renderer::bindTexture(mTextureID);
+		compressedTexImage2D(GL_TEXTURE_2D, 0, image.glFormat, image.width, image.height, image.data.size(), image.data.data());
+		Renderer::countTextureUpload();
+		error = glGetError();
+	}
+	if(error != GL_NO_ERROR)
+	{
+		LOG(LogError) << "Could not upload compressed texture  (file path: " << mPath << ")";
+		Renderer::deleteTexture(mTextureID);
+		mTextureID = 0;
+		return false;
+	}
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+	const GLint wrapMode = mTile ? GL_REPEAT : GL_CLAMP_TO_EDGE;
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapMode);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapMode);
+
+	mTextureSize << image.width, image.height;
+	mMemUsage = image.data.size();
+	mHasMipmaps = false;
+
+	sLoadedMemUsage += mMemUsage;
+	mLastUsedFrame = sCurrentFrame;
+	return true;
+}
+
+bool TextureResource::isCompressedFormatSupported(unsigned int glFormat)
+{
+	// GL_COMPRESSED_TEXTURE_FORMATS lists everything the driver can take, on both GLES 1.1 and desktop GL 1.3+
+	static std::vector<GLint> formats;
+	static bool queried = false;
+	if(!queried)
+	{
+		queried = true;
+		GLint count = 0;
+		glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &count);
+		if(count > 0)
+		{
+			formats.resize(count);
+			glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, formats.data());
+		}
+	}
+
+	return std::find(formats.begin(), formats.end(), (GLint)glFormat) != formats.end();
+}
+
+void TextureResource::setMipmapped(bool mipmapped)
+{
+	if(!mipmapped || mMipmapped)
+		return;
+
+	mMipmapped = true;
+
+	if(mAlias)
+	{
+		mAlias->setMipmapped(true);
+		return;
+	}
+
+	// not uploaded yet (it'll get them then), only a preview so far, atlased, or compressed
+	if(mTextureID == 0 || mPreview || mHasMipmaps || ImageIO::isCompressedFile(mPath) || !canMipmap(mTextureSize.x(), mTextureSize.y()))
+		return;
+
+	GenerateMipmapProc generateMipmap = getGenerateMipmap();
+	if(generateMipmap)
+	{
+		Renderer::bindTexture(mTextureID);
+		generateMipmap(GL_TEXTURE_2D);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+
+		sLoadedMemUsage += mMemUsage / 3;
+		mMemUsage += mMemUsage / 3;
+		mHasMipmaps = true;
+	}else if(!mPath.empty())
+	{
+		// level 0 has to be uploaded again for GL_GENERATE_MIPMAP to do anything
+		std::shared_ptr<ResourceManager>& rm = ResourceManager::getInstance();
+		reload(rm);
+	}
 }
 
 void TextureResource::initFromMemory(const char* data, size_t length)
@@ -67,14 +496,19 @@ void TextureResource::initFromMemory(const char* data, size_t length)
 		return;
 	}
 
-	initFromPixels(imageRGBA.data(), width, height);
+	initDeduplicated(imageRGBA.data(), width, height);
 }
 
 void TextureResource::deinit()
 {
+	TextureAtlas::remove(mAtlasRegion);
+	mPreview = false;
+	mAlias.reset();
+
 	if(mTextureID != 0)
 	{
-		glDeleteTextures(1, &mTextureID);
+		sLoadedMemUsage -= getMemUsage();
+		Renderer::deleteTexture(mTextureID);
 		mTextureID = 0;
 	}
 }
@@ -89,16 +523,32 @@ bool TextureResource::isTiled() const
 	return mTile;
 }
 
-void TextureResource::bind() const
+void TextureResource::bind()
 {
-	if(mTextureID != 0)
-		glBindTexture(GL_TEXTURE_2D, mTextureID);
+	if(mAlias)
+	{
+		mLastUsedFrame = sCurrentFrame;
+		mAlias->bind();
+		return;
+	}
+
+	if(mEvicted)
+	{
+		mEvicted = false;
+		loadNow(ResourceManager::getInstance());
+	}
+
+	mLastUsedFrame = sCurrentFrame;
+
+	const GLuint textureID = getGLTexture();
+	if(textureID != 0)
+		Renderer::bindTexture(textureID);
 	else
 		LOG(LogError) << "Tried to bind uninitialized texture!";
 }
 
 
-std::shared_ptr<TextureResource> TextureResource::get(const std::string& path, bool tile)
+std::shared_ptr<TextureResource> TextureResource::get(const std::string& path, bool tile, bool async, const Eigen::Vector2i& maxSize)
 {
 	std::shared_ptr<ResourceManager>& rm = ResourceManager::getInstance();
 
@@ -111,33 +561,52 @@ std::shared_ptr<TextureResource> TextureResource::get(const std::string& path, b
 		return tex;
 	}
 
-	TextureKeyType key(canonicalPath, tile);
+	const bool isSVG = canonicalPath.size() >= 4 && canonicalPath.substr(canonicalPath.size() - 4, std::string::npos) == ".svg";
+
+	// SVGs are rasterized at whatever size they're drawn at anyway, and compressed textures can't be scaled (or decoded in the background)
+	const bool isCompressed = ImageIO::isCompressedFile(canonicalPath);
+	const Eigen::Vector2i scaleTo = (isSVG || isCompressed) ? Eigen::Vector2i(Eigen::Vector2i::Zero()) : maxSize;
+
+	static Metrics::Counter* cacheHits = Metrics::getCounter("es_texture_cache_hits_total", "TextureResource::get() calls that found a live texture");
+	static Metrics::Counter* cacheMisses = Metrics::getCounter("es_texture_cache_misses_total", "TextureResource::get() calls that had to create a texture");
+
+	TextureKeyType key(canonicalPath, tile, scaleTo.x(), scaleTo.y());
 	auto foundTexture = sTextureMap.find(key);
 	if(foundTexture != sTextureMap.end())
 	{
 		if(!foundTexture->second.expired())
-			return foundTexture->second.lock();
+		{
+			cacheHits->add();
+			std::shared_ptr<TextureResource> tex = foundTexture->second.lock();
+
+			// a synchronous caller expects to be able to use it right away
+			if(!async && tex->mLoadPending)
+				tex->loadNow(rm);
+
+			return tex;
+		}
 	}
 
 	// need to create it
+	cacheMisses->add();
 	std::shared_ptr<TextureResource> tex;
 
 	// is it an SVG?
-	if(key.first.substr(key.first.size() - 4, std::string::npos) == ".svg")
+	if(isSVG)
 	{
 		// probably
 		// don't add it to our map because 2 svgs might be rasterized at different sizes
-		tex = std::shared_ptr<SVGResource>(new SVGResource(key.first, tile));
-		sTextureList.push_back(tex); // add it to our list though
+		tex = std::shared_ptr<SVGResource>(new SVGResource(canonicalPath, tile));
 		rm->addReloadable(tex);
 		tex->reload(rm);
 		return tex;
 	}else{
 		// normal texture
-		tex = std::shared_ptr<TextureResource>(new TextureResource(key.first, tile));
+		tex = std::shared_ptr<TextureResource>(new TextureResource(canonicalPath, tile));
 		sTextureMap[key] = std::weak_ptr<TextureResource>(tex);
-		sTextureList.push_back(tex);
 		rm->addReloadable(tex);
+		tex->mAsync = async && !isCompressed;
+		tex->mMaxSize = scaleTo;
 		tex->reload(ResourceManager::getInstance());
 		return tex;
 	}
@@ -145,34 +614,174 @@ std::shared_ptr<TextureResource> TextureResource::get(const std::string& path, b
 
 bool TextureResource::isInitialized() const
 {
-	return mTextureID != 0;
+	// an evicted texture is still usable, bind() brings it back
+	if(mAlias)
+		return mAlias->isInitialized();
+	return mTextureID != 0 || mAtlasRegion.textureID != 0 || mEvicted;
 }
 
 size_t TextureResource::getMemUsage() const
 {
-	if(!mTextureID || mTextureSize.x() == 0 || mTextureSize.y() == 0)
+	if(!mTextureID)
 		return 0;
 
-	return mTextureSize.x() * mTextureSize.y() * 4;
+	return mMemUsage;
 }
 
 size_t TextureResource::getTotalMemUsage()
 {
-	size_t total = 0;
+	// sLoadedMemUsage is kept up to date on every upload and deinit
+	size_t total = TextureAtlas::getMemUsage() + sLoadedMemUsage;
+
+	return total;
+}
+
+void TextureResource::logLiveTextures()
+{
+	std::vector<const TextureResource*> textures(sTextures.begin(), sTextures.end());
+	std::sort(textures.begin(), textures.end(), 
+		[](const TextureResource* a, const TextureResource* b) { return a->getMemUsage() > b->getMemUsage(); });
+
+	const unsigned int now = SDL_GetTicks();
+	LOG(LogInfo) << sTextures.size() << " live textures, " << sLoadedMemUsage / 1024 << "kb in their own textures and " 
+		<< TextureAtlas::getMemUsage() / 1024 << "kb of atlas pages";
+	for(auto it = textures.begin(); it != textures.end(); it++)
+	{
+		const TextureResource* tex = *it;
+
+		const char* storage = "not loaded";
+		if(tex->mAlias)
+			storage = "shared";
+		else if(tex->mEvicted)
+			storage = "evicted";
+		else if(tex->mAtlasRegion.textureID != 0)
+			storage = "atlas";
+		else if(tex->mPreview)
+			storage = "preview";
+		else if(tex->mTextureID != 0)
+			storage = "texture";
+
+		LOG(LogInfo) << "  " << (tex->mPath.empty() ? "(from memory)" : tex->mPath) << " " << tex->mTextureSize.x() << "x" << tex->mTextureSize.y() 
+			<< " " << tex->getMemUsage() / 1024 << "kb " << storage << ", " << (now - tex->mCreatedTime) / 1000 << "s old, " 
+			<< (sCurrentFrame - tex->mLastUsedFrame) << " frames since drawn";
+	}
+}
+
+void TextureResource::setDeferReloads(bool defer)
+{
+	sDeferReloads = defer;
+}
+
+bool TextureResource::restoreDeferred(int budgetMs)
+{
+	// the first frame after the reload hasn't been drawn yet, it gets to pick what comes first
+	if(sDeferred.empty() || sCurrentFrame <= sDeferFrame)
+		return false;
 
-	auto it = sTextureList.begin();
-	while(it != sTextureList.end())
+	std::vector<TextureResource*> textures;
+	for(auto it = sDeferred.begin(); it != sDeferred.end(); it++)
 	{
-		if((*it).expired())
+		// already brought back by bind()
+		if((*it)->mEvicted)
+			textures.push_back(*it);
+	}
+
+	std::sort(textures.begin(), textures.end(), 
+		[](const TextureResource* a, const TextureResource* b) { return a->mLastUsedFrame > b->mLastUsedFrame; });
+
+	const int maxVRAM = ResourceGovernor::getInstance()->getMaxVRAM();
+	const size_t budget = (size_t)maxVRAM * 1024 * 1024;
+	const unsigned int start = SDL_GetTicks();
+	bool loaded = false;
+	auto it = textures.begin();
+	for(; it != textures.end() && (int)(SDL_GetTicks() - start) < budgetMs; it++)
+	{
+		// the rest would only be evicted again, they can wait for their bind()
+		if(maxVRAM > 0 && getTotalMemUsage() > budget)
 		{
-			// remove expired textures from the list
-			it = sTextureList.erase(it);
-			continue;
+			it = textures.end();
+			break;
 		}
 
-		total += (*it).lock()->getMemUsage();
-		it++;
+		(*it)->mEvicted = false;
+		(*it)->loadNow(ResourceManager::getInstance());
+		loaded = true;
 	}
 
-	return total;
+	sDeferred = std::unordered_set<TextureResource*>(it, textures.end());
+	return loaded;
+}
+
+void TextureResource::enforceVRAMBudget()
+{
+	sCurrentFrame++;
+
+	const int maxVRAM = ResourceGovernor::getInstance()->getMaxVRAM();
+	if(maxVRAM <= 0)
+		return;
+
+	const unsigned int evicted = evictTo((size_t)maxVRAM * 1024 * 1024, NULL);
+	if(evicted)
+		LOG(LogDebug) << "Over VRAM budget, evicted " << evicted << " textures (now using " << sLoadedMemUsage / 1024 << "kb)";
+}
+
+void TextureResource::relieveMemoryPressure(const TextureResource* uploading)
+{
+	ResourceGovernor::getInstance()->onMemoryPressure(sLoadedMemUsage + TextureAtlas::getMemUsage());
+
+	// the caches let go of theirs above, what's left that isn't on screen goes too
+	const unsigned int evicted = evictTo(0, uploading);
+	LOG(LogWarning) << "Evicted " << evicted << " textures to make room (now using " << sLoadedMemUsage / 1024 << "kb)";
+}
+
+bool TextureResource::evictThumbnail(size_t width, size_t height)
+{
+	TextureResource* oldest = NULL;
+	for(auto it = sTextures.begin(); it != sTextures.end(); it++)
+	{
+		TextureResource* tex = *it;
+		if(TextureAtlas::wouldMakeRoom(tex->mAtlasRegion, width, height) && !tex->mPath.empty() && !tex->mPreview && 
+			tex->mLastUsedFrame + 1 < sCurrentFrame && (!oldest || tex->mLastUsedFrame < oldest->mLastUsedFrame))
+			oldest = tex;
+	}
+
+	// everything on them is on screen
+	if(!oldest)
+		return false;
+
+	oldest->deinit();
+	oldest->mEvicted = true;
+	return true;
+}
+
+unsigned int TextureResource::evictTo(size_t budget, const TextureResource* keep)
+{
+	// atlas pages can't be evicted, but they do count
+	const size_t atlasMemUsage = TextureAtlas::getMemUsage();
+	if(sLoadedMemUsage + atlasMemUsage <= budget)
+		return 0;
+
+	// anything drawn last frame is probably still on screen, leave it alone
+	// textures loaded from memory (no path) can't be brought back, so they stay too
+	std::vector<TextureResource*> candidates;
+	for(auto it = sTextures.begin(); it != sTextures.end(); it++)
+	{
+		TextureResource* tex = *it;
+
+		// a preview would come back as the full image, synchronously
+		if(tex != keep && tex->mTextureID != 0 && !tex->mPath.empty() && !tex->mPreview && tex->mLastUsedFrame + 1 < sCurrentFrame)
+			candidates.push_back(tex);
+	}
+
+	std::sort(candidates.begin(), candidates.end(), 
+		[](const TextureResource* a, const TextureResource* b) { return a->mLastUsedFrame < b->mLastUsedFrame; });
+
+	unsigned int evicted = 0;
+	for(auto tex = candidates.begin(); tex != candidates.end() && sLoadedMemUsage + atlasMemUsage > budget; tex++)
+	{
+		(*tex)->deinit();
+		(*tex)->mEvicted = true;
+		evicted++;
+	}
+	return evicted;
 }
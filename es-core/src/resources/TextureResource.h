@@ -3,16 +3,36 @@
 #include "resources/ResourceManager.h"
 
 #include <string>
+#include <vector>
+#include <tuple>
+#include <unordered_set>
 #include <Eigen/Dense>
+#include "ImageIO.h"
+#include "resources/TextureAtlas.h"
 #include "platform.h"
 #include GLHEADER
 
 // An OpenGL texture.
 // Automatically recreates the texture with renderer deinit/reinit.
-class TextureResource : public IReloadable
+class TextureResource : public IReloadable, public std::enable_shared_from_this<TextureResource>
 {
 public:
-	static std::shared_ptr<TextureResource> get(const std::string& path, bool tile = false);
+	// If async is set, the image is decoded in the background and the texture stays uninitialized (isLoading()) until it's
+	// uploaded a frame or so later. SVGs are always loaded right away.
+	// If maxSize is set, images bigger than that are scaled down to fit before they're uploaded (and kept in the ThumbnailCache).
+	// If both are, a tiny preview from the ThumbnailCache (when there is one) is shown, blurry, until the real image is ready.
+	// KTX/DDS files are uploaded as-is (still compressed), so they ignore async and maxSize.
+	static std::shared_ptr<TextureResource> get(const std::string& path, bool tile = false, bool async = false, 
+		const Eigen::Vector2i& maxSize = Eigen::Vector2i::Zero());
+
+	// Reads and decodes path (scaled to fit maxSize if it's set), using the ThumbnailCache if it can. Thread-safe.
+	// If makePreview is set (and maxSize is), the preview is (re)written to the ThumbnailCache from the result too.
+	static bool loadPixels(const std::string& path, const Eigen::Vector2i& maxSize, std::vector<unsigned char>& imageRGBA, size_t& width, size_t& height, 
+		bool makePreview = false);
+
+	// Writes the tiny preview an async, downscaled texture of path shows while it loads (see isPreview()) to the ThumbnailCache,
+	// from a decoded copy of the image, for code that already has one (e.g. it just wrote the file). Thread-safe.
+	static void savePreview(const std::string& path, const std::vector<unsigned char>& imageRGBA, size_t width, size_t height);
 
 	virtual ~TextureResource();
 
@@ -20,9 +40,35 @@ public:
 	virtual void reload(std::shared_ptr<ResourceManager>& rm) override;
 	
 	bool isInitialized() const;
+	inline bool isLoading() const { return mLoadPending; }
+	// Loading, but there's a low resolution stand-in to draw meanwhile (isInitialized() is true, getSize() is the preview's).
+	inline bool isPreview() const { return mPreview; }
 	bool isTiled() const;
 	const Eigen::Vector2i& getSize() const;
-	void bind() const;
+	void bind(); // reloads the texture first if it was evicted
+
+	// Small non-tiled textures are put in a TextureAtlas page, so texture coordinates have to go through here.
+	// Maps (u, v) in [0..1] over this texture to where it actually is in the bound GL texture.
+	inline Eigen::Vector2f getTexCoord(float u, float v) const 
+	{ 
+		const TextureAtlas::Region& region = mAlias ? mAlias->mAtlasRegion : mAtlasRegion;
+		return Eigen::Vector2f(region.texCoordOffset.x() + u * region.texCoordScale.x(), 
+			region.texCoordOffset.y() + v * region.texCoordScale.y()); 
+	}
+
+	// Changes every time the texture is (re)uploaded, which can move it to a different place in the atlas.
+	// Anything holding on to coordinates from getTexCoord() should rebuild them when this changes.
+	// (Both only ever count up, so the sum changes whenever either does.)
+	inline unsigned int getGeneration() const { return mAlias ? mGeneration + mAlias->getGeneration() : mGeneration; }
+
+	// Builds mipmaps and samples them trilinearly, for textures drawn a lot smaller than they are.
+	// Sticks once enabled (the texture is shared). Without glGenerateMipmap (GLES 1) the texture is uploaded again.
+	// Atlased, compressed and (on GLES) non power of two textures are left alone.
+	void setMipmapped(bool mipmapped);
+	inline bool isMipmapped() const { return mMipmapped; }
+
+	// True if both end up binding the same GL texture (i.e. are on the same atlas page), so they can be drawn in one go.
+	inline bool sharesTextureWith(const TextureResource& other) const { return getGLTexture() != 0 && getGLTexture() == other.getGLTexture(); }
 	
 	// Warning: will NOT correctly reinitialize when this texture is reloaded (e.g. ES starts/stops playing a game).
 	virtual void initFromMemory(const char* file, size_t length);
@@ -30,22 +76,89 @@ public:
 	// Warning: will NOT correctly reinitialize when this texture is reloaded (e.g. ES starts/stops playing a game).
 	void initFromPixels(const unsigned char* dataRGBA, size_t width, size_t height);
 
+	// Uploads the base level of a compressed image. Fails (with an error logged) if the GPU doesn't support its format.
+	bool initFromCompressed(const ImageIO::CompressedImage& image);
+
+	// True if the current GL context can sample textures in this compressed format. Needs a context.
+	static bool isCompressedFormatSupported(unsigned int glFormat);
+
+	// Called by the TextureLoader on the render thread once the pixels are decoded (empty if that failed).
+	void onAsyncLoaded(const std::vector<unsigned char>& dataRGBA, size_t width, size_t height);
+
 	size_t getMemUsage() const; // returns an approximation of the VRAM used by this texture (in bytes)
 	static size_t getTotalMemUsage(); // returns an approximation of total VRAM used by textures (in bytes)
 
+	// Logs every live texture, biggest first: path, size, VRAM, age and how it's stored. For tracking down what's
+	// holding on to VRAM after a long uptime (Ctrl-M with --debug).
+	static void logLiveTextures();
+
+	// Call once per frame. If textures use more than the "MaxVRAM" setting (or the ResourceGovernor's cap), the ones bound
+	// least recently are unloaded from VRAM (they come back on their next bind()).
+	static void enforceVRAMBudget();
+
+	// While set, reload() leaves synchronous textures unloaded (like evicted ones) instead of reading them, so re-initializing
+	// after a game doesn't wait on every texture: whatever's drawn first comes back on its bind(), and the rest in restoreDeferred().
+	static void setDeferReloads(bool defer);
+
+	// Call once per frame. Loads textures left behind by a deferred reload, most recently drawn first, for up to budgetMs.
+	// Returns true if it loaded any.
+	static bool restoreDeferred(int budgetMs);
+
 protected:
 	TextureResource(const std::string& path, bool tile);
 	void deinit();
 
+	void loadNow(const std::shared_ptr<ResourceManager>& rm);
+
 	Eigen::Vector2i mTextureSize;
 	const std::string mPath;
 	const bool mTile;
+	Eigen::Vector2i mMaxSize;
+	bool mLoadPending; // isLoading()
 
 private:
+	bool loadPreview();
+
+	// unloads the least recently bound textures (not keep, nor anything drawn last frame) until they fit budget, returns how many
+	static unsigned int evictTo(size_t budget, const TextureResource* keep);
+	// frees the thumbnail atlas cell bound least recently (not drawn last frame) whose removal makes room for an image this
+	// size, returns false if there's none
+	static bool evictThumbnail(size_t width, size_t height);
+	// after a failed upload: the ResourceGovernor has the caches drop what they can, and everything evictable is evicted
+	static void relieveMemoryPressure(const TextureResource* uploading);
+
+	// With "DedupeTextures", pixels identical to a texture that's already uploaded just point this one at it (mAlias).
+	void initDeduplicated(const unsigned char* dataRGBA, size_t width, size_t height);
+
+	inline GLuint getGLTexture() const { return mAlias ? mAlias->getGLTexture() : (mAtlasRegion.textureID != 0 ? mAtlasRegion.textureID : mTextureID); }
+
 	GLuint mTextureID;
+	TextureAtlas::Region mAtlasRegion;
+	bool mAsync;
+	bool mMipmapped; // wanted
+	bool mHasMipmaps; // what's actually uploaded
+	bool mEvicted;
+	bool mPreview; // isPreview()
+	unsigned int mLastUsedFrame;
+	unsigned int mGeneration;
+	size_t mMemUsage; // bytes uploaded, compressed textures use a lot less than 4 per pixel
+	const unsigned int mCreatedTime; // SDL_GetTicks()
+	std::shared_ptr<TextureResource> mAlias; // the texture with the same pixels that's drawn instead, if any
+
+	static bool sDeferReloads;
+	static unsigned int sDeferFrame; // sCurrentFrame when the last deferred reload happened
+	static std::unordered_set<TextureResource*> sDeferred; // left for restoreDeferred(), they're also mEvicted
 
-	typedef std::pair<std::string, bool> TextureKeyType;
+	static size_t sLoadedMemUsage; // running total of getMemUsage(), cheaper than getTotalMemUsage()
+	static unsigned int sCurrentFrame;
+
+	typedef std::tuple<std::string, bool, int, int> TextureKeyType; // path, tile, max width, max height
 	static std::map< TextureKeyType, std::weak_ptr<TextureResource> > sTextureMap; // map of textures, used to prevent duplicate textures
 
-	static std::list< std::weak_ptr<TextureResource> > sTextureList; // list of all textures, used for memory approximations
+	typedef std::tuple<uint32_t, uint64_t, size_t, size_t, bool> ContentKeyType; // CRC-32 and a 64 bit hash of the pixels, width, height, tile
+	static std::map< ContentKeyType, std::weak_ptr<TextureResource> > sContentMap; // uploaded textures by their pixels, for "DedupeTextures"
+	ContentKeyType mContentKey; // where this is in sContentMap, if it is
+	bool mHasContentKey;
+
+	static std::unordered_set<TextureResource*> sTextures; // every texture, added and removed by the constructor and destructor
 };
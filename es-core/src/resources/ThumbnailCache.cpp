@@ -0,0 +1,230 @@
+#include "resources/ThumbnailCache.h"
+#include "platform.h"
+#include "BinaryIO.h"
+#include "Log.h"
+#include "Settings.h"
+#include "TaskScheduler.h"
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <thread>
+#include <time.h>
+
+namespace fs = boost::filesystem;
+
+namespace ThumbnailCache
+{
+	static const char THUMBNAIL_MAGIC[4] = { 'E', 'S', 'T', 'C' };
+	static const uint32_t THUMBNAIL_VERSION = 1;
+	static const unsigned int PRUNE_INTERVAL = 256; // writes between checks of the cache's size
+	static const std::time_t TOUCH_INTERVAL = 60 * 60; // an entry's use is only recorded (in its mtime) this often
+
+	static std::atomic<unsigned long long> sMaxBytes(0); // 0 = no limit, read once by init() so workers never touch Settings
+	static std::atomic<unsigned int> sWrites(0);
+	static std::atomic<bool> sPruning(false);
+
+	static std::string getCacheDir()
+	{
+		return getHomePath() + "/.emulationstation/cache/thumbnails";
+	}
+
+	// the full key is stored in the file too, the hash only picks the file name
+	static std::string getCachePath(const std::string& key)
+	{
+		std::stringstream name;
+		name << std::hex << std::setw(16) << std::setfill('0') << (unsigned long long)std::hash<std::string>()(key);
+		return getCacheDir() + "/" + name.str() + ".rgba";
+	}
+
+	struct Entry
+	{
+		std::time_t used;
+		unsigned long long size;
+		fs::path path;
+	};
+
+	// deletes the least recently used entries until the cache is a bit under the cap, so it isn't over again on the next write
+	static void prune()
+	{
+		const unsigned long long maxBytes = sMaxBytes;
+		if(maxBytes == 0)
+			return;
+
+		std::vector<Entry> entries;
+		unsigned long long total = 0;
+		boost::system::error_code ec;
+		for(fs::directory_iterator it(getCacheDir(), ec), end; !ec && it != end; it.increment(ec))
+		{
+			if(it->path().extension() != ".rgba")
+				continue;
+
+			boost::system::error_code entryEc;
+			Entry entry;
+			entry.size = fs::file_size(it->path(), entryEc);
+			entry.used = fs::last_write_time(it->path(), entryEc);
+			if(entryEc)
+				continue;
+
+			entry.path = it->path();
+			total += entry.size;
+			entries.push_back(entry);
+		}
+
+		if(total <= maxBytes)
+			return;
+
+		std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.used < b.used; });
+
+		const unsigned long long target = maxBytes - maxBytes / 10;
+		unsigned int removed = 0;
+		for(auto it = entries.begin(); it != entries.end() && total > target; it++)
+		{
+			if(fs::remove(it->path, ec))
+			{
+				total -= it->size;
+				removed++;
+			}
+		}
+
+		LOG(LogInfo) << "Thumbnail cache: deleted " << removed << " least recently used entries, " << (total / (1024 * 1024)) << "MB left";
+	}
+
+	// at most one at a time, and off whichever thread asked for it
+	static void schedulePrune()
+	{
+		if(sMaxBytes == 0 || sPruning.exchange(true))
+			return;
+
+		TaskScheduler::getInstance()->submit([] {
+			prune();
+			sPruning = false;
+		});
+	}
+
+	void init()
+	{
+		const int maxMB = Settings::getInstance()->getInt("ThumbnailCacheSize");
+		sMaxBytes = maxMB > 0 ? (unsigned long long)maxMB * 1024 * 1024 : 0;
+		schedulePrune();
+	}
+
+	static bool getKey(const std::string& path, const Eigen::Vector2i& maxSize, std::string& key)
+	{
+		boost::system::error_code ec;
+		std::time_t mtime = fs::last_write_time(path, ec);
+		if(ec)
+			return false;
+
+		std::stringstream ss;
+		ss << path << "|" << (long long)mtime << "|" << maxSize.x() << "x" << maxSize.y();
+		key = ss.str();
+		return true;
+	}
+
+	bool load(const std::string& path, const Eigen::Vector2i& maxSize, std::vector<unsigned char>& imageRGBA, size_t& width, size_t& height)
+	{
+		std::string key;
+		return getKey(path, maxSize, key) && loadByKey(key, imageRGBA, width, height);
+	}
+
+	void save(const std::string& path, const Eigen::Vector2i& maxSize, const std::vector<unsigned char>& imageRGBA, size_t width, size_t height)
+	{
+		std::string key;
+		if(getKey(path, maxSize, key))
+			saveByKey(key, imageRGBA, width, height);
+	}
+
+	bool loadByKey(const std::string& key, std::vector<unsigned char>& imageRGBA, size_t& width, size_t& height)
+	{
+		const std::string cachePath = getCachePath(key);
+
+		std::ifstream in(cachePath.c_str(), std::ios::in | std::ios::binary);
+		if(!in.is_open())
+			return false;
+
+		char magic[4];
+		uint32_t version, keyLength, w, h;
+		if(!in.read(magic, 4) || memcmp(magic, THUMBNAIL_MAGIC, 4) != 0 || !readU32(in, version) || version != THUMBNAIL_VERSION
+			|| !readU32(in, keyLength) || keyLength != key.size())
+			return false;
+
+		std::string storedKey(keyLength, '\0');
+		if(!in.read(&storedKey[0], keyLength) || storedKey != key || !readU32(in, w) || !readU32(in, h) || !w || !h)
+			return false;
+
+		imageRGBA.resize((size_t)w * h * 4);
+		if(!in.read((char*)imageRGBA.data(), imageRGBA.size()))
+		{
+			imageRGBA.clear();
+			return false;
+		}
+
+		in.close();
+
+		// marks it as used for prune(), without a write every time it's shown
+		boost::system::error_code ec;
+		const std::time_t now = time(NULL);
+		const std::time_t mtime = fs::last_write_time(cachePath, ec);
+		if(!ec && now - mtime > TOUCH_INTERVAL)
+			fs::last_write_time(cachePath, now, ec);
+
+		width = w;
+		height = h;
+		return true;
+	}
+
+	void saveByKey(const std::string& key, const std::vector<unsigned char>& imageRGBA, size_t width, size_t height)
+	{
+		if(imageRGBA.size() != width * height * 4)
+			return;
+
+		const std::string cachePath = getCachePath(key);
+
+		boost::system::error_code ec;
+		fs::create_directories(fs::path(cachePath).parent_path(), ec);
+
+		// written under a temporary name first, so a half-written entry is never picked up
+		std::stringstream tmpName;
+		tmpName << cachePath << "." << std::this_thread::get_id() << ".tmp";
+		const std::string tmpPath = tmpName.str();
+		{
+			std::ofstream out(tmpPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+			if(!out.is_open())
+			{
+				LOG(LogWarning) << "Could not write thumbnail cache entry \"" << tmpPath << "\"";
+				return;
+			}
+
+			out.write(THUMBNAIL_MAGIC, 4);
+			writeU32(out, THUMBNAIL_VERSION);
+			writeU32(out, (uint32_t)key.size());
+			out.write(key.data(), key.size());
+			writeU32(out, (uint32_t)width);
+			writeU32(out, (uint32_t)height);
+			out.write((const char*)imageRGBA.data(), imageRGBA.size());
+
+			if(!out.good())
+			{
+				out.close();
+				fs::remove(tmpPath, ec);
+				return;
+			}
+		}
+
+		fs::rename(tmpPath, cachePath, ec);
+		if(ec)
+		{
+			fs::remove(tmpPath, ec);
+			return;
+		}
+
+		if(++sWrites % PRUNE_INTERVAL == 0)
+			schedulePrune();
+	}
+}
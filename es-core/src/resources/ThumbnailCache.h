@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <Eigen/Dense>
+
+// Keeps images that were scaled down for display in ~/.emulationstation/cache/thumbnails, as raw RGBA
+// ready to upload, so showing the same box art again skips reading and decoding the full-size original.
+// Entries are keyed by source path, its mtime and the size they were scaled to fit.
+// Safe to use from several threads (as long as they aren't writing the same entry).
+// Kept under ThumbnailCacheSize MB: loading an entry marks it used, and the least recently used ones are deleted when it's
+// over, checked at startup and after every few hundred writes.
+namespace ThumbnailCache
+{
+	// Reads the size cap and trims the cache to it in the background. Call once from the main thread at startup.
+	void init();
+
+	// Returns false if there's no (up to date) entry.
+	bool load(const std::string& path, const Eigen::Vector2i& maxSize, std::vector<unsigned char>& imageRGBA, size_t& width, size_t& height);
+
+	void save(const std::string& path, const Eigen::Vector2i& maxSize, const std::vector<unsigned char>& imageRGBA, size_t width, size_t height);
+
+	// As above, for images that aren't a file on disk scaled down (e.g. rasterized SVGs). The caller's key has to
+	// change whenever the image would.
+	bool loadByKey(const std::string& key, std::vector<unsigned char>& imageRGBA, size_t& width, size_t& height);
+	void saveByKey(const std::string& key, const std::vector<unsigned char>& imageRGBA, size_t width, size_t height);
+}